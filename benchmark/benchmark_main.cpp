@@ -0,0 +1,118 @@
+//===----------------------- benchmark_main.cpp ---------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#define CATCH_CONFIG_RUNNER
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mpi.h>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "benchmark_utilities.h"
+
+/**
+ * @brief Reports the throughput of all benchmarks that registered their number
+ * of processed cells. The throughput is printed after each benchmark and all
+ * results are written to alpaca_benchmark.csv at the end of the run.
+ */
+class CellThroughputListener : public Catch::TestEventListenerBase {
+
+  // name, cells per run, mean time per run in seconds
+  std::vector<std::tuple<std::string, double, double>> results_;
+
+public:
+  using TestEventListenerBase::TestEventListenerBase;
+
+  /**
+   * @brief Prints the throughput of a finished benchmark.
+   * @param stats The statistics of the benchmark.
+   */
+  void benchmarkEnded(Catch::BenchmarkStats<> const &stats) override {
+    auto const cells = BenchmarkUtilities::CellsPerRun().find(stats.info.name);
+    if (cells == BenchmarkUtilities::CellsPerRun().end()) {
+      return;
+    }
+    double const seconds =
+        std::chrono::duration<double>(stats.mean.point).count();
+    results_.emplace_back(stats.info.name, cells->second, seconds);
+    std::cout << std::scientific << std::setprecision(3) << stats.info.name
+              << ": " << cells->second / seconds << " cells/s\n"
+              << std::defaultfloat;
+  }
+
+  /**
+   * @brief Writes the throughput of all benchmarks.
+   */
+  void testRunEnded(Catch::TestRunStats const &) override {
+    if (results_.empty()) {
+      return;
+    }
+    std::ofstream output("alpaca_benchmark.csv");
+    output << "benchmark,cells_per_run,seconds_per_run,cells_per_second\n";
+    output << std::scientific << std::setprecision(6);
+    for (auto const &[name, cells, seconds] : results_) {
+      output << name << "," << cells << "," << seconds << "," << cells / seconds
+             << "\n";
+    }
+  }
+};
+
+CATCH_REGISTER_LISTENER(CellThroughputListener)
+
+/**
+ * @brief Prints the starting message of the benchmarks.
+ */
+void PrintStartupMessage() {
+  std::cout << "\n"
+            << "                                  \\\\\n"
+            << "                                  l '>\n"
+            << "                                  | |\n"
+            << "                                  | |\n"
+            << "                                  |   AlpacaBench~\n"
+            << "                                  ||    || \n"
+            << "                                  ''    '' \n"
+            << "\n";
+}
+
+int main(int argc, char *argv[]) {
+
+  MPI_Init(&argc, &argv);
+  int number_of_ranks = -1;
+  MPI_Comm_size(MPI_COMM_WORLD, &number_of_ranks);
+  // Kernels are measured on a single core, concurrent ranks would only disturb
+  // the timings
+  if (number_of_ranks != 1) {
+    std::cout << "AlpacaBench has to be run with a single MPI rank\n";
+    MPI_Finalize();
+    return EXIT_FAILURE;
+  }
+
+  PrintStartupMessage();
+  int const result = Catch::Session().run(argc, argv);
+
+  MPI_Finalize();
+
+  return result;
+}
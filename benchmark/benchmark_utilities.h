@@ -0,0 +1,154 @@
+//===--------------------- benchmark_utilities.h --------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef BENCHMARK_UTILITIES_H
+#define BENCHMARK_UTILITIES_H
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "block_definitions/block.h"
+#include "materials/material_manager.h"
+#include "materials/material_type_definitions.h"
+#include "prime_states/prime_state_handler.h"
+#include "unit_handler.h"
+
+/**
+ * @brief Provides the common setup of the micro-benchmarks, i.e. the
+ * registration of the processed cells and the creation of synthetic materials
+ * and blocks.
+ */
+namespace BenchmarkUtilities {
+
+/**
+ * @brief Gives the number of cells processed in a single run of each registered
+ * benchmark.
+ * @return Map from the benchmark name to its number of cells.
+ */
+inline std::unordered_map<std::string, double> &CellsPerRun() {
+  static std::unordered_map<std::string, double> cells_per_run;
+  return cells_per_run;
+}
+
+/**
+ * @brief Registers the number of cells a benchmark processes per run, such that
+ * its throughput is reported in cells per second. Use as name argument of the
+ * BENCHMARK macro.
+ * @param name The name of the benchmark.
+ * @param number_of_cells The number of cells processed in a single run.
+ * @return The name of the benchmark.
+ */
+inline std::string CellBenchmark(std::string const &name,
+                                 double const number_of_cells) {
+  CellsPerRun()[name] = number_of_cells;
+  return name;
+}
+
+/**
+ * @brief Gives the non-dimensional unit handler used in all benchmarks.
+ * @return The unit handler.
+ */
+inline UnitHandler const &BenchmarkUnitHandler() {
+  static UnitHandler const unit_handler(1.0, 1.0, 1.0, 1.0);
+  return unit_handler;
+}
+
+/**
+ * @brief Creates a material manager holding a single inviscid fluid.
+ * @param equation_of_state The equation of state of the fluid.
+ * @return The material manager.
+ */
+inline MaterialManager SingleMaterialManager(
+    std::unique_ptr<EquationOfState const> equation_of_state) {
+  std::vector<std::tuple<MaterialType, Material>> materials;
+  materials.emplace_back(
+      std::make_tuple(MaterialType::Fluid,
+                      Material(std::move(equation_of_state), 0.0, 0.0, 0.0, 0.0,
+                               nullptr, nullptr, BenchmarkUnitHandler())));
+  return MaterialManager(std::move(materials), std::vector<MaterialPairing>());
+}
+
+/**
+ * @brief Gives a smooth, non-trivial prime state at the given cell, which is
+ * valid for all equations of state used in the benchmarks.
+ * @param i, j, k The cell indices.
+ * @param prime_state The prime state.
+ * @return The value of the prime state.
+ */
+inline double SmoothPrimeState(unsigned int const i, unsigned int const j,
+                               unsigned int const k,
+                               PrimeState const prime_state) {
+  double const phase = 0.3 * double(i) + 0.2 * double(j) + 0.1 * double(k);
+  if (prime_state == PrimeState::Density) {
+    return 1.0 + 0.2 * std::sin(phase);
+  }
+  if (prime_state == PrimeState::Pressure) {
+    return 1.0 + 0.1 * std::cos(phase);
+  }
+  // Material parameters of the gamma model
+  if constexpr (MF::IsPrimeStateActive(PrimeState::gamma)) {
+    if (prime_state == PrimeState::gamma) {
+      return 1.4;
+    }
+  }
+  if constexpr (MF::IsPrimeStateActive(PrimeState::pi)) {
+    if (prime_state == PrimeState::pi) {
+      return 0.0;
+    }
+  }
+  // velocities and further prime states
+  return 0.1 + 0.05 * std::sin(2.0 * phase);
+}
+
+/**
+ * @brief Fills all cells of a block with a smooth flow state. The conservatives
+ * in the average and right-hand side buffers are consistent to the prime states
+ * with respect to the equation of state of the material.
+ * @param material_manager The material manager holding the material.
+ * @param material The material of the block.
+ * @param block The block to be filled (indirect return parameter).
+ */
+inline void FillSmoothFlowState(MaterialManager const &material_manager,
+                                MaterialName const material, Block &block) {
+  for (PrimeState const prime_state : MF::ASOP()) {
+    double(&values)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        block.GetPrimeStateBuffer(prime_state);
+    for (unsigned int i = 0; i < CC::TCX(); ++i) {
+      for (unsigned int j = 0; j < CC::TCY(); ++j) {
+        for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+          values[i][j][k] = SmoothPrimeState(i, j, k, prime_state);
+        }
+      }
+    }
+  }
+  PrimeStateHandler const prime_state_handler(material_manager);
+  prime_state_handler.ConvertPrimeStatesToConservatives(
+      material, block.GetPrimeStateBuffer(), block.GetAverageBuffer());
+  prime_state_handler.ConvertPrimeStatesToConservatives(
+      material, block.GetPrimeStateBuffer(), block.GetRightHandSideBuffer());
+}
+} // namespace BenchmarkUtilities
+
+#endif // BENCHMARK_UTILITIES_H
@@ -0,0 +1,190 @@
+//===------------- benchmark_levelset_reinitializers.cpp ------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_utilities.h"
+#include "boundary_condition/zero_gradient_boundary_condition.h"
+#include "enums/interface_tag_definition.h"
+#include "halo_manager.h"
+#include "interface_tags/interface_tag_functions.h"
+#include "levelset/multi_phase_manager/levelset_reinitializer/levelset_reinitializer_setup.h"
+#include "topology/id_information.h"
+#include "topology/topology_manager.h"
+#include "topology/tree.h"
+
+namespace {
+constexpr unsigned int maximum_level = 0;
+
+/**
+ * @brief Gives the level-set field of a sphere in the center of the block,
+ * distorted to twice the distance such that the reinitialization has to restore
+ * the signed-distance property. Values are given in cell sizes and cut off as
+ * done in the simulation.
+ * @param levelset The level-set field (indirect return parameter).
+ */
+void DistortedSphereLevelset(
+    double (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()]) {
+  double const radius = 0.25 * double(CC::ICX());
+  for (unsigned int i = 0; i < CC::TCX(); ++i) {
+    for (unsigned int j = 0; j < CC::TCY(); ++j) {
+      for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+        double const x =
+            double(i) - double(CC::FICX()) + 0.5 - 0.5 * double(CC::ICX());
+        double const y =
+            CC::DIM() != Dimension::One
+                ? double(j) - double(CC::FICY()) + 0.5 - 0.5 * double(CC::ICY())
+                : 0.0;
+        double const z =
+            CC::DIM() == Dimension::Three
+                ? double(k) - double(CC::FICZ()) + 0.5 - 0.5 * double(CC::ICZ())
+                : 0.0;
+        double const distortion = 2.0;
+        levelset[i][j][k] =
+            std::clamp(distortion * (std::sqrt(x * x + y * y + z * z) - radius),
+                       -CC::LSCOF(), CC::LSCOF());
+      }
+    }
+  }
+}
+
+/**
+ * @brief Creates the external halo manager with zero-gradient conditions on all
+ * sides of the domain.
+ * @return The external halo manager.
+ */
+std::unique_ptr<ExternalHaloManager const> ZeroGradientExternalHaloManager() {
+  std::array<std::unique_ptr<MaterialBoundaryCondition const>, 6>
+      material_boundary_conditions = {
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::East> const>(),
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::West> const>(),
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::North> const>(),
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::South> const>(),
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::Top> const>(),
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::Bottom> const>()};
+  std::array<std::unique_ptr<LevelsetBoundaryCondition const>, 6>
+      levelset_boundary_conditions = {
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::East> const>(),
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::West> const>(),
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::North> const>(),
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::South> const>(),
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::Top> const>(),
+          std::make_unique<
+              ZeroGradientBoundaryCondition<BoundaryLocation::Bottom> const>()};
+  return std::make_unique<ExternalHaloManager const>(
+      std::move(material_boundary_conditions),
+      std::move(levelset_boundary_conditions));
+}
+
+/**
+ * @brief Benchmarks the reinitialization of the distorted sphere on a single
+ * two-phase node. Each run restores the distorted level set first, which is
+ * negligible compared to the reinitialization itself.
+ * @param name The name of the reinitializer.
+ * @param halo_manager The halo manager of the single-node topology.
+ * @param node The two-phase node.
+ * @tparam Reinitializer The level-set reinitializer.
+ */
+template <typename Reinitializer>
+void BenchmarkReinitializer(std::string const &name, HaloManager &halo_manager,
+                            Node &node) {
+  double(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      node.GetInterfaceBlock().GetReinitializedBuffer(
+          InterfaceDescription::Levelset);
+  auto const distorted_levelset =
+      std::make_unique<double[]>(CC::TCX() * CC::TCY() * CC::TCZ());
+  DistortedSphereLevelset(levelset);
+  std::copy_n(&levelset[0][0][0], CC::TCX() * CC::TCY() * CC::TCZ(),
+              distorted_levelset.get());
+
+  Reinitializer const reinitializer(halo_manager);
+  std::vector<std::reference_wrapper<Node>> const nodes = {node};
+  constexpr double number_of_cells =
+      double(CC::ICX()) * double(CC::ICY()) * double(CC::ICZ());
+  BENCHMARK(BenchmarkUtilities::CellBenchmark("Reinitialization " + name,
+                                              number_of_cells)) {
+    std::copy_n(distorted_levelset.get(), CC::TCX() * CC::TCY() * CC::TCZ(),
+                &levelset[0][0][0]);
+    reinitializer.Reinitialize(
+        nodes, InterfaceDescriptionBufferType::Reinitialized, true);
+    return levelset[CC::FICX()][CC::FICY()][CC::FICZ()];
+  };
+}
+} // namespace
+
+TEST_CASE("Level-set reinitializers", "[benchmark][levelset]") {
+  constexpr MaterialName material_one = MaterialName::MaterialOne;
+  constexpr MaterialName material_two = MaterialName::MaterialTwo;
+
+  // Single two-phase node with zero-gradient boundaries
+  TopologyManager topology = TopologyManager({1, 1, 1}, maximum_level, 0);
+  Tree tree = Tree(topology, maximum_level, 1.0);
+  nid_t const id = IdSeed();
+  topology.AddMaterialToNode(id, material_one);
+  topology.AddMaterialToNode(id, material_two);
+  Node &node = tree.CreateNode(id, {material_one, material_two});
+  topology.UpdateTopology();
+  node.SetInterfaceBlock(std::make_unique<InterfaceBlock>(1.0));
+  DistortedSphereLevelset(node.GetInterfaceBlock().GetReinitializedBuffer(
+      InterfaceDescription::Levelset));
+  std::int8_t(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      node.GetInterfaceTags(InterfaceDescriptionBufferType::Reinitialized);
+  InterfaceTagFunctions::InitializeInternalInterfaceTags(interface_tags);
+  InterfaceTagFunctions::SetInternalCutCellTagsFromLevelset(
+      node.GetInterfaceBlock().GetReinitializedBuffer(
+          InterfaceDescription::Levelset),
+      interface_tags);
+  InterfaceTagFunctions::SetTotalInterfaceTagsFromCutCells(interface_tags);
+
+  CommunicationManager communication =
+      CommunicationManager(topology, maximum_level);
+  InternalHaloManager internal_halo_manager =
+      InternalHaloManager(tree, topology, communication, 2);
+  std::unique_ptr<ExternalHaloManager const> const external_halo_manager =
+      ZeroGradientExternalHaloManager();
+  HaloManager halo_manager(tree, *external_halo_manager, internal_halo_manager,
+                           communication, maximum_level);
+
+  BenchmarkReinitializer<MinIterativeLevelsetReinitializer>("MinIterative",
+                                                            halo_manager, node);
+  BenchmarkReinitializer<WenoIterativeLevelsetReinitializer>(
+      "WenoIterative", halo_manager, node);
+  BenchmarkReinitializer<FastSweepingLevelsetReinitializer>("FastSweeping",
+                                                            halo_manager, node);
+}
@@ -0,0 +1,69 @@
+//===----------------- benchmark_multiresolution.cpp ----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include <catch2/catch.hpp>
+
+#include <memory>
+
+#include "benchmark_utilities.h"
+#include "materials/equations_of_state/stiffened_gas.h"
+#include "multiresolution/multiresolution.h"
+#include "topology/id_information.h"
+
+TEST_CASE("Multiresolution prediction and averaging",
+          "[benchmark][multiresolution]") {
+  MaterialManager const material_manager =
+      BenchmarkUtilities::SingleMaterialManager(
+          std::make_unique<StiffenedGas const>(
+              std::unordered_map<std::string, double>(
+                  {{"gamma", 1.4}, {"backgroundPressure", 0.0}}),
+              BenchmarkUtilities::BenchmarkUnitHandler()));
+  MaterialName const material = material_manager.GetMaterialNames().front();
+  auto const parent = std::make_unique<Block>();
+  auto const child = std::make_unique<Block>();
+  BenchmarkUtilities::FillSmoothFlowState(material_manager, material, *parent);
+  BenchmarkUtilities::FillSmoothFlowState(material_manager, material, *child);
+  nid_t const child_id = IdsOfChildren(IdSeed()).back();
+
+  // The prediction fills all cells of one field of the child, as done for halo
+  // cells at resolution jumps
+  constexpr double number_of_total_cells =
+      double(CC::TCX()) * double(CC::TCY()) * double(CC::TCZ());
+  BENCHMARK(
+      BenchmarkUtilities::CellBenchmark("Prediction", number_of_total_cells)) {
+    Multiresolution::Prediction(parent->GetAverageBuffer(Equation::Mass),
+                                child->GetAverageBuffer(Equation::Mass),
+                                child_id);
+    return child->GetAverageBuffer(
+        Equation::Mass)[CC::FICX()][CC::FICY()][CC::FICZ()];
+  };
+
+  // The averaging processes all conservatives of the internal child cells
+  constexpr double number_of_internal_cells =
+      double(CC::ICX()) * double(CC::ICY()) * double(CC::ICZ());
+  BENCHMARK(
+      BenchmarkUtilities::CellBenchmark("Average", number_of_internal_cells)) {
+    Multiresolution::Average(child->GetAverageBuffer(),
+                             parent->GetAverageBuffer(), child_id);
+    return parent->GetAverageBuffer(
+        Equation::Mass)[CC::FICX()][CC::FICY()][CC::FICZ()];
+  };
+}
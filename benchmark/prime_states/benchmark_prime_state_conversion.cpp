@@ -0,0 +1,110 @@
+//===-------------- benchmark_prime_state_conversion.cpp ------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "benchmark_utilities.h"
+#include "materials/equations_of_state/isentropic.h"
+#include "materials/equations_of_state/noble_abel_stiffened_gas.h"
+#include "materials/equations_of_state/stiffened_gas.h"
+#include "materials/equations_of_state/stiffened_gas_complete_safe.h"
+#include "materials/equations_of_state/stiffened_gas_safe.h"
+#include "materials/equations_of_state/waterlike_fluid.h"
+
+namespace {
+/**
+ * @brief Benchmarks the conversion between conservatives and prime states on
+ * all cells of a block.
+ * @param name The name of the equation of state.
+ * @param equation_of_state The equation of state of the material.
+ */
+void BenchmarkPrimeStateConversion(
+    std::string const &name,
+    std::unique_ptr<EquationOfState const> equation_of_state) {
+  MaterialManager const material_manager =
+      BenchmarkUtilities::SingleMaterialManager(std::move(equation_of_state));
+  MaterialName const material = material_manager.GetMaterialNames().front();
+  PrimeStateHandler const prime_state_handler(material_manager);
+  auto const block = std::make_unique<Block>();
+  BenchmarkUtilities::FillSmoothFlowState(material_manager, material, *block);
+
+  constexpr double number_of_cells =
+      double(CC::TCX()) * double(CC::TCY()) * double(CC::TCZ());
+  BENCHMARK(BenchmarkUtilities::CellBenchmark(
+      "Conservatives to prime states " + name, number_of_cells)) {
+    prime_state_handler.ConvertConservativesToPrimeStates(
+        material, block->GetAverageBuffer(), block->GetPrimeStateBuffer());
+    return block->GetPrimeStateBuffer(PrimeState::Pressure)[0][0][0];
+  };
+  BENCHMARK(BenchmarkUtilities::CellBenchmark(
+      "Prime states to conservatives " + name, number_of_cells)) {
+    prime_state_handler.ConvertPrimeStatesToConservatives(
+        material, block->GetPrimeStateBuffer(), block->GetAverageBuffer());
+    return block->GetAverageBuffer(Equation::Mass)[0][0][0];
+  };
+}
+} // namespace
+
+TEST_CASE("Prime state conversion", "[benchmark][prime_states]") {
+  UnitHandler const &unit_handler = BenchmarkUtilities::BenchmarkUnitHandler();
+  using Parameters = std::unordered_map<std::string, double>;
+  BenchmarkPrimeStateConversion(
+      "StiffenedGas",
+      std::make_unique<StiffenedGas const>(
+          Parameters({{"gamma", 4.4}, {"backgroundPressure", 0.1}}),
+          unit_handler));
+  BenchmarkPrimeStateConversion(
+      "StiffenedGasSafe",
+      std::make_unique<StiffenedGasSafe const>(
+          Parameters({{"gamma", 4.4}, {"backgroundPressure", 0.1}}),
+          unit_handler));
+  BenchmarkPrimeStateConversion(
+      "StiffenedGasCompleteSafe",
+      std::make_unique<StiffenedGasCompleteSafe const>(
+          Parameters({{"gamma", 4.4},
+                      {"backgroundPressure", 0.1},
+                      {"energyTranslationFactor", 0.0},
+                      {"thermalEnergyFactor", 0.0},
+                      {"specificGasConstant", 1.0}}),
+          unit_handler));
+  BenchmarkPrimeStateConversion("NobleAbelStiffenedGas",
+                                std::make_unique<NobleAbelStiffenedGas const>(
+                                    Parameters({{"gamma", 1.4},
+                                                {"covolume", 0.01},
+                                                {"pressureConstant", 0.1},
+                                                {"energyConstant", 0.0},
+                                                {"entropyConstant", 0.0},
+                                                {"specificHeatCapacity", 1.0}}),
+                                    unit_handler));
+  BenchmarkPrimeStateConversion(
+      "WaterlikeFluid",
+      std::make_unique<WaterlikeFluid const>(
+          Parameters({{"gamma", 7.15}, {"A", 1.0}, {"B", 1.0}, {"rho0", 1.0}}),
+          unit_handler));
+  BenchmarkPrimeStateConversion(
+      "Isentropic",
+      std::make_unique<Isentropic const>(
+          Parameters({{"gamma", 1.4}, {"A", 1.0}}), unit_handler));
+}
@@ -0,0 +1,71 @@
+//===---------------- benchmark_eigendecomposition.cpp --------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "benchmark_utilities.h"
+#include "materials/equations_of_state/stiffened_gas.h"
+#include "solvers/eigendecomposition.h"
+
+namespace {
+/**
+ * @brief Storage of the Roe eigendecomposition at all faces of a block.
+ */
+struct RoeEigendecompositionStorage {
+  double eigenvectors_left_[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
+                           [MF::ANOE()][MF::ANOE()];
+  double eigenvectors_right_[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
+                            [MF::ANOE()][MF::ANOE()];
+  double eigenvalues_[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1][MF::ANOE()];
+};
+} // namespace
+
+TEST_CASE("Roe eigendecomposition", "[benchmark][solvers]") {
+  MaterialManager const material_manager =
+      BenchmarkUtilities::SingleMaterialManager(
+          std::make_unique<StiffenedGas const>(
+              std::unordered_map<std::string, double>(
+                  {{"gamma", 1.4}, {"backgroundPressure", 0.0}}),
+              BenchmarkUtilities::BenchmarkUnitHandler()));
+  MaterialName const material = material_manager.GetMaterialNames().front();
+  auto const mat_block = std::make_unique<std::pair<MaterialName const, Block>>(
+      std::piecewise_construct, std::forward_as_tuple(material),
+      std::forward_as_tuple());
+  BenchmarkUtilities::FillSmoothFlowState(material_manager, material,
+                                          mat_block->second);
+  EigenDecomposition const eigendecomposition(material_manager);
+  auto const storage = std::make_unique<RoeEigendecompositionStorage>();
+
+  // all faces in x-direction of the internal cells
+  constexpr double number_of_faces =
+      double(CC::ICX() + 1) * double(CC::ICY()) * double(CC::ICZ());
+  BENCHMARK(BenchmarkUtilities::CellBenchmark("Roe eigendecomposition X",
+                                              number_of_faces)) {
+    eigendecomposition.ComputeRoeEigendecomposition<Direction::X>(
+        *mat_block, storage->eigenvectors_left_, storage->eigenvectors_right_,
+        storage->eigenvalues_);
+    return storage->eigenvalues_[0][0][0][0];
+  };
+}
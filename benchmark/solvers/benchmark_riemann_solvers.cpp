@@ -0,0 +1,167 @@
+//===----------------- benchmark_riemann_solvers.cpp ----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_utilities.h"
+#include "materials/equations_of_state/isentropic.h"
+#include "materials/equations_of_state/stiffened_gas.h"
+#include "solvers/convective_term_contributions/riemann_solvers/riemann_solver_setup.h"
+
+namespace {
+// Number of solved Riemann problems per benchmark run, about the faces of a
+// pencil in a large block
+constexpr unsigned int number_of_faces = 1024;
+
+/**
+ * @brief Left and right states of all cell faces.
+ */
+struct RiemannFaces {
+  std::vector<std::array<double, MF::ANOE()>> conservatives_left_;
+  std::vector<std::array<double, MF::ANOE()>> conservatives_right_;
+  std::vector<std::array<double, MF::ANOP()>> prime_states_left_;
+  std::vector<std::array<double, MF::ANOP()>> prime_states_right_;
+};
+
+/**
+ * @brief Creates the states on both sides of the faces from the smooth flow
+ * state. Neighboring cells give the left and right states.
+ * @param material_manager The material manager holding the material.
+ * @param material The material of the states.
+ * @return The face states.
+ */
+RiemannFaces SmoothRiemannFaces(MaterialManager const &material_manager,
+                                MaterialName const material) {
+  PrimeStateHandler const prime_state_handler(material_manager);
+  RiemannFaces faces;
+  for (unsigned int f = 0; f < number_of_faces; ++f) {
+    std::array<double, MF::ANOP()> prime_states_left;
+    std::array<double, MF::ANOP()> prime_states_right;
+    for (PrimeState const prime_state : MF::ASOP()) {
+      prime_states_left[PTI(prime_state)] =
+          BenchmarkUtilities::SmoothPrimeState(f, 0, 0, prime_state);
+      prime_states_right[PTI(prime_state)] =
+          BenchmarkUtilities::SmoothPrimeState(f + 1, 0, 0, prime_state);
+    }
+    std::array<double, MF::ANOE()> conservatives_left;
+    std::array<double, MF::ANOE()> conservatives_right;
+    prime_state_handler.ConvertPrimeStatesToConservatives(
+        material, prime_states_left, conservatives_left);
+    prime_state_handler.ConvertPrimeStatesToConservatives(
+        material, prime_states_right, conservatives_right);
+    faces.conservatives_left_.push_back(conservatives_left);
+    faces.conservatives_right_.push_back(conservatives_right);
+    faces.prime_states_left_.push_back(prime_states_left);
+    faces.prime_states_right_.push_back(prime_states_right);
+  }
+  return faces;
+}
+
+/**
+ * @brief Benchmarks the solution of the Riemann problems at all faces in
+ * x-direction.
+ * @param name The name of the Riemann solver.
+ * @param material_manager The material manager holding the material.
+ * @param faces The left and right states of the faces.
+ * @tparam R The Riemann solver, concretized for the active equation set.
+ */
+template <FiniteVolumeSettings::RiemannSolvers R>
+void BenchmarkRiemannSolver(std::string const &name,
+                            MaterialManager const &material_manager,
+                            RiemannFaces const &faces) {
+  using RiemannSolverConcretization =
+      typename RiemannSolverSetup::Concretize<R>::type;
+  EigenDecomposition const eigendecomposition(material_manager);
+  RiemannSolverConcretization const riemann_solver(material_manager,
+                                                   eigendecomposition);
+  MaterialName const material = material_manager.GetMaterialNames().front();
+
+  BENCHMARK(BenchmarkUtilities::CellBenchmark("Riemann solver " + name,
+                                              number_of_faces)) {
+    double mass_flux = 0.0;
+    for (unsigned int f = 0; f < number_of_faces; ++f) {
+      if constexpr (active_equations == EquationSet::GammaModel) {
+        auto const [fluxes, velocity] =
+            riemann_solver.template SolveGammaRiemannProblem<Direction::X>(
+                material, faces.conservatives_left_[f],
+                faces.conservatives_right_[f], faces.prime_states_left_[f],
+                faces.prime_states_right_[f]);
+        mass_flux += fluxes[ETI(Equation::Mass)] + velocity;
+      } else {
+        auto const fluxes =
+            riemann_solver.template SolveRiemannProblem<Direction::X>(
+                material, faces.conservatives_left_[f],
+                faces.conservatives_right_[f], faces.prime_states_left_[f],
+                faces.prime_states_right_[f]);
+        mass_flux += fluxes[ETI(Equation::Mass)];
+      }
+    }
+    return mass_flux;
+  };
+}
+
+/**
+ * @brief Benchmarks all Riemann solvers available for the given equation set,
+ * see RiemannSolverSetup.
+ * @param material_manager The material manager holding the material.
+ * @param faces The left and right states of the faces.
+ * @tparam E The active equation set.
+ */
+template <EquationSet E>
+void BenchmarkAvailableRiemannSolvers(MaterialManager const &material_manager,
+                                      RiemannFaces const &faces) {
+  using FiniteVolumeSettings::RiemannSolvers;
+  BenchmarkRiemannSolver<RiemannSolvers::Hllc>("Hllc", material_manager, faces);
+  if constexpr (E != EquationSet::Isentropic) {
+    BenchmarkRiemannSolver<RiemannSolvers::Hllc_LM>("Hllc_LM", material_manager,
+                                                    faces);
+  }
+  if constexpr (E != EquationSet::GammaModel) {
+    BenchmarkRiemannSolver<RiemannSolvers::Hll>("Hll", material_manager, faces);
+  }
+}
+} // namespace
+
+TEST_CASE("Riemann solvers", "[benchmark][solvers]") {
+  // The isentropic equations require their own equation of state
+  std::unique_ptr<EquationOfState const> equation_of_state;
+  if constexpr (active_equations == EquationSet::Isentropic) {
+    equation_of_state = std::make_unique<Isentropic const>(
+        std::unordered_map<std::string, double>({{"gamma", 1.4}, {"A", 1.0}}),
+        BenchmarkUtilities::BenchmarkUnitHandler());
+  } else {
+    equation_of_state = std::make_unique<StiffenedGas const>(
+        std::unordered_map<std::string, double>(
+            {{"gamma", 1.4}, {"backgroundPressure", 0.0}}),
+        BenchmarkUtilities::BenchmarkUnitHandler());
+  }
+  MaterialManager const material_manager =
+      BenchmarkUtilities::SingleMaterialManager(std::move(equation_of_state));
+  RiemannFaces const faces = SmoothRiemannFaces(
+      material_manager, material_manager.GetMaterialNames().front());
+
+  BenchmarkAvailableRiemannSolvers<active_equations>(material_manager, faces);
+}
@@ -0,0 +1,76 @@
+//===------------- benchmark_reconstruction_stencils.cpp ------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "benchmark_utilities.h"
+#include "stencils/stencil_utilities.h"
+
+namespace {
+// Number of reconstructions per benchmark run, about the faces of a pencil in a
+// large block
+constexpr unsigned int number_of_evaluations = 4096;
+
+/**
+ * @brief Benchmarks the upwind-left reconstruction of a stencil along a pencil
+ * with smooth parts and discontinuities.
+ * @param name The name of the stencil.
+ * @tparam S The reconstruction stencil.
+ */
+template <typename S>
+void BenchmarkReconstructionStencil(std::string const &name) {
+  std::vector<double> pencil(number_of_evaluations + S::StencilSize() - 1);
+  for (unsigned int n = 0; n < pencil.size(); ++n) {
+    // Smooth wave with a jump every 64 cells to activate the nonlinear weights
+    pencil[n] = std::sin(0.05 * n) + ((n / 64) % 2 == 0 ? 0.0 : 1.0);
+  }
+  std::vector<double> results(number_of_evaluations);
+  constexpr double cell_size = 1.0;
+
+  BENCHMARK(BenchmarkUtilities::CellBenchmark("Reconstruction " + name,
+                                              number_of_evaluations)) {
+    SU::ReconstructionOnPencil<S, StencilProperty::UpwindLeft>(
+        pencil.data(), number_of_evaluations, cell_size, results.data());
+    return results.back();
+  };
+}
+} // namespace
+
+TEST_CASE("Reconstruction stencils", "[benchmark][stencils]") {
+  BenchmarkReconstructionStencil<FirstOrder>("FirstOrder");
+  BenchmarkReconstructionStencil<FourthOrderCentral>("FourthOrderCentral");
+  BenchmarkReconstructionStencil<WENO3>("WENO3");
+  BenchmarkReconstructionStencil<WENOF3P>("WENOF3P");
+  BenchmarkReconstructionStencil<WENO5>("WENO5");
+  BenchmarkReconstructionStencil<WENO5Z>("WENO5Z");
+  BenchmarkReconstructionStencil<WENO5HM>("WENO5HM");
+  BenchmarkReconstructionStencil<WENO5IS>("WENO5IS");
+  BenchmarkReconstructionStencil<WENO5NU6P>("WENO5NU6P");
+  BenchmarkReconstructionStencil<WENOAO53>("WENOAO53");
+  BenchmarkReconstructionStencil<WENOCU6>("WENOCU6");
+  BenchmarkReconstructionStencil<TENO5>("TENO5");
+  BenchmarkReconstructionStencil<WENO7>("WENO7");
+  BenchmarkReconstructionStencil<WENO9>("WENO9");
+}
@@ -0,0 +1,8 @@
+# Block sizes ( internal cells per block and dimension ) of the ALPACA_IC<N> executables built by the target block_size_variants, e.g. "8;16;32".
+# The default executable uses the block size of the compile time constants.
+set(BLOCK_SIZES "8;12;16;24;32" CACHE STRING "Block sizes of the block size variants")
+
+# Compiles the target with the given block size.
+function(alpaca_set_block_size TARGET_NAME BLOCK_SIZE)
+   target_compile_definitions(${TARGET_NAME} PRIVATE INTERNAL_CELLS_PER_BLOCK=${BLOCK_SIZE})
+endfunction()
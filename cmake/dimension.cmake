@@ -1,2 +1,8 @@
 set(DIM "3" CACHE STRING "DIM")
-set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -D DIMENSION=${DIM}")
+# Dimensions compiled side by side into ALPACAlib and alpacapy (e.g. "1;2;3"), the dimension is then selected at runtime.
+set(LIB_DIMS "${DIM}" CACHE STRING "Dimensions of ALPACAlib and alpacapy")
+
+# The executables are compiled for DIM only.
+function(alpaca_set_dimension TARGET_NAME)
+   target_compile_definitions(${TARGET_NAME} PRIVATE DIMENSION=${DIM})
+endfunction()
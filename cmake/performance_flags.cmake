@@ -25,6 +25,22 @@ if(ALPACA_ENV STREQUAL "SNG")
     endif(CMAKE_CXX_COMPILER_ID MATCHES "Intel")
 endif(ALPACA_ENV STREQUAL "SNG")
 
+# Hybrid MPI+OpenMP execution: leaf loops are shared among the threads of a rank
+option(HYBRID "Hybrid MPI+OpenMP execution" OFF)
+if(HYBRID)
+    find_package(OpenMP REQUIRED)
+    set(MACHINE_FLAGS "${MACHINE_FLAGS} ${OpenMP_CXX_FLAGS}")
+else(HYBRID)
+    # omp pragmas are intentionally ignored in pure MPI builds, only the simd
+    # pragmas of the batched stencil kernels are kept
+    set(MACHINE_FLAGS "${MACHINE_FLAGS} -Wno-unknown-pragmas")
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Intel")
+        set(MACHINE_FLAGS "${MACHINE_FLAGS} -qopenmp-simd")
+    else(CMAKE_CXX_COMPILER_ID MATCHES "Intel")
+        set(MACHINE_FLAGS "${MACHINE_FLAGS} -fopenmp-simd")
+    endif(CMAKE_CXX_COMPILER_ID MATCHES "Intel")
+endif(HYBRID)
+
 set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${MACHINE_FLAGS}")
 
 # Handle deubg mode
@@ -54,3 +70,8 @@ if(ALPACA_ENV STREQUAL "LRZ" OR ALPACA_ENV STREQUAL "SNG")
         endif(SYMMETRY)
     endif(CMAKE_CXX_COMPILER_ID MATCHES "Intel")
 endif(ALPACA_ENV STREQUAL "LRZ" OR ALPACA_ENV STREQUAL "SNG")
+
+# Without fused multiply-add contraction scalar and batched (SIMD) stencil evaluations give bit-identical results
+if(SYMMETRY AND NOT CMAKE_CXX_COMPILER_ID MATCHES "Intel")
+    set(ALPACA_FLOATING_FLAGS "${ALPACA_FLOATING_FLAGS} -ffp-contract=off")
+endif(SYMMETRY AND NOT CMAKE_CXX_COMPILER_ID MATCHES "Intel")
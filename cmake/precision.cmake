@@ -0,0 +1,5 @@
+# Stores and computes the material fields ( conservatives and prime states ) in single precision, e.g., for exploratory parameter studies.
+option(SINGLE_PRECISION "Single-precision material fields" OFF)
+if( SINGLE_PRECISION )
+   add_compile_definitions(SINGLE_PRECISION)
+endif()
@@ -0,0 +1,219 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include "alpaca_dimensions.h"
+
+#include "alpaca_runner.h"
+#include "alpaca_simulation.h"
+
+namespace Alpaca {
+
+   /**
+    * @brief Gives the dimensions compiled into the library.
+    * @return The dimensions in ascending order.
+    */
+   std::vector<unsigned int> CompiledDimensions() {
+      std::vector<unsigned int> dimensions;
+#ifdef ALPACA_WITH_DIMENSION_1
+      dimensions.push_back( 1 );
+#endif
+#ifdef ALPACA_WITH_DIMENSION_2
+      dimensions.push_back( 2 );
+#endif
+#ifdef ALPACA_WITH_DIMENSION_3
+      dimensions.push_back( 3 );
+#endif
+      return dimensions;
+   }
+
+   /**
+    * @brief Gives the dimension used if none is specified ( the DIM option of the build if compiled, otherwise the lowest compiled one ).
+    * @return The default dimension.
+    */
+   unsigned int DefaultDimension() {
+      return ALPACA_DEFAULT_DIMENSION;
+   }
+
+   /**
+    * @brief Runs the ALPACA simulation routine based on a given input file in the default dimension.
+    * @param inputfile File name to provide user information for the simulation.
+    */
+   void Run( std::string const inputfile ) {
+      Run( inputfile, DefaultDimension() );
+   }
+
+   /**
+    * @brief Runs the ALPACA simulation routine based on a given input file.
+    * @param inputfile File name to provide user information for the simulation.
+    * @param dimension The dimension of the simulation ( must be compiled into the library ).
+    */
+   void Run( std::string const inputfile, unsigned int const dimension ) {
+      Detail::DispatchDimension<void>( dimension, [&inputfile]( auto const dim ) { Detail::RunInDimension<dim()>( inputfile ); } );
+   }
+
+   /**
+    * @brief Sets up the simulation from the input file and initializes it from the initial condition or the restart file.
+    * @param inputfile Path to the input file.
+    * @param dimension The dimension of the simulation ( must be compiled into the library ).
+    */
+   Simulation::Simulation( std::string const& inputfile, unsigned int const dimension )
+       : implementation_( Detail::DispatchDimension<std::unique_ptr<Detail::SimulationInterface>>(
+               dimension, [&inputfile]( auto const dim ) { return Detail::CreateSimulation<dim()>( inputfile ); } ) ),
+         dimension_( dimension ) {
+      /** Empty besides initializer list */
+   }
+
+   /**
+    * @brief Default destructor ( defined here, as the implementation is incomplete in the header ).
+    * @note The summaries of the run are only logged if Finalize() has been called.
+    */
+   Simulation::~Simulation() = default;
+
+   /**
+    * @brief Advances the simulation by a number of macro timesteps.
+    * @param number_of_timesteps The number of macro timesteps.
+    * @return The number of macro timesteps performed ( less if the end time or the maximum number of macro timesteps is reached ).
+    */
+   unsigned int Simulation::Advance( unsigned int const number_of_timesteps ) {
+      return implementation_->Advance( number_of_timesteps );
+   }
+
+   /**
+    * @brief Advances the simulation up to the given time ( at most to the end time of the input file ).
+    * @param time The dimensional time to advance to.
+    * @return The number of macro timesteps performed.
+    */
+   unsigned int Simulation::AdvanceTo( double const time ) {
+      return implementation_->AdvanceTo( time );
+   }
+
+   /**
+    * @brief Gives the current time of the simulation.
+    * @return The dimensional time.
+    */
+   double Simulation::Time() const {
+      return implementation_->Time();
+   }
+
+   /**
+    * @brief Indicates whether the simulation cannot be advanced any further.
+    * @return True if the end time or the maximum number of macro timesteps is reached or the timestep size became too small.
+    */
+   bool Simulation::IsFinished() const {
+      return implementation_->IsFinished();
+   }
+
+   /**
+    * @brief Evaluates the reductions and probes of the in-situ analysis given in the input file for the current state.
+    * @return The name and dimensional value of each reduction and probe ( identical on all ranks ).
+    */
+   std::vector<std::pair<std::string, double>> Simulation::Query() const {
+      return implementation_->Query();
+   }
+
+   /**
+    * @brief Gives views of the buffers of all phases in the leaves of this rank. No data is copied or communicated.
+    * @return One view per leaf and material present in it.
+    * @note The views are invalidated by the next call to Advance() or AdvanceTo().
+    */
+   std::vector<BlockView> Simulation::LocalBlocks() {
+      return implementation_->LocalBlocks();
+   }
+
+   /**
+    * @brief Gives the dimension of the simulation.
+    * @return The dimension.
+    */
+   unsigned int Simulation::Dimension() const {
+      return dimension_;
+   }
+
+   /**
+    * @brief Gives the memory layout of the buffers referenced by the block views.
+    * @param dimension The dimension of the simulation ( must be compiled into the library ).
+    * @return The layout of the dimension.
+    */
+   BlockLayout Simulation::Layout( unsigned int const dimension ) {
+      return Detail::DispatchDimension<BlockLayout>( dimension, []( auto const dim ) { return Detail::LayoutOfDimension<dim()>(); } );
+   }
+
+   /**
+    * @brief Writes the outputs enabled in the input file for the current state.
+    */
+   void Simulation::WriteOutput() {
+      implementation_->WriteOutput();
+   }
+
+   /**
+    * @brief Logs the summaries of the run ( profiling, memory, communication ) and writes the trace files. Further calls have no effect.
+    */
+   void Simulation::Finalize() {
+      implementation_->Finalize();
+   }
+
+}// namespace Alpaca
@@ -0,0 +1,123 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#ifndef ALPACA_DIMENSIONS_H
+#define ALPACA_DIMENSIONS_H
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Marks the interface of the library. The dimension-specific parts of a multi-dimension build are compiled with hidden visibility and
+ *        their hidden symbols are localized ( see ALPACA_LIB_DIMENSIONS in cmake/dimension.cmake ), hence only the marked symbols remain
+ *        visible across the dimensions.
+ */
+#define ALPACA_EXPORT __attribute__( ( visibility( "default" ) ) )
+
+namespace Alpaca {
+
+   std::vector<unsigned int> CompiledDimensions();
+   unsigned int DefaultDimension();
+
+   namespace Detail {
+
+      /**
+       * @brief Calls a function with the dimension as compile-time constant. Only the dimensions compiled into the library are dispatched to.
+       * @param dimension The dimension of the call.
+       * @param function The function called with a std::integral_constant of the dimension.
+       * @tparam Result The result of the function ( identical for all dimensions ).
+       * @return The result of the function.
+       * @note Only to be used within the library, the compiled dimensions are given by the ALPACA_WITH_DIMENSION_* definitions of its build.
+       */
+      template<typename Result, typename Function>
+      Result DispatchDimension( unsigned int const dimension, Function&& function ) {
+         switch( dimension ) {
+#ifdef ALPACA_WITH_DIMENSION_1
+            case 1:
+               return function( std::integral_constant<unsigned int, 1>() );
+#endif
+#ifdef ALPACA_WITH_DIMENSION_2
+            case 2:
+               return function( std::integral_constant<unsigned int, 2>() );
+#endif
+#ifdef ALPACA_WITH_DIMENSION_3
+            case 3:
+               return function( std::integral_constant<unsigned int, 3>() );
+#endif
+            default:
+               throw std::invalid_argument( "Dimension " + std::to_string( dimension ) + " is not compiled into this ALPACA library" );
+         }
+      }
+
+   }// namespace Detail
+
+}// namespace Alpaca
+
+#endif// ALPACA_DIMENSIONS_H
@@ -66,6 +66,8 @@
 * Munich, February 10th, 2021                                                            *
 *                                                                                        *
 *****************************************************************************************/
+#include "alpaca_runner.h"
+
 #include <mpi.h>
 #include <fenv.h> // Floating-Point raising exceptions.
 
@@ -73,18 +75,23 @@
 #include "input_output/log_writer/log_writer.h"
 #include "simulation_runner.h"
 
-namespace Alpaca {
+namespace Alpaca::Detail {
 
    /**
     * @brief Runs the ALPACA simulation routine based on a given input file.
     * @param inputfile File name to provide user information for the simulation.
+    * @tparam DIM The dimension of the simulation, only instantiated for the dimension of the compilation.
+    * @note Called through Alpaca::Run(), which selects the dimension at runtime.
     */
-   void Run( std::string const inputfile ) {
+   template<unsigned int DIM>
+   void RunInDimension( std::string const inputfile ) {
+      static_assert( DIM == DIMENSION, "Only the dimension of the compilation can be run" );
 
       MPI_Init( NULL, NULL );
       //Triggers signals on floating point errors, i.e. prohibits quiet NaNs and alike
 #ifndef PERFORMANCE
       feenableexcept( FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW );
+#endif
 
       //NH Seperate Scope for MPI.
       {
@@ -97,10 +104,13 @@ namespace Alpaca {
          // Instance to provide interface to the input file/data
          InputReader const input_reader( Instantiation::InstantiateInputReader( inputfile ) );
 
-         Simulation::Run( input_reader );
+         ::Simulation::Run( input_reader );
       }
 
       MPI_Finalize();
    }
-}
+
+   template void RunInDimension<DIMENSION>( std::string const inputfile );
+
+}// namespace Alpaca::Detail
 
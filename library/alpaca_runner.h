@@ -71,9 +71,17 @@
 
 #include <string>
 
+#include "alpaca_dimensions.h"
+
 namespace Alpaca {
 
    void Run( std::string const inputfile );
+   void Run( std::string const inputfile, unsigned int const dimension );
+
+   namespace Detail {
+      template<unsigned int DIM>
+      ALPACA_EXPORT void RunInDimension( std::string const inputfile );
+   }
 
 }
 
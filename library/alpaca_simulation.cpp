@@ -0,0 +1,380 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include "alpaca_simulation.h"
+
+#include <filesystem>
+#include <limits>
+
+#include "block_definitions/field_interface_definitions.h"
+#include "block_definitions/field_material_definitions.h"
+#include "communication/mpi_utilities.h"
+#include "input_output/log_writer/log_writer.h"
+#include "input_output/log_writer/logging.h"
+#include "instantiation/halo_manager/instantiation_external_halo_manager.h"
+#include "instantiation/halo_manager/instantiation_halo_manager.h"
+#include "instantiation/halo_manager/instantiation_internal_halo_manager.h"
+#include "instantiation/input_output/instantiation_in_situ_analysis.h"
+#include "instantiation/input_output/instantiation_input_output_manager.h"
+#include "instantiation/input_output/instantiation_input_reader.h"
+#include "instantiation/input_output/instantiation_log_writer.h"
+#include "instantiation/input_output/instantiation_output_writer.h"
+#include "instantiation/input_output/instantiation_restart_manager.h"
+#include "instantiation/instantiation_communication_manager.h"
+#include "instantiation/instantiation_initial_condition.h"
+#include "instantiation/instantiation_modular_algorithm_assembler.h"
+#include "instantiation/instantiation_multiresolution.h"
+#include "instantiation/instantiation_unit_handler.h"
+#include "instantiation/materials/instantiation_material_manager.h"
+#include "instantiation/topology/instantiation_topology_manager.h"
+#include "instantiation/topology/instantiation_tree.h"
+#include "simulation_context.h"
+#include "topology/id_information.h"
+#include "utilities/phase_timer.h"
+
+namespace {
+   /**
+    * @brief Creates the output folder of the simulation and redirects the log into it.
+    * @param input_reader Reader that provides access to the input file.
+    * @return The output folder of the simulation.
+    */
+   std::filesystem::path CreateOutputFolder( InputReader const& input_reader ) {
+      LogWriter& logger     = LogWriter::Instance();
+      auto const input_file = input_reader.GetInputFile();
+      logger.LogMessage( "Using inputfile : " + input_file.string() );
+      auto const output_folder = InputOutput::CreateOutputBaseFolder( input_file );
+      logger.SetLogfile( output_folder / input_file.filename().replace_extension( ".log" ) );
+      logger.LogBreakLine();
+      Logging::LogCompiledSettings();
+      logger.LogMessage( "Number of MPI ranks : " + std::to_string( MpiUtilities::NumberOfRanks() ) );
+      logger.LogBreakLine();
+      logger.Flush();
+      return output_folder;
+   }
+
+   /**
+    * @brief Gives the first value of a field buffer, independent of its layout.
+    * @param buffer The field buffer.
+    * @return Pointer to the contiguous storage of all fields.
+    */
+   template<typename Buffer>
+   double* FirstValue( Buffer& buffer ) {
+      return reinterpret_cast<double*>( buffer.Fields.data() );
+   }
+
+   /**
+    * @brief All instances of a simulation in the order of their dependencies ( as in the standard run, see simulation_runner.h ).
+    */
+   struct Components {
+      InputReader const input_reader_;
+      std::filesystem::path const output_folder_;
+      UnitHandler const unit_handler_;
+      MaterialManager const material_manager_;
+      TopologyManager topology_manager_;
+      Tree tree_;
+      Multiresolution const multiresolution_;
+      CommunicationManager communication_manager_;
+      ExternalHaloManager const external_halo_manager_;
+      InternalHaloManager internal_halo_manager_;
+      HaloManager halo_manager_;
+      OutputWriter const output_writer_;
+      RestartManager restart_manager_;
+      InSituAnalysis const in_situ_analysis_;
+      InputOutputManager input_output_manager_;
+      ModularAlgorithmAssembler algorithm_;
+
+      explicit Components( std::string const& inputfile ) : input_reader_( Instantiation::InstantiateInputReader( inputfile ) ),
+                                                              output_folder_( CreateOutputFolder( input_reader_ ) ),
+                                                              unit_handler_( Instantiation::InstantiateUnitHandler( input_reader_ ) ),
+                                                              material_manager_( Instantiation::InstantiateMaterialManager( input_reader_, unit_handler_ ) ),
+                                                              topology_manager_( Instantiation::InstantiateTopologyManager( input_reader_, material_manager_ ) ),
+                                                              tree_( Instantiation::InstantiateTree( input_reader_, topology_manager_, unit_handler_ ) ),
+                                                              multiresolution_( Instantiation::InstantiateMultiresolution( input_reader_, topology_manager_ ) ),
+                                                              communication_manager_( Instantiation::InstantiateCommunicationManager( input_reader_, topology_manager_ ) ),
+                                                              external_halo_manager_( Instantiation::InstantiateExternalHaloManager( input_reader_, unit_handler_, material_manager_ ) ),
+                                                              internal_halo_manager_( Instantiation::InstantiateInternalHaloManager( topology_manager_, tree_, communication_manager_, material_manager_ ) ),
+                                                              halo_manager_( Instantiation::InstantiateHaloManager( topology_manager_, tree_, external_halo_manager_, internal_halo_manager_, communication_manager_ ) ),
+                                                              output_writer_( Instantiation::InstantiateOutputWriter( input_reader_, topology_manager_, tree_, material_manager_, unit_handler_ ) ),
+                                                              restart_manager_( Instantiation::InstantiateRestartManager( topology_manager_, tree_, unit_handler_ ) ),
+                                                              in_situ_analysis_( Instantiation::InstantiateInSituAnalysis( input_reader_, topology_manager_, tree_, material_manager_, unit_handler_ ) ),
+                                                              input_output_manager_( Instantiation::InstantiateInputOutputManager( input_reader_, output_writer_, restart_manager_, in_situ_analysis_, unit_handler_, output_folder_ ) ),
+                                                              algorithm_( Instantiation::InstantiateModularAlgorithmAssembler( input_reader_, topology_manager_, tree_, communication_manager_, halo_manager_,
+                                                                                                                              multiresolution_, material_manager_, input_output_manager_, unit_handler_ ) ) {
+         /** Empty besides initializer list */
+      }
+   };
+
+   /**
+    * @brief The SimulationImplementation class implements the simulation handle in the dimension of the compilation.
+    */
+   class SimulationImplementation final : public Alpaca::Detail::SimulationInterface {
+
+      // Logger, hdf5 manager, profiler and statistics of the simulation, bound in every call ( mutable as const calls communicate as well )
+      mutable SimulationContext context_;
+      // All instances of the simulation, kept alive between the calls
+      std::unique_ptr<Components> components_;
+      bool finalized_ = false;
+
+   public:
+      explicit SimulationImplementation( std::string const& inputfile );
+      ~SimulationImplementation() override;
+
+      unsigned int Advance( unsigned int const number_of_timesteps ) override;
+      unsigned int AdvanceTo( double const time ) override;
+      double Time() const override;
+      bool IsFinished() const override;
+      std::vector<std::pair<std::string, double>> Query() const override;
+      std::vector<Alpaca::BlockView> LocalBlocks() override;
+      void WriteOutput() override;
+      void Finalize() override;
+   };
+
+   /**
+    * @brief Sets up the simulation from the input file and initializes it from the initial condition or the restart file.
+    * @param inputfile Path to the input file.
+    */
+   SimulationImplementation::SimulationImplementation( std::string const& inputfile ) {
+      SimulationContext::Binding const binding( context_ );
+      Instantiation::InstantiateLogWriter( MpiUtilities::MasterRank() );
+      // Measures the phases from launch to the first time step
+      PhaseTimer startup_timer;
+      components_ = std::make_unique<Components>( inputfile );
+      startup_timer.Lap( "Simulation components" );
+      // The initial condition is only needed for the initialization
+      std::unique_ptr<InitialCondition> initial_condition( Instantiation::InstantiateInitialCondition( components_->input_reader_,
+                                                                                                        components_->topology_manager_,
+                                                                                                        components_->tree_,
+                                                                                                        components_->material_manager_,
+                                                                                                        components_->unit_handler_ ) );
+      startup_timer.Lap( "Initial condition instantiation" );
+      components_->algorithm_.Initialization( *initial_condition, startup_timer );
+      LogWriter::Instance().LogMessage( "Startup phases ( launch to first time step ):" );
+      for( std::string const& line : startup_timer.Summary() ) {
+         LogWriter::Instance().LogMessage( line );
+      }
+      LogWriter::Instance().LogBreakLine();
+      LogWriter::Instance().Flush();
+   }
+
+   /**
+    * @brief Destroys the instances of the simulation within its context.
+    */
+   SimulationImplementation::~SimulationImplementation() {
+      SimulationContext::Binding const binding( context_ );
+      components_.reset();
+   }
+
+   /**
+    * @brief Advances the simulation by a number of macro timesteps.
+    * @param number_of_timesteps The number of macro timesteps.
+    * @return The number of macro timesteps performed ( less if the end time or the maximum number of macro timesteps is reached ).
+    */
+   unsigned int SimulationImplementation::Advance( unsigned int const number_of_timesteps ) {
+      SimulationContext::Binding const binding( context_ );
+      if( number_of_timesteps == 0 ) {
+         return 0;
+      }
+      return components_->algorithm_.ComputeMacroTimesteps( std::numeric_limits<double>::max(), number_of_timesteps );
+   }
+
+   /**
+    * @brief Advances the simulation up to the given time ( at most to the end time of the input file ).
+    * @param time The dimensional time to advance to.
+    * @return The number of macro timesteps performed.
+    * @note The time is hit exactly only if the last timestep is limited, see CC::LET(). Otherwise, the last macro timestep may exceed it.
+    */
+   unsigned int SimulationImplementation::AdvanceTo( double const time ) {
+      SimulationContext::Binding const binding( context_ );
+      double const stop_time = components_->unit_handler_.NonDimensionalizeValue( time, UnitType::Time );
+      return components_->algorithm_.ComputeMacroTimesteps( stop_time, 0 );
+   }
+
+   /**
+    * @brief Gives the current time of the simulation.
+    * @return The dimensional time.
+    */
+   double SimulationImplementation::Time() const {
+      return components_->unit_handler_.DimensionalizeValue( components_->algorithm_.CurrentTime(), UnitType::Time );
+   }
+
+   /**
+    * @brief Indicates whether the simulation cannot be advanced any further.
+    * @return True if the end time or the maximum number of macro timesteps is reached or the timestep size became too small.
+    */
+   bool SimulationImplementation::IsFinished() const {
+      return components_->algorithm_.IsFinished();
+   }
+
+   /**
+    * @brief Evaluates the reductions ( e.g. integrals ) and probes of the in-situ analysis given in the input file for the current state.
+    * @return The name and dimensional value of each reduction and probe ( identical on all ranks ).
+    */
+   std::vector<std::pair<std::string, double>> SimulationImplementation::Query() const {
+      SimulationContext::Binding const binding( context_ );
+      return components_->input_output_manager_.EvaluateInSituAnalysis();
+   }
+
+   /**
+    * @brief Gives views of the buffers of all phases in the leaves of this rank. No data is copied or communicated.
+    * @return One view per leaf and material present in it.
+    * @note The views are invalidated by the next call to Advance() or AdvanceTo().
+    */
+   std::vector<Alpaca::BlockView> SimulationImplementation::LocalBlocks() {
+      SimulationContext::Binding const binding( context_ );
+      Tree& tree                           = components_->tree_;
+      UnitHandler const& unit_handler      = components_->unit_handler_;
+      double const node_size_on_level_zero = tree.GetNodeSizeOnLevelZero();
+      std::vector<Alpaca::BlockView> views;
+      for( nid_t const id : components_->topology_manager_.LocalLeafIds() ) {
+         Node& node                              = tree.GetNodeWithId( id );
+         std::array<double, 3> const coordinates = DomainCoordinatesOfId( id, DomainSizeOfId( id, node_size_on_level_zero ) );
+         std::vector<double*> interface_descriptions;
+         if( node.HasLevelset() ) {
+            for( InterfaceDescription const description : IF::ASOD() ) {
+               interface_descriptions.push_back( &node.GetInterfaceBlock().GetBaseBuffer( description )[0][0][0] );
+            }
+         }
+         for( auto& [material, block] : node.GetPhases() ) {
+            views.push_back( { id,
+                               LevelOfNode( id ),
+                               static_cast<unsigned int>( MTI( material ) ),
+                               { unit_handler.DimensionalizeValue( coordinates[0], UnitType::Length ),
+                                 unit_handler.DimensionalizeValue( coordinates[1], UnitType::Length ),
+                                 unit_handler.DimensionalizeValue( coordinates[2], UnitType::Length ) },
+                               unit_handler.DimensionalizeValue( CellSizeOfId( id, node_size_on_level_zero ), UnitType::Length ),
+                               FirstValue( block.GetAverageBuffer() ),
+                               FirstValue( block.GetPrimeStateBuffer() ),
+                               interface_descriptions } );
+         }
+      }
+      return views;
+   }
+
+   /**
+    * @brief Writes the outputs enabled in the input file for the current state.
+    */
+   void SimulationImplementation::WriteOutput() {
+      SimulationContext::Binding const binding( context_ );
+      components_->input_output_manager_.WriteFullOutput( components_->algorithm_.CurrentTime(), true );
+   }
+
+   /**
+    * @brief Logs the summaries of the run ( profiling, memory, communication ) and writes the trace files. Further calls have no effect.
+    */
+   void SimulationImplementation::Finalize() {
+      SimulationContext::Binding const binding( context_ );
+      if( finalized_ ) {
+         return;
+      }
+      components_->algorithm_.FinishComputeLoop();
+      LogWriter::Instance().LogBreakLine();
+      LogWriter::Instance().Flush();
+      finalized_ = true;
+   }
+
+}// namespace
+
+namespace Alpaca::Detail {
+
+   /**
+    * @brief Sets up a simulation in the dimension of the compilation.
+    * @param inputfile Path to the input file.
+    * @tparam DIM The dimension of the simulation, only instantiated for the dimension of the compilation.
+    * @return The simulation.
+    */
+   template<unsigned int DIM>
+   std::unique_ptr<SimulationInterface> CreateSimulation( std::string const& inputfile ) {
+      static_assert( DIM == DIMENSION, "Only the dimension of the compilation can be simulated" );
+      return std::make_unique<SimulationImplementation>( inputfile );
+   }
+
+   /**
+    * @brief Gives the memory layout of the buffers referenced by the block views.
+    * @tparam DIM The dimension of the simulation, only instantiated for the dimension of the compilation.
+    * @return The layout of this build.
+    */
+   template<unsigned int DIM>
+   BlockLayout LayoutOfDimension() {
+      static_assert( DIM == DIMENSION, "Only the layout of the dimension of the compilation is known" );
+      BlockLayout layout{ { CC::TCX(), CC::TCY(), CC::TCZ() }, CC::HS(), CC::FBL() == FieldBufferLayout::FieldMajor, CC::FBTW(), {}, {}, {} };
+      for( Equation const equation : MF::ASOE() ) {
+         layout.conservative_names_.emplace_back( MF::InputName( equation ) );
+      }
+      for( PrimeState const prime_state : MF::ASOP() ) {
+         layout.prime_state_names_.emplace_back( MF::InputName( prime_state ) );
+      }
+      for( InterfaceDescription const description : IF::ASOD() ) {
+         layout.interface_description_names_.emplace_back( IF::InputName( description ) );
+      }
+      return layout;
+   }
+
+   template std::unique_ptr<SimulationInterface> CreateSimulation<DIMENSION>( std::string const& inputfile );
+   template BlockLayout LayoutOfDimension<DIMENSION>();
+
+}// namespace Alpaca::Detail
@@ -0,0 +1,184 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#ifndef ALPACA_SIMULATION_H
+#define ALPACA_SIMULATION_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "alpaca_dimensions.h"
+
+namespace Alpaca {
+
+   /**
+    * @brief Memory layout of the block buffers, identical for all blocks of a build. Each buffer holds the given number of fields over all
+    *        cells of the block including the halo cells. In the field-major layout the values are stored as [field][i][j][k], in the
+    *        cell-blocked layout as [cell / tile width][field][cell % tile width] with the cell index ( i * cells_y + j ) * cells_z + k.
+    *        The interface descriptions are stored in one buffer per description of the layout [i][j][k] independent of the field layout.
+    */
+   struct BlockLayout {
+      std::array<unsigned int, 3> cells_;
+      unsigned int halo_size_;
+      bool field_major_;
+      unsigned int tile_width_;
+      std::vector<std::string> conservative_names_;
+      std::vector<std::string> prime_state_names_;
+      std::vector<std::string> interface_description_names_;
+   };
+
+   /**
+    * @brief Non-owning view of the buffers of one phase in a local leaf. The buffers hold the non-dimensional values of the simulation and
+    *        are only valid until the simulation is advanced ( remeshing and load balancing may move or free them ).
+    */
+   struct BlockView {
+      std::uint64_t id_;
+      unsigned int level_;
+      unsigned int material_;
+      // dimensional coordinates of the corner of the first internal cell and dimensional cell size
+      std::array<double, 3> origin_;
+      double cell_size_;
+      double* conservatives_;
+      double* prime_states_;
+      // one buffer per interface description in the order of the layout, always field-major [i][j][k], empty if the leaf holds no interface
+      std::vector<double*> interface_descriptions_;
+   };
+
+   namespace Detail {
+
+      /**
+       * @brief Interface of the simulation of one dimension, implemented in each dimension compiled into the library.
+       */
+      class ALPACA_EXPORT SimulationInterface {
+      public:
+         virtual ~SimulationInterface() = default;
+
+         virtual unsigned int Advance( unsigned int const number_of_timesteps ) = 0;
+         virtual unsigned int AdvanceTo( double const time ) = 0;
+         virtual double Time() const = 0;
+         virtual bool IsFinished() const = 0;
+         virtual std::vector<std::pair<std::string, double>> Query() const = 0;
+         virtual std::vector<BlockView> LocalBlocks() = 0;
+         virtual void WriteOutput() = 0;
+         virtual void Finalize() = 0;
+      };
+
+      template<unsigned int DIM>
+      ALPACA_EXPORT std::unique_ptr<SimulationInterface> CreateSimulation( std::string const& inputfile );
+      template<unsigned int DIM>
+      ALPACA_EXPORT BlockLayout LayoutOfDimension();
+
+   }// namespace Detail
+
+   /**
+    * @brief The Simulation class is a handle to a single ALPACA simulation that is driven step-wise from outside, e.g. by a coupling or
+    *        optimization framework. On construction the simulation is set up from the input file and initialized ( initial condition or
+    *        restart ). Afterwards, it can be advanced by a number of macro timesteps or up to a given time, its in-situ analysis ( reductions
+    *        and probes defined in the input file ) can be queried and outputs can be written on demand. Outputs, restart files and the in-situ
+    *        time series due within the advanced time are written as in a standard run.
+    * @note MPI must be initialized by the caller before construction and finalized after destruction. All member functions are collective,
+    *       hence, they must be called on all ranks. Times are dimensional. The dimension is chosen among the ones compiled into the library.
+    * @note Each simulation owns its logger, hdf5 manager, runtime profiler and communication statistics ( see SimulationContext ), which
+    *       are bound to the calling thread for the duration of each call. Hence, several simulations can be driven concurrently from
+    *       different threads. Such simulations must have the same number of materials, since the material signs of the level set are
+    *       process-wide ( see MaterialSignCapsule ).
+    */
+   class Simulation {
+
+      // The simulation in its dimension, kept alive between the calls
+      std::unique_ptr<Detail::SimulationInterface> implementation_;
+      unsigned int const dimension_;
+
+   public:
+      Simulation() = delete;
+      explicit Simulation( std::string const& inputfile, unsigned int const dimension = DefaultDimension() );
+      ~Simulation();
+      Simulation( Simulation const& ) = delete;
+      Simulation& operator=( Simulation const& ) = delete;
+      Simulation( Simulation&& )            = delete;
+      Simulation& operator=( Simulation&& ) = delete;
+
+      unsigned int Advance( unsigned int const number_of_timesteps );
+      unsigned int AdvanceTo( double const time );
+      double Time() const;
+      bool IsFinished() const;
+      std::vector<std::pair<std::string, double>> Query() const;
+      std::vector<BlockView> LocalBlocks();
+      unsigned int Dimension() const;
+      static BlockLayout Layout( unsigned int const dimension = DefaultDimension() );
+      void WriteOutput();
+      void Finalize();
+   };
+
+}// namespace Alpaca
+
+#endif// ALPACA_SIMULATION_H
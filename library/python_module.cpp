@@ -1,13 +1,79 @@
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 #include "alpaca_runner.h"
+#include "alpaca_simulation.h"
 
-void run_alpaca( std::string const input_file ) {
-    Alpaca::Run( input_file );
+void run_alpaca( std::string const input_file, unsigned int const dimension ) {
+    Alpaca::Run( input_file, dimension );
 }
 
 namespace py = pybind11;
 
+/**
+ * @brief Wraps a block buffer into a NumPy array without copying. The array keeps the owner ( the simulation handle ) alive.
+ * @param data First value of the buffer.
+ * @param number_of_fields Number of fields in the buffer.
+ * @param layout Memory layout of the buffers.
+ * @param owner Python object owning the buffer.
+ * @return Array of shape ( fields, cells_x, cells_y, cells_z ) in the field-major layout and ( tiles, fields, tile_width ) otherwise.
+ */
+py::array_t<double> block_buffer_view( double* const data, std::size_t const number_of_fields, Alpaca::BlockLayout const& layout, py::handle const owner ) {
+    std::vector<py::ssize_t> shape;
+    if( layout.field_major_ ) {
+        shape = { py::ssize_t( number_of_fields ), py::ssize_t( layout.cells_[0] ), py::ssize_t( layout.cells_[1] ), py::ssize_t( layout.cells_[2] ) };
+    } else {
+        py::ssize_t const cells = py::ssize_t( layout.cells_[0] ) * layout.cells_[1] * layout.cells_[2];
+        shape = { cells / layout.tile_width_, py::ssize_t( number_of_fields ), py::ssize_t( layout.tile_width_ ) };
+    }
+    return py::array_t<double>( shape, data, owner );
+}
+
+/**
+ * @brief Wraps an interface description buffer into a NumPy array without copying. The array keeps the owner ( the simulation handle ) alive.
+ * @param data First value of the buffer.
+ * @param layout Memory layout of the buffers.
+ * @param owner Python object owning the buffer.
+ * @return Array of shape ( cells_x, cells_y, cells_z ).
+ */
+py::array_t<double> interface_buffer_view( double* const data, Alpaca::BlockLayout const& layout, py::handle const owner ) {
+    std::vector<py::ssize_t> const shape = { py::ssize_t( layout.cells_[0] ), py::ssize_t( layout.cells_[1] ), py::ssize_t( layout.cells_[2] ) };
+    return py::array_t<double>( shape, data, owner );
+}
+
+/**
+ * @brief Gives the blocks of the local leaves of a simulation as dictionaries of metadata and zero-copy buffer views.
+ * @param simulation Python object of the simulation handle.
+ * @return One dictionary per leaf and material.
+ */
+py::list local_blocks( py::object const simulation ) {
+    Alpaca::Simulation& handle       = simulation.cast<Alpaca::Simulation&>();
+    Alpaca::BlockLayout const layout = Alpaca::Simulation::Layout( handle.Dimension() );
+    py::list blocks;
+    for( Alpaca::BlockView const& view : handle.LocalBlocks() ) {
+        py::dict block;
+        block["id"]            = view.id_;
+        block["level"]         = view.level_;
+        block["material"]      = view.material_;
+        block["origin"]        = view.origin_;
+        block["cell_size"]     = view.cell_size_;
+        block["conservatives"] = block_buffer_view( view.conservatives_, layout.conservative_names_.size(), layout, simulation );
+        block["prime_states"]  = block_buffer_view( view.prime_states_, layout.prime_state_names_.size(), layout, simulation );
+        if( !view.interface_descriptions_.empty() ) {
+            py::dict interface_descriptions;
+            for( std::size_t d = 0; d < view.interface_descriptions_.size(); ++d ) {
+                interface_descriptions[py::str( layout.interface_description_names_[d] )] = interface_buffer_view( view.interface_descriptions_[d], layout, simulation );
+            }
+            block["interface_descriptions"] = interface_descriptions;
+        } else {
+            block["interface_descriptions"] = py::none();
+        }
+        blocks.append( block );
+    }
+    return blocks;
+}
+
 PYBIND11_MODULE(alpacapy, m) {
     m.doc() = R"pbdoc(
         Pybind11 example plugin
@@ -18,10 +84,36 @@ PYBIND11_MODULE(alpacapy, m) {
            run_alpaca
     )pbdoc";
 
-    m.def("run_alpaca", &run_alpaca, R"pbdoc(
+    m.def("run_alpaca", &run_alpaca, py::arg("inputfile"), py::arg("dimension") = Alpaca::DefaultDimension(), R"pbdoc(
         Run ALPACA
-        Some other explanation about the add function.
+        Runs the inputfile in the given dimension ( one of compiled_dimensions() ).
     )pbdoc");
+    m.def("compiled_dimensions", &Alpaca::CompiledDimensions, "The dimensions compiled into the module");
+
+    // MPI must be initialized beforehand, e.g. by importing mpi4py
+    py::class_<Alpaca::Simulation>(m, "Simulation", "Handle to a simulation that is advanced step-wise")
+        .def(py::init<std::string const&, unsigned int>(), py::arg("inputfile"), py::arg("dimension") = Alpaca::DefaultDimension())
+        .def("advance", &Alpaca::Simulation::Advance, py::arg("number_of_timesteps"))
+        .def("advance_to", &Alpaca::Simulation::AdvanceTo, py::arg("time"))
+        .def("time", &Alpaca::Simulation::Time)
+        .def("is_finished", &Alpaca::Simulation::IsFinished)
+        .def("query", &Alpaca::Simulation::Query)
+        .def("local_blocks", &local_blocks, "Views of the non-dimensional buffers of the local leaves, invalidated by advancing")
+        .def("dimension", &Alpaca::Simulation::Dimension)
+        .def_static("block_layout", []( unsigned int const dimension ){
+            Alpaca::BlockLayout const layout = Alpaca::Simulation::Layout( dimension );
+            py::dict result;
+            result["cells"]                  = layout.cells_;
+            result["halo_size"]              = layout.halo_size_;
+            result["field_major"]            = layout.field_major_;
+            result["tile_width"]             = layout.tile_width_;
+            result["conservatives"]          = layout.conservative_names_;
+            result["prime_states"]           = layout.prime_state_names_;
+            result["interface_descriptions"] = layout.interface_description_names_;
+            return result;
+        }, py::arg("dimension") = Alpaca::DefaultDimension())
+        .def("write_output", &Alpaca::Simulation::WriteOutput)
+        .def("finalize", &Alpaca::Simulation::Finalize);
 
 #ifdef VERSION_INFO
     m.attr("__version__") = VERSION_INFO;
@@ -47,6 +47,9 @@ from alpacapy.post_analysis.check_symmetry import check_symmetry
 # The full Testsuite
 from alpacapy.testsuite.testsuite import Testsuite
 
+# Scaling studies
+from alpacapy.scaling.scaling_study import ScalingStudy
+
 __all__ = [
     "Logger"
     "NameStyle"
@@ -55,4 +58,5 @@ __all__ = [
     "post_processing"
     "post_analysis"
     "testsuite"
+    "scaling"
 ]
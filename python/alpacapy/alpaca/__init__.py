@@ -12,7 +12,7 @@ from . import (
 
 # Classes and functions
 from .create_executable import create_executable
-from .obtain_runtime_information import obtain_runtime_information
+from .obtain_runtime_information import obtain_runtime_information, obtain_profiling_regions
 from .remove_volatile_log_information import remove_volatile_log_information
 from .run_alpaca import run_alpaca
 
@@ -22,6 +22,7 @@ __all__ = [
     "specifications",
     "create_executable",
     "obtain_runtime_information",
+    "obtain_profiling_regions",
     "remove_volatile_log_information",
     "run_alpaca"
 ]
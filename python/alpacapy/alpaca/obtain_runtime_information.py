@@ -59,3 +59,47 @@ def obtain_runtime_information(log_file_path: str, verbose: bool = False) -> Lis
                 if verbose:
                     logger.write("Found compute loop runtime: " + str(runtimes[2]))
     return runtimes
+
+
+def obtain_profiling_regions(log_file_path: str) -> Dict[str, float]:
+    """ Reads the mean time of each profiler region from the last profiling summary of an Alpaca log file.
+
+    Parameters
+    ----------
+    log_file_path : str
+        The path to the log file of an Alpaca run (relative or absolute).
+    Returns
+    -------
+    Dict[str, float]
+        The mean time over all ranks of each region, where nested regions are given by their path (e.g., "TimeStep/Communication").
+        Empty if the run was not profiled.
+    Notes
+    -----
+    The log framing ("|* " and " *|") wraps the rows of the summary after the mean time, the column widths of the region (44) and of each value (12)
+    are defined in runtime_profiler.cpp.
+    """
+    region_width, value_width = 44, 12
+    mean_start = region_width + 2 * value_width
+    regions = {}
+    parents = []
+    in_table = False
+    with open(fo.get_absolute_path(log_file_path), 'r') as log_file:
+        for line in log_file:
+            content = line.rstrip("\n")
+            content = content[3:-3] if content.startswith("|* ") and content.endswith(" *|") else content
+            if content.startswith("Region") and "Calls" in content and "Mean [s]" in content:
+                # Only the last summary is kept
+                regions, parents, in_table = {}, [], True
+                continue
+            if not in_table:
+                continue
+            calls = content[region_width:region_width + value_width].strip()
+            if not calls.isdigit():
+                # Continuation lines hold the maximum time only, anything else ends the table
+                in_table = content.strip() == "Max [s]" or so.string_to_float(content.strip(), None) is not None
+                continue
+            name = content[:region_width].rstrip()
+            depth = (len(name) - len(name.lstrip())) // 2
+            parents = parents[:depth] + [name.strip()]
+            regions["/".join(parents)] = so.string_to_float(content[mean_start:mean_start + value_width].strip(), -1.0)
+    return regions
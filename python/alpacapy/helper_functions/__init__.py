@@ -5,6 +5,7 @@ Define all functions that can be used for general operations required in several
 
 # Classes and function
 from .bool_type import BoolType
+from .chunked_output import ChunkedOutput
 from .check_operations import check_dict_for_index_based_variations, check_format, check_type, check_list_element_existence,\
     check_list_element_instance, check_list_unique_elements
 from .file_operations import get_absolute_path, get_extension, get_files_in_folder, get_unused_folder
@@ -18,6 +19,7 @@ from .xml_operations import strip_xml_text, pretty_print_xml_tree, modify_xml_ta
 # Data for wildcard import (from . import *)
 __all__ = [
     "BoolType"
+    "ChunkedOutput"
     "check_dict_for_index_based_variations"
     "check_format"
     "check_type"
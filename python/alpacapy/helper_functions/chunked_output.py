@@ -0,0 +1,284 @@
+# Python modules
+from typing import List, Tuple, Dict, Union, Optional, Any, Type, IO, Iterator
+import numpy as np
+import h5py
+# alpacapy modules
+from alpacapy.helper_functions import file_operations as fo
+
+
+class ChunkedOutput:
+    """ Lazy access to the cell data of an ALPACA hdf5 output that never holds a full field in memory.
+
+    The cells are processed in ranges aligned with the chunks the writer used for the cell data (a fixed number of blocks or cells, see
+    Hdf5OutputSettings). With an MPI communicator, the ranges are distributed contiguously over the ranks and the file is opened with the mpio
+    driver of h5py if available. Reductions, slices and resampling combine the results of all ranks, i.e., they are collective calls.
+
+    Attributes
+    ----------
+    filename : str
+        The absolute path to the hdf5 file.
+    comm : mpi4py.MPI.Comm
+        The communicator the output is read with (None for a serial read).
+    """
+
+    def __init__(self, filename: str, comm: Any = None, cell_data_group: str = "cell_data", mesh_group: str = "mesh_topology",
+                 chunk_cells: Optional[int] = None) -> None:
+        """ Opens the output file.
+
+        Parameters
+        ----------
+        filename : str
+            The absolute or relative path to the hdf5 file.
+        comm : mpi4py.MPI.Comm, optional
+            The communicator the output is read with. None reads serially.
+        cell_data_group : str, optional
+            The group holding the cell data ("cell_data_<step>" for steps of shared time series files).
+        mesh_group : str, optional
+            The group holding the mesh topology ("mesh_topology_<step>" for steps of shared time series files).
+        chunk_cells : int, optional
+            The number of cells read at once. By default, the chunk size of the cell data is used.
+        """
+        self.filename = fo.get_absolute_path(filename)
+        self.comm = comm
+        if comm is not None and comm.Get_size() > 1 and h5py.get_config().mpi:
+            self.__file = h5py.File(self.filename, "r", driver="mpio", comm=comm)
+        else:
+            self.__file = h5py.File(self.filename, "r")
+        self.__cell_data = self.__file[cell_data_group]
+        # Steps of shared time series files carry the same suffix on all their groups
+        self.__metadata = self.__file["metadata" + cell_data_group[len("cell_data"):]]
+        self.__mesh = self.__file[mesh_group] if mesh_group in self.__file else None
+        self.__chunk_cells = chunk_cells
+
+    def __enter__(self) -> "ChunkedOutput":
+        return self
+
+    def __exit__(self, *args) -> None:
+        self.close()
+
+    def close(self) -> None:
+        """ Closes the output file. """
+        self.__file.close()
+
+    @property
+    def time(self) -> float:
+        """ The time of the output. """
+        return float(self.__metadata.attrs["time"])
+
+    @property
+    def quantities(self) -> List[str]:
+        """ The names of all quantities in the cell data group. """
+        return list(self.__cell_data.keys())
+
+    @property
+    def number_of_cells(self) -> int:
+        """ The global number of cells. """
+        return self.__cell_data[self.quantities[0]].shape[0]
+
+    def chunk_size(self, quantity: Optional[str] = None) -> int:
+        """ Gives the number of cells read at once.
+
+        Parameters
+        ----------
+        quantity : str, optional
+            The quantity the chunking is taken from. By default, the first quantity is used.
+        Returns
+        -------
+        int
+            The number of cells of a chunk.
+        """
+        if self.__chunk_cells is not None:
+            return self.__chunk_cells
+        dataset = self.__cell_data[quantity if quantity is not None else self.quantities[0]]
+        # Contiguous datasets are read in ranges of the default block chunking (64 blocks of 16^3 cells)
+        return dataset.chunks[0] if dataset.chunks is not None else 64 * 16**3
+
+    def local_cell_ranges(self, quantity: Optional[str] = None) -> List[Tuple[int, int]]:
+        """ Gives the chunk-aligned cell ranges of the current rank.
+
+        Parameters
+        ----------
+        quantity : str, optional
+            The quantity the chunking is taken from.
+        Returns
+        -------
+        List[Tuple[int,int]]
+            The start and end (exclusive) of each range.
+        """
+        chunk = self.chunk_size(quantity)
+        number_of_chunks = -(-self.number_of_cells // chunk)
+        rank, size = (self.comm.Get_rank(), self.comm.Get_size()) if self.comm is not None else (0, 1)
+        # Contiguous chunks per rank keep the reads of a rank sequential
+        first = rank * number_of_chunks // size
+        last = (rank + 1) * number_of_chunks // size
+        return [(index * chunk, min((index + 1) * chunk, self.number_of_cells)) for index in range(first, last)]
+
+    def iterate(self, quantity: str, component: Tuple[int, int] = (0, 0),
+                with_geometry: bool = False) -> Iterator[Tuple[Tuple[int, int], np.array, Optional[np.array], Optional[np.array]]]:
+        """ Iterates over the chunks of the current rank.
+
+        Parameters
+        ----------
+        quantity : str
+            The name of the quantity.
+        component : Tuple[int,int], optional
+            The component of the quantity (vector and matrix quantities).
+        with_geometry : bool, optional
+            Flag whether the lower and upper corners of the cells are read as well.
+        Returns
+        -------
+        Iterator
+            The cell range, the values and, if requested, the lower and upper corners of the cells.
+        """
+        dataset = self.__cell_data[quantity]
+        for start, end in self.local_cell_ranges(quantity):
+            values = np.asarray(dataset[start:end, component[0], component[1]], dtype=np.float64)
+            lower, upper = self.cell_bounds(start, end) if with_geometry else (None, None)
+            yield (start, end), values, lower, upper
+
+    def cell_bounds(self, start: int, end: int) -> Tuple[np.array, np.array]:
+        """ Gives the lower and upper corners of a range of cells.
+
+        Parameters
+        ----------
+        start : int
+            The first cell of the range.
+        end : int
+            The end of the range (exclusive).
+        Returns
+        -------
+        Tuple[np.array,np.array]
+            The lower and upper corners of the cells (cells x 3).
+        Notes
+        -----
+        Only the span of vertices referenced by the range is read, which is small since the writer stores the vertices block by block.
+        """
+        if self.__mesh is None:
+            raise RuntimeError("The output does not hold a mesh topology (it references the mesh of another file)!")
+        vertex_ids = np.asarray(self.__mesh["cell_vertex_IDs"][start:end])
+        first, last = int(vertex_ids.min()), int(vertex_ids.max()) + 1
+        coordinates = np.asarray(self.__mesh["cell_vertex_coordinates"][first:last], dtype=np.float64)[vertex_ids - first]
+        return coordinates.min(axis=1), coordinates.max(axis=1)
+
+    def __allreduce(self, values: np.array, operation: str) -> np.array:
+        """ Combines the values of all ranks.
+
+        Parameters
+        ----------
+        values : np.array
+            The local values.
+        operation : str
+            The reduction operation (sum, min or max).
+        Returns
+        -------
+        np.array
+            The combined values.
+        """
+        if self.comm is None:
+            return values
+        from mpi4py import MPI
+        result = np.empty_like(values)
+        self.comm.Allreduce(values, result, op={"sum": MPI.SUM, "min": MPI.MIN, "max": MPI.MAX}[operation])
+        return result
+
+    def reduce(self, quantity: str, operation: str, component: Tuple[int, int] = (0, 0)) -> float:
+        """ Reduces a quantity over all cells.
+
+        Parameters
+        ----------
+        quantity : str
+            The name of the quantity.
+        operation : str
+            The reduction: min, max, sum, mean (arithmetic) or volume_mean (weighted with the cell volumes).
+        component : Tuple[int,int], optional
+            The component of the quantity.
+        Returns
+        -------
+        float
+            The reduced value.
+        """
+        with_geometry = operation == "volume_mean"
+        if operation in ["min", "max"]:
+            local = np.array([np.inf if operation == "min" else -np.inf])
+        else:
+            local = np.zeros(2)
+        for _, values, lower, upper in self.iterate(quantity, component, with_geometry):
+            if operation == "min":
+                local[0] = min(local[0], values.min(initial=np.inf))
+            elif operation == "max":
+                local[0] = max(local[0], values.max(initial=-np.inf))
+            elif operation == "volume_mean":
+                volumes = np.prod(np.where(upper > lower, upper - lower, 1.0), axis=1)
+                local += [np.dot(values, volumes), volumes.sum()]
+            else:
+                local += [values.sum(), values.size]
+        if operation in ["min", "max"]:
+            return float(self.__allreduce(local, operation)[0])
+        total = self.__allreduce(local, "sum")
+        return float(total[0]) if operation == "sum" else float(total[0] / total[1])
+
+    def slice(self, quantity: str, axis: int, position: float, component: Tuple[int, int] = (0, 0)) -> Tuple[np.array, np.array]:
+        """ Extracts all cells cut by an axis-aligned plane.
+
+        Parameters
+        ----------
+        quantity : str
+            The name of the quantity.
+        axis : int
+            The normal direction of the plane (0 = x, 1 = y, 2 = z).
+        position : float
+            The coordinate of the plane.
+        component : Tuple[int,int], optional
+            The component of the quantity.
+        Returns
+        -------
+        Tuple[np.array,np.array]
+            The cell centers and values of the cut cells (on all ranks).
+        """
+        centers, values = [np.empty((0, 3))], [np.empty(0)]
+        for _, chunk_values, lower, upper in self.iterate(quantity, component, with_geometry=True):
+            # Half-open cells such that a plane on a cell face cuts only one cell
+            cut = (lower[:, axis] <= position) & (position < upper[:, axis])
+            centers.append(0.5 * (lower[cut] + upper[cut]))
+            values.append(chunk_values[cut])
+        centers, values = np.concatenate(centers), np.concatenate(values)
+        if self.comm is not None:
+            centers = np.concatenate(self.comm.allgather(centers))
+            values = np.concatenate(self.comm.allgather(values))
+        return centers, values
+
+    def resample(self, quantity: str, bounds: List[Tuple[float, float]], shape: Tuple[int, int, int],
+                 component: Tuple[int, int] = (0, 0)) -> np.array:
+        """ Resamples a quantity onto a uniform grid by volume-weighted averaging of the cells whose centers lie in a grid cell.
+
+        Parameters
+        ----------
+        quantity : str
+            The name of the quantity.
+        bounds : List[Tuple[float,float]]
+            The lower and upper bound of the grid in each direction.
+        shape : Tuple[int,int,int]
+            The number of grid cells in each direction.
+        component : Tuple[int,int], optional
+            The component of the quantity.
+        Returns
+        -------
+        np.array
+            The resampled values (on all ranks), NaN for grid cells without any cell center.
+        """
+        bounds = np.asarray(bounds, dtype=np.float64)
+        shape = np.asarray(shape, dtype=np.int64)
+        sums = np.zeros(2 * int(np.prod(shape)))
+        weighted, volume = sums[:np.prod(shape)], sums[np.prod(shape):]
+        for _, values, lower, upper in self.iterate(quantity, component, with_geometry=True):
+            centers = 0.5 * (lower + upper)
+            indices = np.floor((centers - bounds[:, 0]) / (bounds[:, 1] - bounds[:, 0]) * shape).astype(np.int64)
+            inside = np.all((indices >= 0) & (indices < shape), axis=1)
+            flat = np.ravel_multi_index(tuple(indices[inside].T), tuple(shape))
+            volumes = np.prod(np.where(upper > lower, upper - lower, 1.0), axis=1)[inside]
+            np.add.at(weighted, flat, values[inside] * volumes)
+            np.add.at(volume, flat, volumes)
+        sums = self.__allreduce(sums, "sum")
+        weighted, volume = sums[:np.prod(shape)], sums[np.prod(shape):]
+        with np.errstate(invalid="ignore", divide="ignore"):
+            return np.where(volume > 0.0, weighted / volume, np.nan).reshape(tuple(shape))
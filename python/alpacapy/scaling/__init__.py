@@ -0,0 +1,17 @@
+""" Alpaca scaling studies.
+
+Gives the possibility to run strong and weak scaling studies of Alpaca simulations on an increasing number of ranks. The runtime information and
+the profiler summary are collected from the log files, the parallel efficiencies are derived and written to machine-readable files and plots.
+Executables built with different block sizes can be compared on the same inputfiles with respect to time and memory per cell.
+"""
+# Classes and functions
+from .read_scaling_information import read_scaling_information
+from .block_size_study import BlockSizeStudy
+from .scaling_study import ScalingStudy
+
+# Data for wildcard import (from . import *)
+__all__ = [
+    "read_scaling_information",
+    "BlockSizeStudy",
+    "ScalingStudy"
+]
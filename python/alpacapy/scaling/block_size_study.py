@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+# Python modules
+from typing import List, Tuple, Dict, Union, Optional, Any, Type, IO
+import datetime
+import json
+import os
+import shutil
+# alpacapy modules
+from alpacapy.logger import Logger
+from alpacapy.alpaca.run_alpaca import run_alpaca
+from alpacapy.helper_functions import file_operations as fo
+from alpacapy.scaling.read_scaling_information import read_scaling_information
+
+
+class BlockSizeStudy:
+    """ Compares Alpaca executables that only differ in the block size, i.e., the internal cells per block and dimension.
+
+    The executables are the ALPACA_IC<N> variants of the build (target block_size_variants, block sizes set with the CMake option BLOCK_SIZES). Each
+    inputfile is run with each executable on the same number of ranks. The block size and halo width are read from the log of each run, such that
+    the executables can be named arbitrarily.
+
+    For each run the wall clock time per cell, the memory per cell and the halo fraction are reported. The memory per cell is the mean total memory
+    of a rank (see the memory report) divided by the cells per rank. The halo fraction is the share of halo cells in the cells allocated per block,
+    1 - IC^d / (IC + 2 * HS)^d. Note that the number of cells changes with the block size if the mesh is refined or the block size does not divide the
+    domain evenly.
+
+    Attributes
+    ----------
+    executable_paths : List[str]
+        The absolute paths to the Alpaca executables compared.
+    result_path : str
+        The absolute path to the folder, where all results of the study are written to.
+    number_of_ranks : int
+        The number of ranks all runs are performed on.
+    cases : Dict[str, Dict[str, Any]]
+        The cases of the study with their inputfile and, after running, the runs.
+    """
+
+    def __init__(self, executable_paths: List[str], result_path: str, number_of_ranks: int = 1, verbose: bool = False) -> None:
+        """ Constructor of the class.
+
+        Parameters
+        ----------
+        executable_paths : List[str]
+            The paths to the Alpaca executables (relative or absolute).
+        result_path : str
+            The path to the folder where the results are written to (relative or absolute). It is created if not existing.
+        number_of_ranks : int, optional
+            The number of ranks all runs are performed on, by default 1.
+        verbose : bool, optional
+            Flag to enable verbosity, by default False.
+        """
+        self.logger = Logger()
+        self.verbose = verbose
+        self.executable_paths = [fo.get_absolute_path(path) for path in executable_paths]
+        self.result_path = fo.get_absolute_path(result_path)
+        self.number_of_ranks = number_of_ranks
+        self.cases = {}
+
+    def add_case(self, inputfile_path: str, name: Optional[str] = None) -> None:
+        """ Adds an inputfile that is run with all executables.
+
+        Parameters
+        ----------
+        inputfile_path : str
+            The path to the inputfile (relative or absolute).
+        name : Optional[str], optional
+            The name of the case, by default the inputfile name without extension.
+        Raises
+        ------
+        ValueError
+            If the case name is already used.
+        """
+        inputfile_path = fo.get_absolute_path(inputfile_path)
+        name = fo.remove_extension(fo.remove_path(inputfile_path)) if name is None else name
+        if name in self.cases:
+            raise ValueError("The block size case " + name + " is already defined")
+        self.cases[name] = {"inputfile": inputfile_path, "runs": []}
+
+    @staticmethod
+    def halo_fraction(internal_cells: int, halo_width: int, dimensions: int) -> float:
+        """ Gives the share of halo cells in all cells allocated for a block.
+
+        Parameters
+        ----------
+        internal_cells : int
+            The internal cells per block and dimension.
+        halo_width : int
+            The halo cells on each side of a block.
+        dimensions : int
+            The number of dimensions of the simulation.
+        Returns
+        -------
+        float
+            The halo fraction.
+        """
+        return 1.0 - (internal_cells / (internal_cells + 2 * halo_width))**dimensions
+
+    @staticmethod
+    def __evaluate_run(run: Dict[str, Any]) -> None:
+        """ Derives the memory per cell and the halo fraction of a single run.
+
+        Parameters
+        ----------
+        run : Dict[str, Any]
+            The run holding the information of its log file, the results are added in-place.
+        """
+        run["memory_per_cell"] = None
+        run["halo_fraction"] = None
+        if run.get("mean_memory_per_rank") is not None and run.get("number_of_cells"):
+            run["memory_per_cell"] = run["mean_memory_per_rank"] * run["ranks"] / run["number_of_cells"]
+        if None not in (run.get("internal_cells_per_block"), run.get("halo_width"), run.get("dimensions")):
+            run["halo_fraction"] = BlockSizeStudy.halo_fraction(run["internal_cells_per_block"], run["halo_width"], run["dimensions"])
+
+    def run(self, print_progress: bool = False) -> None:
+        """ Runs all cases with all executables and collects the performance information of each run.
+
+        Parameters
+        ----------
+        print_progress : bool, optional
+            Flag whether the progress of each simulation is printed as status bar, by default False.
+        """
+        for name, case in self.cases.items():
+            if self.verbose:
+                self.logger.write("Running block size case " + name, color="bold")
+                self.logger.indent += 2
+            case["runs"] = []
+            for executable_path in self.executable_paths:
+                executable_name = fo.remove_path(executable_path)
+                run_path = os.path.join(self.result_path, name, executable_name)
+                os.makedirs(run_path, exist_ok=True)
+                inputfile_path = os.path.join(run_path, fo.remove_path(case["inputfile"]))
+                shutil.copyfile(case["inputfile"], inputfile_path)
+                if self.verbose:
+                    self.logger.write("Run with " + executable_name)
+                passed, result_folder = run_alpaca(executable_path, inputfile_path, run_path, self.number_of_ranks, print_progress, self.verbose)
+                run = {"executable": executable_path, "ranks": self.number_of_ranks, "passed": passed}
+                log_files = [] if result_folder is None else fo.get_files_in_folder(result_folder, extension=".log")
+                if passed and log_files:
+                    run.update(read_scaling_information(os.path.join(result_folder, log_files[0])))
+                    self.__evaluate_run(run)
+                case["runs"].append(run)
+            case["runs"].sort(key=lambda run: run.get("internal_cells_per_block") or 0)
+            if self.verbose:
+                self.__log_case(case)
+                self.logger.indent -= 2
+                self.logger.blank_line()
+
+    def best_block_sizes(self) -> Dict[str, Optional[int]]:
+        """ Gives the block size with the smallest wall clock time per cell for each case.
+
+        Returns
+        -------
+        Dict[str, Optional[int]]
+            The best block size of each case, None if no run of the case passed.
+        """
+        best = {}
+        for name, case in self.cases.items():
+            runs = [run for run in case["runs"] if run["passed"] and run.get("mean_time_per_cell") is not None]
+            best[name] = min(runs, key=lambda run: run["mean_time_per_cell"]).get("internal_cells_per_block") if runs else None
+        return best
+
+    def __log_case(self, case: Dict[str, Any]) -> None:
+        """ Logs the results of a single case as table.
+
+        Parameters
+        ----------
+        case : Dict[str, Any]
+            The case holding the evaluated runs.
+        """
+        def entry(run: Dict[str, Any], key: str) -> str:
+            return "n.a." if run.get(key) is None else "{:.3e}".format(run[key])
+        table = [["Block size", "Cells", "Time/Cell [s]", "Memory/Cell [B]", "Halo fraction"], []]
+        for run in case["runs"]:
+            block_size = run.get("internal_cells_per_block")
+            table.append([fo.remove_path(run["executable"]) if block_size is None else str(block_size), entry(run, "number_of_cells"),
+                          entry(run, "mean_time_per_cell"), entry(run, "memory_per_cell"), entry(run, "halo_fraction")])
+        self.logger.write_table(table)
+
+    def write_json(self, json_file_path: Optional[str] = None) -> str:
+        """ Writes the collected information of all cases into a JSON file.
+
+        Parameters
+        ----------
+        json_file_path : Optional[str], optional
+            The path to the JSON file (relative or absolute), by default block_sizes.json in the result folder.
+        Returns
+        -------
+        str
+            The absolute path to the written file.
+        """
+        json_file_path = os.path.join(self.result_path, "block_sizes.json") if json_file_path is None else fo.get_absolute_path(json_file_path)
+        os.makedirs(os.path.dirname(json_file_path), exist_ok=True)
+        data = {
+            "date": datetime.datetime.now().isoformat(timespec="seconds"),
+            "executables": self.executable_paths,
+            "ranks": self.number_of_ranks,
+            "best_block_sizes": self.best_block_sizes(),
+            "cases": {name: {"inputfile": case["inputfile"], "runs": case["runs"]} for name, case in self.cases.items()}
+        }
+        with open(json_file_path, 'w') as json_file:
+            json.dump(data, json_file, indent=2)
+        return json_file_path
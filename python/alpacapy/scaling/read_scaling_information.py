@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+# Python modules
+from typing import List, Tuple, Dict, Union, Optional, Any, Type, IO
+import re
+# alpacapy modules
+from alpacapy.helper_functions import string_operations as so
+from alpacapy.helper_functions import file_operations as fo
+
+# Width of the message part of a single Alpaca log line (see log_writer_implementation.cpp)
+_log_line_width = 80
+# A row of the profiler summary: indented region name, calls, minimum, mean and maximum time
+_profiler_row = re.compile(r"^( *)(\S.*?)\s+(\d+)\s+(\S+)\s+(\S+)\s+(\S+)\s*$")
+
+
+def _log_message(line: str) -> Optional[str]:
+    """ Gives the message part of an Alpaca log line, i.e., the line without the leading "|* " and the trailing " *|".
+
+    Parameters
+    ----------
+    line : str
+        The line of the log file.
+    Returns
+    -------
+    Optional[str]
+        The message part of the line (not stripped) or None if the line is not a message line.
+    """
+    line = line.rstrip("\n")
+    if not line.startswith("|* ") or not line.endswith(" *|"):
+        return None
+    return line[3:-3]
+
+
+def _parse_profiler_row(message: str) -> Optional[Tuple[int, str, List[float]]]:
+    """ Parses a single (joined) row of the profiler summary.
+
+    Parameters
+    ----------
+    message : str
+        The message holding the row.
+    Returns
+    -------
+    Optional[Tuple[int, str, List[float]]]
+        The depth of the region, its name and the [calls, minimum, mean, maximum] values. None if the message is not a valid row.
+    """
+    match = _profiler_row.match(message)
+    if match is None:
+        return None
+    values = [so.string_to_float(value, None) for value in match.groups()[2:]]
+    if None in values:
+        return None
+    return len(match.group(1)) // 2, match.group(2).strip(), values
+
+
+def read_scaling_information(log_file_path: str) -> Dict[str, Any]:
+    """ Reads the performance information of a single Alpaca run from its log file.
+
+    The wall clock time per cell is logged for each macro time step. Its mean is taken over all steps except the first one (warm-up), if more than
+    one step is present. The profiler summary is only available if the profiling section is present in the inputfile. If it is logged several times,
+    the last (final) summary is used. Rows of the summary that exceed the log line width are joined again. The same holds for the memory report, of
+    which the total memory of all categories is taken.
+
+    Parameters
+    ----------
+    log_file_path : str
+        The path to the log file of an Alpaca run (relative or absolute).
+    Returns
+    -------
+    Dict[str, Any]
+        The information with the keys "compute_loop_time", "mean_time_per_cell", "number_of_cells", "number_of_macro_steps", "dimensions",
+        "internal_cells_per_block", "halo_width", "mean_memory_per_rank", "peak_memory_per_rank" and "regions". The memory is given in bytes, the peak
+        is the largest high-water mark of all ranks. The regions map the full path of each profiled region (names separated by "/") onto its "calls",
+        "minimum", "mean" and "maximum" time in seconds. Values that are not found are None (an empty dictionary for the regions).
+    """
+    information = {
+        "compute_loop_time": None,
+        "mean_time_per_cell": None,
+        "number_of_cells": None,
+        "number_of_macro_steps": 0,
+        "dimensions": None,
+        "internal_cells_per_block": None,
+        "halo_width": None,
+        "mean_memory_per_rank": None,
+        "peak_memory_per_rank": None,
+        "regions": {}
+    }
+    times_per_cell = []
+
+    with open(fo.get_absolute_path(log_file_path), 'r') as log_file:
+        messages = [_log_message(line) for line in log_file]
+
+    index = 0
+    while index < len(messages):
+        message = messages[index]
+        index += 1
+        if message is None:
+            continue
+        if "Compute Loop" in message and "seconds" in message:
+            information["compute_loop_time"] = so.string_to_float(message[message.find(":") + 1:].strip(), None)
+        elif message.startswith("Wall clock time per cell"):
+            times_per_cell.append(so.string_to_float(message[message.find(":") + 1:].strip(), None))
+        elif message.startswith("Number of cells"):
+            information["number_of_cells"] = so.string_to_float(message[message.find(":") + 1:].strip(), None)
+        elif message.startswith("Dimensions") and ":" in message:
+            information["dimensions"] = int(so.string_to_float(message[message.find(":") + 1:].strip(), 0)) or None
+        elif message.startswith("Internal cells per block"):
+            # Of the form "<cells> ( halo width <cells> )"
+            values = re.findall(r"\d+", message[message.find(":") + 1:])
+            if len(values) == 2:
+                information["internal_cells_per_block"], information["halo_width"] = int(values[0]), int(values[1])
+        elif message.startswith("Memory per rank"):
+            # Rows of the categories, the total and the resident memory with minimum, mean, maximum and peak in MB
+            while index < len(messages) and messages[index] is not None and not messages[index].startswith("Total"):
+                index += 1
+            if index < len(messages) and messages[index] is not None:
+                values = [so.string_to_float(value, None) for value in messages[index].split()[1:]]
+                if len(values) == 4 and None not in values:
+                    information["mean_memory_per_rank"] = values[1] * 1.0e6
+                    information["peak_memory_per_rank"] = values[3] * 1.0e6
+        elif message.startswith("Region") and "Calls" in message:
+            # A new summary replaces the previous one. The header itself is wrapped onto the next line.
+            information["regions"] = {}
+            if index < len(messages) and messages[index] is not None and "Max" in messages[index]:
+                index += 1
+            parents = []
+            while index < len(messages) and messages[index] is not None:
+                row = _parse_profiler_row(messages[index])
+                consumed_lines = 1
+                # Rows longer than the log line width are continued on the next line
+                if len(messages[index]) == _log_line_width and index + 1 < len(messages) and messages[index + 1] is not None:
+                    joined_row = _parse_profiler_row(messages[index] + messages[index + 1])
+                    if joined_row is not None:
+                        row = joined_row
+                        consumed_lines = 2
+                if row is None:
+                    break
+                index += consumed_lines
+                depth, name, [calls, minimum, mean, maximum] = row
+                parents = parents[:depth] + [name]
+                information["regions"]["/".join(parents)] = {"calls": int(calls), "minimum": minimum, "mean": mean, "maximum": maximum}
+
+    times_per_cell = [time for time in times_per_cell if time is not None]
+    information["number_of_macro_steps"] = len(times_per_cell)
+    if len(times_per_cell) > 1:
+        times_per_cell = times_per_cell[1:]
+    if times_per_cell:
+        information["mean_time_per_cell"] = sum(times_per_cell) / len(times_per_cell)
+    return information
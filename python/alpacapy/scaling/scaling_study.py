@@ -0,0 +1,294 @@
+#!/usr/bin/env python3
+# Python modules
+from typing import List, Tuple, Dict, Union, Optional, Any, Type, IO
+import datetime
+import json
+import os
+import xml.etree.ElementTree as et
+# alpacapy modules
+from alpacapy.logger import Logger
+from alpacapy.alpaca.run_alpaca import run_alpaca
+from alpacapy.helper_functions import file_operations as fo
+from alpacapy.helper_functions import xml_operations as xo
+from alpacapy.scaling.read_scaling_information import read_scaling_information
+
+
+class ScalingStudy:
+    """ Runs strong and weak scaling studies of Alpaca simulations.
+
+    Each case of the study is a set of inputfiles run on a given number of ranks. For a strong scaling case the same inputfile is used for all rank
+    numbers, for a weak scaling case the inputfile of each rank number must provide a problem size that grows with the number of ranks. The profiling
+    section is added to all inputfiles, such that the region times of the runtime profiler are collected together with the wall clock time per cell.
+
+    The parallel efficiency of a run on p ranks with respect to the reference run on p0 ranks (smallest rank number of the case) is
+    E = (p0 * t0 / N0) / (p * t / N), where t is the mean wall clock time per macro step and N the number of cells. It is the classical strong scaling
+    efficiency for a fixed N and the weak scaling efficiency for N proportional to p. The same measure is applied to the mean time of each profiled region.
+
+    Attributes
+    ----------
+    executable_path : str
+        The absolute path to the Alpaca executable used for all runs.
+    result_path : str
+        The absolute path to the folder, where all results of the study are written to.
+    cases : Dict[str, Dict[str, Any]]
+        The cases of the study with their type ("strong" or "weak"), the inputfile per rank number and, after running, the runs.
+    """
+
+    def __init__(self, executable_path: str, result_path: str, verbose: bool = False) -> None:
+        """ Constructor of the class.
+
+        Parameters
+        ----------
+        executable_path : str
+            The path to the Alpaca executable (relative or absolute).
+        result_path : str
+            The path to the folder where the results are written to (relative or absolute). It is created if not existing.
+        verbose : bool, optional
+            Flag to enable verbosity, by default False.
+        """
+        self.logger = Logger()
+        self.verbose = verbose
+        self.executable_path = fo.get_absolute_path(executable_path)
+        self.result_path = fo.get_absolute_path(result_path)
+        self.cases = {}
+
+    def add_strong_scaling_case(self, inputfile_path: str, ranks: List[int], name: Optional[str] = None) -> None:
+        """ Adds a strong scaling case, i.e., a single inputfile that is run on all given rank numbers.
+
+        Parameters
+        ----------
+        inputfile_path : str
+            The path to the inputfile (relative or absolute).
+        ranks : List[int]
+            The rank numbers the inputfile is run on.
+        name : Optional[str], optional
+            The name of the case, by default the inputfile name without extension.
+        """
+        inputfile_path = fo.get_absolute_path(inputfile_path)
+        name = fo.remove_extension(fo.remove_path(inputfile_path)) if name is None else name
+        self.__add_case(name, "strong", {number_of_ranks: inputfile_path for number_of_ranks in ranks})
+
+    def add_weak_scaling_case(self, inputfile_paths: Dict[int, str], name: str) -> None:
+        """ Adds a weak scaling case, i.e., one inputfile per rank number with a problem size growing with the rank number.
+
+        Parameters
+        ----------
+        inputfile_paths : Dict[int, str]
+            The paths to the inputfiles (relative or absolute) for each rank number.
+        name : str
+            The name of the case.
+        """
+        self.__add_case(name, "weak", {number_of_ranks: fo.get_absolute_path(path) for number_of_ranks, path in inputfile_paths.items()})
+
+    def __add_case(self, name: str, scaling_type: str, inputfiles: Dict[int, str]) -> None:
+        """ Adds a case to the study.
+
+        Parameters
+        ----------
+        name : str
+            The name of the case.
+        scaling_type : str
+            The type of the scaling ("strong" or "weak").
+        inputfiles : Dict[int, str]
+            The absolute inputfile paths for each rank number.
+        Raises
+        ------
+        ValueError
+            If the case name is already used or a rank number is not positive.
+        """
+        if name in self.cases:
+            raise ValueError("The scaling case " + name + " is already defined")
+        if not inputfiles or min(inputfiles.keys()) < 1:
+            raise ValueError("The scaling case " + name + " requires at least one positive rank number")
+        self.cases[name] = {"type": scaling_type, "inputfiles": dict(sorted(inputfiles.items())), "runs": []}
+
+    def __create_profiling_inputfile(self, inputfile_path: str, modified_inputfile_path: str) -> None:
+        """ Copies an inputfile and adds the profiling section to its output section (if not already present).
+
+        Parameters
+        ----------
+        inputfile_path : str
+            The absolute path to the original inputfile.
+        modified_inputfile_path : str
+            The absolute path to the inputfile that is written.
+        """
+        tree = et.parse(inputfile_path)
+        root = tree.getroot()
+        output = root.find("output")
+        if output is None:
+            output = et.SubElement(root, "output")
+        if output.find("profiling") is None:
+            et.SubElement(output, "profiling")
+        xo.pretty_print_xml_tree(root, level_indent=3)
+        tree.write(modified_inputfile_path)
+
+    def run(self, print_progress: bool = False) -> None:
+        """ Runs all cases of the study on all their rank numbers and collects the performance information of each run.
+
+        Parameters
+        ----------
+        print_progress : bool, optional
+            Flag whether the progress of each simulation is printed as status bar, by default False.
+        """
+        for name, case in self.cases.items():
+            if self.verbose:
+                self.logger.write("Running " + case["type"] + " scaling case " + name, color="bold")
+                self.logger.indent += 2
+            case["runs"] = []
+            for number_of_ranks, inputfile_path in case["inputfiles"].items():
+                run_path = os.path.join(self.result_path, name, "ranks_" + str(number_of_ranks))
+                os.makedirs(run_path, exist_ok=True)
+                profiling_inputfile = os.path.join(run_path, fo.remove_path(inputfile_path))
+                self.__create_profiling_inputfile(inputfile_path, profiling_inputfile)
+                if self.verbose:
+                    self.logger.write("Run on " + str(number_of_ranks) + " ranks")
+                passed, result_folder = run_alpaca(self.executable_path, profiling_inputfile, run_path, number_of_ranks, print_progress, self.verbose)
+                run = {"ranks": number_of_ranks, "inputfile": inputfile_path, "passed": passed}
+                log_files = [] if result_folder is None else fo.get_files_in_folder(result_folder, extension=".log")
+                if passed and log_files:
+                    run.update(read_scaling_information(os.path.join(result_folder, log_files[0])))
+                case["runs"].append(run)
+            self.__compute_efficiencies(case)
+            if self.verbose:
+                self.__log_case(case)
+                self.logger.indent -= 2
+                self.logger.blank_line()
+
+    @staticmethod
+    def __normalized_time(time: Optional[float], number_of_ranks: int, number_of_cells: Optional[float]) -> Optional[float]:
+        """ Gives the time spent per cell and rank, i.e., the inverse of the per-rank throughput.
+
+        Parameters
+        ----------
+        time : Optional[float]
+            The time in seconds.
+        number_of_ranks : int
+            The number of ranks.
+        number_of_cells : Optional[float]
+            The number of cells.
+        Returns
+        -------
+        Optional[float]
+            The normalized time or None if any of the values is not available.
+        """
+        if time is None or number_of_cells is None or number_of_cells <= 0.0:
+            return None
+        return time * number_of_ranks / number_of_cells
+
+    def __compute_efficiencies(self, case: Dict[str, Any]) -> None:
+        """ Computes the parallel efficiency (and for strong scaling the speedup) of all passed runs with respect to the first passed run.
+
+        Parameters
+        ----------
+        case : Dict[str, Any]
+            The case holding the runs, the results are added in-place.
+        """
+        passed_runs = [run for run in case["runs"] if run["passed"] and run.get("mean_time_per_cell") is not None]
+        if not passed_runs:
+            return
+        reference = passed_runs[0]
+        # The time per cell is already normalized by the number of cells
+        reference_time = reference["mean_time_per_cell"] * reference["ranks"]
+        for run in passed_runs:
+            run["efficiency"] = reference_time / (run["mean_time_per_cell"] * run["ranks"])
+            if case["type"] == "strong" and reference.get("compute_loop_time") and run.get("compute_loop_time"):
+                run["speedup"] = reference["compute_loop_time"] / run["compute_loop_time"]
+            for path, region in run["regions"].items():
+                reference_region = reference["regions"].get(path)
+                if reference_region is None:
+                    continue
+                region_time = self.__normalized_time(region["mean"], run["ranks"], run["number_of_cells"])
+                reference_region_time = self.__normalized_time(reference_region["mean"], reference["ranks"], reference["number_of_cells"])
+                if region_time and reference_region_time:
+                    region["efficiency"] = reference_region_time / region_time
+
+    def __log_case(self, case: Dict[str, Any]) -> None:
+        """ Logs the efficiencies of a single case as table.
+
+        Parameters
+        ----------
+        case : Dict[str, Any]
+            The case holding the evaluated runs.
+        """
+        def entry(run: Dict[str, Any], key: str) -> str:
+            return "n.a." if run.get(key) is None else "{:.3e}".format(run[key])
+        table = [["Ranks", "Cells", "Time/Cell [s]", "Efficiency", "Speedup"], []]
+        for run in case["runs"]:
+            table.append([str(run["ranks"]), entry(run, "number_of_cells"), entry(run, "mean_time_per_cell"),
+                          entry(run, "efficiency"), entry(run, "speedup")])
+        self.logger.write_table(table)
+
+    def write_json(self, json_file_path: Optional[str] = None) -> str:
+        """ Writes the collected information of all cases into a JSON file.
+
+        Parameters
+        ----------
+        json_file_path : Optional[str], optional
+            The path to the JSON file (relative or absolute), by default scaling.json in the result folder.
+        Returns
+        -------
+        str
+            The absolute path to the written file.
+        """
+        json_file_path = os.path.join(self.result_path, "scaling.json") if json_file_path is None else fo.get_absolute_path(json_file_path)
+        os.makedirs(os.path.dirname(json_file_path), exist_ok=True)
+        data = {
+            "date": datetime.datetime.now().isoformat(timespec="seconds"),
+            "executable": self.executable_path,
+            "cases": {name: {"type": case["type"], "runs": case["runs"]} for name, case in self.cases.items()}
+        }
+        with open(json_file_path, 'w') as json_file:
+            json.dump(data, json_file, indent=2)
+        return json_file_path
+
+    def plot(self, maximum_depth: int = 0) -> List[str]:
+        """ Plots the parallel efficiency of each case over the number of ranks into the result folder.
+
+        The efficiency of the whole time step is plotted together with the efficiencies of all profiled regions up to the given depth.
+        Requires matplotlib. If it is not installed, no plots are created.
+
+        Parameters
+        ----------
+        maximum_depth : int, optional
+            The maximum depth of the profiled regions that are plotted (0 for the top-level regions only), by default 0.
+        Returns
+        -------
+        List[str]
+            The absolute paths to the created plots.
+        """
+        try:
+            import matplotlib
+            matplotlib.use("Agg")
+            import matplotlib.pyplot as plt
+        except ImportError:
+            self.logger.write("Matplotlib is not available. No scaling plots are created", color="y")
+            return []
+
+        plot_files = []
+        for name, case in self.cases.items():
+            runs = [run for run in case["runs"] if run.get("efficiency") is not None]
+            if not runs:
+                continue
+            figure, axis = plt.subplots(figsize=(8, 5))
+            ranks = [run["ranks"] for run in runs]
+            axis.plot(ranks, [run["efficiency"] for run in runs], "k-o", linewidth=2, label="Time per cell")
+            paths = [path for path in runs[-1]["regions"] if path.count("/") <= maximum_depth]
+            for path in paths:
+                region_runs = [run for run in runs if run["regions"].get(path, {}).get("efficiency") is not None]
+                if region_runs:
+                    axis.plot([run["ranks"] for run in region_runs], [run["regions"][path]["efficiency"] for run in region_runs],
+                              "--.", linewidth=1, label=path)
+            axis.axhline(1.0, color="grey", linewidth=0.5)
+            axis.set_xscale("log", base=2)
+            axis.set_xticks(ranks)
+            axis.set_xticklabels([str(number_of_ranks) for number_of_ranks in ranks])
+            axis.set_xlabel("Ranks")
+            axis.set_ylabel(case["type"].capitalize() + " scaling efficiency")
+            axis.set_title(name)
+            axis.legend(fontsize="small", loc="best")
+            figure.tight_layout()
+            plot_file = os.path.join(self.result_path, name + "_efficiency.png")
+            figure.savefig(plot_file, dpi=150)
+            plt.close(figure)
+            plot_files.append(plot_file)
+        return plot_files
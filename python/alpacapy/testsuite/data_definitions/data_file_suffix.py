@@ -18,6 +18,8 @@ class DataFileSuffix(Enum):
     executables = "executables"
     # The file (suffix) where runtime information is read from or written to.
     runtimes = "runtimes"
+    # The file (suffix) where the runtimes of the profiler regions are read from or written to.
+    regions = "regions"
     # The suffix for the testcase
     testcase = "testcase"
 
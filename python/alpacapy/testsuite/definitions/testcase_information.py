@@ -33,6 +33,9 @@ class TestcaseInfo:
         Flag whether the variations are done index based or not (see result_data.py for reference).
     __reference_variables :
         Reference values that exists for the test case (see result_reference_data.py for reference).
+    __runtime_tolerances : List[float]
+        The relative deviation from the reference runtimes (in percent) that still passes for each dimension. Up to 2.5 times the tolerance is a
+        warning, beyond it a regression.
     """
 
     def __init__(self, active: bool, name: str, dimensions: List[int], skip_no_reference_cases: bool, index_based_case_variation: bool = False,
@@ -50,6 +53,7 @@ class TestcaseInfo:
         self.__index_based_case_variation = index_based_case_variation
         self.__case_variations = case_variations
         self.__reference_variables = reference_variables
+        self.__runtime_tolerances = [2.0, 2.0, 2.0]
 
     @property
     def active(self) -> bool:
@@ -71,6 +75,18 @@ class TestcaseInfo:
         """ allows .dimensions access of the dimensions used for the testcase """
         return self.__dimensions
 
+    @property
+    def runtime_tolerances(self) -> List[float]:
+        """ allows .runtime_tolerances access of the runtime tolerances (in percent) for each dimension """
+        return self.__runtime_tolerances
+
+    @runtime_tolerances.setter
+    def runtime_tolerances(self, tolerances: List[float]) -> None:
+        """ allows setting the runtime tolerances (in percent) for each dimension """
+        if len(tolerances) != 3 or any([tolerance <= 0.0 for tolerance in tolerances]):
+            raise ValueError("A positive runtime tolerance must be given for each dimension!")
+        self.__runtime_tolerances = [float(tolerance) for tolerance in tolerances]
+
     def __repr__(self):
         """ Implementation of the built-in repr function """
         string = "Activity status: " + str(self.__active)
@@ -88,6 +104,8 @@ class TestcaseInfo:
         """
         xo.modify_xml_tag(xml_element, str(self.__active), NameStyle.xml.format(self.__name), "active")
         xo.modify_xml_tag(xml_element, str(self.__skip_no_reference_cases), NameStyle.xml.format(self.__name), "skipNoReferenceCases")
+        xo.modify_xml_tag(xml_element, " ".join([str(tolerance) for tolerance in self.__runtime_tolerances]), NameStyle.xml.format(self.__name),
+                          "runtimeTolerance")
 
     def log_setup(self) -> None:
         """ logs the information contained in this class """
@@ -98,6 +116,7 @@ class TestcaseInfo:
         if self.__active:
             logger.write("Dimensions            : " + " ".join([str(dim) for dim in self.__dimensions]))
             logger.write("Skip cases            : " + str(self.__skip_no_reference_cases))
+            logger.write("Runtime tolerances    : " + " ".join([str(tolerance) + " %" for tolerance in self.__runtime_tolerances]))
             variables = ", ".join(self.__reference_variables) if self.__reference_variables else "N/A"
             logger.write("Reference variables   : " + variables)
             if self.__case_variations:
@@ -152,6 +152,10 @@ class TestsuiteInfo:
                 input_arg_dict["environment_ranks"] = self.environment.number_of_ranks()
             # Append the test case to the list
             self.test_cases.append(test_case(**input_arg_dict))
+            # Optional tolerance of the runtime checks (in percent, one value for all or one per dimension)
+            if xo.exists_tag(config_file_root, "testCases", case_tag, "runtimeTolerance"):
+                tolerances = [float(value) for value in xo.read_splitted_xml_tag(config_file_root, "testCases", case_tag, "runtimeTolerance")]
+                self.test_cases[-1].info.runtime_tolerances = tolerances * 3 if len(tolerances) == 1 else tolerances
 
         # Check the dimensions
         if not self.dimensions:
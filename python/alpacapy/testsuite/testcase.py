@@ -9,6 +9,7 @@ import time
 import datetime
 import subprocess as sp
 import shutil as su
+import xml.etree.ElementTree as et
 # alpacapy modules
 from alpacapy.logger import Logger
 from alpacapy.name_style import NameStyle
@@ -16,7 +17,7 @@ from alpacapy.helper_functions import string_operations as so
 from alpacapy.helper_functions import mathematical_operations as mo
 from alpacapy.helper_functions import file_operations as fo
 from alpacapy.alpaca.run_alpaca import run_alpaca
-from alpacapy.alpaca.obtain_runtime_information import obtain_runtime_information
+from alpacapy.alpaca.obtain_runtime_information import obtain_runtime_information, obtain_profiling_regions
 from alpacapy.alpaca.specifications.inputfile_specifications import InputfileSpecifications
 from alpacapy.testsuite.definitions.folder_setup import FolderSetup
 from alpacapy.testsuite.definitions.executable_setup import ExecutableSetup
@@ -69,6 +70,10 @@ class Testcase:
     __runtime_reference_map : List[Dict[int,int]]
        A list of dictionary per dimension mapping the case ID to be run to the case ID holding the reference runtimes. Empty if none can be mapped
        (always all three dimensions for proper mapping).
+    __reference_regions : List[pd.DataFrame]
+       The reference runtimes of the profiler regions per dimension (same rows as the reference runtimes). Empty if no reference file exists.
+    __region_columns : List[List[str]]
+       The columns holding the runtimes of the profiler regions per dimension (added as soon as a region appears in a log file).
     __compute_time_list : List[float]
        A list holding per dimension the total time spent for computation of the testcase (always all three dimensions for proper mapping).
 
@@ -119,6 +124,8 @@ class Testcase:
         self.__cases_to_skip = [[] for dim in [1, 2, 3]]
         self.__result_reference_map = [{} for dim in [1, 2, 3]]
         self.__runtime_reference_map = [{} for dim in [1, 2, 3]]
+        self.__reference_regions = [pd.DataFrame([]) for dim in [1, 2, 3]]
+        self.__region_columns = [[] for dim in [1, 2, 3]]
         # List holding the measured time for the test case computation (one time per dimension)
         self.__compute_time_list = [0.0 for dim in [1, 2, 3]]
 
@@ -136,6 +143,7 @@ class Testcase:
             self.__result_data[dim - 1].add_column("Runtime", float, "{:15.8f}")
             self.__result_data[dim - 1].add_column("RuntimeStatus", str, "{:>20s}")
             self.__result_data[dim - 1].add_column("RuntimeToRef", float, "{:15.4f}")
+            self.__result_data[dim - 1].add_column("RegressedRegions", str, "{:s}")
             self.__result_data[dim - 1].add_column("ResultFolder", str, "{:s}")
 
     def __repr__(self):
@@ -371,6 +379,10 @@ class Testcase:
                     # Add the data to the appropriate dicts and lists (copy to avoid problems with mutable objects)
                     self.__runtime_reference_map[dim - 1] = dict(case_reference_map)
                     self.__cases_to_skip[dim - 1] = cases_to_skip
+                    # The runtimes of the profiler regions are optional (same rows as the runtimes since both are written from the same data)
+                    regions_reference_csv = folder_setup.get_csv_file(self.__info.name, dim, DataFileSuffix.regions.reference, True)
+                    if regions_reference_csv is not None:
+                        self.__reference_regions[dim - 1] = pd.read_csv(regions_reference_csv, sep=' *, *', skipinitialspace=True, engine="python")
                 else:
                     self.logger.write(str(dim) + "D Runtimes: " + str(ResultStatus.warning), color=ResultStatus.warning.color)
                     self.logger.indent += 2
@@ -506,6 +518,9 @@ class Testcase:
                             inputfile_specs = InputfileSpecifications.from_pandas(case_data)
                             inputfile_specs.modify_specifications(inputfile_path, new_inputfile_path, use_default_values=False)
 
+                        # Enable the profiler to obtain the runtimes of the individual algorithm parts
+                        new_inputfile_path = self.__enable_profiling(new_inputfile_path, result_folder_path)
+
                         # Modify the number of ranks for the case if varied
                         if "NumberOfRanks" in case_data.index:
                             number_of_ranks = case_data["NumberOfRanks"]
@@ -550,6 +565,48 @@ class Testcase:
             # End time measurement and append to list
             self.__compute_time_list[dim - 1] += time.time() - start_time
 
+    @staticmethod
+    def __enable_profiling(inputfile_path: str, folder_path: str) -> str:
+        """ Ensures that the profiler is active for an inputfile.
+
+        Parameters
+        ----------
+        inputfile_path : str
+            The absolute path to the inputfile.
+        folder_path : str
+            The absolute path to the folder where a modified copy of the inputfile is placed (if it does not lie in there already).
+        Returns
+        -------
+        str
+            The absolute path to the inputfile with active profiler (the given one if the profiler is active already).
+        """
+        xml_root = et.parse(inputfile_path).getroot()
+        if xml_root.find("output/profiling") is not None:
+            return inputfile_path
+        output = xml_root.find("output")
+        if output is None:
+            output = et.SubElement(xml_root, "output")
+        et.SubElement(output, "profiling")
+        new_inputfile_path = os.path.join(folder_path, fo.remove_path(inputfile_path))
+        et.ElementTree(xml_root).write(new_inputfile_path)
+        return new_inputfile_path
+
+    def __add_region_column(self, dim: int, column: str) -> None:
+        """ Adds a column for the runtime of a profiler region.
+
+        Parameters
+        ----------
+        dim : int
+            The dimension of the result data.
+        column : str
+            The name of the column.
+        """
+        self.__result_data[dim - 1].add_column(column, float, "{:15.8f}")
+        # Cases without the region are marked as the cases without runtime
+        for case_id in self.__result_data[dim - 1].case_ids():
+            self.__result_data[dim - 1].set_value(case_id, column, -1.0)
+        self.__region_columns[dim - 1].append(column)
+
     def _check_simulation_implementation(self, dim: int, case_variation: pd.Series, result_folder: str, reference_data: Optional[pd.Series] = None):
         """ Check simulation function that can be provided by all test cases.
 
@@ -717,6 +774,8 @@ class Testcase:
                 status = ResultStatus.passed
                 relative_error = -1
                 runtime = None
+                regions = {}
+                regressed_regions = []
 
                 # Check whether the simulation passed or not
                 if all_case_data["SimulationStatus"] == str(ResultStatus.simulation_failed):
@@ -736,6 +795,7 @@ class Testcase:
                         else:
                             # Read the runtime from the file
                             [_, _, runtime] = obtain_runtime_information(log_file[0])
+                            regions = obtain_profiling_regions(log_file[0])
 
                         if case_id in self.__runtime_reference_map[dim - 1] and runtime is not None:
                             ref_case_id = self.__runtime_reference_map[dim - 1][case_id]
@@ -743,7 +803,21 @@ class Testcase:
                             # Compute the relative error between both runtimes
                             relative_error = mo.get_relative_error(runtime, reference_runtime)
                             # Get the status of the runtime comparison
-                            status = ResultStatus.status_of_absolute_value(runtime, reference_runtime, 2e-2, 5e-2, lower_bound=0)
+                            tolerance = self.__info.runtime_tolerances[dim - 1] * 1e-2
+                            status = ResultStatus.status_of_absolute_value(runtime, reference_runtime, tolerance, 2.5 * tolerance, lower_bound=0)
+                            # A region regressed if it is slower than the warning tolerance. Regions taking less than one percent of the total
+                            # runtime are too noisy to be compared.
+                            if not self.__reference_regions[dim - 1].empty and ref_case_id in self.__reference_regions[dim - 1].index:
+                                reference_regions = self.__reference_regions[dim - 1].loc[ref_case_id]
+                                for region, region_time in regions.items():
+                                    reference_time = float(reference_regions.get("Region:" + region, -1.0))
+                                    if reference_time <= 0.0 or reference_time < 1e-2 * reference_runtime:
+                                        continue
+                                    if ResultStatus.status_of_absolute_value(region_time, reference_time, tolerance, 2.5 * tolerance,
+                                                                             lower_bound=0) == ResultStatus.failed:
+                                        regressed_regions.append(region)
+                                if regressed_regions:
+                                    status = ResultStatus.failed
                         else:
                             status = ResultStatus.no_reference
 
@@ -751,6 +825,11 @@ class Testcase:
                 self.__result_data[dim - 1].set_value(case_id, "Runtime", -1.0 if runtime is None else runtime)
                 self.__result_data[dim - 1].set_value(case_id, "RuntimeStatus", status)
                 self.__result_data[dim - 1].set_value(case_id, "RuntimeToRef", mo.get_percentage(relative_error))
+                self.__result_data[dim - 1].set_value(case_id, "RegressedRegions", ";".join(regressed_regions))
+                for region, region_time in regions.items():
+                    if "Region:" + region not in self.__region_columns[dim - 1]:
+                        self.__add_region_column(dim, "Region:" + region)
+                    self.__result_data[dim - 1].set_value(case_id, "Region:" + region, region_time)
 
                 # Log information
                 if dim != 1:
@@ -761,6 +840,8 @@ class Testcase:
                     if status not in ResultStatus.no_data_results():
                         self.logger.write("Ref-Runtime  : " + str(reference_runtime) + " s")
                         self.logger.write("RuntimeToRef : " + str(so.convert_to_percentage(relative_error, precision=4)) + " %")
+                    if regressed_regions:
+                        self.logger.write("Regressed    : " + ", ".join(regressed_regions), color="r")
                     self.logger.write("=> Testcase " + str(status), color=status.color)
                     self.logger.blank_line()
                     self.logger.indent -= 2
@@ -924,7 +1005,13 @@ class Testcase:
                 self.logger.write("Runtime status data  : " + fo.remove_path(csv_filename_status))
 
                 self.__result_data[dim - 1].to_csv(csv_filename, "Runtime")
-                self.__result_data[dim - 1].to_csv(csv_filename_status, "Runtime", "RuntimeToRef", "RuntimeStatus")
+                self.__result_data[dim - 1].to_csv(csv_filename_status, "Runtime", "RuntimeToRef", "RuntimeStatus", "RegressedRegions")
+
+                # Write the runtimes of the profiler regions (usable as reference for later runs) and append them to the runtime history
+                csv_filename = folder_setup.get_csv_file(self.__info.name, dim, DataFileSuffix.regions.value)
+                self.logger.write("Region data          : " + fo.remove_path(csv_filename))
+                self.__result_data[dim - 1].to_csv(csv_filename, "Runtime", *self.__region_columns[dim - 1])
+                self.__append_runtime_history(dim, folder_setup)
 
                 # Write the result data
                 if self.__reference_data[dim - 1].active:
@@ -953,6 +1040,33 @@ class Testcase:
             self.logger.write(str(ResultStatus.deactivated), color=ResultStatus.deactivated.color)
         self.logger.indent -= 2
 
+    def __append_runtime_history(self, dim: int, folder_setup: FolderSetup) -> None:
+        """ Appends the runtimes of all cases of a dimension to the runtime history of all testsuite runs.
+
+        The history lies next to the testsuite folders and holds one row per case and region (Region "Total" for the full runtime), such that
+        the runtimes of a case can be followed over all runs.
+
+        Parameters
+        ----------
+        dim : int
+            The dimension of the result data.
+        folder_setup : FolderSetup
+            The setup class providing path/folder information.
+        """
+        date = datetime.datetime.now().strftime("%Y-%m-%d %H:%M:%S")
+        rows = []
+        for case_id, case_data in self.__result_data[dim - 1].itercases():
+            if case_data["Runtime"] < 0.0:
+                continue
+            regions = {"Total": case_data["Runtime"]}
+            regions.update({column[len("Region:"):]: case_data[column] for column in self.__region_columns[dim - 1] if case_data[column] >= 0.0})
+            rows += [{"Date": date, "Testcase": self.__info.name, "Dimension": dim, "Inputfile": case_data["Inputfile"],
+                      "Executable": case_data["Executable"], "Case": self.__result_data[dim - 1].case_variation_string(case_id),
+                      "Region": region, "Time": region_time} for region, region_time in regions.items()]
+        if rows:
+            history_file = os.path.join(os.path.dirname(folder_setup.testsuite_path), "runtime_history.csv")
+            pd.DataFrame(rows).to_csv(history_file, mode="a", header=not os.path.isfile(history_file), index=False)
+
     def log_setup(self) -> None:
         """ Logs the setup of the test case in appropriate form """
         self.__info.log_setup()
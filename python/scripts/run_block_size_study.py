@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+# Python modules
+from argparse import ArgumentParser
+# alpacapy modules
+from alpacapy.scaling.block_size_study import BlockSizeStudy
+from alpacapy.logger import Logger
+
+
+def setup_argument_parser():
+    """ Creates the argument parser to pass commandline arguments.
+
+    Returns
+    -------
+    ArgumentParser
+        The fully created argument parser.
+    """
+    parser = ArgumentParser(prog="Run block size study",
+                            description="Runs inputfiles with Alpaca executables built for different block sizes (target block_size_variants) "
+                            "and compares the wall clock time per cell, the memory per cell and the halo fraction")
+    parser.add_argument("result_path", help="The path to the folder where the runs and the JSON file are written to", type=str)
+    parser.add_argument("--executables", nargs="+", dest="executable_paths", metavar="EXECUTABLE", required=True,
+                        help="The Alpaca executables that are compared, e.g., build/ALPACA_IC8 build/ALPACA_IC16 build/ALPACA_IC32")
+    parser.add_argument("--inputfiles", nargs="+", dest="inputfiles", metavar="INPUTFILE", required=True,
+                        help="Inputfiles (e.g., from testsuite/InputFiles) that are run with all executables")
+    parser.add_argument("--ranks", type=int, dest="number_of_ranks", default=1, help="The number of ranks used for all runs")
+    parser.add_argument("--json-file", dest="json_file_path", default=None,
+                        help="The path to the JSON file holding the results, by default block_sizes.json in the result folder")
+    parser.add_argument("--print-progress", action="store_true", dest="print_progress", default=False,
+                        help="If set, the progress of each simulation is printed to the terminal")
+    parser.add_argument("--quiet", action="store_false", dest="verbose", help="Disables verbosity logging", default=True)
+    return parser
+
+
+if __name__ == "__main__":
+    """ Main part to be called when using the module with direct call. """
+    parser = setup_argument_parser()
+    options = parser.parse_args()
+
+    logger = Logger()
+    logger.star_line_flush()
+    logger.blank_line()
+
+    study = BlockSizeStudy(options.executable_paths, options.result_path, options.number_of_ranks, options.verbose)
+    for inputfile in options.inputfiles:
+        study.add_case(inputfile)
+
+    study.run(options.print_progress)
+    for name, block_size in study.best_block_sizes().items():
+        logger.write("Fastest block size for " + name + ": " + ("n.a." if block_size is None else str(block_size)))
+    logger.write("Results written to: " + study.write_json(options.json_file_path))
+
+    logger.blank_line()
+    logger.star_line_flush()
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+# Python modules
+from argparse import ArgumentParser
+# alpacapy modules
+from alpacapy.scaling.scaling_study import ScalingStudy
+from alpacapy.logger import Logger
+
+
+def parse_weak_scaling_inputfiles(specifications: list) -> dict:
+    """ Converts the weak scaling inputfile specifications of the form <ranks>:<inputfile> into a dictionary.
+
+    Parameters
+    ----------
+    specifications : list
+        The specifications given on the command line.
+    Returns
+    -------
+    dict
+        The inputfile path for each rank number.
+    """
+    inputfiles = {}
+    for specification in specifications:
+        ranks, _, inputfile = specification.partition(":")
+        inputfiles[int(ranks)] = inputfile
+    return inputfiles
+
+
+def setup_argument_parser():
+    """ Creates the argument parser to pass commandline arguments.
+
+    Returns
+    -------
+    ArgumentParser
+        The fully created argument parser.
+    """
+    parser = ArgumentParser(prog="Run scaling study",
+                            description="Runs inputfiles with an Alpaca executable on an increasing number of ranks and evaluates the strong and weak "
+                            "scaling efficiency from the profiler output and the wall clock time per cell")
+    parser.add_argument("executable_path", help="The path to the Alpaca executable used for all runs", type=str)
+    parser.add_argument("result_path", help="The path to the folder where the runs, the JSON file and the plots are written to", type=str)
+    parser.add_argument("--strong", nargs="+", dest="strong_inputfiles", metavar="INPUTFILE", default=[],
+                        help="Inputfiles (e.g., from testsuite/InputFiles) that are run on all rank numbers (strong scaling)")
+    parser.add_argument("--ranks", nargs="+", type=int, dest="ranks", default=[1, 2, 4, 8],
+                        help="The rank numbers used for the strong scaling cases")
+    parser.add_argument("--weak", nargs="+", dest="weak_inputfiles", metavar="RANKS:INPUTFILE", default=[],
+                        help="Inputfiles with the rank number they are run on (weak scaling), e.g., 1:small.xml 8:large.xml")
+    parser.add_argument("--weak-name", dest="weak_name", default="weak_scaling", help="The name of the weak scaling case")
+    parser.add_argument("--json-file", dest="json_file_path", default=None,
+                        help="The path to the JSON file holding the results, by default scaling.json in the result folder")
+    parser.add_argument("--plot-depth", type=int, dest="plot_depth", default=0,
+                        help="The maximum depth of the profiler regions shown in the efficiency plots")
+    parser.add_argument("--print-progress", action="store_true", dest="print_progress", default=False,
+                        help="If set, the progress of each simulation is printed to the terminal")
+    parser.add_argument("--quiet", action="store_false", dest="verbose", help="Disables verbosity logging", default=True)
+    return parser
+
+
+if __name__ == "__main__":
+    """ Main part to be called when using the module with direct call. """
+    parser = setup_argument_parser()
+    options = parser.parse_args()
+
+    logger = Logger()
+    logger.star_line_flush()
+    logger.blank_line()
+
+    study = ScalingStudy(options.executable_path, options.result_path, options.verbose)
+    for inputfile in options.strong_inputfiles:
+        study.add_strong_scaling_case(inputfile, options.ranks)
+    if options.weak_inputfiles:
+        study.add_weak_scaling_case(parse_weak_scaling_inputfiles(options.weak_inputfiles), options.weak_name)
+
+    study.run(options.print_progress)
+    logger.write("Results written to: " + study.write_json(options.json_file_path))
+    for plot_file in study.plot(options.plot_depth):
+        logger.write("Plot written to   : " + plot_file)
+
+    logger.blank_line()
+    logger.star_line_flush()
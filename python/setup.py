@@ -61,6 +61,8 @@ setup(
     python_requires=">=3.6",
     install_requires=install_requires,
     extras_require={
+        "scaling": ["matplotlib"],
+        "parallel": ["mpi4py"]
     },
     scripts=get_scripts()
 )
@@ -0,0 +1,223 @@
+//===------------------------ band_tiled_buffer.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef BAND_TILED_BUFFER_H
+#define BAND_TILED_BUFFER_H
+
+#include "user_specifications/compile_time_constants.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief The BandTiledBuffer class stores a block buffer in tiles. Tiles
+ * holding a single value, e.g. the cut-off level set or the volume fraction far
+ * away from the interface, are kept as this value only, all others are stored
+ * densely. Hence, only the tiles the interface band passes through occupy
+ * memory. The representation is lossless.
+ */
+class BandTiledBuffer {
+
+public:
+  // number of cells of a tile in each direction
+  static constexpr unsigned int TileX = 4;
+  static constexpr unsigned int TileY = CC::DIM() != Dimension::One ? 4 : 1;
+  static constexpr unsigned int TileZ = CC::DIM() == Dimension::Three ? 4 : 1;
+  // number of tiles in each direction, the last tile may be cut by the block
+  static constexpr unsigned int TilesX = (CC::TCX() + TileX - 1) / TileX;
+  static constexpr unsigned int TilesY = (CC::TCY() + TileY - 1) / TileY;
+  static constexpr unsigned int TilesZ = (CC::TCZ() + TileZ - 1) / TileZ;
+  static constexpr unsigned int NumberOfTiles = TilesX * TilesY * TilesZ;
+
+private:
+  struct Tile {
+    double values_[TileX][TileY][TileZ];
+  };
+  static constexpr unsigned int uniform_tile_ = NumberOfTiles;
+
+  // value of each uniform tile
+  std::array<double, NumberOfTiles> uniform_values_ = {};
+  // position of each tile in dense_tiles_, uniform_tile_ for uniform tiles
+  std::array<unsigned int, NumberOfTiles> dense_index_;
+  std::vector<Tile> dense_tiles_;
+
+  /**
+   * @brief Calls the given function for each tile with its index and cell
+   * ranges.
+   * @param function The function called as function( tile, start, end ).
+   */
+  template <typename Function> static void ForEachTile(Function &&function) {
+    unsigned int tile = 0;
+    for (unsigned int ti = 0; ti < TilesX; ++ti) {
+      for (unsigned int tj = 0; tj < TilesY; ++tj) {
+        for (unsigned int tk = 0; tk < TilesZ; ++tk) {
+          std::array<unsigned int, 3> const start = {ti * TileX, tj * TileY,
+                                                     tk * TileZ};
+          std::array<unsigned int, 3> const end = {
+              std::min(start[0] + TileX, CC::TCX()),
+              std::min(start[1] + TileY, CC::TCY()),
+              std::min(start[2] + TileZ, CC::TCZ())};
+          function(tile, start, end);
+          ++tile;
+        } // tk
+      }   // tj
+    }     // ti
+  }
+
+public:
+  /**
+   * @brief Creates a buffer that is zero everywhere without dense tiles.
+   */
+  BandTiledBuffer() { dense_index_.fill(uniform_tile_); }
+  ~BandTiledBuffer() = default;
+  BandTiledBuffer(BandTiledBuffer const &) = delete;
+  BandTiledBuffer &operator=(BandTiledBuffer const &) = delete;
+  BandTiledBuffer(BandTiledBuffer &&) = delete;
+  BandTiledBuffer &operator=(BandTiledBuffer &&) = delete;
+
+  /**
+   * @brief Stores the given block buffer. The dense tiles are packed into one
+   * allocation, whose capacity is kept for later calls.
+   * @param buffer The buffer to be stored.
+   */
+  void Store(double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()]) {
+    unsigned int number_of_dense_tiles = 0;
+    ForEachTile([&](unsigned int const tile,
+                    std::array<unsigned int, 3> const &start,
+                    std::array<unsigned int, 3> const &end) {
+      double const value = buffer[start[0]][start[1]][start[2]];
+      bool uniform = true;
+      for (unsigned int i = start[0]; i < end[0] && uniform; ++i) {
+        for (unsigned int j = start[1]; j < end[1] && uniform; ++j) {
+          for (unsigned int k = start[2]; k < end[2]; ++k) {
+            if (buffer[i][j][k] != value) {
+              uniform = false;
+              break;
+            }
+          } // k
+        }   // j
+      }     // i
+      uniform_values_[tile] = value;
+      dense_index_[tile] = uniform ? uniform_tile_ : number_of_dense_tiles++;
+    });
+
+    dense_tiles_.resize(number_of_dense_tiles);
+    ForEachTile([&](unsigned int const tile,
+                    std::array<unsigned int, 3> const &start,
+                    std::array<unsigned int, 3> const &end) {
+      if (dense_index_[tile] == uniform_tile_) {
+        return;
+      }
+      Tile &dense_tile = dense_tiles_[dense_index_[tile]];
+      for (unsigned int i = start[0]; i < end[0]; ++i) {
+        for (unsigned int j = start[1]; j < end[1]; ++j) {
+          for (unsigned int k = start[2]; k < end[2]; ++k) {
+            dense_tile.values_[i - start[0]][j - start[1]][k - start[2]] =
+                buffer[i][j][k];
+          } // k
+        }   // j
+      }     // i
+    });
+  }
+
+  /**
+   * @brief Sets the buffer to a uniform value, i.e. frees all dense tiles.
+   * @param value The value.
+   */
+  void Fill(double const value) {
+    uniform_values_.fill(value);
+    dense_index_.fill(uniform_tile_);
+    dense_tiles_.clear();
+    dense_tiles_.shrink_to_fit();
+  }
+
+  /**
+   * @brief Gives the stored value of a single cell.
+   * @param i, j, k The indices of the cell.
+   * @return The value.
+   */
+  double Value(unsigned int const i, unsigned int const j,
+               unsigned int const k) const {
+    unsigned int const tile =
+        ((i / TileX) * TilesY + j / TileY) * TilesZ + k / TileZ;
+    if (dense_index_[tile] == uniform_tile_) {
+      return uniform_values_[tile];
+    }
+    return dense_tiles_[dense_index_[tile]]
+        .values_[i % TileX][j % TileY][k % TileZ];
+  }
+
+  /**
+   * @brief Combines a block buffer with the stored buffer, i.e. computes
+   * buffer = buffer_multiplier * buffer + stored_multiplier * stored, tile by
+   * tile.
+   * @param buffer The buffer to be updated.
+   * @param buffer_multiplier The multiplier of the buffer.
+   * @param stored_multiplier The multiplier of the stored buffer.
+   */
+  void Combine(double (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+               double const buffer_multiplier,
+               double const stored_multiplier) const {
+    ForEachTile([&](unsigned int const tile,
+                    std::array<unsigned int, 3> const &start,
+                    std::array<unsigned int, 3> const &end) {
+      if (dense_index_[tile] == uniform_tile_) {
+        double const stored = stored_multiplier * uniform_values_[tile];
+        for (unsigned int i = start[0]; i < end[0]; ++i) {
+          for (unsigned int j = start[1]; j < end[1]; ++j) {
+            for (unsigned int k = start[2]; k < end[2]; ++k) {
+              buffer[i][j][k] = buffer_multiplier * buffer[i][j][k] + stored;
+            } // k
+          }   // j
+        }     // i
+      } else {
+        auto const &values = dense_tiles_[dense_index_[tile]].values_;
+        for (unsigned int i = start[0]; i < end[0]; ++i) {
+          for (unsigned int j = start[1]; j < end[1]; ++j) {
+            for (unsigned int k = start[2]; k < end[2]; ++k) {
+              buffer[i][j][k] =
+                  buffer_multiplier * buffer[i][j][k] +
+                  stored_multiplier *
+                      values[i - start[0]][j - start[1]][k - start[2]];
+            } // k
+          }   // j
+        }     // i
+      }
+    });
+  }
+
+  /**
+   * @brief Gives the number of tiles stored densely.
+   * @return Number of dense tiles.
+   */
+  std::size_t DenseTiles() const { return dense_tiles_.size(); }
+
+  /**
+   * @brief Gives the memory held by the dense tiles.
+   * @return The memory in bytes.
+   */
+  std::size_t DenseBytes() const {
+    return dense_tiles_.capacity() * sizeof(Tile);
+  }
+};
+
+#endif // BAND_TILED_BUFFER_H
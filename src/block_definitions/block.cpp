@@ -21,7 +21,48 @@
 //===----------------------------------------------------------------------===//
 #include "block_definitions/block.h"
 #include "utilities/buffer_operations.h"
+#include "utilities/numa_placement.h"
+#include "utilities/storage_pool.h"
+#include <algorithm>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace {
+/**
+ * @brief Gives a field of a buffer as double array, which is not possible for
+ * buffers stored in another precision.
+ * @param buffer The field buffer.
+ * @param field_index The index of the field asked for.
+ * @return Reference to the requested field.
+ */
+template <typename BufferType>
+auto DoublePrecisionBuffer(BufferType &buffer, unsigned int const field_index)
+    -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  if constexpr (std::is_same_v<typename BufferType::value_type, double>) {
+    return buffer[field_index];
+  } else {
+    throw std::logic_error("Single-precision fields are only accessible "
+                           "through Block::VisitFieldBuffer");
+  }
+}
+
+/**
+ * @brief Const overload.
+ */
+template <typename BufferType>
+auto DoublePrecisionBuffer(BufferType const &buffer,
+                           unsigned int const field_index)
+    -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  if constexpr (std::is_same_v<typename BufferType::value_type, double>) {
+    return buffer[field_index];
+  } else {
+    throw std::logic_error("Single-precision fields are only accessible "
+                           "through Block::VisitFieldBuffer");
+  }
+}
+} // namespace
 
 /**
  * @brief Standard constructor, creates a Block of the provided material.
@@ -33,20 +74,18 @@ Block::Block() {
   // We initialize a Block with zero in all its buffers
   BO::SetFieldBuffer(GetAverageBuffer(), 0.0);
   BO::SetFieldBuffer(GetRightHandSideBuffer(), 0.0);
-  BO::SetFieldBuffer(GetInitialBuffer(), 0.0);
   BO::SetFieldBuffer(GetPrimeStateBuffer(), 0.0);
 
   // Only reset buffer of parameter if they are present
   if constexpr (CC::ParameterModelActive()) {
-    BO::SetFieldBuffer(GetParameterBuffer(), 0.0);
+    BO::SetFieldBuffer(GetParameterBuffer(), ParameterValue(0.0));
   }
 
-  for (BoundaryLocation const location : CC::NBS()) {
-    ResetJumpFluxes(location);
+  if constexpr (!CC::LazyJumpBuffers()) {
+    AllocateJumpBuffers();
   }
-
-  for (BoundaryLocation const location : CC::NBS()) {
-    ResetJumpConservatives(location);
+  if constexpr (!CC::LazyIntegrationBuffers()) {
+    AllocateIntegrationBuffers();
   }
 }
 
@@ -57,6 +96,8 @@ Block::Block() {
  * @param conservative_type If a conservative field is wanted, the conservative
  * buffer type. Defaults to ConservativeBufferType::RightHandSide.
  * @return Reference to Array that is the requested buffer.
+ * @note Single-precision parameters cannot be given as double array, see
+ * VisitFieldBuffer().
  */
 auto Block::GetFieldBuffer(MaterialFieldType const field_type,
                            unsigned int const field_index,
@@ -64,13 +105,14 @@ auto Block::GetFieldBuffer(MaterialFieldType const field_type,
     -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
   switch (field_type) {
   case MaterialFieldType::Conservatives: {
-    return GetConservativeBuffer(conservative_type)[field_index];
+    return DoublePrecisionBuffer(GetConservativeBuffer(conservative_type),
+                                 field_index);
   }
   case MaterialFieldType::Parameters: {
-    return parameters_[field_index];
+    return DoublePrecisionBuffer(parameters_, field_index);
   }
   default: { // MaterialFieldType::PrimeStates:
-    return prime_states_[field_index];
+    return DoublePrecisionBuffer(prime_states_, field_index);
   }
   }
 }
@@ -84,13 +126,14 @@ auto Block::GetFieldBuffer(MaterialFieldType const field_type,
     -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
   switch (field_type) {
   case MaterialFieldType::Conservatives: {
-    return GetConservativeBuffer(conservative_type)[field_index];
+    return DoublePrecisionBuffer(GetConservativeBuffer(conservative_type),
+                                 field_index);
   }
   case MaterialFieldType::Parameters: {
-    return parameters_[field_index];
+    return DoublePrecisionBuffer(parameters_, field_index);
   }
   default: { // MaterialFieldType::PrimeStates:
-    return prime_states_[field_index];
+    return DoublePrecisionBuffer(prime_states_, field_index);
   }
   }
 }
@@ -101,16 +144,16 @@ auto Block::GetFieldBuffer(MaterialFieldType const field_type,
  * @return Reference to the array, that is the requested buffer.
  */
 auto Block::GetAverageBuffer(Equation const equation)
-    -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return averages_[equation];
+    -> FieldValue (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  return GetAverageBuffer()[equation];
 }
 
 /**
  * @brief Const overload.
  */
-auto Block::GetAverageBuffer(Equation const equation) const
-    -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return averages_[equation];
+auto Block::GetAverageBuffer(Equation const equation) const -> FieldValue
+    const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  return GetAverageBuffer()[equation];
 }
 
 /**
@@ -119,16 +162,16 @@ auto Block::GetAverageBuffer(Equation const equation) const
  * @return Reference to Array that is the requested buffer.
  */
 auto Block::GetRightHandSideBuffer(Equation const equation)
-    -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return right_hand_sides_[equation];
+    -> FieldValue (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  return GetRightHandSideBuffer()[equation];
 }
 
 /**
  * @brief Const overload.
  */
-auto Block::GetRightHandSideBuffer(Equation const equation) const
-    -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return right_hand_sides_[equation];
+auto Block::GetRightHandSideBuffer(Equation const equation) const -> FieldValue
+    const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  return GetRightHandSideBuffer()[equation];
 }
 
 /**
@@ -137,16 +180,16 @@ auto Block::GetRightHandSideBuffer(Equation const equation) const
  * @return Reference to Array that is the requested buffer.
  */
 auto Block::GetInitialBuffer(Equation const equation)
-    -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return initials_[equation];
+    -> FieldValue (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  return GetInitialBuffer()[equation];
 }
 
 /**
  * @brief Const overload.
  */
-auto Block::GetInitialBuffer(Equation const equation) const
-    -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return initials_[equation];
+auto Block::GetInitialBuffer(Equation const equation) const -> FieldValue
+    const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  return GetInitialBuffer()[equation];
 }
 
 /**
@@ -214,36 +257,59 @@ Block::GetConservativeBuffer<ConservativeBufferType::Initial>() const {
  * @brief Gives access to the average buffer.
  * @return Average buffer struct.
  */
-Conservatives &Block::GetAverageBuffer() { return averages_; }
+Conservatives &Block::GetAverageBuffer() {
+  return GetConservativeBuffer(ConservativeBufferType::Average);
+}
 
 /**
  * @brief Const overload.
  */
-Conservatives const &Block::GetAverageBuffer() const { return averages_; }
+Conservatives const &Block::GetAverageBuffer() const {
+  return GetConservativeBuffer(ConservativeBufferType::Average);
+}
 
 /**
  * @brief Gives access to the right-hand side buffer.
  * @return Right-hand side buffer struct.
  */
-Conservatives &Block::GetRightHandSideBuffer() { return right_hand_sides_; }
+Conservatives &Block::GetRightHandSideBuffer() {
+  return GetConservativeBuffer(ConservativeBufferType::RightHandSide);
+}
 
 /**
  * @brief Const overload.
  */
 Conservatives const &Block::GetRightHandSideBuffer() const {
-  return right_hand_sides_;
+  return GetConservativeBuffer(ConservativeBufferType::RightHandSide);
 }
 
 /**
  * @brief Gives access to the initial buffer.
  * @return initial buffer struct.
+ * @note Only available while the integration buffers are allocated.
  */
-Conservatives &Block::GetInitialBuffer() { return initials_; }
+Conservatives &Block::GetInitialBuffer() {
+#ifndef PERFORMANCE
+  if (integration_buffers_ == nullptr) {
+    throw std::logic_error(
+        "Integration buffers are not allocated for this block");
+  }
+#endif
+  return integration_buffers_->initial_;
+}
 
 /**
  * @brief Const overload.
  */
-Conservatives const &Block::GetInitialBuffer() const { return initials_; }
+Conservatives const &Block::GetInitialBuffer() const {
+#ifndef PERFORMANCE
+  if (integration_buffers_ == nullptr) {
+    throw std::logic_error(
+        "Integration buffers are not allocated for this block");
+  }
+#endif
+  return integration_buffers_->initial_;
+}
 
 /**
  * @brief Gives access to the conservative buffer of given type.
@@ -252,17 +318,11 @@ Conservatives const &Block::GetInitialBuffer() const { return initials_; }
  */
 Conservatives &
 Block::GetConservativeBuffer(ConservativeBufferType const conservative_type) {
-  switch (conservative_type) {
-  case ConservativeBufferType::RightHandSide: {
-    return right_hand_sides_;
-  }
-  case ConservativeBufferType::Average: {
-    return averages_;
-  }
-  default: { // case ConservativeBufferType::Initial:
-    return initials_;
-  }
+  if (conservative_type == ConservativeBufferType::Initial) {
+    return GetInitialBuffer();
   }
+  return conservatives_[conservative_slots_[static_cast<unsigned int>(
+      conservative_type)]];
 }
 
 /**
@@ -270,17 +330,32 @@ Block::GetConservativeBuffer(ConservativeBufferType const conservative_type) {
  */
 Conservatives const &Block::GetConservativeBuffer(
     ConservativeBufferType const conservative_type) const {
-  switch (conservative_type) {
-  case ConservativeBufferType::RightHandSide: {
-    return right_hand_sides_;
-  }
-  case ConservativeBufferType::Average: {
-    return averages_;
-  }
-  default: { // case ConservativeBufferType::Initial:
-    return initials_;
+  if (conservative_type == ConservativeBufferType::Initial) {
+    return GetInitialBuffer();
   }
+  return conservatives_[conservative_slots_[static_cast<unsigned int>(
+      conservative_type)]];
+}
+
+/**
+ * @brief Swaps the contents of two conservative buffers. Only the assignment of
+ * the buffer types to the storage is exchanged, no values are moved.
+ * @param first_type, second_type The conservative types of the buffers to be
+ * swapped.
+ * @note References and pointers to the buffers obtained before refer to the
+ * other buffer type afterwards. Only the average and right-hand side buffers
+ * can be swapped, the initial buffer is held separately.
+ */
+void Block::SwapConservativeBuffers(ConservativeBufferType const first_type,
+                                    ConservativeBufferType const second_type) {
+#ifndef PERFORMANCE
+  if (first_type == ConservativeBufferType::Initial ||
+      second_type == ConservativeBufferType::Initial) {
+    throw std::logic_error("The initial buffer cannot be swapped");
   }
+#endif
+  std::swap(conservative_slots_[static_cast<unsigned int>(first_type)],
+            conservative_slots_[static_cast<unsigned int>(second_type)]);
 }
 
 /**
@@ -289,7 +364,7 @@ Conservatives const &Block::GetConservativeBuffer(
  * @return Reference to Array that is the requested buffer.
  */
 auto Block::GetPrimeStateBuffer(PrimeState const prime_state_type)
-    -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+    -> FieldValue (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
   return prime_states_[prime_state_type];
 }
 
@@ -297,7 +372,7 @@ auto Block::GetPrimeStateBuffer(PrimeState const prime_state_type)
  * @brief Const overload.
  */
 auto Block::GetPrimeStateBuffer(PrimeState const prime_state_type) const
-    -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+    -> FieldValue const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
   return prime_states_[prime_state_type];
 }
 
@@ -318,7 +393,7 @@ PrimeStates const &Block::GetPrimeStateBuffer() const { return prime_states_; }
  * @return Reference to Array that is the requested buffer.
  */
 auto Block::GetParameterBuffer(Parameter const parameter_type)
-    -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+    -> ParameterValue (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
   return parameters_[parameter_type];
 }
 
@@ -326,7 +401,7 @@ auto Block::GetParameterBuffer(Parameter const parameter_type)
  * @brief Const overload.
  */
 auto Block::GetParameterBuffer(Parameter const parameter_type) const
-    -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+    -> ParameterValue const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
   return parameters_[parameter_type];
 }
 
@@ -348,7 +423,7 @@ Parameters const &Block::GetParameterBuffer() const { return parameters_; }
  */
 auto Block::GetBoundaryJumpFluxes(BoundaryLocation const location)
     -> double (&)[MF::ANOE()][CC::ICY()][CC::ICZ()] {
-  return GetBoundaryJump(jump_fluxes_, location);
+  return GetBoundaryJump(GetBoundaryJumpFluxes(), location);
 }
 
 /**
@@ -356,7 +431,7 @@ auto Block::GetBoundaryJumpFluxes(BoundaryLocation const location)
  */
 auto Block::GetBoundaryJumpFluxes(BoundaryLocation const location) const
     -> double const (&)[MF::ANOE()][CC::ICY()][CC::ICZ()] {
-  return GetBoundaryJump(jump_fluxes_, location);
+  return GetBoundaryJump(GetBoundaryJumpFluxes(), location);
 }
 
 /**
@@ -366,7 +441,7 @@ auto Block::GetBoundaryJumpFluxes(BoundaryLocation const location) const
  */
 auto Block::GetBoundaryJumpConservatives(BoundaryLocation const location)
     -> double (&)[MF::ANOE()][CC::ICY()][CC::ICZ()] {
-  return GetBoundaryJump(jump_conservatives_, location);
+  return GetBoundaryJump(GetBoundaryJumpConservatives(), location);
 }
 
 /**
@@ -374,20 +449,32 @@ auto Block::GetBoundaryJumpConservatives(BoundaryLocation const location)
  */
 auto Block::GetBoundaryJumpConservatives(BoundaryLocation const location) const
     -> double const (&)[MF::ANOE()][CC::ICY()][CC::ICZ()] {
-  return GetBoundaryJump(jump_conservatives_, location);
+  return GetBoundaryJump(GetBoundaryJumpConservatives(), location);
 }
 
 /**
  * @brief Gives access to the jump flux buffer.
  * @return The jump flux buffer struct.
  */
-SurfaceBuffer &Block::GetBoundaryJumpFluxes() { return jump_fluxes_; }
+SurfaceBuffer &Block::GetBoundaryJumpFluxes() {
+#ifndef PERFORMANCE
+  if (jump_buffers_ == nullptr) {
+    throw std::logic_error("Jump buffers are not allocated for this block");
+  }
+#endif
+  return jump_buffers_->fluxes_;
+}
 
 /**
  * @brief const overload.
  */
 SurfaceBuffer const &Block::GetBoundaryJumpFluxes() const {
-  return jump_fluxes_;
+#ifndef PERFORMANCE
+  if (jump_buffers_ == nullptr) {
+    throw std::logic_error("Jump buffers are not allocated for this block");
+  }
+#endif
+  return jump_buffers_->fluxes_;
 }
 
 /**
@@ -395,14 +482,24 @@ SurfaceBuffer const &Block::GetBoundaryJumpFluxes() const {
  * @return The jump conservative buffer struct.
  */
 SurfaceBuffer &Block::GetBoundaryJumpConservatives() {
-  return jump_conservatives_;
+#ifndef PERFORMANCE
+  if (jump_buffers_ == nullptr) {
+    throw std::logic_error("Jump buffers are not allocated for this block");
+  }
+#endif
+  return jump_buffers_->conservatives_;
 }
 
 /**
  * @brief const overload.
  */
 SurfaceBuffer const &Block::GetBoundaryJumpConservatives() const {
-  return jump_conservatives_;
+#ifndef PERFORMANCE
+  if (jump_buffers_ == nullptr) {
+    throw std::logic_error("Jump buffers are not allocated for this block");
+  }
+#endif
+  return jump_buffers_->conservatives_;
 }
 
 /**
@@ -412,6 +509,10 @@ SurfaceBuffer const &Block::GetBoundaryJumpConservatives() const {
  */
 void Block::ResetJumpFluxes(BoundaryLocation const location) {
 
+  if (jump_buffers_ == nullptr) {
+    return;
+  }
+
   double(&jump)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
       GetBoundaryJumpFluxes(location);
 
@@ -431,6 +532,10 @@ void Block::ResetJumpFluxes(BoundaryLocation const location) {
  */
 void Block::ResetJumpConservatives(BoundaryLocation const location) {
 
+  if (jump_buffers_ == nullptr) {
+    return;
+  }
+
   double(&jump)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
       GetBoundaryJumpConservatives(location);
 
@@ -443,6 +548,302 @@ void Block::ResetJumpConservatives(BoundaryLocation const location) {
   }
 }
 
+/**
+ * @brief Indicates whether the jump buffers of this block are allocated.
+ * @return True if the jump buffers exist, false otherwise.
+ */
+bool Block::HasJumpBuffers() const { return jump_buffers_ != nullptr; }
+
+/**
+ * @brief Allocates the jump buffers of this block and sets them to zero. Does
+ * nothing if they already exist.
+ */
+void Block::AllocateJumpBuffers() {
+  if (jump_buffers_ != nullptr) {
+    return;
+  }
+  jump_buffers_ = std::make_unique<JumpBuffers>();
+  for (BoundaryLocation const location : CC::NBS()) {
+    ResetJumpFluxes(location);
+    ResetJumpConservatives(location);
+  }
+}
+
+/**
+ * @brief Frees the jump buffers of this block. Does nothing if jump buffers are
+ * allocated permanently.
+ */
+void Block::ReleaseJumpBuffers() {
+  if constexpr (CC::LazyJumpBuffers()) {
+    jump_buffers_.reset();
+  }
+}
+
+/**
+ * @brief Indicates whether the integration buffers of this block are allocated.
+ * @return True if the integration buffers exist, false otherwise.
+ */
+bool Block::HasIntegrationBuffers() const {
+  return integration_buffers_ != nullptr;
+}
+
+/**
+ * @brief Allocates the integration buffers of this block and sets them to zero.
+ * Does nothing if they already exist.
+ */
+void Block::AllocateIntegrationBuffers() {
+  if (integration_buffers_ != nullptr) {
+    return;
+  }
+  integration_buffers_ = std::make_unique<IntegrationBuffers>();
+  BO::SetFieldBuffer(integration_buffers_->initial_, 0.0);
+}
+
+/**
+ * @brief Frees the integration buffers of this block. Does nothing if
+ * integration buffers are allocated permanently.
+ */
+void Block::ReleaseIntegrationBuffers() {
+  if constexpr (CC::LazyIntegrationBuffers()) {
+    integration_buffers_.reset();
+  }
+}
+
+/**
+ * @brief Gives access to the running statistics of this block.
+ * @return The statistics buffers.
+ * @note Only available while the statistics buffers are allocated.
+ */
+StatisticsBuffers &Block::GetStatisticsBuffers() {
+#ifndef PERFORMANCE
+  if (statistics_buffers_ == nullptr) {
+    throw std::logic_error(
+        "Statistics buffers are not allocated for this block");
+  }
+#endif
+  return *statistics_buffers_;
+}
+
+/**
+ * @brief Const overload.
+ */
+StatisticsBuffers const &Block::GetStatisticsBuffers() const {
+#ifndef PERFORMANCE
+  if (statistics_buffers_ == nullptr) {
+    throw std::logic_error(
+        "Statistics buffers are not allocated for this block");
+  }
+#endif
+  return *statistics_buffers_;
+}
+
+/**
+ * @brief Indicates whether the statistics buffers of this block are allocated.
+ * @return True if the statistics buffers exist, false otherwise.
+ */
+bool Block::HasStatisticsBuffers() const {
+  return statistics_buffers_ != nullptr;
+}
+
+/**
+ * @brief Allocates the statistics buffers of this block and sets them to zero,
+ * i.e. no samples are taken yet. Does nothing if they already exist.
+ */
+void Block::AllocateStatisticsBuffers() {
+  if (statistics_buffers_ != nullptr) {
+    return;
+  }
+  statistics_buffers_ = std::make_unique<StatisticsBuffers>();
+  std::fill_n(&statistics_buffers_->moments_[0][0][0][0],
+              sizeof(statistics_buffers_->moments_) / sizeof(double), 0.0);
+}
+
+/**
+ * @brief Frees the statistics buffers of this block together with all samples
+ * taken.
+ */
+void Block::ReleaseStatisticsBuffers() { statistics_buffers_.reset(); }
+
+/**
+ * @brief Moves the memory of the block including its separately allocated
+ * buffers to the given NUMA domain.
+ * @param domain The target domain ( see NumaPlacement::MoveToDomain ).
+ */
+void Block::MoveToNumaDomain(int const domain) const {
+  NumaPlacement::MoveToDomain(this, sizeof(Block), domain);
+  if (jump_buffers_) {
+    NumaPlacement::MoveToDomain(jump_buffers_.get(), sizeof(JumpBuffers),
+                                domain);
+  }
+  if (integration_buffers_) {
+    NumaPlacement::MoveToDomain(integration_buffers_.get(),
+                                sizeof(IntegrationBuffers), domain);
+  }
+  if (velocity_gradient_) {
+    NumaPlacement::MoveToDomain(velocity_gradient_.get(),
+                                sizeof(VelocityGradient), domain);
+  }
+  if (statistics_buffers_) {
+    NumaPlacement::MoveToDomain(statistics_buffers_.get(),
+                                sizeof(StatisticsBuffers), domain);
+  }
+}
+
+/**
+ * @brief Gives the buffer of the cached velocity gradient to be filled and
+ * marks it as up to date. The buffer is allocated on first use and set to zero.
+ * @return The velocity gradient buffer.
+ */
+auto Block::PrepareVelocityGradient() -> double (
+        &)[CC::TCX()][CC::TCY()][CC::TCZ()][DTI(CC::DIM())][DTI(CC::DIM())] {
+  if (velocity_gradient_ == nullptr) {
+    velocity_gradient_ = std::make_unique<VelocityGradient>();
+    std::fill_n(&velocity_gradient_->values_[0][0][0][0][0],
+                sizeof(velocity_gradient_->values_) / sizeof(double), 0.0);
+  }
+  velocity_gradient_->valid_ = true;
+  return velocity_gradient_->values_;
+}
+
+/**
+ * @brief Gives access to the cached velocity gradient.
+ * @return The velocity gradient buffer.
+ * @note Only meaningful if HasVelocityGradient() is true.
+ */
+auto Block::GetVelocityGradient() const -> double const (
+        &)[CC::TCX()][CC::TCY()][CC::TCZ()][DTI(CC::DIM())][DTI(CC::DIM())] {
+#ifndef PERFORMANCE
+  if (!HasVelocityGradient()) {
+    throw std::logic_error(
+        "No valid velocity gradient is cached on this block");
+  }
+#endif
+  return velocity_gradient_->values_;
+}
+
+/**
+ * @brief Indicates whether a velocity gradient of the current velocity field is
+ * cached on this block.
+ * @return True if a valid velocity gradient exists, false otherwise.
+ */
+bool Block::HasVelocityGradient() const {
+  return velocity_gradient_ != nullptr && velocity_gradient_->valid_;
+}
+
+/**
+ * @brief Indicates whether storage for the velocity gradient is allocated on
+ * this block (regardless of its validity).
+ * @return True if the storage exists, false otherwise.
+ */
+bool Block::HasVelocityGradientStorage() const {
+  return velocity_gradient_ != nullptr;
+}
+
+/**
+ * @brief Marks the cached velocity gradient as outdated. The storage is kept
+ * for the next stage.
+ */
+void Block::InvalidateVelocityGradient() {
+  if (velocity_gradient_ != nullptr) {
+    velocity_gradient_->valid_ = false;
+  }
+}
+
+/**
+ * @brief Allocates the storage of jump buffers, recycled from the block storage
+ * pool if pooling is active.
+ * @param size Size of the requested storage in bytes.
+ * @return Pointer to the uninitialized storage.
+ */
+void *JumpBuffers::operator new(std::size_t const size) {
+  if constexpr (CC::PoolBlockStorage()) {
+    if (size == sizeof(JumpBuffers)) {
+      return StoragePool<sizeof(JumpBuffers)>::Instance().Acquire();
+    }
+  }
+  return ::operator new(size);
+}
+
+/**
+ * @brief Frees the storage of jump buffers, i.e. returns it to the block
+ * storage pool if pooling is active.
+ * @param pointer Pointer to the storage.
+ * @param size Size of the storage in bytes.
+ */
+void JumpBuffers::operator delete(void *const pointer, std::size_t const size) {
+  if constexpr (CC::PoolBlockStorage()) {
+    if (size == sizeof(JumpBuffers)) {
+      StoragePool<sizeof(JumpBuffers)>::Instance().Release(pointer);
+      return;
+    }
+  }
+  ::operator delete(pointer);
+}
+
+/**
+ * @brief Allocates the storage of integration buffers, recycled from the block
+ * storage pool if pooling is active.
+ * @param size Size of the requested storage in bytes.
+ * @return Pointer to the uninitialized storage.
+ */
+void *IntegrationBuffers::operator new(std::size_t const size) {
+  if constexpr (CC::PoolBlockStorage()) {
+    if (size == sizeof(IntegrationBuffers)) {
+      return StoragePool<sizeof(IntegrationBuffers)>::Instance().Acquire();
+    }
+  }
+  return ::operator new(size);
+}
+
+/**
+ * @brief Frees the storage of integration buffers, i.e. returns it to the block
+ * storage pool if pooling is active.
+ * @param pointer Pointer to the storage.
+ * @param size Size of the storage in bytes.
+ */
+void IntegrationBuffers::operator delete(void *const pointer,
+                                         std::size_t const size) {
+  if constexpr (CC::PoolBlockStorage()) {
+    if (size == sizeof(IntegrationBuffers)) {
+      StoragePool<sizeof(IntegrationBuffers)>::Instance().Release(pointer);
+      return;
+    }
+  }
+  ::operator delete(pointer);
+}
+
+/**
+ * @brief Allocates the storage of statistics buffers, recycled from the block
+ * storage pool if pooling is active.
+ * @param size Size of the requested storage in bytes.
+ * @return Pointer to the uninitialized storage.
+ */
+void *StatisticsBuffers::operator new(std::size_t const size) {
+  if constexpr (CC::PoolBlockStorage()) {
+    if (size == sizeof(StatisticsBuffers)) {
+      return StoragePool<sizeof(StatisticsBuffers)>::Instance().Acquire();
+    }
+  }
+  return ::operator new(size);
+}
+
+/**
+ * @brief Frees the storage of statistics buffers, i.e. returns it to the block
+ * storage pool if pooling is active.
+ * @param pointer Pointer to the storage.
+ * @param size Size of the storage in bytes.
+ */
+void StatisticsBuffers::operator delete(void *const pointer,
+                                        std::size_t const size) {
+  if constexpr (CC::PoolBlockStorage()) {
+    if (size == sizeof(StatisticsBuffers)) {
+      StoragePool<sizeof(StatisticsBuffers)>::Instance().Release(pointer);
+      return;
+    }
+  }
+  ::operator delete(pointer);
+}
+
 /**
  * @brief Gives access to a single conservative array in a SurfaceBuffer struct.
  * @param jump The struct holding the desired array.
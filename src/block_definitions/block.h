@@ -22,10 +22,14 @@
 #ifndef BLOCK_H
 #define BLOCK_H
 
+#include <array>
+#include <memory>
+
 #include "block_definitions/field_buffer.h"
 #include "block_definitions/field_material_definitions.h"
 #include "boundary_condition/boundary_specifications.h"
 #include "user_specifications/compile_time_constants.h"
+#include "user_specifications/output_constants.h"
 
 /**
  * @brief Gives a buffer for the values on the six (in 3D) surfaces of the
@@ -45,6 +49,106 @@ static_assert(sizeof(SurfaceBuffer) ==
                   6 * MF::ANOE() * CC::ICY() * CC::ICZ() * sizeof(double),
               "Surface Struct is not contiguous in Memory");
 
+/**
+ * @brief Gives the buffers needed for the flux correction at resolution jumps.
+ * Heap instances are drawn from the block storage pool.
+ */
+struct JumpBuffers {
+  // buffer to save fluxes at internal jump boundaries
+  SurfaceBuffer fluxes_;
+  // buffer to store conservative fluxes at internal jump boundaries
+  SurfaceBuffer conservatives_;
+
+  static void *operator new(std::size_t const size);
+  static void operator delete(void *const pointer, std::size_t const size);
+};
+
+/**
+ * @brief Gives the buffers only needed to integrate a leaf in time. Heap
+ * instances are drawn from the block storage pool.
+ */
+struct IntegrationBuffers {
+  // conservatives at the begin of the time step
+  Conservatives initial_;
+
+  static void *operator new(std::size_t const size);
+  static void operator delete(void *const pointer, std::size_t const size);
+};
+
+/**
+ * @brief Gives the velocity gradient at the cell centers of a block. It is
+ * computed by the parameter update of a stage and consumed by the shear-rate
+ * parameter models and the viscous fluxes of the following right-hand side
+ * ( see CC::CacheVelocityGradient() ).
+ */
+struct VelocityGradient {
+  /**
+   * Description for the positions of the Array:
+   * [CC::TCX()]    [CC::TCY()]    [CC::TCZ()] [DTI(CC::DIM())][DTI(CC::DIM())]
+   * Field index x  Field index y  Field index z  Velocity gradient: du_i / dx_j
+   */
+  double values_[CC::TCX()][CC::TCY()][CC::TCZ()][DTI(CC::DIM())]
+                [DTI(CC::DIM())];
+  // flag whether the values belong to the current velocity field
+  bool valid_ = false;
+};
+
+/**
+ * @brief Gives the running statistics of the prime states sampled on a leaf
+ * ( see StatisticsOutputSettings ). The moments are, in this order, the number
+ * of samples, the means of the sampled prime states and the covariances of all
+ * pairs of them ( upper triangle row by row ). All moments are cell fields,
+ * such that they are predicted and averaged like the conservatives. Heap
+ * instances are drawn from the block storage pool.
+ */
+struct StatisticsBuffers {
+  static constexpr unsigned int number_of_states_ =
+      StatisticsOutputSettings::SampledPrimeStates.size();
+  static constexpr unsigned int number_of_moments_ =
+      1 + number_of_states_ + number_of_states_ * (number_of_states_ + 1) / 2;
+
+  double moments_[number_of_moments_][CC::TCX()][CC::TCY()][CC::TCZ()];
+
+  /**
+   * @brief Gives the index of the number of samples in the moments.
+   */
+  static constexpr unsigned int SamplesIndex() { return 0; }
+
+  /**
+   * @brief Gives the index of the mean of a sampled prime state.
+   * @param state Position of the prime state in the sampled prime states.
+   */
+  static constexpr unsigned int MeanIndex(unsigned int const state) {
+    return 1 + state;
+  }
+
+  /**
+   * @brief Gives the index of the covariance of two sampled prime states.
+   * @param first, second Positions of the prime states in the sampled prime
+   * states, the first must not be larger than the second.
+   */
+  static constexpr unsigned int CovarianceIndex(unsigned int const first,
+                                                unsigned int const second) {
+    return 1 + number_of_states_ + first * number_of_states_ -
+           first * (first - 1) / 2 + second - first;
+  }
+
+  auto operator[](unsigned int const index)
+      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+    return moments_[index];
+  }
+  auto operator[](unsigned int const index) const
+      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+    return moments_[index];
+  }
+  static constexpr std::size_t GetNumberOfFields() {
+    return number_of_moments_;
+  }
+
+  static void *operator new(std::size_t const size);
+  static void operator delete(void *const pointer, std::size_t const size);
+};
+
 /**
  * @brief The Block class holds the data on which the simulation is running.
  * They do NOT manipulate the data themselves, but provide data access to the
@@ -52,11 +156,11 @@ static_assert(sizeof(SurfaceBuffer) ==
  * material. >>A block is always single-phase<<.
  */
 class Block {
-  // buffers for the conservatives (different buffer types required for the
-  // integration)
-  Conservatives averages_;
-  Conservatives right_hand_sides_;
-  Conservatives initials_;
+  // storage of the average and right-hand side conservatives. The buffer types
+  // are assigned to the storage slots through conservative_slots_, such that
+  // buffers are swapped by exchanging the slots
+  std::array<Conservatives, 2> conservatives_;
+  std::array<unsigned char, 2> conservative_slots_ = {0, 1};
 
   // buffers for the primestates (e.g. temperature, pressure, velocity)
   PrimeStates prime_states_;
@@ -65,11 +169,21 @@ class Block {
   // conductivity)
   Parameters parameters_;
 
-  // buffer to save fluxes at internal jump boundaries
-  SurfaceBuffer jump_fluxes_;
+  // buffers for the jump flux correction, only allocated while the node takes
+  // part in a resolution jump ( see CC::LazyJumpBuffers() )
+  std::unique_ptr<JumpBuffers> jump_buffers_;
 
-  // buffer to store conservative fluxes at internal jump boundaries
-  SurfaceBuffer jump_conservatives_;
+  // buffers for the time integration, only allocated while the node is a leaf
+  // ( see CC::LazyIntegrationBuffers() )
+  std::unique_ptr<IntegrationBuffers> integration_buffers_;
+
+  // cached velocity gradient, only allocated once it is first computed ( see
+  // CC::CacheVelocityGradient() )
+  std::unique_ptr<VelocityGradient> velocity_gradient_;
+
+  // running statistics, only allocated while the node is a leaf and the
+  // statistics are sampled ( see StatisticsOutputSettings::SamplingInterval )
+  std::unique_ptr<StatisticsBuffers> statistics_buffers_;
 
 public:
   explicit Block();
@@ -90,22 +204,32 @@ public:
                       ConservativeBufferType const conservative_type =
                           ConservativeBufferType::RightHandSide) const
       -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+  template <typename Function>
+  void VisitFieldBuffer(MaterialFieldType const field_type,
+                        unsigned int const field_index, Function &&function,
+                        ConservativeBufferType const conservative_type =
+                            ConservativeBufferType::RightHandSide);
+  template <typename Function>
+  void VisitFieldBuffer(MaterialFieldType const field_type,
+                        unsigned int const field_index, Function &&function,
+                        ConservativeBufferType const conservative_type =
+                            ConservativeBufferType::RightHandSide) const;
 
   // Returning conservative buffers
   auto GetAverageBuffer(Equation const equation)
-      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
-  auto GetAverageBuffer(Equation const equation) const
-      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+      -> FieldValue (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+  auto GetAverageBuffer(Equation const equation) const -> FieldValue
+      const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
 
   auto GetRightHandSideBuffer(Equation const equation)
-      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
-  auto GetRightHandSideBuffer(Equation const equation) const
-      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+      -> FieldValue (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+  auto GetRightHandSideBuffer(Equation const equation) const -> FieldValue
+      const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
 
   auto GetInitialBuffer(Equation const equation)
-      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
-  auto GetInitialBuffer(Equation const equation) const
-      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+      -> FieldValue (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+  auto GetInitialBuffer(Equation const equation) const -> FieldValue
+      const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
 
   template <ConservativeBufferType C> Conservatives &GetConservativeBuffer();
 
@@ -122,21 +246,23 @@ public:
   GetConservativeBuffer(ConservativeBufferType const conservative_type);
   Conservatives const &
   GetConservativeBuffer(ConservativeBufferType const conservative_type) const;
+  void SwapConservativeBuffers(ConservativeBufferType const first_type,
+                               ConservativeBufferType const second_type);
 
   // Returning primestate buffers
   auto GetPrimeStateBuffer(PrimeState const prime_state_type)
-      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+      -> FieldValue (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
   auto GetPrimeStateBuffer(PrimeState const prime_state_type) const
-      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+      -> FieldValue const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
 
   PrimeStates &GetPrimeStateBuffer();
   PrimeStates const &GetPrimeStateBuffer() const;
 
   // returning parameter buffers
   auto GetParameterBuffer(Parameter const parameter_type)
-      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+      -> ParameterValue (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
   auto GetParameterBuffer(Parameter const parameter_type) const
-      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+      -> ParameterValue const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
 
   Parameters &GetParameterBuffer();
   Parameters const &GetParameterBuffer() const;
@@ -158,8 +284,83 @@ public:
 
   void ResetJumpFluxes(BoundaryLocation const location);
   void ResetJumpConservatives(BoundaryLocation const location);
+
+  bool HasJumpBuffers() const;
+  void AllocateJumpBuffers();
+  void ReleaseJumpBuffers();
+
+  bool HasIntegrationBuffers() const;
+  void AllocateIntegrationBuffers();
+  void ReleaseIntegrationBuffers();
+
+  StatisticsBuffers &GetStatisticsBuffers();
+  StatisticsBuffers const &GetStatisticsBuffers() const;
+  bool HasStatisticsBuffers() const;
+  void AllocateStatisticsBuffers();
+  void ReleaseStatisticsBuffers();
+
+  void MoveToNumaDomain(int const domain) const;
+
+  // Cached velocity gradient
+  auto PrepareVelocityGradient() -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()]
+                                              [DTI(CC::DIM())][DTI(CC::DIM())];
+  auto GetVelocityGradient() const -> double const (
+          &)[CC::TCX()][CC::TCY()][CC::TCZ()][DTI(CC::DIM())][DTI(CC::DIM())];
+  bool HasVelocityGradient() const;
+  bool HasVelocityGradientStorage() const;
+  void InvalidateVelocityGradient();
 };
 
+/**
+ * @brief Applies a function to the corresponding buffer. In contrast to
+ * GetFieldBuffer() the buffer is passed with its storage type, which allows
+ * to handle single-precision parameters and material fields ( see
+ * CC::SinglePrecisionParameters() and CC::SinglePrecisionFields() ) in code
+ * that is generic in the field type.
+ * @param field_type The material field type of the buffer.
+ * @param field_index The index of the field asked for.
+ * @param function Function called with a reference to the buffer.
+ * @param conservative_type If a conservative field is wanted, the conservative
+ * buffer type. Defaults to ConservativeBufferType::RightHandSide.
+ */
+template <typename Function>
+void Block::VisitFieldBuffer(MaterialFieldType const field_type,
+                             unsigned int const field_index,
+                             Function &&function,
+                             ConservativeBufferType const conservative_type) {
+  switch (field_type) {
+  case MaterialFieldType::Conservatives: {
+    function(GetConservativeBuffer(conservative_type)[field_index]);
+  } break;
+  case MaterialFieldType::Parameters: {
+    function(parameters_[field_index]);
+  } break;
+  default: { // MaterialFieldType::PrimeStates:
+    function(prime_states_[field_index]);
+  }
+  }
+}
+
+/**
+ * @brief Const overload.
+ */
+template <typename Function>
+void Block::VisitFieldBuffer(
+    MaterialFieldType const field_type, unsigned int const field_index,
+    Function &&function, ConservativeBufferType const conservative_type) const {
+  switch (field_type) {
+  case MaterialFieldType::Conservatives: {
+    function(GetConservativeBuffer(conservative_type)[field_index]);
+  } break;
+  case MaterialFieldType::Parameters: {
+    function(parameters_[field_index]);
+  } break;
+  default: { // MaterialFieldType::PrimeStates:
+    function(prime_states_[field_index]);
+  }
+  }
+}
+
 auto GetBoundaryJump(SurfaceBuffer &jump, BoundaryLocation const location)
     -> double (&)[MF::ANOE()][CC::ICY()][CC::ICZ()];
 auto GetBoundaryJump(SurfaceBuffer const &jump, BoundaryLocation const location)
@@ -0,0 +1,137 @@
+//===------------------------- cut_cell_list.h ----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef CUT_CELL_LIST_H
+#define CUT_CELL_LIST_H
+
+#include "enums/interface_tag_definition.h"
+#include "user_specifications/compile_time_constants.h"
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+/**
+ * @brief The CutCellList holds the indices of the cells close to the interface,
+ * i.e. cut cells and their neighbors, of a block. It allows interface-local
+ * kernels to iterate over these cells instead of scanning the whole block. The
+ * cells cover the internal cells and the first halo cell in each direction and
+ * are stored in the order of an i-j-k loop.
+ */
+class CutCellList {
+  std::vector<std::array<unsigned int, 3>> cells_;
+  bool valid_ = false;
+
+public:
+  // first and last cell considered in each direction
+  static constexpr unsigned int FirstX = CC::FICX() - 1;
+  static constexpr unsigned int FirstY =
+      CC::DIM() != Dimension::One ? CC::FICY() - 1 : 0;
+  static constexpr unsigned int FirstZ =
+      CC::DIM() == Dimension::Three ? CC::FICZ() - 1 : 0;
+  static constexpr unsigned int LastX = CC::LICX() + 1;
+  static constexpr unsigned int LastY =
+      CC::DIM() != Dimension::One ? CC::LICY() + 1 : 0;
+  static constexpr unsigned int LastZ =
+      CC::DIM() == Dimension::Three ? CC::LICZ() + 1 : 0;
+
+  CutCellList() = default;
+  ~CutCellList() = default;
+  CutCellList(CutCellList const &) = delete;
+  CutCellList &operator=(CutCellList const &) = delete;
+  CutCellList(CutCellList &&) = delete;
+  CutCellList &operator=(CutCellList &&) = delete;
+
+  /**
+   * @brief Gathers the cells close to the interface from the interface tags.
+   * @param interface_tags The interface tags of the block.
+   * @param cells The gathered cells (indirect return parameter).
+   */
+  static void
+  Collect(std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
+          std::vector<std::array<unsigned int, 3>> &cells) {
+    cells.clear();
+    for (unsigned int i = FirstX; i <= LastX; ++i) {
+      for (unsigned int j = FirstY; j <= LastY; ++j) {
+        for (unsigned int k = FirstZ; k <= LastZ; ++k) {
+          if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::CutCellNeighbor)) {
+            cells.push_back({i, j, k});
+          }
+        } // k
+      }   // j
+    }     // i
+  }
+
+  /**
+   * @brief Rebuilds the list. Must be called whenever the interface tags the
+   * list is derived from change.
+   * @param interface_tags The reinitialized interface tags of the block.
+   */
+  void
+  Update(std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()]) {
+    Collect(interface_tags, cells_);
+    valid_ = true;
+  }
+
+  /**
+   * @brief Marks the list as outdated.
+   */
+  void Invalidate() {
+    cells_.clear();
+    valid_ = false;
+  }
+
+  /**
+   * @brief Indicates whether the list describes the current interface tags.
+   * @return True if the list is valid.
+   */
+  bool IsValid() const { return valid_; }
+
+  /**
+   * @brief Gives the cells close to the interface. If the list is outdated,
+   * the cells are gathered from the given interface tags instead.
+   * @param interface_tags The reinitialized interface tags of the block.
+   * @param scratch Storage for the gathered cells in case the list is outdated.
+   * @return The cells close to the interface.
+   */
+  std::vector<std::array<unsigned int, 3>> const &
+  Cells(std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
+        std::vector<std::array<unsigned int, 3>> &scratch) const {
+    if (valid_) {
+      return cells_;
+    }
+    Collect(interface_tags, scratch);
+    return scratch;
+  }
+
+  /**
+   * @brief Indicates whether a cell of the list is an internal cell.
+   * @param cell The indices of the cell.
+   * @return True if the cell is an internal cell.
+   */
+  static constexpr bool IsInternal(std::array<unsigned int, 3> const &cell) {
+    return cell[0] >= CC::FICX() && cell[0] <= CC::LICX() &&
+           cell[1] >= CC::FICY() && cell[1] <= CC::LICY() &&
+           cell[2] >= CC::FICZ() && cell[2] <= CC::LICZ();
+  }
+};
+
+#endif // CUT_CELL_LIST_H
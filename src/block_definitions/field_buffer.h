@@ -25,6 +25,9 @@
 #include "block_definitions/field_interface_definitions.h"
 #include "block_definitions/field_material_definitions.h"
 #include "user_specifications/compile_time_constants.h"
+#include <array>
+#include <cstddef>
+#include <type_traits>
 
 /**
  * @brief Bundles buffers for material fields of a certain type to have them
@@ -33,17 +36,95 @@
  * @tparam FieldEnum Enumeration type allowing to access the material fields.
  * @tparam int(*const FieldToIndex)(FieldEnum) Function converting the field
  * enumeration to an index in the range [0;N).
+ * @tparam Layout Memory layout of the fields, see FieldBufferLayout.
+ * @tparam T Type the values are stored in.
+ * @note The raw three-dimensional field arrays are only available in the
+ * field-major layout. Layout-independent code uses Value() or the cell views.
  */
 template <std::size_t N, typename FieldEnum,
-          unsigned int (*const FieldToIndex)(FieldEnum)>
+          unsigned int (*const FieldToIndex)(FieldEnum),
+          FieldBufferLayout Layout = CC::FBL(), typename T = double>
 struct FieldBuffer {
-  std::array<double[CC::TCX()][CC::TCY()][CC::TCZ()], N> Fields;
+  using value_type = T;
+  static constexpr std::size_t cells_per_field_ =
+      std::size_t(CC::TCX()) * CC::TCY() * CC::TCZ();
+  static_assert(Layout == FieldBufferLayout::FieldMajor ||
+                    cells_per_field_ % CC::FBTW() == 0,
+                "Number of cells per block must be a multiple of the tile "
+                "width of the cell-blocked layout");
+
+  std::conditional_t<Layout == FieldBufferLayout::FieldMajor,
+                     std::array<T[CC::TCX()][CC::TCY()][CC::TCZ()], N>,
+                     std::array<T, N * cells_per_field_>>
+      Fields;
+
+  /**
+   * @brief Gives the position of a field value in the underlying storage.
+   * @param index Index of the field.
+   * @param i, j, k Cell index.
+   * @return Offset in number of values from the start of the buffer.
+   */
+  static constexpr std::size_t Offset(unsigned short const index,
+                                      unsigned int const i,
+                                      unsigned int const j,
+                                      unsigned int const k) {
+    std::size_t const cell =
+        (std::size_t(i) * CC::TCY() + j) * CC::TCZ() + std::size_t(k);
+    if constexpr (Layout == FieldBufferLayout::FieldMajor) {
+      return index * cells_per_field_ + cell;
+    } else {
+      return (cell / CC::FBTW() * N + index) * CC::FBTW() + cell % CC::FBTW();
+    }
+  }
+
+  /**
+   * @brief Access the value of the field at the given index in a cell.
+   */
+  T &Value(unsigned short const index, unsigned int const i,
+           unsigned int const j, unsigned int const k) {
+    if constexpr (Layout == FieldBufferLayout::FieldMajor) {
+      return Fields[index][i][j][k];
+    } else {
+      return Fields[Offset(index, i, j, k)];
+    }
+  }
+
+  /**
+   * @brief Access the value of the field at the given index in a cell. Const
+   * overload.
+   */
+  T Value(unsigned short const index, unsigned int const i,
+          unsigned int const j, unsigned int const k) const {
+    if constexpr (Layout == FieldBufferLayout::FieldMajor) {
+      return Fields[index][i][j][k];
+    } else {
+      return Fields[Offset(index, i, j, k)];
+    }
+  }
+
+  /**
+   * @brief Access the value of field f in a cell.
+   */
+  T &Value(FieldEnum const f, unsigned int const i, unsigned int const j,
+           unsigned int const k) {
+    return Value(FieldToIndex(f), i, j, k);
+  }
+
+  /**
+   * @brief Access the value of field f in a cell. Const overload.
+   */
+  T Value(FieldEnum const f, unsigned int const i, unsigned int const j,
+          unsigned int const k) const {
+    return Value(FieldToIndex(f), i, j, k);
+  }
 
   /**
    * @brief Access the buffer corresponding to field f.
    */
   auto operator[](FieldEnum const f)
-      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+      -> T (&)[CC::TCX()][CC::TCY()][CC::TCZ()]
+    requires(Layout == FieldBufferLayout::FieldMajor)
+  {
     return Fields[FieldToIndex(f)];
   }
 
@@ -51,7 +132,9 @@ struct FieldBuffer {
    * @brief Access the buffer corresponding to field f. Const overload.
    */
   auto operator[](FieldEnum const f) const
-      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+      -> T const (&)[CC::TCX()][CC::TCY()][CC::TCZ()]
+    requires(Layout == FieldBufferLayout::FieldMajor)
+  {
     return Fields[FieldToIndex(f)];
   }
 
@@ -59,7 +142,9 @@ struct FieldBuffer {
    * @brief Access the buffer at the given index.
    */
   auto operator[](unsigned short const index)
-      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+      -> T (&)[CC::TCX()][CC::TCY()][CC::TCZ()]
+    requires(Layout == FieldBufferLayout::FieldMajor)
+  {
     return Fields[index];
   }
 
@@ -67,7 +152,9 @@ struct FieldBuffer {
    * @brief Access the buffer at the given index. Const overload.
    */
   auto operator[](unsigned short const index) const
-      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+      -> T const (&)[CC::TCX()][CC::TCY()][CC::TCZ()]
+    requires(Layout == FieldBufferLayout::FieldMajor)
+  {
     return Fields[index];
   }
 
@@ -78,10 +165,10 @@ struct FieldBuffer {
     FieldBuffer &buffer_;
     unsigned int const i, j, k;
 
-    double &operator[](FieldEnum const f) { return buffer_[f][i][j][k]; }
+    T &operator[](FieldEnum const f) { return buffer_.Value(f, i, j, k); }
 
-    double &operator[](unsigned short const index) {
-      return buffer_[index][i][j][k];
+    T &operator[](unsigned short const index) {
+      return buffer_.Value(index, i, j, k);
     }
   };
 
@@ -93,13 +180,12 @@ struct FieldBuffer {
     FieldBuffer const &buffer_;
     unsigned int const i, j, k;
 
-    double operator[](FieldEnum const f) const { return buffer_[f][i][j][k]; }
+    T operator[](FieldEnum const f) const { return buffer_.Value(f, i, j, k); }
 
-    double operator[](unsigned short const index) const {
-      return buffer_[index][i][j][k];
+    T operator[](unsigned short const index) const {
+      return buffer_.Value(index, i, j, k);
     }
   };
-
   /**
    * @brief Get a non-modifiable object representing the material cell at the
    * given indices.
@@ -129,32 +215,49 @@ struct FieldBuffer {
   static constexpr std::size_t GetNumberOfFields() { return N; }
 };
 
+/**
+ * @brief Type the material fields are stored and computed in ( see
+ * CC::SinglePrecisionFields() ).
+ */
+using FieldValue =
+    std::conditional_t<CC::SinglePrecisionFields(), float, double>;
+
 /**
  * @brief Bundles the conservative values to have them contiguous in memory.
  */
-using Conservatives = FieldBuffer<MF::ANOE(), Equation, ETI>;
+using Conservatives =
+    FieldBuffer<MF::ANOE(), Equation, ETI, CC::FBL(), FieldValue>;
 // Check Memory Layout at compile time for safe MPI sending (Ensures Compiler
 // did not pad the struct)
 static_assert(sizeof(Conservatives) == MF::ANOE() * CC::TCX() * CC::TCY() *
-                                           CC::TCZ() * sizeof(double),
+                                           CC::TCZ() * sizeof(FieldValue),
               "Conservative Struct is not contiguous in Memory");
 
 /**
  * @brief Bundles the prime state values to have them contiguous in memory.
  */
-using PrimeStates = FieldBuffer<MF::ANOP(), PrimeState, PTI>;
+using PrimeStates =
+    FieldBuffer<MF::ANOP(), PrimeState, PTI, CC::FBL(), FieldValue>;
 // Check Memory Layout at compile time for safe MPI sending (Ensures Compiler
 // did not pad the using)
 static_assert(sizeof(PrimeStates) == MF::ANOP() * CC::TCX() * CC::TCY() *
-                                         CC::TCZ() * sizeof(double),
+                                         CC::TCZ() * sizeof(FieldValue),
               "Prime State Struct is not contiguous in Memory");
 
+/**
+ * @brief Type the material parameters are stored in ( see
+ * CC::SinglePrecisionParameters() ).
+ */
+using ParameterValue =
+    std::conditional_t<CC::SinglePrecisionParameters(), float, double>;
+
 /**
  * @brief Bundles the parameters to have them contiguous in memory.
  */
-using Parameters = FieldBuffer<MF::ANOPA(), Parameter, PTI>;
+using Parameters =
+    FieldBuffer<MF::ANOPA(), Parameter, PTI, CC::FBL(), ParameterValue>;
 static_assert(sizeof(Parameters) == MF::ANOPA() * CC::TCX() * CC::TCY() *
-                                        CC::TCZ() * sizeof(double),
+                                        CC::TCZ() * sizeof(ParameterValue),
               "Parameters Struct is not contiguous in Memory");
 
 /**
@@ -21,7 +21,10 @@
 //===----------------------------------------------------------------------===//
 #include "block_definitions/interface_block.h"
 #include "utilities/buffer_operations.h"
+#include "utilities/storage_pool.h"
+#include <new>
 #include <stdexcept>
+#include <utility>
 
 /**
  * @brief Constructor to create a interface block according to an already
@@ -33,7 +36,11 @@ InterfaceBlock::InterfaceBlock(
     double const (&levelset_initial)[CC::TCX()][CC::TCY()][CC::TCZ()]) {
 
   // In the base buffer all values are set to zero
-  BO::SetFieldBuffer(GetBaseBuffer(), 0.0);
+  for (unsigned int d = 0; d < IF::ANOD(); ++d) {
+    BO::SetSingleBuffer(GetFieldBuffer(InterfaceFieldType::Description, d,
+                                       InterfaceDescriptionBufferType::Base),
+                        0.0);
+  }
   // In the right-hand and reinitialized buffer the levelset is copied and
   // volume fraction is set to zero
   BO::CopySingleBuffer(levelset_initial,
@@ -48,8 +55,16 @@ InterfaceBlock::InterfaceBlock(
       GetReinitializedBuffer(InterfaceDescription::VolumeFraction), 0.0);
   BO::SetSingleBuffer(GetIntegratedBuffer(InterfaceDescription::VolumeFraction),
                       0.0);
-  // In the initial buffer all values are set to zero
-  BO::SetFieldBuffer(GetInitialBuffer(), 0.0);
+  // In the initial buffer all values are set to zero ( band-tiled buffers are
+  // zero on construction )
+  if constexpr (!CC::BandTiledInterfaceInitialBuffers()) {
+    for (unsigned int d = 0; d < IF::ANOD(); ++d) {
+      BO::SetSingleBuffer(
+          GetFieldBuffer(InterfaceFieldType::Description, d,
+                         InterfaceDescriptionBufferType::Initial),
+          0.0);
+    }
+  }
   // In the interface state buffer all values are set to zero
   BO::SetFieldBuffer(GetInterfaceStateBuffer(), 0.0);
 
@@ -59,6 +74,38 @@ InterfaceBlock::InterfaceBlock(
   }
 }
 
+/**
+ * @brief Allocates the storage of an interface block, recycled from the block
+ * storage pool if pooling is active.
+ * @param size Size of the requested storage in bytes.
+ * @return Pointer to the uninitialized storage.
+ */
+void *InterfaceBlock::operator new(std::size_t const size) {
+  if constexpr (CC::PoolBlockStorage()) {
+    if (size == sizeof(InterfaceBlock)) {
+      return StoragePool<sizeof(InterfaceBlock)>::Instance().Acquire();
+    }
+  }
+  return ::operator new(size);
+}
+
+/**
+ * @brief Frees the storage of an interface block, i.e. returns it to the block
+ * storage pool if pooling is active.
+ * @param pointer Pointer to the storage.
+ * @param size Size of the storage in bytes.
+ */
+void InterfaceBlock::operator delete(void *const pointer,
+                                     std::size_t const size) {
+  if constexpr (CC::PoolBlockStorage()) {
+    if (size == sizeof(InterfaceBlock)) {
+      StoragePool<sizeof(InterfaceBlock)>::Instance().Release(pointer);
+      return;
+    }
+  }
+  ::operator delete(pointer);
+}
+
 /**
  * @brief Constructor to create an initial homogenous levelset field on the
  * interface block.
@@ -86,8 +133,16 @@ InterfaceBlock::InterfaceBlock(double const levelset_initial) {
       levelset_initial > 0 ? 1.0 : 0.0);
   BO::SetSingleBuffer(GetIntegratedBuffer(InterfaceDescription::VolumeFraction),
                       0.0);
-  // In the initial buffer all values are set to zero
-  BO::SetFieldBuffer(GetInitialBuffer(), 0.0);
+  // In the initial buffer all values are set to zero ( band-tiled buffers are
+  // zero on construction )
+  if constexpr (!CC::BandTiledInterfaceInitialBuffers()) {
+    for (unsigned int d = 0; d < IF::ANOD(); ++d) {
+      BO::SetSingleBuffer(
+          GetFieldBuffer(InterfaceFieldType::Description, d,
+                         InterfaceDescriptionBufferType::Initial),
+          0.0);
+    }
+  }
   // In the interface state buffer all values are set to zero
   BO::SetFieldBuffer(GetInterfaceStateBuffer(), 0.0);
 
@@ -111,7 +166,14 @@ auto InterfaceBlock::GetFieldBuffer(
     -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
   switch (field_type) {
   case InterfaceFieldType::Description: {
-    return GetInterfaceDescriptionBuffer(buffer_type)[field_index];
+#ifndef PERFORMANCE
+    if (CC::BandTiledInterfaceInitialBuffers() &&
+        buffer_type == InterfaceDescriptionBufferType::Initial) {
+      throw std::logic_error("The initial interface buffers are band-tiled");
+    }
+#endif
+    return descriptions_[description_slots_[field_index][static_cast<
+        unsigned int>(buffer_type)]][field_index];
   }
   case InterfaceFieldType::Parameters: {
     return parameters_[field_index];
@@ -131,7 +193,14 @@ auto InterfaceBlock::GetFieldBuffer(
     -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
   switch (field_type) {
   case InterfaceFieldType::Description: {
-    return GetInterfaceDescriptionBuffer(buffer_type)[field_index];
+#ifndef PERFORMANCE
+    if (CC::BandTiledInterfaceInitialBuffers() &&
+        buffer_type == InterfaceDescriptionBufferType::Initial) {
+      throw std::logic_error("The initial interface buffers are band-tiled");
+    }
+#endif
+    return descriptions_[description_slots_[field_index][static_cast<
+        unsigned int>(buffer_type)]][field_index];
   }
   case InterfaceFieldType::Parameters: {
     return parameters_[field_index];
@@ -150,7 +219,8 @@ auto InterfaceBlock::GetFieldBuffer(
 auto InterfaceBlock::GetBaseBuffer(
     InterfaceDescription const interface_description)
     -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return base_[interface_description];
+  return GetInterfaceDescriptionBuffer(InterfaceDescriptionBufferType::Base,
+                                       interface_description);
 }
 
 /**
@@ -159,7 +229,8 @@ auto InterfaceBlock::GetBaseBuffer(
 auto InterfaceBlock::GetBaseBuffer(
     InterfaceDescription const interface_description) const
     -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return base_[interface_description];
+  return GetInterfaceDescriptionBuffer(InterfaceDescriptionBufferType::Base,
+                                       interface_description);
 }
 
 /**
@@ -170,7 +241,8 @@ auto InterfaceBlock::GetBaseBuffer(
 auto InterfaceBlock::GetRightHandSideBuffer(
     InterfaceDescription const interface_description)
     -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return right_hand_side_[interface_description];
+  return GetInterfaceDescriptionBuffer(
+      InterfaceDescriptionBufferType::RightHandSide, interface_description);
 }
 
 /**
@@ -179,7 +251,8 @@ auto InterfaceBlock::GetRightHandSideBuffer(
 auto InterfaceBlock::GetRightHandSideBuffer(
     InterfaceDescription const interface_description) const
     -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return right_hand_side_[interface_description];
+  return GetInterfaceDescriptionBuffer(
+      InterfaceDescriptionBufferType::RightHandSide, interface_description);
 }
 
 /**
@@ -190,7 +263,8 @@ auto InterfaceBlock::GetRightHandSideBuffer(
 auto InterfaceBlock::GetReinitializedBuffer(
     InterfaceDescription const interface_description)
     -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return reinitialized_[interface_description];
+  return GetInterfaceDescriptionBuffer(
+      InterfaceDescriptionBufferType::Reinitialized, interface_description);
 }
 
 /**
@@ -199,7 +273,8 @@ auto InterfaceBlock::GetReinitializedBuffer(
 auto InterfaceBlock::GetReinitializedBuffer(
     InterfaceDescription const interface_description) const
     -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return reinitialized_[interface_description];
+  return GetInterfaceDescriptionBuffer(
+      InterfaceDescriptionBufferType::Reinitialized, interface_description);
 }
 
 /**
@@ -210,7 +285,8 @@ auto InterfaceBlock::GetReinitializedBuffer(
 auto InterfaceBlock::GetInitialBuffer(
     InterfaceDescription const interface_description)
     -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return initial_[interface_description];
+  return GetInterfaceDescriptionBuffer(InterfaceDescriptionBufferType::Initial,
+                                       interface_description);
 }
 
 /**
@@ -219,7 +295,8 @@ auto InterfaceBlock::GetInitialBuffer(
 auto InterfaceBlock::GetInitialBuffer(
     InterfaceDescription const interface_description) const
     -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return initial_[interface_description];
+  return GetInterfaceDescriptionBuffer(InterfaceDescriptionBufferType::Initial,
+                                       interface_description);
 }
 
 /**
@@ -230,7 +307,8 @@ auto InterfaceBlock::GetInitialBuffer(
 auto InterfaceBlock::GetIntegratedBuffer(
     InterfaceDescription const interface_description)
     -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return integrated_[interface_description];
+  return GetInterfaceDescriptionBuffer(
+      InterfaceDescriptionBufferType::Integrated, interface_description);
 }
 
 /**
@@ -239,234 +317,104 @@ auto InterfaceBlock::GetIntegratedBuffer(
 auto InterfaceBlock::GetIntegratedBuffer(
     InterfaceDescription const interface_description) const
     -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
-  return integrated_[interface_description];
-}
-
-/**
- * @brief Wrapper function that returns an interface description buffer (base,
- * right-hand side, reinitialized, initial, or integrated). The decision is made
- * based on the template parameter. Implementation for the base buffer.
- * @return Base interface description struct.
- */
-template <>
-InterfaceDescriptions &InterfaceBlock::GetInterfaceDescriptionBuffer<
-    InterfaceDescriptionBufferType::Base>() {
-  return GetBaseBuffer();
-}
-
-/**
- * @brief Const overload.
- */
-template <>
-InterfaceDescriptions const &InterfaceBlock::GetInterfaceDescriptionBuffer<
-    InterfaceDescriptionBufferType::Base>() const {
-  return GetBaseBuffer();
-}
-
-/**
- * @brief Wrapper function that returns an interface description buffer (base,
- * right-hand side, reinitialized, initial, or integrated). The decision is made
- * based on the template parameter. Implementation for the right-hand side
- * buffer.
- * @return Right-hand side interface description struct.
- */
-template <>
-InterfaceDescriptions &InterfaceBlock::GetInterfaceDescriptionBuffer<
-    InterfaceDescriptionBufferType::RightHandSide>() {
-  return GetRightHandSideBuffer();
-}
-
-/**
- * @brief Const overload.
- */
-template <>
-InterfaceDescriptions const &InterfaceBlock::GetInterfaceDescriptionBuffer<
-    InterfaceDescriptionBufferType::RightHandSide>() const {
-  return GetRightHandSideBuffer();
-}
-
-/**
- * @brief Wrapper function that returns an interface description buffer (base,
- * right-hand side, reinitialized, initial, or integrated). The decision is made
- * based on the template parameter. Implementation for the reinitialized buffer.
- * @return Reinitialized interface description struct.
- */
-template <>
-InterfaceDescriptions &InterfaceBlock::GetInterfaceDescriptionBuffer<
-    InterfaceDescriptionBufferType::Reinitialized>() {
-  return GetReinitializedBuffer();
-}
-
-/**
- * @brief Const overload.
- */
-template <>
-InterfaceDescriptions const &InterfaceBlock::GetInterfaceDescriptionBuffer<
-    InterfaceDescriptionBufferType::Reinitialized>() const {
-  return GetReinitializedBuffer();
-}
-
-/**
- * @brief Wrapper function that returns an interface description buffer (base,
- * right-hand side, reinitialized, initial, or integrated). The decision is made
- * based on the template parameter. Implementation for the initial buffer.
- * @return Initial interface description struct.
- */
-template <>
-InterfaceDescriptions &InterfaceBlock::GetInterfaceDescriptionBuffer<
-    InterfaceDescriptionBufferType::Initial>() {
-  return GetInitialBuffer();
-}
-
-/**
- * @brief Const overload.
- */
-template <>
-InterfaceDescriptions const &InterfaceBlock::GetInterfaceDescriptionBuffer<
-    InterfaceDescriptionBufferType::Initial>() const {
-  return GetInitialBuffer();
-}
-
-/**
- * @brief Wrapper function that returns an interface description buffer (base,
- * right-hand side, reinitialized, initial, or integrated). The decision is made
- * based on the template parameter. Implementation for the integrated buffer.
- * @return Integrated interface description struct.
- */
-template <>
-InterfaceDescriptions &InterfaceBlock::GetInterfaceDescriptionBuffer<
-    InterfaceDescriptionBufferType::Integrated>() {
-  return GetIntegratedBuffer();
-}
-
-/**
- * @brief Const overload.
- */
-template <>
-InterfaceDescriptions const &InterfaceBlock::GetInterfaceDescriptionBuffer<
-    InterfaceDescriptionBufferType::Integrated>() const {
-  return GetIntegratedBuffer();
-}
-
-/**
- * @brief Gives access to the base buffer.
- * @return base buffer struct.
- */
-InterfaceDescriptions &InterfaceBlock::GetBaseBuffer() { return base_; }
-
-/**
- * @brief Const overload.
- */
-InterfaceDescriptions const &InterfaceBlock::GetBaseBuffer() const {
-  return base_;
-}
-
-/**
- * @brief Gives access to the right-hand side buffer.
- * @return Right hand side buffer struct.
- */
-InterfaceDescriptions &InterfaceBlock::GetRightHandSideBuffer() {
-  return right_hand_side_;
-}
-
-/**
- * @brief Const overload.
- */
-InterfaceDescriptions const &InterfaceBlock::GetRightHandSideBuffer() const {
-  return right_hand_side_;
-}
-
-/**
- * @brief Gives access to the reinitialized buffer.
- * @return Reinitialized buffer struct.
- */
-InterfaceDescriptions &InterfaceBlock::GetReinitializedBuffer() {
-  return reinitialized_;
+  return GetInterfaceDescriptionBuffer(
+      InterfaceDescriptionBufferType::Integrated, interface_description);
 }
 
 /**
- * @brief Const overload.
+ * @brief Gives a reference to an interface description buffer of given type.
+ * @param buffer_type InterfaceDescription type of the buffer asked for.
+ * @param interface_description Decider which buffer is to be returned.
+ * @return Reference to Array that is the requested buffer.
  */
-InterfaceDescriptions const &InterfaceBlock::GetReinitializedBuffer() const {
-  return reinitialized_;
+auto InterfaceBlock::GetInterfaceDescriptionBuffer(
+    InterfaceDescriptionBufferType const buffer_type,
+    InterfaceDescription const interface_description)
+    -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+#ifndef PERFORMANCE
+  if (CC::BandTiledInterfaceInitialBuffers() &&
+      buffer_type == InterfaceDescriptionBufferType::Initial) {
+    throw std::logic_error("The initial interface buffers are band-tiled");
+  }
+#endif
+  return descriptions_[description_slots_[IDTI(
+      interface_description)][static_cast<unsigned int>(buffer_type)]]
+                      [interface_description];
 }
 
-/**
- * @brief Gives access to the initial buffer.
- * @return initial buffer struct.
- */
-InterfaceDescriptions &InterfaceBlock::GetInitialBuffer() { return initial_; }
-
 /**
  * @brief Const overload.
  */
-InterfaceDescriptions const &InterfaceBlock::GetInitialBuffer() const {
-  return initial_;
+auto InterfaceBlock::GetInterfaceDescriptionBuffer(
+    InterfaceDescriptionBufferType const buffer_type,
+    InterfaceDescription const interface_description) const
+    -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+#ifndef PERFORMANCE
+  if (CC::BandTiledInterfaceInitialBuffers() &&
+      buffer_type == InterfaceDescriptionBufferType::Initial) {
+    throw std::logic_error("The initial interface buffers are band-tiled");
+  }
+#endif
+  return descriptions_[description_slots_[IDTI(
+      interface_description)][static_cast<unsigned int>(buffer_type)]]
+                      [interface_description];
+}
+
+/**
+ * @brief Swaps the contents of two interface description buffers of one
+ * description. Only the assignment of the buffer types to the storage is
+ * exchanged, no values are moved.
+ * @param first_type, second_type The buffer types to be swapped.
+ * @param interface_description The description whose buffers are swapped.
+ * @note References and pointers to the buffers obtained before refer to the
+ * other buffer type afterwards. Band-tiled initial buffers cannot be swapped.
+ */
+void InterfaceBlock::SwapInterfaceDescriptionBuffers(
+    InterfaceDescriptionBufferType const first_type,
+    InterfaceDescriptionBufferType const second_type,
+    InterfaceDescription const interface_description) {
+#ifndef PERFORMANCE
+  if (CC::BandTiledInterfaceInitialBuffers() &&
+      (first_type == InterfaceDescriptionBufferType::Initial ||
+       second_type == InterfaceDescriptionBufferType::Initial)) {
+    throw std::logic_error("The band-tiled initial buffers cannot be swapped");
+  }
+#endif
+  auto &slots = description_slots_[IDTI(interface_description)];
+  std::swap(slots[static_cast<unsigned int>(first_type)],
+            slots[static_cast<unsigned int>(second_type)]);
 }
 
 /**
- * @brief Gives access to the integrated buffer.
- * @return integrated buffer struct.
+ * @brief Gives the band-tiled initial buffer of a description.
+ * @param interface_description Decider which buffer is to be returned.
+ * @return Reference to the band-tiled buffer.
+ * @note Only available if CC::BandTiledInterfaceInitialBuffers() is set.
  */
-InterfaceDescriptions &InterfaceBlock::GetIntegratedBuffer() {
-  return integrated_;
+BandTiledBuffer &InterfaceBlock::GetBandTiledInitialBuffer(
+    InterfaceDescription const interface_description) {
+  return band_tiled_initial_descriptions_[IDTI(interface_description)];
 }
 
 /**
  * @brief Const overload.
  */
-InterfaceDescriptions const &InterfaceBlock::GetIntegratedBuffer() const {
-  return integrated_;
-}
-
-/**
- * @brief Gives access to the interface descritpion buffer of given type.
- * @param buffer_type InterfaceDescription type of the buffer asked for.
- * @return buffer struct of given type.
- */
-InterfaceDescriptions &InterfaceBlock::GetInterfaceDescriptionBuffer(
-    InterfaceDescriptionBufferType const buffer_type) {
-  switch (buffer_type) {
-  case InterfaceDescriptionBufferType::RightHandSide: {
-    return right_hand_side_;
-  }
-  case InterfaceDescriptionBufferType::Reinitialized: {
-    return reinitialized_;
-  }
-  case InterfaceDescriptionBufferType::Base: {
-    return base_;
-  }
-  case InterfaceDescriptionBufferType::Integrated: {
-    return integrated_;
-  }
-  default: { // case InterfaceDescriptionBufferType::Initial:
-    return initial_;
-  }
-  }
+BandTiledBuffer const &InterfaceBlock::GetBandTiledInitialBuffer(
+    InterfaceDescription const interface_description) const {
+  return band_tiled_initial_descriptions_[IDTI(interface_description)];
 }
 
 /**
- * @brief Const overload.
+ * @brief Gives the memory held by the dense tiles of the band-tiled buffers,
+ * which is not part of the interface block itself.
+ * @return The memory in bytes.
  */
-InterfaceDescriptions const &InterfaceBlock::GetInterfaceDescriptionBuffer(
-    InterfaceDescriptionBufferType const buffer_type) const {
-  switch (buffer_type) {
-  case InterfaceDescriptionBufferType::RightHandSide: {
-    return right_hand_side_;
-  }
-  case InterfaceDescriptionBufferType::Reinitialized: {
-    return reinitialized_;
-  }
-  case InterfaceDescriptionBufferType::Base: {
-    return base_;
-  }
-  case InterfaceDescriptionBufferType::Integrated: {
-    return integrated_;
-  }
-  default: { // case InterfaceDescriptionBufferType::Initial:
-    return initial_;
-  }
+std::size_t InterfaceBlock::BandTiledBytes() const {
+  std::size_t bytes = 0;
+  for (BandTiledBuffer const &buffer : band_tiled_initial_descriptions_) {
+    bytes += buffer.DenseBytes();
   }
+  return bytes;
 }
 
 /**
@@ -535,6 +483,53 @@ InterfaceParameters const &InterfaceBlock::GetInterfaceParameterBuffer() const {
   return parameters_;
 }
 
+/**
+ * @brief Gives the cache of the geometric quantities of the cells close to the
+ * interface.
+ * @return Geometry cache.
+ */
+InterfaceGeometryCache &InterfaceBlock::GetGeometryCache() {
+  return geometry_cache_;
+}
+
+/**
+ * @brief Const overload.
+ */
+InterfaceGeometryCache const &InterfaceBlock::GetGeometryCache() const {
+  return geometry_cache_;
+}
+
+/**
+ * @brief Gives the list of the cells close to the interface.
+ * @return Cut-cell list.
+ */
+CutCellList &InterfaceBlock::GetCutCellList() { return cut_cell_list_; }
+
+/**
+ * @brief Const overload.
+ */
+CutCellList const &InterfaceBlock::GetCutCellList() const {
+  return cut_cell_list_;
+}
+
+/**
+ * @brief Gives the number of consecutive reinitializations the level-set field
+ * skipped.
+ * @return Number of skipped reinitializations.
+ */
+unsigned int InterfaceBlock::GetSkippedReinitializations() const {
+  return skipped_reinitializations_;
+}
+
+/**
+ * @brief Sets the number of consecutive reinitializations the level-set field
+ * skipped.
+ * @param skipped Number of skipped reinitializations.
+ */
+void InterfaceBlock::SetSkippedReinitializations(unsigned int const skipped) {
+  skipped_reinitializations_ = skipped;
+}
+
 /**
  * @brief Gives the requested buffer of a specific single interface block
  * buffer.
@@ -545,28 +540,28 @@ auto InterfaceBlock::GetBuffer(InterfaceBlockBufferType const buffer_type)
   switch (buffer_type) {
   // interface descriptions
   case InterfaceBlockBufferType::LevelsetBase: {
-    return base_[InterfaceDescription::Levelset];
+    return GetBaseBuffer(InterfaceDescription::Levelset);
   }
   case InterfaceBlockBufferType::VolumeFractionBase: {
-    return base_[InterfaceDescription::VolumeFraction];
+    return GetBaseBuffer(InterfaceDescription::VolumeFraction);
   }
   case InterfaceBlockBufferType::LevelsetRightHandSide: {
-    return right_hand_side_[InterfaceDescription::Levelset];
+    return GetRightHandSideBuffer(InterfaceDescription::Levelset);
   }
   case InterfaceBlockBufferType::VolumeFractionRightHandSide: {
-    return right_hand_side_[InterfaceDescription::VolumeFraction];
+    return GetRightHandSideBuffer(InterfaceDescription::VolumeFraction);
   }
   case InterfaceBlockBufferType::LevelsetReinitialized: {
-    return reinitialized_[InterfaceDescription::Levelset];
+    return GetReinitializedBuffer(InterfaceDescription::Levelset);
   }
   case InterfaceBlockBufferType::VolumeFractionReinitialized: {
-    return reinitialized_[InterfaceDescription::VolumeFraction];
+    return GetReinitializedBuffer(InterfaceDescription::VolumeFraction);
   }
   case InterfaceBlockBufferType::LevelsetIntegrated: {
-    return integrated_[InterfaceDescription::Levelset];
+    return GetIntegratedBuffer(InterfaceDescription::Levelset);
   }
   case InterfaceBlockBufferType::VolumeFractionIntegrated: {
-    return integrated_[InterfaceDescription::VolumeFraction];
+    return GetIntegratedBuffer(InterfaceDescription::VolumeFraction);
   }
   // interface states
   case InterfaceBlockBufferType::InterfaceStateVelocity: {
@@ -603,28 +598,28 @@ auto InterfaceBlock::GetBuffer(InterfaceBlockBufferType const buffer_type) const
   switch (buffer_type) {
   // interface description cases
   case InterfaceBlockBufferType::LevelsetBase: {
-    return base_[InterfaceDescription::Levelset];
+    return GetBaseBuffer(InterfaceDescription::Levelset);
   }
   case InterfaceBlockBufferType::VolumeFractionBase: {
-    return base_[InterfaceDescription::VolumeFraction];
+    return GetBaseBuffer(InterfaceDescription::VolumeFraction);
   }
   case InterfaceBlockBufferType::LevelsetRightHandSide: {
-    return right_hand_side_[InterfaceDescription::Levelset];
+    return GetRightHandSideBuffer(InterfaceDescription::Levelset);
   }
   case InterfaceBlockBufferType::VolumeFractionRightHandSide: {
-    return right_hand_side_[InterfaceDescription::VolumeFraction];
+    return GetRightHandSideBuffer(InterfaceDescription::VolumeFraction);
   }
   case InterfaceBlockBufferType::LevelsetReinitialized: {
-    return reinitialized_[InterfaceDescription::Levelset];
+    return GetReinitializedBuffer(InterfaceDescription::Levelset);
   }
   case InterfaceBlockBufferType::VolumeFractionReinitialized: {
-    return reinitialized_[InterfaceDescription::VolumeFraction];
+    return GetReinitializedBuffer(InterfaceDescription::VolumeFraction);
   }
   case InterfaceBlockBufferType::LevelsetIntegrated: {
-    return integrated_[InterfaceDescription::Levelset];
+    return GetIntegratedBuffer(InterfaceDescription::Levelset);
   }
   case InterfaceBlockBufferType::VolumeFractionIntegrated: {
-    return integrated_[InterfaceDescription::VolumeFraction];
+    return GetIntegratedBuffer(InterfaceDescription::VolumeFraction);
   }
   // interface states
   case InterfaceBlockBufferType::InterfaceStateVelocity: {
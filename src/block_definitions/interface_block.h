@@ -22,10 +22,15 @@
 #ifndef INTERFACE_BLOCK_H
 #define INTERFACE_BLOCK_H
 
+#include "block_definitions/band_tiled_buffer.h"
+#include "block_definitions/cut_cell_list.h"
 #include "block_definitions/field_buffer.h"
 #include "block_definitions/field_interface_definitions.h"
+#include "block_definitions/interface_geometry_cache.h"
 #include "interface_block_buffer_definitions.h"
 #include "user_specifications/compile_time_constants.h"
+#include <array>
+#include <cstddef>
 
 /**
  * @brief The InterfaceBlock class holds the interface data, such as the
@@ -36,13 +41,52 @@
  */
 class InterfaceBlock {
 
-  // buffers for the interface description (different buffer types required for
-  // the integration)
-  InterfaceDescriptions base_;
-  InterfaceDescriptions right_hand_side_;
-  InterfaceDescriptions reinitialized_;
-  InterfaceDescriptions initial_;
-  InterfaceDescriptions integrated_;
+  // number of interface description buffer types
+  static constexpr unsigned int number_of_description_buffers_ = 5;
+  // number of dense interface description storages, the initial buffers are
+  // held separately if band-tiled
+  static constexpr unsigned int number_of_description_storages_ =
+      CC::BandTiledInterfaceInitialBuffers()
+          ? number_of_description_buffers_ - 1
+          : number_of_description_buffers_;
+  // storage slot of each buffer type for each description
+  using DescriptionSlots =
+      std::array<std::array<unsigned char, number_of_description_buffers_>,
+                 IF::ANOD()>;
+
+  /**
+   * @brief Gives the assignment of all buffer types to the storage slots of
+   * equal index for each description. If the initial buffers are band-tiled,
+   * the integrated buffers take over their slot.
+   */
+  static constexpr DescriptionSlots InitialDescriptionSlots() {
+    DescriptionSlots slots = {};
+    for (auto &description_slots : slots) {
+      for (unsigned int b = 0; b < number_of_description_buffers_; ++b) {
+        description_slots[b] = static_cast<unsigned char>(b);
+      }
+      if constexpr (CC::BandTiledInterfaceInitialBuffers()) {
+        description_slots[static_cast<unsigned int>(
+            InterfaceDescriptionBufferType::Integrated)] =
+            static_cast<unsigned char>(InterfaceDescriptionBufferType::Initial);
+      }
+    }
+    return slots;
+  }
+
+  // storage of the interface descriptions (different buffer types required for
+  // the integration). The buffer types are assigned to the storage slots per
+  // description through description_slots_, such that buffers are swapped by
+  // exchanging the slots
+  std::array<InterfaceDescriptions, number_of_description_storages_>
+      descriptions_;
+  DescriptionSlots description_slots_ = InitialDescriptionSlots();
+
+  // initial interface descriptions stored densely only where the interface
+  // band passes ( see CC::BandTiledInterfaceInitialBuffers() )
+  std::array<BandTiledBuffer,
+             CC::BandTiledInterfaceInitialBuffers() ? IF::ANOD() : 0>
+      band_tiled_initial_descriptions_;
 
   // buffers for the interface states (e.g. interface velocity,
   // negative/positive pressure)
@@ -52,6 +96,18 @@ class InterfaceBlock {
   // coefficient)
   InterfaceParameters parameters_;
 
+  // geometric quantities of the cells close to the interface derived from the
+  // reinitialized level-set field
+  InterfaceGeometryCache geometry_cache_;
+
+  // indices of the cells close to the interface derived from the reinitialized
+  // interface tags
+  CutCellList cut_cell_list_;
+
+  // number of consecutive reinitializations skipped by the level-set field
+  // ( see ReinitializationConstants::SkipWellResolvedNodes )
+  unsigned int skipped_reinitializations_ = 0;
+
 public:
   InterfaceBlock() = delete;
   explicit InterfaceBlock(double const levelset_initial);
@@ -63,6 +119,10 @@ public:
   InterfaceBlock(InterfaceBlock &&) = delete;
   InterfaceBlock &operator=(InterfaceBlock &&) = delete;
 
+  // Heap instances are drawn from the block storage pool
+  static void *operator new(std::size_t const size);
+  static void operator delete(void *const pointer, std::size_t const size);
+
   // Returning general field buffer
   auto GetFieldBuffer(InterfaceFieldType const field_type,
                       unsigned int const field_index,
@@ -105,25 +165,35 @@ public:
       -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
 
   template <InterfaceDescriptionBufferType C>
-  InterfaceDescriptions &GetInterfaceDescriptionBuffer();
+  auto GetInterfaceDescriptionBuffer(
+      InterfaceDescription const interface_description)
+      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
 
   template <InterfaceDescriptionBufferType C>
-  InterfaceDescriptions const &GetInterfaceDescriptionBuffer() const;
-
-  InterfaceDescriptions &GetBaseBuffer();
-  InterfaceDescriptions const &GetBaseBuffer() const;
-  InterfaceDescriptions &GetRightHandSideBuffer();
-  InterfaceDescriptions const &GetRightHandSideBuffer() const;
-  InterfaceDescriptions &GetReinitializedBuffer();
-  InterfaceDescriptions const &GetReinitializedBuffer() const;
-  InterfaceDescriptions &GetInitialBuffer();
-  InterfaceDescriptions const &GetInitialBuffer() const;
-  InterfaceDescriptions &GetIntegratedBuffer();
-  InterfaceDescriptions const &GetIntegratedBuffer() const;
-  InterfaceDescriptions &GetInterfaceDescriptionBuffer(
-      InterfaceDescriptionBufferType const buffer_type);
-  InterfaceDescriptions const &GetInterfaceDescriptionBuffer(
-      InterfaceDescriptionBufferType const buffer_type) const;
+  auto GetInterfaceDescriptionBuffer(
+      InterfaceDescription const interface_description) const
+      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+
+  auto GetInterfaceDescriptionBuffer(
+      InterfaceDescriptionBufferType const buffer_type,
+      InterfaceDescription const interface_description)
+      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+  auto GetInterfaceDescriptionBuffer(
+      InterfaceDescriptionBufferType const buffer_type,
+      InterfaceDescription const interface_description) const
+      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+
+  void SwapInterfaceDescriptionBuffers(
+      InterfaceDescriptionBufferType const first_type,
+      InterfaceDescriptionBufferType const second_type,
+      InterfaceDescription const interface_description);
+
+  // Returning band-tiled initial buffers
+  BandTiledBuffer &
+  GetBandTiledInitialBuffer(InterfaceDescription const interface_description);
+  BandTiledBuffer const &GetBandTiledInitialBuffer(
+      InterfaceDescription const interface_description) const;
+  std::size_t BandTiledBytes() const;
 
   // Returning state buffers
   auto GetInterfaceStateBuffer(InterfaceState const state_type)
@@ -144,6 +214,18 @@ public:
   InterfaceParameters &GetInterfaceParameterBuffer();
   InterfaceParameters const &GetInterfaceParameterBuffer() const;
 
+  // returning the cached interface geometry
+  InterfaceGeometryCache &GetGeometryCache();
+  InterfaceGeometryCache const &GetGeometryCache() const;
+
+  // returning the list of cells close to the interface
+  CutCellList &GetCutCellList();
+  CutCellList const &GetCutCellList() const;
+
+  // returning the number of consecutively skipped reinitializations
+  unsigned int GetSkippedReinitializations() const;
+  void SetSkippedReinitializations(unsigned int const skipped);
+
   // returning general interface block buffer
   auto GetBuffer(InterfaceBlockBufferType const buffer_type)
       -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
@@ -151,4 +233,28 @@ public:
       -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
 };
 
+/**
+ * @brief Wrapper function that returns an interface description buffer (base,
+ * right-hand side, reinitialized, initial, or integrated). The decision is made
+ * based on the template parameter.
+ * @param interface_description Decider which buffer is to be returned.
+ * @return Reference to Array that is the requested buffer.
+ */
+template <InterfaceDescriptionBufferType C>
+auto InterfaceBlock::GetInterfaceDescriptionBuffer(
+    InterfaceDescription const interface_description)
+    -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  return GetInterfaceDescriptionBuffer(C, interface_description);
+}
+
+/**
+ * @brief Const overload.
+ */
+template <InterfaceDescriptionBufferType C>
+auto InterfaceBlock::GetInterfaceDescriptionBuffer(
+    InterfaceDescription const interface_description) const
+    -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  return GetInterfaceDescriptionBuffer(C, interface_description);
+}
+
 #endif // INTERFACE_BLOCK_H
@@ -0,0 +1,147 @@
+//===------------------ interface_geometry_cache.h ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef INTERFACE_GEOMETRY_CACHE_H
+#define INTERFACE_GEOMETRY_CACHE_H
+
+#include "user_specifications/compile_time_constants.h"
+#include <algorithm>
+#include <array>
+#include <vector>
+
+/**
+ * @brief Geometric quantities of a single cell close to the interface.
+ */
+struct CutCellGeometry {
+  // position of the cell in the block, see InterfaceGeometryCache::CellIndex
+  unsigned int cell_index_;
+  // cell-face apertures of the positive phase
+  std::array<double, 6> apertures_;
+  // interface normal pointing into the positive phase
+  std::array<double, 3> normal_;
+  // height-function curvature, only meaningful if has_curvature_ is set ( see
+  // GeometryCalculationSettings::CurvatureEstimator )
+  double curvature_;
+  bool has_curvature_;
+};
+
+/**
+ * @brief The InterfaceGeometryCache stores the geometric quantities of the
+ * cells close to the interface, which are derived from the reinitialized
+ * level-set field. The quantities are computed once after the level-set field
+ * of a stage is final and reused by all consumers until the level-set field
+ * changes again. Only cells close to the interface are stored.
+ */
+class InterfaceGeometryCache {
+  // cells sorted by their cell index
+  std::vector<CutCellGeometry> cells_;
+  bool valid_ = false;
+
+public:
+  InterfaceGeometryCache() = default;
+  ~InterfaceGeometryCache() = default;
+  InterfaceGeometryCache(InterfaceGeometryCache const &) = delete;
+  InterfaceGeometryCache &operator=(InterfaceGeometryCache const &) = delete;
+  InterfaceGeometryCache(InterfaceGeometryCache &&) = delete;
+  InterfaceGeometryCache &operator=(InterfaceGeometryCache &&) = delete;
+
+  /**
+   * @brief Gives the position of a cell in the block.
+   * @param i The index in x-direction.
+   * @param j The index in y-direction.
+   * @param k The index in z-direction.
+   * @return The linearized cell index.
+   */
+  static constexpr unsigned int
+  CellIndex(unsigned int const i, unsigned int const j, unsigned int const k) {
+    return (i * CC::TCY() + j) * CC::TCZ() + k;
+  }
+
+  /**
+   * @brief Removes all cells and marks the cache as outdated. Must be called
+   * whenever the level-set field the cache was computed from changes.
+   */
+  void Invalidate() {
+    cells_.clear();
+    valid_ = false;
+  }
+
+  /**
+   * @brief Appends a cell. Cells have to be added in increasing order of their
+   * cell index, i.e. in the order of an i-j-k loop.
+   * @param i The index in x-direction.
+   * @param j The index in y-direction.
+   * @param k The index in z-direction.
+   * @param apertures Cell-face apertures of the positive phase.
+   * @param normal Interface normal pointing into the positive phase.
+   * @param curvature Height-function curvature of the cell.
+   * @param has_curvature Whether the curvature is given.
+   */
+  void Add(unsigned int const i, unsigned int const j, unsigned int const k,
+           std::array<double, 6> const &apertures,
+           std::array<double, 3> const &normal, double const curvature = 0.0,
+           bool const has_curvature = false) {
+    cells_.push_back(
+        {CellIndex(i, j, k), apertures, normal, curvature, has_curvature});
+  }
+
+  /**
+   * @brief Marks the cache as up to date once all cells have been added.
+   */
+  void Validate() { valid_ = true; }
+
+  /**
+   * @brief Indicates whether the cache describes the current level-set field.
+   * @return True if the cache is valid.
+   */
+  bool IsValid() const { return valid_; }
+
+  /**
+   * @brief Gives the number of stored cells.
+   * @return Number of cells.
+   */
+  std::size_t Size() const { return cells_.size(); }
+
+  /**
+   * @brief Gives the stored quantities of a cell.
+   * @param i The index in x-direction.
+   * @param j The index in y-direction.
+   * @param k The index in z-direction.
+   * @return Pointer to the quantities, nullptr if the cache is outdated or the
+   * cell is not stored.
+   */
+  CutCellGeometry const *Find(unsigned int const i, unsigned int const j,
+                              unsigned int const k) const {
+    if (!valid_) {
+      return nullptr;
+    }
+    unsigned int const cell_index = CellIndex(i, j, k);
+    auto const cell = std::lower_bound(
+        cells_.begin(), cells_.end(), cell_index,
+        [](CutCellGeometry const &geometry, unsigned int const index) {
+          return geometry.cell_index_ < index;
+        });
+    return cell != cells_.end() && cell->cell_index_ == cell_index ? &(*cell)
+                                                                   : nullptr;
+  }
+};
+
+#endif // INTERFACE_GEOMETRY_CACHE_H
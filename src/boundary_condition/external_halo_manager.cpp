@@ -80,3 +80,17 @@ void ExternalHaloManager::UpdateMaterialExternal(
   material_boundary_conditions_[LTI(loc)]->UpdateMaterialExternal(node,
                                                                   field_type);
 }
+
+/**
+ * @brief Performs the material halo updates in external boundaries of a group
+ * of nodes with a single call of the boundary condition.
+ * @param nodes Nodes for which the halo update is done (indirect return).
+ * @param field_type Field identifier for material block buffers.
+ * @param loc Location of the boundary to update (the same for all nodes).
+ */
+void ExternalHaloManager::UpdateMaterialExternal(
+    std::vector<std::reference_wrapper<Node>> const &nodes,
+    MaterialFieldType const field_type, BoundaryLocation const loc) const {
+  material_boundary_conditions_[LTI(loc)]->UpdateMaterialExternal(nodes,
+                                                                  field_type);
+}
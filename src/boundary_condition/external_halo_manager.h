@@ -27,7 +27,9 @@
 #include "boundary_condition/material_boundary_condition.h"
 #include "topology/node.h"
 #include <array>
+#include <functional>
 #include <memory>
+#include <vector>
 
 /**
  * @brief Container of the external boundaries conditions for materials and
@@ -66,6 +68,10 @@ public:
       BoundaryLocation const loc) const;
   void UpdateMaterialExternal(Node &node, MaterialFieldType const field_type,
                               BoundaryLocation const loc) const;
+  void
+  UpdateMaterialExternal(std::vector<std::reference_wrapper<Node>> const &nodes,
+                         MaterialFieldType const field_type,
+                         BoundaryLocation const loc) const;
 };
 
 #endif /* EXTERNAL_HALO_MANAGER_H */
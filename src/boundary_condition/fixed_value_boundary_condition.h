@@ -73,10 +73,11 @@ public:
       switch (field_type) {
       case MaterialFieldType::Conservatives: {
         for (Equation const eq : MF::ASOE()) {
-          double(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+          FieldValue(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
               host_mat_block.second.GetRightHandSideBuffer(eq);
           for (unsigned int i = start_indices[0]; i < end_indices[0]; ++i) {
             for (unsigned int j = start_indices[1]; j < end_indices[1]; ++j) {
+#pragma omp simd
               for (unsigned int k = start_indices[2]; k < end_indices[2]; ++k) {
                 cells[i][j][k] = fixed_conservatives_[material_index][ETI(eq)];
               }
@@ -86,10 +87,11 @@ public:
       } break;
       case MaterialFieldType::PrimeStates: {
         for (PrimeState const ps : MF::ASOP()) {
-          double(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+          FieldValue(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
               host_mat_block.second.GetPrimeStateBuffer(ps);
           for (unsigned int i = start_indices[0]; i < end_indices[0]; ++i) {
             for (unsigned int j = start_indices[1]; j < end_indices[1]; ++j) {
+#pragma omp simd
               for (unsigned int k = start_indices[2]; k < end_indices[2]; ++k) {
                 cells[i][j][k] = fixed_prime_states_[material_index][PTI(ps)];
               }
@@ -109,6 +111,18 @@ public:
     }
   }
 
+  /**
+   * @brief See base class. Imposes the predefined values onto the
+   * halo cells of all nodes of the group.
+   */
+  void
+  UpdateMaterialExternal(std::vector<std::reference_wrapper<Node>> const &nodes,
+                         MaterialFieldType const field_type) const override {
+    for (Node &node : nodes) {
+      FixedValueBoundaryCondition::UpdateMaterialExternal(node, field_type);
+    }
+  }
+
   /**
    * @brief Identifies the Location of the BoundaryCondition.
    * @return A BoundaryLocation indicating the position of the
@@ -24,6 +24,8 @@
 
 #include "boundary_specifications.h"
 #include "topology/node.h"
+#include <functional>
+#include <vector>
 
 /**
  * @brief The MaterialBoundaryCondition class Defines an Interface for the
@@ -54,6 +56,21 @@ public:
   virtual void
   UpdateMaterialExternal(Node &node,
                          MaterialFieldType const field_type) const = 0;
+
+  /**
+   * @brief Updates the halo cells of a group of nodes sharing this boundary
+   * condition. Concrete conditions override it to loop over the nodes without
+   * virtual calls.
+   * @param nodes The nodes whose halo cells are to be updated.
+   * @param field_type Field identifier for material block buffers.
+   */
+  virtual void
+  UpdateMaterialExternal(std::vector<std::reference_wrapper<Node>> const &nodes,
+                         MaterialFieldType const field_type) const {
+    for (Node &node : nodes) {
+      UpdateMaterialExternal(node, field_type);
+    }
+  }
 };
 
 #endif // MATERIAL_BOUNDARY_CONDITION_H
@@ -120,21 +120,38 @@ public:
     for (auto &host_mat_block : node.GetPhases()) {
       for (unsigned int field_index = 0; field_index < number_of_fields;
            ++field_index) {
-        double(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-            host_mat_block.second.GetFieldBuffer(field_type, field_index);
-        for (unsigned int i = start_indices[0]; i < end_indices[0]; ++i) {
-          for (unsigned int j = start_indices[1]; j < end_indices[1]; ++j) {
-            for (unsigned int k = start_indices[2]; k < end_indices[2]; ++k) {
-              cells[i][j][k] =
-                  WallSign(field_type, field_index) *
-                  BoundaryConstants<LOC>::SymmetryInternalValue(cells, i, j, k);
-            }
-          }
-        }
+        double const sign = WallSign(field_type, field_index);
+        host_mat_block.second.VisitFieldBuffer(
+            field_type, field_index, [&](auto &cells) {
+              for (unsigned int i = start_indices[0]; i < end_indices[0]; ++i) {
+                for (unsigned int j = start_indices[1]; j < end_indices[1];
+                     ++j) {
+#pragma omp simd
+                  for (unsigned int k = start_indices[2]; k < end_indices[2];
+                       ++k) {
+                    cells[i][j][k] =
+                        sign * BoundaryConstants<LOC>::SymmetryInternalValue(
+                                   cells, i, j, k);
+                  }
+                }
+              }
+            });
       }
     }
   }
 
+  /**
+   * @brief See base class. Mirrors the domain values into the halo
+   * cells of all nodes of the group.
+   */
+  void
+  UpdateMaterialExternal(std::vector<std::reference_wrapper<Node>> const &nodes,
+                         MaterialFieldType const field_type) const override {
+    for (Node &node : nodes) {
+      WallBoundaryCondition::UpdateMaterialExternal(node, field_type);
+    }
+  }
+
   /**
    * @brief Identifies the Location of the BoundaryCondition.
    * @return A BoundaryLocation indicating the position of the
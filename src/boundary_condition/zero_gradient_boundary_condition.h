@@ -48,6 +48,7 @@ class ZeroGradientBoundaryCondition : public MaterialBoundaryCondition,
 
     for (unsigned int i = start_indices[0]; i < end_indices[0]; ++i) {
       for (unsigned int j = start_indices[1]; j < end_indices[1]; ++j) {
+#pragma omp simd
         for (unsigned int k = start_indices[2]; k < end_indices[2]; ++k) {
           host_buffer[i][j][k] =
               BoundaryConstants<LOC>::ZeroGradientValue(host_buffer, i, j, k);
@@ -76,13 +77,25 @@ public:
     for (auto &host_mat_block : node.GetPhases()) {
       for (unsigned int field_index = 0; field_index < number_of_fields;
            ++field_index) {
-        double(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-            host_mat_block.second.GetFieldBuffer(field_type, field_index);
-        UpdateZeroGradient(cells);
+        host_mat_block.second.VisitFieldBuffer(
+            field_type, field_index,
+            [this](auto &cells) { UpdateZeroGradient(cells); });
       }
     }
   }
 
+  /**
+   * @brief See base class. Applies the zero-gradient condition
+   * to all nodes of the group.
+   */
+  void
+  UpdateMaterialExternal(std::vector<std::reference_wrapper<Node>> const &nodes,
+                         MaterialFieldType const field_type) const override {
+    for (Node &node : nodes) {
+      ZeroGradientBoundaryCondition::UpdateMaterialExternal(node, field_type);
+    }
+  }
+
   /**
    * @brief See base class. Adjusted to zero-gradient condition.
    */
@@ -21,7 +21,9 @@
 //===----------------------------------------------------------------------===//
 #include "communication_manager.h"
 
+#include <algorithm>
 #include <bitset>
+#include <numeric>
 
 #include "boundary_condition/material_boundary_condition.h"
 #include "communication/communication_statistics.h"
@@ -29,31 +31,86 @@
 #include "levelset/multi_phase_manager/material_sign_capsule.h"
 #include "mpi_utilities.h"
 #include "topology/id_information.h"
+#include "utilities/memory_statistics.h"
+#include "utilities/runtime_profiler.h"
 
 /**
  * @brief Default constructor.
  * @param topology Instance that provides node data on a global level.
  * @param maximum_level Maximum present level for the simulation.
+ * @param halo_exchange The protocol of the aggregated halo exchange.
  */
 CommunicationManager::CommunicationManager(TopologyManager &topology,
-                                           unsigned int const maximum_level)
+                                           unsigned int const maximum_level,
+                                           HaloExchange const halo_exchange)
     :                       // Start initializer list
       CommunicationTypes(), // For allocation of the MPI Datatypes
       topology_(topology), maximum_level_(maximum_level),
       my_rank_id_(MpiUtilities::MyRankId()),
-      mpi_tag_ub_(MpiUtilities::MpiTagUb()),
-      partner_tag_map_(MpiUtilities::NumberOfRanks(), 0),
+      mpi_tag_ub_(MpiUtilities::MpiTagUb()), node_communicator_(MPI_COMM_NULL),
+      node_rank_of_rank_(), partner_tag_map_(MpiUtilities::NumberOfRanks(), 0),
       internal_boundaries_(maximum_level_ + 1),
       internal_boundaries_mpi_(maximum_level_ + 1),
       internal_multi_boundaries_(), internal_multi_boundaries_mpi_(),
       internal_boundaries_jump_(maximum_level_ + 1),
       internal_boundaries_jump_mpi_(maximum_level_ + 1),
-      external_boundaries_(maximum_level_ + 1), external_multi_boundaries_(),
-      boundaries_valid_(maximum_level_ + 1, false) {
+      jump_halos_(maximum_level_ + 1), external_boundaries_(maximum_level_ + 1),
+      external_multi_boundaries_(),
+      external_boundary_groups_(maximum_level_ + 1),
+      external_multi_boundary_groups_(),
+      extended_boundaries_(maximum_level_ + 1),
+      face_halos_only_(maximum_level_ + 1, false),
+      face_halos_only_material_update_count_(topology_.MaterialUpdateCount()),
+      boundaries_valid_(maximum_level_ + 1, false),
+      persistent_halo_requests_(maximum_level_ + 1),
+      persistent_halo_requests_valid_(maximum_level_ + 1,
+                                      {false, false, false}),
+      aggregated_halo_messages_(maximum_level_ + 1),
+      persistent_halo_requests_material_update_count_(
+          topology_.MaterialUpdateCount()),
+      persistent_tag_(mpi_tag_ub_), halo_exchange_(halo_exchange),
+      one_sided_window_(MPI_WIN_NULL) {
   // Initialize cache for Halo Update
   for (unsigned int level = 0; level <= maximum_level_; level++) {
     jump_send_count_.emplace_back(std::array<unsigned int, 3>({0, 0, 0}));
   }
+  if constexpr (CC::SharedMemoryHaloExchange()) {
+    MPI_Comm_split_type(MpiUtilities::Communicator(), MPI_COMM_TYPE_SHARED,
+                        my_rank_id_, MPI_INFO_NULL, &node_communicator_);
+    MPI_Group group;
+    MPI_Group node_group;
+    MPI_Comm_group(MpiUtilities::Communicator(), &group);
+    MPI_Comm_group(node_communicator_, &node_group);
+    std::vector<int> ranks(MpiUtilities::NumberOfRanks());
+    std::iota(std::begin(ranks), std::end(ranks), 0);
+    node_rank_of_rank_.resize(ranks.size());
+    MPI_Group_translate_ranks(group, ranks.size(), ranks.data(), node_group,
+                              node_rank_of_rank_.data());
+    std::replace(std::begin(node_rank_of_rank_), std::end(node_rank_of_rank_),
+                 MPI_UNDEFINED, -1);
+    MPI_Group_free(&node_group);
+    MPI_Group_free(&group);
+  }
+  // The receive buffers of the aggregated halo updates are attached to a
+  // single dynamic window, as they change with every topology epoch
+  if (OneSidedHaloExchange()) {
+    MPI_Win_create_dynamic(MPI_INFO_NULL, MpiUtilities::Communicator(),
+                           &one_sided_window_);
+  }
+}
+
+/**
+ * @brief Default destructor. Releases all persistent requests and
+ * shared-memory as well as one-sided windows.
+ */
+CommunicationManager::~CommunicationManager() {
+  FreePersistentHaloRequests();
+  if (one_sided_window_ != MPI_WIN_NULL) {
+    MPI_Win_free(&one_sided_window_);
+  }
+  if (node_communicator_ != MPI_COMM_NULL) {
+    MPI_Comm_free(&node_communicator_);
+  }
 }
 
 /**
@@ -80,6 +137,12 @@ void IncrementJumpSendCounter(BoundaryLocation const loc,
  */
 void CommunicationManager::GenerateNeighborRelationForHaloUpdate(
     unsigned int const level) {
+  // Once materials change an interface might be present, which requires the
+  // edge and corner halos to be exchanged again
+  if (face_halos_only_[level] && face_halos_only_material_update_count_ !=
+                                     topology_.MaterialUpdateCount()) {
+    boundaries_valid_[level] = false;
+  }
   if (boundaries_valid_[level])
     return;
 
@@ -88,46 +151,76 @@ void CommunicationManager::GenerateNeighborRelationForHaloUpdate(
   internal_boundaries_mpi_[level].clear();
   internal_boundaries_jump_[level].clear();
   internal_boundaries_jump_mpi_[level].clear();
+  jump_halos_[level].clear();
   external_boundaries_[level].clear();
+  for (std::vector<nid_t> &group : external_boundary_groups_[level]) {
+    group.clear();
+  }
+  extended_boundaries_[level].clear();
   if (level == maximum_level_) {
     internal_multi_boundaries_.clear();
     internal_multi_boundaries_mpi_.clear();
     external_multi_boundaries_.clear();
+    for (std::vector<nid_t> &group : external_multi_boundary_groups_) {
+      group.clear();
+    }
   }
 
   // Declare temporary variables and reserve maximum possible space for vectors
   jump_send_count_[level] = {0, 0, 0};
-  std::vector<std::tuple<nid_t, BoundaryLocation>> tmp_neighbor_location_vector;
+  std::vector<std::tuple<TopologyNeighbor, BoundaryLocation>>
+      tmp_neighbor_location_vector;
   std::vector<std::tuple<nid_t, BoundaryLocation>>
       tmp_external_id_location_vector;
   tmp_neighbor_location_vector.reserve(26);
   tmp_external_id_location_vector.reserve(6);
+  std::vector<std::tuple<nid_t, BoundaryLocation>> tmp_extended_vector;
+  tmp_extended_vector.reserve(20);
+  // Nodes on coarser levels provide the predictions for their children, which
+  // requires all their halos
+  face_halos_only_[level] = CC::FaceHalosOnly() && level == maximum_level_ &&
+                            topology_.MultiPhaseNodeCount() == 0;
+  face_halos_only_material_update_count_ = topology_.MaterialUpdateCount();
   // Get List of Halos on this Level
   // All (globally existing) nodes are viewed by all ranks in order to have the
   // same order on all ranks, so that the tagging system works properly.
   for (auto const global_id : topology_.IdsOnLevel(level)) {
     NeighborsOfNode(global_id, tmp_neighbor_location_vector,
-                    tmp_external_id_location_vector);
+                    tmp_external_id_location_vector, tmp_extended_vector,
+                    face_halos_only_[level]);
     if (topology_.NodeIsOnRank(global_id, my_rank_id_)) {
+      extended_boundaries_[level].insert(extended_boundaries_[level].end(),
+                                         tmp_extended_vector.begin(),
+                                         tmp_extended_vector.end());
       external_boundaries_[level].insert(
           external_boundaries_[level].end(),
           tmp_external_id_location_vector.begin(),
           tmp_external_id_location_vector.end());
+      for (auto const &[id, location] : tmp_external_id_location_vector) {
+        external_boundary_groups_[level][LTI(location)].push_back(id);
+      }
       if (level == maximum_level_ && topology_.IsNodeMultiPhase(global_id)) {
         external_multi_boundaries_.insert(
             external_multi_boundaries_.end(),
             tmp_external_id_location_vector.begin(),
             tmp_external_id_location_vector.end());
+        for (auto const &[id, location] : tmp_external_id_location_vector) {
+          external_multi_boundary_groups_[LTI(location)].push_back(id);
+        }
       }
     }
     for (auto const &neighbor_id_location_element :
          tmp_neighbor_location_vector) {
       // sort boundary type into vector
-      if (!topology_.NodeExists(std::get<0>(neighbor_id_location_element))) {
+      TopologyNeighbor const &neighbor =
+          std::get<0>(neighbor_id_location_element);
+      if (neighbor.level_difference_ != 0) {
         // jump boundary
         auto const parent_id = ParentIdOfNode(global_id);
         if (topology_.NodeIsOnRank(global_id, my_rank_id_)) {
           // The node belongs to me -> I must Update it
+          jump_halos_[level].push_back(std::make_tuple(
+              global_id, std::get<1>(neighbor_id_location_element)));
           if (topology_.NodeIsOnRank(parent_id, my_rank_id_)) {
             // I have the child and the parent
             internal_boundaries_jump_[level].push_back(std::make_tuple(
@@ -150,8 +243,7 @@ void CommunicationManager::GenerateNeighborRelationForHaloUpdate(
       } else {
         // No Jump
         bool const my_node = topology_.NodeIsOnRank(global_id, my_rank_id_);
-        bool const my_neighbor = topology_.NodeIsOnRank(
-            std::get<0>(neighbor_id_location_element), my_rank_id_);
+        bool const my_neighbor = neighbor.rank_ == my_rank_id_;
         if (my_node) {
           if (my_neighbor) {
             internal_boundaries_[level].push_back(std::make_tuple(
@@ -165,14 +257,13 @@ void CommunicationManager::GenerateNeighborRelationForHaloUpdate(
         } else {
           if (my_neighbor) {
             internal_boundaries_mpi_[level].push_back(std::make_tuple(
-                std::get<0>(neighbor_id_location_element),
+                neighbor.id_,
                 OppositeDirection(std::get<1>(neighbor_id_location_element)),
                 InternalBoundaryType::NoJumpBoundaryMpiSend));
           }
         }
         if (level == maximum_level_ && topology_.IsNodeMultiPhase(global_id) &&
-            topology_.IsNodeMultiPhase(
-                std::get<0>(neighbor_id_location_element))) {
+            topology_.IsNodeMultiPhase(neighbor.id_)) {
           if (my_node) {
             if (my_neighbor) {
               internal_multi_boundaries_.push_back(std::make_tuple(
@@ -186,7 +277,7 @@ void CommunicationManager::GenerateNeighborRelationForHaloUpdate(
           } else {
             if (my_neighbor) {
               internal_multi_boundaries_mpi_.push_back(std::make_tuple(
-                  std::get<0>(neighbor_id_location_element),
+                  neighbor.id_,
                   OppositeDirection(std::get<1>(neighbor_id_location_element)),
                   InternalBoundaryType::NoJumpBoundaryMpiSend));
             }
@@ -196,6 +287,7 @@ void CommunicationManager::GenerateNeighborRelationForHaloUpdate(
     }
     tmp_neighbor_location_vector.clear();
     tmp_external_id_location_vector.clear();
+    tmp_extended_vector.clear();
   }
   boundaries_valid_[level] = true;
 }
@@ -219,6 +311,18 @@ constexpr std::array<nid_t, 6> bitsets_for_natural_boundary_locations = {
     0x1543310, // top
     0x2a80ce0, // bottom
 };
+
+/**
+ * @brief Gives the size of a message.
+ * @param count The number of elements of the message.
+ * @param datatype The MPI datatype of the elements.
+ * @return The size in bytes.
+ */
+long MessageSize(int const count, MPI_Datatype const datatype) {
+  int datatype_size = 0;
+  MPI_Type_size(datatype, &datatype_size);
+  return long(count) * long(datatype_size);
+}
 } // namespace
 
 /**
@@ -226,18 +330,25 @@ constexpr std::array<nid_t, 6> bitsets_for_natural_boundary_locations = {
  * Domain Boundaries are inserted only as natural (e,w,n,s,t,b), internals are
  * inserted per direction e.g diagonal wnb.
  * @param global_id global node's id.
- * @param nodes_internal_boundaries output array for internal boundaries, all
- * HaloBoundarySides are included that are not part of externals BC.
+ * @param nodes_internal_boundaries output array for the neighbors at internal
+ * boundaries, all HaloBoundarySides are included that are not part of
+ * externals BC.
  * @param external_boundaries all external boundaries are included as natural
  * Boundary Side e.g. east, west...
+ * @param extended_boundaries output array for the internal edge and corner
+ * halos that are not exchanged, only filled if face_halos_only is set.
+ * @param face_halos_only Decider whether only the face halos are exchanged.
  */
 void CommunicationManager::NeighborsOfNode(
     nid_t const global_id,
-    std::vector<std::tuple<nid_t, BoundaryLocation>> &nodes_internal_boundaries,
-    std::vector<std::tuple<nid_t, BoundaryLocation>> &external_boundaries) {
+    std::vector<std::tuple<TopologyNeighbor, BoundaryLocation>>
+        &nodes_internal_boundaries,
+    std::vector<std::tuple<nid_t, BoundaryLocation>> &external_boundaries,
+    std::vector<std::tuple<nid_t, BoundaryLocation>> &extended_boundaries,
+    bool const face_halos_only) {
   std::bitset<26> sides(0);
   for (BoundaryLocation loc : CC::ANBS()) {
-    if (topology_.IsExternalTopologyBoundary(loc, global_id)) {
+    if (topology_.NeighborOfNode(global_id, loc).is_external_) {
       sides |=
           std::bitset<26>(bitsets_for_natural_boundary_locations[LTI(loc)]);
       external_boundaries.push_back(std::make_tuple(global_id, loc));
@@ -245,10 +356,101 @@ void CommunicationManager::NeighborsOfNode(
   }
   for (BoundaryLocation loc : CC::HBS()) {
     if (!sides.test(LTI(loc))) {
-      nid_t neighbor_id = topology_.GetTopologyNeighborId(global_id, loc);
-      nodes_internal_boundaries.push_back(std::make_tuple(neighbor_id, loc));
+      // the natural locations occupy the first six bits
+      if (face_halos_only && LTI(loc) >= 6) {
+        extended_boundaries.push_back(std::make_tuple(global_id, loc));
+        continue;
+      }
+      nodes_internal_boundaries.push_back(
+          std::make_tuple(topology_.NeighborOfNode(global_id, loc), loc));
+    }
+  }
+}
+
+/**
+ * @brief Estimates the memory held by the caches of the communication manager,
+ * i.e. the boundary relations, the persistent requests and the aggregated halo
+ * messages including their buffers.
+ * @return The memory in bytes.
+ */
+std::size_t CommunicationManager::CacheBytes() const {
+  std::size_t bytes =
+      CapacityBytes(partner_tag_map_) + CapacityBytes(internal_boundaries_) +
+      CapacityBytes(internal_boundaries_mpi_) +
+      CapacityBytes(internal_multi_boundaries_) +
+      CapacityBytes(internal_multi_boundaries_mpi_) +
+      CapacityBytes(internal_boundaries_jump_) +
+      CapacityBytes(internal_boundaries_jump_mpi_) +
+      CapacityBytes(jump_halos_) + CapacityBytes(external_boundaries_) +
+      CapacityBytes(external_multi_boundaries_) +
+      CapacityBytes(external_boundary_groups_) +
+      CapacityBytes(extended_boundaries_) + CapacityBytes(jump_send_count_) +
+      CapacityBytes(persistent_halo_requests_) +
+      CapacityBytes(aggregated_halo_messages_);
+  for (auto const &groups : external_boundary_groups_) {
+    for (std::vector<nid_t> const &group : groups) {
+      bytes += CapacityBytes(group);
+    }
+  }
+  for (std::vector<nid_t> const &group : external_multi_boundary_groups_) {
+    bytes += CapacityBytes(group);
+  }
+  for (auto const &boundaries : extended_boundaries_) {
+    bytes += CapacityBytes(boundaries);
+  }
+  for (auto const &halos : jump_halos_) {
+    bytes += CapacityBytes(halos);
+  }
+  for (auto const &requests : persistent_halo_requests_) {
+    for (auto const &field_requests : requests) {
+      bytes += CapacityBytes(field_requests);
+    }
+  }
+  for (auto const &messages : aggregated_halo_messages_) {
+    for (AggregatedHaloMessages const &field_messages : messages) {
+      bytes += CapacityBytes(field_messages.partner_ranks_) +
+               CapacityBytes(field_messages.partner_index_of_rank_) +
+               CapacityBytes(field_messages.send_buffers_) +
+               CapacityBytes(field_messages.recv_buffers_) +
+               CapacityBytes(field_messages.send_data_) +
+               CapacityBytes(field_messages.recv_data_) +
+               CapacityBytes(field_messages.boundary_offsets_) +
+               CapacityBytes(field_messages.send_counts_) +
+               CapacityBytes(field_messages.recv_counts_) +
+               CapacityBytes(field_messages.remote_recv_addresses_) +
+               CapacityBytes(field_messages.requests_);
+    }
+  }
+  return bytes;
+}
+
+/**
+ * @brief Gives the bytes sent to each rank in a halo update of the
+ * conservatives on all levels, i.e. the weights of the halo graph of the ranks.
+ * Only the no-jump halos are counted, as they dominate the volume.
+ * @return The bytes per partner rank ( index: rank ).
+ */
+std::vector<long> CommunicationManager::HaloBytesOfPartners() {
+  std::vector<long> bytes(MpiUtilities::NumberOfRanks(), 0);
+  for (unsigned int level = 0; level <= maximum_level_; ++level) {
+    GenerateNeighborRelationForHaloUpdate(level);
+    for (auto const &[id, location, type] : internal_boundaries_mpi_[level]) {
+      if (type != InternalBoundaryType::NoJumpBoundaryMpiSend) {
+        continue;
+      }
+      TopologyNeighbor const neighbor = topology_.NeighborOfNode(id, location);
+      auto const size = GetHaloSize(location);
+      long materials = 0;
+      for (MaterialName const material : topology_.GetMaterialsOfNode(id)) {
+        if (topology_.NodeContainsMaterial(neighbor.id_, material)) {
+          ++materials;
+        }
+      }
+      bytes[neighbor.rank_] += long(size[0]) * size[1] * size[2] * materials *
+                               MF::ANOE() * long(sizeof(double));
     }
   }
+  return bytes;
 }
 
 /**
@@ -259,6 +461,294 @@ void CommunicationManager::InvalidateCache() {
   for (unsigned i = 0; i < boundaries_valid_.size(); i++) {
     boundaries_valid_[i] = false;
   }
+  FreePersistentHaloRequests();
+}
+
+/**
+ * @brief Releases all persistent halo requests as well as the buffers of
+ * aggregated halo updates and marks them invalid.
+ * @note Must not be called while any of the requests is active.
+ */
+void CommunicationManager::FreePersistentHaloRequests() {
+  for (unsigned int level = 0; level < persistent_halo_requests_.size();
+       ++level) {
+    for (unsigned int field = 0;
+         field < persistent_halo_requests_[level].size(); ++field) {
+      for (MPI_Request &request : persistent_halo_requests_[level][field]) {
+        if (request != MPI_REQUEST_NULL) {
+          MPI_Request_free(&request);
+        }
+      }
+      persistent_halo_requests_[level][field].clear();
+      persistent_halo_requests_valid_[level][field] = false;
+
+      AggregatedHaloMessages &messages =
+          aggregated_halo_messages_[level][field];
+      for (MPI_Request &request : messages.requests_) {
+        if (request != MPI_REQUEST_NULL) {
+          MPI_Request_free(&request);
+        }
+      }
+      FreeSharedHaloWindow(messages);
+      DetachOneSidedHaloBuffers(messages);
+      messages = AggregatedHaloMessages();
+    }
+  }
+  persistent_messages_.clear();
+}
+
+/**
+ * @brief Releases the shared-memory window of an aggregated halo update.
+ * @param messages The buffers of the aggregated halo update.
+ * @note Collective on the node communicator, all ranks of a compute node hold
+ * a window for the same aggregated updates.
+ */
+void CommunicationManager::FreeSharedHaloWindow(
+    AggregatedHaloMessages &messages) const {
+  if (messages.shared_window_ != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(messages.shared_window_);
+    MPI_Win_free(&messages.shared_window_);
+  }
+}
+
+/**
+ * @brief Detaches the receive buffers of an aggregated halo update from the
+ * one-sided window and releases the groups of its partners. Local call.
+ * @param messages The buffers of the aggregated halo update.
+ */
+void CommunicationManager::DetachOneSidedHaloBuffers(
+    AggregatedHaloMessages &messages) const {
+  if (messages.attached_) {
+    for (std::size_t partner = 0; partner < messages.partner_ranks_.size();
+         ++partner) {
+      std::vector<double> &buffer = messages.recv_buffers_[partner];
+      if (NodeRankOfRank(messages.partner_ranks_[partner]) < 0 &&
+          !buffer.empty()) {
+        MPI_Win_detach(one_sided_window_, buffer.data());
+      }
+    }
+    messages.attached_ = false;
+  }
+  for (MPI_Group *group :
+       {&messages.exposure_group_, &messages.access_group_}) {
+    if (*group != MPI_GROUP_NULL && *group != MPI_GROUP_EMPTY) {
+      MPI_Group_free(group);
+    }
+    *group = MPI_GROUP_NULL;
+  }
+}
+
+/**
+ * @brief Releases all persistent halo requests if materials of nodes have
+ * changed since their creation as the requests are bound to the blocks of the
+ * nodes.
+ */
+void CommunicationManager::FreeOutdatedHaloRequests() {
+  if (persistent_halo_requests_material_update_count_ !=
+      topology_.MaterialUpdateCount()) {
+    FreePersistentHaloRequests();
+    persistent_halo_requests_material_update_count_ =
+        topology_.MaterialUpdateCount();
+  }
+}
+
+/**
+ * @brief Gives the buffers of the aggregated no-jump MPI halo update. They are
+ * outdated and emptied (valid_ is false) if the topology or materials of nodes
+ * have changed since their setup.
+ * @param level The level of the halo update.
+ * @param field_type The material field type of the halo update.
+ * @return The buffers.
+ */
+AggregatedHaloMessages &CommunicationManager::AggregatedHaloMessagesOnLevel(
+    unsigned int const level, MaterialFieldType const field_type) {
+  FreeOutdatedHaloRequests();
+  AggregatedHaloMessages &messages =
+      aggregated_halo_messages_[level][static_cast<unsigned int>(field_type)];
+  messages.valid_ = messages.valid_ && boundaries_valid_[level];
+  return messages;
+}
+
+/**
+ * @brief Gives whether the persistent requests of the no-jump MPI halo update
+ * can be reused on the given level. All requests are released if materials of
+ * nodes have changed since their creation.
+ * @param level The level of the halo update.
+ * @param field_type The material field type of the halo update.
+ * @return True if the requests can be started directly, false if they have to
+ * be (re-)created.
+ */
+bool CommunicationManager::ArePersistentHaloRequestsValid(
+    unsigned int const level, MaterialFieldType const field_type) {
+  FreeOutdatedHaloRequests();
+  return boundaries_valid_[level] &&
+         persistent_halo_requests_valid_[level]
+                                        [static_cast<unsigned int>(field_type)];
+}
+
+/**
+ * @brief Gives the container of the persistent requests for the no-jump MPI
+ * halo update.
+ * @param level The level of the halo update.
+ * @param field_type The material field type of the halo update.
+ * @return The persistent requests.
+ */
+std::vector<MPI_Request> &CommunicationManager::PersistentHaloRequests(
+    unsigned int const level, MaterialFieldType const field_type) {
+  return persistent_halo_requests_[level]
+                                  [static_cast<unsigned int>(field_type)];
+}
+
+/**
+ * @brief Marks the persistent requests for the no-jump MPI halo update as
+ * completely created.
+ * @param level The level of the halo update.
+ * @param field_type The material field type of the halo update.
+ */
+void CommunicationManager::ValidatePersistentHaloRequests(
+    unsigned int const level, MaterialFieldType const field_type) {
+  persistent_halo_requests_valid_[level]
+                                 [static_cast<unsigned int>(field_type)] = true;
+}
+
+/**
+ * @brief Creates a persistent send request. All persistent messages use the
+ * same tag, matching relies on the identical order of all ranks.
+ * @param buffer The data to be sent.
+ * @param count The number of elements to be sent.
+ * @param datatype The MPI datatype of the elements.
+ * @param destination_rank The rank receiving the data.
+ * @param requests Container the (inactive) request is appended to.
+ * @return MPI status.
+ */
+int CommunicationManager::SendInit(void const *buffer, int const count,
+                                   MPI_Datatype const datatype,
+                                   int const destination_rank,
+                                   std::vector<MPI_Request> &requests) {
+  CommunicationStatistics &statistics = CommunicationStatistics::Instance();
+  if (statistics.recording_) {
+    persistent_messages_[&requests].emplace_back(
+        statistics.category_, destination_rank, MessageSize(count, datatype),
+        true);
+  }
+  requests.push_back(MPI_Request());
+  int const status =
+      MPI_Send_init(buffer, count, datatype, destination_rank, persistent_tag_,
+                    MpiUtilities::Communicator(), &requests.back());
+#ifndef PERFORMANCE
+  if (status != MPI_SUCCESS) {
+    throw std::logic_error("Send init error");
+  }
+#endif
+  return status;
+}
+
+/**
+ * @brief Creates a persistent receive request. See SendInit.
+ * @param buffer The memory the data is received in.
+ * @param count The number of elements to be received.
+ * @param datatype The MPI datatype of the elements.
+ * @param source_rank The rank sending the data.
+ * @param requests Container the (inactive) request is appended to.
+ * @return MPI status.
+ */
+int CommunicationManager::RecvInit(void *buffer, int const count,
+                                   MPI_Datatype const datatype,
+                                   int const source_rank,
+                                   std::vector<MPI_Request> &requests) {
+  CommunicationStatistics &statistics = CommunicationStatistics::Instance();
+  if (statistics.recording_) {
+    persistent_messages_[&requests].emplace_back(
+        statistics.category_, source_rank, MessageSize(count, datatype), false);
+  }
+  requests.push_back(MPI_Request());
+  int const status =
+      MPI_Recv_init(buffer, count, datatype, source_rank, persistent_tag_,
+                    MpiUtilities::Communicator(), &requests.back());
+#ifndef PERFORMANCE
+  if (status != MPI_SUCCESS) {
+    throw std::logic_error("Receive init error");
+  }
+#endif
+  return status;
+}
+
+/**
+ * @brief Starts all (inactive) persistent requests of a container, see
+ * SendInit and RecvInit.
+ * @param requests The persistent requests.
+ */
+void CommunicationManager::StartPersistent(
+    std::vector<MPI_Request> &requests) const {
+  CommunicationStatistics &statistics = CommunicationStatistics::Instance();
+  if (statistics.recording_) {
+    auto const messages = persistent_messages_.find(&requests);
+    if (messages != persistent_messages_.end()) {
+      for (auto const &[category, partner_rank, bytes, send] :
+           messages->second) {
+        statistics.RecordMessage(category, partner_rank, bytes, send);
+      }
+    }
+  }
+  // Some MPI implementations reject an empty request array, e.g. if all
+  // partners exchange through shared memory
+  if (!requests.empty()) {
+    MPI_Startall(requests.size(), requests.data());
+  }
+}
+
+/**
+ * @brief Waits for the completion of all requests of a container. The waiting
+ * time is measured by the runtime profiler and, if communication statistics
+ * are recorded, added to the current communication category.
+ * @param requests The requests to be completed.
+ */
+void CommunicationManager::WaitAll(std::vector<MPI_Request> &requests) const {
+  ProfileRegion const region("MPI_Waitall");
+  CommunicationStatistics &statistics = CommunicationStatistics::Instance();
+  if (statistics.recording_) {
+    double const start_time = MPI_Wtime();
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    statistics.RecordWait(MPI_Wtime() - start_time);
+  } else {
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+  }
+}
+
+/**
+ * @brief Tests for the completion of all requests of a container without
+ * blocking.
+ * @param requests The requests to be tested. Completed one-off requests are set
+ * to MPI_REQUEST_NULL, completed persistent ones become inactive.
+ * @return True if all requests are completed.
+ */
+bool CommunicationManager::TestAll(std::vector<MPI_Request> &requests) const {
+  int completed = 0;
+  MPI_Testall(requests.size(), requests.data(), &completed,
+              MPI_STATUSES_IGNORE);
+  return completed != 0;
+}
+
+/**
+ * @brief Waits for the completion of any request of a container. The waiting
+ * time is measured as in WaitAll.
+ * @param requests The requests of which one is to be completed. The completed
+ * request is set to MPI_REQUEST_NULL.
+ * @return The index of the completed request, MPI_UNDEFINED if all requests
+ * are already completed.
+ */
+int CommunicationManager::WaitAny(std::vector<MPI_Request> &requests) const {
+  ProfileRegion const region("MPI_Waitany");
+  int index = MPI_UNDEFINED;
+  CommunicationStatistics &statistics = CommunicationStatistics::Instance();
+  if (statistics.recording_) {
+    double const start_time = MPI_Wtime();
+    MPI_Waitany(requests.size(), requests.data(), &index, MPI_STATUS_IGNORE);
+    statistics.RecordWait(MPI_Wtime() - start_time);
+  } else {
+    MPI_Waitany(requests.size(), requests.data(), &index, MPI_STATUS_IGNORE);
+  }
+  return index;
 }
 
 /**
@@ -276,10 +766,15 @@ int CommunicationManager::Send(void const *buffer, int const count,
                                MPI_Datatype const datatype,
                                int const destination_rank,
                                std::vector<MPI_Request> &requests) {
+  CommunicationStatistics &statistics = CommunicationStatistics::Instance();
+  if (statistics.recording_) {
+    statistics.RecordMessage(statistics.category_, destination_rank,
+                             MessageSize(count, datatype), true);
+  }
   int const tag = TagForRank(destination_rank);
   requests.push_back(MPI_Request());
   int const status = MPI_Isend(buffer, count, datatype, destination_rank, tag,
-                               MPI_COMM_WORLD, &requests.back());
+                               MpiUtilities::Communicator(), &requests.back());
 #ifndef PERFORMANCE
   if (status != MPI_SUCCESS) {
     throw std::logic_error("Send error");
@@ -303,10 +798,15 @@ int CommunicationManager::Recv(void *buffer, int const count,
                                MPI_Datatype const datatype,
                                int const source_rank,
                                std::vector<MPI_Request> &requests) {
+  CommunicationStatistics &statistics = CommunicationStatistics::Instance();
+  if (statistics.recording_) {
+    statistics.RecordMessage(statistics.category_, source_rank,
+                             MessageSize(count, datatype), false);
+  }
   int const tag = TagForRank(source_rank);
   requests.push_back(MPI_Request());
   int const status = MPI_Irecv(buffer, count, datatype, source_rank, tag,
-                               MPI_COMM_WORLD, &requests.back());
+                               MpiUtilities::Communicator(), &requests.back());
 #ifndef PERFORMANCE
   if (status != MPI_SUCCESS) {
     throw std::logic_error("Receive error");
@@ -358,6 +858,18 @@ CommunicationManager::InternalBoundariesJump(unsigned int const level) const {
   return internal_boundaries_jump_[level];
 }
 
+/**
+ * @brief Gives a reference to the list for a given level holding all jump
+ * faces of nodes on this rank, i.e. the halos that are filled by prediction
+ * from the parent.
+ * @param level Level for which the list should be returned.
+ * @return List of node ids and locations of all local jump halos.
+ */
+std::vector<std::tuple<nid_t, BoundaryLocation>> const &
+CommunicationManager::JumpHalos(unsigned int const level) const {
+  return jump_halos_[level];
+}
+
 /**
  * @brief Gives a reference to the list for a given level holding all internal
  * non-jump boundary relations that require mpi communication.
@@ -422,6 +934,40 @@ CommunicationManager::ExternalMultiBoundaries() const {
   return external_multi_boundaries_;
 }
 
+/**
+ * @brief Gives the nodes with external boundaries on a given level grouped by
+ * the location of the boundary.
+ * @param level Level for which the groups should be returned.
+ * @return Ids of the external boundary nodes per location.
+ */
+ExternalBoundaryGroups const &
+CommunicationManager::ExternalBoundaryGroupsOnLevel(
+    unsigned int const level) const {
+  return external_boundary_groups_[level];
+}
+
+/**
+ * @brief Gives the multi-material nodes with external boundaries on the maximum
+ * level grouped by the location of the boundary.
+ * @return Ids of the external boundary nodes per location.
+ */
+ExternalBoundaryGroups const &
+CommunicationManager::ExternalMultiBoundaryGroups() const {
+  return external_multi_boundary_groups_;
+}
+
+/**
+ * @brief Gives the edge and corner halos of the local nodes on the given level
+ * that are not exchanged but filled with the closest internal value.
+ * @param level Level for which the list should be returned.
+ * @return List of node ids and halo locations, empty unless only the face halos
+ * are exchanged on the level.
+ */
+std::vector<std::tuple<nid_t, BoundaryLocation>> const &
+CommunicationManager::ExtendedBoundaries(unsigned int const level) const {
+  return extended_boundaries_[level];
+}
+
 /**
  * @brief Gives a reference to the list for a given level holding all internal
  * jump boundary relations that require mpi communication.
@@ -22,14 +22,66 @@
 #ifndef COMMUNICATION_MANAGER_H
 #define COMMUNICATION_MANAGER_H
 
+#include "communication/communication_statistics.h"
 #include "communication/communication_types.h"
 #include "communication/exchange_types.h"
+#include "enums/halo_exchange.h"
 #include "internal_boundary_types.h"
 #include "topology/topology_manager.h"
 #include "topology/tree.h"
+#include <array>
 #include <numeric>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
+/**
+ * @brief Contiguous per-partner-rank buffers of an aggregated halo update. All
+ * no-jump halo data exchanged with one partner rank on a level is packed into a
+ * single message per direction.
+ */
+struct AggregatedHaloMessages {
+  bool valid_ = false;
+  std::vector<int> partner_ranks_;
+  // index into partner_ranks_ for every rank, -1 if the rank is no partner
+  std::vector<int> partner_index_of_rank_;
+  std::vector<std::vector<double>> send_buffers_;
+  std::vector<std::vector<double>> recv_buffers_;
+  // start of the data sent to and received from each partner, either in the
+  // buffers above or, for partners on the same compute node, in the
+  // shared-memory window of the sender
+  std::vector<double *> send_data_;
+  std::vector<double const *> recv_data_;
+  // window holding the data sent to partners on the same compute node, only
+  // used with shared-memory halo exchange
+  MPI_Win shared_window_ = MPI_WIN_NULL;
+  // address of the receive buffer of this rank in the one-sided window of each
+  // partner, only used with one-sided halo exchange
+  std::vector<MPI_Aint> remote_recv_addresses_;
+  // partners putting into the receive buffers of this rank and partners this
+  // rank puts into, only used with one-sided halo exchange
+  MPI_Group exposure_group_ = MPI_GROUP_NULL;
+  MPI_Group access_group_ = MPI_GROUP_NULL;
+  // flag whether the receive buffers are attached to the one-sided window
+  bool attached_ = false;
+  // offset of each boundary (in the order of the MPI boundaries of the level)
+  // in the send or receive buffer of its partner, per halo depth (index
+  // depth - 1). The buffers are sized for the full depth, reduced depths only
+  // use their beginning
+  std::vector<std::vector<std::size_t>> boundary_offsets_;
+  // number of values sent to and received from each partner per halo depth
+  std::vector<std::vector<std::size_t>> send_counts_;
+  std::vector<std::vector<std::size_t>> recv_counts_;
+  // persistent requests (receives first), only used with persistent requests
+  std::vector<MPI_Request> requests_;
+};
+
+/**
+ * @brief Ids of the nodes with an external boundary, grouped by the location of
+ * the boundary (index via LTI). Nodes of a group share the boundary condition.
+ */
+using ExternalBoundaryGroups = std::array<std::vector<nid_t>, 6>;
+
 /**
  * @brief The CommunicationManager class provides the functionality for
  * communicating data between nodes and ranks. Furthermore, it holds the
@@ -41,6 +93,11 @@ class CommunicationManager : public CommunicationTypes {
   unsigned int const maximum_level_;
   int const my_rank_id_;
   int const mpi_tag_ub_;
+  // ranks on the same compute node as this one, only created with shared-memory
+  // halo exchange
+  MPI_Comm node_communicator_;
+  // rank in the node communicator of each rank, -1 if on another node
+  std::vector<int> node_rank_of_rank_;
   std::vector<unsigned int> partner_tag_map_;
 
   /**
@@ -71,9 +128,24 @@ class CommunicationManager : public CommunicationTypes {
   std::vector<
       std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>>>
       internal_boundaries_jump_mpi_;
+  // jump faces of local nodes, i.e. the local and mpi receiving jump boundaries
+  // above without their type
+  std::vector<std::vector<std::tuple<nid_t, BoundaryLocation>>> jump_halos_;
   std::vector<std::vector<std::tuple<nid_t, BoundaryLocation>>>
       external_boundaries_;
   std::vector<std::tuple<nid_t, BoundaryLocation>> external_multi_boundaries_;
+  // the external boundaries above grouped by their location
+  std::vector<ExternalBoundaryGroups> external_boundary_groups_;
+  ExternalBoundaryGroups external_multi_boundary_groups_;
+  // edge and corner halos of local nodes that are filled with the closest
+  // internal value instead of being exchanged (see CC::FaceHalosOnly())
+  std::vector<std::vector<std::tuple<nid_t, BoundaryLocation>>>
+      extended_boundaries_;
+  // flags for each level whether only face halos are exchanged and the
+  // material update count at creation, as this only holds as long as no
+  // interface is present
+  std::vector<bool> face_halos_only_;
+  unsigned int face_halos_only_material_update_count_;
 
   // Vector holding flags dor each level that the lists have been created
   // successfully
@@ -83,19 +155,46 @@ class CommunicationManager : public CommunicationTypes {
   std::vector<std::array<unsigned int, 3>>
       jump_send_count_; // [0]: Plane, [1]: Stick, [2]: cube
 
+  // Persistent requests of the no-jump MPI halo updates per level and material
+  // field type. They are valid together with the relation cache and as long as
+  // no materials are added to or removed from nodes
+  std::vector<std::array<std::vector<MPI_Request>, 3>>
+      persistent_halo_requests_;
+  std::vector<std::array<bool, 3>> persistent_halo_requests_valid_;
+  std::vector<std::array<AggregatedHaloMessages, 3>> aggregated_halo_messages_;
+  unsigned int persistent_halo_requests_material_update_count_;
+  // Tag of all persistent messages, outside the range of TagForRank
+  int const persistent_tag_;
+  // protocol of the aggregated halo exchange and the dynamic window the
+  // receive buffers are attached to with the one-sided protocol
+  HaloExchange const halo_exchange_;
+  MPI_Win one_sided_window_;
+  // Messages of the persistent requests per request container (category,
+  // partner rank, bytes, send), only recorded with communication statistics
+  std::unordered_map<
+      std::vector<MPI_Request> const *,
+      std::vector<std::tuple<CommunicationCategory, int, long, bool>>>
+      persistent_messages_;
+
+  void FreePersistentHaloRequests();
+  void FreeOutdatedHaloRequests();
+
   // Function that gives all neighbor-location and external-location relations
   // for a given global node
   void NeighborsOfNode(
       nid_t const global_id,
-      std::vector<std::tuple<nid_t, BoundaryLocation>>
+      std::vector<std::tuple<TopologyNeighbor, BoundaryLocation>>
           &nodes_internal_boundaries,
-      std::vector<std::tuple<nid_t, BoundaryLocation>> &external_boundaries);
+      std::vector<std::tuple<nid_t, BoundaryLocation>> &external_boundaries,
+      std::vector<std::tuple<nid_t, BoundaryLocation>> &extended_boundaries,
+      bool const face_halos_only);
 
 public:
   CommunicationManager() = delete;
-  explicit CommunicationManager(TopologyManager &topology,
-                                unsigned int const maximum_level);
-  ~CommunicationManager() = default;
+  explicit CommunicationManager(
+      TopologyManager &topology, unsigned int const maximum_level,
+      HaloExchange const halo_exchange = HaloExchange::TwoSided);
+  ~CommunicationManager();
   CommunicationManager(CommunicationManager const &) = delete;
   CommunicationManager &operator=(CommunicationManager const &) = delete;
   CommunicationManager(CommunicationManager &&) = delete;
@@ -110,6 +209,8 @@ public:
   InternalBoundariesJumpMpi(unsigned level) const;
   std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const &
   InternalBoundariesJump(unsigned level) const;
+  std::vector<std::tuple<nid_t, BoundaryLocation>> const &
+  JumpHalos(unsigned int const level) const;
   std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const &
   InternalBoundariesMpi(unsigned level) const;
   std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const &
@@ -122,11 +223,20 @@ public:
   ExternalBoundaries(unsigned level) const;
   std::vector<std::tuple<nid_t, BoundaryLocation>> const &
   ExternalMultiBoundaries() const;
+  ExternalBoundaryGroups const &
+  ExternalBoundaryGroupsOnLevel(unsigned int const level) const;
+  ExternalBoundaryGroups const &ExternalMultiBoundaryGroups() const;
+  std::vector<std::tuple<nid_t, BoundaryLocation>> const &
+  ExtendedBoundaries(unsigned int const level) const;
 
   // Functions to get the status of the list creations and to empty the flags to
   // regenerate the lists
   bool AreBoundariesValid(unsigned level) const;
   void InvalidateCache();
+  void FreeSharedHaloWindow(AggregatedHaloMessages &messages) const;
+  void DetachOneSidedHaloBuffers(AggregatedHaloMessages &messages) const;
+  std::size_t CacheBytes() const;
+  std::vector<long> HaloBytesOfPartners();
 
   // Returns the counter for jump boundaries for the different exchange types
   unsigned int JumpSendCount(unsigned int const level, ExchangeType const type);
@@ -137,11 +247,43 @@ public:
   int Recv(void *buf, int count, MPI_Datatype datatype, int source,
            std::vector<MPI_Request> &requests);
 
+  // Setup and access of the persistent requests for no-jump halo updates
+  int SendInit(void const *buffer, int const count, MPI_Datatype const datatype,
+               int const destination_rank, std::vector<MPI_Request> &requests);
+  int RecvInit(void *buffer, int const count, MPI_Datatype const datatype,
+               int const source_rank, std::vector<MPI_Request> &requests);
+  void StartPersistent(std::vector<MPI_Request> &requests) const;
+  void WaitAll(std::vector<MPI_Request> &requests) const;
+  bool TestAll(std::vector<MPI_Request> &requests) const;
+  int WaitAny(std::vector<MPI_Request> &requests) const;
+  bool ArePersistentHaloRequestsValid(unsigned int const level,
+                                      MaterialFieldType const field_type);
+  std::vector<MPI_Request> &
+  PersistentHaloRequests(unsigned int const level,
+                         MaterialFieldType const field_type);
+  void ValidatePersistentHaloRequests(unsigned int const level,
+                                      MaterialFieldType const field_type);
+  AggregatedHaloMessages &
+  AggregatedHaloMessagesOnLevel(unsigned int const level,
+                                MaterialFieldType const field_type);
+
   // Helping functions to provide current rank and partner tags (MyRankId as
   // member variable to avoid multiple calls of Mpi library)
   int TagForRank(unsigned int const partner);
   void ResetTagsForPartner();
   inline int MyRankId() { return my_rank_id_; }
+
+  // Ranks on the same compute node (only with shared-memory halo exchange)
+  inline MPI_Comm NodeCommunicator() const { return node_communicator_; }
+  inline int NodeRankOfRank(int const rank) const {
+    return node_rank_of_rank_.empty() ? -1 : node_rank_of_rank_[rank];
+  }
+
+  // Window of the one-sided halo exchange ( MPI_WIN_NULL with two-sided )
+  inline bool OneSidedHaloExchange() const {
+    return halo_exchange_ == HaloExchange::OneSided;
+  }
+  inline MPI_Win OneSidedWindow() const { return one_sided_window_; }
 };
 
 #endif /* COMMUNICATION_MANAGER_H */
@@ -21,16 +21,77 @@
 //===----------------------------------------------------------------------===//
 #include "communication_statistics.h"
 #include "mpi_utilities.h"
+#include "simulation_context.h"
+#include "user_specifications/debug_and_profile_setup.h"
+#include "utilities/string_operations.h"
 #include <mpi.h>
+#include <numeric>
 
-long CommunicationStatistics::no_jump_halos_recv_ = 0;
-long CommunicationStatistics::no_jump_halos_send_ = 0;
-long CommunicationStatistics::jump_halos_recv_ = 0;
-long CommunicationStatistics::jump_halos_send_ = 0;
-long CommunicationStatistics::balance_send_ = 0;
-long CommunicationStatistics::balance_recv_ = 0;
-long CommunicationStatistics::average_level_send_ = 0;
-long CommunicationStatistics::average_level_recv_ = 0;
+/**
+ * @brief Gives the name of a communication category.
+ * @param category The communication category.
+ * @return The name of the category.
+ */
+std::string
+CommunicationCategoryToString(CommunicationCategory const category) {
+  switch (category) {
+  case CommunicationCategory::Halo:
+    return "Halo";
+  case CommunicationCategory::JumpHalo:
+    return "JumpHalo";
+  case CommunicationCategory::InterfaceHalo:
+    return "InterfaceHalo";
+  case CommunicationCategory::Balance:
+    return "Balance";
+  case CommunicationCategory::Average:
+    return "Average";
+  default:
+    return "Other";
+  }
+}
+
+/**
+ * @brief Gives the communication statistics of the current simulation context
+ * (see SimulationContext::Current()).
+ * @return The statistics instance.
+ */
+CommunicationStatistics &CommunicationStatistics::Instance() {
+  return SimulationContext::Current().Statistics();
+}
+
+/**
+ * @brief Records a message exchanged with another rank.
+ * @param category The category of the message.
+ * @param partner_rank The rank the message is sent to or received from.
+ * @param bytes Size of the message in bytes.
+ * @param send Flag whether the message is sent (true) or received (false).
+ */
+void CommunicationStatistics::RecordMessage(
+    CommunicationCategory const category, int const partner_rank,
+    long const bytes, bool const send) {
+  unsigned int const index = static_cast<unsigned int>(category);
+  std::vector<long> &partner_bytes =
+      send ? bytes_send_[index] : bytes_recv_[index];
+  if (partner_bytes.empty()) {
+    partner_bytes.assign(MpiUtilities::NumberOfRanks(), 0);
+  }
+  partner_bytes[partner_rank] += bytes;
+  if (send) {
+    if (messages_send_[index].empty()) {
+      messages_send_[index].assign(MpiUtilities::NumberOfRanks(), 0);
+    }
+    messages_send_[index][partner_rank]++;
+  }
+}
+
+/**
+ * @brief Records the time spent waiting for the completion of messages of the
+ * current category.
+ * @param time The waiting time in seconds.
+ */
+void CommunicationStatistics::RecordWait(double const time) {
+  wait_time_[static_cast<unsigned int>(category_)] += time;
+}
 
 /**
  * @brief Sums the MPI statistic over all MPI ranks and gives a string
@@ -38,6 +99,7 @@ long CommunicationStatistics::average_level_recv_ = 0;
  * @return .
  */
 std::string SummedCommunicationStatisticsString() {
+  CommunicationStatistics const &counters = CommunicationStatistics::Instance();
 
   // Logging Stats
   std::string statistics;
@@ -45,44 +107,144 @@ std::string SummedCommunicationStatisticsString() {
                     " | ");
 
   long global_statistic;
-  MPI_Allreduce(&CommunicationStatistics::balance_send_, &global_statistic, 1,
-                MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&counters.balance_send_, &global_statistic, 1, MPI_LONG,
+                MPI_SUM, MpiUtilities::Communicator());
   statistics.append(" Balance Send: " + std::to_string(global_statistic) +
                     " | ");
 
-  MPI_Allreduce(&CommunicationStatistics::balance_recv_, &global_statistic, 1,
-                MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&counters.balance_recv_, &global_statistic, 1, MPI_LONG,
+                MPI_SUM, MpiUtilities::Communicator());
   statistics.append(" Balance Recv: " + std::to_string(global_statistic) +
                     " | ");
 
-  MPI_Allreduce(&CommunicationStatistics::no_jump_halos_send_,
-                &global_statistic, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&counters.no_jump_halos_send_, &global_statistic, 1, MPI_LONG,
+                MPI_SUM, MpiUtilities::Communicator());
   statistics.append(" No Jump Halos Send: " + std::to_string(global_statistic) +
                     " | ");
 
-  MPI_Allreduce(&CommunicationStatistics::no_jump_halos_recv_,
-                &global_statistic, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&counters.no_jump_halos_recv_, &global_statistic, 1, MPI_LONG,
+                MPI_SUM, MpiUtilities::Communicator());
   statistics.append(" No Jump Halos Recv: " + std::to_string(global_statistic) +
                     " | ");
 
-  MPI_Allreduce(&CommunicationStatistics::jump_halos_send_, &global_statistic,
-                1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&counters.jump_halos_send_, &global_statistic, 1, MPI_LONG,
+                MPI_SUM, MpiUtilities::Communicator());
   statistics.append(" Jump Halos Send: " + std::to_string(global_statistic) +
                     " | ");
 
-  MPI_Allreduce(&CommunicationStatistics::jump_halos_recv_, &global_statistic,
-                1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&counters.jump_halos_recv_, &global_statistic, 1, MPI_LONG,
+                MPI_SUM, MpiUtilities::Communicator());
   statistics.append(" Jump Halos Recv: " + std::to_string(global_statistic) +
                     " | ");
 
-  MPI_Allreduce(&CommunicationStatistics::average_level_send_,
-                &global_statistic, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&counters.average_level_send_, &global_statistic, 1, MPI_LONG,
+                MPI_SUM, MpiUtilities::Communicator());
   statistics.append(" Proj.lvl-send: " + std::to_string(global_statistic) +
                     " | ");
 
-  MPI_Allreduce(&CommunicationStatistics::average_level_recv_,
-                &global_statistic, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&counters.average_level_recv_, &global_statistic, 1, MPI_LONG,
+                MPI_SUM, MpiUtilities::Communicator());
   statistics.append(" Proj.lvl-recv: " + std::to_string(global_statistic) +
                     " | ");
   return statistics;
 }
+
+/**
+ * @brief Gives the exchanged volume and the waiting time of each communication
+ * category. The volume is summed over all ranks, the waiting time is given as
+ * minimum, mean and maximum over all ranks. Must be called by all ranks.
+ * @return One line per category (only valid on rank 0).
+ */
+std::vector<std::string> CommunicationVolumeStatistics() {
+  CommunicationStatistics const &counters = CommunicationStatistics::Instance();
+  int const number_of_ranks = MpiUtilities::NumberOfRanks();
+  std::array<double, 2 * number_of_communication_categories_> local_volume;
+  for (unsigned int index = 0; index < number_of_communication_categories_;
+       ++index) {
+    std::vector<long> const &bytes = counters.bytes_send_[index];
+    std::vector<long> const &messages = counters.messages_send_[index];
+    local_volume[2 * index] =
+        double(std::accumulate(bytes.begin(), bytes.end(), 0L));
+    local_volume[2 * index + 1] =
+        double(std::accumulate(messages.begin(), messages.end(), 0L));
+  }
+  std::array<double, 2 * number_of_communication_categories_> global_volume;
+  std::array<double, number_of_communication_categories_> minimum_wait;
+  std::array<double, number_of_communication_categories_> maximum_wait;
+  std::array<double, number_of_communication_categories_> summed_wait;
+  MPI_Reduce(local_volume.data(), global_volume.data(), local_volume.size(),
+             MPI_DOUBLE, MPI_SUM, 0, MpiUtilities::Communicator());
+  MPI_Reduce(counters.wait_time_.data(), minimum_wait.data(),
+             number_of_communication_categories_, MPI_DOUBLE, MPI_MIN, 0,
+             MpiUtilities::Communicator());
+  MPI_Reduce(counters.wait_time_.data(), maximum_wait.data(),
+             number_of_communication_categories_, MPI_DOUBLE, MPI_MAX, 0,
+             MpiUtilities::Communicator());
+  MPI_Reduce(counters.wait_time_.data(), summed_wait.data(),
+             number_of_communication_categories_, MPI_DOUBLE, MPI_SUM, 0,
+             MpiUtilities::Communicator());
+
+  std::vector<std::string> lines;
+  if (!MpiUtilities::MasterRank()) {
+    return lines;
+  }
+  for (unsigned int index = 0; index < number_of_communication_categories_;
+       ++index) {
+    lines.push_back(
+        CommunicationCategoryToString(CommunicationCategory(index)) +
+        " | Messages: " +
+        StringOperations::ToScientificNotationString(
+            global_volume[2 * index + 1], 3) +
+        " | Bytes: " +
+        StringOperations::ToScientificNotationString(global_volume[2 * index],
+                                                     3) +
+        " | Wait min/mean/max [s]: " +
+        StringOperations::ToScientificNotationString(minimum_wait[index], 3) +
+        " / " +
+        StringOperations::ToScientificNotationString(
+            summed_wait[index] / double(number_of_ranks), 3) +
+        " / " +
+        StringOperations::ToScientificNotationString(maximum_wait[index], 3));
+  }
+  return lines;
+}
+
+/**
+ * @brief Gives the rank x rank matrix of the bytes sent in each communication
+ * category in csv format. Each row holds the bytes a rank sent to all ranks.
+ * Must be called by all ranks.
+ * @return The matrix (only valid on rank 0).
+ */
+std::string CommunicationMatrixString() {
+  CommunicationStatistics const &counters = CommunicationStatistics::Instance();
+  int const number_of_ranks = MpiUtilities::NumberOfRanks();
+  std::string matrix;
+  if (MpiUtilities::MasterRank()) {
+    matrix = "category,sender";
+    for (int rank = 0; rank < number_of_ranks; ++rank) {
+      matrix += ",to_rank_" + std::to_string(rank);
+    }
+    matrix += "\n";
+  }
+  std::vector<long> all_bytes(
+      MpiUtilities::MasterRank() ? number_of_ranks * number_of_ranks : 0);
+  for (unsigned int index = 0; index < number_of_communication_categories_;
+       ++index) {
+    std::vector<long> local_bytes = counters.bytes_send_[index];
+    local_bytes.resize(number_of_ranks, 0);
+    MPI_Gather(local_bytes.data(), number_of_ranks, MPI_LONG, all_bytes.data(),
+               number_of_ranks, MPI_LONG, 0, MpiUtilities::Communicator());
+    std::string const category =
+        CommunicationCategoryToString(CommunicationCategory(index));
+    for (int sender = 0; sender < number_of_ranks && !all_bytes.empty();
+         ++sender) {
+      matrix += category + "," + std::to_string(sender);
+      for (int receiver = 0; receiver < number_of_ranks; ++receiver) {
+        matrix += "," + std::to_string(
+                            all_bytes[sender * number_of_ranks + receiver]);
+      }
+      matrix += "\n";
+    }
+  }
+  return matrix;
+}
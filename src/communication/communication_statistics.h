@@ -22,24 +22,104 @@
 #ifndef COMMUNICATION_STATISTICS_H
 #define COMMUNICATION_STATISTICS_H
 
+#include <array>
 #include <string>
+#include <vector>
+
+#include "user_specifications/debug_and_profile_setup.h"
+
+/**
+ * @brief Categories of the MPI communication the statistics are gathered for.
+ * @note Do not change the underlying type. Used for index mapping.
+ */
+enum class CommunicationCategory : unsigned short {
+  Halo = 0,
+  JumpHalo = 1,
+  InterfaceHalo = 2,
+  Balance = 3,
+  Average = 4,
+  Other = 5
+};
+
+/**
+ * @brief Number of communication categories.
+ */
+constexpr unsigned int number_of_communication_categories_ = 6;
+
+std::string CommunicationCategoryToString(CommunicationCategory const category);
 
 /**
  * @brief The CommunicationStatistics struct gathers information about the MPI
- * Communication for proper logging output.
+ * Communication for proper logging output. Besides the message counters, the
+ * bytes exchanged with each partner rank and the time spent waiting for the
+ * completion of messages are recorded per category if recording is enabled
+ * (by default in profiling runs, see DP::Profile()). The statistics are kept
+ * per simulation, see SimulationContext.
  */
 struct CommunicationStatistics {
 public:
-  static long no_jump_halos_recv_;
-  static long no_jump_halos_send_;
-  static long jump_halos_recv_;
-  static long jump_halos_send_;
-  static long balance_send_;
-  static long balance_recv_;
-  static long average_level_send_;
-  static long average_level_recv_;
+  long no_jump_halos_recv_ = 0;
+  long no_jump_halos_send_ = 0;
+  long jump_halos_recv_ = 0;
+  long jump_halos_send_ = 0;
+  long balance_send_ = 0;
+  long balance_recv_ = 0;
+  long average_level_send_ = 0;
+  long average_level_recv_ = 0;
+
+  // flag whether bytes, messages and wait times are recorded
+  bool recording_ = DP::Profile();
+  // category of the currently issued messages, see CommunicationCategoryScope
+  CommunicationCategory category_ = CommunicationCategory::Other;
+  // per category and partner rank
+  std::array<std::vector<long>, number_of_communication_categories_>
+      bytes_send_;
+  std::array<std::vector<long>, number_of_communication_categories_>
+      bytes_recv_;
+  std::array<std::vector<long>, number_of_communication_categories_>
+      messages_send_;
+  // per category
+  std::array<double, number_of_communication_categories_> wait_time_ = {};
+
+  static CommunicationStatistics &Instance();
+
+  void RecordMessage(CommunicationCategory const category,
+                     int const partner_rank, long const bytes, bool const send);
+  void RecordWait(double const time);
+};
+
+/**
+ * @brief Assigns all messages issued during its lifetime to a communication
+ * category. The previous category is restored when it goes out of scope.
+ */
+class CommunicationCategoryScope {
+  CommunicationCategory const previous_category_;
+
+public:
+  /**
+   * @brief Sets the category of the issued messages.
+   * @param category The category of the messages.
+   */
+  explicit CommunicationCategoryScope(CommunicationCategory const category)
+      : previous_category_(CommunicationStatistics::Instance().category_) {
+    CommunicationStatistics::Instance().category_ = category;
+  }
+  /**
+   * @brief Restores the previous category.
+   */
+  ~CommunicationCategoryScope() {
+    CommunicationStatistics::Instance().category_ = previous_category_;
+  }
+  CommunicationCategoryScope() = delete;
+  CommunicationCategoryScope(CommunicationCategoryScope const &) = delete;
+  CommunicationCategoryScope &
+  operator=(CommunicationCategoryScope const &) = delete;
+  CommunicationCategoryScope(CommunicationCategoryScope &&) = delete;
+  CommunicationCategoryScope &operator=(CommunicationCategoryScope &&) = delete;
 };
 
 std::string SummedCommunicationStatisticsString();
+std::vector<std::string> CommunicationVolumeStatistics();
+std::string CommunicationMatrixString();
 
 #endif /* COMMUNICATION_STATISTICS_H */
@@ -21,10 +21,29 @@
 //===----------------------------------------------------------------------===//
 #include "communication_types.h"
 
+#include "block_definitions/field_buffer.h"
 #include "block_definitions/field_material_definitions.h"
 #include "boundary_condition/boundary_specifications.h"
 #include <stdexcept>
 
+namespace {
+/**
+ * @brief Gives the elementary MPI datatype of a DatatypeForMpi index.
+ * @param type The index of the DatatypeForMpi identifier.
+ * @return The elementary MPI datatype.
+ */
+MPI_Datatype BaseDatatype(unsigned int const type) {
+  switch (DatatypeForMpi(type)) {
+  case DatatypeForMpi::Double:
+    return MPI_DOUBLE;
+  case DatatypeForMpi::Float:
+    return MPI_FLOAT;
+  default: // DatatypeForMpi::Byte
+    return MPI_INT8_T;
+  }
+}
+} // namespace
+
 /**
  * @brief Constructor creating and allocating the derived MPI_Datatypes.
  */
@@ -39,81 +58,47 @@ CommunicationTypes::~CommunicationTypes() { FreeTypes(); }
  * @brief Datatypes for 3D Simulations. See Meta function.
  */
 void CommunicationTypes::CreateDataTypes() {
+  // Halo datatypes are subarrays of a single field, consecutive fields are
+  // reached through the extent of a full three-dimensional array
+  static_assert(CC::FBL() == FieldBufferLayout::FieldMajor,
+                "Halo datatypes are only defined for field-major buffers");
 
   // creates all Datatypes for Halo Updates
-  for (unsigned int type = 0; type < 2; type++) {
-    // material data types
-    for (BoundaryLocation const location : CC::HBS()) {
-      // send
-      MPI_Type_create_subarray(3, block_size_.data(),
-                               halo_size_[LTI(location)].data(),
-                               start_indices_halo_send_[LTI(location)].data(),
-                               MPI_ORDER_C, type == 0 ? MPI_DOUBLE : MPI_INT8_T,
-                               &send_types_[type][LTI(location)]);
-      MPI_Type_commit(&send_types_[type][LTI(location)]);
-
-      // recv
-      MPI_Type_create_subarray(3, block_size_.data(),
-                               halo_size_[LTI(location)].data(),
-                               start_indices_halo_recv_[LTI(location)].data(),
-                               MPI_ORDER_C, type == 0 ? MPI_DOUBLE : MPI_INT8_T,
-                               &recv_types_[type][LTI(location)]);
-      MPI_Type_commit(&recv_types_[type][LTI(location)]);
+  for (unsigned int type = 0; type < number_of_datatypes_for_mpi_; type++) {
+    // material data types for all halo depths
+    for (unsigned int depth = 1; depth <= CC::HS(); ++depth) {
+      for (BoundaryLocation const location : CC::HBS()) {
+        std::array<int, 3> const size = GetHaloSize(location, depth);
+        // send
+        MPI_Type_create_subarray(
+            3, block_size_.data(), size.data(),
+            GetStartIndicesHaloSend(location, depth).data(), MPI_ORDER_C,
+            BaseDatatype(type), &send_types_[type][depth - 1][LTI(location)]);
+        MPI_Type_commit(&send_types_[type][depth - 1][LTI(location)]);
+
+        // recv
+        MPI_Type_create_subarray(
+            3, block_size_.data(), size.data(),
+            GetStartIndicesHaloRecv(location, depth).data(), MPI_ORDER_C,
+            BaseDatatype(type), &recv_types_[type][depth - 1][LTI(location)]);
+        MPI_Type_commit(&recv_types_[type][depth - 1][LTI(location)]);
+      }
     }
 
     // ProjectLevel representation of child-memory
     for (unsigned int child = 0; child < CC::NOC(); ++child) {
       MPI_Type_create_subarray(3, block_size_.data(), child_size_.data(),
                                start_index_child_[child].data(), MPI_ORDER_C,
-                               type == 0 ? MPI_DOUBLE : MPI_INT8_T,
+                               BaseDatatype(type),
                                &averaging_send_[type][child]);
       MPI_Type_commit(&averaging_send_[type][child]);
     }
   }
 
-  int const jump_send_start_index[3] = {0, 0, 0};
-  MPI_Type_create_subarray(3, halo_size_[LTI(BoundaryLocation::East)].data(),
-                           halo_size_[LTI(BoundaryLocation::East)].data(),
-                           jump_send_start_index, MPI_ORDER_C, MPI_DOUBLE,
-                           &jump_plane_ew_);
-  MPI_Type_create_subarray(3, halo_size_[LTI(BoundaryLocation::North)].data(),
-                           halo_size_[LTI(BoundaryLocation::North)].data(),
-                           jump_send_start_index, MPI_ORDER_C, MPI_DOUBLE,
-                           &jump_plane_ns_);
-  MPI_Type_create_subarray(3, halo_size_[LTI(BoundaryLocation::Top)].data(),
-                           halo_size_[LTI(BoundaryLocation::Top)].data(),
-                           jump_send_start_index, MPI_ORDER_C, MPI_DOUBLE,
-                           &jump_plane_tb_);
-
-  MPI_Type_commit(&jump_plane_ew_);
-  MPI_Type_commit(&jump_plane_ns_);
-  MPI_Type_commit(&jump_plane_tb_);
-
-  MPI_Type_create_subarray(
-      3, halo_size_[LTI(BoundaryLocation::BottomSouth)].data(),
-      halo_size_[LTI(BoundaryLocation::BottomSouth)].data(),
-      jump_send_start_index, MPI_ORDER_C, MPI_DOUBLE, &jump_stick_x_);
-  MPI_Type_create_subarray(
-      3, halo_size_[LTI(BoundaryLocation::BottomWest)].data(),
-      halo_size_[LTI(BoundaryLocation::BottomWest)].data(),
-      jump_send_start_index, MPI_ORDER_C, MPI_DOUBLE, &jump_stick_y_);
-  MPI_Type_create_subarray(
-      3, halo_size_[LTI(BoundaryLocation::SouthWest)].data(),
-      halo_size_[LTI(BoundaryLocation::SouthWest)].data(),
-      jump_send_start_index, MPI_ORDER_C, MPI_DOUBLE, &jump_stick_z_);
-
-  MPI_Type_commit(&jump_stick_x_);
-  MPI_Type_commit(&jump_stick_y_);
-  MPI_Type_commit(&jump_stick_z_);
-
-  MPI_Type_create_subarray(
-      3, halo_size_[LTI(BoundaryLocation::EastNorthTop)].data(),
-      halo_size_[LTI(BoundaryLocation::EastNorthTop)].data(),
-      jump_send_start_index, MPI_ORDER_C, MPI_DOUBLE, &jump_cube_);
-  MPI_Type_commit(&jump_cube_);
-
   int const tc_per_conservative = CC::TCX() * CC::TCY() * CC::TCZ();
-  MPI_Type_contiguous(tc_per_conservative, MPI_DOUBLE, &single_conservatives_);
+  MPI_Type_contiguous(tc_per_conservative,
+                      BaseDatatype(DTI(DatatypeOf<FieldValue>())),
+                      &single_conservatives_);
   int const tc_per_jump = MF::ANOE() * CC::ICY() * CC::ICZ();
   MPI_Type_contiguous(tc_per_jump, MPI_DOUBLE, &single_boundary_jump_);
 
@@ -127,11 +112,13 @@ void CommunicationTypes::CreateDataTypes() {
  */
 void CommunicationTypes::FreeTypes() {
 
-  for (unsigned int type = 0; type < 2; type++) {
+  for (unsigned int type = 0; type < number_of_datatypes_for_mpi_; type++) {
     // material data types
-    for (BoundaryLocation location : CC::HBS()) {
-      MPI_Type_free(&send_types_[type][LTI(location)]);
-      MPI_Type_free(&recv_types_[type][LTI(location)]);
+    for (unsigned int depth = 0; depth < CC::HS(); ++depth) {
+      for (BoundaryLocation location : CC::HBS()) {
+        MPI_Type_free(&send_types_[type][depth][LTI(location)]);
+        MPI_Type_free(&recv_types_[type][depth][LTI(location)]);
+      }
     }
 
     // ProjectLevel representation of child-memory
@@ -140,15 +127,6 @@ void CommunicationTypes::FreeTypes() {
     }
   }
 
-  // Jump Halo data types
-  MPI_Type_free(&jump_plane_ew_);
-  MPI_Type_free(&jump_plane_ns_);
-  MPI_Type_free(&jump_plane_tb_);
-  MPI_Type_free(&jump_stick_x_);
-  MPI_Type_free(&jump_stick_y_);
-  MPI_Type_free(&jump_stick_z_);
-  MPI_Type_free(&jump_cube_);
-
   // Whole block-struct
   MPI_Type_free(&single_conservatives_);
   MPI_Type_free(&single_boundary_jump_);
@@ -159,24 +137,28 @@ void CommunicationTypes::FreeTypes() {
  * exchange.
  * @param location The direction of the halo to be sent into.
  * @param datatype Mpi Datatype that should be received.
+ * @param depth The number of halo cells received normal to the boundary
+ * ( 1 <= depth <= HS ).
  * @return The Datatype needed to send into the right sub_array.
  */
-MPI_Datatype
-CommunicationTypes::RecvDatatype(BoundaryLocation const location,
-                                 DatatypeForMpi const datatype) const {
-  return recv_types_[DTI(datatype)][LTI(location)];
+MPI_Datatype CommunicationTypes::RecvDatatype(BoundaryLocation const location,
+                                              DatatypeForMpi const datatype,
+                                              unsigned int const depth) const {
+  return recv_types_[DTI(datatype)][depth - 1][LTI(location)];
 }
 
 /**
  * @brief Gives the MPI Datatype to send data from in an internal cell.
  * @param location The direction of the halo to be sent from.
  * @param datatype Mpi Datatype that should be sent.
+ * @param depth The number of halo cells sent normal to the boundary
+ * ( 1 <= depth <= HS ).
  * @return The Datatype needed to send from the right sub_array.
  */
-MPI_Datatype
-CommunicationTypes::SendDatatype(BoundaryLocation const location,
-                                 DatatypeForMpi const datatype) const {
-  return send_types_[DTI(datatype)][LTI(location)];
+MPI_Datatype CommunicationTypes::SendDatatype(BoundaryLocation const location,
+                                              DatatypeForMpi const datatype,
+                                              unsigned int const depth) const {
+  return send_types_[DTI(datatype)][depth - 1][LTI(location)];
 }
 
 /**
@@ -211,41 +193,3 @@ CommunicationTypes::AveragingSendDatatype(unsigned int const child_position,
   throw std::logic_error("Child position not possible: " +
                          std::to_string(child_position));
 }
-
-/**
- * @brief Gives the correct datatype for a jump boundary at the given location.
- * @param location The location identifier.
- * @return The correct MPI_Datatype.
- */
-MPI_Datatype CommunicationTypes::JumpPlaneSendDatatype(
-    BoundaryLocation const location) const {
-
-  switch (location) {
-  case BoundaryLocation::East:
-  case BoundaryLocation::West:
-    return jump_plane_ew_;
-  case BoundaryLocation::North:
-  case BoundaryLocation::South:
-    return jump_plane_ns_;
-  case BoundaryLocation::Top:
-  case BoundaryLocation::Bottom:
-    return jump_plane_tb_;
-  case BoundaryLocation::BottomNorth:
-  case BoundaryLocation::BottomSouth:
-  case BoundaryLocation::TopNorth:
-  case BoundaryLocation::TopSouth:
-    return jump_stick_x_;
-  case BoundaryLocation::BottomEast:
-  case BoundaryLocation::BottomWest:
-  case BoundaryLocation::TopEast:
-  case BoundaryLocation::TopWest:
-    return jump_stick_y_;
-  case BoundaryLocation::NorthEast:
-  case BoundaryLocation::NorthWest:
-  case BoundaryLocation::SouthEast:
-  case BoundaryLocation::SouthWest:
-    return jump_stick_z_;
-  default:
-    return jump_cube_;
-  }
-}
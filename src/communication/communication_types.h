@@ -130,6 +130,8 @@ class CommunicationTypes {
       {{CC::HSSX(), CC::HSSY(), CC::HSSZ()}}, // wst
       {{CC::HSSX(), CC::HSSY(), CC::HSSZ()}}, // wsb
   }};
+  static constexpr std::array<int, 3> first_internal_cells_ = {
+      {CC::FICX(), CC::FICY(), CC::FICZ()}};
   // Averaging
   static constexpr std::array<int, 3> child_size_ = {
       {CC::PSOCICX(), CC::PSOCICY(), CC::PSOCICZ()}};
@@ -142,17 +144,20 @@ class CommunicationTypes {
        {CC::PIOHCFICX(), CC::FICY(), CC::PIOHCFICZ()},
        {CC::FICX(), CC::PIOHCFICY(), CC::PIOHCFICZ()},
        {CC::PIOHCFICX(), CC::PIOHCFICY(), CC::PIOHCFICZ()}}};
-  // Datatypes for Boundaries ( doubles )
+  // Datatypes for Boundaries ( doubles, bytes and floats ) for every halo
+  // depth from one to HS (index depth - 1)
   // 26 Elements for 3 Dimensions, numbering like boundary_specification.h
   // ->BoundaryLocation 1D: East, West 2D: East, West, North, South 3D: East,
   // West, North, South, Top, Bottom
-  std::array<std::array<MPI_Datatype, 26>, 2> send_types_;
-  std::array<std::array<MPI_Datatype, 26>, 2> recv_types_;
+  std::array<std::array<std::array<MPI_Datatype, 26>, CC::HS()>,
+             number_of_datatypes_for_mpi_>
+      send_types_;
+  std::array<std::array<std::array<MPI_Datatype, 26>, CC::HS()>,
+             number_of_datatypes_for_mpi_>
+      recv_types_;
   // Datatypes for ProjectLevel Recv into block
-  std::array<std::array<MPI_Datatype, CC::NOC()>, 2> averaging_send_;
-  MPI_Datatype jump_plane_ew_, jump_plane_ns_, jump_plane_tb_;
-  MPI_Datatype jump_stick_x_, jump_stick_y_, jump_stick_z_;
-  MPI_Datatype jump_cube_;
+  std::array<std::array<MPI_Datatype, CC::NOC()>, number_of_datatypes_for_mpi_>
+      averaging_send_;
   // Datatypes for Load Balancing, sending whole Struct
   MPI_Datatype single_conservatives_;
   MPI_Datatype single_boundary_jump_;
@@ -168,32 +173,80 @@ class CommunicationTypes {
    */
   void FreeTypes();
 
+  /**
+   * @brief Indicates whether the halo of the given location extends in the
+   * given direction, i.e. whether it lies outside the internal cells there.
+   */
+  static constexpr bool IsHaloDirection(BoundaryLocation const location,
+                                        unsigned int const direction) {
+    return start_indices_halo_recv_[LTI(location)][direction] !=
+           first_internal_cells_[direction];
+  }
+
+  /**
+   * @brief Shifts the start indices of a full halo to the start of a halo of
+   * reduced depth. The reduced halo keeps the cells closest to the boundary,
+   * hence, in directions where the location lies on the lower side, the
+   * received cells move towards the boundary, on the upper side the sent ones.
+   * @param start The start indices of the full halo.
+   * @param location The location of the halo.
+   * @param depth The number of halo cells normal to the boundary.
+   * @param lower_side Decider whether directions where the location lies on
+   * the lower ( true ) or on the upper side ( false ) are shifted.
+   * @return The start indices of the reduced halo.
+   */
+  static constexpr std::array<int, 3>
+  ShiftToHaloDepth(std::array<int, 3> start, BoundaryLocation const location,
+                   unsigned int const depth, bool const lower_side) {
+    for (unsigned int d = 0; d < 3; ++d) {
+      if (IsHaloDirection(location, d) &&
+          (start_indices_halo_recv_[LTI(location)][d] == 0) == lower_side) {
+        start[d] += static_cast<int>(CC::HS() - depth);
+      }
+    }
+    return start;
+  }
+
 public:
   // NH TODO-19 Rule-of-five omitted here.
   explicit CommunicationTypes();
   virtual ~CommunicationTypes();
 
   MPI_Datatype SendDatatype(BoundaryLocation const location,
-                            DatatypeForMpi const datatype) const;
+                            DatatypeForMpi const datatype,
+                            unsigned int const depth = CC::HS()) const;
   MPI_Datatype RecvDatatype(BoundaryLocation const location,
-                            DatatypeForMpi const datatype) const;
-  MPI_Datatype JumpPlaneSendDatatype(BoundaryLocation const location) const;
+                            DatatypeForMpi const datatype,
+                            unsigned int const depth = CC::HS()) const;
   MPI_Datatype ConservativesDatatype() const;
   MPI_Datatype JumpSurfaceDatatype() const;
   MPI_Datatype AveragingSendDatatype(unsigned int const child_position,
                                      DatatypeForMpi const datatype) const;
 
+  // The halo geometry of the given location, optionally reduced to the
+  // given depth ( 1 <= depth <= HS ) normal to the boundary
   static constexpr std::array<int, 3>
-  GetStartIndicesHaloSend(BoundaryLocation const location) {
-    return start_indices_halo_send_[LTI(location)];
+  GetStartIndicesHaloSend(BoundaryLocation const location,
+                          unsigned int const depth = CC::HS()) {
+    return ShiftToHaloDepth(start_indices_halo_send_[LTI(location)], location,
+                            depth, false);
   }
   static constexpr std::array<int, 3>
-  GetStartIndicesHaloRecv(BoundaryLocation const location) {
-    return start_indices_halo_recv_[LTI(location)];
+  GetStartIndicesHaloRecv(BoundaryLocation const location,
+                          unsigned int const depth = CC::HS()) {
+    return ShiftToHaloDepth(start_indices_halo_recv_[LTI(location)], location,
+                            depth, true);
   }
   static constexpr std::array<int, 3>
-  GetHaloSize(BoundaryLocation const location) {
-    return halo_size_[LTI(location)];
+  GetHaloSize(BoundaryLocation const location,
+              unsigned int const depth = CC::HS()) {
+    std::array<int, 3> size = halo_size_[LTI(location)];
+    for (unsigned int d = 0; d < 3; ++d) {
+      if (IsHaloDirection(location, d)) {
+        size[d] = static_cast<int>(depth);
+      }
+    }
+    return size;
   }
 };
 
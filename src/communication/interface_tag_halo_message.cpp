@@ -0,0 +1,89 @@
+//===------------------ interface_tag_halo_message.cpp --------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "communication/interface_tag_halo_message.h"
+#include <algorithm>
+
+namespace InterfaceTagHaloMessage {
+
+/**
+ * @brief Gives the size of the message of a halo region with non-uniform tags,
+ * i.e. the size the receive buffer has to provide.
+ * @param size Number of cells of the region in each direction.
+ * @return The maximum number of tags in the message ( plus the flag ).
+ */
+std::size_t MaximumSize(std::array<int, 3> const &size) {
+  return 1 + static_cast<std::size_t>(size[0]) *
+                 static_cast<std::size_t>(size[1]) *
+                 static_cast<std::size_t>(size[2]);
+}
+
+/**
+ * @brief Packs a region of the interface tag buffer into a message.
+ * @param tags The interface tags the data is taken from.
+ * @param start The first cell of the region in each direction.
+ * @param size Number of cells of the region in each direction.
+ * @param message The packed data (indirect return parameter).
+ */
+void Pack(std::int8_t const (&tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
+          std::array<int, 3> const &start, std::array<int, 3> const &size,
+          std::vector<std::int8_t> &message) {
+  message.clear();
+  message.reserve(MaximumSize(size));
+  message.push_back(0);
+  for (int i = start[0]; i < start[0] + size[0]; ++i) {
+    for (int j = start[1]; j < start[1] + size[1]; ++j) {
+      for (int k = start[2]; k < start[2] + size[2]; ++k) {
+        message.push_back(tags[i][j][k]);
+      }
+    }
+  }
+  // uniform regions are reduced to their single tag
+  if (std::all_of(
+          message.begin() + 1, message.end(),
+          [&message](std::int8_t const tag) { return tag == message[1]; })) {
+    message[0] = 1;
+    message.resize(2);
+  }
+}
+
+/**
+ * @brief Unpacks a message into a region of the interface tag buffer.
+ * @param message The data packed by Pack.
+ * @param start The first cell of the region in each direction.
+ * @param size Number of cells of the region in each direction.
+ * @param tags The interface tags the data is written to.
+ */
+void Unpack(std::vector<std::int8_t> const &message,
+            std::array<int, 3> const &start, std::array<int, 3> const &size,
+            std::int8_t (&tags)[CC::TCX()][CC::TCY()][CC::TCZ()]) {
+  bool const uniform = message[0] != 0;
+  std::size_t offset = 1;
+  for (int i = start[0]; i < start[0] + size[0]; ++i) {
+    for (int j = start[1]; j < start[1] + size[1]; ++j) {
+      for (int k = start[2]; k < start[2] + size[2]; ++k) {
+        tags[i][j][k] = uniform ? message[1] : message[offset++];
+      }
+    }
+  }
+}
+
+} // namespace InterfaceTagHaloMessage
@@ -0,0 +1,50 @@
+//===------------------- interface_tag_halo_message.h ---------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef INTERFACE_TAG_HALO_MESSAGE_H
+#define INTERFACE_TAG_HALO_MESSAGE_H
+
+#include "user_specifications/compile_time_constants.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Packing of interface tag halo regions into messages which carry a
+ * region of uniform tags, as found away from the interface, as a single value.
+ * The message starts with a flag whether the region is uniform, followed by
+ * either the uniform tag or all tags of the region.
+ */
+namespace InterfaceTagHaloMessage {
+
+std::size_t MaximumSize(std::array<int, 3> const &size);
+
+void Pack(std::int8_t const (&tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
+          std::array<int, 3> const &start, std::array<int, 3> const &size,
+          std::vector<std::int8_t> &message);
+void Unpack(std::vector<std::int8_t> const &message,
+            std::array<int, 3> const &start, std::array<int, 3> const &size,
+            std::int8_t (&tags)[CC::TCX()][CC::TCY()][CC::TCZ()]);
+
+} // namespace InterfaceTagHaloMessage
+
+#endif // INTERFACE_TAG_HALO_MESSAGE_H
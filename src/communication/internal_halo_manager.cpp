@@ -21,8 +21,34 @@
 //===----------------------------------------------------------------------===//
 #include "communication/internal_halo_manager.h"
 #include "communication/communication_manager.h"
+#include "communication/interface_tag_halo_message.h"
+#include "communication/mpi_utilities.h"
+#include "communication/sparse_halo_message.h"
 #include "multiresolution/multiresolution.h"
 #include "topology/id_information.h"
+#include "utilities/memory_statistics.h"
+#include "utilities/runtime_profiler.h"
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+
+namespace {
+
+/**
+ * @brief Indicates whether the halos of the given buffer are exchanged as
+ * sparse messages, which only applies to level-set buffers.
+ * @param type The identifier of the buffer that is updated.
+ * @return True if only values inside the cut-off band are exchanged.
+ */
+bool IsSparseInterfaceHaloBuffer(InterfaceBlockBufferType const type) {
+  return CC::SparseLevelsetHalos() &&
+         (type == InterfaceBlockBufferType::LevelsetBase ||
+          type == InterfaceBlockBufferType::LevelsetReinitialized ||
+          type == InterfaceBlockBufferType::LevelsetIntegrated);
+}
+
+} // namespace
 
 /**
  * @brief Standard Constructor for Internal Boundaries.
@@ -49,56 +75,208 @@ InternalHaloManager::InternalHaloManager(
  * prime states is done.
  * @param cut_jumps Decider if jump halos should be updated on specified level.
  * If true: jumps will not be updated on the current level.
+ * @param depth The number of no-jump halo cells required normal to the
+ * boundaries, see MaterialHaloUpdateOnLevelBegin.
  */
 void InternalHaloManager::MaterialHaloUpdateOnLevel(
     unsigned int const level, MaterialFieldType const field_type,
-    bool const cut_jumps) {
-  std::vector<MPI_Request> requests;
+    bool const cut_jumps, unsigned int const depth) {
+  MaterialHaloUpdateOnLevelBegin(level, field_type, cut_jumps, level_update_,
+                                 depth);
+  MaterialHaloUpdateOnLevelFinish(level_update_);
+}
+
+/**
+ * @brief First half of a split-phase halo update of internal halo cells. Posts
+ * all MPI communication and carries out all rank-local halo updates. Nodes
+ * which are not listed in the nodes in flight of the pending update are
+ * completely updated on return.
+ * @param level The level on which halos of nodes will be modified.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ * @param cut_jumps Decider if jump halos should be updated on specified level.
+ * If true: jumps will not be updated on the current level.
+ * @param pending Holds the open requests and communication buffers. Indirect
+ * return parameter, has to be passed to MaterialHaloUpdateOnLevelFinish.
+ * @param depth The number of no-jump halo cells required normal to the
+ * boundaries ( 1 <= depth <= HS ). Only the halos exchanged via MPI are reduced
+ * to this depth, the outer halo cells of those keep their previous values.
+ * Jump halos are predicted and exchanged to this depth rounded up to an even
+ * number, as the prediction fills pairs of child cells. Rank-local no-jump
+ * halos are always updated completely.
+ */
+void InternalHaloManager::MaterialHaloUpdateOnLevelBegin(
+    unsigned int const level, MaterialFieldType const field_type,
+    bool const cut_jumps, PendingMaterialHaloUpdate &pending,
+    unsigned int const depth) {
+#ifndef PERFORMANCE
+  if (depth == 0 || depth > CC::HS()) {
+    throw std::logic_error("Halo depth " + std::to_string(depth) +
+                           " not within one and the halo size");
+  }
+#endif
   communication_manager_.GenerateNeighborRelationForHaloUpdate(level);
+  pending.level_ = level;
+  pending.field_type_ = field_type;
+  pending.depth_ = depth;
+  pending.persistent_requests_ = nullptr;
+  pending.aggregated_messages_ = nullptr;
+  pending.exposure_window_ = MPI_WIN_NULL;
+  pending.requests_.clear();
+  pending.nodes_in_flight_.clear();
+  CommunicationCategoryScope const category(CommunicationCategory::Halo);
 
   // Non-Jump halo update
   // it is necessary that first the non-jump boundaries are carried out to
   // ensure that all parent nodes contain the correct information in their halo
   // cells
-  MpiMaterialHaloUpdateNoJump(
-      requests, communication_manager_.InternalBoundariesMpi(level),
-      field_type);
+  if constexpr (CC::AggregateHaloMessages()) {
+    StartAggregatedHaloMessages(level, field_type, pending);
+  } else if (CC::PersistentHaloRequests() && depth == CC::HS() &&
+             field_type != MaterialFieldType::Conservatives) {
+    // The communication pattern only changes with the topology, hence the
+    // requests are created once and restarted afterwards. Reduced depths are
+    // exchanged with one-off requests, as are the conservatives, whose storage
+    // alternates with every buffer swap ( see Block::SwapConservativeBuffers )
+    std::vector<MPI_Request> &persistent_requests =
+        communication_manager_.PersistentHaloRequests(level, field_type);
+    if (!communication_manager_.ArePersistentHaloRequestsValid(level,
+                                                               field_type)) {
+      MpiMaterialHaloUpdateNoJump(
+          persistent_requests,
+          communication_manager_.InternalBoundariesMpi(level), field_type,
+          true);
+      communication_manager_.ValidatePersistentHaloRequests(level, field_type);
+    } else {
+      CountMpiHaloUpdateNoJump(
+          communication_manager_.InternalBoundariesMpi(level));
+    }
+    communication_manager_.StartPersistent(persistent_requests);
+    pending.persistent_requests_ = &persistent_requests;
+  } else {
+    MpiMaterialHaloUpdateNoJump(
+        pending.requests_, communication_manager_.InternalBoundariesMpi(level),
+        field_type, false, depth);
+  }
   NoMpiMaterialHaloUpdate(communication_manager_.InternalBoundaries(level),
                           field_type);
+  ExtendMaterialHalos(communication_manager_.ExtendedBoundaries(level),
+                      field_type);
+  // Local nodes sending or receiving on this level (sends of jump halos are
+  // carried out from the separate jump buffers)
+  for (auto const &boundary :
+       communication_manager_.InternalBoundariesMpi(level)) {
+    pending.nodes_in_flight_.push_back(std::get<0>(boundary));
+  }
   // Jump halo updates
   if (!cut_jumps) {
-    // All direction-types need the same buffer size, but have different
-    // DataTypes for sending the data, Conservatives_Plane_EW is also
-    // representative for Conservatives_Plane_NS and Conservatives_Plane_TB and
-    // so on. Proper cast is handled within SendJumpToChild in
-    // internal_boundary_condition as of C++17 vector is guaranteed to be
-    // contiguous in memory
-    std::vector<ExchangePlane> jump_buffer_plane(
+    CommunicationCategoryScope const jump_category(
+        CommunicationCategory::JumpHalo);
+    // All directions of a type need the same buffer size, Plane_EW is also
+    // representative for Plane_NS and Plane_TB and so on. The halo slabs of
+    // reduced depth are packed to the front of the full-depth entries, which
+    // are contiguous in memory as of C++17
+    pending.jump_buffer_plane_.resize(
         MF::ANOF(field_type) * number_of_materials_ *
         communication_manager_.JumpSendCount(level, ExchangeType::Plane));
-    std::vector<ExchangeStick> jump_buffer_stick(
+    pending.jump_buffer_stick_.resize(
         MF::ANOF(field_type) * number_of_materials_ *
         communication_manager_.JumpSendCount(level, ExchangeType::Stick));
-    std::vector<ExchangeCube> jump_buffer_cube(
+    pending.jump_buffer_cube_.resize(
         MF::ANOF(field_type) * number_of_materials_ *
         communication_manager_.JumpSendCount(level, ExchangeType::Cube));
+    MemoryStatistics::RecordTransient(
+        MemoryCategory::Communication,
+        CapacityBytes(pending.jump_buffer_plane_) +
+            CapacityBytes(pending.jump_buffer_stick_) +
+            CapacityBytes(pending.jump_buffer_cube_));
+    unsigned int const jump_depth = std::min(CC::HS(), depth + depth % 2);
     MpiMaterialHaloUpdateJump(
-        requests, communication_manager_.InternalBoundariesJumpMpi(level),
-        jump_buffer_plane, jump_buffer_stick, jump_buffer_cube, field_type);
+        pending.requests_,
+        communication_manager_.InternalBoundariesJumpMpi(level),
+        pending.jump_buffer_plane_, pending.jump_buffer_stick_,
+        pending.jump_buffer_cube_, field_type, jump_depth);
     NoMpiMaterialHaloUpdate(
-        communication_manager_.InternalBoundariesJump(level), field_type);
-    MPI_Waitall(
-        requests.size(), requests.data(),
-        MPI_STATUSES_IGNORE); // buffer-vectors need to be alive till this point
-  } else {
-    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        communication_manager_.InternalBoundariesJump(level), field_type,
+        jump_depth);
+    for (auto const &boundary :
+         communication_manager_.InternalBoundariesJumpMpi(level)) {
+      if (std::get<2>(boundary) == InternalBoundaryType::JumpBoundaryMpiRecv) {
+        pending.nodes_in_flight_.push_back(std::get<0>(boundary));
+      }
+    }
   }
-  requests.clear();
+  std::sort(pending.nodes_in_flight_.begin(), pending.nodes_in_flight_.end());
+  pending.nodes_in_flight_.erase(std::unique(pending.nodes_in_flight_.begin(),
+                                             pending.nodes_in_flight_.end()),
+                                 pending.nodes_in_flight_.end());
+}
+
+/**
+ * @brief Tests without blocking whether all communication posted in
+ * MaterialHaloUpdateOnLevelBegin is completed, i.e. whether the finish call
+ * does not wait anymore.
+ * @param pending The pending update as filled by the begin function.
+ * @return True if all messages have arrived.
+ */
+bool InternalHaloManager::MaterialHaloUpdateOnLevelArrived(
+    PendingMaterialHaloUpdate &pending) {
+  if (pending.persistent_requests_ != nullptr &&
+      !communication_manager_.TestAll(*pending.persistent_requests_)) {
+    return false;
+  }
+  // A completed exposure epoch is closed by the test itself
+  if (pending.exposure_window_ != MPI_WIN_NULL) {
+    int arrived = 0;
+    MPI_Win_test(pending.exposure_window_, &arrived);
+    if (!arrived) {
+      return false;
+    }
+    pending.exposure_window_ = MPI_WIN_NULL;
+  }
+  return communication_manager_.TestAll(pending.requests_);
+}
+
+/**
+ * @brief Second half of a split-phase halo update of internal halo cells.
+ * Completes all communication posted in MaterialHaloUpdateOnLevelBegin.
+ * @param pending The pending update as filled by the begin function. The nodes
+ * in flight are kept to allow the caller to process the deferred nodes.
+ */
+void InternalHaloManager::MaterialHaloUpdateOnLevelFinish(
+    PendingMaterialHaloUpdate &pending) {
+  CommunicationCategoryScope const category(CommunicationCategory::Halo);
+  // Persistent requests become inactive again, but are kept for reuse
+  if (pending.persistent_requests_ != nullptr) {
+    communication_manager_.WaitAll(*pending.persistent_requests_);
+    pending.persistent_requests_ = nullptr;
+  }
+  // buffer-vectors need to be alive till this point
+  communication_manager_.WaitAll(pending.requests_);
+  if (pending.exposure_window_ != MPI_WIN_NULL) {
+    MPI_Win_wait(pending.exposure_window_);
+    pending.exposure_window_ = MPI_WIN_NULL;
+  }
+  if (pending.aggregated_messages_ != nullptr) {
+    UnpackAggregatedHaloMessages(pending.level_, pending.field_type_,
+                                 pending.depth_, *pending.aggregated_messages_);
+    if (pending.aggregated_messages_->shared_window_ != MPI_WIN_NULL) {
+      // The windows may only be packed again once all partners have read
+      ProfileRegion const region("SharedMemoryHalos");
+      MPI_Barrier(communication_manager_.NodeCommunicator());
+    }
+    pending.aggregated_messages_ = nullptr;
+  }
+  pending.requests_.clear();
+  pending.jump_buffer_plane_.clear();
+  pending.jump_buffer_stick_.clear();
+  pending.jump_buffer_cube_.clear();
 }
 
 void InternalHaloManager::MaterialHaloUpdateOnMultis(
     MaterialFieldType const field_type) {
-  std::vector<MPI_Request> requests;
+  CommunicationCategoryScope const category(CommunicationCategory::Halo);
+  std::vector<MPI_Request> &requests = requests_;
   communication_manager_.GenerateNeighborRelationForHaloUpdate(
       topology_.GetMaximumLevel());
 
@@ -108,7 +286,7 @@ void InternalHaloManager::MaterialHaloUpdateOnMultis(
       field_type);
   NoMpiMaterialHaloUpdate(communication_manager_.InternalMultiBoundaries(),
                           field_type);
-  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+  communication_manager_.WaitAll(requests);
   requests.clear();
 }
 
@@ -116,30 +294,46 @@ void InternalHaloManager::MaterialHaloUpdateOnMultis(
  * @brief Updates the interface tags in internal halo cells on the given level.
  * @param level Level on which the update is done.
  * @param type Level-set buffer type on which the update is done.
+ * @param frozen_nodes Sorted ids of nodes whose halos are left untouched as
+ * neither the node nor its neighbors changed. The halos received via MPI are
+ * always updated.
  */
 void InternalHaloManager::InterfaceTagHaloUpdateOnLevel(
-    unsigned int const level, InterfaceDescriptionBufferType const type) {
-  std::vector<MPI_Request> requests;
+    unsigned int const level, InterfaceDescriptionBufferType const type,
+    std::vector<nid_t> const &frozen_nodes) {
+  CommunicationCategoryScope const category(
+      CommunicationCategory::InterfaceHalo);
+  std::vector<MPI_Request> &requests = requests_;
+  InterfaceTagHaloMessages tag_messages;
   communication_manager_.GenerateNeighborRelationForHaloUpdate(level);
   // Non-Jump halo update
   // it is necessary that first the non-jump boundaries are carried out to
   // ensure that all parent nodes contain the correct information in their halo
   // cells
   MpiInterfaceTagHaloUpdate(communication_manager_.InternalBoundariesMpi(level),
-                            type, requests);
+                            type, requests, tag_messages);
   NoMpiInterfaceTagHaloUpdate(communication_manager_.InternalBoundaries(level),
-                              type);
+                              type, frozen_nodes);
+  for (auto const &[id, location] :
+       communication_manager_.ExtendedBoundaries(level)) {
+    if (!std::binary_search(frozen_nodes.begin(), frozen_nodes.end(), id)) {
+      ExtendClosestInternalValue(tree_.GetNodeWithId(id).GetInterfaceTags(type),
+                                 location);
+    }
+  }
   // Jump halo update
   // (Inteface tag jumps are always handled locally, but might be in the mpi
   // buffer for MaterialHaloUpdates.)
   NoMpiInterfaceTagHaloUpdate(
-      communication_manager_.InternalBoundariesJump(level), type);
+      communication_manager_.InternalBoundariesJump(level), type, frozen_nodes);
   // Inteface tag jumps are always handled locally, but might be in the mpi
   // buffer for MaterialHaloUpdates.
   NoMpiInterfaceTagHaloUpdate(
-      communication_manager_.InternalBoundariesJumpMpi(level), type);
-  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+      communication_manager_.InternalBoundariesJumpMpi(level), type,
+      frozen_nodes);
+  communication_manager_.WaitAll(requests);
   requests.clear();
+  UnpackInterfaceTagHalos(type, tag_messages);
 }
 
 /**
@@ -147,28 +341,101 @@ void InternalHaloManager::InterfaceTagHaloUpdateOnLevel(
  * given level.
  * @param level Level on which the update is done.
  * @param type The identifier of the buffer that is to be updated.
+ * @param frozen_nodes Sorted ids of nodes whose halos are left untouched as
+ * neither the node nor its neighbors changed. Only allowed for nodes without
+ * MPI boundaries.
  */
 void InternalHaloManager::InterfaceHaloUpdateOnLevel(
-    unsigned int const level, InterfaceBlockBufferType const type) {
-  std::vector<MPI_Request> requests;
+    unsigned int const level, InterfaceBlockBufferType const type,
+    std::vector<nid_t> const &frozen_nodes) {
+  CommunicationCategoryScope const category(
+      CommunicationCategory::InterfaceHalo);
+  std::vector<MPI_Request> &requests = requests_;
+  SparseInterfaceHaloMessages sparse_messages;
   communication_manager_.GenerateNeighborRelationForHaloUpdate(level);
   // Non-Jump halo update
   // it is necessary that first the non-jump boundaries are carried out to
   // ensure that all parent nodes contain the correct information in their halo
   // cells
   MpiInterfaceHaloUpdate(communication_manager_.InternalBoundariesMpi(level),
-                         type, requests);
+                         type, requests, sparse_messages);
   NoMpiInterfaceHaloUpdate(communication_manager_.InternalBoundaries(level),
-                           type);
+                           type, frozen_nodes);
   // Jump halo update
   // (levelset jumps are always handled locally, but might be in the mpi buffer
   // for MaterialHaloUpdates.)
   NoMpiInterfaceHaloUpdate(communication_manager_.InternalBoundariesJump(level),
-                           type);
+                           type, frozen_nodes);
   NoMpiInterfaceHaloUpdate(
-      communication_manager_.InternalBoundariesJumpMpi(level), type);
-  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+      communication_manager_.InternalBoundariesJumpMpi(level), type,
+      frozen_nodes);
+  communication_manager_.WaitAll(requests);
   requests.clear();
+  UnpackSparseInterfaceHalos(type, sparse_messages);
+}
+
+/**
+ * @brief Determines which of the given nodes fill their interface halos from
+ * each other on this rank. Jump halos are filled from parents, which are not
+ * modified on the given level and therefore do not cause dependencies.
+ * @param level Level of the nodes.
+ * @param nodes The nodes under consideration.
+ * @param ids The ids of the nodes (indirect return parameter).
+ * @param neighbors For each node the indices of the nodes its no-jump halos are
+ * filled from (indirect return parameter).
+ * @param has_mpi_boundary For each node whether one of its halos is exchanged
+ * via MPI (indirect return parameter).
+ */
+void InternalHaloManager::InterfaceHaloDependenciesOnLevel(
+    unsigned int const level,
+    std::vector<std::reference_wrapper<Node>> const &nodes,
+    std::vector<nid_t> &ids, std::vector<std::vector<std::size_t>> &neighbors,
+    std::vector<bool> &has_mpi_boundary) {
+  communication_manager_.GenerateNeighborRelationForHaloUpdate(level);
+
+  std::unordered_map<Node const *, std::size_t> index_of_node;
+  for (std::size_t n = 0; n < nodes.size(); ++n) {
+    index_of_node.emplace(&nodes[n].get(), n);
+  }
+  auto const index_of_id = [this, level,
+                            &index_of_node](nid_t const id) -> std::size_t {
+    auto const *const entry = tree_.GetLevelContent(level).find(id);
+    if (entry == nullptr) {
+      return std::numeric_limits<std::size_t>::max();
+    }
+    auto const index = index_of_node.find(&entry->second);
+    return index == index_of_node.end()
+               ? std::numeric_limits<std::size_t>::max()
+               : index->second;
+  };
+
+  ids.assign(nodes.size(), 0);
+  for (auto const &[id, node] : tree_.GetLevelContent(level)) {
+    auto const index = index_of_node.find(&node);
+    if (index != index_of_node.end()) {
+      ids[index->second] = id;
+    }
+  }
+  neighbors.assign(nodes.size(), {});
+  has_mpi_boundary.assign(nodes.size(), false);
+
+  for (auto const &boundary :
+       communication_manager_.InternalBoundariesMpi(level)) {
+    std::size_t const host = index_of_id(std::get<0>(boundary));
+    if (host < nodes.size()) {
+      has_mpi_boundary[host] = true;
+    }
+  }
+  for (auto const &boundary :
+       communication_manager_.InternalBoundaries(level)) {
+    nid_t const id = std::get<0>(boundary);
+    std::size_t const host = index_of_id(id);
+    std::size_t const partner =
+        index_of_id(topology_.GetTopologyNeighborId(id, std::get<1>(boundary)));
+    if (host < nodes.size() && partner < nodes.size()) {
+      neighbors[host].push_back(partner);
+    }
+  }
 }
 
 /**
@@ -180,10 +447,12 @@ void InternalHaloManager::InterfaceHaloUpdateOnLevel(
  * @param loc BoundaryLocation to be updated.
  * @param field_type The decider whether a halo update for conservatives or for
  * prime states is done.
+ * @param depth The number of halo cells received normal to the boundary.
  */
 void InternalHaloManager::UpdateMaterialJumpMpiRecv(
     nid_t const id, std::vector<MPI_Request> &requests,
-    BoundaryLocation const loc, MaterialFieldType const field_type) {
+    BoundaryLocation const loc, MaterialFieldType const field_type,
+    unsigned int const depth) {
   Node &node = tree_.GetNodeWithId(id);
   // parent always contains material of child
   for (auto const material : topology_.GetMaterialsOfNode(id)) {
@@ -193,8 +462,8 @@ void InternalHaloManager::UpdateMaterialJumpMpiRecv(
     int const sender_rank = topology_.GetRankOfNode(parent_id);
 
     // MPI
-    MPI_Datatype recv_type =
-        communication_manager_.RecvDatatype(loc, DatatypeForMpi::Double);
+    MPI_Datatype recv_type = communication_manager_.RecvDatatype(
+        loc, DatatypeOf<FieldValue>(), depth);
     switch (field_type) {
     case MaterialFieldType::Conservatives: {
       communication_manager_.Recv(&host_block.GetRightHandSideBuffer(),
@@ -207,14 +476,18 @@ void InternalHaloManager::UpdateMaterialJumpMpiRecv(
 #ifndef PERFORMANCE
     case MaterialFieldType::Parameters: {
       communication_manager_.Recv(&host_block.GetParameterBuffer(), MF::ANOPA(),
-                                  recv_type, sender_rank, requests);
+                                  communication_manager_.RecvDatatype(
+                                      loc, DatatypeOf<ParameterValue>(), depth),
+                                  sender_rank, requests);
     } break;
     default:
       throw std::logic_error("Material field type not known!");
 #else
     default: /* MaterialFieldType::Parameters: */
       communication_manager_.Recv(&host_block.GetParameterBuffer(), MF::ANOPA(),
-                                  recv_type, sender_rank, requests);
+                                  communication_manager_.RecvDatatype(
+                                      loc, DatatypeOf<ParameterValue>(), depth),
+                                  sender_rank, requests);
 #endif
     }
   }
@@ -227,10 +500,11 @@ void InternalHaloManager::UpdateMaterialJumpMpiRecv(
  * @param loc BoundaryLocation to be updated.
  * @param field_type The decider whether a halo update for conservatives or for
  * prime states is done.
+ * @param depth The number of halo cells predicted normal to the boundary.
  */
 void InternalHaloManager::UpdateMaterialJumpNoMpi(
     nid_t const id, BoundaryLocation const loc,
-    MaterialFieldType const field_type) {
+    MaterialFieldType const field_type, unsigned int const depth) {
   Node &node = tree_.GetNodeWithId(id);
   // parent always contains material of child
   for (auto const material : topology_.GetMaterialsOfNode(id)) {
@@ -238,8 +512,8 @@ void InternalHaloManager::UpdateMaterialJumpNoMpi(
 
     nid_t const parent_id = ParentIdOfNode(id);
     auto const start_indices =
-        communication_manager_.GetStartIndicesHaloRecv(loc);
-    auto const halo_size = communication_manager_.GetHaloSize(loc);
+        communication_manager_.GetStartIndicesHaloRecv(loc, depth);
+    auto const halo_size = communication_manager_.GetHaloSize(loc, depth);
 
     Block const &parent_block =
         tree_.GetNodeWithId(parent_id).GetPhaseByMaterial(material);
@@ -312,11 +586,19 @@ void InternalHaloManager::UpdateMaterialHaloCellsNoMpi(
 
       for (unsigned int field_index = 0; field_index < number_of_fields;
            ++field_index) {
-        double(&host_cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-            host_block.GetFieldBuffer(field_type, field_index);
-        double const(&partner_cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-            partner_block.GetFieldBuffer(field_type, field_index);
-        UpdateNoJumpLocal(host_cells, partner_cells, loc);
+        host_block.VisitFieldBuffer(
+            field_type, field_index, [&](auto &host_cells) {
+              partner_block.VisitFieldBuffer(
+                  field_type, field_index, [&](auto const &partner_cells) {
+                    // both blocks store the field in the same precision
+                    if constexpr (std::is_same_v<
+                                      std::remove_cvref_t<decltype(host_cells)>,
+                                      std::remove_cvref_t<
+                                          decltype(partner_cells)>>) {
+                      UpdateNoJumpLocal(host_cells, partner_cells, loc);
+                    }
+                  });
+            });
       }
     }
   }
@@ -332,49 +614,60 @@ void InternalHaloManager::UpdateMaterialHaloCellsNoMpi(
  * @param loc BoundaryLocation to be updated.
  * @param field_type The decider whether a halo update for conservatives or for
  * prime states is done.
+ * @param persistent Decider whether persistent (inactive) requests are created
+ * instead of starting the communication.
+ * @param depth The number of halo cells exchanged normal to the boundary.
  */
 void InternalHaloManager::UpdateMaterialHaloCellsMpiSend(
     nid_t const id, std::vector<MPI_Request> &requests,
-    BoundaryLocation const loc, MaterialFieldType const field_type) {
+    BoundaryLocation const loc, MaterialFieldType const field_type,
+    bool const persistent, unsigned int const depth) {
+  // Persistent requests are only created here, they are started by the caller
+  auto const send = [this, persistent](void const *buffer, int const count,
+                                       MPI_Datatype const datatype,
+                                       int const rank,
+                                       std::vector<MPI_Request> &request_list) {
+    return persistent ? communication_manager_.SendInit(buffer, count, datatype,
+                                                        rank, request_list)
+                      : communication_manager_.Send(buffer, count, datatype,
+                                                    rank, request_list);
+  };
   Node &node = tree_.GetNodeWithId(id);
-  nid_t const neighbor_id = topology_.GetTopologyNeighborId(id, loc);
-  int const rank_of_neighbor = topology_.GetRankOfNode(neighbor_id);
+  TopologyNeighbor const neighbor = topology_.NeighborOfNode(id, loc);
+  nid_t const neighbor_id = neighbor.id_;
+  int const rank_of_neighbor = neighbor.rank_;
 
   for (auto const material : topology_.GetMaterialsOfNode(id)) {
     if (topology_.NodeContainsMaterial(neighbor_id, material)) {
       Block const &host_block = node.GetPhaseByMaterial(material);
       switch (field_type) {
       case MaterialFieldType::Conservatives: {
-        MPI_Datatype send_type =
-            communication_manager_.SendDatatype(loc, DatatypeForMpi::Double);
-        communication_manager_.Send(&host_block.GetRightHandSideBuffer(),
-                                    MF::ANOE(), send_type, rank_of_neighbor,
-                                    requests);
+        MPI_Datatype send_type = communication_manager_.SendDatatype(
+            loc, DatatypeOf<FieldValue>(), depth);
+        send(&host_block.GetRightHandSideBuffer(), MF::ANOE(), send_type,
+             rank_of_neighbor, requests);
       } break;
       case MaterialFieldType::PrimeStates: {
-        MPI_Datatype send_type =
-            communication_manager_.SendDatatype(loc, DatatypeForMpi::Double);
-        communication_manager_.Send(&host_block.GetPrimeStateBuffer(),
-                                    MF::ANOP(), send_type, rank_of_neighbor,
-                                    requests);
+        MPI_Datatype send_type = communication_manager_.SendDatatype(
+            loc, DatatypeOf<FieldValue>(), depth);
+        send(&host_block.GetPrimeStateBuffer(), MF::ANOP(), send_type,
+             rank_of_neighbor, requests);
       } break;
 #ifndef PERFORMANCE
       case MaterialFieldType::Parameters: {
-        MPI_Datatype send_type =
-            communication_manager_.SendDatatype(loc, DatatypeForMpi::Double);
-        communication_manager_.Send(&host_block.GetParameterBuffer(),
-                                    MF::ANOPA(), send_type, rank_of_neighbor,
-                                    requests);
+        MPI_Datatype send_type = communication_manager_.SendDatatype(
+            loc, DatatypeOf<ParameterValue>(), depth);
+        send(&host_block.GetParameterBuffer(), MF::ANOPA(), send_type,
+             rank_of_neighbor, requests);
       } break;
       default:
         throw std::logic_error("Material field type not known!");
 #else
       default: /* MaterialFieldType::Parameters: */ {
-        MPI_Datatype send_type =
-            communication_manager_.SendDatatype(loc, DatatypeForMpi::Double);
-        communication_manager_.Send(&host_block.GetParameterBuffer(),
-                                    MF::ANOPA(), send_type, rank_of_neighbor,
-                                    requests);
+        MPI_Datatype send_type = communication_manager_.SendDatatype(
+            loc, DatatypeOf<ParameterValue>(), depth);
+        send(&host_block.GetParameterBuffer(), MF::ANOPA(), send_type,
+             rank_of_neighbor, requests);
       }
 #endif
       }
@@ -392,34 +685,48 @@ void InternalHaloManager::UpdateMaterialHaloCellsMpiSend(
  * @param loc BoundaryLocation to be updated.
  * @param field_type The decider whether a halo update for conservatives or for
  * prime states is done.
+ * @param persistent Decider whether persistent (inactive) requests are created
+ * instead of starting the communication.
+ * @param depth The number of halo cells exchanged normal to the boundary.
  */
 void InternalHaloManager::UpdateMaterialHaloCellsMpiRecv(
     nid_t const id, std::vector<MPI_Request> &requests,
-    BoundaryLocation const loc, MaterialFieldType const field_type) {
+    BoundaryLocation const loc, MaterialFieldType const field_type,
+    bool const persistent, unsigned int const depth) {
+  // Persistent requests are only created here, they are started by the caller
+  auto const recv = [this, persistent](void *buffer, int const count,
+                                       MPI_Datatype const datatype,
+                                       int const rank,
+                                       std::vector<MPI_Request> &request_list) {
+    return persistent ? communication_manager_.RecvInit(buffer, count, datatype,
+                                                        rank, request_list)
+                      : communication_manager_.Recv(buffer, count, datatype,
+                                                    rank, request_list);
+  };
   Node &node = tree_.GetNodeWithId(id);
-  nid_t const neighbor_id = topology_.GetTopologyNeighborId(id, loc);
-  int const rank_of_neighbor = topology_.GetRankOfNode(neighbor_id);
+  TopologyNeighbor const neighbor = topology_.NeighborOfNode(id, loc);
+  nid_t const neighbor_id = neighbor.id_;
+  int const rank_of_neighbor = neighbor.rank_;
 
   for (auto const material : topology_.GetMaterialsOfNode(id)) {
     if (topology_.NodeContainsMaterial(neighbor_id, material)) {
       Block &host_block = node.GetPhaseByMaterial(material);
-      MPI_Datatype recv_type =
-          communication_manager_.RecvDatatype(loc, DatatypeForMpi::Double);
+      MPI_Datatype recv_type = communication_manager_.RecvDatatype(
+          loc, DatatypeOf<FieldValue>(), depth);
       switch (field_type) {
       case MaterialFieldType::Conservatives: {
-        communication_manager_.Recv(&host_block.GetRightHandSideBuffer(),
-                                    MF::ANOE(), recv_type, rank_of_neighbor,
-                                    requests);
+        recv(&host_block.GetRightHandSideBuffer(), MF::ANOE(), recv_type,
+             rank_of_neighbor, requests);
       } break;
       case MaterialFieldType::PrimeStates: {
-        communication_manager_.Recv(&host_block.GetPrimeStateBuffer(),
-                                    MF::ANOP(), recv_type, rank_of_neighbor,
-                                    requests);
+        recv(&host_block.GetPrimeStateBuffer(), MF::ANOP(), recv_type,
+             rank_of_neighbor, requests);
       } break;
       case MaterialFieldType::Parameters: {
-        communication_manager_.Recv(&host_block.GetParameterBuffer(),
-                                    MF::ANOPA(), recv_type, rank_of_neighbor,
-                                    requests);
+        recv(&host_block.GetParameterBuffer(), MF::ANOPA(),
+             communication_manager_.RecvDatatype(
+                 loc, DatatypeOf<ParameterValue>(), depth),
+             rank_of_neighbor, requests);
       } break;
       default:
         throw std::logic_error("Material field type not known!");
@@ -500,25 +807,39 @@ inline void InternalHaloManager::ExtendClosestInternalValue(
  * @param buffer_type Type of buffer on the levelset block that should be
  * updated.
  * @param loc BoundaryLocation to be updated.
+ * @param sparse_messages Storage of the sent message for sparse level-set
+ * halos.
  */
 void InternalHaloManager::UpdateInterfaceHaloCellsMpiSend(
     nid_t const id, std::vector<MPI_Request> &requests,
-    InterfaceBlockBufferType const buffer_type, BoundaryLocation const loc) {
+    InterfaceBlockBufferType const buffer_type, BoundaryLocation const loc,
+    SparseInterfaceHaloMessages &sparse_messages) {
   Node &node = tree_.GetNodeWithId(id);
   nid_t const host_id = id;
-  nid_t const neighbor_id = topology_.GetTopologyNeighborId(host_id, loc);
+  TopologyNeighbor const neighbor = topology_.NeighborOfNode(host_id, loc);
+  nid_t const neighbor_id = neighbor.id_;
   /*  NH TODO-19 "node.HasLevelset() if" should be avoided, therefore different
    * neighbor relations in CommunicationManger needed for levelset vs.
    * Material/Tag Halo updates.
    */
   if (topology_.IsNodeMultiPhase(neighbor_id) && node.HasLevelset()) {
-    int const rank_of_neighbor = topology_.GetRankOfNode(neighbor_id);
+    int const rank_of_neighbor = neighbor.rank_;
     double const(&host_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetInterfaceBlock().GetBuffer(buffer_type);
-    MPI_Datatype send_type =
-        communication_manager_.SendDatatype(loc, DatatypeForMpi::Double);
-    communication_manager_.Send(host_buffer, 1, send_type, rank_of_neighbor,
-                                requests);
+    if (IsSparseInterfaceHaloBuffer(buffer_type)) {
+      std::vector<double> &message =
+          sparse_messages.send_messages_.emplace_back();
+      SparseHaloMessage::Pack(
+          host_buffer, communication_manager_.GetStartIndicesHaloSend(loc),
+          communication_manager_.GetHaloSize(loc), CC::LSCOF(), message);
+      communication_manager_.Send(message.data(), message.size(), MPI_DOUBLE,
+                                  rank_of_neighbor, requests);
+    } else {
+      MPI_Datatype send_type =
+          communication_manager_.SendDatatype(loc, DatatypeForMpi::Double);
+      communication_manager_.Send(host_buffer, 1, send_type, rank_of_neighbor,
+                                  requests);
+    }
   }
 }
 
@@ -531,26 +852,42 @@ void InternalHaloManager::UpdateInterfaceHaloCellsMpiSend(
  * @param buffer_type Type of buffer on the levelset block that should be
  * updated.
  * @param loc BoundaryLocation to be updated.
+ * @param sparse_messages Storage of the received message for sparse level-set
+ * halos.
  */
 void InternalHaloManager::UpdateInterfaceHaloCellsMpiRecv(
     nid_t const id, std::vector<MPI_Request> &requests,
-    InterfaceBlockBufferType const buffer_type, BoundaryLocation const loc) {
+    InterfaceBlockBufferType const buffer_type, BoundaryLocation const loc,
+    SparseInterfaceHaloMessages &sparse_messages) {
   Node &node = tree_.GetNodeWithId(id);
   nid_t const host_id = id;
-  nid_t const neighbor_id = topology_.GetTopologyNeighborId(host_id, loc);
+  TopologyNeighbor const neighbor = topology_.NeighborOfNode(host_id, loc);
+  nid_t const neighbor_id = neighbor.id_;
   /*  NH TODO-19 "node.HasLevelset() if" should be avoided, therefore different
    * neighbor relations in CommunicationManger needed for levelset vs.
    * Material/Tag Halo updates.
    */
   if (node.HasLevelset()) {
     if (topology_.IsNodeMultiPhase(neighbor_id)) {
-      int const rank_of_neighbor = topology_.GetRankOfNode(neighbor_id);
-      double(&host_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-          node.GetInterfaceBlock().GetBuffer(buffer_type);
-      MPI_Datatype recv_type =
-          communication_manager_.RecvDatatype(loc, DatatypeForMpi::Double);
-      communication_manager_.Recv(host_buffer, 1, recv_type, rank_of_neighbor,
-                                  requests);
+      int const rank_of_neighbor = neighbor.rank_;
+      if (IsSparseInterfaceHaloBuffer(buffer_type)) {
+        // The message size is not known in advance, hence space for the
+        // densest message is provided
+        std::vector<double> &message =
+            sparse_messages.recv_messages_.emplace_back(
+                SparseHaloMessage::MaximumSize(
+                    communication_manager_.GetHaloSize(loc)));
+        sparse_messages.receivers_.emplace_back(id, loc);
+        communication_manager_.Recv(message.data(), message.size(), MPI_DOUBLE,
+                                    rank_of_neighbor, requests);
+      } else {
+        double(&host_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+            node.GetInterfaceBlock().GetBuffer(buffer_type);
+        MPI_Datatype recv_type =
+            communication_manager_.RecvDatatype(loc, DatatypeForMpi::Double);
+        communication_manager_.Recv(host_buffer, 1, recv_type, rank_of_neighbor,
+                                    requests);
+      }
     } else {
       double(&host_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
           node.GetInterfaceBlock().GetBuffer(buffer_type);
@@ -559,6 +896,27 @@ void InternalHaloManager::UpdateInterfaceHaloCellsMpiRecv(
   }
 }
 
+/**
+ * @brief Distributes the received sparse level-set halo messages into the halo
+ * cells of the receiving nodes. Must only be called after the receives are
+ * completed.
+ * @param buffer_type Type of buffer on the levelset block that is updated.
+ * @param sparse_messages The received messages.
+ */
+void InternalHaloManager::UnpackSparseInterfaceHalos(
+    InterfaceBlockBufferType const buffer_type,
+    SparseInterfaceHaloMessages const &sparse_messages) {
+  for (std::size_t m = 0; m < sparse_messages.receivers_.size(); ++m) {
+    auto const &[id, loc] = sparse_messages.receivers_[m];
+    double(&host_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        tree_.GetNodeWithId(id).GetInterfaceBlock().GetBuffer(buffer_type);
+    SparseHaloMessage::Unpack(
+        sparse_messages.recv_messages_[m],
+        communication_manager_.GetStartIndicesHaloRecv(loc),
+        communication_manager_.GetHaloSize(loc), CC::LSCOF(), host_buffer);
+  }
+}
+
 /**
  * @brief Performs all Halo Updates that can be done without communication.
  * @param id The id of the node to be updated.
@@ -587,6 +945,12 @@ void InternalHaloManager::UpdateInterfaceHaloCellsNoMpi(
         double const(&partner_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
             neighbor.GetInterfaceBlock().GetBuffer(buffer_type);
         UpdateNoJumpLocal(host_buffer, partner_buffer, loc);
+        if (IsSparseInterfaceHaloBuffer(buffer_type)) {
+          // Yields the same halo values as an exchange via MPI
+          SparseHaloMessage::CutOff(
+              host_buffer, communication_manager_.GetStartIndicesHaloRecv(loc),
+              communication_manager_.GetHaloSize(loc), CC::LSCOF());
+        }
       } else {
         ExtendClosestInternalValue(host_buffer, loc);
       }
@@ -605,21 +969,33 @@ void InternalHaloManager::UpdateInterfaceHaloCellsNoMpi(
  * MPI_Request vector.
  * @param type Level-set buffer type on which the update is done.
  * @param loc BoundaryLocation to be updated.
+ * @param tag_messages Storage of the sent message for compressed interface tag
+ * halos.
  */
 void InternalHaloManager::UpdateInterfaceTagHaloCellsMpiSend(
     nid_t const id, std::vector<MPI_Request> &requests,
-    InterfaceDescriptionBufferType const type, BoundaryLocation const loc) {
-  Node &node = tree_.GetNodeWithId(id);
+    InterfaceDescriptionBufferType const type, BoundaryLocation const loc,
+    InterfaceTagHaloMessages &tag_messages) {
+  Node const &node = tree_.GetNodeWithId(id);
   nid_t const host_id = id;
-  nid_t const neighbor_id = topology_.GetTopologyNeighborId(host_id, loc);
-
-  int const rank_of_neighbor = topology_.GetRankOfNode(neighbor_id);
+  TopologyNeighbor const neighbor = topology_.NeighborOfNode(host_id, loc);
+  int const rank_of_neighbor = neighbor.rank_;
   std::int8_t const(&host_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       node.GetInterfaceTags(type);
-  MPI_Datatype send_type =
-      communication_manager_.SendDatatype(loc, DatatypeForMpi::Byte);
-  communication_manager_.Send(host_buffer, 1, send_type, rank_of_neighbor,
-                              requests);
+  if constexpr (CC::CompressedInterfaceTagHalos()) {
+    std::vector<std::int8_t> &message =
+        tag_messages.send_messages_.emplace_back();
+    InterfaceTagHaloMessage::Pack(
+        host_buffer, communication_manager_.GetStartIndicesHaloSend(loc),
+        communication_manager_.GetHaloSize(loc), message);
+    communication_manager_.Send(message.data(), message.size(), MPI_INT8_T,
+                                rank_of_neighbor, requests);
+  } else {
+    MPI_Datatype send_type =
+        communication_manager_.SendDatatype(loc, DatatypeForMpi::Byte);
+    communication_manager_.Send(host_buffer, 1, send_type, rank_of_neighbor,
+                                requests);
+  }
 }
 
 /**
@@ -630,22 +1006,56 @@ void InternalHaloManager::UpdateInterfaceTagHaloCellsMpiSend(
  * MPI_Request vector.
  * @param type Level-set buffer type on which the update is done.
  * @param loc BoundaryLocation to be updated.
+ * @param tag_messages Storage of the received message for compressed interface
+ * tag halos.
  */
 void InternalHaloManager::UpdateInterfaceTagHaloCellsMpiRecv(
     nid_t const id, std::vector<MPI_Request> &requests,
-    InterfaceDescriptionBufferType const type, BoundaryLocation const loc) {
+    InterfaceDescriptionBufferType const type, BoundaryLocation const loc,
+    InterfaceTagHaloMessages &tag_messages) {
   Node &node = tree_.GetNodeWithId(id);
   nid_t const host_id = id;
-  nid_t const neighbor_id = topology_.GetTopologyNeighborId(host_id, loc);
+  TopologyNeighbor const neighbor = topology_.NeighborOfNode(host_id, loc);
+  int const rank_of_neighbor = neighbor.rank_;
 
-  int const rank_of_neighbor = topology_.GetRankOfNode(neighbor_id);
+  if constexpr (CC::CompressedInterfaceTagHalos()) {
+    // Whether the region is uniform is not known in advance, hence space for
+    // all tags is provided
+    std::vector<std::int8_t> &message =
+        tag_messages.recv_messages_.emplace_back(
+            InterfaceTagHaloMessage::MaximumSize(
+                communication_manager_.GetHaloSize(loc)));
+    tag_messages.receivers_.emplace_back(id, loc);
+    communication_manager_.Recv(message.data(), message.size(), MPI_INT8_T,
+                                rank_of_neighbor, requests);
+  } else {
+    std::int8_t(&host_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        node.GetInterfaceTags(type);
+    MPI_Datatype recv_type =
+        communication_manager_.RecvDatatype(loc, DatatypeForMpi::Byte);
+    communication_manager_.Recv(host_buffer, 1, recv_type, rank_of_neighbor,
+                                requests);
+  }
+}
 
-  std::int8_t(&host_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceTags(type);
-  MPI_Datatype recv_type =
-      communication_manager_.RecvDatatype(loc, DatatypeForMpi::Byte);
-  communication_manager_.Recv(host_buffer, 1, recv_type, rank_of_neighbor,
-                              requests);
+/**
+ * @brief Distributes the received compressed interface tag halo messages into
+ * the halo cells of the receiving nodes. Must only be called after the receives
+ * are completed.
+ * @param type Level-set buffer type on which the update is done.
+ * @param tag_messages The received messages.
+ */
+void InternalHaloManager::UnpackInterfaceTagHalos(
+    InterfaceDescriptionBufferType const type,
+    InterfaceTagHaloMessages const &tag_messages) {
+  for (std::size_t m = 0; m < tag_messages.receivers_.size(); ++m) {
+    auto const &[id, loc] = tag_messages.receivers_[m];
+    InterfaceTagHaloMessage::Unpack(
+        tag_messages.recv_messages_[m],
+        communication_manager_.GetStartIndicesHaloRecv(loc),
+        communication_manager_.GetHaloSize(loc),
+        tree_.GetNodeWithId(id).GetInterfaceTags(type));
+  }
 }
 
 /**
@@ -660,9 +1070,10 @@ void InternalHaloManager::UpdateInterfaceTagHaloCellsNoMpi(
     BoundaryLocation const loc) {
   Node &node = tree_.GetNodeWithId(id);
   nid_t const host_id = id;
-  nid_t const neighbor_id = topology_.GetTopologyNeighborId(host_id, loc);
+  TopologyNeighbor const neighbor = topology_.NeighborOfNode(host_id, loc);
+  nid_t const neighbor_id = neighbor.id_;
 
-  if (topology_.NodeExists(neighbor_id)) {
+  if (neighbor.level_difference_ == 0) {
     std::int8_t(&host_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetInterfaceTags(type);
     std::int8_t const(&partner_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
@@ -687,17 +1098,19 @@ void InternalHaloManager::UpdateInterfaceTagHaloCellsNoMpi(
  * @param loc BoundaryLocation to be updated.
  * @param field_type The decider whether a halo update for conservatives or for
  * prime states is done.
+ * @param depth The number of halo cells predicted and sent normal to the
+ * boundary.
  */
 unsigned int InternalHaloManager::UpdateMaterialJumpMpiSend(
     nid_t const id, std::vector<MPI_Request> &requests,
     nid_t const remote_child_id, void *send_buffer, BoundaryLocation const loc,
-    MaterialFieldType const field_type) {
+    MaterialFieldType const field_type, unsigned int const depth) {
   Node &node = tree_.GetNodeWithId(id);
 
   // NH ints needed here as a rat's tail of MPI, where uint is not allowed.
   auto const start_indices =
-      communication_manager_.GetStartIndicesHaloRecv(loc);
-  auto const halo_size = communication_manager_.GetHaloSize(loc);
+      communication_manager_.GetStartIndicesHaloRecv(loc, depth);
+  auto const halo_size = communication_manager_.GetHaloSize(loc, depth);
   unsigned int const number_of_fields = MF::ANOF(field_type);
   int const single_block_size = halo_size[0] * halo_size[1] * halo_size[2];
   int const whole_block_size = number_of_fields * single_block_size;
@@ -709,45 +1122,58 @@ unsigned int InternalHaloManager::UpdateMaterialJumpMpiSend(
 
     if (topology_.NodeContainsMaterial(remote_child_id, material)) {
       Block const &parent_block = node.GetPhaseByMaterial(material);
-
-      double *send_buffer_double = (double *)send_buffer;
-
-      MPI_Datatype const send_type =
-          communication_manager_.JumpPlaneSendDatatype(loc);
       int block_pos = material_number * whole_block_size;
 
-      double child_buffer[CC::TCX()][CC::TCY()][CC::TCZ()];
       for (unsigned int field_index = 0; field_index < number_of_fields;
            ++field_index) {
-        Multiresolution::Prediction(
-            parent_block.GetFieldBuffer(field_type, field_index), child_buffer,
-            remote_child_id, start_indices[0], halo_size[0], start_indices[1],
-            halo_size[1], start_indices[2], halo_size[2]);
-        /* in order to buffer only valid values, we need to copy the values into
-         * the send buffer, this operation is dependent on the direction of the
-         * jump the static_cast is used to specify the datatype of the memory
-         * necessary to store the current temporary results. As we have to
-         * distinguish the different directions, different types are used, but
-         * all have the same total amount of bytes
-         */
-        for (int i = 0; i < halo_size[0]; i++) {
-          for (int j = 0; j < halo_size[1]; j++) {
-            for (int k = 0; k < halo_size[2]; k++) {
-              int const cell_pos = material_number * whole_block_size +
-                                   field_index * single_block_size +
-                                   i * halo_size[1] * halo_size[2] +
-                                   j * halo_size[2] + k;
-              send_buffer_double[cell_pos] =
-                  child_buffer[start_indices[0] + i][start_indices[1] + j]
-                              [start_indices[2] + k];
-            }
-          }
-        }
+        parent_block.VisitFieldBuffer(
+            field_type, field_index, [&](auto const &parent_cells) {
+              using ValueType = std::remove_const_t<std::remove_all_extents_t<
+                  std::remove_reference_t<decltype(parent_cells)>>>;
+              ValueType *send_values = static_cast<ValueType *>(send_buffer);
+              ValueType child_buffer[CC::TCX()][CC::TCY()][CC::TCZ()];
+              Multiresolution::Prediction(
+                  parent_cells, child_buffer, remote_child_id, start_indices[0],
+                  halo_size[0], start_indices[1], halo_size[1],
+                  start_indices[2], halo_size[2]);
+              /* in order to buffer only valid values, we need to copy the
+               * values into the send buffer, this operation is dependent on
+               * the direction of the jump the static_cast is used to specify
+               * the datatype of the memory necessary to store the current
+               * temporary results. As we have to distinguish the different
+               * directions, different types are used, but all have the same
+               * total amount of bytes
+               */
+              for (int i = 0; i < halo_size[0]; i++) {
+                for (int j = 0; j < halo_size[1]; j++) {
+                  for (int k = 0; k < halo_size[2]; k++) {
+                    int const cell_pos = material_number * whole_block_size +
+                                         field_index * single_block_size +
+                                         i * halo_size[1] * halo_size[2] +
+                                         j * halo_size[2] + k;
+                    send_values[cell_pos] =
+                        child_buffer[start_indices[0] + i][start_indices[1] + j]
+                                    [start_indices[2] + k];
+                  }
+                }
+              }
+            });
       }
       material_number++;
-      communication_manager_.Send(&send_buffer_double[block_pos],
-                                  number_of_fields, send_type, child_rank,
-                                  requests);
+      // The packed values are contiguous and in the order of the receiving
+      // subarrays, hence they are sent as plain values of the buffer type
+      bool const single_precision = field_type == MaterialFieldType::Parameters
+                                        ? CC::SinglePrecisionParameters()
+                                        : CC::SinglePrecisionFields();
+      if (single_precision) {
+        communication_manager_.Send(
+            static_cast<float *>(send_buffer) + block_pos, whole_block_size,
+            MPI_FLOAT, child_rank, requests);
+      } else {
+        communication_manager_.Send(
+            static_cast<double *>(send_buffer) + block_pos, whole_block_size,
+            MPI_DOUBLE, child_rank, requests);
+      }
     }
   }
   // return increment of field buffers sent
@@ -768,6 +1194,7 @@ unsigned int InternalHaloManager::UpdateMaterialJumpMpiSend(
  * exchange of cube boundaries.
  * @param field_type The decider whether a halo update for conservatives or for
  * prime states is done.
+ * @param depth The number of halo cells updated normal to the boundaries.
  */
 void InternalHaloManager::MpiMaterialHaloUpdateJump(
     std::vector<MPI_Request> &requests,
@@ -776,7 +1203,7 @@ void InternalHaloManager::MpiMaterialHaloUpdateJump(
     std::vector<ExchangePlane> &jump_buffer_plane,
     std::vector<ExchangeStick> &jump_buffer_stick,
     std::vector<ExchangeCube> &jump_buffer_cube,
-    MaterialFieldType const field_type) {
+    MaterialFieldType const field_type, unsigned int const depth) {
   unsigned int jump_send_counter_plane = 0;
   unsigned int jump_send_counter_stick = 0;
   unsigned int jump_send_counter_cube = 0;
@@ -787,12 +1214,12 @@ void InternalHaloManager::MpiMaterialHaloUpdateJump(
 
     switch (std::get<2>(boundary)) {
     case InternalBoundaryType::JumpBoundaryMpiRecv: {
-      CommunicationStatistics::jump_halos_recv_++;
-      UpdateMaterialJumpMpiRecv(id, requests, location, field_type);
+      CommunicationStatistics::Instance().jump_halos_recv_++;
+      UpdateMaterialJumpMpiRecv(id, requests, location, field_type, depth);
     } break;
 #ifndef PERFORMANCE
     case InternalBoundaryType::JumpBoundaryMpiSend: {
-      CommunicationStatistics::jump_halos_send_++;
+      CommunicationStatistics::Instance().jump_halos_send_++;
       nid_t const parent_id = ParentIdOfNode(id);
 
       // buffer size is dependent on jump location
@@ -800,17 +1227,19 @@ void InternalHaloManager::MpiMaterialHaloUpdateJump(
         // Plane
         jump_send_counter_plane += UpdateMaterialJumpMpiSend(
             parent_id, requests, id,
-            &jump_buffer_plane[jump_send_counter_plane], location, field_type);
+            &jump_buffer_plane[jump_send_counter_plane], location, field_type,
+            depth);
       } else if (LTI(location) <= LTI(BoundaryLocation::SouthWest)) {
         // Stick
         jump_send_counter_stick += UpdateMaterialJumpMpiSend(
             parent_id, requests, id,
-            &jump_buffer_stick[jump_send_counter_stick], location, field_type);
+            &jump_buffer_stick[jump_send_counter_stick], location, field_type,
+            depth);
       } else {
         // Cube
         jump_send_counter_cube += UpdateMaterialJumpMpiSend(
             parent_id, requests, id, &jump_buffer_cube[jump_send_counter_cube],
-            location, field_type);
+            location, field_type, depth);
       }
     } break;
     default:
@@ -818,7 +1247,7 @@ void InternalHaloManager::MpiMaterialHaloUpdateJump(
                              "MPI, is noJump or is unknown");
 #else
     default: /* InternalBoundaryType::JumpBoundaryMpiSend */ {
-      CommunicationStatistics::jump_halos_send_++;
+      CommunicationStatistics::Instance().jump_halos_send_++;
       nid_t const parent_id = ParentIdOfNode(id);
 
       // buffer size is dependent on jump location
@@ -826,17 +1255,19 @@ void InternalHaloManager::MpiMaterialHaloUpdateJump(
         // Plane
         jump_send_counter_plane += UpdateMaterialJumpMpiSend(
             parent_id, requests, id,
-            &jump_buffer_plane[jump_send_counter_plane], location, field_type);
+            &jump_buffer_plane[jump_send_counter_plane], location, field_type,
+            depth);
       } else if (LTI(location) <= LTI(BoundaryLocation::SouthWest)) {
         // Stick
         jump_send_counter_stick += UpdateMaterialJumpMpiSend(
             parent_id, requests, id,
-            &jump_buffer_stick[jump_send_counter_stick], location, field_type);
+            &jump_buffer_stick[jump_send_counter_stick], location, field_type,
+            depth);
       } else {
         // Cube
         jump_send_counter_cube += UpdateMaterialJumpMpiSend(
             parent_id, requests, id, &jump_buffer_cube[jump_send_counter_cube],
-            location, field_type);
+            location, field_type, depth);
       }
     }
 #endif
@@ -861,50 +1292,534 @@ void InternalHaloManager::MpiMaterialHaloUpdateJump(
  * @param boundaries Description of internal boundaries without jump.
  * @param field_type The decider whether a halo update for conservatives or for
  * prime states is done.
+ * @param persistent Decider whether persistent (inactive) requests are created
+ * instead of starting the communication.
+ * @param depth The number of halo cells exchanged normal to the boundaries.
  */
 void InternalHaloManager::MpiMaterialHaloUpdateNoJump(
     std::vector<MPI_Request> &requests,
     std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const
         &boundaries,
-    MaterialFieldType const field_type) {
+    MaterialFieldType const field_type, bool const persistent,
+    unsigned int const depth) {
   for (auto const &boundary : boundaries) {
     nid_t id = std::get<0>(boundary);
     BoundaryLocation location = std::get<1>(boundary);
 
     switch (std::get<2>(boundary)) {
     case InternalBoundaryType::NoJumpBoundaryMpiSend: {
-      CommunicationStatistics::no_jump_halos_send_++;
-      UpdateMaterialHaloCellsMpiSend(id, requests, location, field_type);
+      CommunicationStatistics::Instance().no_jump_halos_send_++;
+      UpdateMaterialHaloCellsMpiSend(id, requests, location, field_type,
+                                     persistent, depth);
     } break;
 #ifndef PERFORMANCE
     case InternalBoundaryType::NoJumpBoundaryMpiRecv: {
-      CommunicationStatistics::no_jump_halos_recv_++;
-      UpdateMaterialHaloCellsMpiRecv(id, requests, location, field_type);
+      CommunicationStatistics::Instance().no_jump_halos_recv_++;
+      UpdateMaterialHaloCellsMpiRecv(id, requests, location, field_type,
+                                     persistent, depth);
     } break;
     default:
       throw std::logic_error(
           "Halo update: BoundaryType does not need MPI, is jump or is unknown");
 #else
     default: /* InternalBoundaryType::NoJumpBoundaryMpiRecv */ {
-      CommunicationStatistics::no_jump_halos_recv_++;
-      UpdateMaterialHaloCellsMpiRecv(id, requests, location, field_type);
+      CommunicationStatistics::Instance().no_jump_halos_recv_++;
+      UpdateMaterialHaloCellsMpiRecv(id, requests, location, field_type,
+                                     persistent, depth);
     }
 #endif
     }
   }
 }
 
+/**
+ * @brief Determines the partner ranks and sizes of the aggregated no-jump MPI
+ * halo update on the given level and allocates the contiguous buffers. All
+ * ranks list the boundaries in the same global order, hence the halos sent to
+ * a partner and received by it appear in the same order on both sides. The
+ * layout of the messages is determined for all halo depths, the buffers are
+ * sized for the full one.
+ * @param level The level of the halo update.
+ * @param field_type The decider whether a halo update for conservatives, prime
+ * states or parameters is done.
+ * @param messages The buffers to be set up (indirect return parameter).
+ */
+void InternalHaloManager::SetupAggregatedHaloMessages(
+    unsigned int const level, MaterialFieldType const field_type,
+    AggregatedHaloMessages &messages) {
+  // The receive buffers are reallocated below
+  communication_manager_.DetachOneSidedHaloBuffers(messages);
+  messages.partner_ranks_.clear();
+  messages.partner_index_of_rank_.assign(MpiUtilities::NumberOfRanks(), -1);
+  messages.boundary_offsets_.assign(CC::HS(), {});
+  messages.send_counts_.assign(CC::HS(), {});
+  messages.recv_counts_.assign(CC::HS(), {});
+
+  for (auto const &boundary :
+       communication_manager_.InternalBoundariesMpi(level)) {
+    nid_t const id = std::get<0>(boundary);
+    BoundaryLocation const location = std::get<1>(boundary);
+    TopologyNeighbor const neighbor = topology_.NeighborOfNode(id, location);
+    nid_t const neighbor_id = neighbor.id_;
+    int const rank_of_neighbor = neighbor.rank_;
+    if (messages.partner_index_of_rank_[rank_of_neighbor] < 0) {
+      messages.partner_index_of_rank_[rank_of_neighbor] =
+          messages.partner_ranks_.size();
+      messages.partner_ranks_.push_back(rank_of_neighbor);
+      for (unsigned int d = 0; d < CC::HS(); ++d) {
+        messages.send_counts_[d].push_back(0);
+        messages.recv_counts_[d].push_back(0);
+      }
+    }
+    std::size_t number_of_materials = 0;
+    for (auto const material : topology_.GetMaterialsOfNode(id)) {
+      if (topology_.NodeContainsMaterial(neighbor_id, material)) {
+        number_of_materials++;
+      }
+    }
+    int const partner = messages.partner_index_of_rank_[rank_of_neighbor];
+    bool const is_send =
+        std::get<2>(boundary) == InternalBoundaryType::NoJumpBoundaryMpiSend;
+    for (unsigned int d = 0; d < CC::HS(); ++d) {
+      auto const halo_size =
+          communication_manager_.GetHaloSize(location, d + 1);
+      std::size_t &size = is_send ? messages.send_counts_[d][partner]
+                                  : messages.recv_counts_[d][partner];
+      messages.boundary_offsets_[d].push_back(size);
+      size += number_of_materials * MF::ANOF(field_type) * halo_size[0] *
+              halo_size[1] * halo_size[2];
+    }
+  }
+  std::vector<std::size_t> const &send_sizes = messages.send_counts_.back();
+  std::vector<std::size_t> const &recv_sizes = messages.recv_counts_.back();
+
+  // Partners on the same compute node exchange through shared memory (only
+  // with shared-memory halo exchange), all others through messages
+  std::size_t const number_of_partners = messages.partner_ranks_.size();
+  auto const shares_memory = [this, &messages](std::size_t const partner) {
+    return communication_manager_.NodeRankOfRank(
+               messages.partner_ranks_[partner]) >= 0;
+  };
+  messages.send_buffers_.resize(number_of_partners);
+  messages.recv_buffers_.resize(number_of_partners);
+  messages.send_data_.assign(number_of_partners, nullptr);
+  messages.recv_data_.assign(number_of_partners, nullptr);
+  for (std::size_t partner = 0; partner < number_of_partners; ++partner) {
+    if (!shares_memory(partner)) {
+      messages.send_buffers_[partner].resize(send_sizes[partner]);
+      messages.recv_buffers_[partner].resize(recv_sizes[partner]);
+      messages.send_data_[partner] = messages.send_buffers_[partner].data();
+      messages.recv_data_[partner] = messages.recv_buffers_[partner].data();
+    }
+  }
+  if constexpr (CC::SharedMemoryHaloExchange()) {
+    SetupSharedHaloWindow(messages, send_sizes);
+  }
+
+  if (communication_manager_.OneSidedHaloExchange()) {
+    SetupOneSidedHaloWindow(messages);
+  } else if (CC::PersistentHaloRequests()) {
+    for (std::size_t partner = 0; partner < number_of_partners; ++partner) {
+      if (!shares_memory(partner)) {
+        communication_manager_.RecvInit(
+            messages.recv_buffers_[partner].data(),
+            messages.recv_buffers_[partner].size(), MPI_DOUBLE,
+            messages.partner_ranks_[partner], messages.requests_);
+      }
+    }
+    for (std::size_t partner = 0; partner < number_of_partners; ++partner) {
+      if (!shares_memory(partner)) {
+        communication_manager_.SendInit(
+            messages.send_buffers_[partner].data(),
+            messages.send_buffers_[partner].size(), MPI_DOUBLE,
+            messages.partner_ranks_[partner], messages.requests_);
+      }
+    }
+  }
+  messages.valid_ = true;
+}
+
+/**
+ * @brief Allocates the shared-memory window holding the aggregated halo data
+ * sent to partners on the same compute node. Each rank packs into its own
+ * window, its partners read directly from there. Thus, the halos are copied
+ * once into and once out of the window, without any message.
+ * @param messages The buffers of the aggregated halo update, the partners must
+ * be set up (indirect return parameter).
+ * @param send_sizes The number of values sent to each partner.
+ * @note Collective on the node communicator. All ranks of a compute node set up
+ * the same aggregated halo updates at the same time.
+ */
+void InternalHaloManager::SetupSharedHaloWindow(
+    AggregatedHaloMessages &messages,
+    std::vector<std::size_t> const &send_sizes) {
+  communication_manager_.FreeSharedHaloWindow(messages);
+  std::size_t const number_of_partners = messages.partner_ranks_.size();
+  std::vector<unsigned long long int> window_offsets(number_of_partners, 0);
+  unsigned long long int window_size = 0;
+  for (std::size_t partner = 0; partner < number_of_partners; ++partner) {
+    if (communication_manager_.NodeRankOfRank(
+            messages.partner_ranks_[partner]) >= 0) {
+      window_offsets[partner] = window_size;
+      window_size += send_sizes[partner];
+    }
+  }
+  double *window_base = nullptr;
+  MPI_Win_allocate_shared(static_cast<MPI_Aint>(window_size * sizeof(double)),
+                          sizeof(double), MPI_INFO_NULL,
+                          communication_manager_.NodeCommunicator(),
+                          &window_base, &messages.shared_window_);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, messages.shared_window_);
+
+  // The receivers learn where their data lies in the window of the sender. The
+  // lower rank of a pair sends first to keep the tags of both in sync
+  std::vector<unsigned long long int> partner_offsets(number_of_partners, 0);
+  std::vector<MPI_Request> requests;
+  int const my_rank = communication_manager_.MyRankId();
+  for (std::size_t partner = 0; partner < number_of_partners; ++partner) {
+    int const partner_rank = messages.partner_ranks_[partner];
+    if (communication_manager_.NodeRankOfRank(partner_rank) < 0) {
+      continue;
+    }
+    auto const send = [&]() {
+      communication_manager_.Send(&window_offsets[partner], 1,
+                                  MPI_UNSIGNED_LONG_LONG, partner_rank,
+                                  requests);
+    };
+    auto const recv = [&]() {
+      communication_manager_.Recv(&partner_offsets[partner], 1,
+                                  MPI_UNSIGNED_LONG_LONG, partner_rank,
+                                  requests);
+    };
+    if (my_rank < partner_rank) {
+      send();
+      recv();
+    } else {
+      recv();
+      send();
+    }
+  }
+  communication_manager_.WaitAll(requests);
+
+  for (std::size_t partner = 0; partner < number_of_partners; ++partner) {
+    int const node_rank =
+        communication_manager_.NodeRankOfRank(messages.partner_ranks_[partner]);
+    if (node_rank < 0) {
+      continue;
+    }
+    MPI_Aint partner_window_size = 0;
+    int displacement_unit = 0;
+    double *partner_base = nullptr;
+    MPI_Win_shared_query(messages.shared_window_, node_rank,
+                         &partner_window_size, &displacement_unit,
+                         &partner_base);
+    messages.send_data_[partner] = window_base + window_offsets[partner];
+    messages.recv_data_[partner] = partner_base + partner_offsets[partner];
+  }
+}
+
+/**
+ * @brief Attaches the receive buffers of an aggregated halo update to the
+ * one-sided window and exchanges their addresses with the partners, such that
+ * the partners put their halos directly into the buffers. Partners on the same
+ * compute node keep exchanging through shared memory ( if active ). The
+ * exposure and access groups only contain partners with data to exchange.
+ * @param messages The buffers of the aggregated halo update, the partners and
+ * buffers must be set up (indirect return parameter).
+ * @note The window is created once by the CommunicationManager, the buffers
+ * are attached per topology epoch. Hence, the setup is a local operation apart
+ * from the address exchange with the partners.
+ */
+void InternalHaloManager::SetupOneSidedHaloWindow(
+    AggregatedHaloMessages &messages) {
+  MPI_Win const window = communication_manager_.OneSidedWindow();
+  std::size_t const number_of_partners = messages.partner_ranks_.size();
+  std::vector<MPI_Aint> recv_addresses(number_of_partners, 0);
+  messages.remote_recv_addresses_.assign(number_of_partners, 0);
+  std::vector<int> exposure_ranks;
+  std::vector<int> access_ranks;
+  for (std::size_t partner = 0; partner < number_of_partners; ++partner) {
+    int const partner_rank = messages.partner_ranks_[partner];
+    if (communication_manager_.NodeRankOfRank(partner_rank) >= 0) {
+      continue;
+    }
+    std::vector<double> &recv_buffer = messages.recv_buffers_[partner];
+    if (!recv_buffer.empty()) {
+      MPI_Aint const bytes = recv_buffer.size() * sizeof(double);
+      MPI_Win_attach(window, recv_buffer.data(), bytes);
+      MPI_Get_address(recv_buffer.data(), &recv_addresses[partner]);
+      exposure_ranks.push_back(partner_rank);
+    }
+    if (!messages.send_buffers_[partner].empty()) {
+      access_ranks.push_back(partner_rank);
+    }
+  }
+  messages.attached_ = true;
+
+  // The lower rank of a pair sends first to keep the tags of both in sync
+  std::vector<MPI_Request> requests;
+  int const my_rank = communication_manager_.MyRankId();
+  for (std::size_t partner = 0; partner < number_of_partners; ++partner) {
+    int const partner_rank = messages.partner_ranks_[partner];
+    if (communication_manager_.NodeRankOfRank(partner_rank) >= 0) {
+      continue;
+    }
+    auto const send = [&]() {
+      communication_manager_.Send(&recv_addresses[partner], 1, MPI_AINT,
+                                  partner_rank, requests);
+    };
+    auto const recv = [&]() {
+      communication_manager_.Recv(&messages.remote_recv_addresses_[partner], 1,
+                                  MPI_AINT, partner_rank, requests);
+    };
+    if (my_rank < partner_rank) {
+      send();
+      recv();
+    } else {
+      recv();
+      send();
+    }
+  }
+  communication_manager_.WaitAll(requests);
+
+  MPI_Group group;
+  MPI_Comm_group(MpiUtilities::Communicator(), &group);
+  MPI_Group_incl(group, exposure_ranks.size(), exposure_ranks.data(),
+                 &messages.exposure_group_);
+  MPI_Group_incl(group, access_ranks.size(), access_ranks.data(),
+                 &messages.access_group_);
+  MPI_Group_free(&group);
+}
+
+/**
+ * @brief Puts the packed aggregated halos into the receive buffers of the
+ * partners. The receive buffers of this rank are exposed to the partners at
+ * the same time, the exposure epoch is closed once all partners have put their
+ * halos ( see MaterialHaloUpdateOnLevelArrived and
+ * MaterialHaloUpdateOnLevelFinish ). Neither matching nor tags are involved.
+ * @param depth The number of halo cells exchanged normal to the boundaries.
+ * @param messages The packed buffers of the aggregated halo update.
+ * @param pending The pending update the exposure epoch is registered in.
+ * @note The access epoch is completed before returning, which waits until all
+ * partners have started the same update. The receive buffers are not read
+ * anymore at this point, as the previous update was unpacked in its finish.
+ */
+void InternalHaloManager::PutOneSidedHaloMessages(
+    unsigned int const depth, AggregatedHaloMessages &messages,
+    PendingMaterialHaloUpdate &pending) {
+  MPI_Win const window = communication_manager_.OneSidedWindow();
+  MPI_Win_post(messages.exposure_group_, 0, window);
+  MPI_Win_start(messages.access_group_, 0, window);
+  for (std::size_t partner = 0; partner < messages.partner_ranks_.size();
+       ++partner) {
+    int const partner_rank = messages.partner_ranks_[partner];
+    if (communication_manager_.NodeRankOfRank(partner_rank) >= 0 ||
+        messages.send_buffers_[partner].empty()) {
+      continue;
+    }
+    int const count = messages.send_counts_[depth - 1][partner];
+    MPI_Put(messages.send_buffers_[partner].data(), count, MPI_DOUBLE,
+            partner_rank, messages.remote_recv_addresses_[partner], count,
+            MPI_DOUBLE, window);
+  }
+  MPI_Win_complete(window);
+  pending.exposure_window_ = window;
+}
+
+/**
+ * @brief Packs all no-jump halo data sent to other ranks into one buffer per
+ * partner rank and starts the communication of the aggregated messages. The
+ * position of each halo in the buffers is known from the setup, hence, the
+ * halos are packed independently of each other (by all threads of the rank if
+ * compiled with OpenMP). Halos of reduced depth are packed at the beginning of
+ * the buffers and sent with one-off requests instead of the persistent ones.
+ * @param level The level of the halo update.
+ * @param field_type The decider whether a halo update for conservatives, prime
+ * states or parameters is done.
+ * @param pending The pending update the messages are registered in, holds the
+ * halo depth.
+ */
+void InternalHaloManager::StartAggregatedHaloMessages(
+    unsigned int const level, MaterialFieldType const field_type,
+    PendingMaterialHaloUpdate &pending) {
+  AggregatedHaloMessages &messages =
+      communication_manager_.AggregatedHaloMessagesOnLevel(level, field_type);
+  if (!messages.valid_) {
+    SetupAggregatedHaloMessages(level, field_type, messages);
+  }
+  unsigned int const depth = pending.depth_;
+
+  RuntimeProfiler &profiler = RuntimeProfiler::Instance();
+  profiler.Start("PackHalos");
+  auto const &boundaries = communication_manager_.InternalBoundariesMpi(level);
+  CountMpiHaloUpdateNoJump(boundaries);
+  long const number_of_boundaries = static_cast<long>(boundaries.size());
+#pragma omp parallel for schedule(dynamic)
+  for (long boundary_index = 0; boundary_index < number_of_boundaries;
+       ++boundary_index) {
+    auto const &boundary = boundaries[boundary_index];
+    if (std::get<2>(boundary) != InternalBoundaryType::NoJumpBoundaryMpiSend) {
+      continue;
+    }
+    nid_t const id = std::get<0>(boundary);
+    BoundaryLocation const location = std::get<1>(boundary);
+    TopologyNeighbor const neighbor = topology_.NeighborOfNode(id, location);
+    nid_t const neighbor_id = neighbor.id_;
+    int const partner = messages.partner_index_of_rank_[neighbor.rank_];
+    double *const buffer = messages.send_data_[partner];
+    std::size_t offset = messages.boundary_offsets_[depth - 1][boundary_index];
+    auto const start =
+        communication_manager_.GetStartIndicesHaloSend(location, depth);
+    auto const size = communication_manager_.GetHaloSize(location, depth);
+    Node const &node = tree_.GetNodeWithId(id);
+    for (auto const material : topology_.GetMaterialsOfNode(id)) {
+      if (topology_.NodeContainsMaterial(neighbor_id, material)) {
+        Block const &block = node.GetPhaseByMaterial(material);
+        for (unsigned int f = 0; f < MF::ANOF(field_type); ++f) {
+          block.VisitFieldBuffer(field_type, f, [&](auto const &field) {
+            for (int i = start[0]; i < start[0] + size[0]; ++i) {
+              for (int j = start[1]; j < start[1] + size[1]; ++j) {
+                for (int k = start[2]; k < start[2] + size[2]; ++k) {
+                  buffer[offset++] = field[i][j][k];
+                }
+              }
+            }
+          });
+        }
+      }
+    }
+  }
+  profiler.Stop();
+  if (messages.shared_window_ != MPI_WIN_NULL) {
+    // The partners on the node may read once all ranks of the node have packed
+    ProfileRegion const region("SharedMemoryHalos");
+    MPI_Win_sync(messages.shared_window_);
+    MPI_Barrier(communication_manager_.NodeCommunicator());
+    MPI_Win_sync(messages.shared_window_);
+  }
+
+  if (communication_manager_.OneSidedHaloExchange()) {
+    PutOneSidedHaloMessages(depth, messages, pending);
+  } else if (CC::PersistentHaloRequests() && depth == CC::HS()) {
+    communication_manager_.StartPersistent(messages.requests_);
+    pending.persistent_requests_ = &messages.requests_;
+  } else {
+    // The lower rank of a pair sends first to keep the tags of both in sync
+    int const my_rank = communication_manager_.MyRankId();
+    for (std::size_t partner = 0; partner < messages.partner_ranks_.size();
+         ++partner) {
+      int const partner_rank = messages.partner_ranks_[partner];
+      if (communication_manager_.NodeRankOfRank(partner_rank) >= 0) {
+        continue;
+      }
+      auto const send = [&]() {
+        communication_manager_.Send(messages.send_buffers_[partner].data(),
+                                    messages.send_counts_[depth - 1][partner],
+                                    MPI_DOUBLE, partner_rank,
+                                    pending.requests_);
+      };
+      auto const recv = [&]() {
+        communication_manager_.Recv(messages.recv_buffers_[partner].data(),
+                                    messages.recv_counts_[depth - 1][partner],
+                                    MPI_DOUBLE, partner_rank,
+                                    pending.requests_);
+      };
+      if (my_rank < partner_rank) {
+        send();
+        recv();
+      } else {
+        recv();
+        send();
+      }
+    }
+  }
+  pending.aggregated_messages_ = &messages;
+}
+
+/**
+ * @brief Distributes the received aggregated messages into the halo cells of
+ * the receiving nodes. Must only be called after the receives are completed.
+ * The halos are unpacked independently of each other, see
+ * StartAggregatedHaloMessages.
+ * @param level The level of the halo update.
+ * @param field_type The decider whether a halo update for conservatives, prime
+ * states or parameters is done.
+ * @param depth The number of halo cells received normal to the boundaries.
+ * @param messages The buffers holding the received data.
+ */
+void InternalHaloManager::UnpackAggregatedHaloMessages(
+    unsigned int const level, MaterialFieldType const field_type,
+    unsigned int const depth, AggregatedHaloMessages const &messages) {
+  ProfileRegion const region("UnpackHalos");
+  auto const &boundaries = communication_manager_.InternalBoundariesMpi(level);
+  long const number_of_boundaries = static_cast<long>(boundaries.size());
+#pragma omp parallel for schedule(dynamic)
+  for (long boundary_index = 0; boundary_index < number_of_boundaries;
+       ++boundary_index) {
+    auto const &boundary = boundaries[boundary_index];
+    if (std::get<2>(boundary) == InternalBoundaryType::NoJumpBoundaryMpiSend) {
+      continue;
+    }
+    nid_t const id = std::get<0>(boundary);
+    BoundaryLocation const location = std::get<1>(boundary);
+    TopologyNeighbor const neighbor = topology_.NeighborOfNode(id, location);
+    nid_t const neighbor_id = neighbor.id_;
+    int const partner = messages.partner_index_of_rank_[neighbor.rank_];
+    double const *const buffer = messages.recv_data_[partner];
+    std::size_t offset = messages.boundary_offsets_[depth - 1][boundary_index];
+    auto const start =
+        communication_manager_.GetStartIndicesHaloRecv(location, depth);
+    auto const size = communication_manager_.GetHaloSize(location, depth);
+    Node &node = tree_.GetNodeWithId(id);
+    for (auto const material : topology_.GetMaterialsOfNode(id)) {
+      if (topology_.NodeContainsMaterial(neighbor_id, material)) {
+        Block &block = node.GetPhaseByMaterial(material);
+        for (unsigned int f = 0; f < MF::ANOF(field_type); ++f) {
+          block.VisitFieldBuffer(field_type, f, [&](auto &field) {
+            for (int i = start[0]; i < start[0] + size[0]; ++i) {
+              for (int j = start[1]; j < start[1] + size[1]; ++j) {
+                for (int k = start[2]; k < start[2] + size[2]; ++k) {
+                  field[i][j][k] = buffer[offset++];
+                }
+              }
+            }
+          });
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Updates the communication statistics for a no-jump MPI halo update
+ * carried out with persistent requests or aggregated messages.
+ * @param boundaries Description of internal boundaries without jump.
+ */
+void InternalHaloManager::CountMpiHaloUpdateNoJump(
+    std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const
+        &boundaries) const {
+  for (auto const &boundary : boundaries) {
+    if (std::get<2>(boundary) == InternalBoundaryType::NoJumpBoundaryMpiSend) {
+      CommunicationStatistics::Instance().no_jump_halos_send_++;
+    } else {
+      CommunicationStatistics::Instance().no_jump_halos_recv_++;
+    }
+  }
+}
+
 /**
  * @brief Method used to execute the Halo Update for all boundaries without MPI
  * Communication.
  * @param boundaries description of internal boundaries, either jump or no jump.
  * @param field_type The decider whether a halo update for conservatives or for
  * prime states is done.
+ * @param jump_depth The number of jump halo cells predicted normal to the
+ * boundaries. No-jump halos are always updated completely.
  */
 void InternalHaloManager::NoMpiMaterialHaloUpdate(
     std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const
         &boundaries,
-    MaterialFieldType const field_type) {
+    MaterialFieldType const field_type, unsigned int const jump_depth) {
   for (auto const &boundary : boundaries) {
     InternalBoundaryType const type = std::get<2>(boundary);
     nid_t const id = std::get<0>(boundary);
@@ -912,7 +1827,7 @@ void InternalHaloManager::NoMpiMaterialHaloUpdate(
 
     switch (type) {
     case InternalBoundaryType::JumpBoundaryLocal: {
-      UpdateMaterialJumpNoMpi(id, location, field_type);
+      UpdateMaterialJumpNoMpi(id, location, field_type, jump_depth);
     } break;
 #ifndef PERFORMANCE
     case InternalBoundaryType::NoJumpBoundaryLocal: {
@@ -928,22 +1843,49 @@ void InternalHaloManager::NoMpiMaterialHaloUpdate(
   }
 }
 
+/**
+ * @brief Fills the halos of all boundaries that are not exchanged with the
+ * closest internal value.
+ * @param boundaries Node ids and halo locations to be filled.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ */
+void InternalHaloManager::ExtendMaterialHalos(
+    std::vector<std::tuple<nid_t, BoundaryLocation>> const &boundaries,
+    MaterialFieldType const field_type) {
+  unsigned int const number_of_fields = MF::ANOF(field_type);
+  for (auto const &[id, location] : boundaries) {
+    for (auto &phase : tree_.GetNodeWithId(id).GetPhases()) {
+      Block &block = phase.second;
+      for (unsigned int field_index = 0; field_index < number_of_fields;
+           ++field_index) {
+        block.VisitFieldBuffer(field_type, field_index, [&](auto &cells) {
+          ExtendClosestInternalValue(cells, location);
+        });
+      }
+    }
+  }
+}
+
 /**
  * @brief Executes the Interface tag halo update for all boundaries that do not
  * need communication.
  * @param boundaries Boundaries to be updated.
  * @param buffer_type Level-set buffer type on which the update is done.
+ * @param frozen_nodes Sorted ids of nodes whose halos are not updated.
  */
 void InternalHaloManager::NoMpiInterfaceTagHaloUpdate(
     std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const
         &boundaries,
-    InterfaceDescriptionBufferType const buffer_type) {
+    InterfaceDescriptionBufferType const buffer_type,
+    std::vector<nid_t> const &frozen_nodes) {
   for (auto const &boundary : boundaries) {
     nid_t const id = std::get<0>(boundary);
     BoundaryLocation const location = std::get<1>(boundary);
     InternalBoundaryType const type = std::get<2>(boundary);
 
-    if (type != InternalBoundaryType::JumpBoundaryMpiSend) {
+    if (type != InternalBoundaryType::JumpBoundaryMpiSend &&
+        !std::binary_search(frozen_nodes.begin(), frozen_nodes.end(), id)) {
       // jump/no_jump is dealt within the boundary condition, but there is no
       // need to project jumps from the parent, therefore it is ignored here.
       UpdateInterfaceTagHaloCellsNoMpi(id, buffer_type, location);
@@ -956,30 +1898,35 @@ void InternalHaloManager::NoMpiInterfaceTagHaloUpdate(
  * communication.
  * @param boundaries Boundaries to be updated.
  * @param type Level-set buffer type on which the update is done.
+ * @param tag_messages Storage of the compressed interface tag halo messages.
  */
 void InternalHaloManager::MpiInterfaceTagHaloUpdate(
     std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const
         &boundaries,
     InterfaceDescriptionBufferType const type,
-    std::vector<MPI_Request> &requests) {
+    std::vector<MPI_Request> &requests,
+    InterfaceTagHaloMessages &tag_messages) {
   for (auto const &boundary : boundaries) {
     BoundaryLocation const location = std::get<1>(boundary);
     nid_t const id = std::get<0>(boundary);
 
     switch (std::get<2>(boundary)) {
     case InternalBoundaryType::NoJumpBoundaryMpiSend:
-      UpdateInterfaceTagHaloCellsMpiSend(id, requests, type, location);
+      UpdateInterfaceTagHaloCellsMpiSend(id, requests, type, location,
+                                         tag_messages);
       break;
 #ifndef PERFORMANCE
     case InternalBoundaryType::NoJumpBoundaryMpiRecv:
-      UpdateInterfaceTagHaloCellsMpiRecv(id, requests, type, location);
+      UpdateInterfaceTagHaloCellsMpiRecv(id, requests, type, location,
+                                         tag_messages);
       break;
     default:
       throw std::logic_error("BoundaryManager::MpiInterfaceTagHaloUpdate: "
                              "BoundaryType not supported");
 #else
     default: /* InternalBoundaryType::NoJumpBoundaryMpiRecv */ {
-      UpdateInterfaceTagHaloCellsMpiRecv(id, requests, type, location);
+      UpdateInterfaceTagHaloCellsMpiRecv(id, requests, type, location,
+                                         tag_messages);
     }
 #endif
     }
@@ -992,17 +1939,20 @@ void InternalHaloManager::MpiInterfaceTagHaloUpdate(
  * @param boundaries Boundaries to be updated.
  * @param buffer_type Type of buffer on the levelset block that should be
  * updated.
+ * @param frozen_nodes Sorted ids of nodes whose halos are not updated.
  */
 void InternalHaloManager::NoMpiInterfaceHaloUpdate(
     std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const
         &boundaries,
-    InterfaceBlockBufferType const buffer_type) {
+    InterfaceBlockBufferType const buffer_type,
+    std::vector<nid_t> const &frozen_nodes) {
   for (auto const &boundary : boundaries) {
     nid_t const id = std::get<0>(boundary);
     BoundaryLocation const location = std::get<1>(boundary);
     InternalBoundaryType const type = std::get<2>(boundary);
 
-    if (type != InternalBoundaryType::JumpBoundaryMpiSend) {
+    if (type != InternalBoundaryType::JumpBoundaryMpiSend &&
+        !std::binary_search(frozen_nodes.begin(), frozen_nodes.end(), id)) {
       // jump/no_jump is dealt within the boundary condition, but there is no
       // need to project jumps from the parent, therefore it is ignored here.
       UpdateInterfaceHaloCellsNoMpi(id, buffer_type, location);
@@ -1016,31 +1966,36 @@ void InternalHaloManager::NoMpiInterfaceHaloUpdate(
  * @param boundaries Boundaries to be updated.
  * @param buffer_type Type of buffer on the levelset block that should be
  * updated.
+ * @param sparse_messages Storage of the messages of sparse level-set halos.
  */
 void InternalHaloManager::MpiInterfaceHaloUpdate(
     std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const
         &boundaries,
     InterfaceBlockBufferType const buffer_type,
-    std::vector<MPI_Request> &requests) {
+    std::vector<MPI_Request> &requests,
+    SparseInterfaceHaloMessages &sparse_messages) {
   for (auto const &boundary : boundaries) {
     BoundaryLocation const location = std::get<1>(boundary);
     nid_t const id = std::get<0>(boundary);
 
     switch (std::get<2>(boundary)) {
     case InternalBoundaryType::NoJumpBoundaryMpiSend: {
-      UpdateInterfaceHaloCellsMpiSend(id, requests, buffer_type, location);
+      UpdateInterfaceHaloCellsMpiSend(id, requests, buffer_type, location,
+                                      sparse_messages);
     } break;
 
 #ifndef PERFORMANCE
     case InternalBoundaryType::NoJumpBoundaryMpiRecv: {
-      UpdateInterfaceHaloCellsMpiRecv(id, requests, buffer_type, location);
+      UpdateInterfaceHaloCellsMpiRecv(id, requests, buffer_type, location,
+                                      sparse_messages);
     } break;
     default:
       throw std::logic_error("BoundaryManager::MpiInterfaceHaloUpdate: "
                              "BoundaryType not supported");
 #else
     default: /* InternalBoundaryType::NoJumpBoundaryLocal */
-      UpdateInterfaceHaloCellsMpiRecv(id, requests, buffer_type, location);
+      UpdateInterfaceHaloCellsMpiRecv(id, requests, buffer_type, location,
+                                      sparse_messages);
 #endif
     }
   }
@@ -24,6 +24,56 @@
 
 #include "communication/communication_manager.h"
 #include "communication/communication_statistics.h"
+#include <functional>
+
+/**
+ * @brief Bundles the state of a material halo update whose MPI communication
+ * has been posted but not yet completed. The jump buffers must be kept alive
+ * until the requests are completed. Nodes listed in nodes_in_flight_ must not
+ * be touched before the update is finished.
+ */
+struct PendingMaterialHaloUpdate {
+  unsigned int level_ = 0;
+  std::vector<MPI_Request> requests_;
+  // started persistent requests owned by the CommunicationManager (if any)
+  std::vector<MPI_Request> *persistent_requests_ = nullptr;
+  // buffers of an aggregated update owned by the CommunicationManager (if any)
+  AggregatedHaloMessages *aggregated_messages_ = nullptr;
+  // window whose exposure epoch receives the one-sided halos (if any)
+  MPI_Win exposure_window_ = MPI_WIN_NULL;
+  MaterialFieldType field_type_ = MaterialFieldType::Conservatives;
+  // number of no-jump halo cells exchanged normal to the boundaries
+  unsigned int depth_ = CC::HS();
+  std::vector<ExchangePlane> jump_buffer_plane_;
+  std::vector<ExchangeStick> jump_buffer_stick_;
+  std::vector<ExchangeCube> jump_buffer_cube_;
+  // sorted ids of local nodes on level_ whose buffers are used by requests_
+  std::vector<nid_t> nodes_in_flight_;
+};
+
+/**
+ * @brief Bundles the messages of the sparse level-set halos exchanged via MPI.
+ * The messages must be kept alive until the requests are completed, the
+ * received ones are unpacked afterwards.
+ */
+struct SparseInterfaceHaloMessages {
+  std::vector<std::vector<double>> send_messages_;
+  std::vector<std::vector<double>> recv_messages_;
+  // receiving node and location of each received message
+  std::vector<std::tuple<nid_t, BoundaryLocation>> receivers_;
+};
+
+/**
+ * @brief Bundles the compressed interface tag halo messages exchanged via MPI
+ * ( see CC::CompressedInterfaceTagHalos() ). The messages must be kept alive
+ * until the requests are completed, the received ones are unpacked afterwards.
+ */
+struct InterfaceTagHaloMessages {
+  std::vector<std::vector<std::int8_t>> send_messages_;
+  std::vector<std::vector<std::int8_t>> recv_messages_;
+  // receiving node and location of each received message
+  std::vector<std::tuple<nid_t, BoundaryLocation>> receivers_;
+};
 
 /**
  * @brief The InternalHaloManager is used within the domain, i.e. a classical
@@ -42,6 +92,10 @@ private:
       &communication_manager_; // Cannot be const (for now NH TODO-19) because
                                // of new tagging system.
   unsigned int const number_of_materials_;
+  // state of the blocking halo updates, kept between the calls such that the
+  // request lists and jump buffers are reused instead of allocated anew
+  PendingMaterialHaloUpdate level_update_;
+  std::vector<MPI_Request> requests_;
 
   // Helper function for the local halo filling of special buffers
   template <class T>
@@ -55,46 +109,59 @@ private:
   ExtendClosestInternalValue(T (&host_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
                              BoundaryLocation const loc) const;
 
-  unsigned int UpdateMaterialJumpMpiSend(nid_t id,
-                                         std::vector<MPI_Request> &requests,
-                                         nid_t const remote_child_id,
-                                         void *send_buffer,
-                                         BoundaryLocation const loc,
-                                         MaterialFieldType const filed_type);
+  unsigned int UpdateMaterialJumpMpiSend(
+      nid_t id, std::vector<MPI_Request> &requests, nid_t const remote_child_id,
+      void *send_buffer, BoundaryLocation const loc,
+      MaterialFieldType const filed_type, unsigned int const depth = CC::HS());
   void UpdateMaterialJumpMpiRecv(nid_t id, std::vector<MPI_Request> &requests,
                                  BoundaryLocation const loc,
-                                 MaterialFieldType const field_type);
+                                 MaterialFieldType const field_type,
+                                 unsigned int const depth = CC::HS());
   void UpdateMaterialJumpNoMpi(nid_t id, BoundaryLocation const loc,
-                               MaterialFieldType const field_type);
+                               MaterialFieldType const field_type,
+                               unsigned int const depth = CC::HS());
   void UpdateMaterialHaloCellsMpiSend(nid_t id,
                                       std::vector<MPI_Request> &requests,
                                       BoundaryLocation const loc,
-                                      MaterialFieldType const field_type);
+                                      MaterialFieldType const field_type,
+                                      bool const persistent = false,
+                                      unsigned int const depth = CC::HS());
   void UpdateMaterialHaloCellsMpiRecv(nid_t id,
                                       std::vector<MPI_Request> &requests,
                                       BoundaryLocation const loc,
-                                      MaterialFieldType const field_type);
+                                      MaterialFieldType const field_type,
+                                      bool const persistent = false,
+                                      unsigned int const depth = CC::HS());
   void UpdateMaterialHaloCellsNoMpi(nid_t id, BoundaryLocation const loc,
                                     MaterialFieldType const field_type);
 
   void
   UpdateInterfaceHaloCellsMpiSend(nid_t id, std::vector<MPI_Request> &requests,
                                   InterfaceBlockBufferType const buffer_type,
-                                  BoundaryLocation const loc);
+                                  BoundaryLocation const loc,
+                                  SparseInterfaceHaloMessages &sparse_messages);
   void
   UpdateInterfaceHaloCellsMpiRecv(nid_t id, std::vector<MPI_Request> &requests,
                                   InterfaceBlockBufferType const buffer_type,
-                                  BoundaryLocation const loc);
+                                  BoundaryLocation const loc,
+                                  SparseInterfaceHaloMessages &sparse_messages);
+  void UnpackSparseInterfaceHalos(
+      InterfaceBlockBufferType const buffer_type,
+      SparseInterfaceHaloMessages const &sparse_messages);
   void UpdateInterfaceHaloCellsNoMpi(nid_t id,
                                      InterfaceBlockBufferType const buffer_type,
                                      BoundaryLocation const loc);
 
   void UpdateInterfaceTagHaloCellsMpiSend(
       nid_t id, std::vector<MPI_Request> &requests,
-      InterfaceDescriptionBufferType const type, BoundaryLocation const loc);
+      InterfaceDescriptionBufferType const type, BoundaryLocation const loc,
+      InterfaceTagHaloMessages &tag_messages);
   void UpdateInterfaceTagHaloCellsMpiRecv(
       nid_t id, std::vector<MPI_Request> &requests,
-      InterfaceDescriptionBufferType const type, BoundaryLocation const loc);
+      InterfaceDescriptionBufferType const type, BoundaryLocation const loc,
+      InterfaceTagHaloMessages &tag_messages);
+  void UnpackInterfaceTagHalos(InterfaceDescriptionBufferType const type,
+                               InterfaceTagHaloMessages const &tag_messages);
   void UpdateInterfaceTagHaloCellsNoMpi(
       nid_t id, InterfaceDescriptionBufferType const buffer_type,
       BoundaryLocation const loc);
@@ -103,10 +170,35 @@ private:
       std::vector<MPI_Request> &requests,
       std::vector<std::tuple<nid_t, BoundaryLocation,
                              InternalBoundaryType>> const &no_jump_boundaries,
-      MaterialFieldType const field_type);
+      MaterialFieldType const field_type, bool const persistent = false,
+      unsigned int const depth = CC::HS());
+  void CountMpiHaloUpdateNoJump(
+      std::vector<
+          std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const
+          &no_jump_boundaries) const;
+  void SetupAggregatedHaloMessages(unsigned int const level,
+                                   MaterialFieldType const field_type,
+                                   AggregatedHaloMessages &messages);
+  void SetupSharedHaloWindow(AggregatedHaloMessages &messages,
+                             std::vector<std::size_t> const &send_sizes);
+  void SetupOneSidedHaloWindow(AggregatedHaloMessages &messages);
+  void PutOneSidedHaloMessages(unsigned int const depth,
+                               AggregatedHaloMessages &messages,
+                               PendingMaterialHaloUpdate &pending);
+  void StartAggregatedHaloMessages(unsigned int const level,
+                                   MaterialFieldType const field_type,
+                                   PendingMaterialHaloUpdate &pending);
+  void UnpackAggregatedHaloMessages(unsigned int const level,
+                                    MaterialFieldType const field_type,
+                                    unsigned int const depth,
+                                    AggregatedHaloMessages const &messages);
   void NoMpiMaterialHaloUpdate(
       std::vector<std::tuple<nid_t, BoundaryLocation,
                              InternalBoundaryType>> const &boundaries,
+      MaterialFieldType const field_type,
+      unsigned int const jump_depth = CC::HS());
+  void ExtendMaterialHalos(
+      std::vector<std::tuple<nid_t, BoundaryLocation>> const &boundaries,
       MaterialFieldType const field_type);
   void MpiMaterialHaloUpdateJump(
       std::vector<MPI_Request> &requests,
@@ -115,28 +207,32 @@ private:
       std::vector<ExchangePlane> &jump_buffer_plane,
       std::vector<ExchangeStick> &jump_buffer_stick,
       std::vector<ExchangeCube> &jump_buffer_cube,
-      MaterialFieldType const field_type);
+      MaterialFieldType const field_type, unsigned int const depth = CC::HS());
 
   void NoMpiInterfaceTagHaloUpdate(
       std::vector<std::tuple<nid_t, BoundaryLocation,
                              InternalBoundaryType>> const &boundaries,
-      InterfaceDescriptionBufferType const type);
+      InterfaceDescriptionBufferType const type,
+      std::vector<nid_t> const &frozen_nodes);
 
   void MpiInterfaceTagHaloUpdate(
       std::vector<std::tuple<nid_t, BoundaryLocation,
                              InternalBoundaryType>> const &boundaries,
       InterfaceDescriptionBufferType const type,
-      std::vector<MPI_Request> &requests);
+      std::vector<MPI_Request> &requests,
+      InterfaceTagHaloMessages &tag_messages);
 
   void NoMpiInterfaceHaloUpdate(
       std::vector<std::tuple<nid_t, BoundaryLocation,
                              InternalBoundaryType>> const &boundaries,
-      InterfaceBlockBufferType const buffer_type);
+      InterfaceBlockBufferType const buffer_type,
+      std::vector<nid_t> const &frozen_nodes);
   void MpiInterfaceHaloUpdate(
       std::vector<std::tuple<nid_t, BoundaryLocation,
                              InternalBoundaryType>> const &boundaries,
       InterfaceBlockBufferType const buffer_type,
-      std::vector<MPI_Request> &requests);
+      std::vector<MPI_Request> &requests,
+      SparseInterfaceHaloMessages &sparse_messages);
 
 public:
   InternalHaloManager() = delete;
@@ -151,15 +247,32 @@ public:
 
   void MaterialHaloUpdateOnLevel(unsigned int const level,
                                  MaterialFieldType const field_type,
-                                 bool const cut_jumps);
+                                 bool const cut_jumps,
+                                 unsigned int const depth = CC::HS());
+
+  void MaterialHaloUpdateOnLevelBegin(unsigned int const level,
+                                      MaterialFieldType const field_type,
+                                      bool const cut_jumps,
+                                      PendingMaterialHaloUpdate &pending,
+                                      unsigned int const depth = CC::HS());
+  bool MaterialHaloUpdateOnLevelArrived(PendingMaterialHaloUpdate &pending);
+  void MaterialHaloUpdateOnLevelFinish(PendingMaterialHaloUpdate &pending);
 
   void MaterialHaloUpdateOnMultis(MaterialFieldType const field_type);
 
-  void InterfaceTagHaloUpdateOnLevel(unsigned int const level,
-                                     InterfaceDescriptionBufferType const type);
+  void
+  InterfaceTagHaloUpdateOnLevel(unsigned int const level,
+                                InterfaceDescriptionBufferType const type,
+                                std::vector<nid_t> const &frozen_nodes = {});
 
   void InterfaceHaloUpdateOnLevel(unsigned int const level,
-                                  InterfaceBlockBufferType const type);
+                                  InterfaceBlockBufferType const type,
+                                  std::vector<nid_t> const &frozen_nodes = {});
+  void InterfaceHaloDependenciesOnLevel(
+      unsigned int const level,
+      std::vector<std::reference_wrapper<Node>> const &nodes,
+      std::vector<nid_t> &ids, std::vector<std::vector<std::size_t>> &neighbors,
+      std::vector<bool> &has_mpi_boundary);
 };
 
 #endif // INTERNAL_BOUNDARY_MANAGER_H
@@ -26,8 +26,29 @@
 #include <numeric>
 #include <vector>
 
+#include "simulation_context.h"
+
 namespace MpiUtilities {
 
+/**
+ * @brief Gives the communicator that all ranks of the simulation belong to.
+ * This is MPI_COMM_WORLD unless the ranks are split into independent
+ * simulations, e.g. in an ensemble run.
+ * @return The communicator of the current simulation context.
+ */
+inline MPI_Comm Communicator() {
+  return SimulationContext::Current().Communicator();
+}
+
+/**
+ * @brief Sets the communicator that all ranks of the simulation belong to. Must
+ * be called before any instance of the simulation is created.
+ * @param communicator The communicator of the current simulation context.
+ */
+inline void SetCommunicator(MPI_Comm const communicator) {
+  SimulationContext::Current().SetCommunicator(communicator);
+}
+
 /**
  * @brief Reduces a bool across MPI ranks.
  * @param input local bool.
@@ -38,7 +59,7 @@ inline bool GloballyReducedBool(bool const input,
                                 MPI_Op const operation = MPI_LOR) {
   bool result = input;
   MPI_Allreduce(MPI_IN_PLACE, &result, 1, MPI_CXX_BOOL, operation,
-                MPI_COMM_WORLD);
+                Communicator());
   return result;
 }
 
@@ -49,7 +70,7 @@ inline bool GloballyReducedBool(bool const input,
  */
 inline int MyRankId() {
   int rank_id = -1;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank_id);
+  MPI_Comm_rank(Communicator(), &rank_id);
   return rank_id;
 }
 
@@ -59,18 +80,18 @@ inline int MyRankId() {
  */
 inline bool MasterRank() {
   int rank_id = -1;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank_id);
+  MPI_Comm_rank(Communicator(), &rank_id);
   return rank_id == 0;
 }
 
 /**
- * @brief Gives the number of ranks in the MPI communicator "MPI_COMM_WORLD".
+ * @brief Gives the number of ranks in the simulation communicator.
  * Avoids handle creation, e.g. for const members in initializer list.
  * @return Communicator Size which is the number of ranks.
  */
 inline int NumberOfRanks() {
   int communicator_size = -1;
-  MPI_Comm_size(MPI_COMM_WORLD, &communicator_size);
+  MPI_Comm_size(Communicator(), &communicator_size);
   return communicator_size;
 }
 
@@ -82,10 +103,106 @@ inline int NumberOfRanks() {
 inline int MpiTagUb() {
   int *tag_ub;
   int flag;
-  MPI_Comm_get_attr(MPI_COMM_WORLD, MPI_TAG_UB, &tag_ub, &flag);
+  MPI_Comm_get_attr(Communicator(), MPI_TAG_UB, &tag_ub, &flag);
   return *tag_ub;
 }
 
+/**
+ * @brief Gives the compute node of each rank, identified by the lowest rank
+ * sharing memory with it.
+ * @return The node of every rank in the simulation communicator.
+ */
+inline std::vector<int> SharedMemoryNodeOfRanks() {
+  MPI_Comm shared_communicator;
+  MPI_Comm_split_type(Communicator(), MPI_COMM_TYPE_SHARED, MyRankId(),
+                      MPI_INFO_NULL, &shared_communicator);
+  int node = MyRankId();
+  MPI_Allreduce(MPI_IN_PLACE, &node, 1, MPI_INT, MPI_MIN, shared_communicator);
+  MPI_Comm_free(&shared_communicator);
+  std::vector<int> node_of_rank(NumberOfRanks());
+  MPI_Allgather(&node, 1, MPI_INT, node_of_rank.data(), 1, MPI_INT,
+                Communicator());
+  return node_of_rank;
+}
+
+/**
+ * @brief Gives the sum of the provided values of all lower ranks via a scan,
+ * i.e. without any rank knowing the values of all others.
+ * @param local_value The value contributed by this rank.
+ * @return Sum over all ranks with lower id, zero on rank zero.
+ */
+inline unsigned long long int
+ExclusiveScan(unsigned long long int const local_value) {
+  unsigned long long int offset = 0;
+  MPI_Exscan(&local_value, &offset, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+             Communicator());
+  // The result on rank zero is undefined by the standard
+  return MyRankId() == 0 ? 0 : offset;
+}
+
+/**
+ * @brief Gathers the lengths of several local vectors from all ranks in a
+ * single collective operation.
+ * @param local_lengths The length of each vector on this rank.
+ * @param number_of_ranks The number of ranks in the communicator.
+ * @return The lengths of each vector ( outer index ) on each rank ( inner
+ * index ).
+ */
+inline std::vector<std::vector<int>>
+GatherLengths(std::vector<int> const &local_lengths,
+              int const number_of_ranks) {
+  int const number_of_vectors = local_lengths.size();
+  std::vector<int> gathered_lengths(number_of_vectors * number_of_ranks);
+  MPI_Allgather(local_lengths.data(), number_of_vectors, MPI_INT,
+                gathered_lengths.data(), number_of_vectors, MPI_INT,
+                Communicator());
+  std::vector<std::vector<int>> all_lengths(number_of_vectors,
+                                            std::vector<int>(number_of_ranks));
+  for (int vector = 0; vector < number_of_vectors; ++vector) {
+    for (int rank = 0; rank < number_of_ranks; ++rank) {
+      all_lengths[vector][rank] =
+          gathered_lengths[rank * number_of_vectors + vector];
+    }
+  }
+  return all_lengths;
+}
+
+/**
+ * @brief Wrapper function to collect data from a local (= on one MPI rank)
+ * vector into a large global (= data of all ranks) one via a gatherv operation.
+ * The lengths of the local vectors on all ranks are already known, e.g. from
+ * GatherLengths. If all are empty, no communication takes place.
+ * @param local_data The data present at this rank.
+ * @param type The MPI datatype to be used in the gather call.
+ * @param all_lengths The length of the local data on each rank.
+ * @param global_data Vector holding the collected data from all ranks (indirect
+ * return parameter).
+ * @tparam Data type.
+ * @note Does not perform sanity checks. If the template type and the MPI
+ * datatype do not match the results will be corrupted. Uses Communicator() as
+ * communicator. Overrides the provided global_data array.
+ */
+template <class T>
+void LocalToGlobalData(std::vector<T> const &local_data,
+                       MPI_Datatype const type,
+                       std::vector<int> const &all_lengths,
+                       std::vector<T> &global_data) {
+  std::vector<int> offsets(all_lengths.size());
+  int insert_key = 0;
+  for (std::size_t i = 0; i < all_lengths.size(); ++i) {
+    offsets[i] = insert_key;
+    insert_key += all_lengths[i];
+  }
+
+  global_data.resize(insert_key);
+  if (insert_key == 0) {
+    return;
+  }
+  MPI_Allgatherv(local_data.data(), static_cast<int>(local_data.size()), type,
+                 global_data.data(), all_lengths.data(), offsets.data(), type,
+                 Communicator());
+}
+
 /**
  * @brief Wrapper function to collect data from a local (= on one MPI rank)
  * vector into a large global (= data of all ranks) one via a gatherv operation.
@@ -96,7 +213,7 @@ inline int MpiTagUb() {
  * return parameter).
  * @tparam Data type.
  * @note Does not perform sanity checks. If the template type and the MPI
- * datatype do not match the results will be corrupted. Uses MPI_COMM_WORLD as
+ * datatype do not match the results will be corrupted. Uses Communicator() as
  * communicator. Overrides the provided global_data array.
  */
 template <class T>
@@ -106,19 +223,29 @@ void LocalToGlobalData(std::vector<T> const &local_data,
   int length = local_data.size(); // Must be int due to MPI standard.
   std::vector<int> all_lengths(number_of_ranks);
   MPI_Allgather(&length, 1, MPI_INT, all_lengths.data(), 1, MPI_INT,
-                MPI_COMM_WORLD);
-
-  std::vector<int> offsets(number_of_ranks);
-  int insert_key = 0;
-  for (int i = 0; i < number_of_ranks; ++i) {
-    offsets[i] = insert_key;
-    insert_key += all_lengths[i];
-  }
+                Communicator());
+  LocalToGlobalData(local_data, type, all_lengths, global_data);
+}
 
-  global_data.resize(
-      std::accumulate(all_lengths.begin(), all_lengths.end(), 0));
-  MPI_Allgatherv(local_data.data(), length, type, global_data.data(),
-                 all_lengths.data(), offsets.data(), type, MPI_COMM_WORLD);
+/**
+ * @brief Wrapper function to distribute a vector from one rank to all others.
+ * The vector is resized on the receiving ranks.
+ * @param data The data to be distributed (indirect return parameter on all
+ * ranks but the root).
+ * @param type The MPI datatype to be used in the broadcast.
+ * @param root The rank holding the data.
+ * @tparam Data type.
+ * @note Does not perform sanity checks. If the template type and the MPI
+ * datatype do not match the results will be corrupted. Uses Communicator() as
+ * communicator.
+ */
+template <class T>
+void BroadcastVector(std::vector<T> &data, MPI_Datatype const type,
+                     int const root = 0) {
+  unsigned long long int length = data.size();
+  MPI_Bcast(&length, 1, MPI_UNSIGNED_LONG_LONG, root, Communicator());
+  data.resize(length);
+  MPI_Bcast(data.data(), static_cast<int>(length), type, root, Communicator());
 }
 } // namespace MpiUtilities
 
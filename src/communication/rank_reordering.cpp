@@ -0,0 +1,135 @@
+//===------------------------ rank_reordering.cpp -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "communication/rank_reordering.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <mpi.h>
+
+#include "communication/mpi_utilities.h"
+
+namespace RankReordering {
+
+/**
+ * @brief Maps the halo graph of the ranks onto the processes by creating a
+ * distributed graph communicator that the MPI library may reorder ( e.g. along
+ * the network topology ). The communicator is only used to obtain the mapping
+ * and freed afterwards.
+ * @param halo_bytes The bytes sent to each rank in a halo update ( index:
+ * rank ), see CommunicationManager::HaloBytesOfPartners.
+ * @return The suggested placement.
+ * @note Collective call, hence, it must be called on all ranks.
+ */
+HaloGraphPlacement MapHaloGraph(std::vector<long> const &halo_bytes) {
+  MPI_Comm const communicator = MpiUtilities::Communicator();
+  int const number_of_ranks = MpiUtilities::NumberOfRanks();
+  int const my_rank = MpiUtilities::MyRankId();
+
+  // The halo relations are symmetric, hence, the partners are both sources and
+  // destinations. The weights are given in KiB to fit into integers
+  std::vector<int> partners;
+  std::vector<int> weights;
+  for (int rank = 0; rank < number_of_ranks; ++rank) {
+    if (halo_bytes[rank] > 0) {
+      partners.push_back(rank);
+      weights.push_back(static_cast<int>(std::clamp(
+          halo_bytes[rank] / 1024, 1L, long(std::numeric_limits<int>::max()))));
+    }
+  }
+  MPI_Comm graph_communicator;
+  MPI_Dist_graph_create_adjacent(
+      communicator, int(partners.size()), partners.data(), weights.data(),
+      int(partners.size()), partners.data(), weights.data(), MPI_INFO_NULL, 1,
+      &graph_communicator);
+  int graph_rank;
+  MPI_Comm_rank(graph_communicator, &graph_rank);
+  MPI_Comm_free(&graph_communicator);
+
+  // Compute nodes are identified by their lowest rank, the slot is the rank
+  // within the compute node
+  MPI_Comm node_communicator;
+  MPI_Comm_split_type(communicator, MPI_COMM_TYPE_SHARED, my_rank,
+                      MPI_INFO_NULL, &node_communicator);
+  int node_id;
+  int slot;
+  MPI_Allreduce(&my_rank, &node_id, 1, MPI_INT, MPI_MIN, node_communicator);
+  MPI_Comm_rank(node_communicator, &slot);
+  MPI_Comm_free(&node_communicator);
+
+  std::array<int, 3> const local_mapping = {graph_rank, node_id, slot};
+  std::vector<int> mapping(3 * number_of_ranks);
+  MPI_Allgather(local_mapping.data(), 3, MPI_INT, mapping.data(), 3, MPI_INT,
+                communicator);
+  // the process that runs the subdomain of each rank in the suggested placement
+  std::vector<int> process_of_rank(number_of_ranks);
+  for (int process = 0; process < number_of_ranks; ++process) {
+    process_of_rank[mapping[3 * process]] = process;
+  }
+  auto const node_of = [&mapping](int const process) {
+    return mapping[3 * process + 1];
+  };
+
+  std::array<long, 3> local_volumes = {process_of_rank[my_rank] != my_rank, 0,
+                                       0};
+  for (int const partner : partners) {
+    if (node_of(my_rank) != node_of(partner)) {
+      local_volumes[1] += halo_bytes[partner];
+    }
+    if (node_of(process_of_rank[my_rank]) !=
+        node_of(process_of_rank[partner])) {
+      local_volumes[2] += halo_bytes[partner];
+    }
+  }
+  std::array<long, 3> volumes;
+  MPI_Allreduce(local_volumes.data(), volumes.data(), 3, MPI_LONG, MPI_SUM,
+                communicator);
+
+  HaloGraphPlacement placement;
+  placement.moved_ranks_ = static_cast<int>(volumes[0]);
+  placement.internode_bytes_current_ = volumes[1];
+  placement.internode_bytes_suggested_ = volumes[2];
+
+  // Rankfile in the Open MPI format
+  std::array<char, MPI_MAX_PROCESSOR_NAME> name = {};
+  int name_length;
+  MPI_Get_processor_name(name.data(), &name_length);
+  std::vector<char> names(MpiUtilities::MasterRank()
+                              ? number_of_ranks * MPI_MAX_PROCESSOR_NAME
+                              : 0);
+  MPI_Gather(name.data(), MPI_MAX_PROCESSOR_NAME, MPI_CHAR, names.data(),
+             MPI_MAX_PROCESSOR_NAME, MPI_CHAR, 0, communicator);
+  if (MpiUtilities::MasterRank()) {
+    placement.rankfile_ = "# Placement of the ranks suggested for the halo "
+                          "graph ( slot: rank within the compute node )\n";
+    for (int rank = 0; rank < number_of_ranks; ++rank) {
+      int const process = process_of_rank[rank];
+      placement.rankfile_ +=
+          "rank " + std::to_string(rank) + "=" +
+          std::string(names.data() + process * MPI_MAX_PROCESSOR_NAME) +
+          " slot=" + std::to_string(mapping[3 * process + 2]) + "\n";
+    }
+  }
+  return placement;
+}
+
+} // namespace RankReordering
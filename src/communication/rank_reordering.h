@@ -0,0 +1,49 @@
+//===------------------------- rank_reordering.h --------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef RANK_REORDERING_H
+#define RANK_REORDERING_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Placement of the ranks suggested by the MPI library for the halo
+ * graph, i.e. the graph of the ranks weighted with the halo bytes exchanged
+ * between them. The partition itself is not changed: the subdomain of a rank is
+ * suggested to be run on the process that the library mapped the rank onto.
+ */
+struct HaloGraphPlacement {
+  // rankfile of the suggested placement ( only valid on rank 0 )
+  std::string rankfile_;
+  // number of ranks the library moved to another process
+  int moved_ranks_ = 0;
+  // halo bytes per update exchanged between compute nodes with the current
+  // and the suggested placement
+  long internode_bytes_current_ = 0;
+  long internode_bytes_suggested_ = 0;
+};
+
+namespace RankReordering {
+HaloGraphPlacement MapHaloGraph(std::vector<long> const &halo_bytes);
+} // namespace RankReordering
+
+#endif // RANK_REORDERING_H
@@ -0,0 +1,149 @@
+//===------------------------ reduction_batch.cpp -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "communication/reduction_batch.h"
+#include <stdexcept>
+
+#include "communication/mpi_utilities.h"
+
+/**
+ * @brief Creates an empty batch.
+ */
+ReductionBatch::ReductionBatch() : request_(MPI_REQUEST_NULL) {}
+
+/**
+ * @brief Completes a reduction still in flight, as its buffer is released.
+ */
+ReductionBatch::~ReductionBatch() { Wait(); }
+
+/**
+ * @brief Appends a contribution to the batch.
+ * @param value The contribution, already mapped onto a maximum.
+ * @return The handle of the contribution.
+ */
+std::size_t ReductionBatch::Add(double const value) {
+#ifndef PERFORMANCE
+  if (InFlight()) {
+    throw std::logic_error("Contribution added to a reduction in flight");
+  }
+#endif
+  values_.push_back(value);
+  return values_.size() - 1;
+}
+
+/**
+ * @brief Registers a value whose maximum over all ranks is required.
+ * @param value The local value.
+ * @return The handle to obtain the global maximum.
+ */
+std::size_t ReductionBatch::AddMaximum(double const value) {
+  return Add(value);
+}
+
+/**
+ * @brief Registers a value whose minimum over all ranks is required.
+ * @param value The local value.
+ * @return The handle to obtain the global minimum.
+ */
+std::size_t ReductionBatch::AddMinimum(double const value) {
+  return Add(-value);
+}
+
+/**
+ * @brief Registers a flag which is set globally if it is set on any rank.
+ * @param value The local flag.
+ * @return The handle to obtain the global flag.
+ */
+std::size_t ReductionBatch::AddLogicalOr(bool const value) {
+  return Add(value ? 1.0 : 0.0);
+}
+
+/**
+ * @brief Starts the reduction of all registered contributions. Results are
+ * only valid after Wait(). Collective call, all ranks have to register the
+ * contributions in the same order.
+ */
+void ReductionBatch::Start() {
+#ifndef PERFORMANCE
+  if (InFlight()) {
+    throw std::logic_error("Reduction batch started twice");
+  }
+#endif
+  if (values_.empty()) {
+    return;
+  }
+  MPI_Iallreduce(MPI_IN_PLACE, values_.data(), values_.size(), MPI_DOUBLE,
+                 MPI_MAX, MpiUtilities::Communicator(), &request_);
+}
+
+/**
+ * @brief Completes the reduction in flight, if any.
+ */
+void ReductionBatch::Wait() { MPI_Wait(&request_, MPI_STATUS_IGNORE); }
+
+/**
+ * @brief Reduces all registered contributions immediately.
+ */
+void ReductionBatch::Reduce() {
+  Start();
+  Wait();
+}
+
+/**
+ * @brief Indicates whether a reduction was started but not yet completed.
+ * @return True if in flight, false otherwise.
+ */
+bool ReductionBatch::InFlight() const { return request_ != MPI_REQUEST_NULL; }
+
+/**
+ * @brief Removes all contributions, such that the batch can be reused.
+ */
+void ReductionBatch::Clear() {
+  Wait();
+  values_.clear();
+}
+
+/**
+ * @brief Gives the global maximum of a registered value.
+ * @param handle The handle given by AddMaximum().
+ * @return The global maximum.
+ */
+double ReductionBatch::Maximum(std::size_t const handle) const {
+  return values_[handle];
+}
+
+/**
+ * @brief Gives the global minimum of a registered value.
+ * @param handle The handle given by AddMinimum().
+ * @return The global minimum.
+ */
+double ReductionBatch::Minimum(std::size_t const handle) const {
+  return -values_[handle];
+}
+
+/**
+ * @brief Gives the global state of a registered flag.
+ * @param handle The handle given by AddLogicalOr().
+ * @return True if the flag is set on any rank.
+ */
+bool ReductionBatch::LogicalOr(std::size_t const handle) const {
+  return values_[handle] > 0.0;
+}
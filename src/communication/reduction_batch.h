@@ -0,0 +1,66 @@
+//===------------------------- reduction_batch.h --------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef REDUCTION_BATCH_H
+#define REDUCTION_BATCH_H
+
+#include <cstddef>
+#include <mpi.h>
+#include <vector>
+
+/**
+ * @brief The ReductionBatch fuses several small global reductions into a single
+ * non-blocking collective. Stages register their local contributions and keep
+ * the returned handle, the whole batch is then reduced with one MPI_Iallreduce
+ * at the next synchronization point. Maxima, minima ( negated ) and logical ors
+ * ( zero or one ) are all reduced as maximum of doubles, hence, they can be
+ * mixed in one batch.
+ */
+class ReductionBatch {
+  std::vector<double> values_;
+  MPI_Request request_;
+
+  std::size_t Add(double const value);
+
+public:
+  explicit ReductionBatch();
+  ~ReductionBatch();
+  ReductionBatch(ReductionBatch const &) = delete;
+  ReductionBatch &operator=(ReductionBatch const &) = delete;
+  ReductionBatch(ReductionBatch &&) = delete;
+  ReductionBatch &operator=(ReductionBatch &&) = delete;
+
+  std::size_t AddMaximum(double const value);
+  std::size_t AddMinimum(double const value);
+  std::size_t AddLogicalOr(bool const value);
+
+  void Start();
+  void Wait();
+  void Reduce();
+  bool InFlight() const;
+  void Clear();
+
+  double Maximum(std::size_t const handle) const;
+  double Minimum(std::size_t const handle) const;
+  bool LogicalOr(std::size_t const handle) const;
+};
+
+#endif // REDUCTION_BATCH_H
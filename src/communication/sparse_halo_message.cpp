@@ -0,0 +1,163 @@
+//===--------------------- sparse_halo_message.cpp ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "communication/sparse_halo_message.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+/**
+ * Number of cells whose flags are stored in one mask word.
+ */
+constexpr std::size_t bits_per_word_ = 64;
+
+/**
+ * @brief Gives the number of mask words needed for a halo region.
+ * @param size Number of cells of the region in each direction.
+ * @return The number of words per mask.
+ */
+std::size_t NumberOfMaskWords(std::array<int, 3> const &size) {
+  std::size_t const number_of_cells = static_cast<std::size_t>(size[0]) *
+                                      static_cast<std::size_t>(size[1]) *
+                                      static_cast<std::size_t>(size[2]);
+  return (number_of_cells + bits_per_word_ - 1) / bits_per_word_;
+}
+
+} // namespace
+
+namespace SparseHaloMessage {
+
+/**
+ * @brief Gives the size of the message of a halo region with all cells inside
+ * the band, i.e. the size the receive buffer has to provide.
+ * @param size Number of cells of the region in each direction.
+ * @return The maximum number of doubles in the message.
+ */
+std::size_t MaximumSize(std::array<int, 3> const &size) {
+  return 2 * NumberOfMaskWords(size) + static_cast<std::size_t>(size[0]) *
+                                           static_cast<std::size_t>(size[1]) *
+                                           static_cast<std::size_t>(size[2]);
+}
+
+/**
+ * @brief Packs a region of the level-set buffer into a sparse message.
+ * @param buffer The level-set buffer the data is taken from.
+ * @param start The first cell of the region in each direction.
+ * @param size Number of cells of the region in each direction.
+ * @param cutoff The cut-off value of the level set.
+ * @param message The packed data (indirect return parameter).
+ */
+void Pack(double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+          std::array<int, 3> const &start, std::array<int, 3> const &size,
+          double const cutoff, std::vector<double> &message) {
+  std::size_t const number_of_words = NumberOfMaskWords(size);
+  std::vector<std::uint64_t> in_band(number_of_words, 0);
+  std::vector<std::uint64_t> negative(number_of_words, 0);
+  message.resize(2 * number_of_words);
+
+  std::size_t cell = 0;
+  for (int i = start[0]; i < start[0] + size[0]; ++i) {
+    for (int j = start[1]; j < start[1] + size[1]; ++j) {
+      for (int k = start[2]; k < start[2] + size[2]; ++k) {
+        std::uint64_t const bit = std::uint64_t(1) << (cell % bits_per_word_);
+        double const value = buffer[i][j][k];
+        if (std::abs(value) < cutoff) {
+          in_band[cell / bits_per_word_] |= bit;
+          message.push_back(value);
+        } else if (value < 0.0) {
+          negative[cell / bits_per_word_] |= bit;
+        }
+        cell++;
+      }
+    }
+  }
+
+  std::memcpy(message.data(), in_band.data(),
+              number_of_words * sizeof(std::uint64_t));
+  std::memcpy(message.data() + number_of_words, negative.data(),
+              number_of_words * sizeof(std::uint64_t));
+}
+
+/**
+ * @brief Unpacks a sparse message into a region of the level-set buffer.
+ * Cells outside the band are set to the signed cut-off value.
+ * @param message The data packed by Pack.
+ * @param start The first cell of the region in each direction.
+ * @param size Number of cells of the region in each direction.
+ * @param cutoff The cut-off value of the level set.
+ * @param buffer The level-set buffer the data is written to.
+ */
+void Unpack(std::vector<double> const &message, std::array<int, 3> const &start,
+            std::array<int, 3> const &size, double const cutoff,
+            double (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()]) {
+  std::size_t const number_of_words = NumberOfMaskWords(size);
+  std::vector<std::uint64_t> in_band(number_of_words);
+  std::vector<std::uint64_t> negative(number_of_words);
+  std::memcpy(in_band.data(), message.data(),
+              number_of_words * sizeof(std::uint64_t));
+  std::memcpy(negative.data(), message.data() + number_of_words,
+              number_of_words * sizeof(std::uint64_t));
+
+  std::size_t cell = 0;
+  std::size_t offset = 2 * number_of_words;
+  for (int i = start[0]; i < start[0] + size[0]; ++i) {
+    for (int j = start[1]; j < start[1] + size[1]; ++j) {
+      for (int k = start[2]; k < start[2] + size[2]; ++k) {
+        std::uint64_t const bit = std::uint64_t(1) << (cell % bits_per_word_);
+        if (in_band[cell / bits_per_word_] & bit) {
+          buffer[i][j][k] = message[offset++];
+        } else {
+          buffer[i][j][k] =
+              (negative[cell / bits_per_word_] & bit) ? -cutoff : cutoff;
+        }
+        cell++;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Limits a region of the level-set buffer to the cut-off value. Gives
+ * the same result as packing and unpacking the region, hence halos filled
+ * locally agree with halos received from other ranks.
+ * @param buffer The level-set buffer to be limited.
+ * @param start The first cell of the region in each direction.
+ * @param size Number of cells of the region in each direction.
+ * @param cutoff The cut-off value of the level set.
+ */
+void CutOff(double (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+            std::array<int, 3> const &start, std::array<int, 3> const &size,
+            double const cutoff) {
+  for (int i = start[0]; i < start[0] + size[0]; ++i) {
+    for (int j = start[1]; j < start[1] + size[1]; ++j) {
+      for (int k = start[2]; k < start[2] + size[2]; ++k) {
+        double const value = buffer[i][j][k];
+        if (!(std::abs(value) < cutoff)) {
+          buffer[i][j][k] = value < 0.0 ? -cutoff : cutoff;
+        }
+      }
+    }
+  }
+}
+
+} // namespace SparseHaloMessage
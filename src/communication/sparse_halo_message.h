@@ -0,0 +1,54 @@
+//===---------------------- sparse_halo_message.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef SPARSE_HALO_MESSAGE_H
+#define SPARSE_HALO_MESSAGE_H
+
+#include "user_specifications/compile_time_constants.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Packing of level-set halo regions into messages which only carry the
+ * values inside the narrow band. Values at or beyond the cut-off are
+ * represented by a single sign bit and restored as the signed cut-off value.
+ * The message starts with a bit mask of the cells inside the band and a bit
+ * mask of the negative cells outside the band, followed by the values inside
+ * the band.
+ */
+namespace SparseHaloMessage {
+
+std::size_t MaximumSize(std::array<int, 3> const &size);
+
+void Pack(double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+          std::array<int, 3> const &start, std::array<int, 3> const &size,
+          double const cutoff, std::vector<double> &message);
+void Unpack(std::vector<double> const &message, std::array<int, 3> const &start,
+            std::array<int, 3> const &size, double const cutoff,
+            double (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()]);
+void CutOff(double (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+            std::array<int, 3> const &start, std::array<int, 3> const &size,
+            double const cutoff);
+
+} // namespace SparseHaloMessage
+
+#endif // SPARSE_HALO_MESSAGE_H
@@ -0,0 +1,242 @@
+//===-------------------------- dry_run_runner.h --------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef DRY_RUN_RUNNER_H
+#define DRY_RUN_RUNNER_H
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "input_output/log_writer/log_writer.h"
+#include "instantiation/instantiation_initial_condition.h"
+#include "instantiation/instantiation_unit_handler.h"
+#include "instantiation/materials/instantiation_material_manager.h"
+#include "instantiation/topology/instantiation_topology_manager.h"
+#include "instantiation/topology/instantiation_tree.h"
+
+#include "communication/mpi_utilities.h"
+#include "topology/id_information.h"
+#include "utilities/string_operations.h"
+
+/**
+ * @brief A dry run predicts the mesh, the partition and the memory of a
+ * simulation for a given number of ranks without allocating any block. The
+ * materials of the nodes are evaluated from the initial levelset at block
+ * granularity and only the multi-phase nodes are refined, i.e., the mesh
+ * resolving the interface is predicted. The refinement of single-phase nodes
+ * by the multiresolution analysis depends on the initial fields and is only
+ * bounded from above by the fully refined mesh.
+ */
+namespace DryRun {
+
+/**
+ * @brief Estimates the memory of the blocks of a node as it is allocated in a
+ * simulation, i.e., one block per phase with its jump, integration and
+ * statistics buffers if needed and the interface block on the maximum level.
+ * @param topology The topology holding the node.
+ * @param id The id of the node.
+ * @return The memory in bytes.
+ * @note Velocity gradients and communication buffers are not included.
+ */
+std::size_t NodeBytes(TopologyManager const &topology, nid_t const id) {
+  std::size_t phase_bytes = sizeof(PhaseMap::Entry);
+  if (!CC::LazyJumpBuffers() || topology.NodeNeedsJumpBuffers(id)) {
+    phase_bytes += sizeof(JumpBuffers);
+  }
+  if (!CC::LazyIntegrationBuffers() || topology.NodeIsLeaf(id)) {
+    phase_bytes += sizeof(IntegrationBuffers);
+  }
+  if (StatisticsOutputSettings::SamplingInterval > 0 &&
+      topology.NodeIsLeaf(id)) {
+    phase_bytes += sizeof(StatisticsBuffers);
+  }
+  std::size_t bytes = sizeof(NodeStore::Entry) +
+                      topology.GetMaterialsOfNode(id).size() * phase_bytes;
+  if (topology.IsNodeMultiPhase(id) &&
+      LevelOfNode(id) == topology.GetMaximumLevel()) {
+    bytes += sizeof(InterfaceBlock);
+  }
+  return bytes;
+}
+
+/**
+ * @brief Gives a report line with the minimum, mean and maximum of a quantity
+ * over all ranks.
+ * @param name The name of the quantity.
+ * @param values The values per rank.
+ * @return The line.
+ */
+std::string RankStatisticsLine(std::string const &name,
+                               std::vector<double> const &values) {
+  auto const column = [](std::string const &entry, std::size_t const width) {
+    return entry + StringOperations::Indent(
+                       width > entry.size() ? width - entry.size() : 1);
+  };
+  double const mean = std::accumulate(values.begin(), values.end(), 0.0) /
+                      double(values.size());
+  return column(name, 20) +
+         column(StringOperations::ToScientificNotationString(
+                    *std::min_element(values.begin(), values.end()), 3),
+                12) +
+         column(StringOperations::ToScientificNotationString(mean, 3), 12) +
+         StringOperations::ToScientificNotationString(
+             *std::max_element(values.begin(), values.end()), 3);
+}
+
+/**
+ * @brief Predicts the mesh of the given input and reports its partition onto
+ * the given number of ranks together with the memory of the blocks and the
+ * cost of the leaves per rank.
+ * @param input_reader Reader that is used to provide user-information from an
+ * input file.
+ * @param number_of_ranks The number of ranks the simulation is planned for.
+ * @note The topology is built on the ranks of the dry run, which may be fewer
+ * than the planned ones. The nodes are only partitioned for the report.
+ */
+void Run(InputReader const &input_reader, int const number_of_ranks) {
+  LogWriter &logger = LogWriter::Instance();
+  logger.LogMessage(
+      "Dry run for " + std::to_string(number_of_ranks) +
+      " ranks using inputfile : " + input_reader.GetInputFile().string());
+  logger.LogBreakLine();
+  logger.Flush();
+
+  UnitHandler const unit_handler(
+      Instantiation::InstantiateUnitHandler(input_reader));
+  MaterialManager const material_manager(
+      Instantiation::InstantiateMaterialManager(input_reader, unit_handler));
+  TopologyManager topology_manager(Instantiation::InstantiateTopologyManager(
+      input_reader, material_manager));
+  // The tree stays empty, it only provides the geometry of the nodes
+  Tree tree(Instantiation::InstantiateTree(input_reader, topology_manager,
+                                           unit_handler));
+  std::unique_ptr<InitialCondition> initial_condition(
+      Instantiation::InstantiateInitialCondition(input_reader, topology_manager,
+                                                 tree, material_manager,
+                                                 unit_handler));
+  logger.LogBreakLine();
+  logger.Flush();
+
+  // Same sequence as in the creation of a new simulation, but only
+  // multi-phase nodes are refined
+  unsigned int const maximum_level = topology_manager.GetMaximumLevel();
+  for (unsigned int level = 0; level <= maximum_level; ++level) {
+    if (level > 0) {
+      for (nid_t const id : topology_manager.LocalIdsOnLevel(level - 1)) {
+        if (topology_manager.IsNodeMultiPhase(id)) {
+          topology_manager.RefineNodeWithId(id);
+        }
+      }
+      topology_manager.UpdateTopology();
+    }
+    std::vector<nid_t> const &level_ids =
+        topology_manager.LocalIdsOnLevel(level);
+    std::vector<std::vector<MaterialName>> materials(level_ids.size());
+    long const number_of_level_ids = static_cast<long>(level_ids.size());
+#pragma omp parallel for schedule(dynamic)
+    for (long id_index = 0; id_index < number_of_level_ids; ++id_index) {
+      materials[id_index] =
+          initial_condition->GetInitialMaterials(level_ids[id_index]);
+    }
+    for (std::size_t id_index = 0; id_index < level_ids.size(); ++id_index) {
+      for (MaterialName const material : materials[id_index]) {
+        topology_manager.AddMaterialToNode(level_ids[id_index], material);
+      }
+    }
+    topology_manager.UpdateTopology();
+  }
+
+  logger.LogMessage("Predicted mesh resolving the interface:");
+  logger.LogMessage("Level  Nodes       Leaves      Multi-phase");
+  auto const column = [](unsigned long const value) {
+    std::string const entry = std::to_string(value);
+    return entry +
+           StringOperations::Indent(entry.size() < 12 ? 12 - entry.size() : 1);
+  };
+  unsigned long level_zero_nodes = 0;
+  unsigned long predicted_nodes = 0;
+  for (unsigned int level = 0; level <= maximum_level; ++level) {
+    std::vector<nid_t> const &ids = topology_manager.IdsOnLevel(level);
+    unsigned long const multi_phase_nodes = std::count_if(
+        ids.begin(), ids.end(), [&topology_manager](nid_t const id) {
+          return topology_manager.IsNodeMultiPhase(id);
+        });
+    if (level == 0) {
+      level_zero_nodes = ids.size();
+    }
+    predicted_nodes += ids.size();
+    std::string const level_entry = std::to_string(level);
+    logger.LogMessage(level_entry +
+                      StringOperations::Indent(7 - level_entry.size()) +
+                      column(ids.size()) +
+                      column(topology_manager.LeafIdsOnLevel(level).size()) +
+                      std::to_string(multi_phase_nodes));
+  }
+  unsigned long fully_refined_nodes = 0;
+  for (unsigned int level = 0; level <= maximum_level; ++level) {
+    fully_refined_nodes += level_zero_nodes << (DTI(CC::DIM()) * level);
+  }
+  logger.LogMessage("Single-phase refinement by the multiresolution analysis "
+                    "adds at most " +
+                    std::to_string(fully_refined_nodes - predicted_nodes) +
+                    " nodes (fully refined mesh: " +
+                    std::to_string(fully_refined_nodes) + " nodes)");
+  logger.LogBreakLine();
+
+  // The partition onto the planned ranks, the nodes are not moved
+  topology_manager.PrepareLoadBalancedTopology(number_of_ranks);
+  std::vector<double> nodes(number_of_ranks, 0.0);
+  std::vector<double> blocks(number_of_ranks, 0.0);
+  std::vector<double> megabytes(number_of_ranks, 0.0);
+  for (unsigned int level = 0; level <= maximum_level; ++level) {
+    for (nid_t const id : topology_manager.IdsOnLevel(level)) {
+      int const rank = topology_manager.GetRankOfNode(id);
+      nodes[rank] += 1.0;
+      blocks[rank] += double(topology_manager.GetMaterialsOfNode(id).size());
+      megabytes[rank] += double(NodeBytes(topology_manager, id)) / 1.0e6;
+    }
+  }
+  std::vector<double> const costs =
+      topology_manager.LeafCostsPerRank(number_of_ranks);
+  logger.LogMessage("Per rank            Min         Mean        Max");
+  logger.LogMessage(RankStatisticsLine("Nodes", nodes));
+  logger.LogMessage(RankStatisticsLine("Blocks", blocks));
+  logger.LogMessage(RankStatisticsLine("Block memory [MB]", megabytes));
+  logger.LogMessage(RankStatisticsLine("Leaf cost", costs));
+  double const mean_cost = std::accumulate(costs.begin(), costs.end(), 0.0) /
+                           double(number_of_ranks);
+  logger.LogMessage(
+      "Load imbalance (max / mean leaf cost): " +
+      StringOperations::ToScientificNotationString(
+          mean_cost > 0.0
+              ? *std::max_element(costs.begin(), costs.end()) / mean_cost
+              : 1.0,
+          3));
+  logger.LogBreakLine();
+  logger.Flush();
+}
+
+} // namespace DryRun
+
+#endif // DRY_RUN_RUNNER_H
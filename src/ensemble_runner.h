@@ -0,0 +1,115 @@
+//===----------------------- ensemble_runner.h ----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef ENSEMBLE_RUNNER_H
+#define ENSEMBLE_RUNNER_H
+
+#include <filesystem>
+#include <mpi.h>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "communication/mpi_utilities.h"
+#include "input_output/log_writer/log_writer.h"
+#include "instantiation/input_output/instantiation_input_reader.h"
+#include "simulation_runner.h"
+
+/**
+ * @brief An ensemble runs many independent simulations in one MPI job. The
+ * ranks are split into groups of equal size, each group runs its share of the
+ * input files one after another on its own communicator.
+ */
+namespace Ensemble {
+
+/**
+ * @brief Splits MPI_COMM_WORLD into groups of consecutive ranks and sets the
+ * communicator of the group as simulation communicator. Must be called before
+ * any instance of a simulation (including the logger) is created.
+ * @param ranks_per_simulation The number of ranks of each group.
+ * @return The index of the group of this rank.
+ * @note Throws if the number of ranks is not a multiple of the group size.
+ */
+int SplitRanks(int const ranks_per_simulation) {
+  int world_rank = -1;
+  int world_size = -1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+  if (ranks_per_simulation <= 0 || world_size % ranks_per_simulation != 0) {
+    throw std::invalid_argument(
+        "Number of ranks (" + std::to_string(world_size) +
+        ") must be a multiple of the ranks per simulation (" +
+        std::to_string(ranks_per_simulation) + ")");
+  }
+  int const group = world_rank / ranks_per_simulation;
+  MPI_Comm communicator;
+  MPI_Comm_split(MPI_COMM_WORLD, group, world_rank, &communicator);
+  MpiUtilities::SetCommunicator(communicator);
+  return group;
+}
+
+/**
+ * @brief Runs the input files assigned to the group of this rank (round robin)
+ * one after another and releases the communicator of the group afterwards.
+ * @param input_files All input files of the ensemble.
+ * @param group The index of the group of this rank, see SplitRanks().
+ * @note Throws if two input files share the same name, as their output folders
+ * would be created concurrently in the working directory.
+ */
+void Run(std::vector<std::filesystem::path> const &input_files,
+         int const group) {
+  std::set<std::filesystem::path> names;
+  for (std::filesystem::path const &input_file : input_files) {
+    if (!names.insert(input_file.stem()).second) {
+      throw std::invalid_argument("Input files of an ensemble must have "
+                                  "distinct names: " +
+                                  input_file.string());
+    }
+  }
+
+  int world_size = -1;
+  MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+  std::size_t const number_of_groups =
+      std::size_t(world_size / MpiUtilities::NumberOfRanks());
+
+  LogWriter &logger = LogWriter::Instance();
+  logger.LogMessage("Ensemble of " + std::to_string(input_files.size()) +
+                    " simulations in " + std::to_string(number_of_groups) +
+                    " groups of " +
+                    std::to_string(MpiUtilities::NumberOfRanks()) + " ranks");
+  logger.Flush();
+  for (std::size_t index = std::size_t(group); index < input_files.size();
+       index += number_of_groups) {
+    InputReader const input_reader(
+        Instantiation::InstantiateInputReader(input_files[index]));
+    Simulation::Run(input_reader);
+    logger.Flush();
+  }
+
+  MPI_Comm communicator = MpiUtilities::Communicator();
+  MpiUtilities::SetCommunicator(MPI_COMM_WORLD);
+  MPI_Comm_free(&communicator);
+}
+
+} // namespace Ensemble
+
+#endif // ENSEMBLE_RUNNER_H
@@ -28,7 +28,7 @@
  * @brief Identifier to obtain the correct MPI_Datatype during MPI calls via the
  * CommunicationTypes proxy.
  */
-enum class DatatypeForMpi : unsigned short { Double = 0, Byte = 1 };
+enum class DatatypeForMpi : unsigned short { Double = 0, Byte = 1, Float = 2 };
 
 /**
  * @brief Converts a DatatypeForMpi identifier to a (C++11 standard compliant,
@@ -41,4 +41,21 @@ DTI(DatatypeForMpi const d) {
   return static_cast<typename std::underlying_type<DatatypeForMpi>::type>(d);
 }
 
+/**
+ * @brief Number of DatatypeForMpi identifiers.
+ */
+constexpr unsigned int number_of_datatypes_for_mpi_ = 3;
+
+/**
+ * @brief Gives the DatatypeForMpi identifier of a floating-point type.
+ * @tparam T The floating-point type (double or float).
+ * @return Identifier of the type.
+ */
+template <typename T> constexpr DatatypeForMpi DatatypeOf() {
+  static_assert(std::is_same_v<T, double> || std::is_same_v<T, float>,
+                "Only double and float values have an MPI datatype");
+  return std::is_same_v<T, float> ? DatatypeForMpi::Float
+                                  : DatatypeForMpi::Double;
+}
+
 #endif // DATATYPE_FOR_MPI_DEFINITION_H
@@ -0,0 +1,33 @@
+//===---------------------- field_buffer_layout.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef FIELD_BUFFER_LAYOUT_H
+#define FIELD_BUFFER_LAYOUT_H
+
+/**
+ * @brief Identifier for the memory layout of the field buffers. 'FieldMajor'
+ * stores one full three-dimensional array per field. 'CellBlocked' stores tiles
+ * of consecutive cells (array of structures of arrays), where each tile holds
+ * the values of all fields for a fixed number of cells.
+ */
+enum class FieldBufferLayout { FieldMajor, CellBlocked };
+
+#endif // FIELD_BUFFER_LAYOUT_H
@@ -33,4 +33,9 @@ enum class CutCellCriteria { SignChangeBased, ValueBased };
  */
 enum class GeometryStencilType { Reconstruction, Derivative };
 
+/**
+ * @brief Identifier of the estimator for the interface curvature.
+ */
+enum class CurvatureEstimator { LevelsetDerivatives, HeightFunction };
+
 #endif // GEOMETRY_SETTINGS_H
@@ -0,0 +1,72 @@
+//===-------------------------- halo_exchange.h ---------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef HALO_EXCHANGE_H
+#define HALO_EXCHANGE_H
+
+#include "utilities/string_operations.h"
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Identifier of the protocol the aggregated no-jump halos are exchanged
+ * with between ranks. 'TwoSided' matches sends and receives of tagged messages,
+ * 'OneSided' puts the halos directly into a window of the receiving rank.
+ */
+enum class HaloExchange { TwoSided, OneSided };
+
+/**
+ * @brief Converts the halo exchange into an appropriate string.
+ * @param exchange HaloExchange identifier.
+ * @return String for the halo exchange.
+ */
+inline std::string HaloExchangeToString(HaloExchange const exchange) {
+  switch (exchange) {
+  case HaloExchange::TwoSided:
+    return "Two-sided";
+  case HaloExchange::OneSided:
+    return "One-sided";
+  default:
+    return "ERROR: This halo exchange is not (yet) defined!";
+  }
+}
+
+/**
+ * @brief Gives the halo exchange for a given string.
+ * @param exchange String that should be converted.
+ * @return Halo exchange identifier.
+ */
+inline HaloExchange StringToHaloExchange(std::string const &exchange) {
+  // transform string to upper case without spaces
+  std::string const exchange_upper_case(
+      StringOperations::ToUpperCaseWithoutSpaces(exchange));
+  // switch statements cannot be used with strings
+  if (exchange_upper_case == "TWOSIDED") {
+    return HaloExchange::TwoSided;
+  } else if (exchange_upper_case == "ONESIDED") {
+    return HaloExchange::OneSided;
+  } else {
+    throw std::logic_error("Halo exchange '" + exchange_upper_case +
+                           "' not known!");
+  }
+}
+
+#endif // HALO_EXCHANGE_H
@@ -0,0 +1,41 @@
+//===----------------------- refinement_indicator.h -----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef REFINEMENT_INDICATOR_H
+#define REFINEMENT_INDICATOR_H
+
+/**
+ * @brief Identifier for the indicator deciding on the refinement and
+ * coarsening of leaves. 'WaveletDetail' compares the leaf with the prediction
+ * from its parent ( multiresolution analysis ). The others are sensors
+ * evaluated on the data of the leaf only: 'Gradient' the normalized jump
+ * across a cell, 'Curvature' the normalized second difference of \cite
+ * Loehner1987 and 'ShockSensor' the density-based sensor of \cite Jameson1981
+ * weighted by the one of \cite Ducros1999 to ignore vortices.
+ */
+enum class RefinementIndicator {
+  WaveletDetail,
+  Gradient,
+  Curvature,
+  ShockSensor
+};
+
+#endif // REFINEMENT_INDICATOR_H
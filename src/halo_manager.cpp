@@ -22,6 +22,8 @@
 #include "halo_manager.h"
 #include "communication/exchange_types.h"
 #include "topology/id_information.h"
+#include "utilities/runtime_profiler.h"
+#include <algorithm>
 
 /**
  * @brief Default constructor for Halo Manager instance.
@@ -55,10 +57,13 @@ HaloManager::HaloManager(Tree &tree,
  * @param cut_jumps Decider if jump halos should be updated on all specified
  * level. If true: jumps will not be updated on the coarsest level in
  * "upddate_levels".
+ * @param depth The number of halo cells required on the maximum level, see
+ * HaloDepthOnLevel.
  */
 void HaloManager::MaterialHaloUpdate(
     std::vector<unsigned int> const &levels_ascending,
-    MaterialFieldType const field_type, bool const cut_jumps) const {
+    MaterialFieldType const field_type, bool const cut_jumps,
+    unsigned int const depth) const {
   std::vector<unsigned int> no_jump_update_levels(levels_ascending);
   /* NH 2017-02-20: It may be that no-jump halos are not to be updated on the
    * coarsest level in the input list. Therefore this level is handled
@@ -68,13 +73,87 @@ void HaloManager::MaterialHaloUpdate(
   if (cut_jumps) {
     unsigned int no_jump_extra_level = no_jump_update_levels.front();
     no_jump_update_levels.erase(no_jump_update_levels.begin());
-    MaterialHaloUpdateOnLevel(no_jump_extra_level, field_type, true);
+    MaterialHaloUpdateOnLevel(no_jump_extra_level, field_type, true, depth);
   }
   for (unsigned int const level : no_jump_update_levels) {
-    MaterialHaloUpdateOnLevel(level, field_type, false);
+    MaterialHaloUpdateOnLevel(level, field_type, false, depth);
   }
 }
 
+/**
+ * @brief Gives the number of halo cells exchanged on a level for a required
+ * depth. Only the maximum level exchanges reduced halos. Its nodes are never
+ * parents, whereas the halos of coarser levels feed the prediction of the jump
+ * halos of their children and are thus always exchanged completely.
+ * @param level The level of the halo update.
+ * @param depth The number of halo cells required normal to the boundaries.
+ * @return The number of halo cells exchanged.
+ */
+unsigned int HaloManager::HaloDepthOnLevel(unsigned int const level,
+                                           unsigned int const depth) const {
+  return level == maximum_level_ ? depth : CC::HS();
+}
+
+/**
+ * @brief First half of a split-phase material halo update. All levels but the
+ * finest one in the list are updated completely. On the finest level all MPI
+ * communication is posted and all rank-local updates are carried out, such
+ * that nodes not in flight can already be used on return.
+ * @param levels_ascending The levels on which halos of nodes will be modified
+ * in ascending order.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ * @param cut_jumps Decider if jump halos should be updated on all specified
+ * level. If true: jumps will not be updated on the coarsest level in
+ * "levels_ascending".
+ * @param pending Holds the state of the communication on the finest level.
+ * Indirect return parameter, has to be passed to MaterialHaloUpdateFinish.
+ * @param depth The number of halo cells required on the maximum level, see
+ * HaloDepthOnLevel.
+ */
+void HaloManager::MaterialHaloUpdateBegin(
+    std::vector<unsigned int> const &levels_ascending,
+    MaterialFieldType const field_type, bool const cut_jumps,
+    PendingMaterialHaloUpdate &pending, unsigned int const depth) const {
+  for (std::size_t index = 0; index + 1 < levels_ascending.size(); ++index) {
+    MaterialHaloUpdateOnLevel(levels_ascending[index], field_type,
+                              cut_jumps && index == 0, depth);
+  }
+  unsigned int const finest_level = levels_ascending.back();
+  internal_halo_manager_.MaterialHaloUpdateOnLevelBegin(
+      finest_level, field_type, cut_jumps && levels_ascending.size() == 1,
+      pending, HaloDepthOnLevel(finest_level, depth));
+  MaterialExternalHaloUpdateOnLevel(finest_level, field_type,
+                                    pending.nodes_in_flight_, false);
+}
+
+/**
+ * @brief Tests without blocking whether the communication of a split-phase
+ * material halo update is completed. Allows to poll the update while working
+ * on nodes that are not in flight.
+ * @param pending The pending update as filled by MaterialHaloUpdateBegin.
+ * @return True if MaterialHaloUpdateFinish does not wait for messages anymore.
+ */
+bool HaloManager::MaterialHaloUpdateArrived(
+    PendingMaterialHaloUpdate &pending) const {
+  return internal_halo_manager_.MaterialHaloUpdateOnLevelArrived(pending);
+}
+
+/**
+ * @brief Second half of a split-phase material halo update. Completes the
+ * communication and updates the external halos of the nodes in flight.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done. Must be identical to the one given to the begin call.
+ * @param pending The pending update as filled by MaterialHaloUpdateBegin.
+ */
+void HaloManager::MaterialHaloUpdateFinish(
+    MaterialFieldType const field_type,
+    PendingMaterialHaloUpdate &pending) const {
+  internal_halo_manager_.MaterialHaloUpdateOnLevelFinish(pending);
+  MaterialExternalHaloUpdateOnLevel(pending.level_, field_type,
+                                    pending.nodes_in_flight_, true);
+}
+
 /**
  * @brief Adjusts the material values in all halo cells, according to their
  * type.
@@ -83,11 +162,15 @@ void HaloManager::MaterialHaloUpdate(
  * prime states is done.
  * @param cut_jumps Decider if jump halos should be updated on specified level.
  * If true: jumps will not be updated on the current level.
+ * @param depth The number of halo cells required on the maximum level, see
+ * HaloDepthOnLevel.
  */
 void HaloManager::MaterialHaloUpdateOnLevel(unsigned int const level,
                                             MaterialFieldType const field_type,
-                                            bool const cut_jumps) const {
-  MaterialInternalHaloUpdateOnLevel(level, field_type, cut_jumps);
+                                            bool const cut_jumps,
+                                            unsigned int const depth) const {
+  ProfileRegion const region("MaterialHaloUpdate");
+  MaterialInternalHaloUpdateOnLevel(level, field_type, cut_jumps, depth);
   MaterialExternalHaloUpdateOnLevel(level, field_type);
 }
 
@@ -98,12 +181,14 @@ void HaloManager::MaterialHaloUpdateOnLevel(unsigned int const level,
  * prime states is done.
  * @param cut_jumps Decider if jump halos should be updated on specified level.
  * If true: jumps will not be updated on the current level.
+ * @param depth The number of halo cells required on the maximum level, see
+ * HaloDepthOnLevel.
  */
 void HaloManager::MaterialInternalHaloUpdateOnLevel(
     unsigned int const level, MaterialFieldType const field_type,
-    bool const cut_jumps) const {
-  internal_halo_manager_.MaterialHaloUpdateOnLevel(level, field_type,
-                                                   cut_jumps);
+    bool const cut_jumps, unsigned int const depth) const {
+  internal_halo_manager_.MaterialHaloUpdateOnLevel(
+      level, field_type, cut_jumps, HaloDepthOnLevel(level, depth));
 }
 
 /**
@@ -115,11 +200,60 @@ void HaloManager::MaterialInternalHaloUpdateOnLevel(
  */
 void HaloManager::MaterialExternalHaloUpdateOnLevel(
     unsigned int const level, MaterialFieldType const field_type) const {
-  for (std::tuple<nid_t, BoundaryLocation> const &boundary :
-       communication_manager_.ExternalBoundaries(level)) {
-    external_halo_manager_.UpdateMaterialExternal(
-        tree_.GetNodeWithId(std::get<0>(boundary)), field_type,
-        std::get<1>(boundary));
+  MaterialExternalHaloUpdate(
+      communication_manager_.ExternalBoundaryGroupsOnLevel(level), field_type,
+      [](nid_t const) { return true; });
+}
+
+/**
+ * @brief Adjusts the material values in external halo cells for a subset of the
+ * nodes on the level, according to their type.
+ * @param level The level on which halos of nodes will be modified.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ * @param nodes_in_flight Sorted ids of nodes with pending MPI halo updates.
+ * @param update_nodes_in_flight Decider whether only the nodes in flight (true)
+ * or only all other nodes (false) are updated.
+ */
+void HaloManager::MaterialExternalHaloUpdateOnLevel(
+    unsigned int const level, MaterialFieldType const field_type,
+    std::vector<nid_t> const &nodes_in_flight,
+    bool const update_nodes_in_flight) const {
+  MaterialExternalHaloUpdate(
+      communication_manager_.ExternalBoundaryGroupsOnLevel(level), field_type,
+      [&nodes_in_flight, update_nodes_in_flight](nid_t const id) {
+        return std::binary_search(nodes_in_flight.begin(),
+                                  nodes_in_flight.end(),
+                                  id) == update_nodes_in_flight;
+      });
+}
+
+/**
+ * @brief Adjusts the material values in external halo cells of the given nodes.
+ * The nodes of each boundary location are handed to the boundary condition of
+ * the location at once.
+ * @param groups The ids of the nodes with external boundaries per location.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ * @param update_node Predicate on the node id, whether the halos of the node
+ * are updated.
+ */
+template <typename Predicate>
+void HaloManager::MaterialExternalHaloUpdate(
+    ExternalBoundaryGroups const &groups, MaterialFieldType const field_type,
+    Predicate &&update_node) const {
+  std::vector<std::reference_wrapper<Node>> nodes;
+  for (BoundaryLocation const location : CC::ANBS()) {
+    nodes.clear();
+    for (nid_t const id : groups[LTI(location)]) {
+      if (update_node(id)) {
+        nodes.push_back(tree_.GetNodeWithId(id));
+      }
+    }
+    if (!nodes.empty()) {
+      external_halo_manager_.UpdateMaterialExternal(nodes, field_type,
+                                                    location);
+    }
   }
 }
 
@@ -130,11 +264,13 @@ void HaloManager::MaterialExternalHaloUpdateOnLevel(
  * prime states is done.
  * @param cut_jumps Decider if jump halos should be updated on specified level.
  * If true: jumps will not be updated on the current level.
+ * @param depth The number of halo cells required normal to the boundaries.
  * @note The default value for cut_jumps is true.
  */
 void HaloManager::MaterialHaloUpdateOnLmax(MaterialFieldType const field_type,
-                                           bool const cut_jumps) const {
-  MaterialHaloUpdateOnLevel(maximum_level_, field_type, cut_jumps);
+                                           bool const cut_jumps,
+                                           unsigned int const depth) const {
+  MaterialHaloUpdateOnLevel(maximum_level_, field_type, cut_jumps, depth);
 }
 
 /**
@@ -145,13 +281,11 @@ void HaloManager::MaterialHaloUpdateOnLmax(MaterialFieldType const field_type,
  */
 void HaloManager::MaterialHaloUpdateOnLmaxMultis(
     MaterialFieldType const field_type) const {
+  ProfileRegion const region("MaterialHaloUpdate");
   internal_halo_manager_.MaterialHaloUpdateOnMultis(field_type);
-  for (std::tuple<nid_t, BoundaryLocation> const &boundary :
-       communication_manager_.ExternalMultiBoundaries()) {
-    external_halo_manager_.UpdateMaterialExternal(
-        tree_.GetNodeWithId(std::get<0>(boundary)), field_type,
-        std::get<1>(boundary));
-  }
+  MaterialExternalHaloUpdate(
+      communication_manager_.ExternalMultiBoundaryGroups(), field_type,
+      [](nid_t const) { return true; });
 }
 
 /**
@@ -165,6 +299,48 @@ void HaloManager::InterfaceHaloUpdateOnLmax(
   InterfaceHaloUpdateOnLevelList({maximum_level_}, type);
 }
 
+/**
+ * @brief Calls a interface halo update of the specified interface buffer on
+ * Lmax (only!), which leaves the halos of the given nodes untouched.
+ * @param type The identifier of the buffer that is to be updated.
+ * @param frozen_nodes Sorted ids of nodes whose halos do not change. Only
+ * allowed for nodes without MPI boundaries, see
+ * InterfaceHaloDependenciesOnLmax.
+ */
+void HaloManager::InterfaceHaloUpdateOnLmax(
+    InterfaceBlockBufferType const type,
+    std::vector<nid_t> const &frozen_nodes) const {
+  ProfileRegion const region("InterfaceHaloUpdate");
+  internal_halo_manager_.InterfaceHaloUpdateOnLevel(maximum_level_, type,
+                                                    frozen_nodes);
+  for (auto const &domain_boundary :
+       communication_manager_.ExternalBoundaries(maximum_level_)) {
+    nid_t const id = std::get<0>(domain_boundary);
+    if (!std::binary_search(frozen_nodes.begin(), frozen_nodes.end(), id)) {
+      external_halo_manager_.UpdateLevelsetExternal(
+          tree_.GetNodeWithId(id), type, std::get<1>(domain_boundary));
+    }
+  }
+}
+
+/**
+ * @brief Determines the halo dependencies between the given nodes on Lmax
+ * (only!), see InternalHaloManager::InterfaceHaloDependenciesOnLevel.
+ * @param nodes The nodes under consideration.
+ * @param ids The ids of the nodes (indirect return parameter).
+ * @param neighbors For each node the indices of the nodes its halos are filled
+ * from (indirect return parameter).
+ * @param has_mpi_boundary For each node whether one of its halos is exchanged
+ * via MPI (indirect return parameter).
+ */
+void HaloManager::InterfaceHaloDependenciesOnLmax(
+    std::vector<std::reference_wrapper<Node>> const &nodes,
+    std::vector<nid_t> &ids, std::vector<std::vector<std::size_t>> &neighbors,
+    std::vector<bool> &has_mpi_boundary) const {
+  internal_halo_manager_.InterfaceHaloDependenciesOnLevel(
+      maximum_level_, nodes, ids, neighbors, has_mpi_boundary);
+}
+
 /**
  * @brief Adjusts the values in the stated interface block buffer according to
  * their type. (symmetry, internal ...).
@@ -174,6 +350,7 @@ void HaloManager::InterfaceHaloUpdateOnLmax(
 void HaloManager::InterfaceHaloUpdateOnLevelList(
     std::vector<unsigned int> const updated_levels,
     InterfaceBlockBufferType const type) const {
+  ProfileRegion const region("InterfaceHaloUpdate");
   for (auto const &level : updated_levels) {
     internal_halo_manager_.InterfaceHaloUpdateOnLevel(level, type);
     // Update of domain boundaries
@@ -22,6 +22,8 @@
 #ifndef HALO_MANAGER_H
 #define HALO_MANAGER_H
 
+#include <algorithm>
+
 #include "block_definitions/field_interface_definitions.h"
 #include "boundary_condition/external_halo_manager.h"
 #include "communication/communication_manager.h"
@@ -41,6 +43,13 @@ private:
   CommunicationManager const &communication_manager_;
   unsigned int const maximum_level_;
 
+  template <typename Predicate>
+  void MaterialExternalHaloUpdate(ExternalBoundaryGroups const &groups,
+                                  MaterialFieldType const field_type,
+                                  Predicate &&update_node) const;
+  unsigned int HaloDepthOnLevel(unsigned int const level,
+                                unsigned int const depth) const;
+
 public:
   HaloManager() = delete;
   explicit HaloManager(Tree &tree,
@@ -56,20 +65,37 @@ public:
 
   void MaterialHaloUpdate(std::vector<unsigned int> const &levels_ascending,
                           MaterialFieldType const field_type,
-                          bool const cut_jumps = false) const;
+                          bool const cut_jumps = false,
+                          unsigned int const depth = CC::HS()) const;
   void MaterialHaloUpdateOnLevel(unsigned int const level,
                                  MaterialFieldType const field_type,
-                                 bool const cut_jumps = false) const;
+                                 bool const cut_jumps = false,
+                                 unsigned int const depth = CC::HS()) const;
+  void
+  MaterialHaloUpdateBegin(std::vector<unsigned int> const &levels_ascending,
+                          MaterialFieldType const field_type,
+                          bool const cut_jumps,
+                          PendingMaterialHaloUpdate &pending,
+                          unsigned int const depth = CC::HS()) const;
+  bool MaterialHaloUpdateArrived(PendingMaterialHaloUpdate &pending) const;
+  void MaterialHaloUpdateFinish(MaterialFieldType const field_type,
+                                PendingMaterialHaloUpdate &pending) const;
   void MaterialHaloUpdateOnLmax(MaterialFieldType const field_type,
-                                bool const cut_jumps = true) const;
+                                bool const cut_jumps = true,
+                                unsigned int const depth = CC::HS()) const;
   void MaterialHaloUpdateOnLmaxMultis(MaterialFieldType const field_type) const;
 
-  void MaterialInternalHaloUpdateOnLevel(unsigned int const level,
-                                         MaterialFieldType const field_type,
-                                         bool const cut_jumps = false) const;
+  void MaterialInternalHaloUpdateOnLevel(
+      unsigned int const level, MaterialFieldType const field_type,
+      bool const cut_jumps = false, unsigned int const depth = CC::HS()) const;
   void
   MaterialExternalHaloUpdateOnLevel(unsigned int const level,
                                     MaterialFieldType const field_type) const;
+  void
+  MaterialExternalHaloUpdateOnLevel(unsigned int const level,
+                                    MaterialFieldType const field_type,
+                                    std::vector<nid_t> const &nodes_in_flight,
+                                    bool const update_nodes_in_flight) const;
 
   /**
    * @brief Calls an interface tag halo update on Lmax only.
@@ -84,17 +110,24 @@ public:
    * @brief Adjusts the values in the interface tag buffer according to their
    * type. (symmetry, internal ...).
    * @param updated_levels The levels on which halos of nodes will be modified.
+   * @param frozen_nodes Sorted ids of nodes whose halos do not change, see
+   * InternalHaloManager::InterfaceTagHaloUpdateOnLevel.
    * @tparam IDB Level-set buffer type.
    */
   template <InterfaceDescriptionBufferType IDB>
   void InterfaceTagHaloUpdateOnLevelList(
-      std::vector<unsigned int> const &updated_levels) const {
+      std::vector<unsigned int> const &updated_levels,
+      std::vector<nid_t> const &frozen_nodes = {}) const {
     for (unsigned int const &level : updated_levels) {
-      internal_halo_manager_.InterfaceTagHaloUpdateOnLevel(level, IDB);
+      internal_halo_manager_.InterfaceTagHaloUpdateOnLevel(level, IDB,
+                                                           frozen_nodes);
       // Update of domain boundaries
       for (auto const &domain_boundary :
            communication_manager_.ExternalBoundaries(level)) {
         nid_t const id = std::get<0>(domain_boundary);
+        if (std::binary_search(frozen_nodes.begin(), frozen_nodes.end(), id)) {
+          continue;
+        }
         BoundaryLocation const location = std::get<1>(domain_boundary);
         external_halo_manager_.UpdateInterfaceTagExternal(
             tree_.GetNodeWithId(id).GetInterfaceTags<IDB>(), location);
@@ -106,6 +139,12 @@ public:
       std::vector<unsigned int> const updated_levels,
       InterfaceBlockBufferType const halo_type) const;
   void InterfaceHaloUpdateOnLmax(InterfaceBlockBufferType const type) const;
+  void InterfaceHaloUpdateOnLmax(InterfaceBlockBufferType const type,
+                                 std::vector<nid_t> const &frozen_nodes) const;
+  void InterfaceHaloDependenciesOnLmax(
+      std::vector<std::reference_wrapper<Node>> const &nodes,
+      std::vector<nid_t> &ids, std::vector<std::vector<std::size_t>> &neighbors,
+      std::vector<bool> &has_mpi_boundary) const;
 };
 
 #endif // HALO_MANAGER_H
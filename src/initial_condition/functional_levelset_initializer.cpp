@@ -21,6 +21,33 @@
 //===----------------------------------------------------------------------===//
 #include "functional_levelset_initializer.h"
 
+#include <bit>
+#include <cstdint>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+/**
+ * @brief Gives the random number stream of a point, such that random numbers
+ * in the levelset expression are independent of the evaluation order.
+ * @param point The point.
+ * @return The stream ( SplitMix64 hash of the coordinates ).
+ */
+std::uint64_t RandomStreamOfPoint(std::array<double, 3> const &point) {
+  std::uint64_t stream = 0;
+  for (double const coordinate : point) {
+    stream ^= std::bit_cast<std::uint64_t>(coordinate);
+    stream += 0x9E3779B97F4A7C15;
+    stream = (stream ^ (stream >> 30)) * 0xBF58476D1CE4E5B9;
+    stream = (stream ^ (stream >> 27)) * 0x94D049BB133111EB;
+    stream ^= stream >> 31;
+  }
+  return stream;
+}
+} // namespace
+
 /**
  * @brief Constructs a functional levelset initializer with levelset
  * initialization parameters given as input.
@@ -39,11 +66,22 @@ FunctionalLevelsetInitializer::FunctionalLevelsetInitializer(
     double const node_size_on_level_zero, unsigned int const maximum_level)
     : LevelsetInitializer(bounding_boxes, material_names,
                           node_size_on_level_zero, maximum_level),
-      levelset_expression_string_(levelset_expression_string),
-      levelset_expression_(
-          UserExpression(levelset_expression_string_, {levelset_variable_name_},
-                         spatial_variable_names_, expression_point_)) {
-  /* Empty besides initializer list*/
+      levelset_expression_string_(levelset_expression_string) {
+#ifdef _OPENMP
+  std::size_t const number_of_threads =
+      static_cast<std::size_t>(omp_get_max_threads());
+#else
+  std::size_t const number_of_threads = 1;
+#endif
+  // The points are bound by reference, hence they are created completely first
+  expression_points_.assign(number_of_threads, {0.0, 0.0, 0.0});
+  levelset_expressions_.reserve(number_of_threads);
+  for (std::vector<double> &expression_point : expression_points_) {
+    levelset_expressions_.push_back(std::make_unique<UserExpression>(
+        levelset_expression_string_,
+        std::vector<std::string>{levelset_variable_name_},
+        spatial_variable_names_, expression_point));
+  }
 }
 
 /**
@@ -54,9 +92,16 @@ FunctionalLevelsetInitializer::FunctionalLevelsetInitializer(
  */
 double FunctionalLevelsetInitializer::ComputeSignedLevelsetValue(
     std::array<double, 3> const &point) {
+#ifdef _OPENMP
+  std::size_t const thread = static_cast<std::size_t>(omp_get_thread_num());
+#else
+  std::size_t const thread = 0;
+#endif
   std::copy(std::cbegin(point), std::cend(point),
-            std::begin(expression_point_));
-  return levelset_expression_.GetValue(levelset_variable_name_);
+            std::begin(expression_points_[thread]));
+  UserExpression &levelset_expression = *levelset_expressions_[thread];
+  levelset_expression.SetRandomStream(RandomStreamOfPoint(point));
+  return levelset_expression.GetValue(levelset_variable_name_);
 }
 
 /**
@@ -22,6 +22,9 @@
 #ifndef FUNCTIONAL_LEVELSET_INITIALIZER_H
 #define FUNCTIONAL_LEVELSET_INITIALIZER_H
 
+#include <memory>
+#include <vector>
+
 #include "block_definitions/field_interface_definitions.h"
 #include "initial_condition/levelset_initializer.h"
 #include "user_expression.h"
@@ -43,8 +46,10 @@ class FunctionalLevelsetInitializer : public LevelsetInitializer {
   std::string const levelset_variable_name_ =
       std::string(IF::InputName(InterfaceDescription::Levelset));
   std::string const levelset_expression_string_;
-  std::vector<double> expression_point_ = {0.0, 0.0, 0.0};
-  UserExpression const levelset_expression_;
+  // Each thread evaluates its own expression bound to its own point, such that
+  // nodes can be initialized concurrently
+  std::vector<std::vector<double>> expression_points_;
+  std::vector<std::unique_ptr<UserExpression>> levelset_expressions_;
 
   // Functions required from base class
   double
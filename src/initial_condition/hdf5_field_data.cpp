@@ -0,0 +1,298 @@
+//===------------------------ hdf5_field_data.cpp -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "initial_condition/hdf5_field_data.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+/**
+ * @brief Position of a coordinate within the points of a grid direction.
+ */
+struct GridPosition {
+  // Index of the lower point of the enclosing interval
+  hsize_t index_ = 0;
+  // Weight of the upper point
+  double weight_ = 0.0;
+};
+
+/**
+ * @brief Locates a coordinate within the points of a grid direction. Outside
+ * of the grid the closest boundary point is taken.
+ * @param points The strictly increasing point coordinates.
+ * @param coordinate The coordinate to be located.
+ * @return The enclosing interval and the linear interpolation weight.
+ */
+GridPosition LocateInGrid(std::vector<double> const &points,
+                          double const coordinate) {
+  GridPosition position;
+  if (points.size() < 2) {
+    return position;
+  }
+  auto const upper =
+      std::upper_bound(points.cbegin(), points.cend(), coordinate);
+  std::ptrdiff_t const lower = std::distance(points.cbegin(), upper) - 1;
+  position.index_ = static_cast<hsize_t>(
+      std::clamp(lower, std::ptrdiff_t(0), std::ptrdiff_t(points.size() - 2)));
+  double const interval = points[position.index_ + 1] - points[position.index_];
+  position.weight_ =
+      std::clamp((coordinate - points[position.index_]) / interval, 0.0, 1.0);
+  return position;
+}
+} // namespace
+
+/**
+ * @brief Opens the hdf5 file and reads the grid coordinates. No field data is
+ * read yet.
+ * @param filename Path to the hdf5 file.
+ * @param variable_names Names of the variables to be read ( empty names and
+ * variables that are not in the file are marked unavailable ).
+ */
+Hdf5FieldData::Hdf5FieldData(std::string const &filename,
+                             std::vector<std::string> const &variable_names)
+    : filename_(filename),
+      file_id_(H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT)),
+      datasets_(variable_names.size(), -1) {
+  if (file_id_ < 0) {
+    throw std::invalid_argument("The field data file " + filename_ +
+                                " cannot be opened!");
+  }
+  // The destructor is not called if the construction fails
+  auto const close_and_throw = [this](std::string const &message) {
+    for (hid_t const dataset : datasets_) {
+      if (dataset >= 0) {
+        H5Dclose(dataset);
+      }
+    }
+    H5Fclose(file_id_);
+    throw std::invalid_argument(message);
+  };
+
+  // Read the coordinates of the active dimensions
+  std::array<hsize_t, 3> number_of_points = {1, 1, 1};
+  std::array<char const *, 3> const coordinate_names = {"x", "y", "z"};
+  for (unsigned int d = 0; d < 3; ++d) {
+    if (d >= DTI(CC::DIM())) {
+      coordinates_[d].assign(1, 0.0);
+      continue;
+    }
+    if (H5Lexists(file_id_, coordinate_names[d], H5P_DEFAULT) <= 0) {
+      close_and_throw("The field data file " + filename_ +
+                      " has no coordinates " + coordinate_names[d] + "!");
+    }
+    hid_t const dataset = H5Dopen2(file_id_, coordinate_names[d], H5P_DEFAULT);
+    hid_t const dataspace = H5Dget_space(dataset);
+    number_of_points[d] =
+        static_cast<hsize_t>(H5Sget_simple_extent_npoints(dataspace));
+    coordinates_[d].resize(number_of_points[d]);
+    H5Dread(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+            coordinates_[d].data());
+    H5Sclose(dataspace);
+    H5Dclose(dataset);
+    if (coordinates_[d].empty() ||
+        std::adjacent_find(coordinates_[d].cbegin(), coordinates_[d].cend(),
+                           std::greater_equal<double>()) !=
+            coordinates_[d].cend()) {
+      close_and_throw("The coordinates " + std::string(coordinate_names[d]) +
+                      " in " + filename_ + " must be strictly increasing!");
+    }
+  }
+  for (unsigned int d = 0; d < 3; ++d) {
+    number_of_tiles_[d] =
+        std::max(hsize_t(1), (number_of_points[d] - 1 + tile_intervals_ - 1) /
+                                 tile_intervals_);
+  }
+
+  // Open the datasets of the variables and check their extents
+  for (std::size_t v = 0; v < variable_names.size(); ++v) {
+    if (variable_names[v].empty() ||
+        H5Lexists(file_id_, variable_names[v].c_str(), H5P_DEFAULT) <= 0) {
+      continue;
+    }
+    datasets_[v] = H5Dopen2(file_id_, variable_names[v].c_str(), H5P_DEFAULT);
+    hid_t const dataspace = H5Dget_space(datasets_[v]);
+    std::array<hsize_t, 3> extents = {1, 1, 1};
+    int const rank = H5Sget_simple_extent_ndims(dataspace);
+    if (rank == int(DTI(CC::DIM()))) {
+      H5Sget_simple_extent_dims(dataspace, extents.data(), nullptr);
+    }
+    H5Sclose(dataspace);
+    if (rank != int(DTI(CC::DIM())) || extents != number_of_points) {
+      close_and_throw("The dataset " + variable_names[v] + " in " + filename_ +
+                      " does not match the coordinates!");
+    }
+  }
+}
+
+/**
+ * @brief Closes the datasets and the file.
+ */
+Hdf5FieldData::~Hdf5FieldData() {
+  for (hid_t const dataset : datasets_) {
+    if (dataset >= 0) {
+      H5Dclose(dataset);
+    }
+  }
+  H5Fclose(file_id_);
+}
+
+/**
+ * @brief Indicates whether a variable is given in the file.
+ * @param variable_index Index of the variable ( as given on construction ).
+ * @return True if the variable is read from the file, false otherwise.
+ */
+bool Hdf5FieldData::HasVariable(unsigned int const variable_index) const {
+  return datasets_[variable_index] >= 0;
+}
+
+/**
+ * @brief Gives the index of the first grid point of a tile.
+ * @param tile The tile index in each direction.
+ * @return The first point index in each direction.
+ */
+std::array<hsize_t, 3>
+Hdf5FieldData::TileStart(std::array<hsize_t, 3> const &tile) const {
+  return {tile[0] * tile_intervals_, tile[1] * tile_intervals_,
+          tile[2] * tile_intervals_};
+}
+
+/**
+ * @brief Gives the number of grid points of a tile ( including the points
+ * shared with the neighboring tiles ).
+ * @param tile The tile index in each direction.
+ * @return The number of points in each direction.
+ */
+std::array<hsize_t, 3>
+Hdf5FieldData::TileExtent(std::array<hsize_t, 3> const &tile) const {
+  std::array<hsize_t, 3> const start = TileStart(tile);
+  std::array<hsize_t, 3> extent;
+  for (unsigned int d = 0; d < 3; ++d) {
+    extent[d] = std::min(start[d] + tile_intervals_,
+                         hsize_t(coordinates_[d].size() - 1)) -
+                start[d] + 1;
+  }
+  return extent;
+}
+
+/**
+ * @brief Gives the values of all variables in a tile. The tile is read from
+ * the file on first access.
+ * @param tile The tile index in each direction.
+ * @return The values of all variables ( zero for unavailable variables ).
+ * @note Must be called with the tile mutex held.
+ */
+std::vector<double> const &
+Hdf5FieldData::Tile(std::array<hsize_t, 3> const &tile) const {
+  std::uint64_t const key =
+      (tile[0] * number_of_tiles_[1] + tile[1]) * number_of_tiles_[2] + tile[2];
+  auto [entry, inserted] = tiles_.try_emplace(key);
+  if (!inserted) {
+    return entry->second;
+  }
+
+  std::array<hsize_t, 3> const start = TileStart(tile);
+  std::array<hsize_t, 3> const extent = TileExtent(tile);
+  hsize_t const number_of_values = extent[0] * extent[1] * extent[2];
+  std::vector<double> &values = entry->second;
+  values.assign(datasets_.size() * number_of_values, 0.0);
+  // Only the active dimensions are part of the datasets
+  int const rank = int(DTI(CC::DIM()));
+  hid_t const memory_space = H5Screate_simple(rank, extent.data(), nullptr);
+  for (std::size_t v = 0; v < datasets_.size(); ++v) {
+    if (datasets_[v] < 0) {
+      continue;
+    }
+    hid_t const file_space = H5Dget_space(datasets_[v]);
+    H5Sselect_hyperslab(file_space, H5S_SELECT_SET, start.data(), nullptr,
+                        extent.data(), nullptr);
+    H5Dread(datasets_[v], H5T_NATIVE_DOUBLE, memory_space, file_space,
+            H5P_DEFAULT, values.data() + v * number_of_values);
+    H5Sclose(file_space);
+  }
+  H5Sclose(memory_space);
+  return values;
+}
+
+/**
+ * @brief Interpolates all variables (multi-)linearly onto the cell centers of
+ * a block.
+ * @param origin Coordinates of the block origin ( dimensional ).
+ * @param cell_size Size of the cells of the block ( dimensional ).
+ * @param values Buffer holding the interpolated values ( dimensional, zero for
+ * unavailable variables ). Indirect return value.
+ */
+void Hdf5FieldData::InterpolateOnBlock(
+    std::array<double, 3> const &origin, double const cell_size,
+    double (&values)[MF::ANOP()][CC::ICX()][CC::ICY()][CC::ICZ()]) const {
+  std::array<unsigned int, 3> const cells = {CC::ICX(), CC::ICY(), CC::ICZ()};
+  std::array<std::vector<GridPosition>, 3> positions;
+  for (unsigned int d = 0; d < 3; ++d) {
+    for (unsigned int cell = 0; cell < cells[d]; ++cell) {
+      positions[d].push_back(LocateInGrid(
+          coordinates_[d], origin[d] + (double(cell) + 0.5) * cell_size));
+    }
+  }
+  // Corners of the interpolation stencil of the active dimensions
+  unsigned int const number_of_corners = 1u << DTI(CC::DIM());
+
+  std::scoped_lock const lock(tile_mutex_);
+  for (unsigned int i = 0; i < CC::ICX(); ++i) {
+    for (unsigned int j = 0; j < CC::ICY(); ++j) {
+      for (unsigned int k = 0; k < CC::ICZ(); ++k) {
+        std::array<GridPosition, 3> const cell_position = {
+            positions[0][i], positions[1][j], positions[2][k]};
+        std::array<hsize_t, 3> tile;
+        for (unsigned int d = 0; d < 3; ++d) {
+          tile[d] = std::min(cell_position[d].index_ / tile_intervals_,
+                             number_of_tiles_[d] - 1);
+        }
+        std::vector<double> const &tile_values = Tile(tile);
+        std::array<hsize_t, 3> const start = TileStart(tile);
+        std::array<hsize_t, 3> const extent = TileExtent(tile);
+        hsize_t const number_of_values = extent[0] * extent[1] * extent[2];
+
+        for (unsigned int v = 0; v < datasets_.size(); ++v) {
+          values[v][i][j][k] = 0.0;
+        }
+        for (unsigned int corner = 0; corner < number_of_corners; ++corner) {
+          double weight = 1.0;
+          std::array<hsize_t, 3> point = {0, 0, 0};
+          for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+            bool const upper = (corner >> d) & 1u;
+            weight *= upper ? cell_position[d].weight_
+                            : 1.0 - cell_position[d].weight_;
+            point[d] = cell_position[d].index_ - start[d] + (upper ? 1 : 0);
+          }
+          if (weight == 0.0) {
+            continue;
+          }
+          hsize_t const offset =
+              (point[0] * extent[1] + point[1]) * extent[2] + point[2];
+          for (unsigned int v = 0; v < datasets_.size(); ++v) {
+            values[v][i][j][k] +=
+                weight * tile_values[v * number_of_values + offset];
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,86 @@
+//===------------------------- hdf5_field_data.h --------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef HDF5_FIELD_DATA_H
+#define HDF5_FIELD_DATA_H
+
+#include <array>
+#include <cstdint>
+#include <hdf5.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "block_definitions/field_material_definitions.h"
+#include "user_specifications/compile_time_constants.h"
+
+/**
+ * @brief The Hdf5FieldData class provides field data given on a structured
+ * (rectilinear) grid in an hdf5 file, e.g. a precursor simulation, for the
+ * initialization. The file holds the strictly increasing point coordinates of
+ * each active dimension in the datasets "x", "y" and "z" and one dataset per
+ * variable named as the variable, with one extent per active dimension (x
+ * being the slowest index). Coordinates and values are given in dimensional
+ * form. Points outside of the grid take the value of the closest grid point.
+ * @note The file is not read as a whole. Each rank only reads the tiles of the
+ * grid its blocks overlap. Since the blocks of a rank are contiguous along the
+ * space-filling curve, the source data is distributed in the same way as the
+ * mesh. Tiles are read independently by each rank and kept until destruction.
+ */
+class Hdf5FieldData {
+  // Number of grid intervals per tile and direction ( neighboring tiles share
+  // their boundary points, hence an interval always lies in a single tile )
+  static constexpr hsize_t tile_intervals_ = 32;
+
+  std::string const filename_;
+  hid_t file_id_;
+  // Dataset of each variable ( negative if not given in the file )
+  std::vector<hid_t> datasets_;
+  // Point coordinates of the grid ( a single point for inactive dimensions )
+  std::array<std::vector<double>, 3> coordinates_;
+  std::array<hsize_t, 3> number_of_tiles_;
+  // Tiles that have been read, keyed by their linear index. Each holds all
+  // variables one after another
+  mutable std::unordered_map<std::uint64_t, std::vector<double>> tiles_;
+  mutable std::mutex tile_mutex_;
+
+  std::array<hsize_t, 3> TileStart(std::array<hsize_t, 3> const &tile) const;
+  std::array<hsize_t, 3> TileExtent(std::array<hsize_t, 3> const &tile) const;
+  std::vector<double> const &Tile(std::array<hsize_t, 3> const &tile) const;
+
+public:
+  Hdf5FieldData() = delete;
+  explicit Hdf5FieldData(std::string const &filename,
+                         std::vector<std::string> const &variable_names);
+  ~Hdf5FieldData();
+  Hdf5FieldData(Hdf5FieldData const &) = delete;
+  Hdf5FieldData &operator=(Hdf5FieldData const &) = delete;
+  Hdf5FieldData(Hdf5FieldData &&) = delete;
+  Hdf5FieldData &operator=(Hdf5FieldData &&) = delete;
+
+  bool HasVariable(unsigned int const variable_index) const;
+  void InterpolateOnBlock(
+      std::array<double, 3> const &origin, double const cell_size,
+      double (&values)[MF::ANOP()][CC::ICX()][CC::ICY()][CC::ICZ()]) const;
+};
+
+#endif // HDF5_FIELD_DATA_H
@@ -47,7 +47,9 @@ protected:
   // Protected member
   std::vector<std::string> const spatial_variable_names_ = {"x", "y", "z"};
 
-  // Functions that need to be implemented by the derived classes
+  // Functions that need to be implemented by the derived classes. The levelset
+  // is evaluated for several nodes concurrently, hence
+  // ComputeSignedLevelsetValue must be thread-safe.
   virtual double
   ComputeSignedLevelsetValue(std::array<double, 3> const &point) = 0;
   virtual std::string GetTypeLogData(unsigned int const indent) const = 0;
@@ -61,22 +61,21 @@ std::vector<std::array<double, 3>> ComputeInterfaceCoordinates(
 
   // Create the parametric expression with two running coordinates
   std::vector<double> parameteric_point(2, 0.0);
-  UserExpression const parameteric_expression(
+  UserExpression parameteric_expression(
       UserExpression(parametric_expression, spatial_variable_names,
                      variables_names, parameteric_point));
 
   std::array<double, 3> interface_point = {0.0, 0.0, 0.0};
+  std::vector<double> interface_values(spatial_variable_names.size());
 
   for (std::uint64_t i = 0; i < number_of_points[0]; ++i) {
     parameteric_point[0] = start_values[0] + double(i) * delta_increments[0];
     for (std::uint64_t j = 0; j < number_of_points[1]; ++j) {
       parameteric_point[1] = start_values[1] + double(j) * delta_increments[1];
-      std::transform(std::cbegin(spatial_variable_names),
-                     std::cend(spatial_variable_names),
-                     std::begin(interface_point),
-                     [&parameteric_expression](std::string const variable) {
-                       return parameteric_expression.GetValue(variable);
-                     });
+      parameteric_expression.SetRandomStream(i, static_cast<std::uint32_t>(j));
+      parameteric_expression.GetValues(interface_values);
+      std::copy(std::cbegin(interface_values), std::cend(interface_values),
+                std::begin(interface_point));
       interface_coordinates.push_back(interface_point);
     }
   }
@@ -21,6 +21,11 @@
 //===----------------------------------------------------------------------===//
 #include "prime_state_initializer.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "initial_condition/hdf5_field_data.h"
 #include "topology/id_information.h"
 #include "user_expression.h"
 
@@ -34,18 +39,65 @@
  * @param dimensionalized_node_size_on_level_zero Size of a node on level zero
  * (dimensionalized form).
  * @param unit_handler Instance to provide (non-)dimensionalization operations.
+ * @param field_data_files The hdf5 field data file of each material ( empty
+ * for materials initialized from their expression ).
  */
 PrimeStateInitializer::PrimeStateInitializer(
     std::vector<std::string> const &prime_state_expression_strings,
     std::vector<std::string> const &prime_state_variable_names,
     double const dimensionalized_node_size_on_level_zero,
-    UnitHandler const &unit_handler)
+    UnitHandler const &unit_handler,
+    std::vector<std::string> const &field_data_files)
     : unit_handler_(unit_handler),
       prime_state_expression_strings_(prime_state_expression_strings),
       prime_state_variable_names_(prime_state_variable_names),
       dimensionalized_node_size_on_level_zero_(
           dimensionalized_node_size_on_level_zero) {
-  /** Empty besides initializer list */
+#ifdef _OPENMP
+  expression_caches_.resize(omp_get_max_threads());
+#else
+  expression_caches_.resize(1);
+#endif
+  for (std::string const &file : field_data_files) {
+    field_data_.push_back(file.empty()
+                              ? nullptr
+                              : std::make_unique<Hdf5FieldData const>(
+                                    file, prime_state_variable_names_));
+  }
+}
+
+/**
+ * @brief Default destructor ( defined here, as the user expression and the
+ * field data are incomplete in the header ).
+ */
+PrimeStateInitializer::~PrimeStateInitializer() = default;
+
+/**
+ * @brief Gives the compiled prime state expression of the given material for
+ * the calling thread. The expression is parsed and compiled on first use only.
+ * @param material The material whose expression is requested.
+ * @return The compiled expression and the point it is bound to.
+ */
+PrimeStateInitializer::CompiledExpression &
+PrimeStateInitializer::ExpressionOfMaterial(MaterialName const material) const {
+#ifdef _OPENMP
+  std::size_t const thread = static_cast<std::size_t>(omp_get_thread_num());
+#else
+  std::size_t const thread = 0;
+#endif
+  std::string const &expression_string =
+      prime_state_expression_strings_[MTI(material)];
+  auto [entry, inserted] =
+      expression_caches_[thread].try_emplace(expression_string);
+  CompiledExpression &compiled = entry->second;
+  if (inserted) {
+    // The point is bound by reference, hence it is created in place first
+    compiled.point_.assign(3, 0.0);
+    compiled.expression_ = std::make_unique<UserExpression>(
+        expression_string, prime_state_variable_names_, spatial_variable_names_,
+        compiled.point_);
+  }
+  return compiled;
 }
 
 /**
@@ -68,11 +120,30 @@ void PrimeStateInitializer::GetInitialPrimeStates(
   double const cell_size =
       CellSizeOfId(node_id, dimensionalized_node_size_on_level_zero_);
 
-  // create the expression
-  std::vector<double> cell_center_point(3, 0.0);
-  UserExpression const prime_state_expression(UserExpression(
-      prime_state_expression_strings_[MTI(material)],
-      prime_state_variable_names_, spatial_variable_names_, cell_center_point));
+  // Materials given as field data are interpolated instead
+  if (MTI(material) < field_data_.size() && field_data_[MTI(material)]) {
+    Hdf5FieldData const &field_data = *field_data_[MTI(material)];
+    field_data.InterpolateOnBlock(origin, cell_size, prime_state_buffer);
+    for (PrimeState const p : MF::ASOP()) {
+      for (unsigned int i = 0; i < CC::ICX(); ++i) {
+        for (unsigned int j = 0; j < CC::ICY(); ++j) {
+          for (unsigned int k = 0; k < CC::ICZ(); ++k) {
+            prime_state_buffer[PTI(p)][i][j][k] =
+                unit_handler_.NonDimensionalizeValue(
+                    prime_state_buffer[PTI(p)][i][j][k], MF::FieldUnit(p));
+          }
+        }
+      }
+    }
+    return;
+  }
+
+  // get the ( cached ) expression
+  CompiledExpression &compiled = ExpressionOfMaterial(material);
+  std::vector<double> &cell_center_point = compiled.point_;
+  UserExpression &prime_state_expression = *compiled.expression_;
+  // The expression is evaluated once per cell for all prime states
+  std::vector<double> prime_state_values(prime_state_variable_names_.size());
 
   // Loop through all cells to assign correct values to the buffer
   for (unsigned int i = 0; i < CC::ICX(); ++i) {
@@ -83,14 +154,17 @@ void PrimeStateInitializer::GetInitialPrimeStates(
       for (unsigned int k = 0; k < CC::ICZ(); ++k) {
         if constexpr (CC::DIM() == Dimension::Three)
           cell_center_point[2] = origin[2] + (double(k) + 0.5) * cell_size;
+        // Random numbers are keyed by node and cell to be independent of the
+        // evaluation order
+        prime_state_expression.SetRandomStream(
+            node_id, (i * CC::ICY() + j) * CC::ICZ() + k);
+        prime_state_expression.GetValues(prime_state_values);
         for (PrimeState const p : MF::ASOP()) {
           // If the variable name is not empty obtain value from expression.
           if (!prime_state_variable_names_[PTI(p)].empty()) {
             prime_state_buffer[PTI(p)][i][j][k] =
-                unit_handler_.NonDimensionalizeValue(
-                    prime_state_expression.GetValue(
-                        prime_state_variable_names_[PTI(p)]),
-                    MF::FieldUnit(p));
+                unit_handler_.NonDimensionalizeValue(prime_state_values[PTI(p)],
+                                                     MF::FieldUnit(p));
           } else { // Otherwise set zero value
             prime_state_buffer[PTI(p)][i][j][k] = 0.0;
           }
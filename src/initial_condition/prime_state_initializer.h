@@ -22,7 +22,9 @@
 #ifndef PRIME_STATE_INITIALIZER_H
 #define PRIME_STATE_INITIALIZER_H
 
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "block_definitions/field_material_definitions.h"
@@ -31,9 +33,13 @@
 #include "unit_handler.h"
 #include "user_specifications/compile_time_constants.h"
 
+class UserExpression;
+class Hdf5FieldData;
+
 /**
  * @brief The PrimeStateInitializer class allows for a prime state
- * initialization.
+ * initialization. Materials are either initialized from an expression or
+ * interpolated from field data given in an hdf5 file.
  * @note Uses the C++ Mathematical Expression Toolkit Library by Arash Partow,
  * see respective files for License and Copyright information.
  */
@@ -45,18 +51,34 @@ class PrimeStateInitializer {
   std::vector<std::string> const prime_state_expression_strings_;
   std::vector<std::string> const prime_state_variable_names_;
   std::vector<std::string> const spatial_variable_names_ = {"x", "y", "z"};
+  // Field data of each material ( nullptr if initialized from an expression )
+  std::vector<std::unique_ptr<Hdf5FieldData const>> field_data_;
 
   // Additional required variables
   double const dimensionalized_node_size_on_level_zero_;
 
+  // Compiled expression together with the point it is bound to
+  struct CompiledExpression {
+    std::vector<double> point_;
+    std::unique_ptr<UserExpression> expression_;
+  };
+  // Expressions are compiled once on first use and keyed by their string ( the
+  // variables are the same for all ). Each thread has its own cache, as an
+  // evaluation writes the bound point and the output variables.
+  mutable std::vector<std::unordered_map<std::string, CompiledExpression>>
+      expression_caches_;
+
+  CompiledExpression &ExpressionOfMaterial(MaterialName const material) const;
+
 public:
   PrimeStateInitializer(PrimeStateInitializer const &) = delete;
   explicit PrimeStateInitializer(
       std::vector<std::string> const &prime_state_expression_strings,
       std::vector<std::string> const &prime_state_variable_names,
       double const dimensionalized_node_size_on_level_zero,
-      UnitHandler const &unit_handler);
-  ~PrimeStateInitializer() = default;
+      UnitHandler const &unit_handler,
+      std::vector<std::string> const &field_data_files = {});
+  ~PrimeStateInitializer();
   PrimeStateInitializer &operator=(PrimeStateInitializer const &) = delete;
   PrimeStateInitializer(PrimeStateInitializer &&) = delete;
   PrimeStateInitializer &operator=(PrimeStateInitializer &&) = delete;
@@ -40,7 +40,8 @@ StlLevelsetInitializer::StlLevelsetInitializer(
     : LevelsetInitializer(bounding_boxes, material_names,
                           node_size_on_level_zero, maximum_level),
       stl_filename_(stl_filename),
-      stl_triangles_(StlUtilities::ReadStl(stl_filename_)) {
+      stl_triangles_(StlUtilities::ReadStl(stl_filename_)),
+      stl_hierarchy_(stl_triangles_) {
   /* Empty besides initializer list*/
 }
 
@@ -52,11 +53,7 @@ StlLevelsetInitializer::StlLevelsetInitializer(
  */
 double StlLevelsetInitializer::ComputeSignedLevelsetValue(
     std::array<double, 3> const &point) {
-  double levelset = std::numeric_limits<double>::max();
-  for (StlUtilities::Triangle const &triangle : stl_triangles_) {
-    StlUtilities::Voxelization(triangle, point, levelset);
-  }
-  return levelset;
+  return stl_hierarchy_.SignedDistance(point);
 }
 
 /**
@@ -28,17 +28,19 @@
 /**
  * @brief The StlLevelsetInitializer class allows for a levelset initialization
  * based on a provided STL file. It contains the levelset computation, the loop
- * structure is in the base class.
- * @note The number and size of the triangles, the surface is composed of, must
- * be appropriate for the used mesh size. In case smaller cell sizes are used,
- *       the number of triangles must be increased and the size reduced. The
- * inversely holds for coarser meshes.
+ * structure is in the base class. The levelset is the exact signed distance to
+ * the closest triangle, found with a bounding volume hierarchy built once when
+ * the file is read.
+ * @note The surface must be closed and its normals must point outwards, since
+ * the sign is taken from the normals of the closest triangles.
  */
 class StlLevelsetInitializer : public LevelsetInitializer {
   // Member variables of this class only
   std::string const stl_filename_;
 
   std::vector<StlUtilities::Triangle> stl_triangles_;
+  // Built once over the triangles for the closest-triangle queries
+  StlUtilities::BoundingVolumeHierarchy const stl_hierarchy_;
 
   // Functions required from base class
   double
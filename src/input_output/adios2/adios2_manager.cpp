@@ -0,0 +1,281 @@
+//===----------------------- adios2_manager.cpp ---------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/adios2/adios2_manager.h"
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "communication/mpi_utilities.h"
+
+/**
+ * @brief Indicates whether ALPACA is built with ADIOS2.
+ * @return True if the ADIOS2 backend can be used, false otherwise.
+ */
+bool Adios2Manager::IsAvailable() {
+#ifdef ALPACA_WITH_ADIOS2
+  return true;
+#else
+  return false;
+#endif
+}
+
+#ifdef ALPACA_WITH_ADIOS2
+/**
+ * @brief Creates the manager on all ranks of the communicator.
+ * @param settings Engine and aggregation of the streams.
+ */
+Adios2Manager::Adios2Manager(Adios2Settings const settings)
+    : settings_(settings), adios_(MpiUtilities::Communicator()) {
+  /** Empty besides initializer list */
+}
+
+/**
+ * @brief Destructor closes all streams that are still open. Must be called by
+ * all ranks before MPI is finalized.
+ */
+Adios2Manager::~Adios2Manager() {
+  for (auto &[name, stream] : streams_) {
+    stream.engine_.Close();
+  }
+}
+
+/**
+ * @brief Begins a new step of the given stream and writes the output time
+ * into it. The stream is opened with its first step. BP5 streams are written
+ * as file with the extension .bp, SST streams publish their contact
+ * information under the stream name.
+ * @param stream_name Name of the stream (including path).
+ * @param output_time Time of the output.
+ */
+void Adios2Manager::BeginStep(std::string const &stream_name,
+                              double const output_time) {
+#ifndef PERFORMANCE
+  if (!active_stream_.empty()) {
+    throw std::runtime_error("Cannot begin two ADIOS2 steps at the same time!");
+  }
+#endif
+  auto stream = streams_.find(stream_name);
+  if (stream == streams_.end()) {
+    adios2::IO io = adios_.DeclareIO(stream_name);
+    if (settings_.engine_ == Adios2Engine::SST) {
+      io.SetEngine("SST");
+      // The simulation neither waits for readers nor for slow ones
+      io.SetParameters({{"RendezvousReaderCount", "0"},
+                        {"QueueLimit", "2"},
+                        {"QueueFullPolicy", "Discard"}});
+    } else {
+      io.SetEngine("BP5");
+      io.SetParameter("AsyncWrite", "true");
+      if (settings_.aggregators_ > 0) {
+        io.SetParameter("NumAggregators",
+                        std::to_string(settings_.aggregators_));
+      }
+    }
+    std::string const filename = settings_.engine_ == Adios2Engine::SST
+                                     ? stream_name
+                                     : stream_name + ".bp";
+    stream = streams_
+                 .emplace(stream_name,
+                          Stream{io, io.Open(filename, adios2::Mode::Write)})
+                 .first;
+  }
+  Stream &active = stream->second;
+  active.engine_.BeginStep();
+  adios2::Variable<double> time = active.io_.InquireVariable<double>("time");
+  if (!time) {
+    time = active.io_.DefineVariable<double>("time");
+  }
+  if (MpiUtilities::MasterRank()) {
+    active.engine_.Put(time, output_time, adios2::Mode::Sync);
+  }
+  active_stream_ = stream_name;
+}
+
+/**
+ * @brief Ends the current step, i.e., the step is handed to the engine, which
+ * writes or stages it (asynchronously).
+ */
+void Adios2Manager::EndStep() {
+  CloseGroup();
+  streams_.at(active_stream_).engine_.EndStep();
+  active_stream_.clear();
+}
+
+/**
+ * @brief Closes the given stream if it is open.
+ * @param stream_name Name of the stream.
+ */
+void Adios2Manager::CloseStream(std::string const &stream_name) {
+  auto const stream = streams_.find(stream_name);
+  if (stream != streams_.end()) {
+    stream->second.engine_.Close();
+    streams_.erase(stream);
+    adios_.RemoveIO(stream_name);
+  }
+}
+
+/**
+ * @brief Writes the local block of a dataset as variable of the current step.
+ * The variable is defined with its compression in the first step and only
+ * resized afterwards.
+ * @param dataspace_name Name of the reserved dataspace.
+ * @param dataset_name Name of the dataset.
+ * @param buffer Pointer to the CONTIGUOUS buffer that is written.
+ * @param compression Operator applied to the variable.
+ *
+ * @tparam T Type of the values.
+ */
+template <typename T>
+void Adios2Manager::Put(std::string const &dataspace_name,
+                        std::string const &dataset_name, T const *buffer,
+                        OutputCompression const &compression) {
+  Stream &stream = streams_.at(active_stream_);
+  Dataspace const &dataspace = dataspaces_.at(dataspace_name);
+  std::string const name = active_group_ + dataset_name;
+  adios2::Variable<T> variable = stream.io_.InquireVariable<T>(name);
+  if (!variable) {
+    variable = stream.io_.DefineVariable<T>(name, dataspace.shape_,
+                                            dataspace.start_, dataspace.count_);
+    if (compression.type_ == OutputCompressionType::Deflate) {
+      variable.AddOperation(
+          "blosc", {{"compressor", "zlib"},
+                    {"clevel", std::to_string(compression.deflate_level_)}});
+    } else if (compression.type_ == OutputCompressionType::Zfp) {
+      variable.AddOperation(
+          "zfp", {{"accuracy", std::to_string(compression.error_bound_)}});
+    }
+  } else {
+    variable.SetShape(dataspace.shape_);
+    variable.SetSelection({dataspace.start_, dataspace.count_});
+  }
+  // Ranks without data do not contribute a block
+  if (dataspace.count_.front() > 0) {
+    stream.engine_.Put(variable, buffer, adios2::Mode::Sync);
+  }
+}
+#else
+/**
+ * @brief Without ADIOS2, the manager cannot be created.
+ */
+Adios2Manager::Adios2Manager(Adios2Settings const settings)
+    : settings_(settings) {
+  throw std::invalid_argument(
+      "The ADIOS2 output backend requires a build with ADIOS2!");
+}
+
+Adios2Manager::~Adios2Manager() = default;
+void Adios2Manager::BeginStep(std::string const &, double const) {}
+void Adios2Manager::EndStep() {}
+void Adios2Manager::CloseStream(std::string const &) {}
+template <typename T>
+void Adios2Manager::Put(std::string const &, std::string const &, T const *,
+                        OutputCompression const &) {}
+#endif
+
+/**
+ * @brief Opens a group, i.e., all following datasets are prefixed with its
+ * name.
+ * @param group_name Name of the group.
+ */
+void Adios2Manager::OpenGroup(std::string const &group_name) {
+  active_group_ = group_name + "/";
+}
+
+/**
+ * @brief Closes the active group together with all reserved dataspaces.
+ */
+void Adios2Manager::CloseGroup(std::string const &) {
+  dataspaces_.clear();
+  active_group_.clear();
+}
+
+/**
+ * @brief Reserves a dataspace, i.e., the global shape and the local selection
+ * of the datasets written into it. See Hdf5Manager::ReserveDataspace.
+ * @param dataspace_name Name of the dataspace.
+ * @param dataspace_total_dimensions Global dimensions of the dataspace.
+ * @param dataset_local_dimensions Dimensions of the local block.
+ * @param local_elements_start_index Start index of the local block in the first
+ * dimension.
+ */
+void Adios2Manager::ReserveDataspace(
+    std::string const &dataspace_name,
+    std::vector<hsize_t> const &dataspace_total_dimensions,
+    std::vector<hsize_t> const &dataset_local_dimensions,
+    hsize_t const local_elements_start_index, hid_t const) {
+  Dataspace dataspace;
+  dataspace.shape_.assign(dataspace_total_dimensions.begin(),
+                          dataspace_total_dimensions.end());
+  dataspace.count_.assign(dataset_local_dimensions.begin(),
+                          dataset_local_dimensions.end());
+  dataspace.start_.assign(dataspace.shape_.size(), 0);
+  dataspace.start_.front() = local_elements_start_index;
+  dataspaces_[dataspace_name] = dataspace;
+}
+
+/**
+ * @brief Releases a reserved dataspace.
+ * @param dataspace_name Name of the dataspace (empty: all dataspaces).
+ */
+void Adios2Manager::CloseDataset(std::string const &dataspace_name) {
+  if (dataspace_name.empty()) {
+    dataspaces_.clear();
+  } else {
+    dataspaces_.erase(dataspace_name);
+  }
+}
+
+/**
+ * @brief Writes a dataset into a reserved dataspace. The type of the variable
+ * is given by the buffer, hence the datatype identifier is not used.
+ * @param dataspace_name Name of the reserved dataspace.
+ * @param dataset_name Name of the dataset.
+ * @param buffer Pointer to the CONTIGUOUS buffer that is written.
+ * @param compression Operator applied to the variable.
+ */
+void Adios2Manager::WriteDatasetToDataspace(
+    std::string const &dataspace_name, std::string const &dataset_name,
+    double const *buffer, OutputCompression const &compression, hid_t const) {
+  Put(dataspace_name, dataset_name, buffer, compression);
+}
+
+/**
+ * @brief See overload for double buffers.
+ */
+void Adios2Manager::WriteDatasetToDataspace(
+    std::string const &dataspace_name, std::string const &dataset_name,
+    float const *buffer, OutputCompression const &compression, hid_t const) {
+  Put(dataspace_name, dataset_name, buffer, compression);
+}
+
+/**
+ * @brief See overload for double buffers.
+ */
+void Adios2Manager::WriteDatasetToDataspace(
+    std::string const &dataspace_name, std::string const &dataset_name,
+    unsigned long long int const *buffer, OutputCompression const &compression,
+    hid_t const) {
+  // ADIOS2 uses the fixed-width integer types
+  static_assert(sizeof(unsigned long long int) == sizeof(std::uint64_t));
+  Put(dataspace_name, dataset_name,
+      reinterpret_cast<std::uint64_t const *>(buffer), compression);
+}
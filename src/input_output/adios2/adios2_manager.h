@@ -0,0 +1,121 @@
+//===------------------------ adios2_manager.h ----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef ADIOS2_MANAGER_H
+#define ADIOS2_MANAGER_H
+
+#include <hdf5.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef ALPACA_WITH_ADIOS2
+#include <adios2.h>
+#endif
+
+#include "input_output/output_writer/output_definitions.h"
+
+/**
+ * @brief The Adios2Manager writes the field outputs as steps of ADIOS2 streams,
+ * i.e., BP5 files or SST staging streams. Its interface mirrors the parts of
+ * the Hdf5Manager used to write outputs (groups, reserved dataspaces and
+ * datasets written into them), such that the same writing routines serve both
+ * backends. Groups become prefixes of the variable names.
+ * @note Requires a build with ADIOS2 (cmake option ADIOS2), otherwise the
+ * construction throws.
+ */
+class Adios2Manager {
+
+  Adios2Settings const settings_;
+#ifdef ALPACA_WITH_ADIOS2
+  adios2::ADIOS adios_;
+  /**
+   * @brief An open stream together with the io holding its variables.
+   */
+  struct Stream {
+    adios2::IO io_;
+    adios2::Engine engine_;
+  };
+  // open streams (key: stream name)
+  std::unordered_map<std::string, Stream> streams_;
+#endif
+  // stream of the current step (empty if no step is open)
+  std::string active_stream_;
+  // prefix of the variables of the active group
+  std::string active_group_;
+
+  /**
+   * @brief Global shape and local selection of a reserved dataspace.
+   */
+  struct Dataspace {
+    std::vector<std::size_t> shape_;
+    std::vector<std::size_t> start_;
+    std::vector<std::size_t> count_;
+  };
+  std::unordered_map<std::string, Dataspace> dataspaces_;
+
+  template <typename T>
+  void Put(std::string const &dataspace_name, std::string const &dataset_name,
+           T const *buffer, OutputCompression const &compression);
+
+public:
+  Adios2Manager() = delete;
+  explicit Adios2Manager(Adios2Settings const settings);
+  ~Adios2Manager();
+  Adios2Manager(Adios2Manager const &) = delete;
+  Adios2Manager &operator=(Adios2Manager const &) = delete;
+  Adios2Manager(Adios2Manager &&) = delete;
+  Adios2Manager &operator=(Adios2Manager &&) = delete;
+
+  static bool IsAvailable();
+
+  // Functions to open and close steps and streams (collective calls)
+  void BeginStep(std::string const &stream_name, double const output_time);
+  void EndStep();
+  void CloseStream(std::string const &stream_name);
+
+  // Functions mirroring the hdf5 manager
+  void OpenGroup(std::string const &group_name);
+  void CloseGroup(std::string const &group_name = "");
+  void ReserveDataspace(std::string const &dataspace_name,
+                        std::vector<hsize_t> const &dataspace_total_dimensions,
+                        std::vector<hsize_t> const &dataset_local_dimensions,
+                        hsize_t const local_elements_start_index,
+                        hid_t const datatype_id);
+  void CloseDataset(std::string const &dataspace_name = "");
+  void WriteDatasetToDataspace(
+      std::string const &dataspace_name, std::string const &dataset_name,
+      double const *buffer,
+      OutputCompression const &compression = OutputCompression(),
+      hid_t const datatype_id = -1);
+  void WriteDatasetToDataspace(
+      std::string const &dataspace_name, std::string const &dataset_name,
+      float const *buffer,
+      OutputCompression const &compression = OutputCompression(),
+      hid_t const datatype_id = -1);
+  void WriteDatasetToDataspace(
+      std::string const &dataspace_name, std::string const &dataset_name,
+      unsigned long long int const *buffer,
+      OutputCompression const &compression = OutputCompression(),
+      hid_t const datatype_id = -1);
+};
+
+#endif // ADIOS2_MANAGER_H
@@ -22,14 +22,17 @@
 #ifndef HDF5_DEFINITIONS_H
 #define HDF5_DEFINITIONS_H
 
+#include <cstddef>
 #include <hdf5.h>
 #include <string>
 #include <vector>
 
 /**
- * @brief Enum class for the different access options of the hdf5 file.
+ * @brief Enum class for the different access options of the hdf5 file. Write
+ * creates a new file (an existing one is truncated), Append writes new groups
+ * into an existing file.
  */
-enum class Hdf5Access { Read, Write };
+enum class Hdf5Access { Read, Write, Append };
 
 /**
  * @brief Struct that provides all information required for accessing
@@ -67,6 +70,10 @@ struct Hdf5Dataset {
   hid_t dataset_id_ = -1;
   hid_t local_memory_space_ = -1;
   hid_t local_hyperslab_ = -1;
+  // Blocks staged for a collective write, their number and size in bytes
+  std::vector<char> staged_data_;
+  hsize_t number_of_staged_blocks_ = 0;
+  std::size_t block_size_in_bytes_ = 0;
 
   void Close() {
     if (properties_create_ != -1)
@@ -21,31 +21,86 @@
 //===----------------------------------------------------------------------===//
 #include "input_output/hdf5/hdf5_manager.h"
 
+#include <algorithm>
+#include <cstring>
+#include <mpi.h>
 #include <stdexcept>
+#include <utility>
+
+#include "communication/mpi_utilities.h"
+#include "simulation_context.h"
+
+namespace {
+
+/**
+ * Identifier of the ZFP filter plugin registered with the hdf5 group.
+ */
+constexpr H5Z_filter_t zfp_filter_id_ = 32013;
+/**
+ * Fixed-accuracy mode of the ZFP filter plugin.
+ */
+constexpr unsigned int zfp_accuracy_mode_ = 3;
+
+/**
+ * @brief Indicates whether files can be flushed on a writer thread, i.e.
+ * whether asynchronous writes are enabled, the hdf5 library is thread-safe and
+ * MPI provides full thread support.
+ * @return True if files are written asynchronously.
+ */
+bool AsynchronousWritesSupported() {
+  if constexpr (Hdf5OutputSettings::AsynchronousWrites) {
+    int thread_support = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&thread_support);
+    hbool_t is_threadsafe = false;
+    H5is_library_threadsafe(&is_threadsafe);
+    return thread_support == MPI_THREAD_MULTIPLE && is_threadsafe;
+  } else {
+    return false;
+  }
+}
+
+} // namespace
 
 /**
  * @brief Default constructor (private).
  * @note can only be used to create a singleton hdf5 writer.
  */
-Hdf5Manager::Hdf5Manager() { /** Empty constructor */
+Hdf5Manager::Hdf5Manager()
+    : asynchronous_writes_(AsynchronousWritesSupported()) {
+  /** Empty besides initializer list */
 }
 
 /**
- * @brief Destructor checks whether a file is still open and closes it.
+ * @brief Destructor waits for a pending flush and checks whether a file is
+ * still open and closes it.
  */
 Hdf5Manager::~Hdf5Manager() {
+  WaitForPendingWrites();
   if (file_.is_open_) {
     CloseFile();
   }
 }
 
+/**
+ * @brief Waits until the previously closed file is completely written. Must be
+ * called by all ranks before MPI is finalized.
+ */
+void Hdf5Manager::WaitForPendingWrites() {
+  if (pending_write_.joinable()) {
+    pending_write_.join();
+  }
+}
+
 /**
  * @brief Opens a file to write/read hdf5 content into/from.
  * @param filename Name of the file.
  * @param file_access The mode used to open the hdf5 file.
+ * @param communicator The ranks sharing the file, all of them have to open it
+ * (MPI_COMM_NULL: all ranks of the simulation).
  */
 void Hdf5Manager::OpenFile(std::string const &filename,
-                           Hdf5Access const file_access) {
+                           Hdf5Access const file_access,
+                           MPI_Comm const communicator) {
 #ifndef PERFORMANCE
   // Check whether a file is already opened
   if (file_.is_open_) {
@@ -53,17 +108,30 @@ void Hdf5Manager::OpenFile(std::string const &filename,
         "Error Opening HDF5 file. Cannot open two files at the same time!");
   }
 #endif
+  // Collective hdf5 calls must not overlap with the flush of the previous file
+  WaitForPendingWrites();
   // Set the flag for subsequent calls
   file_.access_type_ = file_access;
 
   // instantiates the file_properties
   file_.properties_ = H5Pcreate(H5P_FILE_ACCESS);
-  H5Pset_fapl_mpio(file_.properties_, MPI_COMM_WORLD, MPI_INFO_NULL);
+  H5Pset_fapl_mpio(file_.properties_,
+                   communicator == MPI_COMM_NULL ? MpiUtilities::Communicator()
+                                                 : communicator,
+                   MPI_INFO_NULL);
   // Opens the file
-  file_.id_ = file_.access_type_ == Hdf5Access::Read
-                  ? H5Fopen(filename.c_str(), H5F_ACC_RDONLY, file_.properties_)
-                  : H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT,
-                              file_.properties_);
+  switch (file_.access_type_) {
+  case Hdf5Access::Read: {
+    file_.id_ = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, file_.properties_);
+  } break;
+  case Hdf5Access::Append: {
+    file_.id_ = H5Fopen(filename.c_str(), H5F_ACC_RDWR, file_.properties_);
+  } break;
+  default: /* Hdf5Access::Write */ {
+    file_.id_ = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT,
+                          file_.properties_);
+  }
+  }
   // Set flag that file is open
   file_.is_open_ = true;
 }
@@ -96,7 +164,13 @@ void Hdf5Manager::OpenGroup(std::string const &group_name) {
                   : H5Gcreate2(file_.id_, group_name.c_str(), H5P_DEFAULT,
                                H5P_DEFAULT, H5P_DEFAULT);
   group.properties_ = H5Pcreate(H5P_DATASET_XFER);
-  H5Pset_dxpl_mpio(group.properties_, H5FD_MPIO_INDEPENDENT);
+  // reads are done by each rank individually with a rank-dependent number of
+  // calls, hence only writes can be collective
+  H5Pset_dxpl_mpio(group.properties_,
+                   Hdf5OutputSettings::CollectiveWrites &&
+                           file_.access_type_ != Hdf5Access::Read
+                       ? H5FD_MPIO_COLLECTIVE
+                       : H5FD_MPIO_INDEPENDENT);
   // Add the new group to the map
   groups_[group_name] = group;
   // Set the active group to the current opened group
@@ -149,6 +223,73 @@ hsize_t Hdf5Manager::GetDatasetExtent(std::string const &dataset_name) const {
   return dataset_extent;
 }
 
+/**
+ * @brief Indicates whether the active group carries an attribute.
+ * @param attribute_name Name of the attribute.
+ * @return True if the attribute exists.
+ */
+bool Hdf5Manager::HasAttribute(std::string const &attribute_name) const {
+#ifndef PERFORMANCE
+  if (active_group_.empty()) {
+    throw std::runtime_error(
+        "Before checking an attribute of a group you must activate one!");
+  }
+#endif
+  return H5Aexists(groups_.at(active_group_).id_, attribute_name.c_str()) > 0;
+}
+
+/**
+ * @brief Writes a string attribute to the currently opened group.
+ * @param attribute_name Name of the attribute that is written.
+ * @param value The string that is written.
+ */
+void Hdf5Manager::WriteAttributeString(std::string const &attribute_name,
+                                       std::string const &value) const {
+#ifndef PERFORMANCE
+  if (active_group_.empty()) {
+    throw std::runtime_error(
+        "Before write a string to a group you must activate one!");
+  }
+#endif
+  // fixed-length string type, an empty string still requires one character
+  hid_t const string_type = H5Tcopy(H5T_C_S1);
+  H5Tset_size(string_type, std::max(value.size(), std::size_t(1)));
+  H5Tset_strpad(string_type, H5T_STR_NULLPAD);
+  hid_t const data_type = H5Screate(H5S_SCALAR);
+  hid_t const data =
+      H5Acreate2(groups_.at(active_group_).id_, attribute_name.c_str(),
+                 string_type, data_type, H5P_DEFAULT, H5P_DEFAULT);
+  std::string const padded_value = value.empty() ? std::string(1, '\0') : value;
+  H5Awrite(data, string_type, padded_value.data());
+  H5Aclose(data);
+  H5Sclose(data_type);
+  H5Tclose(string_type);
+}
+
+/**
+ * @brief Reads a string attribute from the currently opened group.
+ * @param attribute_name Name of the attribute that is read.
+ * @return The read string.
+ */
+std::string
+Hdf5Manager::ReadAttributeString(std::string const &attribute_name) const {
+#ifndef PERFORMANCE
+  if (active_group_.empty()) {
+    throw std::runtime_error(
+        "Before read a string from a group you must activate one!");
+  }
+#endif
+  hid_t const attribute = H5Aopen(groups_.at(active_group_).id_,
+                                  attribute_name.c_str(), H5P_DEFAULT);
+  hid_t const string_type = H5Aget_type(attribute);
+  std::string value(H5Tget_size(string_type), '\0');
+  H5Aread(attribute, string_type, value.data());
+  H5Tclose(string_type);
+  H5Aclose(attribute);
+  // remove the null padding
+  return value.substr(0, value.find('\0'));
+}
+
 /**
  * @brief Opens a dataset for writing data into it. It is part of a two-phase
  * writing procedure:
@@ -216,9 +357,12 @@ void Hdf5Manager::OpenDatasetForWriting(
   /** Define the chunk that is written at once and the proeprties used to create
    * the dataset */
   // Define the chunk that is created at once (The same as local dimensions, but
-  // only one node/block/buffer is written once )
+  // with a configurable number of nodes/blocks/buffers, which must not exceed
+  // the total number)
   dataset.chunk_ = dataset.total_dimensions_;
-  dataset.chunk_.front() = 1;
+  dataset.chunk_.front() =
+      std::max(hsize_t(1), std::min(hsize_t(Hdf5OutputSettings::BlocksPerChunk),
+                                    dataset.total_dimensions_.front()));
   dataset.properties_create_ = H5Pcreate(H5P_DATASET_CREATE);
   H5Pset_chunk(dataset.properties_create_, dataset.chunk_.size(),
                dataset.chunk_.data());
@@ -244,8 +388,54 @@ void Hdf5Manager::OpenDatasetForWriting(
       dataset.local_dimensions_.size(), dataset.local_dimensions_.data(), NULL);
   dataset.local_hyperslab_ = H5Dget_space(dataset.dataset_id_);
 
+  // Size of a single node/block/buffer for staging it in collective writes
+  dataset.block_size_in_bytes_ = H5Tget_size(dataset.datatype_);
+  for (hsize_t const dimension : dataset.local_dimensions_) {
+    dataset.block_size_in_bytes_ *= dimension;
+  }
+
   /** Add the new dataset to the map */
   datasets_[dataset_name] = dataset;
+  datasets_opened_for_writing_.push_back(dataset_name);
+}
+
+/**
+ * @brief Writes all blocks staged for a dataset opened for writing in a single
+ * collective call. All ranks must call this function for the same datasets in
+ * the same order, also ranks without any staged blocks.
+ * @param dataset The dataset that is written.
+ * @param transfer_properties The transfer properties of the group of the
+ * dataset.
+ */
+void Hdf5Manager::WriteStagedBlocks(Hdf5Dataset &dataset,
+                                    hid_t const transfer_properties) {
+
+  // The staged blocks are written contiguously starting at the first local
+  // block
+  std::vector<hsize_t> staged_dimensions = dataset.local_dimensions_;
+  staged_dimensions.front() =
+      std::max(hsize_t(1), dataset.number_of_staged_blocks_) *
+      dataset.local_dimensions_.front();
+  hid_t const memory_space = H5Screate_simple(staged_dimensions.size(),
+                                              staged_dimensions.data(), NULL);
+  if (dataset.number_of_staged_blocks_ > 0) {
+    H5Sselect_hyperslab(dataset.local_hyperslab_, H5S_SELECT_SET,
+                        dataset.start_indices_.data(), NULL,
+                        dataset.count_.data(), staged_dimensions.data());
+  } else {
+    // Ranks without blocks take part in the collective call without data
+    H5Sselect_none(memory_space);
+    H5Sselect_none(dataset.local_hyperslab_);
+  }
+  char const dummy = 0;
+  H5Dwrite(dataset.dataset_id_, dataset.datatype_, memory_space,
+           dataset.local_hyperslab_, transfer_properties,
+           dataset.staged_data_.empty() ? &dummy : dataset.staged_data_.data());
+  H5Sclose(memory_space);
+
+  dataset.staged_data_.clear();
+  dataset.staged_data_.shrink_to_fit();
+  dataset.number_of_staged_blocks_ = 0;
 }
 
 /**
@@ -392,12 +582,50 @@ void Hdf5Manager::ReserveDataspace(
 }
 
 /**
- * @brief Close all or single dataset/dataspace that was allocated before.
+ * @brief Writes the staged blocks of all deferred datasets in the order of
+ * closing and closes the datasets, groups and the file afterwards. Runs on the
+ * writer thread for asynchronous writes.
+ * @param datasets The deferred datasets.
+ * @param groups The deferred groups.
+ * @param file The file the datasets are written to.
+ */
+void Hdf5Manager::FlushFile(std::vector<DeferredDataset> datasets,
+                            std::vector<Hdf5Group> groups, Hdf5File file) {
+  for (DeferredDataset &deferred : datasets) {
+    WriteStagedBlocks(deferred.dataset_, deferred.transfer_properties_);
+    deferred.dataset_.Close();
+  }
+  for (Hdf5Group &group : groups) {
+    group.Close();
+  }
+  file.Close();
+}
+
+/**
+ * @brief Close all or single dataset/dataspace that was allocated before. For
+ * asynchronous writes, datasets opened for writing are only closed when the
+ * file is flushed.
  * @param name Name of the dataset/dataspace that should be closed.
  */
 void Hdf5Manager::CloseDataset(std::string const &name) {
   // If the input string is empty, close all datasets
   if (name.empty()) {
+    // Staged blocks are written in the same order on all ranks
+    if constexpr (Hdf5OutputSettings::CollectiveWrites) {
+      for (std::string const &dataset_name : datasets_opened_for_writing_) {
+        Hdf5Dataset &dataset = datasets_[dataset_name];
+        hid_t const transfer_properties =
+            groups_[dataset.group_name_].properties_;
+        if (asynchronous_writes_) {
+          deferred_datasets_.push_back(
+              {std::move(dataset), transfer_properties});
+          datasets_.erase(dataset_name);
+        } else {
+          WriteStagedBlocks(dataset, transfer_properties);
+        }
+      }
+    }
+    datasets_opened_for_writing_.clear();
     // No range-based loop possible here, since we are deleting elements during
     // the loop
     for (auto it = datasets_.begin(); it != datasets_.end();) {
@@ -412,13 +640,32 @@ void Hdf5Manager::CloseDataset(std::string const &name) {
           "Before closing a dataset/dataspace it must be opened/reserved!");
     }
 #endif
+    auto const opened_for_writing =
+        std::find(datasets_opened_for_writing_.begin(),
+                  datasets_opened_for_writing_.end(), name);
+    if (opened_for_writing != datasets_opened_for_writing_.end()) {
+      datasets_opened_for_writing_.erase(opened_for_writing);
+      if constexpr (Hdf5OutputSettings::CollectiveWrites) {
+        Hdf5Dataset &dataset = datasets_[name];
+        hid_t const transfer_properties =
+            groups_[dataset.group_name_].properties_;
+        if (asynchronous_writes_) {
+          deferred_datasets_.push_back(
+              {std::move(dataset), transfer_properties});
+          datasets_.erase(name);
+          return;
+        }
+        WriteStagedBlocks(dataset, transfer_properties);
+      }
+    }
     datasets_[name].Close();
     datasets_.erase(name);
   }
 }
 
 /**
- * @brief Close all or single group that have been opened before.
+ * @brief Close all or single group that have been opened before. For
+ * asynchronous writes, groups are only closed when the file is flushed.
  * @param name Name of the group that should be closed.
  */
 void Hdf5Manager::CloseGroup(std::string const &group_name) {
@@ -432,7 +679,11 @@ void Hdf5Manager::CloseGroup(std::string const &group_name) {
     // the loop
     for (auto it = groups_.begin(); it != groups_.end();) {
       // erase group from map (calls destructor that closes everything)
-      (*it).second.Close();
+      if (asynchronous_writes_ && file_.access_type_ != Hdf5Access::Read) {
+        deferred_groups_.push_back((*it).second);
+      } else {
+        (*it).second.Close();
+      }
       it = groups_.erase(it);
     }
   } else {
@@ -443,21 +694,38 @@ void Hdf5Manager::CloseGroup(std::string const &group_name) {
     }
 #endif
     // Check if any dataset/dataspace has been opened in that group and close
-    // them
+    // them (staged blocks are written first in the same order on all ranks)
+    std::vector<std::string> datasets_of_group;
+    for (std::string const &dataset_name : datasets_opened_for_writing_) {
+      if (datasets_[dataset_name].group_name_ == group_name) {
+        datasets_of_group.push_back(dataset_name);
+      }
+    }
+    for (std::string const &dataset_name : datasets_of_group) {
+      CloseDataset(dataset_name);
+    }
     for (auto it = datasets_.begin(); it != datasets_.end();) {
       if ((*it).second.group_name_ == group_name) {
         (*it).second.Close();
         it = datasets_.erase(it);
+      } else {
+        ++it;
       }
     }
     // Then close the desired group and erase it from the map
-    groups_[group_name].Close();
+    if (asynchronous_writes_ && file_.access_type_ != Hdf5Access::Read) {
+      deferred_groups_.push_back(groups_[group_name]);
+    } else {
+      groups_[group_name].Close();
+    }
     groups_.erase(group_name);
   }
 }
 
 /**
- * @brief Close a file which has been opened before.
+ * @brief Close a file which has been opened before. For asynchronous writes,
+ * the staged blocks are written on the writer thread and the function returns
+ * immediately.
  */
 void Hdf5Manager::CloseFile() {
 #ifndef PERFORMANCE
@@ -469,17 +737,76 @@ void Hdf5Manager::CloseFile() {
   if (!groups_.empty()) {
     CloseGroup();
   }
-  // Close the file
-  file_.Close();
+  if (asynchronous_writes_ && file_.access_type_ != Hdf5Access::Read) {
+    // The writer thread takes over the file, the staged data is its snapshot
+    pending_write_ =
+        std::thread(&Hdf5Manager::FlushFile, std::move(deferred_datasets_),
+                    std::move(deferred_groups_), file_);
+    deferred_datasets_.clear();
+    deferred_groups_.clear();
+    file_.is_open_ = false;
+  } else {
+    // Close the file
+    file_.Close();
+  }
+}
+
+/**
+ * @brief Indicates whether the filter of a compression type is available in the
+ * hdf5 library, e.g., whether the filter plugin can be loaded.
+ * @param type The compression type.
+ * @return True if the datasets can be compressed.
+ */
+bool Hdf5Manager::IsCompressionAvailable(OutputCompressionType const type) {
+  switch (type) {
+  case OutputCompressionType::Deflate: {
+    return H5Zfilter_avail(H5Z_FILTER_SHUFFLE) > 0 &&
+           H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0;
+  }
+  case OutputCompressionType::Zfp: {
+    return H5Zfilter_avail(zfp_filter_id_) > 0;
+  }
+  default: {
+    return true;
+  }
+  }
+}
+
+/**
+ * @brief Creates the properties of a compressed dataset written to a reserved
+ * dataspace. Filters require chunked datasets, a chunk holds a fixed number of
+ * cells.
+ * @param dataset The reserved dataspace.
+ * @param compression Filter applied to the dataset.
+ * @return Identifier of the dataset creation properties, to be closed by the
+ * caller.
+ */
+hid_t Hdf5Manager::CreateCompressedProperties(
+    Hdf5Dataset const &dataset, OutputCompression const &compression) {
+  std::vector<hsize_t> chunk = dataset.total_dimensions_;
+  chunk.front() = std::min(hsize_t(Hdf5OutputSettings::CellsPerCompressedChunk),
+                           chunk.front());
+  hid_t const properties_create = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_chunk(properties_create, chunk.size(), chunk.data());
+  if (compression.type_ == OutputCompressionType::Deflate) {
+    H5Pset_shuffle(properties_create);
+    H5Pset_deflate(properties_create, compression.deflate_level_);
+  } else if (compression.type_ == OutputCompressionType::Zfp) {
+    // The error bound is passed as double in the last two parameters
+    unsigned int parameters[4] = {zfp_accuracy_mode_, 0, 0, 0};
+    std::memcpy(&parameters[2], &compression.error_bound_, sizeof(double));
+    H5Pset_filter(properties_create, zfp_filter_id_, H5Z_FLAG_MANDATORY, 4,
+                  parameters);
+  }
+  return properties_create;
 }
 
 /**
- * @brief This function is used to get the Hdf5Manager. If no Hdf5Manager exists
- * yet it is created, otherwise the existing writer is passed back. "Singleton
- * Constructor"
+ * @brief This function is used to get the Hdf5Manager of the current
+ * simulation context (see SimulationContext::Current()). If the context has no
+ * Hdf5Manager yet it is created, otherwise the existing writer is passed back.
  * @return The hdf5_writer instance.
  */
 Hdf5Manager &Hdf5Manager::Instance() {
-  static Hdf5Manager instance_;
-  return instance_;
+  return SimulationContext::Current().Hdf5();
 }
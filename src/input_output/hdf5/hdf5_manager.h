@@ -23,16 +23,24 @@
 #define HDF5_MANAGER_H
 
 #include <hdf5.h>
+#include <mpi.h>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "input_output/hdf5/hdf5_definitions.h"
+#include "input_output/output_writer/output_definitions.h"
+#include "user_specifications/output_constants.h"
+
+static_assert(!Hdf5OutputSettings::AsynchronousWrites ||
+                  Hdf5OutputSettings::CollectiveWrites,
+              "Asynchronous hdf5 writes require collective writes!");
 
 /**
  * @brief A light-weight hdf5 file writer class to write output to an hdf5 file.
- * @note Singleton.
+ * @note One instance per simulation, see SimulationContext.
  */
 class Hdf5Manager {
 
@@ -43,12 +51,40 @@ class Hdf5Manager {
   std::unordered_map<std::string, Hdf5Group> groups_;
   // Member variables for specification of a single dataset
   std::unordered_map<std::string, Hdf5Dataset> datasets_;
+  // Names of the datasets opened for writing in the order of opening, which is
+  // identical on all ranks as required for collective writes
+  std::vector<std::string> datasets_opened_for_writing_;
+
+  /**
+   * @brief Dataset whose staged blocks are written when the file is flushed,
+   * together with the transfer properties of its group.
+   */
+  struct DeferredDataset {
+    Hdf5Dataset dataset_;
+    hid_t transfer_properties_;
+  };
+  // Indicates whether files are flushed on the writer thread
+  bool const asynchronous_writes_;
+  // Datasets and groups of the open file whose closing is deferred to the
+  // flush of the file
+  std::vector<DeferredDataset> deferred_datasets_;
+  std::vector<Hdf5Group> deferred_groups_;
+  // Writer thread flushing the previously closed file
+  std::thread pending_write_;
 
-  // Constructor called from the singleton public constructor
+  // Constructor called from the simulation context
   explicit Hdf5Manager();
+  friend class SimulationContext;
+
+  static void WriteStagedBlocks(Hdf5Dataset &dataset,
+                                hid_t const transfer_properties);
+  static void FlushFile(std::vector<DeferredDataset> datasets,
+                        std::vector<Hdf5Group> groups, Hdf5File file);
+  static hid_t CreateCompressedProperties(Hdf5Dataset const &dataset,
+                                          OutputCompression const &compression);
 
 public:
-  // Singleton constructor
+  // Instance of the current simulation context
   static Hdf5Manager &Instance();
 
   ~Hdf5Manager();
@@ -59,7 +95,8 @@ public:
 
   // Functions to open, close files, groups, datasets and dataspaces
   void OpenFile(std::string const &filename,
-                Hdf5Access const access_type = Hdf5Access::Write);
+                Hdf5Access const access_type = Hdf5Access::Write,
+                MPI_Comm const communicator = MPI_COMM_NULL);
   void CloseFile();
   void OpenGroup(std::string const &group_name);
   void ActivateGroup(std::string const &name);
@@ -80,8 +117,15 @@ public:
                         hsize_t const local_elements_start_index,
                         hid_t const datatype_id);
   void CloseDataset(std::string const &dataset_name = "");
+  void WaitForPendingWrites();
+  static bool IsCompressionAvailable(OutputCompressionType const type);
   // Gives the extent of a dataset
   hsize_t GetDatasetExtent(std::string const &dataset_name) const;
+  // Functions for string attributes of the active group
+  bool HasAttribute(std::string const &attribute_name) const;
+  void WriteAttributeString(std::string const &attribute_name,
+                            std::string const &value) const;
+  std::string ReadAttributeString(std::string const &attribute_name) const;
 
   /**
    * @brief Writes a single scalar attribute to the currently opened group.
@@ -121,7 +165,10 @@ public:
    * written)
    *        2. WriteDataset (selects the hyperslab position and writes data into
    * the Therefore, before calling this function, the dataset must always be
-   * opened.
+   * opened. With collective writes, the data is only staged and written
+   * together with all other blocks of the rank when the dataset is closed.
+   * Each call writes the local dimensions given on opening, i.e. several
+   * consecutive entries at once if the first local dimension exceeds one.
    * @param dataset_name Name of the dataset that is written (must conincide
    * with the name used to open).
    * @param buffer Pointer to the CONTIGUOUS buffer that is written.
@@ -138,17 +185,26 @@ public:
 #endif
     // Get the correct dataset info
     Hdf5Dataset &dataset = datasets_[dataset_name];
-    Hdf5Group const &group = groups_[dataset.group_name_];
-    // Select the correct hyperslab
-    H5Sselect_hyperslab(
-        dataset.local_hyperslab_, H5S_SELECT_SET, dataset.start_indices_.data(),
-        NULL, dataset.count_.data(), dataset.local_dimensions_.data());
-    // Write the local dataset to the given group
-    H5Dwrite(dataset.dataset_id_, dataset.datatype_,
-             dataset.local_memory_space_, dataset.local_hyperslab_,
-             group.properties_, buffer);
-    // Increment the dataset start index for the next writing process
-    dataset.start_indices_.front()++;
+    if constexpr (Hdf5OutputSettings::CollectiveWrites) {
+      // Stage the block, all blocks are written at once on closing the dataset
+      char const *const data = reinterpret_cast<char const *>(buffer);
+      dataset.staged_data_.insert(dataset.staged_data_.end(), data,
+                                  data + dataset.block_size_in_bytes_);
+      dataset.number_of_staged_blocks_++;
+    } else {
+      Hdf5Group const &group = groups_[dataset.group_name_];
+      // Select the correct hyperslab
+      H5Sselect_hyperslab(dataset.local_hyperslab_, H5S_SELECT_SET,
+                          dataset.start_indices_.data(), NULL,
+                          dataset.count_.data(),
+                          dataset.local_dimensions_.data());
+      // Write the local dataset to the given group
+      H5Dwrite(dataset.dataset_id_, dataset.datatype_,
+               dataset.local_memory_space_, dataset.local_hyperslab_,
+               group.properties_, buffer);
+      // Increment the dataset start index for the next writing process
+      dataset.start_indices_.front() += dataset.local_dimensions_.front();
+    }
   }
 
   /**
@@ -164,13 +220,20 @@ public:
    * coincide with name that is used to reserve dataspace).
    * @param dataset_name Name of the dataset that is written.
    * @param buffer Pointer to the CONTIGUOUS buffer that is written.
+   * @param compression Filter applied to the dataset. Compressed datasets are
+   * chunked and require collective writes.
+   * @param datatype_id Hdf5 identifier of the datatype of the buffer and the
+   * dataset, if it differs from the one of the dataspace (-1: datatype of the
+   * dataspace).
    *
    * @tparam BufferType Buffer type that is written.
    */
   template <typename BufferType>
-  void WriteDatasetToDataspace(std::string const &dataspace_name,
-                               std::string const &dataset_name,
-                               BufferType const *buffer) const {
+  void WriteDatasetToDataspace(
+      std::string const &dataspace_name, std::string const &dataset_name,
+      BufferType const *buffer,
+      OutputCompression const &compression = OutputCompression(),
+      hid_t const datatype_id = -1) const {
 #ifndef PERFORMANCE
     if (datasets_.find(dataspace_name) == datasets_.end()) {
       throw std::runtime_error("Before writing a datset to dataspace, a "
@@ -180,12 +243,20 @@ public:
     // Get the correct group information
     Hdf5Dataset const &dataset = datasets_.at(dataspace_name);
     Hdf5Group const &group = groups_.at(dataset.group_name_);
+    hid_t const datatype = datatype_id != -1 ? datatype_id : dataset.datatype_;
 
     // Creates a new dataset and links it into the file/group
-    hid_t const dataset_id =
-        H5Dcreate2(group.id_, dataset_name.c_str(), dataset.datatype_,
-                   dataset.dataspace_id_, H5P_DEFAULT,
-                   dataset.properties_create_, H5P_DEFAULT);
+    hid_t const properties_create =
+        compression.type_ == OutputCompressionType::Off ||
+                dataset.total_dimensions_.front() == 0
+            ? dataset.properties_create_
+            : CreateCompressedProperties(dataset, compression);
+    hid_t const dataset_id = H5Dcreate2(
+        group.id_, dataset_name.c_str(), datatype, dataset.dataspace_id_,
+        H5P_DEFAULT, properties_create, H5P_DEFAULT);
+    if (properties_create != dataset.properties_create_) {
+      H5Pclose(properties_create);
+    }
     // Create the local memory and hyperslab space required for writing the data
     // (NULL marks that dataset cannot grow until it is closed)
     hid_t const local_memory_space =
@@ -196,7 +267,7 @@ public:
                         dataset.start_indices_.data(), NULL,
                         dataset.local_dimensions_.data(), NULL);
     // Write the local dataset to the given group
-    H5Dwrite(dataset_id, dataset.datatype_, local_memory_space, local_hyperslab,
+    H5Dwrite(dataset_id, datatype, local_memory_space, local_hyperslab,
              group.properties_, buffer);
     // close all local reserved data
     H5Sclose(local_hyperslab);
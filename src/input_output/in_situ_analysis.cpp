@@ -0,0 +1,612 @@
+//===------------------------ in_situ_analysis.cpp ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/in_situ_analysis.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mpi.h>
+#include <stdexcept>
+
+#include "communication/mpi_utilities.h"
+#include "input_output/output_writer/mesh_generator/mesh_generator_utilities.h"
+#include "topology/id_information.h"
+
+namespace {
+
+/**
+ * @brief Identifiers how the entries of the local results are combined across
+ * the ranks.
+ */
+constexpr double sum_entry_ = 0.0;
+constexpr double maximum_entry_ = 1.0;
+
+/**
+ * @brief Combines the local results of two ranks. Each entry consists of its
+ * combination identifier and its value. Minima are stored as negated maxima.
+ * @param input The entries of the first rank.
+ * @param inout The entries of the second rank, which hold the combined results
+ * afterwards.
+ * @param length Number of entries.
+ */
+void CombineEntries(void *input, void *inout, int *length, MPI_Datatype *) {
+  double const *input_entries = static_cast<double const *>(input);
+  double *combined_entries = static_cast<double *>(inout);
+  for (int entry = 0; entry < *length; ++entry) {
+    double const value = input_entries[2 * entry + 1];
+    double &combined_value = combined_entries[2 * entry + 1];
+    if (combined_entries[2 * entry] == sum_entry_) {
+      combined_value += value;
+    } else {
+      combined_value = std::max(combined_value, value);
+    }
+  }
+}
+
+/**
+ * @brief Gives the position of the quantity with the given name.
+ * @param quantities The available quantities.
+ * @param name Name of the quantity.
+ * @param component Component of the quantity that is used.
+ * @return Index of the quantity.
+ */
+std::size_t QuantityIndex(
+    std::vector<std::unique_ptr<OutputQuantity const>> const &quantities,
+    std::string const &name, unsigned int const component) {
+  auto const quantity = std::find_if(
+      quantities.begin(), quantities.end(),
+      [&name](std::unique_ptr<OutputQuantity const> const &candidate) {
+        return candidate->GetName() == name;
+      });
+  if (quantity == quantities.end()) {
+    throw std::invalid_argument("Quantity '" + name +
+                                "' of the in-situ analysis is not available!");
+  }
+  std::array<unsigned int, 2> const dimensions = (*quantity)->GetDimensions();
+  if (component >= dimensions[0] * dimensions[1]) {
+    throw std::invalid_argument("Component " + std::to_string(component) +
+                                " of the in-situ quantity '" + name +
+                                "' does not exist!");
+  }
+  return std::distance(quantities.begin(), quantity);
+}
+
+/**
+ * @brief Gives the position of the quantity of each reduction or probe.
+ * @param quantities The available quantities.
+ * @param entries The reductions or probes.
+ * @return Index of the quantity of each entry.
+ */
+template <typename T>
+std::vector<std::size_t> QuantityIndices(
+    std::vector<std::unique_ptr<OutputQuantity const>> const &quantities,
+    std::vector<T> const &entries) {
+  std::vector<std::size_t> indices;
+  indices.reserve(entries.size());
+  for (T const &entry : entries) {
+    indices.push_back(
+        QuantityIndex(quantities, entry.quantity_name_, entry.component_));
+  }
+  return indices;
+}
+
+/**
+ * @brief Gives the name of a component of a quantity.
+ * @param quantity The quantity.
+ * @param component The component.
+ * @return Name of the quantity which is extended by the component for
+ * multi-component quantities.
+ */
+std::string ComponentName(OutputQuantity const &quantity,
+                          unsigned int const component) {
+  std::array<unsigned int, 2> const dimensions = quantity.GetDimensions();
+  return dimensions[0] * dimensions[1] > 1
+             ? quantity.GetName() + "_" + std::to_string(component)
+             : quantity.GetName();
+}
+
+/**
+ * @brief Gives the uniform grid of each slice.
+ * @param topology Instance to provide the domain and the maximum level.
+ * @param dimensionalized_node_size_on_level_zero Already dimensionalized size
+ * of a node on level zero.
+ * @param quantities The available quantities.
+ * @param slices The slices.
+ * @param quantity_indices Index of the quantity of each slice.
+ * @return The grid of each slice.
+ */
+std::vector<InSituSliceGrid> CreateSliceGrids(
+    TopologyManager const &topology,
+    double const dimensionalized_node_size_on_level_zero,
+    std::vector<std::unique_ptr<OutputQuantity const>> const &quantities,
+    std::vector<InSituSlice> const &slices,
+    std::vector<std::size_t> const &quantity_indices) {
+  std::array<unsigned int, 3> const number_of_nodes =
+      topology.GetNumberOfNodesOnLevelZero();
+  std::array<unsigned int, 3> const number_of_cells = {CC::ICX(), CC::ICY(),
+                                                       CC::ICZ()};
+  std::vector<InSituSliceGrid> grids;
+  grids.reserve(slices.size());
+  for (std::size_t index = 0; index < slices.size(); ++index) {
+    InSituSlice const &slice = slices[index];
+    if (slice.level_ > topology.GetMaximumLevel()) {
+      throw std::invalid_argument(
+          "Level of an in-situ slice must not exceed the maximum level!");
+    }
+    InSituSliceGrid grid;
+    grid.name_ =
+        ComponentName(*quantities[quantity_indices[index]], slice.component_);
+    grid.cell_size_ = MeshGeneratorUtilities::CellSizeForBlockSize(
+        dimensionalized_node_size_on_level_zero / double(1u << slice.level_));
+    grid.origin_ = slice.point_;
+    for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+      if (slice.spanned_axes_[d]) {
+        grid.axes_.push_back(d);
+        grid.cells_.push_back(number_of_nodes[d] * (1u << slice.level_) *
+                              number_of_cells[d]);
+        grid.origin_[d] = 0.0;
+      }
+    }
+    grids.push_back(grid);
+  }
+  return grids;
+}
+
+/**
+ * @brief The SliceCellMapping assigns a cell of a leaf along a spanned axis to
+ * a cell of the uniform grid of a slice.
+ */
+struct SliceCellMapping {
+  unsigned int leaf_cell_;
+  unsigned int grid_cell_;
+  double weight_;
+};
+
+/**
+ * @brief Maps the cells of a leaf along a spanned axis onto the cells of the
+ * uniform grid of a slice. Finer cells are averaged into the grid cell
+ * containing them, coarser cells are predicted piecewise constant onto all grid
+ * cells they contain.
+ * @param leaf_origin (Dimensional) coordinate of the leaf along the axis.
+ * @param leaf_level Level of the leaf.
+ * @param number_of_leaf_cells Number of internal cells of the leaf along the
+ * axis.
+ * @param grid Grid of the slice.
+ * @param grid_level Level of the grid.
+ * @param axis Index of the axis in the spanned axes of the grid.
+ * @return The mapping of each pair of overlapping leaf and grid cells.
+ */
+std::vector<SliceCellMapping>
+MapCellsOntoGrid(double const leaf_origin, unsigned int const leaf_level,
+                 unsigned int const number_of_leaf_cells,
+                 InSituSliceGrid const &grid, unsigned int const grid_level,
+                 std::size_t const axis) {
+  std::vector<SliceCellMapping> mapping;
+  double const leaf_origin_in_grid_cells = leaf_origin / grid.cell_size_;
+  unsigned int const last_grid_cell = grid.cells_[axis] - 1;
+  if (leaf_level >= grid_level) {
+    unsigned int const leaf_cells_per_grid_cell = 1u
+                                                  << (leaf_level - grid_level);
+    double const weight = 1.0 / double(leaf_cells_per_grid_cell);
+    mapping.reserve(number_of_leaf_cells);
+    for (unsigned int i = 0; i < number_of_leaf_cells; ++i) {
+      unsigned int const grid_cell = static_cast<unsigned int>(
+          std::floor(leaf_origin_in_grid_cells + (double(i) + 0.5) * weight));
+      mapping.push_back({i, std::min(grid_cell, last_grid_cell), weight});
+    }
+  } else {
+    unsigned int const grid_cells_per_leaf_cell = 1u
+                                                  << (grid_level - leaf_level);
+    unsigned int const first =
+        static_cast<unsigned int>(std::lround(leaf_origin_in_grid_cells));
+    mapping.reserve(number_of_leaf_cells * grid_cells_per_leaf_cell);
+    for (unsigned int i = 0; i < number_of_leaf_cells; ++i) {
+      for (unsigned int r = 0; r < grid_cells_per_leaf_cell; ++r) {
+        unsigned int const grid_cell = first + i * grid_cells_per_leaf_cell + r;
+        mapping.push_back({i, std::min(grid_cell, last_grid_cell), 1.0});
+      }
+    }
+  }
+  return mapping;
+}
+
+} // namespace
+
+/**
+ * @brief Constructor to create the in-situ analysis.
+ * @param topology Instance to provide the local leaves.
+ * @param tree Instance to provide the data of the local leaves.
+ * @param dimensionalized_node_size_on_level_zero Already dimensionalized size
+ * of a node on level zero.
+ * @param interval Number of macro time steps between two evaluations (zero
+ * deactivates the analysis).
+ * @param quantities The quantities the reductions and probes refer to.
+ * @param reductions The evaluated reductions.
+ * @param probes The evaluated probes (with dimensional positions).
+ * @param slices The resampled slices (with dimensional positions).
+ */
+InSituAnalysis::InSituAnalysis(
+    TopologyManager const &topology, Tree const &tree,
+    double const dimensionalized_node_size_on_level_zero,
+    unsigned int const interval,
+    std::vector<std::unique_ptr<OutputQuantity const>> quantities,
+    std::vector<InSituReduction> reductions, std::vector<InSituProbe> probes,
+    std::vector<InSituSlice> slices)
+    : topology_(topology), tree_(tree),
+      dimensionalized_node_size_on_level_zero_(
+          dimensionalized_node_size_on_level_zero),
+      interval_(interval), quantities_(std::move(quantities)),
+      reductions_(std::move(reductions)), probes_(std::move(probes)),
+      slices_(std::move(slices)),
+      reduction_quantity_indices_(QuantityIndices(quantities_, reductions_)),
+      probe_quantity_indices_(QuantityIndices(quantities_, probes_)),
+      slice_quantity_indices_(QuantityIndices(quantities_, slices_)),
+      slice_grids_(
+          CreateSliceGrids(topology_, dimensionalized_node_size_on_level_zero_,
+                           quantities_, slices_, slice_quantity_indices_)) {
+  /** Empty besides initializer list */
+}
+
+/**
+ * @brief Gives the names of the values returned by Evaluate, e.g., for the
+ * header of a time series file.
+ * @return The names in the order of the values.
+ */
+std::vector<std::string> InSituAnalysis::ColumnNames() const {
+  std::vector<std::string> names;
+  names.reserve(reductions_.size() + probes_.size());
+  for (std::size_t index = 0; index < reductions_.size(); ++index) {
+    InSituReduction const &reduction = reductions_[index];
+    names.push_back(
+        InSituOperationToString(reduction.operation_) + "(" +
+        ComponentName(*quantities_[reduction_quantity_indices_[index]],
+                      reduction.component_) +
+        ")");
+  }
+  for (std::size_t index = 0; index < probes_.size(); ++index) {
+    InSituProbe const &probe = probes_[index];
+    names.push_back(ComponentName(*quantities_[probe_quantity_indices_[index]],
+                                  probe.component_) +
+                    "(" + std::to_string(probe.point_[0]) + " " +
+                    std::to_string(probe.point_[1]) + " " +
+                    std::to_string(probe.point_[2]) + ")");
+  }
+  return names;
+}
+
+/**
+ * @brief Evaluates all reductions and probes on the local leaves and combines
+ * the results of all ranks in a single reduction. Must be called by all ranks.
+ * @return The values in the order of the column names (only valid on the
+ * master rank). Probes outside of the domain give NaN.
+ */
+std::vector<double> InSituAnalysis::Evaluate() const {
+
+  std::vector<nid_t> const leaf_ids = topology_.LocalLeafIds();
+  std::vector<std::reference_wrapper<Node const>> leaves;
+  leaves.reserve(leaf_ids.size());
+  for (nid_t const id : leaf_ids) {
+    leaves.emplace_back(tree_.GetNodeWithId(id));
+  }
+
+  // Local results as pairs of the combination identifier and the value, the
+  // first entry holds the total volume
+  std::size_t const number_of_entries = 1 + reductions_.size() + probes_.size();
+  std::vector<double> entries(2 * number_of_entries);
+  entries[0] = sum_entry_;
+  entries[1] = 0.0;
+  for (std::size_t index = 0; index < reductions_.size(); ++index) {
+    InSituOperation const operation = reductions_[index].operation_;
+    bool const is_sum = operation != InSituOperation::Minimum &&
+                        operation != InSituOperation::Maximum;
+    entries[2 * (1 + index)] = is_sum ? sum_entry_ : maximum_entry_;
+    entries[2 * (1 + index) + 1] =
+        is_sum ? 0.0 : std::numeric_limits<double>::lowest();
+  }
+  std::size_t const first_probe_entry = 1 + reductions_.size();
+  for (std::size_t index = 0; index < probes_.size(); ++index) {
+    entries[2 * (first_probe_entry + index)] = maximum_entry_;
+    entries[2 * (first_probe_entry + index) + 1] =
+        std::numeric_limits<double>::lowest();
+  }
+
+  constexpr unsigned int cells_per_block =
+      MeshGeneratorUtilities::NumberOfInternalCellsPerBlock();
+  // Volume of a cell of each leaf
+  std::vector<double> cell_volumes(leaf_ids.size());
+  for (std::size_t leaf = 0; leaf < leaf_ids.size(); ++leaf) {
+    double const block_size = DomainSizeOfId(
+        leaf_ids[leaf], dimensionalized_node_size_on_level_zero_);
+    double const cell_size =
+        MeshGeneratorUtilities::CellSizeForBlockSize(block_size);
+    cell_volumes[leaf] = std::pow(cell_size, DTI(CC::DIM()));
+    entries[1] += cell_volumes[leaf] * double(cells_per_block);
+  }
+
+  // Cell data of a quantity is computed once for all its reductions and probes
+  std::vector<double> cell_data;
+  for (std::size_t quantity_index = 0; quantity_index < quantities_.size();
+       ++quantity_index) {
+    OutputQuantity const &quantity = *quantities_[quantity_index];
+    std::array<unsigned int, 2> const dimensions = quantity.GetDimensions();
+    unsigned int const number_of_components = dimensions[0] * dimensions[1];
+    cell_data.resize(leaves.size() * cells_per_block * number_of_components);
+    quantity.ComputeCellData(leaves, cell_data);
+
+    for (std::size_t index = 0; index < reductions_.size(); ++index) {
+      if (reduction_quantity_indices_[index] != quantity_index) {
+        continue;
+      }
+      InSituOperation const operation = reductions_[index].operation_;
+      double &result = entries[2 * (1 + index) + 1];
+      for (std::size_t leaf = 0; leaf < leaves.size(); ++leaf) {
+        for (unsigned int cell = 0; cell < cells_per_block; ++cell) {
+          double const value =
+              cell_data[(leaf * cells_per_block + cell) * number_of_components +
+                        reductions_[index].component_];
+          switch (operation) {
+          case InSituOperation::SquaredIntegral: {
+            result += value * value * cell_volumes[leaf];
+          } break;
+          case InSituOperation::Minimum: {
+            result = std::max(result, -value);
+          } break;
+          case InSituOperation::Maximum: {
+            result = std::max(result, value);
+          } break;
+          default: {
+            result += value * cell_volumes[leaf];
+          } // integral and mean
+          }
+        }
+      }
+    }
+
+    for (std::size_t index = 0; index < probes_.size(); ++index) {
+      if (probe_quantity_indices_[index] != quantity_index) {
+        continue;
+      }
+      InSituProbe const &probe = probes_[index];
+      for (std::size_t leaf = 0; leaf < leaves.size(); ++leaf) {
+        double const block_size = DomainSizeOfId(
+            leaf_ids[leaf], dimensionalized_node_size_on_level_zero_);
+        std::array<double, 3> const block_origin =
+            DomainCoordinatesOfId(leaf_ids[leaf], block_size);
+        std::array<unsigned int, 3> const number_of_cells = {
+            CC::ICX(), CC::ICY(), CC::ICZ()};
+        std::array<unsigned int, 3> cell_index = {0, 0, 0};
+        bool inside = true;
+        double const cell_size =
+            MeshGeneratorUtilities::CellSizeForBlockSize(block_size);
+        for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+          double const position = probe.point_[d] - block_origin[d];
+          if (position < 0.0 || position > block_size) {
+            inside = false;
+            break;
+          }
+          // points on the upper border belong to the last cell
+          cell_index[d] = std::min(
+              number_of_cells[d] - 1,
+              static_cast<unsigned int>(std::floor(position / cell_size)));
+        }
+        if (!inside) {
+          continue;
+        }
+        unsigned int const cell =
+            cell_index[0] +
+            number_of_cells[0] *
+                (cell_index[1] + number_of_cells[1] * cell_index[2]);
+        double &result = entries[2 * (first_probe_entry + index) + 1];
+        // points on the border of two leaves take the larger value to be
+        // independent of the order of the leaves
+        result = std::max(
+            result,
+            cell_data[(leaf * cells_per_block + cell) * number_of_components +
+                      probe.component_]);
+      }
+    }
+  }
+
+  // Combination of the results of all ranks in a single reduction
+  MPI_Datatype entry_type;
+  MPI_Type_contiguous(2, MPI_DOUBLE, &entry_type);
+  MPI_Type_commit(&entry_type);
+  MPI_Op combine_operation;
+  MPI_Op_create(&CombineEntries, 1, &combine_operation);
+  std::vector<double> combined_entries(entries.size());
+  MPI_Reduce(entries.data(), combined_entries.data(), number_of_entries,
+             entry_type, combine_operation, 0, MpiUtilities::Communicator());
+  MPI_Op_free(&combine_operation);
+  MPI_Type_free(&entry_type);
+
+  std::vector<double> values;
+  if (!MpiUtilities::MasterRank()) {
+    return values;
+  }
+  double const total_volume = combined_entries[1];
+  values.reserve(number_of_entries - 1);
+  for (std::size_t index = 0; index < reductions_.size(); ++index) {
+    double const value = combined_entries[2 * (1 + index) + 1];
+    switch (reductions_[index].operation_) {
+    case InSituOperation::Mean: {
+      values.push_back(value / total_volume);
+    } break;
+    case InSituOperation::Minimum: {
+      values.push_back(-value);
+    } break;
+    default: {
+      values.push_back(value);
+    }
+    }
+  }
+  for (std::size_t index = 0; index < probes_.size(); ++index) {
+    double const value = combined_entries[2 * (first_probe_entry + index) + 1];
+    values.push_back(value == std::numeric_limits<double>::lowest()
+                         ? std::numeric_limits<double>::quiet_NaN()
+                         : value);
+  }
+  return values;
+}
+
+/**
+ * @brief Resamples all slices to their uniform grids. Only the local leaves
+ * intersecting a slice are considered, within them the cells containing the
+ * slice. The weighted values of all ranks are combined in a single reduction.
+ * Must be called by all ranks.
+ * @return The values of each slice, row-major with respect to the spanned axes
+ * (only valid on the master rank). Grid cells not covered by any leaf, e.g.,
+ * for slices outside of the domain, give NaN.
+ */
+std::vector<std::vector<double>> InSituAnalysis::EvaluateSlices() const {
+
+  std::vector<nid_t> const leaf_ids = topology_.LocalLeafIds();
+  std::array<unsigned int, 3> const number_of_cells = {CC::ICX(), CC::ICY(),
+                                                       CC::ICZ()};
+  constexpr unsigned int cells_per_block =
+      MeshGeneratorUtilities::NumberOfInternalCellsPerBlock();
+
+  // Local results as pairs of the weighted sum of the values and the sum of
+  // the weights of each grid cell, the slices follow each other
+  std::vector<std::size_t> offsets(slices_.size() + 1, 0);
+  for (std::size_t index = 0; index < slices_.size(); ++index) {
+    std::size_t grid_cells = 1;
+    for (unsigned int const cells : slice_grids_[index].cells_) {
+      grid_cells *= cells;
+    }
+    offsets[index + 1] = offsets[index] + 2 * grid_cells;
+  }
+  std::vector<double> entries(offsets.back(), 0.0);
+
+  std::vector<double> cell_data;
+  for (std::size_t index = 0; index < slices_.size(); ++index) {
+    InSituSlice const &slice = slices_[index];
+    InSituSliceGrid const &grid = slice_grids_[index];
+
+    // Leaves intersecting the slice together with the index of the cell
+    // containing the slice point along the axes that are not spanned
+    std::vector<nid_t> ids;
+    std::vector<std::reference_wrapper<Node const>> leaves;
+    std::vector<std::array<unsigned int, 3>> fixed_cells;
+    for (nid_t const id : leaf_ids) {
+      double const block_size =
+          DomainSizeOfId(id, dimensionalized_node_size_on_level_zero_);
+      std::array<double, 3> const block_origin =
+          DomainCoordinatesOfId(id, block_size);
+      double const cell_size =
+          MeshGeneratorUtilities::CellSizeForBlockSize(block_size);
+      std::array<unsigned int, 3> fixed_cell = {0, 0, 0};
+      bool intersects = true;
+      for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+        if (slice.spanned_axes_[d]) {
+          continue;
+        }
+        double const position = slice.point_[d] - block_origin[d];
+        if (position < 0.0 || position > block_size) {
+          intersects = false;
+          break;
+        }
+        // points on the upper border belong to the last cell
+        fixed_cell[d] = std::min(
+            number_of_cells[d] - 1,
+            static_cast<unsigned int>(std::floor(position / cell_size)));
+      }
+      if (intersects) {
+        ids.push_back(id);
+        leaves.emplace_back(tree_.GetNodeWithId(id));
+        fixed_cells.push_back(fixed_cell);
+      }
+    }
+
+    OutputQuantity const &quantity =
+        *quantities_[slice_quantity_indices_[index]];
+    std::array<unsigned int, 2> const dimensions = quantity.GetDimensions();
+    unsigned int const number_of_components = dimensions[0] * dimensions[1];
+    cell_data.resize(leaves.size() * cells_per_block * number_of_components);
+    quantity.ComputeCellData(leaves, cell_data);
+
+    bool const is_plane = grid.axes_.size() == 2;
+    unsigned int const second_axis_cells = is_plane ? grid.cells_[1] : 1;
+    double *const slice_entries = entries.data() + offsets[index];
+    for (std::size_t leaf = 0; leaf < leaves.size(); ++leaf) {
+      unsigned int const level = LevelOfNode(ids[leaf]);
+      double const block_size =
+          DomainSizeOfId(ids[leaf], dimensionalized_node_size_on_level_zero_);
+      std::array<double, 3> const block_origin =
+          DomainCoordinatesOfId(ids[leaf], block_size);
+      std::array<std::vector<SliceCellMapping>, 2> mappings;
+      for (std::size_t axis = 0; axis < grid.axes_.size(); ++axis) {
+        mappings[axis] = MapCellsOntoGrid(block_origin[grid.axes_[axis]], level,
+                                          number_of_cells[grid.axes_[axis]],
+                                          grid, slice.level_, axis);
+      }
+      if (!is_plane) {
+        mappings[1] = {{0, 0, 1.0}};
+      }
+      std::array<unsigned int, 3> cell = fixed_cells[leaf];
+      for (SliceCellMapping const &first : mappings[0]) {
+        cell[grid.axes_[0]] = first.leaf_cell_;
+        for (SliceCellMapping const &second : mappings[1]) {
+          if (is_plane) {
+            cell[grid.axes_[1]] = second.leaf_cell_;
+          }
+          unsigned int const cell_index =
+              cell[0] +
+              number_of_cells[0] * (cell[1] + number_of_cells[1] * cell[2]);
+          double const value = cell_data[(leaf * cells_per_block + cell_index) *
+                                             number_of_components +
+                                         slice.component_];
+          double const weight = first.weight_ * second.weight_;
+          std::size_t const grid_cell =
+              std::size_t(first.grid_cell_) * second_axis_cells +
+              second.grid_cell_;
+          slice_entries[2 * grid_cell] += weight * value;
+          slice_entries[2 * grid_cell + 1] += weight;
+        }
+      }
+    }
+  }
+
+  // Combination of the results of all ranks in a single reduction
+  std::vector<double> combined_entries(
+      MpiUtilities::MasterRank() ? entries.size() : 0);
+  MPI_Reduce(entries.data(), combined_entries.data(),
+             static_cast<int>(entries.size()), MPI_DOUBLE, MPI_SUM, 0,
+             MpiUtilities::Communicator());
+
+  std::vector<std::vector<double>> values;
+  if (!MpiUtilities::MasterRank()) {
+    return values;
+  }
+  values.reserve(slices_.size());
+  for (std::size_t index = 0; index < slices_.size(); ++index) {
+    std::vector<double> &slice_values = values.emplace_back();
+    slice_values.reserve((offsets[index + 1] - offsets[index]) / 2);
+    for (std::size_t entry = offsets[index]; entry < offsets[index + 1];
+         entry += 2) {
+      double const weight = combined_entries[entry + 1];
+      slice_values.push_back(weight > 0.0
+                                 ? combined_entries[entry] / weight
+                                 : std::numeric_limits<double>::quiet_NaN());
+    }
+  }
+  return values;
+}
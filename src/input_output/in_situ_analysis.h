@@ -0,0 +1,124 @@
+//===------------------------- in_situ_analysis.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef IN_SITU_ANALYSIS_H
+#define IN_SITU_ANALYSIS_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "input_output/output_writer/output_definitions.h"
+#include "input_output/output_writer/output_quantity.h"
+#include "topology/topology_manager.h"
+#include "topology/tree.h"
+
+/**
+ * @brief The InSituAnalysis class evaluates scalar reductions (e.g., total mass
+ * or maximum pressure) and point probes of output quantities during the
+ * simulation. This allows to record time series of integral quantities without
+ * writing full field outputs. The values of the output quantities are computed
+ * with the same routines as for the standard output, hence, they are
+ * dimensional. All reductions and probes of one evaluation are combined in a
+ * single reduction onto the master rank. Additionally, axis-aligned slices of
+ * the quantities can be resampled to uniform grids, which replaces full field
+ * outputs that are only written to look at a few planes or lines.
+ */
+class InSituAnalysis {
+  // topology to obtain the local leaves
+  TopologyManager const &topology_;
+  // tree to access the data of the local leaves
+  Tree const &tree_;
+  // (dimensionalized) size of a node on level zero
+  double const dimensionalized_node_size_on_level_zero_;
+
+  // number of macro time steps between two evaluations (zero if not used)
+  unsigned int const interval_;
+  // quantities the reductions and probes are evaluated on
+  std::vector<std::unique_ptr<OutputQuantity const>> const quantities_;
+  std::vector<InSituReduction> const reductions_;
+  std::vector<InSituProbe> const probes_;
+  std::vector<InSituSlice> const slices_;
+  // position of the quantity of each reduction, probe and slice in the
+  // quantities
+  std::vector<std::size_t> const reduction_quantity_indices_;
+  std::vector<std::size_t> const probe_quantity_indices_;
+  std::vector<std::size_t> const slice_quantity_indices_;
+  // uniform grid of each slice
+  std::vector<InSituSliceGrid> const slice_grids_;
+
+public:
+  InSituAnalysis() = delete;
+  explicit InSituAnalysis(
+      TopologyManager const &topology, Tree const &tree,
+      double const dimensionalized_node_size_on_level_zero,
+      unsigned int const interval,
+      std::vector<std::unique_ptr<OutputQuantity const>> quantities,
+      std::vector<InSituReduction> reductions, std::vector<InSituProbe> probes,
+      std::vector<InSituSlice> slices);
+  ~InSituAnalysis() = default;
+  InSituAnalysis(InSituAnalysis const &) = delete;
+  InSituAnalysis &operator=(InSituAnalysis const &) = delete;
+  InSituAnalysis(InSituAnalysis &&) = delete;
+  InSituAnalysis &operator=(InSituAnalysis &&) = delete;
+
+  /**
+   * @brief Indicates whether any reduction, probe or slice is evaluated.
+   * @return True if the analysis is used, false otherwise.
+   */
+  inline bool IsActive() const {
+    return interval_ > 0 &&
+           (!reductions_.empty() || !probes_.empty() || !slices_.empty());
+  }
+
+  /**
+   * @brief Gives the resampled slices.
+   * @return The slices.
+   */
+  inline std::vector<InSituSlice> const &Slices() const { return slices_; }
+
+  /**
+   * @brief Gives the uniform grids of the slices.
+   * @return The grids in the order of the slices.
+   */
+  inline std::vector<InSituSliceGrid> const &SliceGrids() const {
+    return slice_grids_;
+  }
+
+  /**
+   * @brief Indicates whether the analysis is evaluated in the given macro time
+   * step.
+   * @param macro_timestep Number of the macro time step.
+   * @return True if the analysis has to be evaluated, false otherwise.
+   */
+  inline bool IsDue(unsigned int const macro_timestep) const {
+    return IsActive() && macro_timestep % interval_ == 0;
+  }
+
+  // Function to name the evaluated values
+  std::vector<std::string> ColumnNames() const;
+  // Function to evaluate all reductions and probes (collective call)
+  std::vector<double> Evaluate() const;
+  // Function to resample all slices (collective call)
+  std::vector<std::vector<double>> EvaluateSlices() const;
+};
+
+#endif // IN_SITU_ANALYSIS_H
@@ -26,15 +26,20 @@
 #include <cstdio> // needed for file deletion
 #include <filesystem>
 #include <fstream>
+#include <system_error>
 #include <unistd.h>
 
 #include "input_output/utilities/file_utilities.h"
 
+#include "communication/communication_statistics.h"
 #include "communication/mpi_utilities.h"
+#include "communication/rank_reordering.h"
 #include "input_output/output_writer.h"
 #include "input_output/output_writer/output_definitions.h"
 #include "user_specifications/compile_time_constants.h"
 #include "user_specifications/debug_and_profile_setup.h"
+#include "user_specifications/output_constants.h"
+#include "utilities/runtime_profiler.h"
 
 namespace {
 /**
@@ -51,6 +56,43 @@ inline void RemoveTimeStamps(std::vector<double> &time_stamps,
                                        return timestamp <= maximum_value;
                                      }));
 }
+
+/**
+ * @brief Copies the files of a staged restart snapshot to the restart folder
+ * and points the symbolic link of the latest snapshot to the last of them. Each
+ * file is copied under a temporary name first, hence the restart folder never
+ * holds partial files.
+ * @param staged_filenames The files in the staging folder (snapshot file last).
+ * @param drained_filenames The files in the restart folder (same order).
+ * @param symlink_name The symbolic link to the latest snapshot.
+ * @return The error message (empty if the files are drained).
+ * @note Runs on a background thread, hence it must not log.
+ */
+std::string DrainRestartFiles(std::vector<std::string> const staged_filenames,
+                              std::vector<std::string> const drained_filenames,
+                              std::string const symlink_name) {
+  for (std::size_t index = 0; index < staged_filenames.size(); ++index) {
+    std::string const temporary_filename = drained_filenames[index] + ".part";
+    std::error_code error;
+    std::filesystem::copy_file(
+        staged_filenames[index], temporary_filename,
+        std::filesystem::copy_options::overwrite_existing, error);
+    if (!error) {
+      std::filesystem::rename(temporary_filename, drained_filenames[index],
+                              error);
+    }
+    if (error) {
+      std::remove(temporary_filename.c_str());
+      return "Draining restart file " + staged_filenames[index] +
+             " failed: " + error.message();
+    }
+  }
+  std::remove(symlink_name.c_str());
+  [[maybe_unused]] int const result_io =
+      symlink(FileUtilities::RemoveFilePath(drained_filenames.back()).c_str(),
+              symlink_name.c_str());
+  return "";
+}
 } // namespace
 
 /**
@@ -61,11 +103,14 @@ inline void RemoveTimeStamps(std::vector<double> &time_stamps,
  * @param unit_handler Instance to provide (non-)dimensionalization of values.
  * @param output_writer Full initialized output writer class.
  * @param restart_manager Full initialized restar_manager class.
+ * @param in_situ_analysis Full initialized in-situ analysis.
  * @param time_naming_factor Factor that is used for naming the ouput files.
  * @param standard_output_timestamps Timestamps when output is desired for the
  * standard or debug output.
  * @param interface_output_timestamps Timestamps when output is desired for the
  * interface output.
+ * @param monitoring_output_timestamps Timestamps when output is desired for the
+ * monitoring output.
  * @param restore_mode Restore mode (Off, soft, forced).
  * @param restore_filename Filename that is used for restoring the simulation if
  * mode is enabled.
@@ -73,36 +118,49 @@ inline void RemoveTimeStamps(std::vector<double> &time_stamps,
  * @param restart_snapshot_interval Interval (in wall seconds) when a restart
  * file should be written.
  * @param restart_intervals_to_keep Number of intervals that are kept in total.
+ * @param restart_staging_folder Folder in which restart snapshots are written
+ * before they are drained to the restart folder (empty to write them directly).
+ * @param staging_generations_to_keep Number of snapshots that are kept in the
+ * staging folder.
  */
 InputOutputManager::InputOutputManager(
     std::string const &input_file, std::filesystem::path const &output_folder,
     UnitHandler const &unit_handler, OutputWriter const &output_writer,
-    RestartManager const &restart_manager, double const time_naming_factor,
+    RestartManager &restart_manager, InSituAnalysis const &in_situ_analysis,
+    double const time_naming_factor,
     std::vector<double> const &standard_output_timestamps,
     std::vector<double> const &interface_output_timestamps,
+    std::vector<double> const &monitoring_output_timestamps,
     RestoreMode const restore_mode, std::string const &restore_filename,
     std::vector<double> const &restart_snapshot_timestamps,
     int const restart_snapshot_interval,
-    unsigned int const restart_intervals_to_keep)
+    unsigned int const restart_intervals_to_keep,
+    std::string const &restart_staging_folder,
+    unsigned int const staging_generations_to_keep)
     : // Start initializer list
       unit_handler_(unit_handler), logger_(LogWriter::Instance()),
       output_writer_(output_writer), restart_manager_(restart_manager),
+      in_situ_analysis_(in_situ_analysis),
       output_folder_name_(output_folder.string()),
       time_naming_factor_(time_naming_factor),
       standard_output_enabled_(!standard_output_timestamps.empty()),
       standard_output_timestamps_(standard_output_timestamps),
       interface_output_enabled_(!interface_output_timestamps.empty()),
       interface_output_timestamps_(interface_output_timestamps),
+      monitoring_output_enabled_(!monitoring_output_timestamps.empty()),
+      monitoring_output_timestamps_(monitoring_output_timestamps),
       restore_mode_(restore_mode), restore_filename_(restore_filename),
       restart_snapshot_timestamps_(restart_snapshot_timestamps),
       restart_snapshot_interval_(restart_snapshot_interval),
       restart_files_to_keep_(restart_intervals_to_keep),
       symlink_latest_restart_name_(
           output_folder_name_ + RestartSubfolderName() + LatestSnapshotName()),
-      wall_time_of_last_restart_file_(std::chrono::system_clock::now()) {
+      wall_time_of_last_restart_file_(std::chrono::system_clock::now()),
+      restart_staging_folder_(restart_staging_folder),
+      staging_generations_to_keep_(staging_generations_to_keep) {
   // This Barrier is needed, otherwise we get inconsistent folder names across
   // the ranks.
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(MpiUtilities::Communicator());
   // Only Master-rank is setting up the folders...
   if (MpiUtilities::MyRankId() == 0) {
     // create output folder and subfolders
@@ -133,6 +191,11 @@ InputOutputManager::InputOutputManager(
           OutputFileName(OutputType::Interface) + TimeSeriesSuffix();
       output_writer_.InitializeTimeSeriesFile(time_series_filename);
     }
+    if (!monitoring_output_timestamps_.empty()) {
+      time_series_filename =
+          OutputFileName(OutputType::Monitoring) + TimeSeriesSuffix();
+      output_writer_.InitializeTimeSeriesFile(time_series_filename);
+    }
     if constexpr (DP::DebugOutput()) {
       time_series_filename =
           OutputFileName(OutputType::Debug) + TimeSeriesSuffix();
@@ -147,6 +210,9 @@ InputOutputManager::InputOutputManager(
  * and restart operations.
  */
 InputOutputManager::~InputOutputManager() {
+  // Files written in the background must be complete before MPI is finalized
+  output_writer_.WaitForPendingWrites();
+  FinishRestartDrain();
   // Finalizes the time series files
   std::string time_series_filename;
   if (standard_output_enabled_) {
@@ -159,6 +225,11 @@ InputOutputManager::~InputOutputManager() {
         OutputFileName(OutputType::Interface) + TimeSeriesSuffix();
     output_writer_.FinalizeTimeSeriesFile(time_series_filename);
   }
+  if (monitoring_output_enabled_) {
+    time_series_filename =
+        OutputFileName(OutputType::Monitoring) + TimeSeriesSuffix();
+    output_writer_.FinalizeTimeSeriesFile(time_series_filename);
+  }
   if constexpr (DP::DebugOutput()) {
     time_series_filename =
         OutputFileName(OutputType::Debug) + TimeSeriesSuffix();
@@ -166,6 +237,19 @@ InputOutputManager::~InputOutputManager() {
   }
 }
 
+/**
+ * @brief Waits until the latest staged restart snapshot is drained to the
+ * restart folder and logs a failed drain.
+ */
+void InputOutputManager::FinishRestartDrain() {
+  if (restart_drain_.valid()) {
+    std::string const drain_error = restart_drain_.get();
+    if (!drain_error.empty()) {
+      logger_.LogMessage(drain_error);
+    }
+  }
+}
+
 /**
  * @brief This routine creates the output folders for the simulation.
  * @note  Only the master-rank "0" is supposed to create the folder.
@@ -180,13 +264,24 @@ void InputOutputManager::CreateOutputFolder() const {
     FileUtilities::CreateFolder(output_folder_name_ +
                                 OutputSubfolderName(OutputType::Interface));
   }
+  if (monitoring_output_enabled_) {
+    FileUtilities::CreateFolder(output_folder_name_ +
+                                OutputSubfolderName(OutputType::Monitoring));
+  }
   if constexpr (DP::DebugOutput()) {
     FileUtilities::CreateFolder(output_folder_name_ +
                                 OutputSubfolderName(OutputType::Debug));
   }
 
+  if (!in_situ_analysis_.Slices().empty()) {
+    FileUtilities::CreateFolder(output_folder_name_ + SlicesSubfolderName());
+  }
+
   // create restart folder
   FileUtilities::CreateFolder(output_folder_name_ + RestartSubfolderName());
+  if (!restart_staging_folder_.empty()) {
+    FileUtilities::CreateFolder(restart_staging_folder_);
+  }
 
 #ifndef PERFORMANCE
   // create an .gitignore file in the output folder
@@ -218,10 +313,190 @@ void InputOutputManager::WriteTimestepFile(
   }
 }
 
+/**
+ * @brief Evaluates the in-situ analysis if it is due in the given macro time
+ * step and appends the results to its time series file. The header is written
+ * once when the file is created (also for restarted simulations). The slices
+ * are written into one small hdf5 file per evaluation.
+ * @param timestep The current timestep.
+ * @param macro_timestep Number of the current macro time step.
+ */
+void InputOutputManager::WriteInSituAnalysis(
+    double const timestep, unsigned int const macro_timestep) const {
+  if (!in_situ_analysis_.IsDue(macro_timestep)) {
+    return;
+  }
+  double const dimensionalized_time =
+      unit_handler_.DimensionalizeValue(timestep, UnitType::Time);
+  if (!in_situ_analysis_.Slices().empty()) {
+    // collective evaluation, the results are only valid on rank 0
+    std::vector<std::vector<double>> const slice_values =
+        in_situ_analysis_.EvaluateSlices();
+    if (MpiUtilities::MyRankId() == 0) {
+      output_writer_.WriteSliceFile(
+          dimensionalized_time,
+          output_folder_name_ + SlicesSubfolderName() + "/slices_" +
+              StringOperations::ToScientificNotationString(dimensionalized_time,
+                                                           9),
+          in_situ_analysis_.Slices(), in_situ_analysis_.SliceGrids(),
+          slice_values);
+    }
+  }
+  std::vector<std::string> const column_names = in_situ_analysis_.ColumnNames();
+  if (column_names.empty()) {
+    return;
+  }
+  // collective evaluation, the results are only valid on rank 0
+  std::vector<double> const values = in_situ_analysis_.Evaluate();
+  // can only be done for rank 0 to avoid parallel writing
+  if (MpiUtilities::MyRankId() == 0) {
+    std::string const filename = output_folder_name_ + "/in_situ_analysis.csv";
+    std::string lines;
+    if (!FileUtilities::CheckIfPathExists(filename)) {
+      lines += "time";
+      for (std::string const &name : column_names) {
+        lines += "," + name;
+      }
+      lines += "\n";
+    }
+    lines += StringOperations::ToScientificNotationString(dimensionalized_time);
+    for (double const value : values) {
+      lines += "," + StringOperations::ToScientificNotationString(value);
+    }
+    lines += "\n";
+    FileUtilities::AppendToTextBasedFile(filename, lines);
+  }
+}
+
+/**
+ * @brief Evaluates the reductions and probes of the in-situ analysis
+ * independent of their interval, e.g. when the simulation is driven step-wise
+ * from outside.
+ * @return The name and value of each reduction and probe (valid on all ranks).
+ * @note Collective call, hence, it must be called on all ranks.
+ */
+std::vector<std::pair<std::string, double>>
+InputOutputManager::EvaluateInSituAnalysis() const {
+  std::vector<double> values = in_situ_analysis_.Evaluate();
+  MPI_Bcast(values.data(), static_cast<int>(values.size()), MPI_DOUBLE, 0,
+            MpiUtilities::Communicator());
+  std::vector<std::string> const names = in_situ_analysis_.ColumnNames();
+  std::vector<std::pair<std::string, double>> results;
+  results.reserve(values.size());
+  for (std::size_t index = 0; index < values.size(); ++index) {
+    results.emplace_back(names[index], values[index]);
+  }
+  return results;
+}
+
+/**
+ * @brief Writes the timeline recorded by the runtime profiler if tracing is
+ * enabled. Each rank writes its events to its own trace file. Afterwards, rank
+ * 0 merges the files of all ranks into a single trace in the Chrome trace event
+ * format, which can be viewed, e.g., with Perfetto or chrome://tracing.
+ * @note Collective call, hence, it must be called on all ranks.
+ */
+void InputOutputManager::WriteTraceFiles() const {
+  RuntimeProfiler const &profiler = RuntimeProfiler::Instance();
+  if (!profiler.IsTracing()) {
+    return;
+  }
+  int const rank = MpiUtilities::MyRankId();
+  if (rank == 0) {
+    FileUtilities::CreateFolder(output_folder_name_ + "/trace");
+  }
+  MPI_Barrier(MpiUtilities::Communicator());
+
+  // Each rank file is a valid trace on its own with one event per line
+  std::vector<std::string> const events = profiler.TraceEvents();
+  std::string content = "[\n";
+  for (std::size_t index = 0; index < events.size(); ++index) {
+    content += events[index] + (index + 1 < events.size() ? ",\n" : "\n");
+  }
+  content += "]\n";
+  FileUtilities::WriteTextBasedFile(RankTraceFileName(rank), content);
+  MPI_Barrier(MpiUtilities::Communicator());
+
+  if (rank == 0) {
+    std::string merged = "[\n";
+    std::string separator;
+    for (int other_rank = 0; other_rank < MpiUtilities::NumberOfRanks();
+         ++other_rank) {
+      std::ifstream input_stream(RankTraceFileName(other_rank));
+      std::string line;
+      while (std::getline(input_stream, line)) {
+        if (line == "[" || line == "]") {
+          continue;
+        }
+        if (line.back() == ',') {
+          line.pop_back();
+        }
+        merged += separator + line;
+        separator = ",\n";
+      }
+    }
+    merged += "\n]\n";
+    FileUtilities::WriteTextBasedFile(output_folder_name_ + "/trace.json",
+                                      merged);
+    logger_.LogMessage("Trace written to " + output_folder_name_ +
+                       "/trace.json");
+  }
+}
+
+/**
+ * @brief Writes the bytes sent between all pairs of ranks per communication
+ * category to communication_matrix.csv in the output folder.
+ * @note Collective call, hence, it must be called on all ranks.
+ */
+void InputOutputManager::WriteCommunicationMatrix() const {
+  std::string const matrix = CommunicationMatrixString();
+  if (MpiUtilities::MasterRank()) {
+    std::string const filename =
+        output_folder_name_ + "/communication_matrix.csv";
+    FileUtilities::WriteTextBasedFile(filename, matrix);
+    logger_.LogMessage("Communication matrix written to " + filename);
+  }
+}
+
+/**
+ * @brief Writes the placement of the ranks suggested by the MPI library for the
+ * halo graph to rankfile in the output folder and logs the halo volume
+ * exchanged between compute nodes with the current and the suggested placement.
+ * @param halo_bytes The bytes sent to each rank in a halo update.
+ * @note Collective call, hence, it must be called on all ranks.
+ */
+void InputOutputManager::WriteSuggestedRankfile(
+    std::vector<long> const &halo_bytes) const {
+  HaloGraphPlacement const placement = RankReordering::MapHaloGraph(halo_bytes);
+  if (MpiUtilities::MasterRank()) {
+    std::string const filename = output_folder_name_ + "/rankfile";
+    FileUtilities::WriteTextBasedFile(filename, placement.rankfile_);
+    logger_.LogMessage(
+        "Halo graph placement: " + std::to_string(placement.moved_ranks_) +
+        " ranks moved, halo bytes between compute nodes " +
+        std::to_string(placement.internode_bytes_current_) + " ( current ) / " +
+        std::to_string(placement.internode_bytes_suggested_) +
+        " ( suggested ), rankfile written to " + filename);
+  }
+}
+
+/**
+ * @brief Replaces the status file in the output folder atomically, such that
+ * it can be polled by monitoring tools at any time.
+ * @param status The current status of the run.
+ */
+void InputOutputManager::WriteRunStatus(RunStatus const &status) const {
+  // can only be done for rank 0 to avoid parallel writing
+  if (MpiUtilities::MasterRank()) {
+    FileUtilities::ReplaceTextBasedFile(output_folder_name_ + "/status.json",
+                                        RunStatusJson(status));
+  }
+}
+
 /**
  * @brief Writes the full output (all outputs desired (standard, interface,
- * debug)) at the current timestep. If the force_output flag is set, output is
- * written in any case.
+ * monitoring, debug)) at the current timestep. If the force_output flag is
+ * set, output is written in any case.
  * @param timestep The current timestep.
  * @param force_output A flag indicating whether output should be forced.
  * @return Return whether any output was written or not.
@@ -291,6 +566,28 @@ bool InputOutputManager::WriteFullOutput(double const timestep,
     }
   }
 
+  // Check whether if the monitoring output is enabled (required to prevent
+  // call .front() with empty vector )
+  if (monitoring_output_enabled_) {
+    // Check wether the output is forced or the next desired monitoring time
+    // stamp is smaller than the current
+    if (force_output || monitoring_output_timestamps_.front() <= timestep) {
+      // erase the timestamps that are handled now
+      RemoveTimeStamps(monitoring_output_timestamps_, timestep);
+
+      // call the output functions with the dimensionalized time
+      std::string const output_filename(OutputFileName(OutputType::Monitoring) +
+                                        time_name);
+      std::string const time_series_filename(
+          OutputFileName(OutputType::Monitoring) + TimeSeriesSuffix());
+      WriteOutput(OutputType::Monitoring, dimensionalized_time, output_filename,
+                  time_series_filename);
+
+      // Set flag to true
+      output_written = true;
+    }
+  }
+
   // Always write debug output if activated
   if constexpr (DP::DebugOutput()) {
     std::string const output_filename(OutputFileName(OutputType::Debug) +
@@ -367,7 +664,7 @@ void InputOutputManager::WriteOutput(
     all_times.resize(number_of_ranks);
     // communicate all individual times
     MPI_Allgather(&seconds_elapsed, 1, MPI_DOUBLE, all_times.data(), 1,
-                  MPI_DOUBLE, MPI_COMM_WORLD);
+                  MPI_DOUBLE, MpiUtilities::Communicator());
     std::vector<double>::iterator max_time =
         std::max_element(all_times.begin(), all_times.end());
     std::vector<double>::iterator min_time =
@@ -416,7 +713,8 @@ void InputOutputManager::WriteRestartFile(double const timestep,
       }
     }
     // distribute restart decision among all ranks
-    MPI_Bcast(&snapshot_interval_triggered, 1, MPI_CXX_BOOL, 0, MPI_COMM_WORLD);
+    MPI_Bcast(&snapshot_interval_triggered, 1, MPI_CXX_BOOL, 0,
+              MpiUtilities::Communicator());
   }
 
   // Check restart trigger on snapshot time stamps (first check on empty vector
@@ -439,30 +737,86 @@ void InputOutputManager::WriteRestartFile(double const timestep,
     std::string const time_name(std::to_string(
         unit_handler_.DimensionalizeValue(timestep, UnitType::Time) *
         time_naming_factor_));
-    std::string const filename_without_extension(RestartFileName() + time_name);
+    // staged snapshots are written to the staging folder first
+    bool const is_staged = !restart_staging_folder_.empty();
+    std::string const filename_without_extension(
+        (is_staged ? restart_staging_folder_ + "/restart_"
+                   : RestartFileName()) +
+        time_name);
 
     // write the actual restart file and store its name
-    std::string snapshot_filename =
-        restart_manager_.WriteRestartFile(timestep, filename_without_extension);
+    // (timestamp snapshots are kept, hence they must not depend on others)
+    std::string snapshot_filename = restart_manager_.WriteRestartFile(
+        timestep, filename_without_extension, snapshot_timestamp_triggered);
+    std::string full_snapshot_filename = restart_manager_.LastFullSnapshot();
+
+    // the subfiles of all aggregator groups must be complete before they are
+    // drained by rank zero
+    if (is_staged && RestartOutputSettings::SubfileAggregatorGroupSize > 0) {
+      output_writer_.WaitForPendingWrites();
+      MPI_Barrier(MpiUtilities::Communicator());
+    }
 
     // handle filesystem access only on rank zero
     if (MpiUtilities::MyRankId() == 0) {
 
-      // update symbolic link to latest snapshot file
-      std::remove(symlink_latest_restart_name_.c_str());
-      [[maybe_unused]] int const result_io =
-          symlink(FileUtilities::RemoveFilePath(snapshot_filename).c_str(),
-                  symlink_latest_restart_name_.c_str());
+      if (is_staged) {
+        // the staged file must be complete and the previous drain finished
+        // before the next drain starts
+        output_writer_.WaitForPendingWrites();
+        FinishRestartDrain();
+        // keep only the latest generations in the staging folder
+        staged_restart_files_.push_back(snapshot_filename);
+        if (staged_restart_files_.size() > staging_generations_to_keep_) {
+          for (std::string const &file :
+               RestartManager::SnapshotFiles(staged_restart_files_.front())) {
+            std::remove(file.c_str());
+          }
+          staged_restart_files_.erase(staged_restart_files_.begin());
+        }
+        // drain the files in the background (also updates the symbolic link)
+        std::vector<std::string> const staged_filenames =
+            RestartManager::SnapshotFiles(snapshot_filename);
+        std::vector<std::string> drained_filenames;
+        for (std::string const &file : staged_filenames) {
+          drained_filenames.push_back(DrainedRestartFileName(file));
+        }
+        restart_drain_ =
+            std::async(std::launch::async, DrainRestartFiles, staged_filenames,
+                       drained_filenames, symlink_latest_restart_name_);
+        snapshot_filename = drained_filenames.back();
+        full_snapshot_filename = DrainedRestartFileName(full_snapshot_filename);
+      } else {
+        // update symbolic link to latest snapshot file
+        std::remove(symlink_latest_restart_name_.c_str());
+        [[maybe_unused]] int const result_io =
+            symlink(FileUtilities::RemoveFilePath(snapshot_filename).c_str(),
+                    symlink_latest_restart_name_.c_str());
+      }
 
       // only consider non-timestamp snapshots for deletion
       if (!snapshot_timestamp_triggered) {
-        if (restart_files_written_.size() == restart_files_to_keep_) {
-          // remove the oldest file
-          std::remove(restart_files_written_.front().c_str());
+        // add the newest file to the list
+        restart_files_written_.emplace_back(snapshot_filename,
+                                            full_snapshot_filename);
+        while (restart_files_written_.size() > restart_files_to_keep_) {
+          // keep the oldest file as long as the next one is a differential
+          // snapshot of the same chain, i.e. depends on it
+          if (restart_files_written_.size() > 1) {
+            auto const &[next_file, next_full_snapshot] =
+                restart_files_written_[1];
+            if (next_file != next_full_snapshot &&
+                next_full_snapshot == restart_files_written_.front().second) {
+              break;
+            }
+          }
+          // remove the oldest file (and its subfiles)
+          for (std::string const &file : RestartManager::SnapshotFiles(
+                   restart_files_written_.front().first)) {
+            std::remove(file.c_str());
+          }
           restart_files_written_.erase(restart_files_written_.begin());
         }
-        // add the newest file to the list
-        restart_files_written_.push_back(snapshot_filename);
       }
     }
   }
@@ -548,12 +902,13 @@ CreateOutputBaseFolder(std::filesystem::path const &input_file) {
     FileUtilities::CreateFolder(output_folder);
     folder_path_size = output_folder.string().size();
   }
-  MPI_Bcast(&folder_path_size, 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+  MPI_Bcast(&folder_path_size, 1, MPI_UINT64_T, 0,
+            MpiUtilities::Communicator());
   std::string output_folder_name = MpiUtilities::MasterRank()
                                        ? output_folder.string()
                                        : std::string(folder_path_size, '#');
   MPI_Bcast(output_folder_name.data(), folder_path_size, MPI_CHAR, 0,
-            MPI_COMM_WORLD);
+            MpiUtilities::Communicator());
 
   return output_folder_name;
 }
@@ -24,12 +24,16 @@
 
 #include <chrono>
 #include <filesystem>
+#include <future>
 #include <memory>
+#include <utility>
 
+#include "input_output/in_situ_analysis.h"
 #include "input_output/log_writer/log_writer.h"
 // #include "topology/topology_manager.h"
 // #include "topology/tree.h"
 #include "input_output/utilities/file_utilities.h"
+#include "input_output/utilities/run_status.h"
 #include "unit_handler.h"
 // #include "materials/material_manager.h"
 #include "input_output/input_reader/input_definitions.h"
@@ -43,7 +47,8 @@
  * unique output folder and delegates all output calls. It decides whether
  * simulation output or restart snapshots have to be written based on user
  * configuration and calls the respective routines. Furthermore, all used micro
- * time steps used in the simulation can be written to a file.
+ * time steps used in the simulation and the results of the in-situ analysis
+ * can be written to a file.
  */
 class InputOutputManager {
   // Unit handler for dimensionalization of time
@@ -55,7 +60,10 @@ class InputOutputManager {
   // Writer for output data
   OutputWriter const &output_writer_;
   // Writer of restart data
-  RestartManager const &restart_manager_;
+  RestartManager &restart_manager_;
+  // Reductions and probes written to a time series file, slices written to
+  // separate files
+  InSituAnalysis const &in_situ_analysis_;
 
   // Path data for output (must be first defined for initializer list in
   // constructor)
@@ -71,6 +79,8 @@ class InputOutputManager {
   std::vector<double> standard_output_timestamps_;
   bool const interface_output_enabled_;
   std::vector<double> interface_output_timestamps_;
+  bool const monitoring_output_enabled_;
+  std::vector<double> monitoring_output_timestamps_;
 
   // Restart output (vectors cannot be const due to subsequent removing
   // operations)
@@ -78,14 +88,24 @@ class InputOutputManager {
   std::string const restore_filename_;
   std::vector<double> restart_snapshot_timestamps_;
   int const restart_snapshot_interval_;
-  std::vector<std::string> restart_files_written_;
+  // written snapshots together with the full snapshot their chain starts at
+  std::vector<std::pair<std::string, std::string>> restart_files_written_;
   unsigned int const restart_files_to_keep_;
   std::string const symlink_latest_restart_name_;
   std::chrono::time_point<std::chrono::system_clock>
       wall_time_of_last_restart_file_;
+  // Staging of restart snapshots in a fast folder, from which they are drained
+  // to the restart folder in the background (empty folder if not staged)
+  std::string const restart_staging_folder_;
+  unsigned int const staging_generations_to_keep_;
+  std::vector<std::string> staged_restart_files_;
+  // Background drain of the latest staged snapshot giving its error message
+  std::future<std::string> restart_drain_;
 
   // Local function to create the  appropriate folder structure
   void CreateOutputFolder() const;
+  // Local function to wait for the drain of the latest staged snapshot
+  void FinishRestartDrain();
   // local function to write an output with additional logging
   void
   WriteOutput(OutputType const output_type, double const output_time,
@@ -95,7 +115,8 @@ class InputOutputManager {
   // Functions for naming of files and folders
   /**
    * @brief Returns the output subfolder name.
-   * @param output_type Output type to be used (standard, interface, debug).
+   * @param output_type Output type to be used (standard, interface, debug,
+   * monitoring).
    * @return subfolder name.
    */
   inline std::string OutputSubfolderName(OutputType const output_type) const {
@@ -106,6 +127,9 @@ class InputOutputManager {
     case OutputType::Interface: {
       return "/interface";
     }
+    case OutputType::Monitoring: {
+      return "/monitoring";
+    }
     default: {
       return "/domain";
     } // standard output
@@ -115,7 +139,8 @@ class InputOutputManager {
   /**
    * @brief Returns the file name for the output (without time or time_series
    * appendix).
-   * @param output_type Output type to be used (standard, interface, debug).
+   * @param output_type Output type to be used (standard, interface, debug,
+   * monitoring).
    * @return standard output file name.
    */
   inline std::string OutputFileName(OutputType const output_type) const {
@@ -128,6 +153,10 @@ class InputOutputManager {
       return output_folder_name_ + OutputSubfolderName(OutputType::Interface) +
              "/interface_";
     }
+    case OutputType::Monitoring: {
+      return output_folder_name_ + OutputSubfolderName(OutputType::Monitoring) +
+             "/monitoring_";
+    }
     default: {
       return output_folder_name_ + OutputSubfolderName(OutputType::Standard) +
              "/data_";
@@ -147,6 +176,12 @@ class InputOutputManager {
    */
   inline std::string RestartSubfolderName() const { return "/restart"; }
 
+  /**
+   * @brief Returns the subfolder name of the slices of the in-situ analysis.
+   * @return slices subfolder name.
+   */
+  inline std::string SlicesSubfolderName() const { return "/slices"; }
+
   /**
    * @brief Returns the file name for the restart (without time appendix).
    * @return restart file name.
@@ -155,6 +190,18 @@ class InputOutputManager {
     return output_folder_name_ + RestartSubfolderName() + "/restart_";
   }
 
+  /**
+   * @brief Returns the name a staged restart file has once it is drained to
+   * the restart folder.
+   * @param staged_filename Name of the file in the staging folder.
+   * @return restart file name.
+   */
+  inline std::string
+  DrainedRestartFileName(std::string const &staged_filename) const {
+    return output_folder_name_ + RestartSubfolderName() + "/" +
+           FileUtilities::RemoveFilePath(staged_filename);
+  }
+
   /**
    * @brief Returns the name of the latest snapshot to be used for the restart.
    * @return name of latest snapshot.
@@ -163,6 +210,16 @@ class InputOutputManager {
     return "/latest_restart_snapshot";
   }
 
+  /**
+   * @brief Returns the name of the trace file of a rank.
+   * @param rank The rank the trace file belongs to.
+   * @return trace file name of the rank.
+   */
+  inline std::string RankTraceFileName(int const rank) const {
+    return output_folder_name_ + "/trace/trace_rank_" + std::to_string(rank) +
+           ".json";
+  }
+
   /**
    * @brief Checks whether the restore file specified in the input file exists.
    * @return True is the file exists, false otherwise.
@@ -175,13 +232,17 @@ public:
   explicit InputOutputManager(
       std::string const &input_file, std::filesystem::path const &output_folder,
       UnitHandler const &unit_handler, OutputWriter const &output_writer,
-      RestartManager const &restart_manager, double const time_naming_factor,
+      RestartManager &restart_manager, InSituAnalysis const &in_situ_analysis,
+      double const time_naming_factor,
       std::vector<double> const &standard_output_timestamps,
       std::vector<double> const &interface_output_timestamps,
+      std::vector<double> const &monitoring_output_timestamps,
       RestoreMode const restore_mode, std::string const &restore_filename,
       std::vector<double> const &restart_snapshot_timestamps,
       int const restart_snapshot_interval,
-      unsigned int const restart_intervals_to_keep);
+      unsigned int const restart_intervals_to_keep,
+      std::string const &restart_staging_folder,
+      unsigned int const staging_generations_to_keep);
   InputOutputManager() = delete;
   ~InputOutputManager();
   InputOutputManager(InputOutputManager const &) = delete;
@@ -201,6 +262,19 @@ public:
   // Function to write the time information to a file
   void
   WriteTimestepFile(std::vector<double> const &timesteps_on_finest_level) const;
+  // Function to write the results of the in-situ analysis to a file
+  void WriteInSituAnalysis(double const timestep,
+                           unsigned int const macro_timestep) const;
+  // Function to evaluate the in-situ analysis on demand
+  std::vector<std::pair<std::string, double>> EvaluateInSituAnalysis() const;
+  // Function to write the timeline recorded by the runtime profiler
+  void WriteTraceFiles() const;
+  // Function to write the rank x rank communication matrix
+  void WriteCommunicationMatrix() const;
+  // Function to write the placement of the ranks suggested for the halo graph
+  void WriteSuggestedRankfile(std::vector<long> const &halo_bytes) const;
+  // Function to replace the status file polled during the run
+  void WriteRunStatus(RunStatus const &status) const;
   // Functions to write simulation data output
   bool WriteFullOutput(double const timestep, bool const force_output = false);
   void
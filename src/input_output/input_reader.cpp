@@ -35,6 +35,7 @@
  * @param restart_reader Base class to the restart reader.
  * @param source_term_reader Base class to the source term reader.
  * @param time_control_reader Base class to the time control reader.
+ * @param numerics_reader Base class to the numerics reader.
  */
 InputReader::InputReader(
     std::string const &input_filename, InputType const input_type,
@@ -46,7 +47,8 @@ InputReader::InputReader(
     std::unique_ptr<OutputReader const> output_reader,
     std::unique_ptr<RestartReader const> restart_reader,
     std::unique_ptr<SourceTermReader const> source_term_reader,
-    std::unique_ptr<TimeControlReader const> time_control_reader)
+    std::unique_ptr<TimeControlReader const> time_control_reader,
+    std::unique_ptr<NumericsReader const> numerics_reader)
     : // Start initializer list
       input_filename_(input_filename), input_type_(input_type),
       material_reader_(std::move(material_reader)),
@@ -57,7 +59,8 @@ InputReader::InputReader(
       output_reader_(std::move(output_reader)),
       restart_reader_(std::move(restart_reader)),
       source_term_reader_(std::move(source_term_reader)),
-      time_control_reader_(std::move(time_control_reader)) {
+      time_control_reader_(std::move(time_control_reader)),
+      numerics_reader_(std::move(numerics_reader)) {
   /** Empty besides initializer list */
 }
 
@@ -147,3 +150,11 @@ SourceTermReader const &InputReader::GetSourceTermReader() const {
 TimeControlReader const &InputReader::GetTimeControlReader() const {
   return *time_control_reader_;
 }
+
+/**
+ * @brief Gives the instance of the numerics reader.
+ * @return reference to the numerics reader.
+ */
+NumericsReader const &InputReader::GetNumericsReader() const {
+  return *numerics_reader_;
+}
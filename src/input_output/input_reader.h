@@ -31,6 +31,7 @@
 #include "input_output/input_reader/input_definitions.h"
 #include "input_output/input_reader/material_reader/material_reader.h"
 #include "input_output/input_reader/multi_resolution_reader/multi_resolution_reader.h"
+#include "input_output/input_reader/numerics_reader/numerics_reader.h"
 #include "input_output/input_reader/output_reader/output_reader.h"
 #include "input_output/input_reader/restart_reader/restart_reader.h"
 #include "input_output/input_reader/source_term_reader/source_term_reader.h"
@@ -60,6 +61,7 @@ private:
   std::unique_ptr<RestartReader const> const restart_reader_;
   std::unique_ptr<SourceTermReader const> const source_term_reader_;
   std::unique_ptr<TimeControlReader const> const time_control_reader_;
+  std::unique_ptr<NumericsReader const> const numerics_reader_;
 
 public:
   explicit InputReader(
@@ -72,7 +74,8 @@ public:
       std::unique_ptr<OutputReader const> output_reader,
       std::unique_ptr<RestartReader const> restart_reader,
       std::unique_ptr<SourceTermReader const> source_term_reader,
-      std::unique_ptr<TimeControlReader const> time_control_reader);
+      std::unique_ptr<TimeControlReader const> time_control_reader,
+      std::unique_ptr<NumericsReader const> numerics_reader);
   InputReader() = delete;
   virtual ~InputReader() = default;
   InputReader(InputReader const &) = delete;
@@ -93,5 +96,6 @@ public:
   TEST_VIRTUAL RestartReader const &GetRestartReader() const;
   TEST_VIRTUAL SourceTermReader const &GetSourceTermReader() const;
   TEST_VIRTUAL TimeControlReader const &GetTimeControlReader() const;
+  TEST_VIRTUAL NumericsReader const &GetNumericsReader() const;
 };
 #endif // INPUT_READER_H
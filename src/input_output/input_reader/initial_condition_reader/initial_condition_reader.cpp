@@ -32,6 +32,18 @@ std::string InitialConditionReader::ReadMaterialInitialConditions(
   return DoReadMaterialInitialConditions(material_index);
 }
 
+/**
+ * @brief Reads the field data file the material is initialized from for a
+ * given material index.
+ * @param material_index Index of the material for which the data is read.
+ * @return Path to the hdf5 field data file ( empty if the material is
+ * initialized from its expression ).
+ */
+std::string InitialConditionReader::ReadMaterialInitialConditionFile(
+    unsigned int const material_index) const {
+  return DoReadMaterialInitialConditionFile(material_index);
+}
+
 /**
  * @brief Gives the levelset initialization type name for a given levelset
  * index.
@@ -45,6 +45,8 @@ protected:
   // Functions that must be implemented by the derived classes
   virtual std::string
   DoReadMaterialInitialConditions(unsigned int const material_index) const = 0;
+  virtual std::string DoReadMaterialInitialConditionFile(
+      unsigned int const material_index) const = 0;
   virtual std::string
   DoReadLevelsetInitializerType(unsigned int const material_index) const = 0;
   virtual std::string
@@ -69,6 +71,8 @@ public:
   // return functions of the reader class
   TEST_VIRTUAL std::string
   ReadMaterialInitialConditions(unsigned int const material_index) const;
+  TEST_VIRTUAL std::string
+  ReadMaterialInitialConditionFile(unsigned int const material_index) const;
   TEST_VIRTUAL LevelsetInitializerType
   ReadLevelsetInitializerType(unsigned int const levelset_index,
                               LevelsetInitializerType const default_type) const;
@@ -51,6 +51,24 @@ std::string XmlInitialConditionReader::DoReadMaterialInitialConditions(
   return XmlUtilities::ReadString(material_node);
 }
 
+/**
+ * @brief See base class definition.
+ */
+std::string XmlInitialConditionReader::DoReadMaterialInitialConditionFile(
+    unsigned int const material_index) const {
+  // Get the correct material node (which always must exist)
+  std::string const material_name("material" + std::to_string(material_index));
+  tinyxml2::XMLElement const *material_node = XmlUtilities::GetChild(
+      *xml_input_file_,
+      {"configuration", "domain", "initialConditions", material_name});
+  if (XmlUtilities::ChildExists(material_node, "file")) {
+    return XmlUtilities::ReadString(
+        XmlUtilities::GetChild(material_node, {"file"}));
+  } else {
+    return "";
+  }
+}
+
 /**
  * @brief See base class definition.
  */
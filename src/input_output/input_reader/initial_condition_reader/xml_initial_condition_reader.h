@@ -43,6 +43,8 @@ class XmlInitialConditionReader : public InitialConditionReader {
   // Functions that are required from base class
   std::string DoReadMaterialInitialConditions(
       unsigned int const material_index) const override;
+  std::string DoReadMaterialInitialConditionFile(
+      unsigned int const material_index) const override;
   std::string DoReadLevelsetInitializerType(
       unsigned int const material_index) const override;
   std::string DoReadLevelsetInitializerInput(
@@ -21,6 +21,7 @@
 //===----------------------------------------------------------------------===//
 #include "input_output/input_reader/multi_resolution_reader/multi_resolution_reader.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include "enums/dimension_definition.h"
@@ -106,3 +107,163 @@ unsigned int MultiResolutionReader::ReadEpsilonLevelReference() const {
   }
   return static_cast<unsigned int>(reference_level);
 }
+
+/**
+ * @brief Gives the checked ratio of the maximum to the mean rank cost above
+ * which load balancing is triggered.
+ * @return The threshold, zero if the trigger is inactive.
+ */
+double MultiResolutionReader::ReadLoadImbalanceThreshold() const {
+  // Read the threshold and check on consistency
+  double const threshold(DoReadLoadImbalanceThreshold());
+  if (threshold != 0.0 && threshold < 1.0) {
+    throw std::invalid_argument("Load imbalance threshold must be zero "
+                                "(inactive) or at least one!");
+  }
+  return threshold;
+}
+
+/**
+ * @brief Gives the space-filling curve along which the leaves are distributed
+ * onto the ranks.
+ * @return The curve, the compiled default if none is given.
+ */
+SpaceFillingCurve MultiResolutionReader::ReadSpaceFillingCurve() const {
+  std::string const curve(DoReadSpaceFillingCurve());
+  if (curve.empty()) {
+    return SpaceFillingCurveSettings::DefaultSpaceFillingCurve;
+  }
+  return StringToSpaceFillingCurve(curve);
+}
+
+/**
+ * @brief Gives the protocol the halos are exchanged with between ranks.
+ * @return The halo exchange, two-sided if none is given.
+ */
+HaloExchange MultiResolutionReader::ReadHaloExchange() const {
+  std::string const exchange(DoReadHaloExchange());
+  if (exchange.empty()) {
+    return HaloExchange::TwoSided;
+  }
+  return StringToHaloExchange(exchange);
+}
+
+/**
+ * @brief Gives the memory budget of each rank, which limits the refinement.
+ * @return The budget in megabytes, zero if the refinement is not limited.
+ */
+double MultiResolutionReader::ReadMemoryBudget() const {
+  double const budget(DoReadMemoryBudget());
+  if (budget < 0.0) {
+    throw std::invalid_argument("Memory budget must be zero (inactive) or "
+                                "positive!");
+  }
+  return budget;
+}
+
+/**
+ * @brief Gives the maximum level of the single-phase refinement at the start of
+ * the run ( grid sequencing ).
+ * @return The start level, the maximum level if the run is not sequenced.
+ */
+unsigned int MultiResolutionReader::ReadGridSequencingStartLevel() const {
+  int const start_level(DoReadGridSequencingStartLevel());
+  if (start_level < 0 || start_level > static_cast<int>(ReadMaximumLevel())) {
+    throw std::invalid_argument("Grid sequencing start level must be between "
+                                "zero and the maximum level!");
+  }
+  return static_cast<unsigned int>(start_level);
+}
+
+/**
+ * @brief Gives the times at which the maximum level of the single-phase
+ * refinement is raised by one during grid sequencing.
+ * @return The sorted time stamps, empty if none are given.
+ */
+std::vector<double>
+MultiResolutionReader::ReadGridSequencingTimeStamps() const {
+  std::vector<double> time_stamps(DoReadGridSequencingTimeStamps());
+  if (std::any_of(time_stamps.begin(), time_stamps.end(),
+                  [](double const timestamp) { return timestamp < 0.0; })) {
+    throw std::invalid_argument(
+        "All time stamps for the grid sequencing must be positive or zero!");
+  }
+  std::sort(time_stamps.begin(), time_stamps.end());
+  return time_stamps;
+}
+
+/**
+ * @brief Gives the relative change of the kinetic energy per macro timestep
+ * below which the flow is considered converged and the maximum level of the
+ * single-phase refinement is raised by one during grid sequencing.
+ * @return The tolerance, zero if the criterion is inactive.
+ */
+double MultiResolutionReader::ReadGridSequencingTolerance() const {
+  double const tolerance(DoReadGridSequencingTolerance());
+  if (tolerance < 0.0) {
+    throw std::invalid_argument("Grid sequencing tolerance must be zero "
+                                "(inactive) or positive!");
+  }
+  return tolerance;
+}
+
+/**
+ * @brief Gives the number of regions bounding the levels of the single-phase
+ * refinement.
+ * @return The number of regions, zero if none are given.
+ */
+unsigned int MultiResolutionReader::ReadNumberOfRefinementRegions() const {
+  return static_cast<unsigned int>(DoReadNumberOfRefinementRegions());
+}
+
+/**
+ * @brief Gives the checked bounding box of a refinement region.
+ * @param region_index The zero-based index of the region.
+ * @return xMin, xMax, yMin, yMax, zMin and zMax of the box, unbounded in
+ * directions that are not given.
+ */
+std::array<double, 6> MultiResolutionReader::ReadRefinementRegionBoundingBox(
+    unsigned int const region_index) const {
+  std::array<double, 6> const bounding_box(
+      DoReadRefinementRegionBoundingBox(region_index));
+  for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+    if (bounding_box[2 * d] >= bounding_box[2 * d + 1]) {
+      throw std::invalid_argument("The bounding box of refinement region " +
+                                  std::to_string(region_index + 1) +
+                                  " must be larger than zero!");
+    }
+  }
+  return bounding_box;
+}
+
+/**
+ * @brief Gives the expression of a refinement region.
+ * @param region_index The zero-based index of the region.
+ * @return The expression defining the variable "inside", empty if the region
+ * is the bounding box itself.
+ */
+std::string MultiResolutionReader::ReadRefinementRegionExpression(
+    unsigned int const region_index) const {
+  return DoReadRefinementRegionExpression(region_index);
+}
+
+/**
+ * @brief Gives the checked levels the single-phase refinement is bounded to in
+ * a refinement region.
+ * @param region_index The zero-based index of the region.
+ * @return The minimum and the maximum level of the region.
+ */
+std::array<unsigned int, 2> MultiResolutionReader::ReadRefinementRegionLevels(
+    unsigned int const region_index) const {
+  int const minimum_level(DoReadRefinementRegionMinimumLevel(region_index));
+  int const maximum_level(DoReadRefinementRegionMaximumLevel(region_index));
+  if (minimum_level < 0 || minimum_level > maximum_level ||
+      maximum_level > static_cast<int>(ReadMaximumLevel())) {
+    throw std::invalid_argument(
+        "The levels of refinement region " + std::to_string(region_index + 1) +
+        " must satisfy 0 <= minimum level <= maximum level <= maximum level "
+        "of the simulation!");
+  }
+  return {static_cast<unsigned int>(minimum_level),
+          static_cast<unsigned int>(maximum_level)};
+}
@@ -23,7 +23,10 @@
 #define MULTI_RESOLUTION_READER_H
 
 #include "enums/direction_definition.h"
+#include "enums/halo_exchange.h"
+#include "user_specifications/space_filling_curve_settings.h"
 #include <array>
+#include <string>
 #include <vector>
 
 /**
@@ -44,6 +47,22 @@ protected:
   virtual int DoReadMaximumLevel() const = 0;
   virtual double DoReadEpsilonReference() const = 0;
   virtual int DoReadEpsilonLevelReference() const = 0;
+  virtual double DoReadLoadImbalanceThreshold() const = 0;
+  virtual std::string DoReadSpaceFillingCurve() const = 0;
+  virtual std::string DoReadHaloExchange() const = 0;
+  virtual double DoReadMemoryBudget() const = 0;
+  virtual int DoReadGridSequencingStartLevel() const = 0;
+  virtual std::vector<double> DoReadGridSequencingTimeStamps() const = 0;
+  virtual double DoReadGridSequencingTolerance() const = 0;
+  virtual int DoReadNumberOfRefinementRegions() const = 0;
+  virtual std::array<double, 6>
+  DoReadRefinementRegionBoundingBox(unsigned int const region_index) const = 0;
+  virtual std::string
+  DoReadRefinementRegionExpression(unsigned int const region_index) const = 0;
+  virtual int
+  DoReadRefinementRegionMinimumLevel(unsigned int const region_index) const = 0;
+  virtual int
+  DoReadRefinementRegionMaximumLevel(unsigned int const region_index) const = 0;
 
 public:
   virtual ~MultiResolutionReader() = default;
@@ -58,6 +77,20 @@ public:
   TEST_VIRTUAL unsigned int ReadMaximumLevel() const;
   TEST_VIRTUAL double ReadEpsilonReference() const;
   TEST_VIRTUAL unsigned int ReadEpsilonLevelReference() const;
+  TEST_VIRTUAL double ReadLoadImbalanceThreshold() const;
+  TEST_VIRTUAL SpaceFillingCurve ReadSpaceFillingCurve() const;
+  TEST_VIRTUAL HaloExchange ReadHaloExchange() const;
+  TEST_VIRTUAL double ReadMemoryBudget() const;
+  TEST_VIRTUAL unsigned int ReadGridSequencingStartLevel() const;
+  TEST_VIRTUAL std::vector<double> ReadGridSequencingTimeStamps() const;
+  TEST_VIRTUAL double ReadGridSequencingTolerance() const;
+  TEST_VIRTUAL unsigned int ReadNumberOfRefinementRegions() const;
+  TEST_VIRTUAL std::array<double, 6>
+  ReadRefinementRegionBoundingBox(unsigned int const region_index) const;
+  TEST_VIRTUAL std::string
+  ReadRefinementRegionExpression(unsigned int const region_index) const;
+  TEST_VIRTUAL std::array<unsigned int, 2>
+  ReadRefinementRegionLevels(unsigned int const region_index) const;
 };
 
 #endif // MULTI_RESOLUTION_READER_H
@@ -21,6 +21,8 @@
 //===----------------------------------------------------------------------===//
 #include "input_output/input_reader/multi_resolution_reader/xml_multi_resolution_reader.h"
 
+#include <limits>
+
 #include "input_output/utilities/xml_utilities.h"
 #include "user_specifications/compile_time_constants.h"
 
@@ -92,3 +94,217 @@ double XmlMultiResolutionReader::DoReadEpsilonReference() const {
                          "refinementCriterion", "epsilonReference"});
   return XmlUtilities::ReadDouble(epsilon_node);
 }
+
+/**
+ * @brief See base class definition.
+ * @note The threshold is optional, its absence deactivates the trigger.
+ */
+double XmlMultiResolutionReader::DoReadLoadImbalanceThreshold() const {
+  if (XmlUtilities::ChildExists(*xml_input_file_,
+                                {"configuration", "multiResolution",
+                                 "loadBalancing", "imbalanceThreshold"})) {
+    // Obtain correct node
+    tinyxml2::XMLElement const *threshold_node = XmlUtilities::GetChild(
+        *xml_input_file_, {"configuration", "multiResolution", "loadBalancing",
+                           "imbalanceThreshold"});
+    return XmlUtilities::ReadDouble(threshold_node);
+  } else {
+    return 0.0;
+  }
+}
+
+/**
+ * @brief See base class definition.
+ * @note The curve is optional, an empty string is returned in its absence.
+ */
+std::string XmlMultiResolutionReader::DoReadSpaceFillingCurve() const {
+  if (XmlUtilities::ChildExists(*xml_input_file_,
+                                {"configuration", "multiResolution",
+                                 "loadBalancing", "spaceFillingCurve"})) {
+    // Obtain correct node
+    tinyxml2::XMLElement const *curve_node = XmlUtilities::GetChild(
+        *xml_input_file_, {"configuration", "multiResolution", "loadBalancing",
+                           "spaceFillingCurve"});
+    return XmlUtilities::ReadString(curve_node);
+  } else {
+    return "";
+  }
+}
+
+/**
+ * @brief See base class definition.
+ * @note The halo exchange is optional, an empty string is returned in its
+ * absence.
+ */
+std::string XmlMultiResolutionReader::DoReadHaloExchange() const {
+  if (XmlUtilities::ChildExists(
+          *xml_input_file_,
+          {"configuration", "multiResolution", "haloExchange"})) {
+    // Obtain correct node
+    tinyxml2::XMLElement const *exchange_node = XmlUtilities::GetChild(
+        *xml_input_file_, {"configuration", "multiResolution", "haloExchange"});
+    return XmlUtilities::ReadString(exchange_node);
+  } else {
+    return "";
+  }
+}
+
+/**
+ * @brief See base class definition.
+ * @note The memory budget is optional, by default the refinement is not
+ * limited.
+ */
+double XmlMultiResolutionReader::DoReadMemoryBudget() const {
+  std::vector<std::string> const path = {"configuration", "multiResolution",
+                                         "memoryBudget"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadDouble(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : 0.0;
+}
+
+/**
+ * @brief See base class definition.
+ * @note Grid sequencing is optional, without it the run starts on the maximum
+ * level.
+ */
+int XmlMultiResolutionReader::DoReadGridSequencingStartLevel() const {
+  std::vector<std::string> const path = {"configuration", "multiResolution",
+                                         "gridSequencing", "startLevel"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadInt(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : DoReadMaximumLevel();
+}
+
+/**
+ * @brief See base class definition.
+ * @note The time stamps are optional, an empty list is returned in their
+ * absence.
+ */
+std::vector<double>
+XmlMultiResolutionReader::DoReadGridSequencingTimeStamps() const {
+  std::vector<std::string> const path = {"configuration", "multiResolution",
+                                         "gridSequencing", "stamps"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadTimeStamps(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : std::vector<double>();
+}
+
+/**
+ * @brief See base class definition.
+ * @note The tolerance is optional, by default the convergence criterion is
+ * inactive.
+ */
+double XmlMultiResolutionReader::DoReadGridSequencingTolerance() const {
+  std::vector<std::string> const path = {"configuration", "multiResolution",
+                                         "gridSequencing", "tolerance"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadDouble(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : 0.0;
+}
+
+/**
+ * @brief Gives the xml node of a refinement region.
+ * @param region_index The zero-based index of the region.
+ * @return The node.
+ */
+tinyxml2::XMLElement const *XmlMultiResolutionReader::RefinementRegionNode(
+    unsigned int const region_index) const {
+  std::vector<tinyxml2::XMLElement const *> const region_nodes =
+      XmlUtilities::GetChilds(
+          XmlUtilities::GetChild(*xml_input_file_,
+                                 {"configuration", "multiResolution"}),
+          "refinementRegion");
+  if (region_index >= region_nodes.size()) {
+    throw std::logic_error("Refinement region " +
+                           std::to_string(region_index + 1) +
+                           " does not exist!");
+  }
+  return region_nodes[region_index];
+}
+
+/**
+ * @brief See base class definition.
+ * @note The regions are optional, zero is returned in their absence.
+ */
+int XmlMultiResolutionReader::DoReadNumberOfRefinementRegions() const {
+  std::vector<std::string> const path = {"configuration", "multiResolution"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? static_cast<int>(
+                   XmlUtilities::GetChilds(
+                       XmlUtilities::GetChild(*xml_input_file_, path),
+                       "refinementRegion")
+                       .size())
+             : 0;
+}
+
+/**
+ * @brief See base class definition.
+ * @note All bounds are optional, missing ones do not bound the region.
+ */
+std::array<double, 6>
+XmlMultiResolutionReader::DoReadRefinementRegionBoundingBox(
+    unsigned int const region_index) const {
+  tinyxml2::XMLElement const *region_node = RefinementRegionNode(region_index);
+  std::array<double, 6> bounding_box = {std::numeric_limits<double>::lowest(),
+                                        std::numeric_limits<double>::max(),
+                                        std::numeric_limits<double>::lowest(),
+                                        std::numeric_limits<double>::max(),
+                                        std::numeric_limits<double>::lowest(),
+                                        std::numeric_limits<double>::max()};
+  std::vector<std::string> const coordinates = {"x", "y", "z"};
+  for (unsigned int dim = 0; dim < DTI(CC::DIM()); dim++) {
+    for (unsigned int bound = 0; bound < 2; ++bound) {
+      std::string const name = coordinates[dim] + (bound == 0 ? "Min" : "Max");
+      if (XmlUtilities::ChildExists(region_node, name)) {
+        bounding_box[2 * dim + bound] = XmlUtilities::ReadDouble(
+            XmlUtilities::GetChild(region_node, {name}));
+      }
+    }
+  }
+  return bounding_box;
+}
+
+/**
+ * @brief See base class definition.
+ * @note The expression is optional, an empty string is returned in its
+ * absence.
+ */
+std::string XmlMultiResolutionReader::DoReadRefinementRegionExpression(
+    unsigned int const region_index) const {
+  tinyxml2::XMLElement const *region_node = RefinementRegionNode(region_index);
+  return XmlUtilities::ChildExists(region_node, "expression")
+             ? XmlUtilities::ReadString(
+                   XmlUtilities::GetChild(region_node, {"expression"}))
+             : "";
+}
+
+/**
+ * @brief See base class definition.
+ * @note The minimum level is optional, by default it is zero.
+ */
+int XmlMultiResolutionReader::DoReadRefinementRegionMinimumLevel(
+    unsigned int const region_index) const {
+  tinyxml2::XMLElement const *region_node = RefinementRegionNode(region_index);
+  return XmlUtilities::ChildExists(region_node, "minimumLevel")
+             ? XmlUtilities::ReadInt(
+                   XmlUtilities::GetChild(region_node, {"minimumLevel"}))
+             : 0;
+}
+
+/**
+ * @brief See base class definition.
+ * @note The maximum level is optional, by default it is the maximum level of
+ * the simulation.
+ */
+int XmlMultiResolutionReader::DoReadRefinementRegionMaximumLevel(
+    unsigned int const region_index) const {
+  tinyxml2::XMLElement const *region_node = RefinementRegionNode(region_index);
+  return XmlUtilities::ChildExists(region_node, "maximumLevel")
+             ? XmlUtilities::ReadInt(
+                   XmlUtilities::GetChild(region_node, {"maximumLevel"}))
+             : DoReadMaximumLevel();
+}
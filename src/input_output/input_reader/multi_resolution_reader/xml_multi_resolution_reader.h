@@ -45,6 +45,24 @@ class XmlMultiResolutionReader : public MultiResolutionReader {
   int DoReadMaximumLevel() const override;
   double DoReadEpsilonReference() const override;
   int DoReadEpsilonLevelReference() const override;
+  double DoReadLoadImbalanceThreshold() const override;
+  std::string DoReadSpaceFillingCurve() const override;
+  std::string DoReadHaloExchange() const override;
+  double DoReadMemoryBudget() const override;
+  int DoReadGridSequencingStartLevel() const override;
+  std::vector<double> DoReadGridSequencingTimeStamps() const override;
+  double DoReadGridSequencingTolerance() const override;
+  int DoReadNumberOfRefinementRegions() const override;
+  std::array<double, 6> DoReadRefinementRegionBoundingBox(
+      unsigned int const region_index) const override;
+  std::string DoReadRefinementRegionExpression(
+      unsigned int const region_index) const override;
+  int DoReadRefinementRegionMinimumLevel(
+      unsigned int const region_index) const override;
+  int DoReadRefinementRegionMaximumLevel(
+      unsigned int const region_index) const override;
+  tinyxml2::XMLElement const *
+  RefinementRegionNode(unsigned int const region_index) const;
 
 public:
   XmlMultiResolutionReader() = delete;
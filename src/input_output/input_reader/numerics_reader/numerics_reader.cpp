@@ -0,0 +1,38 @@
+//===------------------------ numerics_reader.cpp -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/input_reader/numerics_reader/numerics_reader.h"
+
+#include "stencils/spatial_reconstruction_stencils/reconstruction_stencil_setup.h"
+
+/**
+ * @brief Gives the reconstruction stencil of the convective fluxes.
+ * @return The stencil given in the input, the compiled default
+ * (reconstruction_stencil) if none is given.
+ * @note Throws if the stencil name is not known. Whether the stencil is
+ * compiled is checked by the convective term solver.
+ */
+ReconstructionStencils NumericsReader::ReadReconstructionStencil() const {
+  std::string const stencil_name(DoReadReconstructionStencil());
+  return stencil_name.empty()
+             ? reconstruction_stencil
+             : ReconstructionStencilSetup::StringToStencil(stencil_name);
+}
@@ -0,0 +1,55 @@
+//===------------------------- numerics_reader.h --------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef NUMERICS_READER_H
+#define NUMERICS_READER_H
+
+#include <string>
+
+#include "user_specifications/stencil_setup.h"
+
+/**
+ * @brief Defines the class that provides access to the numerical methods
+ * selected in the input file among the compiled ones. It serves as a proxy
+ * class for different numerics reader types (xml,...) that only read the actual
+ * data. Here, consistency checks are done that all read data are valid.
+ */
+class NumericsReader {
+
+protected:
+  // Functions that must be implemented by the derived classes
+  virtual std::string DoReadReconstructionStencil() const = 0;
+
+  // constructor can only be called from derived classes
+  explicit NumericsReader() = default;
+
+public:
+  virtual ~NumericsReader() = default;
+  NumericsReader(NumericsReader const &) = default;
+  NumericsReader &operator=(NumericsReader const &) = delete;
+  NumericsReader(NumericsReader &&) = default;
+  NumericsReader &operator=(NumericsReader &&) = delete;
+
+  // Return functions with prepreparation of the data
+  TEST_VIRTUAL ReconstructionStencils ReadReconstructionStencil() const;
+};
+
+#endif // NUMERICS_READER_H
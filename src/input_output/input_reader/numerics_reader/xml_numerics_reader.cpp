@@ -0,0 +1,49 @@
+//===---------------------- xml_numerics_reader.cpp -----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/input_reader/numerics_reader/xml_numerics_reader.h"
+
+#include "input_output/utilities/xml_utilities.h"
+
+/**
+ * @brief Default constructor for the numerics reader for xml-type input files.
+ * @param inputfile The xml input file document holding all information of the
+ * user inputs (shared pointer to provide document for different readers).
+ */
+XmlNumericsReader::XmlNumericsReader(
+    std::shared_ptr<tinyxml2::XMLDocument> inputfile)
+    : NumericsReader(), xml_input_file_(std::move(inputfile)) {
+  /** Empty besides initializer list and base class constructor call */
+}
+
+/**
+ * @brief See base class definition.
+ * @note The whole numerics section is optional, an empty name is returned if
+ * the stencil is not given.
+ */
+std::string XmlNumericsReader::DoReadReconstructionStencil() const {
+  std::vector<std::string> const path = {"configuration", "numerics",
+                                         "reconstructionStencil"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadString(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : "";
+}
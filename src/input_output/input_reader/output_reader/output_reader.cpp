@@ -23,6 +23,9 @@
 
 #include <algorithm>
 
+#include "input_output/adios2/adios2_manager.h"
+#include "user_specifications/compile_time_constants.h"
+
 /**
  * @brief Gives the checked time naming factor used for naming the output files.
  * @return factor used for the naming.
@@ -86,3 +89,240 @@ OutputReader::ReadOutputTimeStamps(OutputType const output_type) const {
 
   return time_stamps;
 }
+
+/**
+ * @brief Gives the checked compression used for the datasets of an output
+ * quantity.
+ * @param quantity_name Name of the output quantity.
+ * @return Compression filter and its parameters.
+ */
+OutputCompression
+OutputReader::ReadOutputCompression(std::string const &quantity_name) const {
+  OutputCompression compression;
+  compression.type_ =
+      StringToOutputCompressionType(DoReadCompressionType(quantity_name));
+  if (compression.type_ == OutputCompressionType::Deflate) {
+    compression.deflate_level_ = DoReadDeflateLevel(quantity_name);
+    if (compression.deflate_level_ < 1 || compression.deflate_level_ > 9) {
+      throw std::invalid_argument("Deflate level of the output quantity '" +
+                                  quantity_name + "' must be in [1,9]!");
+    }
+  } else if (compression.type_ == OutputCompressionType::Zfp) {
+    compression.error_bound_ = DoReadCompressionErrorBound(quantity_name);
+    if (compression.error_bound_ <= 0.0) {
+      throw std::invalid_argument("Error bound of the output quantity '" +
+                                  quantity_name +
+                                  "' must be larger than zero!");
+    }
+  }
+  return compression;
+}
+
+/**
+ * @brief Gives the precision used for the datasets of an output quantity.
+ * @param quantity_name Name of the output quantity.
+ * @return Output precision.
+ */
+OutputPrecision
+OutputReader::ReadOutputPrecision(std::string const &quantity_name) const {
+  return StringToOutputPrecision(DoReadOutputPrecision(quantity_name));
+}
+
+/**
+ * @brief Gives the finest level that is written in the monitoring output.
+ * @return Maximum level of the monitoring output.
+ */
+unsigned int OutputReader::ReadMonitoringMaximumLevel() const {
+  return DoReadMonitoringMaximumLevel();
+}
+
+/**
+ * @brief Gives the checked region written in the monitoring output.
+ * @return Lower and upper bound of the region in each direction.
+ */
+std::array<std::array<double, 2>, 3>
+OutputReader::ReadMonitoringRegion() const {
+  std::array<std::array<double, 2>, 3> const region(DoReadMonitoringRegion());
+  if (std::any_of(region.begin(), region.end(),
+                  [](std::array<double, 2> const &bounds) {
+                    return bounds[0] > bounds[1];
+                  })) {
+    throw std::invalid_argument("Lower bounds of the monitoring region must "
+                                "not be larger than its upper bounds!");
+  }
+  return region;
+}
+
+/**
+ * @brief Gives the number of macro time steps between two evaluations of the
+ * in-situ analysis.
+ * @return Interval of the in-situ analysis (zero if it is not used).
+ */
+unsigned int OutputReader::ReadInSituInterval() const {
+  return DoReadInSituInterval();
+}
+
+/**
+ * @brief Gives the checked reductions evaluated in the in-situ analysis.
+ * @return Reductions in the order of the input file.
+ */
+std::vector<InSituReduction> OutputReader::ReadInSituReductions() const {
+  std::vector<InSituReduction> reductions;
+  for (auto const &[quantity_name, component, operation] :
+       DoReadInSituReductions()) {
+    if (quantity_name.empty()) {
+      throw std::invalid_argument(
+          "Quantity of an in-situ reduction must not be empty!");
+    }
+    reductions.push_back(
+        {quantity_name, component, StringToInSituOperation(operation)});
+  }
+  return reductions;
+}
+
+/**
+ * @brief Gives the checked probes recorded in the in-situ analysis. Line
+ * probes are expanded into equidistant point probes including both end points.
+ * @return Point probes in the order of the input file.
+ */
+std::vector<InSituProbe> OutputReader::ReadInSituProbes() const {
+  std::vector<InSituProbe> probes;
+  for (auto const &[quantity_name, component, start, end, number_of_points] :
+       DoReadInSituProbes()) {
+    if (quantity_name.empty()) {
+      throw std::invalid_argument(
+          "Quantity of an in-situ probe must not be empty!");
+    }
+    if (number_of_points == 0) {
+      throw std::invalid_argument(
+          "Number of points of an in-situ line probe must be larger than "
+          "zero!");
+    }
+    for (unsigned int point = 0; point < number_of_points; ++point) {
+      double const fraction = number_of_points > 1
+                                  ? double(point) / double(number_of_points - 1)
+                                  : 0.0;
+      InSituProbe probe{quantity_name, component, start};
+      for (unsigned int d = 0; d < 3; ++d) {
+        probe.point_[d] += fraction * (end[d] - start[d]);
+      }
+      probes.push_back(probe);
+    }
+  }
+  return probes;
+}
+
+/**
+ * @brief Gives the checked slices resampled in the in-situ analysis.
+ * @return Slices in the order of the input file.
+ */
+std::vector<InSituSlice> OutputReader::ReadInSituSlices() const {
+  std::vector<InSituSlice> slices;
+  for (auto const &[quantity_name, component, axes, point, level, image] :
+       DoReadInSituSlices()) {
+    if (quantity_name.empty()) {
+      throw std::invalid_argument(
+          "Quantity of an in-situ slice must not be empty!");
+    }
+    if (axes.empty() || axes.size() > 2) {
+      throw std::invalid_argument(
+          "An in-situ slice must span one (line) or two (plane) axes!");
+    }
+    InSituSlice slice{quantity_name, component, {false, false, false},
+                      point,         level,     image};
+    std::string const axis_names = "xyz";
+    for (char const axis : axes) {
+      std::size_t const d = axis_names.find(axis);
+      if (d >= DTI(CC::DIM()) || slice.spanned_axes_[d]) {
+        throw std::invalid_argument("Axes '" + axes +
+                                    "' of an in-situ slice are not valid!");
+      }
+      slice.spanned_axes_[d] = true;
+    }
+    slices.push_back(slice);
+  }
+  return slices;
+}
+
+/**
+ * @brief Indicates whether the full output is written before the first time
+ * step.
+ * @return True if the initial output is written, false otherwise.
+ */
+bool OutputReader::ReadInitialOutput() const { return DoReadInitialOutput(); }
+
+/**
+ * @brief Indicates whether the runtime profiler is enabled.
+ * @return True if the profiler is enabled, false otherwise.
+ */
+bool OutputReader::ReadProfilingActive() const {
+  return DoReadProfilingActive();
+}
+
+/**
+ * @brief Gives the number of macro time steps between two intermediate
+ * summaries of the runtime profiler.
+ * @return Interval of the summaries (zero if only summarized at the end).
+ */
+unsigned int OutputReader::ReadProfilingInterval() const {
+  return DoReadProfilingInterval();
+}
+
+/**
+ * @brief Indicates whether the timeline of the runtime profiler is recorded.
+ * @return True if a trace is written, false otherwise.
+ */
+bool OutputReader::ReadProfilingTrace() const { return DoReadProfilingTrace(); }
+
+/**
+ * @brief Indicates whether hardware counters are collected by the runtime
+ * profiler.
+ * @return True if hardware counters are collected, false otherwise.
+ */
+bool OutputReader::ReadProfilingCounters() const {
+  return DoReadProfilingCounters();
+}
+
+/**
+ * @brief Gives the raw processor events counting floating-point instructions.
+ * @return The event codes and the number of operations per counted
+ * instruction.
+ * @note Throws if a weight is not positive.
+ */
+std::vector<std::pair<std::uint64_t, double>>
+OutputReader::ReadProfilingFlopEvents() const {
+  std::vector<std::pair<std::uint64_t, double>> const flop_events =
+      DoReadProfilingFlopEvents();
+  for (auto const &flop_event : flop_events) {
+    if (flop_event.second <= 0.0) {
+      throw std::invalid_argument(
+          "The weight of a floating-point event must be positive!");
+    }
+  }
+  return flop_events;
+}
+
+/**
+ * @brief Gives the backend the field outputs are written with.
+ * @return Output backend.
+ * @note Throws if ADIOS2 is selected in a build without ADIOS2.
+ */
+OutputBackend OutputReader::ReadOutputBackend() const {
+  OutputBackend const backend = StringToOutputBackend(DoReadOutputBackend());
+  if (backend == OutputBackend::Adios2 && !Adios2Manager::IsAvailable()) {
+    throw std::invalid_argument(
+        "The ADIOS2 output backend requires a build with ADIOS2!");
+  }
+  return backend;
+}
+
+/**
+ * @brief Gives the engine and the aggregation of the ADIOS2 output backend.
+ * @return ADIOS2 settings.
+ */
+Adios2Settings OutputReader::ReadAdios2Settings() const {
+  Adios2Settings settings;
+  settings.engine_ = StringToAdios2Engine(DoReadAdios2Engine());
+  settings.aggregators_ = DoReadAdios2Aggregators();
+  return settings;
+}
@@ -22,7 +22,11 @@
 #ifndef OUTPUT_READER_H
 #define OUTPUT_READER_H
 
+#include <array>
+#include <cstdint>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "input_output/output_writer/output_definitions.h"
@@ -46,6 +50,37 @@ protected:
   virtual double DoReadOutputInterval(OutputType const output_type) const = 0;
   virtual std::vector<double>
   DoReadOutputTimeStamps(OutputType const output_type) const = 0;
+  virtual std::string
+  DoReadCompressionType(std::string const &quantity_name) const = 0;
+  virtual unsigned int
+  DoReadDeflateLevel(std::string const &quantity_name) const = 0;
+  virtual double
+  DoReadCompressionErrorBound(std::string const &quantity_name) const = 0;
+  virtual std::string
+  DoReadOutputPrecision(std::string const &quantity_name) const = 0;
+  virtual unsigned int DoReadMonitoringMaximumLevel() const = 0;
+  virtual std::array<std::array<double, 2>, 3>
+  DoReadMonitoringRegion() const = 0;
+  virtual unsigned int DoReadInSituInterval() const = 0;
+  virtual std::vector<std::tuple<std::string, unsigned int, std::string>>
+  DoReadInSituReductions() const = 0;
+  virtual std::vector<
+      std::tuple<std::string, unsigned int, std::array<double, 3>,
+                 std::array<double, 3>, unsigned int>>
+  DoReadInSituProbes() const = 0;
+  virtual std::vector<std::tuple<std::string, unsigned int, std::string,
+                                 std::array<double, 3>, unsigned int, bool>>
+  DoReadInSituSlices() const = 0;
+  virtual bool DoReadInitialOutput() const = 0;
+  virtual bool DoReadProfilingActive() const = 0;
+  virtual unsigned int DoReadProfilingInterval() const = 0;
+  virtual bool DoReadProfilingTrace() const = 0;
+  virtual bool DoReadProfilingCounters() const = 0;
+  virtual std::vector<std::pair<std::uint64_t, double>>
+  DoReadProfilingFlopEvents() const = 0;
+  virtual std::string DoReadOutputBackend() const = 0;
+  virtual std::string DoReadAdios2Engine() const = 0;
+  virtual unsigned int DoReadAdios2Aggregators() const = 0;
 
 public:
   virtual ~OutputReader() = default;
@@ -60,6 +95,26 @@ public:
   ReadOutputTimesType(OutputType const output_type) const;
   TEST_VIRTUAL double ReadOutputInterval(OutputType const output_type) const;
   std::vector<double> ReadOutputTimeStamps(OutputType const output_type) const;
+  TEST_VIRTUAL OutputCompression
+  ReadOutputCompression(std::string const &quantity_name) const;
+  TEST_VIRTUAL OutputPrecision
+  ReadOutputPrecision(std::string const &quantity_name) const;
+  TEST_VIRTUAL unsigned int ReadMonitoringMaximumLevel() const;
+  TEST_VIRTUAL std::array<std::array<double, 2>, 3>
+  ReadMonitoringRegion() const;
+  TEST_VIRTUAL unsigned int ReadInSituInterval() const;
+  TEST_VIRTUAL std::vector<InSituReduction> ReadInSituReductions() const;
+  TEST_VIRTUAL std::vector<InSituProbe> ReadInSituProbes() const;
+  TEST_VIRTUAL std::vector<InSituSlice> ReadInSituSlices() const;
+  TEST_VIRTUAL bool ReadInitialOutput() const;
+  TEST_VIRTUAL bool ReadProfilingActive() const;
+  TEST_VIRTUAL unsigned int ReadProfilingInterval() const;
+  TEST_VIRTUAL bool ReadProfilingTrace() const;
+  TEST_VIRTUAL bool ReadProfilingCounters() const;
+  TEST_VIRTUAL std::vector<std::pair<std::uint64_t, double>>
+  ReadProfilingFlopEvents() const;
+  TEST_VIRTUAL OutputBackend ReadOutputBackend() const;
+  TEST_VIRTUAL Adios2Settings ReadAdios2Settings() const;
 };
 
 #endif // OUTPUT_READER_H
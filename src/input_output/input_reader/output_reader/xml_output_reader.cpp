@@ -22,6 +22,47 @@
 #include "input_output/input_reader/output_reader/xml_output_reader.h"
 
 #include "input_output/utilities/xml_utilities.h"
+#include <limits>
+
+namespace {
+/**
+ * @brief Gives the tag of the given output type in the output tag (the debug
+ * output uses the settings of the standard output).
+ * @param output_type The output type.
+ * @return The tag of the output type.
+ */
+std::string OutputTag(OutputType const output_type) {
+  switch (output_type) {
+  case OutputType::Interface: {
+    return "interfaceOutput";
+  }
+  case OutputType::Monitoring: {
+    return "monitoringOutput";
+  }
+  default: {
+    return "standardOutput";
+  } // standard and debug output
+  }
+}
+
+/**
+ * @brief Gives the coordinates of a point given by x, y and z entries. Missing
+ * entries are set to zero (e.g., z for two-dimensional simulations).
+ * @param parent_node Node holding the coordinates.
+ * @return The coordinates.
+ */
+std::array<double, 3> ReadCoordinates(tinyxml2::XMLElement const *parent_node) {
+  std::array<std::string, 3> const coordinate_tags = {"x", "y", "z"};
+  std::array<double, 3> coordinates = {0.0, 0.0, 0.0};
+  for (unsigned int d = 0; d < 3; ++d) {
+    if (XmlUtilities::ChildExists(parent_node, coordinate_tags[d])) {
+      coordinates[d] = XmlUtilities::ReadDouble(
+          XmlUtilities::GetChild(parent_node, {coordinate_tags[d]}));
+    }
+  }
+  return coordinates;
+}
+} // namespace
 
 /**
  * @brief Default constructor for the output reader for xml-type input files.
@@ -50,9 +91,13 @@ double XmlOutputReader::DoReadTimeNamingFactor() const {
 std::string
 XmlOutputReader::DoReadOutputTimesType(OutputType const output_type) const {
   // specify the correct tag for the given output type
-  std::string const output_tag = output_type == OutputType::Interface
-                                     ? "interfaceOutput"
-                                     : "standardOutput";
+  std::string const output_tag = OutputTag(output_type);
+  // The monitoring output is optional, its absence deactivates it
+  if (output_type == OutputType::Monitoring &&
+      !XmlUtilities::ChildExists(*xml_input_file_,
+                                 {"configuration", "output", output_tag})) {
+    return "Off";
+  }
   // Obtain correct nodes
   tinyxml2::XMLElement const *type_node = XmlUtilities::GetChild(
       *xml_input_file_, {"configuration", "output", output_tag, "type"});
@@ -66,9 +111,7 @@ XmlOutputReader::DoReadOutputTimesType(OutputType const output_type) const {
 double
 XmlOutputReader::DoReadOutputInterval(OutputType const output_type) const {
   // specify the correct tag for the given output type
-  std::string const output_tag = output_type == OutputType::Interface
-                                     ? "interfaceOutput"
-                                     : "standardOutput";
+  std::string const output_tag = OutputTag(output_type);
   // Obtain correct node
   tinyxml2::XMLElement const *interval_node = XmlUtilities::GetChild(
       *xml_input_file_, {"configuration", "output", output_tag, "interval"});
@@ -82,12 +125,366 @@ XmlOutputReader::DoReadOutputInterval(OutputType const output_type) const {
 std::vector<double>
 XmlOutputReader::DoReadOutputTimeStamps(OutputType const output_type) const {
   // specify the correct tag for the given output type
-  std::string const output_tag = output_type == OutputType::Interface
-                                     ? "interfaceOutput"
-                                     : "standardOutput";
+  std::string const output_tag = OutputTag(output_type);
   // Obtain correct node
   tinyxml2::XMLElement const *stamp_node = XmlUtilities::GetChild(
       *xml_input_file_, {"configuration", "output", output_tag, "stamps"});
 
   return XmlUtilities::ReadTimeStamps(stamp_node);
 }
+
+/**
+ * @brief Gives the node of an entry of a per-quantity section (e.g.,
+ * compression). The entry of the quantity is used if present, otherwise the
+ * default entry given directly in the section tag.
+ * @param section_name Name of the section (tag) in the output tag.
+ * @param quantity_name Name of the output quantity.
+ * @param entry_name Name of the entry (tag).
+ * @return The node of the entry, nullptr if the entry is not given at all.
+ */
+tinyxml2::XMLElement const *
+XmlOutputReader::QuantityNode(std::string const &section_name,
+                              std::string const &quantity_name,
+                              std::string const &entry_name) const {
+  if (XmlUtilities::ChildExists(*xml_input_file_,
+                                {"configuration", "output", section_name,
+                                 quantity_name, entry_name})) {
+    return XmlUtilities::GetChild(
+        *xml_input_file_,
+        {"configuration", "output", section_name, quantity_name, entry_name});
+  } else if (XmlUtilities::ChildExists(
+                 *xml_input_file_,
+                 {"configuration", "output", section_name, entry_name})) {
+    return XmlUtilities::GetChild(*xml_input_file_, {"configuration", "output",
+                                                     section_name, entry_name});
+  } else {
+    return nullptr;
+  }
+}
+
+/**
+ * @brief See base class definition.
+ * @note The compression is optional, its absence deactivates it.
+ */
+std::string
+XmlOutputReader::DoReadCompressionType(std::string const &quantity_name) const {
+  tinyxml2::XMLElement const *filter_node =
+      QuantityNode("compression", quantity_name, "filter");
+  return filter_node != nullptr ? XmlUtilities::ReadString(filter_node) : "Off";
+}
+
+/**
+ * @brief See base class definition.
+ * @note The level is optional, the default is 4.
+ */
+unsigned int
+XmlOutputReader::DoReadDeflateLevel(std::string const &quantity_name) const {
+  tinyxml2::XMLElement const *level_node =
+      QuantityNode("compression", quantity_name, "level");
+  return level_node != nullptr ? XmlUtilities::ReadUnsignedInt(level_node) : 4;
+}
+
+/**
+ * @brief See base class definition.
+ * @note A missing error bound is returned as zero.
+ */
+double XmlOutputReader::DoReadCompressionErrorBound(
+    std::string const &quantity_name) const {
+  tinyxml2::XMLElement const *error_bound_node =
+      QuantityNode("compression", quantity_name, "errorBound");
+  return error_bound_node != nullptr
+             ? XmlUtilities::ReadDouble(error_bound_node)
+             : 0.0;
+}
+
+/**
+ * @brief See base class definition.
+ * @note The precision is optional, the default is double precision.
+ */
+std::string
+XmlOutputReader::DoReadOutputPrecision(std::string const &quantity_name) const {
+  tinyxml2::XMLElement const *type_node =
+      QuantityNode("precision", quantity_name, "type");
+  return type_node != nullptr ? XmlUtilities::ReadString(type_node) : "Double";
+}
+
+/**
+ * @brief See base class definition.
+ * @note The level is optional, by default all levels are written.
+ */
+unsigned int XmlOutputReader::DoReadMonitoringMaximumLevel() const {
+  std::vector<std::string> const path = {"configuration", "output",
+                                         "monitoringOutput", "maximumLevel"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadUnsignedInt(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : std::numeric_limits<unsigned int>::max();
+}
+
+/**
+ * @brief See base class definition.
+ * @note All bounds are optional, by default the region is not bounded.
+ */
+std::array<std::array<double, 2>, 3>
+XmlOutputReader::DoReadMonitoringRegion() const {
+  std::array<std::array<std::string, 2>, 3> const bound_tags = {
+      {{"xMin", "xMax"}, {"yMin", "yMax"}, {"zMin", "zMax"}}};
+  std::array<std::array<double, 2>, 3> region;
+  for (unsigned int d = 0; d < 3; ++d) {
+    region[d] = {std::numeric_limits<double>::lowest(),
+                 std::numeric_limits<double>::max()};
+    for (unsigned int bound = 0; bound < 2; ++bound) {
+      std::vector<std::string> const path = {"configuration", "output",
+                                             "monitoringOutput", "region",
+                                             bound_tags[d][bound]};
+      if (XmlUtilities::ChildExists(*xml_input_file_, path)) {
+        region[d][bound] = XmlUtilities::ReadDouble(
+            XmlUtilities::GetChild(*xml_input_file_, path));
+      }
+    }
+  }
+  return region;
+}
+
+/**
+ * @brief See base class definition.
+ * @note The in-situ analysis is optional, its absence deactivates it.
+ */
+unsigned int XmlOutputReader::DoReadInSituInterval() const {
+  std::vector<std::string> const path = {"configuration", "output",
+                                         "inSituAnalysis", "interval"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadUnsignedInt(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : 0;
+}
+
+/**
+ * @brief See base class definition.
+ * @note The component is optional, by default the first one is used.
+ */
+std::vector<std::tuple<std::string, unsigned int, std::string>>
+XmlOutputReader::DoReadInSituReductions() const {
+  std::vector<std::tuple<std::string, unsigned int, std::string>> reductions;
+  if (!XmlUtilities::ChildExists(
+          *xml_input_file_, {"configuration", "output", "inSituAnalysis"})) {
+    return reductions;
+  }
+  tinyxml2::XMLElement const *analysis_node = XmlUtilities::GetChild(
+      *xml_input_file_, {"configuration", "output", "inSituAnalysis"});
+  for (auto reduction_node :
+       XmlUtilities::GetChilds(analysis_node, "reduction")) {
+    std::string const quantity = XmlUtilities::ReadString(
+        XmlUtilities::GetChild(reduction_node, {"quantity"}));
+    unsigned int const component =
+        XmlUtilities::ChildExists(reduction_node, "component")
+            ? XmlUtilities::ReadUnsignedInt(
+                  XmlUtilities::GetChild(reduction_node, {"component"}))
+            : 0;
+    std::string const operation = XmlUtilities::ReadString(
+        XmlUtilities::GetChild(reduction_node, {"operation"}));
+    reductions.emplace_back(quantity, component, operation);
+  }
+  return reductions;
+}
+
+/**
+ * @brief See base class definition.
+ * @note Point probes (probe) are given as line probes with a single point. For
+ * line probes (lineProbe) the start, end and number of points are read. The
+ * component is optional, by default the first one is used.
+ */
+std::vector<std::tuple<std::string, unsigned int, std::array<double, 3>,
+                       std::array<double, 3>, unsigned int>>
+XmlOutputReader::DoReadInSituProbes() const {
+  std::vector<std::tuple<std::string, unsigned int, std::array<double, 3>,
+                         std::array<double, 3>, unsigned int>>
+      probes;
+  if (!XmlUtilities::ChildExists(
+          *xml_input_file_, {"configuration", "output", "inSituAnalysis"})) {
+    return probes;
+  }
+  tinyxml2::XMLElement const *analysis_node = XmlUtilities::GetChild(
+      *xml_input_file_, {"configuration", "output", "inSituAnalysis"});
+  for (std::string const probe_tag : {"probe", "lineProbe"}) {
+    for (auto probe_node : XmlUtilities::GetChilds(analysis_node, probe_tag)) {
+      std::string const quantity = XmlUtilities::ReadString(
+          XmlUtilities::GetChild(probe_node, {"quantity"}));
+      unsigned int const component =
+          XmlUtilities::ChildExists(probe_node, "component")
+              ? XmlUtilities::ReadUnsignedInt(
+                    XmlUtilities::GetChild(probe_node, {"component"}))
+              : 0;
+      if (probe_tag == "probe") {
+        std::array<double, 3> const point = ReadCoordinates(probe_node);
+        probes.emplace_back(quantity, component, point, point, 1);
+      } else {
+        probes.emplace_back(
+            quantity, component,
+            ReadCoordinates(XmlUtilities::GetChild(probe_node, {"start"})),
+            ReadCoordinates(XmlUtilities::GetChild(probe_node, {"end"})),
+            XmlUtilities::ReadUnsignedInt(
+                XmlUtilities::GetChild(probe_node, {"points"})));
+      }
+    }
+  }
+  return probes;
+}
+
+/**
+ * @brief See base class definition.
+ * @note The spanned axes are given as one string (e.g., xy for a plane, x for
+ * a line), the coordinates of the other axes by the x, y and z tags. The
+ * component and the level are optional (default zero), the image is written if
+ * the image tag is present.
+ */
+std::vector<std::tuple<std::string, unsigned int, std::string,
+                       std::array<double, 3>, unsigned int, bool>>
+XmlOutputReader::DoReadInSituSlices() const {
+  std::vector<std::tuple<std::string, unsigned int, std::string,
+                         std::array<double, 3>, unsigned int, bool>>
+      slices;
+  if (!XmlUtilities::ChildExists(
+          *xml_input_file_, {"configuration", "output", "inSituAnalysis"})) {
+    return slices;
+  }
+  tinyxml2::XMLElement const *analysis_node = XmlUtilities::GetChild(
+      *xml_input_file_, {"configuration", "output", "inSituAnalysis"});
+  for (auto slice_node : XmlUtilities::GetChilds(analysis_node, "slice")) {
+    std::string const quantity = XmlUtilities::ReadString(
+        XmlUtilities::GetChild(slice_node, {"quantity"}));
+    unsigned int const component =
+        XmlUtilities::ChildExists(slice_node, "component")
+            ? XmlUtilities::ReadUnsignedInt(
+                  XmlUtilities::GetChild(slice_node, {"component"}))
+            : 0;
+    std::string const axes =
+        XmlUtilities::ReadString(XmlUtilities::GetChild(slice_node, {"axes"}));
+    unsigned int const level =
+        XmlUtilities::ChildExists(slice_node, "level")
+            ? XmlUtilities::ReadUnsignedInt(
+                  XmlUtilities::GetChild(slice_node, {"level"}))
+            : 0;
+    slices.emplace_back(quantity, component, axes, ReadCoordinates(slice_node),
+                        level, XmlUtilities::ChildExists(slice_node, "image"));
+  }
+  return slices;
+}
+
+/**
+ * @brief See base class definition.
+ * @note The initial output is skipped by the presence of the skipInitialOutput
+ * tag.
+ */
+bool XmlOutputReader::DoReadInitialOutput() const {
+  return !XmlUtilities::ChildExists(
+      *xml_input_file_, {"configuration", "output", "skipInitialOutput"});
+}
+
+/**
+ * @brief See base class definition.
+ * @note The profiler is enabled by the presence of the profiling section.
+ */
+bool XmlOutputReader::DoReadProfilingActive() const {
+  return XmlUtilities::ChildExists(*xml_input_file_,
+                                   {"configuration", "output", "profiling"});
+}
+
+/**
+ * @brief See base class definition.
+ * @note The interval is optional, by default the profiler is only summarized at
+ * the end of the run.
+ */
+unsigned int XmlOutputReader::DoReadProfilingInterval() const {
+  std::vector<std::string> const path = {"configuration", "output", "profiling",
+                                         "interval"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadUnsignedInt(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : 0;
+}
+
+/**
+ * @brief See base class definition.
+ * @note The trace is enabled by the presence of the trace tag.
+ */
+bool XmlOutputReader::DoReadProfilingTrace() const {
+  return XmlUtilities::ChildExists(
+      *xml_input_file_, {"configuration", "output", "profiling", "trace"});
+}
+
+/**
+ * @brief See base class definition.
+ * @note The hardware counters are enabled by the presence of the counters tag.
+ */
+bool XmlOutputReader::DoReadProfilingCounters() const {
+  return XmlUtilities::ChildExists(
+      *xml_input_file_, {"configuration", "output", "profiling", "counters"});
+}
+
+/**
+ * @brief See base class definition.
+ * @note The event codes may be given in hexadecimal notation (0x prefix). The
+ * weight is optional, by default one operation per counted instruction.
+ */
+std::vector<std::pair<std::uint64_t, double>>
+XmlOutputReader::DoReadProfilingFlopEvents() const {
+  std::vector<std::pair<std::uint64_t, double>> flop_events;
+  std::vector<std::string> const path = {"configuration", "output", "profiling",
+                                         "counters"};
+  if (!XmlUtilities::ChildExists(*xml_input_file_, path)) {
+    return flop_events;
+  }
+  tinyxml2::XMLElement const *counters_node =
+      XmlUtilities::GetChild(*xml_input_file_, path);
+  for (auto event_node : XmlUtilities::GetChilds(counters_node, "flopEvent")) {
+    std::uint64_t const code = std::stoull(
+        XmlUtilities::ReadString(XmlUtilities::GetChild(event_node, {"code"})),
+        nullptr, 0);
+    double const weight = XmlUtilities::ChildExists(event_node, "weight")
+                              ? XmlUtilities::ReadDouble(XmlUtilities::GetChild(
+                                    event_node, {"weight"}))
+                              : 1.0;
+    flop_events.emplace_back(code, weight);
+  }
+  return flop_events;
+}
+
+/**
+ * @brief See base class definition.
+ * @note The backend is optional, the default is hdf5.
+ */
+std::string XmlOutputReader::DoReadOutputBackend() const {
+  std::vector<std::string> const path = {"configuration", "output", "backend",
+                                         "type"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadString(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : "Hdf5";
+}
+
+/**
+ * @brief See base class definition.
+ * @note The engine is optional, the default is BP5.
+ */
+std::string XmlOutputReader::DoReadAdios2Engine() const {
+  std::vector<std::string> const path = {"configuration", "output", "backend",
+                                         "engine"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadString(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : "BP5";
+}
+
+/**
+ * @brief See base class definition.
+ * @note The number of aggregators is optional, by default ADIOS2 chooses it.
+ */
+unsigned int XmlOutputReader::DoReadAdios2Aggregators() const {
+  std::vector<std::string> const path = {"configuration", "output", "backend",
+                                         "aggregators"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadUnsignedInt(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : 0;
+}
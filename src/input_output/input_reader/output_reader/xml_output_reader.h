@@ -46,6 +46,40 @@ class XmlOutputReader : public OutputReader {
   double DoReadOutputInterval(OutputType const output_type) const override;
   std::vector<double>
   DoReadOutputTimeStamps(OutputType const output_type) const override;
+  std::string
+  DoReadCompressionType(std::string const &quantity_name) const override;
+  unsigned int
+  DoReadDeflateLevel(std::string const &quantity_name) const override;
+  double
+  DoReadCompressionErrorBound(std::string const &quantity_name) const override;
+  std::string
+  DoReadOutputPrecision(std::string const &quantity_name) const override;
+  unsigned int DoReadMonitoringMaximumLevel() const override;
+  std::array<std::array<double, 2>, 3> DoReadMonitoringRegion() const override;
+  unsigned int DoReadInSituInterval() const override;
+  std::vector<std::tuple<std::string, unsigned int, std::string>>
+  DoReadInSituReductions() const override;
+  std::vector<std::tuple<std::string, unsigned int, std::array<double, 3>,
+                         std::array<double, 3>, unsigned int>>
+  DoReadInSituProbes() const override;
+  std::vector<std::tuple<std::string, unsigned int, std::string,
+                         std::array<double, 3>, unsigned int, bool>>
+  DoReadInSituSlices() const override;
+  bool DoReadInitialOutput() const override;
+  bool DoReadProfilingActive() const override;
+  unsigned int DoReadProfilingInterval() const override;
+  bool DoReadProfilingTrace() const override;
+  bool DoReadProfilingCounters() const override;
+  std::vector<std::pair<std::uint64_t, double>>
+  DoReadProfilingFlopEvents() const override;
+  std::string DoReadOutputBackend() const override;
+  std::string DoReadAdios2Engine() const override;
+  unsigned int DoReadAdios2Aggregators() const override;
+
+  // Gives the entry of a quantity or its default in a per-quantity section
+  tinyxml2::XMLElement const *QuantityNode(std::string const &section_name,
+                                           std::string const &quantity_name,
+                                           std::string const &entry_name) const;
 
 public:
   XmlOutputReader() = delete;
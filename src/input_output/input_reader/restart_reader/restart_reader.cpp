@@ -99,3 +99,28 @@ std::vector<double> RestartReader::ReadSnapshotTimeStamps() const {
 
   return time_stamps;
 }
+
+/**
+ * @brief Gives the folder in which restart snapshots are staged before they are
+ * drained to the restart folder.
+ * @return name of the staging folder (empty if snapshots are not staged).
+ * @note Folder name without any white spaces.
+ */
+std::string RestartReader::ReadStagingFolder() const {
+  return StringOperations::RemoveSpaces(DoReadStagingFolder());
+}
+
+/**
+ * @brief Gives the checked number of snapshots kept in the staging folder.
+ * @return number of staged snapshots.
+ */
+unsigned int RestartReader::ReadStagingGenerationsToKeep() const {
+  // read and make consistency check
+  int const keep(DoReadStagingGenerationsToKeep());
+  if (keep < 1) {
+    throw std::invalid_argument("At least one staged restart snapshot must be "
+                                "kept in the staging folder!");
+  }
+
+  return static_cast<unsigned int>(keep);
+}
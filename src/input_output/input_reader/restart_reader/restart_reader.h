@@ -45,6 +45,8 @@ protected:
   virtual int DoReadSnapshotIntervalsToKeep() const = 0;
   virtual int DoReadSnapshotInterval() const = 0;
   virtual std::vector<double> DoReadSnapshotTimeStamps() const = 0;
+  virtual std::string DoReadStagingFolder() const = 0;
+  virtual int DoReadStagingGenerationsToKeep() const = 0;
 
 public:
   virtual ~RestartReader() = default;
@@ -60,6 +62,8 @@ public:
   unsigned int ReadSnapshotIntervalsToKeep() const;
   unsigned int ReadSnapshotInterval() const;
   TEST_VIRTUAL std::vector<double> ReadSnapshotTimeStamps() const;
+  TEST_VIRTUAL std::string ReadStagingFolder() const;
+  TEST_VIRTUAL unsigned int ReadStagingGenerationsToKeep() const;
 };
 
 #endif // RESTART_READER_H
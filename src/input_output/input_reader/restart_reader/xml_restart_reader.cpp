@@ -95,3 +95,29 @@ std::vector<double> XmlRestartReader::DoReadSnapshotTimeStamps() const {
       *xml_input_file_, {"configuration", "restart", "snapshots", "stamps"});
   return XmlUtilities::ReadTimeStamps(node);
 }
+
+/**
+ * @brief See base class definition.
+ * @note The staging is optional, its absence deactivates it.
+ */
+std::string XmlRestartReader::DoReadStagingFolder() const {
+  std::vector<std::string> const path = {"configuration", "restart",
+                                         "snapshots", "staging", "folder"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadString(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : "";
+}
+
+/**
+ * @brief See base class definition.
+ * @note The number of staged snapshots is optional, the default is one.
+ */
+int XmlRestartReader::DoReadStagingGenerationsToKeep() const {
+  std::vector<std::string> const path = {
+      "configuration", "restart", "snapshots", "staging", "generationsToKeep"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadInt(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : 1;
+}
@@ -46,6 +46,8 @@ class XmlRestartReader : public RestartReader {
   int DoReadSnapshotIntervalsToKeep() const override;
   int DoReadSnapshotInterval() const override;
   std::vector<double> DoReadSnapshotTimeStamps() const override;
+  std::string DoReadStagingFolder() const override;
+  int DoReadStagingGenerationsToKeep() const override;
 
 public:
   XmlRestartReader() = delete;
@@ -66,3 +66,25 @@ double TimeControlReader::ReadCFLNumber() const {
 
   return cfl_number;
 }
+
+/**
+ * @brief Gives the maximum number of macro time steps from the input.
+ * @return Maximum number of macro time steps of the run (0: limited by the end
+ * time only).
+ */
+unsigned int TimeControlReader::ReadMaximumMacroSteps() const {
+  return DoReadMaximumMacroSteps();
+}
+
+/**
+ * @brief Gives the wall-clock time limit of the run from the input. The run
+ * writes a restart snapshot and stops before the limit is reached.
+ * @return Wall-clock time limit in seconds (0: no limit).
+ */
+double TimeControlReader::ReadWalltimeLimit() const {
+  double const walltime_limit(DoReadWalltimeLimit());
+  if (walltime_limit < 0.0) {
+    throw std::invalid_argument("Walltime limit must not be negative !");
+  }
+  return walltime_limit;
+}
@@ -35,6 +35,8 @@ protected:
   virtual double DoReadStartTime() const = 0;
   virtual double DoReadEndTime() const = 0;
   virtual double DoReadCFLNumber() const = 0;
+  virtual unsigned int DoReadMaximumMacroSteps() const = 0;
+  virtual double DoReadWalltimeLimit() const = 0;
 
   // constructor can only be called from derived classes
   explicit TimeControlReader() = default;
@@ -50,6 +52,8 @@ public:
   TEST_VIRTUAL double ReadStartTime() const;
   TEST_VIRTUAL double ReadEndTime() const;
   TEST_VIRTUAL double ReadCFLNumber() const;
+  TEST_VIRTUAL unsigned int ReadMaximumMacroSteps() const;
+  TEST_VIRTUAL double ReadWalltimeLimit() const;
 };
 
 #endif // TIME_CONTROL_READER_H
@@ -61,3 +61,30 @@ double XmlTimeControlReader::DoReadCFLNumber() const {
       *xml_input_file_, {"configuration", "timeControl", "CFLNumber"});
   return XmlUtilities::ReadDouble(node);
 }
+
+/**
+ * @brief See base class definition.
+ * @note The maximum number of macro time steps is optional, by default the run
+ * is only limited by the end time.
+ */
+unsigned int XmlTimeControlReader::DoReadMaximumMacroSteps() const {
+  std::vector<std::string> const path = {"configuration", "timeControl",
+                                         "maximumMacroSteps"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadUnsignedInt(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : 0;
+}
+
+/**
+ * @brief See base class definition.
+ * @note The walltime limit is optional, by default the run is not limited.
+ */
+double XmlTimeControlReader::DoReadWalltimeLimit() const {
+  std::vector<std::string> const path = {"configuration", "timeControl",
+                                         "walltimeLimit"};
+  return XmlUtilities::ChildExists(*xml_input_file_, path)
+             ? XmlUtilities::ReadDouble(
+                   XmlUtilities::GetChild(*xml_input_file_, path))
+             : 0.0;
+}
@@ -43,6 +43,8 @@ class XmlTimeControlReader : public TimeControlReader {
   double DoReadStartTime() const override;
   double DoReadEndTime() const override;
   double DoReadCFLNumber() const override;
+  unsigned int DoReadMaximumMacroSteps() const override;
+  double DoReadWalltimeLimit() const override;
 
 public:
   XmlTimeControlReader() = delete;
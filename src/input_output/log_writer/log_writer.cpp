@@ -20,6 +20,7 @@
 //
 //===----------------------------------------------------------------------===//
 #include "input_output/log_writer/log_writer.h"
+#include "simulation_context.h"
 
 /**
  * @brief Default constructor using the provided streams to buffer the messages
@@ -35,9 +36,9 @@ LogWriter::LogWriter(std::unique_ptr<std::stringstream> &&terminal_output,
 }
 
 /**
- * @brief This function is used to get the Logger. If no Logger exists yet it is
- * created, otherwise the existing logger is passed back. "Singleton
- * Constructor"
+ * @brief This function is used to get the Logger of the current simulation
+ * context (see SimulationContext::Current()). If the context has no Logger yet
+ * it is created, otherwise the existing logger is passed back.
  * @param terminal_output stream to use for terminal logging.
  * @param file_output stream to use for logfile logging.
  * @return The logger instance.
@@ -45,8 +46,8 @@ LogWriter::LogWriter(std::unique_ptr<std::stringstream> &&terminal_output,
 LogWriter &
 LogWriter::Instance(std::unique_ptr<std::stringstream> &&terminal_output,
                     std::unique_ptr<std::stringstream> &&file_output) {
-  static LogWriter instance(std::move(terminal_output), std::move(file_output));
-  return instance;
+  return SimulationContext::Current().Logger(std::move(terminal_output),
+                                             std::move(file_output));
 }
 
 /**
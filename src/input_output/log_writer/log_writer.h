@@ -29,21 +29,22 @@
  * @brief A light-weight logger to write output to the terminal and to a log
  * file. Messages are internally buffered and only written to external terminal
  * or file on command.
- * @note Singleton.
+ * @note One instance per simulation, see SimulationContext.
  */
 class LogWriter {
 
   LogWriterImplementation implementation_;
   explicit LogWriter(std::unique_ptr<std::stringstream> &&terminal_output,
                      std::unique_ptr<std::stringstream> &&file_output);
+  friend class SimulationContext;
 
 public:
-  // Singelton "Constructor":
+  // Logger of the current simulation context
   static LogWriter &
   Instance(std::unique_ptr<std::stringstream> &&terminal_output = nullptr,
            std::unique_ptr<std::stringstream> &&file_output = nullptr);
 
-  // Singeltons may never call these methods.
+  // Only the simulation context creates loggers.
   LogWriter() = delete;
   ~LogWriter() = default;
   LogWriter(LogWriter const &) = delete;
@@ -69,6 +69,8 @@ void LogCompiledSettings() {
   }
   logger.LogMessage("Dimensions              : " +
                     std::to_string(static_cast<int>(CC::DIM())));
+  logger.LogMessage("Internal cells per block: " + std::to_string(CC::ICX()) +
+                    " ( halo width " + std::to_string(CC::HS()) + " )");
   if constexpr (CC::DIM() == Dimension::Two) {
     std::string message = "Axis symmetry";
     if constexpr (CC::Axisymmetric()) {
@@ -119,6 +121,12 @@ void LogCompiledSettings() {
     logger.LogMessage(
         "Flux Splitting Scheme                         : " +
         FluxSplittingToString(FluxSplittingSettings::flux_splitting_scheme));
+    if constexpr (FluxSplittingSettings::flux_splitting_scheme ==
+                  FluxSplitting::GlobalLaxFriedrichs) {
+      logger.LogMessage("Flux splitting eigenvalues                    : "
+                        "global reduction per stage ( consider "
+                        "LocalLaxFriedrichs )");
+    }
     if constexpr (FluxSplittingSettings::flux_splitting_scheme ==
                       FluxSplitting::Roe_M ||
                   FluxSplittingSettings::flux_splitting_scheme ==
@@ -27,7 +27,52 @@
 #include "input_output/output_writer/output_definitions.h"
 #include "input_output/utilities/file_utilities.h"
 #include "input_output/utilities/xdmf_utilities.h"
+#include "utilities/memory_statistics.h"
 #include "utilities/string_operations.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+namespace {
+/**
+ * @brief Writes the values of a slice as binary grayscale image (portable
+ * graymap) scaled between their minimum and maximum. The first spanned axis
+ * runs from left to right, the second one from bottom to top. Grid cells
+ * without a value are black.
+ * @param filename Name of the image file (including path and extension).
+ * @param grid The uniform grid of the slice.
+ * @param values The values on the grid.
+ */
+void WriteGrayscaleImage(std::string const &filename,
+                         InSituSliceGrid const &grid,
+                         std::vector<double> const &values) {
+  unsigned int const width = grid.cells_[0];
+  unsigned int const height = grid.cells_.size() > 1 ? grid.cells_[1] : 1;
+  double minimum = std::numeric_limits<double>::max();
+  double maximum = std::numeric_limits<double>::lowest();
+  for (double const value : values) {
+    if (!std::isnan(value)) {
+      minimum = std::min(minimum, value);
+      maximum = std::max(maximum, value);
+    }
+  }
+  double const scale = maximum > minimum ? 254.0 / (maximum - minimum) : 0.0;
+  std::vector<unsigned char> pixels(values.size(), 0);
+  for (unsigned int row = 0; row < height; ++row) {
+    for (unsigned int column = 0; column < width; ++column) {
+      double const value = values[column * height + height - 1 - row];
+      if (!std::isnan(value)) {
+        pixels[row * width + column] =
+            static_cast<unsigned char>(1.0 + scale * (value - minimum));
+      }
+    }
+  }
+  std::ofstream image(filename, std::ios::out | std::ios::binary);
+  image << "P5\n" << width << " " << height << "\n255\n";
+  image.write(reinterpret_cast<char const *>(pixels.data()), pixels.size());
+}
+} // namespace
 
 /**
  * @brief Creates an object to get the simulation data from the RAM to the hard
@@ -37,11 +82,21 @@
  * @param debug_mesh_generator The already initialized debug mesh geenrator.
  * @param interface_mesh_generator The already initialized interface mesh
  * geenrator.
+ * @param monitoring_mesh_generator The already initialized monitoring mesh
+ * generator.
+ * @param interface_surface_generator The already initialized interface surface
+ * generator, nullptr if the interface output is written as cell data.
  * @param material_output_quantities Vector holding all already initialized
  * material output quantities that are written.
  * @param interface_output_quantities Vector holding all already initialized
  * interface output quantities that are written.
+ * @param material_output_formats Precision and compression of each material
+ * output quantity.
+ * @param interface_output_formats Precision and compression of each interface
+ * output quantity.
  * @param number_of_materials Number of materials considered in the simulation.
+ * @param adios2_manager The manager writing the field outputs with ADIOS2,
+ * nullptr if they are written with hdf5.
  *
  * @note for the pointer ownership transfer takes place.
  */
@@ -49,19 +104,30 @@ OutputWriter::OutputWriter(
     std::unique_ptr<MeshGenerator const> standard_mesh_generator,
     std::unique_ptr<MeshGenerator const> debug_mesh_generator,
     std::unique_ptr<MeshGenerator const> interface_mesh_generator,
+    std::unique_ptr<MeshGenerator const> monitoring_mesh_generator,
+    std::unique_ptr<InterfaceSurfaceGenerator const>
+        interface_surface_generator,
     std::vector<std::unique_ptr<OutputQuantity const>>
         material_output_quantities,
     std::vector<std::unique_ptr<OutputQuantity const>>
         interface_output_quantities,
-    unsigned int const number_of_materials)
+    std::vector<OutputDatasetFormat> material_output_formats,
+    std::vector<OutputDatasetFormat> interface_output_formats,
+    unsigned int const number_of_materials,
+    std::unique_ptr<Adios2Manager> adios2_manager)
     : // Start initializer list
       number_of_materials_(number_of_materials),
       hdf5_manager_(Hdf5Manager::Instance()),
+      adios2_manager_(std::move(adios2_manager)),
       standard_mesh_generator_(std::move(standard_mesh_generator)),
       debug_mesh_generator_(std::move(debug_mesh_generator)),
       interface_mesh_generator_(std::move(interface_mesh_generator)),
+      monitoring_mesh_generator_(std::move(monitoring_mesh_generator)),
+      interface_surface_generator_(std::move(interface_surface_generator)),
       material_output_quantities_(std::move(material_output_quantities)),
       interface_output_quantities_(std::move(interface_output_quantities)),
+      material_output_formats_(std::move(material_output_formats)),
+      interface_output_formats_(std::move(interface_output_formats)),
       material_quantities_dimension_map_(
           ComputeDimensionMap(material_output_quantities_)),
       interface_quantities_dimension_map_(
@@ -96,6 +162,10 @@ void OutputWriter::InitializeTimeSeriesFile(
  */
 void OutputWriter::FinalizeTimeSeriesFile(
     std::string const &time_series_filename_without_extension) const {
+  // The stream of the time series is closed by all ranks
+  if (adios2_manager_) {
+    adios2_manager_->CloseStream(time_series_filename_without_extension);
+  }
   // Only do writing to file on 0 rank
   if (MpiUtilities::MyRankId() == 0) {
     // Get the footer of the time series file
@@ -106,6 +176,70 @@ void OutputWriter::FinalizeTimeSeriesFile(
   }
 }
 
+/**
+ * @brief Writes the resampled slices of the in-situ analysis into a single hdf5
+ * file. Each slice is stored in its own group holding the values on the uniform
+ * grid (row-major with respect to the spanned axes) and the description of the
+ * grid as attributes. If requested, a grayscale image of a slice is written
+ * next to the file.
+ * @param output_time Time of the output (dimensional).
+ * @param filename_without_extension Name of the file (including path).
+ * @param slices The slices.
+ * @param grids The uniform grid of each slice.
+ * @param values The resampled values of each slice.
+ * @note Only called on the master rank, which writes the small file alone.
+ */
+void OutputWriter::WriteSliceFile(
+    double const output_time, std::string const &filename_without_extension,
+    std::vector<InSituSlice> const &slices,
+    std::vector<InSituSliceGrid> const &grids,
+    std::vector<std::vector<double>> const &values) const {
+  hdf5_manager_.OpenFile(filename_without_extension + ".h5", Hdf5Access::Write,
+                         MPI_COMM_SELF);
+  hdf5_manager_.OpenGroup("metadata");
+  hdf5_manager_.WriteAttributeScalar("time", output_time, H5T_NATIVE_DOUBLE);
+  hdf5_manager_.CloseGroup();
+
+  std::string const axis_names = "xyz";
+  for (std::size_t index = 0; index < slices.size(); ++index) {
+    InSituSliceGrid const &grid = grids[index];
+    std::string const group_name = "slice_" + std::to_string(index);
+    hdf5_manager_.OpenGroup(group_name);
+    std::string axes;
+    for (unsigned int const axis : grid.axes_) {
+      axes += axis_names[axis];
+    }
+    hdf5_manager_.WriteAttributeString("quantity", grid.name_);
+    hdf5_manager_.WriteAttributeString("axes", axes);
+    hdf5_manager_.WriteAttributeScalar("cell_size", grid.cell_size_,
+                                       H5T_NATIVE_DOUBLE);
+    for (unsigned int d = 0; d < 3; ++d) {
+      hdf5_manager_.WriteAttributeScalar(std::string("origin_") + axis_names[d],
+                                         grid.origin_[d], H5T_NATIVE_DOUBLE);
+    }
+    std::vector<hsize_t> const dimensions(grid.cells_.begin(),
+                                          grid.cells_.end());
+    hdf5_manager_.OpenDatasetForWriting("values", dimensions, dimensions, 0);
+    hdf5_manager_.WriteDataset("values", values[index].data());
+    hdf5_manager_.CloseGroup(group_name);
+
+    if (slices[index].image_) {
+      WriteGrayscaleImage(filename_without_extension + "_" + group_name +
+                              ".pgm",
+                          grid, values[index]);
+    }
+  }
+  hdf5_manager_.CloseFile();
+}
+
+/**
+ * @brief Waits until all hdf5 files (output and restart) written in the
+ * background are complete.
+ */
+void OutputWriter::WaitForPendingWrites() const {
+  hdf5_manager_.WaitForPendingWrites();
+}
+
 /**
  * @brief Triggers the output of the simulation results. Based on user Input the
  * correct type of output is created.
@@ -122,26 +256,153 @@ void OutputWriter::WriteOutput(
     std::string const &filename_without_extension,
     std::string const &time_series_filename_without_extension) const {
 
-  // Define the full path filename of the hdf5 file
-  std::string const hdf5_filename(filename_without_extension + ".h5");
+  // The interface surface replaces the interface leaves with their cell data
+  if (output_type == OutputType::Interface && interface_surface_generator_) {
+    WriteInterfaceSurface(output_time, filename_without_extension,
+                          time_series_filename_without_extension);
+    return;
+  }
+
   // Obtain the correct mesh generator for the given output (ternary operator
   // used to avoid new function declaration and allow constness)
   MeshGenerator const &mesh_generator =
-      output_type == OutputType::Debug       ? *debug_mesh_generator_
-      : output_type == OutputType::Interface ? *interface_mesh_generator_
-                                             : *standard_mesh_generator_;
+      output_type == OutputType::Debug        ? *debug_mesh_generator_
+      : output_type == OutputType::Interface  ? *interface_mesh_generator_
+      : output_type == OutputType::Monitoring ? *monitoring_mesh_generator_
+                                              : *standard_mesh_generator_;
+
+  // With ADIOS2, the outputs of a time series are the steps of one stream,
+  // single outputs are streams of a single step
+  if (adios2_manager_) {
+    if (time_series_filename_without_extension.empty()) {
+      WriteAdios2Step(output_time, filename_without_extension, mesh_generator,
+                      output_type);
+      adios2_manager_->CloseStream(filename_without_extension);
+    } else {
+      WriteAdios2Step(output_time, time_series_filename_without_extension,
+                      mesh_generator, output_type);
+    }
+    return;
+  }
+
+  // Steps of a time series are collected in shared files
+  if (Hdf5OutputSettings::StepsPerTimeSeriesFile > 0 &&
+      !time_series_filename_without_extension.empty()) {
+    WriteSharedFileStep(output_time, time_series_filename_without_extension,
+                        mesh_generator, output_type);
+    return;
+  }
+
+  // Define the full path filename of the hdf5 file
+  std::string const hdf5_filename(filename_without_extension + ".h5");
   // Call the writing function with the specific mesh_generator
-  WriteHdf5File(output_time, hdf5_filename, mesh_generator, output_type);
+  WrittenMesh const mesh =
+      WriteHdf5File(output_time, hdf5_filename, mesh_generator, output_type);
   // Only write xdmf on rank 0 to avoid write conflicts
   if (MpiUtilities::MyRankId() == 0) {
     // Write the single time step xdmf file
     WriteXdmfTimeStepFile(output_time, hdf5_filename, mesh_generator,
-                          output_type);
+                          output_type, mesh);
     // Append the xdmf information to the time series file (ir required)
     if (!time_series_filename_without_extension.empty()) {
       AppendToXdmfTimeSeriesFile(output_time, hdf5_filename, mesh_generator,
                                  time_series_filename_without_extension,
-                                 output_type);
+                                 output_type, mesh);
+    }
+  }
+}
+
+/**
+ * @brief Writes the zero level-set of all interface leaves as surface into the
+ * hdf5 file together with the single time step xdmf file and appends it to the
+ * time series. All ranks write their elements and vertices collectively into
+ * one dataset each.
+ * @param output_time The time at which the simulation is currently at.
+ * @param filename_without_extension Filename without extension where the output
+ * is written to.
+ * @param time_series_filename_without_extension Name of the time series file
+ * (without extension).
+ */
+void OutputWriter::WriteInterfaceSurface(
+    double const output_time, std::string const &filename_without_extension,
+    std::string const &time_series_filename_without_extension) const {
+
+  std::string const hdf5_filename(filename_without_extension + ".h5");
+  hsize_t const vertices_per_element =
+      InterfaceSurfaceGenerator::VerticesPerElement();
+
+  /** Extract the surface of the local interface leaves */
+  std::vector<unsigned long long int> vertex_ids;
+  std::vector<double> vertex_coordinates;
+  interface_surface_generator_->ComputeLocalSurface(vertex_ids,
+                                                    vertex_coordinates);
+  unsigned long long int const local_number_of_elements =
+      vertex_ids.size() / vertices_per_element;
+  unsigned long long int const local_number_of_vertices =
+      vertex_coordinates.size() / 3;
+  // Position of the rank in the global element and vertex lists (ordered by
+  // rank)
+  unsigned long long int const elements_start_index =
+      MpiUtilities::ExclusiveScan(local_number_of_elements);
+  unsigned long long int const vertices_start_index =
+      MpiUtilities::ExclusiveScan(local_number_of_vertices);
+  std::array<unsigned long long int, 2> global_sizes = {
+      local_number_of_elements, local_number_of_vertices};
+  MPI_Allreduce(MPI_IN_PLACE, global_sizes.data(), 2, MPI_UNSIGNED_LONG_LONG,
+                MPI_SUM, MpiUtilities::Communicator());
+  for (unsigned long long int &vertex_id : vertex_ids) {
+    vertex_id += vertices_start_index;
+  }
+
+  /** Write the surface into the hdf5 file */
+  hdf5_manager_.OpenFile(hdf5_filename);
+  hdf5_manager_.OpenGroup("metadata");
+  hdf5_manager_.WriteAttributeScalar("time", output_time, H5T_NATIVE_DOUBLE);
+  hdf5_manager_.CloseGroup();
+
+  hdf5_manager_.OpenGroup("surface_topology");
+  hdf5_manager_.ReserveDataspace(
+      "VertexIDs", {global_sizes[0], vertices_per_element},
+      {local_number_of_elements, vertices_per_element}, elements_start_index,
+      H5T_NATIVE_ULLONG);
+  hdf5_manager_.WriteDatasetToDataspace(
+      "VertexIDs", interface_surface_generator_->GetVertexIDsName(),
+      vertex_ids.data());
+  hdf5_manager_.CloseDataset("VertexIDs");
+  hdf5_manager_.ReserveDataspace("VertexCoordinates",
+                                 {global_sizes[1], hsize_t(3)},
+                                 {local_number_of_vertices, hsize_t(3)},
+                                 vertices_start_index, H5T_NATIVE_DOUBLE);
+  hdf5_manager_.WriteDatasetToDataspace(
+      "VertexCoordinates",
+      interface_surface_generator_->GetVertexCoordinatesName(),
+      vertex_coordinates.data());
+  hdf5_manager_.CloseGroup();
+
+  MemoryStatistics::RecordTransient(MemoryCategory::InputOutput,
+                                    CapacityBytes(vertex_ids) +
+                                        CapacityBytes(vertex_coordinates));
+  hdf5_manager_.CloseFile();
+
+  /** Write the xdmf files on rank 0 only */
+  if (MpiUtilities::MyRankId() == 0) {
+    std::string const hdf5_short_filename(
+        FileUtilities::RemoveFilePath(hdf5_filename));
+    std::string const xdmf_content = XdmfUtilities::SpatialDataInformation(
+        "SpatialData_" +
+            StringOperations::ToScientificNotationString(output_time, 6),
+        XdmfUtilities::TimeDataItem(output_time) + '\n' +
+            interface_surface_generator_->GetXdmfTopologyString(
+                hdf5_short_filename, "surface_topology", global_sizes[0]) +
+            interface_surface_generator_->GetXdmfGeometryString(
+                hdf5_short_filename, "surface_topology", global_sizes[1]));
+    FileUtilities::WriteTextBasedFile(
+        filename_without_extension + ".xdmf",
+        XdmfUtilities::HeaderInformation("TimeStep") + xdmf_content +
+            XdmfUtilities::FooterInformation());
+    if (!time_series_filename_without_extension.empty()) {
+      FileUtilities::AppendToTextBasedFile(
+          time_series_filename_without_extension + ".xdmf", xdmf_content);
     }
   }
 }
@@ -155,18 +416,20 @@ void OutputWriter::WriteOutput(
  * output.
  * @param output_type Type of the output to be written (standard, interface,
  * debug).
+ * @param mesh The location of the mesh of the output.
  */
 void OutputWriter::WriteXdmfTimeStepFile(double const output_time,
                                          std::string const &hdf5_filename,
                                          MeshGenerator const &mesh_generator,
-                                         OutputType const output_type) const {
+                                         OutputType const output_type,
+                                         WrittenMesh const &mesh) const {
 
   // Append header of the file
   std::string xdmf_content(XdmfUtilities::HeaderInformation("TimeStep"));
   // Append core information of the xdmf file (topology, geometry and cell data)
   xdmf_content += XdmfSpatialDataInformation(
       output_time, FileUtilities::RemoveFilePath(hdf5_filename), mesh_generator,
-      output_type);
+      output_type, mesh);
   // Append the footer information
   xdmf_content += XdmfUtilities::FooterInformation();
 
@@ -184,18 +447,19 @@ void OutputWriter::WriteXdmfTimeStepFile(double const output_time,
  * output.
  * @param output_type Type of the output to be written (standard, interface,
  * debug).
+ * @param mesh The location of the mesh of the output.
  */
 void OutputWriter::AppendToXdmfTimeSeriesFile(
     double const output_time, std::string const &hdf5_filename,
     MeshGenerator const &mesh_generator,
     std::string const &time_series_filename_without_extension,
-    OutputType const output_type) const {
+    OutputType const output_type, WrittenMesh const &mesh) const {
 
   // Generate the core which should be appended to the file (use incrementing
   // grid names)
   std::string const xdmf_content = XdmfSpatialDataInformation(
       output_time, FileUtilities::RemoveFilePath(hdf5_filename), mesh_generator,
-      output_type);
+      output_type, mesh);
   // Append content to the file of the time series
   FileUtilities::AppendToTextBasedFile(
       time_series_filename_without_extension + ".xdmf", xdmf_content);
@@ -210,11 +474,14 @@ void OutputWriter::AppendToXdmfTimeSeriesFile(
  * output.
  * @param output_type Type of the output to be used (standard, interface,
  * debug).
+ * @param mesh The location of the mesh, which may lie in another hdf5 file.
+ * @param cell_data_group Group of the hdf5 file holding the cell data.
  * @return String of the Xdmf data that should be written.
  */
 std::string OutputWriter::XdmfSpatialDataInformation(
     double const output_time, std::string const &hdf5_short_filename,
-    MeshGenerator const &mesh_generator, OutputType const output_type) const {
+    MeshGenerator const &mesh_generator, OutputType const output_type,
+    WrittenMesh const &mesh, std::string const &cell_data_group) const {
 
   // Declare the grid name with a prefix and given time used in the name of the
   // hdf5 file
@@ -228,14 +495,18 @@ std::string OutputWriter::XdmfSpatialDataInformation(
   xdmf_content += '\n';
   // Append the Topology and domain information (empty line afterwards for
   // visual separation)
-  xdmf_content += mesh_generator.GetXdmfTopologyString(hdf5_short_filename,
-                                                       "mesh_topology");
-  xdmf_content += mesh_generator.GetXdmfGeometryString(hdf5_short_filename,
-                                                       "mesh_topology");
+  xdmf_content += mesh_generator.GetXdmfTopologyString(
+      mesh.hdf5_short_filename_, mesh.group_);
+  xdmf_content += mesh_generator.GetXdmfGeometryString(
+      mesh.hdf5_short_filename_, mesh.group_);
   xdmf_content += '\n';
   // Append for all material quantities the appropriate information
   hsize_t const global_number_cells = mesh_generator.GetGlobalNumberOfCells();
-  for (auto const &output_quantity : material_output_quantities_) {
+  for (size_t quantity_index = 0;
+       quantity_index < material_output_quantities_.size(); quantity_index++) {
+    auto const &output_quantity = material_output_quantities_[quantity_index];
+    OutputPrecision const precision =
+        material_output_formats_[quantity_index].precision_;
     if (output_quantity->IsActive(output_type)) {
       // Differ between debug and other outputs
       if (output_type == OutputType::Debug) {
@@ -243,37 +514,94 @@ std::string OutputWriter::XdmfSpatialDataInformation(
         for (size_t material_index = 0; material_index < number_of_materials_;
              material_index++) {
           xdmf_content += output_quantity->GetXdmfAttributeString(
-              hdf5_short_filename, "cell_data", global_number_cells,
-              "material_" + std::to_string(material_index + 1) + "_");
+              hdf5_short_filename, cell_data_group, global_number_cells,
+              "material_" + std::to_string(material_index + 1) + "_",
+              precision);
         }
       } else {
         xdmf_content += output_quantity->GetXdmfAttributeString(
-            hdf5_short_filename, "cell_data", global_number_cells);
+            hdf5_short_filename, cell_data_group, global_number_cells, "",
+            precision);
       }
     }
   }
   // For interface quantities no distinction is required for the debug output
-  for (auto const &output_quantity : interface_output_quantities_) {
+  for (size_t quantity_index = 0;
+       quantity_index < interface_output_quantities_.size(); quantity_index++) {
+    auto const &output_quantity = interface_output_quantities_[quantity_index];
     if (output_quantity->IsActive(output_type)) {
       xdmf_content += output_quantity->GetXdmfAttributeString(
-          hdf5_short_filename, "cell_data", global_number_cells);
+          hdf5_short_filename, cell_data_group, global_number_cells, "",
+          interface_output_formats_[quantity_index].precision_);
     }
   }
   // return the string including surrounding grid information
   return XdmfUtilities::SpatialDataInformation(spatial_data_name, xdmf_content);
 }
 
+/**
+ * @brief Writes the cell data of a quantity into a dataset of a reserved
+ * dataspace. For single precision, the data is converted before writing.
+ * @param file_manager The hdf5 or ADIOS2 manager the data is written with.
+ * @param dataspace_name Name of the reserved dataspace.
+ * @param dataset_name Name of the dataset that is written.
+ * @param cell_data The cell data in double precision.
+ * @param format Precision and compression of the dataset.
+ */
+template <typename FileManager>
+void OutputWriter::WriteCellData(FileManager &file_manager,
+                                 std::string const &dataspace_name,
+                                 std::string const &dataset_name,
+                                 std::vector<double> const &cell_data,
+                                 OutputDatasetFormat const &format) const {
+  if (format.precision_ == OutputPrecision::Single) {
+    std::vector<float> const single_cell_data(cell_data.begin(),
+                                              cell_data.end());
+    file_manager.WriteDatasetToDataspace(dataspace_name, dataset_name,
+                                         single_cell_data.data(),
+                                         format.compression_, H5T_NATIVE_FLOAT);
+  } else {
+    file_manager.WriteDatasetToDataspace(dataspace_name, dataset_name,
+                                         cell_data.data(), format.compression_);
+  }
+}
+
 /**
  * @brief Writes the data into the hdf5 file.
+ * @param output_time Time at which the output is written.
  * @param hdf5_filename Filename of the hdf5 file (absolute path).
  * @param mesh_generator The mesh generator to be used for the output.
  * @param output_type Type of the output that is considered (standard,
  * interface, debug).
+ * @return The location of the mesh of the output.
+ *
+ * @note If Hdf5OutputSettings::ReuseUnchangedMesh is set, the mesh is only
+ * written if its topology epoch changed since the previous output of this type.
+ * Otherwise, the mesh of the previous output file is referenced.
  */
-void OutputWriter::WriteHdf5File(double const output_time,
-                                 std::string const &hdf5_filename,
-                                 MeshGenerator const &mesh_generator,
-                                 OutputType const output_type) const {
+OutputWriter::WrittenMesh OutputWriter::WriteHdf5File(
+    double const output_time, std::string const &hdf5_filename,
+    MeshGenerator const &mesh_generator, OutputType const output_type) const {
+
+  WrittenMesh &mesh = written_meshes_[output_type];
+  std::string const hdf5_short_filename =
+      FileUtilities::RemoveFilePath(hdf5_filename);
+  // The epoch is identical on all ranks, hence all take the same decision. A
+  // file that is overwritten cannot hold the mesh referenced by itself
+  bool const write_mesh = !Hdf5OutputSettings::ReuseUnchangedMesh ||
+                          mesh.hdf5_short_filename_.empty() ||
+                          mesh.hdf5_short_filename_ == hdf5_short_filename ||
+                          mesh.epoch_ != mesh_generator.GetMeshEpoch();
+
+  // Declare the vectors where the vertex IDs and coordinates are written into.
+  // The vectors are not initialized with a certain size since done inside of
+  // the mesh generator
+  std::vector<unsigned long long int> vertex_ids;
+  std::vector<double> vertex_coordinates;
+  if (write_mesh) {
+    mesh_generator.ComputeVertexIDs(vertex_ids);
+    mesh_generator.ComputeVertexCoordinates(vertex_coordinates);
+  }
 
   /** Open the hdf5 file */
   hdf5_manager_.OpenFile(hdf5_filename);
@@ -284,65 +612,206 @@ void OutputWriter::WriteHdf5File(double const output_time,
   hdf5_manager_.CloseGroup();
 
   /** Write complete mesh topology information into the hdf5 file */
-  // Open mesh topology group
-  hdf5_manager_.OpenGroup("mesh_topology");
+  if (write_mesh) {
+    mesh = {mesh_generator.GetMeshEpoch(), hdf5_short_filename,
+            "mesh_topology"};
+    WriteMeshTopology(hdf5_manager_, mesh.group_, mesh_generator, vertex_ids,
+                      vertex_coordinates);
+  }
 
-  /** Vertex IDs */
-  // Define the hdf5 dataset properties for vertex ids
-  std::vector<hsize_t> const global_dimensions_vertex_ids =
-      mesh_generator.GetGlobalDimensionsOfVertexIDs();
-  std::vector<hsize_t> const local_dimensions_vertex_ids =
-      mesh_generator.GetLocalDimensionsOfVertexIDs();
-  hsize_t const start_index_vertex_ids =
-      mesh_generator.GetLocalVertexIDsStartIndex();
-
-  // Declare the vector where the vertex IDs are written into. The vector is not
-  // initialized with a certain size since done inside of the mesh generator
+  /** Write cell fields into the hdf5 file */
+  std::size_t const cell_data_bytes = WriteCellDataGroup(
+      hdf5_manager_, "cell_data", mesh_generator, output_type);
+
+  // The staging buffers of the mesh and the cell data are held until here
+  MemoryStatistics::RecordTransient(MemoryCategory::InputOutput,
+                                    CapacityBytes(vertex_ids) +
+                                        CapacityBytes(vertex_coordinates) +
+                                        cell_data_bytes);
+
+  /** Closing the last HDF Ressources and write xdmf file */
+  hdf5_manager_.CloseFile();
+
+  return mesh;
+}
+
+/**
+ * @brief Writes an output as step of an ADIOS2 stream. The step holds the time,
+ * the mesh topology and the cell data with the same names as the hdf5 file,
+ * where groups become prefixes of the variable names, e.g.,
+ * "cell_data/density".
+ * @param output_time Time at which the output is written.
+ * @param stream_name Name of the stream (including path).
+ * @param mesh_generator The mesh generator to be used for the output.
+ * @param output_type Type of the output that is considered (standard,
+ * interface, debug).
+ */
+void OutputWriter::WriteAdios2Step(double const output_time,
+                                   std::string const &stream_name,
+                                   MeshGenerator const &mesh_generator,
+                                   OutputType const output_type) const {
   std::vector<unsigned long long int> vertex_ids;
-  // Compute the vertex coordinates
+  std::vector<double> vertex_coordinates;
   mesh_generator.ComputeVertexIDs(vertex_ids);
+  mesh_generator.ComputeVertexCoordinates(vertex_coordinates);
+
+  adios2_manager_->BeginStep(stream_name, output_time);
+  WriteMeshTopology(*adios2_manager_, "mesh_topology", mesh_generator,
+                    vertex_ids, vertex_coordinates);
+  std::size_t const cell_data_bytes = WriteCellDataGroup(
+      *adios2_manager_, "cell_data", mesh_generator, output_type);
+  adios2_manager_->EndStep();
+
+  MemoryStatistics::RecordTransient(MemoryCategory::InputOutput,
+                                    CapacityBytes(vertex_ids) +
+                                        CapacityBytes(vertex_coordinates) +
+                                        cell_data_bytes);
+}
+
+/**
+ * @brief Writes an output step of a time series into the shared hdf5 file of
+ * the time series and appends it to the time series xdmf file. The step is
+ * stored in its own metadata and cell data groups. The mesh is only written
+ * into a new group if its topology epoch changed since the previous step or
+ * the step starts a new file, otherwise the latest mesh group is referenced.
+ * @param output_time Time at which the output is written.
+ * @param time_series_filename_without_extension Name of the time series file
+ * (without extension), the hdf5 files are named after it.
+ * @param mesh_generator The mesh generator to be used for the output.
+ * @param output_type Type of the output that is considered (standard,
+ * interface, debug).
+ */
+void OutputWriter::WriteSharedFileStep(
+    double const output_time,
+    std::string const &time_series_filename_without_extension,
+    MeshGenerator const &mesh_generator, OutputType const output_type) const {
+
+  SharedFileTimeSeries &time_series =
+      shared_file_time_series_[time_series_filename_without_extension];
+  bool const new_file =
+      time_series.steps_in_file_ == 0 ||
+      time_series.steps_in_file_ >= Hdf5OutputSettings::StepsPerTimeSeriesFile;
+  // Files are named after the time of their first step, hence the files of a
+  // restarted simulation do not overwrite the earlier ones
+  if (new_file) {
+    time_series.steps_in_file_ = 0;
+    time_series.hdf5_filename_ =
+        time_series_filename_without_extension + "_" +
+        StringOperations::ToScientificNotationString(output_time, 6) + ".h5";
+  }
+  std::string const step_suffix =
+      "_" + std::to_string(time_series.number_of_steps_);
+
+  /** Compute the mesh if it needs to be written */
+  bool const write_mesh =
+      new_file || time_series.mesh_.epoch_ != mesh_generator.GetMeshEpoch();
+  std::vector<unsigned long long int> vertex_ids;
+  std::vector<double> vertex_coordinates;
+  if (write_mesh) {
+    mesh_generator.ComputeVertexIDs(vertex_ids);
+    mesh_generator.ComputeVertexCoordinates(vertex_coordinates);
+  }
+
+  /** Write the step into the hdf5 file */
+  hdf5_manager_.OpenFile(time_series.hdf5_filename_,
+                         new_file ? Hdf5Access::Write : Hdf5Access::Append);
+  hdf5_manager_.OpenGroup("metadata" + step_suffix);
+  hdf5_manager_.WriteAttributeScalar("time", output_time, H5T_NATIVE_DOUBLE);
+  hdf5_manager_.CloseGroup();
+  if (write_mesh) {
+    time_series.mesh_ = {
+        mesh_generator.GetMeshEpoch(),
+        FileUtilities::RemoveFilePath(time_series.hdf5_filename_),
+        "mesh_topology" + step_suffix};
+    WriteMeshTopology(hdf5_manager_, time_series.mesh_.group_, mesh_generator,
+                      vertex_ids, vertex_coordinates);
+  }
+  std::size_t const cell_data_bytes = WriteCellDataGroup(
+      hdf5_manager_, "cell_data" + step_suffix, mesh_generator, output_type);
+  MemoryStatistics::RecordTransient(MemoryCategory::InputOutput,
+                                    CapacityBytes(vertex_ids) +
+                                        CapacityBytes(vertex_coordinates) +
+                                        cell_data_bytes);
+  hdf5_manager_.CloseFile();
+
+  /** Append the step to the time series on rank 0 only */
+  if (MpiUtilities::MyRankId() == 0) {
+    FileUtilities::AppendToTextBasedFile(
+        time_series_filename_without_extension + ".xdmf",
+        XdmfSpatialDataInformation(
+            output_time,
+            FileUtilities::RemoveFilePath(time_series.hdf5_filename_),
+            mesh_generator, output_type, time_series.mesh_,
+            "cell_data" + step_suffix));
+  }
+  time_series.number_of_steps_++;
+  time_series.steps_in_file_++;
+}
+
+/**
+ * @brief Writes the vertex IDs and coordinates of the mesh into a new group of
+ * the open hdf5 file or ADIOS2 step.
+ * @param file_manager The hdf5 or ADIOS2 manager the mesh is written with.
+ * @param group_name Name of the group the mesh is written into.
+ * @param mesh_generator The mesh generator the mesh was computed with.
+ * @param vertex_ids The vertex IDs of the local cells.
+ * @param vertex_coordinates The coordinates of the local vertices.
+ */
+template <typename FileManager>
+void OutputWriter::WriteMeshTopology(
+    FileManager &file_manager, std::string const &group_name,
+    MeshGenerator const &mesh_generator,
+    std::vector<unsigned long long int> const &vertex_ids,
+    std::vector<double> const &vertex_coordinates) const {
+  // Open mesh topology group
+  file_manager.OpenGroup(group_name);
+
+  /** Vertex IDs */
   // Reserve storage for the vertex IDs dataset and define hyperslab positions
-  hdf5_manager_.ReserveDataspace("VertexIDs", global_dimensions_vertex_ids,
-                                 local_dimensions_vertex_ids,
-                                 start_index_vertex_ids, H5T_NATIVE_ULLONG);
+  file_manager.ReserveDataspace(
+      "VertexIDs", mesh_generator.GetGlobalDimensionsOfVertexIDs(),
+      mesh_generator.GetLocalDimensionsOfVertexIDs(),
+      mesh_generator.GetLocalVertexIDsStartIndex(), H5T_NATIVE_ULLONG);
   // Write data to the dataset
-  hdf5_manager_.WriteDatasetToDataspace(
+  file_manager.WriteDatasetToDataspace(
       "VertexIDs", mesh_generator.GetVertexIDsName(), vertex_ids.data());
   // Release the memory for the dataset
-  hdf5_manager_.CloseDataset("VertexIDs");
+  file_manager.CloseDataset("VertexIDs");
 
   /** Vertex coordinates */
-  // Define the hdf5 dataset properties for vertex coordinates
-  std::vector<hsize_t> const global_dimensions_vertex_coordinates =
-      mesh_generator.GetGlobalDimensionsOfVertexCoordinates();
-  std::vector<hsize_t> const local_dimensions_vertex_coordinates =
-      mesh_generator.GetLocalDimensionsOfVertexCoordinates();
-  hsize_t const start_index_vertex_coordinates =
-      mesh_generator.GetLocalVertexCoordinatesStartIndex();
-
-  // Declare the vector where the vertex coordinates are written into. The
-  // vector is not initialized with a certain size since done inside of the mesh
-  // generator
-  std::vector<double> vertex_coordinates;
-  // Compute the vertex coordinates
-  mesh_generator.ComputeVertexCoordinates(vertex_coordinates);
   // Reserve storage for the vertex coordinates dataset and define hyperslab
   // positions
-  hdf5_manager_.ReserveDataspace(
-      "VertexCoordinates", global_dimensions_vertex_coordinates,
-      local_dimensions_vertex_coordinates, start_index_vertex_coordinates,
-      H5T_NATIVE_DOUBLE);
+  file_manager.ReserveDataspace(
+      "VertexCoordinates",
+      mesh_generator.GetGlobalDimensionsOfVertexCoordinates(),
+      mesh_generator.GetLocalDimensionsOfVertexCoordinates(),
+      mesh_generator.GetLocalVertexCoordinatesStartIndex(), H5T_NATIVE_DOUBLE);
   // Write data to the dataset
-  hdf5_manager_.WriteDatasetToDataspace(
+  file_manager.WriteDatasetToDataspace(
       "VertexCoordinates", mesh_generator.GetVertexCoordinatesName(),
       vertex_coordinates.data());
 
-  /** 2.4 Close domain group (automatically closes open datasets) */
-  hdf5_manager_.CloseGroup();
+  /** Close domain group (automatically closes open datasets) */
+  file_manager.CloseGroup();
+}
+
+/**
+ * @brief Writes the cell data of all active quantities into a new group of the
+ * open hdf5 file or ADIOS2 step.
+ * @param file_manager The hdf5 or ADIOS2 manager the data is written with.
+ * @param group_name Name of the group the cell data is written into.
+ * @param mesh_generator The mesh generator to be used for the output.
+ * @param output_type Type of the output that is considered (standard,
+ * interface, debug).
+ * @return The largest size of the staging buffers of the cell data in bytes.
+ */
+template <typename FileManager>
+std::size_t OutputWriter::WriteCellDataGroup(
+    FileManager &file_manager, std::string const &group_name,
+    MeshGenerator const &mesh_generator, OutputType const output_type) const {
 
-  /** Write cell fields into the hdf5 file */
   /** Open group where cell data is written to*/
-  hdf5_manager_.OpenGroup("cell_data");
+  file_manager.OpenGroup(group_name);
 
   /** Define parameters used for all cell fields */
   // Local nodes that are written to the hdf5 file by the current rank
@@ -359,32 +828,34 @@ void OutputWriter::WriteHdf5File(double const output_time,
   // Data vector for each quantity (not initialized here. Size is assigned in
   // the dimension loop)
   std::vector<double> cell_data;
+  // Largest size of the buffers of a fused computation of several quantities
+  std::size_t fused_cell_data_bytes = 0;
 
   // Loop through all different material quantities dimensions
   for (auto const &[dimensions, quantity_indices] :
        material_quantities_dimension_map_) {
 
-    // Data vector for each cell data (done here to avoid multiple calls to
-    // allocate and deallocate memory in each quantity)
-    cell_data.resize(local_number_of_cells * dimensions[0] * dimensions[1]);
-
     // Reserve the dataset dataspace for all quantities of this dimension
     std::vector<hsize_t> const global_dimensions(
         {global_number_of_cells, dimensions[0], dimensions[1]});
     std::vector<hsize_t> const local_dimensions(
         {local_number_of_cells, dimensions[0], dimensions[1]});
-    hdf5_manager_.ReserveDataspace("BlockCellData", global_dimensions,
-                                   local_dimensions, local_cells_start_index,
-                                   H5T_NATIVE_DOUBLE);
-
-    // Loop through all quantities with the given dimension
-    for (auto const &quantity_index : quantity_indices) {
-      // Obtain the correct output quantity
-      auto const &output_quantity = material_output_quantities_[quantity_index];
-      // Check if the quantity is active for the given output type
-      if (output_quantity->IsActive(output_type)) {
-        // Change behavior of file writing dependent on output type
-        if (output_type == OutputType::Debug) {
+    file_manager.ReserveDataspace("BlockCellData", global_dimensions,
+                                  local_dimensions, local_cells_start_index,
+                                  H5T_NATIVE_DOUBLE);
+
+    // Change behavior of file writing dependent on output type
+    if (output_type == OutputType::Debug) {
+      // Data vector for each cell data (done here to avoid multiple calls to
+      // allocate and deallocate memory in each quantity)
+      cell_data.resize(local_number_of_cells * dimensions[0] * dimensions[1]);
+      // Loop through all quantities with the given dimension
+      for (auto const &quantity_index : quantity_indices) {
+        // Obtain the correct output quantity
+        auto const &output_quantity =
+            material_output_quantities_[quantity_index];
+        // Check if the quantity is active for the given output type
+        if (output_quantity->IsActive(output_type)) {
           // Loop through all materials given in the current simulation
           for (size_t material_index = 0; material_index < number_of_materials_;
                material_index++) {
@@ -392,24 +863,48 @@ void OutputWriter::WriteHdf5File(double const output_time,
             output_quantity->ComputeDebugCellData(local_nodes, cell_data,
                                                   ITM(material_index));
             // Open the dataset with the appropriate name
-            hdf5_manager_.WriteDatasetToDataspace(
-                "BlockCellData",
-                "material_" + std::to_string(material_index + 1) + "_" +
-                    output_quantity->GetName(),
-                cell_data.data());
+            WriteCellData(file_manager, "BlockCellData",
+                          "material_" + std::to_string(material_index + 1) +
+                              "_" + output_quantity->GetName(),
+                          cell_data, material_output_formats_[quantity_index]);
           }
-        } else {
-          // Compute the cell data of the given quantity
-          output_quantity->ComputeCellData(local_nodes, cell_data);
-          // Write data to hdf5 file
-          hdf5_manager_.WriteDatasetToDataspace(
-              "BlockCellData", output_quantity->GetName(), cell_data.data());
         }
       }
+    } else {
+      // All active quantities of this dimension are computed in a single pass
+      // over the nodes sharing intermediate fields, afterwards each is written
+      std::vector<unsigned int> active_indices;
+      std::vector<std::reference_wrapper<OutputQuantity const>>
+          active_quantities;
+      for (auto const &quantity_index : quantity_indices) {
+        if (material_output_quantities_[quantity_index]->IsActive(
+                output_type)) {
+          active_indices.push_back(quantity_index);
+          active_quantities.push_back(
+              *material_output_quantities_[quantity_index]);
+        }
+      }
+      // One data vector per quantity (all held until the pass is finished)
+      std::vector<std::vector<double>> fused_cell_data(
+          active_quantities.size(),
+          std::vector<double>(local_number_of_cells * dimensions[0] *
+                              dimensions[1]));
+      OutputQuantity::ComputeFusedCellData(active_quantities, local_nodes,
+                                           fused_cell_data);
+      std::size_t bytes = 0;
+      for (std::size_t index = 0; index < active_indices.size(); ++index) {
+        // Write data to hdf5 file
+        WriteCellData(file_manager, "BlockCellData",
+                      active_quantities[index].get().GetName(),
+                      fused_cell_data[index],
+                      material_output_formats_[active_indices[index]]);
+        bytes += CapacityBytes(fused_cell_data[index]);
+      }
+      fused_cell_data_bytes = std::max(fused_cell_data_bytes, bytes);
     }
 
     // Release the dataset dataspace
-    hdf5_manager_.CloseDataset("BlockCellData");
+    file_manager.CloseDataset("BlockCellData");
   }
 
   // Loop through all different material quantities dimensions
@@ -425,9 +920,9 @@ void OutputWriter::WriteHdf5File(double const output_time,
         {global_number_of_cells, dimensions[0], dimensions[1]});
     std::vector<hsize_t> const local_dimensions(
         {local_number_of_cells, dimensions[0], dimensions[1]});
-    hdf5_manager_.ReserveDataspace("InterfaceBlockCellData", global_dimensions,
-                                   local_dimensions, local_cells_start_index,
-                                   H5T_NATIVE_DOUBLE);
+    file_manager.ReserveDataspace("InterfaceBlockCellData", global_dimensions,
+                                  local_dimensions, local_cells_start_index,
+                                  H5T_NATIVE_DOUBLE);
 
     // Loop through all quantities with the given dimension
     for (auto const &quantity_index : quantity_indices) {
@@ -444,21 +939,20 @@ void OutputWriter::WriteHdf5File(double const output_time,
         }
 
         // Open the dataset with the appropriate name
-        hdf5_manager_.WriteDatasetToDataspace("InterfaceBlockCellData",
-                                              output_quantity->GetName(),
-                                              cell_data.data());
+        WriteCellData(file_manager, "InterfaceBlockCellData",
+                      output_quantity->GetName(), cell_data,
+                      interface_output_formats_[quantity_index]);
       }
     }
 
     // Release the dataset dataspace
-    hdf5_manager_.CloseDataset("InterfaceBlockCellData");
+    file_manager.CloseDataset("InterfaceBlockCellData");
   }
 
   /** Close group */
-  hdf5_manager_.CloseGroup();
+  file_manager.CloseGroup();
 
-  /** Closing the last HDF Ressources and write xdmf file */
-  hdf5_manager_.CloseFile();
+  return std::max(CapacityBytes(cell_data), fused_cell_data_bytes);
 }
 
 /**
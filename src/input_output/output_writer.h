@@ -22,11 +22,15 @@
 #ifndef OUTPUT_WRITER_H
 #define OUTPUT_WRITER_H
 
+#include <array>
 #include <map>
+#include <unordered_map>
 
+#include "input_output/adios2/adios2_manager.h"
 #include "input_output/hdf5/hdf5_manager.h"
 #include "input_output/input_reader/multi_resolution_reader/multi_resolution_reader.h"
 #include "input_output/input_reader/output_reader/output_reader.h"
+#include "input_output/output_writer/interface_surface_generator.h"
 #include "input_output/output_writer/mesh_generator.h"
 #include "input_output/output_writer/output_quantity.h"
 #include "materials/material_manager.h"
@@ -48,12 +52,20 @@ class OutputWriter {
   // Instance of the hdf5 file writer (cannot be const due to variable changes
   // during simulation, singleton allows constness of OutputWriter)
   Hdf5Manager &hdf5_manager_;
+  // Writer of the field outputs if the ADIOS2 backend is selected (nullptr:
+  // the field outputs are written with hdf5)
+  std::unique_ptr<Adios2Manager> const adios2_manager_;
 
-  // The different mesh generators for the standard, debug and interface output
-  // (vertexIDs and coordinates generation)
+  // The different mesh generators for the standard, debug, interface and
+  // monitoring output (vertexIDs and coordinates generation)
   std::unique_ptr<MeshGenerator const> const standard_mesh_generator_;
   std::unique_ptr<MeshGenerator const> const debug_mesh_generator_;
   std::unique_ptr<MeshGenerator const> const interface_mesh_generator_;
+  std::unique_ptr<MeshGenerator const> const monitoring_mesh_generator_;
+  // Generator of the interface surface, which replaces the cell data of the
+  // interface output if present
+  std::unique_ptr<InterfaceSurfaceGenerator const> const
+      interface_surface_generator_;
 
   // vector containing all output quantities used for the output (unique_ptr
   // since it is the base class) In general both vectors can be used in one
@@ -63,6 +75,10 @@ class OutputWriter {
       material_output_quantities_;
   std::vector<std::unique_ptr<OutputQuantity const>> const
       interface_output_quantities_;
+  // Precision and compression of the datasets of each output quantity (same
+  // order as the quantities)
+  std::vector<OutputDatasetFormat> const material_output_formats_;
+  std::vector<OutputDatasetFormat> const interface_output_formats_;
 
   // Map that provides the dimensionalization information of all quantities
   // (allows single vector allocations for quantities with same dimensions)
@@ -71,23 +87,82 @@ class OutputWriter {
   std::map<std::array<unsigned int, 2>, std::vector<unsigned int>> const
       interface_quantities_dimension_map_;
 
-  // local functions to write the hdf5 and xdmf files
-  void WriteHdf5File(double const output_time, std::string const &hdf5_filename,
-                     MeshGenerator const &mesh_generator,
-                     OutputType const output_type) const;
+  /**
+   * @brief Location of a mesh in the written hdf5 files together with the
+   * topology epoch it belongs to ( see MeshGenerator::GetMeshEpoch ).
+   */
+  struct WrittenMesh {
+    std::array<unsigned int, 2> epoch_ = {0, 0};
+    std::string hdf5_short_filename_;
+    std::string group_;
+  };
+  // Latest mesh of each output type written into one file per step
+  mutable std::unordered_map<OutputType, WrittenMesh> written_meshes_;
+
+  /**
+   * @brief State of a time series whose steps are written into shared hdf5
+   * files ( see Hdf5OutputSettings::StepsPerTimeSeriesFile ).
+   */
+  struct SharedFileTimeSeries {
+    unsigned int number_of_steps_ = 0;
+    unsigned int steps_in_file_ = 0;
+    std::string hdf5_filename_;
+    WrittenMesh mesh_;
+  };
+  // Shared file states of the time series (key: time series filename without
+  // extension)
+  mutable std::unordered_map<std::string, SharedFileTimeSeries>
+      shared_file_time_series_;
+
+  // local functions to write the hdf5 and xdmf files (the templates are
+  // instantiated for the hdf5 and the ADIOS2 manager)
+  template <typename FileManager>
+  void WriteCellData(FileManager &file_manager,
+                     std::string const &dataspace_name,
+                     std::string const &dataset_name,
+                     std::vector<double> const &cell_data,
+                     OutputDatasetFormat const &format) const;
+  WrittenMesh WriteHdf5File(double const output_time,
+                            std::string const &hdf5_filename,
+                            MeshGenerator const &mesh_generator,
+                            OutputType const output_type) const;
+  void
+  WriteSharedFileStep(double const output_time,
+                      std::string const &time_series_filename_without_extension,
+                      MeshGenerator const &mesh_generator,
+                      OutputType const output_type) const;
+  void WriteAdios2Step(double const output_time, std::string const &stream_name,
+                       MeshGenerator const &mesh_generator,
+                       OutputType const output_type) const;
+  template <typename FileManager>
+  void WriteMeshTopology(FileManager &file_manager,
+                         std::string const &group_name,
+                         MeshGenerator const &mesh_generator,
+                         std::vector<unsigned long long int> const &vertex_ids,
+                         std::vector<double> const &vertex_coordinates) const;
+  template <typename FileManager>
+  std::size_t WriteCellDataGroup(FileManager &file_manager,
+                                 std::string const &group_name,
+                                 MeshGenerator const &mesh_generator,
+                                 OutputType const output_type) const;
+  void WriteInterfaceSurface(
+      double const output_time, std::string const &filename_without_extension,
+      std::string const &time_series_filename_without_extension) const;
   void WriteXdmfTimeStepFile(double const output_time,
                              std::string const &hdf5_filename,
                              MeshGenerator const &mesh_generator,
-                             OutputType const output_type) const;
+                             OutputType const output_type,
+                             WrittenMesh const &mesh) const;
   void AppendToXdmfTimeSeriesFile(
       double const output_time, std::string const &hdf5_filename,
       MeshGenerator const &mesh_generator,
       std::string const &time_series_filename_without_extension,
-      OutputType const output_type) const;
-  std::string XdmfSpatialDataInformation(double const output_time,
-                                         std::string const &hdf5_short_filename,
-                                         MeshGenerator const &mesh_generator,
-                                         OutputType const output_type) const;
+      OutputType const output_type, WrittenMesh const &mesh) const;
+  std::string XdmfSpatialDataInformation(
+      double const output_time, std::string const &hdf5_short_filename,
+      MeshGenerator const &mesh_generator, OutputType const output_type,
+      WrittenMesh const &mesh,
+      std::string const &cell_data_group = "cell_data") const;
 
   // local factory functions
   std::map<std::array<unsigned int, 2>, std::vector<unsigned int>>
@@ -100,11 +175,17 @@ public:
       std::unique_ptr<MeshGenerator const> standard_mesh_generator,
       std::unique_ptr<MeshGenerator const> debug_mesh_generator,
       std::unique_ptr<MeshGenerator const> interface_mesh_generator,
+      std::unique_ptr<MeshGenerator const> monitoring_mesh_generator,
+      std::unique_ptr<InterfaceSurfaceGenerator const>
+          interface_surface_generator,
       std::vector<std::unique_ptr<OutputQuantity const>>
           material_output_quantities,
       std::vector<std::unique_ptr<OutputQuantity const>>
           interface_output_quantities,
-      unsigned int const number_of_materials);
+      std::vector<OutputDatasetFormat> material_output_formats,
+      std::vector<OutputDatasetFormat> interface_output_formats,
+      unsigned int const number_of_materials,
+      std::unique_ptr<Adios2Manager> adios2_manager = nullptr);
   ~OutputWriter() = default;
   OutputWriter(OutputWriter const &) = delete;
   OutputWriter &operator=(OutputWriter const &) = delete;
@@ -121,6 +202,14 @@ public:
       std::string const &time_series_filename_without_extension) const;
   void FinalizeTimeSeriesFile(
       std::string const &time_series_filename_without_extension) const;
+  // Function to write the slices of the in-situ analysis
+  void WriteSliceFile(double const output_time,
+                      std::string const &filename_without_extension,
+                      std::vector<InSituSlice> const &slices,
+                      std::vector<InSituSliceGrid> const &grids,
+                      std::vector<std::vector<double>> const &values) const;
+  // Function to wait for files still being written in the background
+  void WaitForPendingWrites() const;
 };
 
 #endif // OUTPUT_WRITER_H
@@ -0,0 +1,302 @@
+//===----------------- interface_surface_generator.cpp --------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/output_writer/interface_surface_generator.h"
+
+#include "input_output/output_writer/mesh_generator/mesh_generator_utilities.h"
+#include "input_output/utilities/xdmf_utilities.h"
+#include "topology/id_information.h"
+#include "utilities/vector_utilities.h"
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+// Offsets of the corners of a dual cell, indexed by x + 2 * y + 4 * z
+constexpr std::array<std::array<unsigned int, 3>, 8> corner_offsets = {
+    {{0, 0, 0},
+     {1, 0, 0},
+     {0, 1, 0},
+     {1, 1, 0},
+     {0, 0, 1},
+     {1, 0, 1},
+     {0, 1, 1},
+     {1, 1, 1}}};
+// Tetrahedra around the diagonal from corner 0 to 7 ( three dimensions )
+constexpr std::array<std::array<unsigned int, 4>, 6> cube_simplices = {
+    {{0, 7, 1, 3},
+     {0, 7, 3, 2},
+     {0, 7, 2, 6},
+     {0, 7, 6, 4},
+     {0, 7, 4, 5},
+     {0, 7, 5, 1}}};
+// Triangles around the diagonal from corner 0 to 3 ( two dimensions )
+constexpr std::array<std::array<unsigned int, 3>, 2> square_simplices = {
+    {{0, 1, 3}, {0, 3, 2}}};
+} // namespace
+
+/**
+ * @brief Constructor to create the interface surface generator.
+ * @param topology_manager Instance to provide node information on different
+ * ranks.
+ * @param flower Instance to provide node information of current rank.
+ * @param dimensionalized_node_size_on_level_zero Already dimensionalized size
+ * of a node on level zero.
+ */
+InterfaceSurfaceGenerator::InterfaceSurfaceGenerator(
+    TopologyManager const &topology_manager, Tree const &flower,
+    double const dimensionalized_node_size_on_level_zero)
+    : topology_(topology_manager), tree_(flower),
+      dimensionalized_node_size_on_level_zero_(
+          dimensionalized_node_size_on_level_zero) {
+  if constexpr (CC::DIM() == Dimension::One) {
+    throw std::logic_error(
+        "The interface surface output requires at least two dimensions!");
+  }
+}
+
+/**
+ * @brief Extracts the zero level-set of a single block and appends it to the
+ * given vectors. The level-set field is interpolated linearly on the simplices
+ * of the dual cells between the cell centers of the internal cells and the
+ * first halo cells on the upper side.
+ * @param levelset The level-set field of the block.
+ * @param block_origin Coordinates of the corner of the first internal cell.
+ * @param cell_size The size of the cells of the block.
+ * @param vertex_ids Vertex IDs of the surface elements, referring to the
+ * position in the vertex coordinates vector (indirect return).
+ * @param vertex_coordinates Coordinates ( x, y, z ) of the surface vertices
+ * (indirect return).
+ *
+ * @note Triangles are oriented such that their normal points towards positive
+ * level-set values.
+ */
+void InterfaceSurfaceGenerator::ExtractBlockSurface(
+    double const (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    std::array<double, 3> const &block_origin, double const cell_size,
+    std::vector<unsigned long long int> &vertex_ids,
+    std::vector<double> &vertex_coordinates) {
+  if constexpr (CC::DIM() == Dimension::One) {
+    return;
+  }
+
+  using Cell = std::array<unsigned int, 3>;
+  constexpr unsigned long long int cells_per_block =
+      MeshGeneratorUtilities::NumberOfTotalCellsPerBlock();
+
+  // Vertices are placed on the edges between two cell centers of different
+  // sign and shared by all elements of the block cutting the edge
+  std::unordered_map<unsigned long long int, unsigned long long int>
+      edge_vertices;
+  unsigned long long int const first_vertex = vertex_coordinates.size() / 3;
+
+  auto const value = [&levelset](Cell const &cell) {
+    return levelset[cell[0]][cell[1]][cell[2]];
+  };
+  auto const center = [&block_origin, cell_size](Cell const &cell) {
+    std::array<double, 3> coordinates = block_origin;
+    for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+      unsigned int const first_internal_cell =
+          d == 0 ? CC::FICX() : (d == 1 ? CC::FICY() : CC::FICZ());
+      coordinates[d] +=
+          (double(cell[d]) - double(first_internal_cell) + 0.5) * cell_size;
+    }
+    return coordinates;
+  };
+  auto const edge_vertex = [&](Cell const &first, Cell const &second) {
+    unsigned long long int const first_index =
+        (first[0] * CC::TCY() + first[1]) * CC::TCZ() + first[2];
+    unsigned long long int const second_index =
+        (second[0] * CC::TCY() + second[1]) * CC::TCZ() + second[2];
+    unsigned long long int const edge =
+        std::min(first_index, second_index) * cells_per_block +
+        std::max(first_index, second_index);
+    auto const [entry, inserted] =
+        edge_vertices.try_emplace(edge, first_vertex + edge_vertices.size());
+    if (inserted) {
+      double const weight = value(first) / (value(first) - value(second));
+      std::array<double, 3> const first_center = center(first);
+      std::array<double, 3> const second_center = center(second);
+      for (unsigned int d = 0; d < 3; ++d) {
+        vertex_coordinates.push_back(
+            first_center[d] + weight * (second_center[d] - first_center[d]));
+      }
+    }
+    return entry->second;
+  };
+  auto const vertex = [&vertex_coordinates](unsigned long long int const id) {
+    return std::array<double, 3>({vertex_coordinates[3 * id],
+                                  vertex_coordinates[3 * id + 1],
+                                  vertex_coordinates[3 * id + 2]});
+  };
+  auto const add_triangle =
+      [&](unsigned long long int const a, unsigned long long int b,
+          unsigned long long int c, std::array<double, 3> const &direction) {
+        std::array<double, 3> const origin = vertex(a);
+        if (VU::ScalarTripleProduct(VU::Difference(origin, vertex(b)),
+                                    VU::Difference(origin, vertex(c)),
+                                    direction) < 0.0) {
+          std::swap(b, c);
+        }
+        vertex_ids.insert(vertex_ids.end(), {a, b, c});
+      };
+
+  auto const extract_simplex = [&](auto const &corners) {
+    constexpr unsigned int number_of_corners =
+        std::tuple_size_v<std::decay_t<decltype(corners)>>;
+    std::array<Cell, number_of_corners> positive;
+    std::array<Cell, number_of_corners> negative;
+    unsigned int number_of_positive = 0;
+    unsigned int number_of_negative = 0;
+    for (Cell const &corner : corners) {
+      if (value(corner) > 0.0) {
+        positive[number_of_positive++] = corner;
+      } else {
+        negative[number_of_negative++] = corner;
+      }
+    }
+    if (number_of_positive == 0 || number_of_negative == 0) {
+      return;
+    }
+    // direction from the centroid of the negative to the one of the positive
+    // corners
+    std::array<double, 3> direction = {0.0, 0.0, 0.0};
+    for (Cell const &corner : corners) {
+      double const weight = value(corner) > 0.0 ? 1.0 / number_of_positive
+                                                : -1.0 / number_of_negative;
+      std::array<double, 3> const corner_center = center(corner);
+      for (unsigned int d = 0; d < 3; ++d) {
+        direction[d] += weight * corner_center[d];
+      }
+    }
+    if constexpr (number_of_corners == 3) {
+      // a single corner is separated from the other two by a line segment
+      Cell const &single = number_of_positive == 1 ? positive[0] : negative[0];
+      std::array<Cell, number_of_corners> const &others =
+          number_of_positive == 1 ? negative : positive;
+      vertex_ids.push_back(edge_vertex(single, others[0]));
+      vertex_ids.push_back(edge_vertex(single, others[1]));
+    } else if (number_of_positive == 1 || number_of_negative == 1) {
+      // a single corner is separated from the other three by a triangle
+      Cell const &single = number_of_positive == 1 ? positive[0] : negative[0];
+      std::array<Cell, number_of_corners> const &others =
+          number_of_positive == 1 ? negative : positive;
+      add_triangle(edge_vertex(single, others[0]),
+                   edge_vertex(single, others[1]),
+                   edge_vertex(single, others[2]), direction);
+    } else {
+      // two corners are separated from the other two by a quadrilateral
+      unsigned long long int const a = edge_vertex(positive[0], negative[0]);
+      unsigned long long int const b = edge_vertex(positive[0], negative[1]);
+      unsigned long long int const c = edge_vertex(positive[1], negative[1]);
+      unsigned long long int const d = edge_vertex(positive[1], negative[0]);
+      add_triangle(a, b, c, direction);
+      add_triangle(a, c, d, direction);
+    }
+  };
+
+  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+        std::array<Cell, 8> cube;
+        for (unsigned int c = 0; c < cube.size(); ++c) {
+          cube[c] = {i + corner_offsets[c][0], j + corner_offsets[c][1],
+                     CC::DIM() == Dimension::Three ? k + corner_offsets[c][2]
+                                                   : k};
+        }
+        if constexpr (CC::DIM() == Dimension::Three) {
+          for (auto const &simplex : cube_simplices) {
+            extract_simplex(
+                std::array<Cell, 4>({cube[simplex[0]], cube[simplex[1]],
+                                     cube[simplex[2]], cube[simplex[3]]}));
+          }
+        } else {
+          for (auto const &simplex : square_simplices) {
+            extract_simplex(std::array<Cell, 3>(
+                {cube[simplex[0]], cube[simplex[1]], cube[simplex[2]]}));
+          }
+        }
+      } // k
+    }   // j
+  }     // i
+}
+
+/**
+ * @brief Extracts the zero level-set of all interface leaves of the current
+ * rank ( reinitialized level-set field ).
+ * @param vertex_ids Vertex IDs of the surface elements, referring to the local
+ * vertex coordinates (indirect return).
+ * @param vertex_coordinates Coordinates ( x, y, z ) of the surface vertices
+ * (indirect return).
+ */
+void InterfaceSurfaceGenerator::ComputeLocalSurface(
+    std::vector<unsigned long long int> &vertex_ids,
+    std::vector<double> &vertex_coordinates) const {
+  vertex_ids.clear();
+  vertex_coordinates.clear();
+  for (nid_t const id : topology_.LocalInterfaceLeafIds()) {
+    double const block_size =
+        DomainSizeOfId(id, dimensionalized_node_size_on_level_zero_);
+    ExtractBlockSurface(
+        tree_.GetNodeWithId(id).GetInterfaceBlock().GetReinitializedBuffer(
+            InterfaceDescription::Levelset),
+        DomainCoordinatesOfId(id, block_size),
+        MeshGeneratorUtilities::CellSizeForBlockSize(block_size), vertex_ids,
+        vertex_coordinates);
+  }
+}
+
+/**
+ * @brief Returns the string used for the topology (vertex IDs).
+ * @param filename Name of the .hdf5 file where the actual data is found.
+ * @param group_name Name of the group the topology is written into.
+ * @param number_of_elements Global number of surface elements.
+ * @return Attribute string for the topology.
+ */
+std::string InterfaceSurfaceGenerator::GetXdmfTopologyString(
+    std::string const &filename, std::string const &group_name,
+    unsigned long long int const number_of_elements) const {
+  std::string const data_item(
+      "<DataItem NumberType=\"Int\" Format=\"HDF\" Dimensions=\"" +
+      std::to_string(number_of_elements) + " " +
+      std::to_string(VerticesPerElement()) + "\"> " + filename + ":/" +
+      group_name + "/" + vertex_ids_name_ + " </DataItem>\n");
+  return XdmfUtilities::SurfaceTopologyString(data_item, number_of_elements,
+                                              VerticesPerElement());
+}
+
+/**
+ * @brief Returns the string used for the geometry (vertex coordinates).
+ * @param filename Name of the .hdf5 file where the actual data is found.
+ * @param group_name Name of the group the geometry is written into.
+ * @param number_of_vertices Global number of surface vertices.
+ * @return Attribute string for the geometry.
+ */
+std::string InterfaceSurfaceGenerator::GetXdmfGeometryString(
+    std::string const &filename, std::string const &group_name,
+    unsigned long long int const number_of_vertices) const {
+  std::string const data_item("<DataItem Format=\"HDF\" NumberType=\"Float\" "
+                              "Precision=\"8\" Dimensions=\"" +
+                              std::to_string(number_of_vertices) + " 3\"> " +
+                              filename + ":/" + group_name + "/" +
+                              vertex_coordinates_name_ + " </DataItem>\n");
+  return XdmfUtilities::GeometryString(data_item, number_of_vertices);
+}
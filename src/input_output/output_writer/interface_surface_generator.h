@@ -0,0 +1,112 @@
+//===------------------ interface_surface_generator.h ---------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef INTERFACE_SURFACE_GENERATOR_H
+#define INTERFACE_SURFACE_GENERATOR_H
+
+#include "topology/topology_manager.h"
+#include "topology/tree.h"
+#include <array>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The InterfaceSurfaceGenerator extracts the zero level-set of all
+ * interface leaves as surface for the output, i.e. triangles in three and line
+ * segments in two dimensions. Within a block, the dual grid spanned by the cell
+ * centers is split into simplices ( six tetrahedra per cube, two triangles per
+ * square ), on which the zero level-set is linear. Each block covers the dual
+ * cells from its first internal cell center to the first halo cell center on
+ * the upper side, such that the surfaces of neighboring blocks on the same
+ * level join without gaps or overlaps. At resolution jumps the surfaces of the
+ * blocks on both sides do not match exactly. Vertices are shared between the
+ * elements of a block, but duplicated at block borders.
+ */
+class InterfaceSurfaceGenerator {
+
+  // Naming of the vertex IDs and coordinates in the final file
+  std::string const vertex_ids_name_ = "surface_vertex_IDs";
+  std::string const vertex_coordinates_name_ = "surface_vertex_coordinates";
+
+  // topology manager containing the global information of nodes
+  TopologyManager const &topology_;
+  // tree containing all local information of the nodes
+  Tree const &tree_;
+  // block size on level zero (already dimensionalized)
+  double const dimensionalized_node_size_on_level_zero_;
+
+public:
+  /**
+   * @brief Gives the number of vertices of a surface element.
+   * @return Three for triangles, two for line segments.
+   */
+  static constexpr unsigned int VerticesPerElement() {
+    return CC::DIM() == Dimension::Three ? 3 : 2;
+  }
+
+  InterfaceSurfaceGenerator() = delete;
+  explicit InterfaceSurfaceGenerator(
+      TopologyManager const &topology, Tree const &flower,
+      double const dimensionalized_node_size_on_level_zero);
+  ~InterfaceSurfaceGenerator() = default;
+  InterfaceSurfaceGenerator(InterfaceSurfaceGenerator const &) = delete;
+  InterfaceSurfaceGenerator &
+  operator=(InterfaceSurfaceGenerator const &) = delete;
+  InterfaceSurfaceGenerator(InterfaceSurfaceGenerator &&) = delete;
+  InterfaceSurfaceGenerator &operator=(InterfaceSurfaceGenerator &&) = delete;
+
+  static void
+  ExtractBlockSurface(double const (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()],
+                      std::array<double, 3> const &block_origin,
+                      double const cell_size,
+                      std::vector<unsigned long long int> &vertex_ids,
+                      std::vector<double> &vertex_coordinates);
+
+  void ComputeLocalSurface(std::vector<unsigned long long int> &vertex_ids,
+                           std::vector<double> &vertex_coordinates) const;
+
+  /**
+   * @brief Return the name of the vertex IDs to be used in the files.
+   * @return The name used for the vertex IDs.
+   */
+  std::string GetVertexIDsName() const { return vertex_ids_name_; }
+
+  /**
+   * @brief Return the name of the vertex coordinates to be used in the files.
+   * @return The name used for the vertex coordinates.
+   */
+  std::string GetVertexCoordinatesName() const {
+    return vertex_coordinates_name_;
+  }
+
+  // Creates the appropriate strings for the topology (vertex ids) and geometry
+  // (vertex coordinates)
+  std::string
+  GetXdmfTopologyString(std::string const &filename,
+                        std::string const &group_name,
+                        unsigned long long int const number_of_elements) const;
+  std::string
+  GetXdmfGeometryString(std::string const &filename,
+                        std::string const &group_name,
+                        unsigned long long int const number_of_vertices) const;
+};
+
+#endif // INTERFACE_SURFACE_GENERATOR_H
@@ -27,6 +27,7 @@
 #include "topology/topology_manager.h"
 #include "topology/tree.h"
 #include "unit_handler.h"
+#include <array>
 #include <hdf5.h>
 
 /**
@@ -105,6 +106,14 @@ protected:
    */
   virtual hsize_t DoGetLocalVertexCoordinatesStartIndex() const = 0;
 
+  /**
+   * @brief See public function for reference. By default, the mesh only
+   * depends on the leaves and their ranks.
+   */
+  virtual std::array<unsigned int, 2> DoGetMeshEpoch() const {
+    return {topology_.TopologyUpdateCount(), 0};
+  }
+
   // Constructor can only be called from derived classes
   explicit MeshGenerator(TopologyManager const &topology_manager,
                          Tree const &flower,
@@ -236,6 +245,14 @@ public:
     return vertex_coordinates_name_;
   }
 
+  /**
+   * @brief Gives the topology epoch of the mesh. The mesh is unchanged as long
+   * as the epoch is. The epoch is identical on all ranks.
+   * @return The topology update count and the material update count ( zero if
+   * the mesh does not depend on the materials of the nodes ).
+   */
+  std::array<unsigned int, 2> GetMeshEpoch() const { return DoGetMeshEpoch(); }
+
   // Functions to append vertex IDs and coordinatesS
   void ComputeVertexIDs(std::vector<unsigned long long int> &vertex_ids) const;
   void ComputeVertexCoordinates(std::vector<double> &vertex_coordinates) const;
@@ -0,0 +1,274 @@
+//===------------------ decimated_mesh_generator.cpp ----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/output_writer/mesh_generator/decimated_mesh_generator.h"
+#include "communication/mpi_utilities.h"
+#include "input_output/output_writer/mesh_generator/mesh_generator_utilities.h"
+#include "topology/id_information.h"
+#include <algorithm>
+
+/**
+ * @brief Constructor to create the decimated mesh generator.
+ * @param topology_manager Instance to provide node information on different
+ * ranks.
+ * @param flower Instance to provide node information of current rank.
+ * @param dimensionalized_node_size_on_level_zero Already dimensionalized size
+ * of a node on level zero.
+ * @param maximum_level Finest level that is written.
+ * @param region_of_interest Already dimensionalized lower and upper bound of
+ * the written region in each direction.
+ */
+DecimatedMeshGenerator::DecimatedMeshGenerator(
+    TopologyManager const &topology_manager, Tree const &flower,
+    double const dimensionalized_node_size_on_level_zero,
+    unsigned int const maximum_level,
+    std::array<std::array<double, 2>, 3> const &region_of_interest)
+    : MeshGenerator(topology_manager, flower,
+                    dimensionalized_node_size_on_level_zero),
+      maximum_level_(maximum_level), region_of_interest_(region_of_interest) {
+  /** Empty besides call of base class constructor */
+}
+
+/**
+ * @brief Checks whether the internal domain of a node intersects the region of
+ * interest (only in the directions of the simulation dimension).
+ * @param id The id of the node.
+ * @return True if the node intersects the region, false otherwise.
+ */
+bool DecimatedMeshGenerator::IsInRegionOfInterest(nid_t const id) const {
+  double const block_size =
+      DomainSizeOfId(id, dimensionalized_node_size_on_level_zero_);
+  std::array<double, 3> const block_origin =
+      DomainCoordinatesOfId(id, block_size);
+  for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+    if (block_origin[d] + block_size < region_of_interest_[d][0] ||
+        block_origin[d] > region_of_interest_[d][1]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Gives the ids of all nodes (on all ranks) that are written, i.e.,
+ * all leaves up to the maximum output level and the nodes on this level, both
+ * restricted to the region of interest.
+ * @return The ids of the written nodes.
+ * @note Relies on the global topology only. Hence, it can be called without
+ * communication, e.g., when only rank zero writes the xdmf file.
+ */
+std::vector<nid_t> DecimatedMeshGenerator::OutputIds() const {
+  std::vector<nid_t> output_ids;
+  unsigned int const finest_level =
+      std::min(maximum_level_, topology_.GetCurrentMaximumLevel());
+  for (unsigned int level = 0; level <= finest_level; ++level) {
+    for (nid_t const id : topology_.IdsOnLevel(level)) {
+      if ((level == maximum_level_ || topology_.NodeIsLeaf(id)) &&
+          IsInRegionOfInterest(id)) {
+        output_ids.push_back(id);
+      }
+    }
+  }
+  return output_ids;
+}
+
+/**
+ * @brief Gives the ids of the written nodes on the current rank in the order
+ * in which they are written.
+ * @return The ids of the local written nodes.
+ */
+std::vector<nid_t> DecimatedMeshGenerator::LocalOutputIds() const {
+  std::vector<nid_t> local_ids = OutputIds();
+  int const rank = MpiUtilities::MyRankId();
+  local_ids.erase(std::remove_if(local_ids.begin(), local_ids.end(),
+                                 [this, rank](nid_t const id) {
+                                   return topology_.GetRankOfNode(id) != rank;
+                                 }),
+                  local_ids.end());
+  std::sort(local_ids.begin(), local_ids.end());
+  return local_ids;
+}
+
+/**
+ * @brief Gives the number of written nodes on all ranks prior to the current
+ * one (global vectors are filled in the order rank0, rank1, ..., rankN).
+ * @return The offset of the current rank.
+ */
+unsigned long long int DecimatedMeshGenerator::LocalOutputOffset() const {
+  std::vector<nid_t> const output_ids = OutputIds();
+  int const rank = MpiUtilities::MyRankId();
+  return std::count_if(output_ids.begin(), output_ids.end(),
+                       [this, rank](nid_t const id) {
+                         return topology_.GetRankOfNode(id) < rank;
+                       });
+}
+
+/**
+ * @brief See base class implementation.
+ */
+std::vector<std::reference_wrapper<Node const>>
+DecimatedMeshGenerator::DoGetLocalNodes() const {
+  std::vector<std::reference_wrapper<Node const>> local_nodes;
+  for (nid_t const id : LocalOutputIds()) {
+    local_nodes.emplace_back(tree_.GetNodeWithId(id));
+  }
+  return local_nodes;
+}
+
+/**
+ * @brief See base class implementation.
+ */
+hsize_t DecimatedMeshGenerator::DoGetGlobalNumberOfCells() const {
+  return hsize_t(OutputIds().size()) *
+         MeshGeneratorUtilities::NumberOfInternalCellsPerBlock();
+}
+
+/**
+ * @brief See base class implementation.
+ */
+hsize_t DecimatedMeshGenerator::DoGetLocalNumberOfCells() const {
+  return hsize_t(LocalOutputIds().size()) *
+         MeshGeneratorUtilities::NumberOfInternalCellsPerBlock();
+}
+
+/**
+ * @brief See base class implementation.
+ */
+hsize_t DecimatedMeshGenerator::DoGetLocalCellsStartIndex() const {
+  return hsize_t(LocalOutputOffset()) *
+         MeshGeneratorUtilities::NumberOfInternalCellsPerBlock();
+}
+
+/**
+ * @brief See base class implementation.
+ */
+std::vector<hsize_t>
+DecimatedMeshGenerator::DoGetGlobalDimensionsOfVertexCoordinates() const {
+  return {hsize_t(OutputIds().size()) *
+              MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock(),
+          hsize_t(3)};
+}
+
+/**
+ * @brief See base class implementation.
+ */
+std::vector<hsize_t>
+DecimatedMeshGenerator::DoGetLocalDimensionsOfVertexCoordinates() const {
+  return {hsize_t(LocalOutputIds().size()) *
+              MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock(),
+          hsize_t(3)};
+}
+
+/**
+ * @brief See base class implementation.
+ */
+hsize_t DecimatedMeshGenerator::DoGetLocalVertexCoordinatesStartIndex() const {
+  return hsize_t(LocalOutputOffset()) *
+         MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock();
+}
+
+/**
+ * @brief See base class definition.
+ */
+void DecimatedMeshGenerator::DoComputeVertexCoordinates(
+    std::vector<double> &vertex_coordinates) const {
+
+  std::vector<nid_t> const local_ids = LocalOutputIds();
+  // resize the vector to ensure enough memory for the cooridnates ( x,y,z
+  // coordinates for each vertex )
+  vertex_coordinates.resize(
+      local_ids.size() *
+      MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * 3);
+
+  // Compute the correct coordinates of the vertices
+  std::size_t vertex_counter = 0;
+  for (auto const &id : local_ids) {
+    double const block_size =
+        DomainSizeOfId(id, dimensionalized_node_size_on_level_zero_);
+    double const cell_size =
+        MeshGeneratorUtilities::CellSizeForBlockSize(block_size);
+    std::array<double, 3> block_origin = DomainCoordinatesOfId(id, block_size);
+    for (unsigned int k = 0; k <= CC::ICZ(); ++k) {
+      for (unsigned int j = 0; j <= CC::ICY(); ++j) {
+        for (unsigned int i = 0; i <= CC::ICX(); ++i) {
+          vertex_coordinates[vertex_counter] =
+              block_origin[0] + double(i) * cell_size;
+          vertex_coordinates[vertex_counter + 1] =
+              block_origin[1] + double(j) * cell_size;
+          vertex_coordinates[vertex_counter + 2] =
+              block_origin[2] + double(k) * cell_size;
+          vertex_counter += 3;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief See base class definition.
+ */
+void DecimatedMeshGenerator::DoComputeVertexIDs(
+    std::vector<unsigned long long int> &vertex_ids) const {
+  std::size_t const number_of_local_nodes = LocalOutputIds().size();
+  // Global offset between ranks
+  unsigned long long int const offset = LocalOutputOffset();
+  // Resize Vertex ID vector ( 8 vertices span one cell )
+  vertex_ids.resize(number_of_local_nodes *
+                    MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() *
+                    8);
+  unsigned long long int vertex_id_counter = 0;
+  // Vertices are numbered with increasing x, then y and then z (see
+  // InterfaceMeshGenerator)
+  constexpr unsigned int j_ids_skew = (CC::ICX() + 1);
+  constexpr unsigned int k_ids_skew = (CC::ICX() + 1) * (CC::ICY() + 1);
+
+  for (unsigned int node_counter = 0; node_counter < number_of_local_nodes;
+       node_counter++) {
+    // Shift index for correct indexing in the global mesh
+    unsigned long long int const shift =
+        (node_counter + offset) *
+        MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock();
+    for (unsigned int k = 0; k < CC::ICZ(); ++k) {
+      for (unsigned int j = 0; j < CC::ICY(); ++j) {
+        for (unsigned int i = 0; i < CC::ICX(); ++i) {
+          // Add all vertices for one cell
+          vertex_ids[vertex_id_counter] =
+              i + j * j_ids_skew + k * k_ids_skew + shift;
+          vertex_ids[vertex_id_counter + 1] =
+              (i + 1) + j * j_ids_skew + k * k_ids_skew + shift;
+          vertex_ids[vertex_id_counter + 2] =
+              (i + 1) + (j + 1) * j_ids_skew + k * k_ids_skew + shift;
+          vertex_ids[vertex_id_counter + 3] =
+              i + (j + 1) * j_ids_skew + k * k_ids_skew + shift;
+          vertex_ids[vertex_id_counter + 4] =
+              i + j * j_ids_skew + (k + 1) * k_ids_skew + shift;
+          vertex_ids[vertex_id_counter + 5] =
+              (i + 1) + j * j_ids_skew + (k + 1) * k_ids_skew + shift;
+          vertex_ids[vertex_id_counter + 6] =
+              (i + 1) + (j + 1) * j_ids_skew + (k + 1) * k_ids_skew + shift;
+          vertex_ids[vertex_id_counter + 7] =
+              i + (j + 1) * j_ids_skew + (k + 1) * k_ids_skew + shift;
+          vertex_id_counter += 8;
+        }
+      }
+    }
+  }
+}
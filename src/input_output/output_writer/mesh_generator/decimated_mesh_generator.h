@@ -0,0 +1,86 @@
+//===------------------- decimated_mesh_generator.h -----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef DECIMATED_MESH_GENERATOR_H
+#define DECIMATED_MESH_GENERATOR_H
+
+#include "input_output/output_writer/mesh_generator.h"
+#include <array>
+#include <hdf5.h>
+
+/**
+ * @brief The DecimatedMeshGenerator generates a mesh for the output (currently
+ * xdmf + hdf5) with a limited resolution in a region of interest. Leaves on a
+ * level up to the maximum output level are written as they are. Finer leaves
+ * are represented by their ancestor on the maximum output level, which holds
+ * the multiresolution averages of its descendants. Only nodes intersecting the
+ * region of interest are written. As for the interface mesh, the mesh is
+ * ambiguous, i.e., the vertices at block borders are duplicated.
+ */
+class DecimatedMeshGenerator : public MeshGenerator {
+
+  // Variable specification from the base class
+  using MeshGenerator::dimensionalized_node_size_on_level_zero_;
+  using MeshGenerator::topology_;
+  using MeshGenerator::tree_;
+
+  // finest level that is written
+  unsigned int const maximum_level_;
+  // (dimensionalized) lower and upper bound of the region in each direction
+  std::array<std::array<double, 2>, 3> const region_of_interest_;
+
+  bool IsInRegionOfInterest(nid_t const id) const;
+  std::vector<nid_t> OutputIds() const;
+  std::vector<nid_t> LocalOutputIds() const;
+  unsigned long long int LocalOutputOffset() const;
+
+  // virtual functions required from the base class to compute data to hdf5 file
+  void DoComputeVertexIDs(
+      std::vector<unsigned long long int> &vertex_ids) const override;
+  void DoComputeVertexCoordinates(
+      std::vector<double> &vertex_coordinates) const override;
+
+  // virtual dimension functions required from base class
+  std::vector<std::reference_wrapper<Node const>>
+  DoGetLocalNodes() const override;
+  hsize_t DoGetGlobalNumberOfCells() const override;
+  hsize_t DoGetLocalNumberOfCells() const override;
+  hsize_t DoGetLocalCellsStartIndex() const override;
+  std::vector<hsize_t>
+  DoGetGlobalDimensionsOfVertexCoordinates() const override;
+  std::vector<hsize_t> DoGetLocalDimensionsOfVertexCoordinates() const override;
+  hsize_t DoGetLocalVertexCoordinatesStartIndex() const override;
+
+public:
+  DecimatedMeshGenerator() = delete;
+  explicit DecimatedMeshGenerator(
+      TopologyManager const &topology, Tree const &flower,
+      double const dimensionalized_node_size_on_level_zero,
+      unsigned int const maximum_level,
+      std::array<std::array<double, 2>, 3> const &region_of_interest);
+  virtual ~DecimatedMeshGenerator() = default;
+  DecimatedMeshGenerator(DecimatedMeshGenerator const &) = delete;
+  DecimatedMeshGenerator &operator=(DecimatedMeshGenerator const &) = delete;
+  DecimatedMeshGenerator(DecimatedMeshGenerator &&) = delete;
+  DecimatedMeshGenerator &operator=(DecimatedMeshGenerator &&) = delete;
+};
+
+#endif // DECIMATED_MESH_GENERATOR_H
@@ -49,6 +49,14 @@ InterfaceMeshGenerator::DoGetLocalNodes() const {
   return tree_.InterfaceLeaves();
 }
 
+/**
+ * @brief See base class implementation. The interface leaves change with the
+ * materials of the nodes.
+ */
+std::array<unsigned int, 2> InterfaceMeshGenerator::DoGetMeshEpoch() const {
+  return {topology_.TopologyUpdateCount(), topology_.MaterialUpdateCount()};
+}
+
 /**
  * @brief See base class implementation.
  */
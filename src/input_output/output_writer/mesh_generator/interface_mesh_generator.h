@@ -59,6 +59,7 @@ class InterfaceMeshGenerator : public MeshGenerator {
   DoGetGlobalDimensionsOfVertexCoordinates() const override;
   std::vector<hsize_t> DoGetLocalDimensionsOfVertexCoordinates() const override;
   hsize_t DoGetLocalVertexCoordinatesStartIndex() const override;
+  std::array<unsigned int, 2> DoGetMeshEpoch() const override;
 
 public:
   InterfaceMeshGenerator() = delete;
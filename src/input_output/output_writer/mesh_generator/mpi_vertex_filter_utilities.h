@@ -20,6 +20,7 @@
 //
 //===----------------------------------------------------------------------===//
 #include <functional>
+#include <limits>
 
 #include "communication/mpi_utilities.h"
 #include "topology/id_information.h"
@@ -28,6 +29,44 @@ namespace MpiVertexFilter {
 
 enum class Direction { X, Y, Z };
 
+// placeholder for boundary vertices which are not received from a neighbor
+constexpr unsigned long long int unset_vertex_id_ =
+    std::numeric_limits<unsigned long long int>::max();
+
+/**
+ * @brief Part of a boundary buffer that is exchanged between two leaves. All
+ * blocks exchanged between two ranks are combined into a single message.
+ */
+struct BoundaryBlock {
+  // position of the leaf pair in the sorted send/receive list of the rank
+  std::size_t position_;
+  // absolute address of the first vertex ID of the block
+  MPI_Aint address_;
+  // layout of the block in memory
+  MPI_Datatype type_;
+};
+
+/**
+ * @brief Gives the boundaries of a leaf which are sent and received,
+ * respectively, for the given axis.
+ * @param direction Axis along which to send/receive.
+ * @return The send and the receive location.
+ */
+std::pair<BoundaryLocation, BoundaryLocation>
+SendRecvLocations(Direction const direction) {
+  switch (direction) {
+  case Direction::X: {
+    return {BoundaryLocation::West, BoundaryLocation::East};
+  }
+  case Direction::Y: {
+    return {BoundaryLocation::South, BoundaryLocation::North};
+  }
+  default: /* Direction::Z */ {
+    return {BoundaryLocation::Bottom, BoundaryLocation::Top};
+  }
+  }
+}
+
 /**
  * @brief Initializes and sorts lists of send/receive pairs of leaves for each
  * rank.
@@ -45,7 +84,7 @@ void InitializeSendRecvRankLists(
     TopologyManager const &topology) {
 
   int max_rank = 0;
-  MPI_Comm_size(MPI_COMM_WORLD, &max_rank);
+  MPI_Comm_size(MpiUtilities::Communicator(), &max_rank);
 
   // init array with empty vectors
   for (int r = 0; r < max_rank; r++) {
@@ -54,22 +93,7 @@ void InitializeSendRecvRankLists(
   }
 
   // init send recv direction
-  BoundaryLocation send_direction;
-  BoundaryLocation recv_direction;
-  switch (direction) {
-  case Direction::X: {
-    send_direction = BoundaryLocation::West;
-    recv_direction = BoundaryLocation::East;
-  } break;
-  case Direction::Y: {
-    send_direction = BoundaryLocation::South;
-    recv_direction = BoundaryLocation::North;
-  } break;
-  default: /* Direction::Z */ {
-    send_direction = BoundaryLocation::Bottom;
-    recv_direction = BoundaryLocation::Top;
-  }
-  }
+  auto const [send_direction, recv_direction] = SendRecvLocations(direction);
 
   // iterate over all leaves to get target ranks
   for (nid_t const &node_id : local_leaf_ids) {
@@ -186,23 +210,23 @@ void LoadBoundaryBuffer(unsigned long long int const *cell_vertex_ids,
 }
 
 /**
- * @brief Sends specified buffer to all nodes out of a list using MPI.
+ * @brief Adds the parts of the specified buffer which are sent to the nodes out
+ * of a list to the messages of the respective ranks.
  * @param node_id ID of node to send from.
- * @param send_list_id_leveldiff List of node IDs paired with the tree
- * leveldifference to node_id to send data to.
+ * @param send_id_list List of node IDs to send data to.
  * @param send_buffer Buffer containing data to send.
  * @param direction Axis defining direction of communication.
  * @param send_list_per_rank List of total communications of MPI rank to define
- * a MPI tag.
- * @param mpi_send_request_list All MPI request get appended to this list.
+ * the position of a block in the message.
+ * @param send_blocks_per_rank The blocks sent to each rank (indirect return).
  * @param topology The topology to get information about the MPI status of the
  * simulation.
  */
-void SendFromNode(
+void AddSendBlocks(
     nid_t const node_id, std::vector<nid_t> const &send_id_list,
     unsigned long long int const *send_buffer, Direction const direction,
     std::vector<std::vector<std::pair<nid_t, nid_t>>> const &send_list_per_rank,
-    std::vector<MPI_Request> &mpi_send_request_list,
+    std::vector<std::vector<BoundaryBlock>> &send_blocks_per_rank,
     TopologyManager const &topology) {
 
   unsigned int cell_count_axis_1 = 1;
@@ -318,46 +342,50 @@ void SendFromNode(
       MPI_Type_vector(buf_size_2, 1, stride, mpi_stride_type, &mpi_block_type);
       MPI_Type_free(&mpi_stride_type);
     }
-    MPI_Type_commit(&mpi_block_type);
 
-    // send buffer
+    // add block to the message of the target rank
     int const target_rank = topology.GetRankOfNode(target_id);
     std::pair<nid_t, nid_t> const target_source_id(target_id, node_id);
-    std::vector<std::pair<nid_t, nid_t>> const send_list_target_rank =
+    std::vector<std::pair<nid_t, nid_t>> const &send_list_target_rank =
         send_list_per_rank[target_rank];
-    // look up rank in send_list; use its position as tag
-    int const tag = std::distance(send_list_target_rank.begin(),
-                                  lower_bound(send_list_target_rank.begin(),
-                                              send_list_target_rank.end(),
-                                              target_source_id)) %
-                    MpiUtilities::MpiTagUb();
-
-    int rank;
-    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-
-    mpi_send_request_list.push_back(MPI_Request());
-    MPI_Isend(send_buffer + local_send_buffer_offset, 1, mpi_block_type,
-              target_rank, tag, MPI_COMM_WORLD, &mpi_send_request_list.back());
-    MPI_Type_free(&mpi_block_type);
+    // look up pair in send_list; its position defines the order in the message
+    std::size_t const position = std::distance(
+        send_list_target_rank.begin(),
+        std::lower_bound(send_list_target_rank.begin(),
+                         send_list_target_rank.end(), target_source_id));
+    MPI_Aint address;
+    MPI_Get_address(send_buffer + local_send_buffer_offset, &address);
+    send_blocks_per_rank[target_rank].push_back(
+        {position, address, mpi_block_type});
   }
 }
 
 /**
- * @brief Receive from a list of nodes into specified buffer.
+ * @brief Adds the parts received from the nodes out of a list to the messages
+ * of the respective ranks. Each node of the list gets its own staging buffer
+ * laid out as the boundary buffer of the receiving node.
  * @param node_id ID of receiving node.
- * @param recv_list_id_leveldiff List of node IDs paired with the tree
- * leveldifference to node_id to receive data from.
- * @param boundary_buffer Buffer to write received data into.
+ * @param recv_id_list List of node IDs to receive data from.
+ * @param staging_buffers Buffers to write received data into. Parts which are
+ * not received keep the value unset_vertex_id_.
+ * @param boundary_size Number of vertex IDs in one boundary buffer.
+ * @param number_of_used_buffers Number of the already used staging buffers,
+ * increased for every node the data is received from (indirect return).
  * @param direction Axis defining direction of communication.
  * @param recv_list_per_rank List of total communications of MPI rank to define
- * a MPI tag.
+ * the position of a block in the message.
+ * @param recv_blocks_per_rank The blocks received from each rank (indirect
+ * return).
  * @param topology The topology to get information about the MPI status of the
  * simulation.
  */
-void RecvToNode(
+void AddRecvBlocks(
     nid_t const node_id, std::vector<nid_t> const &recv_id_list,
-    unsigned long long int *boundary_buffer, Direction const direction,
+    std::vector<unsigned long long int> &staging_buffers,
+    unsigned int const boundary_size, std::size_t &number_of_used_buffers,
+    Direction const direction,
     std::vector<std::vector<std::pair<nid_t, nid_t>>> const &recv_list_per_rank,
+    std::vector<std::vector<BoundaryBlock>> &recv_blocks_per_rank,
     TopologyManager const &topology) {
 
   unsigned int cell_count_axis_1 = 1;
@@ -467,22 +495,154 @@ void RecvToNode(
       MPI_Type_vector(buf_size_2, 1, stride, mpi_stride_type, &mpi_insert_type);
       MPI_Type_free(&mpi_stride_type);
     }
-    MPI_Type_commit(&mpi_insert_type);
-    std::vector<std::pair<nid_t, nid_t>> const recv_list_source_rank =
+    std::vector<std::pair<nid_t, nid_t>> const &recv_list_source_rank =
         recv_list_per_rank[source_rank];
     std::pair<nid_t, nid_t> const target_source_id(node_id, source_id);
-    // look up location in recv list for tag
-    int const tag =
-        distance(recv_list_source_rank.begin(),
-                 lower_bound(recv_list_source_rank.begin(),
-                             recv_list_source_rank.end(), target_source_id)) %
-        MpiUtilities::MpiTagUb();
-    // recv data
-    int rank;
-    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-    MPI_Recv(boundary_buffer + buffer_insert_offset, 1, mpi_insert_type,
-             source_rank, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-    MPI_Type_free(&mpi_insert_type);
+    // look up pair in recv list; its position defines the order in the message
+    std::size_t const position = std::distance(
+        recv_list_source_rank.begin(),
+        std::lower_bound(recv_list_source_rank.begin(),
+                         recv_list_source_rank.end(), target_source_id));
+    unsigned long long int *const staging_buffer =
+        staging_buffers.data() + number_of_used_buffers * boundary_size;
+    number_of_used_buffers++;
+    MPI_Aint address;
+    MPI_Get_address(staging_buffer + buffer_insert_offset, &address);
+    recv_blocks_per_rank[source_rank].push_back(
+        {position, address, mpi_insert_type});
+  }
+}
+
+/**
+ * @brief Combines blocks into a single MPI datatype. The blocks are ordered by
+ * their position in the send/receive list, which is identical on the sending
+ * and on the receiving rank. The datatypes of the single blocks are released.
+ * @param blocks The blocks to be combined.
+ * @return The committed datatype (relative to MPI_BOTTOM).
+ */
+MPI_Datatype CombinedBlockType(std::vector<BoundaryBlock> &blocks) {
+  std::sort(blocks.begin(), blocks.end(),
+            [](BoundaryBlock const &a, BoundaryBlock const &b) {
+              return a.position_ < b.position_;
+            });
+  std::vector<int> block_lengths(blocks.size(), 1);
+  std::vector<MPI_Aint> addresses;
+  std::vector<MPI_Datatype> types;
+  addresses.reserve(blocks.size());
+  types.reserve(blocks.size());
+  for (BoundaryBlock const &block : blocks) {
+    addresses.push_back(block.address_);
+    types.push_back(block.type_);
+  }
+  MPI_Datatype combined_type;
+  MPI_Type_create_struct(static_cast<int>(blocks.size()), block_lengths.data(),
+                         addresses.data(), types.data(), &combined_type);
+  MPI_Type_commit(&combined_type);
+  for (BoundaryBlock &block : blocks) {
+    MPI_Type_free(&block.type_);
+  }
+  return combined_type;
+}
+
+/**
+ * @brief Exchanges the boundary vertex IDs of all local leaves with their
+ * neighbors along one axis. All blocks exchanged between two ranks are
+ * aggregated into one non-blocking message in each direction.
+ * @param send_buffers Boundaries of the local leaves which are sent, one
+ * after another in the order of the local leaves.
+ * @param boundary_buffers Boundaries of the local leaves which are received,
+ * filled with the own vertex IDs beforehand (indirect return).
+ * @param boundary_size Number of vertex IDs in one boundary buffer.
+ * @param local_leaf_ids List of all leaves of calling MPI rank.
+ * @param direction Axis along which to send/receive.
+ * @param topology The topology to get information about the MPI status of the
+ * simulation.
+ * @note Received IDs are inserted in the order of the neighbor lists, hence
+ * the result does not depend on the order in which messages arrive.
+ */
+void ExchangeBoundaries(std::vector<unsigned long long int> const &send_buffers,
+                        std::vector<unsigned long long int> &boundary_buffers,
+                        unsigned int const boundary_size,
+                        std::vector<nid_t> const &local_leaf_ids,
+                        Direction const direction,
+                        TopologyManager const &topology) {
+
+  int const number_of_ranks = MpiUtilities::NumberOfRanks();
+  std::vector<std::vector<std::pair<nid_t, nid_t>>> send_list_per_rank(
+      number_of_ranks);
+  std::vector<std::vector<std::pair<nid_t, nid_t>>> recv_list_per_rank(
+      number_of_ranks);
+  InitializeSendRecvRankLists(send_list_per_rank, recv_list_per_rank,
+                              local_leaf_ids, direction, topology);
+
+  // one staging buffer for every leaf pair data is received for
+  std::size_t number_of_recv_pairs = 0;
+  for (auto const &recv_list : recv_list_per_rank) {
+    number_of_recv_pairs += recv_list.size();
+  }
+  std::vector<unsigned long long int> staging_buffers(
+      number_of_recv_pairs * boundary_size, unset_vertex_id_);
+  // the staging buffers of a leaf follow each other
+  std::vector<std::size_t> first_staging_buffer_of_leaf(
+      local_leaf_ids.size() + 1, 0);
+  std::size_t number_of_used_buffers = 0;
+
+  auto const [send_location, recv_location] = SendRecvLocations(direction);
+  std::vector<std::vector<BoundaryBlock>> send_blocks_per_rank(number_of_ranks);
+  std::vector<std::vector<BoundaryBlock>> recv_blocks_per_rank(number_of_ranks);
+  for (std::size_t leaf_index = 0; leaf_index < local_leaf_ids.size();
+       leaf_index++) {
+    nid_t const node_id = local_leaf_ids[leaf_index];
+    AddSendBlocks(node_id,
+                  topology.GetNeighboringLeaves(node_id, send_location),
+                  send_buffers.data() + leaf_index * boundary_size, direction,
+                  send_list_per_rank, send_blocks_per_rank, topology);
+    first_staging_buffer_of_leaf[leaf_index] = number_of_used_buffers;
+    AddRecvBlocks(
+        node_id, topology.GetNeighboringLeaves(node_id, recv_location),
+        staging_buffers, boundary_size, number_of_used_buffers, direction,
+        recv_list_per_rank, recv_blocks_per_rank, topology);
+  }
+  first_staging_buffer_of_leaf.back() = number_of_used_buffers;
+
+  // one message per rank pair, the direction serves as tag
+  int const tag = static_cast<int>(direction);
+  std::vector<MPI_Request> requests;
+  for (int rank = 0; rank < number_of_ranks; ++rank) {
+    if (!recv_blocks_per_rank[rank].empty()) {
+      MPI_Datatype recv_type = CombinedBlockType(recv_blocks_per_rank[rank]);
+      requests.push_back(MPI_Request());
+      MPI_Irecv(MPI_BOTTOM, 1, recv_type, rank, tag,
+                MpiUtilities::Communicator(), &requests.back());
+      MPI_Type_free(&recv_type);
+    }
+  }
+  for (int rank = 0; rank < number_of_ranks; ++rank) {
+    if (!send_blocks_per_rank[rank].empty()) {
+      MPI_Datatype send_type = CombinedBlockType(send_blocks_per_rank[rank]);
+      requests.push_back(MPI_Request());
+      MPI_Isend(MPI_BOTTOM, 1, send_type, rank, tag,
+                MpiUtilities::Communicator(), &requests.back());
+      MPI_Type_free(&send_type);
+    }
+  }
+  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+  // insert the received IDs in the order of the neighbor lists
+  for (std::size_t leaf_index = 0; leaf_index < local_leaf_ids.size();
+       leaf_index++) {
+    unsigned long long int *const boundary_buffer =
+        boundary_buffers.data() + leaf_index * boundary_size;
+    for (std::size_t buffer = first_staging_buffer_of_leaf[leaf_index];
+         buffer < first_staging_buffer_of_leaf[leaf_index + 1]; ++buffer) {
+      unsigned long long int const *const staging_buffer =
+          staging_buffers.data() + buffer * boundary_size;
+      for (unsigned int i = 0; i < boundary_size; ++i) {
+        if (staging_buffer[i] != unset_vertex_id_) {
+          boundary_buffer[i] = staging_buffer[i];
+        }
+      }
+    }
   }
 }
 } // namespace MpiVertexFilter
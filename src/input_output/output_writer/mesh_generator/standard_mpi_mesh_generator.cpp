@@ -39,7 +39,8 @@ StandardMpiMeshGenerator::StandardMpiMeshGenerator(
     bool const mpi_filtering_active)
     : MeshGenerator(topology_manager, flower,
                     dimensionalized_node_size_on_level_zero),
-      mpi_filtering_active_(mpi_filtering_active) {
+      mpi_filtering_active_(mpi_filtering_active),
+      vertex_id_cache_(std::make_unique<VertexIdCache>()) {
   /** Empty besides call of base class constructor */
 }
 
@@ -150,9 +151,20 @@ void StandardMpiMeshGenerator::DoComputeVertexCoordinates(
 
 /**
  * @brief See base class definition.
+ *
+ * @note The filtered vertex IDs are reused as long as the topology is not
+ * changed. As the topology is identical on all ranks, either all or none of
+ * the ranks take part in the mpi routine.
  */
 void StandardMpiMeshGenerator::DoComputeVertexIDs(
     std::vector<unsigned long long int> &vertex_ids) const {
+  if (mpi_filtering_active_ && vertex_id_cache_->valid_ &&
+      vertex_id_cache_->topology_update_count_ ==
+          topology_.TopologyUpdateCount()) {
+    vertex_ids = vertex_id_cache_->vertex_ids_;
+    return;
+  }
+
   /************************************************************************/
   /** 1. Create full set of vertices */
   // Local leave definitions
@@ -225,6 +237,9 @@ void StandardMpiMeshGenerator::DoComputeVertexIDs(
   // present in the grid
   if (mpi_filtering_active_) {
     FilterVertexIDs(vertex_ids, leave_offset);
+    vertex_id_cache_->vertex_ids_ = vertex_ids;
+    vertex_id_cache_->topology_update_count_ = topology_.TopologyUpdateCount();
+    vertex_id_cache_->valid_ = true;
   }
 }
 
@@ -238,68 +253,42 @@ void StandardMpiMeshGenerator::FilterVertexIDs(
     std::vector<unsigned long long int> &vertex_ids,
     std::vector<unsigned long long int> const &leave_offset) const {
 
-  // create list of send vectors to each other rank; this is introduced to deal
-  // with the creation of tags
-  std::vector<std::vector<std::pair<nid_t, nid_t>>> send_list_per_rank(
-      MpiUtilities::NumberOfRanks());
-  std::vector<std::vector<std::pair<nid_t, nid_t>>> recv_list_per_rank(
-      MpiUtilities::NumberOfRanks());
-  std::vector<MPI_Request>
-      mpi_send_request_list; // vector to track all send requests
   std::vector<nid_t> const local_leaf_ids =
       topology_.LocalLeafIds(); // get local leaves
   unsigned int const number_of_local_leaves = local_leaf_ids.size();
 
   // x-Direction ( send West to East )
-  MpiVertexFilter::InitializeSendRecvRankLists(
-      send_list_per_rank, recv_list_per_rank, local_leaf_ids,
-      MpiVertexFilter::Direction::X, topology_);
   unsigned int const x_boundary_size = (CC::ICZ() + 1) * (CC::ICY() + 1);
-  // init send buffer for sends; exact size unknown -> size is upper bound
+  // Buffers for the west (send) and the east (receive) boundary of all leaves
   std::vector<unsigned long long int> send_buffers(number_of_local_leaves *
                                                    x_boundary_size);
-
-  // send data
+  std::vector<unsigned long long int> boundary_buffers(number_of_local_leaves *
+                                                       x_boundary_size);
   for (unsigned int leaf_index = 0; leaf_index < number_of_local_leaves;
        leaf_index++) {
-    nid_t node_id = local_leaf_ids[leaf_index];
-    unsigned int send_buffer_offset = leaf_index * x_boundary_size;
+    unsigned int const buffer_offset = leaf_index * x_boundary_size;
     unsigned long long int const vertex_offset = leave_offset[leaf_index];
     unsigned int const vertex_id_jump_y = 8 * CC::ICX();
     unsigned int const vertex_id_jump_z = 8 * CC::ICX() * CC::ICY();
     // load inner points
     MpiVertexFilter::LoadBoundaryBuffer(
-        vertex_ids.data() + vertex_offset,
-        send_buffers.data() + send_buffer_offset, vertex_id_jump_y,
-        vertex_id_jump_z, CC::ICY(), CC::ICZ(), 0, 3, 4, 7);
-    // send data to all ranks necesarry
-    MpiVertexFilter::SendFromNode(
-        node_id,
-        topology_.GetNeighboringLeaves(node_id, BoundaryLocation::West),
-        send_buffers.data() + send_buffer_offset, MpiVertexFilter::Direction::X,
-        send_list_per_rank, mpi_send_request_list, topology_);
-  }
-
-  // recv data
-  for (unsigned int leaf_index = 0; leaf_index < local_leaf_ids.size();
-       leaf_index++) {
-    nid_t const node_id = local_leaf_ids[leaf_index];
-    std::vector<unsigned long long int> east_boundary_points(x_boundary_size);
-    unsigned long long int const vertex_offset =
-        leave_offset[leaf_index] + 8 * (CC::ICX() - 1);
-    unsigned int const vertex_id_jump_y = 8 * CC::ICX();
-    unsigned int const vertex_id_jump_z = 8 * CC::ICX() * CC::ICY();
+        vertex_ids.data() + vertex_offset, send_buffers.data() + buffer_offset,
+        vertex_id_jump_y, vertex_id_jump_z, CC::ICY(), CC::ICZ(), 0, 3, 4, 7);
     // init east vetrices
     MpiVertexFilter::LoadBoundaryBuffer(
-        vertex_ids.data() + vertex_offset, east_boundary_points.data(),
-        vertex_id_jump_y, vertex_id_jump_z, CC::ICY(), CC::ICZ(), 1, 2, 5, 6);
-    // receive data for node
-    MpiVertexFilter::RecvToNode(
-        node_id,
-        topology_.GetNeighboringLeaves(node_id, BoundaryLocation::East),
-        east_boundary_points.data(), MpiVertexFilter::Direction::X,
-        recv_list_per_rank, topology_);
+        vertex_ids.data() + vertex_offset + 8 * (CC::ICX() - 1),
+        boundary_buffers.data() + buffer_offset, vertex_id_jump_y,
+        vertex_id_jump_z, CC::ICY(), CC::ICZ(), 1, 2, 5, 6);
+  }
+
+  MpiVertexFilter::ExchangeBoundaries(send_buffers, boundary_buffers,
+                                      x_boundary_size, local_leaf_ids,
+                                      MpiVertexFilter::Direction::X, topology_);
 
+  for (unsigned int leaf_index = 0; leaf_index < number_of_local_leaves;
+       leaf_index++) {
+    unsigned long long int const *const east_boundary_points =
+        boundary_buffers.data() + leaf_index * x_boundary_size;
     // insert east boundary into cell vertices; iterate over every boundary
     // block
     for (unsigned int k = 0; k < CC::ICZ(); k++) {
@@ -320,65 +309,40 @@ void StandardMpiMeshGenerator::FilterVertexIDs(
     }
   }
 
-  // wait for all messages from x direction
-  MPI_Waitall(mpi_send_request_list.size(), mpi_send_request_list.data(),
-              MPI_STATUSES_IGNORE);
-
   // y direction ( send South to North )
-  unsigned int const y_boundary_size = (CC::ICZ() + 1) * (CC::ICX() + 1);
-
   if constexpr (CC::DIM() !=
                 Dimension::One) { // in one-dimensional case no communication
                                   // along the y-axis is needed
 
-    MpiVertexFilter::InitializeSendRecvRankLists(
-        send_list_per_rank, recv_list_per_rank, local_leaf_ids,
-        MpiVertexFilter::Direction::Y, topology_);
-    mpi_send_request_list.clear();
-    if (x_boundary_size != y_boundary_size) // only init new sendbuffer if size
-                                            // differs from existing one
-      send_buffers.resize(number_of_local_leaves * y_boundary_size);
+    unsigned int const y_boundary_size = (CC::ICZ() + 1) * (CC::ICX() + 1);
+    send_buffers.resize(number_of_local_leaves * y_boundary_size);
+    boundary_buffers.resize(number_of_local_leaves * y_boundary_size);
     for (unsigned int leaf_index = 0; leaf_index < number_of_local_leaves;
          leaf_index++) {
-      nid_t const node_id = local_leaf_ids[leaf_index];
-      unsigned int const send_buffer_offset = leaf_index * y_boundary_size;
+      unsigned int const buffer_offset = leaf_index * y_boundary_size;
       unsigned long long int const vertex_offset = leave_offset[leaf_index];
       unsigned int const vertex_id_jump_x = 8;
       unsigned int const vertex_id_jump_z = 8 * CC::ICX() * CC::ICY();
       // load into buffer
+      MpiVertexFilter::LoadBoundaryBuffer(vertex_ids.data() + vertex_offset,
+                                          send_buffers.data() + buffer_offset,
+                                          vertex_id_jump_x, vertex_id_jump_z,
+                                          CC::ICX(), CC::ICZ(), 0, 1, 4, 5);
+      // init north vetrices
       MpiVertexFilter::LoadBoundaryBuffer(
-          vertex_ids.data() + vertex_offset,
-          send_buffers.data() + send_buffer_offset, vertex_id_jump_x,
-          vertex_id_jump_z, CC::ICX(), CC::ICZ(), 0, 1, 4, 5);
-
-      // send data to all ranks necessary
-      MpiVertexFilter::SendFromNode(
-          node_id,
-          topology_.GetNeighboringLeaves(node_id, BoundaryLocation::South),
-          send_buffers.data() + send_buffer_offset,
-          MpiVertexFilter::Direction::Y, send_list_per_rank,
-          mpi_send_request_list, topology_);
+          vertex_ids.data() + vertex_offset + 8 * CC::ICX() * (CC::ICY() - 1),
+          boundary_buffers.data() + buffer_offset, vertex_id_jump_x,
+          vertex_id_jump_z, CC::ICX(), CC::ICZ(), 3, 2, 7, 6);
     }
 
-    // recv all data
-    for (unsigned int leaf_index = 0; leaf_index < local_leaf_ids.size();
+    MpiVertexFilter::ExchangeBoundaries(
+        send_buffers, boundary_buffers, y_boundary_size, local_leaf_ids,
+        MpiVertexFilter::Direction::Y, topology_);
+
+    for (unsigned int leaf_index = 0; leaf_index < number_of_local_leaves;
          leaf_index++) {
-      nid_t const node_id = local_leaf_ids[leaf_index];
-      // init north vetrices
-      std::vector<unsigned long long int> north_boundary_points(
-          y_boundary_size);
-      unsigned long long int const vertex_offset =
-          leave_offset[leaf_index] + 8 * CC::ICX() * (CC::ICY() - 1);
-      unsigned int const vertex_id_jump_x = 8;
-      unsigned int const vertex_id_jump_z = 8 * CC::ICX() * CC::ICY();
-      MpiVertexFilter::LoadBoundaryBuffer(
-          vertex_ids.data() + vertex_offset, north_boundary_points.data(),
-          vertex_id_jump_x, vertex_id_jump_z, CC::ICX(), CC::ICZ(), 3, 2, 7, 6);
-      MpiVertexFilter::RecvToNode(
-          node_id,
-          topology_.GetNeighboringLeaves(node_id, BoundaryLocation::North),
-          north_boundary_points.data(), MpiVertexFilter::Direction::Y,
-          recv_list_per_rank, topology_);
+      unsigned long long int const *const north_boundary_points =
+          boundary_buffers.data() + leaf_index * y_boundary_size;
       // insert north boundary into cell vertices; iterate over every boundary
       // block
       for (unsigned int k = 0; k < CC::ICZ(); k++) {
@@ -398,63 +362,41 @@ void StandardMpiMeshGenerator::FilterVertexIDs(
         }
       }
     }
-
-    MPI_Waitall(mpi_send_request_list.size(), mpi_send_request_list.data(),
-                MPI_STATUSES_IGNORE);
   } // if Dim != 1
 
   // z-direction ( send Bottom to Top )
   if constexpr (CC::DIM() == Dimension::Three) {
 
-    MpiVertexFilter::InitializeSendRecvRankLists(
-        send_list_per_rank, recv_list_per_rank, local_leaf_ids,
-        MpiVertexFilter::Direction::Z, topology_);
-    mpi_send_request_list.clear();
     unsigned int const z_boundary_size = (CC::ICX() + 1) * (CC::ICY() + 1);
-    if (y_boundary_size != z_boundary_size)
-      send_buffers.resize(number_of_local_leaves * z_boundary_size);
+    send_buffers.resize(number_of_local_leaves * z_boundary_size);
+    boundary_buffers.resize(number_of_local_leaves * z_boundary_size);
     for (unsigned int leaf_index = 0; leaf_index < number_of_local_leaves;
          leaf_index++) {
-      nid_t const node_id = local_leaf_ids[leaf_index];
-      // Do MPI communication of boundaries
-      unsigned int const send_buffer_offset = leaf_index * z_boundary_size;
-      // load inner points
+      unsigned int const buffer_offset = leaf_index * z_boundary_size;
       unsigned long long int const vertex_offset = leave_offset[leaf_index];
       unsigned int const vertex_id_jump_x = 8;
       unsigned int const vertex_id_jump_y = 8 * CC::ICX();
+      // load inner points
+      MpiVertexFilter::LoadBoundaryBuffer(vertex_ids.data() + vertex_offset,
+                                          send_buffers.data() + buffer_offset,
+                                          vertex_id_jump_x, vertex_id_jump_y,
+                                          CC::ICX(), CC::ICY(), 0, 1, 3, 2);
+      // init top vertices
       MpiVertexFilter::LoadBoundaryBuffer(
-          vertex_ids.data() + vertex_offset,
-          send_buffers.data() + send_buffer_offset, vertex_id_jump_x,
-          vertex_id_jump_y, CC::ICX(), CC::ICY(), 0, 1, 3, 2);
-      // send data to all ranks necessary
-      MpiVertexFilter::SendFromNode(
-          node_id,
-          topology_.GetNeighboringLeaves(node_id, BoundaryLocation::Bottom),
-          send_buffers.data() + send_buffer_offset,
-          MpiVertexFilter::Direction::Z, send_list_per_rank,
-          mpi_send_request_list, topology_);
+          vertex_ids.data() + vertex_offset +
+              8 * CC::ICX() * CC::ICY() * (CC::ICZ() - 1),
+          boundary_buffers.data() + buffer_offset, vertex_id_jump_x,
+          vertex_id_jump_y, CC::ICX(), CC::ICY(), 4, 5, 7, 6);
     }
 
-    // recv all data
-    for (unsigned int leaf_index = 0; leaf_index < local_leaf_ids.size();
-         leaf_index++) {
-      nid_t const node_id = local_leaf_ids[leaf_index];
-      // init boundary buffer
-      std::vector<unsigned long long int> top_boundary_points(z_boundary_size);
+    MpiVertexFilter::ExchangeBoundaries(
+        send_buffers, boundary_buffers, z_boundary_size, local_leaf_ids,
+        MpiVertexFilter::Direction::Z, topology_);
 
-      unsigned long long int const vertex_offset =
-          leave_offset[leaf_index] +
-          8 * CC::ICX() * CC::ICY() * (CC::ICZ() - 1);
-      unsigned int const vertex_id_jump_x = 8;
-      unsigned int const vertex_id_jump_y = 8 * CC::ICX();
-      MpiVertexFilter::LoadBoundaryBuffer(
-          vertex_ids.data() + vertex_offset, top_boundary_points.data(),
-          vertex_id_jump_x, vertex_id_jump_y, CC::ICX(), CC::ICY(), 4, 5, 7, 6);
-      MpiVertexFilter::RecvToNode(
-          node_id,
-          topology_.GetNeighboringLeaves(node_id, BoundaryLocation::Top),
-          top_boundary_points.data(), MpiVertexFilter::Direction::Z,
-          recv_list_per_rank, topology_);
+    for (unsigned int leaf_index = 0; leaf_index < number_of_local_leaves;
+         leaf_index++) {
+      unsigned long long int const *const top_boundary_points =
+          boundary_buffers.data() + leaf_index * z_boundary_size;
       // insert boundary buffer into cell vertices; iterate over every boundary
       // block
       for (unsigned int j = 0; j < CC::ICY(); j++) {
@@ -475,8 +417,5 @@ void StandardMpiMeshGenerator::FilterVertexIDs(
         }
       }
     }
-    // wait for communication in z direction to be completed
-    MPI_Waitall(mpi_send_request_list.size(), mpi_send_request_list.data(),
-                MPI_STATUSES_IGNORE);
   } // if Dim == 3
 }
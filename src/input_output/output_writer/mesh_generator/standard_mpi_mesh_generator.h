@@ -24,6 +24,7 @@
 
 #include "input_output/output_writer/mesh_generator.h"
 #include <hdf5.h>
+#include <memory>
 
 /**
  * @brief The StandardMpiMeshGenerator generates a mesh for the output
@@ -33,7 +34,8 @@
  * coordinates) using a mpi-routine. If the mpi-routine is not used double
  * placed vertices will be present in the output. The mesh represents the
  * current multi-resolution situation including jumps between different blocks.
- * Only leaf nodes are written.
+ * Only leaf nodes are written. The filtered vertex IDs are kept until the
+ * topology changes, hence repeated outputs on the same mesh skip the filtering.
  */
 class StandardMpiMeshGenerator : public MeshGenerator {
 
@@ -42,8 +44,20 @@ class StandardMpiMeshGenerator : public MeshGenerator {
   using MeshGenerator::topology_;
   using MeshGenerator::tree_;
 
+  /**
+   * @brief Filtered vertex IDs of the local leaves together with the state of
+   * the topology they have been computed for.
+   */
+  struct VertexIdCache {
+    bool valid_ = false;
+    unsigned int topology_update_count_ = 0;
+    std::vector<unsigned long long int> vertex_ids_;
+  };
+
   // self defined member variables
   bool const mpi_filtering_active_;
+  // the generator itself is immutable, hence the cache is held indirectly
+  std::unique_ptr<VertexIdCache> const vertex_id_cache_;
 
   // virtual functions required from the base class to compute data to hdf5 file
   void DoComputeVertexIDs(
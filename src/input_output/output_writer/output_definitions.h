@@ -22,7 +22,9 @@
 #ifndef OUTPUT_DEFINITIONS_H
 #define OUTPUT_DEFINITIONS_H
 
+#include <array>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "utilities/string_operations.h"
@@ -38,14 +40,163 @@ enum class OutputTimesType { Off, Interval, Stamps, IntervalStamps };
 
 /**
  * @brief The OutputType defines the type of output which is written (standard,
- * interface and debug).
+ * interface, debug and monitoring). The monitoring output is a decimated
+ * standard output (limited resolution and region).
  */
 // AB 2020-03-23 Do not change underlying type and indices. Used for mapping of
 // correct array position.
 enum class OutputType : unsigned short {
   Standard = 0,
   Interface = 1,
-  Debug = 2
+  Debug = 2,
+  Monitoring = 3
+};
+
+/**
+ * @brief The OutputCompressionType defines the filter that is applied to the
+ * datasets of an output quantity. (Off: No compression). (Deflate: Lossless
+ * compression with byte shuffling and deflate). (Zfp: Lossy compression with
+ * the ZFP filter plugin in fixed-accuracy mode).
+ */
+enum class OutputCompressionType { Off, Deflate, Zfp };
+
+/**
+ * @brief The OutputPrecision defines the floating-point precision the datasets
+ * of an output quantity are written with.
+ */
+enum class OutputPrecision { Single, Double };
+
+/**
+ * @brief The OutputBackend defines the library the field outputs are written
+ * with. (Hdf5: One hdf5 file per output together with xdmf files). (Adios2:
+ * One ADIOS2 stream per time series holding each output as a step, requires a
+ * build with ADIOS2).
+ */
+enum class OutputBackend { Hdf5, Adios2 };
+
+/**
+ * @brief The Adios2Engine defines the ADIOS2 engine the streams are written
+ * with. (BP5: Aggregated files written asynchronously). (SST: Staging of the
+ * steps to readers running concurrently, e.g., on separate nodes).
+ */
+enum class Adios2Engine { BP5, SST };
+
+/**
+ * @brief The InSituOperation defines how the values of an output quantity are
+ * reduced over the domain in the in-situ analysis. (Integral: Volume integral).
+ * (SquaredIntegral: Volume integral of the squared value, e.g., enstrophy from
+ * the vorticity). (Mean: Volume average). (Minimum/Maximum: Extreme value of
+ * all cells).
+ */
+enum class InSituOperation {
+  Integral,
+  SquaredIntegral,
+  Mean,
+  Minimum,
+  Maximum
+};
+
+/**
+ * @brief Gives the size of a value of the given precision.
+ * @param precision The output precision.
+ * @return Number of bytes of a value.
+ */
+constexpr unsigned int OutputPrecisionInBytes(OutputPrecision const precision) {
+  return precision == OutputPrecision::Single ? 4 : 8;
+}
+
+/**
+ * @brief The OutputCompression bundles the filter and its parameters used for
+ * the datasets of an output quantity.
+ */
+struct OutputCompression {
+  OutputCompressionType type_ = OutputCompressionType::Off;
+  // compression level of the deflate filter (1 to 9)
+  unsigned int deflate_level_ = 4;
+  // absolute (dimensional) error bound of lossy filters
+  double error_bound_ = 0.0;
+};
+
+/**
+ * @brief The OutputDatasetFormat bundles how the datasets of an output quantity
+ * are stored in the hdf5 file.
+ */
+struct OutputDatasetFormat {
+  OutputPrecision precision_ = OutputPrecision::Double;
+  OutputCompression compression_;
+};
+
+/**
+ * @brief The Adios2Settings bundle the parameters of the ADIOS2 output backend.
+ */
+struct Adios2Settings {
+  Adios2Engine engine_ = Adios2Engine::BP5;
+  // number of ranks aggregating the data into subfiles (zero: ADIOS2 default)
+  unsigned int aggregators_ = 0;
+};
+
+/**
+ * @brief The InSituReduction defines a scalar evaluated over the whole domain
+ * in the in-situ analysis.
+ */
+struct InSituReduction {
+  // name of the output quantity the values are taken from
+  std::string quantity_name_;
+  // component of the quantity (row-major for matrix quantities)
+  unsigned int component_ = 0;
+  InSituOperation operation_ = InSituOperation::Integral;
+};
+
+/**
+ * @brief The InSituProbe defines the value of a single cell, i.e., the cell
+ * containing the probe point, recorded in the in-situ analysis.
+ */
+struct InSituProbe {
+  // name of the output quantity the values are taken from
+  std::string quantity_name_;
+  // component of the quantity (row-major for matrix quantities)
+  unsigned int component_ = 0;
+  // (dimensional) position of the probe
+  std::array<double, 3> point_ = {0.0, 0.0, 0.0};
+};
+
+/**
+ * @brief The InSituSlice defines an axis-aligned plane or line through the
+ * domain on which an output quantity is resampled to a uniform grid in the
+ * in-situ analysis.
+ */
+struct InSituSlice {
+  // name of the output quantity the values are taken from
+  std::string quantity_name_;
+  // component of the quantity (row-major for matrix quantities)
+  unsigned int component_ = 0;
+  // axes the slice extends along (two for planes, one for lines)
+  std::array<bool, 3> spanned_axes_ = {true, true, false};
+  // (dimensional) point on the slice, which fixes the coordinates of the axes
+  // that are not spanned
+  std::array<double, 3> point_ = {0.0, 0.0, 0.0};
+  // level of the uniform grid the values are resampled to
+  unsigned int level_ = 0;
+  // indicates whether a grayscale image is written in addition
+  bool image_ = false;
+};
+
+/**
+ * @brief The InSituSliceGrid describes the uniform grid an in-situ slice is
+ * resampled to.
+ */
+struct InSituSliceGrid {
+  // name of the resampled quantity (component)
+  std::string name_;
+  // spanned axes in ascending order
+  std::vector<unsigned int> axes_;
+  // number of grid cells along each spanned axis
+  std::vector<unsigned int> cells_;
+  // (dimensional) size of a grid cell
+  double cell_size_;
+  // (dimensional) lower corner of the grid, i.e., the slice point for the axes
+  // that are not spanned
+  std::array<double, 3> origin_;
 };
 
 /**
@@ -75,6 +226,9 @@ inline std::string OutputTypeToString(OutputType const type) {
   case OutputType::Debug: {
     return "Debug";
   }
+  case OutputType::Monitoring: {
+    return "Monitoring";
+  }
   default: {
     throw std::logic_error("Output type is not known!");
   }
@@ -106,4 +260,145 @@ inline OutputTimesType StringToOutputTimesType(std::string const &times_type) {
   }
 }
 
+/**
+ * @brief Gives the proper OutputCompression type for a given string.
+ * @param compression_type String that should be converted.
+ * @return Output compression type.
+ */
+inline OutputCompressionType
+StringToOutputCompressionType(std::string const &compression_type) {
+  // transform string to upper case without spaces
+  std::string const type_upper_case(
+      StringOperations::ToUpperCaseWithoutSpaces(compression_type));
+  // switch statements cannot be used with strings
+  if (type_upper_case == "OFF") {
+    return OutputCompressionType::Off;
+  } else if (type_upper_case == "DEFLATE") {
+    return OutputCompressionType::Deflate;
+  } else if (type_upper_case == "ZFP") {
+    return OutputCompressionType::Zfp;
+  } else {
+    throw std::logic_error("Output compression type '" + type_upper_case +
+                           "' not known!");
+  }
+}
+
+/**
+ * @brief Gives the proper OutputPrecision for a given string.
+ * @param precision String that should be converted.
+ * @return Output precision.
+ */
+inline OutputPrecision StringToOutputPrecision(std::string const &precision) {
+  // transform string to upper case without spaces
+  std::string const precision_upper_case(
+      StringOperations::ToUpperCaseWithoutSpaces(precision));
+  // switch statements cannot be used with strings
+  if (precision_upper_case == "SINGLE") {
+    return OutputPrecision::Single;
+  } else if (precision_upper_case == "DOUBLE") {
+    return OutputPrecision::Double;
+  } else {
+    throw std::logic_error("Output precision '" + precision_upper_case +
+                           "' not known!");
+  }
+}
+
+/**
+ * @brief Converts a string to its corresponding output backend.
+ * @param backend The backend as string.
+ * @return Backend identifier.
+ */
+inline OutputBackend StringToOutputBackend(std::string const &backend) {
+  // transform string to upper case without spaces
+  std::string const backend_upper_case(
+      StringOperations::ToUpperCaseWithoutSpaces(backend));
+  // switch statements cannot be used with strings
+  if (backend_upper_case == "HDF5") {
+    return OutputBackend::Hdf5;
+  } else if (backend_upper_case == "ADIOS2") {
+    return OutputBackend::Adios2;
+  } else {
+    throw std::logic_error("Output backend '" + backend_upper_case +
+                           "' not known!");
+  }
+}
+
+/**
+ * @brief Converts a string to its corresponding ADIOS2 engine.
+ * @param engine The engine as string.
+ * @return Engine identifier.
+ */
+inline Adios2Engine StringToAdios2Engine(std::string const &engine) {
+  // transform string to upper case without spaces
+  std::string const engine_upper_case(
+      StringOperations::ToUpperCaseWithoutSpaces(engine));
+  // switch statements cannot be used with strings
+  if (engine_upper_case == "BP5") {
+    return Adios2Engine::BP5;
+  } else if (engine_upper_case == "SST") {
+    return Adios2Engine::SST;
+  } else {
+    throw std::logic_error("ADIOS2 engine '" + engine_upper_case +
+                           "' not known!");
+  }
+}
+
+/**
+ * @brief Converts the InSituOperation to its corresponding string (for logging
+ * and the column names of the time series).
+ * @param operation The in-situ operation identifier.
+ * @return String to be used.
+ */
+inline std::string InSituOperationToString(InSituOperation const operation) {
+
+  switch (operation) {
+  case InSituOperation::Integral: {
+    return "Integral";
+  }
+  case InSituOperation::SquaredIntegral: {
+    return "SquaredIntegral";
+  }
+  case InSituOperation::Mean: {
+    return "Mean";
+  }
+  case InSituOperation::Minimum: {
+    return "Minimum";
+  }
+  case InSituOperation::Maximum: {
+    return "Maximum";
+  }
+  default: {
+    throw std::logic_error("In-situ operation is not known!");
+  }
+  }
+}
+
+/**
+ * @brief Gives the proper InSituOperation for a given string.
+ * @param operation String that should be converted.
+ * @return In-situ operation.
+ */
+inline InSituOperation StringToInSituOperation(std::string const &operation) {
+  // transform string to upper case without spaces
+  std::string const operation_upper_case(
+      StringOperations::ToUpperCaseWithoutSpaces(operation));
+  // switch statements cannot be used with strings
+  if (operation_upper_case == "INTEGRAL") {
+    return InSituOperation::Integral;
+  } else if (operation_upper_case == "SQUAREDINTEGRAL") {
+    return InSituOperation::SquaredIntegral;
+  } else if (operation_upper_case == "MEAN") {
+    return InSituOperation::Mean;
+  } else if (operation_upper_case == "MINIMUM" ||
+             operation_upper_case == "MIN") {
+    return InSituOperation::Minimum;
+  } else if (operation_upper_case == "MAXIMUM" ||
+             operation_upper_case == "MAX") {
+    return InSituOperation::Maximum;
+  } else {
+    throw std::logic_error("In-situ operation '" + operation_upper_case +
+                           "' not known!");
+  }
+}
+
 #endif // OUTPUT_DEFINITIONS_H
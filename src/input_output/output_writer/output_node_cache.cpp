@@ -0,0 +1,176 @@
+//===----------------------- output_node_cache.cpp ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/output_writer/output_node_cache.h"
+
+#include "levelset/multi_phase_manager/material_sign_capsule.h"
+#include "stencils/stencil_utilities.h"
+
+/**
+ * @brief Constructs a cache bound to the given node.
+ * @param node The node the fields are computed for.
+ */
+OutputNodeCache::OutputNodeCache(Node const &node)
+    : node_(&node), has_velocity_(false), has_velocity_gradient_(false) {
+  /** Empty besides initializer list */
+}
+
+/**
+ * @brief Binds the cache to another node and invalidates all cached fields.
+ * @param node The node the fields are computed for.
+ */
+void OutputNodeCache::Bind(Node const &node) {
+  node_ = &node;
+  has_velocity_ = false;
+  has_velocity_gradient_ = false;
+}
+
+/**
+ * @brief Gives the node the cache is bound to.
+ * @return The node.
+ */
+Node const &OutputNodeCache::GetNode() const { return *node_; }
+
+/**
+ * @brief Computes the velocity of the real material in all cells of the node.
+ * Components that do not exist in the current dimension are zero.
+ */
+void OutputNodeCache::ComputeVelocity() {
+  Node const &node = *node_;
+  // For single-phase nodes both references point to the same buffer
+  PrimeStates const &positive_prime_states =
+      node.HasLevelset()
+          ? node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial())
+                .GetPrimeStateBuffer()
+          : node.GetPhaseByMaterial(node.GetSinglePhaseMaterial())
+                .GetPrimeStateBuffer();
+  PrimeStates const &negative_prime_states =
+      node.HasLevelset()
+          ? node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial())
+                .GetPrimeStateBuffer()
+          : positive_prime_states;
+  std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
+
+  for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+    for (unsigned int j = 0; j < CC::TCY(); ++j) {
+      for (unsigned int i = 0; i < CC::TCX(); ++i) {
+        PrimeStates const &prime_states = interface_tags[i][j][k] > 0
+                                              ? positive_prime_states
+                                              : negative_prime_states;
+        velocity_x_[i][j][k] = prime_states[PrimeState::VelocityX][i][j][k];
+        velocity_y_[i][j][k] =
+            CC::DIM() != Dimension::One
+                ? prime_states[PrimeState::VelocityY][i][j][k]
+                : 0.0;
+        velocity_z_[i][j][k] =
+            CC::DIM() == Dimension::Three
+                ? prime_states[PrimeState::VelocityZ][i][j][k]
+                : 0.0;
+      }
+    }
+  }
+  has_velocity_ = true;
+}
+
+/**
+ * @brief Computes the velocity gradient in all internal cells of the node with
+ * a fourth-order central difference.
+ */
+void OutputNodeCache::ComputeVelocityGradient() {
+  using DerivativeStencil = DerivativeStencilSetup::Concretize<
+      DerivativeStencils::FourthOrderCentralDifference>::type;
+  // Ensures the velocity is present
+  VelocityX();
+  double const cell_size = node_->GetCellSize();
+  for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+      for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+        velocity_gradient_[i - CC::FICX()][j - CC::FICY()][k - CC::FICZ()] =
+            SU::JacobianMatrix<DerivativeStencil>(
+                velocity_x_, velocity_y_, velocity_z_, i, j, k, cell_size);
+      }
+    }
+  }
+  has_velocity_gradient_ = true;
+}
+
+/**
+ * @brief Gives the velocity of the real material in x-direction in all cells.
+ * @return The velocity buffer.
+ */
+double const (&OutputNodeCache::VelocityX())[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  if (!has_velocity_) {
+    ComputeVelocity();
+  }
+  return velocity_x_;
+}
+
+/**
+ * @brief Gives the velocity of the real material in y-direction in all cells.
+ * @return The velocity buffer (zero in one dimension).
+ */
+double const (&OutputNodeCache::VelocityY())[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  if (!has_velocity_) {
+    ComputeVelocity();
+  }
+  return velocity_y_;
+}
+
+/**
+ * @brief Gives the velocity of the real material in z-direction in all cells.
+ * @return The velocity buffer (zero in one and two dimensions).
+ */
+double const (&OutputNodeCache::VelocityZ())[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  if (!has_velocity_) {
+    ComputeVelocity();
+  }
+  return velocity_z_;
+}
+
+/**
+ * @brief Gives the velocity gradient of an internal cell.
+ * @param i,j,k Indices of the internal cell (in total cell indexing).
+ * @return The Jacobian matrix, d u_l / d x_m at [l][m].
+ */
+std::array<std::array<double, 3>, 3> const &
+OutputNodeCache::VelocityGradient(unsigned int const i, unsigned int const j,
+                                  unsigned int const k) {
+  if (!has_velocity_gradient_) {
+    ComputeVelocityGradient();
+  }
+  return velocity_gradient_[i - CC::FICX()][j - CC::FICY()][k - CC::FICZ()];
+}
+
+/**
+ * @brief Gives the vorticity of an internal cell, i.e., the curl of the
+ * velocity.
+ * @param i,j,k Indices of the internal cell (in total cell indexing).
+ * @return The vorticity vector.
+ */
+std::array<double, 3> OutputNodeCache::Vorticity(unsigned int const i,
+                                                 unsigned int const j,
+                                                 unsigned int const k) {
+  std::array<std::array<double, 3>, 3> const &gradient =
+      VelocityGradient(i, j, k);
+  return {gradient[2][1] - gradient[1][2], gradient[0][2] - gradient[2][0],
+          gradient[1][0] - gradient[0][1]};
+}
@@ -0,0 +1,79 @@
+//===------------------------ output_node_cache.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef OUTPUT_NODE_CACHE_H
+#define OUTPUT_NODE_CACHE_H
+
+#include "topology/node.h"
+#include <array>
+
+/**
+ * @brief The OutputNodeCache class holds intermediate fields of a single node
+ * that are shared by several output quantities, e.g., the velocity gradient
+ * required for the vorticity, helicity, vortex stretching and vortex
+ * dilatation. The fields are computed lazily on first request and are kept
+ * until the cache is bound to the next node. Hence, quantities that are
+ * evaluated for the same node one after another (see
+ * OutputQuantity::ComputeFusedCellData) compute them only once.
+ * @note The cache is large (several total block sizes) and should be created
+ * once on the heap and re-bound for each node.
+ */
+class OutputNodeCache {
+
+  // node the cached fields belong to
+  Node const *node_;
+  // flags whether the fields of the current node are already computed
+  bool has_velocity_;
+  bool has_velocity_gradient_;
+  // velocity of the real material in each cell (taken from the positive or
+  // negative material depending on the interface tag)
+  double velocity_x_[CC::TCX()][CC::TCY()][CC::TCZ()];
+  double velocity_y_[CC::TCX()][CC::TCY()][CC::TCZ()];
+  double velocity_z_[CC::TCX()][CC::TCY()][CC::TCZ()];
+  // velocity gradient (Jacobian matrix) of all internal cells
+  std::array<std::array<double, 3>, 3> velocity_gradient_[CC::ICX()][CC::ICY()]
+                                                         [CC::ICZ()];
+
+  void ComputeVelocity();
+  void ComputeVelocityGradient();
+
+public:
+  explicit OutputNodeCache(Node const &node);
+  ~OutputNodeCache() = default;
+  OutputNodeCache(OutputNodeCache const &) = delete;
+  OutputNodeCache &operator=(OutputNodeCache const &) = delete;
+  OutputNodeCache(OutputNodeCache &&) = delete;
+  OutputNodeCache &operator=(OutputNodeCache &&) = delete;
+
+  void Bind(Node const &node);
+  Node const &GetNode() const;
+
+  double const (&VelocityX())[CC::TCX()][CC::TCY()][CC::TCZ()];
+  double const (&VelocityY())[CC::TCX()][CC::TCY()][CC::TCZ()];
+  double const (&VelocityZ())[CC::TCX()][CC::TCY()][CC::TCZ()];
+  std::array<std::array<double, 3>, 3> const &
+  VelocityGradient(unsigned int const i, unsigned int const j,
+                   unsigned int const k);
+  std::array<double, 3> Vorticity(unsigned int const i, unsigned int const j,
+                                  unsigned int const k);
+};
+
+#endif // OUTPUT_NODE_CACHE_H
@@ -68,17 +68,17 @@ void BaroclinicityOutput::DoComputeCellData(
     std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
 
-    double const(&positive_pressure)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&positive_pressure)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial())
             .GetPrimeStateBuffer(PrimeState::Pressure);
-    double const(&positive_density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&positive_density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial())
             .GetPrimeStateBuffer(PrimeState::Density);
 
-    double const(&negative_pressure)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&negative_pressure)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial())
             .GetPrimeStateBuffer(PrimeState::Pressure);
-    double const(&negative_density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&negative_density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial())
             .GetPrimeStateBuffer(PrimeState::Density);
 
@@ -119,9 +119,9 @@ void BaroclinicityOutput::DoComputeCellData(
     // No interface node -> interface tags/material is the same everywhere
     MaterialName const material = node.GetSinglePhaseMaterial();
     Block const &block = node.GetPhaseByMaterial(material);
-    double const(&real_pressure)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&real_pressure)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetPrimeStateBuffer(PrimeState::Pressure);
-    double const(&real_density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&real_density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetPrimeStateBuffer(PrimeState::Density);
 
     for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
@@ -68,10 +68,10 @@ void NumericalSchlierenOutput::DoComputeCellData(
   if (node.HasLevelset()) {
     std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
-    double const(&positive_density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&positive_density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial())
             .GetPrimeStateBuffer(PrimeState::Density);
-    double const(&negative_density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&negative_density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial())
             .GetPrimeStateBuffer(PrimeState::Density);
     for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
@@ -95,7 +95,7 @@ void NumericalSchlierenOutput::DoComputeCellData(
     // No interface node -> interface tags/material is the same everywhere
     MaterialName const material = node.GetSinglePhaseMaterial();
     Block const &block = node.GetPhaseByMaterial(material);
-    double const(&density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetPrimeStateBuffer(PrimeState::Density);
     for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
       for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
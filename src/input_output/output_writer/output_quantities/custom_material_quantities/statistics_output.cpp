@@ -0,0 +1,170 @@
+//===----------------------- statistics_output.cpp ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/output_writer/output_quantities/custom_material_quantities/statistics_output.h"
+
+#include "levelset/multi_phase_manager/material_sign_capsule.h"
+
+namespace {
+/**
+ * @brief Gives the dimensionalization factors of the sampled prime states.
+ * @param unit_handler Instance to provide dimensionalization of variables.
+ * @return The factor of each sampled prime state.
+ */
+std::array<double, StatisticsBuffers::number_of_states_>
+DimensionalizationFactors(UnitHandler const &unit_handler) {
+  std::array<double, StatisticsBuffers::number_of_states_> factors;
+  for (unsigned int a = 0; a < factors.size(); ++a) {
+    factors[a] = unit_handler.DimensionalizeValue(
+        1.0, MF::FieldUnit(StatisticsOutputSettings::SampledPrimeStates[a]));
+  }
+  return factors;
+}
+} // namespace
+
+/**
+ * @brief constructor to create the statistics output.
+ * @param unit_handler Instance to provide dimensionalization of variables.
+ * @param material_manager Instance to access all material data.
+ * @param quantity_name Name of the quantity that is displayed in the ParaView
+ * cell data list.
+ * @param output_flags Flags of the output type that is written (0: standard, 1:
+ * interface, 2:debug).
+ * @param covariances Flag whether the covariances are written instead of the
+ * means.
+ *
+ * @note {row, colmun} = {n,1} marks that the means are a vector of the n
+ * sampled prime states, {n,n} that the covariances are a matrix.
+ */
+StatisticsOutput::StatisticsOutput(UnitHandler const &unit_handler,
+                                   MaterialManager const &material_manager,
+                                   std::string const &quantity_name,
+                                   std::array<bool, 3> const output_flags,
+                                   bool const covariances)
+    : OutputQuantity(unit_handler, material_manager, quantity_name,
+                     output_flags,
+                     {StatisticsBuffers::number_of_states_,
+                      covariances ? StatisticsBuffers::number_of_states_ : 1}),
+      covariances_(covariances),
+      dimensionalization_factors_(DimensionalizationFactors(unit_handler)) {
+  /** Empty besides initializer list */
+}
+
+/**
+ * @brief Writes the (dimensionalized) means or covariances of a cell.
+ * @param statistics The statistics of the block.
+ * @param i, j, k The index of the cell.
+ * @param cell_data Vector in which the data is written.
+ * @param cell_data_counter Actual position of the index in the cell data
+ * vector.
+ */
+void StatisticsOutput::WriteCell(
+    StatisticsBuffers const &statistics, unsigned int const i,
+    unsigned int const j, unsigned int const k, std::vector<double> &cell_data,
+    unsigned long long int &cell_data_counter) const {
+  for (unsigned int a = 0; a < dimensions_[0]; ++a) {
+    if (!covariances_) {
+      cell_data[cell_data_counter++] =
+          statistics[StatisticsBuffers::MeanIndex(a)][i][j][k] *
+          dimensionalization_factors_[a];
+      continue;
+    }
+    for (unsigned int b = 0; b < dimensions_[1]; ++b) {
+      cell_data[cell_data_counter++] =
+          statistics[StatisticsBuffers::CovarianceIndex(
+              std::min(a, b), std::max(a, b))][i][j][k] *
+          dimensionalization_factors_[a] * dimensionalization_factors_[b];
+    }
+  }
+}
+
+/**
+ * @brief see base class definition.
+ */
+void StatisticsOutput::DoComputeCellData(
+    Node const &node, std::vector<double> &cell_data,
+    unsigned long long int &cell_data_counter) const {
+
+  if (node.HasLevelset()) {
+    std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
+    StatisticsBuffers const &positive_statistics =
+        node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial())
+            .GetStatisticsBuffers();
+    StatisticsBuffers const &negative_statistics =
+        node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial())
+            .GetStatisticsBuffers();
+
+    for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+      for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+        for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+          WriteCell(interface_tags[i][j][k] > 0 ? positive_statistics
+                                                : negative_statistics,
+                    i, j, k, cell_data, cell_data_counter);
+        }
+      }
+    }
+  } else {
+    StatisticsBuffers const &statistics =
+        node.GetSinglePhase().GetStatisticsBuffers();
+    for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+      for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+        for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+          WriteCell(statistics, i, j, k, cell_data, cell_data_counter);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief see base class definition.
+ *
+ * @note The statistics only exist on leaves, all other nodes and the halo cells
+ * are written as zero.
+ */
+void StatisticsOutput::DoComputeDebugCellData(
+    Node const &node, std::vector<double> &cell_data,
+    unsigned long long int &cell_data_counter,
+    MaterialName const material) const {
+
+  bool const with_statistics =
+      node.ContainsMaterial(material) &&
+      node.GetPhaseByMaterial(material).HasStatisticsBuffers();
+  for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+    for (unsigned int j = 0; j < CC::TCY(); ++j) {
+      for (unsigned int i = 0; i < CC::TCX(); ++i) {
+        bool const internal = i >= CC::FICX() && i <= CC::LICX() &&
+                              j >= CC::FICY() && j <= CC::LICY() &&
+                              k >= CC::FICZ() && k <= CC::LICZ();
+        if (with_statistics && internal) {
+          WriteCell(node.GetPhaseByMaterial(material).GetStatisticsBuffers(), i,
+                    j, k, cell_data, cell_data_counter);
+        } else {
+          for (unsigned int value = 0; value < dimensions_[0] * dimensions_[1];
+               ++value) {
+            cell_data[cell_data_counter++] = 0.0;
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,71 @@
+//===------------------------ statistics_output.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef STATISTICS_OUTPUT_H
+#define STATISTICS_OUTPUT_H
+
+#include "input_output/output_writer/output_quantity.h"
+#include "topology/node.h"
+
+/**
+ * @brief The StatisticsOutput class handles the output of the running
+ * statistics of the sampled prime states ( see StatisticsOutputSettings ), i.e.
+ * either their means as vector or their covariances as matrix. In cells of
+ * multi-phase nodes the statistics of the material present in the cell are
+ * written. StatisticsOutput must not change any data.
+ */
+class StatisticsOutput : public OutputQuantity {
+
+private:
+  // flag whether the covariances are written instead of the means
+  bool const covariances_;
+  // dimensionalization factors of the sampled prime states
+  std::array<double, StatisticsBuffers::number_of_states_> const
+      dimensionalization_factors_;
+
+  void WriteCell(StatisticsBuffers const &statistics, unsigned int const i,
+                 unsigned int const j, unsigned int const k,
+                 std::vector<double> &cell_data,
+                 unsigned long long int &cell_data_counter) const;
+
+  // Compute functions required from base class
+  void
+  DoComputeCellData(Node const &node, std::vector<double> &cell_data,
+                    unsigned long long int &cell_data_counter) const override;
+  void DoComputeDebugCellData(Node const &node, std::vector<double> &cell_data,
+                              unsigned long long int &cell_data_counter,
+                              MaterialName const material) const override;
+
+public:
+  StatisticsOutput() = delete;
+  explicit StatisticsOutput(UnitHandler const &unit_handler,
+                            MaterialManager const &material_manager,
+                            std::string const &quantity_name,
+                            std::array<bool, 3> const output_flags,
+                            bool const covariances);
+  virtual ~StatisticsOutput() = default;
+  StatisticsOutput(StatisticsOutput const &) = delete;
+  StatisticsOutput &operator=(StatisticsOutput const &) = delete;
+  StatisticsOutput(StatisticsOutput &&) = delete;
+  StatisticsOutput &operator=(StatisticsOutput &&) = delete;
+};
+
+#endif // STATISTICS_OUTPUT_H
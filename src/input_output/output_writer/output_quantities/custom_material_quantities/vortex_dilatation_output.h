@@ -37,6 +37,9 @@ private:
   void
   DoComputeCellData(Node const &node, std::vector<double> &cell_data,
                     unsigned long long int &cell_data_counter) const override;
+  void DoComputeCachedCellData(
+      OutputNodeCache &cache, std::vector<double> &cell_data,
+      unsigned long long int &cell_data_counter) const override;
   void DoComputeDebugCellData(Node const &node, std::vector<double> &cell_data,
                               unsigned long long int &cell_data_counter,
                               MaterialName const material) const override;
@@ -21,11 +21,8 @@
 //===----------------------------------------------------------------------===//
 #include "input_output/output_writer/output_quantities/custom_material_quantities/vorticity_absolute_output.h"
 
-#include "levelset/multi_phase_manager/material_sign_capsule.h"
-#include "stencils/stencil_utilities.h"
-#include "utilities/mathematical_functions.h"
 #include "utilities/vector_utilities.h"
-#include <algorithm> //lower_bound, sort
+#include <memory>
 
 /**
  * @brief constructor to create the absolute vorticity output.
@@ -52,109 +49,27 @@ VorticityAbsoluteOutput::VorticityAbsoluteOutput(
 void VorticityAbsoluteOutput::DoComputeCellData(
     Node const &node, std::vector<double> &cell_data,
     unsigned long long int &cell_data_counter) const {
-  // define derivative stencils for derivative computations
-  constexpr DerivativeStencils derivative_stencil =
-      DerivativeStencils::FourthOrderCentralDifference;
-  using DerivativeStencil =
-      DerivativeStencilSetup::Concretize<derivative_stencil>::type;
+  std::unique_ptr<OutputNodeCache> const cache =
+      std::make_unique<OutputNodeCache>(node);
+  DoComputeCachedCellData(*cache, cell_data, cell_data_counter);
+}
+
+/**
+ * @brief see base class definition. The velocity gradient is taken from the
+ * cache and thus shared with other vorticity-based quantities.
+ */
+void VorticityAbsoluteOutput::DoComputeCachedCellData(
+    OutputNodeCache &cache, std::vector<double> &cell_data,
+    unsigned long long int &cell_data_counter) const {
   // Obtain the factor used for dimensionalization unit: [1/s]
   double const dimensionalization_factor =
       unit_handler_.DimensionalizeValue(1.0, {}, {UnitType::Time});
-  // get the cell size for the node
-  double const cell_size = node.GetCellSize();
-
-  if (node.HasLevelset()) {
-    std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-        node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
-
-    PrimeStates const &positive_prime_states =
-        node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial())
-            .GetPrimeStateBuffer();
-    PrimeStates const &negative_prime_states =
-        node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial())
-            .GetPrimeStateBuffer();
-
-    double real_velocity_x[CC::TCX()][CC::TCY()][CC::TCZ()];
-    double real_velocity_y[CC::TCX()][CC::TCY()][CC::TCZ()];
-    double real_velocity_z[CC::TCX()][CC::TCY()][CC::TCZ()];
-
-    for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-      for (unsigned int j = 0; j < CC::TCY(); ++j) {
-        for (unsigned int i = 0; i < CC::TCX(); ++i) {
-          if (interface_tags[i][j][k] > 0) {
-            real_velocity_x[i][j][k] =
-                positive_prime_states[PrimeState::VelocityX][i][j][k];
-            real_velocity_y[i][j][k] =
-                CC::DIM() != Dimension::One
-                    ? positive_prime_states[PrimeState::VelocityY][i][j][k]
-                    : 0.0;
-            real_velocity_z[i][j][k] =
-                CC::DIM() == Dimension::Three
-                    ? positive_prime_states[PrimeState::VelocityZ][i][j][k]
-                    : 0.0;
-          } else {
-            real_velocity_x[i][j][k] =
-                negative_prime_states[PrimeState::VelocityX][i][j][k];
-            real_velocity_y[i][j][k] =
-                CC::DIM() != Dimension::One
-                    ? negative_prime_states[PrimeState::VelocityY][i][j][k]
-                    : 0.0;
-            real_velocity_z[i][j][k] =
-                CC::DIM() == Dimension::Three
-                    ? negative_prime_states[PrimeState::VelocityZ][i][j][k]
-                    : 0.0;
-          }
-        }
-      }
-    }
 
-    for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-      for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-        for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-          cell_data[cell_data_counter++] =
-              VU::L2Norm(SU::Curl<DerivativeStencil>(
-                  real_velocity_x, real_velocity_y, real_velocity_z, i, j, k,
-                  cell_size)) *
-              dimensionalization_factor;
-        }
-      }
-    }
-  } else {
-    // No interface node -> interface tags/material is the same everywhere
-    MaterialName const material = node.GetSinglePhaseMaterial();
-    Block const &block = node.GetPhaseByMaterial(material);
-    PrimeStates const &prime_states = block.GetPrimeStateBuffer();
-
-    double real_velocity_x[CC::TCX()][CC::TCY()][CC::TCZ()];
-    double real_velocity_y[CC::TCX()][CC::TCY()][CC::TCZ()];
-    double real_velocity_z[CC::TCX()][CC::TCY()][CC::TCZ()];
-
-    for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-      for (unsigned int j = 0; j < CC::TCY(); ++j) {
-        for (unsigned int i = 0; i < CC::TCX(); ++i) {
-          real_velocity_x[i][j][k] =
-              prime_states[PrimeState::VelocityX][i][j][k];
-          real_velocity_y[i][j][k] =
-              CC::DIM() != Dimension::One
-                  ? prime_states[PrimeState::VelocityY][i][j][k]
-                  : 0.0;
-          real_velocity_z[i][j][k] =
-              CC::DIM() == Dimension::Three
-                  ? prime_states[PrimeState::VelocityZ][i][j][k]
-                  : 0.0;
-        }
-      }
-    }
-
-    for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-      for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-        for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-          cell_data[cell_data_counter++] =
-              VU::L2Norm(SU::Curl<DerivativeStencil>(
-                  real_velocity_x, real_velocity_y, real_velocity_z, i, j, k,
-                  cell_size)) *
-              dimensionalization_factor;
-        }
+  for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+      for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+        cell_data[cell_data_counter++] =
+            VU::L2Norm(cache.Vorticity(i, j, k)) * dimensionalization_factor;
       }
     }
   }
@@ -78,13 +78,6 @@ void MaterialFieldQuantity::DoComputeCellData(
          component < quantity_data_.field_indices_.size(); component++) {
       // Get the correct field index
       unsigned int const field_index = quantity_data_.field_indices_[component];
-      // Get buffers of both materials and other specifications
-      double const(&positive_field_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-          node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial())
-              .GetFieldBuffer(field_type, field_index, buffer_type_);
-      double const(&negative_field_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-          node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial())
-              .GetFieldBuffer(field_type, field_index, buffer_type_);
       // Dimensionalization factor for re-dimensionalization of variables
       double const dimensionalization_factor =
           unit_handler_.DimensionalizeValue(
@@ -93,28 +86,46 @@ void MaterialFieldQuantity::DoComputeCellData(
       // set the local counter on original cell_data_counter + the component
       local_counter = cell_data_counter + component;
 
-      // Loop through all internal cells of block
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-        for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-          for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-            // Use negative material if interface tags are negative or in new
-            // cut cell band and negative levelset
-            if (interface_tags[i][j][k] < 0 ||
-                (std::abs(interface_tags[i][j][k]) <= ITTI(IT::NewCutCell) &&
-                 levelset[i][j][k] < 0.0)) {
-              cell_data[local_counter] =
-                  negative_field_buffer[i][j][k] * dimensionalization_factor;
-            }
-            // otherwise positive
-            else {
-              cell_data[local_counter] =
-                  positive_field_buffer[i][j][k] * dimensionalization_factor;
-            }
-
-            local_counter += quantity_data_.field_indices_.size();
-          }
-        }
-      }
+      // Get buffers of both materials (in their storage precision)
+      Block const &positive_block =
+          node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial());
+      Block const &negative_block =
+          node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial());
+      positive_block.VisitFieldBuffer(
+          field_type, field_index,
+          [&](auto const &positive_field_buffer) {
+            negative_block.VisitFieldBuffer(
+                field_type, field_index,
+                [&](auto const &negative_field_buffer) {
+                  // Loop through all internal cells of block
+                  for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+                    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+                      for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+                        // Use negative material if interface tags are negative
+                        // or in new cut cell band and negative levelset
+                        if (interface_tags[i][j][k] < 0 ||
+                            (std::abs(interface_tags[i][j][k]) <=
+                                 ITTI(IT::NewCutCell) &&
+                             levelset[i][j][k] < 0.0)) {
+                          cell_data[local_counter] =
+                              negative_field_buffer[i][j][k] *
+                              dimensionalization_factor;
+                        }
+                        // otherwise positive
+                        else {
+                          cell_data[local_counter] =
+                              positive_field_buffer[i][j][k] *
+                              dimensionalization_factor;
+                        }
+
+                        local_counter += quantity_data_.field_indices_.size();
+                      }
+                    }
+                  }
+                },
+                buffer_type_);
+          },
+          buffer_type_);
     }
 
   } else {
@@ -130,9 +141,6 @@ void MaterialFieldQuantity::DoComputeCellData(
          component < quantity_data_.field_indices_.size(); component++) {
       // Get the correct buffer and dimensionalization factor
       unsigned int const field_index = quantity_data_.field_indices_[component];
-      double const(&field_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-          node.GetPhaseByMaterial(material).GetFieldBuffer(
-              field_type, field_index, buffer_type_);
       double const dimensionalization_factor =
           unit_handler_.DimensionalizeValue(
               1.0, MF::FieldUnit(field_type, field_index));
@@ -140,18 +148,23 @@ void MaterialFieldQuantity::DoComputeCellData(
       // set the local counter on original cell_data_counter + the component
       local_counter = cell_data_counter + component;
 
-      // Loop through all internal cells in the block
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-        for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-          for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-            // add the dimensionalized value
-            cell_data[local_counter] =
-                field_buffer[i][j][k] * dimensionalization_factor;
-
-            local_counter += quantity_data_.field_indices_.size();
-          }
-        }
-      }
+      node.GetPhaseByMaterial(material).VisitFieldBuffer(
+          field_type, field_index,
+          [&](auto const &field_buffer) {
+            // Loop through all internal cells in the block
+            for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+              for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+                for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+                  // add the dimensionalized value
+                  cell_data[local_counter] =
+                      field_buffer[i][j][k] * dimensionalization_factor;
+
+                  local_counter += quantity_data_.field_indices_.size();
+                }
+              }
+            }
+          },
+          buffer_type_);
     }
   }
 }
@@ -167,8 +180,11 @@ void MaterialFieldQuantity::DoComputeDebugCellData(
   // extract the correct field type
   MaterialFieldType const field_type = quantity_data_.field_type_;
 
-  // Check whether the given material is contained in the node
-  if (node.ContainsMaterial(material)) {
+  // Check whether the given material is contained in the node (parents hold
+  // no initial buffer, see CC::LazyIntegrationBuffers())
+  if (node.ContainsMaterial(material) &&
+      (buffer_type_ != ConservativeBufferType::Initial ||
+       node.GetPhaseByMaterial(material).HasIntegrationBuffers())) {
     // local counter
     unsigned long long int local_counter = 0;
     // Loop through all components
@@ -177,9 +193,6 @@ void MaterialFieldQuantity::DoComputeDebugCellData(
 
       // Get the correct buffer and dimensionalization factor
       unsigned int const field_index = quantity_data_.field_indices_[component];
-      double const(&field_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-          node.GetPhaseByMaterial(material).GetFieldBuffer(
-              field_type, field_index, buffer_type_);
       double const dimensionalization_factor =
           unit_handler_.DimensionalizeValue(
               1.0, MF::FieldUnit(field_type, field_index));
@@ -187,18 +200,23 @@ void MaterialFieldQuantity::DoComputeDebugCellData(
       // set the local counter on original cell_data_counter + the component
       local_counter = cell_data_counter + component;
 
-      // Loop through all cells
-      for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-        for (unsigned int j = 0; j < CC::TCY(); ++j) {
-          for (unsigned int i = 0; i < CC::TCX(); ++i) {
-            // add the dimensionalized value
-            cell_data[local_counter] =
-                field_buffer[i][j][k] * dimensionalization_factor;
-
-            local_counter += quantity_data_.field_indices_.size();
-          }
-        }
-      }
+      node.GetPhaseByMaterial(material).VisitFieldBuffer(
+          field_type, field_index,
+          [&](auto const &field_buffer) {
+            // Loop through all cells
+            for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+              for (unsigned int j = 0; j < CC::TCY(); ++j) {
+                for (unsigned int i = 0; i < CC::TCX(); ++i) {
+                  // add the dimensionalized value
+                  cell_data[local_counter] =
+                      field_buffer[i][j][k] * dimensionalization_factor;
+
+                  local_counter += quantity_data_.field_indices_.size();
+                }
+              }
+            }
+          },
+          buffer_type_);
     }
   } else {
     // Loop through all components
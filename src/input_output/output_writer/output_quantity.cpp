@@ -21,6 +21,7 @@
 //===----------------------------------------------------------------------===//
 #include "output_quantity.h"
 #include "input_output/utilities/xdmf_utilities.h"
+#include <memory>
 
 /**
  * @brief Explicit constructor to be used to create an output quantity.
@@ -61,11 +62,15 @@ std::array<unsigned int, 2> OutputQuantity::GetDimensions() const {
 
 /**
  * @brief Checks whether the output quantity should be written for a given
- * output type (0: standard, 1: interface, 2: debug).
+ * output type (0: standard, 1: interface, 2: debug). The monitoring output
+ * writes the quantities of the standard output.
  * @param output_type Output type to be checked.
  * @return true if output should be written, false if not.
  */
 bool OutputQuantity::IsActive(OutputType const output_type) const {
+  if (output_type == OutputType::Monitoring) {
+    return output_flags_[OTTI(OutputType::Standard)];
+  }
   return output_flags_[OTTI(output_type)];
 }
 
@@ -79,15 +84,17 @@ bool OutputQuantity::IsActive(OutputType const output_type) const {
  * @param number_of_global_cells Number of cells used for the complete quantity
  * (globally on all ranks).
  * @param prefix Additional prefix that can be used for the attribute_name.
+ * @param precision Precision the data has been written with.
  * @return Compete Xdmf attribute string.
  */
 std::string OutputQuantity::GetXdmfAttributeString(
     std::string const &hdf5_filename, std::string const &group_name,
-    hsize_t const number_of_global_cells, std::string const prefix) const {
+    hsize_t const number_of_global_cells, std::string const prefix,
+    OutputPrecision const precision) const {
   // Get the data item
   std::string const data_item(XdmfUtilities::DataItemString(
       hdf5_filename, group_name + "/" + prefix + quantity_name_,
-      number_of_global_cells, dimensions_));
+      number_of_global_cells, dimensions_, OutputPrecisionInBytes(precision)));
   if (dimensions_.back() > 1 ||
       dimensions_.front() >
           DTI(CC::DIM())) { // multidimensional (second component dimension
@@ -140,12 +147,69 @@ void OutputQuantity::ComputeCellData(
   unsigned long long int cell_data_per_node =
       dimensions_[0] * dimensions_[1] * CC::ICX() * CC::ICY() * CC::ICZ();
 
+  // Nothing to compute (the cache is not required)
+  if (nodes.empty()) {
+    return;
+  }
+  // Cache for the intermediate fields (allocated once for all nodes)
+  std::unique_ptr<OutputNodeCache> const cache =
+      std::make_unique<OutputNodeCache>(nodes.front().get());
+
   // Loop through all nodes to append correct number of data
   for (Node const &node : nodes) {
     // Ensures that the data counter is at the correct position for this node
     cell_data_counter = cell_data_per_node * node_counter;
     // Call the function that is implemented by the derived class
-    DoComputeCellData(node, cell_data, cell_data_counter);
+    cache->Bind(node);
+    DoComputeCachedCellData(*cache, cell_data, cell_data_counter);
+    // Increment the node counter
+    node_counter++;
+  }
+}
+
+/**
+ * @brief Computes the data of all internal cells for several quantities in a
+ * single pass over the nodes. All quantities are evaluated for one node before
+ * the next node is considered, such that the node data stays in cache and
+ * intermediate fields (e.g., velocity gradients) are computed only once per
+ * node (see OutputNodeCache).
+ * @param quantities Quantities to be computed.
+ * @param nodes Vector of nodes for which the output should be done.
+ * @param cell_data Vectors in which the full set of cell data is written, one
+ * per quantity (same order as the quantities and sized appropriately).
+ *
+ * @note The order within each cell data vector is the same as for
+ * ComputeCellData.
+ */
+void OutputQuantity::ComputeFusedCellData(
+    std::vector<std::reference_wrapper<OutputQuantity const>> const &quantities,
+    std::vector<std::reference_wrapper<Node const>> const &nodes,
+    std::vector<std::vector<double>> &cell_data) {
+
+  // Nothing to compute (the cache is not required)
+  if (nodes.empty()) {
+    return;
+  }
+  // Cache for the intermediate fields (allocated once for all nodes)
+  std::unique_ptr<OutputNodeCache> const cache =
+      std::make_unique<OutputNodeCache>(nodes.front().get());
+
+  // node counter
+  unsigned int node_counter = 0;
+  // Loop through all nodes and compute all quantities for each
+  for (Node const &node : nodes) {
+    cache->Bind(node);
+    for (std::size_t quantity_index = 0; quantity_index < quantities.size();
+         ++quantity_index) {
+      OutputQuantity const &quantity = quantities[quantity_index];
+      // Ensures that the data counter is at the correct position for this node
+      unsigned long long int cell_data_counter =
+          static_cast<unsigned long long int>(quantity.dimensions_[0]) *
+          quantity.dimensions_[1] * CC::ICX() * CC::ICY() * CC::ICZ() *
+          node_counter;
+      quantity.DoComputeCachedCellData(*cache, cell_data[quantity_index],
+                                       cell_data_counter);
+    }
     // Increment the node counter
     node_counter++;
   }
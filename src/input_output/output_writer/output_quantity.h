@@ -23,6 +23,7 @@
 #define OUTPUT_QUANTITY_H
 
 #include "input_output/output_writer/output_definitions.h"
+#include "input_output/output_writer/output_node_cache.h"
 #include "materials/material_definitions.h"
 #include "materials/material_manager.h"
 #include "topology/node.h"
@@ -67,6 +68,25 @@ protected:
   DoComputeCellData(Node const &node, std::vector<double> &cell_data,
                     unsigned long long int &cell_data_counter) const = 0;
 
+  /**
+   * @brief Compute values for the data vector that is written to the hdf5 file
+   * (standard, interface mode) with access to the intermediate fields of the
+   * node shared with other quantities.
+   * @param cache Cache bound to the node whose data should be added.
+   * @param cell_data_counter Actual position of the index in the cell data
+   * vector.
+   * @param cell_data Vector in which the data is written.
+   *
+   * @note Quantities that use shared intermediates override this function. By
+   * default the uncached computation is used.
+   */
+  virtual void
+  DoComputeCachedCellData(OutputNodeCache &cache,
+                          std::vector<double> &cell_data,
+                          unsigned long long int &cell_data_counter) const {
+    DoComputeCellData(cache.GetNode(), cell_data, cell_data_counter);
+  }
+
   /**
    * @brief Compute values for the data vector that is written to the hdf5 file
    * (debug mode).
@@ -103,16 +123,21 @@ public:
   void
   ComputeCellData(std::vector<std::reference_wrapper<Node const>> const &nodes,
                   std::vector<double> &cell_data) const;
+  static void ComputeFusedCellData(
+      std::vector<std::reference_wrapper<OutputQuantity const>> const
+          &quantities,
+      std::vector<std::reference_wrapper<Node const>> const &nodes,
+      std::vector<std::vector<double>> &cell_data);
   void ComputeDebugCellData(
       std::vector<std::reference_wrapper<Node const>> const &nodes,
       std::vector<double> &cell_data,
       MaterialName const material = MaterialName::MaterialOne) const;
 
   // Creates and attribute string compliant with a xdmf reader
-  std::string GetXdmfAttributeString(std::string const &filename,
-                                     std::string const &group_name,
-                                     hsize_t const number_of_values,
-                                     std::string const prefix = "") const;
+  std::string GetXdmfAttributeString(
+      std::string const &filename, std::string const &group_name,
+      hsize_t const number_of_values, std::string const prefix = "",
+      OutputPrecision const precision = OutputPrecision::Double) const;
 
   // Additional return functions to provide data to outside
   bool IsActive(OutputType const output_type) const;
@@ -21,14 +21,22 @@
 //===----------------------------------------------------------------------===//
 #include "input_output/restart_manager.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <functional>
+#include <stdexcept>
 #include <vector>
 
 #include "block_definitions/block.h"
 #include "communication/mpi_utilities.h"
 #include "enums/interface_tag_definition.h"
+#include "input_output/utilities/file_utilities.h"
 #include "levelset/multi_phase_manager/material_sign_capsule.h"
 #include "materials/material_definitions.h"
 #include "user_specifications/compile_time_constants.h"
+#include "user_specifications/output_constants.h"
 #include "utilities/buffer_operations.h"
 
 namespace {
@@ -52,6 +60,16 @@ void CheckConsistency(T const &first_value, T const &second_value,
                            std::to_string(second_value) + ")!");
   }
 }
+
+/**
+ * @brief Gives the native HDF5 type the material fields are stored in ( see
+ * CC::SinglePrecisionFields() ). Snapshots written in another precision are
+ * converted by HDF5 while reading.
+ * @return The HDF5 type identifier.
+ */
+hid_t FieldValueDatatype() {
+  return CC::SinglePrecisionFields() ? H5T_NATIVE_FLOAT : H5T_NATIVE_DOUBLE;
+}
 } // namespace
 
 /**
@@ -77,10 +95,205 @@ RestartManager::RestartManager(UnitHandler const &unit_handler,
       temperature_reference_(
           unit_handler.DimensionalizeValue(1.0, UnitType::Temperature)),
       velocity_reference_(
-          unit_handler.DimensionalizeValue(1.0, UnitType::Velocity)) {
+          unit_handler.DimensionalizeValue(1.0, UnitType::Velocity)),
+      differential_snapshots_written_(0) {
   /** Empty besides initializer list */
 }
 
+/**
+ * @brief Reads the global information of all nodes from the snapshot file that
+ * is currently open.
+ * @return The node information of the snapshot.
+ */
+RestartManager::SnapshotNodeInfo RestartManager::ReadSnapshotNodeInfo() const {
+  SnapshotNodeInfo info;
+
+  // differential snapshots refer to their predecessor
+  hdf5_manager_.OpenGroup("simulation_data");
+  bool const is_differential = hdf5_manager_.HasAttribute("PreviousSnapshot");
+  if (is_differential) {
+    info.previous_snapshot_ =
+        hdf5_manager_.ReadAttributeString("PreviousSnapshot");
+  }
+  // leaf-only snapshots do not store the parents
+  bool const is_leaves_only = hdf5_manager_.HasAttribute("LeavesOnly");
+  // subfiled snapshots only hold the node information
+  bool const is_subfiled = hdf5_manager_.HasAttribute("SubfilePrefix");
+  if (is_subfiled) {
+    info.subfile_prefix_ = hdf5_manager_.ReadAttributeString("SubfilePrefix");
+  }
+  hdf5_manager_.CloseGroup();
+
+  /** The global node information is read by rank zero only and distributed to
+   * all others, which avoids that all ranks read the same data */
+  if (MpiUtilities::MyRankId() == 0) {
+    hdf5_manager_.OpenGroup("node_info_data");
+
+    // Get the information for the number of nodes of the full topology and
+    // then read the nodes ids
+    unsigned int const global_number_of_nodes =
+        hdf5_manager_.GetDatasetExtent("NodeIds");
+    info.node_ids_.resize(global_number_of_nodes);
+    hdf5_manager_.ReadFullDataset("NodeIds", info.node_ids_.data(),
+                                  H5T_NATIVE_ULLONG);
+
+    // Get the information of all other required parameters (Consistency check
+    // on the given input data)
+    info.number_of_materials_.resize(global_number_of_nodes);
+    hdf5_manager_.ReadFullDataset("NumberOfMaterials",
+                                  info.number_of_materials_.data(),
+                                  H5T_NATIVE_USHORT);
+
+    info.materials_.resize(std::accumulate(info.number_of_materials_.begin(),
+                                           info.number_of_materials_.end(), 0));
+    hdf5_manager_.ReadFullDataset("Materials", info.materials_.data(),
+                                  H5T_NATIVE_USHORT);
+
+    info.number_of_interface_blocks_.resize(global_number_of_nodes);
+    hdf5_manager_.ReadFullDataset("NumberOfInterfaceBlocks",
+                                  info.number_of_interface_blocks_.data(),
+                                  H5T_NATIVE_USHORT);
+
+    // full snapshots store all nodes
+    info.stored_in_snapshot_.assign(global_number_of_nodes, 1);
+    if (is_differential || is_leaves_only) {
+      hdf5_manager_.ReadFullDataset("StoredInSnapshot",
+                                    info.stored_in_snapshot_.data(),
+                                    H5T_NATIVE_USHORT);
+    }
+
+    if (is_subfiled) {
+      info.subfile_of_node_.resize(global_number_of_nodes);
+      hdf5_manager_.ReadFullDataset(
+          "SubfileOfNode", info.subfile_of_node_.data(), H5T_NATIVE_UINT);
+    }
+
+    /** Close the open group */
+    hdf5_manager_.CloseGroup();
+  }
+  MpiUtilities::BroadcastVector(info.node_ids_, MPI_UNSIGNED_LONG_LONG);
+  MpiUtilities::BroadcastVector(info.number_of_materials_, MPI_UNSIGNED_SHORT);
+  MpiUtilities::BroadcastVector(info.materials_, MPI_UNSIGNED_SHORT);
+  MpiUtilities::BroadcastVector(info.number_of_interface_blocks_,
+                                MPI_UNSIGNED_SHORT);
+  MpiUtilities::BroadcastVector(info.stored_in_snapshot_, MPI_UNSIGNED_SHORT);
+  if (is_subfiled) {
+    MpiUtilities::BroadcastVector(info.subfile_of_node_, MPI_UNSIGNED);
+  }
+  unsigned int const global_number_of_nodes = info.node_ids_.size();
+
+  // The cell datasets only hold the stored nodes. The nodes of a subfile are
+  // consecutive and its datasets start with the first of them
+  info.material_offsets_.resize(global_number_of_nodes);
+  info.material_block_offsets_.resize(global_number_of_nodes);
+  info.interface_block_offsets_.resize(global_number_of_nodes);
+  hsize_t material_offset = 0;
+  hsize_t material_block_offset = 0;
+  hsize_t interface_block_offset = 0;
+  for (unsigned int node_index = 0; node_index < global_number_of_nodes;
+       ++node_index) {
+    if (is_subfiled && node_index > 0 &&
+        info.subfile_of_node_[node_index] !=
+            info.subfile_of_node_[node_index - 1]) {
+      material_block_offset = 0;
+      interface_block_offset = 0;
+    }
+    info.material_offsets_[node_index] = material_offset;
+    info.material_block_offsets_[node_index] = material_block_offset;
+    info.interface_block_offsets_[node_index] = interface_block_offset;
+    material_offset += info.number_of_materials_[node_index];
+    if (info.stored_in_snapshot_[node_index] == 1) {
+      material_block_offset += info.number_of_materials_[node_index];
+      interface_block_offset += info.number_of_interface_blocks_[node_index];
+    }
+  }
+
+  return info;
+}
+
+/**
+ * @brief Opens the cell datasets of the snapshot file that is currently open.
+ */
+void RestartManager::OpenCellDatasetsForReading() const {
+  hdf5_manager_.OpenGroup("node_cell_data");
+
+  // Define the size of the buffers that are read at once
+  std::vector<hsize_t> const local_dimensions_conservatives(
+      {1, MF::ANOE(), CC::TCX(), CC::TCY(), CC::TCZ()});
+  std::vector<hsize_t> const local_dimensions_prime_states(
+      {1, MF::ANOP(), CC::TCX(), CC::TCY(), CC::TCZ()});
+  std::vector<hsize_t> const local_dimensions_single_buffer(
+      {1, CC::TCX(), CC::TCY(), CC::TCZ()});
+
+  // Open all datasets
+  hdf5_manager_.OpenDatasetForReading(
+      "Conservatives", local_dimensions_conservatives, FieldValueDatatype());
+  hdf5_manager_.OpenDatasetForReading(
+      "PrimeStates", local_dimensions_prime_states, FieldValueDatatype());
+  hdf5_manager_.OpenDatasetForReading(
+      "Levelset", local_dimensions_single_buffer, H5T_NATIVE_DOUBLE);
+  hdf5_manager_.OpenDatasetForReading(
+      "InterfaceTags", local_dimensions_single_buffer, H5T_NATIVE_CHAR);
+}
+
+/**
+ * @brief Opens the subfile holding the cell data of a node for reading, unless
+ * it is already open. The subfile is opened by this rank only, hence each rank
+ * only accesses the subfiles of its nodes.
+ * @param snapshot_folder The folder of the snapshot file (and its subfiles).
+ * @param info The node information of the snapshot.
+ * @param node_index The index of the node in the snapshot.
+ * @param open_subfile The subfile currently open (negative if none), updated
+ * in-place.
+ */
+void RestartManager::OpenSubfileOfNode(std::string const &snapshot_folder,
+                                       SnapshotNodeInfo const &info,
+                                       unsigned int const node_index,
+                                       int &open_subfile) const {
+  int const subfile = info.subfile_of_node_[node_index];
+  if (subfile == open_subfile) {
+    return;
+  }
+  if (open_subfile >= 0) {
+    hdf5_manager_.CloseFile();
+  }
+  hdf5_manager_.OpenFile((std::filesystem::path(snapshot_folder) /
+                          SubfileName(info.subfile_prefix_, subfile))
+                             .string(),
+                         Hdf5Access::Read, MPI_COMM_SELF);
+  OpenCellDatasetsForReading();
+  open_subfile = subfile;
+}
+
+/**
+ * @brief Reads the conservatives and prime states of all phases of a node from
+ * the snapshot file that is currently open.
+ * @param node The node whose phases are read.
+ * @param info The node information of the snapshot.
+ * @param node_index The index of the node in the snapshot.
+ */
+void RestartManager::ReadMaterialBlocks(Node &node,
+                                        SnapshotNodeInfo const &info,
+                                        unsigned int const node_index) const {
+  for (unsigned int material_index = 0;
+       material_index < info.number_of_materials_[node_index];
+       ++material_index) {
+    MaterialName const material =
+        info.materials_[info.material_offsets_[node_index] + material_index];
+    Block &material_block = node.GetPhaseByMaterial(material);
+
+    hsize_t const reading_offset =
+        info.material_block_offsets_[node_index] + material_index;
+
+    // Read the conservatives and primes
+    hdf5_manager_.ReadDataset("Conservatives",
+                              &material_block.GetRightHandSideBuffer(),
+                              reading_offset);
+    hdf5_manager_.ReadDataset(
+        "PrimeStates", &material_block.GetPrimeStateBuffer(), reading_offset);
+  }
+}
+
 /**
  * @brief Restores the simulation topology and tree from a restart file.
  * @param restore_filename The name of the file that should be used to restore
@@ -155,88 +368,57 @@ RestartManager::RestoreSimulation(std::string const &restore_filename) const {
 
   /** Read the global information information of all nodes (required to restore
    * the topology) */
-  hdf5_manager_.OpenGroup("node_info_data");
-
-  // Get the information for the number of nodes of the full topology and then
-  // read the nodes ids
-  unsigned int const global_number_of_nodes =
-      hdf5_manager_.GetDatasetExtent("NodeIds");
-  std::vector<nid_t> node_ids(global_number_of_nodes);
-  hdf5_manager_.ReadFullDataset("NodeIds", node_ids.data(), H5T_NATIVE_ULLONG);
-
-  // Get the information of all other required parameters (Consistency check on
-  // the given input data)
-  std::vector<unsigned short> number_of_materials(global_number_of_nodes);
-  hdf5_manager_.ReadFullDataset("NumberOfMaterials", number_of_materials.data(),
-                                H5T_NATIVE_USHORT);
-
-  std::vector<MaterialName> materials(std::accumulate(
-      number_of_materials.begin(), number_of_materials.end(), 0));
-  hdf5_manager_.ReadFullDataset("Materials", materials.data(),
-                                H5T_NATIVE_USHORT);
-
-  std::vector<unsigned short> number_of_interface_blocks(
-      global_number_of_nodes);
-  hdf5_manager_.ReadFullDataset("NumberOfInterfaceBlocks",
-                                number_of_interface_blocks.data(),
-                                H5T_NATIVE_USHORT);
-
-  /** Close the open group */
-  hdf5_manager_.CloseGroup();
+  SnapshotNodeInfo const info = ReadSnapshotNodeInfo();
 
   /** Restore the topology with the given data and obtain the local indices (of
    * all global node ids) of the restored topology */
-  auto const local_node_indices =
-      topology_.RestoreTopology(node_ids, number_of_materials, materials);
-
-  /** Now read all cell data from file and store it into the buffer */
-  hdf5_manager_.OpenGroup("node_cell_data");
-
-  // Define the size of the buffers that are read at once
-  std::vector<hsize_t> const local_dimensions_conservatives(
-      {1, MF::ANOE(), CC::TCX(), CC::TCY(), CC::TCZ()});
-  std::vector<hsize_t> const local_dimensions_prime_states(
-      {1, MF::ANOP(), CC::TCX(), CC::TCY(), CC::TCZ()});
-  std::vector<hsize_t> const local_dimensions_single_buffer(
-      {1, CC::TCX(), CC::TCY(), CC::TCZ()});
-
-  // Open all datasets
-  hdf5_manager_.OpenDatasetForReading(
-      "Conservatives", local_dimensions_conservatives, H5T_NATIVE_DOUBLE);
-  hdf5_manager_.OpenDatasetForReading(
-      "PrimeStates", local_dimensions_prime_states, H5T_NATIVE_DOUBLE);
-  hdf5_manager_.OpenDatasetForReading(
-      "Levelset", local_dimensions_single_buffer, H5T_NATIVE_DOUBLE);
-  hdf5_manager_.OpenDatasetForReading(
-      "InterfaceTags", local_dimensions_single_buffer, H5T_NATIVE_CHAR);
+  auto local_node_indices = topology_.RestoreTopology(
+      info.node_ids_, info.number_of_materials_, info.materials_);
+  // read the blocks in the order they are stored in the file
+  std::sort(local_node_indices.begin(), local_node_indices.end());
+
+  /** Now read all cell data from file and store it into the buffer. For
+   * subfiled snapshots each rank opens the subfiles of its nodes on its own,
+   * the snapshots of a chain and their subfiles are placed in the same folder
+   */
+  std::string const snapshot_folder =
+      std::filesystem::path(restore_filename).parent_path().string();
+  bool const is_subfiled = !info.subfile_of_node_.empty();
+  int open_subfile = -1;
+  if (is_subfiled) {
+    hdf5_manager_.CloseFile();
+  } else {
+    OpenCellDatasetsForReading();
+  }
 
   // Declare the buffers that are filled during reading plus other variables
   // required during reading
   std::int8_t interface_tags[CC::TCX()][CC::TCY()][CC::TCZ()];
   double single_buffer[CC::TCX()][CC::TCY()][CC::TCZ()];
   std::vector<MaterialName> materials_of_node;
+  // nodes whose data is stored in a previous snapshot of the chain
+  std::unordered_map<nid_t, std::reference_wrapper<Node>> pending_nodes;
 
   // Loop through all local nodes and add the data
   for (auto const node_index : local_node_indices) {
 
-    // Compute the offset where the current material blocks start
-    hsize_t const material_block_offset =
-        std::accumulate(number_of_materials.begin(),
-                        number_of_materials.begin() + node_index, 0);
-
+    hsize_t const material_offset = info.material_offsets_[node_index];
     materials_of_node.clear();
     for (unsigned int material_index = 0;
-         material_index < number_of_materials[node_index]; ++material_index) {
+         material_index < info.number_of_materials_[node_index];
+         ++material_index) {
       materials_of_node.push_back(
-          materials[material_block_offset + material_index]);
+          info.materials_[material_offset + material_index]);
     }
 
     // Declare the interface block as null_pointer
     std::unique_ptr<InterfaceBlock> interface_block = nullptr;
-    if (number_of_interface_blocks[node_index] == 1) {
-      hsize_t const reading_offset =
-          std::accumulate(number_of_interface_blocks.begin(),
-                          number_of_interface_blocks.begin() + node_index, 0);
+    if (info.number_of_interface_blocks_[node_index] == 1) {
+      // multi-phase nodes are stored in every snapshot
+      hsize_t const reading_offset = info.interface_block_offsets_[node_index];
+      if (is_subfiled) {
+        OpenSubfileOfNode(snapshot_folder, info, node_index, open_subfile);
+      }
 
       // read the levelset
       hdf5_manager_.ReadDataset("Levelset", single_buffer, reading_offset);
@@ -261,46 +443,233 @@ RestartManager::RestoreSimulation(std::string const &restore_filename) const {
 
     // Create the node with the material and interface data
     Node &new_node =
-        tree_.CreateNode(node_ids[node_index], materials_of_node,
+        tree_.CreateNode(info.node_ids_[node_index], materials_of_node,
                          interface_tags, std::move(interface_block));
 
-    // Read the conservative and prime state data
-    for (unsigned int material_index = 0;
-         material_index < number_of_materials[node_index]; ++material_index) {
-      MaterialName const material =
-          materials[material_block_offset + material_index];
-      Block &material_block = new_node.GetPhaseByMaterial(material);
+    // Read the conservative and prime state data ( parents of leaf-only
+    // snapshots are averaged from their children afterwards )
+    if (info.stored_in_snapshot_[node_index] == 1) {
+      if (is_subfiled) {
+        OpenSubfileOfNode(snapshot_folder, info, node_index, open_subfile);
+      }
+      ReadMaterialBlocks(new_node, info, node_index);
+    } else if (info.stored_in_snapshot_[node_index] == 0) {
+      pending_nodes.emplace(info.node_ids_[node_index], new_node);
+    }
+  }
 
-      hsize_t const reading_offset = material_block_offset + material_index;
+  /** Close the file (closes also all groups and datasets that are open) */
+  if (!is_subfiled || open_subfile >= 0) {
+    hdf5_manager_.CloseFile();
+  }
 
-      // Read the conservatives and primes
-      hdf5_manager_.ReadDataset("Conservatives",
-                                &material_block.GetRightHandSideBuffer(),
-                                reading_offset);
-      hdf5_manager_.ReadDataset(
-          "PrimeStates", &material_block.GetPrimeStateBuffer(), reading_offset);
+  /** Replay the chain of differential snapshots until all nodes are read */
+  std::string previous_snapshot = info.previous_snapshot_;
+  while (!previous_snapshot.empty()) {
+    hdf5_manager_.OpenFile(
+        (std::filesystem::path(snapshot_folder) / previous_snapshot).string(),
+        Hdf5Access::Read);
+    SnapshotNodeInfo const previous_info = ReadSnapshotNodeInfo();
+    bool const previous_is_subfiled = !previous_info.subfile_of_node_.empty();
+    open_subfile = -1;
+    if (previous_is_subfiled) {
+      hdf5_manager_.CloseFile();
+    } else {
+      OpenCellDatasetsForReading();
+    }
+    for (unsigned int node_index = 0;
+         node_index < previous_info.node_ids_.size(); ++node_index) {
+      if (previous_info.stored_in_snapshot_[node_index] != 1) {
+        continue;
+      }
+      auto const pending_node =
+          pending_nodes.find(previous_info.node_ids_[node_index]);
+      if (pending_node != pending_nodes.end()) {
+        if (previous_is_subfiled) {
+          OpenSubfileOfNode(snapshot_folder, previous_info, node_index,
+                            open_subfile);
+        }
+        ReadMaterialBlocks(pending_node->second, previous_info, node_index);
+        pending_nodes.erase(pending_node);
+      }
+    }
+    if (!previous_is_subfiled || open_subfile >= 0) {
+      hdf5_manager_.CloseFile();
     }
+    previous_snapshot = previous_info.previous_snapshot_;
   }
 
-  /** Close the file (closes also all groups and datasets that are open) */
-  hdf5_manager_.CloseFile();
+#ifndef PERFORMANCE
+  if (!pending_nodes.empty()) {
+    throw std::runtime_error("The chain of restart snapshots of " +
+                             restore_filename + " is incomplete!");
+  }
+#endif
 
   // return the time of the restart file
   return restart_time;
 }
 
+/**
+ * @brief Indicates whether a node has to be stored in a differential snapshot,
+ * i.e. whether its topology or its conservatives changed beyond the tolerance
+ * since it was last stored. Multi-phase nodes are always stored.
+ * @param node The node to be checked.
+ * @param id The id of the node.
+ * @return True if the node is stored.
+ */
+bool RestartManager::IsStoredInDifferentialSnapshot(Node const &node,
+                                                    nid_t const id) const {
+  if (node.HasLevelset()) {
+    return true;
+  }
+  // new nodes or nodes which moved to this rank
+  auto const reference = reference_states_.find(id);
+  if (reference == reference_states_.end()) {
+    return true;
+  }
+  auto const &[material, block] = *node.GetPhases().begin();
+  if (material != reference->second.material_) {
+    return true;
+  }
+
+  std::vector<double> const &reference_averages = reference->second.averages_;
+  std::size_t cell = 0;
+  for (Equation const eq : MF::ASOE()) {
+    FieldValue const(&averages)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        block.GetAverageBuffer(eq);
+    double maximum_reference = 0.0;
+    double maximum_change = 0.0;
+    for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+      for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+        for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+          maximum_reference =
+              std::max(maximum_reference, std::abs(reference_averages[cell]));
+          maximum_change =
+              std::max(maximum_change,
+                       std::abs(averages[i][j][k] - reference_averages[cell]));
+          cell++;
+        }
+      }
+    }
+    if (maximum_change > RestartOutputSettings::DifferentialSnapshotTolerance *
+                             maximum_reference) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Updates the reference states to the nodes stored in the snapshot just
+ * written. References of nodes no longer present on this rank are dropped.
+ * @param stored_nodes Flags whether the local nodes are stored in the
+ * snapshot, in the order of the full node list.
+ */
+void RestartManager::UpdateReferenceStates(
+    std::vector<bool> const &stored_nodes) {
+  std::unordered_map<nid_t, ReferenceState> reference_states;
+  std::size_t node_index = 0;
+  for (auto const &level : tree_.FullNodeList()) {
+    for (auto const &[id, node] : level) {
+      bool const is_stored = stored_nodes[node_index++];
+      if (node.HasLevelset()) {
+        continue;
+      }
+      if (!is_stored) {
+        // parents of leaf-only snapshots have no reference
+        if (auto const reference = reference_states_.find(id);
+            reference != reference_states_.end() &&
+            (!RestartOutputSettings::LeafOnlySnapshots ||
+             topology_.NodeIsLeaf(id))) {
+          reference_states.emplace(id, std::move(reference->second));
+        }
+        continue;
+      }
+      auto const &[material, block] = *node.GetPhases().begin();
+      ReferenceState reference{material, {}};
+      reference.averages_.reserve(MF::ANOE() * CC::ICX() * CC::ICY() *
+                                  CC::ICZ());
+      for (Equation const eq : MF::ASOE()) {
+        FieldValue const(&averages)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+            block.GetAverageBuffer(eq);
+        for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+          for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+            for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+              reference.averages_.push_back(averages[i][j][k]);
+            }
+          }
+        }
+      }
+      reference_states.emplace(id, std::move(reference));
+    }
+  }
+  reference_states_ = std::move(reference_states);
+}
+
 /**
  * @brief Writes a restart file containing the topology and all relevant node
- * data at the current time step.
+ * data at the current time step. With differential snapshots enabled, only the
+ * nodes changed since they were last stored are written, unless a full
+ * snapshot is due or requested.
  * @param timestep The current time step where the restart snapshot file is
  * written.
  * @param filename_without_extension The filename of the restart file (without
  * file extension).
+ * @param full_snapshot Flag to enforce a full snapshot, e.g. for snapshots that
+ * must not depend on others.
  * @return The final name of the restart file that has been written.
  */
-std::string RestartManager::WriteRestartFile(
-    double const timestep,
-    std::string const &filename_without_extension) const {
+std::string
+RestartManager::WriteRestartFile(double const timestep,
+                                 std::string const &filename_without_extension,
+                                 bool const full_snapshot) {
+
+  /** Decide whether only the changed nodes are written */
+  constexpr unsigned int differential_snapshots_per_full_snapshot =
+      RestartOutputSettings::DifferentialSnapshotsPerFullSnapshot;
+  bool const is_differential = differential_snapshots_per_full_snapshot > 0 &&
+                               !full_snapshot &&
+                               !previous_snapshot_filename_.empty() &&
+                               differential_snapshots_written_ <
+                                   differential_snapshots_per_full_snapshot;
+
+  // Parents are not stored in leaf-only snapshots, their data is averaged from
+  // their children on restore
+  constexpr bool leaves_only = RestartOutputSettings::LeafOnlySnapshots;
+
+  // Flags whether the local nodes are stored (in the order of the node list)
+  std::vector<bool> stored_nodes;
+  // The node information of all local nodes, written in a single call per
+  // dataset
+  std::vector<nid_t> node_ids;
+  std::vector<unsigned short> number_of_materials;
+  std::vector<unsigned short> materials;
+  std::vector<unsigned short> number_of_interface_blocks;
+  std::vector<unsigned short> stored_in_snapshot;
+  // So far nodes can have only one levelset, so this way of counting interface
+  // blocks is fine
+  std::array<unsigned int, 2> local_stored_blocks = {0, 0};
+  for (auto const &level : tree_.FullNodeList()) {
+    for (auto const &[id, node] : level) {
+      bool const is_averaged = leaves_only && !topology_.NodeIsLeaf(id);
+      bool const is_stored =
+          !is_averaged &&
+          (!is_differential || IsStoredInDifferentialSnapshot(node, id));
+      stored_nodes.push_back(is_stored);
+      if (is_stored) {
+        local_stored_blocks[0] += node.GetPhases().size();
+        local_stored_blocks[1] += node.HasLevelset() ? 1 : 0;
+      }
+      node_ids.push_back(id);
+      number_of_materials.push_back(node.GetPhases().size());
+      for (auto const &mat_block : node.GetPhases()) {
+        materials.push_back(MTI(mat_block.first));
+      }
+      number_of_interface_blocks.push_back(node.HasLevelset() ? 1 : 0);
+      stored_in_snapshot.push_back(is_averaged ? 2 : (is_stored ? 1 : 0));
+    }
+  }
 
   /** Prepare data that is required for the restart file (data that needs to be
    * collected from different ranks, etc.) */
@@ -319,33 +688,49 @@ std::string RestartManager::WriteRestartFile(
       nodes_blocks_global.second;
   unsigned int const local_material_blocks_offset = nodes_blocks_offset.second;
 
-  // interface block data (So far nodes can have only one levelset, so this way
-  // of counting is fine).
-  unsigned int const local_number_of_interface_blocks =
-      tree_.NodesWithLevelset().size();
-  std::vector<unsigned int> number_of_interface_blocks_per_rank(
-      MpiUtilities::NumberOfRanks());
-  MPI_Allgather(&local_number_of_interface_blocks, 1, MPI_UNSIGNED,
-                number_of_interface_blocks_per_rank.data(), 1, MPI_UNSIGNED,
-                MPI_COMM_WORLD);
-  unsigned int const local_interface_block_offset = std::accumulate(
-      number_of_interface_blocks_per_rank.begin(),
-      number_of_interface_blocks_per_rank.begin() + my_rank, 0u);
-  unsigned int const global_number_of_interface_blocks = std::accumulate(
-      number_of_interface_blocks_per_rank.begin() + my_rank,
-      number_of_interface_blocks_per_rank.end(), local_interface_block_offset);
+  // With subfiles, consecutive ranks form an aggregator group writing the cell
+  // data into a common subfile
+  constexpr unsigned int aggregator_group_size =
+      RestartOutputSettings::SubfileAggregatorGroupSize;
+  bool const is_subfiled = aggregator_group_size > 0;
+  unsigned int const my_subfile =
+      is_subfiled ? my_rank / aggregator_group_size : 0;
+
+  // stored material and interface block data (counted in the file holding the
+  // cell data of this rank)
+  std::vector<unsigned int> stored_blocks_per_rank(
+      2 * MpiUtilities::NumberOfRanks());
+  MPI_Allgather(local_stored_blocks.data(), 2, MPI_UNSIGNED,
+                stored_blocks_per_rank.data(), 2, MPI_UNSIGNED,
+                MpiUtilities::Communicator());
+  unsigned int local_stored_material_block_offset = 0;
+  unsigned int local_interface_block_offset = 0;
+  unsigned int global_number_of_stored_material_blocks = 0;
+  unsigned int global_number_of_interface_blocks = 0;
+  for (int rank = 0; rank < MpiUtilities::NumberOfRanks(); ++rank) {
+    if (is_subfiled && rank / aggregator_group_size != my_subfile) {
+      continue;
+    }
+    if (rank == static_cast<int>(my_rank)) {
+      local_stored_material_block_offset =
+          global_number_of_stored_material_blocks;
+      local_interface_block_offset = global_number_of_interface_blocks;
+    }
+    global_number_of_stored_material_blocks += stored_blocks_per_rank[2 * rank];
+    global_number_of_interface_blocks += stored_blocks_per_rank[2 * rank + 1];
+  }
 
   /** Define the dimensions for the different values and datasets that are
    * written to the restart file */
   std::vector<hsize_t> const total_dimensions_conservatives(
-      {global_number_of_material_blocks, MF::ANOE(), CC::TCX(), CC::TCY(),
-       CC::TCZ()});
+      {global_number_of_stored_material_blocks, MF::ANOE(), CC::TCX(),
+       CC::TCY(), CC::TCZ()});
   std::vector<hsize_t> const local_dimensions_conservatives(
       {1, MF::ANOE(), CC::TCX(), CC::TCY(), CC::TCZ()});
 
   std::vector<hsize_t> const total_dimensions_prime_states(
-      {global_number_of_material_blocks, MF::ANOP(), CC::TCX(), CC::TCY(),
-       CC::TCZ()});
+      {global_number_of_stored_material_blocks, MF::ANOP(), CC::TCX(),
+       CC::TCY(), CC::TCZ()});
   std::vector<hsize_t> const local_dimensions_prime_states(
       {1, MF::ANOP(), CC::TCX(), CC::TCY(), CC::TCZ()});
 
@@ -356,11 +741,13 @@ std::string RestartManager::WriteRestartFile(
 
   std::vector<hsize_t> const total_dimensions_node_scalar(
       {global_number_of_nodes});
-  std::vector<hsize_t> const local_dimensions_node_scalar({1});
+  std::vector<hsize_t> const local_dimensions_node_scalar(
+      {std::max(hsize_t(1), hsize_t(node_ids.size()))});
 
   std::vector<hsize_t> const total_dimensions_block_scalar(
       {global_number_of_material_blocks});
-  std::vector<hsize_t> const local_dimensions_block_scalar({1});
+  std::vector<hsize_t> const local_dimensions_block_scalar(
+      {std::max(hsize_t(1), hsize_t(materials.size()))});
 
   /** Open the hdf5 file where the data is written into */
   std::string const filename = filename_without_extension + ".h5";
@@ -381,18 +768,106 @@ std::string RestartManager::WriteRestartFile(
   hdf5_manager_.OpenDatasetForWriting(
       "NumberOfInterfaceBlocks", total_dimensions_node_scalar,
       local_dimensions_node_scalar, local_nodes_offset, H5T_NATIVE_USHORT);
+  if (is_differential || leaves_only) {
+    hdf5_manager_.OpenDatasetForWriting(
+        "StoredInSnapshot", total_dimensions_node_scalar,
+        local_dimensions_node_scalar, local_nodes_offset, H5T_NATIVE_USHORT);
+  }
+  if (is_subfiled) {
+    hdf5_manager_.OpenDatasetForWriting(
+        "SubfileOfNode", total_dimensions_node_scalar,
+        local_dimensions_node_scalar, local_nodes_offset, H5T_NATIVE_UINT);
+  }
+
+  /** Write the general info data of all local nodes at once */
+  if (!node_ids.empty()) {
+    hdf5_manager_.WriteDataset("NodeIds", node_ids.data());
+    hdf5_manager_.WriteDataset("NumberOfInterfaceBlocks",
+                               number_of_interface_blocks.data());
+    hdf5_manager_.WriteDataset("NumberOfMaterials", number_of_materials.data());
+    hdf5_manager_.WriteDataset("Materials", materials.data());
+    if (is_differential || leaves_only) {
+      hdf5_manager_.WriteDataset("StoredInSnapshot", stored_in_snapshot.data());
+    }
+    if (is_subfiled) {
+      std::vector<unsigned int> const subfile_of_node(node_ids.size(),
+                                                      my_subfile);
+      hdf5_manager_.WriteDataset("SubfileOfNode", subfile_of_node.data());
+    }
+  }
+
+  /** Write metadata into the hdf5 file (all required to check consistency of
+   * restart file and new input file) */
+  hdf5_manager_.OpenGroup("simulation_data");
+  // Time
+  hdf5_manager_.WriteAttributeScalar("Time", timestep, H5T_NATIVE_DOUBLE);
+  // Number of Dimensions
+  hdf5_manager_.WriteAttributeScalar("Dimensions", DTI(CC::DIM()),
+                                     H5T_NATIVE_UINT);
+  // Number of Internal Cells
+  hdf5_manager_.WriteAttributeScalar("InternalCells", CC::ICX(),
+                                     H5T_NATIVE_UINT);
+  // Number of Halo Cells
+  hdf5_manager_.WriteAttributeScalar("HaloSize", CC::HS(), H5T_NATIVE_UINT);
+  // Maximum level
+  hdf5_manager_.WriteAttributeScalar("MaximumLevel", maximum_level_,
+                                     H5T_NATIVE_UINT);
+  // Length reference
+  hdf5_manager_.WriteAttributeScalar("LengthReference", length_reference_,
+                                     H5T_NATIVE_DOUBLE);
+  // Velocity reference
+  hdf5_manager_.WriteAttributeScalar("VelocityReference", velocity_reference_,
+                                     H5T_NATIVE_DOUBLE);
+  // Density reference
+  hdf5_manager_.WriteAttributeScalar("DensityReference", density_reference_,
+                                     H5T_NATIVE_DOUBLE);
+  // Temperature reference
+  hdf5_manager_.WriteAttributeScalar("TemperatureReference",
+                                     temperature_reference_, H5T_NATIVE_DOUBLE);
+  // Predecessor of differential snapshots (placed in the same folder)
+  if (is_differential) {
+    hdf5_manager_.WriteAttributeString(
+        "PreviousSnapshot",
+        FileUtilities::RemoveFilePath(previous_snapshot_filename_));
+  }
+  // Parents are averaged from their children on restore
+  if (leaves_only) {
+    hdf5_manager_.WriteAttributeScalar("LeavesOnly", 1u, H5T_NATIVE_UINT);
+  }
+  // Subfiles holding the cell data (placed in the same folder)
+  if (is_subfiled) {
+    hdf5_manager_.WriteAttributeString(
+        "SubfilePrefix",
+        FileUtilities::RemoveFilePath(filename_without_extension));
+  }
+
+  /** Close the open groups (automatically closes all datasets) */
+  hdf5_manager_.CloseGroup();
+
+  /** Switch to the subfile of the aggregator group, which is shared by the
+   * ranks of the group only */
+  if (is_subfiled) {
+    hdf5_manager_.CloseFile();
+    MPI_Comm subfile_communicator;
+    MPI_Comm_split(MpiUtilities::Communicator(), my_subfile, my_rank,
+                   &subfile_communicator);
+    hdf5_manager_.OpenFile(SubfileName(filename_without_extension, my_subfile),
+                           Hdf5Access::Write, subfile_communicator);
+    // the file holds its own duplicate of the communicator
+    MPI_Comm_free(&subfile_communicator);
+  }
 
   /** Open the group and datasets, where the cell data information of the node
    * are written into */
   hdf5_manager_.OpenGroup("node_cell_data");
   hdf5_manager_.OpenDatasetForWriting(
       "Conservatives", total_dimensions_conservatives,
-      local_dimensions_conservatives, local_material_blocks_offset,
-      H5T_NATIVE_DOUBLE);
+      local_dimensions_conservatives, local_stored_material_block_offset,
+      FieldValueDatatype());
   hdf5_manager_.OpenDatasetForWriting(
       "PrimeStates", total_dimensions_prime_states,
-      local_dimensions_prime_states, local_material_blocks_offset,
-      H5T_NATIVE_DOUBLE);
+      local_dimensions_prime_states, local_stored_material_block_offset,
+      FieldValueDatatype());
   hdf5_manager_.OpenDatasetForWriting(
       "Levelset", total_dimensions_single_buffer,
       local_dimensions_single_buffer, local_interface_block_offset,
@@ -402,28 +877,15 @@ std::string RestartManager::WriteRestartFile(
       local_dimensions_single_buffer, local_interface_block_offset,
       H5T_NATIVE_CHAR);
 
-  /** Write all node data to the file */
+  /** Write the cell data of all stored nodes to the file */
+  std::size_t node_index = 0;
   for (auto const &level : tree_.FullNodeList()) {
     for (auto const &[id, node] : level) {
-      /** Write general node info data */
-      std::unordered_map<MaterialName, Block> const &phases(node.GetPhases());
-      unsigned short const number_of_materials = phases.size();
-      unsigned short const number_of_interface_blocks =
-          node.HasLevelset() ? 1 : 0;
-
-      // Write the info data
-      hdf5_manager_.WriteDataset("NodeIds", &id);
-      hdf5_manager_.WriteDataset("NumberOfInterfaceBlocks",
-                                 &number_of_interface_blocks);
-      hdf5_manager_.WriteDataset("NumberOfMaterials", &number_of_materials);
-      for (auto const &mat_block : phases) {
-        unsigned short const material_index = MTI(mat_block.first);
-        hdf5_manager_.WriteDataset("Materials", &material_index);
+      if (!stored_nodes[node_index++]) {
+        continue;
       }
-
-      /** Write the actual cell data */
       // Write material/block data (conservatives and prime states)
-      for (auto const &mat_block : phases) {
+      for (auto const &mat_block : node.GetPhases()) {
         // Write conservatives and prime states
         hdf5_manager_.WriteDataset("Conservatives",
                                    &mat_block.second.GetAverageBuffer());
@@ -443,43 +905,62 @@ std::string RestartManager::WriteRestartFile(
     }
   }
 
-  /** Close the open groups (automatically closes all datasets) */
-  hdf5_manager_.CloseGroup();
-
-  /** Write metadata into the hdf5 file (all required to check consistency of
-   * restart file and new input file) */
-  hdf5_manager_.OpenGroup("simulation_data");
-  // Time
-  hdf5_manager_.WriteAttributeScalar("Time", timestep, H5T_NATIVE_DOUBLE);
-  // Number of Dimensions
-  hdf5_manager_.WriteAttributeScalar("Dimensions", DTI(CC::DIM()),
-                                     H5T_NATIVE_UINT);
-  // Number of Internal Cells
-  hdf5_manager_.WriteAttributeScalar("InternalCells", CC::ICX(),
-                                     H5T_NATIVE_UINT);
-  // Number of Halo Cells
-  hdf5_manager_.WriteAttributeScalar("HaloSize", CC::HS(), H5T_NATIVE_UINT);
-  // Maximum level
-  hdf5_manager_.WriteAttributeScalar("MaximumLevel", maximum_level_,
-                                     H5T_NATIVE_UINT);
-  // Length reference
-  hdf5_manager_.WriteAttributeScalar("LengthReference", length_reference_,
-                                     H5T_NATIVE_DOUBLE);
-  // Velocity reference
-  hdf5_manager_.WriteAttributeScalar("VelocityReference", velocity_reference_,
-                                     H5T_NATIVE_DOUBLE);
-  // Density reference
-  hdf5_manager_.WriteAttributeScalar("DensityReference", density_reference_,
-                                     H5T_NATIVE_DOUBLE);
-  // Temperature reference
-  hdf5_manager_.WriteAttributeScalar("TemperatureReference",
-                                     temperature_reference_, H5T_NATIVE_DOUBLE);
-
   /** Close the file (automatically closes all groups and datasets) */
   hdf5_manager_.CloseFile();
 
+  /** Keep track of the snapshot chain */
+  if (is_differential) {
+    differential_snapshots_written_++;
+  } else {
+    differential_snapshots_written_ = 0;
+    full_snapshot_filename_ = filename;
+  }
+  previous_snapshot_filename_ = filename;
+  if constexpr (differential_snapshots_per_full_snapshot > 0) {
+    UpdateReferenceStates(stored_nodes);
+  }
+
   /** Return the created filename and provide logging */
-  logger_.LogMessage("Restart file written at t = " +
-                     StringOperations::ToScientificNotationString(timestep, 9));
+  logger_.LogMessage(
+      std::string(is_differential ? "Differential restart" : "Restart") +
+      " file written at t = " +
+      StringOperations::ToScientificNotationString(timestep, 9));
   return filename;
 }
+
+/**
+ * @brief Gives the name of a subfile of a restart snapshot.
+ * @param prefix The snapshot filename without extension (with or without
+ * path).
+ * @param subfile The index of the subfile, i.e. of the aggregator group.
+ * @return The subfile name.
+ */
+std::string RestartManager::SubfileName(std::string const &prefix,
+                                        unsigned int const subfile) {
+  return prefix + "_subfile_" + std::to_string(subfile) + ".h5";
+}
+
+/**
+ * @brief Gives all files a restart snapshot written in the current simulation
+ * consists of, i.e. the snapshot file and its subfiles. The snapshot file is
+ * the last entry, such that it is complete only if all its subfiles are.
+ * @param filename The name of the snapshot file.
+ * @return The names of all files (with the path of the given name).
+ */
+std::vector<std::string>
+RestartManager::SnapshotFiles(std::string const &filename) {
+  std::vector<std::string> files;
+  constexpr unsigned int aggregator_group_size =
+      RestartOutputSettings::SubfileAggregatorGroupSize;
+  if constexpr (aggregator_group_size > 0) {
+    unsigned int const number_of_subfiles =
+        (MpiUtilities::NumberOfRanks() + aggregator_group_size - 1) /
+        aggregator_group_size;
+    std::string const prefix = FileUtilities::RemoveFileExtension(filename);
+    for (unsigned int subfile = 0; subfile < number_of_subfiles; ++subfile) {
+      files.push_back(SubfileName(prefix, subfile));
+    }
+  }
+  files.push_back(filename);
+  return files;
+}
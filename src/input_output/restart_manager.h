@@ -23,6 +23,8 @@
 #define RESTART_MANAGER_H
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "input_output/hdf5/hdf5_manager.h"
 #include "topology/topology_manager.h"
@@ -34,7 +36,8 @@
  * snapshot files. The restart files are written in HDF5 Format (without XDMF
  * file). No mesh information is used for the restart file. Only data relevant
  * for setting up the simulations are required. The restart file cannot be
- * visualized in ParaView.
+ * visualized in ParaView. With subfiles, the cell data is written into one file
+ * per aggregator group of ranks and the snapshot file only serves as index.
  */
 class RestartManager {
   // Member variables to get topology information on current and all ranks
@@ -51,6 +54,59 @@ class RestartManager {
   double const temperature_reference_;
   double const velocity_reference_;
 
+  /**
+   * @brief Conservatives of a single-phase node at the time it was last stored
+   * in a restart snapshot.
+   */
+  struct ReferenceState {
+    MaterialName material_;
+    std::vector<double> averages_;
+  };
+  // States of the local nodes as stored in the snapshot chain (only used for
+  // differential snapshots)
+  std::unordered_map<nid_t, ReferenceState> reference_states_;
+  // Number of differential snapshots written since the last full snapshot
+  unsigned int differential_snapshots_written_;
+  // The previously written snapshot and the full snapshot its chain starts at
+  std::string previous_snapshot_filename_;
+  std::string full_snapshot_filename_;
+
+  /**
+   * @brief Global information of all nodes of a snapshot file, i.e. the
+   * topology and the position of the node data in the cell datasets.
+   */
+  struct SnapshotNodeInfo {
+    std::vector<nid_t> node_ids_;
+    std::vector<unsigned short> number_of_materials_;
+    std::vector<MaterialName> materials_;
+    std::vector<unsigned short> number_of_interface_blocks_;
+    // 1: stored in the snapshot, 0: stored in a previous snapshot of the
+    // chain, 2: averaged from the children ( parents of leaf-only snapshots )
+    std::vector<unsigned short> stored_in_snapshot_;
+    // offsets of the nodes in the material list and cell datasets
+    std::vector<hsize_t> material_offsets_;
+    std::vector<hsize_t> material_block_offsets_;
+    std::vector<hsize_t> interface_block_offsets_;
+    // the snapshot the file refers to for the nodes not stored (empty for full
+    // snapshots)
+    std::string previous_snapshot_;
+    // the subfile holding the cell data of each node and the prefix of the
+    // subfile names (both empty if the cell data is in the snapshot file)
+    std::vector<unsigned int> subfile_of_node_;
+    std::string subfile_prefix_;
+  };
+
+  SnapshotNodeInfo ReadSnapshotNodeInfo() const;
+  void OpenCellDatasetsForReading() const;
+  void OpenSubfileOfNode(std::string const &snapshot_folder,
+                         SnapshotNodeInfo const &info,
+                         unsigned int const node_index,
+                         int &open_subfile) const;
+  void ReadMaterialBlocks(Node &node, SnapshotNodeInfo const &info,
+                          unsigned int const node_index) const;
+  bool IsStoredInDifferentialSnapshot(Node const &node, nid_t const id) const;
+  void UpdateReferenceStates(std::vector<bool> const &stored_nodes);
+
 public:
   RestartManager() = delete;
   explicit RestartManager(UnitHandler const &unit_handler,
@@ -64,9 +120,23 @@ public:
 
   // Functions to restore simulation or write restart file
   double RestoreSimulation(std::string const &restore_filename) const;
-  std::string
-  WriteRestartFile(double const timestep,
-                   std::string const &filename_without_extension) const;
+  std::string WriteRestartFile(double const timestep,
+                               std::string const &filename_without_extension,
+                               bool const full_snapshot = false);
+
+  static std::string SubfileName(std::string const &prefix,
+                                 unsigned int const subfile);
+  static std::vector<std::string> SnapshotFiles(std::string const &filename);
+
+  /**
+   * @brief Gives the full snapshot the chain of the last written snapshot
+   * starts at. Coincides with the last written snapshot unless differential
+   * snapshots are used.
+   * @return The filename of the full snapshot.
+   */
+  std::string const &LastFullSnapshot() const {
+    return full_snapshot_filename_;
+  }
 };
 
 #endif // RESTART_MANAGER_H
@@ -0,0 +1,88 @@
+//===----------------------- in_memory_checkpoint.h -----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef IN_MEMORY_CHECKPOINT_H
+#define IN_MEMORY_CHECKPOINT_H
+
+#include "materials/material_definitions.h"
+#include "topology/node_id_type.h"
+#include <mpi.h>
+#include <vector>
+
+/**
+ * @brief The InMemoryCheckpoint struct holds the state of the simulation at
+ * the end of a macro timestep in memory ( see
+ * RestartOutputSettings::InMemoryCheckpointInterval ). Besides the global
+ * topology, each rank keeps the packed data of its own nodes and a copy of
+ * the data of its buddy rank, i.e. the preceding rank. The node data is packed
+ * with the datatypes of the load balancing migration. The packed data of the
+ * nodes is stored in the order of the node ids.
+ */
+struct InMemoryCheckpoint {
+  // run time of the checkpoint, negative if no checkpoint has been taken
+  double time_ = -1.0;
+  // global topology at the checkpoint ( see TopologyManager::RestoreTopology )
+  std::vector<nid_t> ids_;
+  std::vector<unsigned short> number_of_materials_;
+  std::vector<MaterialName> materials_;
+  // rank holding each node at the checkpoint
+  std::vector<int> ranks_;
+  // packed data of the own nodes and its size per node
+  std::vector<char> own_data_;
+  std::vector<int> own_sizes_;
+  // packed data of the nodes of the buddy rank and its size per node
+  std::vector<char> buddy_data_;
+  std::vector<int> buddy_sizes_;
+  // pending exchange of the data with the buddy ranks
+  std::vector<MPI_Request> requests_;
+
+  /**
+   * @brief Indicates whether a checkpoint has been taken.
+   * @return True if the simulation can be rolled back, false otherwise.
+   */
+  bool IsValid() const { return time_ >= 0.0; }
+
+  /**
+   * @brief Gives the buddy rank, which keeps the copy of the data of the given
+   * rank.
+   * @param rank The rank whose data is copied.
+   * @param number_of_ranks The number of ranks.
+   * @return The rank holding the copy.
+   */
+  static int BuddyOfRank(int const rank, int const number_of_ranks) {
+    return (rank + 1) % number_of_ranks;
+  }
+
+  /**
+   * @brief Gives the bytes held by the checkpoint on this rank.
+   * @return The bytes of the packed node data and the topology.
+   */
+  std::size_t Bytes() const {
+    return own_data_.capacity() + buddy_data_.capacity() +
+           ids_.capacity() * sizeof(nid_t) +
+           number_of_materials_.capacity() * sizeof(unsigned short) +
+           materials_.capacity() * sizeof(MaterialName) +
+           ranks_.capacity() * sizeof(int) +
+           (own_sizes_.capacity() + buddy_sizes_.capacity()) * sizeof(int);
+  }
+};
+
+#endif // IN_MEMORY_CHECKPOINT_H
@@ -0,0 +1,274 @@
+//===---------------------- benchmark_inputfile.cpp -----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/utilities/benchmark_inputfile.h"
+
+#include <stdexcept>
+
+#include "user_specifications/compile_time_constants.h"
+
+namespace {
+/**
+ * @brief Largest number of blocks on level zero in one direction ( see
+ * MultiResolutionReader ).
+ */
+constexpr unsigned int maximum_blocks_per_direction_ = 128;
+
+/**
+ * @brief Reads a positive number given after a command line option.
+ * @param arguments The command line arguments.
+ * @param index Index of the option, the number is expected at the next index.
+ * @return The number.
+ */
+unsigned int ReadPositiveNumber(std::vector<std::string> const &arguments,
+                                std::size_t const index) {
+  if (index + 1 >= arguments.size()) {
+    throw std::invalid_argument("Benchmark option " + arguments[index] +
+                                " requires a number!");
+  }
+  int const number = std::stoi(arguments[index + 1]);
+  if (number <= 0) {
+    throw std::invalid_argument("Benchmark option " + arguments[index] +
+                                " must be larger than zero!");
+  }
+  return static_cast<unsigned int>(number);
+}
+
+/**
+ * @brief Gives the squared distance to the center of the unit cell containing
+ * the point as expression of the active coordinates.
+ * @return The expression.
+ */
+std::string SquaredDistanceToUnitCellCenter() {
+  std::string expression = "pow(x - floor(x) - 0.5, 2)";
+  if constexpr (CC::DIM() != Dimension::One) {
+    expression += " + pow(y - floor(y) - 0.5, 2)";
+  }
+  if constexpr (CC::DIM() == Dimension::Three) {
+    expression += " + pow(z - floor(z) - 0.5, 2)";
+  }
+  return expression;
+}
+
+/**
+ * @brief Gives the input of a material with an ideal-gas equation of state.
+ * @param index Index of the material ( starting at 1 ).
+ * @return The xml node of the material.
+ */
+std::string Material(unsigned int const index) {
+  std::string const tag = "material" + std::to_string(index);
+  return "<" + tag +
+         ">"
+         "<equationOfState>"
+         "<type> StiffenedGas </type>"
+         "<gamma> 1.4 </gamma>"
+         "<backgroundPressure> 0.0 </backgroundPressure>"
+         "</equationOfState>"
+         "<properties>"
+         "<specificHeatCapacity> 0.0 </specificHeatCapacity>"
+         "<thermalConductivity> 0.0 </thermalConductivity>"
+         "<shearViscosity> 0.0 </shearViscosity>"
+         "<bulkViscosity> 0.0 </bulkViscosity>"
+         "</properties>"
+         "</" +
+         tag + ">";
+}
+
+/**
+ * @brief Gives the initial condition of a material, a density wave advected
+ * diagonally through the periodic box.
+ * @param index Index of the material ( starting at 1 ).
+ * @param density The mean density of the material.
+ * @return The xml node of the initial condition.
+ */
+std::string InitialCondition(unsigned int const index, double const density) {
+  std::string const tag = "material" + std::to_string(index);
+  return "<" + tag + ">density := " + std::to_string(density) +
+         " * (1.0 + 0.1 * sin(2.0 * pi * x));"
+         "velocityX := 1.0;"
+         "velocityY := 0.5;"
+         "velocityZ := 0.25;"
+         "pressure := 1.0;"
+         "</" +
+         tag + ">";
+}
+} // namespace
+
+namespace BenchmarkInputfile {
+
+/**
+ * @brief Reads the benchmark settings from the command line arguments following
+ * the --benchmark option, i.e. --steps <macro steps>, --blocks <blocks per
+ * rank> and --multi-phase.
+ * @param arguments The command line arguments after --benchmark.
+ * @return The benchmark settings, defaults for options that are not given.
+ */
+BenchmarkSetup ParseArguments(std::vector<std::string> const &arguments) {
+  BenchmarkSetup setup;
+  for (std::size_t index = 0; index < arguments.size(); ++index) {
+    if (arguments[index] == "--steps") {
+      setup.macro_steps_ = ReadPositiveNumber(arguments, index++);
+    } else if (arguments[index] == "--blocks") {
+      setup.blocks_per_rank_ = ReadPositiveNumber(arguments, index++);
+    } else if (arguments[index] == "--multi-phase") {
+      setup.multi_phase_ = true;
+    } else {
+      throw std::invalid_argument("Unknown benchmark option " +
+                                  arguments[index] + "!");
+    }
+  }
+  return setup;
+}
+
+/**
+ * @brief Distributes the blocks on level zero onto the active directions such
+ * that the domain is as close to a cube as possible.
+ * @param number_of_blocks The total number of blocks on level zero.
+ * @return The number of blocks in each direction ( one for inactive
+ * directions ).
+ */
+std::array<unsigned int, 3> NodeRatio(unsigned int const number_of_blocks) {
+  std::array<unsigned int, 3> best_ratio = {0, 0, 0};
+  unsigned int const maximum_y =
+      CC::DIM() == Dimension::One ? 1 : maximum_blocks_per_direction_;
+  unsigned int const maximum_z =
+      CC::DIM() == Dimension::Three ? maximum_blocks_per_direction_ : 1;
+  for (unsigned int z = 1; z <= maximum_z; ++z) {
+    for (unsigned int y = 1; y <= maximum_y; ++y) {
+      if (number_of_blocks % (y * z) != 0) {
+        continue;
+      }
+      unsigned int const x = number_of_blocks / (y * z);
+      // Prefer the smallest largest extent, sorted descending from x to z
+      if (x <= maximum_blocks_per_direction_ && x >= y && y >= z &&
+          (best_ratio[0] == 0 || x < best_ratio[0])) {
+        best_ratio = {x, y, z};
+      }
+    }
+  }
+  if (best_ratio[0] == 0) {
+    throw std::invalid_argument(
+        "The benchmark blocks cannot be arranged on level zero, use fewer "
+        "blocks per rank!");
+  }
+  return best_ratio;
+}
+
+/**
+ * @brief Creates the xml input of the benchmark. The uniform periodic box holds
+ * the given number of blocks per rank on level zero. Output, restart snapshots
+ * and refinement are disabled, the runtime profiler is enabled and the run
+ * ends after the given number of macro time steps. In the multi-phase case, a
+ * bubble of a lighter material is placed in each unit cube of the domain.
+ * @param setup The benchmark settings.
+ * @param number_of_ranks The number of MPI ranks of the run.
+ * @return The content of the xml input file.
+ */
+std::string Create(BenchmarkSetup const &setup, int const number_of_ranks) {
+  std::array<unsigned int, 3> const node_ratio =
+      NodeRatio(setup.blocks_per_rank_ * number_of_ranks);
+  std::string const periodic_boundaries =
+      "<west> periodic </west><east> periodic </east>"
+      "<south> periodic </south><north> periodic </north>"
+      "<bottom> periodic </bottom><top> periodic </top>";
+  std::string const levelset =
+      setup.multi_phase_
+          ? "phi := 0.3 - sqrt(" + SquaredDistanceToUnitCellCenter() + ");"
+          : std::string("phi := 1.0;");
+
+  return "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+         "<configuration>"
+         "<domain>"
+         "<nodeSize> 1.0 </nodeSize>"
+         "<nodeRatio>"
+         "<x> " +
+         std::to_string(node_ratio[0]) +
+         " </x>"
+         "<y> " +
+         std::to_string(node_ratio[1]) +
+         " </y>"
+         "<z> " +
+         std::to_string(node_ratio[2]) +
+         " </z>"
+         "</nodeRatio>"
+         "<boundaryConditions>"
+         "<material>" +
+         periodic_boundaries +
+         "</material>"
+         "<levelSet>" +
+         periodic_boundaries +
+         "</levelSet>"
+         "</boundaryConditions>"
+         "<initialConditions>" +
+         InitialCondition(1, 1.0) +
+         (setup.multi_phase_ ? InitialCondition(2, 0.1) : std::string()) +
+         "<levelSet1>" + levelset +
+         "</levelSet1>"
+         "</initialConditions>"
+         "</domain>"
+         "<materials>"
+         "<numberOfMaterials> " +
+         std::string(setup.multi_phase_ ? "2" : "1") + " </numberOfMaterials>" +
+         Material(1) + (setup.multi_phase_ ? Material(2) : std::string()) +
+         "</materials>"
+         "<materialPairings>"
+         "<material1_2>"
+         "<surfaceTensionCoefficient> 0.0 </surfaceTensionCoefficient>"
+         "</material1_2>"
+         "</materialPairings>"
+         "<sourceTerms>"
+         "<gravity><x> 0.0 </x><y> 0.0 </y><z> 0.0 </z></gravity>"
+         "</sourceTerms>"
+         "<multiResolution>"
+         "<maximumLevel> 0 </maximumLevel>"
+         "<refinementCriterion>"
+         "<epsilonReference> 0.01 </epsilonReference>"
+         "<levelOfEpsilonReference> 0 </levelOfEpsilonReference>"
+         "</refinementCriterion>"
+         "</multiResolution>"
+         "<timeControl>"
+         "<startTime> 0.0 </startTime>"
+         "<endTime> 1.0e10 </endTime>"
+         "<CFLNumber> 0.6 </CFLNumber>"
+         "<maximumMacroSteps> " +
+         std::to_string(setup.macro_steps_) +
+         " </maximumMacroSteps>"
+         "</timeControl>"
+         "<dimensionalization>"
+         "<lengthReference> 1.0 </lengthReference>"
+         "<velocityReference> 1.0 </velocityReference>"
+         "<densityReference> 1.0 </densityReference>"
+         "<temperatureReference> 1.0 </temperatureReference>"
+         "</dimensionalization>"
+         "<restart>"
+         "<restore><mode> Off </mode><fileName> none </fileName></restore>"
+         "<snapshots><type> Off </type></snapshots>"
+         "</restart>"
+         "<output>"
+         "<timeNamingFactor> 1.0 </timeNamingFactor>"
+         "<standardOutput><type> Off </type></standardOutput>"
+         "<interfaceOutput><type> Off </type></interfaceOutput>"
+         "<profiling/>"
+         "</output>"
+         "</configuration>";
+}
+
+} // namespace BenchmarkInputfile
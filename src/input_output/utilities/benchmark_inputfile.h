@@ -0,0 +1,54 @@
+//===----------------------- benchmark_inputfile.h ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef BENCHMARK_INPUTFILE_H
+#define BENCHMARK_INPUTFILE_H
+
+#include <array>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Settings of the benchmark run mode ( see main ).
+ */
+struct BenchmarkSetup {
+  // macro time steps that are run
+  unsigned int macro_steps_ = 10;
+  // blocks on level zero per rank
+  unsigned int blocks_per_rank_ = 8;
+  // a periodic array of bubbles of a second material is added
+  bool multi_phase_ = false;
+};
+
+/**
+ * @brief Creates the synthetic input of the benchmark run mode. The mesh is a
+ * uniform ( single level ) periodic box, which grows with the number of ranks
+ * ( weak scaling ), and is advanced without any output.
+ */
+namespace BenchmarkInputfile {
+
+BenchmarkSetup ParseArguments(std::vector<std::string> const &arguments);
+std::array<unsigned int, 3> NodeRatio(unsigned int const number_of_blocks);
+std::string Create(BenchmarkSetup const &setup, int const number_of_ranks);
+
+} // namespace BenchmarkInputfile
+
+#endif // BENCHMARK_INPUTFILE_H
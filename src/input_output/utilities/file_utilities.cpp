@@ -143,4 +143,19 @@ void AppendToTextBasedFile(std::string const &filename,
   output_stream.close();
 }
 
+/**
+ * @brief Replaces a file containing human readable (ascii) text atomically,
+ * i.e. readers either see the old or the new content but never a partially
+ * written file. The content is written to a temporary file next to the target
+ * first, which is then renamed.
+ * @param filename The name of the file to be replaced (created if missing).
+ * @param content The text to be written into the file.
+ */
+void ReplaceTextBasedFile(std::string const &filename,
+                          std::string const &content) {
+  std::string const temporary_filename = filename + ".tmp";
+  WriteTextBasedFile(temporary_filename, content);
+  std::filesystem::rename(temporary_filename, filename);
+}
+
 } // namespace FileUtilities
@@ -41,6 +41,8 @@ void WriteTextBasedFile(std::string const &filename,
                         std::string const &content);
 void AppendToTextBasedFile(std::string const &filename,
                            std::string const &content);
+void ReplaceTextBasedFile(std::string const &filename,
+                          std::string const &content);
 std::filesystem::path
 CreateOutputBaseFolder(std::filesystem::path const &inputfile);
 
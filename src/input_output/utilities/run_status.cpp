@@ -0,0 +1,88 @@
+//===--------------------------- run_status.cpp ---------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/utilities/run_status.h"
+
+#include <cmath>
+
+#include "utilities/string_operations.h"
+
+namespace {
+/**
+ * @brief Converts a number into a JSON value.
+ * @param number The number.
+ * @return The number in scientific notation, null if it is not finite ( e.g.
+ * the projection of the remaining time for a vanishing time step ).
+ */
+std::string JsonNumber(double const number) {
+  return std::isfinite(number)
+             ? StringOperations::ToScientificNotationString(number, 9)
+             : "null";
+}
+
+/**
+ * @brief Converts a point in time into an ISO 8601 string in UTC.
+ * @param time The point in time ( seconds since epoch ).
+ * @return The quoted time string.
+ */
+std::string JsonTime(std::time_t const time) {
+  char buffer[32];
+  std::tm const *const utc = std::gmtime(&time);
+  if (utc == nullptr ||
+      std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", utc) == 0) {
+    return "null";
+  }
+  return "\"" + std::string(buffer) + "\"";
+}
+} // namespace
+
+/**
+ * @brief Gives the run status as a single JSON object. Besides the members, the
+ * projected completion time is given ( null if it cannot be projected ).
+ * @param status The run status.
+ * @return The JSON object ( one entry per line ).
+ */
+std::string RunStatusJson(RunStatus const &status) {
+  auto const entry = [](std::string const &name, std::string const &value) {
+    return "  \"" + name + "\": " + value;
+  };
+  std::string const completion =
+      std::isfinite(status.remaining_seconds_)
+          ? JsonTime(status.updated_ +
+                     static_cast<std::time_t>(status.remaining_seconds_))
+          : "null";
+  return "{\n" + entry("updated", JsonTime(status.updated_)) + ",\n" +
+         entry("simulation_time", JsonNumber(status.simulation_time_)) + ",\n" +
+         entry("end_time", JsonNumber(status.end_time_)) + ",\n" +
+         entry("timestep_size", JsonNumber(status.timestep_size_)) + ",\n" +
+         entry("macro_steps", std::to_string(status.macro_steps_)) + ",\n" +
+         entry("macro_steps_per_hour",
+               JsonNumber(status.macro_steps_per_hour_)) +
+         ",\n" +
+         entry("number_of_nodes", std::to_string(status.number_of_nodes_)) +
+         ",\n" +
+         entry("number_of_leaves", std::to_string(status.number_of_leaves_)) +
+         ",\n" + entry("rank_imbalance", JsonNumber(status.rank_imbalance_)) +
+         ",\n" + entry("elapsed_seconds", JsonNumber(status.elapsed_seconds_)) +
+         ",\n" +
+         entry("remaining_seconds", JsonNumber(status.remaining_seconds_)) +
+         ",\n" + entry("projected_completion", completion) + "\n}\n";
+}
@@ -0,0 +1,57 @@
+//===---------------------------- run_status.h ----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef RUN_STATUS_H
+#define RUN_STATUS_H
+
+#include <ctime>
+#include <string>
+
+/**
+ * @brief Progress of a running simulation as written to the status file in the
+ * output folder ( see InputOutputManager::WriteRunStatus ). The file is meant
+ * to be polled by monitoring tools during long runs instead of parsing the log.
+ * All times of the simulation are dimensional.
+ */
+struct RunStatus {
+  double simulation_time_ = 0.0;
+  double end_time_ = 0.0;
+  // size of the last macro time step
+  double timestep_size_ = 0.0;
+  // macro time steps of this run ( restarts start counting from zero )
+  unsigned int macro_steps_ = 0;
+  // derived from the mean wall clock time of the last macro time steps
+  double macro_steps_per_hour_ = 0.0;
+  unsigned int number_of_nodes_ = 0;
+  unsigned int number_of_leaves_ = 0;
+  // ratio of the maximum and the mean cell updates of all ranks
+  double rank_imbalance_ = 1.0;
+  // wall clock time of this run so far in seconds
+  double elapsed_seconds_ = 0.0;
+  // projected wall clock time until the end time is reached in seconds
+  double remaining_seconds_ = 0.0;
+  // time of the update ( seconds since epoch )
+  std::time_t updated_ = 0;
+};
+
+std::string RunStatusJson(RunStatus const &status);
+
+#endif // RUN_STATUS_H
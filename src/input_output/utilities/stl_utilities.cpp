@@ -21,56 +21,149 @@
 //===----------------------------------------------------------------------===//
 #include "input_output/utilities/stl_utilities.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mpi.h>
+#include <numeric>
+#include <stdexcept>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "communication/mpi_utilities.h"
 #include "utilities/mathematical_functions.h"
 
 namespace StlUtilities {
 /**
  * @brief Reads out and returns a double array from the STL file denoting either
  * a triangle point or normal.
- * @param stl_file_stream The stl file stream.
+ * @param bytes The bytes of the array in the stl file.
  * @return The array of read STL triangle.
  */
-std::array<double, 3> ReadStlArray(std::ifstream &stl_file_stream) {
-  double const x = static_cast<double>(ReadStlValue<float>(stl_file_stream));
-  double const y = static_cast<double>(ReadStlValue<float>(stl_file_stream));
-  double const z = static_cast<double>(ReadStlValue<float>(stl_file_stream));
+std::array<double, 3> ReadStlArray(char const *bytes) {
+  double const x = static_cast<double>(ReadStlValue<float>(bytes));
+  double const y = static_cast<double>(ReadStlValue<float>(bytes + 4));
+  double const z = static_cast<double>(ReadStlValue<float>(bytes + 8));
   std::array<double, 3> const return_array({x, y, z});
   return return_array;
 }
 
 /**
  * @brief Reads out an STL file and returns geometry information. See \cite STL
- * for specifications of STL files.
+ * for specifications of STL files. The file is read by rank zero only and
+ * broadcast to one rank per shared-memory node, which holds it in a window
+ * shared with the other ranks of the node. The triangles are then created from
+ * the shared bytes, using all threads of the rank. Must be called by all
+ * ranks.
  * @param stl_filename The name of the STL file.
  * @return The vector of read STL triangles.
  */
 std::vector<Triangle> ReadStl(std::string const &stl_filename) {
-  std::ifstream stl_file_stream(stl_filename.c_str(),
-                                std::ios::in | std::ios::binary);
-  if (!stl_file_stream) {
+  MPI_Comm node_communicator;
+  MPI_Comm_split_type(MpiUtilities::Communicator(), MPI_COMM_TYPE_SHARED, 0,
+                      MPI_INFO_NULL, &node_communicator);
+  int node_rank = 0;
+  MPI_Comm_rank(node_communicator, &node_rank);
+  // Rank zero is the leader of its node, as the split keeps the rank order
+  MPI_Comm leader_communicator;
+  MPI_Comm_split(MpiUtilities::Communicator(),
+                 node_rank == 0 ? 0 : MPI_UNDEFINED, 0, &leader_communicator);
+
+  std::ifstream stl_file_stream;
+  long long int file_size = -1;
+  if (MpiUtilities::MasterRank()) {
+    stl_file_stream.open(stl_filename.c_str(),
+                         std::ios::in | std::ios::binary | std::ios::ate);
+    if (stl_file_stream) {
+      file_size = static_cast<long long int>(stl_file_stream.tellg());
+      stl_file_stream.seekg(0, std::ios::beg);
+    }
+  }
+  MPI_Bcast(&file_size, 1, MPI_LONG_LONG_INT, 0, MpiUtilities::Communicator());
+  if (file_size < 0) {
+    MPI_Comm_free(&node_communicator);
+    if (leader_communicator != MPI_COMM_NULL) {
+      MPI_Comm_free(&leader_communicator);
+    }
     throw std::invalid_argument("Specfied STL file does not exist: " +
                                 stl_filename);
   }
 
-  // shift by 80 bytes which constitute the header by STL standard
-  stl_file_stream.seekg(80, std::ios::beg);
+  // The leader allocates the bytes of the node, the others access them
+  char *bytes = nullptr;
+  MPI_Win window;
+  MPI_Win_allocate_shared(node_rank == 0 ? static_cast<MPI_Aint>(file_size) : 0,
+                          1, MPI_INFO_NULL, node_communicator, &bytes, &window);
+  if (node_rank != 0) {
+    MPI_Aint size = 0;
+    int displacement_unit = 1;
+    MPI_Win_shared_query(window, 0, &size, &displacement_unit, &bytes);
+  }
+  MPI_Win_fence(0, window);
+  if (MpiUtilities::MasterRank()) {
+    stl_file_stream.read(bytes, static_cast<std::streamsize>(file_size));
+  }
+  if (leader_communicator != MPI_COMM_NULL) {
+    // Broadcast in pieces, as the count of MPI is an int
+    constexpr long long int piece = std::numeric_limits<int>::max();
+    for (long long int offset = 0; offset < file_size; offset += piece) {
+      MPI_Bcast(bytes + offset,
+                static_cast<int>(std::min(piece, file_size - offset)), MPI_CHAR,
+                0, leader_communicator);
+    }
+    MPI_Comm_free(&leader_communicator);
+  }
+  MPI_Win_fence(0, window);
+
+  // skip the 80 bytes which constitute the header by STL standard and read the
+  // number of triangles (following four bytes). Each triangle consists of the
+  // normal and three corners ( 48 bytes ) and two irrelevant bytes.
+  constexpr std::size_t header_bytes = 84;
+  constexpr std::size_t triangle_bytes = 50;
+  std::size_t const number_of_triangles =
+      file_size >= static_cast<long long int>(header_bytes)
+          ? std::min<std::size_t>(
+                ReadStlValue<unsigned int>(bytes + 80),
+                (static_cast<std::size_t>(file_size) - header_bytes) /
+                    triangle_bytes)
+          : 0;
 
-  // read the number of triangles (following four bytes)
-  unsigned int const number_of_triangles =
-      ReadStlValue<unsigned int>(stl_file_stream);
+  // Each thread creates the triangles of a contiguous part of the file
+  std::vector<std::vector<Triangle>> triangles_of_thread;
+#pragma omp parallel
+  {
+#ifdef _OPENMP
+    std::size_t const number_of_threads = omp_get_num_threads();
+    std::size_t const thread = omp_get_thread_num();
+#else
+    std::size_t const number_of_threads = 1;
+    std::size_t const thread = 0;
+#endif
+#pragma omp single
+    triangles_of_thread.resize(number_of_threads);
+    std::size_t const first = number_of_triangles * thread / number_of_threads;
+    std::size_t const end =
+        number_of_triangles * (thread + 1) / number_of_threads;
+    std::vector<Triangle> &triangles = triangles_of_thread[thread];
+    triangles.reserve(end - first);
+    for (std::size_t i = first; i < end; ++i) {
+      char const *triangle = bytes + header_bytes + i * triangle_bytes;
+      triangles.emplace_back(
+          ReadStlArray(triangle), ReadStlArray(triangle + 12),
+          ReadStlArray(triangle + 24), ReadStlArray(triangle + 36));
+    }
+  }
+  MPI_Win_free(&window);
+  MPI_Comm_free(&node_communicator);
 
   std::vector<Triangle> return_vector;
   return_vector.reserve(number_of_triangles);
-
-  // go through file and store triangle information in vector
-  for (unsigned int i = 0; i < number_of_triangles; i++) {
-    std::array<double, 3> const normal = ReadStlArray(stl_file_stream);
-    std::array<double, 3> const v1 = ReadStlArray(stl_file_stream);
-    std::array<double, 3> const v2 = ReadStlArray(stl_file_stream);
-    std::array<double, 3> const v3 = ReadStlArray(stl_file_stream);
-    return_vector.emplace_back(Triangle(normal, v1, v2, v3));
-    // move by two bytes which are irrelevant by STL standard
-    stl_file_stream.seekg(2, std::ios::cur);
+  for (std::vector<Triangle> const &triangles : triangles_of_thread) {
+    for (Triangle const &triangle : triangles) {
+      return_vector.push_back(triangle);
+    }
   }
   return return_vector;
 }
@@ -211,4 +304,201 @@ void Voxelization(Triangle const &triangle, std::array<double, 3> const &point,
     signed_distance = new_signed_distance;
   }
 }
+
+/**
+ * @brief Gives the point of the triangle closest to the given point by
+ * classifying the point into the Voronoi regions of the corners, edges and the
+ * face of the triangle ( see Ericson, Real-Time Collision Detection, 2005 ).
+ * @param triangle The triangle.
+ * @param point The coordinates of the point.
+ * @return The closest point on the triangle.
+ */
+std::array<double, 3>
+ClosestPointOnTriangle(Triangle const &triangle,
+                       std::array<double, 3> const &point) {
+  // Gives origin + factor * direction
+  auto const shifted = [](std::array<double, 3> const &origin,
+                          std::array<double, 3> const &direction,
+                          double const factor) {
+    return std::array<double, 3>({origin[0] + factor * direction[0],
+                                  origin[1] + factor * direction[1],
+                                  origin[2] + factor * direction[2]});
+  };
+  std::array<double, 3> const ab = VU::Difference(triangle.p1, triangle.p2);
+  std::array<double, 3> const ac = VU::Difference(triangle.p1, triangle.p3);
+  std::array<double, 3> const ap = VU::Difference(triangle.p1, point);
+  double const d1 = VU::DotProduct(ab, ap);
+  double const d2 = VU::DotProduct(ac, ap);
+  if (d1 <= 0.0 && d2 <= 0.0) {
+    return triangle.p1;
+  }
+  std::array<double, 3> const bp = VU::Difference(triangle.p2, point);
+  double const d3 = VU::DotProduct(ab, bp);
+  double const d4 = VU::DotProduct(ac, bp);
+  if (d3 >= 0.0 && d4 <= d3) {
+    return triangle.p2;
+  }
+  double const vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+    return shifted(triangle.p1, ab, d1 / (d1 - d3));
+  }
+  std::array<double, 3> const cp = VU::Difference(triangle.p3, point);
+  double const d5 = VU::DotProduct(ab, cp);
+  double const d6 = VU::DotProduct(ac, cp);
+  if (d6 >= 0.0 && d5 <= d6) {
+    return triangle.p3;
+  }
+  double const vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+    return shifted(triangle.p1, ac, d2 / (d2 - d6));
+  }
+  double const va = d3 * d6 - d5 * d4;
+  if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+    return shifted(triangle.p2, VU::Difference(triangle.p2, triangle.p3),
+                   (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+  }
+  double const denominator = 1.0 / (va + vb + vc);
+  return shifted(shifted(triangle.p1, ab, vb * denominator), ac,
+                 vc * denominator);
+}
+
+/**
+ * @brief Builds the hierarchy over the given triangles.
+ * @param triangles The triangles of the surface. Must outlive the hierarchy.
+ */
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(
+    std::vector<Triangle> const &triangles)
+    : triangles_(triangles), order_(triangles.size()) {
+  std::iota(order_.begin(), order_.end(), 0);
+  if (!triangles_.empty()) {
+    nodes_.reserve(2 * (triangles_.size() / triangles_per_leaf_ + 1));
+    Build(0, order_.size());
+  }
+}
+
+/**
+ * @brief Creates the node holding the given range of triangles and, if the
+ * range is too large for a leaf, its subtrees. The range is split at the
+ * median of the triangle centroids along the longest extent of the box.
+ * @param begin, end The range of the triangles in the order.
+ */
+void BoundingVolumeHierarchy::Build(std::size_t const begin,
+                                    std::size_t const end) {
+  std::size_t const node_index = nodes_.size();
+  nodes_.push_back(
+      {{std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::max()},
+       {std::numeric_limits<double>::lowest(),
+        std::numeric_limits<double>::lowest(),
+        std::numeric_limits<double>::lowest()},
+       begin,
+       end - begin});
+  for (std::size_t i = begin; i < end; ++i) {
+    Triangle const &triangle = triangles_[order_[i]];
+    for (unsigned int d = 0; d < 3; ++d) {
+      nodes_[node_index].lower_[d] =
+          std::min({nodes_[node_index].lower_[d], triangle.p1[d],
+                    triangle.p2[d], triangle.p3[d]});
+      nodes_[node_index].upper_[d] =
+          std::max({nodes_[node_index].upper_[d], triangle.p1[d],
+                    triangle.p2[d], triangle.p3[d]});
+    }
+  }
+  if (end - begin <= triangles_per_leaf_) {
+    return;
+  }
+
+  std::array<double, 3> const extent =
+      VU::Difference(nodes_[node_index].lower_, nodes_[node_index].upper_);
+  auto const axis =
+      std::max_element(extent.cbegin(), extent.cend()) - extent.cbegin();
+  std::size_t const middle = begin + (end - begin) / 2;
+  std::nth_element(order_.begin() + begin, order_.begin() + middle,
+                   order_.begin() + end,
+                   [this, axis](std::size_t const a, std::size_t const b) {
+                     Triangle const &ta = triangles_[a];
+                     Triangle const &tb = triangles_[b];
+                     return ta.p1[axis] + ta.p2[axis] + ta.p3[axis] <
+                            tb.p1[axis] + tb.p2[axis] + tb.p3[axis];
+                   });
+  nodes_[node_index].count_ = 0;
+  Build(begin, middle);
+  nodes_[node_index].first_ = nodes_.size();
+  Build(middle, end);
+}
+
+/**
+ * @brief Computes the signed distance of the point to the surface, i.e. the
+ * exact distance to the closest triangle. The sign is positive on the side the
+ * normals point away from. If several triangles are equally close ( the
+ * closest point lies on a shared edge or corner ), the sign is taken from the
+ * triangle whose normal is best aligned with the direction to the point.
+ * @param point The coordinates of the point.
+ * @return The signed distance ( largest double if there are no triangles ).
+ */
+double BoundingVolumeHierarchy::SignedDistance(
+    std::array<double, 3> const &point) const {
+  // Triangles are considered equally close within this relative tolerance
+  constexpr double tolerance = 1.0e-10;
+  auto const squared_box_distance = [&point](BoxNode const &node) {
+    double squared_distance = 0.0;
+    for (unsigned int d = 0; d < 3; ++d) {
+      double const gap =
+          std::max({node.lower_[d] - point[d], 0.0, point[d] - node.upper_[d]});
+      squared_distance += gap * gap;
+    }
+    return squared_distance;
+  };
+
+  double best_distance = std::numeric_limits<double>::max();
+  // Projection of the direction from the point to the closest point onto the
+  // normal, normalized by the distance
+  double best_alignment = 0.0;
+  if (nodes_.empty()) {
+    return best_distance;
+  }
+  std::vector<std::size_t> stack = {0};
+  while (!stack.empty()) {
+    std::size_t const node_index = stack.back();
+    BoxNode const &node = nodes_[node_index];
+    stack.pop_back();
+    double const bound = best_distance * (1.0 + tolerance);
+    if (squared_box_distance(node) > bound * bound) {
+      continue;
+    }
+    if (node.count_ > 0) {
+      for (std::size_t i = node.first_; i < node.first_ + node.count_; ++i) {
+        Triangle const &triangle = triangles_[order_[i]];
+        std::array<double, 3> const to_surface =
+            VU::Difference(point, ClosestPointOnTriangle(triangle, point));
+        double const distance = VU::L2Norm(to_surface);
+        double const alignment =
+            distance > 0.0
+                ? VU::DotProduct(to_surface, triangle.normal) / distance
+                : 0.0;
+        bool const closer = distance < best_distance * (1.0 - tolerance);
+        bool const equally_close =
+            !closer && distance <= best_distance * (1.0 + tolerance);
+        if (closer ||
+            (equally_close && std::abs(alignment) > std::abs(best_alignment))) {
+          best_distance = distance;
+          best_alignment = alignment;
+        }
+      }
+    } else {
+      // The closer child is visited first
+      std::size_t const left = node_index + 1;
+      std::size_t const right = node.first_;
+      if (squared_box_distance(nodes_[left]) <
+          squared_box_distance(nodes_[right])) {
+        stack.push_back(right);
+        stack.push_back(left);
+      } else {
+        stack.push_back(left);
+        stack.push_back(right);
+      }
+    }
+  }
+  return best_alignment < 0.0 ? -best_distance : best_distance;
+}
 } // namespace StlUtilities
@@ -23,6 +23,7 @@
 #define STL_UTILITIES_H
 
 #include <array>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <streambuf>
@@ -78,25 +79,24 @@ struct Triangle {
 
 // File reading functions
 /**
- * @brief Reads out a single value from the binary stl file. Only float or
- * unsigned int are allowed
- * @param stl_file_stream The stl file stream.
+ * @brief Reads out a single value from the bytes of a binary stl file. Only
+ * float or unsigned int are allowed
+ * @param bytes The bytes of the value in the stl file.
  * @tparam Type of the value to be read from the stl file.
  * @return The read-out value.
  */
-template <typename T> inline T ReadStlValue(std::ifstream &stl_file_stream) {
+template <typename T> inline T ReadStlValue(char const *bytes) {
   // Sanity check that the types are correct
   static_assert(std::is_same<T, unsigned int>::value ||
                     std::is_same<T, float>::value,
                 "Wrong type read out from STL file - only unsigned int and "
                 "float are possible.");
   // STL stores values as floats, i.e. 4 bytes
-  constexpr unsigned int size = sizeof(T);
   T result;
-  stl_file_stream.read(reinterpret_cast<char *>(&result), size);
+  std::memcpy(&result, bytes, sizeof(T));
   return result;
 }
-std::array<double, 3> ReadStlArray(std::ifstream &stl_file_stream);
+std::array<double, 3> ReadStlArray(char const *bytes);
 std::vector<Triangle> ReadStl(std::string const &stl_filename);
 
 // Distance computations
@@ -112,6 +112,48 @@ double DetermineOutsideDistance(std::array<double, 3> const &point,
 
 void Voxelization(Triangle const &triangle, std::array<double, 3> const &point,
                   double &levelset);
+std::array<double, 3>
+ClosestPointOnTriangle(Triangle const &triangle,
+                       std::array<double, 3> const &point);
+
+/**
+ * @brief The BoundingVolumeHierarchy sorts the triangles of a surface into a
+ * binary tree of axis-aligned bounding boxes. It is built once and gives the
+ * exact signed distance to the surface, visiting only triangles whose bounding
+ * box is closer to the point than the closest triangle found so far, i.e.
+ * O(log(triangles)) per point.
+ */
+class BoundingVolumeHierarchy {
+  // Box of a subtree. Leaves ( count_ > 0 ) hold the triangles
+  // order_[first_, first_ + count_), internal nodes have their left child
+  // directly after them and the right child at first_
+  struct BoxNode {
+    std::array<double, 3> lower_;
+    std::array<double, 3> upper_;
+    std::size_t first_;
+    std::size_t count_;
+  };
+
+  std::vector<Triangle> const &triangles_;
+  // triangle indices in the order of the leaves
+  std::vector<std::size_t> order_;
+  std::vector<BoxNode> nodes_;
+
+  void Build(std::size_t const begin, std::size_t const end);
+
+public:
+  static constexpr std::size_t triangles_per_leaf_ = 4;
+
+  BoundingVolumeHierarchy() = delete;
+  explicit BoundingVolumeHierarchy(std::vector<Triangle> const &triangles);
+  ~BoundingVolumeHierarchy() = default;
+  BoundingVolumeHierarchy(BoundingVolumeHierarchy const &) = delete;
+  BoundingVolumeHierarchy &operator=(BoundingVolumeHierarchy const &) = delete;
+  BoundingVolumeHierarchy(BoundingVolumeHierarchy &&) = delete;
+  BoundingVolumeHierarchy &operator=(BoundingVolumeHierarchy &&) = delete;
+
+  double SignedDistance(std::array<double, 3> const &point) const;
+};
 } // namespace StlUtilities
 
 #endif // STL_UTILITIES_H
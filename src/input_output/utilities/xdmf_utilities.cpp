@@ -74,15 +74,17 @@ std::string TimeDataItem(double const output_time) {
  * @param number_of_cells The total number of cells in the data item.
  * @param dimensions Dimensions the data item consists of ({1,1} : scalar, {3,1}
  * : vector, {n,m} : matrix/tensor).
+ * @param precision Number of bytes of a single value (4 : single, 8 : double).
  * @return string for data item item.
  */
 std::string DataItemString(std::string const &hdf5_filename,
                            std::string const &item_name,
                            unsigned long long int const number_of_cells,
-                           std::array<unsigned int, 2> const &dimensions) {
+                           std::array<unsigned int, 2> const &dimensions,
+                           unsigned int const precision) {
 
-  return "<DataItem Format=\"HDF\" NumberType=\"Float\" Precision=\"8\" "
-         "Dimensions=\"" +
+  return "<DataItem Format=\"HDF\" NumberType=\"Float\" Precision=\"" +
+         std::to_string(precision) + "\" Dimensions=\"" +
          std::to_string(number_of_cells) + DimensionsToString(dimensions) +
          "\"> " + hdf5_filename + ":/" + item_name + " </DataItem>\n";
 }
@@ -109,6 +111,32 @@ std::string TopologyString(std::string const &data_item,
          "</Topology>\n";
 }
 
+/**
+ * @brief Returns the attribute string used for the description of the topology
+ * of a surface in the Xdmf file, i.e. triangles or line segments given by the
+ * IDs of their vertices.
+ * @param data_item data_item to be placed in the topology string (where the
+ * vertex ID information can be found in hdf5 file).
+ * @param number_of_elements total number of surface elements.
+ * @param vertices_per_element Number of vertices of a single element (3 :
+ * triangle, 2 : line segment).
+ * @return Attribute string for the topology.
+ */
+std::string
+SurfaceTopologyString(std::string const &data_item,
+                      unsigned long long int const number_of_elements,
+                      unsigned int const vertices_per_element) {
+  std::string const topology_type =
+      vertices_per_element == 3
+          ? "TopologyType=\"Triangle\""
+          : "TopologyType=\"Polyline\" NodesPerElement=\"" +
+                std::to_string(vertices_per_element) + "\"";
+  return StringOperations::Indent(6) + "<Topology " + topology_type +
+         " NumberOfElements=\"" + std::to_string(number_of_elements) + "\">\n" +
+         StringOperations::Indent(8) + data_item + StringOperations::Indent(6) +
+         "</Topology>\n";
+}
+
 /**
  * @brief Returns the attribute string used for the description of the geometry
  * in the Xdmf file. The geometry describes the vertex coordinates for each
@@ -35,9 +35,14 @@ std::string TimeDataItem(double const output_time);
 std::string DataItemString(std::string const &hdf5_filename,
                            std::string const &item_name,
                            unsigned long long int const number_of_cells,
-                           std::array<unsigned int, 2> const &dimensions);
+                           std::array<unsigned int, 2> const &dimensions,
+                           unsigned int const precision = 8);
 std::string TopologyString(std::string const &data_item,
                            unsigned long long int const number_of_cells);
+std::string
+SurfaceTopologyString(std::string const &data_item,
+                      unsigned long long int const number_of_elements,
+                      unsigned int const vertices_per_element);
 std::string GeometryString(std::string const &data_item,
                            unsigned long long int const number_of_vertices);
 std::string ScalarAttributeString(std::string const &attribute_name,
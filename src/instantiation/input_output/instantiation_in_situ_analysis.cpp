@@ -0,0 +1,110 @@
+//===----------------- instantiation_in_situ_analysis.cpp -----------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "instantiation/input_output/instantiation_in_situ_analysis.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "input_output/log_writer/log_writer.h"
+#include "instantiation/input_output/instantiation_output_writer.h"
+#include "utilities/string_operations.h"
+
+namespace Instantiation {
+
+/**
+ * @brief Instantiates the in-situ analysis with the given input classes. The
+ * reductions, probes and slices can use all quantities that are written in any
+ * output (see output_constants.h).
+ * @param input_reader Reader that provides access to the full data of the
+ * input file.
+ * @param topology_manager Class providing global (on all ranks) node
+ * information.
+ * @param tree Tree class providing local (on current rank) node information.
+ * @param material_manager Instance providing initialized material data.
+ * @param unit_handler Instance to provide (non-)dimensionalization of values.
+ * @return The fully instantiated InSituAnalysis class.
+ */
+InSituAnalysis InstantiateInSituAnalysis(
+    InputReader const &input_reader, TopologyManager const &topology_manager,
+    Tree const &tree, MaterialManager const &material_manager,
+    UnitHandler const &unit_handler) {
+
+  OutputReader const &output_reader(input_reader.GetOutputReader());
+  double const node_size_on_level_zero(unit_handler.DimensionalizeValue(
+      tree.GetNodeSizeOnLevelZero(), UnitType::Length));
+
+  unsigned int const interval = output_reader.ReadInSituInterval();
+  if (interval == 0) {
+    return InSituAnalysis(topology_manager, tree, node_size_on_level_zero, 0,
+                          {}, {}, {}, {});
+  }
+  std::vector<InSituReduction> reductions(output_reader.ReadInSituReductions());
+  std::vector<InSituProbe> probes(output_reader.ReadInSituProbes());
+  std::vector<InSituSlice> slices(output_reader.ReadInSituSlices());
+
+  // Only the quantities that are used are kept
+  std::vector<std::unique_ptr<OutputQuantity const>> available_quantities(
+      GetMaterialOutputQuantities(unit_handler, material_manager));
+  std::vector<std::unique_ptr<OutputQuantity const>> interface_quantities(
+      GetInterfaceOutputQuantities(unit_handler, material_manager));
+  std::move(interface_quantities.begin(), interface_quantities.end(),
+            std::back_inserter(available_quantities));
+  auto const is_used = [&reductions, &probes,
+                        &slices](std::string const &name) {
+    return std::any_of(reductions.begin(), reductions.end(),
+                       [&name](InSituReduction const &reduction) {
+                         return reduction.quantity_name_ == name;
+                       }) ||
+           std::any_of(probes.begin(), probes.end(),
+                       [&name](InSituProbe const &probe) {
+                         return probe.quantity_name_ == name;
+                       }) ||
+           std::any_of(slices.begin(), slices.end(),
+                       [&name](InSituSlice const &slice) {
+                         return slice.quantity_name_ == name;
+                       });
+  };
+  std::vector<std::unique_ptr<OutputQuantity const>> quantities;
+  for (auto &quantity : available_quantities) {
+    if (is_used(quantity->GetName())) {
+      quantities.push_back(std::move(quantity));
+    }
+  }
+
+  LogWriter &logger = LogWriter::Instance();
+  logger.LogMessage("In-situ analysis:");
+  logger.LogMessage(StringOperations::Indent(2) + "Interval  : " +
+                    std::to_string(interval) + " macro time steps");
+  logger.LogMessage(StringOperations::Indent(2) +
+                    "Reductions: " + std::to_string(reductions.size()));
+  logger.LogMessage(StringOperations::Indent(2) +
+                    "Probes    : " + std::to_string(probes.size()));
+  logger.LogMessage(StringOperations::Indent(2) +
+                    "Slices    : " + std::to_string(slices.size()));
+  logger.LogMessage(" ");
+
+  // return the fully initialized analysis
+  return InSituAnalysis(topology_manager, tree, node_size_on_level_zero,
+                        interval, std::move(quantities), std::move(reductions),
+                        std::move(probes), std::move(slices));
+}
+} // namespace Instantiation
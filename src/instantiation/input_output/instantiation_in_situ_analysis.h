@@ -0,0 +1,41 @@
+//===------------------ instantiation_in_situ_analysis.h ------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef INSTANTIATION_IN_SITU_ANALYSIS_H
+#define INSTANTIATION_IN_SITU_ANALYSIS_H
+
+#include "input_output/in_situ_analysis.h"
+#include "input_output/input_reader.h"
+
+/**
+ * @brief Defines all instantiation functions required for the in-situ
+ * analysis.
+ */
+namespace Instantiation {
+
+// Instantiation function for the in-situ analysis
+InSituAnalysis InstantiateInSituAnalysis(
+    InputReader const &input_reader, TopologyManager const &topology_manager,
+    Tree const &tree, MaterialManager const &material_manager,
+    UnitHandler const &unit_handler);
+} // namespace Instantiation
+
+#endif // INSTANTIATION_IN_SITU_ANALYSIS_H
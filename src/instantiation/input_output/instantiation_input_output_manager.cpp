@@ -237,6 +237,7 @@ ComputeSnapshotTimes(RestartReader const &restart_reader,
  * information.
  * @param tree Tree class providing local (on current rank) node information.
  * @param material_manager Instance providing initialized material data.
+ * @param in_situ_analysis Instance evaluating reductions and probes.
  * @param unit_handler Instance to provide (non-)dimensionalization of values.
  * @param base_output_folder The folder in which the different outputs are to be
  * written.
@@ -244,8 +245,8 @@ ComputeSnapshotTimes(RestartReader const &restart_reader,
  */
 InputOutputManager InstantiateInputOutputManager(
     InputReader const &input_reader, OutputWriter const &output_writer,
-    RestartManager const &restart_manager, UnitHandler const &unit_handler,
-    std::filesystem::path base_output_folder) {
+    RestartManager &restart_manager, InSituAnalysis const &in_situ_analysis,
+    UnitHandler const &unit_handler, std::filesystem::path base_output_folder) {
 
   // Get the required readers
   TimeControlReader const &time_control_reader(
@@ -262,6 +263,8 @@ InputOutputManager InstantiateInputOutputManager(
       output_reader, time_control_reader, unit_handler, OutputType::Standard);
   std::vector<double> const interface_output_timestamps = ComputeOutputTimes(
       output_reader, time_control_reader, unit_handler, OutputType::Interface);
+  std::vector<double> const monitoring_output_timestamps = ComputeOutputTimes(
+      output_reader, time_control_reader, unit_handler, OutputType::Monitoring);
   double const time_naming_factor = output_reader.ReadTimeNamingFactor();
   // Restart
   RestoreMode const restore_mode = restart_reader.ReadRestoreMode();
@@ -282,6 +285,10 @@ InputOutputManager InstantiateInputOutputManager(
        snapshot_times_type == SnapshotTimesType::IntervalStamps)
           ? restart_reader.ReadSnapshotIntervalsToKeep()
           : 0;
+  std::string const staging_folder = restart_reader.ReadStagingFolder();
+  unsigned int const staging_generations_to_keep =
+      staging_folder.empty() ? 1
+                             : restart_reader.ReadStagingGenerationsToKeep();
 
   // logging
   LogWriter &logger = LogWriter::Instance();
@@ -302,14 +309,16 @@ InputOutputManager InstantiateInputOutputManager(
   // Output and restart
   // Header for time stamps
   if (!standard_output_timestamps.empty() ||
-      !interface_output_timestamps.empty() || !snapshot_timestamps.empty()) {
+      !interface_output_timestamps.empty() ||
+      !monitoring_output_timestamps.empty() || !snapshot_timestamps.empty()) {
     logger.LogMessage(StringOperations::Indent(37) + "First" +
                       StringOperations::Indent(10) + "Last" +
                       StringOperations::Indent(6) + "Total");
   }
   // output time stamps
   if (!standard_output_timestamps.empty() ||
-      !interface_output_timestamps.empty()) {
+      !interface_output_timestamps.empty() ||
+      !monitoring_output_timestamps.empty()) {
     if (!standard_output_timestamps.empty()) {
       logger.LogMessage(
           "Standard output time stamps :    " +
@@ -338,6 +347,20 @@ InputOutputManager InstantiateInputOutputManager(
               6) +
           "    " + std::to_string(interface_output_timestamps.size()));
     }
+    if (!monitoring_output_timestamps.empty()) {
+      logger.LogMessage(
+          "Monitoring output time stamps:   " +
+          StringOperations::ToScientificNotationString(
+              unit_handler.DimensionalizeValue(
+                  monitoring_output_timestamps.front(), UnitType::Time),
+              6) +
+          "  " +
+          StringOperations::ToScientificNotationString(
+              unit_handler.DimensionalizeValue(
+                  monitoring_output_timestamps.back(), UnitType::Time),
+              6) +
+          "    " + std::to_string(monitoring_output_timestamps.size()));
+    }
   }
   // restart time stamps
   logger.LogMessage(" ");
@@ -361,6 +384,12 @@ InputOutputManager InstantiateInputOutputManager(
                       std::to_string(snapshots_to_keep));
   }
 
+  if (!staging_folder.empty()) {
+    logger.LogMessage("Snapshot staging folder     : " + staging_folder);
+    logger.LogMessage("Kept staged snapshots       : " +
+                      std::to_string(staging_generations_to_keep));
+  }
+
   if (snapshot_interval == 0 && snapshot_timestamps.empty()) {
     logger.LogMessage("Restart snapshots           : Disabled");
   }
@@ -376,9 +405,11 @@ InputOutputManager InstantiateInputOutputManager(
   // Instantiate the input output manager
   return InputOutputManager(
       input_file, base_output_folder, unit_handler, output_writer,
-      restart_manager, time_naming_factor, standard_output_timestamps,
-      interface_output_timestamps, restore_mode, restart_file,
-      snapshot_timestamps, snapshot_interval, snapshots_to_keep);
+      restart_manager, in_situ_analysis, time_naming_factor,
+      standard_output_timestamps, interface_output_timestamps,
+      monitoring_output_timestamps, restore_mode, restart_file,
+      snapshot_timestamps, snapshot_interval, snapshots_to_keep, staging_folder,
+      staging_generations_to_keep);
 }
 
 } // namespace Instantiation
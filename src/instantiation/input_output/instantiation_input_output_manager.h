@@ -48,8 +48,8 @@ ComputeSnapshotTimes(RestartReader const &restart_reader,
 // Instantiation function for the input_output manager
 InputOutputManager InstantiateInputOutputManager(
     InputReader const &input_reader, OutputWriter const &output_writer,
-    RestartManager const &restart_manager, UnitHandler const &unit_handler,
-    std::filesystem::path base_output_folder);
+    RestartManager &restart_manager, InSituAnalysis const &in_situ_analysis,
+    UnitHandler const &unit_handler, std::filesystem::path base_output_folder);
 } // namespace Instantiation
 
 #endif // INSTANTIATION_INPUT_OUTPUT_MANAGER_H
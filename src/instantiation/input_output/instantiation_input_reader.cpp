@@ -21,12 +21,17 @@
 //===----------------------------------------------------------------------===//
 #include "instantiation/input_output/instantiation_input_reader.h"
 
+#include <fstream>
+#include <iterator>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
+#include "communication/mpi_utilities.h"
 #include "input_output/input_reader/input_definitions.h"
 #include "input_output/log_writer/log_writer.h"
 #include "input_output/utilities/file_utilities.h"
+#include "input_output/utilities/xml_utilities.h"
 #include <tinyxml2.h>
 
 #include "input_output/input_reader/boundary_condition_reader/xml_boundary_condition_reader.h"
@@ -34,23 +39,111 @@
 #include "input_output/input_reader/initial_condition_reader/xml_initial_condition_reader.h"
 #include "input_output/input_reader/material_reader/xml_material_reader.h"
 #include "input_output/input_reader/multi_resolution_reader/xml_multi_resolution_reader.h"
+#include "input_output/input_reader/numerics_reader/xml_numerics_reader.h"
 #include "input_output/input_reader/output_reader/xml_output_reader.h"
 #include "input_output/input_reader/restart_reader/xml_restart_reader.h"
 #include "input_output/input_reader/source_term_reader/xml_source_term_reader.h"
 #include "input_output/input_reader/time_control_reader/xml_time_control_reader.h"
 
+namespace {
+/**
+ * @brief Reads the input file on the master rank and distributes its content to
+ * all ranks, such that the file system is accessed once per simulation instead
+ * of once per rank.
+ * @param input_filename Name of the file used for input.
+ * @return The content of the file (on all ranks).
+ * @note Throws on all ranks if the file does not exist.
+ */
+std::vector<char> ReadOnMasterRank(std::string const &input_filename) {
+  std::vector<char> content;
+  bool exists = true;
+  if (MpiUtilities::MasterRank()) {
+    exists = FileUtilities::CheckIfPathExists(input_filename);
+    if (exists) {
+      std::ifstream file(input_filename, std::ios::binary);
+      content.assign(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+    }
+  }
+  MPI_Bcast(&exists, 1, MPI_CXX_BOOL, 0, MpiUtilities::Communicator());
+  if (!exists) {
+    throw std::logic_error("Input file " + input_filename + " does not exist!");
+  }
+  MpiUtilities::BroadcastVector(content, MPI_CHAR);
+  return content;
+}
+
+/**
+ * @brief Checks that all sections which are read unconditionally are present.
+ * All missing sections are reported at once, before any instance is created.
+ * @param input_file The parsed xml document.
+ * @note Throws if a section is missing.
+ */
+void ValidateXmlInputFile(tinyxml2::XMLDocument const &input_file) {
+  std::vector<std::vector<std::string>> const required_sections = {
+      {"configuration", "domain", "nodeSize"},
+      {"configuration", "domain", "nodeRatio"},
+      {"configuration", "domain", "boundaryConditions"},
+      {"configuration", "domain", "initialConditions"},
+      {"configuration", "materials"},
+      {"configuration", "multiResolution"},
+      {"configuration", "timeControl"},
+      {"configuration", "dimensionalization"},
+      {"configuration", "restart"},
+      {"configuration", "output"}};
+  std::string missing_sections;
+  for (std::vector<std::string> const &section : required_sections) {
+    if (!XmlUtilities::ChildExists(input_file, section)) {
+      std::string path;
+      for (std::string const &tag : section) {
+        path += "<" + tag + ">";
+      }
+      missing_sections += "\n  " + path;
+    }
+  }
+  if (!missing_sections.empty()) {
+    throw std::logic_error("Missing sections in the XML inputfile:" +
+                           missing_sections);
+  }
+}
+
+/**
+ * @brief Creates the input reader from an already parsed xml document.
+ * @param input_filename Name of the file used for input.
+ * @param input_file The parsed xml document (shared by all readers).
+ * @return The fully instantiated InputReader class.
+ */
+InputReader
+InstantiateXmlInputReader(std::string const &input_filename,
+                          std::shared_ptr<tinyxml2::XMLDocument> input_file) {
+  LogWriter &logger = LogWriter::Instance();
+  logger.LogMessage("Instantiating xml input reader");
+  return InputReader(
+      input_filename, InputType::Xml,
+      std::make_unique<XmlMaterialReader const>(input_file),
+      std::make_unique<XmlBoundaryConditionReader const>(input_file),
+      std::make_unique<XmlInitialConditionReader const>(input_file),
+      std::make_unique<XmlMultiResolutionReader const>(input_file),
+      std::make_unique<XmlDimensionalizationReader const>(input_file),
+      std::make_unique<XmlOutputReader const>(input_file),
+      std::make_unique<XmlRestartReader const>(input_file),
+      std::make_unique<XmlSourceTermReader const>(input_file),
+      std::make_unique<XmlTimeControlReader const>(input_file),
+      std::make_unique<XmlNumericsReader const>(input_file));
+}
+} // namespace
+
 namespace Instantiation {
 
 /**
  * @brief Instantiates the full input reader class with the given input file.
  * @param input_filename Name of the file use for input.
  * @return The fully instantiated InputReader class.
+ * @note Must be called on all ranks, only the master rank reads the file.
  */
 InputReader InstantiateInputReader(std::string const &input_filename) {
-  // Check whether the file exists
-  if (!FileUtilities::CheckIfPathExists(input_filename)) {
-    throw std::logic_error("Input file " + input_filename + " does not exist!");
-  }
+  // Read the file once and distribute it (throws if it does not exist)
+  std::vector<char> const content = ReadOnMasterRank(input_filename);
 
   // Determine the input type
   InputType const input_type(
@@ -63,26 +156,17 @@ InputReader InstantiateInputReader(std::string const &input_filename) {
     // reader
     std::shared_ptr<tinyxml2::XMLDocument> input_file(
         new tinyxml2::XMLDocument);
-    tinyxml2::XMLError error = input_file->LoadFile(input_filename.c_str());
+    tinyxml2::XMLError error =
+        input_file->Parse(content.data(), content.size());
     // Check if eversthing worked properly
     if (error != tinyxml2::XML_SUCCESS) {
       throw std::logic_error("Syntax error parsing the XML inputfile file, "
-                             "check opening and closing tags!");
+                             "check opening and closing tags! " +
+                             std::string(input_file->ErrorStr()));
     }
+    ValidateXmlInputFile(*input_file);
     // Create the input reader properly
-    LogWriter &logger = LogWriter::Instance();
-    logger.LogMessage("Instantiating xml input reader");
-    return InputReader(
-        input_filename, input_type,
-        std::make_unique<XmlMaterialReader const>(input_file),
-        std::make_unique<XmlBoundaryConditionReader const>(input_file),
-        std::make_unique<XmlInitialConditionReader const>(input_file),
-        std::make_unique<XmlMultiResolutionReader const>(input_file),
-        std::make_unique<XmlDimensionalizationReader const>(input_file),
-        std::make_unique<XmlOutputReader const>(input_file),
-        std::make_unique<XmlRestartReader const>(input_file),
-        std::make_unique<XmlSourceTermReader const>(input_file),
-        std::make_unique<XmlTimeControlReader const>(input_file));
+    return InstantiateXmlInputReader(input_filename, input_file);
   }
 
   default: {
@@ -91,4 +175,22 @@ InputReader InstantiateInputReader(std::string const &input_filename) {
   }
   }
 }
+
+/**
+ * @brief Instantiates the input reader of the benchmark run mode from the
+ * synthetic input ( see BenchmarkInputfile ). No file is read.
+ * @param setup The benchmark settings.
+ * @return The fully instantiated InputReader class.
+ */
+InputReader InstantiateBenchmarkInputReader(BenchmarkSetup const &setup) {
+  std::shared_ptr<tinyxml2::XMLDocument> input_file(new tinyxml2::XMLDocument);
+  std::string const input_data =
+      BenchmarkInputfile::Create(setup, MpiUtilities::NumberOfRanks());
+  if (input_file->Parse(input_data.c_str()) != tinyxml2::XML_SUCCESS) {
+    throw std::logic_error("Syntax error parsing the benchmark input!");
+  }
+  ValidateXmlInputFile(*input_file);
+  // The name determines the output folder of the log file
+  return InstantiateXmlInputReader("alpaca_benchmark.xml", input_file);
+}
 } // namespace Instantiation
@@ -23,6 +23,7 @@
 #define INSTANTIATION_INPUT_READER_H
 
 #include "input_output/input_reader.h"
+#include "input_output/utilities/benchmark_inputfile.h"
 
 /**
  * @brief Defines all instantiation functions required for the input reader.
@@ -30,6 +31,7 @@
 namespace Instantiation {
 // Instantiation function for the input reader
 InputReader InstantiateInputReader(std::string const &input_filename);
+InputReader InstantiateBenchmarkInputReader(BenchmarkSetup const &setup);
 } // namespace Instantiation
 
 #endif // INSTANTIATION_INPUT_READER_H
@@ -31,14 +31,20 @@ namespace {
  * on all other ranks.
  * @param on_master_rank Indicator wether the function is executed on the master
  * rank.
+ * @param to_terminal Indicator whether the master rank also writes to the
+ * terminal (besides the logfile).
  * @note Throws ('dies') if a logger could not be instantiated.
  */
-LogWriter &CreateLogWriterOrDieTrying(bool const on_master_rank) {
+LogWriter &CreateLogWriterOrDieTrying(bool const on_master_rank,
+                                      bool const to_terminal) {
   try {
     std::unique_ptr<std::stringstream> terminal_stream(nullptr);
     std::unique_ptr<std::stringstream> file_stream(nullptr);
     if (on_master_rank) {
-      terminal_stream = std::make_unique<std::stringstream>(std::ios_base::out);
+      if (to_terminal) {
+        terminal_stream =
+            std::make_unique<std::stringstream>(std::ios_base::out);
+      }
       file_stream = std::make_unique<std::stringstream>(std::ios_base::out);
     }
     return LogWriter::Instance(std::move(terminal_stream),
@@ -57,9 +63,12 @@ namespace Instantiation {
  * master rank is instantiated such that it writes to terminal and/or logfile.
  * @param on_master_rank Indicator wether the function is executed on the master
  * rank.
+ * @param to_terminal Indicator whether the master rank also writes to the
+ * terminal, e.g. false for all but one simulation of an ensemble.
  */
-LogWriter &InstantiateLogWriter(bool const on_master_rank) {
-  LogWriter &logger = CreateLogWriterOrDieTrying(on_master_rank);
+LogWriter &InstantiateLogWriter(bool const on_master_rank,
+                                bool const to_terminal) {
+  LogWriter &logger = CreateLogWriterOrDieTrying(on_master_rank, to_terminal);
   logger.WelcomeMessage();
   logger.LogMessage("Logger initialised");
   logger.Flush();
@@ -29,8 +29,8 @@
  */
 namespace Instantiation {
 
-LogWriter &InstantiateLogWriter(bool const on_master_rank);
-
+LogWriter &InstantiateLogWriter(bool const on_master_rank,
+                                bool const to_terminal = true);
 }
 
 #endif // INSTANTIATION_LOG_WRITER_H
@@ -23,11 +23,18 @@
 
 #include "user_specifications/compile_time_constants.h"
 #include "user_specifications/output_constants.h"
+#include <limits>
+
+#include "input_output/log_writer/log_writer.h"
+#include "utilities/string_operations.h"
 // mesh generators for the topology generations
 #include "input_output/output_writer/mesh_generator/debug_mesh_generator.h"
+#include "input_output/output_writer/mesh_generator/decimated_mesh_generator.h"
 #include "input_output/output_writer/mesh_generator/interface_mesh_generator.h"
 #include "input_output/output_writer/mesh_generator/standard_finest_level_mesh_generator.h"
 #include "input_output/output_writer/mesh_generator/standard_mpi_mesh_generator.h"
+// surface generator for the interface output
+#include "input_output/output_writer/interface_surface_generator.h"
 // output quantities for the cell data generation
 #include "input_output/output_writer/output_quantities/custom_material_quantities/baroclinicity_output.h"
 #include "input_output/output_writer/output_quantities/custom_material_quantities/helicity_output.h"
@@ -35,6 +42,7 @@
 #include "input_output/output_writer/output_quantities/custom_material_quantities/mach_number_output.h"
 #include "input_output/output_writer/output_quantities/custom_material_quantities/numerical_schlieren_output.h"
 #include "input_output/output_writer/output_quantities/custom_material_quantities/partition_output.h"
+#include "input_output/output_writer/output_quantities/custom_material_quantities/statistics_output.h"
 #include "input_output/output_writer/output_quantities/custom_material_quantities/vortex_dilatation_output.h"
 #include "input_output/output_writer/output_quantities/custom_material_quantities/vortex_stretching_output.h"
 #include "input_output/output_writer/output_quantities/custom_material_quantities/vorticity_absolute_output.h"
@@ -289,6 +297,25 @@ GetMaterialOutputQuantities(UnitHandler const &unit_handler,
         COS::VortexStretching));
   }
 
+  /**************************************************************************************************/
+  /*                                 STATISTICS QUANTITIES */
+  /**************************************************************************************************/
+  // short name using
+  namespace SOS = StatisticsOutputSettings;
+
+  // the statistics buffers only exist if the statistics are sampled
+  if constexpr (SOS::SamplingInterval > 0) {
+    if (IsAnyActive(SOS::Mean)) {
+      output_quantities.push_back(std::make_unique<StatisticsOutput const>(
+          unit_handler, material_manager, SOS::MeanName, SOS::Mean, false));
+    }
+    if (IsAnyActive(SOS::Covariance)) {
+      output_quantities.push_back(std::make_unique<StatisticsOutput const>(
+          unit_handler, material_manager, SOS::CovarianceName, SOS::Covariance,
+          true));
+    }
+  }
+
   return output_quantities;
 }
 
@@ -385,9 +412,126 @@ std::unique_ptr<MeshGenerator const> GetStandardMeshGenerator(
   }
 }
 
+/**
+ * @brief Gives the mesh generator of the monitoring output, which limits the
+ * resolution and the region of the standard output.
+ * @param output_reader Reader that provides access to the output data of the
+ * input file.
+ * @param topology_manager Class providing global (on all ranks) node
+ * information.
+ * @param tree Tree class providing local (on current rank) node information.
+ * @param node_size_on_level_zero Size of one block on level zero.
+ * @return Pointer to the base class of all mesh generators.
+ */
+std::unique_ptr<MeshGenerator const> GetMonitoringMeshGenerator(
+    OutputReader const &output_reader, TopologyManager const &topology_manager,
+    Tree const &tree, double const node_size_on_level_zero) {
+  unsigned int maximum_level = topology_manager.GetMaximumLevel();
+  std::array<std::array<double, 2>, 3> region_of_interest;
+  region_of_interest.fill({std::numeric_limits<double>::lowest(),
+                           std::numeric_limits<double>::max()});
+
+  if (output_reader.ReadOutputTimesType(OutputType::Monitoring) !=
+      OutputTimesType::Off) {
+    maximum_level =
+        std::min(maximum_level, output_reader.ReadMonitoringMaximumLevel());
+    region_of_interest = output_reader.ReadMonitoringRegion();
+
+    LogWriter &logger = LogWriter::Instance();
+    logger.LogMessage("Monitoring output:");
+    logger.LogMessage(StringOperations::Indent(2) +
+                      "Maximum level: " + std::to_string(maximum_level));
+    std::array<std::string, 3> const direction_names = {"x", "y", "z"};
+    for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+      logger.LogMessage(StringOperations::Indent(2) + "Region in " +
+                        direction_names[d] + "   : " +
+                        StringOperations::ToScientificNotationString(
+                            region_of_interest[d][0], 6) +
+                        "  " +
+                        StringOperations::ToScientificNotationString(
+                            region_of_interest[d][1], 6));
+    }
+    logger.LogMessage(" ");
+  }
+
+  return std::make_unique<DecimatedMeshGenerator const>(
+      topology_manager, tree, node_size_on_level_zero, maximum_level,
+      region_of_interest);
+}
+
+/**
+ * @brief Gives the precision and compression of the datasets of each given
+ * output quantity.
+ * @param output_reader Reader that provides access to the output data of the
+ * input file.
+ * @param quantities The output quantities.
+ * @return The dataset format of each quantity in the same order.
+ */
+std::vector<OutputDatasetFormat> GetOutputDatasetFormats(
+    OutputReader const &output_reader,
+    std::vector<std::unique_ptr<OutputQuantity const>> const &quantities) {
+  std::vector<OutputDatasetFormat> formats;
+  formats.reserve(quantities.size());
+  // The ADIOS2 backend applies its own operators, see Adios2Manager
+  bool const hdf5_backend =
+      output_reader.ReadOutputBackend() == OutputBackend::Hdf5;
+  for (auto const &quantity : quantities) {
+    OutputDatasetFormat format;
+    format.precision_ = output_reader.ReadOutputPrecision(quantity->GetName());
+    format.compression_ =
+        output_reader.ReadOutputCompression(quantity->GetName());
+    OutputCompressionType const compression_type = format.compression_.type_;
+    if (hdf5_backend && compression_type != OutputCompressionType::Off) {
+      // Parallel hdf5 only supports filters for collective writes
+      if constexpr (!Hdf5OutputSettings::CollectiveWrites) {
+        throw std::invalid_argument(
+            "Compressed output requires collective hdf5 writes!");
+      }
+      if (!Hdf5Manager::IsCompressionAvailable(compression_type)) {
+        throw std::invalid_argument("The compression filter of the output "
+                                    "quantity '" +
+                                    quantity->GetName() +
+                                    "' is not available in hdf5!");
+      }
+    }
+    formats.push_back(format);
+  }
+  return formats;
+}
+
+/**
+ * @brief Gives the manager writing the field outputs with ADIOS2 if this
+ * backend is selected.
+ * @param output_reader Reader that provides access to the output data of the
+ * input file.
+ * @return Pointer to the ADIOS2 manager, nullptr for the hdf5 backend.
+ */
+std::unique_ptr<Adios2Manager>
+GetAdios2Manager(OutputReader const &output_reader) {
+  if (output_reader.ReadOutputBackend() != OutputBackend::Adios2) {
+    return nullptr;
+  }
+  Adios2Settings const settings = output_reader.ReadAdios2Settings();
+
+  LogWriter &logger = LogWriter::Instance();
+  logger.LogMessage("ADIOS2 output:");
+  std::string const engine =
+      settings.engine_ == Adios2Engine::SST ? "SST" : "BP5";
+  logger.LogMessage(StringOperations::Indent(2) + "Engine     : " + engine);
+  if (settings.engine_ == Adios2Engine::BP5 && settings.aggregators_ > 0) {
+    logger.LogMessage(StringOperations::Indent(2) +
+                      "Aggregators: " + std::to_string(settings.aggregators_));
+  }
+  logger.LogMessage(" ");
+
+  return std::make_unique<Adios2Manager>(settings);
+}
+
 /**
  * @brief Instantiates the complete output writer class with the given input
  * classes.
+ * @param input_reader Reader that provides access to the full data of the
+ * input file.
  * @param topology_manager Class providing global (on all ranks) node
  * information.
  * @param tree Tree class providing local (on current rank) node information.
@@ -396,7 +540,8 @@ std::unique_ptr<MeshGenerator const> GetStandardMeshGenerator(
  * @return The fully instantiated OutputWriter class as pointer (allows
  * movements of it).
  */
-OutputWriter InstantiateOutputWriter(TopologyManager &topology_manager,
+OutputWriter InstantiateOutputWriter(InputReader const &input_reader,
+                                     TopologyManager &topology_manager,
                                      Tree &tree,
                                      MaterialManager const &material_manager,
                                      UnitHandler const &unit_handler) {
@@ -407,6 +552,17 @@ OutputWriter InstantiateOutputWriter(TopologyManager &topology_manager,
   std::array<unsigned int, 3> const number_of_nodes_on_level_zero(
       topology_manager.GetNumberOfNodesOnLevelZero());
 
+  std::vector<std::unique_ptr<OutputQuantity const>> material_output_quantities(
+      GetMaterialOutputQuantities(unit_handler, material_manager));
+  std::vector<std::unique_ptr<OutputQuantity const>>
+      interface_output_quantities(
+          GetInterfaceOutputQuantities(unit_handler, material_manager));
+  OutputReader const &output_reader(input_reader.GetOutputReader());
+  std::vector<OutputDatasetFormat> material_output_formats(
+      GetOutputDatasetFormats(output_reader, material_output_quantities));
+  std::vector<OutputDatasetFormat> interface_output_formats(
+      GetOutputDatasetFormats(output_reader, interface_output_quantities));
+
   return OutputWriter(
       GetStandardMeshGenerator(topology_manager, tree, node_size_on_level_zero,
                                number_of_nodes_on_level_zero),
@@ -415,8 +571,15 @@ OutputWriter InstantiateOutputWriter(TopologyManager &topology_manager,
           number_of_nodes_on_level_zero[2]),
       std::make_unique<InterfaceMeshGenerator const>(topology_manager, tree,
                                                      node_size_on_level_zero),
-      GetMaterialOutputQuantities(unit_handler, material_manager),
-      GetInterfaceOutputQuantities(unit_handler, material_manager),
-      material_manager.GetNumberOfMaterials());
+      GetMonitoringMeshGenerator(output_reader, topology_manager, tree,
+                                 node_size_on_level_zero),
+      InterfaceFieldOutputSettings::SurfaceOutput
+          ? std::make_unique<InterfaceSurfaceGenerator const>(
+                topology_manager, tree, node_size_on_level_zero)
+          : nullptr,
+      std::move(material_output_quantities),
+      std::move(interface_output_quantities),
+      std::move(material_output_formats), std::move(interface_output_formats),
+      material_manager.GetNumberOfMaterials(), GetAdios2Manager(output_reader));
 }
 } // namespace Instantiation
@@ -25,6 +25,7 @@
 #include <memory>
 #include <vector>
 
+#include "input_output/input_reader.h"
 #include "input_output/output_writer.h"
 
 /**
@@ -37,15 +38,24 @@ std::unique_ptr<MeshGenerator const>
 GetStandardMeshGenerator(UnitHandler const &unit_handler,
                          TopologyManager const &topology, Tree const &flower,
                          double const node_size_on_level_zero);
+std::unique_ptr<MeshGenerator const> GetMonitoringMeshGenerator(
+    OutputReader const &output_reader, TopologyManager const &topology_manager,
+    Tree const &tree, double const node_size_on_level_zero);
 std::vector<std::unique_ptr<OutputQuantity const>>
 GetMaterialOutputQuantities(UnitHandler const &unit_handler,
                             MaterialManager const &material_manager);
 std::vector<std::unique_ptr<OutputQuantity const>>
 GetInterfaceOutputQuantities(UnitHandler const &unit_handler,
                              MaterialManager const &material_manager);
+std::vector<OutputDatasetFormat> GetOutputDatasetFormats(
+    OutputReader const &output_reader,
+    std::vector<std::unique_ptr<OutputQuantity const>> const &quantities);
+std::unique_ptr<Adios2Manager>
+GetAdios2Manager(OutputReader const &output_reader);
 
 // Instantiation function for the input_output manager
-OutputWriter InstantiateOutputWriter(TopologyManager &topology_manager,
+OutputWriter InstantiateOutputWriter(InputReader const &input_reader,
+                                     TopologyManager &topology_manager,
                                      Tree &tree,
                                      MaterialManager const &material_manager,
                                      UnitHandler const &unit_handler);
@@ -20,20 +20,38 @@
 //
 //===----------------------------------------------------------------------===//
 #include "instantiation/instantiation_communication_manager.h"
+#include <stdexcept>
+
+#include "input_output/log_writer/log_writer.h"
+#include "user_specifications/compile_time_constants.h"
 
 namespace Instantiation {
 
 /**
  * @brief Instantiates the complete communication manager class with the given
  * input classes.
+ * @param input_reader Reader that provides access to the full data of the input
+ * file.
  * @param topology_manager Class providing global (on all ranks) node
  * information.
  * @return The fully instantiated CommunicationManager class.
  */
 CommunicationManager
-InstantiateCommunicationManager(TopologyManager &topology_manager) {
+InstantiateCommunicationManager(InputReader const &input_reader,
+                                TopologyManager &topology_manager) {
+
+  HaloExchange const halo_exchange =
+      input_reader.GetMultiResolutionReader().ReadHaloExchange();
+  // The one-sided protocol puts the aggregated messages of each partner
+  if (halo_exchange == HaloExchange::OneSided && !CC::AggregateHaloMessages()) {
+    throw std::invalid_argument(
+        "One-sided halo exchange requires aggregated halo messages!");
+  }
+
+  LogWriter &logger = LogWriter::Instance();
+  logger.LogMessage("Halo exchange: " + HaloExchangeToString(halo_exchange));
 
-  return CommunicationManager(topology_manager,
-                              topology_manager.GetMaximumLevel());
+  return CommunicationManager(
+      topology_manager, topology_manager.GetMaximumLevel(), halo_exchange);
 }
 } // namespace Instantiation
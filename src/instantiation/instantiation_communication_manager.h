@@ -23,6 +23,7 @@
 #define INSTANTIATION_COMMUNICATION_MANAGER_H
 
 #include "communication/communication_manager.h"
+#include "input_output/input_reader.h"
 
 /**
  * @brief Defines all instantiation functions required for the communication
@@ -32,7 +33,8 @@ namespace Instantiation {
 
 // Instantiation of the communication manager
 CommunicationManager
-InstantiateCommunicationManager(TopologyManager &topology_manager);
+InstantiateCommunicationManager(InputReader const &input_reader,
+                                TopologyManager &topology_manager);
 } // namespace Instantiation
 
 #endif // INSTANTIATION_COMMUNICATION_MANAGER_H
@@ -40,12 +40,15 @@ namespace Instantiation {
  * simulation.
  * @param prime_state_variable_names All names of the prime states that are read
  * (contains empty strings for prime states that should not be read).
+ * @param field_data_files The field data file of each material. No expression
+ * is read for materials initialized from field data.
  * @return Initial condition expression strings for all materials.
  */
 std::vector<std::string> GetMaterialInitialConditions(
     InitialConditionReader const &initial_condition_reader,
     unsigned int const number_of_materials,
-    std::vector<std::string> const &prime_state_variable_names) {
+    std::vector<std::string> const &prime_state_variable_names,
+    std::vector<std::string> const &field_data_files) {
   // logger for warning logging
   LogWriter &logger = LogWriter::Instance();
 
@@ -54,6 +57,9 @@ std::vector<std::string> GetMaterialInitialConditions(
   // Loop through all materials (start at one )
   for (unsigned int material_index = 0; material_index < number_of_materials;
        material_index++) {
+    if (!field_data_files[material_index].empty()) {
+      continue;
+    }
     // material index +1 is used since in input file the indices start at 1 and
     // internally at 0
     material_initial_conditions[material_index] =
@@ -79,6 +85,36 @@ std::vector<std::string> GetMaterialInitialConditions(
   return material_initial_conditions;
 }
 
+/**
+ * @brief Reads the field data files of all materials and logs the materials
+ * initialized from field data.
+ * @param initial_condition_reader Instance that provides access to the initial
+ * condition data in the input file.
+ * @param number_of_materials Number of materials present in the current
+ * simulation.
+ * @return The hdf5 field data file of each material ( empty for materials
+ * initialized from their expression ).
+ */
+std::vector<std::string> GetMaterialFieldDataFiles(
+    InitialConditionReader const &initial_condition_reader,
+    unsigned int const number_of_materials) {
+  LogWriter &logger = LogWriter::Instance();
+
+  std::vector<std::string> field_data_files(number_of_materials);
+  for (unsigned int material_index = 0; material_index < number_of_materials;
+       material_index++) {
+    field_data_files[material_index] =
+        initial_condition_reader.ReadMaterialInitialConditionFile(
+            material_index + 1);
+    if (!field_data_files[material_index].empty()) {
+      logger.LogMessage("Material " + std::to_string(material_index + 1) +
+                        " is initialized from field data: " +
+                        field_data_files[material_index]);
+    }
+  }
+  return field_data_files;
+}
+
 /**
  * @brief Gives the variables for the parametric initializer.
  * @param initial_condition_reader Instance to read the initial condition data.
@@ -234,16 +270,20 @@ std::unique_ptr<InitialCondition> InstantiateInitialCondition(
           topology_manager.GetMaximumLevel()));
 
   // Initialize the prime state handler
+  std::vector<std::string> const field_data_files{
+      GetMaterialFieldDataFiles(input_reader.GetInitialConditionReader(),
+                                material_manager.GetNumberOfMaterials())};
   std::vector<std::string> const material_initial_conditions{
       GetMaterialInitialConditions(input_reader.GetInitialConditionReader(),
                                    material_manager.GetNumberOfMaterials(),
-                                   prime_state_variable_names)};
+                                   prime_state_variable_names,
+                                   field_data_files)};
   std::unique_ptr<PrimeStateInitializer const> prime_state_initializer{
       std::make_unique<PrimeStateInitializer const>(
           material_initial_conditions, prime_state_variable_names,
           unit_handler.DimensionalizeValue(tree.GetNodeSizeOnLevelZero(),
                                            UnitType::Length),
-          unit_handler)};
+          unit_handler, field_data_files)};
   return std::make_unique<InitialCondition>(std::move(prime_state_initializer),
                                             std::move(levelset_initializer));
 }
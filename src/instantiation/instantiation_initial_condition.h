@@ -42,7 +42,13 @@ namespace Instantiation {
 // factory functions
 std::vector<std::string> GetMaterialInitialConditions(
     InitialConditionReader const &initial_condition_reader,
-    unsigned int number_of_materials);
+    unsigned int const number_of_materials,
+    std::vector<std::string> const &prime_state_variable_names,
+    std::vector<std::string> const &field_data_files);
+
+std::vector<std::string> GetMaterialFieldDataFiles(
+    InitialConditionReader const &initial_condition_reader,
+    unsigned int const number_of_materials);
 
 std::array<ParametricVariable, 2> CreateParametricVariables(
     InitialConditionReader const &initial_condition_reader);
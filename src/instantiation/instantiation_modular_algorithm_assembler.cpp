@@ -21,7 +21,12 @@
 //===----------------------------------------------------------------------===//
 #include "instantiation/instantiation_modular_algorithm_assembler.h"
 
+#include <algorithm>
+#include <cstdlib>
+
+#include "stencils/spatial_reconstruction_stencils/reconstruction_stencil_setup.h"
 #include "user_specifications/compile_time_constants.h"
+#include "utilities/runtime_profiler.h"
 #include "utilities/string_operations.h"
 
 namespace Instantiation {
@@ -103,6 +108,10 @@ ModularAlgorithmAssembler InstantiateModularAlgorithmAssembler(
   double const end_time = unit_handler.NonDimensionalizeValue(
       input_reader.GetTimeControlReader().ReadEndTime(), UnitType::Time);
   double const cfl_number = input_reader.GetTimeControlReader().ReadCFLNumber();
+  unsigned int const maximum_macro_steps =
+      input_reader.GetTimeControlReader().ReadMaximumMacroSteps();
+  double const walltime_limit =
+      input_reader.GetTimeControlReader().ReadWalltimeLimit();
 
   // Log data
   LogWriter &logger = LogWriter::Instance();
@@ -119,6 +128,126 @@ ModularAlgorithmAssembler InstantiateModularAlgorithmAssembler(
   logger.LogMessage(
       StringOperations::Indent(2) + "CFL number: " +
       StringOperations::ToScientificNotationString(cfl_number, 9));
+  if (maximum_macro_steps > 0) {
+    logger.LogMessage(StringOperations::Indent(2) + "Macro steps: " +
+                      std::to_string(maximum_macro_steps) + " ( at most )");
+  }
+  if (walltime_limit > 0.0) {
+    logger.LogMessage(
+        StringOperations::Indent(2) + "Walltime limit: " +
+        StringOperations::ToScientificNotationString(walltime_limit, 5) + " s");
+  }
+  logger.LogMessage(" ");
+
+  // The memory budget of the input file takes precedence over the one of the
+  // job environment
+  double memory_budget =
+      input_reader.GetMultiResolutionReader().ReadMemoryBudget();
+  if (char const *const environment = std::getenv("ALPACA_MEMORY_BUDGET");
+      memory_budget == 0.0 && environment != nullptr) {
+    memory_budget = std::max(std::strtod(environment, nullptr), 0.0);
+  }
+  if (memory_budget > 0.0) {
+    logger.LogMessage(
+        "Memory budget: " +
+        StringOperations::ToScientificNotationString(memory_budget, 5) +
+        " MB per rank");
+    logger.LogMessage(" ");
+  }
+
+  // Grid sequencing starts below the maximum level and raises it during the run
+  MultiResolutionReader const &multi_resolution_reader =
+      input_reader.GetMultiResolutionReader();
+  unsigned int const grid_sequencing_level =
+      multi_resolution_reader.ReadGridSequencingStartLevel();
+  std::vector<double> grid_sequencing_stamps;
+  double grid_sequencing_tolerance = 0.0;
+  if (grid_sequencing_level < topology_manager.GetMaximumLevel()) {
+    for (double const stamp :
+         multi_resolution_reader.ReadGridSequencingTimeStamps()) {
+      grid_sequencing_stamps.push_back(
+          unit_handler.NonDimensionalizeValue(stamp, UnitType::Time));
+    }
+    grid_sequencing_tolerance =
+        multi_resolution_reader.ReadGridSequencingTolerance();
+    logger.LogMessage("Grid sequencing: start on level " +
+                      std::to_string(grid_sequencing_level));
+    logger.LogMessage(StringOperations::Indent(2) + "Level raises at: " +
+                      std::to_string(grid_sequencing_stamps.size()) +
+                      " time stamps");
+    if (grid_sequencing_tolerance > 0.0) {
+      logger.LogMessage(StringOperations::Indent(2) + "Level raises below: " +
+                        StringOperations::ToScientificNotationString(
+                            grid_sequencing_tolerance, 5) +
+                        " relative change of the kinetic energy");
+    }
+    logger.LogMessage(" ");
+  }
+
+  // The convective stencil is selected among the compiled ones
+  ReconstructionStencils const convective_stencil =
+      input_reader.GetNumericsReader().ReadReconstructionStencil();
+  logger.LogMessage(
+      "Convective reconstruction stencil: " +
+      ReconstructionStencilSetup::StencilToString(convective_stencil));
+  logger.LogMessage(" ");
+
+  // Enable the runtime profiler if desired
+  bool const profiling_active =
+      input_reader.GetOutputReader().ReadProfilingActive();
+  unsigned int const profiling_interval =
+      profiling_active ? input_reader.GetOutputReader().ReadProfilingInterval()
+                       : 0;
+  bool const tracing_active =
+      profiling_active && input_reader.GetOutputReader().ReadProfilingTrace();
+  bool const counters_active =
+      profiling_active &&
+      input_reader.GetOutputReader().ReadProfilingCounters();
+  RuntimeProfiler::Instance().Enable(profiling_active);
+  if (tracing_active) {
+    RuntimeProfiler::Instance().EnableTracing();
+  }
+  if (counters_active) {
+    RuntimeProfiler::Instance().EnableHardwareCounters(
+        input_reader.GetOutputReader().ReadProfilingFlopEvents());
+  }
+  logger.LogMessage("Runtime profiling: " +
+                    std::string(profiling_active ? "active" : "inactive"));
+  if (profiling_active) {
+    logger.LogMessage(
+        StringOperations::Indent(2) + "Summary interval: " +
+        (profiling_interval > 0
+             ? std::to_string(profiling_interval) + " macro time steps"
+             : std::string("end of run")));
+    logger.LogMessage(StringOperations::Indent(2) + "Trace           : " +
+                      std::string(tracing_active ? "active" : "inactive"));
+    logger.LogMessage(StringOperations::Indent(2) + "Counters        : " +
+                      std::string(counters_active ? "active" : "inactive"));
+    if (counters_active) {
+      RuntimeProfiler const &profiler = RuntimeProfiler::Instance();
+      std::string unavailable;
+      for (auto const &[counter, name] :
+           {std::make_pair(HardwareCounter::Cycles, "cycles"),
+            std::make_pair(HardwareCounter::Instructions, "instructions"),
+            std::make_pair(HardwareCounter::L1DataMisses, "L1D misses"),
+            std::make_pair(HardwareCounter::LastLevelCacheMisses, "LLC misses"),
+            std::make_pair(HardwareCounter::FloatingPointOperations,
+                           "FLOPs")}) {
+        if (!profiler.IsCounterAvailable(counter)) {
+          unavailable += (unavailable.empty() ? "" : ", ") + std::string(name);
+        }
+      }
+      if (!unavailable.empty()) {
+        logger.LogMessage(StringOperations::Indent(4) +
+                          "Not available: " + unavailable);
+      }
+    }
+  }
+  bool const initial_output =
+      input_reader.GetOutputReader().ReadInitialOutput();
+  if (!initial_output) {
+    logger.LogMessage("Initial output: skipped");
+  }
   logger.LogMessage(" ");
   // Compute the cell size on maximum level
   unsigned int const maximum_level = topology_manager.GetMaximumLevel();
@@ -130,10 +259,13 @@ ModularAlgorithmAssembler InstantiateModularAlgorithmAssembler(
 
   // initialize the algorithm assembler
   return ModularAlgorithmAssembler(
-      start_time, end_time, cfl_number,
+      start_time, end_time, cfl_number, maximum_macro_steps, walltime_limit,
+      memory_budget * 1024.0 * 1024.0, grid_sequencing_level,
+      grid_sequencing_stamps, grid_sequencing_tolerance,
       GetGravity(input_reader.GetSourceTermReader(), unit_handler),
-      GetAllLevels(maximum_level), cell_size_on_maximum_level, unit_handler,
-      tree, topology_manager, halo_manager, communication_manager,
-      multiresolution, material_manager, input_output_manager);
+      convective_stencil, GetAllLevels(maximum_level),
+      cell_size_on_maximum_level, unit_handler, tree, topology_manager,
+      halo_manager, communication_manager, multiresolution, material_manager,
+      input_output_manager, profiling_interval, initial_output);
 }
 } // namespace Instantiation
@@ -47,6 +47,24 @@ InstantiateMultiresolution(InputReader const &input_reader,
   Thresholder thresholder =
       Thresholder(maximum_level, epsilon_reference_level, epsilon_reference);
 
+  // Create the refinement regions ( the same dimensional units as the input )
+  MultiResolutionReader const &multi_resolution_reader =
+      input_reader.GetMultiResolutionReader();
+  unsigned int const number_of_regions =
+      multi_resolution_reader.ReadNumberOfRefinementRegions();
+  std::vector<RefinementRegion> regions;
+  for (unsigned int index = 0; index < number_of_regions; ++index) {
+    std::array<unsigned int, 2> const levels =
+        multi_resolution_reader.ReadRefinementRegionLevels(index);
+    regions.push_back(
+        {multi_resolution_reader.ReadRefinementRegionBoundingBox(index),
+         multi_resolution_reader.ReadRefinementRegionExpression(index),
+         levels[0], levels[1]});
+  }
+  RefinementRegions refinement_regions(
+      regions, multi_resolution_reader.ReadNodeSizeOnLevelZero(),
+      maximum_level);
+
   // Log data
   LogWriter &logger = LogWriter::Instance();
   logger.LogMessage(" ");
@@ -69,9 +87,15 @@ InstantiateMultiresolution(InputReader const &input_reader,
   } else {
     logger.LogMessage("Homogenous Mesh - Provided Epsilon is ignored ");
   }
+  if (refinement_regions.Any()) {
+    logger.LogMessage("Refinement regions :");
+    for (std::string const &line : refinement_regions.GetLogData(2)) {
+      logger.LogMessage(line);
+    }
+  }
   logger.LogMessage(" ");
 
-  // Return the created multiresolution with the thresholder
-  return Multiresolution(std::move(thresholder));
+  // Return the created multiresolution with the thresholder and the regions
+  return Multiresolution(std::move(thresholder), std::move(refinement_regions));
 }
 } // namespace Instantiation
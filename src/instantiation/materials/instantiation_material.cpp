@@ -29,6 +29,7 @@
 #include "materials/equations_of_state/stiffened_gas.h"
 #include "materials/equations_of_state/stiffened_gas_complete_safe.h"
 #include "materials/equations_of_state/stiffened_gas_safe.h"
+#include "materials/equations_of_state/tabulated_equation_of_state.h"
 #include "materials/equations_of_state/waterlike_fluid.h"
 
 #include "materials/material_property_models/shear_viscosity_models/constant_shear_viscosity_model.h"
@@ -112,6 +113,30 @@ std::unique_ptr<EquationOfState const> InstantiateEquationOfState(
   }
 }
 
+/**
+ * @brief Replaces the given equation of state by its tabulated counterpart if
+ * the input data asks for tabulation.
+ * @param eos The analytic equation of state.
+ * @param eos_data All parameters specified for the equation of state from the
+ * input file.
+ * @param unit_handler Instance to provide (non-)dimensionalization of values.
+ * @return pointer to the const base class of all equations of state.
+ */
+std::unique_ptr<EquationOfState const> InstantiateTabulatedEquationOfState(
+    std::unique_ptr<EquationOfState const> eos,
+    std::unordered_map<std::string, double> const &eos_data,
+    UnitHandler const &unit_handler) {
+  if (!TabulatedEquationOfState::IsRequested(eos_data)) {
+    return eos;
+  }
+  // 1. Create, 2. Log, 3. Return eos
+  std::unique_ptr<TabulatedEquationOfState const> tabulated_eos(
+      std::make_unique<TabulatedEquationOfState const>(std::move(eos), eos_data,
+                                                       unit_handler));
+  LogWriter::Instance().LogMessage(tabulated_eos->GetLogData(4, unit_handler));
+  return tabulated_eos;
+}
+
 /**
  * @brief Gives the model for the material property shear viscosity for the
  * given input data.
@@ -351,7 +376,9 @@ InstantiateMaterial(unsigned int const material_index,
 
   // create eos
   std::unique_ptr<EquationOfState const> eos(
-      InstantiateEquationOfState(eos_name, eos_data, unit_handler));
+      InstantiateTabulatedEquationOfState(
+          InstantiateEquationOfState(eos_name, eos_data, unit_handler),
+          eos_data, unit_handler));
 
   // Material properties
   logger.LogMessage(std::string(60, '-'));
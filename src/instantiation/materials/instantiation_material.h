@@ -40,6 +40,12 @@ std::unique_ptr<EquationOfState const> InstantiateEquationOfState(
     std::unordered_map<std::string, double> const &eos_data,
     UnitHandler const &unit_handler);
 
+// Instantiate function for the tabulation of the equation of state
+std::unique_ptr<EquationOfState const> InstantiateTabulatedEquationOfState(
+    std::unique_ptr<EquationOfState const> eos,
+    std::unordered_map<std::string, double> const &eos_data,
+    UnitHandler const &unit_handler);
+
 // Instantiate function for the shear viscosity model
 std::unique_ptr<MaterialParameterModel const> InstantiateShearViscosityModel(
     MaterialPropertyModelName const model_name,
@@ -237,6 +237,8 @@ InstantiateTopologyManager(InputReader const &input_reader,
       GetNumberOfNodesOnLevelZero(input_reader.GetMultiResolutionReader()),
       input_reader.GetMultiResolutionReader().ReadMaximumLevel(),
       GetActivePeriodicDirections(input_reader.GetBoundaryConditionReader(),
-                                  material_manager));
+                                  material_manager),
+      input_reader.GetMultiResolutionReader().ReadLoadImbalanceThreshold(),
+      input_reader.GetMultiResolutionReader().ReadSpaceFillingCurve());
 }
 } // namespace Instantiation
@@ -0,0 +1,85 @@
+//===----------------------- runge_kutta_3_SSP_4.h ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef RUNGE_KUTTA_3_SSP_4_H
+#define RUNGE_KUTTA_3_SSP_4_H
+
+#include "time_integrator.h"
+
+/**
+ * @brief The RungeKutta3SSP4 class integrates in time using the four-stage
+ * third-order strong-stability preserving Runge-Kutta method of Kraaijevanger
+ * in the low-storage form of Ketcheson. On paper the equations are
+ * I)   u^(1)   = u^n + 1/2 * dt * f(u^n),
+ * II)  u^(2)   = u^(1) + 1/2 * dt * f(u^(1)),
+ * III) u^(3)   = 2/3 * u^n + 1/3 * u^(2) + 1/6 * dt * f(u^(2)),
+ * IV)  u^(n+1) = u^(3) + 1/2 * dt * f(u^(3)).
+ * Only the third stage refers back to u^n, hence the scheme runs with the same
+ * buffers as RungeKutta3TVD. Its SSP coefficient is two, i.e. CFL numbers up to
+ * twice the ones of RungeKutta3TVD may be used, which lowers the cost per unit
+ * simulation time by one third.
+ */
+class RungeKutta3SSP4 : public TimeIntegrator<RungeKutta3SSP4> {
+
+  friend TimeIntegrator;
+
+  static constexpr unsigned int number_of_stages_ = 4;
+
+  static constexpr std::array<double, number_of_stages_>
+      timestep_multiplier_jump_conservatives_ = {
+          1.0 / 6.0, // first stage
+          1.0 / 6.0, // second stage
+          1.0 / 6.0, // third stage
+          0.5        // fourth stage
+      };
+
+  static constexpr std::array<double, number_of_stages_>
+      timestep_multiplier_conservatives_ = {
+          0.5,       // first stage
+          0.5,       // second stage
+          1.0 / 6.0, // third stage
+          0.5        // fourth stage
+      };
+
+  static constexpr std::array<std::array<double, 2>, number_of_stages_ - 1>
+      buffer_multiplier_ = {{
+          {1.0, 0.0},             // second stage
+          {1.0 / 3.0, 2.0 / 3.0}, // third stage
+          {1.0, 0.0}              // fourth stage
+      }};
+
+public:
+  RungeKutta3SSP4() = delete;
+  ~RungeKutta3SSP4() = default;
+  RungeKutta3SSP4(RungeKutta3SSP4 const &) = delete;
+  RungeKutta3SSP4 &operator=(RungeKutta3SSP4 const &) = delete;
+  RungeKutta3SSP4(RungeKutta3SSP4 &&) = delete;
+  RungeKutta3SSP4 &operator=(RungeKutta3SSP4 &&) = delete;
+
+  /**
+   * @brief Constructor.
+   * @param start_time Time when the simulation should start.
+   */
+  explicit RungeKutta3SSP4(double const start_time = 0.0)
+      : TimeIntegrator(start_time) {}
+};
+
+#endif // RUNGE_KUTTA_3_SSP_4_H
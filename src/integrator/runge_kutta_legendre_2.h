@@ -0,0 +1,107 @@
+//===---------------------- runge_kutta_legendre_2.h ----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef RUNGE_KUTTA_LEGENDRE_2_H
+#define RUNGE_KUTTA_LEGENDRE_2_H
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief The RungeKuttaLegendre2 class provides the coefficients of the
+ * second-order Runge-Kutta-Legendre super-time-stepping scheme ( RKL2 ) of
+ * \cite Meyer2014. An s-stage step of size dt on a parabolic operator L reads
+ * Y_0 = u^n, Y_1 = Y_0 + mu~_1 * dt * L(Y_0) and for j = 2,...,s
+ * Y_j = mu_j * Y_(j-1) + nu_j * Y_(j-2) + ( 1 - mu_j - nu_j ) * Y_0
+ *     + mu~_j * dt * L(Y_(j-1)) + gamma~_j * dt * L(Y_0),
+ * with u^(n+1) = Y_s. The step is stable for dt <= dt_explicit * ( s^2 + s - 2
+ * ) / 4, where dt_explicit is the stable timestep size of the explicit Euler
+ * scheme, i.e. the number of operator evaluations grows with the square root
+ * of the timestep size only.
+ */
+class RungeKuttaLegendre2 {
+
+  /**
+   * @brief Gives the coefficient b_j of the scheme.
+   * @param j The stage.
+   * @return The coefficient.
+   */
+  static constexpr double B(unsigned int const j) {
+    return j < 2 ? 1.0 / 3.0
+                 : double(j * j + j - 2) / (2.0 * double(j) * double(j + 1));
+  }
+
+public:
+  /**
+   * @brief The coefficients of a single stage, see class description.
+   */
+  struct StageCoefficients {
+    double mu_;
+    double nu_;
+    double mu_tilde_;
+    double gamma_tilde_;
+  };
+
+  RungeKuttaLegendre2() = delete;
+  ~RungeKuttaLegendre2() = default;
+  RungeKuttaLegendre2(RungeKuttaLegendre2 const &) = delete;
+  RungeKuttaLegendre2 &operator=(RungeKuttaLegendre2 const &) = delete;
+  RungeKuttaLegendre2(RungeKuttaLegendre2 &&) = delete;
+  RungeKuttaLegendre2 &operator=(RungeKuttaLegendre2 &&) = delete;
+
+  /**
+   * @brief Gives the smallest number of stages that is stable for the given
+   * timestep size.
+   * @param timestep The timestep size of the super step.
+   * @param explicit_timestep The stable timestep size of the explicit Euler
+   * scheme.
+   * @return The number of stages ( at least two ).
+   */
+  static unsigned int NumberOfStages(double const timestep,
+                                     double const explicit_timestep) {
+    double const ratio = timestep / explicit_timestep;
+    double const stages =
+        std::ceil(0.5 * (std::sqrt(9.0 + 16.0 * ratio) - 1.0));
+    return std::max(2u, static_cast<unsigned int>(stages));
+  }
+
+  /**
+   * @brief Gives the coefficients of a stage.
+   * @param number_of_stages The number of stages s of the super step.
+   * @param stage The stage j ( 1 <= j <= s ).
+   * @return The coefficients. For the first stage mu_1 = 1 and nu_1 = gamma~_1
+   * = 0, such that all stages share the same update formula.
+   */
+  static constexpr StageCoefficients
+  Coefficients(unsigned int const number_of_stages, unsigned int const stage) {
+    double const w1 = 4.0 / double(number_of_stages * number_of_stages +
+                                   number_of_stages - 2);
+    if (stage < 2) {
+      return {1.0, 0.0, B(1) * w1, 0.0};
+    }
+    double const j = double(stage);
+    double const mu = (2.0 * j - 1.0) / j * B(stage) / B(stage - 1);
+    double const nu = -(j - 1.0) / j * B(stage) / B(stage - 2);
+    return {mu, nu, mu * w1, -(1.0 - B(stage - 1)) * mu * w1};
+  }
+};
+
+#endif // RUNGE_KUTTA_LEGENDRE_2_H
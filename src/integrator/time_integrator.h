@@ -22,6 +22,7 @@
 #ifndef TIME_INTEGRATOR_H
 #define TIME_INTEGRATOR_H
 
+#include <algorithm>
 #include <numeric>
 
 #include "block_definitions/block.h"
@@ -63,6 +64,10 @@ template <typename DerivedTimeIntegrator> class TimeIntegrator {
    */
   void IntegrateJumpConservatives(Block &block, double const timestep) const {
 
+    if (!block.HasJumpBuffers()) {
+      return;
+    }
+
     for (auto const &location : CC::ANBS()) {
       double(&boundary_conservatives)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
           block.GetBoundaryJumpConservatives(location);
@@ -92,17 +97,33 @@ template <typename DerivedTimeIntegrator> class TimeIntegrator {
    * buffer states need to be ensured by caller.
    * @param timestep The size of the time step used in the current integration
    * step.
-   * @note  This function works only for RK2 and RK3. In order to use
-   * higher-order schemes, it might be necessary to adapt it.
+   * @note  This function works for schemes in Shu-Osher form with at most two
+   * registers (RK2, RK3, RK3SSP4). Other schemes might require to adapt it.
    */
   void IntegrateConservatives(Block &block, double const timestep) const {
+    IntegrateConservatives(block, timestep, CC::FICX(), CC::LICX() + 1);
+  }
+
+  /**
+   * @brief Same as for IntegrateConservatives(Block& block, double const
+   * timestep) function, however, only the internal cells of the given range of
+   * x-planes are incremented.
+   * @param block The block whose contents should be integrated.
+   * @param timestep The size of the time step used in the current integration
+   * step.
+   * @param first_plane,end_plane First ( inclusive ) and last ( exclusive )
+   * x-index of the integrated planes.
+   */
+  void IntegrateConservatives(Block &block, double const timestep,
+                              unsigned int const first_plane,
+                              unsigned int const end_plane) const {
 
     for (Equation const eq : MF::ASOE()) {
-      double(&u_old)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      FieldValue(&u_old)[CC::TCX()][CC::TCY()][CC::TCZ()] =
           block.GetAverageBuffer(eq);
-      double(&u_new)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      FieldValue(&u_new)[CC::TCX()][CC::TCY()][CC::TCZ()] =
           block.GetRightHandSideBuffer(eq);
-      for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+      for (unsigned int i = first_plane; i < end_plane; ++i) {
         for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
           for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
             u_new[i][j][k] = u_old[i][j][k] + timestep * u_new[i][j][k];
@@ -132,9 +153,9 @@ template <typename DerivedTimeIntegrator> class TimeIntegrator {
                      std::array<int, 3> const halo_size) const {
 
     for (Equation const eq : MF::ASOE()) {
-      double(&u_old)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      FieldValue(&u_old)[CC::TCX()][CC::TCY()][CC::TCZ()] =
           block.GetAverageBuffer(eq);
-      double(&u_new)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      FieldValue(&u_new)[CC::TCX()][CC::TCY()][CC::TCZ()] =
           block.GetRightHandSideBuffer(eq);
 
       for (int i = start_indices_halo[0];
@@ -158,8 +179,8 @@ template <typename DerivedTimeIntegrator> class TimeIntegrator {
    * @param node The node whose level-set field should be incremented.
    * @param timestep The size of the time step used in the current integration
    * step.
-   * @note  This function works only for RK2 and RK3. In order to use
-   * higher-order schemes, it might be necessary to adapt it.
+   * @note  This function works for schemes in Shu-Osher form with at most two
+   * registers (RK2, RK3, RK3SSP4). Other schemes might require to adapt it.
    */
   void IntegrateLevelset(Node &node, double const timestep) const {
     double(&levelset_new)[CC::TCX()][CC::TCY()][CC::TCZ()] =
@@ -339,6 +360,55 @@ public:
     }
   }
 
+  /**
+   * @brief Integrates one node by one stage like IntegrateNode, however, the
+   * internal cells of each phase are swept in tiles of x-planes. Each tile is
+   * handed to the given function right after its integration, i.e. while it
+   * is still held in cache.
+   * @param node The node to be integrated.
+   * @param stage The integration stage.
+   * @param number_of_timesteps The number of time steps relevant for this
+   * integration, see IntegrateNode.
+   * @param tile_function Function called with the material, the block and the
+   * first ( inclusive ) and last ( exclusive ) x-plane of each integrated tile.
+   * @tparam TileFunction Type of the tile function.
+   */
+  template <typename TileFunction>
+  void IntegrateNodeTiled(Node &node, unsigned int const stage,
+                          unsigned int const number_of_timesteps,
+                          TileFunction const &tile_function) const {
+#ifndef PERFORMANCE
+    if (stage >= NumberOfStages()) {
+      throw std::invalid_argument(
+          "Stage is too large for the chosen time integration scheme");
+    }
+#endif
+
+    double const timestep = std::accumulate(
+        micro_timestep_sizes_.crbegin(),
+        micro_timestep_sizes_.crbegin() + number_of_timesteps, 0.0);
+    double const multiplier_jump_conservatives =
+        GetTimestepMultiplierJumpConservatives(stage);
+    double const multiplier_conservatives =
+        GetTimestepMultiplierConservatives(stage);
+    // Zero tile planes sweep the whole block at once
+    constexpr unsigned int tile_planes = CC::FusedIntegrationTilePlanes() > 0
+                                             ? CC::FusedIntegrationTilePlanes()
+                                             : CC::ICX();
+
+    for (auto &phase : node.GetPhases()) {
+      IntegrateJumpConservatives(phase.second,
+                                 multiplier_jump_conservatives * timestep);
+      for (unsigned int first = CC::FICX(); first <= CC::LICX();
+           first += tile_planes) {
+        unsigned int const end = std::min(first + tile_planes, CC::LICX() + 1);
+        IntegrateConservatives(phase.second,
+                               multiplier_conservatives * timestep, first, end);
+        tile_function(phase.first, phase.second, first, end);
+      }
+    }
+  }
+
   /**
    * @brief Integrates one node by one stage. Integration is done for the
    * level-set field.
@@ -381,9 +451,9 @@ public:
           double const material_sign_double = double(material_sign);
 
           for (Equation const eq : MF::ASOE()) {
-            double const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+            FieldValue const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
                 mat_block.second.GetAverageBuffer(eq);
-            double(&u_initial)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+            FieldValue(&u_initial)[CC::TCX()][CC::TCY()][CC::TCZ()] =
                 mat_block.second.GetInitialBuffer(eq);
             for (unsigned int i = 0; i < CC::TCX(); ++i) {
               for (unsigned int j = 0; j < CC::TCY(); ++j) {
@@ -414,14 +484,26 @@ public:
    */
   void FillInitialLevelsetBuffer(Node &node, unsigned int const stage) const {
     if (stage == 0) {
-      BO::Interface::CopyInterfaceDescriptionBufferForNode<
-          InterfaceDescriptionBufferType::Base,
-          InterfaceDescriptionBufferType::Initial,
-          InterfaceDescription::Levelset>(node);
-      BO::Interface::CopyInterfaceDescriptionBufferForNode<
-          InterfaceDescriptionBufferType::Reinitialized,
-          InterfaceDescriptionBufferType::Initial,
-          InterfaceDescription::VolumeFraction>(node);
+      if constexpr (CC::BandTiledInterfaceInitialBuffers()) {
+        InterfaceBlock &interface_block = node.GetInterfaceBlock();
+        interface_block
+            .GetBandTiledInitialBuffer(InterfaceDescription::Levelset)
+            .Store(
+                interface_block.GetBaseBuffer(InterfaceDescription::Levelset));
+        interface_block
+            .GetBandTiledInitialBuffer(InterfaceDescription::VolumeFraction)
+            .Store(interface_block.GetReinitializedBuffer(
+                InterfaceDescription::VolumeFraction));
+      } else {
+        BO::Interface::CopyInterfaceDescriptionBufferForNode<
+            InterfaceDescriptionBufferType::Base,
+            InterfaceDescriptionBufferType::Initial,
+            InterfaceDescription::Levelset>(node);
+        BO::Interface::CopyInterfaceDescriptionBufferForNode<
+            InterfaceDescriptionBufferType::Reinitialized,
+            InterfaceDescriptionBufferType::Initial,
+            InterfaceDescription::VolumeFraction>(node);
+      }
     } // stage
   }
 
@@ -436,12 +518,16 @@ public:
     if (stage != 0) {
 
       auto const multipliers = GetBufferMultiplier(stage);
+      // stages not referring back to the initial buffer need no sweep
+      if (multipliers[0] == 1.0 && multipliers[1] == 0.0) {
+        return;
+      }
 
       for (auto &mat_block : node.GetPhases()) {
         for (Equation const eq : MF::ASOE()) {
-          double(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+          FieldValue(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
               mat_block.second.GetAverageBuffer(eq);
-          double const(&u_initial)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+          FieldValue const(&u_initial)[CC::TCX()][CC::TCY()][CC::TCZ()] =
               mat_block.second.GetInitialBuffer(eq);
           for (unsigned int i = 0; i < CC::TCX(); ++i) {
             for (unsigned int j = 0; j < CC::TCY(); ++j) {
@@ -468,10 +554,19 @@ public:
     if (stage != 0) {
 
       auto const multipliers = GetBufferMultiplier(stage);
+      if (multipliers[0] == 1.0 && multipliers[1] == 0.0) {
+        return;
+      }
 
       double(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
           node.GetInterfaceBlock().GetBaseBuffer(
               InterfaceDescription::Levelset);
+      if constexpr (CC::BandTiledInterfaceInitialBuffers()) {
+        node.GetInterfaceBlock()
+            .GetBandTiledInitialBuffer(InterfaceDescription::Levelset)
+            .Combine(levelset, multipliers[0], multipliers[1]);
+        return;
+      }
       double const(&levelset_initial)[CC::TCX()][CC::TCY()][CC::TCZ()] =
           node.GetInterfaceBlock().GetInitialBuffer(
               InterfaceDescription::Levelset);
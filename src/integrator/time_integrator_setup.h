@@ -23,6 +23,7 @@
 #define TIME_INTEGRATOR_SETUP_H
 
 #include "runge_kutta_2_TVD.h"
+#include "runge_kutta_3_SSP_4.h"
 #include "runge_kutta_3_TVD.h"
 #include "time_integrator.h"
 #include "user_specifications/numerical_setup.h"
@@ -54,6 +55,12 @@ template <> struct Concretize<TimeIntegrators::RK2> {
 template <> struct Concretize<TimeIntegrators::RK3> {
   typedef RungeKutta3TVD type;
 };
+/**
+ * @brief See generic implementation.
+ */
+template <> struct Concretize<TimeIntegrators::RK3SSP4> {
+  typedef RungeKutta3SSP4 type;
+};
 
 } // namespace TimeIntegratorSetup
 
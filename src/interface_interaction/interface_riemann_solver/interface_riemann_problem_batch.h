@@ -0,0 +1,91 @@
+//===----------------- interface_riemann_problem_batch.h ------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef INTERFACE_RIEMANN_PROBLEM_BATCH_H
+#define INTERFACE_RIEMANN_PROBLEM_BATCH_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+/**
+ * @brief Holds the interface Riemann problems of several cells in
+ * structure-of-arrays layout, such that they can be solved together. The left
+ * state belongs to the negative material, the right state to the positive
+ * material.
+ */
+struct InterfaceRiemannProblemBatch {
+  // states left and right of the interface
+  std::vector<double> rho_left_;
+  std::vector<double> p_left_;
+  std::vector<double> velocity_normal_left_;
+  std::vector<double> rho_right_;
+  std::vector<double> p_right_;
+  std::vector<double> velocity_normal_right_;
+  // pressure jump due to capillarity
+  std::vector<double> delta_p_;
+  // initial guess of the interface pressure, e.g. from the previous stage
+  std::vector<double> pressure_guess_;
+
+  // solution of the interface Riemann problems
+  std::vector<double> interface_velocity_;
+  std::vector<double> interface_pressure_positive_;
+  std::vector<double> interface_pressure_negative_;
+
+  /**
+   * @brief Sets the number of interface Riemann problems in the batch.
+   * @param size The number of problems.
+   */
+  void Resize(std::size_t const size) {
+    for (std::vector<double> *const quantity :
+         {&rho_left_, &p_left_, &velocity_normal_left_, &rho_right_, &p_right_,
+          &velocity_normal_right_, &delta_p_, &pressure_guess_,
+          &interface_velocity_, &interface_pressure_positive_,
+          &interface_pressure_negative_}) {
+      quantity->resize(size);
+    }
+  }
+
+  /**
+   * @brief Gives the number of interface Riemann problems in the batch.
+   * @return The number of problems.
+   */
+  std::size_t Size() const { return rho_left_.size(); }
+
+  /**
+   * @brief Stores the solution of a single interface Riemann problem.
+   * @param n The index of the problem in the batch.
+   * @param interface_velocity The interface velocity.
+   * @param interface_pressure_positive The interface pressure of the positive
+   * material.
+   * @param interface_pressure_negative The interface pressure of the negative
+   * material.
+   */
+  void SetSolution(std::size_t const n, double const interface_velocity,
+                   double const interface_pressure_positive,
+                   double const interface_pressure_negative) {
+    interface_velocity_[n] = interface_velocity;
+    interface_pressure_positive_[n] = interface_pressure_positive;
+    interface_pressure_negative_[n] = interface_pressure_negative;
+  }
+};
+
+#endif // INTERFACE_RIEMANN_PROBLEM_BATCH_H
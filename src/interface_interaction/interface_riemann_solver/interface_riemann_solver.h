@@ -22,6 +22,7 @@
 #ifndef INTERFACE_RIEMANN_SOLVER_H
 #define INTERFACE_RIEMANN_SOLVER_H
 
+#include "interface_riemann_problem_batch.h"
 #include "materials/material_manager.h"
 
 /**
@@ -47,6 +48,31 @@ protected:
     // Empty besides initializer list.
   }
 
+  /**
+   * @brief Solves a batch of interface Riemann problems cell by cell. Derived
+   * classes may provide a dedicated batched solution procedure instead.
+   * @param batch The interface Riemann problems and their solution (indirect
+   * return parameter).
+   * @param material_left Material of the left fluid.
+   * @param material_right Material of the right fluid.
+   */
+  void SolveInterfaceRiemannProblemsImplementation(
+      InterfaceRiemannProblemBatch &batch, MaterialName const material_left,
+      MaterialName const material_right) const {
+    for (std::size_t n = 0; n < batch.Size(); ++n) {
+      std::array<double, 3> const interface_states =
+          static_cast<DerivedInterfaceRiemannSolver const &>(*this)
+              .SolveInterfaceRiemannProblemImplementation(
+                  batch.rho_left_[n], batch.p_left_[n],
+                  batch.velocity_normal_left_[n], material_left,
+                  batch.rho_right_[n], batch.p_right_[n],
+                  batch.velocity_normal_right_[n], material_right,
+                  batch.delta_p_[n]);
+      batch.SetSolution(n, interface_states[0], interface_states[1],
+                        interface_states[2]);
+    }
+  }
+
 public:
   InterfaceRiemannSolver() = delete;
   ~InterfaceRiemannSolver() = default;
@@ -91,6 +117,38 @@ public:
             rho_left, p_left, velocity_normal_left, material_left, rho_right,
             p_right, velocity_normal_right, material_right, delta_p);
   }
+
+  /**
+   * @brief Solves a batch of interface Riemann problems with the same pair of
+   * materials.
+   * @param batch The interface Riemann problems and their solution (indirect
+   * return parameter).
+   * @param material_left Material of the left fluid.
+   * @param material_right Material of the right fluid.
+   */
+  void SolveInterfaceRiemannProblems(InterfaceRiemannProblemBatch &batch,
+                                     MaterialName const material_left,
+                                     MaterialName const material_right) const {
+    if constexpr (CC::SolidBoundaryActive()) {
+      if (material_manager_.IsSolidBoundary(material_left)) {
+        for (std::size_t n = 0; n < batch.Size(); ++n) {
+          batch.SetSolution(n, batch.velocity_normal_left_[n],
+                            batch.p_right_[n], 0.0);
+        }
+        return;
+      }
+      if (material_manager_.IsSolidBoundary(material_right)) {
+        for (std::size_t n = 0; n < batch.Size(); ++n) {
+          batch.SetSolution(n, batch.velocity_normal_right_[n], 0.0,
+                            batch.p_left_[n]);
+        }
+        return;
+      }
+    }
+    static_cast<DerivedInterfaceRiemannSolver const &>(*this)
+        .SolveInterfaceRiemannProblemsImplementation(batch, material_left,
+                                                     material_right);
+  }
 };
 
 #endif // INTERFACE_RIEMANN_SOLVER_H
@@ -23,7 +23,9 @@
 #define ITERATIVE_INTERFACE_RIEMANN_SOLVER_H
 
 #include <cmath>
+#include <cstddef>
 #include <limits>
+#include <vector>
 
 #include "interface_riemann_solver.h"
 #include "user_specifications/two_phase_constants.h"
@@ -364,6 +366,211 @@ class IterativeInterfaceRiemannSolver
             interface_pressure_negative};
   }
 
+  /**
+   * @brief Solves a batch of interface Riemann problems iteratively. All
+   * problems perform their Newton iterations in lockstep on the
+   * structure-of-arrays data of the batch. After each iteration, converged
+   * problems are removed from the list of active problems. The iterations start
+   * from the pressure guess of the batch if it is admissible, and from the
+   * linearized solution otherwise. Problems which do not converge from the
+   * pressure guess are restarted from the linearized solution.
+   * @param batch The interface Riemann problems and their solution (indirect
+   * return parameter).
+   * @param material_left Material of the left fluid.
+   * @param material_right Material of the right fluid.
+   */
+  void SolveInterfaceRiemannProblemsImplementation(
+      InterfaceRiemannProblemBatch &batch, MaterialName const material_left,
+      MaterialName const material_right) const {
+    std::size_t const size = batch.Size();
+    if (size == 0) {
+      return;
+    }
+
+    EquationOfState const &equation_of_state_left =
+        material_manager_.GetMaterial(material_left).GetEquationOfState();
+    EquationOfState const &equation_of_state_right =
+        material_manager_.GetMaterial(material_right).GetEquationOfState();
+
+    double const gamma_left = equation_of_state_left.Gamma();
+    double const gamma_right = equation_of_state_right.Gamma();
+    double const pressure_constant_left = equation_of_state_left.B();
+    double const pressure_constant_right = equation_of_state_right.B();
+    double const D_left = IterationConstants::D(gamma_left);
+    double const D_right = IterationConstants::D(gamma_right);
+
+    std::vector<double> speed_of_sound_left(size);
+    std::vector<double> speed_of_sound_right(size);
+    equation_of_state_left.SpeedOfSound(
+        batch.rho_left_.data(), batch.p_left_.data(),
+        speed_of_sound_left.data(), static_cast<unsigned int>(size));
+    equation_of_state_right.SpeedOfSound(
+        batch.rho_right_.data(), batch.p_right_.data(),
+        speed_of_sound_right.data(), static_cast<unsigned int>(size));
+
+    /**
+     * For the iteration procedure several constants can be computed in advance.
+     * Those constants can be found in \cite Toro2009 chapter 4.3.
+     */
+    std::vector<double> impedance_left(size);
+    std::vector<double> impedance_right(size);
+    std::vector<double> inverse_impedance_sum(size);
+    std::vector<double> pressure_function_left(size);
+    std::vector<double> one_pressure_function_left(size);
+    std::vector<double> pressure_function_right(size);
+    std::vector<double> one_pressure_function_right(size);
+    std::vector<double> A_left(size);
+    std::vector<double> B_left(size);
+    std::vector<double> C_left(size);
+    std::vector<double> A_right(size);
+    std::vector<double> B_right(size);
+    std::vector<double> C_right(size);
+    std::vector<double> linearized_root(size);
+
+    for (std::size_t n = 0; n < size; ++n) {
+      impedance_left[n] = batch.rho_left_[n] * speed_of_sound_left[n];
+      impedance_right[n] = batch.rho_right_[n] * speed_of_sound_right[n];
+      inverse_impedance_sum[n] =
+          1.0 / std::max((impedance_left[n] + impedance_right[n]),
+                         std::numeric_limits<double>::epsilon());
+
+      pressure_function_left[n] = IterationUtilities::MaterialPressureFunction(
+          batch.p_left_[n], pressure_constant_left);
+      one_pressure_function_left[n] =
+          1.0 / std::max(pressure_function_left[n],
+                         std::numeric_limits<double>::epsilon());
+      pressure_function_right[n] = IterationUtilities::MaterialPressureFunction(
+          batch.p_right_[n], pressure_constant_right);
+      one_pressure_function_right[n] =
+          1.0 / std::max(pressure_function_right[n],
+                         std::numeric_limits<double>::epsilon());
+
+      A_left[n] = IterationConstants::A(gamma_left, batch.rho_left_[n]);
+      B_left[n] = IterationConstants::B(gamma_left, pressure_function_left[n]);
+      C_left[n] = IterationConstants::C(gamma_left, speed_of_sound_left[n]);
+      A_right[n] = IterationConstants::A(gamma_right, batch.rho_right_[n]);
+      B_right[n] =
+          IterationConstants::B(gamma_right, pressure_function_right[n]);
+      C_right[n] = IterationConstants::C(gamma_right, speed_of_sound_right[n]);
+
+      linearized_root[n] =
+          (impedance_left[n] * batch.p_right_[n] +
+           impedance_right[n] * (batch.p_left_[n] - batch.delta_p_[n]) +
+           impedance_left[n] * impedance_right[n] *
+               (batch.velocity_normal_left_[n] -
+                batch.velocity_normal_right_[n])) *
+          inverse_impedance_sum[n];
+    }
+
+    std::vector<double> root(size);
+    std::vector<unsigned char> started_from_guess(size);
+    std::vector<unsigned char> converged(size, 0);
+    std::vector<std::size_t> active_problems;
+    active_problems.reserve(size);
+
+    for (std::size_t n = 0; n < size; ++n) {
+      double const guess = batch.pressure_guess_[n];
+      started_from_guess[n] =
+          IterativeInterfaceRiemannSolverConstants::WarmStart &&
+          std::isfinite(guess) && guess + pressure_constant_left > 0.0 &&
+          guess + pressure_constant_right > 0.0;
+      root[n] = started_from_guess[n] ? guess : linearized_root[n];
+      active_problems.push_back(n);
+    }
+
+    /**
+     * Iterative procedure to compute the interface states of all active
+     * problems.
+     */
+    auto const iterate = [&](std::vector<std::size_t> &problems) {
+      for (unsigned int it = 0; it < IterativeInterfaceRiemannSolverConstants::
+                                         MaximumNumberOfIterations &&
+                                !problems.empty();
+           ++it) {
+        std::size_t number_of_active_problems = 0;
+        for (std::size_t a = 0; a < problems.size(); ++a) {
+          std::size_t const n = problems[a];
+
+          std::array<double, 2> const relations_left =
+              ObtainFunctionAndDerivative(
+                  root[n], batch.p_left_[n], pressure_function_left[n],
+                  one_pressure_function_left[n], pressure_constant_left,
+                  A_left[n], B_left[n], C_left[n], D_left);
+          std::array<double, 2> const relations_right =
+              ObtainFunctionAndDerivative(
+                  root[n], batch.p_right_[n], pressure_function_right[n],
+                  one_pressure_function_right[n], pressure_constant_right,
+                  A_right[n], B_right[n], C_right[n], D_right);
+
+          double const derivative_of_root_function =
+              DerivativeOfRootFunction(relations_left[1], relations_right[1]);
+          // the problem is dropped and falls back to the linearized solution
+          if (derivative_of_root_function == 0.0) {
+            continue;
+          }
+
+          double const next_root =
+              root[n] - RootFunction(relations_left[0], relations_right[0],
+                                     batch.velocity_normal_right_[n] -
+                                         batch.velocity_normal_left_[n]) /
+                            std::max(derivative_of_root_function,
+                                     std::numeric_limits<double>::epsilon());
+
+          if (IterationUtilities::GetTolerance(root[n], next_root) <
+              IterativeInterfaceRiemannSolverConstants::MaximumResiduum) {
+            converged[n] = 1;
+            double const interface_velocity =
+                0.5 * (batch.velocity_normal_right_[n] +
+                       batch.velocity_normal_left_[n]) +
+                0.5 * (relations_right[0] - relations_left[0]);
+            batch.SetSolution(n, interface_velocity, next_root,
+                              next_root - batch.delta_p_[n]);
+          } else {
+            root[n] = next_root;
+            problems[number_of_active_problems++] = n;
+          }
+        }
+        problems.resize(number_of_active_problems);
+      }
+    };
+
+    iterate(active_problems);
+
+    // restart the problems which did not converge from the pressure guess
+    active_problems.clear();
+    for (std::size_t n = 0; n < size; ++n) {
+      if (!converged[n] && started_from_guess[n]) {
+        root[n] = linearized_root[n];
+        active_problems.push_back(n);
+      }
+    }
+    iterate(active_problems);
+
+    /**
+     * In case the iterative procedure did not converge within the specified
+     * maximum number of iterations, we take the linearized solution.
+     */
+    for (std::size_t n = 0; n < size; ++n) {
+      if (converged[n]) {
+        continue;
+      }
+      double const impedance_product = impedance_left[n] * impedance_right[n];
+      double const velocity_jump =
+          batch.velocity_normal_left_[n] - batch.velocity_normal_right_[n];
+      batch.SetSolution(
+          n,
+          (impedance_left[n] * batch.velocity_normal_left_[n] +
+           impedance_right[n] * batch.velocity_normal_right_[n] +
+           batch.p_left_[n] - batch.p_right_[n] - batch.delta_p_[n]) *
+              inverse_impedance_sum[n],
+          linearized_root[n],
+          (impedance_left[n] * (batch.p_right_[n] + batch.delta_p_[n]) +
+           impedance_right[n] * batch.p_left_[n] +
+           impedance_product * velocity_jump) *
+              inverse_impedance_sum[n]);
+    }
+  }
+
 public:
   IterativeInterfaceRiemannSolver() = delete;
   ~IterativeInterfaceRiemannSolver() = default;
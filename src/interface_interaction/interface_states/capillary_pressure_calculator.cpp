@@ -24,6 +24,7 @@
 #include "levelset/geometry/geometry_calculator.h"
 #include "levelset/multi_phase_manager/material_sign_capsule.h"
 #include "stencils/stencil_utilities.h"
+#include "user_specifications/two_phase_constants.h"
 #include "utilities/mathematical_functions.h"
 
 /**
@@ -60,21 +61,81 @@ void CapillaryPressureCalculator::ComputePressureDifference(
 
   std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
-  /**
-   * Use the pressure_difference buffer in the next function call to store the
-   * curvature. Then, in the following step multiplication with the
-   * surface_tension_coefficient_ gives the pressure difference due to capillary
-   * forces.
-   */
-  ComputeInterfaceCurvature(node, pressure_difference);
 
-  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-        if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::NewCutCell)) {
-          pressure_difference[i][j][k] *= surface_tension_coefficient_;
+  std::vector<std::array<unsigned int, 3>> cut_cells;
+  std::vector<std::array<unsigned int, 3>> const &cells =
+      node.GetInterfaceBlock().GetCutCellList().Cells(interface_tags,
+                                                      cut_cells);
+  auto const is_cut_cell =
+      [&interface_tags](std::array<unsigned int, 3> const &cell) {
+        return CutCellList::IsInternal(cell) &&
+               std::abs(interface_tags[cell[0]][cell[1]][cell[2]]) <=
+                   ITTI(IT::NewCutCell);
+      };
+
+  if constexpr (GeometryCalculationSettings::CurvatureEstimator ==
+                CurvatureEstimator::HeightFunction) {
+    double const(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        node.GetInterfaceBlock().GetReinitializedBuffer(
+            InterfaceDescription::Levelset);
+    InterfaceGeometryCache const &geometry_cache =
+        node.GetInterfaceBlock().GetGeometryCache();
+    // cut cells without well-defined heights use the level-set derivatives
+    std::vector<std::array<unsigned int, 3>> levelset_curvature_cells;
+    for (std::array<unsigned int, 3> const &cell : cells) {
+      if (!is_cut_cell(cell)) {
+        continue;
+      }
+      unsigned int const i = cell[0];
+      unsigned int const j = cell[1];
+      unsigned int const k = cell[2];
+      CutCellGeometry const *const cached = geometry_cache.Find(i, j, k);
+      double curvature = 0.0;
+      bool const has_curvature =
+          cached != nullptr
+              ? cached->has_curvature_
+              : ComputeHeightFunctionInterfaceCurvature(
+                    node, i, j, k, GetNormal(levelset, i, j, k), curvature);
+      if (has_curvature) {
+        pressure_difference[i][j][k] =
+            surface_tension_coefficient_ *
+            (cached != nullptr ? cached->curvature_ : curvature);
+      } else {
+        levelset_curvature_cells.push_back(cell);
+      }
+    }
+    if (levelset_curvature_cells.empty()) {
+      return;
+    }
+
+    double levelset_curvature[CC::TCX()][CC::TCY()][CC::TCZ()];
+    for (unsigned int i = 0; i < CC::TCX(); ++i) {
+      for (unsigned int j = 0; j < CC::TCY(); ++j) {
+        for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+          levelset_curvature[i][j][k] = 0.0;
         }
       }
     }
+    ComputeInterfaceCurvature(node, levelset_curvature);
+    for (auto const &[i, j, k] : levelset_curvature_cells) {
+      pressure_difference[i][j][k] =
+          surface_tension_coefficient_ * levelset_curvature[i][j][k];
+    }
+  } else {
+    /**
+     * Use the pressure_difference buffer in the next function call to store the
+     * curvature. Then, in the following step multiplication with the
+     * surface_tension_coefficient_ gives the pressure difference due to
+     * capillary forces.
+     */
+    ComputeInterfaceCurvature(node, pressure_difference);
+
+    // only cut cells carry a curvature, hence the cut-cell list suffices
+    for (std::array<unsigned int, 3> const &cell : cells) {
+      if (is_cut_cell(cell)) {
+        pressure_difference[cell[0]][cell[1]][cell[2]] *=
+            surface_tension_coefficient_;
+      }
+    }
   }
 }
@@ -70,6 +70,8 @@ void InterfaceVelocityPressureCalculator::
                 InterfaceState::PressureNegative)
           : node.GetInterfaceBlock().GetInterfaceStateBuffer(
                 InterfaceState::PressurePositive);
+  InterfaceGeometryCache const &geometry_cache =
+      node.GetInterfaceBlock().GetGeometryCache();
 
   // for describing positive material as right, and negative material als left,
   // see cited paper of Luo
@@ -81,60 +83,76 @@ void InterfaceVelocityPressureCalculator::
   PrimeStates const &right_prime_states =
       node.GetPhaseByMaterial(material_right).GetPrimeStateBuffer();
 
-  double velocity_normal_left = 0.0;
-  double velocity_normal_right = 0.0;
-
+  // gather the interface Riemann problems of the node to solve them together.
+  // The storage is kept per thread to avoid allocations for every node. The
+  // whole extension band is required as the level-set advection relies on the
+  // interface velocity there.
+  thread_local InterfaceRiemannProblemBatch batch;
+  thread_local std::vector<std::array<unsigned int, 3>> cells;
+  cells.clear();
   for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
     for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
       for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
         if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::ExtensionBand)) {
+          cells.push_back({i, j, k});
+        }
+      } // k
+    }   // j
+  }     // i
+  batch.Resize(cells.size());
+
+  for (std::size_t n = 0; n < cells.size(); ++n) {
+    auto const [i, j, k] = cells[n];
+
+    CutCellGeometry const *const cached = geometry_cache.Find(i, j, k);
+    std::array<double, 3> const normal =
+        cached != nullptr ? cached->normal_
+                          : GetNormal(levelset_reinitialized, i, j, k);
 
-          std::array<double, 3> const normal =
-              GetNormal(levelset_reinitialized, i, j, k);
+    double velocity_normal_left =
+        left_prime_states[PrimeState::VelocityX][i][j][k] * normal[0];
+    velocity_normal_left +=
+        CC::DIM() != Dimension::One
+            ? left_prime_states[PrimeState::VelocityY][i][j][k] * normal[1]
+            : 0.0;
+    velocity_normal_left +=
+        CC::DIM() == Dimension::Three
+            ? left_prime_states[PrimeState::VelocityZ][i][j][k] * normal[2]
+            : 0.0;
 
-          velocity_normal_left =
-              left_prime_states[PrimeState::VelocityX][i][j][k] * normal[0];
-          velocity_normal_left +=
-              CC::DIM() != Dimension::One
-                  ? left_prime_states[PrimeState::VelocityY][i][j][k] *
-                        normal[1]
-                  : 0.0;
-          velocity_normal_left +=
-              CC::DIM() == Dimension::Three
-                  ? left_prime_states[PrimeState::VelocityZ][i][j][k] *
-                        normal[2]
-                  : 0.0;
+    double velocity_normal_right =
+        right_prime_states[PrimeState::VelocityX][i][j][k] * normal[0];
+    velocity_normal_right +=
+        CC::DIM() != Dimension::One
+            ? right_prime_states[PrimeState::VelocityY][i][j][k] * normal[1]
+            : 0.0;
+    velocity_normal_right +=
+        CC::DIM() == Dimension::Three
+            ? right_prime_states[PrimeState::VelocityZ][i][j][k] * normal[2]
+            : 0.0;
 
-          velocity_normal_right =
-              right_prime_states[PrimeState::VelocityX][i][j][k] * normal[0];
-          velocity_normal_right +=
-              CC::DIM() != Dimension::One
-                  ? right_prime_states[PrimeState::VelocityY][i][j][k] *
-                        normal[1]
-                  : 0.0;
-          velocity_normal_right +=
-              CC::DIM() == Dimension::Three
-                  ? right_prime_states[PrimeState::VelocityZ][i][j][k] *
-                        normal[2]
-                  : 0.0;
+    batch.rho_left_[n] = left_prime_states[PrimeState::Density][i][j][k];
+    batch.p_left_[n] = left_prime_states[PrimeState::Pressure][i][j][k];
+    batch.velocity_normal_left_[n] = velocity_normal_left;
+    batch.rho_right_[n] = right_prime_states[PrimeState::Density][i][j][k];
+    batch.p_right_[n] = right_prime_states[PrimeState::Pressure][i][j][k];
+    batch.velocity_normal_right_[n] = velocity_normal_right;
+    batch.delta_p_[n] = pressure_difference[i][j][k];
+    // the interface pressure of the previous stage serves as initial guess
+    batch.pressure_guess_[n] = interface_pressure_positive[i][j][k];
+  }
 
-          std::array<double, 3> const interface_states =
-              interface_riemann_solver_.SolveInterfaceRiemannProblem(
-                  left_prime_states[PrimeState::Density][i][j][k],
-                  left_prime_states[PrimeState::Pressure][i][j][k],
-                  velocity_normal_left, material_left,
-                  right_prime_states[PrimeState::Density][i][j][k],
-                  right_prime_states[PrimeState::Pressure][i][j][k],
-                  velocity_normal_right, material_right,
-                  pressure_difference[i][j][k]);
+  interface_riemann_solver_.SolveInterfaceRiemannProblems(batch, material_left,
+                                                          material_right);
 
-          interface_velocity[i][j][k] = interface_states[0];
-          interface_pressure_positive[i][j][k] = interface_states[1];
-          if constexpr (CC::CapillaryForcesActive()) {
-            interface_pressure_negative[i][j][k] = interface_states[2];
-          }
-        } // if
-      }   // k
-    }     // j
-  }       // i
+  for (std::size_t n = 0; n < cells.size(); ++n) {
+    auto const [i, j, k] = cells[n];
+    interface_velocity[i][j][k] = batch.interface_velocity_[n];
+    interface_pressure_positive[i][j][k] =
+        batch.interface_pressure_positive_[n];
+    if constexpr (CC::CapillaryForcesActive()) {
+      interface_pressure_negative[i][j][k] =
+          batch.interface_pressure_negative_[n];
+    }
+  }
 }
@@ -66,49 +66,49 @@ void HeatExchangeFluxes::ComputeInterfaceFluxes(
   double real_material_temperature[CC::TCX()][CC::TCY()][CC::TCZ()];
   ComputeRealMaterialTemperature(node, real_material_temperature);
 
-  double(&positive_energy_rhs)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue(&positive_energy_rhs)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial())
           .GetRightHandSideBuffer(Equation::Energy);
-  double(&negative_energy_rhs)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue(&negative_energy_rhs)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial())
           .GetRightHandSideBuffer(Equation::Energy);
 
-  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-        if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::NewCutCell)) {
-
-          // compute harmonic average of heat transfer coefficient
-          double const thermal_conductivity_interface =
-              (thermal_conductivity_positive_ *
-               thermal_conductivity_negative_) /
-              (volume_fraction[i][j][k] * thermal_conductivity_negative_ +
-               (1.0 - volume_fraction[i][j][k]) *
-                   thermal_conductivity_positive_ +
-               epsilon_);
-
-          std::array<double, 3> temperature_gradient =
-              SU::GradientVector<DerivativeStencilSetup::Concretize<
-                  heat_fluxes_derivative_stencil_cell_center>::type>(
-                  real_material_temperature, i, j, k, cell_size);
-          for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
-            temperature_gradient[d] *=
-                delta_aperture_field[BIT::T2IX(i)][BIT::T2IY(j)][BIT::T2IZ(k)]
-                                    [d];
-          }
-
-          double const interface_heat_flux =
-              -thermal_conductivity_interface *
-              ConsistencyManagedSum(temperature_gradient);
-
-          // store in exchange buffers - only influence on energy field
-          positive_energy_rhs[i][j][k] += interface_heat_flux * one_cell_size;
-          negative_energy_rhs[i][j][k] -= interface_heat_flux * one_cell_size;
-
-        } // if cut cell
-      }   // k
-    }     // j
-  }       // i
+  std::vector<std::array<unsigned int, 3>> cut_cells;
+  for (std::array<unsigned int, 3> const &cell :
+       node.GetInterfaceBlock().GetCutCellList().Cells(interface_tags,
+                                                       cut_cells)) {
+    unsigned int const i = cell[0];
+    unsigned int const j = cell[1];
+    unsigned int const k = cell[2];
+    if (!CutCellList::IsInternal(cell) ||
+        std::abs(interface_tags[i][j][k]) > ITTI(IT::NewCutCell)) {
+      continue;
+    }
+
+    // compute harmonic average of heat transfer coefficient
+    double const thermal_conductivity_interface =
+        (thermal_conductivity_positive_ * thermal_conductivity_negative_) /
+        (volume_fraction[i][j][k] * thermal_conductivity_negative_ +
+         (1.0 - volume_fraction[i][j][k]) * thermal_conductivity_positive_ +
+         epsilon_);
+
+    std::array<double, 3> temperature_gradient =
+        SU::GradientVector<DerivativeStencilSetup::Concretize<
+            heat_fluxes_derivative_stencil_cell_center>::type>(
+            real_material_temperature, i, j, k, cell_size);
+    for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+      temperature_gradient[d] *=
+          delta_aperture_field[BIT::T2IX(i)][BIT::T2IY(j)][BIT::T2IZ(k)][d];
+    }
+
+    double const interface_heat_flux =
+        -thermal_conductivity_interface *
+        ConsistencyManagedSum(temperature_gradient);
+
+    // store in exchange buffers - only influence on energy field
+    positive_energy_rhs[i][j][k] += interface_heat_flux * one_cell_size;
+    negative_energy_rhs[i][j][k] -= interface_heat_flux * one_cell_size;
+  } // cells close to the interface
 }
 
 /**
@@ -126,10 +126,10 @@ void HeatExchangeFluxes::ComputeRealMaterialTemperature(
       node.GetInterfaceBlock().GetReinitializedBuffer(
           InterfaceDescription::Levelset);
 
-  double const(&temperature_positive)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&temperature_positive)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial())
           .GetPrimeStateBuffer(PrimeState::Temperature);
-  double const(&temperature_negative)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&temperature_negative)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial())
           .GetPrimeStateBuffer(PrimeState::Temperature);
 
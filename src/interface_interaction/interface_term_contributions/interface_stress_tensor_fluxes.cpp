@@ -279,7 +279,10 @@ void InterfaceStressTensorFluxes::AddInviscidPartToInterfaceStressTensor(
 }
 
 /**
- * @brief      Adds the viscous part to the interface stress tensor.
+ * @brief      Adds the viscous part to the interface stress tensor. The
+ * real-material velocity is computed once per node and the velocity gradient
+ * and the viscous stress tensor are evaluated in a single pass over the cut
+ * cells.
  * @param      node                                    The considered node.
  * @param      interface_stress_tensor_positive_material  The interface stress
  * tensor of the positive material.
@@ -295,77 +298,12 @@ void InterfaceStressTensorFluxes::AddViscousPartToInterfaceStressTensor(
                                                    [CC::ICZ()][DTI(CC::DIM())]
                                                    [DTI(CC::DIM())]) const {
 
-  double velocity_gradient[CC::ICX()][CC::ICY()][CC::ICZ()][DTI(CC::DIM())]
-                          [DTI(CC::DIM())];
-  double tau[CC::ICX()][CC::ICY()][CC::ICZ()][DTI(CC::DIM())][DTI(CC::DIM())];
-  for (unsigned int i = 0; i < CC::ICX(); ++i) {
-    for (unsigned int j = 0; j < CC::ICY(); ++j) {
-      for (unsigned int k = 0; k < CC::ICZ(); ++k) {
-        for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
-          for (unsigned int s = 0; s < DTI(CC::DIM()); ++s) {
-            velocity_gradient[i][j][k][r][s] = 0.0;
-            tau[i][j][k][r][s] = 0.0;
-          } // s
-        }   // r
-      }     // k
-    }       // j
-  }         // i
-
-  CalculateVelocityGradientAtInterface(node, velocity_gradient);
-
-  CalculateViscousStressTensor(node, velocity_gradient, tau);
-  if constexpr (CC::Axisymmetric()) {
-    AddAxisymmetricPartToViscousStressTensor(node, tau);
-  }
-
   std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
-
-  bool const is_negative_material_solid = material_manager_.IsSolidBoundary(
-      negative_material_properties_.material_);
-  bool const is_positive_material_solid = material_manager_.IsSolidBoundary(
-      positive_material_properties_.material_);
-
-  for (unsigned int i = 0; i < CC::ICX(); ++i) {
-    for (unsigned int j = 0; j < CC::ICY(); ++j) {
-      for (unsigned int k = 0; k < CC::ICZ(); ++k) {
-        std::array<unsigned int, 3> const indices = {BIT::I2TX(i), BIT::I2TY(j),
-                                                     BIT::I2TZ(k)};
-        if (std::abs(interface_tags[indices[0]][indices[1]][indices[2]]) <=
-            ITTI(IT::NewCutCell)) {
-          for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
-            for (unsigned int s = 0; s < DTI(CC::DIM()); ++s) {
-              if (!is_negative_material_solid) {
-                interface_stress_tensor_negative_material[i][j][k][r][s] +=
-                    tau[i][j][k][r][s];
-              }
-              if (!is_positive_material_solid) {
-                interface_stress_tensor_positive_material[i][j][k][r][s] +=
-                    tau[i][j][k][r][s];
-              }
-            } // s
-          }   // r
-        }     // if
-      }       // k
-    }         // j
-  }           // i
-}
-
-/**
- * @brief      Calculates the velocity gradient at the interface.
- * @param      node                            The node.
- * @param      velocity_gradient_at_interface  The velocity gradient at the
- * interface as an indirect return parameter.
- */
-void InterfaceStressTensorFluxes::CalculateVelocityGradientAtInterface(
-    Node const &node,
-    double (&velocity_gradient_at_interface)[CC::ICX()][CC::ICY()][CC::ICZ()]
-                                            [DTI(CC::DIM())][DTI(CC::DIM())])
-    const {
-
+  double const(&volume_fractions)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      node.GetInterfaceBlock().GetReinitializedBuffer(
+          InterfaceDescription::VolumeFraction);
   double const cell_size = node.GetCellSize();
-  std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
 
   double real_material_velocity_x[CC::TCX()][CC::TCY()][CC::TCZ()];
   double real_material_velocity_y[CC::TCX()][CC::TCY()][CC::TCZ()];
@@ -374,137 +312,138 @@ void InterfaceStressTensorFluxes::CalculateVelocityGradientAtInterface(
                               real_material_velocity_y,
                               real_material_velocity_z);
 
-  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-        if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::NewCutCell)) {
+  bool const is_negative_material_solid = material_manager_.IsSolidBoundary(
+      negative_material_properties_.material_);
+  bool const is_positive_material_solid = material_manager_.IsSolidBoundary(
+      positive_material_properties_.material_);
+
+  std::vector<std::array<unsigned int, 3>> cut_cells;
+  for (std::array<unsigned int, 3> const &cell :
+       node.GetInterfaceBlock().GetCutCellList().Cells(interface_tags,
+                                                       cut_cells)) {
+    unsigned int const i = cell[0];
+    unsigned int const j = cell[1];
+    unsigned int const k = cell[2];
+    if (!CutCellList::IsInternal(cell) ||
+        std::abs(interface_tags[i][j][k]) > ITTI(IT::NewCutCell)) {
+      continue;
+    }
 
-          std::array<std::array<double, 3>, 3> const gradient =
-              SU::JacobianMatrix<DerivativeStencilSetup::Concretize<
-                  viscous_fluxes_derivative_stencil_cell_center>::type>(
-                  real_material_velocity_x, real_material_velocity_y,
-                  real_material_velocity_z, i, j, k, cell_size);
+    unsigned int const x = BIT::T2IX(i);
+    unsigned int const y = BIT::T2IY(j);
+    unsigned int const z = BIT::T2IZ(k);
+
+    std::array<std::array<double, 3>, 3> const velocity_gradient =
+        CalculateVelocityGradientAtInterface(
+            real_material_velocity_x, real_material_velocity_y,
+            real_material_velocity_z, i, j, k, cell_size);
+
+    std::array<double, 3> const interface_viscosity =
+        ComputeInterfaceViscosities(volume_fractions[i][j][k]);
+    std::array<std::array<double, 3>, 3> tau =
+        CalculateViscousStressTensor(interface_viscosity, velocity_gradient);
+    if constexpr (CC::Axisymmetric()) {
+      double const radius = std::get<0>(node.GetBlockCoordinates()) +
+                            (static_cast<double>(x) + 0.5) * cell_size;
+      AddAxisymmetricPartToViscousStressTensor(
+          interface_viscosity, real_material_velocity_x[i][j][k], radius, tau);
+    }
 
-          for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
-            for (unsigned int s = 0; s < DTI(CC::DIM()); ++s) {
-              velocity_gradient_at_interface[BIT::T2IX(i)][BIT::T2IY(j)]
-                                            [BIT::T2IZ(k)][r][s] =
-                                                gradient[r][s];
-            }
-          }
-        } // if
-      }   // k
-    }     // j
-  }       // i
+    for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
+      for (unsigned int s = 0; s < DTI(CC::DIM()); ++s) {
+        if (!is_negative_material_solid) {
+          interface_stress_tensor_negative_material[x][y][z][r][s] += tau[r][s];
+        }
+        if (!is_positive_material_solid) {
+          interface_stress_tensor_positive_material[x][y][z][r][s] += tau[r][s];
+        }
+      } // s
+    }   // r
+  }     // cells close to the interface
 }
 
 /**
- * @brief      Calculates the viscous contribution to the stress tensor tau.
- * @param      node               The node.
- * @param[in]  velocity_gradient  The interface velocity gradient.
- * @param      tau                The viscous part of the stress tensor as an
- * indirect return parameter.
+ * @brief      Calculates the velocity gradient at the interface in a single
+ * cut cell.
+ * @param      real_material_velocity_x  The real-material velocity field in x
+ * direction.
+ * @param      real_material_velocity_y  The real-material velocity field in y
+ * direction.
+ * @param      real_material_velocity_z  The real-material velocity field in z
+ * direction.
+ * @param      i, j, k                   The indices of the cut cell.
+ * @param      cell_size                 The cell size of the node.
+ * @return     The velocity gradient du_r / dx_s.
  */
-void InterfaceStressTensorFluxes::CalculateViscousStressTensor(
-    Node const &node,
-    double const (&velocity_gradient)[CC::ICX()][CC::ICY()][CC::ICZ()]
-                                     [DTI(CC::DIM())][DTI(CC::DIM())],
-    double (&tau)[CC::ICX()][CC::ICY()][CC::ICZ()][DTI(CC::DIM())]
-                 [DTI(CC::DIM())]) const {
-
-  std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
-  double const(&volume_fractions)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceBlock().GetReinitializedBuffer(
-          InterfaceDescription::VolumeFraction);
-
-  for (unsigned int i = 0; i < CC::ICX(); ++i) {
-    for (unsigned int j = 0; j < CC::ICY(); ++j) {
-      for (unsigned int k = 0; k < CC::ICZ(); ++k) {
-        std::array<unsigned int, 3> const indices = {BIT::I2TX(i), BIT::I2TY(j),
-                                                     BIT::I2TZ(k)};
-        if (std::abs(interface_tags[indices[0]][indices[1]][indices[2]]) <=
-            ITTI(IT::NewCutCell)) {
-          std::array<double, 3> const interface_viscosity =
-              ComputeInterfaceViscosities(
-                  volume_fractions[indices[0]][indices[1]][indices[2]]);
-          std::array<double, 3> const velocity_gradient_diagonal = {
-              velocity_gradient[i][j][k][0][0],
-              CC::DIM() != Dimension::One ? velocity_gradient[i][j][k][1][1]
-                                          : 0.0,
-              CC::DIM() == Dimension::Three ? velocity_gradient[i][j][k][2][2]
-                                            : 0.0};
-          double const volume_viscosity_contribution =
-              interface_viscosity[2] *
-              DimensionAwareConsistencyManagedSum(velocity_gradient_diagonal);
+std::array<std::array<double, 3>, 3>
+InterfaceStressTensorFluxes::CalculateVelocityGradientAtInterface(
+    double const (&real_material_velocity_x)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double const (&real_material_velocity_y)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double const (&real_material_velocity_z)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    unsigned int const i, unsigned int const j, unsigned int const k,
+    double const cell_size) const {
+  return SU::JacobianMatrix<DerivativeStencilSetup::Concretize<
+      viscous_fluxes_derivative_stencil_cell_center>::type>(
+      real_material_velocity_x, real_material_velocity_y,
+      real_material_velocity_z, i, j, k, cell_size);
+}
 
-          for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
-            for (unsigned int s = 0; s < DTI(CC::DIM()); ++s) {
-              tau[i][j][k][r][s] +=
-                  interface_viscosity[0] * (velocity_gradient[i][j][k][r][s] +
-                                            velocity_gradient[i][j][k][s][r]);
-            }
-          }
+/**
+ * @brief      Calculates the viscous contribution to the stress tensor tau in
+ * a single cut cell.
+ * @param[in]  interface_viscosity  The shear, bulk and volumetric interface
+ * viscosities.
+ * @param[in]  velocity_gradient    The interface velocity gradient.
+ * @return     The viscous part of the stress tensor.
+ */
+std::array<std::array<double, 3>, 3>
+InterfaceStressTensorFluxes::CalculateViscousStressTensor(
+    std::array<double, 3> const &interface_viscosity,
+    std::array<std::array<double, 3>, 3> const &velocity_gradient) const {
+
+  std::array<double, 3> const velocity_gradient_diagonal = {
+      velocity_gradient[0][0],
+      CC::DIM() != Dimension::One ? velocity_gradient[1][1] : 0.0,
+      CC::DIM() == Dimension::Three ? velocity_gradient[2][2] : 0.0};
+  double const volume_viscosity_contribution =
+      interface_viscosity[2] *
+      DimensionAwareConsistencyManagedSum(velocity_gradient_diagonal);
+
+  std::array<std::array<double, 3>, 3> tau = {
+      {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}}};
+  for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
+    for (unsigned int s = 0; s < DTI(CC::DIM()); ++s) {
+      tau[r][s] = interface_viscosity[0] *
+                  (velocity_gradient[r][s] + velocity_gradient[s][r]);
+    }
+  }
 
-          for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
-            tau[i][j][k][r][r] += volume_viscosity_contribution;
-          }
-        } // if
-      }   // k
-    }     // j
-  }       // i
+  for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
+    tau[r][r] += volume_viscosity_contribution;
+  }
+  return tau;
 }
 
 /**
- * @brief      Adds the axisymmetric viscous part to the stress tensor
- *
- * @param      node               The node.
- * @param      tau                The viscid part of the stress tensor as an
- * indirect return parameter.
+ * @brief      Adds the axisymmetric viscous part to the stress tensor of a
+ * single cut cell.
+ * @param[in]  interface_viscosity     The shear, bulk and volumetric interface
+ * viscosities.
+ * @param[in]  real_material_velocity_x The real-material radial velocity in
+ * the cell.
+ * @param[in]  radius                  The radial position of the cell center.
+ * @param      tau                     The viscous part of the stress tensor as
+ * an indirect return parameter.
  */
 void InterfaceStressTensorFluxes::AddAxisymmetricPartToViscousStressTensor(
-    Node const &node, double (&tau)[CC::ICX()][CC::ICY()][CC::ICZ()]
-                                   [DTI(CC::DIM())][DTI(CC::DIM())]) const {
-
-  std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
-  double const(&volume_fractions)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceBlock().GetReinitializedBuffer(
-          InterfaceDescription::VolumeFraction);
-
-  double const cell_size = node.GetCellSize();
-
-  double real_fluid_velocity_x[CC::TCX()][CC::TCY()][CC::TCZ()];
-  double real_fluid_velocity_y[CC::TCX()][CC::TCY()][CC::TCZ()];
-  double real_fluid_velocity_z[CC::TCX()][CC::TCY()][CC::TCZ()];
-  ComputeRealMaterialVelocity(node, real_fluid_velocity_x,
-                              real_fluid_velocity_y, real_fluid_velocity_z);
-
-  for (unsigned int i = 0; i < CC::ICX(); ++i) {
-    for (unsigned int j = 0; j < CC::ICY(); ++j) {
-      for (unsigned int k = 0; k < CC::ICZ(); ++k) {
-        std::array<unsigned int, 3> const indices = {BIT::I2TX(i), BIT::I2TY(j),
-                                                     BIT::I2TZ(k)};
-        if (std::abs(interface_tags[indices[0]][indices[1]][indices[2]]) <=
-            ITTI(IT::NewCutCell)) {
-          std::array<double, 3> const interface_viscosity =
-              ComputeInterfaceViscosities(
-                  volume_fractions[indices[0]][indices[1]][indices[2]]);
-
-          double const radius = std::get<0>(node.GetBlockCoordinates()) +
-                                (static_cast<double>(i) + 0.5) * cell_size;
-          double const volume_viscosity_contribution =
-              interface_viscosity[2] *
-              real_fluid_velocity_x[indices[0]][indices[1]][indices[2]] /
-              radius;
-
-          for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
-            tau[i][j][k][r][r] += volume_viscosity_contribution;
-          }
-        } // if
-      }   // k
-    }     // j
-  }       // i
+    std::array<double, 3> const &interface_viscosity,
+    double const real_material_velocity_x, double const radius,
+    std::array<std::array<double, 3>, 3> &tau) const {
+  double const volume_viscosity_contribution =
+      interface_viscosity[2] * real_material_velocity_x / radius;
+  for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
+    tau[r][r] += volume_viscosity_contribution;
+  }
 }
 
 /**
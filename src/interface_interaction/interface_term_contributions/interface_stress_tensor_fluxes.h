@@ -82,22 +82,21 @@ class InterfaceStressTensorFluxes {
                                                      [CC::ICZ()][DTI(CC::DIM())]
                                                      [DTI(CC::DIM())]) const;
 
-  void CalculateVelocityGradientAtInterface(
-      Node const &node,
-      double (&velocity_gradient_at_interface)[CC::ICX()][CC::ICY()][CC::ICZ()]
-                                              [DTI(CC::DIM())][DTI(CC::DIM())])
-      const;
+  std::array<std::array<double, 3>, 3> CalculateVelocityGradientAtInterface(
+      double const (&real_material_velocity_x)[CC::TCX()][CC::TCY()][CC::TCZ()],
+      double const (&real_material_velocity_y)[CC::TCX()][CC::TCY()][CC::TCZ()],
+      double const (&real_material_velocity_z)[CC::TCX()][CC::TCY()][CC::TCZ()],
+      unsigned int const i, unsigned int const j, unsigned int const k,
+      double const cell_size) const;
 
-  void CalculateViscousStressTensor(
-      Node const &node,
-      double const (&velocity_gradient)[CC::ICX()][CC::ICY()][CC::ICZ()]
-                                       [DTI(CC::DIM())][DTI(CC::DIM())],
-      double (&tau)[CC::ICX()][CC::ICY()][CC::ICZ()][DTI(CC::DIM())]
-                   [DTI(CC::DIM())]) const;
+  std::array<std::array<double, 3>, 3> CalculateViscousStressTensor(
+      std::array<double, 3> const &interface_viscosity,
+      std::array<std::array<double, 3>, 3> const &velocity_gradient) const;
 
   void AddAxisymmetricPartToViscousStressTensor(
-      Node const &node, double (&tau)[CC::ICX()][CC::ICY()][CC::ICZ()]
-                                     [DTI(CC::DIM())][DTI(CC::DIM())]) const;
+      std::array<double, 3> const &interface_viscosity,
+      double const real_material_velocity_x, double const radius,
+      std::array<std::array<double, 3>, 3> &tau) const;
 
   void AddFluxesToRightHandSide(
       Node &node,
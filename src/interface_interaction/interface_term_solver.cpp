@@ -100,42 +100,47 @@ void InterfaceTermSolver::FillInterfaceNormalVelocityBuffer(
   double const(&interface_velocity)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       node.GetInterfaceBlock().GetInterfaceStateBuffer(
           InterfaceState::Velocity);
+  InterfaceGeometryCache const &geometry_cache =
+      node.GetInterfaceBlock().GetGeometryCache();
 
-  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-        if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::NewCutCell)) {
+  std::vector<std::array<unsigned int, 3>> cut_cells;
+  for (std::array<unsigned int, 3> const &cell :
+       node.GetInterfaceBlock().GetCutCellList().Cells(interface_tags,
+                                                       cut_cells)) {
+    unsigned int const i = cell[0];
+    unsigned int const j = cell[1];
+    unsigned int const k = cell[2];
+    if (!CutCellList::IsInternal(cell) ||
+        std::abs(interface_tags[i][j][k]) > ITTI(IT::NewCutCell)) {
+      continue;
+    }
 
-          std::array<double, 3> const normal =
-              GetNormal(levelset_reinitialized, i, j, k);
+    CutCellGeometry const *const cached = geometry_cache.Find(i, j, k);
+    std::array<double, 3> const normal =
+        cached != nullptr ? cached->normal_
+                          : GetNormal(levelset_reinitialized, i, j, k);
 
-          // determine interface velocity vector based on absolute value of
-          // interface velocity
-          std::array<double, 3> const u_interface_normal = {
-              interface_velocity[i][j][k] * normal[0],
-              CC::DIM() != Dimension::One
-                  ? interface_velocity[i][j][k] * normal[1]
-                  : 0.0,
-              CC::DIM() == Dimension::Three
-                  ? interface_velocity[i][j][k] * normal[2]
-                  : 0.0};
+    // determine interface velocity vector based on absolute value of
+    // interface velocity
+    std::array<double, 3> const u_interface_normal = {
+        interface_velocity[i][j][k] * normal[0],
+        CC::DIM() != Dimension::One ? interface_velocity[i][j][k] * normal[1]
+                                    : 0.0,
+        CC::DIM() == Dimension::Three ? interface_velocity[i][j][k] * normal[2]
+                                      : 0.0};
 
-          // calculate indices in exchange term buffers
-          std::array<unsigned int, 3> const indices = {
-              i - CC::FICX(), CC::DIM() != Dimension::One ? j - CC::FICY() : 0,
-              CC::DIM() == Dimension::Three ? k - CC::FICZ() : 0};
+    // calculate indices in exchange term buffers
+    std::array<unsigned int, 3> const indices = {
+        i - CC::FICX(), CC::DIM() != Dimension::One ? j - CC::FICY() : 0,
+        CC::DIM() == Dimension::Three ? k - CC::FICZ() : 0};
 
-          u_interface_normal_field[indices[0]][indices[1]][indices[2]][0] =
-              u_interface_normal[0];
-          u_interface_normal_field[indices[0]][indices[1]][indices[2]][1] =
-              u_interface_normal[1];
-          u_interface_normal_field[indices[0]][indices[1]][indices[2]][2] =
-              u_interface_normal[2];
-
-        } // if
-      }   // k
-    }     // j
-  }       // i
+    u_interface_normal_field[indices[0]][indices[1]][indices[2]][0] =
+        u_interface_normal[0];
+    u_interface_normal_field[indices[0]][indices[1]][indices[2]][1] =
+        u_interface_normal[1];
+    u_interface_normal_field[indices[0]][indices[1]][indices[2]][2] =
+        u_interface_normal[2];
+  } // cells close to the interface
 }
 
 /**
@@ -155,43 +160,50 @@ void InterfaceTermSolver::FillDeltaApertureBuffer(
   double const(&levelset_reinitialized)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       node.GetInterfaceBlock().GetReinitializedBuffer(
           InterfaceDescription::Levelset);
+  InterfaceGeometryCache const &geometry_cache =
+      node.GetInterfaceBlock().GetGeometryCache();
 
-  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-        if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::NewCutCell)) {
+  std::vector<std::array<unsigned int, 3>> cut_cells;
+  for (std::array<unsigned int, 3> const &cell :
+       node.GetInterfaceBlock().GetCutCellList().Cells(interface_tags,
+                                                       cut_cells)) {
+    unsigned int const i = cell[0];
+    unsigned int const j = cell[1];
+    unsigned int const k = cell[2];
+    if (!CutCellList::IsInternal(cell) ||
+        std::abs(interface_tags[i][j][k]) > ITTI(IT::NewCutCell)) {
+      continue;
+    }
 
-          // get cell face apertures for cell i j k
-          std::array<double, 6> const cell_face_apertures =
-              geometry_calculator_.ComputeCellFaceAperture(
-                  levelset_reinitialized, i, j, k);
-          // compute changes in aperture over cell, which is the relevant lenght
-          // scale for interface interaction in each direction
-          std::array<double, 3> const delta_aperture = {
-              cell_face_apertures[1] - cell_face_apertures[0],
-              CC::DIM() != Dimension::One
-                  ? cell_face_apertures[3] - cell_face_apertures[2]
-                  : 0.0,
-              CC::DIM() == Dimension::Three
-                  ? cell_face_apertures[5] - cell_face_apertures[4]
-                  : 0.0};
+    // get cell face apertures for cell i j k
+    CutCellGeometry const *const cached = geometry_cache.Find(i, j, k);
+    std::array<double, 6> const cell_face_apertures =
+        cached != nullptr ? cached->apertures_
+                          : geometry_calculator_.ComputeCellFaceAperture(
+                                levelset_reinitialized, i, j, k);
+    // compute changes in aperture over cell, which is the relevant lenght
+    // scale for interface interaction in each direction
+    std::array<double, 3> const delta_aperture = {
+        cell_face_apertures[1] - cell_face_apertures[0],
+        CC::DIM() != Dimension::One
+            ? cell_face_apertures[3] - cell_face_apertures[2]
+            : 0.0,
+        CC::DIM() == Dimension::Three
+            ? cell_face_apertures[5] - cell_face_apertures[4]
+            : 0.0};
 
-          // calculate indices in exchange term buffers
-          std::array<unsigned int, 3> const indices = {
-              i - CC::FICX(), CC::DIM() != Dimension::One ? j - CC::FICY() : 0,
-              CC::DIM() == Dimension::Three ? k - CC::FICZ() : 0};
+    // calculate indices in exchange term buffers
+    std::array<unsigned int, 3> const indices = {
+        i - CC::FICX(), CC::DIM() != Dimension::One ? j - CC::FICY() : 0,
+        CC::DIM() == Dimension::Three ? k - CC::FICZ() : 0};
 
-          delta_aperture_field[indices[0]][indices[1]][indices[2]][0] =
-              delta_aperture[0];
-          delta_aperture_field[indices[0]][indices[1]][indices[2]][1] =
-              delta_aperture[1];
-          delta_aperture_field[indices[0]][indices[1]][indices[2]][2] =
-              delta_aperture[2];
-
-        } // if
-      }   // k
-    }     // j
-  }       // i
+    delta_aperture_field[indices[0]][indices[1]][indices[2]][0] =
+        delta_aperture[0];
+    delta_aperture_field[indices[0]][indices[1]][indices[2]][1] =
+        delta_aperture[1];
+    delta_aperture_field[indices[0]][indices[1]][indices[2]][2] =
+        delta_aperture[2];
+  } // cells close to the interface
 }
 
 /**
@@ -220,6 +232,8 @@ void InterfaceTermSolver::WeightFaceFluxes(
   double const(&levelset_reinitialized)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       node.GetInterfaceBlock().GetReinitializedBuffer(
           InterfaceDescription::Levelset);
+  InterfaceGeometryCache const &geometry_cache =
+      node.GetInterfaceBlock().GetGeometryCache();
 
   unsigned int const i_start = 0;
   unsigned int const j_start = CC::DIM() != Dimension ::One ? 0 : 1;
@@ -239,10 +253,22 @@ void InterfaceTermSolver::WeightFaceFluxes(
             ITTI(
                 IT::CutCellNeighbor)) { // Fluxes for interface cells have to be
                                         // weighted by the cell-face aperture.
-          std::array<double, 6> const cell_face_apertures =
-              geometry_calculator_.ComputeCellFaceAperture(
-                  levelset_reinitialized, i_index, j_index, k_index,
-                  material_sign);
+          CutCellGeometry const *const cached =
+              geometry_cache.Find(i_index, j_index, k_index);
+          std::array<double, 6> cell_face_apertures;
+          if (cached != nullptr) {
+            // the cache holds the apertures of the positive phase
+            cell_face_apertures = cached->apertures_;
+            if (material_sign < 0) {
+              for (double &aperture : cell_face_apertures) {
+                aperture = 1.0 - aperture;
+              }
+            }
+          } else {
+            cell_face_apertures = geometry_calculator_.ComputeCellFaceAperture(
+                levelset_reinitialized, i_index, j_index, k_index,
+                material_sign);
+          }
           for (unsigned int e = 0; e < MF::ANOE(); ++e) {
             face_fluxes_x[e][i][j][k] *= cell_face_apertures[1];
             if constexpr (CC::DIM() != Dimension::One)
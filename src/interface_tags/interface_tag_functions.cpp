@@ -25,6 +25,7 @@
 #include "levelset/geometry/geometry_calculator.h"
 #include "user_specifications/two_phase_constants.h"
 #include "utilities/mathematical_functions.h"
+#include <algorithm>
 
 namespace InterfaceTagFunctions {
 
@@ -196,23 +197,28 @@ void SetTotalInterfaceTagsFromCutCells(
 }
 
 /**
- * @brief Gives whether or not the given interface tags are uniform (hence, a
- * bulk phase).
- * @param interface_tags Reference to the interface tags to be checked.
- * @return True if all interface tags are uniform, false otherwise.
+ * @brief Gives the range of the given interface tags and their number of cut
+ * cells in a single pass over all cells.
+ * @param interface_tags Reference to the interface tags to be summarized.
+ * @return The summary of the interface tags.
  */
-bool TotalInterfaceTagsAreUniform(
+InterfaceTagSummary SummarizeInterfaceTags(
     std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()]) {
+  InterfaceTagSummary summary = {interface_tags[0][0][0],
+                                 interface_tags[0][0][0], 0};
   for (unsigned int i = 0; i < CC::TCX(); ++i) {
     for (unsigned int j = 0; j < CC::TCY(); ++j) {
       for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-        if (std::abs(interface_tags[i][j][k]) != ITTI(IT::BulkPhase)) {
-          return false;
+        std::int8_t const tag = interface_tags[i][j][k];
+        summary.minimum_ = std::min(summary.minimum_, tag);
+        summary.maximum_ = std::max(summary.maximum_, tag);
+        if (std::abs(tag) <= ITTI(IT::NewCutCell)) {
+          summary.cut_cells_++;
         }
       } // k
     }   // j
   }     // i
-  return true;
+  return summary;
 }
 
 } // namespace InterfaceTagFunctions
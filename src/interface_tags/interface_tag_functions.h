@@ -22,7 +22,34 @@
 #ifndef INTERFACE_TAG_FUNCTIONS_H
 #define INTERFACE_TAG_FUNCTIONS_H
 
+#include "enums/interface_tag_definition.h"
 #include "user_specifications/compile_time_constants.h"
+#include <cstdint>
+#include <cstdlib>
+
+/**
+ * @brief Summary of the interface tags of a node, i.e. the range of the tags
+ * and the number of cut cells among all ( total ) cells.
+ */
+struct InterfaceTagSummary {
+  std::int8_t minimum_;
+  std::int8_t maximum_;
+  unsigned int cut_cells_;
+
+  /**
+   * @brief Indicates whether all cells carry the same tag.
+   * @return True if the tags are uniform, false otherwise.
+   */
+  bool IsUniform() const { return minimum_ == maximum_; }
+
+  /**
+   * @brief Indicates whether all cells are bulk cells of the same phase.
+   * @return True if the tags are uniformly bulk phase, false otherwise.
+   */
+  bool IsUniformBulk() const {
+    return IsUniform() && std::abs(minimum_) == ITTI(IT::BulkPhase);
+  }
+};
 
 namespace InterfaceTagFunctions {
 
@@ -33,7 +60,7 @@ void SetInternalCutCellTagsFromLevelset(
     std::int8_t (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()]);
 void SetTotalInterfaceTagsFromCutCells(
     std::int8_t (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()]);
-bool TotalInterfaceTagsAreUniform(
+InterfaceTagSummary SummarizeInterfaceTags(
     std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()]);
 
 } // namespace InterfaceTagFunctions
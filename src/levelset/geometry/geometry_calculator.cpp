@@ -21,6 +21,7 @@
 //===----------------------------------------------------------------------===//
 #include "geometry_calculator.h"
 #include "enums/interface_tag_definition.h"
+#include "height_function_curvature.h"
 #include "stencils/stencil_utilities.h"
 #include "user_specifications/two_phase_constants.h"
 #include "utilities/mathematical_functions.h"
@@ -62,7 +63,7 @@ void GetLevelsetAtCellCorners(
 
   // degenerates automatically in 2D and 1D, however always uses 8 corner values
   // which are mirrored then into the not considered dimension
-  std::vector<double> levelset_at_corners;
+  std::array<double, 8> levelset_at_corners;
 
   // get levelset values at the corners of the cell
   for (unsigned int r = 0; r < rmax; ++r) {
@@ -138,7 +139,7 @@ void GetLevelsetAtSubcellCorners(
 
   // degenerates automatically in 2D and 1D, however always uses 8 corner values
   // which are mirrored then into the not considered dimension
-  std::vector<double> levelset_at_corners;
+  std::array<double, 8> levelset_at_corners;
 
   // get levelset values at the corners of the cell
   for (unsigned int r = 0; r < rmax; ++r) {
@@ -163,12 +164,11 @@ void GetLevelsetAtSubcellCorners(
         subcell_corner_levelset[2 * r][2 * s][2 * t] =
             0.125 * (std::accumulate(levelset_at_corners.begin(),
                                      levelset_at_corners.end(), 0.0));
-        levelset_at_corners.clear();
       }
     }
   }
 
-  std::vector<double> levelset_edge_vector = {0.0, 0.0, 0.0, 0.0};
+  std::array<double, 4> levelset_edge_vector = {0.0, 0.0, 0.0, 0.0};
 
   // edges for 2D and 3D case
   if constexpr (CC::DIM() != Dimension::One) {
@@ -188,7 +188,6 @@ void GetLevelsetAtSubcellCorners(
         subcell_corner_levelset[1][2 * s][2 * t] =
             0.25 * (std::accumulate(levelset_edge_vector.begin(),
                                     levelset_edge_vector.end(), 0.0));
-        levelset_edge_vector.clear();
       }
     }
 
@@ -207,7 +206,6 @@ void GetLevelsetAtSubcellCorners(
         subcell_corner_levelset[2 * r][1][2 * t] =
             0.25 * (std::accumulate(levelset_edge_vector.begin(),
                                     levelset_edge_vector.end(), 0.0));
-        levelset_edge_vector.clear();
       }
     }
   }
@@ -231,12 +229,11 @@ void GetLevelsetAtSubcellCorners(
         subcell_corner_levelset[2 * r][2 * s][1] =
             0.25 * (std::accumulate(levelset_edge_vector.begin(),
                                     levelset_edge_vector.end(), 0.0));
-        levelset_edge_vector.clear();
       }
     }
 
     // Calculation of patches
-    std::vector<double> levelset_patch_vector;
+    std::array<double, 2> levelset_patch_vector;
 
     for (unsigned int r = 0; r < rmax; ++r) {
 
@@ -246,7 +243,6 @@ void GetLevelsetAtSubcellCorners(
       subcell_corner_levelset[2 * r][1][1] =
           0.5 * (std::accumulate(levelset_patch_vector.begin(),
                                  levelset_patch_vector.end(), 0.0));
-      levelset_patch_vector.clear();
 
       levelset_patch_vector = {levelset[i][j - 1 + r][k],
                                levelset[i][j + r][k]};
@@ -254,7 +250,6 @@ void GetLevelsetAtSubcellCorners(
       subcell_corner_levelset[1][2 * r][1] =
           0.5 * (std::accumulate(levelset_patch_vector.begin(),
                                  levelset_patch_vector.end(), 0.0));
-      levelset_patch_vector.clear();
 
       levelset_patch_vector = {levelset[i][j][k - 1 + r],
                                levelset[i][j][k + r]};
@@ -262,7 +257,6 @@ void GetLevelsetAtSubcellCorners(
       subcell_corner_levelset[1][1][2 * r] =
           0.5 * (std::accumulate(levelset_patch_vector.begin(),
                                  levelset_patch_vector.end(), 0.0));
-      levelset_patch_vector.clear();
     }
   }
 }
@@ -395,6 +389,43 @@ GetNormal(double const (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()],
   return normal;
 }
 
+/**
+ * @brief Computes the interface curvature of a single cut cell from height
+ * functions of the reinitialized volume fraction. The curvature is limited like
+ * the level-set based one ( see ComputeInterfaceCurvature ).
+ * @param node The node containing the cut cell.
+ * @param i,j,k The indices of the cut cell.
+ * @param normal The interface normal of the cut cell.
+ * @param curvature The curvature. Indirect return parameter, only set if the
+ * heights are well defined.
+ * @return True if the heights are well defined, false otherwise.
+ */
+bool ComputeHeightFunctionInterfaceCurvature(
+    Node const &node, unsigned int const i, unsigned int const j,
+    unsigned int const k, std::array<double, 3> const &normal,
+    double &curvature) {
+  double const(&volume_fraction)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      node.GetInterfaceBlock().GetReinitializedBuffer(
+          InterfaceDescription::VolumeFraction);
+  double cell_curvature = 0.0;
+  if (!ComputeHeightFunctionCurvature(volume_fraction, normal, i, j, k,
+                                      cell_curvature)) {
+    return false;
+  }
+
+  double const cell_size = node.GetCellSize();
+  cell_curvature /= cell_size;
+  if (CC::Axisymmetric()) {
+    double const radius = std::get<0>(node.GetBlockCoordinates()) +
+                          (double(i) - double(CC::FICX()) + 0.5) * cell_size;
+    cell_curvature += normal[0] / radius;
+  }
+
+  curvature = Sign(cell_curvature) *
+              std::min(std::abs(cell_curvature), 1.0 / cell_size);
+  return true;
+}
+
 /**
  * @brief Computes the interface curvature and stores it in the curvature
  * buffer.
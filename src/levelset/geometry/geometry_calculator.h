@@ -98,6 +98,11 @@ bool IsCutCell(double const (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()],
 void ComputeInterfaceCurvature(
     Node const &node, double (&curvature)[CC::TCX()][CC::TCY()][CC::TCZ()]);
 
+bool ComputeHeightFunctionInterfaceCurvature(
+    Node const &node, unsigned int const i, unsigned int const j,
+    unsigned int const k, std::array<double, 3> const &normal,
+    double &curvature);
+
 void GetLevelsetAtSubcellCorners(
     double (&subcell_corner_levelset)[subcell_box_size_x][subcell_box_size_y]
                                      [subcell_box_size_z],
@@ -23,9 +23,7 @@
 #include "utilities/mathematical_functions.h"
 
 #include <algorithm>
-#include <bitset>
 #include <cmath>
-#include <functional>
 #include <numeric>
 
 namespace {
@@ -106,14 +104,15 @@ constexpr double AperturePPPP(std::array<double, 4> const) { // 15
 }
 
 /**
- * @brief Function lookup table for aperture calculation.
+ * @brief Function lookup table for aperture calculation. The table is indexed
+ * by the bit mask of the positive corners of the face.
  */
-std::array<std::function<double(std::array<double, 4> const)>, 16>
-    ApertureFunctionLookup = {
-        ApertureMMMM, AperturePMMM, ApertureMPMM, AperturePPMM,
-        ApertureMMPM, AperturePMPM, ApertureMPPM, AperturePPPM,
-        ApertureMMMP, AperturePMMP, ApertureMPMP, AperturePPMP,
-        ApertureMMPP, AperturePMPP, ApertureMPPP, AperturePPPP};
+using ApertureFunction = double (*)(std::array<double, 4> const);
+constexpr std::array<ApertureFunction, 16> ApertureFunctionLookup = {
+    ApertureMMMM, AperturePMMM, ApertureMPMM, AperturePPMM,
+    ApertureMMPM, AperturePMPM, ApertureMPPM, AperturePPPM,
+    ApertureMMMP, AperturePMMP, ApertureMPMP, AperturePPMP,
+    ApertureMMPP, AperturePMPP, ApertureMPPP, AperturePPPP};
 
 /**
  * @brief Calculates the aperture of a single cell patch from the level-set
@@ -122,12 +121,52 @@ std::array<std::function<double(std::array<double, 4> const)>, 16>
  * @return Cell-face aperture.
  */
 double CellFaceAperture(std::array<double, 4> const face) {
+  unsigned int const positive_corners =
+      static_cast<unsigned int>(face[0] > 0.0) |
+      static_cast<unsigned int>(face[1] > 0.0) << 1 |
+      static_cast<unsigned int>(face[2] > 0.0) << 2 |
+      static_cast<unsigned int>(face[3] > 0.0) << 3;
+  return ApertureFunctionLookup[positive_corners](face);
+}
+
+/**
+ * @brief Sums up the first values of an array in increasing order to decrease
+ * floating point errors.
+ * @param values The values to be summed up.
+ * @param size The number of values which are considered.
+ * @return The sum.
+ */
+template <std::size_t N>
+double SortedSum(std::array<double, N> values, unsigned int const size) {
+  std::sort(values.begin(), values.begin() + size);
+  return std::accumulate(values.begin(), values.begin() + size, 0.0);
+}
 
-  std::bitset<4> positive_corners;
-  for (unsigned int b = 0; b < 4; ++b) {
-    positive_corners.set(b, face[b] > 0.0);
+/**
+ * @brief Classifies the level-set values at the subcell corners of a cell by
+ * their signs. Cells without a sign change have trivial geometric quantities.
+ * @param levelset_cube The level-set values at the subcell corners.
+ * @return 1 if all corners are positive, -1 if no corner is positive and 0 if
+ * the cell is cut by the interface.
+ */
+int ClassifySubcellCorners(
+    double const (&levelset_cube)[subcell_box_size_x][subcell_box_size_y]
+                                 [subcell_box_size_z]) {
+  unsigned int number_of_positive_corners = 0;
+  for (unsigned int r = 0; r < subcell_box_size_x; ++r) {
+    for (unsigned int s = 0; s < subcell_box_size_y; ++s) {
+      for (unsigned int t = 0; t < subcell_box_size_z; ++t) {
+        number_of_positive_corners +=
+            static_cast<unsigned int>(levelset_cube[r][s][t] > 0.0);
+      }
+    }
+  }
+  constexpr unsigned int number_of_corners =
+      subcell_box_size_x * subcell_box_size_y * subcell_box_size_z;
+  if (number_of_positive_corners == number_of_corners) {
+    return 1;
   }
-  return ApertureFunctionLookup[positive_corners.to_ulong()](face);
+  return number_of_positive_corners == 0 ? -1 : 0;
 }
 
 /**
@@ -292,6 +331,18 @@ std::array<double, 6> ComputeCellFaceApertureSubCellBasedImplementation(
   // these subcells by linear interpolation
   GetLevelsetAtSubcellCorners(levelset_cube, levelset, i, j, k);
 
+  // faces of cells without sign change are either fully open or closed
+  int const corner_signs = ClassifySubcellCorners(levelset_cube);
+  if (corner_signs != 0) {
+    double const aperture =
+        (corner_signs > 0) == (material_sign > 0) ? 1.0 : 0.0;
+    double const padding = material_sign < 0 ? 1.0 : 0.0;
+    std::array<double, 6> cell_apertures = {padding, padding, padding,
+                                            padding, padding, padding};
+    std::fill_n(cell_apertures.begin(), 2 * DTI(CC::DIM()), aperture);
+    return cell_apertures;
+  }
+
   unsigned int r = 0;
   unsigned int s = 0;
   unsigned int t = 0;
@@ -306,7 +357,8 @@ std::array<double, 6> ComputeCellFaceApertureSubCellBasedImplementation(
                                 ? 0.25
                                 : (CC::DIM() != Dimension::One ? 0.5 : 1.0);
 
-  std::vector<double> subcell_apertures;
+  std::array<double, 4> subcell_apertures = {0.0, 0.0, 0.0, 0.0};
+  unsigned int number_of_subcell_apertures = 0;
   std::array<double, 6> cell_apertures = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
   std::array<double, 4> faces = {0.0, 0.0, 0.0, 0.0};
 
@@ -319,16 +371,15 @@ std::array<double, 6> ComputeCellFaceApertureSubCellBasedImplementation(
       faces[1] = levelset_cube[r][s + s_offset][t];
       faces[2] = levelset_cube[r][s + s_offset][t + t_offset];
       faces[3] = levelset_cube[r][s][t + t_offset];
-      subcell_apertures.emplace_back(CellFaceAperture(faces));
+      subcell_apertures[number_of_subcell_apertures++] =
+          CellFaceAperture(faces);
     }
   }
   // apertures are computed on the subcells and then averaged. Reorder by size
   // to decrease floating point errors.
-  std::sort(subcell_apertures.begin(), subcell_apertures.end());
   cell_apertures[0] =
-      multiplier * (std::accumulate(subcell_apertures.begin(),
-                                    subcell_apertures.end(), 0.0));
-  subcell_apertures.clear();
+      multiplier * SortedSum(subcell_apertures, number_of_subcell_apertures);
+  number_of_subcell_apertures = 0;
 
   // face (i+1/2,j,k)
   r = r_max;
@@ -338,14 +389,13 @@ std::array<double, 6> ComputeCellFaceApertureSubCellBasedImplementation(
       faces[1] = levelset_cube[r][s + s_offset][t];
       faces[2] = levelset_cube[r][s + s_offset][t + t_offset];
       faces[3] = levelset_cube[r][s][t + t_offset];
-      subcell_apertures.emplace_back(CellFaceAperture(faces));
+      subcell_apertures[number_of_subcell_apertures++] =
+          CellFaceAperture(faces);
     }
   }
-  std::sort(subcell_apertures.begin(), subcell_apertures.end());
   cell_apertures[1] =
-      multiplier * (std::accumulate(subcell_apertures.begin(),
-                                    subcell_apertures.end(), 0.0));
-  subcell_apertures.clear();
+      multiplier * SortedSum(subcell_apertures, number_of_subcell_apertures);
+  number_of_subcell_apertures = 0;
 
   // only needed in 2D/3D
   if constexpr (CC::DIM() != Dimension::One) {
@@ -357,14 +407,13 @@ std::array<double, 6> ComputeCellFaceApertureSubCellBasedImplementation(
         faces[1] = levelset_cube[r + r_offset][s][t];
         faces[2] = levelset_cube[r + r_offset][s][t + t_offset];
         faces[3] = levelset_cube[r][s][t + t_offset];
-        subcell_apertures.emplace_back(CellFaceAperture(faces));
+        subcell_apertures[number_of_subcell_apertures++] =
+            CellFaceAperture(faces);
       }
     }
-    std::sort(subcell_apertures.begin(), subcell_apertures.end());
     cell_apertures[2] =
-        multiplier * (std::accumulate(subcell_apertures.begin(),
-                                      subcell_apertures.end(), 0.0));
-    subcell_apertures.clear();
+        multiplier * SortedSum(subcell_apertures, number_of_subcell_apertures);
+    number_of_subcell_apertures = 0;
 
     // face (i,j+1/2,k)
     s = s_max;
@@ -374,14 +423,13 @@ std::array<double, 6> ComputeCellFaceApertureSubCellBasedImplementation(
         faces[1] = levelset_cube[r + r_offset][s][t];
         faces[2] = levelset_cube[r + r_offset][s][t + t_offset];
         faces[3] = levelset_cube[r][s][t + t_offset];
-        subcell_apertures.emplace_back(CellFaceAperture(faces));
+        subcell_apertures[number_of_subcell_apertures++] =
+            CellFaceAperture(faces);
       }
     }
-    std::sort(subcell_apertures.begin(), subcell_apertures.end());
     cell_apertures[3] =
-        multiplier * (std::accumulate(subcell_apertures.begin(),
-                                      subcell_apertures.end(), 0.0));
-    subcell_apertures.clear();
+        multiplier * SortedSum(subcell_apertures, number_of_subcell_apertures);
+    number_of_subcell_apertures = 0;
   } else {
     // pad with 0.0 to length 6
     cell_apertures[2] = 0.0;
@@ -398,14 +446,13 @@ std::array<double, 6> ComputeCellFaceApertureSubCellBasedImplementation(
         faces[1] = levelset_cube[r + r_offset][s][t];
         faces[2] = levelset_cube[r + r_offset][s + s_offset][t];
         faces[3] = levelset_cube[r][s + s_offset][t];
-        subcell_apertures.emplace_back(CellFaceAperture(faces));
+        subcell_apertures[number_of_subcell_apertures++] =
+            CellFaceAperture(faces);
       }
     }
-    std::sort(subcell_apertures.begin(), subcell_apertures.end());
     cell_apertures[4] =
-        multiplier * (std::accumulate(subcell_apertures.begin(),
-                                      subcell_apertures.end(), 0.0));
-    subcell_apertures.clear();
+        multiplier * SortedSum(subcell_apertures, number_of_subcell_apertures);
+    number_of_subcell_apertures = 0;
 
     // face (i,j,k+1/2)
     t = t_max;
@@ -415,14 +462,13 @@ std::array<double, 6> ComputeCellFaceApertureSubCellBasedImplementation(
         faces[1] = levelset_cube[r + r_offset][s][t];
         faces[2] = levelset_cube[r + r_offset][s + s_offset][t];
         faces[3] = levelset_cube[r][s + s_offset][t];
-        subcell_apertures.emplace_back(CellFaceAperture(faces));
+        subcell_apertures[number_of_subcell_apertures++] =
+            CellFaceAperture(faces);
       }
     }
-    std::sort(subcell_apertures.begin(), subcell_apertures.end());
     cell_apertures[5] =
-        multiplier * (std::accumulate(subcell_apertures.begin(),
-                                      subcell_apertures.end(), 0.0));
-    subcell_apertures.clear();
+        multiplier * SortedSum(subcell_apertures, number_of_subcell_apertures);
+    number_of_subcell_apertures = 0;
 
   } else {
     // pad with 0.0 to length 6
@@ -522,17 +568,17 @@ double ComputeVolumeFractionCellBasedImplementation(
   // the full algorithm is only required for 3D simulations
   if constexpr (CC::DIM() == Dimension::Three) {
 
-    std::vector<double> corner_values;
+    std::array<double, 8> corner_values;
+    unsigned int number_of_corner_values = 0;
     for (unsigned int r = 0; r < cell_box_size_x; ++r) {
       for (unsigned int s = 0; s < cell_box_size_y; ++s) {
         for (unsigned int t = 0; t < cell_box_size_z; ++t) {
-          corner_values.push_back(cell_levelset_cube[r][s][t]);
+          corner_values[number_of_corner_values++] =
+              cell_levelset_cube[r][s][t];
         }
       }
     }
-    std::sort(corner_values.begin(), corner_values.end());
-    levelset_center = 0.125 * (std::accumulate(corner_values.begin(),
-                                               corner_values.end(), 0.0));
+    levelset_center = 0.125 * SortedSum(corner_values, number_of_corner_values);
 
     temp_i = (A12 - A11);
     temp_j = (A22 - A21);
@@ -588,6 +634,12 @@ double ComputeVolumeFractionSubCellBasedImplementation(
 
   GetLevelsetAtSubcellCorners(levelset_cube, levelset, i, j, k);
 
+  // cells without sign change are either fully filled or empty
+  int const corner_signs = ClassifySubcellCorners(levelset_cube);
+  if (corner_signs != 0) {
+    return (corner_signs > 0) == (material_sign > 0) ? 1.0 : 0.0;
+  }
+
   unsigned int r = 0;
   unsigned int s = 0;
   unsigned int t = 0;
@@ -614,8 +666,10 @@ double ComputeVolumeFractionSubCellBasedImplementation(
   unsigned int const t_offset = CC::DIM() == Dimension::Three ? 1 : 0;
 
   std::array<double, 4> faces = {0.0, 0.0, 0.0, 0.0};
-  std::vector<double> subvolume_fraction_vector;
-  std::vector<double> corner_values;
+  std::array<double, 8> subvolume_fractions;
+  unsigned int number_of_subvolume_fractions = 0;
+  std::array<double, 8> corner_values;
+  unsigned int number_of_corner_values = 0;
 
   constexpr double one_third = 1.0 / 3.0;
 
@@ -695,14 +749,14 @@ double ComputeVolumeFractionSubCellBasedImplementation(
           for (unsigned int o = 0; o < r_max; ++o) {
             for (unsigned int p = 0; p < s_max; ++p) {
               for (unsigned int q = 0; q < t_max; ++q) {
-                corner_values.emplace_back(levelset_cube[l + o][m + p][n + q]);
+                corner_values[number_of_corner_values++] =
+                    levelset_cube[l + o][m + p][n + q];
               }
             }
           }
-          std::sort(corner_values.begin(), corner_values.end());
-          levelset_center = 0.125 * (std::accumulate(corner_values.begin(),
-                                                     corner_values.end(), 0.0));
-          corner_values.clear();
+          levelset_center =
+              0.125 * SortedSum(corner_values, number_of_corner_values);
+          number_of_corner_values = 0;
 
           temp_i = ((A12 - A11) * 0.25);
           temp_j = ((A22 - A21) * 0.25);
@@ -727,7 +781,8 @@ double ComputeVolumeFractionSubCellBasedImplementation(
         subvolume_fraction = std::min(subvolume_fraction, 1.0);
         subvolume_fraction = std::max(subvolume_fraction, 0.0);
 
-        subvolume_fraction_vector.emplace_back(subvolume_fraction);
+        subvolume_fractions[number_of_subvolume_fractions++] =
+            subvolume_fraction;
       }
     }
   }
@@ -737,10 +792,9 @@ double ComputeVolumeFractionSubCellBasedImplementation(
                                 ? 0.125
                                 : (CC::DIM() != Dimension::One ? 0.25 : 0.5);
 
-  std::sort(subvolume_fraction_vector.begin(), subvolume_fraction_vector.end());
-  double volume_fraction =
-      multiplier * (std::accumulate(subvolume_fraction_vector.begin(),
-                                    subvolume_fraction_vector.end(), 0.0));
+  double const volume_fraction =
+      multiplier *
+      SortedSum(subvolume_fractions, number_of_subvolume_fractions);
 
   return material_sign > 0 ? volume_fraction : 1.0 - volume_fraction;
 }
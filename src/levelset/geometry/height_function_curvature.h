@@ -0,0 +1,137 @@
+//===-------------------- height_function_curvature.h ---------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef HEIGHT_FUNCTION_CURVATURE_H
+#define HEIGHT_FUNCTION_CURVATURE_H
+
+#include "user_specifications/compile_time_constants.h"
+#include <array>
+#include <cmath>
+
+namespace HeightFunctionCurvature {
+/**
+ * @brief Number of cells a height column extends to each side of the cut cell.
+ */
+constexpr int ColumnHalfLength = 3;
+
+/**
+ * @brief Tolerance on the volume fraction of the cells at both ends of a column
+ * to be considered empty or full.
+ */
+constexpr double EndCellTolerance = 1.0e-8;
+
+static_assert(CC::HS() >= ColumnHalfLength,
+              "Halo size not enough to compute the height-function curvature. "
+              "Increase the halo size in compile_time_constants.h or use the "
+              "level-set curvature estimator!");
+} // namespace HeightFunctionCurvature
+
+/**
+ * @brief Computes the interface curvature in a cut cell from height functions
+ * of the volume fraction, see \cite Cummins2005. The heights are the column
+ * sums of the volume fraction along the coordinate direction closest to the
+ * interface normal on a 3 x 7 ( 2D ) or 3 x 3 x 7 ( 3D ) stencil. The
+ * curvature is the divergence of the interface normal pointing into the
+ * positive material, i.e. it has the sign convention of the level-set based
+ * curvature.
+ * @param volume_fraction The volume fraction of the positive material.
+ * @param normal The interface normal pointing into the positive material.
+ * @param i,j,k The indices of the cut cell.
+ * @param curvature The curvature in units of one over the cell size. Indirect
+ * return parameter, only set if the heights are well defined.
+ * @return True if all columns start in one material and end in the other, i.e.
+ * the heights are well defined, false otherwise.
+ */
+inline bool ComputeHeightFunctionCurvature(
+    double const (&volume_fraction)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    std::array<double, 3> const &normal, unsigned int const i,
+    unsigned int const j, unsigned int const k, double &curvature) {
+
+  if constexpr (CC::DIM() == Dimension::One) {
+    return false;
+  }
+
+  // the height direction is the one closest to the interface normal
+  unsigned int height_direction = 0;
+  for (unsigned int d = 1; d < DTI(CC::DIM()); ++d) {
+    if (std::abs(normal[d]) > std::abs(normal[height_direction])) {
+      height_direction = d;
+    }
+  }
+  std::array<unsigned int, 2> const tangential_directions = {
+      (height_direction + 1) % DTI(CC::DIM()),
+      (height_direction + 2) % DTI(CC::DIM())};
+  // cells in the normal direction belong to the positive material
+  int const positive_end = normal[height_direction] > 0.0
+                               ? HeightFunctionCurvature::ColumnHalfLength
+                               : -HeightFunctionCurvature::ColumnHalfLength;
+
+  constexpr int tangential_offsets_y = CC::DIM() == Dimension::Three ? 1 : 0;
+  double heights[3][3] = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+  for (int a = -1; a <= 1; ++a) {
+    for (int b = -tangential_offsets_y; b <= tangential_offsets_y; ++b) {
+      std::array<int, 3> column = {int(i), int(j), int(k)};
+      column[tangential_directions[0]] += a;
+      if constexpr (CC::DIM() == Dimension::Three) {
+        column[tangential_directions[1]] += b;
+      }
+      auto const column_volume_fraction = [&](int const c) {
+        std::array<int, 3> cell = column;
+        cell[height_direction] += c;
+        return volume_fraction[cell[0]][cell[1]][cell[2]];
+      };
+      if (column_volume_fraction(positive_end) <
+              1.0 - HeightFunctionCurvature::EndCellTolerance ||
+          column_volume_fraction(-positive_end) >
+              HeightFunctionCurvature::EndCellTolerance) {
+        return false;
+      }
+      double height = 0.0;
+      for (int c = -HeightFunctionCurvature::ColumnHalfLength;
+           c <= HeightFunctionCurvature::ColumnHalfLength; ++c) {
+        height += column_volume_fraction(c);
+      }
+      heights[a + 1][b + 1] = height;
+    } // b
+  }   // a
+
+  // derivatives of the height in units of the cell size
+  double const h_x = 0.5 * (heights[2][1] - heights[0][1]);
+  double const h_xx = heights[2][1] - 2.0 * heights[1][1] + heights[0][1];
+  double const h_y = CC::DIM() == Dimension::Three
+                         ? 0.5 * (heights[1][2] - heights[1][0])
+                         : 0.0;
+  double const h_yy = CC::DIM() == Dimension::Three
+                          ? heights[1][2] - 2.0 * heights[1][1] + heights[1][0]
+                          : 0.0;
+  double const h_xy = CC::DIM() == Dimension::Three
+                          ? 0.25 * (heights[2][2] - heights[2][0] -
+                                    heights[0][2] + heights[0][0])
+                          : 0.0;
+
+  double const denominator = 1.0 + h_x * h_x + h_y * h_y;
+  curvature = (h_xx * (1.0 + h_y * h_y) + h_yy * (1.0 + h_x * h_x) -
+               2.0 * h_x * h_y * h_xy) /
+              (denominator * std::sqrt(denominator));
+  return true;
+}
+
+#endif // HEIGHT_FUNCTION_CURVATURE_H
@@ -40,8 +40,6 @@ void DerivativeStencilSingleLevelsetAdvector::AdvectImplementation(
   double const cell_size = node.GetCellSize();
   double const one_cell_size = 1.0 / cell_size;
 
-  std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
   double const(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       interface_block.GetBaseBuffer(InterfaceDescription::Levelset);
   double const(&levelset_reinitialized)[CC::TCX()][CC::TCY()][CC::TCZ()] =
@@ -60,58 +58,40 @@ void DerivativeStencilSingleLevelsetAdvector::AdvectImplementation(
   }
   std::array<double, DTI(CC::DIM())> increments;
 
-  for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-        /***
-         * In order to calculate the right-hand side for the level-set advection
-         * in the 2nd RK stage we need reasonable level-set values in the whole
-         * extension band. Thus, it is necessary to calculate level-set
-         * advection rhs values for the extension band.
-         */
-        if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::ExtensionBand)) {
+  // The right-hand side is only needed within the extension band, see
+  // LevelsetAdvector::AdvectedCells
+  for (auto const &[i, j, k] : AdvectedCells(node)) {
+    // Calculate normal to determine x-,y- and z-component of
+    // interface_velocity
+    std::array<double, 3> const normal =
+        GetNormal(levelset_reinitialized, i, j, k);
 
-          // Calculate normal to determine x-,y- and z-component of
-          // interface_velocity
-          std::array<double, 3> const normal =
-              GetNormal(levelset_reinitialized, i, j, k);
+    double const u_interface = interface_velocity[i][j][k] * one_cell_size;
 
-          double const u_interface =
-              interface_velocity[i][j][k] * one_cell_size;
+    interface_velocity_projection[0] = u_interface * normal[0];
+    levelset_derivative[0] =
+        SU::ReconstructionWithUpwinding<DerivativeStencil, Direction::X>(
+            levelset, i, j, k, interface_velocity_projection[0], cell_size);
+    increments[0] = -interface_velocity_projection[0] * levelset_derivative[0];
 
-          interface_velocity_projection[0] = u_interface * normal[0];
-          levelset_derivative[0] =
-              SU::ReconstructionWithUpwinding<DerivativeStencil, Direction::X>(
-                  levelset, i, j, k, interface_velocity_projection[0],
-                  cell_size);
-          increments[0] =
-              -interface_velocity_projection[0] * levelset_derivative[0];
+    if constexpr (CC::DIM() != Dimension::One) {
+      interface_velocity_projection[1] = u_interface * normal[1];
+      levelset_derivative[1] =
+          SU::ReconstructionWithUpwinding<DerivativeStencil, Direction::Y>(
+              levelset, i, j, k, interface_velocity_projection[1], cell_size);
+      increments[1] =
+          -interface_velocity_projection[1] * levelset_derivative[1];
+    }
 
-          if constexpr (CC::DIM() != Dimension::One) {
-            interface_velocity_projection[1] = u_interface * normal[1];
-            levelset_derivative[1] =
-                SU::ReconstructionWithUpwinding<DerivativeStencil,
-                                                Direction::Y>(
-                    levelset, i, j, k, interface_velocity_projection[1],
-                    cell_size);
-            increments[1] =
-                -interface_velocity_projection[1] * levelset_derivative[1];
-          }
+    if constexpr (CC::DIM() == Dimension::Three) {
+      interface_velocity_projection[2] = u_interface * normal[2];
+      levelset_derivative[2] =
+          SU::ReconstructionWithUpwinding<DerivativeStencil, Direction::Z>(
+              levelset, i, j, k, interface_velocity_projection[2], cell_size);
+      increments[2] =
+          -interface_velocity_projection[2] * levelset_derivative[2];
+    }
 
-          if constexpr (CC::DIM() == Dimension::Three) {
-            interface_velocity_projection[2] = u_interface * normal[2];
-            levelset_derivative[2] =
-                SU::ReconstructionWithUpwinding<DerivativeStencil,
-                                                Direction::Z>(
-                    levelset, i, j, k, interface_velocity_projection[2],
-                    cell_size);
-            increments[2] =
-                -interface_velocity_projection[2] * levelset_derivative[2];
-          }
-
-          levelset_rhs[i][j][k] = ConsistencyManagedSum(increments);
-        }
-      } // i
-    }   // j
-  }     // k
+    levelset_rhs[i][j][k] = ConsistencyManagedSum(increments);
+  } // cells
 }
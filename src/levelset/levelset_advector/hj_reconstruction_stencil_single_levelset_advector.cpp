@@ -21,7 +21,6 @@
 //===----------------------------------------------------------------------===//
 #include "hj_reconstruction_stencil_single_levelset_advector.h"
 
-#include "enums/interface_tag_definition.h"
 #include "stencils/stencil_utilities.h"
 #include "utilities/mathematical_functions.h"
 
@@ -43,8 +42,6 @@ void HjReconstructionStencilSingleLevelsetAdvector::AdvectImplementation(
   double const cell_size = node.GetCellSize();
   double const one_cell_size = 1.0 / cell_size;
 
-  std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
   double const(&levelset_reinitialized)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       interface_block.GetReinitializedBuffer(InterfaceDescription::Levelset);
   double(&levelset_rhs)[CC::TCX()][CC::TCY()][CC::TCZ()] =
@@ -60,53 +57,40 @@ void HjReconstructionStencilSingleLevelsetAdvector::AdvectImplementation(
     }
   }
 
-  for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-        /***
-         * In order to calculate the right-hand side for the level-set advection
-         * in the 2nd RK stage we need reasonable level-set values in the whole
-         * extension band. Thus, it is necessary to calculate level-set
-         * advection rhs values for the extension band.
-         */
-        if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::ExtensionBand)) {
+  // The right-hand side is only needed within the extension band, see
+  // LevelsetAdvector::AdvectedCells
+  for (auto const &[i, j, k] : AdvectedCells(node)) {
+    double const u_interface = interface_velocity[i][j][k] * one_cell_size;
 
-          double const u_interface =
-              interface_velocity[i][j][k] * one_cell_size;
+    derivatives[0][0] =
+        SU::Derivative<ReconstructionStencil, SP::UpwindLeft, Direction::X>(
+            levelset_reinitialized, i, j, k, 1.0);
+    derivatives[0][1] =
+        SU::Derivative<ReconstructionStencil, SP::UpwindRight, Direction::X>(
+            levelset_reinitialized, i, j, k, 1.0);
 
-          derivatives[0][0] = SU::Derivative<ReconstructionStencil,
-                                             SP::UpwindLeft, Direction::X>(
+    if constexpr (CC::DIM() != Dimension::One) {
+      derivatives[1][0] =
+          SU::Derivative<ReconstructionStencil, SP::UpwindLeft, Direction::Y>(
               levelset_reinitialized, i, j, k, 1.0);
-          derivatives[0][1] = SU::Derivative<ReconstructionStencil,
-                                             SP::UpwindRight, Direction::X>(
+      derivatives[1][1] =
+          SU::Derivative<ReconstructionStencil, SP::UpwindRight, Direction::Y>(
               levelset_reinitialized, i, j, k, 1.0);
+    }
 
-          if constexpr (CC::DIM() != Dimension::One) {
-            derivatives[1][0] = SU::Derivative<ReconstructionStencil,
-                                               SP::UpwindLeft, Direction::Y>(
-                levelset_reinitialized, i, j, k, 1.0);
-            derivatives[1][1] = SU::Derivative<ReconstructionStencil,
-                                               SP::UpwindRight, Direction::Y>(
-                levelset_reinitialized, i, j, k, 1.0);
-          }
-
-          if constexpr (CC::DIM() == Dimension::Three) {
-            derivatives[2][0] = SU::Derivative<ReconstructionStencil,
-                                               SP::UpwindLeft, Direction::Z>(
-                levelset_reinitialized, i, j, k, 1.0);
-            derivatives[2][1] = SU::Derivative<ReconstructionStencil,
-                                               SP::UpwindRight, Direction::Z>(
-                levelset_reinitialized, i, j, k, 1.0);
-          }
+    if constexpr (CC::DIM() == Dimension::Three) {
+      derivatives[2][0] =
+          SU::Derivative<ReconstructionStencil, SP::UpwindLeft, Direction::Z>(
+              levelset_reinitialized, i, j, k, 1.0);
+      derivatives[2][1] =
+          SU::Derivative<ReconstructionStencil, SP::UpwindRight, Direction::Z>(
+              levelset_reinitialized, i, j, k, 1.0);
+    }
 
-          double const old_levelset_sign =
-              Signum(levelset_reinitialized[i][j][k]);
-          double const godunov_hamiltonian =
-              GodunovHamiltonian(derivatives, old_levelset_sign);
+    double const old_levelset_sign = Signum(levelset_reinitialized[i][j][k]);
+    double const godunov_hamiltonian =
+        GodunovHamiltonian(derivatives, old_levelset_sign);
 
-          levelset_rhs[i][j][k] = -u_interface * godunov_hamiltonian;
-        }
-      } // i
-    }   // j
-  }     // k
+    levelset_rhs[i][j][k] = -u_interface * godunov_hamiltonian;
+  } // cells
 }
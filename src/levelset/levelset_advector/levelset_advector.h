@@ -22,10 +22,15 @@
 #ifndef LEVELSET_ADVECTOR_H
 #define LEVELSET_ADVECTOR_H
 
+#include "enums/interface_tag_definition.h"
 #include "levelset/geometry/geometry_calculator_marching_cubes.h"
 #include "topology/node.h"
 #include "user_specifications/numerical_setup.h"
 
+#include <array>
+#include <cstdlib>
+#include <vector>
+
 /**
  * @brief Provides functionality to propagate a level-set field in time by using
  * a predefined stencil.
@@ -35,6 +40,35 @@ template <typename DerivedLevelsetAdvector> class LevelsetAdvector {
 
   friend DerivedLevelsetAdvector;
 
+  /**
+   * @brief Collects the internal cells of a node whose level-set right-hand
+   * side is computed. In order to calculate the right-hand side for the
+   * level-set advection in the 2nd RK stage we need reasonable level-set values
+   * in the whole extension band. Beyond it the level set is cut off by the
+   * reinitialization, hence, the remaining cells are skipped. The stencils
+   * read up to the reinitialization band, which encloses the extension band.
+   * @param node The node for which the level-set field is propagated in time.
+   * @return Indices of the cells in memory order. The list is reused by the
+   * next call on the same thread.
+   */
+  static std::vector<std::array<unsigned int, 3>> const &
+  AdvectedCells(Node &node) {
+    thread_local std::vector<std::array<unsigned int, 3>> cells;
+    std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
+    cells.clear();
+    for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+      for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+        for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+          if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::ExtensionBand)) {
+            cells.push_back({i, j, k});
+          }
+        } // k
+      }   // j
+    }     // i
+    return cells;
+  }
+
 public:
   // Private constructor only
   ~LevelsetAdvector() = default;
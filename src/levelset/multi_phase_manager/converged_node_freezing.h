@@ -0,0 +1,88 @@
+//===--------------------- converged_node_freezing.h ----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef CONVERGED_NODE_FREEZING_H
+#define CONVERGED_NODE_FREEZING_H
+
+#include "topology/node_id_type.h"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Bookkeeping for iterative methods on the finest level which stop
+ * iterating nodes that converged. Skipping a node is only exact if its halos do
+ * not change anymore, i.e. if all nodes its halos are filled from are skipped
+ * as well.
+ */
+namespace ConvergedNodeFreezing {
+
+/**
+ * @brief Determines the nodes which are no longer iterated. A node is frozen
+ * if it converged, has no halos exchanged via MPI and all nodes its halos are
+ * filled from are frozen as well. Hence, neither the node nor its halos
+ * change in further iterations.
+ * @param node_residuum The residuum of each node in its last iteration.
+ * @param maximum_residuum The residuum below which a node is converged.
+ * @param ids The ids of the nodes.
+ * @param neighbors For each node the indices of the nodes its halos are
+ * filled from.
+ * @param has_mpi_boundary For each node whether one of its halos is exchanged
+ * via MPI.
+ * @param frozen For each node whether it is frozen (indirect return
+ * parameter).
+ * @param frozen_ids Sorted ids of the frozen nodes (indirect return
+ * parameter).
+ */
+inline void
+UpdateFrozenNodes(std::vector<double> const &node_residuum,
+                  double const maximum_residuum, std::vector<nid_t> const &ids,
+                  std::vector<std::vector<std::size_t>> const &neighbors,
+                  std::vector<bool> const &has_mpi_boundary,
+                  std::vector<bool> &frozen, std::vector<nid_t> &frozen_ids) {
+  for (std::size_t n = 0; n < frozen.size(); ++n) {
+    frozen[n] = node_residuum[n] < maximum_residuum && !has_mpi_boundary[n];
+  }
+  // Unfreeze nodes next to active ones until no further node is affected
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (std::size_t n = 0; n < frozen.size(); ++n) {
+      if (frozen[n] &&
+          std::any_of(neighbors[n].begin(), neighbors[n].end(),
+                      [&frozen](std::size_t const m) { return !frozen[m]; })) {
+        frozen[n] = false;
+        changed = true;
+      }
+    }
+  }
+  frozen_ids.clear();
+  for (std::size_t n = 0; n < frozen.size(); ++n) {
+    if (frozen[n]) {
+      frozen_ids.push_back(ids[n]);
+    }
+  }
+  std::sort(frozen_ids.begin(), frozen_ids.end());
+}
+
+} // namespace ConvergedNodeFreezing
+
+#endif // CONVERGED_NODE_FREEZING_H
@@ -106,203 +106,201 @@ void ApertureCutCellMixer::CalculateMixingContributionsImplementation(
             }
           };
 
-  for (unsigned int i = FICMOX; i <= LICPOX; ++i) {
-    for (unsigned int j = FICMOY; j <= LICPOY; ++j) {
-      for (unsigned int k = FICMOZ; k <= LICPOZ; ++k) {
-        // reset variables to prepare the calculations for the next cell
-        mixing_indices.clear();
-        mixing_flux_factors.clear();
-        beta_sum = 0.0;
-        mixing_for_cell_active = false;
+  std::vector<std::array<unsigned int, 3>> cut_cells;
+  for (std::array<unsigned int, 3> const &cell :
+       node.GetInterfaceBlock().GetCutCellList().Cells(interface_tags,
+                                                       cut_cells)) {
+    unsigned int const i = cell[0];
+    unsigned int const j = cell[1];
+    unsigned int const k = cell[2];
+    // reset variables to prepare the calculations for the next cell
+    mixing_indices.clear();
+    mixing_flux_factors.clear();
+    beta_sum = 0.0;
+    mixing_for_cell_active = false;
 
-        volume_fraction_self = reference_volume_fraction +
-                               material_sign_double * volume_fraction[i][j][k];
-        if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::CutCellNeighbor) &&
-            (volume_fraction_self < CC::MITH() ||
-             levelset[i][j][k] * material_sign < 0)) {
+    volume_fraction_self = reference_volume_fraction +
+                           material_sign_double * volume_fraction[i][j][k];
+    if (volume_fraction_self < CC::MITH() ||
+        levelset[i][j][k] * material_sign < 0) {
 
-          if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::NewCutCell) &&
-              volume_fraction_self != 0.0) {
+      if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::NewCutCell) &&
+          volume_fraction_self != 0.0) {
 
-            std::array<double, 6> const cell_face_apertures =
-                geometry_calculator_.ComputeCellFaceAperture(levelset, i, j, k,
-                                                             material_sign);
+        std::array<double, 6> const cell_face_apertures =
+            geometry_calculator_.ComputeCellFaceAperture(levelset, i, j, k,
+                                                         material_sign);
 
-            // x-1
-            i_target = i - 1;
-            j_target = j;
-            k_target = k;
-            volume_fraction_target =
-                reference_volume_fraction +
-                material_sign_double *
-                    volume_fraction[i_target][j_target][k_target];
-            if (volume_fraction_target > volume_fraction_self) {
-              mixing_fraction = std::abs(cell_face_apertures[0]);
-              create_mixing_contribution(i, j, k);
-            }
+        // x-1
+        i_target = i - 1;
+        j_target = j;
+        k_target = k;
+        volume_fraction_target =
+            reference_volume_fraction +
+            material_sign_double *
+                volume_fraction[i_target][j_target][k_target];
+        if (volume_fraction_target > volume_fraction_self) {
+          mixing_fraction = std::abs(cell_face_apertures[0]);
+          create_mixing_contribution(i, j, k);
+        }
 
-            // x+1
-            i_target = i + 1;
-            j_target = j;
-            k_target = k;
-            volume_fraction_target =
-                reference_volume_fraction +
-                material_sign_double *
-                    volume_fraction[i_target][j_target][k_target];
-            if (volume_fraction_target > volume_fraction_self) {
-              mixing_fraction = std::abs(cell_face_apertures[1]);
-              create_mixing_contribution(i, j, k);
-            }
+        // x+1
+        i_target = i + 1;
+        j_target = j;
+        k_target = k;
+        volume_fraction_target =
+            reference_volume_fraction +
+            material_sign_double *
+                volume_fraction[i_target][j_target][k_target];
+        if (volume_fraction_target > volume_fraction_self) {
+          mixing_fraction = std::abs(cell_face_apertures[1]);
+          create_mixing_contribution(i, j, k);
+        }
 
-            if constexpr (CC::DIM() != Dimension::One) {
-              // y-1
-              i_target = i;
-              j_target = j - 1;
-              k_target = k;
-              volume_fraction_target =
-                  reference_volume_fraction +
-                  material_sign_double *
-                      volume_fraction[i_target][j_target][k_target];
-              if (volume_fraction_target > volume_fraction_self) {
-                mixing_fraction = std::abs(cell_face_apertures[2]);
-                create_mixing_contribution(i, j, k);
-              }
+        if constexpr (CC::DIM() != Dimension::One) {
+          // y-1
+          i_target = i;
+          j_target = j - 1;
+          k_target = k;
+          volume_fraction_target =
+              reference_volume_fraction +
+              material_sign_double *
+                  volume_fraction[i_target][j_target][k_target];
+          if (volume_fraction_target > volume_fraction_self) {
+            mixing_fraction = std::abs(cell_face_apertures[2]);
+            create_mixing_contribution(i, j, k);
+          }
 
-              // y+1
-              i_target = i;
-              j_target = j + 1;
-              k_target = k;
-              volume_fraction_target =
-                  reference_volume_fraction +
-                  material_sign_double *
-                      volume_fraction[i_target][j_target][k_target];
-              if (volume_fraction_target > volume_fraction_self) {
-                mixing_fraction = std::abs(cell_face_apertures[3]);
-                create_mixing_contribution(i, j, k);
-              }
-            }
+          // y+1
+          i_target = i;
+          j_target = j + 1;
+          k_target = k;
+          volume_fraction_target =
+              reference_volume_fraction +
+              material_sign_double *
+                  volume_fraction[i_target][j_target][k_target];
+          if (volume_fraction_target > volume_fraction_self) {
+            mixing_fraction = std::abs(cell_face_apertures[3]);
+            create_mixing_contribution(i, j, k);
+          }
+        }
 
-            if constexpr (CC::DIM() == Dimension::Three) {
-              // z-1
-              i_target = i;
-              j_target = j;
-              k_target = k - 1;
-              volume_fraction_target =
-                  reference_volume_fraction +
-                  material_sign_double *
-                      volume_fraction[i_target][j_target][k_target];
-              if (volume_fraction_target > volume_fraction_self) {
-                mixing_fraction = std::abs(cell_face_apertures[4]);
-                create_mixing_contribution(i, j, k);
-              }
+        if constexpr (CC::DIM() == Dimension::Three) {
+          // z-1
+          i_target = i;
+          j_target = j;
+          k_target = k - 1;
+          volume_fraction_target =
+              reference_volume_fraction +
+              material_sign_double *
+                  volume_fraction[i_target][j_target][k_target];
+          if (volume_fraction_target > volume_fraction_self) {
+            mixing_fraction = std::abs(cell_face_apertures[4]);
+            create_mixing_contribution(i, j, k);
+          }
 
-              // z+1
-              i_target = i;
-              j_target = j;
-              k_target = k + 1;
-              volume_fraction_target =
-                  reference_volume_fraction +
-                  material_sign_double *
-                      volume_fraction[i_target][j_target][k_target];
-              if (volume_fraction_target > volume_fraction_self) {
-                mixing_fraction = std::abs(cell_face_apertures[5]);
-                create_mixing_contribution(i, j, k);
-              }
-            }
+          // z+1
+          i_target = i;
+          j_target = j;
+          k_target = k + 1;
+          volume_fraction_target =
+              reference_volume_fraction +
+              material_sign_double *
+                  volume_fraction[i_target][j_target][k_target];
+          if (volume_fraction_target > volume_fraction_self) {
+            mixing_fraction = std::abs(cell_face_apertures[5]);
+            create_mixing_contribution(i, j, k);
+          }
+        }
 
-            // normalization of the mixing fraction
-            if (mixing_for_cell_active) {
-              double const one_beta_sum = 1.0 / beta_sum;
-              for (unsigned int n = 0; n < mixing_flux_factors.size(); ++n) {
-                mixing_flux_factors[n][0] *= one_beta_sum;
-              }
-            }
+        // normalization of the mixing fraction
+        if (mixing_for_cell_active) {
+          double const one_beta_sum = 1.0 / beta_sum;
+          for (unsigned int n = 0; n < mixing_flux_factors.size(); ++n) {
+            mixing_flux_factors[n][0] *= one_beta_sum;
+          }
+        }
 
-          } else {
+      } else {
 
-            mixing_for_cell_active = true;
-            // calculate inward pointing normal vector
-            std::array<double, 3> const normal =
-                GetNormal(levelset, i, j, k, material_sign);
+        mixing_for_cell_active = true;
+        // calculate inward pointing normal vector
+        std::array<double, 3> const normal =
+            GetNormal(levelset, i, j, k, material_sign);
 
-            // target cell in x direction
-            i_target =
-                i +
-                ((normal[0] > 0.0) -
+        // target cell in x direction
+        i_target =
+            i + ((normal[0] > 0.0) -
                  (normal[0] <
                   0.0)); // Bool arithmetics on purpose. +1 if normal direction
                          // positive, -1 if normal direction negative
-            j_target = j;
-            k_target = k;
-            volume_fraction_target =
-                reference_volume_fraction +
-                material_sign_double *
-                    volume_fraction[i_target][j_target][k_target];
-            if (volume_fraction_target > volume_fraction_self) {
-              mixing_fraction = normal[0] * normal[0];
-              create_mixing_contribution(i, j, k);
-            }
+        j_target = j;
+        k_target = k;
+        volume_fraction_target =
+            reference_volume_fraction +
+            material_sign_double *
+                volume_fraction[i_target][j_target][k_target];
+        if (volume_fraction_target > volume_fraction_self) {
+          mixing_fraction = normal[0] * normal[0];
+          create_mixing_contribution(i, j, k);
+        }
 
-            if constexpr (CC::DIM() != Dimension::One) {
-              // target cell in y direction
-              i_target = i;
-              j_target =
-                  j + ((normal[1] > 0.0) -
-                       (normal[1] < 0.0)); // Bool arithmetics on purpose. +1 if
-                                           // normal direction positive, -1 if
-                                           // normal direction negative
-              k_target = k;
-              volume_fraction_target =
-                  reference_volume_fraction +
-                  material_sign_double *
-                      volume_fraction[i_target][j_target][k_target];
-              if (volume_fraction_target > volume_fraction_self) {
-                mixing_fraction = normal[1] * normal[1];
-                create_mixing_contribution(i, j, k);
-              }
-            }
+        if constexpr (CC::DIM() != Dimension::One) {
+          // target cell in y direction
+          i_target = i;
+          j_target = j + ((normal[1] > 0.0) -
+                          (normal[1] < 0.0)); // Bool arithmetics on purpose. +1
+                                              // if normal direction positive,
+                                              // -1 if normal direction negative
+          k_target = k;
+          volume_fraction_target =
+              reference_volume_fraction +
+              material_sign_double *
+                  volume_fraction[i_target][j_target][k_target];
+          if (volume_fraction_target > volume_fraction_self) {
+            mixing_fraction = normal[1] * normal[1];
+            create_mixing_contribution(i, j, k);
+          }
+        }
 
-            if constexpr (CC::DIM() == Dimension::Three) {
-              // target cell in z direction
-              i_target = i;
-              j_target = j;
-              k_target =
-                  k + ((normal[2] > 0.0) -
-                       (normal[2] < 0.0)); // Bool arithmetics on purpose. +1 if
-                                           // normal direction positive, -1 if
-                                           // normal direction negative
-              volume_fraction_target =
-                  reference_volume_fraction +
-                  material_sign_double *
-                      volume_fraction[i_target][j_target][k_target];
-              if (volume_fraction_target > volume_fraction_self) {
-                mixing_fraction = normal[2] * normal[2];
-                create_mixing_contribution(i, j, k);
-              }
-            }
+        if constexpr (CC::DIM() == Dimension::Three) {
+          // target cell in z direction
+          i_target = i;
+          j_target = j;
+          k_target = k + ((normal[2] > 0.0) -
+                          (normal[2] < 0.0)); // Bool arithmetics on purpose. +1
+                                              // if normal direction positive,
+                                              // -1 if normal direction negative
+          volume_fraction_target =
+              reference_volume_fraction +
+              material_sign_double *
+                  volume_fraction[i_target][j_target][k_target];
+          if (volume_fraction_target > volume_fraction_self) {
+            mixing_fraction = normal[2] * normal[2];
+            create_mixing_contribution(i, j, k);
           }
+        }
+      }
 
-          if (mixing_for_cell_active) {
-            // calculation of a constant to calculate the mixing fluxes
-            for (unsigned int n = 0; n < mixing_flux_factors.size(); ++n) {
-              // Note, that at this point in mixing_flux_factors[n][1] the
-              // volume fraction is saved temporarily. This is necessary, since
-              // the calculation of the mixing flux factor is only possible with
-              // normalized mixing_fraction (saved in mixing_flux_factors[n][0])
-              mixing_flux_factors[n][1] =
-                  mixing_flux_factors[n][0] /
-                  (volume_fraction_self * mixing_flux_factors[n][0] +
-                   mixing_flux_factors[n][1]);
-            }
+      if (mixing_for_cell_active) {
+        // calculation of a constant to calculate the mixing fluxes
+        for (unsigned int n = 0; n < mixing_flux_factors.size(); ++n) {
+          // Note, that at this point in mixing_flux_factors[n][1] the
+          // volume fraction is saved temporarily. This is necessary, since
+          // the calculation of the mixing flux factor is only possible with
+          // normalized mixing_fraction (saved in mixing_flux_factors[n][0])
+          mixing_flux_factors[n][1] =
+              mixing_flux_factors[n][0] /
+              (volume_fraction_self * mixing_flux_factors[n][0] +
+               mixing_flux_factors[n][1]);
+        }
 
-            // add the mixing operations for cell i j k to the data container
-            // which saves all mixing operations for one block
-            mixing_contributions.push_back(
-                std::make_pair(mixing_indices, mixing_flux_factors));
-          }
+        // add the mixing operations for cell i j k to the data container
+        // which saves all mixing operations for one block
+        mixing_contributions.push_back(
+            std::make_pair(mixing_indices, mixing_flux_factors));
+      }
 
-        } // cells which are mixed
-      }   // k
-    }     // j
-  }       // i
+    } // cells which are mixed
+  }   // cells close to the interface
 }
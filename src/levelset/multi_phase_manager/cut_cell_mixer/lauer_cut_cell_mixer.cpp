@@ -111,173 +111,166 @@ void LauerCutCellMixer::CalculateMixingContributionsImplementation(
   constexpr bool mix_all_cells = false; // If for testing purposes mixing to all
                                         // cells is required change to true.
 
-  for (unsigned int i = FICMOX; i <= LICPOX; ++i) {
-    for (unsigned int j = FICMOY; j <= LICPOY; ++j) {
-      for (unsigned int k = FICMOZ; k <= LICPOZ; ++k) {
-        // reset variables to prepare the calculations for the next cell
-        mixing_indices.clear();
-        mixing_flux_factors.clear();
-        beta_sum = 0.0;
-        mixing_for_cell_active = false;
+  std::vector<std::array<unsigned int, 3>> cut_cells;
+  for (std::array<unsigned int, 3> const &cell :
+       node.GetInterfaceBlock().GetCutCellList().Cells(interface_tags,
+                                                       cut_cells)) {
+    unsigned int const i = cell[0];
+    unsigned int const j = cell[1];
+    unsigned int const k = cell[2];
+    // reset variables to prepare the calculations for the next cell
+    mixing_indices.clear();
+    mixing_flux_factors.clear();
+    beta_sum = 0.0;
+    mixing_for_cell_active = false;
 
-        volume_fraction_self = reference_volume_fraction +
-                               material_sign_double * volume_fraction[i][j][k];
-        if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::CutCellNeighbor) &&
-            (volume_fraction_self < CC::MITH() ||
-             levelset[i][j][k] * material_sign < 0)) {
+    volume_fraction_self = reference_volume_fraction +
+                           material_sign_double * volume_fraction[i][j][k];
+    if (volume_fraction_self < CC::MITH() ||
+        levelset[i][j][k] * material_sign < 0) {
 
-          std::array<double, 3> const normal =
-              GetNormal(levelset, i, j, k, material_sign);
+      std::array<double, 3> const normal =
+          GetNormal(levelset, i, j, k, material_sign);
 
-          unsigned int mixing_target_i =
-              i + ((normal[0] > 0.0) - (normal[0] < 0.0));
-          unsigned int mixing_target_j =
-              j + ((normal[1] > 0.0) - (normal[1] < 0.0));
-          unsigned int mixing_target_k =
-              k + ((normal[2] > 0.0) - (normal[2] < 0.0));
+      unsigned int mixing_target_i =
+          i + ((normal[0] > 0.0) - (normal[0] < 0.0));
+      unsigned int mixing_target_j =
+          j + ((normal[1] > 0.0) - (normal[1] < 0.0));
+      unsigned int mixing_target_k =
+          k + ((normal[2] > 0.0) - (normal[2] < 0.0));
 
-          // x
-          i_target = mixing_target_i;
-          j_target = j;
-          k_target = k;
-          volume_fraction_target =
-              reference_volume_fraction +
-              material_sign_double *
-                  volume_fraction[i_target][j_target][k_target];
-          if (volume_fraction_target > volume_fraction_self || mix_all_cells) {
-            mixing_fraction =
-                std::abs(normal[0] * normal[0]) * volume_fraction_target;
-            create_mixing_contribution(i, j, k);
-          }
+      // x
+      i_target = mixing_target_i;
+      j_target = j;
+      k_target = k;
+      volume_fraction_target =
+          reference_volume_fraction +
+          material_sign_double * volume_fraction[i_target][j_target][k_target];
+      if (volume_fraction_target > volume_fraction_self || mix_all_cells) {
+        mixing_fraction =
+            std::abs(normal[0] * normal[0]) * volume_fraction_target;
+        create_mixing_contribution(i, j, k);
+      }
 
-          if constexpr (CC::DIM() != Dimension::One) {
-            // y
-            i_target = i;
-            j_target = mixing_target_j;
-            k_target = k;
-            volume_fraction_target =
-                reference_volume_fraction +
-                material_sign_double *
-                    volume_fraction[i_target][j_target][k_target];
-            if (volume_fraction_target > volume_fraction_self ||
-                mix_all_cells) {
-              mixing_fraction =
-                  std::abs(normal[1] * normal[1]) * volume_fraction_target;
-              create_mixing_contribution(i, j, k);
-            }
+      if constexpr (CC::DIM() != Dimension::One) {
+        // y
+        i_target = i;
+        j_target = mixing_target_j;
+        k_target = k;
+        volume_fraction_target =
+            reference_volume_fraction +
+            material_sign_double *
+                volume_fraction[i_target][j_target][k_target];
+        if (volume_fraction_target > volume_fraction_self || mix_all_cells) {
+          mixing_fraction =
+              std::abs(normal[1] * normal[1]) * volume_fraction_target;
+          create_mixing_contribution(i, j, k);
+        }
 
-            // xy
-            i_target = mixing_target_i;
-            j_target = mixing_target_j;
-            k_target = k;
-            volume_fraction_target =
-                reference_volume_fraction +
-                material_sign_double *
-                    volume_fraction[i_target][j_target][k_target];
-            if (volume_fraction_target > volume_fraction_self ||
-                mix_all_cells) {
-              mixing_fraction =
-                  std::abs(normal[0] * normal[1]) * volume_fraction_target;
-              create_mixing_contribution(i, j, k);
-            }
-          }
+        // xy
+        i_target = mixing_target_i;
+        j_target = mixing_target_j;
+        k_target = k;
+        volume_fraction_target =
+            reference_volume_fraction +
+            material_sign_double *
+                volume_fraction[i_target][j_target][k_target];
+        if (volume_fraction_target > volume_fraction_self || mix_all_cells) {
+          mixing_fraction =
+              std::abs(normal[0] * normal[1]) * volume_fraction_target;
+          create_mixing_contribution(i, j, k);
+        }
+      }
 
-          if constexpr (CC::DIM() == Dimension::Three) {
-            // z
-            i_target = i;
-            j_target = j;
-            k_target = mixing_target_k;
-            volume_fraction_target =
-                reference_volume_fraction +
-                material_sign_double *
-                    volume_fraction[i_target][j_target][k_target];
-            if (volume_fraction_target > volume_fraction_self ||
-                mix_all_cells) {
-              mixing_fraction =
-                  std::abs(normal[2] * normal[2]) * volume_fraction_target;
-              create_mixing_contribution(i, j, k);
-            }
+      if constexpr (CC::DIM() == Dimension::Three) {
+        // z
+        i_target = i;
+        j_target = j;
+        k_target = mixing_target_k;
+        volume_fraction_target =
+            reference_volume_fraction +
+            material_sign_double *
+                volume_fraction[i_target][j_target][k_target];
+        if (volume_fraction_target > volume_fraction_self || mix_all_cells) {
+          mixing_fraction =
+              std::abs(normal[2] * normal[2]) * volume_fraction_target;
+          create_mixing_contribution(i, j, k);
+        }
 
-            // xz
-            i_target = mixing_target_i;
-            j_target = j;
-            k_target = mixing_target_k;
-            volume_fraction_target =
-                reference_volume_fraction +
-                material_sign_double *
-                    volume_fraction[i_target][j_target][k_target];
-            if (volume_fraction_target > volume_fraction_self ||
-                mix_all_cells) {
-              mixing_fraction =
-                  std::abs(normal[0] * normal[2]) * volume_fraction_target;
-              create_mixing_contribution(i, j, k);
-            }
+        // xz
+        i_target = mixing_target_i;
+        j_target = j;
+        k_target = mixing_target_k;
+        volume_fraction_target =
+            reference_volume_fraction +
+            material_sign_double *
+                volume_fraction[i_target][j_target][k_target];
+        if (volume_fraction_target > volume_fraction_self || mix_all_cells) {
+          mixing_fraction =
+              std::abs(normal[0] * normal[2]) * volume_fraction_target;
+          create_mixing_contribution(i, j, k);
+        }
 
-            // yz
-            i_target = i;
-            j_target = mixing_target_j;
-            k_target = mixing_target_k;
-            volume_fraction_target =
-                reference_volume_fraction +
-                material_sign_double *
-                    volume_fraction[i_target][j_target][k_target];
-            if (volume_fraction_target > volume_fraction_self ||
-                mix_all_cells) {
-              mixing_fraction =
-                  std::abs(normal[1] * normal[2]) * volume_fraction_target;
-              create_mixing_contribution(i, j, k);
-            }
+        // yz
+        i_target = i;
+        j_target = mixing_target_j;
+        k_target = mixing_target_k;
+        volume_fraction_target =
+            reference_volume_fraction +
+            material_sign_double *
+                volume_fraction[i_target][j_target][k_target];
+        if (volume_fraction_target > volume_fraction_self || mix_all_cells) {
+          mixing_fraction =
+              std::abs(normal[1] * normal[2]) * volume_fraction_target;
+          create_mixing_contribution(i, j, k);
+        }
 
-            // xyz
-            i_target = mixing_target_i;
-            j_target = mixing_target_j;
-            k_target = mixing_target_k;
-            volume_fraction_target =
-                reference_volume_fraction +
-                material_sign_double *
-                    volume_fraction[i_target][j_target][k_target];
-            if (volume_fraction_target > volume_fraction_self ||
-                mix_all_cells) {
-              mixing_fraction =
-                  std::pow(std::abs(normal[0] * normal[1] * normal[2]),
-                           2.0 / 3.0) *
-                  volume_fraction_target;
-              create_mixing_contribution(i, j, k);
-            }
-          }
+        // xyz
+        i_target = mixing_target_i;
+        j_target = mixing_target_j;
+        k_target = mixing_target_k;
+        volume_fraction_target =
+            reference_volume_fraction +
+            material_sign_double *
+                volume_fraction[i_target][j_target][k_target];
+        if (volume_fraction_target > volume_fraction_self || mix_all_cells) {
+          mixing_fraction =
+              std::pow(std::abs(normal[0] * normal[1] * normal[2]), 2.0 / 3.0) *
+              volume_fraction_target;
+          create_mixing_contribution(i, j, k);
+        }
+      }
 
-          // normalization of the mixing fraction
-          if (mixing_for_cell_active) {
-            double const one_beta_sum = 1.0 / beta_sum;
-            for (unsigned int n = 0; n < mixing_flux_factors.size(); ++n) {
-              mixing_flux_factors[n][0] *= one_beta_sum;
-            }
-          }
+      // normalization of the mixing fraction
+      if (mixing_for_cell_active) {
+        double const one_beta_sum = 1.0 / beta_sum;
+        for (unsigned int n = 0; n < mixing_flux_factors.size(); ++n) {
+          mixing_flux_factors[n][0] *= one_beta_sum;
+        }
+      }
 
-          if (mixing_for_cell_active) {
-            // calculation of a constant to calculate the mixing fluxes
-            for (unsigned int n = 0; n < mixing_flux_factors.size(); ++n) {
-              // Note, that at this point in mixing_flux_factors[n][1] the
-              // volume fraction is saved temporarily. This is necessary, since
-              // the calculation of the mixing flux factor is only possible with
-              // normalized mixing_fraction (saved in mixing_flux_factors[n][0])
-              mixing_flux_factors[n][1] =
-                  mixing_flux_factors[n][0] /
-                  (volume_fraction_self * mixing_flux_factors[n][0] +
-                   mixing_flux_factors[n][1]);
-            }
+      if (mixing_for_cell_active) {
+        // calculation of a constant to calculate the mixing fluxes
+        for (unsigned int n = 0; n < mixing_flux_factors.size(); ++n) {
+          // Note, that at this point in mixing_flux_factors[n][1] the
+          // volume fraction is saved temporarily. This is necessary, since
+          // the calculation of the mixing flux factor is only possible with
+          // normalized mixing_fraction (saved in mixing_flux_factors[n][0])
+          mixing_flux_factors[n][1] =
+              mixing_flux_factors[n][0] /
+              (volume_fraction_self * mixing_flux_factors[n][0] +
+               mixing_flux_factors[n][1]);
+        }
 
-            // JW At this place the mixing contributions can be sorted by its
-            // strength. Does not seem to be benifical though.
+        // JW At this place the mixing contributions can be sorted by its
+        // strength. Does not seem to be benifical though.
 
-            // add the mixing operations for cell i j k to the data container
-            // which saves all mixing operations for one block
-            mixing_contributions.push_back(
-                std::make_pair(mixing_indices, mixing_flux_factors));
-          }
+        // add the mixing operations for cell i j k to the data container
+        // which saves all mixing operations for one block
+        mixing_contributions.push_back(
+            std::make_pair(mixing_indices, mixing_flux_factors));
+      }
 
-        } // cells which are mixed
-      }   // k
-    }     // j
-  }       // i
+    } // cells which are mixed
+  }   // cells close to the interface
 }
@@ -149,7 +149,7 @@ private:
         node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
 
     for (Equation const eq : MF::ASOE()) {
-      double(&conservatives)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      FieldValue(&conservatives)[CC::TCX()][CC::TCY()][CC::TCZ()] =
           phase.GetRightHandSideBuffer(eq);
       for (unsigned int i = FICMOX; i <= LICPOX; ++i) {
         for (unsigned int j = FICMOY; j <= LICPOY; ++j) {
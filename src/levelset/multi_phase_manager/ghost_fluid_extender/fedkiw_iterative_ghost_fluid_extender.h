@@ -47,6 +47,7 @@ private:
   // Taking some variables from the base class
   using GhostFluidExtenderSpecification::epsilon_;
   using GhostFluidExtenderSpecification::field_type_;
+  using FieldValue = typename GhostFluidExtenderSpecification::FieldValue;
   using GhostFluidExtenderSpecification::
       number_of_convergence_tracking_quantities_;
   static constexpr unsigned int stencil_width_ = 1;
@@ -59,24 +60,26 @@ private:
 
 protected:
   /**
-   * @brief Extend to cut-cell neighbors and extension band iteratively.
+   * @brief Extend to cut-cell neighbors and extension band iteratively. All
+   * fields of a material are extended in a single pass over the cells.
    * @param node The node which is extended.
+   * @param extension_cells The cells of the node to extend into.
    * @param convergence_tracking_quantities An array holding information about
    * the convergence status of the iterative extension method.
+   * @return The residuum of the node.
    */
-  void IterativeExtension(
-      Node &node, double (&convergence_tracking_quantities)
-                      [2][number_of_convergence_tracking_quantities_]) const {
+  double IterativeExtension(
+      Node &node,
+      typename GhostFluidExtenderSpecification::ExtensionCells const
+          &extension_cells,
+      double (&convergence_tracking_quantities)
+          [2][number_of_convergence_tracking_quantities_]) const {
 
     double const(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetInterfaceBlock().GetReinitializedBuffer(
             InterfaceDescription::Levelset);
-    std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-        node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
-    double const(&volume_fraction)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-        node.GetInterfaceBlock().GetReinitializedBuffer(
-            InterfaceDescription::VolumeFraction);
 
+    double node_residuum = 0.0;
     // Loop through all materials of the node
     for (auto &phase : node.GetPhases()) {
 
@@ -84,14 +87,16 @@ protected:
           MaterialSignCapsule::SignOfMaterial(phase.first);
       unsigned int const material_index =
           phase.first == MaterialSignCapsule::PositiveMaterial() ? 0 : 1;
-      double const reference_volume_fraction = (material_sign > 0) ? 0.0 : 1.0;
       double const material_sign_double = double(material_sign);
+      auto const &cells = extension_cells[material_index];
 
-      double extension_rhs[MF::ANOF(field_type_)][CC::TCX()][CC::TCY()]
-                          [CC::TCZ()];
+      std::array<FieldValue(*)[CC::TCY()][CC::TCZ()], MF::ANOF(field_type_)>
+          fields;
       double one_normalization_constant[MF::ANOF(field_type_)];
       for (unsigned int field_index = 0; field_index < MF::ANOF(field_type_);
            field_index++) {
+        fields[field_index] = GhostFluidExtenderSpecification::ExtensionBuffer(
+            phase.second, field_index);
         one_normalization_constant[field_index] =
             1.0 /
             (std::max(
@@ -99,20 +104,11 @@ protected:
                 convergence_tracking_quantities[material_index][field_index]));
       }
 
+      // The right-hand side of all fields, stored cell by cell
+      std::vector<double> extension_rhs(cells.size() * MF::ANOF(field_type_));
+      double material_residuum = 0.0;
+
       for (unsigned int iteration = 0; iteration < repetition_; ++iteration) {
-        /**
-         * Setting the extension_rhs buffer to zero is crucial!
-         */
-        for (unsigned int field_index = 0; field_index < MF::ANOF(field_type_);
-             field_index++) {
-          for (unsigned int i = 0; i < CC::TCX(); ++i) {
-            for (unsigned int j = 0; j < CC::TCY(); ++j) {
-              for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-                extension_rhs[field_index][i][j][k] = 0.0;
-              } // k
-            }   // j
-          }     // i
-        }       // fields of field_type
 
         std::array<double, DTI(CC::DIM())> rhs_contributions;
 
@@ -123,154 +119,123 @@ protected:
           }
         }
 
-        // Loop through internal block - finally, fill extension band and
-        // cut-cell neighbors
-        for (unsigned int i = CC::FICX() - i_offset_;
-             i <= CC::LICX() + i_offset_; ++i) {
-          for (unsigned int j = CC::FICY() - j_offset_;
-               j <= CC::LICY() + j_offset_; ++j) {
-            for (unsigned int k = CC::FICZ() - k_offset_;
-                 k <= CC::LICZ() + k_offset_; ++k) {
-              double const cell_volume_fraction =
-                  reference_volume_fraction +
-                  material_sign_double * volume_fraction[i][j][k];
-              /**
-               * JW: We also extend in the reinitialization band in order to
-               * have better convergence behaviour (Reduce influence of
-               * implicitly imposed boundary conditions at the end of the narrow
-               * band). The convergence criteria is only checked for the
-               * extension band.
-               */
-              if (std::abs(interface_tags[i][j][k]) <=
-                      ITTI(IT::ReinitializationBand) &&
-                  (cell_volume_fraction <= CC::ETH())) {
+        // Loop through the cells to extend into - finally, fill extension band
+        // and cut-cell neighbors
+        for (std::size_t c = 0; c < cells.size(); ++c) {
+          unsigned int const i = cells[c].i_;
+          unsigned int const j = cells[c].j_;
+          unsigned int const k = cells[c].k_;
 
-                if (-material_sign * levelset[i + 1][j][k] >
-                        -material_sign * levelset[i][j][k] &&
-                    -material_sign * levelset[i - 1][j][k] >
-                        -material_sign * levelset[i][j][k]) {
-                  derivative_indices[0][0] = i;
-                  derivative_indices[0][1] = i;
-                } else {
-                  if (-material_sign * levelset[i + 1][j][k] <
-                      -material_sign * levelset[i - 1][j][k]) {
-                    derivative_indices[0][0] = i + 1;
-                    derivative_indices[0][1] = i;
-                  } else {
-                    derivative_indices[0][0] = i;
-                    derivative_indices[0][1] = i - 1;
-                  }
-                }
-
-                if constexpr (CC::DIM() != Dimension::One) {
-                  if (-material_sign * levelset[i][j + 1][k] >
-                          -material_sign * levelset[i][j][k] &&
-                      -material_sign * levelset[i][j - 1][k] >
-                          -material_sign * levelset[i][j][k]) {
-                    derivative_indices[1][0] = j;
-                    derivative_indices[1][1] = j;
-                  } else {
-                    if (-material_sign * levelset[i][j + 1][k] <
-                        -material_sign * levelset[i][j - 1][k]) {
-                      derivative_indices[1][0] = j + 1;
-                      derivative_indices[1][1] = j;
-                    } else {
-                      derivative_indices[1][0] = j;
-                      derivative_indices[1][1] = j - 1;
-                    }
-                  }
-                }
+          if (-material_sign * levelset[i + 1][j][k] >
+                  -material_sign * levelset[i][j][k] &&
+              -material_sign * levelset[i - 1][j][k] >
+                  -material_sign * levelset[i][j][k]) {
+            derivative_indices[0][0] = i;
+            derivative_indices[0][1] = i;
+          } else {
+            if (-material_sign * levelset[i + 1][j][k] <
+                -material_sign * levelset[i - 1][j][k]) {
+              derivative_indices[0][0] = i + 1;
+              derivative_indices[0][1] = i;
+            } else {
+              derivative_indices[0][0] = i;
+              derivative_indices[0][1] = i - 1;
+            }
+          }
 
-                if constexpr (CC::DIM() == Dimension::Three) {
-                  if (-material_sign * levelset[i][j][k + 1] >
-                          -material_sign * levelset[i][j][k] &&
-                      -material_sign * levelset[i][j][k - 1] >
-                          -material_sign * levelset[i][j][k]) {
-                    derivative_indices[2][0] = k;
-                    derivative_indices[2][1] = k;
-                  } else {
-                    if (-material_sign * levelset[i][j][k + 1] <
-                        -material_sign * levelset[i][j][k - 1]) {
-                      derivative_indices[2][0] = k + 1;
-                      derivative_indices[2][1] = k;
-                    } else {
-                      derivative_indices[2][0] = k;
-                      derivative_indices[2][1] = k - 1;
-                    }
-                  }
-                }
+          if constexpr (CC::DIM() != Dimension::One) {
+            if (-material_sign * levelset[i][j + 1][k] >
+                    -material_sign * levelset[i][j][k] &&
+                -material_sign * levelset[i][j - 1][k] >
+                    -material_sign * levelset[i][j][k]) {
+              derivative_indices[1][0] = j;
+              derivative_indices[1][1] = j;
+            } else {
+              if (-material_sign * levelset[i][j + 1][k] <
+                  -material_sign * levelset[i][j - 1][k]) {
+                derivative_indices[1][0] = j + 1;
+                derivative_indices[1][1] = j;
+              } else {
+                derivative_indices[1][0] = j;
+                derivative_indices[1][1] = j - 1;
+              }
+            }
+          }
 
-                // calculate gradients
-                for (unsigned int field_index = 0;
-                     field_index < MF::ANOF(field_type_); field_index++) {
-                  double const(&cell)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-                      phase.second.GetFieldBuffer(field_type_, field_index);
+          if constexpr (CC::DIM() == Dimension::Three) {
+            if (-material_sign * levelset[i][j][k + 1] >
+                    -material_sign * levelset[i][j][k] &&
+                -material_sign * levelset[i][j][k - 1] >
+                    -material_sign * levelset[i][j][k]) {
+              derivative_indices[2][0] = k;
+              derivative_indices[2][1] = k;
+            } else {
+              if (-material_sign * levelset[i][j][k + 1] <
+                  -material_sign * levelset[i][j][k - 1]) {
+                derivative_indices[2][0] = k + 1;
+                derivative_indices[2][1] = k;
+              } else {
+                derivative_indices[2][0] = k;
+                derivative_indices[2][1] = k - 1;
+              }
+            }
+          }
 
-                  rhs_contributions[0] = cell[derivative_indices[0][0]][j][k] -
-                                         cell[derivative_indices[0][1]][j][k];
-                  rhs_contributions[0] *=
-                      levelset[derivative_indices[0][0]][j][k] -
-                      levelset[derivative_indices[0][1]][j][k];
+          // calculate gradients
+          for (unsigned int field_index = 0;
+               field_index < MF::ANOF(field_type_); field_index++) {
+            FieldValue const(*const cell)[CC::TCY()][CC::TCZ()] =
+                fields[field_index];
 
-                  if constexpr (CC::DIM() != Dimension::One) {
-                    rhs_contributions[1] =
-                        cell[i][derivative_indices[1][0]][k] -
-                        cell[i][derivative_indices[1][1]][k];
-                    rhs_contributions[1] *=
-                        levelset[i][derivative_indices[1][0]][k] -
-                        levelset[i][derivative_indices[1][1]][k];
-                  }
+            rhs_contributions[0] = cell[derivative_indices[0][0]][j][k] -
+                                   cell[derivative_indices[0][1]][j][k];
+            rhs_contributions[0] *= levelset[derivative_indices[0][0]][j][k] -
+                                    levelset[derivative_indices[0][1]][j][k];
 
-                  if constexpr (CC::DIM() == Dimension::Three) {
-                    rhs_contributions[2] =
-                        cell[i][j][derivative_indices[2][0]] -
-                        cell[i][j][derivative_indices[2][1]];
-                    rhs_contributions[2] *=
-                        levelset[i][j][derivative_indices[2][0]] -
-                        levelset[i][j][derivative_indices[2][1]];
-                  }
+            if constexpr (CC::DIM() != Dimension::One) {
+              rhs_contributions[1] = cell[i][derivative_indices[1][0]][k] -
+                                     cell[i][derivative_indices[1][1]][k];
+              rhs_contributions[1] *= levelset[i][derivative_indices[1][0]][k] -
+                                      levelset[i][derivative_indices[1][1]][k];
+            }
 
-                  extension_rhs[field_index][i][j][k] =
-                      ConsistencyManagedSum(rhs_contributions) *
-                      ExtensionConstants::Dtau * material_sign_double;
+            if constexpr (CC::DIM() == Dimension::Three) {
+              rhs_contributions[2] = cell[i][j][derivative_indices[2][0]] -
+                                     cell[i][j][derivative_indices[2][1]];
+              rhs_contributions[2] *= levelset[i][j][derivative_indices[2][0]] -
+                                      levelset[i][j][derivative_indices[2][1]];
+            }
 
-                  if (ExtensionConstants::TrackConvergence &&
-                      std::abs(interface_tags[i][j][k]) <=
-                          ITTI(IT::ExtensionBand)) {
-                    convergence_tracking_quantities[material_index][MF::ANOF(
-                        field_type_)] =
-                        std::max(
-                            convergence_tracking_quantities[material_index]
-                                                           [MF::ANOF(
-                                                               field_type_)],
-                            std::abs(extension_rhs[field_index][i][j][k] *
-                                     one_normalization_constant[field_index]));
-                  }
+            double &rhs =
+                extension_rhs[c * MF::ANOF(field_type_) + field_index];
+            rhs = ConsistencyManagedSum(rhs_contributions) *
+                  ExtensionConstants::Dtau * material_sign_double;
 
-                } // fields of field_type
-              }   // cells to extend
-            }     // k
-          }       // j
-        }         // i
+            if (ExtensionConstants::TrackConvergence &&
+                cells[c].in_extension_band_) {
+              material_residuum = std::max(
+                  material_residuum,
+                  std::abs(rhs * one_normalization_constant[field_index]));
+            }
+          } // fields of field_type
+        }   // cells to extend
 
-        for (unsigned int field_index = 0; field_index < MF::ANOF(field_type_);
-             field_index++) {
-          double(&extension_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-              phase.second.GetFieldBuffer(field_type_, field_index);
-          for (unsigned int i = CC::FICX() - i_offset_;
-               i <= CC::LICX() + i_offset_; ++i) {
-            for (unsigned int j = CC::FICY() - j_offset_;
-                 j <= CC::LICY() + j_offset_; ++j) {
-              for (unsigned int k = CC::FICZ() - k_offset_;
-                   k <= CC::LICZ() + k_offset_; ++k) {
-                extension_buffer[i][j][k] +=
-                    extension_rhs[field_index][i][j][k];
-              } // k
-            }   // j
-          }     // i
-        }       // fields of field_type
+        for (std::size_t c = 0; c < cells.size(); ++c) {
+          for (unsigned int field_index = 0;
+               field_index < MF::ANOF(field_type_); field_index++) {
+            fields[field_index][cells[c].i_][cells[c].j_][cells[c].k_] +=
+                extension_rhs[c * MF::ANOF(field_type_) + field_index];
+          } // fields of field_type
+        }   // cells to extend
       }
+
+      double &tracked_residuum =
+          convergence_tracking_quantities[material_index]
+                                         [MF::ANOF(field_type_)];
+      tracked_residuum = std::max(tracked_residuum, material_residuum);
+      node_residuum = std::max(node_residuum, material_residuum);
     }
+    return node_residuum;
   }
 
 public:
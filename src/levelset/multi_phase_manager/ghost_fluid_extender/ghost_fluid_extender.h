@@ -22,12 +22,15 @@
 #ifndef GHOST_FLUID_EXTENDER_H
 #define GHOST_FLUID_EXTENDER_H
 
+#include "communication/mpi_utilities.h"
 #include "halo_manager.h"
 #include "levelset/geometry/geometry_calculator_marching_cubes.h"
+#include "levelset/multi_phase_manager/converged_node_freezing.h"
 #include "levelset/multi_phase_manager/material_sign_capsule.h"
 #include "materials/material_manager.h"
 #include "user_specifications/numerical_setup.h"
 #include "user_specifications/two_phase_constants.h"
+#include <algorithm>
 
 /**
  * @brief The GhostFluidExtender class extends material-states from
@@ -62,6 +65,112 @@ private:
       MF::ANOF(field_type_) + 1;
   // numerical threshold
   static constexpr double epsilon_ = std::numeric_limits<double>::epsilon();
+  // type the values of the extended fields are stored in
+  using FieldValue =
+      std::conditional_t<field_type_ == MaterialFieldType::Parameters,
+                         ParameterValue, ::FieldValue>;
+
+  /**
+   * @brief Gives a field of the extended field type in its storage precision.
+   * @param block The block holding the field.
+   * @param field_index The index of the field.
+   * @return Reference to the field buffer.
+   */
+  static auto ExtensionBuffer(Block &block, unsigned int const field_index)
+      -> FieldValue (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+    if constexpr (field_type_ == MaterialFieldType::Parameters) {
+      return block.GetParameterBuffer()[field_index];
+    } else {
+      return field_type_ == MaterialFieldType::Conservatives
+                 ? block.GetRightHandSideBuffer()[field_index]
+                 : block.GetPrimeStateBuffer()[field_index];
+    }
+  }
+
+  /**
+   * @brief Const overload.
+   */
+  static auto ExtensionBuffer(Block const &block,
+                              unsigned int const field_index) -> FieldValue
+      const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+    if constexpr (field_type_ == MaterialFieldType::Parameters) {
+      return block.GetParameterBuffer()[field_index];
+    } else {
+      return field_type_ == MaterialFieldType::Conservatives
+                 ? block.GetRightHandSideBuffer()[field_index]
+                 : block.GetPrimeStateBuffer()[field_index];
+    }
+  }
+
+  /**
+   * @brief A cell in which a material is extended.
+   */
+  struct ExtensionCell {
+    unsigned int i_;
+    unsigned int j_;
+    unsigned int k_;
+    // whether the cell lies in the extension band, i.e. is checked for
+    // convergence
+    bool in_extension_band_;
+  };
+  // The cells to extend into for the positive (0) and negative (1) material
+  using ExtensionCells = std::array<std::vector<ExtensionCell>, 2>;
+
+  /**
+   * @brief Gathers the cells of a node in which the materials are extended. We
+   * also extend in the reinitialization band in order to have better
+   * convergence behaviour (Reduce influence of implicitly imposed boundary
+   * conditions at the end of the narrow band). The convergence criteria is
+   * only checked for the extension band. Interface tags and volume fractions do
+   * not change during the extension, hence the cells are gathered once.
+   * @param node The node for which the cells are gathered.
+   * @param extension_cells The cells of each material (indirect return
+   * parameter).
+   */
+  void CollectExtensionCells(Node const &node,
+                             ExtensionCells &extension_cells) const {
+
+    std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
+    double const(&volume_fraction)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        node.GetInterfaceBlock().GetReinitializedBuffer(
+            InterfaceDescription::VolumeFraction);
+
+    constexpr unsigned int i_offset = DerivedGhostFluidExtender::i_offset_;
+    constexpr unsigned int j_offset = DerivedGhostFluidExtender::j_offset_;
+    constexpr unsigned int k_offset = DerivedGhostFluidExtender::k_offset_;
+
+    for (auto const &phase : node.GetPhases()) {
+      std::int8_t const material_sign =
+          MaterialSignCapsule::SignOfMaterial(phase.first);
+      unsigned int const material_index =
+          phase.first == MaterialSignCapsule::PositiveMaterial() ? 0 : 1;
+      double const reference_volume_fraction = (material_sign > 0) ? 0.0 : 1.0;
+      double const material_sign_double = double(material_sign);
+
+      std::vector<ExtensionCell> &cells = extension_cells[material_index];
+      cells.clear();
+      for (unsigned int i = CC::FICX() - i_offset; i <= CC::LICX() + i_offset;
+           ++i) {
+        for (unsigned int j = CC::FICY() - j_offset; j <= CC::LICY() + j_offset;
+             ++j) {
+          for (unsigned int k = CC::FICZ() - k_offset;
+               k <= CC::LICZ() + k_offset; ++k) {
+            double const cell_volume_fraction =
+                reference_volume_fraction +
+                material_sign_double * volume_fraction[i][j][k];
+            if (std::abs(interface_tags[i][j][k]) <=
+                    ITTI(IT::ReinitializationBand) &&
+                (cell_volume_fraction <= CC::ETH())) {
+              cells.push_back({i, j, k,
+                               std::abs(interface_tags[i][j][k]) <=
+                                   ITTI(IT::ExtensionBand)});
+            }
+          } // k
+        }   // j
+      }     // i
+    }       // phases
+  }
 
   /**
    * @brief Determines the maximum material fields in the cells where we extend.
@@ -94,8 +203,8 @@ private:
       // Loop through all fields of the given field_Type
       for (unsigned int field_index = 0; field_index < MF::ANOF(field_type_);
            field_index++) {
-        double const(&extension_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-            phase.second.GetFieldBuffer(field_type_, field_index);
+        FieldValue const(&extension_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+            ExtensionBuffer(phase.second, field_index);
         // Loop through all internal cells of the block
         for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
           for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
@@ -110,7 +219,7 @@ private:
                 convergence_tracking_quantities[material_index][field_index] =
                     std::max(convergence_tracking_quantities[material_index]
                                                             [field_index],
-                             std::abs(extension_buffer[i][j][k]));
+                             std::abs(double(extension_buffer[i][j][k])));
               }
             } // k
           }   // j
@@ -119,6 +228,47 @@ private:
     }         // phases
   }
 
+  /**
+   * @brief Applies a function to all nodes in parallel. Each thread works on
+   * its own copy of the convergence tracking quantities, the copies are merged
+   * by their maxima afterwards. Entries not changed by the function keep their
+   * value.
+   * @param number_of_nodes The number of nodes.
+   * @param convergence_tracking_quantities An array holding information about
+   * the convergence status of the iterative extension method.
+   * @param function Callable taking the node index and the thread's tracking
+   * quantities.
+   */
+  template <typename Function>
+  static void ForNodesTrackingConvergence(
+      std::size_t const number_of_nodes,
+      double (&convergence_tracking_quantities)
+          [2][number_of_convergence_tracking_quantities_],
+      Function &&function) {
+    long const nodes_count = static_cast<long>(number_of_nodes);
+#pragma omp parallel
+    {
+      double thread_quantities[2][number_of_convergence_tracking_quantities_];
+      std::copy_n(&convergence_tracking_quantities[0][0],
+                  2 * number_of_convergence_tracking_quantities_,
+                  &thread_quantities[0][0]);
+#pragma omp for schedule(dynamic)
+      for (long node_index = 0; node_index < nodes_count; ++node_index) {
+        function(static_cast<std::size_t>(node_index), thread_quantities);
+      }
+#pragma omp critical
+      for (unsigned int material_index = 0; material_index < 2;
+           ++material_index) {
+        for (unsigned int index = 0;
+             index < number_of_convergence_tracking_quantities_; ++index) {
+          convergence_tracking_quantities[material_index][index] =
+              std::max(convergence_tracking_quantities[material_index][index],
+                       thread_quantities[material_index][index]);
+        }
+      }
+    }
+  }
+
   /**
    * @brief The default constructor for the IterativeGhostFluidExtender. Calls
    * the default constructor of the base class.
@@ -162,6 +312,30 @@ public:
       }
     }
 
+    // The cells to extend into are gathered once and reused in all iterations
+    std::vector<ExtensionCells> extension_cells(nodes.size());
+    long const number_of_nodes = static_cast<long>(nodes.size());
+#pragma omp parallel for schedule(dynamic)
+    for (long n = 0; n < number_of_nodes; ++n) {
+      CollectExtensionCells(nodes[n], extension_cells[n]);
+    }
+
+    // Nodes which converged together with all nodes their halos are filled
+    // from are frozen, i.e. no longer iterated. The halo dependencies are the
+    // same for material and interface buffers.
+    constexpr bool freeze_nodes = ExtensionConstants::TrackConvergence &&
+                                  ExtensionConstants::FreezeConvergedNodes;
+    std::vector<nid_t> ids;
+    std::vector<std::vector<std::size_t>> neighbors;
+    std::vector<bool> has_mpi_boundary;
+    std::vector<bool> frozen(nodes.size(), false);
+    std::vector<nid_t> frozen_ids;
+    std::vector<double> node_residuum(nodes.size(), 0.0);
+    if constexpr (freeze_nodes) {
+      halo_manager_.InterfaceHaloDependenciesOnLmax(nodes, ids, neighbors,
+                                                    has_mpi_boundary);
+    }
+
     // Actual iterative loop
     for (unsigned int iteration_number = 0;
          iteration_number < ExtensionConstants::MaximumNumberOfIterations;
@@ -176,14 +350,16 @@ public:
             convergence_tracking_quantities[material_index][field_index] = 0.0;
           }
         }
-        for (Node const &node : nodes) {
-          DetermineMaximumValueOfQuantitiesToExtend(
-              node, convergence_tracking_quantities);
-        }
+        ForNodesTrackingConvergence(
+            nodes.size(), convergence_tracking_quantities,
+            [this, &nodes](std::size_t const n, auto &thread_quantities) {
+              DetermineMaximumValueOfQuantitiesToExtend(nodes[n],
+                                                        thread_quantities);
+            });
 
         MPI_Allreduce(MPI_IN_PLACE, &convergence_tracking_quantities,
                       number_of_convergence_tracking_quantities_ * 2,
-                      MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+                      MPI_DOUBLE, MPI_MAX, MpiUtilities::Communicator());
         // Write convergence to logger if desired or if maximum of iterations is
         // reached
         if (convergence_tracking_quantities[0][MF::ANOF(field_type_)] <
@@ -208,14 +384,29 @@ public:
         convergence_tracking_quantities[1][MF::ANOF(field_type_)] = 0.0;
       }
 
-      // iterative extension on field buffer (static derived extender)
-      for (Node &node : nodes) {
-        static_cast<DerivedGhostFluidExtender const &>(*this)
-            .IterativeExtension(node, convergence_tracking_quantities);
-      } // nodes
+      // iterative extension on field buffer (static derived extender), the
+      // nodes only read their own halos, which are not updated in between
+      ForNodesTrackingConvergence(
+          nodes.size(), convergence_tracking_quantities,
+          [this, &nodes, &frozen, &node_residuum,
+           &extension_cells](std::size_t const n, auto &thread_quantities) {
+            if (frozen[n]) {
+              return;
+            }
+            node_residuum[n] =
+                static_cast<DerivedGhostFluidExtender const &>(*this)
+                    .IterativeExtension(nodes[n], extension_cells[n],
+                                        thread_quantities);
+          });
 
       // Update the halos after each iterative step
       halo_manager_.MaterialHaloUpdateOnLmaxMultis(field_type_);
+
+      if constexpr (freeze_nodes) {
+        ConvergedNodeFreezing::UpdateFrozenNodes(
+            node_residuum, ExtensionConstants::MaximumResiduum, ids, neighbors,
+            has_mpi_boundary, frozen, frozen_ids);
+      }
     }
   };
 };
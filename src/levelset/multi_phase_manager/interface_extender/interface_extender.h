@@ -22,6 +22,7 @@
 #ifndef INTERFACE_EXTENDER_H
 #define INTERFACE_EXTENDER_H
 
+#include "communication/mpi_utilities.h"
 #include "halo_manager.h"
 #include "levelset/geometry/geometry_calculator_marching_cubes.h"
 #include "user_specifications/numerical_setup.h"
@@ -134,7 +135,7 @@ public:
 
         MPI_Allreduce(MPI_IN_PLACE, convergence_tracking_quantities.data(),
                       number_of_convergence_tracking_quantities_, MPI_DOUBLE,
-                      MPI_MAX, MPI_COMM_WORLD);
+                      MPI_MAX, MpiUtilities::Communicator());
 
         if (convergence_tracking_quantities[IF::NOFTE(field_type_)] <
                 InterfaceStateExtensionConstants::MaximumResiduum &&
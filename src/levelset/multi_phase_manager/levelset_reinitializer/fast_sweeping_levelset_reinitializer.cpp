@@ -0,0 +1,217 @@
+//===----------- fast_sweeping_levelset_reinitializer.cpp -----------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "fast_sweeping_levelset_reinitializer.h"
+#include "communication/reduction_batch.h"
+#include "utilities/mathematical_functions.h"
+#include <algorithm>
+#include <array>
+
+/**
+ * @brief The default constructor for a FastSweepingLevelsetReinitializer.
+ * Calls the default constructor of the base class.
+ * @param halo_manager See base class.
+ */
+FastSweepingLevelsetReinitializer::FastSweepingLevelsetReinitializer(
+    HaloManager &halo_manager)
+    : LevelsetReinitializer(halo_manager) {
+  // Empty Constructor, besides call of base class constructor.
+}
+
+namespace {
+
+/**
+ * @brief Solves the upwind discretization of the Eikonal equation for the
+ * distance of a cell as described in \cite Zhao2005. All distances are given
+ * in cell sizes.
+ * @param distances The smaller distance of the two neighbors in each
+ * direction.
+ * @return The distance of the cell.
+ */
+double SolveEikonal(std::array<double, DTI(CC::DIM())> distances) {
+  std::sort(distances.begin(), distances.end());
+  double solution = distances[0] + 1.0;
+  if constexpr (CC::DIM() != Dimension::One) {
+    if (solution > distances[1]) {
+      double const difference = distances[0] - distances[1];
+      solution = 0.5 * (distances[0] + distances[1] +
+                        std::sqrt(2.0 - difference * difference));
+    }
+  }
+  if constexpr (CC::DIM() == Dimension::Three) {
+    if (solution > distances[2]) {
+      double const sum = distances[0] + distances[1] + distances[2];
+      double const sum_of_squares = distances[0] * distances[0] +
+                                    distances[1] * distances[1] +
+                                    distances[2] * distances[2];
+      solution =
+          (sum +
+           std::sqrt(std::max(0.0, sum * sum - 3.0 * (sum_of_squares - 1.0)))) /
+          3.0;
+    }
+  }
+  return solution;
+}
+
+} // namespace
+
+/**
+ * @brief Sets the level-set value of all cells to be reinitialized to the
+ * cut-off value, keeping the sign. The sweeps then only decrease the distances.
+ * @param node The node with levelset block which has to be reinitialized.
+ * @param levelset_type Level-set field type that is reinitialized.
+ */
+void FastSweepingLevelsetReinitializer::InitializeSingleNode(
+    Node &node, InterfaceDescriptionBufferType const levelset_type) const {
+  std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      node.GetInterfaceTags(levelset_type);
+  double(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      node.GetInterfaceBlock().GetInterfaceDescriptionBuffer(
+          levelset_type, InterfaceDescription::Levelset);
+
+  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+        if (IsReinitializedCell(interface_tags[i][j][k])) {
+          levelset[i][j][k] = Signum(levelset[i][j][k]) * CC::LSCOF();
+        }
+      } // k
+    }   // j
+  }     // i
+}
+
+/**
+ * @brief Performs Gauss-Seidel sweeps in all alternating orderings over the
+ * internal cells of a node as described in \cite Zhao2005.
+ * @param node The node with levelset block which has to be reinitialized.
+ * @param levelset_type Level-set field type that is reinitialized.
+ * @return The residuum for the current node.
+ */
+double FastSweepingLevelsetReinitializer::SweepSingleNode(
+    Node &node, InterfaceDescriptionBufferType const levelset_type) const {
+  std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      node.GetInterfaceTags(levelset_type);
+  double(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      node.GetInterfaceBlock().GetInterfaceDescriptionBuffer(
+          levelset_type, InterfaceDescription::Levelset);
+
+  double residuum = 0.0;
+  std::array<double, DTI(CC::DIM())> distances;
+
+  // Each bit of the ordering reverses the sweep direction in one dimension
+  constexpr unsigned int number_of_orderings = 1u << DTI(CC::DIM());
+  for (unsigned int ordering = 0; ordering < number_of_orderings; ++ordering) {
+    for (unsigned int ii = 0; ii < CC::ICX(); ++ii) {
+      unsigned int const i =
+          (ordering & 1u) ? CC::LICX() - ii : CC::FICX() + ii;
+      for (unsigned int jj = 0; jj < CC::ICY(); ++jj) {
+        unsigned int const j =
+            (ordering & 2u) ? CC::LICY() - jj : CC::FICY() + jj;
+        for (unsigned int kk = 0; kk < CC::ICZ(); ++kk) {
+          unsigned int const k =
+              (ordering & 4u) ? CC::LICZ() - kk : CC::FICZ() + kk;
+          if (!IsReinitializedCell(interface_tags[i][j][k])) {
+            continue;
+          }
+
+          distances[0] = std::min(std::abs(levelset[i - 1][j][k]),
+                                  std::abs(levelset[i + 1][j][k]));
+          if constexpr (CC::DIM() != Dimension::One) {
+            distances[1] = std::min(std::abs(levelset[i][j - 1][k]),
+                                    std::abs(levelset[i][j + 1][k]));
+          }
+          if constexpr (CC::DIM() == Dimension::Three) {
+            distances[2] = std::min(std::abs(levelset[i][j][k - 1]),
+                                    std::abs(levelset[i][j][k + 1]));
+          }
+
+          double const distance =
+              std::min(std::abs(levelset[i][j][k]), SolveEikonal(distances));
+          double const value = Signum(levelset[i][j][k]) * distance;
+          if (std::abs(interface_tags[i][j][k]) <
+              ITTI(IT::ReinitializationBand)) {
+            residuum = std::max(residuum, std::abs(value - levelset[i][j][k]));
+          }
+          levelset[i][j][k] = value;
+        } // k
+      }   // j
+    }     // i
+  }       // ordering
+
+  return residuum;
+}
+
+/**
+ * @brief Reinitializes the level-set field with block-wise fast sweeping. The
+ * iterations are repeated until the level-set field no longer changes, which
+ * typically happens after a few iterations.
+ * @param nodes Vector holding all nodes that have to be updated.
+ * @param levelset_type Level set buffer type which is reinitialized.
+ * @param is_last_stage Unused, the cut cells are never modified.
+ */
+void FastSweepingLevelsetReinitializer::ReinitializeImplementation(
+    std::vector<std::reference_wrapper<Node>> const &nodes,
+    InterfaceDescriptionBufferType const levelset_type, bool const) const {
+
+  InterfaceBlockBufferType const levelset_buffer_type =
+      levelset_type == InterfaceDescriptionBufferType::Reinitialized
+          ? InterfaceBlockBufferType::LevelsetReinitialized
+          : InterfaceBlockBufferType::LevelsetIntegrated;
+
+  long const number_of_nodes = static_cast<long>(nodes.size());
+#pragma omp parallel for schedule(dynamic)
+  for (long n = 0; n < number_of_nodes; ++n) {
+    InitializeSingleNode(nodes[n], levelset_type);
+  }
+  halo_manager_.InterfaceHaloUpdateOnLmax(levelset_buffer_type);
+
+  constexpr unsigned int maximum_number_of_iterations =
+      FastSweepingReinitializationConstants::MaximumNumberOfIterations;
+  for (unsigned int iteration_number = 0;
+       iteration_number < maximum_number_of_iterations; ++iteration_number) {
+    double residuum = 0.0;
+#pragma omp parallel for schedule(dynamic) reduction(max : residuum)
+    for (long n = 0; n < number_of_nodes; ++n) {
+      residuum = std::max(residuum, SweepSingleNode(nodes[n], levelset_type));
+    }
+
+    // The reduction of the residuum runs during the halo update
+    ReductionBatch convergence;
+    std::size_t const residuum_handle = convergence.AddMaximum(residuum);
+    convergence.Start();
+    halo_manager_.InterfaceHaloUpdateOnLmax(levelset_buffer_type);
+    convergence.Wait();
+    residuum = convergence.Maximum(residuum_handle);
+
+    if (residuum < FastSweepingReinitializationConstants::MaximumResiduum) {
+      if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
+        logger_.BufferMessage(
+            "Reinit: " + std::to_string(static_cast<int>(iteration_number)) +
+            " ");
+      }
+      break;
+    } else if (iteration_number == maximum_number_of_iterations - 1) {
+      if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
+        logger_.BufferMessage("Reinit: nc   !!!   ");
+      }
+    }
+  }
+}
@@ -0,0 +1,78 @@
+//===----------- fast_sweeping_levelset_reinitializer.h -------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef FAST_SWEEPING_LEVELSET_REINITIALIZER_H
+#define FAST_SWEEPING_LEVELSET_REINITIALIZER_H
+
+#include "enums/interface_tag_definition.h"
+#include "levelset_reinitializer.h"
+#include "user_specifications/two_phase_constants.h"
+
+/**
+ * @brief Provides functionality to reinitialize a level-set field with the
+ * parallel fast sweeping method as described in \cite Zhao2005 and \cite
+ * Detrixhe2013. Within each block, Gauss-Seidel sweeps in all alternating
+ * orderings solve the upwind discretization of the Eikonal equation with the
+ * cut cells as fixed boundary values. The blocks are coupled via halo updates
+ * between the iterations.
+ */
+class FastSweepingLevelsetReinitializer
+    : public LevelsetReinitializer<FastSweepingLevelsetReinitializer> {
+
+  friend LevelsetReinitializer;
+
+  /**
+   * @brief Indicates whether the level-set value of a cell is recomputed. Cut
+   * cells provide the boundary values of the Eikonal equation and are kept.
+   * @param interface_tag The interface tag of the cell.
+   * @return True if the cell is reinitialized.
+   */
+  static bool IsReinitializedCell(std::int8_t const interface_tag) {
+    return std::abs(interface_tag) > ITTI(IT::NewCutCell);
+  }
+
+  void InitializeSingleNode(
+      Node &node, InterfaceDescriptionBufferType const levelset_type) const;
+  double
+  SweepSingleNode(Node &node,
+                  InterfaceDescriptionBufferType const levelset_type) const;
+
+protected:
+  void ReinitializeImplementation(
+      std::vector<std::reference_wrapper<Node>> const &nodes,
+      InterfaceDescriptionBufferType const levelset_type,
+      bool const is_last_stage) const;
+
+public:
+  FastSweepingLevelsetReinitializer() = delete;
+  explicit FastSweepingLevelsetReinitializer(HaloManager &halo_manager);
+  ~FastSweepingLevelsetReinitializer() = default;
+  FastSweepingLevelsetReinitializer(FastSweepingLevelsetReinitializer const &) =
+      delete;
+  FastSweepingLevelsetReinitializer &
+  operator=(FastSweepingLevelsetReinitializer const &) = delete;
+  FastSweepingLevelsetReinitializer(FastSweepingLevelsetReinitializer &&) =
+      delete;
+  FastSweepingLevelsetReinitializer &
+  operator=(FastSweepingLevelsetReinitializer &&) = delete;
+};
+
+#endif // FAST_SWEEPING_LEVELSET_REINITIALIZER_H
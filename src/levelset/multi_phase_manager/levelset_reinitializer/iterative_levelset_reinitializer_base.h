@@ -22,11 +22,17 @@
 #ifndef ITERATIVE_LEVELSET_REINITIALIZER_BASE_H
 #define ITERATIVE_LEVELSET_REINITIALIZER_BASE_H
 
+#include "communication/reduction_batch.h"
 #include "enums/interface_tag_definition.h"
+#include "levelset/multi_phase_manager/converged_node_freezing.h"
 #include "levelset_reinitializer.h"
 #include "user_specifications/two_phase_constants.h"
 #include "utilities/buffer_operations_interface.h"
 #include "utilities/mathematical_functions.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
 
 /**
  * @brief The class IterativeLevelsetReinitializerBase ensures the
@@ -67,7 +73,7 @@ class IterativeLevelsetReinitializerBase
     InterfaceBlock &interface_block = node.GetInterfaceBlock();
     double(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         interface_block.GetInterfaceDescriptionBuffer(
-            levelset_type)[InterfaceDescription::Levelset];
+            levelset_type, InterfaceDescription::Levelset);
 
     // Cells which have a levelset value greater than the cutoff value are set
     // to cutoff.
@@ -83,6 +89,80 @@ class IterativeLevelsetReinitializerBase
     }     // i
   }
 
+  /**
+   * @brief Collects the internal cells of a node which are updated in the
+   * reinitialization sweeps. The interface tags do not change during the
+   * iterations, hence the list is valid for all sweeps of a stage.
+   * @param node The node with levelset block which has to be reinitialized.
+   * @param levelset_type Level set buffer type which is reinitialized.
+   * @param is_last_stage whether it's the last RK stage or not.
+   * @param band_cells Indices of the cells to be reinitialized (indirect
+   * return parameter).
+   */
+  void CollectBandCellsOfSingleNode(
+      Node &node, InterfaceDescriptionBufferType const levelset_type,
+      bool const is_last_stage,
+      std::vector<std::array<unsigned int, 3>> &band_cells) const {
+    std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        node.GetInterfaceTags(levelset_type);
+    band_cells.clear();
+    for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+      for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+        for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+          if (DerivedIterativeLevelsetReinitializer::IsReinitializedCell(
+                  interface_tags[i][j][k], is_last_stage)) {
+            band_cells.push_back({i, j, k});
+          }
+        } // k
+      }   // j
+    }     // i
+  }
+
+  /**
+   * @brief Gives the quality of the distance function of a node, i.e. the
+   * maximum deviation of the gradient magnitude of the level set from one in
+   * the extension band. The central differences only read the reinitialization
+   * band.
+   * @param node The node with levelset block which has to be reinitialized.
+   * @param levelset_type Level set buffer type which is reinitialized.
+   * @return The maximum deviation of |grad(phi)| from one.
+   */
+  static double DistanceFunctionDeviationOfSingleNode(
+      Node &node, InterfaceDescriptionBufferType const levelset_type) {
+    double const(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        node.GetInterfaceBlock().GetInterfaceDescriptionBuffer(
+            levelset_type, InterfaceDescription::Levelset);
+    std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        node.GetInterfaceTags(levelset_type);
+    double deviation = 0.0;
+    for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+      for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+        for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+          if (std::abs(interface_tags[i][j][k]) > ITTI(IT::ExtensionBand)) {
+            continue;
+          }
+          // the level set is given in cell sizes
+          double const gradient_x =
+              0.5 * (levelset[i + 1][j][k] - levelset[i - 1][j][k]);
+          double gradient_y = 0.0;
+          double gradient_z = 0.0;
+          if constexpr (CC::DIM() != Dimension::One) {
+            gradient_y = 0.5 * (levelset[i][j + 1][k] - levelset[i][j - 1][k]);
+          }
+          if constexpr (CC::DIM() == Dimension::Three) {
+            gradient_z = 0.5 * (levelset[i][j][k + 1] - levelset[i][j][k - 1]);
+          }
+          double const gradient_magnitude =
+              std::sqrt(DimensionAwareConsistencyManagedSum(
+                  gradient_x * gradient_x, gradient_y * gradient_y,
+                  gradient_z * gradient_z));
+          deviation = std::max(deviation, std::abs(gradient_magnitude - 1.0));
+        } // k
+      }   // j
+    }     // i
+    return deviation;
+  }
+
   /**
    * @brief Reinitializes a single-level set field as described in \cite
    * Sussman1994.
@@ -111,7 +191,55 @@ class IterativeLevelsetReinitializerBase
           InterfaceDescriptionBufferType::RightHandSide>(nodes);
     }
 
+    // The cells to be updated are gathered once and reused in all iterations
+    std::vector<std::vector<std::array<unsigned int, 3>>> band_cells(
+        nodes.size());
+    long const number_of_nodes = static_cast<long>(nodes.size());
+#pragma omp parallel for schedule(dynamic)
+    for (long n = 0; n < number_of_nodes; ++n) {
+      CollectBandCellsOfSingleNode(nodes[n], levelset_type, is_last_stage,
+                                   band_cells[n]);
+    }
+
+    // Nodes whose level set is still close to a distance function are skipped
+    // for a limited number of reinitializations ( char entries, as they are
+    // written concurrently )
+    std::vector<char> skipped(nodes.size(), false);
+    if constexpr (ReinitializationConstants::SkipWellResolvedNodes) {
+#pragma omp parallel for schedule(dynamic)
+      for (long n = 0; n < number_of_nodes; ++n) {
+        InterfaceBlock &interface_block = nodes[n].get().GetInterfaceBlock();
+        unsigned int const skipped_reinitializations =
+            interface_block.GetSkippedReinitializations();
+        skipped[n] =
+            skipped_reinitializations <
+                ReinitializationConstants::MaximumSkippedReinitializations &&
+            DistanceFunctionDeviationOfSingleNode(nodes[n], levelset_type) <=
+                ReinitializationConstants::MaximumGradientDeviation;
+        interface_block.SetSkippedReinitializations(
+            skipped[n] ? skipped_reinitializations + 1 : 0);
+      }
+    }
+
+    // Nodes which converged together with all nodes their halos are filled
+    // from are frozen, i.e. neither iterated nor halo updated anymore
+    constexpr bool freeze_nodes =
+        ReinitializationConstants::TrackConvergence &&
+        ReinitializationConstants::FreezeConvergedNodes;
+    std::vector<nid_t> ids;
+    std::vector<std::vector<std::size_t>> neighbors;
+    std::vector<bool> has_mpi_boundary;
+    std::vector<bool> frozen(nodes.size(), false);
+    std::vector<nid_t> frozen_ids;
+    std::vector<double> node_residuum(nodes.size(), 0.0);
+    if constexpr (freeze_nodes) {
+      halo_manager_.InterfaceHaloDependenciesOnLmax(nodes, ids, neighbors,
+                                                    has_mpi_boundary);
+    }
+
     // Carry out the actual reinitialization procedure
+    static_assert(ReinitializationConstants::ConvergenceCheckInterval > 0,
+                  "The convergence check interval must be positive");
     double residuum = 0.0;
     for (unsigned int iteration_number = 0;
          iteration_number <
@@ -121,19 +249,45 @@ class IterativeLevelsetReinitializerBase
       if constexpr (ReinitializationConstants::TrackConvergence) {
         residuum = 0.0;
       }
-      for (auto &node : nodes) {
-        residuum = std::max(
-            residuum,
+      // the nodes only read their own halos, which are updated in between
+      // the sweeps by the master thread
+#pragma omp parallel for schedule(dynamic) reduction(max : residuum)
+      for (long n = 0; n < number_of_nodes; ++n) {
+        if (frozen[n] || skipped[n]) {
+          continue;
+        }
+        node_residuum[n] =
             static_cast<DerivedIterativeLevelsetReinitializer const &>(*this)
-                .ReinitializeSingleNodeImplementation(node, levelset_type,
-                                                      is_last_stage));
+                .ReinitializeSingleNodeImplementation(nodes[n], levelset_type,
+                                                      band_cells[n]);
+        residuum = std::max(residuum, node_residuum[n]);
+      }
+
+      // The global residuum is only checked every few iterations, its
+      // reduction runs during the halo update
+      bool const check_convergence =
+          ReinitializationConstants::TrackConvergence &&
+          ((iteration_number + 1) %
+                   ReinitializationConstants::ConvergenceCheckInterval ==
+               0 ||
+           iteration_number ==
+               ReinitializationConstants::MaximumNumberOfIterations - 1);
+      ReductionBatch convergence;
+      std::size_t const residuum_handle = convergence.AddMaximum(residuum);
+      if (check_convergence) {
+        convergence.Start();
       }
 
       // halo update
-      halo_manager_.InterfaceHaloUpdateOnLmax(levelset_buffer_type);
-      if constexpr (ReinitializationConstants::TrackConvergence) {
-        MPI_Allreduce(MPI_IN_PLACE, &residuum, 1, MPI_DOUBLE, MPI_MAX,
-                      MPI_COMM_WORLD);
+      if constexpr (freeze_nodes) {
+        halo_manager_.InterfaceHaloUpdateOnLmax(levelset_buffer_type,
+                                                frozen_ids);
+      } else {
+        halo_manager_.InterfaceHaloUpdateOnLmax(levelset_buffer_type);
+      }
+      if (check_convergence) {
+        convergence.Wait();
+        residuum = convergence.Maximum(residuum_handle);
 
         if (residuum < ReinitializationConstants::MaximumResiduum) {
           if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
@@ -149,10 +303,16 @@ class IterativeLevelsetReinitializerBase
           }
         }
       }
+      if constexpr (freeze_nodes) {
+        ConvergedNodeFreezing::UpdateFrozenNodes(
+            node_residuum, ReinitializationConstants::MaximumResiduum, ids,
+            neighbors, has_mpi_boundary, frozen, frozen_ids);
+      }
     }
 
-    for (auto &node : nodes) {
-      CutOffSingleNode(node, levelset_type);
+#pragma omp parallel for schedule(dynamic)
+    for (long n = 0; n < number_of_nodes; ++n) {
+      CutOffSingleNode(nodes[n], levelset_type);
     }
     halo_manager_.InterfaceHaloUpdateOnLmax(levelset_buffer_type);
   }
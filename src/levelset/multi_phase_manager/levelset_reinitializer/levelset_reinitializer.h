@@ -27,6 +27,7 @@
 #include "levelset/geometry/geometry_calculator_marching_cubes.h"
 #include "materials/material_manager.h"
 #include "user_specifications/numerical_setup.h"
+#include "utilities/runtime_profiler.h"
 
 /**
  * @brief The class LevelsetReinitializer ensures the (signed-)distance property
@@ -71,6 +72,7 @@ public:
   void Reinitialize(std::vector<std::reference_wrapper<Node>> const &nodes,
                     InterfaceDescriptionBufferType const levelset_type,
                     bool const is_last_stage) const {
+    ProfileRegion const region("Reinitialize");
     static_cast<DerivedLevelsetReinitializer const &>(*this)
         .ReinitializeImplementation(nodes, levelset_type, is_last_stage);
   }
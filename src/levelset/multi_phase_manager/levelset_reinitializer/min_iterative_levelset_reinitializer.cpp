@@ -196,18 +196,19 @@ GetSubcellFixNegative(double const (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()],
  * Min2010.
  * @param node The node with levelset block which has to be reinitialized.
  * @param levelset_type  Level-set field type that is reinitialized.
+ * @param band_cells Indices of the cells to be reinitialized.
  * @return The residuum for the current node.
  */
 double MinIterativeLevelsetReinitializer::ReinitializeSingleNodeImplementation(
     Node &node, InterfaceDescriptionBufferType const levelset_type,
-    bool const) const {
+    std::vector<std::array<unsigned int, 3>> const &band_cells) const {
 
   std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       node.GetInterfaceTags(levelset_type);
   InterfaceBlock &interface_block = node.GetInterfaceBlock();
   double(&levelset_orig)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       interface_block.GetInterfaceDescriptionBuffer(
-          levelset_type)[InterfaceDescription::Levelset];
+          levelset_type, InterfaceDescription::Levelset);
   double const(&levelset_0_orig)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       interface_block.GetRightHandSideBuffer(InterfaceDescription::Levelset);
 
@@ -226,145 +227,111 @@ double MinIterativeLevelsetReinitializer::ReinitializeSingleNodeImplementation(
     }
   }
 
-  for (unsigned int i = 0; i < CC::TCX(); ++i) {
-    for (unsigned int j = 0; j < CC::TCY(); ++j) {
-      for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-        reinitialization_rhs[i][j][k] = 0.0;
-      } // k
-    }   // j
-  }     // i
-
-  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-        old_levelset_sign = Signum(levelset_0_orig[i][j][k]);
-        if (std::abs(interface_tags[i][j][k]) > ITTI(IT::NewCutCell)) {
-
-          if (levelset_orig[i][j][k] * levelset_orig[i - 1][j][k] > 0.0 ||
-              !subcell_fix_active_) {
-            derivatives[0][0] =
-                levelset_orig[i][j][k] - levelset_orig[i - 1][j][k];
-            derivatives[0][0] += 0.5 * GetMinModOfSecondDerivative(
-                                           levelset_orig, i - 1, j, k, 1, 0, 0);
-          } else {
-            // subcell fix
-            fix_value =
-                GetSubcellFixNegative(levelset_0_orig, i, j, k, 1, 0, 0);
-            derivatives[0][0] = levelset_orig[i][j][k] / fix_value;
-            derivatives[0][0] += 0.5 * fix_value *
-                                 GetMinModOfSecondDerivative(
+  for (auto const &[i, j, k] : band_cells) {
+    old_levelset_sign = Signum(levelset_0_orig[i][j][k]);
+
+    if (levelset_orig[i][j][k] * levelset_orig[i - 1][j][k] > 0.0 ||
+        !subcell_fix_active_) {
+      derivatives[0][0] = levelset_orig[i][j][k] - levelset_orig[i - 1][j][k];
+      derivatives[0][0] += 0.5 * GetMinModOfSecondDerivative(
                                      levelset_orig, i - 1, j, k, 1, 0, 0);
-          }
-
-          if (levelset_orig[i + 1][j][k] * levelset_orig[i][j][k] > 0.0 ||
-              !subcell_fix_active_) {
-            derivatives[0][1] =
-                levelset_orig[i + 1][j][k] - levelset_orig[i][j][k];
-            derivatives[0][1] -= 0.5 * GetMinModOfSecondDerivative(
-                                           levelset_orig, i, j, k, 1, 0, 0);
-          } else {
-            // subcell fix
-            fix_value =
-                GetSubcellFixPositive(levelset_0_orig, i, j, k, 1, 0, 0);
-            derivatives[0][1] = -levelset_orig[i][j][k] / fix_value;
-            derivatives[0][1] -=
-                0.5 * fix_value *
-                GetMinModOfSecondDerivative(levelset_orig, i, j, k, 1, 0, 0);
-          }
-
-          if constexpr (CC::DIM() != Dimension::One) {
-            if (levelset_orig[i][j][k] * levelset_orig[i][j - 1][k] > 0.0 ||
-                !subcell_fix_active_) {
-              derivatives[1][0] =
-                  levelset_orig[i][j][k] - levelset_orig[i][j - 1][k];
-              derivatives[1][0] +=
-                  0.5 * GetMinModOfSecondDerivative(levelset_orig, i, j - 1, k,
-                                                    0, 1, 0);
-            } else {
-              // subcell fix
-              fix_value =
-                  GetSubcellFixNegative(levelset_0_orig, i, j, k, 0, 1, 0);
-              derivatives[1][0] = levelset_orig[i][j][k] / fix_value;
-              derivatives[1][0] += 0.5 * fix_value *
-                                   GetMinModOfSecondDerivative(
+    } else {
+      // subcell fix
+      fix_value = GetSubcellFixNegative(levelset_0_orig, i, j, k, 1, 0, 0);
+      derivatives[0][0] = levelset_orig[i][j][k] / fix_value;
+      derivatives[0][0] +=
+          0.5 * fix_value *
+          GetMinModOfSecondDerivative(levelset_orig, i - 1, j, k, 1, 0, 0);
+    }
+
+    if (levelset_orig[i + 1][j][k] * levelset_orig[i][j][k] > 0.0 ||
+        !subcell_fix_active_) {
+      derivatives[0][1] = levelset_orig[i + 1][j][k] - levelset_orig[i][j][k];
+      derivatives[0][1] -=
+          0.5 * GetMinModOfSecondDerivative(levelset_orig, i, j, k, 1, 0, 0);
+    } else {
+      // subcell fix
+      fix_value = GetSubcellFixPositive(levelset_0_orig, i, j, k, 1, 0, 0);
+      derivatives[0][1] = -levelset_orig[i][j][k] / fix_value;
+      derivatives[0][1] -=
+          0.5 * fix_value *
+          GetMinModOfSecondDerivative(levelset_orig, i, j, k, 1, 0, 0);
+    }
+
+    if constexpr (CC::DIM() != Dimension::One) {
+      if (levelset_orig[i][j][k] * levelset_orig[i][j - 1][k] > 0.0 ||
+          !subcell_fix_active_) {
+        derivatives[1][0] = levelset_orig[i][j][k] - levelset_orig[i][j - 1][k];
+        derivatives[1][0] += 0.5 * GetMinModOfSecondDerivative(
                                        levelset_orig, i, j - 1, k, 0, 1, 0);
-            }
-
-            if (levelset_orig[i][j + 1][k] * levelset_orig[i][j][k] > 0.0 ||
-                !subcell_fix_active_) {
-              derivatives[1][1] =
-                  levelset_orig[i][j + 1][k] - levelset_orig[i][j][k];
-              derivatives[1][1] -= 0.5 * GetMinModOfSecondDerivative(
-                                             levelset_orig, i, j, k, 0, 1, 0);
-            } else {
-              // subcell fix
-              fix_value =
-                  GetSubcellFixPositive(levelset_0_orig, i, j, k, 0, 1, 0);
-              derivatives[1][1] = -levelset_orig[i][j][k] / fix_value;
-              derivatives[1][1] -=
-                  0.5 * fix_value *
-                  GetMinModOfSecondDerivative(levelset_orig, i, j, k, 0, 1, 0);
-            }
-          }
-
-          if constexpr (CC::DIM() == Dimension::Three) {
-            if (levelset_orig[i][j][k] * levelset_orig[i][j][k - 1] > 0.0 ||
-                !subcell_fix_active_) {
-              derivatives[2][0] =
-                  levelset_orig[i][j][k] - levelset_orig[i][j][k - 1];
-              derivatives[2][0] +=
-                  0.5 * GetMinModOfSecondDerivative(levelset_orig, i, j, k - 1,
-                                                    0, 0, 1);
-            } else {
-              // subcell fix
-              fix_value =
-                  GetSubcellFixNegative(levelset_0_orig, i, j, k, 0, 0, 1);
-              derivatives[2][0] = levelset_orig[i][j][k] / fix_value;
-              derivatives[2][0] += 0.5 * fix_value *
-                                   GetMinModOfSecondDerivative(
+      } else {
+        // subcell fix
+        fix_value = GetSubcellFixNegative(levelset_0_orig, i, j, k, 0, 1, 0);
+        derivatives[1][0] = levelset_orig[i][j][k] / fix_value;
+        derivatives[1][0] +=
+            0.5 * fix_value *
+            GetMinModOfSecondDerivative(levelset_orig, i, j - 1, k, 0, 1, 0);
+      }
+
+      if (levelset_orig[i][j + 1][k] * levelset_orig[i][j][k] > 0.0 ||
+          !subcell_fix_active_) {
+        derivatives[1][1] = levelset_orig[i][j + 1][k] - levelset_orig[i][j][k];
+        derivatives[1][1] -=
+            0.5 * GetMinModOfSecondDerivative(levelset_orig, i, j, k, 0, 1, 0);
+      } else {
+        // subcell fix
+        fix_value = GetSubcellFixPositive(levelset_0_orig, i, j, k, 0, 1, 0);
+        derivatives[1][1] = -levelset_orig[i][j][k] / fix_value;
+        derivatives[1][1] -=
+            0.5 * fix_value *
+            GetMinModOfSecondDerivative(levelset_orig, i, j, k, 0, 1, 0);
+      }
+    }
+
+    if constexpr (CC::DIM() == Dimension::Three) {
+      if (levelset_orig[i][j][k] * levelset_orig[i][j][k - 1] > 0.0 ||
+          !subcell_fix_active_) {
+        derivatives[2][0] = levelset_orig[i][j][k] - levelset_orig[i][j][k - 1];
+        derivatives[2][0] += 0.5 * GetMinModOfSecondDerivative(
                                        levelset_orig, i, j, k - 1, 0, 0, 1);
-            }
-
-            if (levelset_orig[i][j][k + 1] * levelset_orig[i][j][k] > 0.0 ||
-                !subcell_fix_active_) {
-              derivatives[2][1] =
-                  levelset_orig[i][j][k + 1] - levelset_orig[i][j][k];
-              derivatives[2][1] -= 0.5 * GetMinModOfSecondDerivative(
-                                             levelset_orig, i, j, k, 0, 0, 1);
-            } else {
-              // subcell fix
-              fix_value =
-                  GetSubcellFixPositive(levelset_0_orig, i, j, k, 0, 0, 1);
-              derivatives[2][1] = -levelset_orig[i][j][k] / fix_value;
-              derivatives[2][1] -=
-                  0.5 * fix_value *
-                  GetMinModOfSecondDerivative(levelset_orig, i, j, k, 0, 0, 1);
-            }
-          }
-
-          increment =
-              ReinitializationConstants::Dtau * old_levelset_sign *
-              (1.0 - GodunovHamiltonian(derivatives, old_levelset_sign));
-          if (ReinitializationConstants::TrackConvergence &&
-              std::abs(interface_tags[i][j][k]) <
-                  ITTI(IT::ReinitializationBand)) {
-            residuum = std::max(residuum, std::abs(increment));
-          }
-
-          reinitialization_rhs[i][j][k] = increment;
-        }
-      } // k
-    }   // j
-  }     // i
+      } else {
+        // subcell fix
+        fix_value = GetSubcellFixNegative(levelset_0_orig, i, j, k, 0, 0, 1);
+        derivatives[2][0] = levelset_orig[i][j][k] / fix_value;
+        derivatives[2][0] +=
+            0.5 * fix_value *
+            GetMinModOfSecondDerivative(levelset_orig, i, j, k - 1, 0, 0, 1);
+      }
+
+      if (levelset_orig[i][j][k + 1] * levelset_orig[i][j][k] > 0.0 ||
+          !subcell_fix_active_) {
+        derivatives[2][1] = levelset_orig[i][j][k + 1] - levelset_orig[i][j][k];
+        derivatives[2][1] -=
+            0.5 * GetMinModOfSecondDerivative(levelset_orig, i, j, k, 0, 0, 1);
+      } else {
+        // subcell fix
+        fix_value = GetSubcellFixPositive(levelset_0_orig, i, j, k, 0, 0, 1);
+        derivatives[2][1] = -levelset_orig[i][j][k] / fix_value;
+        derivatives[2][1] -=
+            0.5 * fix_value *
+            GetMinModOfSecondDerivative(levelset_orig, i, j, k, 0, 0, 1);
+      }
+    }
+
+    increment = ReinitializationConstants::Dtau * old_levelset_sign *
+                (1.0 - GodunovHamiltonian(derivatives, old_levelset_sign));
+    if (ReinitializationConstants::TrackConvergence &&
+        std::abs(interface_tags[i][j][k]) < ITTI(IT::ReinitializationBand)) {
+      residuum = std::max(residuum, std::abs(increment));
+    }
+
+    reinitialization_rhs[i][j][k] = increment;
+  }
 
   // add to level-set and also the residuum
-  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-        levelset_orig[i][j][k] += reinitialization_rhs[i][j][k];
-      } // k
-    }   // j
-  }     // i
+  for (auto const &[i, j, k] : band_cells) {
+    levelset_orig[i][j][k] += reinitialization_rhs[i][j][k];
+  }
 
   return residuum;
 }
@@ -39,10 +39,19 @@ class MinIterativeLevelsetReinitializer
    */
   static constexpr bool subcell_fix_active_ = false;
 
+  /**
+   * @brief Indicates whether a cell is updated in the reinitialization sweeps.
+   * @param interface_tag The interface tag of the cell.
+   * @return True if the cell is reinitialized.
+   */
+  static bool IsReinitializedCell(std::int8_t const interface_tag, bool const) {
+    return std::abs(interface_tag) > ITTI(IT::NewCutCell);
+  }
+
 protected:
   double ReinitializeSingleNodeImplementation(
       Node &node, InterfaceDescriptionBufferType const levelset_type,
-      bool const) const;
+      std::vector<std::array<unsigned int, 3>> const &band_cells) const;
 
 public:
   MinIterativeLevelsetReinitializer() = delete;
@@ -51,12 +51,12 @@ WenoIterativeLevelsetReinitializer::WenoIterativeLevelsetReinitializer(
  * @brief Reinitializes the levelset field of a node using a HJ WENO scheme.
  * @param node The node with levelset block which has to be reinitialized.
  * @param levelset_type  Level-set field type that is reinitialized.
- * @param is_last_stage Return whether it's the last RK stage or not.
+ * @param band_cells Indices of the cells to be reinitialized.
  * @return The residuum for the current node.
  */
 double WenoIterativeLevelsetReinitializer::ReinitializeSingleNodeImplementation(
     Node &node, InterfaceDescriptionBufferType const levelset_type,
-    bool const is_last_stage) const {
+    std::vector<std::array<unsigned int, 3>> const &band_cells) const {
 
   using ReconstructionStencil = ReconstructionStencilSetup::Concretize<
       levelset_reconstruction_stencil>::type;
@@ -66,7 +66,7 @@ double WenoIterativeLevelsetReinitializer::ReinitializeSingleNodeImplementation(
   InterfaceBlock &interface_block = node.GetInterfaceBlock();
   double(&levelset_orig)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       interface_block.GetInterfaceDescriptionBuffer(
-          levelset_type)[InterfaceDescription::Levelset];
+          levelset_type, InterfaceDescription::Levelset);
   double const(&levelset_0_orig)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       interface_block.GetRightHandSideBuffer(InterfaceDescription::Levelset);
 
@@ -81,76 +81,53 @@ double WenoIterativeLevelsetReinitializer::ReinitializeSingleNodeImplementation(
     }
   }
 
-  for (unsigned int i = 0; i < CC::TCX(); ++i) {
-    for (unsigned int j = 0; j < CC::TCY(); ++j) {
-      for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-        reinitialization_rhs[i][j][k] = 0.0;
-      } // k
-    }   // j
-  }     // i
-
-  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-        if (std::abs(interface_tags[i][j][k]) > ITTI(IT::NewCutCell) ||
-            (ReinitializationConstants::ReinitializeCutCells &&
-             is_last_stage)) {
-
-          // We normalize the level-set field on the cell size, thus 1.0 is
-          // necessary as cell size for stencil evaluation.
-          derivatives[0][0] =
-              SU::Derivative<ReconstructionStencil, SP::UpwindLeft,
-                             Direction::X>(levelset_orig, i, j, k, 1.0);
-          derivatives[0][1] =
-              SU::Derivative<ReconstructionStencil, SP::UpwindRight,
-                             Direction::X>(levelset_orig, i, j, k, 1.0);
-
-          if constexpr (CC::DIM() != Dimension::One) {
-            derivatives[1][0] =
-                SU::Derivative<ReconstructionStencil, SP::UpwindLeft,
-                               Direction::Y>(levelset_orig, i, j, k, 1.0);
-            derivatives[1][1] =
-                SU::Derivative<ReconstructionStencil, SP::UpwindRight,
-                               Direction::Y>(levelset_orig, i, j, k, 1.0);
-          }
+  for (auto const &[i, j, k] : band_cells) {
+    // We normalize the level-set field on the cell size, thus 1.0 is
+    // necessary as cell size for stencil evaluation.
+    derivatives[0][0] =
+        SU::Derivative<ReconstructionStencil, SP::UpwindLeft, Direction::X>(
+            levelset_orig, i, j, k, 1.0);
+    derivatives[0][1] =
+        SU::Derivative<ReconstructionStencil, SP::UpwindRight, Direction::X>(
+            levelset_orig, i, j, k, 1.0);
+
+    if constexpr (CC::DIM() != Dimension::One) {
+      derivatives[1][0] =
+          SU::Derivative<ReconstructionStencil, SP::UpwindLeft, Direction::Y>(
+              levelset_orig, i, j, k, 1.0);
+      derivatives[1][1] =
+          SU::Derivative<ReconstructionStencil, SP::UpwindRight, Direction::Y>(
+              levelset_orig, i, j, k, 1.0);
+    }
 
-          if constexpr (CC::DIM() == Dimension::Three) {
-            derivatives[2][0] =
-                SU::Derivative<ReconstructionStencil, SP::UpwindLeft,
-                               Direction::Z>(levelset_orig, i, j, k, 1.0);
-            derivatives[2][1] =
-                SU::Derivative<ReconstructionStencil, SP::UpwindRight,
-                               Direction::Z>(levelset_orig, i, j, k, 1.0);
-          }
+    if constexpr (CC::DIM() == Dimension::Three) {
+      derivatives[2][0] =
+          SU::Derivative<ReconstructionStencil, SP::UpwindLeft, Direction::Z>(
+              levelset_orig, i, j, k, 1.0);
+      derivatives[2][1] =
+          SU::Derivative<ReconstructionStencil, SP::UpwindRight, Direction::Z>(
+              levelset_orig, i, j, k, 1.0);
+    }
 
-          double const old_levelset_sign = Signum(levelset_0_orig[i][j][k]);
-          double const godunov_hamiltonian =
-              GodunovHamiltonian(derivatives, old_levelset_sign);
-          double const advection_velocity =
-              ComputeAdvectionVelocity(levelset_0_orig[i][j][k]);
-          double const increment = ReinitializationConstants::Dtau *
-                                   advection_velocity *
-                                   (1.0 - godunov_hamiltonian);
-          if (ReinitializationConstants::TrackConvergence &&
-              std::abs(interface_tags[i][j][k]) <
-                  ITTI(IT::ReinitializationBand)) {
-            residuum = std::max(residuum, std::abs(increment));
-          }
+    double const old_levelset_sign = Signum(levelset_0_orig[i][j][k]);
+    double const godunov_hamiltonian =
+        GodunovHamiltonian(derivatives, old_levelset_sign);
+    double const advection_velocity =
+        ComputeAdvectionVelocity(levelset_0_orig[i][j][k]);
+    double const increment = ReinitializationConstants::Dtau *
+                             advection_velocity * (1.0 - godunov_hamiltonian);
+    if (ReinitializationConstants::TrackConvergence &&
+        std::abs(interface_tags[i][j][k]) < ITTI(IT::ReinitializationBand)) {
+      residuum = std::max(residuum, std::abs(increment));
+    }
 
-          reinitialization_rhs[i][j][k] = increment;
-        }
-      } // k
-    }   // j
-  }     // i
+    reinitialization_rhs[i][j][k] = increment;
+  }
 
   // add to level-set and also the residuum
-  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-        levelset_orig[i][j][k] += reinitialization_rhs[i][j][k];
-      } // k
-    }   // j
-  }     // i
+  for (auto const &[i, j, k] : band_cells) {
+    levelset_orig[i][j][k] += reinitialization_rhs[i][j][k];
+  }
 
   return residuum;
 }
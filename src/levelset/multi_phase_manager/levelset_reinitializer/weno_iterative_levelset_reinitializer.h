@@ -34,10 +34,22 @@ class WenoIterativeLevelsetReinitializer
 
   friend IterativeLevelsetReinitializerBase;
 
+  /**
+   * @brief Indicates whether a cell is updated in the reinitialization sweeps.
+   * @param interface_tag The interface tag of the cell.
+   * @param is_last_stage Whether it's the last RK stage or not.
+   * @return True if the cell is reinitialized.
+   */
+  static bool IsReinitializedCell(std::int8_t const interface_tag,
+                                  bool const is_last_stage) {
+    return std::abs(interface_tag) > ITTI(IT::NewCutCell) ||
+           (ReinitializationConstants::ReinitializeCutCells && is_last_stage);
+  }
+
 protected:
   double ReinitializeSingleNodeImplementation(
       Node &node, InterfaceDescriptionBufferType const levelset_type,
-      bool const is_last_stage) const;
+      std::vector<std::array<unsigned int, 3>> const &band_cells) const;
 
 public:
   WenoIterativeLevelsetReinitializer() = delete;
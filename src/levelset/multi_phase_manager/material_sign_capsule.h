@@ -29,6 +29,9 @@
  * material sign where needed. It is the user's responsibility to call functions
  * only after initialization (currently done in the constructor of the material
  * manager class that holds all information for the two materials).
+ * @note The signs are process-wide rather than part of a SimulationContext, as
+ * they are queried in the innermost loops. Simulations run concurrently in one
+ * process must therefore have the same number of materials.
  */
 class MaterialSignCapsule {
 
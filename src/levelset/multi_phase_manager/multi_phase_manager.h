@@ -23,6 +23,7 @@
 #define MULTI_PHASE_MANAGER_H
 
 #include "communication/communication_manager.h"
+#include "enums/interface_tag_definition.h"
 #include "interface_interaction/interface_state_calculator.h"
 #include "materials/material_manager.h"
 #include "user_specifications/numerical_setup.h"
@@ -209,6 +210,57 @@ public:
   void TransformToConservatives(Node &node) const {
     buffer_handler_.TransformToConservatives(node);
   }
+
+  /**
+   * @brief Computes the interface normals and the cell-face apertures of the
+   * cells close to the interface and stores them in the geometry cache of the
+   * interface block. With the height-function curvature estimator also the
+   * curvature of the cut cells is cached. Has to be called once the
+   * reinitialized level-set field and the interface tags of a stage are final.
+   * @param nodes The nodes for which the geometry is cached.
+   */
+  void UpdateGeometryCache(
+      std::vector<std::reference_wrapper<Node>> const &nodes) const {
+    for (Node &node : nodes) {
+      std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+          node.GetInterfaceTags<
+              InterfaceDescriptionBufferType::Reinitialized>();
+      InterfaceBlock &interface_block = node.GetInterfaceBlock();
+      double const(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+          interface_block.GetReinitializedBuffer(
+              InterfaceDescription::Levelset);
+      InterfaceGeometryCache &cache = interface_block.GetGeometryCache();
+
+      cache.Invalidate();
+      // the cell-face fluxes are weighted including the first halo cell
+      std::vector<std::array<unsigned int, 3>> cut_cells;
+      for (std::array<unsigned int, 3> const &cell :
+           interface_block.GetCutCellList().Cells(interface_tags, cut_cells)) {
+        unsigned int const i = cell[0];
+        unsigned int const j = cell[1];
+        unsigned int const k = cell[2];
+        if (i <= CC::LICX() && j <= CC::LICY() && k <= CC::LICZ()) {
+          std::array<double, 3> const normal = GetNormal(levelset, i, j, k);
+          double curvature = 0.0;
+          bool has_curvature = false;
+          if constexpr (CC::CapillaryForcesActive() &&
+                        GeometryCalculationSettings::CurvatureEstimator ==
+                            CurvatureEstimator::HeightFunction) {
+            if (CutCellList::IsInternal(cell) &&
+                std::abs(interface_tags[i][j][k]) <= ITTI(IT::NewCutCell)) {
+              has_curvature = ComputeHeightFunctionInterfaceCurvature(
+                  node, i, j, k, normal, curvature);
+            }
+          }
+          cache.Add(
+              i, j, k,
+              geometry_calculator_.ComputeCellFaceAperture(levelset, i, j, k),
+              normal, curvature, has_curvature);
+        }
+      }
+      cache.Validate();
+    }
+  }
 };
 
 #endif // MULTI_PHASE_MANAGER_H
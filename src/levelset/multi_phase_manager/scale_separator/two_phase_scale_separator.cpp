@@ -167,6 +167,48 @@ GetResolvedValue(double const (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()],
   return resolved_value;
 }
 
+/**
+ * @brief Determines the bounding box of the cells that may take part in the
+ * scale separation, i.e. cut cells, cells with a level-set value below the
+ * scale separation threshold and cells already tagged as scale separated. Cells
+ * outside the box are left untouched by the scale separation procedure.
+ * @param levelset The level-set field of the block.
+ * @param interface_tags The interface tags of the block.
+ * @param box_begin First cell of the box in each direction (indirect return
+ * parameter).
+ * @param box_end One past the last cell of the box in each direction (indirect
+ * return parameter).
+ * @return False if the box is empty, i.e. the block is not affected by the
+ * scale separation, true otherwise.
+ */
+bool CandidateBox(
+    double const (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    std::array<unsigned int, 3> &box_begin,
+    std::array<unsigned int, 3> &box_end) {
+  box_begin = {CC::TCX(), CC::TCY(), CC::TCZ()};
+  box_end = {0, 0, 0};
+  for (unsigned int i = CC::FICX() - i_offset; i < CC::LICX() + i_offset + 1;
+       ++i) {
+    for (unsigned int j = CC::FICY() - j_offset; j < CC::LICY() + j_offset + 1;
+         ++j) {
+      for (unsigned int k = CC::FICZ() - k_offset;
+           k < CC::LICZ() + k_offset + 1; ++k) {
+        std::int8_t const tag = std::abs(interface_tags[i][j][k]);
+        if (tag <= ITTI(IT::NewCutCell) ||
+            tag == ITTI(IT::ScaleSeparatedCell) ||
+            std::abs(levelset[i][j][k]) < stimulus_response_constant) {
+          box_begin = {std::min(box_begin[0], i), std::min(box_begin[1], j),
+                       std::min(box_begin[2], k)};
+          box_end = {std::max(box_end[0], i + 1), std::max(box_end[1], j + 1),
+                     std::max(box_end[2], k + 1)};
+        }
+      } // k
+    }   // j
+  }     // i
+  return box_begin[0] < box_end[0];
+}
+
 /**
  * @brief Performs a scale separation procedure according to \cite Luo2016.
  * @param node The node for which scale separation is done.
@@ -185,6 +227,15 @@ void ScaleSeparationProcedure(Node &node,
                 InterfaceDescriptionBufferType::Reinitialized>()
           : node.GetInterfaceTags<InterfaceDescriptionBufferType::Integrated>();
 
+  // Only cells close to the interface are affected, blocks with the interface
+  // in their halo only are skipped entirely
+  std::array<unsigned int, 3> box_begin;
+  std::array<unsigned int, 3> box_end;
+  if (!CandidateBox(levelset_reinitialized, interface_tags, box_begin,
+                    box_end)) {
+    return;
+  }
+
   std::int8_t interface_tags_positive_shift[CC::TCX()][CC::TCY()][CC::TCZ()];
   std::int8_t interface_tags_negative_shift[CC::TCX()][CC::TCY()][CC::TCZ()];
 
@@ -212,10 +263,20 @@ void ScaleSeparationProcedure(Node &node,
    * can be done in
    * 1. inner cells
    * 2. halo cells except for the last layer of halo cells
+   * They are only read within the stencil width around the candidate box.
    */
-  for (unsigned int i = i_lower; i < i_upper; ++i) {
-    for (unsigned int j = j_lower; j < j_upper; ++j) {
-      for (unsigned int k = k_lower; k < k_upper; ++k) {
+  unsigned int const i_begin =
+      std::max(int(i_lower), int(box_begin[0]) - stencil_width_i);
+  unsigned int const j_begin =
+      std::max(int(j_lower), int(box_begin[1]) - stencil_width_j);
+  unsigned int const k_begin =
+      std::max(int(k_lower), int(box_begin[2]) - stencil_width_k);
+  unsigned int const i_end = std::min(i_upper, box_end[0] + stencil_width_i);
+  unsigned int const j_end = std::min(j_upper, box_end[1] + stencil_width_j);
+  unsigned int const k_end = std::min(k_upper, box_end[2] + stencil_width_k);
+  for (unsigned int i = i_begin; i < i_end; ++i) {
+    for (unsigned int j = j_begin; j < j_end; ++j) {
+      for (unsigned int k = k_begin; k < k_end; ++k) {
         if (IsCutCell<GeometryCalculationSettings::CutCellCriteria>(
                 levelset_positive_shift, i, j, k))
           interface_tags_positive_shift[i][j][k] = ITTI(IT::OldCutCell);
@@ -229,12 +290,9 @@ void ScaleSeparationProcedure(Node &node,
   /**
    * Determine non-resolved cells.
    */
-  for (unsigned int i = CC::FICX() - i_offset; i < CC::LICX() + i_offset + 1;
-       ++i) {
-    for (unsigned int j = CC::FICY() - j_offset; j < CC::LICY() + j_offset + 1;
-         ++j) {
-      for (unsigned int k = CC::FICZ() - k_offset;
-           k < CC::LICZ() + k_offset + 1; ++k) {
+  for (unsigned int i = box_begin[0]; i < box_end[0]; ++i) {
+    for (unsigned int j = box_begin[1]; j < box_end[1]; ++j) {
+      for (unsigned int k = box_begin[2]; k < box_end[2]; ++k) {
 
         std::int8_t flag_sign_change = 0;
 
@@ -299,9 +357,12 @@ void ScaleSeparationProcedure(Node &node,
    * Calculate scale separated levelset field.
    */
   int flag = 0;
-  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+  for (unsigned int i = std::max(CC::FICX(), box_begin[0]);
+       i < std::min(CC::LICX() + 1, box_end[0]); ++i) {
+    for (unsigned int j = std::max(CC::FICY(), box_begin[1]);
+         j < std::min(CC::LICY() + 1, box_end[1]); ++j) {
+      for (unsigned int k = std::max(CC::FICZ(), box_begin[2]);
+           k < std::min(CC::LICZ() + 1, box_end[2]); ++k) {
         if (std::abs(interface_tags[i][j][k]) == ITTI(IT::ScaleSeparatedCell)) {
 
           flag = 0;
@@ -53,7 +53,7 @@ void TwoPhaseBufferHandler::TransformToConservativesImplementation(
       double const reference_volume_fraction = (material_sign > 0) ? 0.0 : 1.0;
       double const material_sign_double = double(material_sign);
       for (Equation const eq : MF::ASOE()) {
-        double(&average_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        FieldValue(&average_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
             phase.second.GetAverageBuffer(eq);
         for (unsigned int i = 0; i < CC::TCX(); ++i) {
           for (unsigned int j = 0; j < CC::TCY(); ++j) {
@@ -88,7 +88,7 @@ void TwoPhaseBufferHandler::
     double const reference_volume_fraction = (material_sign > 0) ? 0.0 : 1.0;
     double const material_sign_double = double(material_sign);
     for (Equation const eq : MF::ASOE()) {
-      double(&conservative)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      FieldValue(&conservative)[CC::TCX()][CC::TCY()][CC::TCZ()] =
           phase.second.GetRightHandSideBuffer(eq);
       for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
         for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
@@ -51,12 +51,19 @@ TwoPhaseManager::TwoPhaseManager(MaterialManager const &material_manager,
  */
 void TwoPhaseManager::MixImplementation(
     std::vector<std::reference_wrapper<Node>> const &nodes) const {
+  long const number_of_nodes = static_cast<long>(nodes.size());
 
   // TODO-19 JW: If integration is done on total cells, this halo update can
   // possibly be left out
-  halo_manager_.MaterialHaloUpdateOnLmax(MaterialFieldType::Conservatives);
-
-  for (Node &node : nodes) {
+  // The mixed cells reach one halo cell beyond the internal ones ( see
+  // CutCellList ), their mixing targets are direct neighbors
+  constexpr unsigned int mixing_halo_depth = 2;
+  halo_manager_.MaterialHaloUpdateOnLmax(MaterialFieldType::Conservatives, true,
+                                         mixing_halo_depth);
+
+#pragma omp parallel for schedule(dynamic)
+  for (long node_index = 0; node_index < number_of_nodes; ++node_index) {
+    Node &node = nodes[node_index];
     cut_cell_mixer_.Mix(node);
     buffer_handler_.TransformToVolumeAveragedConservatives(node);
   }
@@ -71,7 +78,9 @@ void TwoPhaseManager::MixImplementation(
    * conservatives. Extension-band cells and cut-cells in which we extend: Prime
    * states of the last RK stage.
    */
-  for (Node &node : nodes) {
+#pragma omp parallel for schedule(dynamic)
+  for (long node_index = 0; node_index < number_of_nodes; ++node_index) {
+    Node &node = nodes[node_index];
     buffer_handler_.CalculatePrimesFromIntegratedConservatives(node);
   }
 }
@@ -86,6 +95,7 @@ void TwoPhaseManager::MixImplementation(
 void TwoPhaseManager::EnforceWellResolvedDistanceFunctionImplementation(
     std::vector<std::reference_wrapper<Node>> const &nodes,
     bool const is_last_stage) const {
+  long const number_of_nodes = static_cast<long>(nodes.size());
   if (CC::ScaleSeparationActive() && is_last_stage) {
     scale_separator_.SeparateScales(
         nodes, InterfaceBlockBufferType::LevelsetReinitialized);
@@ -108,14 +118,18 @@ void TwoPhaseManager::EnforceWellResolvedDistanceFunctionImplementation(
   }
 
   if (is_last_stage) {
-    for (Node &node : nodes) {
+#pragma omp parallel for schedule(dynamic)
+    for (long node_index = 0; node_index < number_of_nodes; ++node_index) {
+      Node &node = nodes[node_index];
       buffer_handler_.AdaptConservativesToWellResolvedDistanceFunction(node);
     }
     halo_manager_.MaterialHaloUpdateOnLmax(MaterialFieldType::Conservatives);
     UpdateInterfaceTagsOnFinestLevel<
         InterfaceDescriptionBufferType::Reinitialized>(nodes);
 
-    for (Node &node : nodes) {
+#pragma omp parallel for schedule(dynamic)
+    for (long node_index = 0; node_index < number_of_nodes; ++node_index) {
+      Node &node = nodes[node_index];
       SetVolumeFractionBuffer<InterfaceDescriptionBufferType::Reinitialized>(
           node);
     }
@@ -130,6 +144,7 @@ void TwoPhaseManager::EnforceWellResolvedDistanceFunctionImplementation(
  */
 void TwoPhaseManager::ExtendPrimeStatesImplementation(
     std::vector<std::reference_wrapper<Node>> const &nodes) const {
+  long const number_of_nodes = static_cast<long>(nodes.size());
 
   /** After the extension we have the following occupation of the prime-state
    * buffer: Real-material cells and cut-cells in which we do not extend: Prime
@@ -145,7 +160,9 @@ void TwoPhaseManager::ExtendPrimeStatesImplementation(
    * conservatives. Extension-band cells and cut-cells in which we extend:
    * Conservatives obtained from the extended prime states. Other cells
    * (Non-real material or narrow band cells): 0.0. */
-  for (Node &node : nodes) {
+#pragma omp parallel for schedule(dynamic)
+  for (long node_index = 0; node_index < number_of_nodes; ++node_index) {
+    Node &node = nodes[node_index];
     buffer_handler_.CalculateConservativesFromExtendedPrimes(node);
   } // nodes
 
@@ -187,11 +204,11 @@ void TwoPhaseManager::SetVolumeFractionBuffer(Node &node) const {
       node.GetInterfaceTags<T>();
 
   double const(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceBlock()
-          .GetInterfaceDescriptionBuffer<T>()[InterfaceDescription::Levelset];
+      node.GetInterfaceBlock().GetInterfaceDescriptionBuffer<T>(
+          InterfaceDescription::Levelset);
   double(&volume_fraction)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceBlock().GetInterfaceDescriptionBuffer<T>()
-          [InterfaceDescription::VolumeFraction];
+      node.GetInterfaceBlock().GetInterfaceDescriptionBuffer<T>(
+          InterfaceDescription::VolumeFraction);
 
   for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
     for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
@@ -220,6 +237,7 @@ void TwoPhaseManager::SetVolumeFractionBuffer(Node &node) const {
 void TwoPhaseManager::UpdateIntegratedBufferImplementation(
     std::vector<std::reference_wrapper<Node>> const &nodes,
     bool const is_last_stage) const {
+  long const number_of_nodes = static_cast<long>(nodes.size());
 
   /***
    * At this point in the algorithm time integration of the level-set field is
@@ -272,7 +290,9 @@ void TwoPhaseManager::UpdateIntegratedBufferImplementation(
       nodes);
 
   // Set the volume fraction buffer according to the propagated level-set field.
-  for (Node &node : nodes) {
+#pragma omp parallel for schedule(dynamic)
+  for (long node_index = 0; node_index < number_of_nodes; ++node_index) {
+    Node &node = nodes[node_index];
     SetVolumeFractionBuffer<InterfaceDescriptionBufferType::Integrated>(node);
   }
   // A halo update for the volume fractions is necessary to have also correct
@@ -287,20 +307,29 @@ void TwoPhaseManager::UpdateIntegratedBufferImplementation(
  */
 void TwoPhaseManager::PropagateLevelsetImplementation(
     std::vector<std::reference_wrapper<Node>> const &nodes) const {
+  long const number_of_nodes = static_cast<long>(nodes.size());
 
-  BO::Interface::CopyInterfaceDescriptionBufferForNodeList<
+  // The integrated buffers are entirely rewritten in the next stage ( see
+  // UpdateIntegratedBufferImplementation ), hence swapping suffices
+  BO::Interface::SwapInterfaceDescriptionBufferForNodeList<
       InterfaceDescriptionBufferType::Integrated,
       InterfaceDescriptionBufferType::Reinitialized,
       InterfaceDescription::Levelset>(nodes);
-  BO::Interface::CopyInterfaceDescriptionBufferForNodeList<
+  BO::Interface::SwapInterfaceDescriptionBufferForNodeList<
       InterfaceDescriptionBufferType::Integrated,
       InterfaceDescriptionBufferType::Reinitialized,
       InterfaceDescription::VolumeFraction>(nodes);
 
-  for (Node &node : nodes) {
+#pragma omp parallel for schedule(dynamic)
+  for (long node_index = 0; node_index < number_of_nodes; ++node_index) {
+    Node &node = nodes[node_index];
     BO::CopySingleBuffer(
         node.GetInterfaceTags<InterfaceDescriptionBufferType::Integrated>(),
         node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>());
+    // the cached geometry refers to the previous level-set field
+    node.GetInterfaceBlock().GetGeometryCache().Invalidate();
+    node.GetInterfaceBlock().GetCutCellList().Update(
+        node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>());
   }
 }
 
@@ -310,7 +339,10 @@ void TwoPhaseManager::PropagateLevelsetImplementation(
  */
 void TwoPhaseManager::InitializeVolumeFractionBufferImplementation(
     std::vector<std::reference_wrapper<Node>> const &nodes) const {
-  for (Node &node : nodes) {
+  long const number_of_nodes = static_cast<long>(nodes.size());
+#pragma omp parallel for schedule(dynamic)
+  for (long node_index = 0; node_index < number_of_nodes; ++node_index) {
+    Node &node = nodes[node_index];
     SetVolumeFractionBuffer<InterfaceDescriptionBufferType::Reinitialized>(
         node);
   }
@@ -325,13 +357,18 @@ void TwoPhaseManager::InitializeVolumeFractionBufferImplementation(
 void TwoPhaseManager::ObtainInterfaceStatesImplementation(
     std::vector<std::reference_wrapper<Node>> const &nodes,
     bool const reset_interface_states) const {
+  long const number_of_nodes = static_cast<long>(nodes.size());
   if (reset_interface_states) {
-    for (Node &node : nodes) {
+#pragma omp parallel for schedule(dynamic)
+    for (long node_index = 0; node_index < number_of_nodes; ++node_index) {
+      Node &node = nodes[node_index];
       BO::SetFieldBuffer(node.GetInterfaceBlock().GetInterfaceStateBuffer(),
                          0.0);
     }
   }
-  for (auto const &node : nodes) {
+#pragma omp parallel for schedule(dynamic)
+  for (long node_index = 0; node_index < number_of_nodes; ++node_index) {
+    Node &node = nodes[node_index];
     // solve interface Riemann problem to obtain interface velocity and
     // interface exchange terms
     interface_state_calculator_.ObtainInterfaceStates(node);
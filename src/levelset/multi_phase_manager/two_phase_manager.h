@@ -72,8 +72,8 @@ private:
 
     for (Node &node : nodes_containing_level_set) {
       InterfaceTagFunctions::SetInternalCutCellTagsFromLevelset(
-          node.GetInterfaceBlock().GetInterfaceDescriptionBuffer<IDB>()
-              [InterfaceDescription::Levelset],
+          node.GetInterfaceBlock().GetInterfaceDescriptionBuffer<IDB>(
+              InterfaceDescription::Levelset),
           node.GetInterfaceTags<IDB>());
     }
 
@@ -84,6 +84,13 @@ private:
           node.GetInterfaceTags<IDB>());
     }
     halo_manager_.InterfaceTagHaloUpdateOnLmax<IDB>();
+
+    if constexpr (IDB == InterfaceDescriptionBufferType::Reinitialized) {
+      for (Node &node : nodes_containing_level_set) {
+        node.GetInterfaceBlock().GetCutCellList().Update(
+            node.GetInterfaceTags<IDB>());
+      }
+    }
   }
 
 public:
@@ -23,11 +23,22 @@
 #include <fenv_wrapper.h> // Floating-Point raising exceptions.
 #include <filesystem>
 #include <mpi.h>
+#include <string>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
+#include "communication/communication_statistics.h"
 #include "communication/mpi_utilities.h"
+#include "dry_run_runner.h"
+#include "ensemble_runner.h"
 #include "instantiation/input_output/instantiation_input_reader.h"
 #include "instantiation/input_output/instantiation_log_writer.h"
 #include "simulation_runner.h"
+#include "user_specifications/compile_time_constants.h"
+#include "user_specifications/output_constants.h"
+#include "utilities/numa_placement.h"
 
 /**
  * @brief Starting function of ALPACA, called from the operating system.
@@ -40,30 +51,106 @@
  */
 int main(int argc, char *argv[]) {
 
-  MPI_Init(&argc, &argv);
+  // Asynchronous hdf5 writes communicate from a writer thread, otherwise they
+  // fall back to synchronous writes
+  int const requested_thread_support = Hdf5OutputSettings::AsynchronousWrites
+                                           ? MPI_THREAD_MULTIPLE
+                                           : MPI_THREAD_FUNNELED;
+#ifdef _OPENMP
+  // Only the master thread communicates, threads are used within leaf loops
+  int provided_thread_support;
+  MPI_Init_thread(&argc, &argv, requested_thread_support,
+                  &provided_thread_support);
+  if (provided_thread_support < MPI_THREAD_FUNNELED) {
+    MPI_Abort(MPI_COMM_WORLD, 1);
+  }
+#else
+  if constexpr (Hdf5OutputSettings::AsynchronousWrites) {
+    int provided_thread_support;
+    MPI_Init_thread(&argc, &argv, requested_thread_support,
+                    &provided_thread_support);
+  } else {
+    MPI_Init(&argc, &argv);
+  }
+#endif
   // Triggers signals on floating point errors, i.e. prohibits quiet NaNs and
   // alike
   feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
 
   // NH separate scope for MPI.
   {
-    LogWriter &logger =
-        Instantiation::InstantiateLogWriter(MpiUtilities::MasterRank());
+    std::vector<std::string> const arguments(argv + 1, argv + argc);
+    // ensemble run mode, e.g. --ensemble 4 case_a.xml case_b.xml runs each
+    // input file on four ranks. Only the first group writes to the terminal
+    bool const ensemble_run =
+        arguments.size() > 2 && arguments.front() == "--ensemble";
+    int const group =
+        ensemble_run ? Ensemble::SplitRanks(std::stoi(arguments[1])) : 0;
+    LogWriter &logger = Instantiation::InstantiateLogWriter(
+        MpiUtilities::MasterRank(), group == 0);
 
     // determine the name of the executable and write it to the logger
     std::string const executable_name(argv[0]);
     logger.LogMessage("Using executable: " + executable_name);
+#ifdef _OPENMP
+    logger.LogMessage("Using OpenMP threads per rank: " +
+                      std::to_string(omp_get_max_threads()));
+    // The leaf loops are scheduled at runtime: statically if the leaves are
+    // placed on the NUMA domains of their threads, dynamically otherwise
+    if constexpr (CC::NumaAwarePlacement()) {
+      omp_set_schedule(omp_sched_static, 0);
+      logger.LogMessage(NumaPlacement::PinThreads());
+    } else {
+      omp_set_schedule(omp_sched_dynamic, 1);
+    }
+#endif
     logger.Flush();
 
-    // determine the name of the input file (default: inputfile.xml)
-    std::filesystem::path const input_file(argc > 1 ? argv[1]
-                                                    : "inputfile.xml");
-    // Instance to provide interface to the input file/data
-    InputReader const input_reader(
-        Instantiation::InstantiateInputReader(input_file));
+    if (ensemble_run) {
+      Ensemble::Run(std::vector<std::filesystem::path>(arguments.begin() + 2,
+                                                       arguments.end()),
+                    group);
+    } else if (arguments.size() > 1 && arguments.front() == "--dry-run") {
+      // dry run mode, e.g. --dry-run 512 case.xml predicts the mesh, partition
+      // and memory of case.xml on 512 ranks without allocating any block
+      std::filesystem::path const input_file(
+          arguments.size() > 2 ? arguments[2] : "inputfile.xml");
+      InputReader const input_reader(
+          Instantiation::InstantiateInputReader(input_file));
+      DryRun::Run(input_reader, std::stoi(arguments[1]));
+      logger.Flush();
+    } else if (!arguments.empty() && arguments.front() == "--benchmark") {
+      // benchmark run mode on a synthetic mesh, e.g. --benchmark --steps 20
+      // --blocks 16 --multi-phase
+      BenchmarkSetup const setup = BenchmarkInputfile::ParseArguments(
+          std::vector<std::string>(arguments.begin() + 1, arguments.end()));
+      logger.LogMessage("Benchmark run: " + std::to_string(setup.macro_steps_) +
+                        " macro steps, " +
+                        std::to_string(setup.blocks_per_rank_) +
+                        " blocks per rank, " +
+                        (setup.multi_phase_ ? "multi-phase" : "single-phase"));
+      CommunicationStatistics::Instance().recording_ = true;
+      InputReader const input_reader(
+          Instantiation::InstantiateBenchmarkInputReader(setup));
 
-    Simulation::Run(input_reader);
-    logger.Flush();
+      std::filesystem::path const output_folder = Simulation::Run(input_reader);
+      logger.Flush();
+      // The benchmark leaves no files behind, the results are in the terminal
+      MPI_Barrier(MPI_COMM_WORLD);
+      if (MpiUtilities::MasterRank()) {
+        std::filesystem::remove_all(output_folder);
+      }
+    } else {
+      // determine the name of the input file (default: inputfile.xml)
+      std::filesystem::path const input_file(
+          arguments.empty() ? "inputfile.xml" : arguments.front());
+      // Instance to provide interface to the input file/data
+      InputReader const input_reader(
+          Instantiation::InstantiateInputReader(input_file));
+
+      Simulation::Run(input_reader);
+      logger.Flush();
+    }
   }
 
   MPI_Finalize();
@@ -56,6 +56,7 @@ class EquationOfState {
     return -1.0;
   }
 
+  virtual EquationOfStateName GetName() const = 0;
   virtual double GetGruneisen() const = 0;
   virtual double GetGruneisen([[maybe_unused]] double const density) const {
     return GetGruneisen();
@@ -66,6 +67,13 @@ class EquationOfState {
   virtual double GetB() const { return -1.0; }
   virtual double ComputeSpeedOfSound(double const density,
                                      double const pressure) const = 0;
+  virtual void ComputeSpeedOfSoundBatch(
+      double const *const density, double const *const pressure,
+      double *const speed_of_sound, unsigned int const number_of_states) const {
+    for (unsigned int s = 0; s < number_of_states; ++s) {
+      speed_of_sound[s] = ComputeSpeedOfSound(density[s], pressure[s]);
+    }
+  }
 
 protected:
   // protected default constructor (can only be called from derived classes)
@@ -160,6 +168,22 @@ public:
     return ComputeSpeedOfSound(density, pressure);
   }
 
+  /**
+   * @brief Computes the speed of sound for a batch of states with a single
+   * dispatch to the material equation of state.
+   * @param density The densities of the states.
+   * @param pressure The pressures of the states.
+   * @param speed_of_sound The speed of sound of each state (indirect return
+   * parameter).
+   * @param number_of_states The number of states in the batch.
+   */
+  void SpeedOfSound(double const *const density, double const *const pressure,
+                    double *const speed_of_sound,
+                    unsigned int const number_of_states) const {
+    ComputeSpeedOfSoundBatch(density, pressure, speed_of_sound,
+                             number_of_states);
+  }
+
   /**
    * @brief Computes the Grueneisen coefficient according to the material
    * equation of state. Dependent on material constants only so far.
@@ -197,6 +221,12 @@ public:
    * @return B value of the implemented material.
    */
   double B() const { return GetB(); }
+
+  /**
+   * @brief Gives the identifier of the implemented equation of state.
+   * @return Name of the equation of state.
+   */
+  EquationOfStateName Name() const { return GetName(); }
 };
 
 #endif // EQUATION_OF_STATE_H
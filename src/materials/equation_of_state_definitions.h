@@ -40,7 +40,8 @@ enum class EquationOfStateName {
   StiffenedGasCompleteSafe,
   NobleAbelStiffenedGas,
   WaterlikeFluid,
-  Isentropic
+  Isentropic,
+  Tabulated
 };
 
 /**
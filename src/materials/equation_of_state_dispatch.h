@@ -0,0 +1,79 @@
+//===------------------- equation_of_state_dispatch.h ---------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef EQUATION_OF_STATE_DISPATCH_H
+#define EQUATION_OF_STATE_DISPATCH_H
+
+#include <utility>
+
+#include "materials/equation_of_state.h"
+#include "materials/equations_of_state/isentropic.h"
+#include "materials/equations_of_state/noble_abel_stiffened_gas.h"
+#include "materials/equations_of_state/stiffened_gas.h"
+#include "materials/equations_of_state/stiffened_gas_complete_safe.h"
+#include "materials/equations_of_state/stiffened_gas_safe.h"
+#include "materials/equations_of_state/tabulated_equation_of_state.h"
+#include "materials/equations_of_state/waterlike_fluid.h"
+#include "user_specifications/compile_time_constants.h"
+
+/**
+ * @brief Calls the visitor with the given equation of state cast to its
+ * concrete (final) type. The resolution happens once per call, such that loops
+ * inside the visitor are instantiated per equation of state and all equation
+ * of state calls within them are statically bound. Falls back to the abstract
+ * interface if the devirtualization is switched off in the compile time
+ * constants.
+ * @param eos The equation of state to be resolved.
+ * @param visitor Callable accepting any equation of state type.
+ * @return The value returned by the visitor.
+ */
+template <typename Visitor>
+decltype(auto) VisitEquationOfState(EquationOfState const &eos,
+                                    Visitor &&visitor) {
+  if constexpr (CC::DevirtualizeEquationOfState()) {
+    switch (eos.Name()) {
+    case EquationOfStateName::StiffenedGas:
+      return std::forward<Visitor>(visitor)(
+          static_cast<StiffenedGas const &>(eos));
+    case EquationOfStateName::StiffenedGasSafe:
+      return std::forward<Visitor>(visitor)(
+          static_cast<StiffenedGasSafe const &>(eos));
+    case EquationOfStateName::StiffenedGasCompleteSafe:
+      return std::forward<Visitor>(visitor)(
+          static_cast<StiffenedGasCompleteSafe const &>(eos));
+    case EquationOfStateName::NobleAbelStiffenedGas:
+      return std::forward<Visitor>(visitor)(
+          static_cast<NobleAbelStiffenedGas const &>(eos));
+    case EquationOfStateName::WaterlikeFluid:
+      return std::forward<Visitor>(visitor)(
+          static_cast<WaterlikeFluid const &>(eos));
+    case EquationOfStateName::Isentropic:
+      return std::forward<Visitor>(visitor)(
+          static_cast<Isentropic const &>(eos));
+    case EquationOfStateName::Tabulated:
+      return std::forward<Visitor>(visitor)(
+          static_cast<TabulatedEquationOfState const &>(eos));
+    }
+  }
+  return std::forward<Visitor>(visitor)(eos);
+}
+
+#endif // EQUATION_OF_STATE_DISPATCH_H
@@ -72,6 +72,14 @@ double Isentropic::ComputeEnergy(double const, double const, double const,
   return -1;
 }
 
+/**
+ * @brief Gives the identifier of the equation of state.
+ * @return Isentropic.
+ */
+EquationOfStateName Isentropic::GetName() const {
+  return EquationOfStateName::Isentropic;
+}
+
 /**
  * @brief Gruneisen coefficent is not necessary for isentropic equation of
  * state.
@@ -29,7 +29,7 @@
  * @brief The Isentropic class implements a generic isentropic material, i.e.
  * material parameters must be set via caller input.
  */
-class Isentropic : public EquationOfState {
+class Isentropic final : public EquationOfState {
 
   double const gamma_;
   double const A_;
@@ -43,6 +43,7 @@ class Isentropic : public EquationOfState {
   double ComputeEnergy(double const density, double const velocity_x,
                        double const velocity_y, double const velocity_z,
                        double const pressure) const override;
+  EquationOfStateName GetName() const override;
   double GetGruneisen() const override;
   double ComputePsi(double const pressure,
                     double const one_density) const override;
@@ -189,6 +189,14 @@ double NobleAbelStiffenedGas::ComputePsi(double const pressure,
          (one_density - covolume_);
 }
 
+/**
+ * @brief Gives the identifier of the equation of state.
+ * @return NobleAbelStiffenedGas.
+ */
+EquationOfStateName NobleAbelStiffenedGas::GetName() const {
+  return EquationOfStateName::NobleAbelStiffenedGas;
+}
+
 /**
  * @brief Returns Gamma.
  * @return Gamma.
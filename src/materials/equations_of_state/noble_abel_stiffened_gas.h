@@ -32,7 +32,7 @@
  * state, i.e. material parameters must be set via caller input. The equation of
  * state is described in \cite LeMetayer2016.
  */
-class NobleAbelStiffenedGas : public EquationOfState {
+class NobleAbelStiffenedGas final : public EquationOfState {
   // parameters required for the computation
   double const epsilon_ = std::numeric_limits<double>::epsilon();
   double const gamma_;
@@ -55,6 +55,7 @@ class NobleAbelStiffenedGas : public EquationOfState {
   double ComputeTemperature(double const mass, double const momentum_x,
                             double const momentum_y, double const momentum_z,
                             double const energy) const override;
+  EquationOfStateName GetName() const override;
   double GetGruneisen() const override;
   double GetGruneisen(double const density) const override;
   double ComputePsi(double const pressure,
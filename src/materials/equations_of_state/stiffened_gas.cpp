@@ -49,25 +49,6 @@ StiffenedGas::StiffenedGas(
   /* Empty besides initializer list*/
 }
 
-/**
- * @brief Computes Pressure from inputs as -gamma*B + ( gamma - 1 ) * ( E  - 0.5
- * * rho * ||v^2|| ).
- * @param mass The mass used for the computation.
- * @param momentum_x The momentum in x-direction used for the computation.
- * @param momentum_y The momentum in y-direction used for the computation.
- * @param momentum_z The momentum in z-direction used for the computation.
- * @param energy The energy used for the computation.
- * @return Pressure according to stiffened-gas equation of state.
- */
-double StiffenedGas::ComputePressure(double const mass, double const momentum_x,
-                                     double const momentum_y,
-                                     double const momentum_z,
-                                     double const energy) const {
-  return GenericStiffenedGas::CalculatePressure<false>(
-      mass, momentum_x, momentum_y, momentum_z, energy, gamma_,
-      background_pressure_);
-}
-
 /**
  * @brief Computes enthalpy as ( E + p ) / rho.
  * @param mass The mass used for the computation.
@@ -86,25 +67,6 @@ double StiffenedGas::ComputeEnthalpy(double const mass, double const momentum_x,
          mass;
 }
 
-/**
- * @brief Computes energy according to stiffened gas equation.
- * @param density The density used for the computation.
- * @param velocity_x The velocity in x-direction used for the computation.
- * @param velocity_y The velocity in y-direction used for the computation.
- * @param velocity_z The velocity in z-direction used for the computation.
- * @param pressure The pressure used for the computation.
- * @return Energy according to given inputs.
- */
-double StiffenedGas::ComputeEnergy(double const density,
-                                   double const velocity_x,
-                                   double const velocity_y,
-                                   double const velocity_z,
-                                   double const pressure) const {
-  return GenericStiffenedGas::CalculateEnergy(density, velocity_x, velocity_y,
-                                              velocity_z, pressure, gamma_,
-                                              background_pressure_);
-}
-
 /**
  * @brief Computes Gruneisen coefficient as ( gamma-1 ) for stiffened-gas
  * equation of state.
@@ -112,6 +74,14 @@ double StiffenedGas::ComputeEnergy(double const density,
  */
 double StiffenedGas::GetGruneisen() const { return (gamma_ - 1.0); }
 
+/**
+ * @brief Gives the identifier of the equation of state.
+ * @return StiffenedGas.
+ */
+EquationOfStateName StiffenedGas::GetName() const {
+  return EquationOfStateName::StiffenedGas;
+}
+
 /**
  * @brief Returns Gamma.
  * @return Gamma.
@@ -148,6 +118,25 @@ double StiffenedGas::ComputeSpeedOfSound(double const density,
       density, pressure, gamma_, background_pressure_);
 }
 
+/**
+ * @brief Computes the speed of sound for a batch of states, see
+ * ComputeSpeedOfSound.
+ * @param density The densities used for the computation.
+ * @param pressure The pressures used for the computation.
+ * @param speed_of_sound The speed of sound of each state (indirect return
+ * parameter).
+ * @param number_of_states The number of states.
+ */
+void StiffenedGas::ComputeSpeedOfSoundBatch(
+    double const *const density, double const *const pressure,
+    double *const speed_of_sound, unsigned int const number_of_states) const {
+#pragma omp simd
+  for (unsigned int s = 0; s < number_of_states; ++s) {
+    speed_of_sound[s] = GenericStiffenedGas::CalculateSpeedOfSound<false>(
+        density[s], pressure[s], gamma_, background_pressure_);
+  }
+}
+
 /**
  * @brief Provides logging information of the equation of state.
  * @param indent Number of white spaces used at the beginning of each line for
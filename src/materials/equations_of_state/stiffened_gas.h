@@ -23,6 +23,7 @@
 #define STIFFENED_GAS_H
 
 #include "materials/equation_of_state.h"
+#include "materials/equations_of_state/generic_stiffened_gas.h"
 #include "unit_handler.h"
 #include <unordered_map>
 
@@ -30,7 +31,7 @@
  * @brief The StiffenedGas class implements a generic stiffened gas, i.e.
  * material parameters must be set via caller input.
  */
-class StiffenedGas : public EquationOfState {
+class StiffenedGas final : public EquationOfState {
   // parameters required for the computation
   double const gamma_;
   double const background_pressure_;
@@ -45,6 +46,7 @@ class StiffenedGas : public EquationOfState {
   double ComputeEnergy(double const density, double const velocity_x,
                        double const velocity_y, double const velocity_z,
                        double const pressure) const override;
+  EquationOfStateName GetName() const override;
   double GetGruneisen() const override;
   double ComputePsi(double const pressure,
                     double const one_density) const override;
@@ -52,6 +54,11 @@ class StiffenedGas : public EquationOfState {
   double GetB() const override;
   double ComputeSpeedOfSound(double const density,
                              double const pressure) const override;
+  void
+  ComputeSpeedOfSoundBatch(double const *const density,
+                           double const *const pressure,
+                           double *const speed_of_sound,
+                           unsigned int const number_of_states) const override;
 
 public:
   StiffenedGas() = delete;
@@ -64,9 +71,71 @@ public:
   StiffenedGas(StiffenedGas &&) = delete;
   StiffenedGas &operator=(StiffenedGas &&) = delete;
 
+  // Statically bound counterparts of the interface functions, which allow
+  // inlining in loops dispatched on the concrete type (see
+  // VisitEquationOfState)
+  double Pressure(double const mass, double const momentum_x,
+                  double const momentum_y, double const momentum_z,
+                  double const energy) const {
+    return StiffenedGas::ComputePressure(mass, momentum_x, momentum_y,
+                                         momentum_z, energy);
+  }
+  double Energy(double const density, double const velocity_x,
+                double const velocity_y, double const velocity_z,
+                double const pressure) const {
+    return StiffenedGas::ComputeEnergy(density, velocity_x, velocity_y,
+                                       velocity_z, pressure);
+  }
+  double Temperature([[maybe_unused]] double const mass,
+                     [[maybe_unused]] double const momentum_x,
+                     [[maybe_unused]] double const momentum_y,
+                     [[maybe_unused]] double const momentum_z,
+                     [[maybe_unused]] double const energy) const {
+    return -1.0;
+  }
+
   // function for logging
   std::string GetLogData(unsigned int const indent,
                          UnitHandler const &unit_handler) const;
 };
 
+/**
+ * @brief Computes Pressure from inputs as -gamma*B + ( gamma - 1 ) * ( E  - 0.5
+ * * rho * ||v^2|| ).
+ * @param mass The mass used for the computation.
+ * @param momentum_x The momentum in x-direction used for the computation.
+ * @param momentum_y The momentum in y-direction used for the computation.
+ * @param momentum_z The momentum in z-direction used for the computation.
+ * @param energy The energy used for the computation.
+ * @return Pressure according to stiffened-gas equation of state.
+ */
+inline double StiffenedGas::ComputePressure(double const mass,
+                                            double const momentum_x,
+                                            double const momentum_y,
+                                            double const momentum_z,
+                                            double const energy) const {
+  return GenericStiffenedGas::CalculatePressure<false>(
+      mass, momentum_x, momentum_y, momentum_z, energy, gamma_,
+      background_pressure_);
+}
+
+/**
+ * @brief Computes energy according to stiffened gas equation.
+ * @param density The density used for the computation.
+ * @param velocity_x The velocity in x-direction used for the computation.
+ * @param velocity_y The velocity in y-direction used for the computation.
+ * @param velocity_z The velocity in z-direction used for the computation.
+ * @param pressure The pressure used for the computation.
+ * @return Energy according to given inputs.
+ */
+inline double StiffenedGas::ComputeEnergy(double const density,
+                                          double const velocity_x,
+                                          double const velocity_y,
+                                          double const velocity_z,
+                                          double const pressure) const {
+  return GenericStiffenedGas::CalculateEnergy(density, velocity_x, velocity_y,
+                                              velocity_z, pressure, gamma_,
+                                              background_pressure_);
+}
+
 #endif // STIFFENED_GAS_H
@@ -175,6 +175,14 @@ double StiffenedGasCompleteSafe::ComputePsi(double const pressure,
   return (pressure + gamma_ * background_pressure_) * one_density;
 }
 
+/**
+ * @brief Gives the identifier of the equation of state.
+ * @return StiffenedGasCompleteSafe.
+ */
+EquationOfStateName StiffenedGasCompleteSafe::GetName() const {
+  return EquationOfStateName::StiffenedGasCompleteSafe;
+}
+
 /**
  * @brief Returns Gamma.
  * @return Gamma.
@@ -202,6 +210,27 @@ StiffenedGasCompleteSafe::ComputeSpeedOfSound(double const density,
   return std::sqrt(std::max(speed_of_sound_squared, epsilon_));
 }
 
+/**
+ * @brief Computes the speed of sound for a batch of states, see
+ * ComputeSpeedOfSound.
+ * @param density The densities used for the computation.
+ * @param pressure The pressures used for the computation.
+ * @param speed_of_sound The speed of sound of each state (indirect return
+ * parameter).
+ * @param number_of_states The number of states.
+ */
+void StiffenedGasCompleteSafe::ComputeSpeedOfSoundBatch(
+    double const *const density, double const *const pressure,
+    double *const speed_of_sound, unsigned int const number_of_states) const {
+#pragma omp simd
+  for (unsigned int s = 0; s < number_of_states; ++s) {
+    double const speed_of_sound_squared = gamma_ *
+                                          (pressure[s] + background_pressure_) /
+                                          std::max(density[s], epsilon_);
+    speed_of_sound[s] = std::sqrt(std::max(speed_of_sound_squared, epsilon_));
+  }
+}
+
 /**
  * @brief Provides logging information of the equation of state.
  * @param indent Number of white spaces used at the beginning of each line for
@@ -33,7 +33,7 @@
  * is described in \cite Menikoff1989. Safe version, i.e. uses epsilons to avoid
  * floating-point errors.
  */
-class StiffenedGasCompleteSafe : public EquationOfState {
+class StiffenedGasCompleteSafe final : public EquationOfState {
   // parameters required for the computation
   double const epsilon_ = std::numeric_limits<double>::epsilon();
   double const gamma_;
@@ -55,6 +55,7 @@ class StiffenedGasCompleteSafe : public EquationOfState {
   double ComputeTemperature(double const mass, double const momentum_x,
                             double const momentum_y, double const momentum_z,
                             double const energy) const override;
+  EquationOfStateName GetName() const override;
   double GetGruneisen() const override;
   double ComputePsi(double const pressure,
                     double const one_density) const override;
@@ -62,6 +63,11 @@ class StiffenedGasCompleteSafe : public EquationOfState {
   double GetB() const override;
   double ComputeSpeedOfSound(double const density,
                              double const pressure) const override;
+  void
+  ComputeSpeedOfSoundBatch(double const *const density,
+                           double const *const pressure,
+                           double *const speed_of_sound,
+                           unsigned int const number_of_states) const override;
 
 public:
   StiffenedGasCompleteSafe() = delete;
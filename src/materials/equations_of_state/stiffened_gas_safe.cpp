@@ -149,6 +149,35 @@ double StiffenedGasSafe::ComputeSpeedOfSound(double const density,
   return std::sqrt(std::max(speed_of_sound_squared, epsilon_));
 }
 
+/**
+ * @brief Computes the speed of sound for a batch of states, see
+ * ComputeSpeedOfSound.
+ * @param density The densities used for the computation.
+ * @param pressure The pressures used for the computation.
+ * @param speed_of_sound The speed of sound of each state (indirect return
+ * parameter).
+ * @param number_of_states The number of states.
+ */
+void StiffenedGasSafe::ComputeSpeedOfSoundBatch(
+    double const *const density, double const *const pressure,
+    double *const speed_of_sound, unsigned int const number_of_states) const {
+#pragma omp simd
+  for (unsigned int s = 0; s < number_of_states; ++s) {
+    double const speed_of_sound_squared = gamma_ *
+                                          (pressure[s] + background_pressure_) /
+                                          std::max(density[s], epsilon_);
+    speed_of_sound[s] = std::sqrt(std::max(speed_of_sound_squared, epsilon_));
+  }
+}
+
+/**
+ * @brief Gives the identifier of the equation of state.
+ * @return StiffenedGasSafe.
+ */
+EquationOfStateName StiffenedGasSafe::GetName() const {
+  return EquationOfStateName::StiffenedGasSafe;
+}
+
 /**
  * @brief Returns Gamma.
  * @return Gamma.
@@ -32,7 +32,7 @@
  * material parameters must be set via caller input. Safe version, i.e. uses
  * epsilons to avoid floating-point errors.
  */
-class StiffenedGasSafe : public EquationOfState {
+class StiffenedGasSafe final : public EquationOfState {
   // parameter required for the computataion
   double const epsilon_ = std::numeric_limits<double>::epsilon();
   double const gamma_;
@@ -48,6 +48,7 @@ class StiffenedGasSafe : public EquationOfState {
   double ComputeEnergy(double const density, double const velocity_x,
                        double const velocity_y, double const velocity_z,
                        double const pressure) const override;
+  EquationOfStateName GetName() const override;
   double GetGruneisen() const override;
   double ComputePsi(double const pressure,
                     double const one_density) const override;
@@ -55,6 +56,11 @@ class StiffenedGasSafe : public EquationOfState {
   double GetB() const override;
   double ComputeSpeedOfSound(double const density,
                              double const pressure) const override;
+  void
+  ComputeSpeedOfSoundBatch(double const *const density,
+                           double const *const pressure,
+                           double *const speed_of_sound,
+                           unsigned int const number_of_states) const override;
 
 public:
   StiffenedGasSafe() = delete;
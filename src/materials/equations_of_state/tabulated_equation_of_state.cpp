@@ -0,0 +1,304 @@
+//===------------------ tabulated_equation_of_state.cpp -------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "materials/equations_of_state/tabulated_equation_of_state.h"
+#include "utilities/helper_functions.h"
+#include "utilities/string_operations.h"
+#include <stdexcept>
+
+namespace {
+/**
+ * @brief Range and resolution of one axis of a table.
+ */
+struct TableAxis {
+  double minimum_;
+  double maximum_;
+  unsigned int points_;
+};
+
+/**
+ * @brief Reads the range and resolution of a table axis from the equation of
+ * state data ( table<Quantity>Minimum, table<Quantity>Maximum and
+ * table<Quantity>Points ).
+ * @param dimensional_eos_data Map containing all data for the equation of
+ * state.
+ * @param quantity Name of the tabulated quantity.
+ * @param non_dimensionalize Callable to non-dimensionalize the range.
+ * @return The non-dimensional axis.
+ */
+template <typename NonDimensionalize>
+TableAxis ReadTableAxis(
+    std::unordered_map<std::string, double> const &dimensional_eos_data,
+    std::string const &quantity, NonDimensionalize &&non_dimensionalize) {
+  TableAxis const axis = {
+      non_dimensionalize(GetCheckedParameter<double>(
+          dimensional_eos_data, "table" + quantity + "Minimum",
+          "TabulatedEquationOfState")),
+      non_dimensionalize(GetCheckedParameter<double>(
+          dimensional_eos_data, "table" + quantity + "Maximum",
+          "TabulatedEquationOfState")),
+      static_cast<unsigned int>(GetCheckedParameter<double>(
+          dimensional_eos_data, "table" + quantity + "Points",
+          "TabulatedEquationOfState"))};
+  if (axis.points_ < 2 || !(axis.maximum_ > axis.minimum_)) {
+    throw std::invalid_argument("The table axis of " + quantity +
+                                " requires at least two points and a "
+                                "maximum larger than its minimum!");
+  }
+  return axis;
+}
+
+/**
+ * @brief Samples the given function on a uniform grid spanned by two axes.
+ * @param x_axis,y_axis The axes of the table.
+ * @param function Callable giving the tabulated value for a point (x,y).
+ * @return The filled table.
+ */
+template <typename Function>
+EquationOfStateTable Tabulate(TableAxis const &x_axis, TableAxis const &y_axis,
+                              Function &&function) {
+  double const x_spacing =
+      (x_axis.maximum_ - x_axis.minimum_) / double(x_axis.points_ - 1);
+  double const y_spacing =
+      (y_axis.maximum_ - y_axis.minimum_) / double(y_axis.points_ - 1);
+  EquationOfStateTable table = {
+      x_axis.minimum_, x_axis.maximum_, y_axis.minimum_,
+      y_axis.maximum_, x_axis.points_,  y_axis.points_,
+      1.0 / x_spacing, 1.0 / y_spacing, {}};
+  table.values_.reserve(std::size_t(x_axis.points_) * y_axis.points_);
+  for (unsigned int i = 0; i < x_axis.points_; ++i) {
+    double const x = x_axis.minimum_ + double(i) * x_spacing;
+    for (unsigned int j = 0; j < y_axis.points_; ++j) {
+      table.values_.push_back(
+          function(x, y_axis.minimum_ + double(j) * y_spacing));
+    }
+  }
+  return table;
+}
+} // namespace
+
+/**
+ * @brief Constructs a tabulated equation of state from an analytic one. The
+ * table ranges and resolutions are given as input.
+ * @param analytic_eos The equation of state the tables are computed from.
+ * @param dimensional_eos_data Map containing all data for the equation of
+ * state.
+ * @param unit_handler Instance to provide (non-)dimensionalization of values.
+ *
+ * @note During the constructing a check is done if the required parameter
+ * exists. If not an error is thrown. Furthermore, dimensionalization of each
+ * value is done.
+ */
+TabulatedEquationOfState::TabulatedEquationOfState(
+    std::unique_ptr<EquationOfState const> analytic_eos,
+    std::unordered_map<std::string, double> const &dimensional_eos_data,
+    UnitHandler const &unit_handler)
+    : analytic_eos_(std::move(analytic_eos)),
+      pressure_table_(Tabulate(
+          ReadTableAxis(dimensional_eos_data, "Density",
+                        [&unit_handler](double const value) {
+                          return unit_handler.NonDimensionalizeValue(
+                              value, UnitType::Density);
+                        }),
+          ReadTableAxis(dimensional_eos_data, "Energy",
+                        [&unit_handler](double const value) {
+                          return unit_handler.NonDimensionalizeValue(
+                              value, {UnitType::Energy}, {UnitType::Density});
+                        }),
+          [this](double const density, double const specific_energy) {
+            return analytic_eos_->Pressure(density, 0.0, 0.0, 0.0,
+                                           density * specific_energy);
+          })),
+      speed_of_sound_table_(
+          Tabulate(ReadTableAxis(dimensional_eos_data, "Density",
+                                 [&unit_handler](double const value) {
+                                   return unit_handler.NonDimensionalizeValue(
+                                       value, UnitType::Density);
+                                 }),
+                   ReadTableAxis(dimensional_eos_data, "Pressure",
+                                 [&unit_handler](double const value) {
+                                   return unit_handler.NonDimensionalizeValue(
+                                       value, UnitType::Pressure);
+                                 }),
+                   [this](double const density, double const pressure) {
+                     return analytic_eos_->SpeedOfSound(density, pressure);
+                   })) {
+  /* Empty besides initializer list*/
+}
+
+/**
+ * @brief Indicates whether the equation of state data asks for tabulation,
+ * i.e. whether a table resolution is given.
+ * @param dimensional_eos_data Map containing all data for the equation of
+ * state.
+ * @return True if the equation of state is to be tabulated, false otherwise.
+ */
+bool TabulatedEquationOfState::IsRequested(
+    std::unordered_map<std::string, double> const &dimensional_eos_data) {
+  return dimensional_eos_data.find("tableDensityPoints") !=
+         dimensional_eos_data.end();
+}
+
+/**
+ * @brief See base class definition. Evaluated by the analytic equation of
+ * state.
+ */
+double TabulatedEquationOfState::ComputeEnthalpy(double const mass,
+                                                 double const momentum_x,
+                                                 double const momentum_y,
+                                                 double const momentum_z,
+                                                 double const energy) const {
+  return analytic_eos_->Enthalpy(mass, momentum_x, momentum_y, momentum_z,
+                                 energy);
+}
+
+/**
+ * @brief See base class definition. Evaluated by the analytic equation of
+ * state.
+ */
+double TabulatedEquationOfState::ComputeEnergy(double const density,
+                                               double const velocity_x,
+                                               double const velocity_y,
+                                               double const velocity_z,
+                                               double const pressure) const {
+  return analytic_eos_->Energy(density, velocity_x, velocity_y, velocity_z,
+                               pressure);
+}
+
+/**
+ * @brief See base class definition. Evaluated by the analytic equation of
+ * state.
+ */
+double TabulatedEquationOfState::ComputeTemperature(double const mass,
+                                                    double const momentum_x,
+                                                    double const momentum_y,
+                                                    double const momentum_z,
+                                                    double const energy) const {
+  return analytic_eos_->Temperature(mass, momentum_x, momentum_y, momentum_z,
+                                    energy);
+}
+
+/**
+ * @brief Gives the identifier of the equation of state.
+ * @return Tabulated.
+ */
+EquationOfStateName TabulatedEquationOfState::GetName() const {
+  return EquationOfStateName::Tabulated;
+}
+
+/**
+ * @brief See base class definition. Evaluated by the analytic equation of
+ * state.
+ */
+double TabulatedEquationOfState::GetGruneisen() const {
+  return analytic_eos_->Gruneisen();
+}
+
+/**
+ * @brief See base class definition. Evaluated by the analytic equation of
+ * state.
+ */
+double TabulatedEquationOfState::GetGruneisen(double const density) const {
+  return analytic_eos_->Gruneisen(density);
+}
+
+/**
+ * @brief See base class definition. Evaluated by the analytic equation of
+ * state.
+ */
+double TabulatedEquationOfState::ComputePsi(double const pressure,
+                                            double const one_density) const {
+  return analytic_eos_->Psi(pressure, one_density);
+}
+
+/**
+ * @brief See base class definition. Given by the analytic equation of state.
+ */
+double TabulatedEquationOfState::GetGamma() const {
+  return analytic_eos_->Gamma();
+}
+
+/**
+ * @brief See base class definition. Given by the analytic equation of state.
+ */
+double TabulatedEquationOfState::GetB() const { return analytic_eos_->B(); }
+
+/**
+ * @brief Gives the speed of sound of a batch of states from the table.
+ * @param density The densities of the states.
+ * @param pressure The pressures of the states.
+ * @param speed_of_sound The speed of sound of each state (indirect return
+ * parameter).
+ * @param number_of_states The number of states in the batch.
+ */
+void TabulatedEquationOfState::ComputeSpeedOfSoundBatch(
+    double const *const density, double const *const pressure,
+    double *const speed_of_sound, unsigned int const number_of_states) const {
+  for (unsigned int s = 0; s < number_of_states; ++s) {
+    speed_of_sound[s] =
+        TabulatedEquationOfState::ComputeSpeedOfSound(density[s], pressure[s]);
+  }
+}
+
+/**
+ * @brief Provides logging information of the equation of state.
+ * @param indent Number of white spaces used at the beginning of each line for
+ * the logging information.
+ * @param unit_handler Instance to provide dimensionalization of variables.
+ * @return string with logging information.
+ */
+std::string
+TabulatedEquationOfState::GetLogData(unsigned int const indent,
+                                     UnitHandler const &unit_handler) const {
+  auto const range = [](double const minimum, double const maximum,
+                        unsigned int const points) {
+    return StringOperations::ToScientificNotationString(minimum, 9) + " - " +
+           StringOperations::ToScientificNotationString(maximum, 9) + " (" +
+           std::to_string(points) + " points)\n";
+  };
+  // string that is returned
+  std::string log_string;
+  log_string +=
+      StringOperations::Indent(indent) + "Tabulation           : Bilinear\n";
+  log_string += StringOperations::Indent(indent) + "Density              : " +
+                range(unit_handler.DimensionalizeValue(
+                          pressure_table_.x_minimum_, UnitType::Density),
+                      unit_handler.DimensionalizeValue(
+                          pressure_table_.x_maximum_, UnitType::Density),
+                      pressure_table_.x_points_);
+  log_string +=
+      StringOperations::Indent(indent) + "Specific energy      : " +
+      range(unit_handler.DimensionalizeValue(pressure_table_.y_minimum_,
+                                             {UnitType::Energy},
+                                             {UnitType::Density}),
+            unit_handler.DimensionalizeValue(pressure_table_.y_maximum_,
+                                             {UnitType::Energy},
+                                             {UnitType::Density}),
+            pressure_table_.y_points_);
+  log_string += StringOperations::Indent(indent) + "Pressure             : " +
+                range(unit_handler.DimensionalizeValue(
+                          speed_of_sound_table_.y_minimum_, UnitType::Pressure),
+                      unit_handler.DimensionalizeValue(
+                          speed_of_sound_table_.y_maximum_, UnitType::Pressure),
+                      speed_of_sound_table_.y_points_);
+
+  return log_string;
+}
@@ -0,0 +1,208 @@
+//===------------------- tabulated_equation_of_state.h --------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef TABULATED_EQUATION_OF_STATE_H
+#define TABULATED_EQUATION_OF_STATE_H
+
+#include "materials/equation_of_state.h"
+#include "unit_handler.h"
+#include "utilities/mathematical_functions.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief The EquationOfStateTable struct holds the values of a function
+ * z = f(x,y) sampled on a uniform grid and interpolates them bilinearly. The
+ * values are stored contiguously along y, such that the four values of a
+ * lookup lie on two adjacent cache lines.
+ */
+struct EquationOfStateTable {
+  double x_minimum_;
+  double x_maximum_;
+  double y_minimum_;
+  double y_maximum_;
+  unsigned int x_points_;
+  unsigned int y_points_;
+  double one_x_spacing_;
+  double one_y_spacing_;
+  std::vector<double> values_;
+
+  /**
+   * @brief Indicates whether the given point lies within the table range.
+   * @param x,y The coordinates of the point.
+   * @return True if the point can be interpolated, false otherwise.
+   */
+  bool Contains(double const x, double const y) const {
+    return x >= x_minimum_ && x <= x_maximum_ && y >= y_minimum_ &&
+           y <= y_maximum_;
+  }
+
+  /**
+   * @brief Interpolates the table bilinearly at the given point.
+   * @param x,y The coordinates of the point (must lie within the table range).
+   * @return The interpolated value.
+   */
+  double Interpolate(double const x, double const y) const {
+    double const x_normalized = (x - x_minimum_) * one_x_spacing_;
+    double const y_normalized = (y - y_minimum_) * one_y_spacing_;
+    // the upper bounds belong to the last interval
+    unsigned int const i =
+        std::min(static_cast<unsigned int>(x_normalized), x_points_ - 2);
+    unsigned int const j =
+        std::min(static_cast<unsigned int>(y_normalized), y_points_ - 2);
+    double const x_weight = x_normalized - double(i);
+    double const y_weight = y_normalized - double(j);
+    double const *const lower = values_.data() + i * y_points_ + j;
+    double const *const upper = lower + y_points_;
+    double const lower_value = lower[0] + y_weight * (lower[1] - lower[0]);
+    double const upper_value = upper[0] + y_weight * (upper[1] - upper[0]);
+    return lower_value + x_weight * (upper_value - lower_value);
+  }
+};
+
+/**
+ * @brief The TabulatedEquationOfState class replaces the pressure and speed of
+ * sound evaluations of an analytic equation of state by lookups in tables that
+ * are precomputed from it at construction. The pressure is tabulated over
+ * density and specific internal energy, the speed of sound over density and
+ * pressure. States outside the table ranges and all remaining quantities are
+ * evaluated by the analytic equation of state. Worthwhile for equations of
+ * state whose evaluation is expensive compared to a bilinear interpolation.
+ * @note Since the energy is computed analytically, the conversion from prime
+ * states to conservatives and back reproduces the pressure only up to the
+ * interpolation error of the table.
+ */
+class TabulatedEquationOfState final : public EquationOfState {
+  // equation of state the tables are computed from
+  std::unique_ptr<EquationOfState const> const analytic_eos_;
+  // pressure over density and specific internal energy
+  EquationOfStateTable const pressure_table_;
+  // speed of sound over density and pressure
+  EquationOfStateTable const speed_of_sound_table_;
+
+  // functions required from base class
+  double ComputePressure(double const mass, double const momentum_x,
+                         double const momentum_y, double const momentum_z,
+                         double const energy) const override;
+  double ComputeEnthalpy(double const mass, double const momentum_x,
+                         double const momentum_y, double const momentum_z,
+                         double const energy) const override;
+  double ComputeEnergy(double const density, double const velocity_x,
+                       double const velocity_y, double const velocity_z,
+                       double const pressure) const override;
+  double ComputeTemperature(double const mass, double const momentum_x,
+                            double const momentum_y, double const momentum_z,
+                            double const energy) const override;
+  EquationOfStateName GetName() const override;
+  double GetGruneisen() const override;
+  double GetGruneisen(double const density) const override;
+  double ComputePsi(double const pressure,
+                    double const one_density) const override;
+  double GetGamma() const override;
+  double GetB() const override;
+  double ComputeSpeedOfSound(double const density,
+                             double const pressure) const override;
+  void
+  ComputeSpeedOfSoundBatch(double const *const density,
+                           double const *const pressure,
+                           double *const speed_of_sound,
+                           unsigned int const number_of_states) const override;
+
+public:
+  TabulatedEquationOfState() = delete;
+  explicit TabulatedEquationOfState(
+      std::unique_ptr<EquationOfState const> analytic_eos,
+      std::unordered_map<std::string, double> const &dimensional_eos_data,
+      UnitHandler const &unit_handler);
+  virtual ~TabulatedEquationOfState() = default;
+  TabulatedEquationOfState(TabulatedEquationOfState const &) = delete;
+  TabulatedEquationOfState &
+  operator=(TabulatedEquationOfState const &) = delete;
+  TabulatedEquationOfState(TabulatedEquationOfState &&) = delete;
+  TabulatedEquationOfState &operator=(TabulatedEquationOfState &&) = delete;
+
+  // Statically bound counterpart of the interface function, which allows
+  // inlining in loops dispatched on the concrete type (see
+  // VisitEquationOfState)
+  double Pressure(double const mass, double const momentum_x,
+                  double const momentum_y, double const momentum_z,
+                  double const energy) const {
+    return TabulatedEquationOfState::ComputePressure(
+        mass, momentum_x, momentum_y, momentum_z, energy);
+  }
+
+  static bool IsRequested(
+      std::unordered_map<std::string, double> const &dimensional_eos_data);
+
+  // function for logging
+  std::string GetLogData(unsigned int const indent,
+                         UnitHandler const &unit_handler) const;
+};
+
+/**
+ * @brief Gives the pressure from the table of the specific internal energy
+ * ( E - 0.5 * ||m^2|| / rho ) / rho. Falls back to the analytic equation of
+ * state outside the table range.
+ * @param mass The mass used for the computation.
+ * @param momentum_x The momentum in x-direction used for the computation.
+ * @param momentum_y The momentum in y-direction used for the computation.
+ * @param momentum_z The momentum in z-direction used for the computation.
+ * @param energy The energy used for the computation.
+ * @return Pressure for the given state.
+ */
+inline double TabulatedEquationOfState::ComputePressure(
+    double const mass, double const momentum_x, double const momentum_y,
+    double const momentum_z, double const energy) const {
+  double const one_mass = 1.0 / mass;
+  double const specific_energy =
+      (energy - 0.5 *
+                    DimensionAwareConsistencyManagedSum(
+                        momentum_x * momentum_x, momentum_y * momentum_y,
+                        momentum_z * momentum_z) *
+                    one_mass) *
+      one_mass;
+  if (pressure_table_.Contains(mass, specific_energy)) {
+    return pressure_table_.Interpolate(mass, specific_energy);
+  }
+  return analytic_eos_->Pressure(mass, momentum_x, momentum_y, momentum_z,
+                                 energy);
+}
+
+/**
+ * @brief Gives the speed of sound from the table. Falls back to the analytic
+ * equation of state outside the table range.
+ * @param density The density used for the computation.
+ * @param pressure The pressure used for the computation.
+ * @return Speed of sound for the given state.
+ */
+inline double
+TabulatedEquationOfState::ComputeSpeedOfSound(double const density,
+                                              double const pressure) const {
+  if (speed_of_sound_table_.Contains(density, pressure)) {
+    return speed_of_sound_table_.Interpolate(density, pressure);
+  }
+  return analytic_eos_->SpeedOfSound(density, pressure);
+}
+
+#endif // TABULATED_EQUATION_OF_STATE_H
@@ -99,6 +99,14 @@ double WaterlikeFluid::ComputeEnergy(double const density,
           density);
 }
 
+/**
+ * @brief Gives the identifier of the equation of state.
+ * @return WaterlikeFluid.
+ */
+EquationOfStateName WaterlikeFluid::GetName() const {
+  return EquationOfStateName::WaterlikeFluid;
+}
+
 /**
  * @brief Computes Gruneisen coefficient as ( gamma-1 ) for stiffened-gas
  * equation of state.
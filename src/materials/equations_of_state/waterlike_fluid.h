@@ -32,7 +32,7 @@
  * Tait'S EOS ), i.e. material parameters must be set via caller input.
  * Implementation according to \cite Fedkiw1999a ( some formulas rearranged ).
  */
-class WaterlikeFluid : public EquationOfState {
+class WaterlikeFluid final : public EquationOfState {
   // variables required for the computation
   double const gamma_;
   double const A_;
@@ -49,6 +49,7 @@ class WaterlikeFluid : public EquationOfState {
   double ComputeEnergy(double const density, double const velocity_x,
                        double const velocity_y, double const velocity_z,
                        double const pressure) const override;
+  EquationOfStateName GetName() const override;
   double GetGruneisen() const override;
   double ComputePsi(double const pressure,
                     double const one_density) const override;
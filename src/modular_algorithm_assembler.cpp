@@ -22,32 +22,260 @@
 #include "modular_algorithm_assembler.h"
 
 #include <algorithm>
+#include <array>
 #include <bitset>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <numeric>
 #include <string>
+#include <unordered_set>
+#include <utility>
 
 #include "block_definitions/interface_block.h"
 #include "communication/mpi_utilities.h"
+#include "communication/reduction_batch.h"
 #include "enums/interface_tag_definition.h"
 #include "enums/remesh_identifier.h"
 #include "input_output/restart_manager/restart_definitions.h"
+#include "integrator/runge_kutta_legendre_2.h"
 #include "interface_tags/interface_tag_functions.h"
 #include "materials/equations_of_state/gamma_model_stiffened_gas.h"
 #include "multiresolution/multiresolution.h"
+#include "stencils/spatial_reconstruction_stencils/reconstruction_stencil_setup.h"
 #include "topology/id_information.h"
 #include "user_specifications/compile_time_constants.h"
 #include "user_specifications/debug_and_profile_setup.h"
+#include "user_specifications/output_constants.h"
 #include "user_specifications/riemann_solver_settings.h"
+#include "utilities/memory_statistics.h"
+#include "utilities/numa_placement.h"
+#include "utilities/statistics_operations.h"
+#include "utilities/stop_signal.h"
 #include "utilities/string_operations.h"
 
 #include "utilities/buffer_operations_interface.h"
 #include "utilities/buffer_operations_material.h"
 
 namespace {
-void SetTimeInProfileRuns(double &time) {
-  if constexpr (DP::Profile()) {
-    time = MPI_Wtime();
+/**
+ * @brief Posts the non-blocking exchange of one aggregated buffer per partner
+ * rank. Partners are handled in ascending rank order and the lower rank of a
+ * pair sends first, so the tags agree on both sides.
+ * @param communicator The communication manager providing the tags.
+ * @param send_buffers The data to be sent to each partner rank.
+ * @param recv_buffers The (already sized) buffers receiving the data of each
+ * partner rank.
+ * @param requests Container the requests are appended to.
+ */
+void PostAggregatedExchange(
+    CommunicationManager &communicator,
+    std::map<int, std::vector<double>> const &send_buffers,
+    std::map<int, std::vector<double>> &recv_buffers,
+    std::vector<MPI_Request> &requests) {
+  int const my_rank = communicator.MyRankId();
+  std::vector<int> partners;
+  for (auto const &[rank, buffer] : send_buffers) {
+    partners.push_back(rank);
+  }
+  for (auto const &[rank, buffer] : recv_buffers) {
+    partners.push_back(rank);
+  }
+  std::sort(partners.begin(), partners.end());
+  partners.erase(std::unique(partners.begin(), partners.end()), partners.end());
+
+  for (int const partner : partners) {
+    auto const send = [&]() {
+      if (auto const buffer = send_buffers.find(partner);
+          buffer != send_buffers.end()) {
+        communicator.Send(buffer->second.data(), buffer->second.size(),
+                          MPI_DOUBLE, partner, requests);
+      }
+    };
+    auto const recv = [&]() {
+      if (auto buffer = recv_buffers.find(partner);
+          buffer != recv_buffers.end()) {
+        communicator.Recv(buffer->second.data(), buffer->second.size(),
+                          MPI_DOUBLE, partner, requests);
+      }
+    };
+    if (my_rank < partner) {
+      send();
+      recv();
+    } else {
+      recv();
+      send();
+    }
+  }
+}
+
+/**
+ * @brief Collects buffers at arbitrary addresses as blocks of an MPI struct
+ * datatype. One element of the datatype sent from or received into MPI_BOTTOM
+ * transfers all buffers in a single message without intermediate copies.
+ */
+class StructDatatypeBuilder {
+  std::vector<int> counts_;
+  std::vector<MPI_Aint> addresses_;
+  std::vector<MPI_Datatype> datatypes_;
+
+public:
+  /**
+   * @brief Adds a buffer to the datatype.
+   * @param buffer Address of the buffer.
+   * @param count Number of elements of the buffer.
+   * @param datatype Datatype of the elements.
+   */
+  void Add(void const *const buffer, int const count,
+           MPI_Datatype const datatype) {
+    MPI_Aint address;
+    MPI_Get_address(buffer, &address);
+    counts_.push_back(count);
+    addresses_.push_back(address);
+    datatypes_.push_back(datatype);
+  }
+
+  /**
+   * @brief Creates the datatype of all added buffers.
+   * @return The committed datatype, to be freed by the caller.
+   */
+  MPI_Datatype Commit() const {
+    MPI_Datatype datatype;
+    MPI_Type_create_struct(counts_.size(), counts_.data(), addresses_.data(),
+                           datatypes_.data(), &datatype);
+    MPI_Type_commit(&datatype);
+    return datatype;
+  }
+};
+
+// Clock for the cost measurement of single nodes ( unlike MPI_Wtime it may be
+// used by all threads )
+using CostClock = std::chrono::steady_clock;
+
+/**
+ * @brief Gives the start time of a cost measurement.
+ * @return Current time if node costs are measured, an arbitrary value
+ * otherwise.
+ */
+CostClock::time_point CostMeasurementStart() {
+  if constexpr (CC::MeasureNodeCosts()) {
+    return CostClock::now();
+  } else {
+    return CostClock::time_point();
+  }
+}
+
+/**
+ * @brief Adds the time elapsed since the given start to the cost of the given
+ * nodes, each node is charged the same share.
+ * @param nodes The nodes the work was done on.
+ * @param start The start of the measurement.
+ */
+void ChargeNodes(std::vector<std::reference_wrapper<Node>> const &nodes,
+                 CostClock::time_point const start) {
+  if constexpr (CC::MeasureNodeCosts()) {
+    if (!nodes.empty()) {
+      double const share =
+          std::chrono::duration<double>(CostClock::now() - start).count() /
+          nodes.size();
+      for (Node &node : nodes) {
+        node.AddComputationalCost(share);
+      }
+    }
   }
 }
+
+/**
+ * @brief Adds the time elapsed since the given start to the cost of a node.
+ * @param node The node the work was done on.
+ * @param start The start of the measurement.
+ */
+void ChargeNode(Node &node, CostClock::time_point const start) {
+  if constexpr (CC::MeasureNodeCosts()) {
+    node.AddComputationalCost(
+        std::chrono::duration<double>(CostClock::now() - start).count());
+  }
+}
+
+// The Global Lax-Friedrichs scheme needs the eigenvalues of all blocks before
+// any flux can be computed
+constexpr bool uses_global_eigenvalues =
+    convective_term_solver == ConvectiveTermSolvers::FluxSplitting &&
+    FluxSplittingSettings::flux_splitting_scheme ==
+        FluxSplitting::GlobalLaxFriedrichs;
+
+// scaling for viscosity limited timestep size - value taken from \cite
+// Sussman2000
+constexpr double nu_timestep_size_constant = 3.0 / 14.0;
+// scaling for thermal-diffusivity limited timestep size - value taken from
+// \cite Pieper2016
+constexpr double thermal_diffusivity_dt_constant = 0.1;
+
+/**
+ * @brief Gives the number of halo cells a reconstruction stencil reads beyond
+ * the outermost cell faces of a block.
+ * @tparam RECON The reconstruction stencil.
+ * @return The halo depth of the stencil.
+ */
+template <ReconstructionStencils RECON>
+constexpr unsigned int ReconstructionHaloDepth() {
+  using Stencil = typename ReconstructionStencilSetup::Concretize<RECON>::type;
+  return std::max(Stencil::DownstreamStencilSize() + 1,
+                  Stencil::StencilSize() - Stencil::DownstreamStencilSize() -
+                      1);
+}
+
+/**
+ * @brief Gives the largest halo depth among the convective stencils that can
+ * be selected at runtime and the compile-time one.
+ * @return The halo depth of the convective fluxes.
+ */
+template <std::size_t... I>
+constexpr unsigned int ConvectiveHaloDepth(std::index_sequence<I...>) {
+  return std::max(
+      {ReconstructionHaloDepth<reconstruction_stencil>(),
+       ReconstructionHaloDepth<runtime_reconstruction_stencils[I]>()...});
+}
+
+// Number of halo cells the right-hand side of single-phase nodes reads. Viscous
+// and heat fluxes reconstruct cell-center derivatives to the cell faces and
+// parameter models are evaluated in all halo cells, both need the full halo
+// ( unless the fluxes are advanced by super-time-stepping )
+constexpr unsigned int right_hand_side_halo_depth =
+    ((CC::ViscosityIsActive() || CC::HeatConductionActive()) &&
+     !CC::SuperTimeStepping()) ||
+            CC::ParameterModelActive()
+        ? CC::HS()
+        : ConvectiveHaloDepth(std::make_index_sequence<
+                              runtime_reconstruction_stencils.size()>{});
+static_assert(right_hand_side_halo_depth <= CC::HS(),
+              "Halo size not enough for the right-hand side");
+
+/**
+ * @brief Groups leaves into superblocks, i.e. the siblings of one parent.
+ * Leaves on level zero form a superblock of their own.
+ * @param leaf_ids The ids of the leaves, all on the given level.
+ * @param level The level of the leaves.
+ * @return The superblocks, each in ascending order of the position among
+ * siblings.
+ */
+std::vector<std::vector<nid_t>> Superblocks(std::vector<nid_t> leaf_ids,
+                                            unsigned int const level) {
+  // Siblings only differ in their last bits, i.e. sorted ids group them
+  std::sort(leaf_ids.begin(), leaf_ids.end());
+  std::vector<std::vector<nid_t>> superblocks;
+  for (nid_t const id : leaf_ids) {
+    if (superblocks.empty() || level == 0 ||
+        ParentIdOfNode(superblocks.back().front()) != ParentIdOfNode(id)) {
+      superblocks.emplace_back();
+    }
+    superblocks.back().push_back(id);
+  }
+  return superblocks;
+}
 } // namespace
 
 /**
@@ -63,15 +291,37 @@ void SetTimeInProfileRuns(double &time) {
  * the simulation.
  * @param input_output Instance of the I/O manager that handles filesystem
  * access and ouput decisions.
+ * @param convective_stencil The reconstruction stencil of the convective
+ * fluxes (one of the compiled runtime_reconstruction_stencils).
+ * @param walltime_limit Wall clock time limit of the run in seconds (0:
+ * unlimited). A restart snapshot is written and the run stops before it is
+ * reached.
+ * @param memory_budget Memory budget of each rank in bytes (0: unlimited). The
+ * single-phase refinement is limited when the budget is nearly exhausted.
+ * @param grid_sequencing_level Maximum level of the single-phase refinement at
+ * the start of the run ( grid sequencing ). Equal to the maximum level if the
+ * run is not sequenced.
+ * @param grid_sequencing_stamps Times at which the maximum level of the
+ * single-phase refinement is raised by one.
+ * @param grid_sequencing_tolerance Relative change of the kinetic energy per
+ * macro timestep below which the maximum level of the single-phase refinement
+ * is raised by one ( 0: inactive ).
  */
 ModularAlgorithmAssembler::ModularAlgorithmAssembler(
     double const start_time, double const end_time, double const cfl_number,
-    std::array<double, 3> const gravity, std::vector<unsigned int> all_levels,
+    unsigned int const maximum_macro_steps, double const walltime_limit,
+    double const memory_budget, unsigned int const grid_sequencing_level,
+    std::vector<double> const grid_sequencing_stamps,
+    double const grid_sequencing_tolerance, std::array<double, 3> const gravity,
+    ReconstructionStencils const convective_stencil,
+    std::vector<unsigned int> all_levels,
     double const cell_size_on_maximum_level, UnitHandler const &unit_handler,
     Tree &tree, TopologyManager &topology, HaloManager &halo_manager,
     CommunicationManager &communication, Multiresolution const &multiresolution,
-    MaterialManager const &material_manager, InputOutputManager &input_output)
+    MaterialManager const &material_manager, InputOutputManager &input_output,
+    unsigned int const profiling_interval, bool const initial_output)
     : start_time_(start_time), end_time_(end_time), cfl_number_(cfl_number),
+      maximum_macro_steps_(maximum_macro_steps),
       cell_size_on_maximum_level_(cell_size_on_maximum_level),
       gravity_(gravity), all_levels_(all_levels), time_integrator_(start_time_),
       tree_(tree), topology_(topology), halo_manager_(halo_manager),
@@ -82,8 +332,15 @@ ModularAlgorithmAssembler::ModularAlgorithmAssembler(
       multi_phase_manager_(material_manager_, halo_manager_),
       prime_state_handler_(material_manager),
       parameter_manager_(material_manager_, halo_manager_),
-      space_solver_(material_manager_, gravity),
-      logger_(LogWriter::Instance()) {
+      space_solver_(material_manager_, gravity, convective_stencil),
+      logger_(LogWriter::Instance()), profiler_(RuntimeProfiler::Instance()),
+      profiling_interval_(profiling_interval), initial_output_(initial_output),
+      steps_since_analysis_(all_levels_.size(), 0),
+      outdated_halo_levels_(all_levels_.size(), true), stop_time_(end_time_),
+      walltime_limit_(walltime_limit), memory_budget_(memory_budget),
+      refinement_level_limit_(grid_sequencing_level),
+      grid_sequencing_stamps_(grid_sequencing_stamps),
+      grid_sequencing_tolerance_(grid_sequencing_tolerance) {
   /* Empty besides initializer list*/
 }
 
@@ -95,69 +352,178 @@ ModularAlgorithmAssembler::ModularAlgorithmAssembler(
  * macro time step within this function.
  */
 void ModularAlgorithmAssembler::ComputeLoop() {
+  ComputeMacroTimesteps(end_time_, 0);
+  FinishComputeLoop();
+}
+
+/**
+ * @brief Advances the simulation macro timestep by macro timestep until the
+ * given time or number of timesteps is reached. Successive calls continue the
+ * run, e.g. when the simulation is driven step-wise from outside.
+ * @param stop_time The (non-dimensional) time to advance to. Limited to the
+ * end time. With CC::LET() the last timestep is limited to hit it exactly.
+ * @param number_of_timesteps The maximum number of macro timesteps of this
+ * call (0: unlimited).
+ * @return The number of macro timesteps performed.
+ * @note The run also stops on unhealthy timestep sizes and on the maximum
+ * number of macro timesteps of the whole run.
+ */
+unsigned int ModularAlgorithmAssembler::ComputeMacroTimesteps(
+    double const stop_time, unsigned int const number_of_timesteps) {
 
-  std::vector<double> loop_times;
-  std::vector<double> output_runtimes;
   double time_measurement_start;
   double time_measurement_end;
   double current_simulation_time = time_integrator_.CurrentRunTime();
+  double timestep_size = 0.0;
+  stop_time_ = std::min(stop_time, end_time_);
+
+  if (loop_times_.empty()) {
+    /* fast forward if current time is already greater than start time ( i.e.
+     * simulation was restarted ). We have to catch division by zero in case
+     * only the initialization should be performed, i. e. start and end time
+     * are set to zero
+     */
+    double const flush_percentage =
+        end_time_ == start_time_ ? 0.0
+                                 : (current_simulation_time - start_time_) /
+                                       (end_time_ - start_time_);
+    logger_.RunningAlpaca(flush_percentage,
+                          current_simulation_time > start_time_);
+    logger_.LogMessage(" ");
+    run_start_time_ = MPI_Wtime();
+    status_time_ = run_start_time_;
+  }
 
-  bool timestep_size_is_healthy = true;
-
-  /* fast forward if current time is already greater than start time ( i.e.
-   * simulation was restarted ). We have to catch division by zero in case only
-   * the initialization should be performed, i. e. start and end time are set to
-   * zero
-   */
-  double const flush_percentage =
-      end_time_ == start_time_
-          ? 0.0
-          : (current_simulation_time - start_time_) / (end_time_ - start_time_);
-  logger_.RunningAlpaca(flush_percentage,
-                        current_simulation_time > start_time_);
-  logger_.LogMessage(" ");
-
-  while (current_simulation_time < end_time_ && timestep_size_is_healthy) {
-    MPI_Barrier(MPI_COMM_WORLD); // For Time measurement
+  unsigned int timesteps = 0;
+  while (current_simulation_time < stop_time_ && timestep_size_is_healthy_ &&
+         (maximum_macro_steps_ == 0 ||
+          loop_times_.size() < maximum_macro_steps_) &&
+         (number_of_timesteps == 0 || timesteps < number_of_timesteps) &&
+         !walltime_stop_) {
     time_measurement_start = MPI_Wtime();
+    profiler_.Start("Advance");
     Advance(); // This is the heart of the Simulation, the advancement in Time
                // over the different levels
     ResetAllJumpBuffers();
-    MPI_Barrier(MPI_COMM_WORLD); // For Time measurement
+    profiler_.Stop();
+    // In case the time step is limited the timestep size will be exactly zero.
+    bool const timestep_size_collapsed =
+        !abort_requested_ &&
+        time_integrator_.MicroTimestepSizes().back() < CC::MTS() &&
+        time_integrator_.MicroTimestepSizes().back() > 0.0;
+    if constexpr (RestartOutputSettings::InMemoryCheckpointInterval > 0) {
+      bool const non_physical_states =
+          !abort_requested_ && NonPhysicalStatesExist();
+      // Failed macro timesteps are retried from the last checkpoint with a
+      // reduced CFL number
+      if ((non_physical_states || timestep_size_collapsed) &&
+          rollback_retries_ < RestartOutputSettings::MaximumRollbackRetries) {
+        RollBackToInMemoryCheckpoint();
+        rollback_retries_++;
+        cfl_factor_ *= RestartOutputSettings::RollbackCflFactor;
+        reduced_cfl_steps_ = RestartOutputSettings::RollbackReducedCflSteps;
+        logger_.LogMessage("Retrying with CFL number " +
+                           StringOperations::ToScientificNotationString(
+                               cfl_number_ * cfl_factor_, 3));
+        current_simulation_time = time_integrator_.CurrentRunTime();
+        continue;
+      }
+      // Otherwise the last checkpoint is kept as restart snapshot
+      if (abort_requested_ || non_physical_states) {
+        RollBackToInMemoryCheckpoint();
+        input_output_.WriteRestartFile(checkpoint_.time_, true);
+        if (abort_requested_) {
+          logger_.LogMessage("The file 'ABORTFILE' was found in the output "
+                             "folder. Simulation is being terminated");
+          throw std::runtime_error(
+              "The simulation was aborted by the user! \n");
+        }
+        logger_.LogMessage("Non-physical states were found. Simulation is "
+                           "being terminated");
+        throw std::runtime_error(
+            "The simulation produced non-physical states! \n");
+      }
+    }
+    // Each rank measures its own step time. Instead of synchronizing all
+    // ranks, the longest and shortest time are reduced in the background of
+    // the following work ( see RecordMacroStep() )
     time_measurement_end = MPI_Wtime();
-    loop_times.push_back(time_measurement_end - time_measurement_start);
-    // Information Logging
-    LogNodeNumbers();
-    LogPerformanceNumbers(loop_times);
+    loop_times_.push_back(time_measurement_end - time_measurement_start);
+    local_step_times_ = {loop_times_.back(), -loop_times_.back()};
+    MPI_Iallreduce(local_step_times_.data(), reduced_step_times_.data(),
+                   local_step_times_.size(), MPI_DOUBLE, MPI_MAX,
+                   MpiUtilities::Communicator(), &step_time_request_);
+    timesteps++;
 
     if constexpr (CC::WTL()) {
       input_output_.WriteTimestepFile(time_integrator_.MicroTimestepSizes());
     }
-    // In case the time step is limited the timestep size will be exactly zero.
-    if (time_integrator_.MicroTimestepSizes().back() < CC::MTS() &&
-        time_integrator_.MicroTimestepSizes().back() > 0.0) {
-      timestep_size_is_healthy = false;
+    if (timestep_size_collapsed) {
+      timestep_size_is_healthy_ = false;
+    }
+    // The CFL number is relaxed once the reduction after a rollback expired
+    if (reduced_cfl_steps_ > 0 && --reduced_cfl_steps_ == 0) {
+      cfl_factor_ = 1.0;
+      logger_.LogMessage(
+          "Relaxing to CFL number " +
+          StringOperations::ToScientificNotationString(cfl_number_, 3));
     }
     time_integrator_.FinishMacroTimestep();
+    timestep_size = time_integrator_.CurrentRunTime() - current_simulation_time;
     current_simulation_time = time_integrator_.CurrentRunTime();
     logger_.LogMessage("Macro timestep done t = " +
                        StringOperations::ToScientificNotationString(
                            unit_handler_.DimensionalizeValue(
                                current_simulation_time, UnitType::Time),
                            9));
+    if (refinement_level_limit_ < all_levels_.back()) {
+      UpdateGridSequencing(current_simulation_time);
+    }
+    // Information Logging
+    RecordMacroStep();
+    if (loop_times_.size() % DP::PerformanceLogInterval() == 0) {
+      LogNodeNumbers();
+      LogPerformanceNumbers();
+    }
+    // The status file is throttled to keep the load on the file system low
+    if (loop_times_.size() == 1 ||
+        MPI_Wtime() - status_time_ >= DP::StatusInterval()) {
+      status_time_ = MPI_Wtime();
+      WriteRunStatus(current_simulation_time, timestep_size, loop_times_.size(),
+                     status_time_ - run_start_time_);
+    }
 
     // surround the output writing with time measurements to provide tunrim
     // tracking if desired
     if constexpr (CC::TR()) {
-      MPI_Barrier(MPI_COMM_WORLD);
+      MPI_Barrier(MpiUtilities::Communicator());
       time_measurement_start = MPI_Wtime();
     }
 
+    // running statistics every n-th macro time step of this run
+    if constexpr (StatisticsOutputSettings::SamplingInterval > 0) {
+      if (loop_times_.size() % StatisticsOutputSettings::SamplingInterval ==
+          0) {
+        profiler_.Start("SampleStatistics");
+        SampleStatistics();
+        profiler_.Stop();
+      }
+    }
+
+    profiler_.Start("Output");
     // writing a restart file has priority over normal output, so call it first
+    profiler_.Start("RestartFile");
+    double const restart_write_start = MPI_Wtime();
     input_output_.WriteRestartFile(current_simulation_time,
-                                   !timestep_size_is_healthy);
-    if (input_output_.WriteFullOutput(current_simulation_time,
-                                      !timestep_size_is_healthy)) {
+                                   !timestep_size_is_healthy_);
+    restart_write_time_ =
+        std::max(restart_write_time_, MPI_Wtime() - restart_write_start);
+    profiler_.Stop();
+    profiler_.Start("FullOutput");
+    bool const output_written = input_output_.WriteFullOutput(
+        current_simulation_time, !timestep_size_is_healthy_);
+    profiler_.Stop();
+    if (output_written) {
       // if output has been written this timestep, we also write profiling
       // information
       if constexpr (DP::Profile()) {
@@ -165,6 +531,37 @@ void ModularAlgorithmAssembler::ComputeLoop() {
             topology_.LeafRankDistribution(MpiUtilities::NumberOfRanks()));
       }
     }
+    // in-memory checkpoint every n-th macro time step of this run
+    if constexpr (RestartOutputSettings::InMemoryCheckpointInterval > 0) {
+      if (loop_times_.size() %
+              RestartOutputSettings::InMemoryCheckpointInterval ==
+          0) {
+        TakeInMemoryCheckpoint();
+        rollback_retries_ = 0;
+      }
+    }
+    // in-situ analysis every n-th macro time step of this run
+    profiler_.Start("InSituAnalysis");
+    input_output_.WriteInSituAnalysis(current_simulation_time,
+                                      loop_times_.size());
+    profiler_.Stop();
+    // end of the output region
+    profiler_.Stop();
+
+    // Stop with a final restart snapshot in time before the walltime limit of
+    // the job or on a stop signal of the batch system
+    if (WalltimeStopRequired()) {
+      input_output_.WriteRestartFile(current_simulation_time, true);
+      logger_.LogMessage("Walltime limit or stop signal reached. Restart "
+                         "snapshot written, simulation is being stopped");
+      walltime_stop_ = true;
+    }
+
+    // intermediate profiling summary every n-th macro time step of this run
+    if (profiling_interval_ > 0 &&
+        loop_times_.size() % profiling_interval_ == 0) {
+      LogProfilingSummary();
+    }
 
     logger_.RunningAlpaca((current_simulation_time - start_time_) /
                           (end_time_ - start_time_));
@@ -172,40 +569,86 @@ void ModularAlgorithmAssembler::ComputeLoop() {
 
     // Finalize the output time measurement
     if constexpr (CC::TR()) {
-      MPI_Barrier(MPI_COMM_WORLD);
+      MPI_Barrier(MpiUtilities::Communicator());
       time_measurement_end = MPI_Wtime();
-      output_runtimes.push_back(time_measurement_end - time_measurement_start);
+      output_runtimes_.push_back(time_measurement_end - time_measurement_start);
     }
   }
 
-  if constexpr (DP::Profile()) {
+  if (timesteps > 0) {
+    WriteRunStatus(current_simulation_time, timestep_size, loop_times_.size(),
+                   MPI_Wtime() - run_start_time_);
+  }
+  return timesteps;
+}
+
+/**
+ * @brief Logs the summaries of the run ( communication, profiling, memory and
+ * timings ) and writes the trace files. Called once after the last macro
+ * timestep.
+ */
+void ModularAlgorithmAssembler::FinishComputeLoop() {
+  // complete the exchange of the last in-memory checkpoint
+  communicator_.WaitAll(checkpoint_.requests_);
+  checkpoint_.requests_.clear();
+  if (CommunicationStatistics::Instance().recording_) {
     logger_.LogMessage(SummedCommunicationStatisticsString());
+    for (std::string const &line : CommunicationVolumeStatistics()) {
+      logger_.LogMessage(line);
+    }
+    input_output_.WriteCommunicationMatrix();
   }
+  LogProfilingSummary();
+  LogMemoryReport();
+  input_output_.WriteTraceFiles();
   logger_.LogMessage(
       "Total Time Spent in Compute Loop ( seconds ): " +
       StringOperations::ToScientificNotationString(
-          std::accumulate(loop_times.begin(), loop_times.end(), 0.0), 5));
+          std::accumulate(loop_times_.begin(), loop_times_.end(), 0.0), 5));
   if constexpr (CC::TR()) {
     logger_.LogMessage("Total Time Spent for Output Writing ( seconds ): " +
                        StringOperations::ToScientificNotationString(
-                           std::accumulate(output_runtimes.begin(),
-                                           output_runtimes.end(), 0.0),
+                           std::accumulate(output_runtimes_.begin(),
+                                           output_runtimes_.end(), 0.0),
                            5));
   }
 }
 
+/**
+ * @brief Gives the current time of the simulation.
+ * @return The (non-dimensional) time at the end of the last macro timestep.
+ */
+double ModularAlgorithmAssembler::CurrentTime() const {
+  return time_integrator_.CurrentRunTime();
+}
+
+/**
+ * @brief Indicates whether the run cannot be advanced any further, i.e. the
+ * end time or the maximum number of macro timesteps is reached, the
+ * timestep size became unhealthy or the run stopped before the walltime limit.
+ * @return True if the run is finished, false otherwise.
+ */
+bool ModularAlgorithmAssembler::IsFinished() const {
+  return time_integrator_.CurrentRunTime() >= end_time_ ||
+         !timestep_size_is_healthy_ || walltime_stop_ ||
+         (maximum_macro_steps_ != 0 &&
+          loop_times_.size() >= maximum_macro_steps_);
+}
+
 /**
  * @brief Sets-up the starting point of the simulation based on either a restart
  * file or the initial conditions depending on the configuration.
+ * @param initial_condition The initial condition of a new simulation.
+ * @param startup_timer Timer the phases of the initialization are added to.
  */
 void ModularAlgorithmAssembler::Initialization(
-    InitialCondition &initial_condition) {
+    InitialCondition &initial_condition, PhaseTimer &startup_timer) {
 
   double time_measurement_start;
   double time_measurement_end;
   // track the runtime for the initialization if desired
   if constexpr (CC::TR()) {
-    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Barrier(MpiUtilities::Communicator());
     time_measurement_start = MPI_Wtime();
   }
 
@@ -215,23 +658,50 @@ void ModularAlgorithmAssembler::Initialization(
   if (restart_time < 0.0) {
     CreateNewSimulation(initial_condition);
     logger_.LogMessage("Initializing new simulation");
+    startup_timer.Lap("Initial condition and mesh");
   } else { // otherwise finalize the restart
     FinalizeSimulationRestart(restart_time);
+    startup_timer.Lap("Restore from snapshot");
   }
+  UpdateJumpBuffers();
+  UpdateIntegrationBuffers();
+  UpdateStatisticsBuffers();
+  PlaceLeavesOnNumaDomains();
   logger_.LogMessage("Simulation successfully instantiated");
 
   // Information Logging
   LogNodeNumbers();
+  if constexpr (CC::HaloGraphRankPlacement()) {
+    input_output_.WriteSuggestedRankfile(communicator_.HaloBytesOfPartners());
+  }
+  startup_timer.Lap("Buffers and NUMA placement");
 
-  // initial output
+  // initial output ( written in the background if
+  // Hdf5OutputSettings::AsynchronousWrites is set )
   double const run_time = time_integrator_.CurrentRunTime();
-  input_output_.WriteFullOutput(run_time, true);
+  if (initial_output_) {
+    double const output_start = MPI_Wtime();
+    input_output_.WriteFullOutput(run_time, true);
+    // first estimate of the final restart write ( of similar volume )
+    restart_write_time_ = MPI_Wtime() - output_start;
+  } else {
+    logger_.LogMessage("Initial output skipped");
+  }
+  startup_timer.Lap("Initial output");
   input_output_.WriteRestartFile(
       run_time); // Does only trigger writing of restart file if requested by
                  // user input ( =inputfile ).
+  startup_timer.Lap("Initial restart snapshot");
+  if constexpr (RestartOutputSettings::InMemoryCheckpointInterval > 0) {
+    TakeInMemoryCheckpoint();
+    startup_timer.Lap("In-memory checkpoint");
+  }
+  // The walltime of the job includes the startup
+  walltime_start_ = MPI_Wtime() - startup_timer.Total();
+  StopSignal::Install();
 
   if constexpr (CC::TR()) {
-    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Barrier(MpiUtilities::Communicator());
     time_measurement_end = MPI_Wtime();
     logger_.LogMessage("Total Time Spent for Initialization ( seconds ): " +
                        StringOperations::ToScientificNotationString(
@@ -249,6 +719,8 @@ void ModularAlgorithmAssembler::FinalizeSimulationRestart(
 
   // align the simulation with the restart time
   time_integrator_.SetStartTime(restart_time);
+  // the grid sequencing continues with the raises due until the restart time
+  UpdateGridSequencing(restart_time);
 
   // project interface tags to make sure that cut cell tags are present on lower
   // levels
@@ -257,6 +729,10 @@ void ModularAlgorithmAssembler::FinalizeSimulationRestart(
   child_levels_descending.pop_back(); // remove level 0
   UpdateInterfaceTags(child_levels_descending);
 
+  // restore the parents from their children, as leaf-only snapshots do not
+  // store them ( the restored data is held in the right-hand side buffers )
+  averager_.AverageMaterial(child_levels_descending);
+
   // initialize volume fractions if necessary
   std::vector<std::reference_wrapper<Node>> const
       nodes_needing_multiphase_treatment = tree_.NodesWithLevelset();
@@ -282,73 +758,71 @@ void ModularAlgorithmAssembler::FinalizeSimulationRestart(
  * can - commonly only for pathological cases - lead to slight inacuracies and
  * might in a worst-case situation alter the mesh-structure compared to
  * (memory-wise infeasable) top-down approach.
+ * @note With CC::TDI() only blocks whose wavelet details demand refinement or
+ * which contain the interface are refined on the way up, instead of refining
+ * all blocks and coarsening them afterwards. Hence, the fine levels are only
+ * built in these subtrees. Structures which are not visible in the details of
+ * coarser levels are not resolved then.
  */
 void ModularAlgorithmAssembler::CreateNewSimulation(
     InitialCondition &initial_condition) {
 
-  double levelset_temp[CC::TCX()][CC::TCY()][CC::TCZ()];
-  std::int8_t initial_interface_tags[CC::TCX()][CC::TCY()][CC::TCZ()];
   std::vector<MaterialName> initial_materials;
-  std::vector<nid_t> coarsable_list;
-  std::vector<nid_t> globally_coarsable;
-  std::vector<nid_t> parents_of_coarsable;
-  std::vector<nid_t>
-      refinement_list; // This list is only need as stub in this function.
+  std::vector<nid_t> coarsable_parents;
+  std::vector<nid_t> globally_coarsable_parents;
+  // Nodes whose details demand refinement ( only used for CC::TDI() )
+  std::vector<nid_t> refinement_list;
+  std::vector<nid_t> globally_refinable;
+  std::vector<nid_t> remeshing_list;
+  std::vector<nid_t> globally_remeshing;
 
   for (unsigned int level = 0; level <= all_levels_.back(); ++level) {
     if (level > 0) {
       for (nid_t const &node_id : topology_.LocalIdsOnLevel(
                level -
                1)) { // We refine the parent to get the level we want to work on
+        if constexpr (CC::TDI()) {
+          // Level one is built completely, as it may never be coarsened
+          if (level > 1 && !topology_.IsNodeMultiPhase(node_id) &&
+              !std::binary_search(globally_refinable.cbegin(),
+                                  globally_refinable.cend(), node_id)) {
+            continue;
+          }
+        }
+        // Beyond the grid sequencing limit and the maximum level of the
+        // refinement regions only the interface is resolved
+        if ((level > refinement_level_limit_ ||
+             level > multiresolution_.GetRefinementRegions().LevelBoundsOfNode(
+                         node_id)[1]) &&
+            !topology_.IsNodeMultiPhase(node_id)) {
+          continue;
+        }
         topology_.RefineNodeWithId(node_id);
       }
       UpdateTopology();
     }
-    for (nid_t const &node_id : topology_.LocalIdsOnLevel(level)) {
+    // The initial condition of the nodes is evaluated concurrently, the nodes
+    // are created afterwards as the tree may not be modified concurrently
+    std::vector<nid_t> const &level_ids = topology_.LocalIdsOnLevel(level);
+    std::vector<InitialNodeData> initial_node_data(level_ids.size());
+    long const number_of_level_ids = static_cast<long>(level_ids.size());
+#pragma omp parallel for schedule(dynamic)
+    for (long id_index = 0; id_index < number_of_level_ids; ++id_index) {
+      nid_t const node_id = level_ids[id_index];
+      // Evaluated left to right, makes it safe on level zero
+      if (level == 0 || topology_.IsNodeMultiPhase(ParentIdOfNode(node_id))) {
+        EvaluateInitialNode(node_id, initial_condition,
+                            initial_node_data[id_index]);
+      }
+    }
+    for (std::size_t id_index = 0; id_index < level_ids.size(); ++id_index) {
+      nid_t const node_id = level_ids[id_index];
       nid_t parent_id = ParentIdOfNode(node_id);
-      if (level == 0 || topology_.IsNodeMultiPhase(
-                            parent_id)) { // Evaluated left to right, makes it
-                                          // safe on level zero
-        // get the materials that initially exists in this node ( this is
-        // determined on the finest level to avoid losing structures that are
-        // unresolved by this node ) for single fluid simulations, no need to
-        // call levelset initializer
-        if (material_manager_.GetMaterialNames().size() == 1) {
-          initial_materials = material_manager_.GetMaterialNames();
-        } else {
-          // for multi fluid simulations, call the initial material function
-          // from the initial condition class
-          initial_materials = initial_condition.GetInitialMaterials(node_id);
-        }
-        if (initial_materials.size() > 1) {
-          // we have a multi node, thus we need the correct levelset to
-          // determine the interface tags
-          initial_condition.GetInitialLevelset(node_id, levelset_temp);
-          InterfaceTagFunctions::InitializeInternalInterfaceTags(
-              initial_interface_tags);
-          InterfaceTagFunctions::SetInternalCutCellTagsFromLevelset(
-              levelset_temp, initial_interface_tags);
-        } else {
-          // we have a single node, thus we need only to consider uniform
-          // interface tags but no levelset
-          std::int8_t const uniform_tag =
-              MaterialSignCapsule::SignOfMaterial(initial_materials.front()) *
-              ITTI(IT::BulkPhase);
-          for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-            for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-              for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-                initial_interface_tags[i][j][k] = uniform_tag;
-              }
-            }
-          }
-        }
-        if (level == all_levels_.back() &&
-            initial_materials.size() > 1) { // multi and leaf
-          tree_.CreateNode(node_id, initial_materials, initial_interface_tags,
-                           std::make_unique<InterfaceBlock>(levelset_temp));
-        } else { // either single or non-leaf multi
-          tree_.CreateNode(node_id, initial_materials, initial_interface_tags);
-        }
+      InitialNodeData &data = initial_node_data[id_index];
+      if (level == 0 || topology_.IsNodeMultiPhase(parent_id)) {
+        initial_materials = data.materials_;
+        tree_.CreateNode(node_id, initial_materials, data.interface_tags_,
+                         std::move(data.interface_block_));
       } else { // parent is single material
         initial_materials = topology_.GetMaterialsOfNode(parent_id);
         // copying tags of parent is sufficient as they are the same ( single
@@ -402,33 +876,47 @@ void ModularAlgorithmAssembler::CreateNewSimulation(
       halo_manager_.InterfaceHaloUpdateOnLmax(
           InterfaceBlockBufferType::LevelsetRightHandSide);
     }
-    if (level > 1) { // Level One may never be coarsened.
-      coarsable_list.clear();
-      DetermineRemeshingNodes({level - 1}, coarsable_list,
+    if (level > 1 || (CC::TDI() && level == 1)) {
+      coarsable_parents.clear();
+      refinement_list.clear();
+      DetermineRemeshingNodes({level - 1}, coarsable_parents,
                               refinement_list); // Called on parent level
+      if (level == 1) { // Level One may never be coarsened.
+        coarsable_parents.clear();
+      }
+      if constexpr (!CC::TDI()) {
+        refinement_list.clear();
+      }
 
-      MpiUtilities::LocalToGlobalData(coarsable_list, MPI_LONG_LONG_INT,
+      // Only the parents are exchanged, their children follow from the
+      // topology. Both lists are exchanged at once and split again, as nodes
+      // to be refined are leaves while parents are not.
+      remeshing_list = refinement_list;
+      remeshing_list.insert(remeshing_list.end(), coarsable_parents.cbegin(),
+                            coarsable_parents.cend());
+      MpiUtilities::LocalToGlobalData(remeshing_list, MPI_LONG_LONG_INT,
                                       MpiUtilities::NumberOfRanks(),
-                                      globally_coarsable);
-
-      // We get the parents, as coarsening is called on parents. Duplicates do
-      // not hurt ( TopologyManager handles them ).
-      parents_of_coarsable = globally_coarsable;
-      std::for_each(
-          parents_of_coarsable.begin(), parents_of_coarsable.end(),
-          [](nid_t &to_parent) { to_parent = ParentIdOfNode(to_parent); });
-      for (auto const &coarsable_id : coarsable_list) {
-        if (topology_.NodeIsOnRank(coarsable_id, communicator_.MyRankId())) {
-          tree_.RemoveNodeWithId(coarsable_id);
+                                      globally_remeshing);
+      globally_refinable.clear();
+      globally_coarsable_parents.clear();
+      std::partition_copy(
+          globally_remeshing.cbegin(), globally_remeshing.cend(),
+          std::back_inserter(globally_refinable),
+          std::back_inserter(globally_coarsable_parents),
+          [this](nid_t const id) { return topology_.NodeIsLeaf(id); });
+      std::sort(globally_refinable.begin(), globally_refinable.end());
+      for (nid_t const parent_id : globally_coarsable_parents) {
+        for (nid_t const child_id : IdsOfChildren(parent_id)) {
+          if (topology_.NodeIsOnRank(child_id, communicator_.MyRankId())) {
+            tree_.RemoveNodeWithId(child_id);
+          }
         }
-      }
-
-      // Update the topology
-      for (nid_t const parent_id : parents_of_coarsable) {
+        // Update the topology
         topology_.CoarseNodeWithId(parent_id);
       }
-      if (!parents_of_coarsable.empty()) {
+      if (!globally_coarsable_parents.empty()) {
         communicator_.InvalidateCache();
+        cached_details_.clear();
       }
     }
 
@@ -535,6 +1023,54 @@ void ModularAlgorithmAssembler::CreateNewSimulation(
   }
 }
 
+/**
+ * @brief Evaluates the initial materials, interface tags and, on the interface
+ * level, the interface block of a node whose parent is multi-phase ( or which
+ * is on level zero ). Thread-safe, the node itself is not created.
+ * @param node_id The id of the node.
+ * @param initial_condition The initial condition to be evaluated.
+ * @param data The evaluated initial data of the node ( indirect return
+ * parameter ).
+ * @note The materials that initially exist in the node are determined on the
+ * finest level to avoid losing structures that are unresolved by this node.
+ */
+void ModularAlgorithmAssembler::EvaluateInitialNode(
+    nid_t const node_id, InitialCondition &initial_condition,
+    InitialNodeData &data) const {
+  // for single fluid simulations, no need to call levelset initializer
+  if (material_manager_.GetMaterialNames().size() == 1) {
+    data.materials_ = material_manager_.GetMaterialNames();
+  } else {
+    data.materials_ = initial_condition.GetInitialMaterials(node_id);
+  }
+  if (data.materials_.size() > 1) {
+    // we have a multi node, thus we need the correct levelset to determine the
+    // interface tags
+    double levelset[CC::TCX()][CC::TCY()][CC::TCZ()];
+    initial_condition.GetInitialLevelset(node_id, levelset);
+    InterfaceTagFunctions::InitializeInternalInterfaceTags(
+        data.interface_tags_);
+    InterfaceTagFunctions::SetInternalCutCellTagsFromLevelset(
+        levelset, data.interface_tags_);
+    if (LevelOfNode(node_id) == all_levels_.back()) {
+      data.interface_block_ = std::make_unique<InterfaceBlock>(levelset);
+    }
+  } else {
+    // we have a single node, thus we need only to consider uniform interface
+    // tags but no levelset
+    std::int8_t const uniform_tag =
+        MaterialSignCapsule::SignOfMaterial(data.materials_.front()) *
+        ITTI(IT::BulkPhase);
+    for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+      for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+        for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+          data.interface_tags_[i][j][k] = uniform_tag;
+        }
+      }
+    }
+  }
+}
+
 /**
  * @brief Advances the simulation in time by one macro time step. To do so
  * 2^level micro time steps need to be executed each consisting of 1 to n
@@ -548,9 +1084,6 @@ void ModularAlgorithmAssembler::Advance() {
   bool plot_this_step = false;
   bool log_this_step = false;
 
-  // These variables are only for profiling
-  double function_timer = 0.0;
-
   unsigned int const maximum_level = all_levels_.back();
 
   // number of timesteps to run on the maximum level to run one timestep on
@@ -570,22 +1103,45 @@ void ModularAlgorithmAssembler::Advance() {
 
   double time_measurement_start = 0.0;
   double time_measurement_end = 0.0;
+  // Set if the right-hand side of the next stage was already computed
+  bool right_hand_side_computed = false;
 
   // Run enough timesteps on the maximum level to run one timestep on level 0
   for (unsigned int timestep = 0;
        timestep < number_of_timesteps_on_finest_level; ++timestep) {
 
-    SetTimeInProfileRuns(function_timer);
     if constexpr (DP::Profile()) {
-      MPI_Barrier(MPI_COMM_WORLD); // For Time measurement
+      MPI_Barrier(MpiUtilities::Communicator()); // For Time measurement
       time_measurement_start = MPI_Wtime();
     }
 
-    time_integrator_.AppendMicroTimestep(ComputeTimestepSize());
-    LogElapsedTimeSinceInProfileRuns(function_timer,
-                                     "ComputeTimestepSize                ");
-    ProvideDebugInformation("ComputeTimestepSize - Done ", plot_this_step,
-                            log_this_step, debug_key);
+    // The global time step size is first needed for the integration of the
+    // first stage, hence, its reduction is overlapped with the right-hand side
+    profiler_.Start("ComputeTimestepSize");
+    double const local_timestep_size = ComputeLocalTimestepSize();
+    double global_timestep_size = 0.0;
+    MPI_Request timestep_size_request;
+    MPI_Iallreduce(&local_timestep_size, &global_timestep_size, 1, MPI_DOUBLE,
+                   MPI_MIN, MpiUtilities::Communicator(),
+                   &timestep_size_request);
+    profiler_.Stop();
+    auto const finish_timestep_size = [&]() {
+      if (timestep_size_request == MPI_REQUEST_NULL) {
+        return;
+      }
+      profiler_.Start("ComputeTimestepSize");
+      MPI_Wait(&timestep_size_request, MPI_STATUS_IGNORE);
+      time_integrator_.AppendMicroTimestep(global_timestep_size);
+      profiler_.Stop();
+      logger_.LogMessage("Timestep = " +
+                         StringOperations::ToScientificNotationString(
+                             unit_handler_.DimensionalizeValue(
+                                 global_timestep_size, UnitType::Time),
+                             9));
+      logger_.FlushToTerminal();
+      ProvideDebugInformation("ComputeTimestepSize - Done ", plot_this_step,
+                              log_this_step, debug_key);
+    };
 
     for (unsigned int stage = 0; stage < time_integrator_.NumberOfStages();
          ++stage) {
@@ -608,34 +1164,31 @@ void ModularAlgorithmAssembler::Advance() {
       // the next stage. Reinitialized parameters are stored in integrated
       // buffers.
       if (exist_multi_nodes_global) {
-        SetTimeInProfileRuns(function_timer);
+        profiler_.Start("ComputeLevelsetRightHandSide");
         ComputeLevelsetRightHandSide(nodes_needing_multiphase_treatment, stage);
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "ComputeLevelsetRightHandSide       ");
+        profiler_.Stop();
         ProvideDebugInformation("ComputeLevelsetRightHandSide - Done ",
                                 plot_this_step, log_this_step, debug_key);
 
-        SetTimeInProfileRuns(function_timer);
+        profiler_.Start("LevelsetHaloUpdate");
         halo_manager_.InterfaceHaloUpdateOnLmax(
             InterfaceBlockBufferType::LevelsetRightHandSide);
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "LevelsetHaloUpdate                 ");
+        profiler_.Stop();
         ProvideDebugInformation("LevelsetHaloUpdate ( maximum level ) - Done ",
                                 plot_this_step, log_this_step, debug_key);
 
-        SetTimeInProfileRuns(function_timer);
+        finish_timestep_size();
+        profiler_.Start("IntegrateLevelset");
         IntegrateLevelset(nodes_needing_multiphase_treatment, stage);
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "IntegrateLevelset                  ");
+        profiler_.Stop();
         ProvideDebugInformation("IntegrateLevelset - Done ", plot_this_step,
                                 log_this_step, debug_key);
 
         bool const is_last_stage = time_integrator_.IsLastStage(stage);
-        SetTimeInProfileRuns(function_timer);
+        profiler_.Start("UpdateIntegratedBuffer");
         multi_phase_manager_.UpdateIntegratedBuffer(
             nodes_needing_multiphase_treatment, is_last_stage);
-        LogElapsedTimeSinceInProfileRuns(
-            function_timer, "UpdateIntegratedBuffer                  ");
+        profiler_.Stop();
         std::string &&message =
             is_last_stage
                 ? "UpdateIntegratedBuffer in MultiphaseManager ( possibly with "
@@ -646,28 +1199,35 @@ void ModularAlgorithmAssembler::Advance() {
       }
 
       // compute rhs on all levels which need to be updated this integer
-      // timestep
-      SetTimeInProfileRuns(function_timer);
-      ComputeRightHandSide(levels_to_update_descending, stage);
-      LogElapsedTimeSinceInProfileRuns(function_timer,
-                                       "ComputeRightHandSide               ");
-      ProvideDebugInformation("ComputeRightHandSide - Done ", plot_this_step,
-                              log_this_step, debug_key);
+      // timestep (unless done while overlapping the last halo update)
+      if (!right_hand_side_computed) {
+        profiler_.Start("ComputeRightHandSide");
+        ComputeRightHandSide(levels_to_update_descending, stage);
+        profiler_.Stop();
+        ProvideDebugInformation("ComputeRightHandSide - Done ", plot_this_step,
+                                log_this_step, debug_key);
+      }
+      right_hand_side_computed = false;
 
       // Flux averaging from levels which run this timestep down to the lowest
       // neighbor level or parent
-      SetTimeInProfileRuns(function_timer);
+      profiler_.Start("AverageMaterial");
       averager_.AverageMaterial(levels_to_update_descending);
-      LogElapsedTimeSinceInProfileRuns(
-          function_timer, "AverageMaterial                       ");
+      profiler_.Stop();
       ProvideDebugInformation("AverageMaterial - Done ", plot_this_step,
                               log_this_step, debug_key);
 
-      SetTimeInProfileRuns(function_timer);
-      halo_manager_.MaterialHaloUpdate(all_levels_,
-                                       MaterialFieldType::Conservatives);
-      LogElapsedTimeSinceInProfileRuns(function_timer,
-                                       "UpdateHalos ( all )                  ");
+      // Only the levels which changed since the previous halo update of this
+      // kind are exchanged, the halos of all others are still valid. Without
+      // remeshing and migration these are the advanced levels and their parents
+      // ( averaging and jump flux adjustment ).
+      std::vector<unsigned int> const changed_levels = TakeOutdatedHaloLevels();
+      profiler_.Start("UpdateHalos ( all )");
+      if (!changed_levels.empty()) {
+        halo_manager_.MaterialHaloUpdate(changed_levels,
+                                         MaterialFieldType::Conservatives);
+      }
+      profiler_.Stop();
       ProvideDebugInformation("UpdateHalos( AllLevels ) - Done ",
                               plot_this_step, log_this_step, debug_key);
 
@@ -681,21 +1241,20 @@ void ModularAlgorithmAssembler::Advance() {
       levels_with_updated_parents_descending = levels_to_update_descending;
       levels_with_updated_parents_descending.pop_back();
 
-      SetTimeInProfileRuns(function_timer);
+      finish_timestep_size();
+      profiler_.Start("Integrate");
       Integrate(levels_to_update_descending, stage);
-      LogElapsedTimeSinceInProfileRuns(function_timer,
-                                       "Integrate                          ");
+      profiler_.Stop();
       ProvideDebugInformation("Integration - Done ", plot_this_step,
                               log_this_step, debug_key);
 
       // After fluid evolution is done, integrated values are copied into
       // reinitialized values for the next iteration.
       if (exist_multi_nodes_global) {
-        SetTimeInProfileRuns(function_timer);
+        profiler_.Start("PropagateLevelset");
         multi_phase_manager_.PropagateLevelset(
             nodes_needing_multiphase_treatment);
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "PropagateLevelset                  ");
+        profiler_.Stop();
         ProvideDebugInformation(
             "PropagateLevelset in MultiphaseManager - Done ", plot_this_step,
             log_this_step, debug_key);
@@ -703,66 +1262,89 @@ void ModularAlgorithmAssembler::Advance() {
 
       // Averaging of new mean values - project all levels to be on the safe
       // side
-      SetTimeInProfileRuns(function_timer);
+      profiler_.Start("AverageMaterial");
       averager_.AverageMaterial(levels_with_updated_parents_descending);
-      LogElapsedTimeSinceInProfileRuns(
-          function_timer, "AverageMaterial                       ");
+      profiler_.Stop();
       ProvideDebugInformation("AverageMaterial - Done ", plot_this_step,
                               log_this_step, debug_key);
 
       // to maintain conservation
       if (time_integrator_.IsLastStage(stage)) {
         // We correct the values at jumps to maintain conservation.
-        SetTimeInProfileRuns(function_timer);
+        profiler_.Start("AdjustJumpFluxes");
         JumpFluxAdjustment(levels_to_update_descending);
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "AdjustJumpFluxes                   ");
+        profiler_.Stop();
         ProvideDebugInformation("AdjustJumpFluxes - Done ", plot_this_step,
                                 log_this_step, debug_key);
       }
 
+      // In single-phase stages that are not the last one only the swap and the
+      // prime-state recovery follow the halo update. It is therefore
+      // overlapped with these and the right-hand side of the next stage.
+      if (CC::OverlapHaloCommunication() && !uses_global_eigenvalues &&
+          !CC::ParameterModelActive() && !exist_multi_nodes_global &&
+          !time_integrator_.IsLastStage(stage)) {
+        profiler_.Start("UpdateHalos + Swap + RHS ( overlapped )");
+        HaloUpdateOverlappedWithRightHandSide(levels_to_update_ascending,
+                                              stage + 1);
+        profiler_.Stop();
+        ProvideDebugInformation(
+            "UpdateHalos( levels_to_update, cut_jump=true ) overlapped with "
+            "Swap, ObtainPrimeStates and ComputeRightHandSide - Done ",
+            plot_this_step, log_this_step, debug_key);
+        right_hand_side_computed = true;
+        continue;
+      }
+
       // boundary exchange mean values and jumps on finished levels
-      SetTimeInProfileRuns(function_timer);
+      profiler_.Start("UpdateHalos ( cut_jumps )");
+      // Only the right-hand side of the next stage reads the halos of the
+      // maximum level in single-phase stages that are not the last one
+      unsigned int const halo_depth =
+          exist_multi_nodes_global || time_integrator_.IsLastStage(stage)
+              ? CC::HS()
+              : right_hand_side_halo_depth;
       halo_manager_.MaterialHaloUpdate(levels_to_update_ascending,
-                                       MaterialFieldType::Conservatives, true);
-      LogElapsedTimeSinceInProfileRuns(function_timer,
-                                       "UpdateHalos ( cut_jumps )            ");
+                                       MaterialFieldType::Conservatives, true,
+                                       halo_depth);
+      profiler_.Stop();
       ProvideDebugInformation(
           "UpdateHalos( levels_to_update, cut_jump=true ) - Done ",
           plot_this_step, log_this_step, debug_key);
 
       if (time_integrator_.IsLastStage(stage)) {
         if (exist_multi_nodes_global) {
-          SetTimeInProfileRuns(function_timer);
+          profiler_.Start("SenseVanishedInterface");
           SenseVanishedInterface(levels_to_update_descending);
-          LogElapsedTimeSinceInProfileRuns(
-              function_timer, "SenseVanishedInterface             ");
+          profiler_.Stop();
           ProvideDebugInformation("SenseVanishedInterface - Done ",
                                   plot_this_step, log_this_step, debug_key);
         }
 
-        SetTimeInProfileRuns(function_timer);
-        Remesh(levels_to_update_ascending);
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "Remesh                             ");
+        profiler_.Start("Remesh");
+        bool const remeshed = Remesh(levels_to_update_ascending);
+        profiler_.Stop();
         ProvideDebugInformation("Remesh - Done ", plot_this_step, log_this_step,
                                 debug_key);
 
         if (exist_multi_nodes_global) { // TODO-19 JW and NH: Think of removing
                                         // this if statement in case of a newly
                                         // created interface ( phase change... )
-          SetTimeInProfileRuns(function_timer);
+          profiler_.Start("SenseApproachingInterface");
           SenseApproachingInterface(levels_to_update_ascending);
-          LogElapsedTimeSinceInProfileRuns(
-              function_timer, "SenseApproachingInterface          ");
+          profiler_.Stop();
           ProvideDebugInformation("SenseApproachingInterface - Done ",
                                   plot_this_step, log_this_step, debug_key);
         }
 
-        SetTimeInProfileRuns(function_timer);
-        LoadBalancing(levels_to_update_descending);
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "LoadBalancing                      ");
+        // the load is only rebalanced along with the remeshing
+        if (remeshed) {
+          profiler_.Start("LoadBalancing");
+          LoadBalancing(levels_to_update_descending,
+                        memory_rebalance_required_);
+          memory_rebalance_required_ = false;
+          profiler_.Stop();
+        }
 
         nodes_needing_multiphase_treatment = tree_.NodesWithLevelset();
         exist_multi_nodes_global = MpiUtilities::GloballyReducedBool(
@@ -777,21 +1359,20 @@ void ModularAlgorithmAssembler::Advance() {
       } // last stage
 
       if (exist_multi_nodes_global) {
-        SetTimeInProfileRuns(function_timer);
+        profiler_.Start("Mixing");
+        CostClock::time_point cost_start = CostMeasurementStart();
         multi_phase_manager_.Mix(nodes_needing_multiphase_treatment);
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "Mixing                             ");
+        ChargeNodes(nodes_needing_multiphase_treatment, cost_start);
+        profiler_.Stop();
         ProvideDebugInformation("Mixing - Done ", plot_this_step, log_this_step,
                                 debug_key);
 
         if constexpr (ReinitializationConstants::ReinitializeAfterMixing) {
           bool const is_last_stage = time_integrator_.IsLastStage(stage);
-          SetTimeInProfileRuns(function_timer);
+          profiler_.Start("EnforceWellResolvedDistanceFunction");
           multi_phase_manager_.EnforceWellResolvedDistanceFunction(
               nodes_needing_multiphase_treatment, is_last_stage);
-          LogElapsedTimeSinceInProfileRuns(
-              function_timer,
-              "EnforceWellResolvedDistanceFunction                  ");
+          profiler_.Stop();
           std::string &&message =
               is_last_stage
                   ? "EnforceWellResolvedDistanceFunction in MultiphaseManager "
@@ -802,44 +1383,53 @@ void ModularAlgorithmAssembler::Advance() {
                                   debug_key);
         }
 
-        SetTimeInProfileRuns(function_timer);
-        UpdateInterfaceTags(levels_with_updated_parents_descending);
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "UpdateInterfaceTags                ");
+        profiler_.Start("UpdateInterfaceTags");
+        // Between the stages only the multi-phase nodes changed their tags
+        UpdateInterfaceTags(levels_with_updated_parents_descending,
+                            !time_integrator_.IsLastStage(stage));
+        profiler_.Stop();
         ProvideDebugInformation("UpdateInterfaceTags - Done ", plot_this_step,
                                 log_this_step, debug_key);
 
-        SetTimeInProfileRuns(function_timer);
+        if constexpr (CC::CacheInterfaceGeometry()) {
+          profiler_.Start("UpdateGeometryCache");
+          multi_phase_manager_.UpdateGeometryCache(
+              nodes_needing_multiphase_treatment);
+          profiler_.Stop();
+          ProvideDebugInformation("UpdateGeometryCache - Done ", plot_this_step,
+                                  log_this_step, debug_key);
+        }
+
+        profiler_.Start("ObtainPrimeStatesFromConservatives");
         ObtainPrimeStatesFromConservatives<
             ConservativeBufferType::RightHandSide>({all_levels_.back()}, true);
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "ObtainPrimeStatesFromConservatives ");
+        profiler_.Stop();
         ProvideDebugInformation("ObtainPrimeStatesFromConservatives - Done ",
                                 plot_this_step, log_this_step, debug_key);
 
-        SetTimeInProfileRuns(function_timer);
+        profiler_.Start("Extend");
+        cost_start = CostMeasurementStart();
         multi_phase_manager_.Extend(nodes_needing_multiphase_treatment);
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "Extend                             ");
+        ChargeNodes(nodes_needing_multiphase_treatment, cost_start);
+        profiler_.Stop();
         ProvideDebugInformation("Extend - Done ", plot_this_step, log_this_step,
                                 debug_key);
       }
 
       // SWAP on levels which were integrated this step
-      SetTimeInProfileRuns(function_timer);
+      profiler_.Start("Swap");
       SwapBuffers(levels_to_update_descending, stage);
-      LogElapsedTimeSinceInProfileRuns(function_timer,
-                                       "Swap                               ");
+      profiler_.Stop();
       ProvideDebugInformation("SwapOnLevel - Done ", plot_this_step,
                               log_this_step, debug_key);
 
       // Calculate the prime states based on the integrated conservatives and
       // save them in the prime state buffer.
-      SetTimeInProfileRuns(function_timer);
+      profiler_.Start("ObtainPrimeStatesFromConservatives");
       ObtainPrimeStatesFromConservatives<ConservativeBufferType::Average>(
           levels_to_update_descending);
-      LogElapsedTimeSinceInProfileRuns(function_timer,
-                                       "ObtainPrimeStatesFromConservatives ");
+      recovered_leaves_.clear();
+      profiler_.Stop();
       ProvideDebugInformation("ObtainPrimeStatesFromConservatives - Done ",
                               plot_this_step, log_this_step, debug_key);
 
@@ -850,21 +1440,22 @@ void ModularAlgorithmAssembler::Advance() {
         std::vector<unsigned int> levels_to_update(all_levels_);
         std::reverse(levels_to_update.begin(), levels_to_update.end());
 
-        SetTimeInProfileRuns(function_timer);
+        profiler_.Start("UpdateParameters");
         UpdateParameters(levels_to_update, exist_multi_nodes_global,
                          nodes_needing_multiphase_treatment);
-        LogElapsedTimeSinceInProfileRuns(function_timer, "UpdateParameters ");
+        profiler_.Stop();
         ProvideDebugInformation("UpdateParameters - Done ", plot_this_step,
                                 log_this_step, debug_key);
       }
 
       if (exist_multi_nodes_global) {
-        SetTimeInProfileRuns(function_timer);
+        profiler_.Start("SetInterfaceQuantities");
+        CostClock::time_point const cost_start = CostMeasurementStart();
         multi_phase_manager_.ObtainInterfaceStates(
             nodes_needing_multiphase_treatment,
             time_integrator_.IsLastStage(stage));
-        LogElapsedTimeSinceInProfileRuns(function_timer,
-                                         "SetInterfaceQuantities             ");
+        ChargeNodes(nodes_needing_multiphase_treatment, cost_start);
+        profiler_.Stop();
         ProvideDebugInformation("SetInterfaceQuantities - Done ",
                                 plot_this_step, log_this_step, debug_key);
         if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
@@ -874,7 +1465,7 @@ void ModularAlgorithmAssembler::Advance() {
     } // stages
 
     if constexpr (DP::Profile()) {
-      MPI_Barrier(MPI_COMM_WORLD); // For Time measurement
+      MPI_Barrier(MpiUtilities::Communicator()); // For Time measurement
       time_measurement_end = MPI_Wtime();
       // Information Logging
       auto &&[number_of_nodes, number_of_leaves] = topology_.NodeAndLeafCount();
@@ -899,13 +1490,31 @@ void ModularAlgorithmAssembler::Advance() {
     }
 
     // Safe stop of the code ( after every micro timestep, therefore not in
-    // ComputeLoop )
-    if (input_output_.CheckIfAbortfileExists()) {
+    // ComputeLoop ). With in-memory checkpoints the macro timestep is left
+    // and rolled back on all ranks at once
+    if constexpr (RestartOutputSettings::InMemoryCheckpointInterval > 0) {
+      if (MpiUtilities::GloballyReducedBool(
+              input_output_.CheckIfAbortfileExists())) {
+        abort_requested_ = true;
+        break;
+      }
+    } else if (input_output_.CheckIfAbortfileExists()) {
       logger_.LogMessage("The file 'ABORTFILE' was found in the output folder. "
                          "Simulation is being terminated");
       throw std::runtime_error("The simulation was aborted by the user! \n");
     }
   }
+
+  // The parabolic terms follow the completed macro timestep
+  if constexpr (CC::SuperTimeStepping()) {
+    if (!abort_requested_) {
+      profiler_.Start("SuperTimeStep");
+      SuperTimeStep();
+      profiler_.Stop();
+      ProvideDebugInformation("SuperTimeStep - Done ", plot_this_step,
+                              log_this_step, debug_key);
+    }
+  }
   communicator_.ResetTagsForPartner();
 }
 
@@ -927,8 +1536,8 @@ void ModularAlgorithmAssembler::ProvideDebugInformation(
     bool const log_this_step, double &debug_key) const {
   if constexpr (DP::DebugLog()) {
     if (log_this_step) {
-      MPI_Barrier(MPI_COMM_WORLD); // In debuging we want to make sure all ranks
-                                   // have reached this point.
+      // In debuging we want to make sure all ranks have reached this point.
+      MPI_Barrier(MpiUtilities::Communicator());
       logger_.LogMessage(debug_string + std::to_string(debug_key));
       logger_.Flush();
     }
@@ -950,15 +1559,16 @@ void ModularAlgorithmAssembler::ProvideDebugInformation(
  * @param levels For all leaves on these levels the right-hand side will be
  * computed.
  * @param stage The current Runge-Kutta stage.
+ * @note If compiled with OpenMP (cmake option HYBRID) the leaves of each level
+ * are processed by all threads of the rank.
  */
 void ModularAlgorithmAssembler::ComputeRightHandSide(
     std::vector<unsigned int> const levels, unsigned int const stage) {
 
+  MarkHalosOutdated(levels);
+
   // Global Lax-Friedrich scheme
-  if constexpr (convective_term_solver ==
-                    ConvectiveTermSolvers::FluxSplitting &&
-                FluxSplittingSettings::flux_splitting_scheme ==
-                    FluxSplitting::GlobalLaxFriedrichs) {
+  if constexpr (uses_global_eigenvalues) {
     // In case of Global Lax Friedrichs Eigenvalues must be collected across
     // ranks and blocks
     double max_eigenvalues[DTI(CC::DIM())][MF::ANOE()];
@@ -968,10 +1578,17 @@ void ModularAlgorithmAssembler::ComputeRightHandSide(
         max_eigenvalues[d][e] = 0.0;
       }
     }
-    double current_eigenvalues[DTI(CC::DIM())][MF::ANOE()];
+    // Maximum operations are exact, hence the per-thread reduction gives
+    // identical results independent of the thread count and ordering
     for (auto const &level : levels) {
-      for (Node const &node : tree_.LeavesOnLevel(level)) {
-        for (auto &phase : node.GetPhases()) {
+      std::vector<std::reference_wrapper<Node const>> const &leaves =
+          std::as_const(tree_).LeavesOnLevel(level);
+      long const number_of_leaves = static_cast<long>(leaves.size());
+#pragma omp parallel for schedule(runtime)                                     \
+    reduction(max : max_eigenvalues[:DTI(CC::DIM())][:MF::ANOE()])
+      for (long leaf_index = 0; leaf_index < number_of_leaves; ++leaf_index) {
+        double current_eigenvalues[DTI(CC::DIM())][MF::ANOE()];
+        for (auto &phase : leaves[leaf_index].get().GetPhases()) {
           space_solver_.ComputeMaxEigenvaluesForPhase(phase,
                                                       current_eigenvalues);
           for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
@@ -983,28 +1600,183 @@ void ModularAlgorithmAssembler::ComputeRightHandSide(
         } // phases
       }   // node
     }     // level
-    MPI_Allreduce(MPI_IN_PLACE, max_eigenvalues, DTI(CC::DIM()) * MF::ANOE(),
-                  MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Request eigenvalue_request;
+    MPI_Iallreduce(MPI_IN_PLACE, max_eigenvalues, DTI(CC::DIM()) * MF::ANOE(),
+                   MPI_DOUBLE, MPI_MAX, MpiUtilities::Communicator(),
+                   &eigenvalue_request);
+    // The initial buffers do not depend on the eigenvalues, hence, they are
+    // filled while the reduction is in flight
+    for (auto const &level : levels) {
+      std::vector<std::reference_wrapper<Node>> const &leaves =
+          tree_.LeavesOnLevel(level);
+      long const number_of_leaves = static_cast<long>(leaves.size());
+#pragma omp parallel for schedule(runtime)
+      for (long leaf_index = 0; leaf_index < number_of_leaves; ++leaf_index) {
+        time_integrator_.FillInitialBuffer(leaves[leaf_index], stage);
+      } // node
+    }   // level
+    MPI_Wait(&eigenvalue_request, MPI_STATUS_IGNORE);
     space_solver_.SetFluxFunctionGlobalEigenvalues(max_eigenvalues);
   }
   for (auto const &level : levels) {
-    for (Node &node : tree_.LeavesOnLevel(level)) {
-      time_integrator_.FillInitialBuffer(node, stage);
+    // Superblocks ( the rank-local siblings of one parent ) are distributed
+    // among the threads of a rank. Within a superblock the siblings are
+    // computed one after another, such that the convective fluxes over their
+    // shared faces are computed once and handed from the lower to the upper
+    // sibling.
+    if constexpr (CC::SuperblockExecution()) {
+      std::vector<std::vector<nid_t>> const superblocks =
+          Superblocks(topology_.LocalLeafIdsOnLevel(level), level);
+      long const number_of_superblocks = static_cast<long>(superblocks.size());
+#pragma omp parallel for schedule(runtime)
+      for (long superblock_index = 0; superblock_index < number_of_superblocks;
+           ++superblock_index) {
+        // One face storage per thread, reused for all superblocks
+        thread_local SiblingFaceFluxes sibling_fluxes;
+        sibling_fluxes.material_.fill(std::nullopt);
+        for (nid_t const id : superblocks[superblock_index]) {
+          ComputeRightHandSideOfNode(tree_.GetNodeWithId(id), stage,
+                                     !uses_global_eigenvalues, &sibling_fluxes,
+                                     PositionOfNodeAmongSiblings(id));
+        }
+      } // superblock
+      continue;
+    }
+    // The leaves are independent of each other, i.e. they are distributed
+    // among the threads of a rank (if compiled with OpenMP). All MPI
+    // communication happens outside of this loop. Hence, faces shared by two
+    // leaves are computed by both of them. Superblock execution ( see
+    // CompileTimeConstants ) trades this independence for computing the faces
+    // shared by siblings once.
+    std::vector<std::reference_wrapper<Node>> const &leaves =
+        tree_.LeavesOnLevel(level);
+    long const number_of_leaves = static_cast<long>(leaves.size());
+#pragma omp parallel for schedule(runtime)
+    for (long leaf_index = 0; leaf_index < number_of_leaves; ++leaf_index) {
+      ComputeRightHandSideOfNode(leaves[leaf_index], stage,
+                                 !uses_global_eigenvalues);
+    } // node
+  }   // level
+}
+
+/**
+ * @brief Computes the right-hand side of a single leaf, see
+ * ComputeRightHandSide.
+ * @param node The leaf for which the right-hand side is computed.
+ * @param stage The current Runge-Kutta stage.
+ * @param fill_initial_buffer Indicates whether the initial buffer still has to
+ * be filled ( false if already done for all leaves, see ComputeRightHandSide ).
+ * @param sibling_fluxes The face fluxes of the superblock of the leaf, nullptr
+ * if not computed as part of a superblock ( see SpaceSolver::UpdateFluxes ).
+ * @param sibling_position The position of the leaf among its siblings.
+ */
+void ModularAlgorithmAssembler::ComputeRightHandSideOfNode(
+    Node &node, unsigned int const stage, bool const fill_initial_buffer,
+    SiblingFaceFluxes *sibling_fluxes, unsigned int const sibling_position) {
+  CostClock::time_point const cost_start = CostMeasurementStart();
+  // The right-hand side of a solid boundary is zero ( see
+  // SpaceSolver::UpdateFluxes ), neither the initial buffer nor the buffer
+  // preparation is needed as the integration is skipped ( see Integrate )
+  if (IsStaticSolidNode(node)) {
+    for (auto &phase : node.GetPhases()) {
+      for (Equation const eq : MF::ASOE()) {
+        FieldValue(&rhs_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+            phase.second.GetRightHandSideBuffer(eq);
+        std::fill_n(&rhs_buffer[0][0][0], CC::TCX() * CC::TCY() * CC::TCZ(),
+                    0.0);
+      }
+    }
+    ChargeNode(node, cost_start);
+    return;
+  }
+  if (fill_initial_buffer) {
+    time_integrator_.FillInitialBuffer(node, stage);
+  }
 
-      // compute fluxes for levelset and materials ( including single phase and
-      // interface contributions! )
-      space_solver_.UpdateFluxes(node);
+  // compute fluxes for levelset and materials ( including single phase and
+  // interface contributions! )
+  space_solver_.UpdateFluxes(node, sibling_fluxes, sibling_position);
 
-      // Integration can only be performed on conservatives, but not on volume
-      // averaged conservatives. Thus, we have to transform the volume averaged
-      // conservatives, which are currently saved in the average buffer, to
-      // conservatives.
-      multi_phase_manager_.TransformToConservatives(node);
+  // Integration can only be performed on conservatives, but not on volume
+  // averaged conservatives. Thus, we have to transform the volume averaged
+  // conservatives, which are currently saved in the average buffer, to
+  // conservatives.
+  multi_phase_manager_.TransformToConservatives(node);
 
-      // Conservative as well as levelset buffers are prepared for integration
-      time_integrator_.PrepareBufferForIntegration(node, stage);
-    } // node
-  }   // level
+  // Conservative as well as levelset buffers are prepared for integration
+  time_integrator_.PrepareBufferForIntegration(node, stage);
+  ChargeNode(node, cost_start);
+}
+
+/**
+ * @brief Carries out the conservative halo update at the end of a single-phase
+ * Runge-Kutta stage that is not the last one. The MPI communication is
+ * overlapped with the buffer swap, the prime-state recovery and the right-hand
+ * side computation of the next stage. The work is scheduled as task graph:
+ * Nodes that do not take part in MPI communication are processed by all
+ * threads while the master thread polls the messages in flight. Each node in
+ * flight is released as soon as the update is finished, i.e. without waiting
+ * for the remaining nodes not in flight. The halos of the maximum level are
+ * only exchanged as deep as the right-hand side reads them.
+ * @param levels_ascending The levels to be updated in ascending order.
+ * @param next_stage The stage whose right-hand side is computed.
+ * @note Only valid if no level-set nodes exist, no parameter models are active
+ * and the right-hand side does not need global information.
+ */
+void ModularAlgorithmAssembler::HaloUpdateOverlappedWithRightHandSide(
+    std::vector<unsigned int> const &levels_ascending,
+    unsigned int const next_stage) {
+
+  MarkHalosOutdated(levels_ascending);
+  PendingMaterialHaloUpdate &pending = overlapped_halo_update_;
+  halo_manager_.MaterialHaloUpdateBegin(levels_ascending,
+                                        MaterialFieldType::Conservatives, true,
+                                        pending, right_hand_side_halo_depth);
+
+  auto const advance_node = [this, next_stage](nid_t const id, Node &node) {
+    time_integrator_.SwapBuffersForNextStage(node);
+    if (topology_.NodeIsLeaf(id)) {
+      DoObtainPrimeStatesFromConservativesForNonLevelsetNodes<
+          ConservativeBufferType::Average>(node);
+      ComputeRightHandSideOfNode(node, next_stage);
+    }
+  };
+
+  TaskGraph &graph = stage_transition_graph_;
+  graph.Clear();
+  std::vector<nid_t> const &nodes_in_flight = pending.nodes_in_flight_;
+  for (unsigned int const level : levels_ascending) {
+    for (auto &[id, node] : tree_.GetLevelContent(level)) {
+      if (level != pending.level_ ||
+          !std::binary_search(nodes_in_flight.begin(), nodes_in_flight.end(),
+                              id)) {
+        graph.AddComputeTask([&advance_node, id = id, &node = node]() {
+          advance_node(id, node);
+        });
+      }
+    } // nodes
+  }   // levels
+
+  TaskGraph::TaskId const halo_update =
+      graph.AddCommunicationTask([this, &pending]() {
+        if (!halo_manager_.MaterialHaloUpdateArrived(pending)) {
+          return false;
+        }
+        halo_manager_.MaterialHaloUpdateFinish(MaterialFieldType::Conservatives,
+                                               pending);
+        return true;
+      });
+
+  for (nid_t const id : nodes_in_flight) {
+    graph.AddComputeTask(
+        [&advance_node, id, &node = tree_.GetNodeWithId(id)]() {
+          advance_node(id, node);
+        },
+        {halo_update});
+  }
+
+  graph.Run();
+  recovered_leaves_.clear();
 }
 
 /**
@@ -1068,13 +1840,52 @@ void ModularAlgorithmAssembler::SwapBuffers(
 void ModularAlgorithmAssembler::Integrate(
     std::vector<unsigned int> const updated_levels, unsigned int const stage) {
 
+  MarkHalosOutdated(updated_levels);
+  recovered_leaves_.clear();
+
   for (auto const &level : updated_levels) {
     unsigned int const number_of_timesteps =
         1 << (all_levels_.back() - level); // 2^x
 
-    // We integrate all leaves
-    for (Node &node : tree_.LeavesOnLevel(level)) {
-      time_integrator_.IntegrateNode(node, stage, number_of_timesteps);
+    // We integrate all leaves but the static solid ones, whose conservatives
+    // do not change. Instead of integrating, their unchanged conservatives are
+    // moved into the right-hand side buffer, where the integrated values are
+    // expected, and moved back by the swap at the end of the stage.
+    std::vector<std::reference_wrapper<Node>> const &leaves =
+        tree_.LeavesOnLevel(level);
+    // Single-phase leaves recover the prime states of their internal cells
+    // tile by tile right after the integration. In the last stage, the leaves
+    // at resolution jumps are excluded, as the jump flux adjustment changes
+    // their conservatives afterwards.
+    std::vector<nid_t> const &leaf_ids = topology_.LocalLeafIdsOnLevel(level);
+    bool const last_stage = time_integrator_.IsLastStage(stage);
+    for (std::size_t index = 0; index < leaves.size(); ++index) {
+      Node &node = leaves[index];
+      CostClock::time_point const cost_start = CostMeasurementStart();
+      if (IsStaticSolidNode(node)) {
+        BO::Material::SwapConservativeBuffersForNode<
+            ConservativeBufferType::RightHandSide,
+            ConservativeBufferType::Average>(node);
+      } else if (CC::FusedPrimeStateRecovery() && !node.HasLevelset() &&
+                 !(last_stage && JumpBuffersNeeded(leaf_ids[index]))) {
+        time_integrator_.IntegrateNodeTiled(
+            node, stage, number_of_timesteps,
+            [this](MaterialName const material, Block &block,
+                   unsigned int const first_plane,
+                   unsigned int const end_plane) {
+              prime_state_handler_.ConvertConservativesToPrimeStates(
+                  material,
+                  block.GetConservativeBuffer<
+                      ConservativeBufferType::RightHandSide>(),
+                  block.GetPrimeStateBuffer(),
+                  {first_plane, CC::FICY(), CC::FICZ()},
+                  {end_plane, CC::LICY() + 1, CC::LICZ() + 1});
+            });
+        recovered_leaves_.push_back(&node);
+      } else {
+        time_integrator_.IntegrateNode(node, stage, number_of_timesteps);
+      }
+      ChargeNode(node, cost_start);
     }
 
     /* We need to integrate the values in jump halos. However, as two jump halos
@@ -1082,19 +1893,39 @@ void ModularAlgorithmAssembler::Integrate(
      * wrongly integrated halo cells are later overwritten by the halo update
      */
 
-    // We integrate jump halos on all nodes
-    for (auto &[id, node] : tree_.GetLevelContent(level)) {
-      for (BoundaryLocation const &location : CC::HBS()) {
-        if (topology_.FaceIsJump(id, location)) {
-          std::array<int, 3> start_indices_halo =
-              communicator_.GetStartIndicesHaloRecv(location);
-          std::array<int, 3> halo_size = communicator_.GetHaloSize(location);
-          time_integrator_.IntegrateJumpHalos(node, stage, number_of_timesteps,
-                                              start_indices_halo, halo_size);
-        }
+    // We integrate the jump halos of all nodes, which are cached together with
+    // the halo update pattern
+    communicator_.GenerateNeighborRelationForHaloUpdate(level);
+    for (auto const &[id, location] : communicator_.JumpHalos(level)) {
+      // the halos of static solid nodes keep their values
+      if (IsStaticSolidNode(tree_.GetNodeWithId(id))) {
+        continue;
       }
+      std::array<int, 3> start_indices_halo =
+          communicator_.GetStartIndicesHaloRecv(location);
+      std::array<int, 3> halo_size = communicator_.GetHaloSize(location);
+      time_integrator_.IntegrateJumpHalos(tree_.GetNodeWithId(id), stage,
+                                          number_of_timesteps,
+                                          start_indices_halo, halo_size);
     }
   } // level
+  std::sort(recovered_leaves_.begin(), recovered_leaves_.end());
+}
+
+/**
+ * @brief Indicates whether a node only consists of a solid boundary. Such nodes
+ * are static, i.e. they have a zero right-hand side and are not integrated.
+ * @param node The node to be checked.
+ * @return True if the node holds a single solid-boundary phase and no level
+ * set, false otherwise.
+ */
+bool ModularAlgorithmAssembler::IsStaticSolidNode(Node const &node) const {
+  if constexpr (CC::SolidBoundaryActive()) {
+    return !node.HasLevelset() && node.GetPhases().size() == 1 &&
+           material_manager_.IsSolidBoundary(node.GetPhases().begin()->first);
+  } else {
+    return false;
+  }
 }
 
 /**
@@ -1117,14 +1948,26 @@ void ModularAlgorithmAssembler::IntegrateLevelset(
 /**
  * @brief Updates the interface tags on all levels based on the cut cells on the
  * finest level.
- * @param nodes The nodes on the finest level, for which the level-set field has
- * to be updated.
  * @param levels_with_updated_parents_descending The child levels whose parents
  * were updated in descending order.
+ * @param only_multi_phase_nodes_retagged Indicates whether only the tags of
+ * multi-phase nodes changed since the last update, e.g., between the stages of
+ * a time step. The update is then restricted to the nodes around them ( see
+ * CollectRetaggedNodes ), provided the topology did not change since the last
+ * full update.
  */
 void ModularAlgorithmAssembler::UpdateInterfaceTags(
-    std::vector<unsigned int> const levels_with_updated_parents_descending)
-    const {
+    std::vector<unsigned int> const levels_with_updated_parents_descending,
+    bool const only_multi_phase_nodes_retagged) {
+
+  bool const incremental =
+      only_multi_phase_nodes_retagged && retagged_nodes_.collected_ &&
+      retagged_nodes_.topology_update_count_ ==
+          topology_.TopologyUpdateCount() &&
+      retagged_nodes_.material_update_count_ == topology_.MaterialUpdateCount();
+  std::vector<nid_t> const no_frozen_nodes;
+  std::vector<nid_t> const &frozen_nodes =
+      incremental ? retagged_nodes_.frozen_ : no_frozen_nodes;
 
   /**
    * Step 0: To project cut-cell tags to parent levels and to subsequently set
@@ -1153,14 +1996,15 @@ void ModularAlgorithmAssembler::UpdateInterfaceTags(
   // Halo Update does not hurt, and we need not only parents but also the child
   // levels
   halo_manager_.InterfaceTagHaloUpdateOnLevelList<
-      InterfaceDescriptionBufferType::Reinitialized>(all_levels_);
+      InterfaceDescriptionBufferType::Reinitialized>(all_levels_, frozen_nodes);
 
   /**
    * Step 2: For all levels where cut cells were newly set, the narrow-band tags
    * are set based on the cut-cell tags.
    */
   for (unsigned int const level : parent_levels_with_projected_cut_cell_tags) {
-    for (auto const node_id : topology_.LocalIdsOnLevel(level)) {
+    for (auto const node_id : incremental ? retagged_nodes_.retagged_[level]
+                                          : topology_.LocalIdsOnLevel(level)) {
       InterfaceTagFunctions::SetTotalInterfaceTagsFromCutCells(
           tree_.GetNodeWithId(node_id)
               .GetInterfaceTags<
@@ -1174,13 +2018,14 @@ void ModularAlgorithmAssembler::UpdateInterfaceTags(
    */
   halo_manager_.InterfaceTagHaloUpdateOnLevelList<
       InterfaceDescriptionBufferType::Reinitialized>(
-      parent_levels_with_projected_cut_cell_tags);
+      parent_levels_with_projected_cut_cell_tags, frozen_nodes);
 
   /**
    * Step 4: Update also integrated interface tags on all levels.
    */
   for (unsigned int const level : all_levels_) {
-    for (auto const node_id : topology_.LocalIdsOnLevel(level)) {
+    for (auto const node_id : incremental ? retagged_nodes_.updated_[level]
+                                          : topology_.LocalIdsOnLevel(level)) {
       BO::CopySingleBuffer(
           tree_.GetNodeWithId(node_id)
               .GetInterfaceTags<
@@ -1189,6 +2034,82 @@ void ModularAlgorithmAssembler::UpdateInterfaceTags(
               .GetInterfaceTags<InterfaceDescriptionBufferType::Integrated>());
     }
   }
+
+  if (!incremental) {
+    CollectRetaggedNodes();
+  }
+}
+
+/**
+ * @brief Determines the local nodes whose interface tags change along with the
+ * multi-phase nodes, i.e. between two updates of the interface tags within the
+ * same topology. The tags of a node only change if the node or one of its
+ * neighbors on the same level is multi-phase, as only these hold cut cells (
+ * in the halos ). Multi-phase parents are the ancestors of the multi-phase
+ * leaves, hence the changes are only propagated up their ancestor chains. The
+ * halos of the remaining nodes only change if they are filled from changed
+ * nodes, from a parent or via MPI. The lists are only renewed once the topology
+ * or the materials changed.
+ */
+void ModularAlgorithmAssembler::CollectRetaggedNodes() {
+  if (retagged_nodes_.collected_ &&
+      retagged_nodes_.topology_update_count_ ==
+          topology_.TopologyUpdateCount() &&
+      retagged_nodes_.material_update_count_ ==
+          topology_.MaterialUpdateCount()) {
+    return;
+  }
+  int const my_rank = communicator_.MyRankId();
+  retagged_nodes_.retagged_.assign(all_levels_.back() + 1, {});
+  retagged_nodes_.updated_.assign(all_levels_.back() + 1, {});
+  retagged_nodes_.frozen_.clear();
+
+  std::unordered_set<nid_t> retagged;
+  for (unsigned int const level : all_levels_) {
+    for (nid_t const id : topology_.LocalIdsOnLevel(level)) {
+      bool is_retagged = topology_.IsNodeMultiPhase(id);
+      for (BoundaryLocation const location : CC::HBS()) {
+        if (is_retagged) {
+          break;
+        }
+        TopologyNeighbor const neighbor =
+            topology_.NeighborOfNode(id, location);
+        is_retagged = !neighbor.is_external_ &&
+                      neighbor.level_difference_ == 0 &&
+                      topology_.IsNodeMultiPhase(neighbor.id_);
+      }
+      if (is_retagged) {
+        retagged_nodes_.retagged_[level].push_back(id);
+        retagged.insert(id);
+      }
+    }
+  }
+
+  for (unsigned int const level : all_levels_) {
+    for (nid_t const id : topology_.LocalIdsOnLevel(level)) {
+      bool frozen = !retagged.contains(id);
+      for (BoundaryLocation const location : CC::HBS()) {
+        if (!frozen) {
+          break;
+        }
+        TopologyNeighbor const neighbor =
+            topology_.NeighborOfNode(id, location);
+        frozen = neighbor.is_external_ || (neighbor.level_difference_ == 0 &&
+                                           neighbor.rank_ == my_rank &&
+                                           !retagged.contains(neighbor.id_));
+      }
+      if (frozen) {
+        retagged_nodes_.frozen_.push_back(id);
+      } else {
+        retagged_nodes_.updated_[level].push_back(id);
+      }
+    }
+  }
+  std::sort(retagged_nodes_.frozen_.begin(), retagged_nodes_.frozen_.end());
+
+  retagged_nodes_.topology_update_count_ = topology_.TopologyUpdateCount();
+  retagged_nodes_.material_update_count_ = topology_.MaterialUpdateCount();
+  retagged_nodes_.collected_ = true;
 }
 
 /**
@@ -1213,15 +2134,14 @@ void ModularAlgorithmAssembler::SenseApproachingInterface(
 
   bool interface_block_created = false;
   bool node_refined = false;
+  bool phase_added = false;
   for (auto const &level : levels_ascending) {
     for (nid_t const &node_id : topology_.LocalIdsOnLevel(level)) {
       if (!topology_.IsNodeMultiPhase(node_id)) {
         Node &node = tree_.GetNodeWithId(node_id);
         // TODO-19 TP test total cells, but probably halo is enough for standard
         // case ( no phase change in bulk ) --> OPTIMIZE?
-        if (!InterfaceTagFunctions::TotalInterfaceTagsAreUniform(
-                node.GetInterfaceTags<
-                    InterfaceDescriptionBufferType::Reinitialized>())) {
+        if (!node.GetInterfaceTagSummary().IsUniformBulk()) {
           // not uniform anymore, thus change to multi
 
           // get additional material
@@ -1231,6 +2151,7 @@ void ModularAlgorithmAssembler::SenseApproachingInterface(
                   ? MaterialSignCapsule::NegativeMaterial()
                   : MaterialSignCapsule::PositiveMaterial();
           topology_.AddMaterialToNode(node_id, material_new);
+          phase_added = true;
           if (level == all_levels_.back()) {
             // Lmax node with interface block but without children
             auto const sign = Signum(node.GetUniformInterfaceTag());
@@ -1258,10 +2179,19 @@ void ModularAlgorithmAssembler::SenseApproachingInterface(
     // propagate more than one level
     UpdateTopology();
   }
-  MPI_Allreduce(MPI_IN_PLACE, &interface_block_created, 1, MPI_CXX_BOOL,
-                MPI_LOR, MPI_COMM_WORLD);
-  MPI_Allreduce(MPI_IN_PLACE, &node_refined, 1, MPI_CXX_BOOL, MPI_LOR,
-                MPI_COMM_WORLD);
+  // All flags are reduced in a single collective
+  ReductionBatch flags;
+  std::size_t const interface_block_created_handle =
+      flags.AddLogicalOr(interface_block_created);
+  std::size_t const node_refined_handle = flags.AddLogicalOr(node_refined);
+  std::size_t const phase_added_handle = flags.AddLogicalOr(phase_added);
+  flags.Reduce();
+  interface_block_created = flags.LogicalOr(interface_block_created_handle);
+  node_refined = flags.LogicalOr(node_refined_handle);
+  // New phases, possibly on coarser levels, have no valid halos yet
+  if (flags.LogicalOr(phase_added_handle)) {
+    MarkAllHalosOutdated();
+  }
   if (interface_block_created) {
     halo_manager_.InterfaceHaloUpdateOnLmax(
         InterfaceBlockBufferType::LevelsetReinitialized);
@@ -1291,6 +2221,7 @@ void ModularAlgorithmAssembler::SenseVanishedInterface(
   // the disappearance of the interface propagates down the tree
 
   for (auto const &level : levels_descending) {
+    std::vector<nid_t> vanished_ids;
     for (auto const &node_id : topology_.LocalIdsOnLevel(level)) {
       if (topology_.IsNodeMultiPhase(node_id)) {
         // a multi-phase non-Lmax node has to have children, therefore no
@@ -1302,38 +2233,97 @@ void ModularAlgorithmAssembler::SenseVanishedInterface(
                 all_children_single && (!topology_.IsNodeMultiPhase(child_id));
           }
         }
-        if (all_children_single) {
-          // if all children are single, this node might become single as well
-          Node &node = tree_.GetNodeWithId(node_id);
-          if (InterfaceTagFunctions::TotalInterfaceTagsAreUniform(
-                  node.GetInterfaceTags<
-                      InterfaceDescriptionBufferType::Reinitialized>())) {
-            // make single again
-
-            // get the vanished material ( can use an arbitrary interface tag
-            // since it's already clear that they are uniform )
-            MaterialName const material_old =
-                (node.GetInterfaceTags<
-                     InterfaceDescriptionBufferType::Reinitialized>()
-                     [CC::FICX()][CC::FICY()][CC::FICZ()] < 0)
-                    ? MaterialSignCapsule::PositiveMaterial()
-                    : MaterialSignCapsule::NegativeMaterial();
-            topology_.RemoveMaterialFromNode(node_id, material_old);
-
-            // remove old material and interface block ( by setting it to
-            // nullptr )
-            node.RemovePhase(material_old);
-            node.SetInterfaceBlock();
-          }
+        // if all children are single, this node might become single as well
+        if (all_children_single && tree_.GetNodeWithId(node_id)
+                                       .GetInterfaceTagSummary()
+                                       .IsUniformBulk()) {
+          vanished_ids.push_back(node_id);
         }
       }
     }
+    if constexpr (CC::InterfaceRemovalDelay() > 0 ||
+                  CC::InterfaceRemovalDistance() > 0) {
+      vanished_ids = NodesWithSettledInterface(level, vanished_ids);
+    }
+
+    for (nid_t const node_id : vanished_ids) {
+      // make single again
+      Node &node = tree_.GetNodeWithId(node_id);
+      // get the vanished material ( the tags are uniform )
+      MaterialName const material_old =
+          (node.GetInterfaceTagSummary().minimum_ < 0)
+              ? MaterialSignCapsule::PositiveMaterial()
+              : MaterialSignCapsule::NegativeMaterial();
+      topology_.RemoveMaterialFromNode(node_id, material_old);
+
+      // remove old material and interface block ( by setting it to nullptr )
+      node.RemovePhase(material_old);
+      node.SetInterfaceBlock();
+    }
     // update topology after every level to make sure, that the change can
     // propagate more than one level
     UpdateTopology();
   }
 }
 
+/**
+ * @brief Applies the hysteresis of the change from multi- to single-phase
+ * nodes to the nodes of a level whose interface has vanished. A node changes
+ * once the interface stayed away for more than CC::InterfaceRemovalDelay()
+ * checks and no multi-phase node within CC::InterfaceRemovalDistance() blocks
+ * still holds the interface. Oscillating or grazing interfaces hence do not
+ * remove and add phases ( and interface blocks ) back and forth. The vanished
+ * nodes of all ranks are gathered, such that the decision does not depend on
+ * the partitioning.
+ * @param level The level of the nodes.
+ * @param vanished_ids The local multi-phase nodes of the level whose interface
+ * has vanished.
+ * @return The nodes among the given ones that become single-phase.
+ * @note Collective call, hence, it must be called on all ranks.
+ */
+std::vector<nid_t> ModularAlgorithmAssembler::NodesWithSettledInterface(
+    unsigned int const level, std::vector<nid_t> const &vanished_ids) {
+  std::vector<nid_t> global_vanished_ids;
+  MpiUtilities::LocalToGlobalData(vanished_ids, MPI_LONG_LONG_INT,
+                                  MpiUtilities::NumberOfRanks(),
+                                  global_vanished_ids);
+  std::sort(global_vanished_ids.begin(), global_vanished_ids.end());
+  auto const vanished = [&global_vanished_ids](nid_t const id) {
+    return std::binary_search(global_vanished_ids.cbegin(),
+                              global_vanished_ids.cend(), id);
+  };
+
+  // The count restarts whenever the interface returns to a node of the level
+  for (auto checks = vanished_interface_checks_.begin();
+       checks != vanished_interface_checks_.end();) {
+    if (LevelOfNode(checks->first) == level && !vanished(checks->first)) {
+      checks = vanished_interface_checks_.erase(checks);
+    } else {
+      ++checks;
+    }
+  }
+  for (nid_t const id : global_vanished_ids) {
+    ++vanished_interface_checks_[id];
+  }
+
+  std::vector<nid_t> settled_ids;
+  for (nid_t const id : vanished_ids) {
+    if (vanished_interface_checks_[id] <= CC::InterfaceRemovalDelay()) {
+      continue;
+    }
+    std::vector<nid_t> const neighbors =
+        NeighborsWithinBand(id, CC::InterfaceRemovalDistance());
+    if (std::none_of(neighbors.cbegin(), neighbors.cend(),
+                     [&](nid_t const neighbor_id) {
+                       return topology_.IsNodeMultiPhase(neighbor_id) &&
+                              !vanished(neighbor_id);
+                     })) {
+      settled_ids.push_back(id);
+    }
+  }
+  return settled_ids;
+}
+
 /**
  * @brief Ensures conservation at resolution jumps following \cite Roussel2003.
  * Uses the ( more precise ) fluxes on the finer level to correct the fluxes on
@@ -1360,56 +2350,86 @@ void ModularAlgorithmAssembler::JumpFluxAdjustment(
   int const my_rank = communicator_.MyRankId();
 
   /*** Sending Down ***/
-  // First the parents' jump buffers are filled form the childrens values.
+  // First the parents' jump buffers are filled form the childrens values. The
+  // surfaces are sent in one message per partner rank and level, levels have to
+  // be processed one after the other as the children hold the averaged values
+  // of their own children.
+  constexpr std::size_t surface_values =
+      CC::SIDES() * MF::ANOE() * CC::ICY() * CC::ICZ();
   for (auto const &level : levels_averaging_down) {
+    std::map<int, std::vector<double>> send_buffers;
+    std::map<int, std::vector<double>> recv_buffers;
+    std::vector<nid_t> local_children;
+    std::vector<std::pair<nid_t, int>> remote_children;
     for (auto const &child_id : topology_.IdsOnLevel(level)) {
       nid_t const parent_id = ParentIdOfNode(child_id);
+      // Only children at jump faces hold values the parent needs
+      if (!JumpBuffersNeeded(child_id) || !JumpBuffersNeeded(parent_id)) {
+        continue;
+      }
       int const rank_of_child = topology_.GetRankOfNode(child_id);
       int const rank_of_parent = topology_.GetRankOfNode(parent_id);
       if (rank_of_child == my_rank && rank_of_parent == my_rank) {
-        // Non MPI Averaging
-        Node &parent = tree_.GetNodeWithId(parent_id);
-        Node const &child = tree_.GetNodeWithId(child_id);
-        for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
-          Multiresolution::AverageJumpBuffer(
-              child.GetPhaseByMaterial(material).GetBoundaryJumpConservatives(),
-              parent.GetPhaseByMaterial(material)
-                  .GetBoundaryJumpConservatives(),
-              child_id);
-        }
+        local_children.push_back(child_id);
       } else if (rank_of_child == my_rank && rank_of_parent != my_rank) {
-        // MPI_ISend
+        // Pack for MPI_Isend
         Node const &child = tree_.GetNodeWithId(child_id);
+        std::vector<double> &buffer = send_buffers[rank_of_parent];
         for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
-          MPI_Send(&child.GetPhaseByMaterial(material)
-                        .GetBoundaryJumpConservatives(),
-                   CC::SIDES(), communicator_.JumpSurfaceDatatype(),
-                   rank_of_parent, communicator_.TagForRank(rank_of_parent),
-                   MPI_COMM_WORLD);
+          double const *surface = &child.GetPhaseByMaterial(material)
+                                       .GetBoundaryJumpConservatives()
+                                       .east_[0][0][0];
+          buffer.insert(buffer.end(), surface, surface + surface_values);
         }
       } else if (rank_of_child != my_rank && rank_of_parent == my_rank) {
-        SurfaceBuffer childs_jump_buffer;
+        // Size for MPI_Irecv
+        std::vector<double> &buffer = recv_buffers[rank_of_child];
+        buffer.resize(buffer.size() +
+                      topology_.GetMaterialsOfNode(child_id).size() *
+                          surface_values);
+        remote_children.emplace_back(child_id, rank_of_child);
+      }
+    }
 
-        // MPI_Recv
-        Node &parent = tree_.GetNodeWithId(parent_id);
-        for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
-          MPI_Recv(&childs_jump_buffer, CC::SIDES(),
-                   communicator_.JumpSurfaceDatatype(), rank_of_child,
-                   communicator_.TagForRank(rank_of_child), MPI_COMM_WORLD,
-                   MPI_STATUS_IGNORE);
-          Multiresolution::AverageJumpBuffer(
-              childs_jump_buffer,
-              parent.GetPhaseByMaterial(material)
-                  .GetBoundaryJumpConservatives(),
-              child_id);
-        }
+    std::vector<MPI_Request> requests;
+    PostAggregatedExchange(communicator_, send_buffers, recv_buffers, requests);
+
+    // Non MPI Averaging while the messages are in flight
+    for (auto const &child_id : local_children) {
+      Node &parent = tree_.GetNodeWithId(ParentIdOfNode(child_id));
+      Node const &child = tree_.GetNodeWithId(child_id);
+      for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
+        Multiresolution::AverageJumpBuffer(
+            child.GetPhaseByMaterial(material).GetBoundaryJumpConservatives(),
+            parent.GetPhaseByMaterial(material).GetBoundaryJumpConservatives(),
+            child_id);
       }
     }
-  }
 
-  /*** Exchanging ***/
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
 
-  /* A node adjusts its values if:
+    // MPI Averaging
+    std::map<int, std::size_t> recv_offsets;
+    SurfaceBuffer childs_jump_buffer;
+    for (auto const &[child_id, rank_of_child] : remote_children) {
+      Node &parent = tree_.GetNodeWithId(ParentIdOfNode(child_id));
+      double const *buffer = recv_buffers[rank_of_child].data();
+      std::size_t &offset = recv_offsets[rank_of_child];
+      for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
+        std::copy(buffer + offset, buffer + offset + surface_values,
+                  &childs_jump_buffer.east_[0][0][0]);
+        offset += surface_values;
+        Multiresolution::AverageJumpBuffer(
+            childs_jump_buffer,
+            parent.GetPhaseByMaterial(material).GetBoundaryJumpConservatives(),
+            child_id);
+      }
+    }
+  }
+
+  /*** Exchanging ***/
+
+  /* A node adjusts its values if:
    * 1. ) It is leaf
    * 2. ) Its neighbor exists
    * 3. ) Its neighbor is not a leaf
@@ -1446,6 +2466,49 @@ void ModularAlgorithmAssembler::JumpFluxAdjustment(
       }
     }
   }
+
+  // The neighbors' jump buffers are final after sending down, hence the
+  // exchange of all levels is posted at once, aggregated per partner rank
+  std::map<int, std::vector<double>> send_buffers;
+  std::map<int, std::vector<double>> recv_buffers;
+  for (auto const &level : level_exchanging) {
+    for (auto const &leaf_id : topology_.LeafIdsOnLevel(level)) {
+      bool const leaf_on_my_rank = topology_.NodeIsOnRank(leaf_id, my_rank);
+      for (MaterialName const material :
+           topology_.GetMaterialsOfNode(leaf_id)) {
+        for (auto const &location : CC::ANBS()) {
+          neighbor_id = topology_.GetTopologyNeighborId(leaf_id, location);
+          if (!topology_.NodeExists(neighbor_id) ||
+              topology_.NodeIsLeaf(neighbor_id)) {
+            continue;
+          }
+          bool const neighbor_on_my_rank =
+              topology_.NodeIsOnRank(neighbor_id, my_rank);
+          if (leaf_on_my_rank && !neighbor_on_my_rank) {
+            std::vector<double> &buffer =
+                recv_buffers[topology_.GetRankOfNode(neighbor_id)];
+            buffer.resize(buffer.size() + JumpBufferSendingSize());
+          } else if (!leaf_on_my_rank && neighbor_on_my_rank) {
+            double const(
+                &neighbor_jump_buffer)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
+                tree_.GetNodeWithId(neighbor_id)
+                    .GetPhaseByMaterial(material)
+                    .GetBoundaryJumpConservatives(OppositeDirection(location));
+            std::vector<double> &buffer =
+                send_buffers[topology_.GetRankOfNode(leaf_id)];
+            buffer.insert(buffer.end(), &neighbor_jump_buffer[0][0][0],
+                          &neighbor_jump_buffer[0][0][0] +
+                              JumpBufferSendingSize());
+          }
+        }
+      }
+    }
+  }
+  std::vector<MPI_Request> requests;
+  PostAggregatedExchange(communicator_, send_buffers, recv_buffers, requests);
+  std::map<int, std::size_t> recv_offsets;
+  bool messages_arrived = false;
+
   for (auto const &level : level_exchanging) {
     leaf_ids_on_level = topology_.LeafIdsOnLevel(level);
     for (auto const &leaf_id : leaf_ids_on_level) {
@@ -1556,10 +2619,21 @@ void ModularAlgorithmAssembler::JumpFluxAdjustment(
                 }
               } else {
                 // MPI Recv
-                // Overwrites directly into the jump_buffer
-                MPI_Recv(jump_buffer, JumpBufferSendingSize(), MPI_DOUBLE,
-                         topology_.GetRankOfNode(neighbor_id), 0,
-                         MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                // Overwrites directly into the jump_buffer, the messages are
+                // only waited for once the first remote neighbor is needed
+                if (!messages_arrived) {
+                  MPI_Waitall(requests.size(), requests.data(),
+                              MPI_STATUSES_IGNORE);
+                  messages_arrived = true;
+                }
+                int const rank_of_neighbor =
+                    topology_.GetRankOfNode(neighbor_id);
+                double const *buffer = recv_buffers[rank_of_neighbor].data();
+                std::size_t &offset = recv_offsets[rank_of_neighbor];
+                std::copy(buffer + offset,
+                          buffer + offset + JumpBufferSendingSize(),
+                          &jump_buffer[0][0][0]);
+                offset += JumpBufferSendingSize();
               }
 
               // Update Step 2
@@ -1586,22 +2660,7 @@ void ModularAlgorithmAssembler::JumpFluxAdjustment(
                   }
                 }
               }
-            } else {
-              if (topology_.NodeIsOnRank(
-                      neighbor_id,
-                      my_rank)) { // I do not have the Node but I do have the
-                                  // Neighbor and must send it
-                // Send MPI
-                double(
-                    &neighbor_jump_buffer)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
-                    tree_.GetNodeWithId(neighbor_id)
-                        .GetPhaseByMaterial(material)
-                        .GetBoundaryJumpConservatives(neighbor_location);
-                MPI_Send(neighbor_jump_buffer, JumpBufferSendingSize(),
-                         MPI_DOUBLE, topology_.GetRankOfNode(leaf_id), 0,
-                         MPI_COMM_WORLD);
-              }
-            }
+            } // Data of held neighbors of remote nodes is already sent
           } // Neighbor qualifies for exchange
         }   // location
 
@@ -1610,7 +2669,7 @@ void ModularAlgorithmAssembler::JumpFluxAdjustment(
           Node &node = tree_.GetNodeWithId(leaf_id);
           Block &block = node.GetPhaseByMaterial(material);
           for (Equation const eq : MF::ASOE()) {
-            double(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+            FieldValue(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
                 block.GetRightHandSideBuffer(eq);
             for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
               for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
@@ -1642,6 +2701,11 @@ void ModularAlgorithmAssembler::JumpFluxAdjustment(
     }     // leaves on id
   }       // levels to exchange
 
+  // send buffers need to be alive till this point
+  if (!messages_arrived) {
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+  }
+
   /*** Resetting Buffer ***/
   ResetJumpConservativeBuffers(finished_levels_descending);
 }
@@ -1722,12 +2786,35 @@ template <ConservativeBufferType C>
 void ModularAlgorithmAssembler::
     DoObtainPrimeStatesFromConservativesForNonLevelsetNodes(Node &node) const {
 
+  // Leaves whose internal cells were recovered during the integration only
+  // convert the slabs of halo cells around them
+  constexpr std::array<std::array<std::array<unsigned int, 3>, 2>, 6>
+      halo_slabs = {
+          {{{{0, 0, 0}, {CC::FICX(), CC::TCY(), CC::TCZ()}}},
+           {{{CC::LICX() + 1, 0, 0}, {CC::TCX(), CC::TCY(), CC::TCZ()}}},
+           {{{CC::FICX(), 0, 0}, {CC::LICX() + 1, CC::FICY(), CC::TCZ()}}},
+           {{{CC::FICX(), CC::LICY() + 1, 0},
+             {CC::LICX() + 1, CC::TCY(), CC::TCZ()}}},
+           {{{CC::FICX(), CC::FICY(), 0},
+             {CC::LICX() + 1, CC::LICY() + 1, CC::FICZ()}}},
+           {{{CC::FICX(), CC::FICY(), CC::LICZ() + 1},
+             {CC::LICX() + 1, CC::LICY() + 1, CC::TCZ()}}}}};
+  bool const internal_cells_recovered = std::binary_search(
+      recovered_leaves_.begin(), recovered_leaves_.end(), &node);
+
   for (auto &phase : node.GetPhases()) {
     PrimeStates &prime_states = phase.second.GetPrimeStateBuffer();
     Conservatives const &conservatives =
         phase.second.GetConservativeBuffer<C>();
-    prime_state_handler_.ConvertConservativesToPrimeStates(
-        phase.first, conservatives, prime_states);
+    if (internal_cells_recovered) {
+      for (auto const &[start, end] : halo_slabs) {
+        prime_state_handler_.ConvertConservativesToPrimeStates(
+            phase.first, conservatives, prime_states, start, end);
+      }
+    } else {
+      prime_state_handler_.ConvertConservativesToPrimeStates(
+          phase.first, conservatives, prime_states);
+    }
   } // phases
 }
 
@@ -1771,10 +2858,11 @@ void ModularAlgorithmAssembler::
 
 /**
  * @brief Determines the maximal allowed size of the next time step ( on the
- * finest level ).
- * @return Largest non-cfl-violating time step size on the finest level.
+ * finest level ) for the leaves of this rank.
+ * @return Largest non-cfl-violating time step size on the finest level of this
+ * rank. The global minimum of all ranks must be taken by the caller.
  */
-double ModularAlgorithmAssembler::ComputeTimestepSize() const {
+double ModularAlgorithmAssembler::ComputeLocalTimestepSize() const {
 
   std::array<double, DTI(CC::DIM())> velocity_plus_sound;
   double dt = 0.0;
@@ -1784,16 +2872,21 @@ double ModularAlgorithmAssembler::ComputeTimestepSize() const {
   double sigma = 0.0;
   double g = 0.0;
 
-  // scaling for viscosity and surface tension limited timestep size - values
-  // taken from \cite Sussman2000
-  constexpr double nu_timestep_size_constant = 3.0 / 14.0;
+  // scaling for surface tension limited timestep size - value taken from
+  // \cite Sussman2000
   constexpr double sigma_timestep_size_constant = M_PI * 8.0;
 
-  // scaling for thermal-diffusivity limited timestep size - value taken from
-  // \cite Pieper2016
-  constexpr double thermal_diffusivity_dt_constant = 0.1;
   double thermal_diffusivity = 0.0;
 
+  // the surface tension coefficient is the same for all cells
+  double const surface_tension_coefficient =
+      CC::CapillaryForcesActive()
+          ? material_manager_
+                .GetMaterialPairing(MaterialSignCapsule::PositiveMaterial(),
+                                    MaterialSignCapsule::NegativeMaterial())
+                .GetSurfaceTensionCoefficient()
+          : 0.0;
+
   for (Node &node : tree_.Leaves()) {
     for (auto const &[material, block] : node.GetPhases()) {
       if constexpr (CC::SolidBoundaryActive()) {
@@ -1906,14 +2999,8 @@ double ModularAlgorithmAssembler::ComputeTimestepSize() const {
 
               // only required if surface tension is active
               if constexpr (CC::CapillaryForcesActive()) {
-                // Change
-                sigma = std::max(
-                    sigma, material_manager_
-                                   .GetMaterialPairing(
-                                       MaterialSignCapsule::PositiveMaterial(),
-                                       MaterialSignCapsule::NegativeMaterial())
-                                   .GetSurfaceTensionCoefficient() *
-                               one_density);
+                sigma =
+                    std::max(sigma, surface_tension_coefficient * one_density);
               }
             }
           } // k
@@ -1931,7 +3018,8 @@ double ModularAlgorithmAssembler::ComputeTimestepSize() const {
    */
   dt = sum_of_signalspeeds / cell_size_on_maximum_level_;
 
-  if constexpr (CC::ViscosityIsActive()) {
+  // The parabolic limits are lifted by super-time-stepping, see SuperTimeStep
+  if constexpr (CC::ViscosityIsActive() && !CC::SuperTimeStepping()) {
     dt = std::max(
         dt, (nu / (nu_timestep_size_constant * cell_size_on_maximum_level_ *
                    cell_size_on_maximum_level_)));
@@ -1942,7 +3030,7 @@ double ModularAlgorithmAssembler::ComputeTimestepSize() const {
                           (std::pow(cell_size_on_maximum_level_, 1.5)));
   }
 
-  if constexpr (CC::HeatConductionActive()) {
+  if constexpr (CC::HeatConductionActive() && !CC::SuperTimeStepping()) {
     dt = std::max(dt, thermal_diffusivity / (cell_size_on_maximum_level_ *
                                              cell_size_on_maximum_level_ *
                                              thermal_diffusivity_dt_constant));
@@ -1964,10 +3052,11 @@ double ModularAlgorithmAssembler::ComputeTimestepSize() const {
       0.0) { // The rank does not have any nodes, thus it could not compute a dt
     local_dt_on_finest_level = std::numeric_limits<double>::max();
   } else {
-    local_dt_on_finest_level = cfl_number_ / dt;
+    local_dt_on_finest_level = cfl_number_ * cfl_factor_ / dt;
   }
 
-  // limit the time-step size in the last macro time step to the exact end time
+  // limit the time-step size in the last macro time step to the exact end (or
+  // stop) time
   if constexpr (CC::LET()) {
     std::vector<double> const micro_time_steps =
         time_integrator_.MicroTimestepSizes();
@@ -1975,35 +3064,203 @@ double ModularAlgorithmAssembler::ComputeTimestepSize() const {
         std::accumulate(micro_time_steps.cbegin(), micro_time_steps.cend(),
                         time_integrator_.CurrentRunTime());
 
-    if (current_run_time + local_dt_on_finest_level > end_time_) {
+    if (current_run_time + local_dt_on_finest_level > stop_time_) {
       // Floating-point math might yield negative epsilon.
-      local_dt_on_finest_level = std::max(end_time_ - current_run_time, 0.0);
+      local_dt_on_finest_level = std::max(stop_time_ - current_run_time, 0.0);
     }
   }
 
-  double global_min_dt;
-  // NH 2016-10-28 dt_in_finest_level needs to be the GLOBAL minimum of the
-  // computed values
-  MPI_Allreduce(&local_dt_on_finest_level, &global_min_dt, 1, MPI_DOUBLE,
-                MPI_MIN, MPI_COMM_WORLD);
+  return local_dt_on_finest_level;
+}
+
+/**
+ * @brief Determines the stable timestep size of the explicit Euler scheme for
+ * the viscous and heat fluxes on the leaves of this rank, see SuperTimeStep.
+ * In contrast to ComputeLocalTimestepSize the cell size of each leaf is used,
+ * as all leaves are advanced by the same super step.
+ * @return Largest stable explicit timestep size of the parabolic terms of this
+ * rank. The global minimum of all ranks must be taken by the caller.
+ */
+double ModularAlgorithmAssembler::ComputeLocalParabolicTimestepSize() const {
 
-  logger_.LogMessage(
-      "Timestep = " +
-      StringOperations::ToScientificNotationString(
-          unit_handler_.DimensionalizeValue(global_min_dt, UnitType::Time), 9));
-  logger_.FlushToTerminal();
+  double rate = 0.0;
+
+  for (Node &node : tree_.Leaves()) {
+    double const one_cell_size_squared =
+        1.0 / (node.GetCellSize() * node.GetCellSize());
+    for (auto const &[material, block] : node.GetPhases()) {
+      if constexpr (CC::SolidBoundaryActive()) {
+        if (material_manager_.IsSolidBoundary(material))
+          continue;
+      }
+
+      double const shear_viscosity =
+          CC::ViscosityIsActive()
+              ? material_manager_.GetMaterial(material).GetShearViscosity()
+              : 0.0;
+      double const specific_heat =
+          material_manager_.GetMaterial(material).GetSpecificHeatCapacity();
+      double const thermal_conductivity_over_specific_heat =
+          CC::HeatConductionActive() && specific_heat != 0.0
+              ? material_manager_.GetMaterial(material)
+                        .GetThermalConductivity() /
+                    specific_heat
+              : 0.0;
+      // Both limits share the density, hence, only the stricter one is kept
+      double const diffusivity =
+          std::max(shear_viscosity / nu_timestep_size_constant,
+                   thermal_conductivity_over_specific_heat /
+                       thermal_diffusivity_dt_constant) *
+          one_cell_size_squared;
+
+      FieldValue const(&density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+          block.GetPrimeStateBuffer()[PrimeState::Density];
+      for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+        for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+          for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+            rate = std::max(rate, diffusivity / density[i][j][k]);
+          } // k
+        }   // j
+      }     // i
+    }       // block
+  }         // node
 
-  return global_min_dt;
+  // NH Check against double is okay in this case ( and this case only! )
+  return rate == 0.0 ? std::numeric_limits<double>::max()
+                     : cfl_number_ * cfl_factor_ / rate;
 }
 
 /**
- * @brief Sets all values in all jump buffers on all levels to 0.0.
+ * @brief Advances the viscous and heat fluxes of all leaves by the completed
+ * macro timestep with the second-order Runge-Kutta-Legendre super-time-stepping
+ * scheme ( see RungeKuttaLegendre2 ), i.e. the parabolic terms are split from
+ * the convective ones, which were advanced without them. All levels are at the
+ * same time, hence, all leaves perform the super step together. Each stage is
+ * followed by the averaging, the halo update and the prime-state recovery on
+ * all levels.
+ * @note Restricted to single-phase simulations. The parabolic fluxes across
+ * resolution jumps are not corrected, i.e. they are conservative up to the
+ * truncation error only.
+ */
+void ModularAlgorithmAssembler::SuperTimeStep() {
+
+  MarkAllHalosOutdated();
+
+  if (MpiUtilities::GloballyReducedBool(!tree_.NodesWithLevelset().empty())) {
+    throw std::logic_error(
+        "Super-time-stepping is restricted to single-phase simulations!");
+  }
+
+  std::vector<double> const &micro_timesteps =
+      time_integrator_.MicroTimestepSizes();
+  double const timestep =
+      std::accumulate(micro_timesteps.cbegin(), micro_timesteps.cend(), 0.0);
+  if (timestep <= 0.0) {
+    return;
+  }
+
+  double const local_explicit_timestep = ComputeLocalParabolicTimestepSize();
+  double explicit_timestep = 0.0;
+  MPI_Allreduce(&local_explicit_timestep, &explicit_timestep, 1, MPI_DOUBLE,
+                MPI_MIN, MpiUtilities::Communicator());
+  unsigned int const number_of_stages =
+      RungeKuttaLegendre2::NumberOfStages(timestep, explicit_timestep);
+  logger_.LogMessage("Super-time-stepping stages = " +
+                     std::to_string(number_of_stages));
+
+  std::vector<unsigned int> const levels_descending(all_levels_.rbegin(),
+                                                    all_levels_.rend());
+  std::vector<std::reference_wrapper<Node>> const &leaves = tree_.Leaves();
+  long const number_of_leaves = static_cast<long>(leaves.size());
+
+  // Per leaf the internal cells of the initial state Y_0, its right-hand side
+  // L(Y_0) and the state of the second last stage Y_(j-2)
+  std::size_t const cells_per_phase =
+      MF::ANOE() * CC::ICX() * CC::ICY() * CC::ICZ();
+  std::vector<std::vector<double>> initial_states(leaves.size());
+  std::vector<std::vector<double>> initial_right_hand_sides(leaves.size());
+  std::vector<std::vector<double>> second_last_states(leaves.size());
+
+  for (unsigned int stage = 1; stage <= number_of_stages; ++stage) {
+    RungeKuttaLegendre2::StageCoefficients const coefficients =
+        RungeKuttaLegendre2::Coefficients(number_of_stages, stage);
+    double const mu_tilde_timestep = coefficients.mu_tilde_ * timestep;
+    double const gamma_tilde_timestep = coefficients.gamma_tilde_ * timestep;
+    double const initial_weight = 1.0 - coefficients.mu_ - coefficients.nu_;
+
+#pragma omp parallel for schedule(runtime)
+    for (long leaf_index = 0; leaf_index < number_of_leaves; ++leaf_index) {
+      Node &node = leaves[leaf_index];
+      CostClock::time_point const cost_start = CostMeasurementStart();
+      space_solver_.UpdateParabolicFluxes(node);
+
+      std::vector<double> &initial_state = initial_states[leaf_index];
+      std::vector<double> &initial_right_hand_side =
+          initial_right_hand_sides[leaf_index];
+      std::vector<double> &second_last_state = second_last_states[leaf_index];
+      if (stage == 1) {
+        std::size_t const size = node.GetPhases().size() * cells_per_phase;
+        initial_state.assign(size, 0.0);
+        initial_right_hand_side.assign(size, 0.0);
+        second_last_state.assign(size, 0.0);
+      }
+
+      // The cells are visited in the same order in each stage
+      std::size_t n = 0;
+      for (auto &phase : node.GetPhases()) {
+        for (Equation const eq : MF::ASOE()) {
+          FieldValue const(&average)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+              phase.second.GetAverageBuffer(eq);
+          FieldValue(&right_hand_side)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+              phase.second.GetRightHandSideBuffer(eq);
+          for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+            for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+              for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+                if (stage == 1) {
+                  initial_state[n] = average[i][j][k];
+                  initial_right_hand_side[n] = right_hand_side[i][j][k];
+                }
+                double const last_state = average[i][j][k];
+                right_hand_side[i][j][k] =
+                    coefficients.mu_ * last_state +
+                    coefficients.nu_ * second_last_state[n] +
+                    initial_weight * initial_state[n] +
+                    mu_tilde_timestep * right_hand_side[i][j][k] +
+                    gamma_tilde_timestep * initial_right_hand_side[n];
+                second_last_state[n] = last_state;
+                ++n;
+              } // k
+            }   // j
+          }     // i
+        }       // equation
+      }         // phases
+      ChargeNode(node, cost_start);
+    } // leaves
+
+    // The new stage is held in the right-hand side buffers like after a
+    // Runge-Kutta stage
+    averager_.AverageMaterial(levels_descending);
+    halo_manager_.MaterialHaloUpdate(all_levels_,
+                                     MaterialFieldType::Conservatives);
+    for (unsigned int const level : all_levels_) {
+      for (Node &node : tree_.NodesOnLevel(level)) {
+        time_integrator_.SwapBuffersForNextStage(node);
+      }
+    }
+    ObtainPrimeStatesFromConservatives<ConservativeBufferType::Average>(
+        all_levels_);
+  } // stages
+}
+
+/**
+ * @brief Sets all values in all jump buffers on all levels to 0.0. Only nodes
+ * holding jump buffers are visited.
  */
 void ModularAlgorithmAssembler::ResetAllJumpBuffers() const {
 
-  for (auto &level : tree_.FullNodeList()) {
-    for (auto &id_node : level) {
-      for (auto &phase : id_node.second.GetPhases()) {
+  for (auto const &nodes : jump_buffer_nodes_) {
+    for (Node &node : nodes) {
+      for (auto &phase : node.GetPhases()) {
         for (auto const &location : CC::ANBS()) {
           phase.second.ResetJumpConservatives(location);
           phase.second.ResetJumpFluxes(location);
@@ -2022,7 +3279,7 @@ void ModularAlgorithmAssembler::ResetJumpConservativeBuffers(
     std::vector<unsigned int> const levels) const {
 
   for (auto const &level : levels) {
-    for (Node &node : tree_.NodesOnLevel(level)) {
+    for (Node &node : jump_buffer_nodes_[level]) {
       for (auto &phase : node.GetPhases()) {
         for (auto &location : CC::ANBS()) {
           phase.second.ResetJumpConservatives(location);
@@ -2032,6 +3289,125 @@ void ModularAlgorithmAssembler::ResetJumpConservativeBuffers(
   }       // levels
 }
 
+/**
+ * @brief Gives the datatype transferring all data of a node that is migrated
+ * to another rank, i.e. the conservatives ( plus the average and initial
+ * buffers if the node was not updated ), the jump buffers, the statistics of
+ * leaves and for multi-phase
+ * nodes the interface tags as well as the prime states and the interface
+ * block. The receiving node must be created with the same phases, jump buffers
+ * and interface block beforehand.
+ * @param id The id of the node.
+ * @param node The node whose buffers are transferred.
+ * @param node_not_updated Indicates whether the node has not been updated in
+ * this time step.
+ * @param with_jump_buffers Indicates whether the jump buffers are transferred.
+ * @return The committed datatype addressing the buffers of the node absolutely,
+ * i.e. to be used with MPI_BOTTOM and freed by the caller.
+ */
+MPI_Datatype ModularAlgorithmAssembler::MigrationDatatype(
+    nid_t const id, Node const &node, bool const node_not_updated,
+    bool const with_jump_buffers) const {
+  MPI_Datatype const conservatives_datatype =
+      communicator_.ConservativesDatatype();
+  MPI_Datatype const boundary_jump_datatype =
+      communicator_.JumpSurfaceDatatype();
+  StructDatatypeBuilder builder;
+  for (MaterialName const material : topology_.GetMaterialsOfNode(id)) {
+    Block const &block = node.GetPhaseByMaterial(material);
+    builder.Add(&block.GetRightHandSideBuffer(), MF::ANOE(),
+                conservatives_datatype);
+    // Nodes that have not been updated need the average and initial buffer,
+    // the latter only exists on leaves
+    if (node_not_updated) {
+      builder.Add(&block.GetAverageBuffer(), MF::ANOE(),
+                  conservatives_datatype);
+      if (IntegrationBuffersNeeded(id)) {
+        builder.Add(&block.GetInitialBuffer(), MF::ANOE(),
+                    conservatives_datatype);
+      }
+    }
+    if (with_jump_buffers) {
+      builder.Add(&block.GetBoundaryJumpFluxes(), CC::SIDES(),
+                  boundary_jump_datatype);
+      builder.Add(&block.GetBoundaryJumpConservatives(), CC::SIDES(),
+                  boundary_jump_datatype);
+    }
+    if (StatisticsBuffersNeeded(id)) {
+      builder.Add(&block.GetStatisticsBuffers(),
+                  sizeof(StatisticsBuffers) / sizeof(double), MPI_DOUBLE);
+    }
+  }
+  if (topology_.IsNodeMultiPhase(id)) {
+    builder.Add(
+        node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>(),
+        FullBlockSendingSize(), MPI_INT8_T);
+    if (node.HasLevelset()) { // Lmax node
+      for (MaterialName const material : topology_.GetMaterialsOfNode(id)) {
+        builder.Add(&node.GetPhaseByMaterial(material).GetPrimeStateBuffer(),
+                    MF::ANOP(), conservatives_datatype);
+      }
+      InterfaceBlock const &interface_block = node.GetInterfaceBlock();
+      builder.Add(interface_block.GetReinitializedBuffer(
+                      InterfaceDescription::Levelset),
+                  FullBlockSendingSize(), MPI_DOUBLE);
+      // The levelset_initial buffer is not needed, since the levelset is
+      // integrated each micro timestep
+      builder.Add(interface_block.GetReinitializedBuffer(
+                      InterfaceDescription::VolumeFraction),
+                  FullBlockSendingSize(), MPI_DOUBLE);
+      builder.Add(
+          interface_block.GetInterfaceStateBuffer(InterfaceState::Velocity),
+          FullBlockSendingSize(), MPI_DOUBLE);
+    }
+  }
+  return builder.Commit();
+}
+
+/**
+ * @brief Creates a local node that is to be filled with the data of a migrated
+ * node ( see MigrationDatatype() ). Its phases, jump buffers, integration
+ * buffers, statistics buffers and interface block are created according to the
+ * topology, single-phase nodes get uniform interface tags.
+ * @param id The id of the node.
+ * @return The created node.
+ */
+Node &ModularAlgorithmAssembler::CreateMigratedNode(nid_t const id) {
+  Node &new_node = tree_.CreateNode(id, topology_.GetMaterialsOfNode(id));
+  if (JumpBuffersNeeded(id)) {
+    for (MaterialName const material : topology_.GetMaterialsOfNode(id)) {
+      new_node.GetPhaseByMaterial(material).AllocateJumpBuffers();
+    }
+  }
+  if (IntegrationBuffersNeeded(id)) {
+    for (MaterialName const material : topology_.GetMaterialsOfNode(id)) {
+      new_node.GetPhaseByMaterial(material).AllocateIntegrationBuffers();
+    }
+  }
+  if (StatisticsBuffersNeeded(id)) {
+    for (MaterialName const material : topology_.GetMaterialsOfNode(id)) {
+      new_node.GetPhaseByMaterial(material).AllocateStatisticsBuffers();
+    }
+  }
+  if (topology_.IsNodeMultiPhase(id)) {
+    if (LevelOfNode(id) == all_levels_.back()) {
+      // We have not yet created a LS field in our recieving Node. At this
+      // point it is clear it need one, so we create it with dummys and receive
+      // the correct values.
+      new_node.SetInterfaceBlock(std::make_unique<InterfaceBlock>(0.0));
+    }
+  } else {
+    std::int8_t uniform_tag = MaterialSignCapsule::SignOfMaterial(
+                                  topology_.GetMaterialsOfNode(id).back()) *
+                              ITTI(IT::BulkPhase);
+    std::int8_t(&new_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        new_node
+            .GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
+    BO::SetSingleBuffer(new_tags, uniform_tag);
+  }
+  return new_node;
+}
+
 /**
  * @brief Checks if DoLoadBalancing is necessary and eventually executes it.
  * @param updated_levels_descending Gives the list of levels which have
@@ -2043,25 +3419,67 @@ void ModularAlgorithmAssembler::ResetJumpConservativeBuffers(
 void ModularAlgorithmAssembler::LoadBalancing(
     std::vector<unsigned int> const updated_levels_descending,
     bool const force) {
+  if constexpr (CC::MeasureNodeCosts()) {
+    double local_cost = 0.0;
+    for (auto const level : all_levels_) {
+      for (auto const &[id, node] : tree_.GetLevelContent(level)) {
+        local_cost += node.GetComputationalCost();
+      }
+    }
+    topology_.UpdateLoadImbalance(local_cost);
+  }
   if (topology_.IsLoadBalancingNecessary() || force) {
+    if constexpr (CC::MeasureNodeCosts()) {
+      // The costs measured since the last load balancing steer the new
+      // partition
+      std::vector<nid_t> ids;
+      std::vector<double> costs;
+      for (auto const level : all_levels_) {
+        for (auto &[id, node] : tree_.GetLevelContent(level)) {
+          ids.push_back(id);
+          costs.push_back(node.GetComputationalCost());
+          node.ResetComputationalCost();
+        }
+      }
+      topology_.AssignMeasuredCosts(ids, costs);
+    }
+    // Sent jump, integration and statistics buffers are determined from the
+    // topology on both sides
+    UpdateJumpBuffers();
+    UpdateIntegrationBuffers();
+    UpdateStatisticsBuffers();
     // id - Current Rank - Future Rank
+    profiler_.Start("PrepareBalancedTopology");
     std::vector<std::tuple<nid_t const, int const, int const>> const
-        ids_rank_map = topology_.PrepareLoadBalancedTopology(
-            MpiUtilities::NumberOfRanks());
+        ids_rank_map = CC::IncrementalLoadBalancing() && !force
+                           ? topology_.PrepareIncrementallyBalancedTopology(
+                                 MpiUtilities::NumberOfRanks(),
+                                 CC::MaximumMigrationBytes() / sizeof(Block))
+                           : topology_.PrepareLoadBalancedTopology(
+                                 MpiUtilities::NumberOfRanks());
     // ^ Changes the rank assignment in the Topology.
     communicator_.InvalidateCache();
-
-    std::vector<std::uint64_t> received_nodes_not_updated;
-
-    MPI_Datatype const conservatives_datatype =
-        communicator_.ConservativesDatatype();
-    MPI_Datatype const boundary_jump_datatype =
-        communicator_.JumpSurfaceDatatype();
-
+    cached_details_.clear();
+    MarkAllHalosOutdated();
+    profiler_.Stop();
+    // the migration lasts until the end of the load balancing
+    ProfileRegion const migration_region("Migration");
+    CommunicationCategoryScope const category(CommunicationCategory::Balance);
+
+    // The node migrated by each request, whether it is received and, if so,
+    // whether its prime states are recovered on arrival
+    struct Migration {
+      nid_t id_;
+      bool received_;
+      bool not_updated_;
+    };
+    std::vector<Migration> migrations;
     std::vector<MPI_Request> requests;
 
     int const my_rank_id = MpiUtilities::MyRankId();
 
+    // Each node is transferred in a single message directly from and into its
+    // buffers
     for (auto const &[id, current_rank, future_rank] :
          ids_rank_map) { // We traverse current topology
       /*If the node has not been updated, i.e. integrated values in RHS buffer,
@@ -2072,146 +3490,50 @@ void ModularAlgorithmAssembler::LoadBalancing(
                     LevelOfNode(id)) == updated_levels_descending.end();
 
       if (current_rank == my_rank_id) {
-        Node const &node = tree_.GetNodeWithId(id);
-        for (MaterialName const material : topology_.GetMaterialsOfNode(id)) {
-          Block const &block = node.GetPhaseByMaterial(material);
-
-          communicator_.Send(&block.GetRightHandSideBuffer(), MF::ANOE(),
-                             conservatives_datatype, future_rank, requests);
-          /*If the node has not been updated we need to send the AVG and initial
-           * buffer as well*/
-          if (node_not_updated) {
-            communicator_.Send(&block.GetAverageBuffer(), MF::ANOE(),
-                               conservatives_datatype, future_rank, requests);
-            communicator_.Send(&block.GetInitialBuffer(), MF::ANOE(),
-                               conservatives_datatype, future_rank, requests);
-          }
-          communicator_.Send(&block.GetBoundaryJumpFluxes(), CC::SIDES(),
-                             boundary_jump_datatype, future_rank, requests);
-          communicator_.Send(&block.GetBoundaryJumpConservatives(), CC::SIDES(),
-                             boundary_jump_datatype, future_rank, requests);
-        }
-        if (topology_.IsNodeMultiPhase(id)) {
-          communicator_.Send(
-              node.GetInterfaceTags<
-                  InterfaceDescriptionBufferType::Reinitialized>(),
-              FullBlockSendingSize(), MPI_INT8_T, future_rank, requests);
-          if (node.HasLevelset()) { // Lmax node
-
-            for (MaterialName const material :
-                 topology_.GetMaterialsOfNode(id)) {
-              communicator_.Send(
-                  &node.GetPhaseByMaterial(material).GetPrimeStateBuffer(),
-                  MF::ANOP(), conservatives_datatype, future_rank, requests);
-            }
-            communicator_.Send(node.GetInterfaceBlock().GetReinitializedBuffer(
-                                   InterfaceDescription::Levelset),
-                               FullBlockSendingSize(), MPI_DOUBLE, future_rank,
-                               requests);
-            /**
-             * It is not necessary to send the levelset_initial buffer, since
-             * the levelset is integrated each micro timestep.
-             */
-            communicator_.Send(node.GetInterfaceBlock().GetReinitializedBuffer(
-                                   InterfaceDescription::VolumeFraction),
-                               FullBlockSendingSize(), MPI_DOUBLE, future_rank,
-                               requests);
-            communicator_.Send(node.GetInterfaceBlock().GetInterfaceStateBuffer(
-                                   InterfaceState::Velocity),
-                               FullBlockSendingSize(), MPI_DOUBLE, future_rank,
-                               requests);
-          }
-        }
+        MPI_Datatype datatype =
+            MigrationDatatype(id, tree_.GetNodeWithId(id), node_not_updated,
+                              JumpBuffersNeeded(id));
+        communicator_.Send(MPI_BOTTOM, 1, datatype, future_rank, requests);
+        migrations.push_back({id, false, false});
+        // The datatype is only released once the send has completed
+        MPI_Type_free(&datatype);
         if constexpr (DP::Profile()) {
-          CommunicationStatistics::balance_send_++;
+          CommunicationStatistics::Instance().balance_send_++;
         }
       } else if (future_rank == my_rank_id) { // The node is currently NOT ours,
                                               // but will be in the future
-        if (node_not_updated) {
-          received_nodes_not_updated.push_back(id);
-        }
-        // Create Node first, then post asynchronous Recv.
-        Node &new_node = tree_.CreateNode(id, topology_.GetMaterialsOfNode(id));
-
-        for (MaterialName const material : topology_.GetMaterialsOfNode(id)) {
-          Block &block = new_node.GetPhaseByMaterial(material);
-          communicator_.Recv(&block.GetRightHandSideBuffer(), MF::ANOE(),
-                             conservatives_datatype, current_rank, requests);
-          /*If the node has not been updated, we need to receive ( and apply )
-           * the AVG buffer as well*/
-          if (node_not_updated) {
-            communicator_.Recv(&block.GetAverageBuffer(), MF::ANOE(),
-                               conservatives_datatype, current_rank, requests);
-            communicator_.Recv(&block.GetInitialBuffer(), MF::ANOE(),
-                               conservatives_datatype, current_rank, requests);
-          }
-          communicator_.Recv(&block.GetBoundaryJumpFluxes(), CC::SIDES(),
-                             boundary_jump_datatype, current_rank, requests);
-          communicator_.Recv(&block.GetBoundaryJumpConservatives(), CC::SIDES(),
-                             boundary_jump_datatype, current_rank, requests);
-        }
-        if (topology_.IsNodeMultiPhase(id)) {
-          communicator_.Recv(
-              &new_node.GetInterfaceTags<
-                  InterfaceDescriptionBufferType::Reinitialized>(),
-              FullBlockSendingSize(), MPI_INT8_T, current_rank, requests);
-          if (LevelOfNode(id) == all_levels_.back()) {
-            for (MaterialName const material :
-                 topology_.GetMaterialsOfNode(id)) {
-              communicator_.Recv(
-                  &new_node.GetPhaseByMaterial(material).GetPrimeStateBuffer(),
-                  MF::ANOP(), conservatives_datatype, current_rank, requests);
-            }
-            // We have not yet created a LS field in our recieving Node. At this
-            // point it is clear it need one, so we create it with dummys and
-            // receive the correct values.
-            new_node.SetInterfaceBlock(std::make_unique<InterfaceBlock>(0.0));
-            communicator_.Recv(
-                new_node.GetInterfaceBlock().GetReinitializedBuffer(
-                    InterfaceDescription::Levelset),
-                FullBlockSendingSize(), MPI_DOUBLE, current_rank, requests);
-            communicator_.Recv(
-                new_node.GetInterfaceBlock().GetReinitializedBuffer(
-                    InterfaceDescription::VolumeFraction),
-                FullBlockSendingSize(), MPI_DOUBLE, current_rank, requests);
-            communicator_.Recv(
-                new_node.GetInterfaceBlock().GetInterfaceStateBuffer(
-                    InterfaceState::Velocity),
-                FullBlockSendingSize(), MPI_DOUBLE, current_rank, requests);
-          }
-        } else {
-          std::int8_t uniform_tag =
-              MaterialSignCapsule::SignOfMaterial(
-                  topology_.GetMaterialsOfNode(id).back()) *
-              ITTI(IT::BulkPhase);
-          std::int8_t(&new_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-              new_node.GetInterfaceTags<
-                  InterfaceDescriptionBufferType::Reinitialized>();
-          BO::SetSingleBuffer(new_tags, uniform_tag);
-        }
+        // Create Node with all its buffers first, then post asynchronous Recv.
+        Node &new_node = CreateMigratedNode(id);
+        MPI_Datatype datatype = MigrationDatatype(
+            id, new_node, node_not_updated, JumpBuffersNeeded(id));
+        communicator_.Recv(MPI_BOTTOM, 1, datatype, current_rank, requests);
+        migrations.push_back(
+            {id, true, node_not_updated && topology_.NodeIsLeaf(id)});
+        MPI_Type_free(&datatype);
         if constexpr (DP::Profile()) {
-          CommunicationStatistics::balance_recv_++;
+          CommunicationStatistics::Instance().balance_recv_++;
         }
       }
     }
-    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
-    requests.clear();
-
-    // remove nodes only after Data was received by partner
-    for (unsigned int i = 0; i < ids_rank_map.size();
-         i++) { // We traverse current topology
-      nid_t const id = std::get<0>(ids_rank_map[i]);
-      int const current_rank = std::get<1>(ids_rank_map[i]);
-      if (current_rank == my_rank_id) {
-        tree_.RemoveNodeWithId(id);
-      }
-    }
 
-    // calculate prime states for received nodes that were not updated this
-    // timestep
-    for (auto const &id : received_nodes_not_updated) {
-      if (topology_.NodeIsLeaf(id)) {
-        Node &node = tree_.GetNodeWithId(id);
+    // The partition quality only depends on the new topology, hence, it is
+    // reduced while the nodes are in flight
+    logger_.LogMessage("Load Balancing ( " +
+                       std::to_string(ids_rank_map.size()) + " )");
+    LogPartitionQuality();
+
+    // The migrations complete in the order of arrival. Sent nodes are removed
+    // as soon as their data left ( all nodes are created before, hence, the
+    // freed storage is not reused for pending receives ). Received nodes that
+    // were not updated this timestep get their prime states while the
+    // remaining nodes are still in flight.
+    for (std::size_t completed = 0; completed < requests.size(); ++completed) {
+      int const index = communicator_.WaitAny(requests);
+      Migration const &migration = migrations[index];
+      if (!migration.received_) {
+        tree_.RemoveNodeWithId(migration.id_);
+      } else if (migration.not_updated_) {
+        Node &node = tree_.GetNodeWithId(migration.id_);
         if (node.HasLevelset()) {
           DoObtainPrimeStatesFromConservativesForLevelsetNodes<
               ConservativeBufferType::Average>(node);
@@ -2221,10 +3543,250 @@ void ModularAlgorithmAssembler::LoadBalancing(
         }
       }
     }
+    requests.clear();
 
-    logger_.LogMessage("Load Balancing ( " +
-                       std::to_string(ids_rank_map.size()) + " )");
+    CollectJumpBufferNodes();
+    PlaceLeavesOnNumaDomains();
+    LogMemoryReport();
+  }
+}
+
+/**
+ * @brief Takes an in-memory checkpoint of the current state ( see
+ * RestartOutputSettings::InMemoryCheckpointInterval ). The local nodes are
+ * packed with the datatypes of the load balancing migration and a copy is sent
+ * asynchronously to the buddy rank. The exchange completes in the background
+ * of the following macro timesteps.
+ * @note Must be called between two macro timesteps, i.e. with the state in the
+ * average buffers and reset jump buffers.
+ */
+void ModularAlgorithmAssembler::TakeInMemoryCheckpoint() {
+  ProfileRegion const checkpoint_region("InMemoryCheckpoint");
+  CommunicationCategoryScope const category(CommunicationCategory::Balance);
+  // The buffers of the previous exchange are reused
+  communicator_.WaitAll(checkpoint_.requests_);
+  checkpoint_.requests_.clear();
+
+  int const my_rank_id = MpiUtilities::MyRankId();
+  int const number_of_ranks = MpiUtilities::NumberOfRanks();
+  int const preceding_rank =
+      (my_rank_id + number_of_ranks - 1) % number_of_ranks;
+
+  checkpoint_.time_ = time_integrator_.CurrentRunTime();
+  checkpoint_.ids_.clear();
+  checkpoint_.number_of_materials_.clear();
+  checkpoint_.materials_.clear();
+  checkpoint_.ranks_.clear();
+  checkpoint_.own_data_.clear();
+  checkpoint_.own_sizes_.clear();
+  checkpoint_.buddy_sizes_.clear();
+  for (unsigned int const level : all_levels_) {
+    for (nid_t const id : topology_.IdsOnLevel(level)) {
+      std::vector<MaterialName> const &materials =
+          topology_.GetMaterialsOfNode(id);
+      int const rank = topology_.GetRankOfNode(id);
+      checkpoint_.ids_.push_back(id);
+      checkpoint_.number_of_materials_.push_back(materials.size());
+      checkpoint_.materials_.insert(checkpoint_.materials_.end(),
+                                    materials.begin(), materials.end());
+      checkpoint_.ranks_.push_back(rank);
+      if (rank == my_rank_id) {
+        // The jump buffers are reset after each macro timestep
+        MPI_Datatype datatype =
+            MigrationDatatype(id, tree_.GetNodeWithId(id), true, false);
+        int size = 0;
+        MPI_Pack_size(1, datatype, MpiUtilities::Communicator(), &size);
+        std::size_t const offset = checkpoint_.own_data_.size();
+        checkpoint_.own_data_.resize(offset + size);
+        int position = 0;
+        MPI_Pack(MPI_BOTTOM, 1, datatype, checkpoint_.own_data_.data() + offset,
+                 size, &position, MpiUtilities::Communicator());
+        MPI_Type_free(&datatype);
+        checkpoint_.own_data_.resize(offset + position);
+        checkpoint_.own_sizes_.push_back(position);
+      } else if (number_of_ranks > 1 && rank == preceding_rank) {
+        checkpoint_.buddy_sizes_.push_back(0);
+      }
+    }
+  }
+
+  if (number_of_ranks > 1) {
+    int const buddy_rank =
+        InMemoryCheckpoint::BuddyOfRank(my_rank_id, number_of_ranks);
+    // With two ranks both messages go to the same partner, hence, the order
+    // has to match on both sides ( see TagForRank )
+    bool const receive_first =
+        buddy_rank == preceding_rank && my_rank_id > buddy_rank;
+    auto const exchange = [&](void const *send_buffer, int const send_count,
+                              void *receive_buffer, int const receive_count,
+                              MPI_Datatype const datatype,
+                              std::vector<MPI_Request> &requests) {
+      if (receive_first) {
+        communicator_.Recv(receive_buffer, receive_count, datatype,
+                           preceding_rank, requests);
+      }
+      communicator_.Send(send_buffer, send_count, datatype, buddy_rank,
+                         requests);
+      if (!receive_first) {
+        communicator_.Recv(receive_buffer, receive_count, datatype,
+                           preceding_rank, requests);
+      }
+    };
+    std::vector<MPI_Request> requests;
+    exchange(checkpoint_.own_sizes_.data(), checkpoint_.own_sizes_.size(),
+             checkpoint_.buddy_sizes_.data(), checkpoint_.buddy_sizes_.size(),
+             MPI_INT, requests);
+    communicator_.WaitAll(requests);
+    checkpoint_.buddy_data_.resize(
+        std::accumulate(checkpoint_.buddy_sizes_.begin(),
+                        checkpoint_.buddy_sizes_.end(), std::size_t(0)));
+    exchange(checkpoint_.own_data_.data(), checkpoint_.own_data_.size(),
+             checkpoint_.buddy_data_.data(), checkpoint_.buddy_data_.size(),
+             MPI_PACKED, checkpoint_.requests_);
+  }
+  MemoryStatistics::SetCurrent(MemoryCategory::Checkpoint, checkpoint_.Bytes());
+}
+
+/**
+ * @brief Rolls the simulation back to the last in-memory checkpoint. The
+ * topology of the checkpoint is restored and balanced, the nodes are filled
+ * from the local copies, i.e. the own data or the data of the preceding rank,
+ * and otherwise received from the rank that held them at the checkpoint.
+ * @note Collective, must be called between two macro timesteps.
+ */
+void ModularAlgorithmAssembler::RollBackToInMemoryCheckpoint() {
+  ProfileRegion const rollback_region("InMemoryRollBack");
+  CommunicationCategoryScope const category(CommunicationCategory::Balance);
+  MarkAllHalosOutdated();
+  communicator_.WaitAll(checkpoint_.requests_);
+  checkpoint_.requests_.clear();
+
+  int const my_rank_id = MpiUtilities::MyRankId();
+  int const number_of_ranks = MpiUtilities::NumberOfRanks();
+
+  // Discard the current state
+  std::vector<nid_t> local_ids;
+  for (auto const &level : tree_.FullNodeList()) {
+    for (auto const &[id, node] : level) {
+      local_ids.push_back(id);
+    }
+  }
+  for (nid_t const id : local_ids) {
+    tree_.RemoveNodeWithId(id);
   }
+  topology_.RestoreTopology(checkpoint_.ids_, checkpoint_.number_of_materials_,
+                            checkpoint_.materials_);
+  communicator_.InvalidateCache();
+  cached_details_.clear();
+
+  std::vector<MPI_Request> requests;
+  std::size_t own_offset = 0;
+  std::size_t own_index = 0;
+  std::size_t buddy_offset = 0;
+  std::size_t buddy_index = 0;
+  for (std::size_t i = 0; i < checkpoint_.ids_.size(); ++i) {
+    nid_t const id = checkpoint_.ids_[i];
+    int const checkpoint_rank = checkpoint_.ranks_[i];
+    int const buddy_rank =
+        InMemoryCheckpoint::BuddyOfRank(checkpoint_rank, number_of_ranks);
+    int const future_rank = topology_.GetRankOfNode(id);
+    // Locate the local copy of the node data if present
+    char *data = nullptr;
+    int size = 0;
+    if (checkpoint_rank == my_rank_id) {
+      data = checkpoint_.own_data_.data() + own_offset;
+      size = checkpoint_.own_sizes_[own_index++];
+      own_offset += size;
+    } else if (buddy_rank == my_rank_id) {
+      data = checkpoint_.buddy_data_.data() + buddy_offset;
+      size = checkpoint_.buddy_sizes_[buddy_index++];
+      buddy_offset += size;
+    }
+
+    if (future_rank == my_rank_id) {
+      Node &new_node = CreateMigratedNode(id);
+      MPI_Datatype datatype = MigrationDatatype(id, new_node, true, false);
+      if (data != nullptr) {
+        int position = 0;
+        MPI_Unpack(data, size, &position, MPI_BOTTOM, 1, datatype,
+                   MpiUtilities::Communicator());
+      } else {
+        communicator_.Recv(MPI_BOTTOM, 1, datatype, checkpoint_rank, requests);
+      }
+      MPI_Type_free(&datatype);
+    } else if (checkpoint_rank == my_rank_id && future_rank != buddy_rank) {
+      communicator_.Send(data, size, MPI_PACKED, future_rank, requests);
+    }
+  }
+  communicator_.WaitAll(requests);
+  UpdateJumpBuffers();
+  UpdateIntegrationBuffers();
+  UpdateStatisticsBuffers();
+
+  // The prime states of the restored leaves are recalculated as for migrated
+  // nodes ( in full, an aborted stage may have left recovered leaves behind )
+  recovered_leaves_.clear();
+  for (nid_t const id : topology_.LocalLeafIds()) {
+    Node &node = tree_.GetNodeWithId(id);
+    if (node.HasLevelset()) {
+      DoObtainPrimeStatesFromConservativesForLevelsetNodes<
+          ConservativeBufferType::Average>(node);
+    } else {
+      DoObtainPrimeStatesFromConservativesForNonLevelsetNodes<
+          ConservativeBufferType::Average>(node);
+    }
+  }
+
+  // Discard the micro timesteps of an aborted macro timestep
+  time_integrator_.FinishMacroTimestep();
+  time_integrator_.SetStartTime(checkpoint_.time_);
+  logger_.LogMessage(
+      "Rolled back to in-memory checkpoint t = " +
+      StringOperations::ToScientificNotationString(
+          unit_handler_.DimensionalizeValue(checkpoint_.time_, UnitType::Time),
+          9));
+}
+
+/**
+ * @brief Indicates whether non-physical states exist in the leaves of any
+ * rank, i.e. non-positive densities or pressures not above the limit of the
+ * equation of state ( p + B > 0 ). Not-a-number values are caught as well.
+ * @return True if a non-physical state exists on any rank, false otherwise.
+ */
+bool ModularAlgorithmAssembler::NonPhysicalStatesExist() const {
+  bool non_physical_state_exists = false;
+  for (Node const &node : tree_.Leaves()) {
+    std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
+    for (auto const &[material, block] : node.GetPhases()) {
+      if constexpr (CC::SolidBoundaryActive()) {
+        if (material_manager_.IsSolidBoundary(material))
+          continue;
+      }
+      auto const material_sign = MaterialSignCapsule::SignOfMaterial(material);
+      // The gamma model carries the material properties in the prime states
+      double const minimum_pressure =
+          active_equations == EquationSet::GammaModel
+              ? std::numeric_limits<double>::lowest()
+              : -material_manager_.GetMaterial(material)
+                     .GetEquationOfState()
+                     .B();
+      PrimeStates const &prime_states = block.GetPrimeStateBuffer();
+      for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+        for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+          for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+            if (interface_tags[i][j][k] * material_sign > 0 &&
+                (!(prime_states[PrimeState::Density][i][j][k] > 0.0) ||
+                 !(prime_states[PrimeState::Pressure][i][j][k] >
+                   minimum_pressure))) {
+              non_physical_state_exists = true;
+            }
+          }
+        }
+      }
+    }
+  }
+  return MpiUtilities::GloballyReducedBool(non_physical_state_exists);
 }
 
 /**
@@ -2235,9 +3797,19 @@ void ModularAlgorithmAssembler::LoadBalancing(
 void ModularAlgorithmAssembler::ImposeInitialCondition(
     unsigned int const level, InitialCondition &initial_condition) {
 
-  double initial_prime_states[MF::ANOP()][CC::ICX()][CC::ICY()][CC::ICZ()];
-
+  // The nodes are independent, hence they are distributed among the threads.
+  // The prime state initializer holds per-thread expressions and its random
+  // numbers do not depend on the evaluation order.
+  std::vector<std::pair<nid_t, Node *>> nodes;
   for (auto &[id, node] : tree_.GetLevelContent(level)) {
+    nodes.emplace_back(id, &node);
+  }
+  long const number_of_nodes = static_cast<long>(nodes.size());
+#pragma omp parallel for schedule(dynamic)
+  for (long node_index = 0; node_index < number_of_nodes; ++node_index) {
+    nid_t const id = nodes[node_index].first;
+    Node &node = *nodes[node_index].second;
+    double initial_prime_states[MF::ANOP()][CC::ICX()][CC::ICY()][CC::ICZ()];
     for (MaterialName const material : topology_.GetMaterialsOfNode(id)) {
 
       std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
@@ -2287,6 +3859,167 @@ void ModularAlgorithmAssembler::UpdateTopology() {
     // Caches for Halo Updates are only invalid if nodes have been refined,
     // coarsened or moved. Changes in the number of materials are no Problem.
     communicator_.InvalidateCache();
+    cached_details_.clear();
+    MarkAllHalosOutdated();
+  }
+  // Also new phases need jump buffers, hence this is done unconditionally
+  UpdateJumpBuffers();
+  UpdateIntegrationBuffers();
+  UpdateStatisticsBuffers();
+}
+
+/**
+ * @brief Indicates whether the blocks of the given node need jump buffers.
+ * @param id The id of the node.
+ * @return True if jump buffers are needed, false otherwise.
+ */
+bool ModularAlgorithmAssembler::JumpBuffersNeeded(nid_t const id) const {
+  return !CC::LazyJumpBuffers() || topology_.NodeNeedsJumpBuffers(id);
+}
+
+/**
+ * @brief Allocates the jump buffers of all local blocks that take part in a
+ * resolution jump and frees them on all others.
+ */
+void ModularAlgorithmAssembler::UpdateJumpBuffers() {
+  if constexpr (CC::LazyJumpBuffers()) {
+    for (auto &level : tree_.FullNodeList()) {
+      for (auto &[id, node] : level) {
+        bool const needed = topology_.NodeNeedsJumpBuffers(id);
+        for (auto &phase : node.GetPhases()) {
+          if (needed) {
+            phase.second.AllocateJumpBuffers();
+          } else {
+            phase.second.ReleaseJumpBuffers();
+          }
+        }
+      }
+    }
+  }
+  CollectJumpBufferNodes();
+}
+
+/**
+ * @brief Indicates whether the blocks of the given node need integration
+ * buffers.
+ * @param id The id of the node.
+ * @return True if integration buffers are needed, false otherwise.
+ */
+bool ModularAlgorithmAssembler::IntegrationBuffersNeeded(nid_t const id) const {
+  return !CC::LazyIntegrationBuffers() || topology_.NodeIsLeaf(id);
+}
+
+/**
+ * @brief Allocates the integration buffers of all local blocks of leaves and
+ * frees them on all parents. Nodes that become leaves through coarsening thus
+ * obtain their buffers, which are filled at the begin of their next time step.
+ */
+void ModularAlgorithmAssembler::UpdateIntegrationBuffers() {
+  if constexpr (CC::LazyIntegrationBuffers()) {
+    for (auto &level : tree_.FullNodeList()) {
+      for (auto &[id, node] : level) {
+        bool const needed = topology_.NodeIsLeaf(id);
+        for (auto &phase : node.GetPhases()) {
+          if (needed) {
+            phase.second.AllocateIntegrationBuffers();
+          } else {
+            phase.second.ReleaseIntegrationBuffers();
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Indicates whether the blocks of the given node need statistics
+ * buffers.
+ * @param id The id of the node.
+ * @return True if statistics buffers are needed, false otherwise.
+ */
+bool ModularAlgorithmAssembler::StatisticsBuffersNeeded(nid_t const id) const {
+  return StatisticsOutputSettings::SamplingInterval > 0 &&
+         topology_.NodeIsLeaf(id);
+}
+
+/**
+ * @brief Allocates the statistics buffers of all local blocks of leaves and
+ * frees them on all parents. The statistics of refined and coarsened nodes are
+ * passed on beforehand ( see RefineNode() and Averager::AverageStatistics() ),
+ * blocks of new phases start without samples.
+ */
+void ModularAlgorithmAssembler::UpdateStatisticsBuffers() {
+  if constexpr (StatisticsOutputSettings::SamplingInterval > 0) {
+    for (auto &level : tree_.FullNodeList()) {
+      for (auto &[id, node] : level) {
+        bool const needed = topology_.NodeIsLeaf(id);
+        for (auto &phase : node.GetPhases()) {
+          if (needed) {
+            phase.second.AllocateStatisticsBuffers();
+          } else {
+            phase.second.ReleaseStatisticsBuffers();
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Adds the current prime states of all local leaves as sample to their
+ * running statistics ( see StatisticsOutputSettings ). Phases that appeared
+ * since the last topology update start without samples.
+ */
+void ModularAlgorithmAssembler::SampleStatistics() {
+  for (unsigned int const level : all_levels_) {
+    for (Node &node : tree_.LeavesOnLevel(level)) {
+      for (auto &phase : node.GetPhases()) {
+        phase.second.AllocateStatisticsBuffers();
+        SO::Sample(phase.second.GetPrimeStateBuffer(),
+                   phase.second.GetStatisticsBuffers());
+      }
+    }
+  }
+}
+
+/**
+ * @brief Moves the blocks of all local leaves to the NUMA domain of the thread
+ * the leaf is assigned to in the leaf loops. The loops over the leaves of a
+ * level are scheduled at runtime, which is static if CC::NumaAwarePlacement()
+ * is set ( see main ), hence the same leaves go to the same threads here and
+ * in the right-hand side computation. Must be called whenever leaves migrate,
+ * leaves created by remeshing are placed at the next call.
+ */
+void ModularAlgorithmAssembler::PlaceLeavesOnNumaDomains() {
+  if constexpr (CC::NumaAwarePlacement()) {
+    for (unsigned int const level : all_levels_) {
+      std::vector<std::reference_wrapper<Node>> const &leaves =
+          tree_.LeavesOnLevel(level);
+      long const number_of_leaves = static_cast<long>(leaves.size());
+#pragma omp parallel for schedule(runtime)
+      for (long leaf_index = 0; leaf_index < number_of_leaves; ++leaf_index) {
+        leaves[leaf_index].get().MoveToNumaDomain(
+            NumaPlacement::CurrentDomain());
+      }
+    }
+  }
+}
+
+/**
+ * @brief Gathers the local nodes holding jump buffers on each level, such that
+ * resetting the buffers skips all others. Must be called whenever nodes are
+ * created or removed.
+ */
+void ModularAlgorithmAssembler::CollectJumpBufferNodes() {
+  std::vector<NodeStore> &levels = tree_.FullNodeList();
+  jump_buffer_nodes_.resize(levels.size());
+  for (unsigned int level = 0; level < levels.size(); ++level) {
+    jump_buffer_nodes_[level].clear();
+    for (auto &[id, node] : levels[level]) {
+      if (JumpBuffersNeeded(id)) {
+        jump_buffer_nodes_[level].push_back(node);
+      }
+    }
   }
 }
 
@@ -2297,8 +4030,10 @@ void ModularAlgorithmAssembler::UpdateTopology() {
  * coarsened, in order to maintain a consistent buffer state.
  * @param levels_to_update_ascending List of the levels to be considered for
  * coarsening/refinement.
+ * @return False if no wavelet analysis was due ( see CC::RemeshInterval() ),
+ * i.e. the topology is unchanged, true otherwise.
  */
-void ModularAlgorithmAssembler::Remesh(
+bool ModularAlgorithmAssembler::Remesh(
     std::vector<unsigned int> const levels_to_update_ascending) {
 
   /*** We create run the Wavelet analysis on finished levels ***/
@@ -2312,38 +4047,132 @@ void ModularAlgorithmAssembler::Remesh(
                        return level >= topology_.GetCurrentMaximumLevel();
                      }),
       parent_levels.end());
-  std::vector<nid_t> nodes_to_be_coarsened;
+  if constexpr (CC::CWD()) {
+    AccumulateChangesOfCachedDetails(levels_to_update_ascending);
+  }
+
+  // The children of a level are only analysed every CC::RemeshInterval() time
+  // steps of the level. In between, fronts may move by
+  // 2 * CC::RemeshInterval() * CFL cells on the level of the children, hence
+  // a band of blocks of this width around all refined regions is kept refined.
+  unsigned int band = 0;
+  if constexpr (CC::RemeshInterval() > 1) {
+    for (unsigned int const level : levels_to_update_ascending) {
+      ++steps_since_analysis_[level];
+    }
+    parent_levels.erase(std::remove_if(parent_levels.begin(),
+                                       parent_levels.end(),
+                                       [&](unsigned int const level) {
+                                         return steps_since_analysis_[level] <
+                                                CC::RemeshInterval();
+                                       }),
+                        parent_levels.end());
+    if (parent_levels.empty()) {
+      std::vector<unsigned int> halo_levels(levels_to_update_ascending);
+      halo_levels.erase(halo_levels.begin());
+      halo_manager_.MaterialHaloUpdate(halo_levels,
+                                       MaterialFieldType::Conservatives);
+      return false;
+    }
+    for (unsigned int const level : parent_levels) {
+      steps_since_analysis_[level] = 0;
+    }
+    band = static_cast<unsigned int>(
+        std::ceil(2.0 * CC::RemeshInterval() * cfl_number_ / CC::ICX()));
+  }
+
+  UpdateMemoryBudgetState();
+  // Leaves are replaced and migrated from here on, hence, the prime states of
+  // all leaves are recovered in full at the end of the stage
+  recovered_leaves_.clear();
+
+  std::vector<nid_t> parents_to_be_coarsened;
   std::vector<nid_t> nodes_needing_refinement;
-  DetermineRemeshingNodes(parent_levels, nodes_to_be_coarsened,
+  profiler_.Start("DetermineRemeshingNodes");
+  DetermineRemeshingNodes(parent_levels, parents_to_be_coarsened,
                           nodes_needing_refinement);
+  profiler_.Stop();
+
+  // The refinement is refused on all ranks alike once the memory budget is
+  // exhausted, the coarsening still proceeds
+  if (refinement_refused_) {
+    nodes_needing_refinement.clear();
+  }
 
   /* First we deal with the refinement. We keep the nodes to be coarsened until
    * after the halo update, which is need in the refinement process, to reduce
    * the possible number of jumphalos.
    */
 
-  // We need to cut all non-leaves and all Lmax-leaves from the refinement list.
+  // We need to cut all non-leaves and all leaves on the maximum level ( or the
+  // limit of the grid sequencing ) from the refinement list.
   nodes_needing_refinement.erase(
       std::remove_if(nodes_needing_refinement.begin(),
                      nodes_needing_refinement.end(),
                      [&](nid_t const id) {
                        return (!topology_.NodeIsLeaf(id) ||
-                               LevelOfNode(id) == all_levels_.back());
+                               LevelOfNode(id) >= refinement_level_limit_);
                      }),
       nodes_needing_refinement.end());
 
-  // Global Distibution of the refine list
+  // Level zero parents are not allowed, as this means a coarsening of level 1.
+  parents_to_be_coarsened.erase(
+      std::remove_if(
+          parents_to_be_coarsened.begin(), parents_to_be_coarsened.end(),
+          [&](nid_t const parent_id) { return LevelOfNode(parent_id) == 0; }),
+      parents_to_be_coarsened.end());
+
+  // Global distribution of the refine list and the coarsened parents in one
+  // exchange. The decisions are local to the ranks holding the parents, hence
+  // only this delta of the topology is communicated. Nodes to be refined are
+  // leaves while parents are not, which splits the list again ( same on all
+  // ranks, as the topology is global ).
+  std::vector<nid_t> remeshing_list(nodes_needing_refinement);
+  remeshing_list.insert(remeshing_list.end(), parents_to_be_coarsened.begin(),
+                        parents_to_be_coarsened.end());
+  std::vector<nid_t> global_remeshing_list;
+  MpiUtilities::LocalToGlobalData(remeshing_list, MPI_LONG_LONG_INT,
+                                  number_of_ranks, global_remeshing_list);
   std::vector<nid_t> global_refine_list;
-  MpiUtilities::LocalToGlobalData(nodes_needing_refinement, MPI_LONG_LONG_INT,
-                                  number_of_ranks, global_refine_list);
+  std::vector<nid_t> parents_of_coarsened;
+  std::partition_copy(global_remeshing_list.begin(),
+                      global_remeshing_list.end(),
+                      std::back_inserter(global_refine_list),
+                      std::back_inserter(parents_of_coarsened),
+                      [&](nid_t const id) { return topology_.NodeIsLeaf(id); });
+
+  // The band ahead of the refined leaves is refined as well ( same on all
+  // ranks, as the topology is global )
+  if (band > 0) {
+    std::size_t const number_of_refined_leaves = global_refine_list.size();
+    for (std::size_t index = 0; index < number_of_refined_leaves; ++index) {
+      for (nid_t const neighbor_id :
+           NeighborsWithinBand(global_refine_list[index], band)) {
+        if (topology_.NodeIsLeaf(neighbor_id) &&
+            !topology_.IsNodeMultiPhase(neighbor_id) &&
+            LevelOfNode(neighbor_id) <
+                multiresolution_.GetRefinementRegions().LevelBoundsOfNode(
+                    neighbor_id)[1]) {
+          global_refine_list.push_back(neighbor_id);
+        }
+      }
+    }
+    // Sort - Erase - Unique - Idiom
+    std::sort(global_refine_list.begin(), global_refine_list.end());
+    global_refine_list.erase(
+        std::unique(global_refine_list.begin(), global_refine_list.end()),
+        global_refine_list.end());
+  }
 
-  // Duplicates can not exist - no check needed
+  // Duplicates can not exist ( or have been removed ) - no check needed
+  profiler_.Start("Refinement");
   for (nid_t const leaf_id : global_refine_list) {
     if (topology_.NodeIsOnRank(leaf_id, communicator_.MyRankId())) {
       RefineNode(leaf_id);
     }
   }
   UpdateTopology();
+  profiler_.Stop();
   std::vector<unsigned int> halo_levels(levels_to_update_ascending);
   halo_levels.erase(
       halo_levels.begin()); // The lowest level did not change during refinement
@@ -2354,39 +4183,44 @@ void ModularAlgorithmAssembler::Remesh(
 
   /* Second we deal with coarsening*/
 
-  // Global Distribution of the coarse list
-  std::vector<nid_t> global_remove_list;
-  MpiUtilities::LocalToGlobalData(nodes_to_be_coarsened, MPI_LONG_LONG_INT,
-                                  number_of_ranks, global_remove_list);
+  // Families within the band of nodes which are kept are kept as well
+  if (band > 0) {
+    std::unordered_set<nid_t> removed;
+    for (nid_t const parent_id : parents_of_coarsened) {
+      for (nid_t const child_id : IdsOfChildren(parent_id)) {
+        removed.insert(child_id);
+      }
+    }
+    parents_of_coarsened.erase(
+        std::remove_if(parents_of_coarsened.begin(), parents_of_coarsened.end(),
+                       [&](nid_t const parent_id) {
+                         for (nid_t const child_id : IdsOfChildren(parent_id)) {
+                           for (nid_t const neighbor_id :
+                                NeighborsWithinBand(child_id, band)) {
+                             if (removed.count(neighbor_id) == 0) {
+                               return true;
+                             }
+                           }
+                         }
+                         return false;
+                       }),
+        parents_of_coarsened.end());
+  }
 
   // Gives ALL local nodes which need to be deleted
   std::vector<nid_t> local_cut;
-  std::copy_if(global_remove_list.begin(), global_remove_list.end(),
-               std::back_inserter(local_cut), [&](nid_t const id) {
-                 return topology_.NodeIsOnRank(id, communicator_.MyRankId());
-               });
-
-  // Coarsening operation is called on parents, hence we convert the coarse list
-  // to a list of the respective parents. NH TODO-19 this cumbersome step should
-  // go away
-  std::vector<nid_t> parents_of_coarsened = global_remove_list;
-  std::for_each(
-      parents_of_coarsened.begin(), parents_of_coarsened.end(),
-      [](nid_t &to_parent) { to_parent = ParentIdOfNode(to_parent); });
-
-  // Housekeeping - Due to ancestors in list duplicates may arise - these need
-  // to be cut Sort - Erase - Unique - Idiom
-  std::sort(parents_of_coarsened.begin(), parents_of_coarsened.end());
-  parents_of_coarsened.erase(
-      std::unique(parents_of_coarsened.begin(), parents_of_coarsened.end()),
-      parents_of_coarsened.end());
+  for (nid_t const parent_id : parents_of_coarsened) {
+    for (nid_t const child_id : IdsOfChildren(parent_id)) {
+      if (topology_.NodeIsOnRank(child_id, communicator_.MyRankId())) {
+        local_cut.push_back(child_id);
+      }
+    }
+  }
 
-  // Level zero parents are not allowed, as this means a coarsening of level 1.
-  parents_of_coarsened.erase(
-      std::remove_if(
-          parents_of_coarsened.begin(), parents_of_coarsened.end(),
-          [&](nid_t const parent_id) { return LevelOfNode(parent_id) == 0; }),
-      parents_of_coarsened.end());
+  // The statistics of the children are kept in their parents
+  if constexpr (StatisticsOutputSettings::SamplingInterval > 0) {
+    averager_.AverageStatistics(parents_of_coarsened);
+  }
 
   // Updating the topology ( light data )
   for (nid_t const parent_id : parents_of_coarsened) {
@@ -2394,40 +4228,203 @@ void ModularAlgorithmAssembler::Remesh(
   }
   if (!parents_of_coarsened.empty()) {
     communicator_.InvalidateCache();
+    cached_details_.clear();
+    MarkAllHalosOutdated();
   }
 
   // Updating the tree ( hard data )
-
-  // Sort - Erase - Unique - Idiom
-  std::sort(local_cut.begin(), local_cut.end());
-  local_cut.erase(std::unique(local_cut.begin(), local_cut.end()),
-                  local_cut.end());
-
-  // Level One may not be coarsened, ever.
-  local_cut.erase(
-      std::remove_if(local_cut.begin(), local_cut.end(),
-                     [&](nid_t const id) { return (LevelOfNode(id) == 1); }),
-      local_cut.end());
   for (auto const &nid_to_be_removed : local_cut) {
     tree_.RemoveNodeWithId(nid_to_be_removed);
   }
+  return true;
+}
+
+/**
+ * @brief Compares the memory held by the ranks against their budget and limits
+ * the single-phase refinement accordingly. Above
+ * CC::MemoryBudgetRaiseFraction() of the budget, the thresholds are raised
+ * exponentially up to the ratio of the refine and the coarsen threshold at
+ * CC::MemoryBudgetRefuseFraction(), above which the refinement is refused. The
+ * state follows the fullest rank, hence, all families are judged alike. Each
+ * escalation is logged and forces the following load balancing to spread the
+ * memory over the ranks.
+ * @note Collective call, hence, it must be called on all ranks.
+ */
+void ModularAlgorithmAssembler::UpdateMemoryBudgetState() {
+  if (memory_budget_ <= 0.0) {
+    return;
+  }
+  UpdateMemoryStatistics();
+  double fraction = CurrentMemoryBytes() / memory_budget_;
+  MPI_Allreduce(MPI_IN_PLACE, &fraction, 1, MPI_DOUBLE, MPI_MAX,
+                MpiUtilities::Communicator());
+
+  // Ratio of the refine and the coarsen threshold of the fifth-order prediction
+  constexpr double maximum_threshold_factor = 32.0;
+  double const exhaustion = std::clamp(
+      (fraction - CC::MemoryBudgetRaiseFraction()) /
+          (CC::MemoryBudgetRefuseFraction() - CC::MemoryBudgetRaiseFraction()),
+      0.0, 1.0);
+  double const threshold_factor =
+      std::pow(maximum_threshold_factor, exhaustion);
+  bool const refused = fraction >= CC::MemoryBudgetRefuseFraction();
+
+  std::string const usage =
+      StringOperations::ToScientificNotationString(100.0 * fraction, 3) +
+      " % of the memory budget used";
+  if (refused && !refinement_refused_) {
+    logger_.LogMessage("Warning: " + usage +
+                       ". Single-phase refinement refused, load rebalanced");
+    memory_rebalance_required_ = true;
+  } else if (threshold_factor > 1.0 && refinement_threshold_factor_ == 1.0) {
+    logger_.LogMessage("Warning: " + usage +
+                       ". Refinement thresholds raised, load rebalanced");
+    memory_rebalance_required_ = true;
+  } else if (threshold_factor == 1.0 && refinement_threshold_factor_ > 1.0) {
+    logger_.LogMessage(usage + ". Refinement thresholds restored");
+  }
+  refinement_threshold_factor_ = threshold_factor;
+  refinement_refused_ = refused;
+}
+
+/**
+ * @brief Raises the maximum level of the single-phase refinement during grid
+ * sequencing, i.e., by one for each time stamp passed and once the relative
+ * change of the kinetic energy in the last macro timestep falls below the
+ * tolerance. The new finest level is populated by the following remeshing
+ * steps, which refine where the wavelet details demand it ( the children are
+ * predicted from their parents ). The data structures are sized for the
+ * maximum level from the start, hence, no restart is needed.
+ * @param time The current simulation time.
+ * @note Collective call, hence, it must be called on all ranks.
+ */
+void ModularAlgorithmAssembler::UpdateGridSequencing(double const time) {
+  unsigned int raises = 0;
+  while (next_grid_sequencing_stamp_ < grid_sequencing_stamps_.size() &&
+         grid_sequencing_stamps_[next_grid_sequencing_stamp_] <= time) {
+    ++next_grid_sequencing_stamp_;
+    ++raises;
+  }
+  if (grid_sequencing_tolerance_ > 0.0 && raises == 0 &&
+      refinement_level_limit_ < all_levels_.back()) {
+    double const kinetic_energy = TotalKineticEnergy();
+    if (last_kinetic_energy_ > 0.0 &&
+        std::abs(kinetic_energy - last_kinetic_energy_) <=
+            grid_sequencing_tolerance_ * last_kinetic_energy_) {
+      raises = 1;
+    }
+    last_kinetic_energy_ = kinetic_energy;
+  }
+  if (raises == 0 || refinement_level_limit_ == all_levels_.back()) {
+    return;
+  }
+  refinement_level_limit_ =
+      std::min(refinement_level_limit_ + raises, all_levels_.back());
+  // The energy of the refined flow is not compared to the coarse one
+  last_kinetic_energy_ = -1.0;
+  logger_.LogMessage("Grid sequencing: maximum refinement level raised to " +
+                     std::to_string(refinement_level_limit_));
+}
+
+/**
+ * @brief Gives the kinetic energy of all materials in the domain, i.e., the
+ * sum over the cells of all leaves weighted by their volume.
+ * @return The kinetic energy ( non-dimensional ).
+ * @note Collective call, hence, it must be called on all ranks.
+ */
+double ModularAlgorithmAssembler::TotalKineticEnergy() const {
+  double kinetic_energy = 0.0;
+  for (unsigned int const level : all_levels_) {
+    double const cell_size =
+        cell_size_on_maximum_level_ * double(1 << (all_levels_.back() - level));
+    double const cell_volume = std::pow(cell_size, DTI(CC::DIM()));
+    for (Node const &node : tree_.LeavesOnLevel(level)) {
+      std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+          node.GetInterfaceTags<
+              InterfaceDescriptionBufferType::Reinitialized>();
+      for (auto const &[material, block] : node.GetPhases()) {
+        if constexpr (CC::SolidBoundaryActive()) {
+          if (material_manager_.IsSolidBoundary(material))
+            continue;
+        }
+        auto const material_sign =
+            MaterialSignCapsule::SignOfMaterial(material);
+        PrimeStates const &prime_states = block.GetPrimeStateBuffer();
+        for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+          for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+            for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+              if (interface_tags[i][j][k] * material_sign < 0) {
+                continue;
+              }
+              double velocity_squared = 0.0;
+              for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+                velocity_squared += prime_states[MF::AV()[d]][i][j][k] *
+                                    prime_states[MF::AV()[d]][i][j][k];
+              }
+              kinetic_energy += 0.5 *
+                                prime_states[PrimeState::Density][i][j][k] *
+                                velocity_squared * cell_volume;
+            }
+          }
+        }
+      }
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &kinetic_energy, 1, MPI_DOUBLE, MPI_SUM,
+                MpiUtilities::Communicator());
+  return kinetic_energy;
+}
+
+/**
+ * @brief Gives the existing nodes on the same level as the given node which
+ * are at most the given number of blocks away ( in each direction ).
+ * @param id The id of the node.
+ * @param band The width of the band in blocks.
+ * @return The ids of the neighbors within the band ( without the node itself ).
+ */
+std::vector<nid_t>
+ModularAlgorithmAssembler::NeighborsWithinBand(nid_t const id,
+                                               unsigned int const band) const {
+  std::vector<nid_t> neighbors;
+  std::vector<nid_t> layer = {id};
+  for (unsigned int width = 0; width < band; ++width) {
+    std::vector<nid_t> next_layer;
+    for (nid_t const layer_id : layer) {
+      for (BoundaryLocation const location : CC::HBS()) {
+        if (topology_.IsExternalTopologyBoundary(location, layer_id)) {
+          continue;
+        }
+        nid_t const neighbor_id =
+            topology_.GetTopologyNeighborId(layer_id, location);
+        if (neighbor_id != id && topology_.NodeExists(neighbor_id) &&
+            std::find(neighbors.cbegin(), neighbors.cend(), neighbor_id) ==
+                neighbors.cend()) {
+          neighbors.push_back(neighbor_id);
+          next_layer.push_back(neighbor_id);
+        }
+      }
+    }
+    layer = std::move(next_layer);
+  }
+  return neighbors;
 }
 
 /**
  * @brief Gives the ids of nodes which may be coarsened or need refinement
- * according to the wavelet-analysis of \cite Harten 1993
+ * according to the wavelet-analysis of \cite Harten 1993 or a local refinement
+ * indicator ( see CC::RI() )
  * @param parent_levels The levels of the parents, i.e. Children of these
  * parents might be coarsened.
- * @param remove_list A list of all ids of nodes which may be coarsened (
- * indirect return parameter ).
+ * @param coarsen_list A list of the ids of parents whose children may be
+ * coarsened ( indirect return parameter ). Only filled by the rank holding the
+ * parent.
  * @param refine_list A list of all ids of nodes which must be refined (
  * indirect return parameter ).
  */
 void ModularAlgorithmAssembler::DetermineRemeshingNodes(
     std::vector<unsigned int> const parent_levels,
-    std::vector<nid_t> &remove_list, std::vector<nid_t> &refine_list) const {
+    std::vector<nid_t> &coarsen_list, std::vector<nid_t> &refine_list) {
 
-  std::vector<RemeshIdentifier> remesh_list;
   int const my_rank = communicator_.MyRankId();
   /**
    *  We need to check whether or not a node may be coarsened stay or even be
@@ -2435,14 +4432,49 @@ void ModularAlgorithmAssembler::DetermineRemeshingNodes(
    * only coarse or refine leaves and siblings may only be coarsened together.
    *  In two-phase simulations further checks are needed as multi nodes may only
    * be leaves if they reside on Lmax.
+   *  The load balancing keeps siblings on the rank of their parent, hence the
+   * decisions are commonly rank-local. Children residing on another rank than
+   * their parent ( e.g. siblings split into single- and multi-phase nodes ) are
+   * exchanged non-blocking. Only the equations entering the wavelet analysis
+   * are sent, packed into one message per child. All receives are posted before
+   * the rank-local decisions are made, remote decisions are made as the data
+   * arrives.
+   *  Local refinement indicators need no parent data. The rank holding a remote
+   * child evaluates it and only sends the indicator value.
    */
-  MPI_Datatype const conservatives_struct_ =
-      communicator_.ConservativesDatatype();
+  constexpr bool local_indicator =
+      CC::RI() != RefinementIndicator::WaveletDetail;
+  constexpr std::size_t values_per_equation = CC::TCX() * CC::TCY() * CC::TCZ();
+  constexpr std::size_t values_per_child =
+      local_indicator ? 1 : MF::EWA().size() * values_per_equation;
+
+  // Remeshing decisions of all siblings whose parent is held by this rank
+  struct Family {
+    nid_t parent_id_;
+    std::array<nid_t, CC::NOC()> children_;
+    std::vector<RemeshIdentifier> remesh_list_;
+  };
+  // Children whose data is received from another rank
+  struct RemoteChild {
+    std::size_t family_;
+    std::size_t position_;
+    nid_t child_id_;
+  };
+
+  std::vector<Family> families;
+  std::vector<RemoteChild> remote_children;
+  std::vector<std::vector<double>> recv_buffers;
+  std::vector<std::vector<double>> send_buffers;
+  std::vector<MPI_Request> recv_requests;
+  std::vector<MPI_Request> send_requests;
+  // Local children are only evaluated once all messages are posted
+  std::vector<std::pair<std::size_t, std::size_t>> local_children;
+
   for (auto const &level_of_parent : parent_levels) {
     for (auto const &parent_id : topology_.IdsOnLevel(level_of_parent)) {
       bool const parent_on_my_rank = topology_.NodeIsOnRank(parent_id, my_rank);
-      std::vector<nid_t> const children = IdsOfChildren(parent_id);
-      for (auto const &child_id : children) {
+      Family family{parent_id, IdsOfChildren(parent_id), {}};
+      for (auto const &child_id : family.children_) {
         if (topology_.NodeExists(child_id)) {
           if (!topology_.IsNodeMultiPhase(
                   child_id)) { // only single nodes may be coarsened or refined
@@ -2451,84 +4483,238 @@ void ModularAlgorithmAssembler::DetermineRemeshingNodes(
               bool const child_on_my_rank =
                   topology_.NodeIsOnRank(child_id, my_rank);
               if (parent_on_my_rank) {
+                // The decision is filled in once all messages are posted
+                family.remesh_list_.emplace_back(RemeshIdentifier::Neutral);
                 if (child_on_my_rank) { // We hold parent and Child -> NO MPI
-
-                  remesh_list.emplace_back(
-                      multiresolution_.ChildNeedsRemeshing<CC::NFWA()>(
-                          tree_.GetNodeWithId(parent_id).GetPhaseByMaterial(
-                              topology_.SingleMaterialOfNode(child_id)),
-                          tree_.GetNodeWithId(child_id).GetSinglePhase(),
-                          child_id));
-
+                  local_children.emplace_back(families.size(),
+                                              family.remesh_list_.size() - 1);
                 } else { // We hold parent but not the Child ( which exists ) ->
-                         // MPI_Receive
-
-                  // get material of child via topology ( since it is
-                  // single-phase taking front() of the material vector is valid
-                  // )
-                  Block received_child_block = Block();
-                  int const sender_rank = topology_.GetRankOfNode(child_id);
-                  MPI_Recv(&received_child_block.GetRightHandSideBuffer(),
-                           MF::ANOE(), conservatives_struct_, sender_rank, 0,
-                           MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-                  remesh_list.emplace_back(
-                      multiresolution_.ChildNeedsRemeshing<CC::NFWA()>(
-                          tree_.GetNodeWithId(parent_id).GetPhaseByMaterial(
-                              topology_.SingleMaterialOfNode(child_id)),
-                          received_child_block, child_id));
+                         // MPI_Irecv
+                  remote_children.push_back({families.size(),
+                                             family.remesh_list_.size() - 1,
+                                             child_id});
+                  recv_buffers.emplace_back(values_per_child);
+                  communicator_.Recv(
+                      recv_buffers.back().data(), values_per_child, MPI_DOUBLE,
+                      topology_.GetRankOfNode(child_id), recv_requests);
                 }
               } else {
                 if (child_on_my_rank) { // We do NOT hold the parent, but do
-                                        // hold the Child -> MPI Send
-                  int receiver_rank = topology_.GetRankOfNode(parent_id);
+                                        // hold the Child -> MPI_Isend
                   Block const &send_child =
                       tree_.GetNodeWithId(child_id).GetSinglePhase();
-                  MPI_Send(&send_child.GetRightHandSideBuffer(), MF::ANOE(),
-                           conservatives_struct_, receiver_rank, 0,
-                           MPI_COMM_WORLD);
+                  send_buffers.emplace_back(values_per_child);
+                  double *buffer = send_buffers.back().data();
+                  if constexpr (local_indicator) {
+                    buffer[0] =
+                        Multiresolution::LocalIndicator<CC::RI()>(send_child);
+                  } else {
+                    for (Equation const eq : MF::EWA()) {
+                      FieldValue const *values =
+                          &send_child.GetRightHandSideBuffer(eq)[0][0][0];
+                      std::copy(values, values + values_per_equation, buffer);
+                      buffer += values_per_equation;
+                    }
+                  }
+                  communicator_.Send(
+                      send_buffers.back().data(), values_per_child, MPI_DOUBLE,
+                      topology_.GetRankOfNode(parent_id), send_requests);
                 }
               }
             } else { // IF: IsLeaf
               // Add a meshing-lock, i. e. neutral
               if (parent_on_my_rank) { // Only the parent needs to fill this
                                        // list.
-                remesh_list.emplace_back(RemeshIdentifier::Neutral);
+                family.remesh_list_.emplace_back(RemeshIdentifier::Neutral);
               }
             } // ELSE: IsLeaf
 
           } else { // Child is multi-phase
             // In case the child is multi-phase we don't do anything
             if (parent_on_my_rank) {
-              remesh_list.emplace_back(RemeshIdentifier::Neutral);
+              family.remesh_list_.emplace_back(RemeshIdentifier::Neutral);
             }
           } // else : child is multi-phase
         }   // child node exists
       }     // children
+      if (!family.remesh_list_.empty()) {
+        families.push_back(std::move(family));
+      }
+    } // parents
+  }   // level_of_parent
 
-      // Now we have checked all siblings
-#ifndef PERFORMANCE
-      if (!remesh_list.empty() && remesh_list.size() != children.size()) {
-        throw std::logic_error("This must not happen");
+  // Rank-local decisions while the messages are in flight. Leaves whose
+  // decision cannot have changed since their last analysis reuse it.
+  for (auto const &[family_index, position] : local_children) {
+    Family &family = families[family_index];
+    nid_t const child_id = family.children_[position];
+    if constexpr (local_indicator) {
+      family.remesh_list_[position] =
+          Multiresolution::LeafNeedsRemeshing<CC::RI()>(
+              tree_.GetNodeWithId(child_id).GetSinglePhase(),
+              refinement_threshold_factor_);
+      continue;
+    }
+    unsigned int const level = LevelOfNode(child_id);
+    if constexpr (CC::CWD()) {
+      auto const cached = cached_details_.find(child_id);
+      if (cached != cached_details_.end() &&
+          multiresolution_.DecisionIsCertain(cached->second, level,
+                                             refinement_threshold_factor_)) {
+        family.remesh_list_[position] = multiresolution_.RemeshingDecision(
+            cached->second.detail_, level, refinement_threshold_factor_);
+        continue;
       }
+    }
+    double const detail = multiresolution_.ChildDetail<CC::NFWA()>(
+        tree_.GetNodeWithId(family.parent_id_)
+            .GetPhaseByMaterial(topology_.SingleMaterialOfNode(child_id)),
+        tree_.GetNodeWithId(child_id).GetSinglePhase(), child_id);
+    family.remesh_list_[position] = multiresolution_.RemeshingDecision(
+        detail, level, refinement_threshold_factor_);
+    if constexpr (CC::CWD()) {
+      cached_details_[child_id] = {detail, 0.0};
+    }
+  }
+
+  // Remote decisions in the order of arrival
+  if (!recv_requests.empty()) {
+    Block received_child_block = Block();
+    for (std::size_t received = 0; received < recv_requests.size();
+         ++received) {
+      int index = MPI_UNDEFINED;
+      MPI_Waitany(recv_requests.size(), recv_requests.data(), &index,
+                  MPI_STATUS_IGNORE);
+      RemoteChild const &remote_child = remote_children[index];
+      double const *buffer = recv_buffers[index].data();
+      Family &family = families[remote_child.family_];
+      if constexpr (local_indicator) {
+        family.remesh_list_[remote_child.position_] =
+            Multiresolution::LocalRemeshingDecision(
+                buffer[0], refinement_threshold_factor_);
+        continue;
+      }
+      for (Equation const eq : MF::EWA()) {
+        FieldValue *values =
+            &received_child_block.GetRightHandSideBuffer(eq)[0][0][0];
+        std::copy(buffer, buffer + values_per_equation, values);
+        buffer += values_per_equation;
+      }
+      family.remesh_list_[remote_child.position_] =
+          multiresolution_.ChildNeedsRemeshing<CC::NFWA()>(
+              tree_.GetNodeWithId(family.parent_id_)
+                  .GetPhaseByMaterial(
+                      topology_.SingleMaterialOfNode(remote_child.child_id_)),
+              received_child_block, remote_child.child_id_,
+              refinement_threshold_factor_);
+    }
+  }
+
+  // Now we have checked all siblings
+  for (auto &family : families) {
+#ifndef PERFORMANCE
+    if (family.remesh_list_.size() != family.children_.size()) {
+      throw std::logic_error("This must not happen");
+    }
 #endif
-      for (unsigned int i = 0; i < remesh_list.size(); ++i) {
-        if (remesh_list[i] == RemeshIdentifier::Refine) {
-          refine_list.emplace_back(children[i]);
-        }
+    for (unsigned int i = 0; i < family.remesh_list_.size(); ++i) {
+      // The levels of single-phase leaves are bounded by the refinement
+      // regions, all other children lock their family
+      nid_t const child_id = family.children_[i];
+      if (topology_.NodeIsLeaf(child_id) &&
+          !topology_.IsNodeMultiPhase(child_id)) {
+        family.remesh_list_[i] =
+            multiresolution_.GetRefinementRegions().BoundRemeshingDecision(
+                family.remesh_list_[i], child_id);
       }
-      // siblings may only be coarsened together. List can be empty if children
-      // do not exist.
-      if (!remesh_list.empty() && !topology_.IsNodeMultiPhase(parent_id) &&
-          std::all_of(remesh_list.begin(), remesh_list.end(),
-                      [](const RemeshIdentifier condition) {
-                        return condition == RemeshIdentifier::Coarse;
-                      })) {
-        remove_list.insert(remove_list.end(), children.begin(), children.end());
+      if (family.remesh_list_[i] == RemeshIdentifier::Refine) {
+        refine_list.emplace_back(child_id);
       }
-      remesh_list.clear();
-    } // parents
-  }   // level_of_parent
+    }
+    // siblings may only be coarsened together. List can be empty if children
+    // do not exist.
+    if (!topology_.IsNodeMultiPhase(family.parent_id_) &&
+        std::all_of(family.remesh_list_.begin(), family.remesh_list_.end(),
+                    [](const RemeshIdentifier condition) {
+                      return condition == RemeshIdentifier::Coarse;
+                    })) {
+      coarsen_list.push_back(family.parent_id_);
+    }
+  }
+
+  // send buffers need to be alive till this point
+  MPI_Waitall(send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE);
+}
+
+/**
+ * @brief Adds the change of the last time step to the cached details of the
+ * leaves on the updated levels. Entries of nodes that are no local single-phase
+ * leaves anymore are removed.
+ * @param updated_levels The levels which finished a time step.
+ * @note Must be called once per time step of the levels, before their blocks
+ * are swapped.
+ */
+void ModularAlgorithmAssembler::AccumulateChangesOfCachedDetails(
+    std::vector<unsigned int> const &updated_levels) {
+  int const my_rank = communicator_.MyRankId();
+  for (auto cached = cached_details_.begin();
+       cached != cached_details_.end();) {
+    nid_t const id = cached->first;
+    if (!topology_.NodeExists(id) || !topology_.NodeIsOnRank(id, my_rank) ||
+        !topology_.NodeIsLeaf(id) || topology_.IsNodeMultiPhase(id)) {
+      cached = cached_details_.erase(cached);
+      continue;
+    }
+    if (std::find(updated_levels.cbegin(), updated_levels.cend(),
+                  LevelOfNode(id)) != updated_levels.cend()) {
+      double const change = Multiresolution::RelativeChangeOfStep(
+          tree_.GetNodeWithId(id).GetSinglePhase());
+      double &relative_change = cached->second.relative_change_;
+      relative_change = (1.0 + relative_change) * (1.0 + change) - 1.0;
+    }
+    ++cached;
+  }
+}
+
+/**
+ * @brief Marks the halos of the given levels and of their parent levels as
+ * outdated, i.e. the conservatives of these levels are about to change. Parent
+ * levels change by the averaging and the jump flux adjustment.
+ * @param levels The levels whose conservatives change.
+ * @note The marks are global, as all ranks advance the same levels.
+ */
+void ModularAlgorithmAssembler::MarkHalosOutdated(
+    std::vector<unsigned int> const &levels) {
+  for (unsigned int const level : levels) {
+    outdated_halo_levels_[level] = true;
+    if (level > 0) {
+      outdated_halo_levels_[level - 1] = true;
+    }
+  }
+}
+
+/**
+ * @brief Marks the halos of all levels as outdated, e.g. after remeshing or
+ * migration.
+ */
+void ModularAlgorithmAssembler::MarkAllHalosOutdated() {
+  std::fill(outdated_halo_levels_.begin(), outdated_halo_levels_.end(), true);
+}
+
+/**
+ * @brief Gives the levels whose halos are outdated and resets their marks, i.e.
+ * the halos of these levels must be updated by the caller.
+ * @return The levels with outdated halos in ascending order.
+ */
+std::vector<unsigned int> ModularAlgorithmAssembler::TakeOutdatedHaloLevels() {
+  std::vector<unsigned int> levels;
+  for (unsigned int const level : all_levels_) {
+    if (outdated_halo_levels_[level]) {
+      levels.push_back(level);
+      outdated_halo_levels_[level] = false;
+    }
+  }
+  return levels;
 }
 
 /**
@@ -2537,8 +4723,15 @@ void ModularAlgorithmAssembler::DetermineRemeshingNodes(
  */
 void ModularAlgorithmAssembler::RefineNode(nid_t const id) {
   topology_.RefineNodeWithId(id);
-  std::vector<nid_t> const ids_of_children = tree_.RefineNode(id);
-  Node const &parent = tree_.GetNodeWithId(id);
+  std::array<nid_t, CC::NOC()> const ids_of_children = tree_.RefineNode(id);
+  Node &parent = tree_.GetNodeWithId(id);
+  // The statistics of the parent are released with the next topology update,
+  // hence they are prepared for the prediction in place
+  bool const with_statistics = parent.GetSinglePhase().HasStatisticsBuffers();
+  if (with_statistics) {
+    SO::ToRawMoments(parent.GetSinglePhase().GetStatisticsBuffers());
+    SO::ExtendIntoHalos(parent.GetSinglePhase().GetStatisticsBuffers());
+  }
   for (auto const &child_id : ids_of_children) {
     Node &child = tree_.GetNodeWithId(child_id);
     // only single material nodes are supposed to be refined, hence using the
@@ -2549,6 +4742,13 @@ void ModularAlgorithmAssembler::RefineNode(nid_t const id) {
           child.GetSinglePhase().GetRightHandSideBuffer(eq), child_id,
           CC::FICX(), CC::ICX(), CC::FICY(), CC::ICY(), CC::FICZ(), CC::ICZ());
     }
+    if (with_statistics) {
+      Block &child_block = child.GetSinglePhase();
+      child_block.AllocateStatisticsBuffers();
+      SO::Predict(parent.GetSinglePhase().GetStatisticsBuffers(),
+                  child_block.GetStatisticsBuffers(), child_id);
+      SO::ToCentralMoments(child_block.GetStatisticsBuffers());
+    }
     // add material
     topology_.AddMaterialToNode(child_id, parent.GetSinglePhaseMaterial());
   }
@@ -2589,38 +4789,290 @@ void ModularAlgorithmAssembler::LogNodeNumbers() const {
   if constexpr (GeneralTwoPhaseSettings::LogLevelsetLeafCount) {
     unsigned int global_levelset_leaves = tree_.NodesWithLevelset().size();
     MPI_Allreduce(MPI_IN_PLACE, &global_levelset_leaves, 1, MPI_UNSIGNED,
-                  MPI_SUM, MPI_COMM_WORLD);
+                  MPI_SUM, MpiUtilities::Communicator());
     logger_.LogMessage("Global number of levelset leaves  : " +
                        std::to_string(global_levelset_leaves));
   }
 }
 
 /**
- * @brief Logs performance measures related to the compute time.
- * @param loop_times Contains start and end times for loops.
+ * @brief Logs the quality of the current partition of the leaves onto the
+ * ranks. The surface of a rank is the number of faces of its leaves whose
+ * neighbor on the same or a coarser level resides on another rank, its volume
+ * the number of its leaves. Both the surface-to-volume ratio and the number of
+ * neighboring ranks are proportional to the halo communication a rank faces.
  */
-void ModularAlgorithmAssembler::LogPerformanceNumbers(
-    std::vector<double> const &loop_times) const {
+void ModularAlgorithmAssembler::LogPartitionQuality() const {
+  int const rank = MpiUtilities::MyRankId();
+  std::unordered_set<int> neighbor_ranks;
+  double cut_faces = 0.0;
+  for (nid_t const id : topology_.LocalLeafIds()) {
+    for (BoundaryLocation const location : CC::ANBS()) {
+      TopologyNeighbor const neighbor = topology_.NeighborOfNode(id, location);
+      if (!neighbor.is_external_ && neighbor.rank_ != rank) {
+        cut_faces += 1.0;
+        neighbor_ranks.insert(neighbor.rank_);
+      }
+    }
+  }
+  double const leaves = double(topology_.LocalLeafIds().size());
+  double const surface_to_volume = leaves > 0.0 ? cut_faces / leaves : 0.0;
+  // sums in the first, maxima in the second array
+  std::array<double, 3> sums = {cut_faces, leaves,
+                                double(neighbor_ranks.size())};
+  std::array<double, 2> maxima = {surface_to_volume,
+                                  double(neighbor_ranks.size())};
+  MPI_Allreduce(MPI_IN_PLACE, sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM,
+                MpiUtilities::Communicator());
+  MPI_Allreduce(MPI_IN_PLACE, maxima.data(), maxima.size(), MPI_DOUBLE, MPI_MAX,
+                MpiUtilities::Communicator());
+  double const number_of_ranks = double(MpiUtilities::NumberOfRanks());
+  logger_.LogMessage(
+      "Partition surface-to-volume (mean/max) : " +
+      StringOperations::ToScientificNotationString(
+          sums[1] > 0.0 ? sums[0] / sums[1] : 0.0, 3) +
+      " / " + StringOperations::ToScientificNotationString(maxima[0], 3));
+  logger_.LogMessage("Partition neighbor ranks (mean/max)    : " +
+                     StringOperations::ToScientificNotationString(
+                         sums[2] / number_of_ranks, 3) +
+                     " / " + std::to_string(static_cast<int>(maxima[1])));
+}
+
+/**
+ * @brief Counts the cell updates per macro time step of the current topology
+ * split by level, by rank ( maximum ) and into multi-phase leaves. Level l is
+ * advanced 2^l times per macro time step. The counts are only renewed once the
+ * topology or the materials changed, i.e. no loop over all leaves is needed in
+ * between remeshing and load balancing.
+ */
+void ModularAlgorithmAssembler::CountCellUpdates() {
+  if (cell_updates_.counted_ &&
+      cell_updates_.topology_update_count_ == topology_.TopologyUpdateCount() &&
+      cell_updates_.material_update_count_ == topology_.MaterialUpdateCount()) {
+    return;
+  }
+  double const cells_per_block = CC::ICX() * CC::ICY() * CC::ICZ();
+  std::vector<double> rank_updates(MpiUtilities::NumberOfRanks(), 0.0);
+  cell_updates_.per_level_.assign(all_levels_.back() + 1, 0.0);
+  cell_updates_.multi_phase_ = 0.0;
+  for (nid_t const id : topology_.LeafIds()) {
+    unsigned int const level = LevelOfNode(id);
+    double const updates = cells_per_block * double(1 << level);
+    cell_updates_.per_level_[level] += updates;
+    rank_updates[topology_.GetRankOfNode(id)] += updates;
+    if (topology_.IsNodeMultiPhase(id)) {
+      cell_updates_.multi_phase_ += updates;
+    }
+  }
+  cell_updates_.total_ = std::accumulate(cell_updates_.per_level_.begin(),
+                                         cell_updates_.per_level_.end(), 0.0);
+  cell_updates_.maximum_rank_ =
+      *std::max_element(rank_updates.begin(), rank_updates.end());
+  cell_updates_.topology_update_count_ = topology_.TopologyUpdateCount();
+  cell_updates_.material_update_count_ = topology_.MaterialUpdateCount();
+  cell_updates_.counted_ = true;
+}
+
+/**
+ * @brief Completes the bookkeeping of the last macro time step. Waits for the
+ * non-blocking reduction of the step times, takes the time of the slowest rank
+ * as time of the step and adds it to the performance window ( see
+ * DP::PerformanceWindow() ) and the run status.
+ */
+void ModularAlgorithmAssembler::RecordMacroStep() {
+  MPI_Wait(&step_time_request_, MPI_STATUS_IGNORE);
+  loop_times_.back() = reduced_step_times_[0];
+  CountCellUpdates();
+  performance_window_.emplace_back(loop_times_.back(), cell_updates_.total_);
+  if (performance_window_.size() > DP::PerformanceWindow()) {
+    performance_window_.pop_front();
+  }
   auto &&[number_of_nodes, number_of_leaves] = topology_.NodeAndLeafCount();
+  run_status_.number_of_nodes_ = number_of_nodes;
+  run_status_.number_of_leaves_ = number_of_leaves;
+  run_status_.rank_imbalance_ = cell_updates_.maximum_rank_ *
+                                double(MpiUtilities::NumberOfRanks()) /
+                                cell_updates_.total_;
+}
+
+/**
+ * @brief Logs performance measures related to the compute time of the last
+ * macro time step. Besides the wall clock time, the throughput in cell updates
+ * per second is given split by level and by single- and multi-phase leaves.
+ * The imbalance of the work is the ratio of the maximum and the mean cell
+ * updates of all ranks, the one of the time the ratio of the longest and the
+ * shortest step time of all ranks. Time and throughput are also averaged over
+ * the last macro time steps ( see DP::PerformanceWindow() ).
+ * @note Requires RecordMacroStep() to be called for the last macro time step.
+ */
+void ModularAlgorithmAssembler::LogPerformanceNumbers() const {
+  double const number_of_leaves = run_status_.number_of_leaves_;
+  double const cells_per_block = CC::ICX() * CC::ICY() * CC::ICZ();
+  double const macro_step_time = loop_times_.back();
+
+  double window_time = 0.0;
+  double window_updates = 0.0;
+  for (auto const &[time, updates] : performance_window_) {
+    window_time += time;
+    window_updates += updates;
+  }
+
+  // Labels are aligned with the ones of the wall clock times
+  auto const label = [](std::string const &text) {
+    return text +
+           StringOperations::Indent(text.size() < 30 ? 30 - text.size() : 0) +
+           ": ";
+  };
+  auto const throughput = [macro_step_time](double const updates) {
+    return StringOperations::ToScientificNotationString(
+        updates / macro_step_time, 5);
+  };
   logger_.LogMessage(
       "Wall clock time for macro step: " +
-      StringOperations::ToScientificNotationString(loop_times.back(), 5));
-  logger_.LogMessage("Wall clock time per cell      : " +
+      StringOperations::ToScientificNotationString(macro_step_time, 5));
+  logger_.LogMessage(
+      "Wall clock time per cell      : " +
+      StringOperations::ToScientificNotationString(
+          macro_step_time / (number_of_leaves * cells_per_block), 5));
+  logger_.LogMessage("Number of cells               : " +
                      StringOperations::ToScientificNotationString(
-                         loop_times.back() / (number_of_leaves * CC::ICX() *
-                                              CC::ICY() * CC::ICZ()),
-                         5));
+                         number_of_leaves * cells_per_block, 5));
+  logger_.LogMessage("Cell updates per second       : " +
+                     throughput(cell_updates_.total_));
+  for (unsigned int level = 0; level < cell_updates_.per_level_.size();
+       ++level) {
+    if (cell_updates_.per_level_[level] > 0.0) {
+      logger_.LogMessage(label("  on level " + std::to_string(level)) +
+                         throughput(cell_updates_.per_level_[level]));
+    }
+  }
+  logger_.LogMessage(
+      "  in single-phase leaves      : " +
+      throughput(cell_updates_.total_ - cell_updates_.multi_phase_));
+  logger_.LogMessage("  in multi-phase leaves       : " +
+                     throughput(cell_updates_.multi_phase_));
+  logger_.LogMessage("Rank imbalance ( max/mean )   : " +
+                     StringOperations::ToScientificNotationString(
+                         run_status_.rank_imbalance_, 5));
   logger_.LogMessage(
-      "Number of cells               : " +
+      "Rank step times ( min/max )   : " +
+      StringOperations::ToScientificNotationString(-reduced_step_times_[1], 5) +
+      " / " +
+      StringOperations::ToScientificNotationString(reduced_step_times_[0], 5));
+  logger_.LogMessage(
+      label("Mean over last " + std::to_string(performance_window_.size()) +
+            " macro steps") +
       StringOperations::ToScientificNotationString(
-          number_of_leaves * CC::ICX() * CC::ICY() * CC::ICZ(), 5));
+          window_time / double(performance_window_.size()), 5) +
+      " s, " +
+      StringOperations::ToScientificNotationString(window_updates / window_time,
+                                                   5) +
+      " cell updates/s");
+}
+
+/**
+ * @brief Decides whether the run has to stop to write a final restart snapshot
+ * in time. The duration of the next macro timestep is predicted by the longest
+ * one of the last macro timesteps ( see DP::PerformanceWindow() ), the
+ * duration of the final write by the longest restart ( or initial output )
+ * write so far. Both are scaled by RestartOutputSettings::WalltimeSafetyFactor.
+ * Collective call.
+ * @return True if the walltime limit would be exceeded otherwise or a stop
+ * signal was received on any rank, false otherwise.
+ */
+bool ModularAlgorithmAssembler::WalltimeStopRequired() const {
+  bool stop = StopSignal::Received();
+  if (walltime_limit_ > 0.0 && !performance_window_.empty()) {
+    double next_step_time = 0.0;
+    for (auto const &window_entry : performance_window_) {
+      next_step_time = std::max(next_step_time, window_entry.first);
+    }
+    double const elapsed = MPI_Wtime() - walltime_start_;
+    stop = stop || elapsed + RestartOutputSettings::WalltimeSafetyFactor *
+                                 (next_step_time + restart_write_time_) >
+                       walltime_limit_;
+  }
+  return MpiUtilities::GloballyReducedBool(stop);
+}
+
+/**
+ * @brief Updates the status of the run and writes it to the status file. The
+ * rate of macro time steps is taken from the last macro time steps ( see
+ * DP::PerformanceWindow() ) and the remaining wall clock time is projected
+ * assuming the current time step size.
+ * @param simulation_time The current simulation time.
+ * @param timestep_size The size of the last macro time step.
+ * @param macro_steps The number of macro time steps of this run.
+ * @param elapsed_seconds The wall clock time of this run so far.
+ * @note Node and leaf counts and the rank imbalance are updated in
+ * LogPerformanceNumbers().
+ */
+void ModularAlgorithmAssembler::WriteRunStatus(double const simulation_time,
+                                               double const timestep_size,
+                                               unsigned int const macro_steps,
+                                               double const elapsed_seconds) {
+  double window_time = 0.0;
+  for (auto const &window_entry : performance_window_) {
+    window_time += window_entry.first;
+  }
+  double const macro_step_seconds =
+      window_time / double(performance_window_.size());
+
+  run_status_.simulation_time_ =
+      unit_handler_.DimensionalizeValue(simulation_time, UnitType::Time);
+  run_status_.end_time_ =
+      unit_handler_.DimensionalizeValue(end_time_, UnitType::Time);
+  run_status_.timestep_size_ =
+      unit_handler_.DimensionalizeValue(timestep_size, UnitType::Time);
+  run_status_.macro_steps_ = macro_steps;
+  run_status_.macro_steps_per_hour_ = 3600.0 / macro_step_seconds;
+  run_status_.elapsed_seconds_ = elapsed_seconds;
+  // Division by a vanishing time step size gives infinity, i.e. no projection
+  run_status_.remaining_seconds_ =
+      simulation_time < end_time_
+          ? (end_time_ - simulation_time) / timestep_size * macro_step_seconds
+          : 0.0;
+  run_status_.updated_ = std::time(nullptr);
+  input_output_.WriteRunStatus(run_status_);
+}
+
+/**
+ * @brief Logs the summary of the runtime profiler, i.e. the minimum, mean and
+ * maximum time of all ranks spent in each region.
+ * @note Collective call, hence, it must be called on all ranks.
+ */
+void ModularAlgorithmAssembler::LogProfilingSummary() const {
+  if (!profiler_.IsEnabled()) {
+    return;
+  }
+  for (std::string const &line : profiler_.Summary()) {
+    logger_.LogMessage(line);
+  }
 }
 
-void ModularAlgorithmAssembler::LogElapsedTimeSinceInProfileRuns(
-    double const start_time, std::string const function_name) {
-  if (DP::Profile()) {
-    logger_.LogMessage(
-        function_name + " - elapsed time: " +
-        StringOperations::ToScientificNotationString(MPI_Wtime() - start_time));
+/**
+ * @brief Sets the persistent memory of the categories estimated from the
+ * current tree, topology and communication caches.
+ */
+void ModularAlgorithmAssembler::UpdateMemoryStatistics() const {
+  MemoryStatistics::SetCurrent(MemoryCategory::Blocks, tree_.BlockBytes());
+  MemoryStatistics::SetCurrent(MemoryCategory::InterfaceBlocks,
+                               tree_.InterfaceBlockBytes());
+  MemoryStatistics::SetCurrent(MemoryCategory::Topology,
+                               topology_.ForestBytes());
+  MemoryStatistics::SetCurrent(MemoryCategory::Communication,
+                               communicator_.CacheBytes());
+}
+
+/**
+ * @brief Logs the memory held by the ranks in each category together with the
+ * high-water marks. The persistent memory is estimated from the current tree,
+ * topology and communication caches.
+ * @note Collective call, hence, it must be called on all ranks.
+ */
+void ModularAlgorithmAssembler::LogMemoryReport() const {
+  UpdateMemoryStatistics();
+  for (std::string const &line : MemoryReport()) {
+    logger_.LogMessage(line);
   }
 }
@@ -22,10 +22,16 @@
 #ifndef MODULAR_ALGORITHM_ASSEMBLER_H
 #define MODULAR_ALGORITHM_ASSEMBLER_H
 
+#include <array>
+#include <deque>
+#include <unordered_map>
+#include <utility>
+
 #include "communication/communication_manager.h"
 #include "halo_manager.h"
 #include "initial_condition/initial_condition.h"
 #include "input_output/input_output_manager.h"
+#include "input_output/restart_manager/in_memory_checkpoint.h"
 #include "integrator/time_integrator_setup.h"
 #include "levelset/multi_phase_manager/multi_phase_manager_setup.h"
 #include "multiresolution/averager.h"
@@ -33,6 +39,9 @@
 #include "parameter/parameter_manager.h"
 #include "prime_states/prime_state_handler.h"
 #include "solvers/space_solver.h"
+#include "utilities/phase_timer.h"
+#include "utilities/runtime_profiler.h"
+#include "utilities/task_graph.h"
 
 using TimeIntegratorConcretization =
     TimeIntegratorSetup::Concretize<time_integrator>::type;
@@ -55,6 +64,8 @@ class ModularAlgorithmAssembler {
   double const start_time_;
   double const end_time_;
   double const cfl_number_;
+  // maximum number of macro time steps of this run (0: only the end time)
+  unsigned int const maximum_macro_steps_;
 
   double const cell_size_on_maximum_level_;
   // source term variables (time computation)
@@ -84,11 +95,128 @@ class ModularAlgorithmAssembler {
 
   ParameterManager const parameter_manager_;
 
-  SpaceSolver const space_solver_;
+  SpaceSolver space_solver_;
 
   LogWriter &logger_;
+  RuntimeProfiler &profiler_;
+  // macro time steps between two intermediate profiling summaries (0: only at
+  // the end of the run)
+  unsigned int const profiling_interval_;
+  // whether the full output is written before the first time step
+  bool const initial_output_;
+  // wall clock times and cell updates of the last macro time steps ( see
+  // DP::PerformanceWindow() )
+  std::deque<std::pair<double, double>> performance_window_;
+  // cell updates per macro time step of the current topology ( see
+  // CountCellUpdates() )
+  struct CellUpdates {
+    std::vector<double> per_level_;
+    double total_ = 0.0;
+    double maximum_rank_ = 0.0;
+    double multi_phase_ = 0.0;
+    unsigned int topology_update_count_ = 0;
+    unsigned int material_update_count_ = 0;
+    bool counted_ = false;
+  };
+  CellUpdates cell_updates_;
+  // step time of this rank and its non-blocking reduction to the longest and
+  // ( negated ) shortest step time of all ranks
+  std::array<double, 2> local_step_times_ = {0.0, 0.0};
+  std::array<double, 2> reduced_step_times_ = {0.0, 0.0};
+  MPI_Request step_time_request_ = MPI_REQUEST_NULL;
+  // progress of the run written to the status file
+  RunStatus run_status_;
+  // details of the last wavelet analysis of local leaves ( see CC::CWD() )
+  std::unordered_map<nid_t, CachedDetail> cached_details_;
+  // local nodes whose interface tags change along with the multi-phase nodes
+  // of the current topology ( see CollectRetaggedNodes() )
+  struct RetaggedNodes {
+    // per level, the nodes whose tags change
+    std::vector<std::vector<nid_t>> retagged_;
+    // per level, the nodes whose tags or tag halos change
+    std::vector<std::vector<nid_t>> updated_;
+    // sorted ids of the nodes whose tags and tag halos do not change
+    std::vector<nid_t> frozen_;
+    unsigned int topology_update_count_ = 0;
+    unsigned int material_update_count_ = 0;
+    bool collected_ = false;
+  };
+  RetaggedNodes retagged_nodes_;
+  // number of consecutive checks the interface stayed away from multi-phase
+  // nodes of all ranks ( see CC::InterfaceRemovalDelay() )
+  std::unordered_map<nid_t, unsigned int> vanished_interface_checks_;
+  // local nodes holding jump buffers on each level, whose buffers are reset
+  // ( see CollectJumpBufferNodes() )
+  std::vector<std::vector<std::reference_wrapper<Node>>> jump_buffer_nodes_;
+  // state and task graph of the halo update overlapped with the right-hand
+  // side, reused between the stages to keep their buffers ( see
+  // HaloUpdateOverlappedWithRightHandSide() )
+  PendingMaterialHaloUpdate overlapped_halo_update_;
+  TaskGraph stage_transition_graph_;
+  // leaves whose internal prime states were recovered together with their
+  // integration in the current stage, sorted ( see Integrate() )
+  std::vector<Node const *> recovered_leaves_;
+  // time steps of each level since the last wavelet analysis of its children (
+  // see CC::RemeshInterval() )
+  std::vector<unsigned int> steps_since_analysis_;
+  // levels whose conservatives changed since their last halo update at the
+  // begin of a stage ( see MarkHalosOutdated() )
+  std::vector<bool> outdated_halo_levels_;
+  // state of the compute loop, kept between calls to advance step-wise
+  double stop_time_;
+  bool timestep_size_is_healthy_ = true;
+  std::vector<double> loop_times_;
+  std::vector<double> output_runtimes_;
+  double run_start_time_ = 0.0;
+  double status_time_ = 0.0;
+  // state of the last in-memory checkpoint ( see
+  // RestartOutputSettings::InMemoryCheckpointInterval )
+  InMemoryCheckpoint checkpoint_;
+  // set if the user aborted the current macro timestep
+  bool abort_requested_ = false;
+  // wall clock time limit of the run ( 0: unlimited ), the wall clock time the
+  // run started at, the longest restart or initial output write so far and
+  // whether the run stopped before the limit or on a stop signal
+  double const walltime_limit_;
+  double walltime_start_ = 0.0;
+  double restart_write_time_ = 0.0;
+  bool walltime_stop_ = false;
+  // reduction of the CFL number after rollbacks, the macro timesteps it
+  // persists and the rollbacks since the last checkpoint
+  double cfl_factor_ = 1.0;
+  unsigned int reduced_cfl_steps_ = 0;
+  unsigned int rollback_retries_ = 0;
+  // memory budget of each rank in bytes ( 0: unlimited ), the factor the
+  // thresholds of the single-phase refinement are raised by, whether this
+  // refinement is refused and whether the next load balancing is forced as the
+  // budget got exhausted further
+  double const memory_budget_;
+  double refinement_threshold_factor_ = 1.0;
+  bool refinement_refused_ = false;
+  bool memory_rebalance_required_ = false;
+  // grid sequencing: maximum level of the single-phase refinement, the times
+  // it is raised by one at, the next of these times, the relative change of
+  // the kinetic energy per macro timestep below which it is raised by one as
+  // well ( 0: inactive ) and the kinetic energy of the last macro timestep
+  // ( negative: unknown )
+  unsigned int refinement_level_limit_;
+  std::vector<double> const grid_sequencing_stamps_;
+  std::size_t next_grid_sequencing_stamp_ = 0;
+  double const grid_sequencing_tolerance_;
+  double last_kinetic_energy_ = -1.0;
+
+  // Initial materials, interface tags and interface block of a node, evaluated
+  // before the node is created
+  struct InitialNodeData {
+    std::vector<MaterialName> materials_;
+    std::int8_t interface_tags_[CC::TCX()][CC::TCY()][CC::TCZ()];
+    std::unique_ptr<InterfaceBlock> interface_block_;
+  };
 
   void CreateNewSimulation(InitialCondition &initial_condition);
+  void EvaluateInitialNode(nid_t const node_id,
+                           InitialCondition &initial_condition,
+                           InitialNodeData &data) const;
   void FinalizeSimulationRestart(double const restart_time);
 
   void Advance();
@@ -96,11 +224,16 @@ class ModularAlgorithmAssembler {
                                bool const plot_this_step,
                                bool const print_this_step,
                                double &debug_key) const;
-  void LogElapsedTimeSinceInProfileRuns(double const start_time,
-                                        std::string const message);
 
   void ComputeRightHandSide(std::vector<unsigned int> const levels,
                             unsigned int const stage);
+  void ComputeRightHandSideOfNode(Node &node, unsigned int const stage,
+                                  bool const fill_initial_buffer = true,
+                                  SiblingFaceFluxes *sibling_fluxes = nullptr,
+                                  unsigned int const sibling_position = 0);
+  void HaloUpdateOverlappedWithRightHandSide(
+      std::vector<unsigned int> const &levels_ascending,
+      unsigned int const next_stage);
   void ComputeLevelsetRightHandSide(
       std::vector<std::reference_wrapper<Node>> const &nodes,
       unsigned int const stage);
@@ -108,12 +241,15 @@ class ModularAlgorithmAssembler {
                    unsigned int const stage) const;
   void Integrate(std::vector<unsigned int> const updated_levels,
                  unsigned int const stage);
+  bool IsStaticSolidNode(Node const &node) const;
   void IntegrateLevelset(std::vector<std::reference_wrapper<Node>> const &nodes,
                          unsigned int const stage);
   void JumpFluxAdjustment(
       std::vector<unsigned int> const finished_levels_descending) const;
 
-  double ComputeTimestepSize() const;
+  double ComputeLocalTimestepSize() const;
+  double ComputeLocalParabolicTimestepSize() const;
+  void SuperTimeStep();
 
   void ResetAllJumpBuffers() const;
   void
@@ -125,22 +261,54 @@ class ModularAlgorithmAssembler {
   void ImposeInitialCondition(unsigned int const level,
                               InitialCondition &initial_condition);
 
-  void UpdateInterfaceTags(std::vector<unsigned int> const
-                               levels_with_updated_parents_descending) const;
+  void UpdateInterfaceTags(
+      std::vector<unsigned int> const levels_with_updated_parents_descending,
+      bool const only_multi_phase_nodes_retagged = false);
+  void CollectRetaggedNodes();
   void
   SenseApproachingInterface(std::vector<unsigned int> const levels_ascending,
                             bool refine_if_necessary = true);
   void
   SenseVanishedInterface(std::vector<unsigned int> const levels_descending);
-
-  void Remesh(std::vector<unsigned int> const levels_to_update_ascending);
+  std::vector<nid_t>
+  NodesWithSettledInterface(unsigned int const level,
+                            std::vector<nid_t> const &vanished_ids);
+
+  bool Remesh(std::vector<unsigned int> const levels_to_update_ascending);
+  void UpdateMemoryBudgetState();
+  void UpdateGridSequencing(double const time);
+  double TotalKineticEnergy() const;
+  std::vector<nid_t> NeighborsWithinBand(nid_t const id,
+                                         unsigned int const band) const;
   void DetermineRemeshingNodes(std::vector<unsigned int> const parent_levels,
-                               std::vector<nid_t> &remove_list,
-                               std::vector<nid_t> &refine_list) const;
+                               std::vector<nid_t> &coarsen_list,
+                               std::vector<nid_t> &refine_list);
+  void AccumulateChangesOfCachedDetails(
+      std::vector<unsigned int> const &updated_levels);
 
   void RefineNode(nid_t const node_id);
 
   void UpdateTopology();
+  void MarkHalosOutdated(std::vector<unsigned int> const &levels);
+  void MarkAllHalosOutdated();
+  std::vector<unsigned int> TakeOutdatedHaloLevels();
+  bool JumpBuffersNeeded(nid_t const id) const;
+  void UpdateJumpBuffers();
+  void CollectJumpBufferNodes();
+  bool IntegrationBuffersNeeded(nid_t const id) const;
+  void UpdateIntegrationBuffers();
+  bool StatisticsBuffersNeeded(nid_t const id) const;
+  void UpdateStatisticsBuffers();
+  void SampleStatistics();
+  void PlaceLeavesOnNumaDomains();
+  MPI_Datatype MigrationDatatype(nid_t const id, Node const &node,
+                                 bool const node_not_updated,
+                                 bool const with_jump_buffers) const;
+  Node &CreateMigratedNode(nid_t const id);
+
+  void TakeInMemoryCheckpoint();
+  void RollBackToInMemoryCheckpoint();
+  bool NonPhysicalStatesExist() const;
 
   std::vector<unsigned int> GetLevels(unsigned int const timestep) const;
 
@@ -161,7 +329,17 @@ class ModularAlgorithmAssembler {
                             &nodes_needing_multiphase_treatment) const;
 
   void LogNodeNumbers() const;
-  void LogPerformanceNumbers(std::vector<double> const &loop_times) const;
+  void CountCellUpdates();
+  void RecordMacroStep();
+  void LogPerformanceNumbers() const;
+  void LogProfilingSummary() const;
+  void UpdateMemoryStatistics() const;
+  void LogMemoryReport() const;
+  void LogPartitionQuality() const;
+  bool WalltimeStopRequired() const;
+  void WriteRunStatus(double const simulation_time, double const timestep_size,
+                      unsigned int const macro_steps,
+                      double const elapsed_seconds);
 
   std::vector<double> GenerateAllLevels() const;
 
@@ -169,13 +347,19 @@ public:
   ModularAlgorithmAssembler() = delete;
   explicit ModularAlgorithmAssembler(
       double const start_time, double const end_time, double const cfl_number,
-      std::array<double, 3> const gravity, std::vector<unsigned int> all_levels,
+      unsigned int const maximum_macro_steps, double const walltime_limit,
+      double const memory_budget, unsigned int const grid_sequencing_level,
+      std::vector<double> const grid_sequencing_stamps,
+      double const grid_sequencing_tolerance,
+      std::array<double, 3> const gravity,
+      ReconstructionStencils const convective_stencil,
+      std::vector<unsigned int> all_levels,
       double const cell_size_on_maximum_level, UnitHandler const &unit_handler,
       Tree &tree, TopologyManager &topology, HaloManager &halo_manager,
       CommunicationManager &communication,
       Multiresolution const &multiresolution,
-      MaterialManager const &material_manager,
-      InputOutputManager &input_output);
+      MaterialManager const &material_manager, InputOutputManager &input_output,
+      unsigned int const profiling_interval, bool const initial_output = true);
   ~ModularAlgorithmAssembler() = default;
   ModularAlgorithmAssembler(ModularAlgorithmAssembler const &) = delete;
   ModularAlgorithmAssembler &
@@ -184,8 +368,14 @@ public:
   ModularAlgorithmAssembler &operator=(ModularAlgorithmAssembler &&) = delete;
 
   void ComputeLoop();
-
-  void Initialization(InitialCondition &initial_condition);
+  unsigned int ComputeMacroTimesteps(double const stop_time,
+                                     unsigned int const number_of_timesteps);
+  void FinishComputeLoop();
+  double CurrentTime() const;
+  bool IsFinished() const;
+
+  void Initialization(InitialCondition &initial_condition,
+                      PhaseTimer &startup_timer);
 };
 
 #endif // MODULAR_ALGORITHM_ASSEMBLER_H
@@ -25,6 +25,11 @@
 #include "multiresolution/multiresolution.h"
 #include "topology/id_information.h"
 #include "user_specifications/debug_and_profile_setup.h"
+#include "utilities/statistics_operations.h"
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
 
 namespace {
 /**
@@ -55,78 +60,146 @@ Averager::Averager(TopologyManager const &topology,
 
 /**
  * @brief Fill parents of nodes on the given level via conservative average
- * operations.
+ * operations. Only the local children and the children of local parents are
+ * visited. All averaged values exchanged with a partner rank on a level are
+ * packed into a single message. The received messages are unpacked in the
+ * order of their arrival while the coarser levels only wait for the messages
+ * they depend on, outgoing messages are completed at the very end.
  * @param child_levels_descending The levels of the children holding the data to
  * be averaged.
  */
 void Averager::AverageMaterial(
     std::vector<unsigned int> const &child_levels_descending) const {
 
+  CommunicationCategoryScope const category(CommunicationCategory::Average);
+  int const my_rank = communicator_.MyRankId();
+  // Gives the size of the packed averages of the given children
+  auto const packed_size = [this](std::vector<nid_t> const &child_ids) {
+    int size = 0;
+    for (nid_t const child_id : child_ids) {
+      int child_size = 0;
+      MPI_Pack_size(
+          MF::ANOE(),
+          communicator_.AveragingSendDatatype(
+              PositionOfNodeAmongSiblings(child_id), DatatypeOf<FieldValue>()),
+          MpiUtilities::Communicator(), &child_size);
+      size += child_size * topology_.GetMaterialsOfNode(child_id).size();
+    }
+    return size;
+  };
+
+  // The send buffers are kept until all levels are done
+  std::vector<std::vector<char>> send_buffers;
+  std::vector<MPI_Request> send_requests;
+  std::unique_ptr<Conservatives> const averaged =
+      std::make_unique<Conservatives>();
+
   for (unsigned int const child_level :
        DescendingVectorWithoutZero(child_levels_descending)) {
 
-    std::vector<std::tuple<nid_t, int, int>>
-        child_parent_rank_relations; // id, rank-child, rank-parent
     std::vector<nid_t> no_mpi_list;
-    unsigned int send_counter = 0;
-
-    // sort by mpi necessary or not
-    for (nid_t const child_id : topology_.IdsOnLevel(child_level)) {
-      nid_t const parent_id = ParentIdOfNode(child_id);
-      int const rank_of_child = topology_.GetRankOfNode(child_id);
-      int const rank_of_parent = topology_.GetRankOfNode(parent_id);
-
-      if (rank_of_child == communicator_.MyRankId() &&
-          rank_of_parent == communicator_.MyRankId()) {
+    // children whose averages are sent to or received from a partner rank
+    std::map<int, std::vector<nid_t>> send_children_of_rank;
+    std::map<int, std::vector<nid_t>> recv_children_of_rank;
+
+    for (nid_t const child_id : topology_.LocalIdsOnLevel(child_level)) {
+      int const rank_of_parent =
+          topology_.GetRankOfNode(ParentIdOfNode(child_id));
+      if (rank_of_parent == my_rank) {
         no_mpi_list.push_back(child_id);
-      } else if (rank_of_child == communicator_.MyRankId() ||
-                 rank_of_parent == communicator_.MyRankId()) {
-        child_parent_rank_relations.push_back(
-            std::make_tuple(child_id, rank_of_child, rank_of_parent));
-        if (rank_of_child == communicator_.MyRankId()) {
-          send_counter += topology_.GetMaterialsOfNode(child_id)
-                              .size(); // needed for buffer size
+      } else {
+        send_children_of_rank[rank_of_parent].push_back(child_id);
+      }
+    }
+    for (nid_t const parent_id : topology_.LocalIdsOnLevel(child_level - 1)) {
+      if (topology_.NodeIsLeaf(parent_id)) {
+        continue;
+      }
+      for (nid_t const child_id : IdsOfChildren(parent_id)) {
+        if (int const rank_of_child = topology_.GetRankOfNode(child_id);
+            rank_of_child != my_rank) {
+          recv_children_of_rank[rank_of_child].push_back(child_id);
         }
       }
     }
 
-    std::vector<Conservatives> send_buffer_parent(send_counter);
-    send_counter = 0; // is reused
-    std::vector<MPI_Request> requests;
-
-    for (auto const &[child_id, rank_of_child, rank_of_parent] :
-         child_parent_rank_relations) {
-      if (rank_of_child == communicator_.MyRankId() &&
-          rank_of_parent != communicator_.MyRankId()) {
+    // Both partners pack and unpack the children in the order of their ids
+    for (auto &[rank, child_ids] : send_children_of_rank) {
+      std::sort(std::begin(child_ids), std::end(child_ids));
+      std::vector<char> &buffer =
+          send_buffers.emplace_back(packed_size(child_ids));
+      int position = 0;
+      for (nid_t const child_id : child_ids) {
         Node const &child = tree_.GetNodeWithId(child_id);
-        unsigned int const pos = PositionOfNodeAmongSiblings(child_id);
+        MPI_Datatype const datatype = communicator_.AveragingSendDatatype(
+            PositionOfNodeAmongSiblings(child_id), DatatypeOf<FieldValue>());
         for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
           Multiresolution::Average(
               child.GetPhaseByMaterial(material).GetRightHandSideBuffer(),
-              send_buffer_parent.at(send_counter), child_id);
-          communicator_.Send(
-              &send_buffer_parent.at(send_counter), MF::ANOE(),
-              communicator_.AveragingSendDatatype(pos, DatatypeForMpi::Double),
-              rank_of_parent, requests);
-          send_counter++;
-          if constexpr (DP::Profile()) {
-            CommunicationStatistics::average_level_send_++;
-          }
+              *averaged, child_id);
+          MPI_Pack(averaged.get(), MF::ANOE(), datatype, buffer.data(),
+                   buffer.size(), &position, MpiUtilities::Communicator());
         }
-      } else if (rank_of_child != communicator_.MyRankId() &&
-                 rank_of_parent == communicator_.MyRankId()) {
-        nid_t const parent_id = ParentIdOfNode(child_id);
-        Node &parent = tree_.GetNodeWithId(parent_id);
-        unsigned int const pos = PositionOfNodeAmongSiblings(child_id);
-        for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
-          communicator_.Recv(
-              &parent.GetPhaseByMaterial(material).GetRightHandSideBuffer(),
-              MF::ANOE(),
-              communicator_.AveragingSendDatatype(pos, DatatypeForMpi::Double),
-              rank_of_child, requests);
-          if constexpr (DP::Profile()) {
-            CommunicationStatistics::average_level_recv_++;
-          }
+      }
+    }
+    std::vector<std::vector<char>> recv_buffers;
+    std::vector<std::vector<nid_t> const *> recv_children;
+    for (auto &[rank, child_ids] : recv_children_of_rank) {
+      std::sort(std::begin(child_ids), std::end(child_ids));
+      recv_buffers.emplace_back(packed_size(child_ids));
+      recv_children.push_back(&child_ids);
+    }
+
+    // Messages between two ranks are posted in the same order on both sides,
+    // lower to higher rank first, to obtain matching tags
+    std::vector<MPI_Request> recv_requests;
+    auto send = send_buffers.end() - send_children_of_rank.size();
+    auto recv = recv_buffers.begin();
+    auto send_rank = send_children_of_rank.cbegin();
+    auto recv_rank = recv_children_of_rank.cbegin();
+    auto const post_send = [&]() {
+      communicator_.Send(send->data(), send->size(), MPI_PACKED,
+                         send_rank->first, send_requests);
+      send++;
+      send_rank++;
+      if constexpr (DP::Profile()) {
+        CommunicationStatistics::Instance().average_level_send_++;
+      }
+    };
+    auto const post_recv = [&]() {
+      communicator_.Recv(recv->data(), recv->size(), MPI_PACKED,
+                         recv_rank->first, recv_requests);
+      recv++;
+      recv_rank++;
+      if constexpr (DP::Profile()) {
+        CommunicationStatistics::Instance().average_level_recv_++;
+      }
+    };
+    while (send_rank != send_children_of_rank.cend() ||
+           recv_rank != recv_children_of_rank.cend()) {
+      int const rank = std::min(send_rank != send_children_of_rank.cend()
+                                    ? send_rank->first
+                                    : std::numeric_limits<int>::max(),
+                                recv_rank != recv_children_of_rank.cend()
+                                    ? recv_rank->first
+                                    : std::numeric_limits<int>::max());
+      bool const sends_to_rank =
+          send_rank != send_children_of_rank.cend() && send_rank->first == rank;
+      bool const receives_from_rank =
+          recv_rank != recv_children_of_rank.cend() && recv_rank->first == rank;
+      if (rank > my_rank) {
+        if (sends_to_rank) {
+          post_send();
+        }
+        if (receives_from_rank) {
+          post_recv();
+        }
+      } else {
+        if (receives_from_rank) {
+          post_recv();
+        }
+        if (sends_to_rank) {
+          post_send();
         }
       }
     }
@@ -143,9 +216,27 @@ void Averager::AverageMaterial(
       }
     }
 
-    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
-    requests.clear();
+    // Parents are filled as soon as the message holding their children arrives
+    for (std::size_t received = 0; received < recv_requests.size();
+         ++received) {
+      int const index = communicator_.WaitAny(recv_requests);
+      std::vector<char> const &buffer = recv_buffers[index];
+      int position = 0;
+      for (nid_t const child_id : *recv_children[index]) {
+        Node &parent = tree_.GetNodeWithId(ParentIdOfNode(child_id));
+        MPI_Datatype const datatype = communicator_.AveragingSendDatatype(
+            PositionOfNodeAmongSiblings(child_id), DatatypeOf<FieldValue>());
+        for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
+          MPI_Unpack(
+              buffer.data(), buffer.size(), &position,
+              &parent.GetPhaseByMaterial(material).GetRightHandSideBuffer(),
+              MF::ANOE(), datatype, MpiUtilities::Communicator());
+        }
+      }
+    }
   } // child_level
+
+  communicator_.WaitAll(send_requests);
 }
 
 /**
@@ -157,6 +248,7 @@ void Averager::AverageInterfaceTags(
     std::vector<unsigned int> const &levels_with_updated_parents_descending)
     const {
 
+  CommunicationCategoryScope const category(CommunicationCategory::Average);
   for (unsigned int const child_level :
        DescendingVectorWithoutZero(levels_with_updated_parents_descending)) {
     std::vector<std::tuple<nid_t, int, int>>
@@ -277,7 +369,7 @@ void Averager::AverageInterfaceTags(
       }
     }
 
-    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    communicator_.WaitAll(requests);
     requests.clear();
   }
 }
@@ -290,6 +382,7 @@ void Averager::AverageInterfaceTags(
  */
 void Averager::AverageParameters(
     std::vector<unsigned int> const child_levels_descending) const {
+  CommunicationCategoryScope const category(CommunicationCategory::Average);
   for (unsigned int child_level : child_levels_descending) {
     // if level 0 should be reached, break the loop as there is no parent level
     // available
@@ -344,14 +437,14 @@ void Averager::AverageParameters(
           Multiresolution::Average(
               child.GetPhaseByMaterial(material).GetParameterBuffer(),
               send_buffer_parent.at(sendcounter), child_id);
-          communicator_.Send(
-              &send_buffer_parent.at(sendcounter), MF::ANOPA(),
-              communicator_.AveragingSendDatatype(pos, DatatypeForMpi::Double),
-              rank_of_parent, requests);
+          communicator_.Send(&send_buffer_parent.at(sendcounter), MF::ANOPA(),
+                             communicator_.AveragingSendDatatype(
+                                 pos, DatatypeOf<ParameterValue>()),
+                             rank_of_parent, requests);
           sendcounter++;
 
           if constexpr (DP::Profile()) {
-            CommunicationStatistics::average_level_send_++;
+            CommunicationStatistics::Instance().average_level_send_++;
           }
         }
       } else if (rank_of_child != communicator_.MyRankId() &&
@@ -365,10 +458,11 @@ void Averager::AverageParameters(
           communicator_.Recv(
               &parent.GetPhaseByMaterial(material).GetParameterBuffer(),
               MF::ANOPA(),
-              communicator_.AveragingSendDatatype(pos, DatatypeForMpi::Double),
+              communicator_.AveragingSendDatatype(pos,
+                                                  DatatypeOf<ParameterValue>()),
               rank_of_child, requests);
           if constexpr (DP::Profile()) {
-            CommunicationStatistics::average_level_recv_++;
+            CommunicationStatistics::Instance().average_level_recv_++;
           }
         }
       }
@@ -386,7 +480,79 @@ void Averager::AverageParameters(
       }
     }
 
-    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    communicator_.WaitAll(requests);
     requests.clear();
   } // child_level
 }
+
+/**
+ * @brief Fills the statistics of the given parents from their children, which
+ * is needed once the children are coarsened. The statistics of the parents are
+ * allocated beforehand. The moments are averaged as raw moments ( see
+ * StatisticsOperations ), i.e. the means and covariances of the parent are the
+ * ones of the samples of all its children.
+ * @param parent_ids The ids of the parents ( same list on all ranks ). All
+ * their children must hold statistics.
+ */
+void Averager::AverageStatistics(std::vector<nid_t> const &parent_ids) const {
+  CommunicationCategoryScope const category(CommunicationCategory::Average);
+  int const my_rank = communicator_.MyRankId();
+  std::vector<MPI_Request> requests;
+  // averages sent to remote parents are kept until the sends are completed
+  std::vector<std::unique_ptr<StatisticsBuffers>> send_buffers;
+  std::unique_ptr<StatisticsBuffers> raw_child;
+
+  for (nid_t const parent_id : parent_ids) {
+    int const rank_of_parent = topology_.GetRankOfNode(parent_id);
+    if (rank_of_parent == my_rank) {
+      for (auto &phase : tree_.GetNodeWithId(parent_id).GetPhases()) {
+        phase.second.AllocateStatisticsBuffers();
+      }
+    }
+    for (nid_t const child_id : IdsOfChildren(parent_id)) {
+      int const rank_of_child = topology_.GetRankOfNode(child_id);
+      if (rank_of_child != my_rank && rank_of_parent != my_rank) {
+        continue;
+      }
+      MPI_Datatype const datatype = communicator_.AveragingSendDatatype(
+          PositionOfNodeAmongSiblings(child_id), DatatypeForMpi::Double);
+      for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
+        if (rank_of_child != my_rank) {
+          communicator_.Recv(&tree_.GetNodeWithId(parent_id)
+                                  .GetPhaseByMaterial(material)
+                                  .GetStatisticsBuffers(),
+                             StatisticsBuffers::number_of_moments_, datatype,
+                             rank_of_child, requests);
+          continue;
+        }
+        raw_child = std::make_unique<StatisticsBuffers>(
+            tree_.GetNodeWithId(child_id)
+                .GetPhaseByMaterial(material)
+                .GetStatisticsBuffers());
+        SO::ToRawMoments(*raw_child);
+        if (rank_of_parent == my_rank) {
+          Multiresolution::Average(*raw_child,
+                                   tree_.GetNodeWithId(parent_id)
+                                       .GetPhaseByMaterial(material)
+                                       .GetStatisticsBuffers(),
+                                   child_id);
+        } else {
+          StatisticsBuffers &averaged =
+              *send_buffers.emplace_back(std::make_unique<StatisticsBuffers>());
+          Multiresolution::Average(*raw_child, averaged, child_id);
+          communicator_.Send(&averaged, StatisticsBuffers::number_of_moments_,
+                             datatype, rank_of_parent, requests);
+        }
+      }
+    }
+  }
+  communicator_.WaitAll(requests);
+
+  for (nid_t const parent_id : parent_ids) {
+    if (topology_.GetRankOfNode(parent_id) == my_rank) {
+      for (auto &phase : tree_.GetNodeWithId(parent_id).GetPhases()) {
+        SO::ToCentralMoments(phase.second.GetStatisticsBuffers());
+      }
+    }
+  }
+}
@@ -54,6 +54,8 @@ public:
 
   void AverageInterfaceTags(std::vector<unsigned int> const
                                 &levels_with_updated_parents_descending) const;
+
+  void AverageStatistics(std::vector<nid_t> const &parent_ids) const;
 };
 
 #endif // AVERAGER_H
@@ -24,15 +24,23 @@
 #include "boundary_condition/boundary_specifications.h"
 #include "enums/interface_tag_definition.h"
 #include "utilities/string_operations.h"
+#include <array>
 #include <bitset>
+#include <cmath>
+#include <limits>
+#include <utility>
 
 /**
  * @brief Default constructor.
  * @param thresholder Thresholder used to compute the maximum allowed details in
  * the multiresolution analysis.
+ * @param refinement_regions User-defined regions bounding the levels of the
+ * single-phase refinement.
  */
-Multiresolution::Multiresolution(Thresholder &&thresholder)
-    : thresholder_(thresholder) {
+Multiresolution::Multiresolution(Thresholder &&thresholder,
+                                 RefinementRegions &&refinement_regions)
+    : thresholder_(thresholder),
+      refinement_regions_(std::move(refinement_regions)) {
   // Empty besides initializer list
 }
 
@@ -177,10 +185,6 @@ void Multiresolution::Prediction(
   unsigned int const parent_z_end =
       CC::DIM() == Dimension::Three ? (parent_z_start + (z_count / 2)) : 1;
 
-  unsigned int child_index_x = x_start;
-  unsigned int child_index_y = CC::DIM() != Dimension::One ? y_start : 0;
-  unsigned int child_index_z = CC::DIM() == Dimension::Three ? z_start : 0;
-
   constexpr double coefficient0 = -22.0 / 128.0;
   constexpr double coefficient1 = 3.0 / 128.0;
 
@@ -198,29 +202,33 @@ void Multiresolution::Prediction(
   constexpr double coefficient110 = coefficient011;
   constexpr double coefficient111 = coefficient1 * coefficient11;
 
-  double Qx = 0.0;
-  double Qy = 0.0;
-  double Qz = 0.0;
-  double Qxy = 0.0;
-  double Qxz = 0.0;
-  double Qyz = 0.0;
-  double Qxyz = 0.0;
-
   // We traverse the complete parent. Loop is offsetted because stencil reaches
   // further (fifth-order interpolation)
   /**
    * According to \cite Harten1993.
    */
   for (unsigned int i = parent_x_start; i < parent_x_end; ++i) {
-    child_index_y = y_start;
+    unsigned int const child_index_x = x_start + 2 * (i - parent_x_start);
     for (unsigned int j = parent_y_start; j < parent_y_end; ++j) {
-      child_index_z = z_start;
+      unsigned int const child_index_y = y_start + 2 * (j - parent_y_start);
 
+      // Parent and child are distinct buffers and each parent cell writes its
+      // own children only. Hence, the contiguous parent row is vectorized. The
+      // sums are evaluated in the same order as in the scalar loop, so the
+      // result is bit-identical (with and without full symmetry).
+#pragma omp simd
       for (unsigned int k = parent_z_start; k < parent_z_end; ++k) {
+        unsigned int const child_index_z = z_start + 2 * (k - parent_z_start);
+        double Qy = 0.0;
+        double Qz = 0.0;
+        double Qxy = 0.0;
+        double Qxz = 0.0;
+        double Qyz = 0.0;
+        double Qxyz = 0.0;
 
         // clang-format off
             //terms for 1D, 2D, 3D cases
-            Qx = coefficient0 * (parent_values[i+1][j][k] - parent_values[i-1][j][k]) + coefficient1 * (parent_values[i+2][j][k] - parent_values[i-2][j][k]);
+            double const Qx = coefficient0 * (parent_values[i+1][j][k] - parent_values[i-1][j][k]) + coefficient1 * (parent_values[i+2][j][k] - parent_values[i-2][j][k]);
 
             //terms for 2D, 3D cases
             if constexpr(CC::DIM() != Dimension::One) {
@@ -282,13 +290,61 @@ void Multiresolution::Prediction(
                child_values[child_index_x  ][child_index_y+1][child_index_z+1] = parent_values[i][j][k] + ConsistencyManagedSum( Qx, -Qy, -Qz) + ConsistencyManagedSum(-Qxy, -Qxz,  Qyz) + Qxyz;
                child_values[child_index_x+1][child_index_y+1][child_index_z+1] = parent_values[i][j][k] + ConsistencyManagedSum(-Qx, -Qy, -Qz) + ConsistencyManagedSum( Qxy,  Qxz,  Qyz) - Qxyz;
             }
-            child_index_z += 2;
         // clang-format on
       } // k-loop
-      child_index_y += 2;
-    } // j-loop
-    child_index_x += 2;
-  } // i-loop
+    }   // j-loop
+  }     // i-loop
+}
+
+/**
+ * @brief Single-precision overload. The values are converted to double and
+ * predicted in double precision. Only the parent cells within the stencil reach
+ * of the filled child cells are converted and only the filled child cells are
+ * written back.
+ */
+void Multiresolution::Prediction(
+    float const (&parent_values)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    float (&child_values)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    nid_t const child_id, unsigned int const x_start,
+    unsigned int const x_count, unsigned int const y_start,
+    unsigned int const y_count, unsigned int const z_start,
+    unsigned int const z_count) {
+  double parent_double[CC::TCX()][CC::TCY()][CC::TCZ()];
+  double child_double[CC::TCX()][CC::TCY()][CC::TCZ()];
+
+  // Parent cells read by the prediction, i.e. the parents of the filled child
+  // cells widened by the two cells of the stencil in the active dimensions
+  std::bitset<3> const position(PositionOfNodeAmongSiblings(child_id));
+  auto const parent_range = [&position](unsigned int const direction,
+                                        unsigned int const start,
+                                        unsigned int const count) {
+    unsigned int const first =
+        start / 2 + (position.test(direction) ? CC::PIOHCH() : CC::PIOLCH());
+    return std::array<unsigned int, 2>{first - 2, first + count / 2 + 2};
+  };
+  std::array<unsigned int, 2> const range_x = parent_range(0, x_start, x_count);
+  std::array<unsigned int, 2> const range_y =
+      CC::DIM() != Dimension::One ? parent_range(1, y_start, y_count)
+                                  : std::array<unsigned int, 2>{0, 1};
+  std::array<unsigned int, 2> const range_z =
+      CC::DIM() == Dimension::Three ? parent_range(2, z_start, z_count)
+                                    : std::array<unsigned int, 2>{0, 1};
+  for (unsigned int i = range_x[0]; i < range_x[1]; ++i) {
+    for (unsigned int j = range_y[0]; j < range_y[1]; ++j) {
+      for (unsigned int k = range_z[0]; k < range_z[1]; ++k) {
+        parent_double[i][j][k] = parent_values[i][j][k];
+      }
+    }
+  }
+  Prediction(parent_double, child_double, child_id, x_start, x_count, y_start,
+             y_count, z_start, z_count);
+  for (unsigned int i = x_start; i < x_start + x_count; ++i) {
+    for (unsigned int j = y_start; j < y_start + y_count; ++j) {
+      for (unsigned int k = z_start; k < z_start + z_count; ++k) {
+        child_values[i][j][k] = static_cast<float>(child_double[i][j][k]);
+      }
+    }
+  }
 }
 
 /**
@@ -296,14 +352,14 @@ void Multiresolution::Prediction(
  * function.
  */
 template <>
-RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Linfinity>(
+double Multiresolution::ChildDetail<Norm::Linfinity>(
     Block const &parent, Block const &child, nid_t const child_id) const {
 
-  double predicted_values[CC::TCX()][CC::TCY()][CC::TCZ()];
+  FieldValue predicted_values[CC::TCX()][CC::TCY()][CC::TCZ()];
   double max_detail = 0.0;
 
   for (Equation const eq : MF::EWA()) {
-    double const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         child.GetRightHandSideBuffer(eq);
     Multiresolution::Prediction(parent.GetRightHandSideBuffer(eq),
                                 predicted_values, child_id);
@@ -311,15 +367,15 @@ RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Linfinity>(
       for (unsigned int j = 0; j < CC::TCY(); ++j) {
         for (unsigned int k = 0; k < CC::TCZ(); ++k) {
           max_detail =
-              std::max(max_detail, std::abs(exact_values[i][j][k] -
-                                            predicted_values[i][j][k]) /
-                                       std::abs(exact_values[i][j][k]));
+              std::max<double>(max_detail, std::abs(exact_values[i][j][k] -
+                                                    predicted_values[i][j][k]) /
+                                               std::abs(exact_values[i][j][k]));
         } // Loop : k
       }   // Loop : j
     }     // Loop : i
   }       // Loop : Equation
 
-  return RemeshingDecision(max_detail, LevelOfNode(child_id));
+  return max_detail;
 }
 
 /**
@@ -327,17 +383,18 @@ RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Linfinity>(
  * See meta function.
  */
 template <>
-RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Lone>(
-    Block const &parent, Block const &child, nid_t const child_id) const {
+double Multiresolution::ChildDetail<Norm::Lone>(Block const &parent,
+                                                Block const &child,
+                                                nid_t const child_id) const {
 
-  double predicted_values[CC::TCX()][CC::TCY()][CC::TCZ()];
+  FieldValue predicted_values[CC::TCX()][CC::TCY()][CC::TCZ()];
   double max_detail = 0.0;
   double error_norm = 0.0;
 
   double const one_number_of_cells = 1.0 / (CC::TCX() * CC::TCY() * CC::TCZ());
 
   for (Equation const eq : MF::EWA()) {
-    double const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         child.GetRightHandSideBuffer(eq);
     Multiresolution::Prediction(parent.GetRightHandSideBuffer(eq),
                                 predicted_values, child_id);
@@ -357,7 +414,7 @@ RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Lone>(
                                                     // values over the eq-loops.
   }                                                 // Loop : eq
 
-  return RemeshingDecision(max_detail, LevelOfNode(child_id));
+  return max_detail;
 }
 
 /**
@@ -365,17 +422,18 @@ RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Lone>(
  * See meta function.
  */
 template <>
-RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Ltwo>(
-    Block const &parent, Block const &child, nid_t const child_id) const {
+double Multiresolution::ChildDetail<Norm::Ltwo>(Block const &parent,
+                                                Block const &child,
+                                                nid_t const child_id) const {
 
-  double predicted_values[CC::TCX()][CC::TCY()][CC::TCZ()];
+  FieldValue predicted_values[CC::TCX()][CC::TCY()][CC::TCZ()];
   double max_detail = 0.0;
   double error_norm = 0.0;
 
   double const one_number_of_cells = 1.0 / (CC::TCX() * CC::TCY() * CC::TCZ());
 
   for (Equation const eq : MF::EWA()) {
-    double const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         child.GetRightHandSideBuffer(eq);
     Multiresolution::Prediction(parent.GetRightHandSideBuffer(eq),
                                 predicted_values, child_id);
@@ -394,7 +452,7 @@ RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Ltwo>(
         std::max(max_detail, std::sqrt(error_norm) * one_number_of_cells);
   } // loop : eq
 
-  return RemeshingDecision(max_detail, LevelOfNode(child_id));
+  return max_detail;
 }
 
 /**
@@ -402,11 +460,14 @@ RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Ltwo>(
  * level of the analysis.
  * @param detail The relevant detail according to the used error norm.
  * @param level The level on which the decision is made.
+ * @param threshold_factor Factor the thresholds are raised by, e.g. when the
+ * memory budget of the rank is nearly exhausted.
  * @return Remeshing decision.
  */
 RemeshIdentifier
 Multiresolution::RemeshingDecision(double const detail,
-                                   unsigned int const level) const {
+                                   unsigned int const level,
+                                   double const threshold_factor) const {
 
   /* The 32 pops out of \cite Harten 1995. = 2^(p+1). With p being the order of
    * the prediction minus 1. Our prediction is of fifth order. If the prediction
@@ -415,7 +476,8 @@ Multiresolution::RemeshingDecision(double const detail,
    */
   constexpr double fifth_order_coefficient = 32.0;
 
-  double const epsilon_coarsen = thresholder_.ThresholdOnLevel(level);
+  double const epsilon_coarsen =
+      thresholder_.ThresholdOnLevel(level) * threshold_factor;
   double const epsilon_refinement = epsilon_coarsen * fifth_order_coefficient;
 
   if (detail <= epsilon_coarsen) {
@@ -427,6 +489,273 @@ Multiresolution::RemeshingDecision(double const detail,
   }
 }
 
+/**
+ * @brief Gives whether the remeshing decision of a leaf cannot have changed
+ * since its detail was cached. A relative change rho of the conservatives of
+ * the child (including its halo cells, i.e. the changes of the neighbors within
+ * the prediction stencil) changes the relative detail of each cell by at most
+ * rho * ( detail + 1 + L ), with L being the sum of the absolute prediction
+ * weights. The decision is certain if the lower and the upper bound of the
+ * detail give the same decision.
+ * @param cached_detail The detail of the last analysis and the accumulated
+ * relative change since then.
+ * @param level The level of the leaf.
+ * @param threshold_factor Factor the thresholds are raised by.
+ * @return True if the cached decision still holds, false if the detail has to
+ * be recomputed.
+ */
+bool Multiresolution::DecisionIsCertain(CachedDetail const &cached_detail,
+                                        unsigned int const level,
+                                        double const threshold_factor) const {
+  // sum of the absolute weights of the one-dimensional prediction, applied in
+  // each direction
+  constexpr double weights_one_dimension = 1.0 + 2.0 * (22.0 + 3.0) / 128.0;
+  double prediction_weights = 1.0;
+  for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+    prediction_weights *= weights_one_dimension;
+  }
+
+  if (!std::isfinite(cached_detail.relative_change_)) {
+    return false;
+  }
+  double const change = cached_detail.relative_change_ *
+                        (cached_detail.detail_ + 1.0 + prediction_weights);
+  return RemeshingDecision(std::max(cached_detail.detail_ - change, 0.0), level,
+                           threshold_factor) ==
+         RemeshingDecision(cached_detail.detail_ + change, level,
+                           threshold_factor);
+}
+
+/**
+ * @brief Gives the largest relative change of the conservatives entering the
+ * wavelet analysis during the last time step of the block, i.e. between the
+ * initial buffer (values at the begin of the step) and the right-hand side
+ * buffer (values at its end). All cells including the halo cells are
+ * considered.
+ * @param block The block after its last stage.
+ * @return The largest relative change, infinity if a vanishing value is
+ * encountered.
+ */
+double Multiresolution::RelativeChangeOfStep(Block const &block) {
+  double max_change = 0.0;
+  for (Equation const eq : MF::EWA()) {
+    FieldValue const(&u_new)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        block.GetRightHandSideBuffer(eq);
+    FieldValue const(&u_old)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        block.GetInitialBuffer(eq);
+    for (unsigned int i = 0; i < CC::TCX(); ++i) {
+      for (unsigned int j = 0; j < CC::TCY(); ++j) {
+        for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+          double const change = std::abs(u_new[i][j][k] - u_old[i][j][k]) /
+                                std::abs(u_new[i][j][k]);
+          if (std::isnan(change)) {
+            return std::numeric_limits<double>::infinity();
+          }
+          max_change = std::max(max_change, change);
+        } // k
+      }   // j
+    }     // i
+  }       // equations
+  return max_change;
+}
+
+namespace {
+// Noise filter of the normalized sensors ( see \cite Loehner1987 ). It is also
+// applied to the largest magnitude of the field in the block, which suppresses
+// the noise of fields around zero, e.g. momenta
+constexpr double noise_filter = 0.01;
+
+/**
+ * @brief Gives the largest magnitude of a field in the internal cells of a
+ * block.
+ * @param u The field.
+ * @return The largest magnitude.
+ */
+double
+LargestMagnitude(FieldValue const (&u)[CC::TCX()][CC::TCY()][CC::TCZ()]) {
+  double magnitude = 0.0;
+  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+        magnitude = std::max(magnitude, double(std::abs(u[i][j][k])));
+      }
+    }
+  }
+  return magnitude;
+}
+
+/**
+ * @brief Gives the largest value of a three-point sensor over the internal
+ * cells of a block, all directions and all equations of the wavelet analysis.
+ * @param block The block.
+ * @param sensor Callable giving the sensor from the values of the lower
+ * neighbor, the cell and the upper neighbor and the largest magnitude of the
+ * field in the block.
+ * @return The largest sensor value.
+ */
+template <typename Sensor>
+double LargestThreePointSensor(Block const &block, Sensor &&sensor) {
+  double largest = 0.0;
+  for (Equation const eq : MF::EWA()) {
+    FieldValue const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        block.GetRightHandSideBuffer(eq);
+    double const magnitude = LargestMagnitude(u);
+    for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+      for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+        for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+          largest = std::max(largest, sensor(u[i - 1][j][k], u[i][j][k],
+                                             u[i + 1][j][k], magnitude));
+          if constexpr (CC::DIM() != Dimension::One) {
+            largest = std::max(largest, sensor(u[i][j - 1][k], u[i][j][k],
+                                               u[i][j + 1][k], magnitude));
+          }
+          if constexpr (CC::DIM() == Dimension::Three) {
+            largest = std::max(largest, sensor(u[i][j][k - 1], u[i][j][k],
+                                               u[i][j][k + 1], magnitude));
+          }
+        } // k
+      }   // j
+    }     // i
+  }       // equations
+  return largest;
+}
+} // namespace
+
+/**
+ * @brief Implementation of the meta function for the normalized jump across a
+ * cell, |u_+ - u_-| / ( |u_+| + |u_-| ). See meta function.
+ */
+template <>
+double Multiresolution::LocalIndicator<RefinementIndicator::Gradient>(
+    Block const &block) {
+  return LargestThreePointSensor(block, [](double const minus, double const,
+                                           double const plus,
+                                           double const magnitude) {
+    double const normalization =
+        std::abs(plus) + std::abs(minus) + noise_filter * magnitude;
+    return normalization > 0.0 ? std::abs(plus - minus) / normalization : 0.0;
+  });
+}
+
+/**
+ * @brief Implementation of the meta function for the normalized second
+ * difference of \cite Loehner1987. See meta function.
+ */
+template <>
+double Multiresolution::LocalIndicator<RefinementIndicator::Curvature>(
+    Block const &block) {
+  return LargestThreePointSensor(
+      block, [](double const minus, double const center, double const plus,
+                double const magnitude) {
+        double const normalization =
+            std::abs(plus - center) + std::abs(center - minus) +
+            noise_filter * (std::abs(plus) + 2.0 * std::abs(center) +
+                            std::abs(minus) + magnitude);
+        return normalization > 0.0
+                   ? std::abs(plus - 2.0 * center + minus) / normalization
+                   : 0.0;
+      });
+}
+
+/**
+ * @brief Implementation of the meta function for the shock sensor. The sensor
+ * of \cite Jameson1981 is evaluated on the density ( the pressure is not
+ * available without the equation of state ) and weighted by the dilatation
+ * ratio of \cite Ducros1999, which vanishes in vortices. See meta function.
+ */
+template <>
+double Multiresolution::LocalIndicator<RefinementIndicator::ShockSensor>(
+    Block const &block) {
+  FieldValue const(&rho)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      block.GetRightHandSideBuffer(Equation::Mass);
+  FieldValue const(&rho_u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      block.GetRightHandSideBuffer(Equation::MomentumX);
+  // momenta of missing dimensions alias the x-momentum and remain unused
+  FieldValue const(&rho_v)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      block.GetRightHandSideBuffer(
+          MF::AME()[CC::DIM() != Dimension::One ? 1 : 0]);
+  FieldValue const(&rho_w)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      block.GetRightHandSideBuffer(
+          MF::AME()[CC::DIM() == Dimension::Three ? 2 : 0]);
+
+  auto const jameson = [](double const minus, double const center,
+                          double const plus) {
+    return std::abs(plus - 2.0 * center + minus) /
+           (plus + 2.0 * center + minus);
+  };
+  // central differences, the cell size cancels in the ratio
+  auto const u = [&](unsigned int const i, unsigned int const j,
+                     unsigned int const k) {
+    return rho_u[i][j][k] / rho[i][j][k];
+  };
+  auto const v = [&](unsigned int const i, unsigned int const j,
+                     unsigned int const k) {
+    return rho_v[i][j][k] / rho[i][j][k];
+  };
+  auto const w = [&](unsigned int const i, unsigned int const j,
+                     unsigned int const k) {
+    return rho_w[i][j][k] / rho[i][j][k];
+  };
+
+  double largest = 0.0;
+  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+        double sensor =
+            jameson(rho[i - 1][j][k], rho[i][j][k], rho[i + 1][j][k]);
+        double dilatation = u(i + 1, j, k) - u(i - 1, j, k);
+        double vorticity_squared = 0.0;
+        if constexpr (CC::DIM() != Dimension::One) {
+          sensor = std::max(sensor, jameson(rho[i][j - 1][k], rho[i][j][k],
+                                            rho[i][j + 1][k]));
+          dilatation += v(i, j + 1, k) - v(i, j - 1, k);
+          double const vorticity_z = (v(i + 1, j, k) - v(i - 1, j, k)) -
+                                     (u(i, j + 1, k) - u(i, j - 1, k));
+          vorticity_squared += vorticity_z * vorticity_z;
+        }
+        if constexpr (CC::DIM() == Dimension::Three) {
+          sensor = std::max(sensor, jameson(rho[i][j][k - 1], rho[i][j][k],
+                                            rho[i][j][k + 1]));
+          dilatation += w(i, j, k + 1) - w(i, j, k - 1);
+          double const vorticity_x = (w(i, j + 1, k) - w(i, j - 1, k)) -
+                                     (v(i, j, k + 1) - v(i, j, k - 1));
+          double const vorticity_y = (u(i, j, k + 1) - u(i, j, k - 1)) -
+                                     (w(i + 1, j, k) - w(i - 1, j, k));
+          vorticity_squared +=
+              vorticity_x * vorticity_x + vorticity_y * vorticity_y;
+        }
+        double const dilatation_squared = dilatation * dilatation;
+        double const ducros =
+            dilatation_squared + vorticity_squared > 0.0
+                ? dilatation_squared / (dilatation_squared + vorticity_squared)
+                : 0.0;
+        largest = std::max(largest, sensor * ducros);
+      } // k
+    }   // j
+  }     // i
+  return largest;
+}
+
+/**
+ * @brief Gives the remeshing decision of a leaf from its local indicator
+ * against the fixed thresholds CC::RICT() and CC::RIRT(). Unlike the details,
+ * the indicators are normalized and hence not scaled with the level.
+ * @param indicator The local indicator of the leaf.
+ * @param threshold_factor Factor the thresholds are raised by.
+ * @return Remeshing decision.
+ */
+RemeshIdentifier
+Multiresolution::LocalRemeshingDecision(double const indicator,
+                                        double const threshold_factor) {
+  if (indicator <= CC::RICT() * threshold_factor) {
+    return RemeshIdentifier::Coarse;
+  } else if (indicator >= CC::RIRT() * threshold_factor) {
+    return RemeshIdentifier::Refine;
+  } else {
+    return RemeshIdentifier::Neutral;
+  }
+}
+
 /**
  * @brief Averageing-operator equivalent for interface tags.
  * @param child_tags The child's interface tag buffer.
@@ -24,8 +24,10 @@
 
 #include "block_definitions/block.h"
 #include "enums/norms.h"
+#include "enums/refinement_indicator.h"
 #include "enums/remesh_identifier.h"
 #include "input_output/log_writer/log_writer.h"
+#include "multiresolution/refinement_regions.h"
 #include "multiresolution/threshold_computer.h"
 #include "topology/id_information.h"
 #include "user_specifications/compile_time_constants.h"
@@ -43,6 +45,15 @@ constexpr unsigned int xyz_look_up_table_[3][8] = {
      CC::PIOHCFICZ(), CC::PIOHCFICZ(), CC::PIOHCFICZ(), CC::PIOHCFICZ()}};
 }
 
+/**
+ * @brief The detail of a leaf found in its last wavelet analysis together with
+ * the accumulated relative change of its conservatives since then.
+ */
+struct CachedDetail {
+  double detail_;
+  double relative_change_;
+};
+
 /**
  * @brief The Multiresolution class provides prediction and averaging methods
  * for field and interface tags as well as more high-level helper functions
@@ -51,36 +62,97 @@ constexpr unsigned int xyz_look_up_table_[3][8] = {
 class Multiresolution {
 
   Thresholder const thresholder_;
-
-  RemeshIdentifier RemeshingDecision(double const detail,
-                                     unsigned int const level) const;
+  RefinementRegions const refinement_regions_;
 
 public:
   Multiresolution() = delete;
-  explicit Multiresolution(Thresholder &&thresholder);
+  explicit Multiresolution(Thresholder &&thresholder,
+                           RefinementRegions &&refinement_regions);
   ~Multiresolution() = default;
   Multiresolution(Multiresolution const &) = delete;
   Multiresolution &operator=(Multiresolution const &) = delete;
   Multiresolution(Multiresolution &&) = delete;
   Multiresolution &operator=(Multiresolution &&) = delete;
 
+  RemeshIdentifier RemeshingDecision(double const detail,
+                                     unsigned int const level,
+                                     double const threshold_factor = 1.0) const;
+  bool DecisionIsCertain(CachedDetail const &cached_detail,
+                         unsigned int const level,
+                         double const threshold_factor = 1.0) const;
+  static double RelativeChangeOfStep(Block const &block);
+
   /**
-   * @brief Meta function to identify if the provided (child) node needs
-   * refinement or may be coarsened. Therefore the relative differences
-   * ("details") between the parent's prediction and the exact value of the
-   * child are compared. Details are computed according to \cite Roussel2003. In
-   * this calculation the error estimates must be adjusted by the dimensionality
-   * of the studied case. The error estimate may be computed with respect to
-   * different norms.
+   * @brief Gives the user-defined regions bounding the levels of the
+   * single-phase refinement.
+   * @return The regions.
+   */
+  RefinementRegions const &GetRefinementRegions() const {
+    return refinement_regions_;
+  }
+
+  /**
+   * @brief Meta function to compute the relative differences ("details")
+   * between the parent's prediction and the exact value of the child. Details
+   * are computed according to \cite Roussel2003. In this calculation the error
+   * estimates must be adjusted by the dimensionality of the studied case. The
+   * error estimate may be computed with respect to different norms.
    * @param parent Conservative data of the parent.
    * @param child Conservative data of the child.
    * @param child_id The id of the child node.
+   * @return The detail of the provided child.
+   * @tparam N The Norm used to decide whether the children should be coarsened.
+   */
+  template <Norm N>
+  double ChildDetail(Block const &parent, Block const &child,
+                     nid_t const child_id) const;
+
+  /**
+   * @brief Identifies if the provided (child) node needs refinement or may be
+   * coarsened, based on its detail. See ChildDetail.
+   * @param parent Conservative data of the parent.
+   * @param child Conservative data of the child.
+   * @param child_id The id of the child node.
+   * @param threshold_factor Factor the thresholds are raised by.
    * @return Remeshing decision for the provided child.
    * @tparam N The Norm used to decide whether the children should be coarsened.
    */
   template <Norm N>
-  RemeshIdentifier ChildNeedsRemeshing(Block const &parent, Block const &child,
-                                       nid_t const child_id) const;
+  RemeshIdentifier
+  ChildNeedsRemeshing(Block const &parent, Block const &child,
+                      nid_t const child_id,
+                      double const threshold_factor = 1.0) const {
+    return RemeshingDecision(ChildDetail<N>(parent, child, child_id),
+                             LevelOfNode(child_id), threshold_factor);
+  }
+
+  /**
+   * @brief Meta function to compute an indicator for the refinement of a leaf
+   * from its own data only, i.e. unlike the details without its parent. Hence,
+   * the decision is local to the rank holding the leaf.
+   * @param block Conservative data of the leaf ( including its halo cells ).
+   * @return The largest indicator value of the internal cells, within [0, 1].
+   * @tparam R The indicator, all but RefinementIndicator::WaveletDetail.
+   */
+  template <RefinementIndicator R>
+  static double LocalIndicator(Block const &block);
+
+  /**
+   * @brief Identifies if the provided leaf needs refinement or may be
+   * coarsened, based on its local indicator. See LocalIndicator.
+   * @param block Conservative data of the leaf ( including its halo cells ).
+   * @param threshold_factor Factor the thresholds are raised by.
+   * @return Remeshing decision for the provided leaf.
+   * @tparam R The indicator, all but RefinementIndicator::WaveletDetail.
+   */
+  template <RefinementIndicator R>
+  static RemeshIdentifier
+  LeafNeedsRemeshing(Block const &block, double const threshold_factor = 1.0) {
+    return LocalRemeshingDecision(LocalIndicator<R>(block), threshold_factor);
+  }
+  static RemeshIdentifier
+  LocalRemeshingDecision(double const indicator,
+                         double const threshold_factor = 1.0);
 
   /**
    * @brief Averages the child values into the parent, i.e. conservative average
@@ -115,21 +187,19 @@ public:
     unsigned int const k_child_start =
         CC::DIM() == Dimension::Three ? CC::FICZ() : 0;
 
-    unsigned int i_child = i_child_start;
-    unsigned int j_child = j_child_start;
-    unsigned int k_child = k_child_start;
-
     for (size_t field_index = 0; field_index < BufferType::GetNumberOfFields();
          ++field_index) {
       auto const &child_values = child_buffer[field_index];
       auto &parent_values = parent_buffer[field_index];
 
-      i_child = i_child_start;
       for (unsigned int i = x_start; i < x_end; ++i) {
-        j_child = j_child_start;
+        unsigned int const i_child = i_child_start + 2 * (i - x_start);
         for (unsigned int j = y_start; j < y_end; ++j) {
-          k_child = k_child_start;
+          unsigned int const j_child = j_child_start + 2 * (j - y_start);
+          // child and parent are distinct buffers, the row is vectorized
+#pragma omp simd
           for (unsigned int k = z_start; k < z_end; ++k) {
+            unsigned int const k_child = k_child_start + 2 * (k - z_start);
             if constexpr (CC::DIM() == Dimension::One) {
               parent_values[i][j][k] =
                   (child_values[i_child][j_child][k_child] +
@@ -157,13 +227,10 @@ public:
                       child_values[i_child][j_child + 1][k_child + 1] +
                           child_values[i_child + 1][j_child][k_child]);
             }
-            k_child += 2;
           } // k
-          j_child += 2;
-        } // j
-        i_child += 2;
-      } // i
-    }   // eq
+        }   // j
+      }     // i
+    }       // eq
   }
 
   static void AverageJumpBuffer(SurfaceBuffer const &child_values,
@@ -175,6 +242,12 @@ public:
       unsigned int const x_start = 0, unsigned int const x_count = CC::TCX(),
       unsigned int const y_start = 0, unsigned int const y_count = CC::TCY(),
       unsigned int const z_start = 0, unsigned int const z_count = CC::TCZ());
+  static void Prediction(
+      float const (&U_parent)[CC::TCX()][CC::TCY()][CC::TCZ()],
+      float (&U_child)[CC::TCX()][CC::TCY()][CC::TCZ()], nid_t const child_id,
+      unsigned int const x_start = 0, unsigned int const x_count = CC::TCX(),
+      unsigned int const y_start = 0, unsigned int const y_count = CC::TCY(),
+      unsigned int const z_start = 0, unsigned int const z_count = CC::TCZ());
   static void PropagateCutCellTagsFromChildIntoParent(
       std::int8_t const (&child_tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
       std::int8_t (&parent_tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
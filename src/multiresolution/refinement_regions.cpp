@@ -0,0 +1,179 @@
+//===----------------------- refinement_regions.cpp -----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "multiresolution/refinement_regions.h"
+
+#include <algorithm>
+
+#include "enums/dimension_definition.h"
+#include "user_expression.h"
+#include "user_specifications/compile_time_constants.h"
+#include "utilities/string_operations.h"
+
+/**
+ * @brief Creates the regions and compiles their expressions.
+ * @param regions The regions with dimensional bounding boxes.
+ * @param node_size_on_level_zero The dimensional size of a node on level zero.
+ * @param maximum_level The maximum level of the simulation.
+ */
+RefinementRegions::RefinementRegions(
+    std::vector<RefinementRegion> const &regions,
+    double const node_size_on_level_zero, unsigned int const maximum_level)
+    : node_size_on_level_zero_(node_size_on_level_zero),
+      maximum_level_(maximum_level), regions_(regions),
+      expression_point_(3, 0.0) {
+  expressions_.reserve(regions_.size());
+  for (RefinementRegion const &region : regions_) {
+    expressions_.push_back(
+        region.expression_.empty()
+            ? nullptr
+            : std::make_unique<UserExpression>(
+                  region.expression_, std::vector<std::string>{"inside"},
+                  std::vector<std::string>{"x", "y", "z"}, expression_point_));
+  }
+}
+
+// Defined here, as the expressions are incomplete in the header. The point
+// keeps its storage when moved, hence the expressions stay bound to it.
+RefinementRegions::~RefinementRegions() = default;
+RefinementRegions::RefinementRegions(RefinementRegions &&) = default;
+
+/**
+ * @brief Indicates whether a node belongs to a region.
+ * @param region_index The index of the region.
+ * @param origin The dimensional coordinates of the origin of the node.
+ * @param size The dimensional size of the node.
+ * @return True if the node overlaps the bounding box and, if given, the
+ * expression is positive at one of its corners or its center.
+ */
+bool RefinementRegions::NodeIsInRegion(std::size_t const region_index,
+                                       std::array<double, 3> const &origin,
+                                       double const size) const {
+  std::array<double, 6> const &box = regions_[region_index].bounding_box_;
+  for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+    if (origin[d] + size <= box[2 * d] || origin[d] >= box[2 * d + 1]) {
+      return false;
+    }
+  }
+  UserExpression const *expression = expressions_[region_index].get();
+  if (expression == nullptr) {
+    return true;
+  }
+  unsigned int const number_of_corners = 1 << DTI(CC::DIM());
+  for (unsigned int corner = 0; corner <= number_of_corners; ++corner) {
+    for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+      // The last point is the center
+      double const offset = corner == number_of_corners
+                                ? 0.5 * size
+                                : double((corner >> d) & 1) * size;
+      expression_point_[d] = origin[d] + offset;
+    }
+    if (expression->GetValue("inside") > 0.0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Gives the levels the refinement of a node is bounded to.
+ * @param id The id of the node.
+ * @return The minimum and the maximum level of the node.
+ */
+std::array<unsigned int, 2>
+RefinementRegions::LevelBoundsOfNode(nid_t const id) const {
+  if (regions_.empty()) {
+    return {0, maximum_level_};
+  }
+  double const size = DomainSizeOfId(id, node_size_on_level_zero_);
+  std::array<double, 3> const origin = DomainCoordinatesOfId(id, size);
+  bool in_any_region = false;
+  std::array<unsigned int, 2> bounds = {0, 0};
+  for (std::size_t index = 0; index < regions_.size(); ++index) {
+    if (NodeIsInRegion(index, origin, size)) {
+      in_any_region = true;
+      bounds[0] = std::max(bounds[0], regions_[index].minimum_level_);
+      bounds[1] = std::max(bounds[1], regions_[index].maximum_level_);
+    }
+  }
+  if (!in_any_region) {
+    bounds[1] = maximum_level_;
+  }
+  return bounds;
+}
+
+/**
+ * @brief Bounds the remeshing decision of a single-phase leaf to the levels of
+ * its regions. Leaves above the maximum level are coarsened, leaves below the
+ * minimum level are refined, regardless of their details.
+ * @param decision The decision based on the details of the leaf.
+ * @param id The id of the leaf.
+ * @return The bounded decision.
+ */
+RemeshIdentifier
+RefinementRegions::BoundRemeshingDecision(RemeshIdentifier const decision,
+                                          nid_t const id) const {
+  if (regions_.empty()) {
+    return decision;
+  }
+  unsigned int const level = LevelOfNode(id);
+  auto const [minimum_level, maximum_level] = LevelBoundsOfNode(id);
+  if (level > maximum_level) {
+    return RemeshIdentifier::Coarse;
+  }
+  if (level < minimum_level) {
+    return RemeshIdentifier::Refine;
+  }
+  if ((decision == RemeshIdentifier::Refine && level >= maximum_level) ||
+      (decision == RemeshIdentifier::Coarse && level <= minimum_level)) {
+    return RemeshIdentifier::Neutral;
+  }
+  return decision;
+}
+
+/**
+ * @brief Gives the data for logging of the regions.
+ * @param indent Number of white spaces used at the beginning of each line.
+ * @return One line per region.
+ */
+std::vector<std::string>
+RefinementRegions::GetLogData(unsigned int const indent) const {
+  std::vector<std::string> lines;
+  for (RefinementRegion const &region : regions_) {
+    std::string line = StringOperations::Indent(indent) + "Levels " +
+                       std::to_string(region.minimum_level_) + " to " +
+                       std::to_string(region.maximum_level_) + " in [";
+    for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+      line += (d > 0 ? ", " : "") +
+              StringOperations::ToScientificNotationString(
+                  region.bounding_box_[2 * d], 3) +
+              " : " +
+              StringOperations::ToScientificNotationString(
+                  region.bounding_box_[2 * d + 1], 3);
+    }
+    line += "]";
+    if (!region.expression_.empty()) {
+      line += " where " + region.expression_;
+    }
+    lines.push_back(line);
+  }
+  return lines;
+}
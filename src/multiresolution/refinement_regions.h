@@ -0,0 +1,96 @@
+//===------------------------ refinement_regions.h ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef REFINEMENT_REGIONS_H
+#define REFINEMENT_REGIONS_H
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "enums/remesh_identifier.h"
+#include "topology/id_information.h"
+
+// The expression toolkit is only included in the translation unit
+class UserExpression;
+
+/**
+ * @brief A user-defined region together with the levels the single-phase
+ * refinement is bounded to inside of it.
+ */
+struct RefinementRegion {
+  // xMin, xMax, yMin, yMax, zMin, zMax ( dimensional )
+  std::array<double, 6> bounding_box_;
+  // defines the variable "inside", positive inside the region ( empty: the
+  // whole bounding box )
+  std::string expression_;
+  unsigned int minimum_level_;
+  unsigned int maximum_level_;
+};
+
+/**
+ * @brief The RefinementRegions class bounds the levels of the single-phase
+ * refinement in user-defined regions. A node belongs to a region if it overlaps
+ * the bounding box of the region and, for regions given by an expression, the
+ * expression is positive at one of its corners or its center. Where regions
+ * overlap, the largest minimum and the largest maximum level apply, i.e., a
+ * region of interest may be nested in a coarse one. Outside all regions the
+ * refinement is only bounded by the maximum level.
+ * @note The interface always resides on the maximum level, hence multi-phase
+ * nodes are not bounded.
+ */
+class RefinementRegions {
+  double node_size_on_level_zero_;
+  unsigned int maximum_level_;
+  std::vector<RefinementRegion> regions_;
+  // The expressions ( null for box regions ) are bound to the same point
+  mutable std::vector<double> expression_point_;
+  std::vector<std::unique_ptr<UserExpression>> expressions_;
+
+  bool NodeIsInRegion(std::size_t const region_index,
+                      std::array<double, 3> const &origin,
+                      double const size) const;
+
+public:
+  RefinementRegions() = delete;
+  explicit RefinementRegions(std::vector<RefinementRegion> const &regions,
+                             double const node_size_on_level_zero,
+                             unsigned int const maximum_level);
+  ~RefinementRegions();
+  RefinementRegions(RefinementRegions const &) = delete;
+  RefinementRegions &operator=(RefinementRegions const &) = delete;
+  RefinementRegions(RefinementRegions &&);
+  RefinementRegions &operator=(RefinementRegions &&) = delete;
+
+  std::array<unsigned int, 2> LevelBoundsOfNode(nid_t const id) const;
+  RemeshIdentifier BoundRemeshingDecision(RemeshIdentifier const decision,
+                                          nid_t const id) const;
+  std::vector<std::string> GetLogData(unsigned int const indent) const;
+
+  /**
+   * @brief Indicates whether any region is defined.
+   * @return True if the refinement is bounded in a region, false otherwise.
+   */
+  bool Any() const { return !regions_.empty(); }
+};
+
+#endif // REFINEMENT_REGIONS_H
@@ -0,0 +1,874 @@
+//===----------------------- native_expression.cpp ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "native_expression.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+/**
+ * @brief Math functions of the expression toolkit and their C++ counterparts.
+ * Variadic functions take at least one argument and are passed a braced list.
+ */
+struct MathFunction {
+  char const *name_;
+  unsigned arguments_;
+  bool variadic_;
+};
+
+std::unordered_map<std::string, MathFunction> const math_functions = {
+    {"abs", {"std::fabs", 1, false}},    {"acos", {"std::acos", 1, false}},
+    {"acosh", {"std::acosh", 1, false}}, {"asin", {"std::asin", 1, false}},
+    {"asinh", {"std::asinh", 1, false}}, {"atan", {"std::atan", 1, false}},
+    {"atanh", {"std::atanh", 1, false}}, {"atan2", {"std::atan2", 2, false}},
+    {"ceil", {"std::ceil", 1, false}},   {"clamp", {"Clamp", 3, false}},
+    {"cos", {"std::cos", 1, false}},     {"cosh", {"std::cosh", 1, false}},
+    {"erf", {"std::erf", 1, false}},     {"erfc", {"std::erfc", 1, false}},
+    {"exp", {"std::exp", 1, false}},     {"expm1", {"std::expm1", 1, false}},
+    {"floor", {"std::floor", 1, false}}, {"hypot", {"std::hypot", 2, false}},
+    {"log", {"std::log", 1, false}},     {"log10", {"std::log10", 1, false}},
+    {"log1p", {"std::log1p", 1, false}}, {"log2", {"std::log2", 1, false}},
+    {"max", {"std::max", 1, true}},      {"min", {"std::min", 1, true}},
+    {"pow", {"std::pow", 2, false}},     {"round", {"std::round", 1, false}},
+    {"sgn", {"Sgn", 1, false}},          {"sin", {"std::sin", 1, false}},
+    {"sinh", {"std::sinh", 1, false}},   {"sqrt", {"std::sqrt", 1, false}},
+    {"tan", {"std::tan", 1, false}},     {"tanh", {"std::tanh", 1, false}},
+    {"trunc", {"std::trunc", 1, false}}};
+
+// Symbols of the expression toolkit that cannot be used as variables
+std::unordered_set<std::string> const reserved_symbols = {
+    "break",  "case",    "const",  "continue", "default",
+    "else",   "epsilon", "for",    "null",     "repeat",
+    "return", "swap",    "switch", "until",    "while"};
+
+// Helpers of the generated code, prepended to the translated function
+constexpr char const *prologue =
+    "#include <algorithm>\n"
+    "#include <cmath>\n"
+    "#include <limits>\n"
+    "namespace {\n"
+    "inline bool True(double const v) { return v != 0.0; }\n"
+    "inline double Sgn(double const v) {\n"
+    "  return v > 0.0 ? 1.0 : (v < 0.0 ? -1.0 : 0.0);\n"
+    "}\n"
+    "inline double Clamp(double const l, double const v, double const u) {\n"
+    "  return v < l ? l : (v > u ? u : v);\n"
+    "}\n"
+    "} // namespace\n"
+    "extern \"C\" void alpaca_user_expression(double const *in, double *out,\n"
+    "    double (*random)(void *), void *generator) {\n";
+
+/**
+ * @brief Gives the lower case of a symbol, as the symbols of the expression
+ * toolkit are case insensitive.
+ * @param symbol The symbol.
+ * @return The symbol in lower case.
+ */
+std::string LowerCase(std::string symbol) {
+  for (char &character : symbol) {
+    character =
+        static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+  }
+  return symbol;
+}
+
+/**
+ * @brief Recursive descent translator of the expression toolkit syntax into
+ * the body of a C++ function. Inputs, outputs and all other variables are
+ * renamed by their index, such that the names of the user cannot clash with
+ * C++.
+ */
+class Translator {
+  std::string const &source_;
+  std::size_t position_ = 0;
+  std::unordered_map<std::string, std::size_t> inputs_;
+  std::unordered_map<std::string, std::size_t> outputs_;
+  std::unordered_map<std::string, std::size_t> locals_;
+  // variables assigned in the enclosing blocks, in any block and variables read
+  // before an assignment in the enclosing blocks
+  std::vector<std::unordered_set<std::string>> assigned_{1};
+  std::unordered_set<std::string> assigned_anywhere_;
+  std::unordered_set<std::string> read_unassigned_;
+  unsigned random_draws_ = 0;
+  // flag whether the last operand is a power
+  bool raised_to_power_ = false;
+  std::string body_;
+
+  [[noreturn]] void Fail(std::string const &reason) const {
+    throw std::invalid_argument("Expression cannot be compiled natively (" +
+                                reason + ") at position " +
+                                std::to_string(position_));
+  }
+
+  /**
+   * @brief Skips whitespace and comments.
+   */
+  void SkipWhitespace() {
+    while (position_ < source_.size()) {
+      if (std::isspace(static_cast<unsigned char>(source_[position_]))) {
+        position_++;
+      } else if (source_[position_] == '#' ||
+                 source_.compare(position_, 2, "//") == 0) {
+        position_ = std::min(source_.find('\n', position_), source_.size());
+      } else if (source_.compare(position_, 2, "/*") == 0) {
+        std::size_t const end = source_.find("*/", position_ + 2);
+        if (end == std::string::npos) {
+          Fail("unterminated comment");
+        }
+        position_ = end + 2;
+      } else {
+        return;
+      }
+    }
+  }
+
+  bool AtEnd() {
+    SkipWhitespace();
+    return position_ >= source_.size();
+  }
+
+  /**
+   * @brief Consumes the given operator if it follows.
+   * @param token The operator.
+   * @return True if the operator has been consumed.
+   */
+  bool Accept(std::string_view const token) {
+    SkipWhitespace();
+    if (source_.compare(position_, token.size(), token) == 0) {
+      position_ += token.size();
+      return true;
+    }
+    return false;
+  }
+
+  void Expect(std::string_view const token) {
+    if (!Accept(token)) {
+      Fail("expected '" + std::string(token) + "'");
+    }
+  }
+
+  /**
+   * @brief Consumes the next symbol.
+   * @return The symbol in lower case, empty if no symbol follows.
+   */
+  std::string Symbol() {
+    SkipWhitespace();
+    std::size_t end = position_;
+    if (end < source_.size() &&
+        std::isalpha(static_cast<unsigned char>(source_[end]))) {
+      while (end < source_.size() &&
+             (std::isalnum(static_cast<unsigned char>(source_[end])) ||
+              source_[end] == '_')) {
+        end++;
+      }
+    }
+    std::string const symbol =
+        LowerCase(source_.substr(position_, end - position_));
+    position_ = end;
+    return symbol;
+  }
+
+  /**
+   * @brief Consumes the given keyword if it follows.
+   * @param keyword The keyword in lower case.
+   * @return True if the keyword has been consumed.
+   */
+  bool AcceptKeyword(std::string const &keyword) {
+    std::size_t const start = position_;
+    if (Symbol() == keyword) {
+      return true;
+    }
+    position_ = start;
+    return false;
+  }
+
+  /**
+   * @brief Gives the C++ name of a variable that is read.
+   * @param symbol The symbol of the variable.
+   * @return The C++ name.
+   */
+  std::string Read(std::string const &symbol) {
+    if (auto const input = inputs_.find(symbol); input != inputs_.end()) {
+      return "i" + std::to_string(input->second);
+    }
+    if (std::none_of(
+            assigned_.begin(), assigned_.end(),
+            [&symbol](auto const &block) { return block.contains(symbol); })) {
+      read_unassigned_.insert(symbol);
+    }
+    return Local(symbol);
+  }
+
+  /**
+   * @brief Gives the C++ name of a variable that is assigned.
+   * @param symbol The symbol of the variable.
+   * @return The C++ name.
+   */
+  std::string Assign(std::string const &symbol) {
+    if (inputs_.contains(symbol)) {
+      Fail("assignment of the input " + symbol);
+    }
+    assigned_.back().insert(symbol);
+    assigned_anywhere_.insert(symbol);
+    return Local(symbol);
+  }
+
+  std::string Local(std::string const &symbol) {
+    if (auto const output = outputs_.find(symbol); output != outputs_.end()) {
+      return "o" + std::to_string(output->second);
+    }
+    if (reserved_symbols.contains(symbol)) {
+      Fail("unsupported symbol " + symbol);
+    }
+    return "l" + std::to_string(
+                     locals_.try_emplace(symbol, locals_.size()).first->second);
+  }
+
+  /**
+   * @brief Translates a sequence of statements up to the end of the source or
+   * the closing brace of a block.
+   * @param in_block Flag whether the statements form a block.
+   */
+  void Statements(bool const in_block) {
+    while (true) {
+      while (Accept(";")) {
+      }
+      if (in_block && Accept("}")) {
+        return;
+      }
+      if (AtEnd()) {
+        if (in_block) {
+          Fail("expected '}'");
+        }
+        return;
+      }
+      bool const ends_with_block = Statement();
+      if (!ends_with_block && !Accept(";") && !AtEnd() &&
+          !(in_block && source_[position_] == '}')) {
+        Fail("expected ';'");
+      }
+    }
+  }
+
+  /**
+   * @brief Translates a single statement.
+   * @return True if the statement ends with a block, i.e., needs no
+   * separator.
+   */
+  bool Statement() {
+    random_draws_ = 0;
+    std::size_t const start = position_;
+    if (AcceptKeyword("if") && Accept("(")) {
+      std::string const condition = Expression();
+      if (Accept(")")) {
+        return If(condition);
+      }
+    }
+    // a conditional function, not a statement
+    position_ = start;
+    random_draws_ = 0;
+    if (AcceptKeyword("var")) {
+      std::string const symbol = Symbol();
+      if (symbol.empty() || outputs_.contains(symbol)) {
+        Fail("invalid declaration");
+      }
+      std::string value = "0.0";
+      if (Accept(":=")) {
+        value = Expression();
+      }
+      body_ += "  " + Assign(symbol) + " = " + value + ";\n";
+      return false;
+    }
+    std::string const symbol = Symbol();
+    if (!symbol.empty()) {
+      if (Accept(":")) {
+        // the expression toolkit joins ": =" into an assignment
+        Expect("=");
+        std::string const value = Expression();
+        body_ += "  " + Assign(symbol) + " = " + value + ";\n";
+        return false;
+      }
+      for (char const *operation : {"+=", "-=", "*=", "/="}) {
+        if (Accept(operation)) {
+          std::string const value = Expression();
+          Read(symbol);
+          body_ +=
+              "  " + Assign(symbol) + " " + operation + " " + value + ";\n";
+          return false;
+        }
+      }
+    }
+    position_ = start;
+    body_ += "  static_cast<void>(" + Expression() + ");\n";
+    return false;
+  }
+
+  /**
+   * @brief Translates the branches of an if statement.
+   * @param condition The translated condition.
+   * @return True if the statement ends with a block.
+   */
+  bool If(std::string const &condition) {
+    body_ += "  if (True(" + condition + ")) {\n";
+    bool ends_with_block = Branch();
+    std::size_t const end_of_branch = position_;
+    Accept(";");
+    if (AcceptKeyword("else")) {
+      body_ += "  } else {\n";
+      ends_with_block = Branch();
+    } else {
+      position_ = end_of_branch;
+    }
+    body_ += "  }\n";
+    return ends_with_block;
+  }
+
+  bool Branch() {
+    assigned_.emplace_back();
+    bool ends_with_block = true;
+    if (Accept("{")) {
+      Statements(true);
+    } else {
+      ends_with_block = Statement();
+    }
+    assigned_.pop_back();
+    return ends_with_block;
+  }
+
+  std::string Expression() {
+    std::string const condition = Or();
+    if (Accept("?")) {
+      std::string const first = Expression();
+      Expect(":");
+      return "(True(" + condition + ") ? " + first + " : " + Expression() + ")";
+    }
+    return condition;
+  }
+
+  std::string Or() {
+    std::string result = And();
+    while (true) {
+      // the keywords evaluate both operands, the symbols short-circuit
+      if (AcceptKeyword("or")) {
+        result = "double(True(" + result + ") | True(" + And() + "))";
+      } else if (AcceptKeyword("xor")) {
+        result = "double(True(" + result + ") != True(" + And() + "))";
+      } else if (Accept("|")) {
+        result = "double(True(" + result + ") || True(" + And() + "))";
+      } else {
+        return result;
+      }
+    }
+  }
+
+  std::string And() {
+    std::string result = Comparison();
+    while (true) {
+      if (AcceptKeyword("and")) {
+        result = "double(True(" + result + ") & True(" + Comparison() + "))";
+      } else if (Accept("&")) {
+        result = "double(True(" + result + ") && True(" + Comparison() + "))";
+      } else {
+        return result;
+      }
+    }
+  }
+
+  std::string Comparison() {
+    std::string const left = Additive();
+    // two-character operators first
+    for (auto const &[token, operation] : {std::pair{"==", "=="},
+                                           {"!=", "!="},
+                                           {"<>", "!="},
+                                           {"<=", "<="},
+                                           {">=", ">="},
+                                           {"=", "=="},
+                                           {"<", "<"},
+                                           {">", ">"}}) {
+      if (Accept(token)) {
+        return "double(" + left + " " + operation + " " + Additive() + ")";
+      }
+    }
+    return left;
+  }
+
+  std::string Additive() {
+    std::string result = Multiplicative();
+    while (true) {
+      if (Accept("+")) {
+        result = "(" + result + " + " + Multiplicative() + ")";
+      } else if (Accept("-")) {
+        result = "(" + result + " - " + Multiplicative() + ")";
+      } else {
+        return result;
+      }
+    }
+  }
+
+  std::string Multiplicative() {
+    std::string result = Unary();
+    while (true) {
+      if (Accept("*")) {
+        result = "(" + result + " * " + Unary() + ")";
+      } else if (Accept("/")) {
+        result = "(" + result + " / " + Unary() + ")";
+      } else if (Accept("%")) {
+        result = "std::fmod(" + result + ", " + Unary() + ")";
+      } else {
+        return result;
+      }
+    }
+  }
+
+  std::string Unary() {
+    for (char const *operation : {"-", "+"}) {
+      if (Accept(operation)) {
+        std::string const operand = Power();
+        // the precedence of a sign before a power differs between notations
+        if (raised_to_power_) {
+          Fail("ambiguous sign of a power");
+        }
+        return "(" + std::string(operation) + operand + ")";
+      }
+    }
+    if (AcceptKeyword("not")) {
+      return "double(!True(" + Unary() + "))";
+    }
+    return Power();
+  }
+
+  std::string Power() {
+    std::string const base = Primary();
+    if (!Accept("^")) {
+      raised_to_power_ = false;
+      return base;
+    }
+    std::string exponent;
+    if (Accept("-")) {
+      exponent = "(-" + Primary() + ")";
+    } else {
+      Accept("+");
+      exponent = Primary();
+    }
+    // the associativity of chained powers differs between notations
+    if (Accept("^")) {
+      Fail("chained power");
+    }
+    raised_to_power_ = true;
+    return "std::pow(" + base + ", " + exponent + ")";
+  }
+
+  std::string Primary() {
+    SkipWhitespace();
+    if (position_ >= source_.size()) {
+      Fail("unexpected end");
+    }
+    char const next = source_[position_];
+    if (std::isdigit(static_cast<unsigned char>(next)) || next == '.') {
+      return Number();
+    }
+    for (auto const &[open, close] : {std::pair{"(", ")"}, {"[", "]"}}) {
+      if (Accept(open)) {
+        std::string const inner = Expression();
+        Expect(close);
+        return "(" + inner + ")";
+      }
+    }
+    std::string const symbol = Symbol();
+    if (symbol.empty()) {
+      Fail("unexpected character");
+    }
+    if (symbol == "true" || symbol == "false") {
+      return symbol == "true" ? "1.0" : "0.0";
+    }
+    if (symbol == "pi") {
+      return "3.141592653589793238462643383279502";
+    }
+    if (symbol == "inf") {
+      return "std::numeric_limits<double>::infinity()";
+    }
+    if (!Accept("(")) {
+      return Read(symbol);
+    }
+    return Call(symbol);
+  }
+
+  /**
+   * @brief Translates a function call whose opening parenthesis has been
+   * consumed.
+   * @param symbol The name of the function.
+   * @return The translated call.
+   */
+  std::string Call(std::string const &symbol) {
+    std::vector<std::string> arguments;
+    if (!Accept(")")) {
+      do {
+        arguments.push_back(Expression());
+      } while (Accept(","));
+      Expect(")");
+    }
+    if (symbol == "rand" && arguments.empty()) {
+      // the order of several draws in one statement is not specified in C++
+      if (++random_draws_ > 1) {
+        Fail("several random numbers in one statement");
+      }
+      return "random(generator)";
+    }
+    if (symbol == "if" && arguments.size() == 3) {
+      return "(True(" + arguments[0] + ") ? " + arguments[1] + " : " +
+             arguments[2] + ")";
+    }
+    auto const function = math_functions.find(symbol);
+    if (function == math_functions.end() ||
+        (function->second.variadic_
+             ? arguments.size() < function->second.arguments_
+             : arguments.size() != function->second.arguments_)) {
+      Fail("unsupported function " + symbol);
+    }
+    std::string call = std::string(function->second.name_) +
+                       (function->second.variadic_ ? "({" : "(");
+    for (std::size_t index = 0; index < arguments.size(); ++index) {
+      call += (index > 0 ? ", " : "") + arguments[index];
+    }
+    return call + (function->second.variadic_ ? "})" : ")");
+  }
+
+  std::string Number() {
+    char const *const start = source_.c_str() + position_;
+    char *end = nullptr;
+    std::strtod(start, &end);
+    if (end == start) {
+      Fail("invalid number");
+    }
+    std::string number(start, static_cast<std::size_t>(end - start));
+    position_ += number.size();
+    // integer literals would lead to integer arithmetic in C++
+    if (number.find_first_of(".eE") == std::string::npos) {
+      number += ".0";
+    }
+    return number;
+  }
+
+public:
+  Translator(std::string const &source,
+             std::vector<std::string> const &variables_out,
+             std::vector<std::string> const &variables_in)
+      : source_(source) {
+    for (std::size_t index = 0; index < variables_in.size(); ++index) {
+      inputs_.try_emplace(LowerCase(variables_in[index]), index);
+    }
+    for (std::size_t index = 0; index < variables_out.size(); ++index) {
+      if (!variables_out[index].empty() &&
+          !outputs_.try_emplace(LowerCase(variables_out[index]), index)
+               .second) {
+        Fail("duplicate output " + variables_out[index]);
+      }
+      if (inputs_.contains(LowerCase(variables_out[index]))) {
+        Fail("output " + variables_out[index] + " is an input");
+      }
+    }
+  }
+
+  /**
+   * @brief Translates the expression.
+   * @return The C++ source of the shared object.
+   */
+  std::string Translate() {
+    Statements(false);
+    // Variables of the expression toolkit keep their value between
+    // evaluations, the outputs are kept by the caller, all other variables
+    // have to be assigned before they are read
+    for (std::string const &symbol : read_unassigned_) {
+      if (assigned_anywhere_.contains(symbol) && !outputs_.contains(symbol)) {
+        Fail("variable " + symbol + " is read before its assignment");
+      }
+    }
+    std::string source = prologue;
+    for (auto const &[symbol, index] : inputs_) {
+      source += "  double const i" + std::to_string(index) + " = in[" +
+                std::to_string(index) + "];\n";
+    }
+    for (auto const &[symbol, index] : outputs_) {
+      source += "  double o" + std::to_string(index) + " = out[" +
+                std::to_string(index) + "];\n";
+    }
+    for (std::size_t index = 0; index < locals_.size(); ++index) {
+      source += "  double l" + std::to_string(index) + " = 0.0;\n";
+    }
+    source += body_;
+    for (auto const &[symbol, index] : outputs_) {
+      source += "  out[" + std::to_string(index) + "] = o" +
+                std::to_string(index) + ";\n";
+    }
+    source += "  static_cast<void>(random);\n"
+              "  static_cast<void>(generator);\n"
+              "}\n";
+    return source;
+  }
+};
+
+/**
+ * @brief Gives a private temporary directory of this run for the shared
+ * objects, used if no cache directory is available. It is removed at the end of
+ * the run.
+ * @return The directory, empty if it cannot be created.
+ */
+std::filesystem::path RunDirectory() {
+  struct TemporaryDirectory {
+    std::filesystem::path path_;
+    ~TemporaryDirectory() {
+      std::error_code error;
+      std::filesystem::remove_all(path_, error);
+    }
+  };
+  static TemporaryDirectory const directory = [] {
+    std::error_code error;
+    std::string name = (std::filesystem::temp_directory_path(error) /
+                        "alpaca_native_expressions_XXXXXX")
+                           .string();
+    // Creates the directory with access for the owner only
+    return TemporaryDirectory{error || ::mkdtemp(name.data()) == nullptr
+                                  ? std::filesystem::path()
+                                  : std::filesystem::path(name)};
+  }();
+  return directory.path_;
+}
+
+/**
+ * @brief Compiles a shared object. The key it was compiled for is embedded as
+ * symbol alpaca_user_expression_key.
+ * @param library The shared object, replaced if it exists.
+ * @param source The C++ source.
+ * @param key The key of the shared object ( compiler and source ).
+ * @param compiler The compiler command including its flags.
+ * @return True if the shared object was compiled, false otherwise.
+ */
+bool Build(std::filesystem::path const &library, std::string const &source,
+           std::string const &key, std::string const &compiler) {
+  std::string const process = "_" + std::to_string(::getpid());
+  std::filesystem::path const source_file =
+      library.parent_path() / (library.stem().string() + process + ".cpp");
+  std::filesystem::path const temporary_library =
+      library.parent_path() / (library.stem().string() + process + ".so");
+  {
+    std::ofstream output(source_file);
+    output << source
+           << "extern \"C\" unsigned char const alpaca_user_expression_key[] "
+              "= {";
+    for (char const character : key) {
+      output << static_cast<unsigned>(static_cast<unsigned char>(character))
+             << ',';
+    }
+    output << "0};\n";
+  }
+  std::string const command = compiler + " -fPIC -shared -o " +
+                              temporary_library.string() + " " +
+                              source_file.string() + " > /dev/null 2>&1";
+  bool const compiled = std::system(command.c_str()) == 0;
+  std::error_code error;
+  std::filesystem::remove(source_file, error);
+  if (compiled) {
+    std::filesystem::permissions(temporary_library,
+                                 std::filesystem::perms::owner_all, error);
+    if (!error) {
+      std::filesystem::rename(temporary_library, library, error);
+    }
+  }
+  if (!compiled || error) {
+    std::filesystem::remove(temporary_library, error);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Loads the function of a shared object if the object is private ( see
+ * NativeExpression::IsPrivate ) and was compiled for the given key.
+ * @param library The shared object.
+ * @param key The key of the shared object ( compiler and source ).
+ * @return The loaded function, null if the object does not exist, is not
+ * private or belongs to another key.
+ */
+NativeExpression::Function Load(std::filesystem::path const &library,
+                                std::string const &key) {
+  if (!NativeExpression::IsPrivate(library)) {
+    return nullptr;
+  }
+  void *const handle = ::dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (handle == nullptr) {
+    return nullptr;
+  }
+  auto const *const library_key =
+      static_cast<char const *>(::dlsym(handle, "alpaca_user_expression_key"));
+  if (library_key == nullptr || key != library_key) {
+    ::dlclose(handle);
+    return nullptr;
+  }
+  // The objects stay loaded until the end of the run
+  return reinterpret_cast<NativeExpression::Function>(
+      ::dlsym(handle, "alpaca_user_expression"));
+}
+
+} // namespace
+
+namespace NativeExpression {
+
+/**
+ * @brief Translates an expression into the C++ source of a shared object that
+ * defines the function alpaca_user_expression ( see Function ).
+ * @param expression The expression.
+ * @param variables_out The names of the output variables.
+ * @param variables_in The names of the input variables.
+ * @return The C++ source.
+ * @throws std::invalid_argument if the expression is not part of the subset
+ * that can be translated.
+ */
+std::string Translate(std::string const &expression,
+                      std::vector<std::string> const &variables_out,
+                      std::vector<std::string> const &variables_in) {
+  return Translator(expression, variables_out, variables_in).Translate();
+}
+
+/**
+ * @brief Gives the per-user directory the shared objects are cached in, i.e.,
+ * alpaca/native_expressions in $XDG_CACHE_HOME or, if not set, in
+ * $HOME/.cache. The directory is created with access for the owner only.
+ * @return The directory, empty if it cannot be created or is not private.
+ */
+std::filesystem::path CacheDirectory() {
+  std::filesystem::path base;
+  if (char const *const cache_home = std::getenv("XDG_CACHE_HOME");
+      cache_home != nullptr && *cache_home == '/') {
+    base = cache_home;
+  } else if (char const *const home = std::getenv("HOME");
+             home != nullptr && *home == '/') {
+    base = std::filesystem::path(home) / ".cache";
+  } else {
+    return {};
+  }
+  std::filesystem::path const directory =
+      base / "alpaca" / "native_expressions";
+  std::error_code error;
+  std::filesystem::create_directories(directory.parent_path(), error);
+  ::mkdir(directory.c_str(), S_IRWXU);
+  return IsPrivate(directory) ? directory : std::filesystem::path();
+}
+
+/**
+ * @brief Indicates whether a file or directory can only be modified by the
+ * current user, i.e., it is not a symbolic link, is owned by the effective user
+ * and is neither writable by the group nor by others.
+ * @param path The file or directory.
+ * @return True if the path is private, false otherwise or if it does not exist.
+ */
+bool IsPrivate(std::filesystem::path const &path) {
+  struct stat status;
+  if (::lstat(path.c_str(), &status) != 0) {
+    return false;
+  }
+  return (S_ISDIR(status.st_mode) || S_ISREG(status.st_mode)) &&
+         status.st_uid == ::geteuid() &&
+         (status.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+/**
+ * @brief Compiles the source of a shared object and loads its function. The
+ * shared objects are cached in the private CacheDirectory() under the hash of
+ * source and compiler, i.e., the same expression is compiled only once per
+ * user and machine. Without a cache directory, they are compiled into a
+ * private temporary directory of the run. Each process compiles into its own
+ * file that is renamed afterwards, such that ranks on the same machine can
+ * compile concurrently. Source and compiler are also embedded in the object
+ * and compared after loading, hence, objects of colliding hashes are compiled
+ * anew.
+ * @param source The C++ source.
+ * @param compiler The compiler command including its flags, e.g., "c++ -O2".
+ * @return The loaded function, null if compiling or loading fails.
+ */
+Function Compile(std::string const &source, std::string const &compiler) {
+  // Expressions are created per thread, the cache makes them share one object
+  static std::mutex mutex;
+  static std::unordered_map<std::string, Function> cache;
+  std::lock_guard<std::mutex> const lock(mutex);
+  std::string const key = compiler + '\n' + source;
+  if (auto const cached = cache.find(key); cached != cache.end()) {
+    return cached->second;
+  }
+  Function &function = cache[key];
+
+  std::filesystem::path directory = CacheDirectory();
+  if (directory.empty()) {
+    directory = RunDirectory();
+    if (directory.empty()) {
+      return function;
+    }
+  }
+  std::filesystem::path const library =
+      directory /
+      ("expression_" + std::to_string(std::hash<std::string>{}(key)) + ".so");
+  function = Load(library, key);
+  if (function == nullptr && Build(library, source, key, compiler)) {
+    function = Load(library, key);
+  }
+  return function;
+}
+
+/**
+ * @brief Creates the native function of an expression if enabled by the
+ * environment variable ALPACA_NATIVE_EXPRESSIONS, which gives the compiler
+ * command.
+ * @param expression The expression.
+ * @param variables_out The names of the output variables.
+ * @param variables_in The names of the input variables.
+ * @return The native function, null if not enabled or if the expression cannot
+ * be compiled natively.
+ */
+Function Create(std::string const &expression,
+                std::vector<std::string> const &variables_out,
+                std::vector<std::string> const &variables_in) {
+  char const *const compiler = std::getenv("ALPACA_NATIVE_EXPRESSIONS");
+  if (compiler == nullptr || *compiler == '\0') {
+    return nullptr;
+  }
+  try {
+    return Compile(Translate(expression, variables_out, variables_in),
+                   compiler);
+  } catch (std::invalid_argument const &) {
+    return nullptr;
+  }
+}
+
+} // namespace NativeExpression
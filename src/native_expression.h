@@ -0,0 +1,60 @@
+//===------------------------ native_expression.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef NATIVE_EXPRESSION_H
+#define NATIVE_EXPRESSION_H
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The NativeExpression namespace translates user expressions into C++
+ * and compiles them with the system compiler into a shared object, which is
+ * loaded at run time. It covers the subset of the expression toolkit syntax
+ * whose semantics can be reproduced exactly (assignments, arithmetic,
+ * comparisons, logical operators, conditionals, the common math functions and
+ * rand()). Everything else is rejected such that the UserExpression falls back
+ * to the interpreter.
+ */
+namespace NativeExpression {
+
+/**
+ * @brief Signature of a compiled expression. The inputs and outputs are passed
+ * in the order of their names, random numbers are drawn through the given
+ * function from the given generator.
+ */
+using Function = void (*)(double const *inputs, double *outputs,
+                          double (*random)(void *), void *generator);
+
+std::string Translate(std::string const &expression,
+                      std::vector<std::string> const &variables_out,
+                      std::vector<std::string> const &variables_in);
+std::filesystem::path CacheDirectory();
+bool IsPrivate(std::filesystem::path const &path);
+Function Compile(std::string const &source, std::string const &compiler);
+Function Create(std::string const &expression,
+                std::vector<std::string> const &variables_out,
+                std::vector<std::string> const &variables_in);
+
+} // namespace NativeExpression
+
+#endif // NATIVE_EXPRESSION_H
@@ -52,7 +52,7 @@ class ConstantMaterialParameterModel : public MaterialParameterModel {
   void DoUpdateParameter(Block &block, double const) const override {
 
     // extract the parameter from the block, which should be computed
-    double(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    ParameterValue(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetParameterBuffer(
             DerivedConstantMaterialParameterModel::parameter_buffer_type_);
 
@@ -83,7 +83,7 @@ class ConstantMaterialParameterModel : public MaterialParameterModel {
       std::int8_t const material_sign) const override {
 
     // extract the parameter from the block, which should be computed
-    double(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    ParameterValue(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetParameterBuffer(
             DerivedConstantMaterialParameterModel::parameter_buffer_type_);
 
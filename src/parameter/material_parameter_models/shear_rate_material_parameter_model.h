@@ -58,18 +58,42 @@ class ShearRateMaterialParameterModel : public MaterialParameterModel {
     // y and z velocity buffers may not be available
     // as workaround use the x velocity buffer in these cases
     // this is legal since the respective gradients are not computed/used anyway
-    double const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetPrimeStateBuffer(PrimeState::VelocityX);
-    double const(&v)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&v)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetPrimeStateBuffer(PrimeState::VelocityY);
-    double const(&w)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&w)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetPrimeStateBuffer(PrimeState::VelocityZ);
 
     // extract the shear viscosity from the block, which should be computed
-    double(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    ParameterValue(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetParameterBuffer(
             DerivedShearRateMaterialParameterModel::parameter_buffer_type_);
 
+    // If the velocity gradient of the stage is cached on the block, the shear
+    // rate and the parameter are computed in a single pass from it
+    if constexpr (CC::CacheVelocityGradient() &&
+                  DerivedShearRateMaterialParameterModel::derivative_stencil_ ==
+                      viscous_fluxes_derivative_stencil_cell_center) {
+      if (block.HasVelocityGradient()) {
+        double const(&velocity_gradient)[CC::TCX()][CC::TCY()][CC::TCZ()]
+                                        [DTI(CC::DIM())][DTI(CC::DIM())] =
+                                            block.GetVelocityGradient();
+        for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+          for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+            for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+              parameter_buffer[i][j][k] =
+                  static_cast<DerivedShearRateMaterialParameterModel const &>(
+                      *this)
+                      .ComputeParameter(ShearRateOperations::ComputeShearRate(
+                          velocity_gradient, i, j, k));
+            }
+          }
+        }
+        return;
+      }
+    }
+
     /**
      * Description for the positions of the Array:
      * [CC::TCX()]    [CC::TCY()]    [CC::TCZ()]
@@ -123,16 +147,16 @@ class ShearRateMaterialParameterModel : public MaterialParameterModel {
         DerivedShearRateMaterialParameterModel::derivative_stencil_>::type;
 
     // extract the velocities from the block
-    double const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetPrimeStateBuffer(PrimeState::VelocityX);
-    double const(&v)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&v)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetPrimeStateBuffer(PrimeState::VelocityY);
-    double const(&w)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&w)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetPrimeStateBuffer(PrimeState::VelocityZ);
 
     // extract the appropriate parameter buffer from the block, which should be
     // computed
-    double(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    ParameterValue(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetParameterBuffer(
             DerivedShearRateMaterialParameterModel::parameter_buffer_type_);
 
@@ -48,11 +48,11 @@ class TemperatureMaterialParameterModel : public MaterialParameterModel {
   void DoUpdateParameter(Block &block, double const) const override {
 
     // extract the temperature from the block
-    double const(&T)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&T)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetPrimeStateBuffer(PrimeState::Temperature);
 
     // extract the paramerer from the block, which should be computed
-    double(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    ParameterValue(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetParameterBuffer(
             DerivedTemperatureMaterialParameterModel::parameter_to_calculate_);
 
@@ -84,11 +84,11 @@ class TemperatureMaterialParameterModel : public MaterialParameterModel {
       std::int8_t const material_sign) const override {
 
     // extract the temperature from the block
-    double const(&T)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    FieldValue const(&T)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetPrimeStateBuffer(PrimeState::Temperature);
 
     // extract the parameter from the block, which should be computed
-    double(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    ParameterValue(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetParameterBuffer(
             DerivedTemperatureMaterialParameterModel::parameter_to_calculate_);
 
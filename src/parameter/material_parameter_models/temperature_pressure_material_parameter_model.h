@@ -55,7 +55,7 @@ class TemperaturePressureMaterialParameterModel
         block.GetPrimeStateBuffer(PrimeState::Pressure);
 
     // extract the shear viscosity from the block, which should be computed
-    double(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    ParameterValue(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetParameterBuffer(
             DerivedTemperaturePressureMaterialParameterModel::
                 parameter_to_calculate_);
@@ -96,7 +96,7 @@ class TemperaturePressureMaterialParameterModel
         block.GetPrimeStateBuffer(PrimeState::Pressure);
 
     // extract the parameter from the block, which should be computed
-    double(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+    ParameterValue(&parameter_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         block.GetParameterBuffer(
             DerivedTemperaturePressureMaterialParameterModel::
                 parameter_to_calculate_);
@@ -22,6 +22,39 @@
 #include "parameter/parameter_manager.h"
 
 #include "levelset/multi_phase_manager/material_sign_capsule.h"
+#include "stencils/spatial_derivative_stencils/derivative_stencil_setup.h"
+#include "stencils/stencil_utilities.h"
+#include "utilities/buffer_operations_stencils.h"
+
+namespace {
+/**
+ * @brief Computes the velocity gradient at the cell centers of a block and
+ * caches it on the block for the parameter models and the viscous fluxes.
+ * @param block The block under consideration (indirect return).
+ * @param cell_size The cell size of the block.
+ */
+void UpdateVelocityGradient(Block &block, double const cell_size) {
+  using DerivativeStencil = DerivativeStencilSetup::Concretize<
+      viscous_fluxes_derivative_stencil_cell_center>::type;
+
+  // y and z velocity buffers may not be available
+  // as workaround use the x velocity buffer in these cases
+  // this is legal since the respective gradients are not computed/used anyway
+  FieldValue const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      block.GetPrimeStateBuffer(PrimeState::VelocityX);
+  FieldValue const(&v)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      CC::DIM() != Dimension::One
+          ? block.GetPrimeStateBuffer(PrimeState::VelocityY)
+          : u;
+  FieldValue const(&w)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      CC::DIM() == Dimension::Three
+          ? block.GetPrimeStateBuffer(PrimeState::VelocityZ)
+          : u;
+
+  BO::Stencils::ComputeVectorGradientAtCellCenter<DerivativeStencil>(
+      u, v, w, cell_size, block.PrepareVelocityGradient());
+}
+} // namespace
 
 /**
  * @brief Standard constructor to create the ParameterManager object.
@@ -53,6 +86,17 @@ void ParameterManager::UpdateParameters(Node &node) const {
         MaterialSignCapsule::SignOfMaterial(phase.first);
     Material const &material = material_manager_.GetMaterial(phase.first);
 
+    // The velocity gradient is shared by all models and the viscous fluxes of
+    // the following right-hand side. Blocks cut by the interface compute it
+    // only in the cells of their material.
+    if constexpr (CC::CacheVelocityGradient()) {
+      if (node.HasLevelset()) {
+        phase.second.InvalidateVelocityGradient();
+      } else {
+        UpdateVelocityGradient(phase.second, cell_size);
+      }
+    }
+
     // Start block to update the material property models
     // Shear viscosity
     if constexpr (CC::ViscosityIsActive() && CC::ShearViscosityModelActive()) {
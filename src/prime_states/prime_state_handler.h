@@ -24,10 +24,25 @@
 
 #include "block_definitions/block.h"
 #include "block_definitions/field_material_definitions.h"
+#include "materials/equation_of_state_dispatch.h"
 #include "materials/equations_of_state/gamma_model_stiffened_gas.h"
 #include "materials/material_manager.h"
 #include "user_specifications/equation_settings.h"
 
+template <typename EquationOfStateType, typename PrimeStatesContainerType,
+          typename ConservativesContainerType>
+inline void PrimeStatesToConservatives(
+    EquationOfStateType const &eos,
+    PrimeStatesContainerType const &prime_states_container,
+    ConservativesContainerType &conservatives_container);
+
+template <typename EquationOfStateType, typename ConservativesContainerType,
+          typename PrimeStatesContainerType>
+inline void ConservativesToPrimeStates(
+    EquationOfStateType const &eos,
+    ConservativesContainerType const &conservatives_container,
+    PrimeStatesContainerType &prime_states_container);
+
 /**
  * @brief This class handles the conversion between conservative and prime state
  * values for full buffers or single cells.
@@ -79,14 +94,40 @@ public:
   void ConvertPrimeStatesToConservatives(MaterialName const &material,
                                          PrimeStates const &prime_states,
                                          Conservatives &conservatives) const {
-    for (unsigned int i = 0; i < CC::TCX(); ++i) {
-      for (unsigned int j = 0; j < CC::TCY(); ++j) {
-        for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-          ConvertPrimeStatesToConservatives(material, prime_states,
-                                            conservatives, i, j, k);
-        }
-      }
-    }
+    ConvertPrimeStatesToConservatives(material, prime_states, conservatives,
+                                      {0, 0, 0},
+                                      {CC::TCX(), CC::TCY(), CC::TCZ()});
+  }
+
+  /**
+   * @brief Converts prime state to conservative values for all cells in the
+   * given index range of the buffers. The range is traversed along contiguous
+   * k-lines with all fields of a cell processed at once.
+   * @param material Material identifier of the material under consideration.
+   * @param prime_states The input PrimeStates buffer.
+   * @param conservatives The output Conservatives buffer.
+   * @param start First cell index (inclusive) in each direction.
+   * @param end Last cell index (exclusive) in each direction.
+   * @note The equation of state is resolved once for the whole range.
+   */
+  void ConvertPrimeStatesToConservatives(
+      MaterialName const &material, PrimeStates const &prime_states,
+      Conservatives &conservatives, std::array<unsigned int, 3> const &start,
+      std::array<unsigned int, 3> const &end) const {
+    VisitEquationOfState(
+        material_manager_.GetMaterial(material).GetEquationOfState(),
+        [&](auto const &eos) {
+          for (unsigned int i = start[0]; i < end[0]; ++i) {
+            for (unsigned int j = start[1]; j < end[1]; ++j) {
+#pragma omp simd
+              for (unsigned int k = start[2]; k < end[2]; ++k) {
+                auto &&conservatives_cell = conservatives.GetCellView(i, j, k);
+                PrimeStatesToConservatives(
+                    eos, prime_states.GetCellView(i, j, k), conservatives_cell);
+              }
+            }
+          }
+        });
   }
 
   /**
@@ -141,14 +182,40 @@ public:
   void ConvertConservativesToPrimeStates(MaterialName const &material,
                                          Conservatives const &conservatives,
                                          PrimeStates &prime_states) const {
-    for (unsigned int i = 0; i < CC::TCX(); ++i) {
-      for (unsigned int j = 0; j < CC::TCY(); ++j) {
-        for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-          ConvertConservativesToPrimeStates(material, conservatives,
-                                            prime_states, i, j, k);
-        }
-      }
-    }
+    ConvertConservativesToPrimeStates(material, conservatives, prime_states,
+                                      {0, 0, 0},
+                                      {CC::TCX(), CC::TCY(), CC::TCZ()});
+  }
+
+  /**
+   * @brief Converts conservative to prime state values for all cells in the
+   * given index range of the buffers. The range is traversed along contiguous
+   * k-lines with all fields of a cell processed at once.
+   * @param material Material identifier of the material under consideration.
+   * @param conservatives The input Conservatives buffer.
+   * @param prime_states The output PrimeStates buffer.
+   * @param start First cell index (inclusive) in each direction.
+   * @param end Last cell index (exclusive) in each direction.
+   * @note The equation of state is resolved once for the whole range.
+   */
+  void ConvertConservativesToPrimeStates(
+      MaterialName const &material, Conservatives const &conservatives,
+      PrimeStates &prime_states, std::array<unsigned int, 3> const &start,
+      std::array<unsigned int, 3> const &end) const {
+    VisitEquationOfState(
+        material_manager_.GetMaterial(material).GetEquationOfState(),
+        [&](auto const &eos) {
+          for (unsigned int i = start[0]; i < end[0]; ++i) {
+            for (unsigned int j = start[1]; j < end[1]; ++j) {
+#pragma omp simd
+              for (unsigned int k = start[2]; k < end[2]; ++k) {
+                auto &&prime_states_cell = prime_states.GetCellView(i, j, k);
+                ConservativesToPrimeStates(
+                    eos, conservatives.GetCellView(i, j, k), prime_states_cell);
+              }
+            }
+          }
+        });
   }
 
   /**
@@ -192,10 +259,10 @@ public:
   }
 };
 
-template <typename PrimeStatesContainerType,
+template <typename EquationOfStateType, typename PrimeStatesContainerType,
           typename ConservativesContainerType>
 inline void PrimeStatesToConservatives(
-    EquationOfState const &eos,
+    EquationOfStateType const &eos,
     PrimeStatesContainerType const &prime_states_container,
     ConservativesContainerType &conservatives_container) {
   if constexpr (MF::IsEquationActive(Equation::Mass) &&
@@ -274,10 +341,10 @@ inline void PrimeStatesToConservatives(
   }
 }
 
-template <typename ConservativesContainerType,
+template <typename EquationOfStateType, typename ConservativesContainerType,
           typename PrimeStatesContainerType>
 inline void ConservativesToPrimeStates(
-    EquationOfState const &eos,
+    EquationOfStateType const &eos,
     ConservativesContainerType const &conservatives_container,
     PrimeStatesContainerType &prime_states_container) {
   if constexpr (MF::IsPrimeStateActive(PrimeState::Density) &&
@@ -0,0 +1,197 @@
+//===----------------------- simulation_context.cpp -----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "simulation_context.h"
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "communication/communication_statistics.h"
+#include "input_output/hdf5/hdf5_manager.h"
+#include "input_output/log_writer/log_writer.h"
+#include "utilities/runtime_profiler.h"
+
+namespace {
+/**
+ * @brief The contexts bound on any thread of the process.
+ */
+struct BoundContexts {
+  // Number of active bindings over all contexts, read without locking
+  std::atomic<std::size_t> number_of_bindings_ = 0;
+  std::mutex mutex_;
+  // Number of active bindings of each context
+  std::unordered_map<SimulationContext *, std::size_t> bindings_of_context_;
+};
+
+/**
+ * @brief Gives the contexts bound in the process.
+ * @return The process-wide bookkeeping of the bound contexts.
+ */
+BoundContexts &ProcessBoundContexts() {
+  static BoundContexts bound_contexts;
+  return bound_contexts;
+}
+} // namespace
+
+/**
+ * @brief Creates a context whose members are created on first use.
+ * @param communicator The communicator all ranks of the simulation belong to.
+ */
+SimulationContext::SimulationContext(MPI_Comm const communicator)
+    : communicator_(communicator) {
+  /** Empty besides initializer list */
+}
+
+/**
+ * @brief Default destructor. Must be called by all ranks before MPI is
+ * finalized if the hdf5 manager of the context was used.
+ */
+SimulationContext::~SimulationContext() = default;
+
+/**
+ * @brief Gives the context bound to the calling thread.
+ * @return Reference to the pointer to the bound context (nullptr if none is
+ * bound).
+ */
+SimulationContext *&SimulationContext::BoundContext() {
+  thread_local SimulationContext *bound_context = nullptr;
+  return bound_context;
+}
+
+/**
+ * @brief Gives the context that is bound in the process, on whichever thread.
+ * Throws if several contexts are bound, since the caller cannot be assigned to
+ * one of them.
+ * @return The only bound context, nullptr if none is bound.
+ */
+SimulationContext *SimulationContext::SoleBoundContext() {
+  BoundContexts &bound_contexts = ProcessBoundContexts();
+  if (bound_contexts.number_of_bindings_ == 0) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> const lock(bound_contexts.mutex_);
+  if (bound_contexts.bindings_of_context_.empty()) {
+    return nullptr;
+  }
+  if (bound_contexts.bindings_of_context_.size() > 1) {
+    throw std::logic_error(
+        "Several simulation contexts are bound, threads without a binding "
+        "(e.g. OpenMP workers) must bind the context of their simulation");
+  }
+  return bound_contexts.bindings_of_context_.begin()->first;
+}
+
+/**
+ * @brief Gives the context of the simulation run by the calling thread.
+ * @return The context bound to the thread. On threads without a binding, the
+ * only context bound in the process or the default context if none is bound.
+ */
+SimulationContext &SimulationContext::Current() {
+  if (SimulationContext *const bound = BoundContext(); bound != nullptr) {
+    return *bound;
+  }
+  if (SimulationContext *const sole = SoleBoundContext(); sole != nullptr) {
+    return *sole;
+  }
+  static SimulationContext default_context;
+  return default_context;
+}
+
+/**
+ * @brief Binds the context to the calling thread.
+ * @param context The context of the simulation run by the thread.
+ */
+SimulationContext::Binding::Binding(SimulationContext &context)
+    : previous_context_(BoundContext()), context_(context) {
+  BoundContexts &bound_contexts = ProcessBoundContexts();
+  {
+    std::lock_guard<std::mutex> const lock(bound_contexts.mutex_);
+    bound_contexts.bindings_of_context_[&context_]++;
+  }
+  bound_contexts.number_of_bindings_++;
+  BoundContext() = &context_;
+}
+
+/**
+ * @brief Restores the previously bound context.
+ */
+SimulationContext::Binding::~Binding() {
+  BoundContext() = previous_context_;
+  BoundContexts &bound_contexts = ProcessBoundContexts();
+  bound_contexts.number_of_bindings_--;
+  std::lock_guard<std::mutex> const lock(bound_contexts.mutex_);
+  auto const bindings = bound_contexts.bindings_of_context_.find(&context_);
+  if (--bindings->second == 0) {
+    bound_contexts.bindings_of_context_.erase(bindings);
+  }
+}
+
+/**
+ * @brief Gives the logger of the context. It is created with the given streams
+ * on the first call, the streams of later calls are ignored.
+ * @param terminal_output The stream of the messages written to the terminal.
+ * @param file_output The stream of the messages written to the logfile.
+ * @return The logger.
+ */
+LogWriter &
+SimulationContext::Logger(std::unique_ptr<std::stringstream> &&terminal_output,
+                          std::unique_ptr<std::stringstream> &&file_output) {
+  if (!logger_) {
+    logger_.reset(
+        new LogWriter(std::move(terminal_output), std::move(file_output)));
+  }
+  return *logger_;
+}
+
+/**
+ * @brief Gives the hdf5 manager of the context.
+ * @return The hdf5 manager.
+ */
+Hdf5Manager &SimulationContext::Hdf5() {
+  if (!hdf5_manager_) {
+    hdf5_manager_.reset(new Hdf5Manager());
+  }
+  return *hdf5_manager_;
+}
+
+/**
+ * @brief Gives the runtime profiler of the context.
+ * @return The runtime profiler.
+ */
+RuntimeProfiler &SimulationContext::Profiler() {
+  if (!profiler_) {
+    profiler_.reset(new RuntimeProfiler());
+  }
+  return *profiler_;
+}
+
+/**
+ * @brief Gives the communication statistics of the context.
+ * @return The communication statistics.
+ */
+CommunicationStatistics &SimulationContext::Statistics() {
+  if (!communication_statistics_) {
+    communication_statistics_ = std::make_unique<CommunicationStatistics>();
+  }
+  return *communication_statistics_;
+}
@@ -0,0 +1,114 @@
+//===------------------------ simulation_context.h ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef SIMULATION_CONTEXT_H
+#define SIMULATION_CONTEXT_H
+
+#include <memory>
+#include <mpi.h>
+#include <sstream>
+
+class LogWriter;
+class Hdf5Manager;
+class RuntimeProfiler;
+struct CommunicationStatistics;
+
+/**
+ * @brief The SimulationContext holds the state that is shared by all instances
+ * of one simulation, i.e., the logger, the hdf5 manager, the runtime profiler,
+ * the communication statistics and the simulation communicator. The Instance()
+ * functions of these classes resolve to the context bound to the calling
+ * thread (see Binding). Threads without a binding, e.g. OpenMP workers, resolve
+ * to the only context bound in the process and to a process-wide default
+ * context if none is bound. Hence, several simulations can run concurrently in
+ * one process, each on its own thread with its own bound context.
+ * @note The members are created on first use. The logger of a new context is
+ * silent unless it is instantiated while the context is bound (see
+ * Instantiation::InstantiateLogWriter). Concurrent outputs of several contexts
+ * require a thread-safe hdf5 build.
+ * @note Not all state is held per simulation. While several contexts are bound,
+ * threads without a binding cannot resolve their context and throw. The
+ * material signs of the level set (see MaterialSignCapsule) are process-wide,
+ * hence, concurrent multi-phase simulations must use the same number of
+ * materials. The storage pools of blocks and nodes (see StoragePool) are
+ * shared by all simulations of the process by design.
+ */
+class SimulationContext {
+
+  MPI_Comm communicator_;
+  std::unique_ptr<LogWriter> logger_;
+  std::unique_ptr<Hdf5Manager> hdf5_manager_;
+  std::unique_ptr<RuntimeProfiler> profiler_;
+  std::unique_ptr<CommunicationStatistics> communication_statistics_;
+
+  static SimulationContext *&BoundContext();
+  static SimulationContext *SoleBoundContext();
+
+public:
+  explicit SimulationContext(MPI_Comm const communicator = MPI_COMM_WORLD);
+  ~SimulationContext();
+  SimulationContext(SimulationContext const &) = delete;
+  SimulationContext &operator=(SimulationContext const &) = delete;
+  SimulationContext(SimulationContext &&) = delete;
+  SimulationContext &operator=(SimulationContext &&) = delete;
+
+  static SimulationContext &Current();
+
+  LogWriter &
+  Logger(std::unique_ptr<std::stringstream> &&terminal_output = nullptr,
+         std::unique_ptr<std::stringstream> &&file_output = nullptr);
+  Hdf5Manager &Hdf5();
+  RuntimeProfiler &Profiler();
+  CommunicationStatistics &Statistics();
+
+  /**
+   * @brief Gives the communicator that all ranks of the simulation belong to.
+   * @return The simulation communicator.
+   */
+  MPI_Comm Communicator() const { return communicator_; }
+  /**
+   * @brief Sets the communicator that all ranks of the simulation belong to.
+   * @param communicator The simulation communicator.
+   */
+  void SetCommunicator(MPI_Comm const communicator) {
+    communicator_ = communicator;
+  }
+
+  /**
+   * @brief Binds a context to the calling thread during its lifetime. The
+   * previously bound context is restored when it goes out of scope.
+   */
+  class Binding {
+    SimulationContext *const previous_context_;
+    SimulationContext &context_;
+
+  public:
+    explicit Binding(SimulationContext &context);
+    ~Binding();
+    Binding() = delete;
+    Binding(Binding const &) = delete;
+    Binding &operator=(Binding const &) = delete;
+    Binding(Binding &&) = delete;
+    Binding &operator=(Binding &&) = delete;
+  };
+};
+
+#endif // SIMULATION_CONTEXT_H
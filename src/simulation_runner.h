@@ -22,12 +22,15 @@
 #ifndef SIMULATION_RUNNER_H
 #define SIMULATION_RUNNER_H
 
+#include <filesystem>
+
 #include "input_output/log_writer/log_writer.h"
 #include "input_output/log_writer/logging.h"
 
 #include "instantiation/halo_manager/instantiation_external_halo_manager.h"
 #include "instantiation/halo_manager/instantiation_halo_manager.h"
 #include "instantiation/halo_manager/instantiation_internal_halo_manager.h"
+#include "instantiation/input_output/instantiation_in_situ_analysis.h"
 #include "instantiation/input_output/instantiation_input_output_manager.h"
 #include "instantiation/input_output/instantiation_output_writer.h"
 #include "instantiation/input_output/instantiation_restart_manager.h"
@@ -41,7 +44,9 @@
 #include "instantiation/topology/instantiation_tree.h"
 
 #include "communication/mpi_utilities.h"
+#include "simulation_context.h"
 #include "user_specifications/space_filling_curve_settings.h"
+#include "utilities/phase_timer.h"
 
 namespace Simulation {
 
@@ -49,9 +54,12 @@ namespace Simulation {
  * @brief Run simulation of ALPACA.
  * @param input_reader Reader that is used to provide user-information from an
  * input file.
+ * @return The output folder of the simulation.
  */
-void Run(InputReader const &input_reader) {
+std::filesystem::path Run(InputReader const &input_reader) {
   LogWriter &logger = LogWriter::Instance();
+  // Measures the phases from launch to the first time step
+  PhaseTimer startup_timer;
 
   auto const input_file = input_reader.GetInputFile();
 
@@ -70,18 +78,22 @@ void Run(InputReader const &input_reader) {
                     std::to_string(MpiUtilities::NumberOfRanks()));
   logger.LogMessage(
       "Load balancing      : " +
-      SpaceFillingCurveSettings::SpaceFillingCurveSelectionString());
+      SpaceFillingCurveSettings::SpaceFillingCurveSelectionString(
+          input_reader.GetMultiResolutionReader().ReadSpaceFillingCurve()));
   logger.LogBreakLine();
   logger.Flush();
+  startup_timer.Lap("Output folder and logging");
 
   // Instance for dimensionalization and non-dimensionalization of variables
   UnitHandler const unit_handler(
       Instantiation::InstantiateUnitHandler(input_reader));
+  startup_timer.Lap("Unit handler");
   logger.LogBreakLine();
   logger.Flush();
   // Instance for handling of material and material pairing data
   MaterialManager const material_manager(
       Instantiation::InstantiateMaterialManager(input_reader, unit_handler));
+  startup_timer.Lap("Material manager");
   logger.LogBreakLine();
   logger.Flush();
   // Instance for handling global node data (cannot be const due to changes in
@@ -90,17 +102,21 @@ void Run(InputReader const &input_reader) {
       input_reader, material_manager));
   Tree tree(Instantiation::InstantiateTree(input_reader, topology_manager,
                                            unit_handler));
+  startup_timer.Lap("Topology manager and tree");
   logger.LogBreakLine();
   logger.Flush();
   // Instance that provides multi-resolution information
   Multiresolution const multiresolution(
       Instantiation::InstantiateMultiresolution(input_reader,
                                                 topology_manager));
+  startup_timer.Lap("Multiresolution");
   logger.LogBreakLine();
   logger.Flush();
   // Instance to provide communication
   CommunicationManager communication_manager(
-      Instantiation::InstantiateCommunicationManager(topology_manager));
+      Instantiation::InstantiateCommunicationManager(input_reader,
+                                                     topology_manager));
+  startup_timer.Lap("Communication manager and datatypes");
   // Instances for handling boundary conditions (internal and external). The
   // external and internal halo managers are not instantiated inside the halo
   // manager due to delete move constructors of both classes. A creation of the
@@ -116,18 +132,24 @@ void Run(InputReader const &input_reader) {
   HaloManager halo_manager(Instantiation::InstantiateHaloManager(
       topology_manager, tree, external_halo_manager, internal_halo_manager,
       communication_manager));
+  startup_timer.Lap("Halo managers");
   logger.LogBreakLine();
   logger.Flush();
   // Instance to restart simulation from snapshot and write output files (cannot
   // be const due to vector eraseing inside)
   OutputWriter const output_writer(Instantiation::InstantiateOutputWriter(
-      topology_manager, tree, material_manager, unit_handler));
-  RestartManager const restart_manager(Instantiation::InstantiateRestartManager(
+      input_reader, topology_manager, tree, material_manager, unit_handler));
+  RestartManager restart_manager(Instantiation::InstantiateRestartManager(
       topology_manager, tree, unit_handler));
+  InSituAnalysis const in_situ_analysis(
+      Instantiation::InstantiateInSituAnalysis(input_reader, topology_manager,
+                                               tree, material_manager,
+                                               unit_handler));
   InputOutputManager input_output_manager(
       Instantiation::InstantiateInputOutputManager(
-          input_reader, output_writer, restart_manager, unit_handler,
-          output_folder));
+          input_reader, output_writer, restart_manager, in_situ_analysis,
+          unit_handler, output_folder));
+  startup_timer.Lap("Input/output");
   logger.LogBreakLine();
   logger.Flush();
   // Instance for handling the initial conditions of the simulation
@@ -135,6 +157,7 @@ void Run(InputReader const &input_reader) {
       Instantiation::InstantiateInitialCondition(input_reader, topology_manager,
                                                  tree, material_manager,
                                                  unit_handler));
+  startup_timer.Lap("Initial condition instantiation");
   logger.LogBreakLine();
   logger.Flush();
   // Instance for the whole computation loop
@@ -143,18 +166,42 @@ void Run(InputReader const &input_reader) {
           input_reader, topology_manager, tree, communication_manager,
           halo_manager, multiresolution, material_manager, input_output_manager,
           unit_handler));
+  startup_timer.Lap("Algorithm assembler");
   logger.LogBreakLine();
   logger.Flush();
 
   // Initialize the simulation
-  mr_based_algorithm.Initialization(*initial_condition);
+  mr_based_algorithm.Initialization(*initial_condition, startup_timer);
   // Delete the initial condition by setting it to null
   initial_condition = nullptr;
+  logger.LogMessage("Startup phases ( launch to first time step ):");
+  for (std::string const &line : startup_timer.Summary()) {
+    logger.LogMessage(line);
+  }
+  logger.LogBreakLine();
+  logger.Flush();
   // Start loop computation
   mr_based_algorithm.ComputeLoop();
 
   logger.LogBreakLine();
   logger.Flush();
+  return output_folder;
+}
+
+/**
+ * @brief Run simulation of ALPACA within the given context, e.g. one of
+ * several simulations run concurrently on different threads of one process.
+ * @param input_reader Reader that is used to provide user-information from an
+ * input file.
+ * @param context The context holding the logger, the hdf5 manager, the
+ * profiler, the communication statistics and the communicator of the
+ * simulation.
+ * @return The output folder of the simulation.
+ */
+std::filesystem::path Run(InputReader const &input_reader,
+                          SimulationContext &context) {
+  SimulationContext::Binding const binding(context);
+  return Run(input_reader);
 }
 
 } // namespace Simulation
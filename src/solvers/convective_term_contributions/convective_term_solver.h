@@ -22,6 +22,8 @@
 #ifndef CONVECTIVE_TERM_SOLVER_H
 #define CONVECTIVE_TERM_SOLVER_H
 
+#include <array>
+
 #include "block_definitions/block.h"
 #include "materials/material_manager.h"
 #include "solvers/eigendecomposition.h"
@@ -63,6 +65,11 @@ public:
    * @param cell_size The size of the cells in the block.
    * @param fluxes_x, fluxes_y, fluxes_z The fluxes over the cell faces as
    * computed by this Riemann solver. Indirect return parameter.
+   * @param volume_forces The volume forces of the convective term. Indirect
+   * return parameter.
+   * @param given_lower_faces Indicates per direction whether the fluxes over
+   * the lower-most faces are already given in the flux arrays. These faces are
+   * then neither reconstructed nor solved.
    */
   void UpdateConvectiveFluxes(
       std::pair<MaterialName const, Block> const &mat_block,
@@ -73,11 +80,12 @@ public:
           &fluxes_y)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
       double (
           &fluxes_z)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
-      double (
-          &volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()]) const {
+      double (&volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()],
+      std::array<bool, 3> const &given_lower_faces = {false, false,
+                                                      false}) const {
     static_cast<DerivedConvectiveTermSolver const &>(*this)
         .UpdateImplementation(mat_block, cell_size, fluxes_x, fluxes_y,
-                              fluxes_z, volume_forces);
+                              fluxes_z, volume_forces, given_lower_faces);
   }
 };
 
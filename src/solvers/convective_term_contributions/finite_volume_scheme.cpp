@@ -20,6 +20,10 @@
 //
 //===----------------------------------------------------------------------===//
 #include "solvers/convective_term_contributions/finite_volume_scheme.h"
+
+#include <stdexcept>
+#include <utility>
+
 #include "stencils/stencil_utilities.h"
 
 /**
@@ -27,16 +31,73 @@
  * EigenDecomposition object.
  * @param material_manager .
  * @param eigendecomposition_calculator .
+ * @param stencil The reconstruction stencil of the convective fluxes, must be
+ * one of runtime_reconstruction_stencils.
  */
 FiniteVolumeScheme::FiniteVolumeScheme(
     MaterialManager const &material_manager,
-    EigenDecomposition const &eigendecomposition_calculator)
+    EigenDecomposition const &eigendecomposition_calculator,
+    ReconstructionStencils const stencil)
     : ConvectiveTermSolver(material_manager, eigendecomposition_calculator),
       riemann_solver_(material_manager, eigendecomposition_calculator_),
-      state_reconstruction_() {
+      state_reconstruction_(), compute_fluxes_(SelectFluxFunctions(stencil)) {
   /* Empty besides initializer list*/
 }
 
+/**
+ * @brief Gives the flux kernels of all active directions for a reconstruction
+ * stencil.
+ * @tparam RECON The reconstruction stencil.
+ * @return The kernels in x-, y- and z-direction (nullptr for inactive ones).
+ */
+template <ReconstructionStencils RECON>
+std::array<FiniteVolumeScheme::FluxFunction, 3>
+FiniteVolumeScheme::FluxFunctionsOfStencil() {
+  static_assert(ReconstructionStencilSetup::Concretize<
+                    RECON>::type::DownstreamStencilSize() < CC::HS(),
+                "Halo size not enough for a runtime reconstruction stencil. "
+                "Increase the halo size in compile_time_constants.h!");
+  std::array<FluxFunction, 3> functions = {
+      &FiniteVolumeScheme::ComputeFluxes<Direction::X, RECON>, nullptr,
+      nullptr};
+  if constexpr (CC::DIM() != Dimension::One) {
+    functions[1] = &FiniteVolumeScheme::ComputeFluxes<Direction::Y, RECON>;
+  }
+  if constexpr (CC::DIM() == Dimension::Three) {
+    functions[2] = &FiniteVolumeScheme::ComputeFluxes<Direction::Z, RECON>;
+  }
+  return functions;
+}
+
+/**
+ * @brief Selects the flux kernels of the given reconstruction stencil among
+ * the compiled ones. Called once on construction, the kernels themselves are
+ * fully specialized for their stencil.
+ * @param stencil The reconstruction stencil.
+ * @return The kernels in x-, y- and z-direction.
+ * @note Throws if the stencil is not one of runtime_reconstruction_stencils.
+ */
+std::array<FiniteVolumeScheme::FluxFunction, 3>
+FiniteVolumeScheme::SelectFluxFunctions(ReconstructionStencils const stencil) {
+  std::array<FluxFunction, 3> functions = {nullptr, nullptr, nullptr};
+  [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+    ((runtime_reconstruction_stencils[Indices] == stencil
+          ? (void)(functions = FluxFunctionsOfStencil<
+                       runtime_reconstruction_stencils[Indices]>())
+          : (void)0),
+     ...);
+  }
+  (std::make_index_sequence<runtime_reconstruction_stencils.size()>());
+  if (functions[0] == nullptr) {
+    throw std::invalid_argument(
+        "Reconstruction stencil " +
+        ReconstructionStencilSetup::StencilToString(stencil) +
+        " is not compiled, add it to runtime_reconstruction_stencils in "
+        "stencil_setup.h!");
+  }
+  return functions;
+}
+
 /**
  * @brief Solving the convective term of the system. Using dimension splitting
  * for fluxes in x, y, and z- direction. Also See base class.
@@ -48,71 +109,24 @@ void FiniteVolumeScheme::UpdateImplementation(
     double (&fluxes_x)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
     double (&fluxes_y)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
     double (&fluxes_z)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
-    double (
-        &volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()]) const {
-
-  double roe_eigenvectors_left[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                              [MF::ANOE()][MF::ANOE()];
-  double roe_eigenvectors_right[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                               [MF::ANOE()][MF::ANOE()];
-  double roe_eigenvalues[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                        [MF::ANOE()];
+    double (&volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()],
+    std::array<bool, 3> const &given_lower_faces) const {
 
   double u_hllc_x[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
   double u_hllc_y[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
   double u_hllc_z[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
 
-  constexpr bool require_eigendecomposition =
-      (active_equations == EquationSet::NavierStokes ||
-       active_equations == EquationSet::Euler) &&
-      state_reconstruction_type == StateReconstructionType::Characteristic;
-
-  if constexpr (require_eigendecomposition) {
-    // Setting the eigenvectors, eigenvalues to zero is necessary for two-phase
-    // simulations as not every entry is necessarily set during
-    // eigendecomposition
-    for (unsigned int i = 0; i < CC::ICX() + 1; ++i) {
-      for (unsigned int j = 0; j < CC::ICY() + 1; ++j) {
-        for (unsigned int k = 0; k < CC::ICZ() + 1; ++k) {
-          for (unsigned int e = 0; e < MF::ANOE(); ++e) {
-            for (unsigned int f = 0; f < MF::ANOE(); ++f) {
-              roe_eigenvectors_left[i][j][k][e][f] = 0.0;
-              roe_eigenvectors_right[i][j][k][e][f] = 0.0;
-            }
-            roe_eigenvalues[i][j][k][e] = 0.0;
-          }
-        }
-      }
-    }
-
-    eigendecomposition_calculator_.ComputeRoeEigendecomposition<Direction::X>(
-        mat_block, roe_eigenvectors_left, roe_eigenvectors_right,
-        roe_eigenvalues);
-  }
-  ComputeFluxes<Direction::X>(mat_block, fluxes_x, u_hllc_x,
-                              roe_eigenvectors_left, roe_eigenvectors_right,
-                              cell_size);
+  (this->*compute_fluxes_[0])(mat_block, fluxes_x, u_hllc_x, cell_size,
+                              given_lower_faces[0]);
 
   if constexpr (CC::DIM() != Dimension::One) {
-    if constexpr (require_eigendecomposition) {
-      eigendecomposition_calculator_.ComputeRoeEigendecomposition<Direction::Y>(
-          mat_block, roe_eigenvectors_left, roe_eigenvectors_right,
-          roe_eigenvalues);
-    }
-    ComputeFluxes<Direction::Y>(mat_block, fluxes_y, u_hllc_y,
-                                roe_eigenvectors_left, roe_eigenvectors_right,
-                                cell_size);
+    (this->*compute_fluxes_[1])(mat_block, fluxes_y, u_hllc_y, cell_size,
+                                given_lower_faces[1]);
   }
 
   if constexpr (CC::DIM() == Dimension::Three) {
-    if constexpr (require_eigendecomposition) {
-      eigendecomposition_calculator_.ComputeRoeEigendecomposition<Direction::Z>(
-          mat_block, roe_eigenvectors_left, roe_eigenvectors_right,
-          roe_eigenvalues);
-    }
-    ComputeFluxes<Direction::Z>(mat_block, fluxes_z, u_hllc_z,
-                                roe_eigenvectors_left, roe_eigenvectors_right,
-                                cell_size);
+    (this->*compute_fluxes_[2])(mat_block, fluxes_z, u_hllc_z, cell_size,
+                                given_lower_faces[2]);
   }
 
   if constexpr (active_equations == EquationSet::GammaModel) {
@@ -146,75 +160,144 @@ void FiniteVolumeScheme::UpdateImplementation(
 
 /**
  * @brief Computes the convective cell face fluxes by performing a finite-volume
- * state reconstruction and solving a Riemann problem afterwards.
+ * state reconstruction and solving a Riemann problem afterwards. Faces are
+ * visited line by line along the principal direction, such that the Roe
+ * eigendecomposition (if required) is only held for one line at a time.
  * @param mat_block The block and material information of the phase under
  * consideration.
  * @param fluxes Reference to an array which is filled with the computed fluxes
  * (indirect return parameter).
- * @param roe_eigenvectors_left .
- * @param roe_eigenvectors_right .
+ * @param u_hllc .
  * @param cell_size .
+ * @param lower_face_given Indicates whether the fluxes over the lower-most
+ * faces are already given. These faces are then skipped.
  * @tparam DIR Indicates which spatial direction is to be computed.
+ * @tparam RECON The reconstruction stencil.
  * @note Hotpath function.
  */
-template <Direction DIR>
+template <Direction DIR, ReconstructionStencils RECON>
 void FiniteVolumeScheme::ComputeFluxes(
     std::pair<MaterialName const, Block> const &mat_block,
     double (&fluxes)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
     double (&u_hllc)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
-    double const (
-        &Roe_eigenvectors_left)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                               [MF::ANOE()][MF::ANOE()],
-    double const (
-        &Roe_eigenvectors_right)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                                [MF::ANOE()][MF::ANOE()],
-    double const cell_size) const {
-
-  constexpr unsigned int x_start =
-      DIR == Direction::X ? CC::FICX() - 1 : CC::FICX();
-  constexpr unsigned int y_start =
-      DIR == Direction::Y ? CC::FICY() - 1 : CC::FICY();
-  constexpr unsigned int z_start =
-      DIR == Direction::Z ? CC::FICZ() - 1 : CC::FICZ();
-
-  constexpr unsigned int x_end = CC::LICX();
-  constexpr unsigned int y_end = CC::LICY();
-  constexpr unsigned int z_end = CC::LICZ();
-
-  constexpr int total_to_internal_offset_x = CC::FICX() - 1;
-  constexpr int total_to_internal_offset_y =
-      CC::DIM() != Dimension::One ? static_cast<int>(CC::FICY()) - 1 : -1;
-  constexpr int total_to_internal_offset_z =
-      CC::DIM() == Dimension::Three ? static_cast<int>(CC::FICZ()) - 1 : -1;
+    double const cell_size, bool const lower_face_given) const {
+
+  constexpr bool roe_equations =
+      active_equations == EquationSet::NavierStokes ||
+      active_equations == EquationSet::Euler;
+  constexpr bool hybrid_reconstruction =
+      state_reconstruction_type ==
+      StateReconstructionType::HybridCharacteristic;
+  constexpr bool require_eigendecomposition =
+      roe_equations &&
+      state_reconstruction_type == StateReconstructionType::Characteristic;
+  // Only the faces flagged by the sensor are decomposed
+  constexpr bool require_flagged_eigendecomposition =
+      roe_equations && hybrid_reconstruction;
+
+  constexpr std::array<unsigned int, 3> start = {
+      DIR == Direction::X ? CC::FICX() - 1 : CC::FICX(),
+      DIR == Direction::Y ? CC::FICY() - 1 : CC::FICY(),
+      DIR == Direction::Z ? CC::FICZ() - 1 : CC::FICZ()};
+  constexpr std::array<unsigned int, 3> end = {CC::LICX(), CC::LICY(),
+                                               CC::LICZ()};
+  // Given faces are neither reconstructed nor solved
+  unsigned int const first_face = lower_face_given ? 1 : 0;
+
+  constexpr std::array<int, 3> total_to_internal_offset = {
+      CC::FICX() - 1,
+      CC::DIM() != Dimension::One ? static_cast<int>(CC::FICY()) - 1 : -1,
+      CC::DIM() == Dimension::Three ? static_cast<int>(CC::FICZ()) - 1 : -1};
+
+  constexpr unsigned int principal = DTI(DIR);
+  constexpr unsigned int minor1 = DTI(GetMinorDirection<DIR>(0));
+  constexpr unsigned int minor2 = DTI(GetMinorDirection<DIR>(1));
+
+  // One line of eigenvectors per thread, reused for all lines and blocks
+  thread_local RoeEigendecompositionPencil pencil;
+  // The characteristic reconstruction only needs the Roe averages of a line,
+  // it applies the eigenvectors in closed form
+  thread_local RoeAveragesPencil roe_averages;
+  // Sensor results of the faces of one line ( hybrid reconstruction only )
+  [[maybe_unused]] bool characteristic_faces[CC::ICX() + 1];
 
   // Access the pair's elements directly.
   auto const &[material, block] = mat_block;
+  EquationOfState const &eos =
+      material_manager_.GetMaterial(material).GetEquationOfState();
+  [[maybe_unused]] double const B =
+      active_equations == EquationSet::Isentropic ||
+              active_equations == EquationSet::GammaModel
+          ? 0.0
+          : eos.B();
+
+  // Valid faces of one line are collected and handed to the Riemann solver at
+  // once
+  constexpr std::size_t faces_per_line = CC::ICX() + 1;
+  RiemannFaceStates<faces_per_line> states_left;
+  RiemannFaceStates<faces_per_line> states_right;
+  std::array<std::array<double, faces_per_line>, MF::ANOE()> line_fluxes;
+  std::array<unsigned int, faces_per_line> line_face_cells;
 
-  for (unsigned int i = x_start; i <= x_end; ++i) {
-    for (unsigned int j = y_start; j <= y_end; ++j) {
-      for (unsigned int k = z_start; k <= z_end; ++k) {
-        // Shifted indices to match block index system and roe-ev index system
-        int const i_index = i - total_to_internal_offset_x;
-        int const j_index = j - total_to_internal_offset_y;
-        int const k_index = k - total_to_internal_offset_z;
+  std::array<unsigned int, 3> cell;
+  for (cell[minor1] = start[minor1]; cell[minor1] <= end[minor1];
+       ++cell[minor1]) {
+    for (cell[minor2] = start[minor2]; cell[minor2] <= end[minor2];
+         ++cell[minor2]) {
+      if constexpr (require_eigendecomposition) {
+        eigendecomposition_calculator_.ComputeRoeAveragesOnPencil<DIR>(
+            mat_block, cell[minor1], cell[minor2], roe_averages);
+      }
+      // Generic lambda to discard the sensor for non-hybrid reconstructions
+      [&](auto const &reconstruction) {
+        if constexpr (hybrid_reconstruction) {
+          characteristic_faces[0] = false;
+          for (cell[principal] = start[principal] + first_face;
+               cell[principal] <= end[principal]; ++cell[principal]) {
+            characteristic_faces[cell[principal] - start[principal]] =
+                reconstruction.template IsCharacteristicFace<DIR, RECON>(
+                    block, cell[0], cell[1], cell[2]);
+          }
+        }
+      }(state_reconstruction_);
+      if constexpr (require_flagged_eigendecomposition) {
+        eigendecomposition_calculator_
+            .ComputeRoeEigendecompositionOnPencil<DIR>(
+                mat_block, cell[minor1], cell[minor2], characteristic_faces,
+                pencil);
+      }
+      unsigned int number_of_faces = 0;
+      for (cell[principal] = start[principal] + first_face;
+           cell[principal] <= end[principal]; ++cell[principal]) {
+        unsigned int const i = cell[0];
+        unsigned int const j = cell[1];
+        unsigned int const k = cell[2];
+        unsigned int const face = cell[principal] - start[principal];
 
         auto const [reconstructed_conservatives_left,
                     reconstructed_conservatives_right,
                     reconstructed_primes_left, reconstructed_primes_right] =
-            state_reconstruction_.SolveStateReconstruction<
-                DIR, reconstruction_stencil>(
-                block,
-                material_manager_.GetMaterial(material).GetEquationOfState(),
-                Roe_eigenvectors_left[i_index][j_index][k_index],
-                Roe_eigenvectors_right[i_index][j_index][k_index], cell_size, i,
-                j, k);
+            [&](auto const &reconstruction) {
+              if constexpr (hybrid_reconstruction) {
+                return reconstruction
+                    .template SolveFlaggedStateReconstruction<DIR, RECON>(
+                        characteristic_faces[face], block, eos,
+                        pencil.eigenvectors_left_[face],
+                        pencil.eigenvectors_right_[face], cell_size, i, j, k);
+              } else if constexpr (require_eigendecomposition) {
+                return reconstruction
+                    .template SolveStateReconstruction<DIR, RECON>(
+                        block, eos, roe_averages.faces_[face], cell_size, i, j,
+                        k);
+              } else {
+                return reconstruction
+                    .template SolveStateReconstruction<DIR, RECON>(
+                        block, eos, pencil.eigenvectors_left_[face],
+                        pencil.eigenvectors_right_[face], cell_size, i, j, k);
+              }
+            }(state_reconstruction_);
         // To check for invalid cells due to ghost fluid method
         if constexpr (active_equations != EquationSet::GammaModel) {
-          double const B = active_equations == EquationSet::Isentropic
-                               ? 0.0
-                               : material_manager_.GetMaterial(material)
-                                     .GetEquationOfState()
-                                     .B();
           if (reconstructed_conservatives_left[ETI(Equation::Mass)] <=
                   std::numeric_limits<double>::epsilon() ||
               reconstructed_conservatives_right[ETI(Equation::Mass)] <=
@@ -226,6 +309,10 @@ void FiniteVolumeScheme::ComputeFluxes(
         }
 
         if constexpr (active_equations == EquationSet::GammaModel) {
+          // Shifted indices to match block index system and flux index system
+          int const i_index = i - total_to_internal_offset[0];
+          int const j_index = j - total_to_internal_offset[1];
+          int const k_index = k - total_to_internal_offset[2];
           auto const [face_fluxes, u_hllc_single] =
               riemann_solver_.SolveGammaRiemannProblem<DIR>(
                   material, reconstructed_conservatives_left,
@@ -237,15 +324,39 @@ void FiniteVolumeScheme::ComputeFluxes(
           u_hllc[i_index][j_index][k_index] = u_hllc_single;
         } else {
           (void)u_hllc;
-          auto const face_fluxes = riemann_solver_.SolveRiemannProblem<DIR>(
-              material, reconstructed_conservatives_left,
-              reconstructed_conservatives_right, reconstructed_primes_left,
-              reconstructed_primes_right);
           for (unsigned int n = 0; n < MF::ANOE(); ++n) {
-            fluxes[n][i_index][j_index][k_index] += face_fluxes[n];
+            states_left.conservatives_[n][number_of_faces] =
+                reconstructed_conservatives_left[n];
+            states_right.conservatives_[n][number_of_faces] =
+                reconstructed_conservatives_right[n];
+          }
+          for (unsigned int p = 0; p < MF::ANOP(); ++p) {
+            states_left.prime_states_[p][number_of_faces] =
+                reconstructed_primes_left[p];
+            states_right.prime_states_[p][number_of_faces] =
+                reconstructed_primes_right[p];
           }
+          line_face_cells[number_of_faces] = cell[principal];
+          ++number_of_faces;
         }
-      } // k
-    }   // j
-  }     // i
+      } // principal
+
+      if constexpr (active_equations != EquationSet::GammaModel) {
+        riemann_solver_.SolveRiemannProblems<DIR>(
+            material, states_left, states_right, number_of_faces, line_fluxes);
+        for (unsigned int f = 0; f < number_of_faces; ++f) {
+          cell[principal] = line_face_cells[f];
+          // Shifted indices to match block index system and flux index system
+          int const i_index = cell[0] - total_to_internal_offset[0];
+          int const j_index = cell[1] - total_to_internal_offset[1];
+          int const k_index = cell[2] - total_to_internal_offset[2];
+          for (unsigned int n = 0; n < MF::ANOE(); ++n) {
+            fluxes[n][i_index][j_index][k_index] += line_fluxes[n][f];
+          }
+        }
+      } else {
+        (void)number_of_faces;
+      }
+    } // second minor
+  }   // first minor
 }
@@ -22,6 +22,8 @@
 #ifndef FINITE_VOLUME_SCHEME_H
 #define FINITE_VOLUME_SCHEME_H
 
+#include <array>
+
 #include "block_definitions/block.h"
 #include "enums/direction_definition.h"
 #include "materials/equation_of_state.h"
@@ -44,21 +46,28 @@ class FiniteVolumeScheme : public ConvectiveTermSolver<FiniteVolumeScheme> {
       FiniteVolumeSettings::riemann_solver>::type;
   using StateReconstructionConcretization =
       StateReconstructionSetup::Concretize<state_reconstruction_type>::type;
+  using FluxFunction = void (FiniteVolumeScheme::*)(
+      std::pair<MaterialName const, Block> const &,
+      double (&)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
+      double (&)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1], double const,
+      bool const) const;
+
   RiemannSolverConcretization const riemann_solver_;
   StateReconstructionConcretization const state_reconstruction_;
+  // Flux kernels of the selected reconstruction stencil per direction
+  std::array<FluxFunction, 3> const compute_fluxes_;
 
-  template <Direction DIR>
+  template <ReconstructionStencils RECON>
+  static std::array<FluxFunction, 3> FluxFunctionsOfStencil();
+  static std::array<FluxFunction, 3>
+  SelectFluxFunctions(ReconstructionStencils const stencil);
+
+  template <Direction DIR, ReconstructionStencils RECON>
   void ComputeFluxes(
       std::pair<MaterialName const, Block> const &mat_block,
       double (&fluxes)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
       double (&u_hllc)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
-      double const (
-          &Roe_eigenvectors_left)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                                 [MF::ANOE()][MF::ANOE()],
-      double const (
-          &Roe_eigenvectors_right)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                                  [MF::ANOE()][MF::ANOE()],
-      double const cell_size) const;
+      double const cell_size, bool const lower_face_given) const;
 
   void UpdateImplementation(
       std::pair<MaterialName const, Block> const &mat_block,
@@ -69,14 +78,15 @@ class FiniteVolumeScheme : public ConvectiveTermSolver<FiniteVolumeScheme> {
           &fluxes_y)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
       double (
           &fluxes_z)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
-      double (
-          &volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()]) const;
+      double (&volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()],
+      std::array<bool, 3> const &given_lower_faces) const;
 
 public:
   FiniteVolumeScheme() = delete;
   explicit FiniteVolumeScheme(
       MaterialManager const &material_manager,
-      EigenDecomposition const &eigendecomposition_calculator);
+      EigenDecomposition const &eigendecomposition_calculator,
+      ReconstructionStencils const stencil = reconstruction_stencil);
   ~FiniteVolumeScheme() = default;
   FiniteVolumeScheme(FiniteVolumeScheme const &) = delete;
   FiniteVolumeScheme &operator=(FiniteVolumeScheme const &) = delete;
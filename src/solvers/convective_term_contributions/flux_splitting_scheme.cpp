@@ -23,6 +23,8 @@
 #include "solvers/state_reconstruction/state_reconstruction.h"
 #include "stencils/stencil_utilities.h"
 
+#include <stdexcept>
+
 static_assert((active_equations == EquationSet::Euler ||
                active_equations == EquationSet::NavierStokes) ||
                   (convective_term_solver !=
@@ -45,9 +47,9 @@ void ComputeAdvection(
     double (&advection)[MF::ANOE()][CC::TCX()][CC::TCY()][CC::TCZ()]) {
 
   PrimeStates const &prime_states = block.GetPrimeStateBuffer();
-  double const(&energy)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&energy)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       block.GetAverageBuffer(Equation::Energy);
-  double const(&direction_velocity)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&direction_velocity)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       prime_states[MF::AV()[DTI(DIR)]];
 
   for (unsigned int i = 0; i < CC::TCX(); ++i) {
@@ -81,12 +83,21 @@ void ComputeAdvection(
  * EigenDecomposition object.
  * @param material_manager .
  * @param eigendecomposition_calculator .
+ * @param stencil The reconstruction stencil of the convective fluxes.
+ * @note Throws if the stencil differs from the compiled one, the runtime
+ * selection is only available for the finite-volume scheme.
  */
 FluxSplittingScheme::FluxSplittingScheme(
     MaterialManager const &material_manager,
-    EigenDecomposition const &eigendecomposition_calculator)
+    EigenDecomposition const &eigendecomposition_calculator,
+    ReconstructionStencils const stencil)
     : ConvectiveTermSolver(material_manager, eigendecomposition_calculator) {
-  /* Empty besides initializer list*/
+  if (stencil != reconstruction_stencil) {
+    throw std::invalid_argument("The reconstruction stencil of the flux "
+                                "splitting scheme cannot be selected at "
+                                "runtime, change reconstruction_stencil in "
+                                "stencil_setup.h!");
+  }
 }
 
 /**
@@ -100,7 +111,8 @@ void FluxSplittingScheme::UpdateImplementation(
     double (&fluxes_x)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
     double (&fluxes_y)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
     double (&fluxes_z)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
-    double (&)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()]) const {
+    double (&)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()],
+    std::array<bool, 3> const &given_lower_faces) const {
 
   double advection_contribution[MF::ANOE()][CC::TCX()][CC::TCY()][CC::TCZ()];
 
@@ -142,18 +154,20 @@ void FluxSplittingScheme::UpdateImplementation(
       mat_block, roe_eigenvectors_left, roe_eigenvectors_right,
       fluxfunction_wavespeeds);
   ComputeAdvection<Direction::X>(mat_block.second, advection_contribution);
-  ComputeFluxes<Direction::X>(
-      mat_block.second, fluxes_x, advection_contribution, cell_size,
-      roe_eigenvectors_left, roe_eigenvectors_right, fluxfunction_wavespeeds);
+  ComputeFluxes<Direction::X>(mat_block.second, fluxes_x,
+                              advection_contribution, cell_size,
+                              roe_eigenvectors_left, roe_eigenvectors_right,
+                              fluxfunction_wavespeeds, given_lower_faces[0]);
 
   if constexpr (CC::DIM() != Dimension::One) {
     eigendecomposition_calculator_.ComputeRoeEigendecomposition<Direction::Y>(
         mat_block, roe_eigenvectors_left, roe_eigenvectors_right,
         fluxfunction_wavespeeds);
     ComputeAdvection<Direction::Y>(mat_block.second, advection_contribution);
-    ComputeFluxes<Direction::Y>(
-        mat_block.second, fluxes_y, advection_contribution, cell_size,
-        roe_eigenvectors_left, roe_eigenvectors_right, fluxfunction_wavespeeds);
+    ComputeFluxes<Direction::Y>(mat_block.second, fluxes_y,
+                                advection_contribution, cell_size,
+                                roe_eigenvectors_left, roe_eigenvectors_right,
+                                fluxfunction_wavespeeds, given_lower_faces[1]);
   }
 
   if constexpr (CC::DIM() == Dimension::Three) {
@@ -161,9 +175,10 @@ void FluxSplittingScheme::UpdateImplementation(
         mat_block, roe_eigenvectors_left, roe_eigenvectors_right,
         fluxfunction_wavespeeds);
     ComputeAdvection<Direction::Z>(mat_block.second, advection_contribution);
-    ComputeFluxes<Direction::Z>(
-        mat_block.second, fluxes_z, advection_contribution, cell_size,
-        roe_eigenvectors_left, roe_eigenvectors_right, fluxfunction_wavespeeds);
+    ComputeFluxes<Direction::Z>(mat_block.second, fluxes_z,
+                                advection_contribution, cell_size,
+                                roe_eigenvectors_left, roe_eigenvectors_right,
+                                fluxfunction_wavespeeds, given_lower_faces[2]);
   }
 }
 
@@ -179,6 +194,8 @@ void FluxSplittingScheme::UpdateImplementation(
  * @param roe_eigenvectors_left .
  * @param roe_eigenvectors_right .
  * @param roe_eigenvalues .
+ * @param lower_face_given Indicates whether the fluxes over the lower-most
+ * faces are already given. These faces are then skipped.
  * @tparam DIR Indicates which spatial direction is to be computed.
  * @note Hotpath function.
  */
@@ -193,7 +210,8 @@ void FluxSplittingScheme::ComputeFluxes(
     double (&roe_eigenvectors_right)[CC::ICX() + 1][CC::ICY() + 1]
                                     [CC::ICZ() + 1][MF::ANOE()][MF::ANOE()],
     double (&fluxfunction_wavespeed)[CC::ICX() + 1][CC::ICY() + 1]
-                                    [CC::ICZ() + 1][MF::ANOE()]) const {
+                                    [CC::ICZ() + 1][MF::ANOE()],
+    bool const lower_face_given) const {
 
   using ReconstructionStencil =
       ReconstructionStencilSetup::Concretize<reconstruction_stencil>::type;
@@ -223,6 +241,8 @@ void FluxSplittingScheme::ComputeFluxes(
   constexpr unsigned int x_end = CC::LICX();
   constexpr unsigned int y_end = CC::LICY();
   constexpr unsigned int z_end = CC::LICZ();
+  // Given faces are not computed
+  unsigned int const first_face = lower_face_given ? 1 : 0;
 
   std::array<double, ReconstructionStencil::StencilSize()>
       positive_characteristic_flux;
@@ -233,9 +253,9 @@ void FluxSplittingScheme::ComputeFluxes(
 
   auto const &conservatives = block.GetAverageBuffer();
 
-  for (unsigned int i = x_start; i <= x_end; ++i) {
-    for (unsigned int j = y_start; j <= y_end; ++j) {
-      for (unsigned int k = z_start; k <= z_end; ++k) {
+  for (unsigned int i = x_start + x_varying * first_face; i <= x_end; ++i) {
+    for (unsigned int j = y_start + y_varying * first_face; j <= y_end; ++j) {
+      for (unsigned int k = z_start + z_varying * first_face; k <= z_end; ++k) {
         // Shifted indices to match block index system and roe-eigenvalue index
         // system
         int const i_index = i - offset_x;
@@ -22,12 +22,15 @@
 #ifndef FLUX_SPLITTING_SCHEME_H
 #define FLUX_SPLITTING_SCHEME_H
 
+#include <array>
+
 #include "block_definitions/block.h"
 #include "enums/direction_definition.h"
 #include "materials/equation_of_state.h"
 #include "materials/material_manager.h"
 #include "solvers/convective_term_contributions/convective_term_solver.h"
 #include "user_specifications/compile_time_constants.h"
+#include "user_specifications/stencil_setup.h"
 #include "utilities/helper_functions.h"
 
 /**
@@ -49,7 +52,8 @@ class FluxSplittingScheme : public ConvectiveTermSolver<FluxSplittingScheme> {
       double (&roe_eigenvectors_right)[CC::ICX() + 1][CC::ICY() + 1]
                                       [CC::ICZ() + 1][MF::ANOE()][MF::ANOE()],
       double (&fluxfunction_wavespeed)[CC::ICX() + 1][CC::ICY() + 1]
-                                      [CC::ICZ() + 1][MF::ANOE()]) const;
+                                      [CC::ICZ() + 1][MF::ANOE()],
+      bool const lower_face_given) const;
 
   void UpdateImplementation(
       std::pair<MaterialName const, Block> const &mat_block,
@@ -60,14 +64,15 @@ class FluxSplittingScheme : public ConvectiveTermSolver<FluxSplittingScheme> {
           &fluxes_y)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
       double (
           &fluxes_z)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
-      double (
-          &volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()]) const;
+      double (&volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()],
+      std::array<bool, 3> const &given_lower_faces) const;
 
 public:
   FluxSplittingScheme() = delete;
   explicit FluxSplittingScheme(
       MaterialManager const &material_manager,
-      EigenDecomposition const &eigendecomposition_calculator);
+      EigenDecomposition const &eigendecomposition_calculator,
+      ReconstructionStencils const stencil = reconstruction_stencil);
   ~FluxSplittingScheme() = default;
   FluxSplittingScheme(FluxSplittingScheme const &) = delete;
   FluxSplittingScheme &operator=(FluxSplittingScheme const &) = delete;
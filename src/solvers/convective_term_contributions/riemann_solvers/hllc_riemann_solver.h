@@ -39,23 +39,26 @@ class HllcRiemannSolver : public RiemannSolver<HllcRiemannSolver> {
   friend RiemannSolver;
 
   /**
-   * @brief Computes an approximate solution of a Riemann problem using the HLLC
-   * procedure.
-   * @param material Material information of the phase under consideration.
+   * @brief Computes the flux of the HLLC procedure for given speeds of sound,
+   * i.e. without evaluating the equation of state.
    * @param conservatives_left The initial left conservative states.
    * @param conservatives_right The initial right conservative states.
    * @param prime_state_left The initial left primitive states.
    * @param prime_state_right The initial right primitive states.
+   * @param speed_of_sound_left The speed of sound of the left state.
+   * @param speed_of_sound_right The speed of sound of the right state.
+   * @param gamma The ratio of specific heats (for Toro signal speeds).
    * @tparam DIR Indicates which spatial direction is to be computed.
    * @note Hotpath function.
    */
   template <Direction DIR>
-  std::array<double, MF::ANOE()> SolveRiemannProblemImplementation(
-      MaterialName const material,
-      std::array<double, MF::ANOE()> const &conservatives_left,
-      std::array<double, MF::ANOE()> const &conservatives_right,
-      std::array<double, MF::ANOP()> const &prime_state_left,
-      std::array<double, MF::ANOP()> const &prime_state_right) const {
+  std::array<double, MF::ANOE()>
+  ComputeFlux(std::array<double, MF::ANOE()> const &conservatives_left,
+              std::array<double, MF::ANOE()> const &conservatives_right,
+              std::array<double, MF::ANOP()> const &prime_state_left,
+              std::array<double, MF::ANOP()> const &prime_state_right,
+              double const speed_of_sound_left,
+              double const speed_of_sound_right, double const gamma) const {
     std::array<double, MF::ANOE()> q_star_left;
     std::array<double, MF::ANOE()> q_star_right;
     std::array<double, MF::ANOE()> flux_left;
@@ -65,12 +68,7 @@ class HllcRiemannSolver : public RiemannSolver<HllcRiemannSolver> {
     constexpr unsigned int principal_momentum_index = ETI(MF::AME()[DTI(DIR)]);
     constexpr unsigned int principal_velocity_index = PTI(MF::AV()[DTI(DIR)]);
 
-    // For Toro signal speeds
-    double const gamma =
-        material_manager_.GetMaterial(material).GetEquationOfState().Gamma();
-
-    // Compute pressure, velocity and speed of sound for both cells for
-    // reconstructed values
+    // Compute pressure and velocity for both cells for reconstructed values
     double const pressure_left = prime_state_left[PTI(PrimeState::Pressure)];
     double const pressure_right = prime_state_right[PTI(PrimeState::Pressure)];
 
@@ -80,16 +78,6 @@ class HllcRiemannSolver : public RiemannSolver<HllcRiemannSolver> {
         1.0 / conservatives_right[ETI(Equation::Mass)];
     double const velocity_left = prime_state_left[principal_velocity_index];
     double const velocity_right = prime_state_right[principal_velocity_index];
-    double const speed_of_sound_left =
-        material_manager_.GetMaterial(material)
-            .GetEquationOfState()
-            .SpeedOfSound(conservatives_left[ETI(Equation::Mass)],
-                          pressure_left);
-    double const speed_of_sound_right =
-        material_manager_.GetMaterial(material)
-            .GetEquationOfState()
-            .SpeedOfSound(conservatives_right[ETI(Equation::Mass)],
-                          pressure_right);
 
     // Calculation of signal speeds
     auto const [wave_speed_left_simple, wave_speed_right_simple] =
@@ -197,6 +185,36 @@ class HllcRiemannSolver : public RiemannSolver<HllcRiemannSolver> {
     return fluxes;
   }
 
+  /**
+   * @brief Computes an approximate solution of a Riemann problem using the HLLC
+   * procedure.
+   * @param material Material information of the phase under consideration.
+   * @param conservatives_left The initial left conservative states.
+   * @param conservatives_right The initial right conservative states.
+   * @param prime_state_left The initial left primitive states.
+   * @param prime_state_right The initial right primitive states.
+   * @tparam DIR Indicates which spatial direction is to be computed.
+   * @note Hotpath function.
+   */
+  template <Direction DIR>
+  std::array<double, MF::ANOE()> SolveRiemannProblemImplementation(
+      MaterialName const material,
+      std::array<double, MF::ANOE()> const &conservatives_left,
+      std::array<double, MF::ANOE()> const &conservatives_right,
+      std::array<double, MF::ANOP()> const &prime_state_left,
+      std::array<double, MF::ANOP()> const &prime_state_right) const {
+    EquationOfState const &eos =
+        material_manager_.GetMaterial(material).GetEquationOfState();
+    return ComputeFlux<DIR>(
+        conservatives_left, conservatives_right, prime_state_left,
+        prime_state_right,
+        eos.SpeedOfSound(conservatives_left[ETI(Equation::Mass)],
+                         prime_state_left[PTI(PrimeState::Pressure)]),
+        eos.SpeedOfSound(conservatives_right[ETI(Equation::Mass)],
+                         prime_state_right[PTI(PrimeState::Pressure)]),
+        eos.Gamma());
+  }
+
 public:
   HllcRiemannSolver() = delete;
   explicit HllcRiemannSolver(
@@ -22,11 +22,23 @@
 #ifndef RIEMANN_SOLVER_H
 #define RIEMANN_SOLVER_H
 #include <array>
+#include <cstddef>
 
 #include "block_definitions/block.h"
 #include "materials/material_manager.h"
 #include "solvers/eigendecomposition.h"
 
+/**
+ * @brief Reconstructed states on one side of a batch of cell faces in
+ * structure-of-arrays layout, i.e. conservatives_[n][f] is equation n at face
+ * f.
+ * @tparam W The maximum number of faces in the batch.
+ */
+template <std::size_t W> struct RiemannFaceStates {
+  std::array<std::array<double, W>, MF::ANOE()> conservatives_;
+  std::array<std::array<double, W>, MF::ANOP()> prime_states_;
+};
+
 /**
  * @brief Interface to solve the underlying system of equations. Uses spatial
  * reconstruction stencils to approximate the solution.
@@ -79,6 +91,69 @@ public:
             prime_state_right);
   }
 
+  /**
+   * @brief Solves the first-order Riemann problems of a batch of cell faces.
+   * The equation of state is dispatched once for the whole batch, the fluxes
+   * are identical to the ones of SolveRiemannProblem for each face.
+   * @tparam direction.
+   * @tparam W The capacity of the batch.
+   * @param material Container holding the relevant fluid data to compute the
+   * update.
+   * @param states_left, states_right The reconstructed left/right states of the
+   * faces.
+   * @param number_of_faces The number of faces (at most W) in the batch.
+   * @param fluxes The flux over each cell face, fluxes[n][f] is equation n at
+   * face f (indirect return parameter).
+   * @note Solvers have to provide ComputeFlux, which gives the flux of one
+   * face for known speeds of sound.
+   */
+  template <Direction DIR, std::size_t W>
+  void SolveRiemannProblems(
+      MaterialName const material, RiemannFaceStates<W> const &states_left,
+      RiemannFaceStates<W> const &states_right,
+      unsigned int const number_of_faces,
+      std::array<std::array<double, W>, MF::ANOE()> &fluxes) const {
+    EquationOfState const &eos =
+        material_manager_.GetMaterial(material).GetEquationOfState();
+    double const gamma = eos.Gamma();
+
+    std::array<double, W> speed_of_sound_left;
+    std::array<double, W> speed_of_sound_right;
+    eos.SpeedOfSound(
+        states_left.conservatives_[ETI(Equation::Mass)].data(),
+        states_left.prime_states_[PTI(PrimeState::Pressure)].data(),
+        speed_of_sound_left.data(), number_of_faces);
+    eos.SpeedOfSound(
+        states_right.conservatives_[ETI(Equation::Mass)].data(),
+        states_right.prime_states_[PTI(PrimeState::Pressure)].data(),
+        speed_of_sound_right.data(), number_of_faces);
+
+#pragma omp simd
+    for (unsigned int f = 0; f < number_of_faces; ++f) {
+      std::array<double, MF::ANOE()> conservatives_left;
+      std::array<double, MF::ANOE()> conservatives_right;
+      std::array<double, MF::ANOP()> prime_state_left;
+      std::array<double, MF::ANOP()> prime_state_right;
+      for (unsigned int n = 0; n < MF::ANOE(); ++n) {
+        conservatives_left[n] = states_left.conservatives_[n][f];
+        conservatives_right[n] = states_right.conservatives_[n][f];
+      }
+      for (unsigned int p = 0; p < MF::ANOP(); ++p) {
+        prime_state_left[p] = states_left.prime_states_[p][f];
+        prime_state_right[p] = states_right.prime_states_[p][f];
+      }
+      std::array<double, MF::ANOE()> const face_fluxes =
+          static_cast<DerivedRiemannSolver const &>(*this)
+              .template ComputeFlux<DIR>(
+                  conservatives_left, conservatives_right, prime_state_left,
+                  prime_state_right, speed_of_sound_left[f],
+                  speed_of_sound_right[f], gamma);
+      for (unsigned int n = 0; n < MF::ANOE(); ++n) {
+        fluxes[n][f] = face_fluxes[n];
+      }
+    }
+  }
+
   /**
    * @brief Solves the first-order Riemann problem using left and right state
    * vectors.
@@ -25,15 +25,13 @@
 
 #include <cmath>
 
-double EigenDecomposition::global_eigenvalues_[DTI(CC::DIM())][MF::ANOE()];
-
 /**
  * @brief Standard constructor using an already existing MaterialManager.
  * @param material_manager The MaterialManager provides the correct equation of
  * state for a given Material.
  */
 EigenDecomposition::EigenDecomposition(MaterialManager const &material_manager)
-    : material_manager_(material_manager) {
+    : material_manager_(material_manager), global_eigenvalues_{} {
   /*Empty besides initializer list*/
 }
 
@@ -55,7 +53,7 @@ void EigenDecomposition::ComputeMaxEigenvaluesOnBlock(
   // Access the pair's elements directly.
   auto const &[material, block] = mat_block;
 
-  double const(&density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       block.GetPrimeStateBuffer(PrimeState::Density);
 
   for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
@@ -121,9 +119,10 @@ void EigenDecomposition::ComputeMaxEigenvaluesOnBlock(
 /**
  * @brief Stores the global Lax-Friedrichs eigenvalues for later usage.
  * @param eigenvalues The eigenvalues to be set.
+ * @note Must not be called while fluxes are computed ( e.g. by other threads ).
  */
 void EigenDecomposition::SetGlobalEigenvalues(
-    double (&eigenvalues)[DTI(CC::DIM())][MF::ANOE()]) const {
+    double const (&eigenvalues)[DTI(CC::DIM())][MF::ANOE()]) {
   for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
     for (unsigned int e = 0; e < MF::ANOE(); ++e) {
       global_eigenvalues_[d][e] = eigenvalues[d][e];
@@ -31,6 +31,49 @@
 #include "user_specifications/compile_time_constants.h"
 #include "user_specifications/riemann_solver_settings.h"
 
+/**
+ * @brief Scratch storage for the Roe eigendecomposition on one line of cell
+ * faces along a principal direction (pencil). Users keep one instance per
+ * thread and reuse it for all lines, instead of holding the eigenvectors of a
+ * whole block.
+ */
+struct RoeEigendecompositionPencil {
+  double eigenvectors_left_[CC::ICX() + 1][MF::ANOE()][MF::ANOE()];
+  double eigenvectors_right_[CC::ICX() + 1][MF::ANOE()][MF::ANOE()];
+  double eigenvalues_[CC::ICX() + 1][MF::ANOE()];
+};
+
+static_assert(CC::ICX() >= CC::ICY() && CC::ICX() >= CC::ICZ(),
+              "Pencils are sized by the number of internal cells in x");
+
+/**
+ * @brief Roe averages at one cell face, which fully define the Roe eigenvectors
+ * of the face. Velocities are sorted into principal and minor directions of the
+ * face.
+ */
+struct RoeFaceAverages {
+  double principal_velocity_ = 0.0;
+  double minor1_velocity_ = 0.0;
+  double minor2_velocity_ = 0.0;
+  double q_squared_ = 0.0;
+  double enthalpy_ = 0.0;
+  double gruneisen_ = 0.0;
+  double speed_of_sound_ = 0.0;
+  double one_cc_ = 0.0;
+  double density_ = 0.0;
+  double one_density_ = 0.0;
+};
+
+/**
+ * @brief Scratch storage for the Roe averages on one line of cell faces, see
+ * RoeEigendecompositionPencil. Used instead of the eigenvectors if these are
+ * only applied through ProjectToCharacteristicSpace and
+ * ProjectToPhysicalSpace.
+ */
+struct RoeAveragesPencil {
+  RoeFaceAverages faces_[CC::ICX() + 1];
+};
+
 /**
  * @brief The RoeEigenvalues class computes Roe eigenvalues and eigenvectors
  * within one block. For further information consult \cite Roe1981. For
@@ -41,9 +84,22 @@ class EigenDecomposition {
 
   MaterialManager const &material_manager_;
 
-  // Using static to cheat constness (for this global variable okay - don't do
-  // this at home (we are what you a call Experts) ;)
-  static double global_eigenvalues_[DTI(CC::DIM())][MF::ANOE()];
+  // Global Lax-Friedrichs eigenvalues of the current stage ( maxima over all
+  // blocks of all ranks ), set between two right-hand side evaluations
+  double global_eigenvalues_[DTI(CC::DIM())][MF::ANOE()];
+
+  template <Direction DIR>
+  void ComputeRoeEigendecompositionAtFace(
+      MaterialName const material, Block const &block, unsigned int const i,
+      unsigned int const j, unsigned int const k,
+      double (&left_eigenvector)[MF::ANOE()][MF::ANOE()],
+      double (&right_eigenvector)[MF::ANOE()][MF::ANOE()],
+      double (&eigenvalues)[MF::ANOE()]) const;
+  template <Direction DIR>
+  bool ComputeRoeAveragesAtFace(MaterialName const material, Block const &block,
+                                unsigned int const i, unsigned int const j,
+                                unsigned int const k,
+                                RoeFaceAverages &averages) const;
 
 public:
   EigenDecomposition() = delete;
@@ -63,12 +119,29 @@ public:
                                       [CC::ICZ() + 1][MF::ANOE()][MF::ANOE()],
       double (&fluxfunction_eigenvalues)[CC::ICX() + 1][CC::ICY() + 1]
                                         [CC::ICZ() + 1][MF::ANOE()]) const;
+  template <Direction DIR>
+  void ComputeRoeEigendecompositionOnPencil(
+      std::pair<MaterialName const, Block> const &mat_block,
+      unsigned int const first_minor_index,
+      unsigned int const second_minor_index,
+      RoeEigendecompositionPencil &pencil) const;
+  template <Direction DIR>
+  void ComputeRoeEigendecompositionOnPencil(
+      std::pair<MaterialName const, Block> const &mat_block,
+      unsigned int const first_minor_index,
+      unsigned int const second_minor_index, bool const (&faces)[CC::ICX() + 1],
+      RoeEigendecompositionPencil &pencil) const;
+  template <Direction DIR>
+  void ComputeRoeAveragesOnPencil(
+      std::pair<MaterialName const, Block> const &mat_block,
+      unsigned int const first_minor_index,
+      unsigned int const second_minor_index, RoeAveragesPencil &pencil) const;
 
   void ComputeMaxEigenvaluesOnBlock(
       std::pair<MaterialName const, Block> const &mat_block,
       double (&eigenvalues)[DTI(CC::DIM())][MF::ANOE()]) const;
   void
-  SetGlobalEigenvalues(double (&eigenvalues)[DTI(CC::DIM())][MF::ANOE()]) const;
+  SetGlobalEigenvalues(double const (&eigenvalues)[DTI(CC::DIM())][MF::ANOE()]);
   auto GetGlobalEigenvalues() const
       -> double const (&)[DTI(CC::DIM())][MF::ANOE()];
 };
@@ -163,11 +236,264 @@ inline std::array<double, MF::ANOE()> const TransformToPhysicalSpace(
 
   return physical_values;
 }
+
+/**
+ * @brief Fills the Roe left and right eigenvectors of a face in the given
+ * direction from its Roe averages according to \cite Fedkiw1999a.
+ * @param averages The Roe averages at the face.
+ * @param left_eigenvector Left eigenvectors at the face (indirect return
+ * parameter).
+ * @param right_eigenvector Right eigenvectors at the face (indirect return
+ * parameter).
+ * @tparam DIR The principal direction of the face.
+ */
+template <Direction DIR>
+inline void RoeEigenvectorsFromAverages(
+    RoeFaceAverages const &averages,
+    double (&left_eigenvector)[MF::ANOE()][MF::ANOE()],
+    double (&right_eigenvector)[MF::ANOE()][MF::ANOE()]) {
+  constexpr unsigned int principal = DTI(DIR);
+  constexpr unsigned int minor1 = DTI(GetMinorDirection<DIR>(0));
+  constexpr unsigned int minor2 = DTI(GetMinorDirection<DIR>(1));
+
+  // Index of eigenvectors for characteristic fields due to principal momentum
+  constexpr unsigned int ev_principal = DTI(CC::DIM());
+
+  double const principal_velocity_roe_ave = averages.principal_velocity_;
+  [[maybe_unused]] double const minor1_velocity_roe_ave =
+      averages.minor1_velocity_;
+  [[maybe_unused]] double const minor2_velocity_roe_ave =
+      averages.minor2_velocity_;
+  double const q_squared = averages.q_squared_;
+  double const enthalpy_roe_ave = averages.enthalpy_;
+  double const gruneisen_roe_ave = averages.gruneisen_;
+  double const c = averages.speed_of_sound_;
+  double const one_cc = averages.one_cc_;
+  [[maybe_unused]] double const density_roe_ave = averages.density_;
+  [[maybe_unused]] double const one_density_roe_ave = averages.one_density_;
+
+  // clang-format off
+  // LEFT EIGENVECTORS **********************************************
+  // ****************************************************************
+
+  // Eigenvector for lambda = u-c
+  left_eigenvector[         0     ][ETI(Equation::Mass)       ] = 0.5 * one_cc * (gruneisen_roe_ave*q_squared - gruneisen_roe_ave*enthalpy_roe_ave + (principal_velocity_roe_ave+c) * c);
+  left_eigenvector[         0     ][ETI(MF::AME()[principal]) ] = 0.5 * one_cc * (-principal_velocity_roe_ave * gruneisen_roe_ave - c);
+  if constexpr( CC::DIM() != Dimension::One )
+     left_eigenvector[      0     ][ETI(MF::AME()[minor1])    ] = 0.5 * one_cc * (-minor1_velocity_roe_ave*gruneisen_roe_ave);
+  if constexpr( CC::DIM() == Dimension::Three )
+     left_eigenvector[      0     ][ETI(MF::AME()[minor2])    ] = 0.5 * one_cc * (-minor2_velocity_roe_ave*gruneisen_roe_ave);
+  left_eigenvector[         0     ][ETI(Equation::Energy)     ] = 0.5 * one_cc * gruneisen_roe_ave;
+
+  if constexpr( CC::DIM() != Dimension::One ) {
+     // Additional eigenvector for lambda = u related to second momentum equation (= first minor momentum)
+     left_eigenvector[      1     ][ETI(Equation::Mass)       ] = minor1_velocity_roe_ave * one_density_roe_ave;
+     left_eigenvector[      1     ][ETI(MF::AME()[principal]) ] = 0.0;
+     left_eigenvector[      1     ][ETI(MF::AME()[minor1])    ] = -one_density_roe_ave;
+     if constexpr( CC::DIM() == Dimension::Three )
+        left_eigenvector[   1     ][ETI(MF::AME()[minor2])    ] = 0.0;
+     left_eigenvector[      1     ][ETI(Equation::Energy)     ] = 0.0;
+  }
+
+  if constexpr( CC::DIM() == Dimension::Three ) {
+     // Additional eigenvector for lambda = u related to third momentum equation (= second minor momentum)
+     left_eigenvector[      2     ][ETI(Equation::Mass)       ] = -minor2_velocity_roe_ave * one_density_roe_ave;
+     left_eigenvector[      2     ][ETI(MF::AME()[principal]) ] = 0.0;
+     left_eigenvector[      2     ][ETI(MF::AME()[minor1])    ] = 0.0;
+     left_eigenvector[      2     ][ETI(MF::AME()[minor2])    ] = one_density_roe_ave;
+     left_eigenvector[      2     ][ETI(Equation::Energy)     ] = 0.0;
+  }
+
+  // Eigenvector for lambda = u related to principal momentum direction
+  left_eigenvector[   ev_principal][ETI(Equation::Mass)       ] =  one_cc * (enthalpy_roe_ave - q_squared);
+  left_eigenvector[   ev_principal][ETI(MF::AME()[principal]) ] =  one_cc * principal_velocity_roe_ave;
+  if constexpr( CC::DIM() != Dimension::One )
+     left_eigenvector[ev_principal][ETI(MF::AME()[minor1])    ] =  one_cc * minor1_velocity_roe_ave;
+  if constexpr( CC::DIM() == Dimension::Three )
+     left_eigenvector[ev_principal][ETI(MF::AME()[minor2])    ] =  one_cc * minor2_velocity_roe_ave;
+  left_eigenvector[   ev_principal][ETI(Equation::Energy)     ] = -one_cc;
+
+  // eigenvector for lambda = u+c
+  left_eigenvector[   MF::ANOE()-1][ETI(Equation::Mass)       ] = 0.5 * one_cc * (gruneisen_roe_ave*q_squared - gruneisen_roe_ave*enthalpy_roe_ave - (principal_velocity_roe_ave-c) * c);
+  left_eigenvector[   MF::ANOE()-1][ETI(MF::AME()[principal]) ] = 0.5 * one_cc * (-principal_velocity_roe_ave*gruneisen_roe_ave + c);
+  if constexpr( CC::DIM() != Dimension::One )
+     left_eigenvector[MF::ANOE()-1][ETI(MF::AME()[minor1])    ] = 0.5 * one_cc * (-minor1_velocity_roe_ave*gruneisen_roe_ave);
+  if constexpr( CC::DIM() == Dimension::Three )
+     left_eigenvector[MF::ANOE()-1][ETI(MF::AME()[minor2])    ] = 0.5 * one_cc * (-minor2_velocity_roe_ave*gruneisen_roe_ave);
+  left_eigenvector[   MF::ANOE()-1][ETI(Equation::Energy)     ] = 0.5 * one_cc * gruneisen_roe_ave;
+
+
+  // RIGHT EIGENVECTORS *********************************************
+  // ****************************************************************
+
+  // Mass equation entries of right eigenvectors
+  right_eigenvector[   ETI(Equation::Mass)      ][      0     ] = 1.0;
+  if constexpr( CC::DIM() != Dimension::One )
+     right_eigenvector[ETI(Equation::Mass)      ][      1     ] = 0.0;
+  if constexpr( CC::DIM() == Dimension::Three )
+     right_eigenvector[ETI(Equation::Mass)      ][      2     ] = 0.0;
+  right_eigenvector[   ETI(Equation::Mass)      ][ev_principal] = gruneisen_roe_ave;
+  right_eigenvector[   ETI(Equation::Mass)      ][MF::ANOE()-1] = 1.0;
+
+  // principal momentum equation entries
+  right_eigenvector[   ETI(MF::AME()[principal])][      0     ] = principal_velocity_roe_ave - c;
+  if constexpr( CC::DIM() != Dimension::One )
+     right_eigenvector[ETI(MF::AME()[principal])][      1     ] = 0.0;
+  if constexpr( CC::DIM() == Dimension::Three )
+     right_eigenvector[ETI(MF::AME()[principal])][      2     ] = 0.0;
+  right_eigenvector[   ETI(MF::AME()[principal])][ev_principal] = gruneisen_roe_ave * principal_velocity_roe_ave;
+  right_eigenvector[   ETI(MF::AME()[principal])][MF::ANOE()-1] = principal_velocity_roe_ave + c;
+
+  if constexpr( CC::DIM() != Dimension::One ) {
+     // first minor momentum equation entries
+     right_eigenvector[   ETI(MF::AME()[minor1])][      0     ] = minor1_velocity_roe_ave;
+     right_eigenvector[   ETI(MF::AME()[minor1])][      1     ] = -density_roe_ave;
+     if constexpr( CC::DIM() == Dimension::Three )
+        right_eigenvector[ETI(MF::AME()[minor1])][      2     ] = 0.0;
+     right_eigenvector[   ETI(MF::AME()[minor1])][ev_principal] = gruneisen_roe_ave * minor1_velocity_roe_ave;
+     right_eigenvector[   ETI(MF::AME()[minor1])][MF::ANOE()-1] = minor1_velocity_roe_ave;
+  }
+
+  if constexpr( CC::DIM() == Dimension::Three ) {
+     // second minor momentum equation entries
+     right_eigenvector[ETI(MF::AME()[minor2])   ][      0     ] = minor2_velocity_roe_ave;
+     right_eigenvector[ETI(MF::AME()[minor2])   ][      1     ] = 0.0;
+     right_eigenvector[ETI(MF::AME()[minor2])   ][      2     ] = density_roe_ave;
+     right_eigenvector[ETI(MF::AME()[minor2])   ][ev_principal] = gruneisen_roe_ave * minor2_velocity_roe_ave;
+     right_eigenvector[ETI(MF::AME()[minor2])   ][MF::ANOE()-1] = minor2_velocity_roe_ave;
+  }
+
+  // Energy equation entries
+  right_eigenvector[   ETI(Equation::Energy)    ][      0     ] = enthalpy_roe_ave - principal_velocity_roe_ave * c;
+  if constexpr( CC::DIM() != Dimension::One )
+     right_eigenvector[ETI(Equation::Energy)    ][      1     ] = -minor1_velocity_roe_ave * density_roe_ave;
+  if constexpr( CC::DIM() == Dimension::Three )
+     right_eigenvector[ETI(Equation::Energy)    ][      2     ] = density_roe_ave * minor2_velocity_roe_ave;
+  right_eigenvector[   ETI(Equation::Energy)    ][ev_principal] = gruneisen_roe_ave * enthalpy_roe_ave - c*c;
+  right_eigenvector[   ETI(Equation::Energy)    ][MF::ANOE()-1] = enthalpy_roe_ave + principal_velocity_roe_ave * c;
+  // clang-format on
+}
+
+/**
+ * @brief Transforms conservative values into characteristic space with the
+ * left Roe eigenvectors of a face, which are applied in closed form from the
+ * Roe averages instead of as matrix ( see RoeEigenvectorsFromAverages ). The
+ * contributions of the minor momenta are added such that the result does not
+ * depend on the orientation of the face.
+ * @param conservatives Values of the conservative equations.
+ * @param averages The Roe averages at the face.
+ * @return Values of the characteristic fields.
+ * @tparam DIR The principal direction of the face.
+ * @note Hotpath function.
+ */
+template <Direction DIR>
+inline std::array<double, MF::ANOE()> ProjectToCharacteristicSpace(
+    std::array<double, MF::ANOE()> const &conservatives,
+    RoeFaceAverages const &averages) {
+  constexpr unsigned int principal = DTI(DIR);
+  constexpr unsigned int minor1 = DTI(GetMinorDirection<DIR>(0));
+  constexpr unsigned int minor2 = DTI(GetMinorDirection<DIR>(1));
+  constexpr unsigned int ev_principal = DTI(CC::DIM());
+
+  double const u = averages.principal_velocity_;
+  double const c = averages.speed_of_sound_;
+  double const rho = conservatives[ETI(Equation::Mass)];
+  double const momentum = conservatives[ETI(MF::AME()[principal])];
+  double const minor1_momentum =
+      CC::DIM() != Dimension::One ? conservatives[ETI(MF::AME()[minor1])] : 0.0;
+  double const minor2_momentum = CC::DIM() == Dimension::Three
+                                     ? conservatives[ETI(MF::AME()[minor2])]
+                                     : 0.0;
+  double const minor_kinetic = averages.minor1_velocity_ * minor1_momentum +
+                               averages.minor2_velocity_ * minor2_momentum;
+  // Common part of the acoustic and the entropy fields
+  double const entropy_part = (averages.q_squared_ - averages.enthalpy_) * rho -
+                              (u * momentum + minor_kinetic) +
+                              conservatives[ETI(Equation::Energy)];
+
+  std::array<double, MF::ANOE()> characteristic_values;
+  characteristic_values[0] =
+      0.5 * averages.one_cc_ *
+      (averages.gruneisen_ * entropy_part + c * ((u + c) * rho - momentum));
+  if constexpr (CC::DIM() != Dimension::One) {
+    characteristic_values[1] =
+        averages.one_density_ *
+        (averages.minor1_velocity_ * rho - minor1_momentum);
+  }
+  if constexpr (CC::DIM() == Dimension::Three) {
+    characteristic_values[2] =
+        averages.one_density_ *
+        (minor2_momentum - averages.minor2_velocity_ * rho);
+  }
+  characteristic_values[ev_principal] = -averages.one_cc_ * entropy_part;
+  characteristic_values[MF::ANOE() - 1] =
+      0.5 * averages.one_cc_ *
+      (averages.gruneisen_ * entropy_part - c * ((u - c) * rho - momentum));
+  return characteristic_values;
+}
+
+/**
+ * @brief Transforms characteristic values back into physical space with the
+ * right Roe eigenvectors of a face, applied in closed form. As in
+ * TransformToPhysicalSpace, the acoustic fields are added together to maintain
+ * symmetry.
+ * @param characteristic_values Values of the characteristic fields.
+ * @param averages The Roe averages at the face.
+ * @return Values of the conservative equations.
+ * @tparam DIR The principal direction of the face.
+ * @note Hotpath function.
+ */
+template <Direction DIR>
+inline std::array<double, MF::ANOE()> ProjectToPhysicalSpace(
+    std::array<double, MF::ANOE()> const &characteristic_values,
+    RoeFaceAverages const &averages) {
+  constexpr unsigned int principal = DTI(DIR);
+  constexpr unsigned int minor1 = DTI(GetMinorDirection<DIR>(0));
+  constexpr unsigned int minor2 = DTI(GetMinorDirection<DIR>(1));
+  constexpr unsigned int ev_principal = DTI(CC::DIM());
+
+  double const u = averages.principal_velocity_;
+  double const c = averages.speed_of_sound_;
+  double const w_minus = characteristic_values[0];
+  double const w_plus = characteristic_values[MF::ANOE() - 1];
+  double const w_entropy = characteristic_values[ev_principal];
+  double const w_minor1 =
+      CC::DIM() != Dimension::One ? characteristic_values[1] : 0.0;
+  double const w_minor2 =
+      CC::DIM() == Dimension::Three ? characteristic_values[2] : 0.0;
+  double const w_acoustic = w_minus + w_plus;
+
+  std::array<double, MF::ANOE()> physical_values;
+  physical_values[ETI(Equation::Mass)] =
+      averages.gruneisen_ * w_entropy + w_acoustic;
+  physical_values[ETI(MF::AME()[principal])] =
+      averages.gruneisen_ * u * w_entropy +
+      ((u - c) * w_minus + (u + c) * w_plus);
+  if constexpr (CC::DIM() != Dimension::One) {
+    physical_values[ETI(MF::AME()[minor1])] =
+        (-averages.density_ * w_minor1 +
+         averages.gruneisen_ * averages.minor1_velocity_ * w_entropy) +
+        averages.minor1_velocity_ * w_acoustic;
+  }
+  if constexpr (CC::DIM() == Dimension::Three) {
+    physical_values[ETI(MF::AME()[minor2])] =
+        (averages.density_ * w_minor2 +
+         averages.gruneisen_ * averages.minor2_velocity_ * w_entropy) +
+        averages.minor2_velocity_ * w_acoustic;
+  }
+  physical_values[ETI(Equation::Energy)] =
+      ((-averages.minor1_velocity_ * averages.density_ * w_minor1 +
+        averages.density_ * averages.minor2_velocity_ * w_minor2) +
+       (averages.gruneisen_ * averages.enthalpy_ - c * c) * w_entropy) +
+      ((averages.enthalpy_ - u * c) * w_minus +
+       (averages.enthalpy_ + u * c) * w_plus);
+  return physical_values;
+}
 } // namespace
 
 /**
  * @brief Computes the Roe left and right eigenvectors and the Roe eigenvalues
- * in x-direction according to \cite Fedkiw1999a.
+ * in the given direction according to \cite Fedkiw1999a.
  * @param mat_block The block and material information of the phase under
  * consideration.
  * @param roe_eigenvectors_left Reference to an array which is filled with the
@@ -201,6 +527,167 @@ void EigenDecomposition::ComputeRoeEigendecomposition(
   constexpr unsigned int start_z =
       DIR == Direction::Z ? CC::FICZ() - 1 : CC::FICZ();
 
+  auto const &[material, block] = mat_block;
+
+  for (unsigned int i = start_x; i <= CC::LICX(); ++i) {
+    for (unsigned int j = start_y; j <= CC::LICY(); ++j) {
+      for (unsigned int k = start_z; k <= CC::LICZ(); ++k) {
+        unsigned int const i_index = i - total_to_internal_offset_x;
+        unsigned int const j_index = j - total_to_internal_offset_y;
+        unsigned int const k_index = k - total_to_internal_offset_z;
+        ComputeRoeEigendecompositionAtFace<DIR>(
+            material, block, i, j, k,
+            roe_eigenvectors_left[i_index][j_index][k_index],
+            roe_eigenvectors_right[i_index][j_index][k_index],
+            fluxfunction_eigenvalues[i_index][j_index][k_index]);
+      } // k
+    }   // j
+  }     // i
+}
+
+/**
+ * @brief Computes the Roe left and right eigenvectors and the Roe eigenvalues
+ * on all cell faces of one line along the given direction.
+ * @param mat_block The block and material information of the phase under
+ * consideration.
+ * @param first_minor_index Total cell index of the line in the first minor
+ * direction.
+ * @param second_minor_index Total cell index of the line in the second minor
+ * direction.
+ * @param pencil Scratch storage which is filled with the result, indexed from
+ * the face left of the first internal cell (indirect return parameter).
+ * @note Hotpath function.
+ */
+template <Direction DIR>
+void EigenDecomposition::ComputeRoeEigendecompositionOnPencil(
+    std::pair<MaterialName const, Block> const &mat_block,
+    unsigned int const first_minor_index, unsigned int const second_minor_index,
+    RoeEigendecompositionPencil &pencil) const {
+
+  constexpr unsigned int start = DIR == Direction::X   ? CC::FICX() - 1
+                                 : DIR == Direction::Y ? CC::FICY() - 1
+                                                       : CC::FICZ() - 1;
+  constexpr unsigned int end = DIR == Direction::X   ? CC::LICX()
+                               : DIR == Direction::Y ? CC::LICY()
+                                                     : CC::LICZ();
+
+  auto const &[material, block] = mat_block;
+
+  for (unsigned int p = start; p <= end; ++p) {
+    unsigned int const i = DIR == Direction::X ? p : first_minor_index;
+    unsigned int const j = DIR == Direction::Y   ? p
+                           : DIR == Direction::X ? first_minor_index
+                                                 : second_minor_index;
+    unsigned int const k = DIR == Direction::Z ? p : second_minor_index;
+    ComputeRoeEigendecompositionAtFace<DIR>(
+        material, block, i, j, k, pencil.eigenvectors_left_[p - start],
+        pencil.eigenvectors_right_[p - start], pencil.eigenvalues_[p - start]);
+  }
+}
+
+/**
+ * @brief Computes the Roe left and right eigenvectors and the Roe eigenvalues
+ * on the selected cell faces of one line along the given direction. The
+ * entries of all other faces are left untouched.
+ * @param mat_block The block and material information of the phase under
+ * consideration.
+ * @param first_minor_index Total cell index of the line in the first minor
+ * direction.
+ * @param second_minor_index Total cell index of the line in the second minor
+ * direction.
+ * @param faces Flags of the faces to be decomposed, indexed as the pencil.
+ * @param pencil Scratch storage which is filled with the result, indexed from
+ * the face left of the first internal cell (indirect return parameter).
+ * @note Hotpath function.
+ */
+template <Direction DIR>
+void EigenDecomposition::ComputeRoeEigendecompositionOnPencil(
+    std::pair<MaterialName const, Block> const &mat_block,
+    unsigned int const first_minor_index, unsigned int const second_minor_index,
+    bool const (&faces)[CC::ICX() + 1],
+    RoeEigendecompositionPencil &pencil) const {
+
+  constexpr unsigned int start = DIR == Direction::X   ? CC::FICX() - 1
+                                 : DIR == Direction::Y ? CC::FICY() - 1
+                                                       : CC::FICZ() - 1;
+  constexpr unsigned int end = DIR == Direction::X   ? CC::LICX()
+                               : DIR == Direction::Y ? CC::LICY()
+                                                     : CC::LICZ();
+
+  auto const &[material, block] = mat_block;
+
+  for (unsigned int p = start; p <= end; ++p) {
+    if (!faces[p - start]) {
+      continue;
+    }
+    unsigned int const i = DIR == Direction::X ? p : first_minor_index;
+    unsigned int const j = DIR == Direction::Y   ? p
+                           : DIR == Direction::X ? first_minor_index
+                                                 : second_minor_index;
+    unsigned int const k = DIR == Direction::Z ? p : second_minor_index;
+    ComputeRoeEigendecompositionAtFace<DIR>(
+        material, block, i, j, k, pencil.eigenvectors_left_[p - start],
+        pencil.eigenvectors_right_[p - start], pencil.eigenvalues_[p - start]);
+  }
+}
+
+/**
+ * @brief Computes the Roe averages on all cell faces of one line along the
+ * given direction, see ComputeRoeEigendecompositionOnPencil.
+ * @param mat_block The block and material information of the phase under
+ * consideration.
+ * @param first_minor_index Total cell index of the line in the first minor
+ * direction.
+ * @param second_minor_index Total cell index of the line in the second minor
+ * direction.
+ * @param pencil Scratch storage which is filled with the result, indexed from
+ * the face left of the first internal cell (indirect return parameter).
+ * @note Hotpath function.
+ */
+template <Direction DIR>
+void EigenDecomposition::ComputeRoeAveragesOnPencil(
+    std::pair<MaterialName const, Block> const &mat_block,
+    unsigned int const first_minor_index, unsigned int const second_minor_index,
+    RoeAveragesPencil &pencil) const {
+
+  constexpr unsigned int start = DIR == Direction::X   ? CC::FICX() - 1
+                                 : DIR == Direction::Y ? CC::FICY() - 1
+                                                       : CC::FICZ() - 1;
+  constexpr unsigned int end = DIR == Direction::X   ? CC::LICX()
+                               : DIR == Direction::Y ? CC::LICY()
+                                                     : CC::LICZ();
+
+  auto const &[material, block] = mat_block;
+
+  for (unsigned int p = start; p <= end; ++p) {
+    unsigned int const i = DIR == Direction::X ? p : first_minor_index;
+    unsigned int const j = DIR == Direction::Y   ? p
+                           : DIR == Direction::X ? first_minor_index
+                                                 : second_minor_index;
+    unsigned int const k = DIR == Direction::Z ? p : second_minor_index;
+    ComputeRoeAveragesAtFace<DIR>(material, block, i, j, k,
+                                  pencil.faces_[p - start]);
+  }
+}
+
+/**
+ * @brief Computes the Roe averages at the cell face between cell (i,j,k) and
+ * its neighbor in the given direction according to \cite Fedkiw1999a. They
+ * define the eigenvectors of the face, see RoeEigenvectorsFromAverages.
+ * @param material The material of the block.
+ * @param block The block under consideration.
+ * @param i,j,k Total cell indices of the cell left of the face.
+ * @param averages Roe averages at the face, all zero for faces next to cells
+ * without a valid state (indirect return parameter).
+ * @return False if the face lies next to a cell without a valid state.
+ * @note Hotpath function.
+ */
+template <Direction DIR>
+bool EigenDecomposition::ComputeRoeAveragesAtFace(
+    MaterialName const material, Block const &block, unsigned int const i,
+    unsigned int const j, unsigned int const k,
+    RoeFaceAverages &averages) const {
+
   constexpr unsigned int x_varying = DIR == Direction::X ? 1 : 0;
   constexpr unsigned int y_varying = DIR == Direction::Y ? 1 : 0;
   constexpr unsigned int z_varying = DIR == Direction::Z ? 1 : 0;
@@ -211,22 +698,16 @@ void EigenDecomposition::ComputeRoeEigendecomposition(
   constexpr unsigned int minor1 = DTI(GetMinorDirection<DIR>(0));
   constexpr unsigned int minor2 = DTI(GetMinorDirection<DIR>(1));
 
-  // Index of eigenvectors for characteristic fields due to principal momentum
-  constexpr unsigned int ev_principal = DTI(CC::DIM());
-
-  // Access the pair's elements directly.
-  auto const &[material, block] = mat_block;
-
   // We need to use the conservative buffer for density as the prime state is
   // only consistent (if zero) after last RK stage
   Conservatives const &conservatives = block.GetAverageBuffer();
-  double const(&density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       block.GetAverageBuffer(Equation::Mass);
-  double const(&energy)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&energy)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       block.GetAverageBuffer(Equation::Energy);
 
   PrimeStates const &prime_states = block.GetPrimeStateBuffer();
-  double const(&pressure)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&pressure)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       block.GetPrimeStateBuffer(PrimeState::Pressure);
 
   double const gruneisen_coefficient_material =
@@ -235,235 +716,202 @@ void EigenDecomposition::ComputeRoeEigendecomposition(
                                             .GetEquationOfState()
                                             .Gruneisen();
 
-  for (unsigned int i = start_x; i <= CC::LICX(); ++i) {
-    for (unsigned int j = start_y; j <= CC::LICY(); ++j) {
-      for (unsigned int k = start_z; k <= CC::LICZ(); ++k) {
-        // clang-format off
-            // Indices of neighbor cell
-            unsigned int const in = i + x_varying;
-            unsigned int const jn = j + y_varying;
-            unsigned int const kn = k + z_varying;
-            /**
-             * This if statement is necessary due to the ghost-fluid method. In ghost-material cells which do not lie on the extension band, i.e. therein
-             * we do not have extended or integrated values, the density is zero. Therefore, we cannot compute Roe eigenvalues in those cells.
-             */
-            if(density[i][j][k] <= 0.0 || density[in][jn][kn] <= 0.0) continue;
-
-            // References to write directly to the buffers of the currently considered cell face
-            auto& left_eigenvector  = roe_eigenvectors_left   [i - total_to_internal_offset_x][j - total_to_internal_offset_y][k - total_to_internal_offset_z];
-            auto& right_eigenvector = roe_eigenvectors_right  [i - total_to_internal_offset_x][j - total_to_internal_offset_y][k - total_to_internal_offset_z];
-            auto& eigenvalues       = fluxfunction_eigenvalues[i - total_to_internal_offset_x][j - total_to_internal_offset_y][k - total_to_internal_offset_z];
-
-            // extract required conservatives and primes
-            double const rho_target                 =       density[i][j][k];
-            double const one_rho_target             = 1.0 / density[i][j][k];
-            double const energy_target              =     energy[i][j][k];
-            double const x_momentum_target          = conservatives[Equation::MomentumX][i][j][k];
-            double const y_momentum_target          = CC::DIM() != Dimension::One ? conservatives[Equation::MomentumY][i][j][k] : 0.0;
-            double const z_momentum_target          = CC::DIM() == Dimension::Three ? conservatives[Equation::MomentumZ][i][j][k] : 0.0;
-            double const principal_velocity_target  = prime_states[MF::AV()[principal]][i][j][k];
-            double const minor1_velocity_target     = CC::DIM() != Dimension::One   ? prime_states[MF::AV()[minor1]][i][j][k] : 0.0;
-            double const minor2_velocity_target     = CC::DIM() == Dimension::Three ? prime_states[MF::AV()[minor2]][i][j][k] : 0.0;
-            double const pressure_target            = pressure[i][j][k];
-            double const generalized_psi_target     = material_manager_.GetMaterial(material).GetEquationOfState().Psi(pressure_target, one_rho_target);
-            double const gruneisen_target           = CC::GruneisenDensityDependent() ? material_manager_.GetMaterial(material).GetEquationOfState().Gruneisen(rho_target) : 0.0;
-
-            double const rho_neighbor               =       density[in][jn][kn];
-            double const one_rho_neighbor           = 1.0 / density[in][jn][kn];
-            double const energy_neighbor            =     energy[in][jn][kn];
-            double const x_momentum_neighbor        = conservatives[Equation::MomentumX][in][jn][kn];
-            double const y_momentum_neighbor        = CC::DIM() != Dimension::One ? conservatives[Equation::MomentumY][in][jn][kn] : 0.0;
-            double const z_momentum_neighbor        = CC::DIM() == Dimension::Three ? conservatives[Equation::MomentumZ][in][jn][kn] : 0.0;
-            double const principal_velocity_neighbor= prime_states[MF::AV()[principal]][in][jn][kn];
-            double const minor1_velocity_neighbor   = CC::DIM() != Dimension::One   ? prime_states[MF::AV()[minor1]][in][jn][kn] : 0.0;
-            double const minor2_velocity_neighbor   = CC::DIM() == Dimension::Three ? prime_states[MF::AV()[minor2]][in][jn][kn] : 0.0;
-            double const pressure_neighbor          =   pressure[in][jn][kn];
-            double const generalized_psi_neighbor   = material_manager_.GetMaterial(material).GetEquationOfState().Psi(pressure_neighbor, one_rho_neighbor);
-            double const gruneisen_neighbor         = CC::GruneisenDensityDependent() ? material_manager_.GetMaterial(material).GetEquationOfState().Gruneisen(rho_neighbor) : 0.0;
-
-            // compute expensive and frequently used temporaries
-            double const sqrt_rho_target   = std::sqrt(rho_target);
-            double const sqrt_rho_neighbor = std::sqrt(rho_neighbor);
-            double const rho_div = 1.0 / ( sqrt_rho_target + sqrt_rho_neighbor );
-            double const density_roe_ave = sqrt_rho_target * sqrt_rho_neighbor;
-            double const one_density_roe_ave = 1.0 / density_roe_ave;
-
-            // compute Roe averages
-            double const principal_velocity_roe_ave = ((principal_velocity_target * sqrt_rho_target) + (principal_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
-            double const minor1_velocity_roe_ave = ((minor1_velocity_target * sqrt_rho_target) + (minor1_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
-            double const minor2_velocity_roe_ave = ((minor2_velocity_target * sqrt_rho_target) + (minor2_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
-            double const generalized_psi_roe_ave = ((generalized_psi_target * sqrt_rho_target) + (generalized_psi_neighbor * sqrt_rho_neighbor)) * rho_div;
-            double const gruneisen_roe_ave = CC::GruneisenDensityDependent() ? ((gruneisen_target * sqrt_rho_target) + (gruneisen_neighbor * sqrt_rho_neighbor)) * rho_div : gruneisen_coefficient_material;
-            double const enthalpy_roe_ave = ( material_manager_.GetMaterial(material).GetEquationOfState().Enthalpy(rho_target,   x_momentum_target,   y_momentum_target,   z_momentum_target,   energy_target )   * sqrt_rho_target
-                                            + material_manager_.GetMaterial(material).GetEquationOfState().Enthalpy(rho_neighbor, x_momentum_neighbor, y_momentum_neighbor, z_momentum_neighbor, energy_neighbor ) * sqrt_rho_neighbor)
-                                            * rho_div;
-
-            // Absolute roe averaged velocity, speed of sound
-            double const q_squared  = DimensionAwareConsistencyManagedSum( principal_velocity_roe_ave * principal_velocity_roe_ave, minor1_velocity_roe_ave * minor1_velocity_roe_ave, minor2_velocity_roe_ave * minor2_velocity_roe_ave);
-            double const tmp = DimensionAwareConsistencyManagedSum( (principal_velocity_target - principal_velocity_neighbor) * (principal_velocity_target - principal_velocity_neighbor),
-                                                         (minor1_velocity_target    - minor1_velocity_neighbor)    * (minor1_velocity_target    - minor1_velocity_neighbor),
-                                                         (minor2_velocity_target    - minor2_velocity_neighbor)    * (minor2_velocity_target    - minor2_velocity_neighbor) );
-            double const pressure_over_density_roe_ave = ((pressure_target*one_rho_target) * sqrt_rho_target + (pressure_neighbor*one_rho_neighbor) * sqrt_rho_neighbor) * rho_div
-                                                           + 0.5 * density_roe_ave * (rho_div * rho_div) * tmp;
-            double const cc = generalized_psi_roe_ave + gruneisen_roe_ave * pressure_over_density_roe_ave;
-            double const one_cc = 1.0 / cc;
-            double const c = std::sqrt(cc);
-
-            // LEFT EIGENVECTORS **********************************************
-            // ****************************************************************
-
-            // Eigenvector for lambda = u-c
-            left_eigenvector[         0     ][ETI(Equation::Mass)       ] = 0.5 * one_cc * (gruneisen_roe_ave*q_squared - gruneisen_roe_ave*enthalpy_roe_ave + (principal_velocity_roe_ave+c) * c);
-            left_eigenvector[         0     ][ETI(MF::AME()[principal]) ] = 0.5 * one_cc * (-principal_velocity_roe_ave * gruneisen_roe_ave - c);
-            if constexpr( CC::DIM() != Dimension::One )
-               left_eigenvector[      0     ][ETI(MF::AME()[minor1])    ] = 0.5 * one_cc * (-minor1_velocity_roe_ave*gruneisen_roe_ave);
-            if constexpr( CC::DIM() == Dimension::Three )
-               left_eigenvector[      0     ][ETI(MF::AME()[minor2])    ] = 0.5 * one_cc * (-minor2_velocity_roe_ave*gruneisen_roe_ave);
-            left_eigenvector[         0     ][ETI(Equation::Energy)     ] = 0.5 * one_cc * gruneisen_roe_ave;
-
-            if constexpr( CC::DIM() != Dimension::One ) {
-               // Additional eigenvector for lambda = u related to second momentum equation (= first minor momentum)
-               left_eigenvector[      1     ][ETI(Equation::Mass)       ] = minor1_velocity_roe_ave * one_density_roe_ave;
-               left_eigenvector[      1     ][ETI(MF::AME()[principal]) ] = 0.0;
-               left_eigenvector[      1     ][ETI(MF::AME()[minor1])    ] = -one_density_roe_ave;
-               if constexpr( CC::DIM() == Dimension::Three )
-                  left_eigenvector[   1     ][ETI(MF::AME()[minor2])    ] = 0.0;
-               left_eigenvector[      1     ][ETI(Equation::Energy)     ] = 0.0;
-            }
-
-            if constexpr( CC::DIM() == Dimension::Three ) {
-               // Additional eigenvector for lambda = u related to third momentum equation (= second minor momentum)
-               left_eigenvector[      2     ][ETI(Equation::Mass)       ] = -minor2_velocity_roe_ave * one_density_roe_ave;
-               left_eigenvector[      2     ][ETI(MF::AME()[principal]) ] = 0.0;
-               left_eigenvector[      2     ][ETI(MF::AME()[minor1])    ] = 0.0;
-               left_eigenvector[      2     ][ETI(MF::AME()[minor2])    ] = one_density_roe_ave;
-               left_eigenvector[      2     ][ETI(Equation::Energy)     ] = 0.0;
-            }
-
-            // Eigenvector for lambda = u related to principal momentum direction
-            left_eigenvector[   ev_principal][ETI(Equation::Mass)       ] =  one_cc * (enthalpy_roe_ave - q_squared);
-            left_eigenvector[   ev_principal][ETI(MF::AME()[principal]) ] =  one_cc * principal_velocity_roe_ave;
-            if constexpr( CC::DIM() != Dimension::One )
-               left_eigenvector[ev_principal][ETI(MF::AME()[minor1])    ] =  one_cc * minor1_velocity_roe_ave;
-            if constexpr( CC::DIM() == Dimension::Three )
-               left_eigenvector[ev_principal][ETI(MF::AME()[minor2])    ] =  one_cc * minor2_velocity_roe_ave;
-            left_eigenvector[   ev_principal][ETI(Equation::Energy)     ] = -one_cc;
-
-            // eigenvector for lambda = u+c
-            left_eigenvector[   MF::ANOE()-1][ETI(Equation::Mass)       ] = 0.5 * one_cc * (gruneisen_roe_ave*q_squared - gruneisen_roe_ave*enthalpy_roe_ave - (principal_velocity_roe_ave-c) * c);
-            left_eigenvector[   MF::ANOE()-1][ETI(MF::AME()[principal]) ] = 0.5 * one_cc * (-principal_velocity_roe_ave*gruneisen_roe_ave + c);
-            if constexpr( CC::DIM() != Dimension::One )
-               left_eigenvector[MF::ANOE()-1][ETI(MF::AME()[minor1])    ] = 0.5 * one_cc * (-minor1_velocity_roe_ave*gruneisen_roe_ave);
-            if constexpr( CC::DIM() == Dimension::Three )
-               left_eigenvector[MF::ANOE()-1][ETI(MF::AME()[minor2])    ] = 0.5 * one_cc * (-minor2_velocity_roe_ave*gruneisen_roe_ave);
-            left_eigenvector[   MF::ANOE()-1][ETI(Equation::Energy)     ] = 0.5 * one_cc * gruneisen_roe_ave;
-
-
-            // RIGHT EIGENVECTORS *********************************************
-            // ****************************************************************
-
-            // Mass equation entries of right eigenvectors
-            right_eigenvector[   ETI(Equation::Mass)      ][      0     ] = 1.0;
-            if constexpr( CC::DIM() != Dimension::One )
-               right_eigenvector[ETI(Equation::Mass)      ][      1     ] = 0.0;
-            if constexpr( CC::DIM() == Dimension::Three )
-               right_eigenvector[ETI(Equation::Mass)      ][      2     ] = 0.0;
-            right_eigenvector[   ETI(Equation::Mass)      ][ev_principal] = gruneisen_roe_ave;
-            right_eigenvector[   ETI(Equation::Mass)      ][MF::ANOE()-1] = 1.0;
-
-            // principal momentum equation entries
-            right_eigenvector[   ETI(MF::AME()[principal])][      0     ] = principal_velocity_roe_ave - c;
-            if constexpr( CC::DIM() != Dimension::One )
-               right_eigenvector[ETI(MF::AME()[principal])][      1     ] = 0.0;
-            if constexpr( CC::DIM() == Dimension::Three )
-               right_eigenvector[ETI(MF::AME()[principal])][      2     ] = 0.0;
-            right_eigenvector[   ETI(MF::AME()[principal])][ev_principal] = gruneisen_roe_ave * principal_velocity_roe_ave;
-            right_eigenvector[   ETI(MF::AME()[principal])][MF::ANOE()-1] = principal_velocity_roe_ave + c;
-
-            if constexpr( CC::DIM() != Dimension::One ) {
-               // first minor momentum equation entries
-               right_eigenvector[   ETI(MF::AME()[minor1])][      0     ] = minor1_velocity_roe_ave;
-               right_eigenvector[   ETI(MF::AME()[minor1])][      1     ] = -density_roe_ave;
-               if constexpr( CC::DIM() == Dimension::Three )
-                  right_eigenvector[ETI(MF::AME()[minor1])][      2     ] = 0.0;
-               right_eigenvector[   ETI(MF::AME()[minor1])][ev_principal] = gruneisen_roe_ave * minor1_velocity_roe_ave;
-               right_eigenvector[   ETI(MF::AME()[minor1])][MF::ANOE()-1] = minor1_velocity_roe_ave;
-            }
-
-            if constexpr( CC::DIM() == Dimension::Three ) {
-               // second minor momentum equation entries
-               right_eigenvector[ETI(MF::AME()[minor2])   ][      0     ] = minor2_velocity_roe_ave;
-               right_eigenvector[ETI(MF::AME()[minor2])   ][      1     ] = 0.0;
-               right_eigenvector[ETI(MF::AME()[minor2])   ][      2     ] = density_roe_ave;
-               right_eigenvector[ETI(MF::AME()[minor2])   ][ev_principal] = gruneisen_roe_ave * minor2_velocity_roe_ave;
-               right_eigenvector[ETI(MF::AME()[minor2])   ][MF::ANOE()-1] = minor2_velocity_roe_ave;
-            }
-
-            // Energy equation entries
-            right_eigenvector[   ETI(Equation::Energy)    ][      0     ] = enthalpy_roe_ave - principal_velocity_roe_ave * c;
-            if constexpr( CC::DIM() != Dimension::One )
-               right_eigenvector[ETI(Equation::Energy)    ][      1     ] = -minor1_velocity_roe_ave * density_roe_ave;
-            if constexpr( CC::DIM() == Dimension::Three )
-               right_eigenvector[ETI(Equation::Energy)    ][      2     ] = density_roe_ave * minor2_velocity_roe_ave;
-            right_eigenvector[   ETI(Equation::Energy)    ][ev_principal] = gruneisen_roe_ave * enthalpy_roe_ave - c*c;
-            right_eigenvector[   ETI(Equation::Energy)    ][MF::ANOE()-1] = enthalpy_roe_ave + principal_velocity_roe_ave * c;
-
-
-            // EIGENVALUES ****************************************************
-            // ****************************************************************
-
-            // Flux-function artificial viscosity -> Roe eigenvalues
-            if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::Roe ) {
-               SaveForAllFields( eigenvalues,
-                  std::abs(principal_velocity_roe_ave - c),
-                  std::abs(principal_velocity_roe_ave),
-                  std::abs(principal_velocity_roe_ave + c) );
-            }
-
-            // Flux-function artificial viscosity -> Roe-M eigenvalues
-            if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::Roe_M ) {
-               SaveForAllFields( eigenvalues,
-                  std::abs( principal_velocity_roe_ave - std::min( c, FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_roe_ave ) ) ),
-                  std::abs( principal_velocity_roe_ave ),
-                  std::abs( principal_velocity_roe_ave + std::min( c, FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_roe_ave ) ) ) );
-            }
-
-            // Flux-function artificial viscosity -> Local-Lax-Friedrichs eigenvalues
-            if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::LocalLaxFriedrichs ) {
-               double const c_target   = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_target,   pressure_target);
-               double const c_neighbor = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_neighbor, pressure_neighbor);
-
-               SaveForAllFields( eigenvalues,
-                  std::max(std::abs(principal_velocity_target - c_target),std::abs(principal_velocity_neighbor - c_neighbor)),
-                  std::max(std::abs(principal_velocity_target), std::abs(principal_velocity_neighbor)),
-                  std::max(std::abs(principal_velocity_target + c_target),std::abs(principal_velocity_neighbor + c_neighbor)) );
-            }
-
-            // Flux-function artificial viscosity -> LLF-M eigenvalues
-            if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::LocalLaxFriedrichs_M ) {
-               double const c_target   = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_target,   pressure_target);
-               double const c_neighbor = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_neighbor, pressure_neighbor);
-
-               double const c_target_m   = std::min( FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_target )  , c_target );
-               double const c_neighbor_m = std::min( FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_neighbor ), c_neighbor );
-
-               SaveForAllFields( eigenvalues,
-                  std::max(std::abs(principal_velocity_target - c_target_m),std::abs(principal_velocity_neighbor - c_neighbor_m)),
-                  std::max(std::abs(principal_velocity_target), std::abs(principal_velocity_neighbor)),
-                  std::max(std::abs(principal_velocity_target + c_target_m),std::abs(principal_velocity_neighbor + c_neighbor_m)) );
-            }
-
-            // Flux-function artificial viscosity -> Global-Lax-Friedrichs or LaxFriedrichs scheme
-            if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::GlobalLaxFriedrichs ) {
-               for(unsigned int l = 0; l < MF::ANOE(); ++l) {
-                  eigenvalues[l] = global_eigenvalues_[0][l];
-               }
-            }
-
-        // clang-format on
-      } // k
-    }   // j
-  }     // i
+  // clang-format off
+  // Indices of neighbor cell
+  unsigned int const in = i + x_varying;
+  unsigned int const jn = j + y_varying;
+  unsigned int const kn = k + z_varying;
+  /**
+   * This if statement is necessary due to the ghost-fluid method. In ghost-material cells which do not lie on the extension band, i.e. therein
+   * we do not have extended or integrated values, the density is zero. Therefore, we cannot compute Roe eigenvalues in those cells.
+   */
+  if(density[i][j][k] <= 0.0 || density[in][jn][kn] <= 0.0) {
+     // All-zero averages project every state onto zero
+     averages = RoeFaceAverages();
+     return false;
+  }
+
+  // extract required conservatives and primes
+  double const rho_target                 =       density[i][j][k];
+  double const one_rho_target             = 1.0 / density[i][j][k];
+  double const energy_target              =     energy[i][j][k];
+  double const x_momentum_target          = conservatives[Equation::MomentumX][i][j][k];
+  double const y_momentum_target          = CC::DIM() != Dimension::One ? conservatives[Equation::MomentumY][i][j][k] : 0.0;
+  double const z_momentum_target          = CC::DIM() == Dimension::Three ? conservatives[Equation::MomentumZ][i][j][k] : 0.0;
+  double const principal_velocity_target  = prime_states[MF::AV()[principal]][i][j][k];
+  double const minor1_velocity_target     = CC::DIM() != Dimension::One   ? prime_states[MF::AV()[minor1]][i][j][k] : 0.0;
+  double const minor2_velocity_target     = CC::DIM() == Dimension::Three ? prime_states[MF::AV()[minor2]][i][j][k] : 0.0;
+  double const pressure_target            = pressure[i][j][k];
+  double const generalized_psi_target     = material_manager_.GetMaterial(material).GetEquationOfState().Psi(pressure_target, one_rho_target);
+  double const gruneisen_target           = CC::GruneisenDensityDependent() ? material_manager_.GetMaterial(material).GetEquationOfState().Gruneisen(rho_target) : 0.0;
+
+  double const rho_neighbor               =       density[in][jn][kn];
+  double const one_rho_neighbor           = 1.0 / density[in][jn][kn];
+  double const energy_neighbor            =     energy[in][jn][kn];
+  double const x_momentum_neighbor        = conservatives[Equation::MomentumX][in][jn][kn];
+  double const y_momentum_neighbor        = CC::DIM() != Dimension::One ? conservatives[Equation::MomentumY][in][jn][kn] : 0.0;
+  double const z_momentum_neighbor        = CC::DIM() == Dimension::Three ? conservatives[Equation::MomentumZ][in][jn][kn] : 0.0;
+  double const principal_velocity_neighbor= prime_states[MF::AV()[principal]][in][jn][kn];
+  double const minor1_velocity_neighbor   = CC::DIM() != Dimension::One   ? prime_states[MF::AV()[minor1]][in][jn][kn] : 0.0;
+  double const minor2_velocity_neighbor   = CC::DIM() == Dimension::Three ? prime_states[MF::AV()[minor2]][in][jn][kn] : 0.0;
+  double const pressure_neighbor          =   pressure[in][jn][kn];
+  double const generalized_psi_neighbor   = material_manager_.GetMaterial(material).GetEquationOfState().Psi(pressure_neighbor, one_rho_neighbor);
+  double const gruneisen_neighbor         = CC::GruneisenDensityDependent() ? material_manager_.GetMaterial(material).GetEquationOfState().Gruneisen(rho_neighbor) : 0.0;
+
+  // compute expensive and frequently used temporaries
+  double const sqrt_rho_target   = std::sqrt(rho_target);
+  double const sqrt_rho_neighbor = std::sqrt(rho_neighbor);
+  double const rho_div = 1.0 / ( sqrt_rho_target + sqrt_rho_neighbor );
+  double const density_roe_ave = sqrt_rho_target * sqrt_rho_neighbor;
+  double const one_density_roe_ave = 1.0 / density_roe_ave;
+
+  // compute Roe averages
+  double const principal_velocity_roe_ave = ((principal_velocity_target * sqrt_rho_target) + (principal_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
+  double const minor1_velocity_roe_ave = ((minor1_velocity_target * sqrt_rho_target) + (minor1_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
+  double const minor2_velocity_roe_ave = ((minor2_velocity_target * sqrt_rho_target) + (minor2_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
+  double const generalized_psi_roe_ave = ((generalized_psi_target * sqrt_rho_target) + (generalized_psi_neighbor * sqrt_rho_neighbor)) * rho_div;
+  double const gruneisen_roe_ave = CC::GruneisenDensityDependent() ? ((gruneisen_target * sqrt_rho_target) + (gruneisen_neighbor * sqrt_rho_neighbor)) * rho_div : gruneisen_coefficient_material;
+  double const enthalpy_roe_ave = ( material_manager_.GetMaterial(material).GetEquationOfState().Enthalpy(rho_target,   x_momentum_target,   y_momentum_target,   z_momentum_target,   energy_target )   * sqrt_rho_target
+                                  + material_manager_.GetMaterial(material).GetEquationOfState().Enthalpy(rho_neighbor, x_momentum_neighbor, y_momentum_neighbor, z_momentum_neighbor, energy_neighbor ) * sqrt_rho_neighbor)
+                                  * rho_div;
+
+  // Absolute roe averaged velocity, speed of sound
+  double const q_squared  = DimensionAwareConsistencyManagedSum( principal_velocity_roe_ave * principal_velocity_roe_ave, minor1_velocity_roe_ave * minor1_velocity_roe_ave, minor2_velocity_roe_ave * minor2_velocity_roe_ave);
+  double const tmp = DimensionAwareConsistencyManagedSum( (principal_velocity_target - principal_velocity_neighbor) * (principal_velocity_target - principal_velocity_neighbor),
+                                               (minor1_velocity_target    - minor1_velocity_neighbor)    * (minor1_velocity_target    - minor1_velocity_neighbor),
+                                               (minor2_velocity_target    - minor2_velocity_neighbor)    * (minor2_velocity_target    - minor2_velocity_neighbor) );
+  double const pressure_over_density_roe_ave = ((pressure_target*one_rho_target) * sqrt_rho_target + (pressure_neighbor*one_rho_neighbor) * sqrt_rho_neighbor) * rho_div
+                                                 + 0.5 * density_roe_ave * (rho_div * rho_div) * tmp;
+  double const cc = generalized_psi_roe_ave + gruneisen_roe_ave * pressure_over_density_roe_ave;
+  double const one_cc = 1.0 / cc;
+  double const c = std::sqrt(cc);
+
+  averages.principal_velocity_ = principal_velocity_roe_ave;
+  averages.minor1_velocity_    = minor1_velocity_roe_ave;
+  averages.minor2_velocity_    = minor2_velocity_roe_ave;
+  averages.q_squared_          = q_squared;
+  averages.enthalpy_           = enthalpy_roe_ave;
+  averages.gruneisen_          = gruneisen_roe_ave;
+  averages.speed_of_sound_     = c;
+  averages.one_cc_             = one_cc;
+  averages.density_            = density_roe_ave;
+  averages.one_density_        = one_density_roe_ave;
+  return true;
+  // clang-format on
+}
+
+/**
+ * @brief Computes the Roe left and right eigenvectors and the Roe eigenvalues
+ * at the cell face between cell (i,j,k) and its neighbor in the given direction
+ * according to \cite Fedkiw1999a. Faces next to cells without a valid state
+ * are filled with zeros.
+ * @param material The material of the block.
+ * @param block The block under consideration.
+ * @param i,j,k Total cell indices of the cell left of the face.
+ * @param left_eigenvector Left eigenvectors at the face (indirect return
+ * parameter).
+ * @param right_eigenvector Right eigenvectors at the face (indirect return
+ * parameter).
+ * @param eigenvalues Flux-function eigenvalues at the face (indirect return
+ * parameter).
+ * @note Hotpath function.
+ */
+template <Direction DIR>
+void EigenDecomposition::ComputeRoeEigendecompositionAtFace(
+    MaterialName const material, Block const &block, unsigned int const i,
+    unsigned int const j, unsigned int const k,
+    double (&left_eigenvector)[MF::ANOE()][MF::ANOE()],
+    double (&right_eigenvector)[MF::ANOE()][MF::ANOE()],
+    double (&eigenvalues)[MF::ANOE()]) const {
+
+  RoeFaceAverages averages;
+  if (!ComputeRoeAveragesAtFace<DIR>(material, block, i, j, k, averages)) {
+    // Give defined (zero) entries for skipped faces, such that callers do not
+    // need to clear their buffers
+    for (unsigned int l = 0; l < MF::ANOE(); ++l) {
+      for (unsigned int m = 0; m < MF::ANOE(); ++m) {
+        left_eigenvector[l][m] = 0.0;
+        right_eigenvector[l][m] = 0.0;
+      }
+      eigenvalues[l] = 0.0;
+    }
+    return;
+  }
+  RoeEigenvectorsFromAverages<DIR>(averages, left_eigenvector,
+                                   right_eigenvector);
+
+  double const principal_velocity_roe_ave = averages.principal_velocity_;
+  double const c = averages.speed_of_sound_;
+
+  // States of both cells, only used by the local Lax-Friedrichs eigenvalues
+  [[maybe_unused]] unsigned int const in = i + (DIR == Direction::X ? 1 : 0);
+  [[maybe_unused]] unsigned int const jn = j + (DIR == Direction::Y ? 1 : 0);
+  [[maybe_unused]] unsigned int const kn = k + (DIR == Direction::Z ? 1 : 0);
+  [[maybe_unused]] double const rho_target =
+      block.GetAverageBuffer(Equation::Mass)[i][j][k];
+  [[maybe_unused]] double const rho_neighbor =
+      block.GetAverageBuffer(Equation::Mass)[in][jn][kn];
+  [[maybe_unused]] double const pressure_target =
+      block.GetPrimeStateBuffer(PrimeState::Pressure)[i][j][k];
+  [[maybe_unused]] double const pressure_neighbor =
+      block.GetPrimeStateBuffer(PrimeState::Pressure)[in][jn][kn];
+  [[maybe_unused]] double const principal_velocity_target =
+      block.GetPrimeStateBuffer(MF::AV()[DTI(DIR)])[i][j][k];
+  [[maybe_unused]] double const principal_velocity_neighbor =
+      block.GetPrimeStateBuffer(MF::AV()[DTI(DIR)])[in][jn][kn];
+
+  // clang-format off
+  // EIGENVALUES ****************************************************
+  // ****************************************************************
+
+  // Flux-function artificial viscosity -> Roe eigenvalues
+  if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::Roe ) {
+     SaveForAllFields( eigenvalues,
+        std::abs(principal_velocity_roe_ave - c),
+        std::abs(principal_velocity_roe_ave),
+        std::abs(principal_velocity_roe_ave + c) );
+  }
+
+  // Flux-function artificial viscosity -> Roe-M eigenvalues
+  if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::Roe_M ) {
+     SaveForAllFields( eigenvalues,
+        std::abs( principal_velocity_roe_ave - std::min( c, FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_roe_ave ) ) ),
+        std::abs( principal_velocity_roe_ave ),
+        std::abs( principal_velocity_roe_ave + std::min( c, FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_roe_ave ) ) ) );
+  }
+
+  // Flux-function artificial viscosity -> Local-Lax-Friedrichs eigenvalues
+  if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::LocalLaxFriedrichs ) {
+     double const c_target   = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_target,   pressure_target);
+     double const c_neighbor = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_neighbor, pressure_neighbor);
+
+     SaveForAllFields( eigenvalues,
+        std::max(std::abs(principal_velocity_target - c_target),std::abs(principal_velocity_neighbor - c_neighbor)),
+        std::max(std::abs(principal_velocity_target), std::abs(principal_velocity_neighbor)),
+        std::max(std::abs(principal_velocity_target + c_target),std::abs(principal_velocity_neighbor + c_neighbor)) );
+  }
+
+  // Flux-function artificial viscosity -> LLF-M eigenvalues
+  if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::LocalLaxFriedrichs_M ) {
+     double const c_target   = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_target,   pressure_target);
+     double const c_neighbor = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_neighbor, pressure_neighbor);
+
+     double const c_target_m   = std::min( FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_target )  , c_target );
+     double const c_neighbor_m = std::min( FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_neighbor ), c_neighbor );
+
+     SaveForAllFields( eigenvalues,
+        std::max(std::abs(principal_velocity_target - c_target_m),std::abs(principal_velocity_neighbor - c_neighbor_m)),
+        std::max(std::abs(principal_velocity_target), std::abs(principal_velocity_neighbor)),
+        std::max(std::abs(principal_velocity_target + c_target_m),std::abs(principal_velocity_neighbor + c_neighbor_m)) );
+  }
+
+  // Flux-function artificial viscosity -> Global-Lax-Friedrichs or LaxFriedrichs scheme
+  if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::GlobalLaxFriedrichs ) {
+     for(unsigned int l = 0; l < MF::ANOE(); ++l) {
+        eigenvalues[l] = global_eigenvalues_[0][l];
+     }
+  }
+  // clang-format on
 }
 
 #endif // EIGENVALUE_CALCULATOR_H
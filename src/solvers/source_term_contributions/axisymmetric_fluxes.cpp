@@ -33,17 +33,17 @@ void AxisymmetricFluxes::ComputeAxisymmetricContributions(
     double (&volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()],
     double const cell_size, double const node_origin_x) const {
 
-  double const(&velocity_x)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&velocity_x)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       block.GetPrimeStateBuffer(PrimeState::VelocityX);
-  double const(&pressure)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&pressure)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       block.GetPrimeStateBuffer(PrimeState::Pressure);
-  double const(&momentum_x)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&momentum_x)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       block.GetAverageBuffer(Equation::MomentumX);
   // direct use of y-momentum buffer allowed since axisymmetric is only used in
   // 2D
-  double const(&momentum_y)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&momentum_y)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       block.GetAverageBuffer(Equation::MomentumY);
-  double const(&energy)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&energy)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       block.GetAverageBuffer(Equation::Energy);
 
   for (unsigned int i = 0; i < CC::ICX(); ++i) {
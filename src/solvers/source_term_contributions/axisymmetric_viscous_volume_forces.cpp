@@ -56,16 +56,17 @@ void AxisymmetricViscousVolumeForces::ComputeForces(
                                                 [CC::ICY()][CC::ICZ()],
     double const cell_size, double const node_origin_x) const {
 
-  double const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       mat_block.second.GetPrimeStateBuffer(PrimeState::VelocityX);
-  double const(&v)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&v)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       mat_block.second.GetPrimeStateBuffer(PrimeState::VelocityY);
-  double const(&w)[CC::TCX()][CC::TCY()][CC::TCZ()] = u;
+  FieldValue const(&w)[CC::TCX()][CC::TCY()][CC::TCZ()] = u;
 
   // Get the shear viscosity from the material (all computations below ensure
   // that buffer is only used when model is active, otherwise the buffer does
   // not exist)
-  double const(&shear_viscosity_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  ParameterValue const(
+      &shear_viscosity_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       mat_block.second.GetParameterBuffer(Parameter::ShearViscosity);
   double const shear_viscosity_fixed =
       material_manager_.GetMaterial(mat_block.first).GetShearViscosity();
@@ -141,9 +142,10 @@ void AxisymmetricViscousVolumeForces::ComputeForces(
  * parameter.
  */
 void AxisymmetricViscousVolumeForces::ComputeVelocityGradient(
-    double const (&u)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    double const (&v)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    double const (&w)[CC::TCX()][CC::TCY()][CC::TCZ()], double const cell_size,
+    FieldValue const (&u)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    FieldValue const (&v)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    FieldValue const (&w)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double const cell_size,
     double (&velocity_gradient)[CC::TCX()][CC::TCY()][dim_][dim_]) const {
   /**
    * @brief Offsets in order to also calculate first derivatives in halo cells.
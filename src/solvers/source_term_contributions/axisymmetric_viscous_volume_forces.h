@@ -39,9 +39,9 @@ private:
       2; // only sane configuration; enables unit testing
 
   void ComputeVelocityGradient(
-      double const (&u)[CC::TCX()][CC::TCY()][CC::TCZ()],
-      double const (&v)[CC::TCX()][CC::TCY()][CC::TCZ()],
-      double const (&w)[CC::TCX()][CC::TCY()][CC::TCZ()],
+      FieldValue const (&u)[CC::TCX()][CC::TCY()][CC::TCZ()],
+      FieldValue const (&v)[CC::TCX()][CC::TCY()][CC::TCZ()],
+      FieldValue const (&w)[CC::TCX()][CC::TCY()][CC::TCZ()],
       double const cell_size,
       double (&velocity_gradient)[CC::TCX()][CC::TCY()][dim_][dim_]) const;
 
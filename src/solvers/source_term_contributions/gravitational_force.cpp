@@ -46,7 +46,7 @@ void GravitationalForce::ComputeForces(
         &gravity_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()]) const {
 
   Conservatives const &conservatives = block.GetAverageBuffer();
-  double const(&density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       block.GetAverageBuffer(Equation::Mass);
 
   for (unsigned int i = 0; i < CC::ICX(); ++i) {
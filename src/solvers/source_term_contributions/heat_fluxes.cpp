@@ -67,13 +67,13 @@ void HeatFluxes::ComputeFluxes(
       material_manager_.GetMaterial(mat_block.first).GetThermalConductivity();
 
   // Get the temperature field buffer
-  double const(&temperature)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&temperature)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       mat_block.second.GetPrimeStateBuffer(PrimeState::Temperature);
 
   // Get the thermal conductivity from the material (all computations below
   // ensure that buffer is only used when model is active, otherwise the buffer
   // does not exist)
-  double const(&conductivity)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  ParameterValue const(&conductivity)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       mat_block.second.GetParameterBuffer(Parameter::ThermalConductivity);
 
   /**
@@ -66,13 +66,13 @@ void ViscousFluxes::ComputeFluxes(
   // y and z velocity buffers may not be available
   // as workaround use the x velocity buffer in these cases
   // this is legal since the respective gradients are not computed/used anyway
-  double const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       mat_block.second.GetPrimeStateBuffer(PrimeState::VelocityX);
-  double const(&v)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&v)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       CC::DIM() != Dimension::One
           ? mat_block.second.GetPrimeStateBuffer(PrimeState::VelocityY)
           : u;
-  double const(&w)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  FieldValue const(&w)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       CC::DIM() == Dimension::Three
           ? mat_block.second.GetPrimeStateBuffer(PrimeState::VelocityZ)
           : u;
@@ -80,7 +80,7 @@ void ViscousFluxes::ComputeFluxes(
   // Get the shear viscosity from the material (all computations below ensure
   // that buffer is only used when model is active, otherwirse the buffer does
   // not exist)
-  double const(&shear_viscosity)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+  ParameterValue const(&shear_viscosity)[CC::TCX()][CC::TCY()][CC::TCZ()] =
       mat_block.second.GetParameterBuffer(Parameter::ShearViscosity);
 
   /**
@@ -110,15 +110,6 @@ void ViscousFluxes::ComputeFluxes(
   double shear_viscosity_at_cell_faces[CC::ICX() + 1][CC::ICY() + 1]
                                       [CC::ICZ() + 1][DTI(CC::DIM())];
 
-  /**
-   * Description for the positions of the Array:
-   * [CC::ICX()+1]  [CC::ICY()+1]  [CC::ICZ()+1]
-   * [DTI(CC::DIM())][DTI(CC::DIM())] Field index x  Field index y  Field index
-   * z  tau_ij at face i
-   */
-  double tau_flux[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1][DTI(CC::DIM())]
-                 [DTI(CC::DIM())];
-
   for (unsigned int i = 0; i < CC::ICX() + 1; ++i) {
     for (unsigned int j = 0; j < CC::ICY() + 1; ++j) {
       for (unsigned int k = 0; k < CC::ICZ() + 1; ++k) {
@@ -127,7 +118,6 @@ void ViscousFluxes::ComputeFluxes(
             for (unsigned int t = 0; t < DTI(CC::DIM()); ++t) {
               velocity_gradient_at_cell_faces[i][j][k][r][s][t] = 0.0;
             }
-            tau_flux[i][j][k][r][s] = 0.0;
             velocity_at_cell_faces[i][j][k][r][s] = 0.0;
           }
 
@@ -138,10 +128,20 @@ void ViscousFluxes::ComputeFluxes(
       }
     }
   }
-  // Compute tHe contributions for the dissipative fluxes
-  BO::Stencils::ComputeVectorGradientAtCellFaces<
-      DerivativeStencilCenter, DerivativeStencilFace, ReconstructionStencil>(
-      u, v, w, cell_size, velocity_gradient_at_cell_faces);
+  // Compute tHe contributions for the dissipative fluxes. The velocity
+  // gradient at the cell centers is reused if the parameter update cached it
+  bool const velocity_gradient_cached =
+      CC::CacheVelocityGradient() && mat_block.second.HasVelocityGradient();
+  if (velocity_gradient_cached) {
+    BO::Stencils::ComputeVectorGradientAtCellFaces<DerivativeStencilFace,
+                                                   ReconstructionStencil>(
+        u, v, w, mat_block.second.GetVelocityGradient(), cell_size,
+        velocity_gradient_at_cell_faces);
+  } else {
+    BO::Stencils::ComputeVectorGradientAtCellFaces<
+        DerivativeStencilCenter, DerivativeStencilFace, ReconstructionStencil>(
+        u, v, w, cell_size, velocity_gradient_at_cell_faces);
+  }
   BO::Stencils::ComputeVectorAtCellFaces<ReconstructionStencil>(
       u, v, w, cell_size, velocity_at_cell_faces);
   // Depending if viscosity models are active, shear viscosity must be
@@ -149,51 +149,50 @@ void ViscousFluxes::ComputeFluxes(
   if constexpr (CC::ShearViscosityModelActive()) {
     BO::Stencils::ComputeScalarAtCellFaces<ReconstructionStencil>(
         shear_viscosity, cell_size, shear_viscosity_at_cell_faces);
-    ComputeTauFluxes(
-        velocity_gradient_at_cell_faces, shear_viscosity_at_cell_faces,
-        material_manager_.GetMaterial(mat_block.first).GetBulkViscosity(),
-        tau_flux);
-  } else {
-    ComputeTauFluxes(velocity_gradient_at_cell_faces,
-                     material_manager_.GetMaterial(mat_block.first)
-                         .GetShearAndBulkViscosity(),
-                     tau_flux);
   }
+  Material const &material = material_manager_.GetMaterial(mat_block.first);
+  double const fixed_shear_viscosity = material.GetShearViscosity();
+  double const bulk_viscosity = material.GetBulkViscosity();
 
-  // Calculate the complete dissipative fluxes in each direction
+  // The stress tensor is computed face by face and directly added to the
+  // dissipative fluxes, such that no block-sized buffer of it is needed
   for (unsigned int i = 0; i < CC::ICX() + 1; ++i) {
     for (unsigned int j = 0; j < CC::ICY() + 1; ++j) {
       for (unsigned int k = 0; k < CC::ICZ() + 1; ++k) {
+        // tau_rs at the face in direction r
+        double tau[DTI(CC::DIM())][DTI(CC::DIM())];
+        for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
+          double const mu_1 = CC::ShearViscosityModelActive()
+                                  ? shear_viscosity_at_cell_faces[i][j][k][r]
+                                  : fixed_shear_viscosity;
+          double const mu_2 = bulk_viscosity - 2.0 * mu_1 / 3.0;
+          ComputeTau(r, velocity_gradient_at_cell_faces[i][j][k][r], mu_1, mu_2,
+                     tau[r]);
+        }
 
         for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
-          dissipative_flux_x[ETI(MF::AME()[r])][i][j][k] -=
-              tau_flux[i][j][k][0][r];
+          dissipative_flux_x[ETI(MF::AME()[r])][i][j][k] -= tau[0][r];
           if constexpr (CC::DIM() != Dimension::One)
-            dissipative_flux_y[ETI(MF::AME()[r])][i][j][k] -=
-                tau_flux[i][j][k][1][r];
+            dissipative_flux_y[ETI(MF::AME()[r])][i][j][k] -= tau[1][r];
           if constexpr (CC::DIM() == Dimension::Three)
-            dissipative_flux_z[ETI(MF::AME()[r])][i][j][k] -=
-                tau_flux[i][j][k][2][r];
+            dissipative_flux_z[ETI(MF::AME()[r])][i][j][k] -= tau[2][r];
         }
 
         if constexpr (MF::IsEquationActive(Equation::Energy)) {
           double const energy_flux_x = std::inner_product(
-              std::cbegin(tau_flux[i][j][k][0]),
-              std::cend(tau_flux[i][j][k][0]),
+              std::cbegin(tau[0]), std::cend(tau[0]),
               std::cbegin(velocity_at_cell_faces[i][j][k][0]), 0.0);
           dissipative_flux_x[ETI(Equation::Energy)][i][j][k] -= energy_flux_x;
 
           if constexpr (CC::DIM() != Dimension::One) {
             double const energy_flux_y = std::inner_product(
-                std::cbegin(tau_flux[i][j][k][1]),
-                std::cend(tau_flux[i][j][k][1]),
+                std::cbegin(tau[1]), std::cend(tau[1]),
                 std::cbegin(velocity_at_cell_faces[i][j][k][1]), 0.0);
             dissipative_flux_y[ETI(Equation::Energy)][i][j][k] -= energy_flux_y;
           }
           if constexpr (CC::DIM() == Dimension::Three) {
             double const energy_flux_z = std::inner_product(
-                std::cbegin(tau_flux[i][j][k][2]),
-                std::cend(tau_flux[i][j][k][2]),
+                std::cbegin(tau[2]), std::cend(tau[2]),
                 std::cbegin(velocity_at_cell_faces[i][j][k][2]), 0.0);
             dissipative_flux_z[ETI(Equation::Energy)][i][j][k] -= energy_flux_z;
           }
@@ -204,83 +203,22 @@ void ViscousFluxes::ComputeFluxes(
 }
 
 /**
- * @brief Computes tau, the viscous part of the stress tensor.
- * @param velocity_gradient_at_cell_faces The velocity gradient field at cell
- * faces.
- * @param viscosity A vector containing the shear and bulk viscosity.
- * @param tau The viscous part of the stress tensor.
+ * @brief Computes the row of tau, the viscous part of the stress tensor, that
+ * belongs to a cell face.
+ * @param r The direction of the cell face.
+ * @param velocity_gradient The velocity gradient at the cell face: du_s / dx_t.
+ * @param mu_1 The shear viscosity at the cell face.
+ * @param mu_2 The bulk viscosity reduced by two thirds of the shear viscosity.
+ * @param tau The row tau_rs of the stress tensor (indirect return parameter).
  */
-void ViscousFluxes::ComputeTauFluxes(
-    double const (
-        &velocity_gradient_at_cell_faces)[CC::ICX() + 1][CC::ICY() + 1]
-                                         [CC::ICZ() + 1][DTI(CC::DIM())]
-                                         [DTI(CC::DIM())][DTI(CC::DIM())],
-    std::vector<double> const viscosity,
-    double (&tau)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1][DTI(CC::DIM())]
-                 [DTI(CC::DIM())]) const {
-
-  double const mu_1 = viscosity[0];
-  double const mu_2 = viscosity[1] - 2.0 * viscosity[0] / 3.0;
-
-  for (unsigned int i = 0; i < CC::ICX() + 1; ++i) {
-    for (unsigned int j = 0; j < CC::ICY() + 1; ++j) {
-      for (unsigned int k = 0; k < CC::ICZ() + 1; ++k) {
-        for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
-          double volumetric_part = 0.0;
-          for (unsigned int s = 0; s < DTI(CC::DIM()); ++s) {
-            tau[i][j][k][r][s] =
-                mu_1 * (velocity_gradient_at_cell_faces[i][j][k][r][r][s] +
-                        velocity_gradient_at_cell_faces[i][j][k][r][s][r]);
-            volumetric_part +=
-                velocity_gradient_at_cell_faces[i][j][k][r][s][s];
-          }
-          tau[i][j][k][r][r] += volumetric_part * mu_2;
-        }
-      }
-    }
-  }
-}
-
-/**
- * @brief Computes tau, the viscous part of the stress tensor, for a field
- * dependent viscosity.
- * @param velocity_gradient_at_cell_faces The velocity gradient field at cell
- * faces.
- * @param shear_viscosity The shear_viscosity field at the cell faces.
- * @param bulk_viscosity The constant bulk viscosity.
- * @param tau The viscous part of the stress tensor.
- */
-void ViscousFluxes::ComputeTauFluxes(
-    double const (
-        &velocity_gradient_at_cell_faces)[CC::ICX() + 1][CC::ICY() + 1]
-                                         [CC::ICZ() + 1][DTI(CC::DIM())]
-                                         [DTI(CC::DIM())][DTI(CC::DIM())],
-    double const (
-        &shear_viscosity_at_cell_faces)[CC::ICX() + 1][CC::ICY() + 1]
-                                       [CC::ICZ() + 1][DTI(CC::DIM())],
-    double const bulk_viscosity,
-    double (&tau)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1][DTI(CC::DIM())]
-                 [DTI(CC::DIM())]) const {
-
-  for (unsigned int i = 0; i < CC::ICX() + 1; ++i) {
-    for (unsigned int j = 0; j < CC::ICY() + 1; ++j) {
-      for (unsigned int k = 0; k < CC::ICZ() + 1; ++k) {
-        for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
-          // Compute the two viscosity coefficients
-          double const mu_1 = shear_viscosity_at_cell_faces[i][j][k][r];
-          double const mu_2 = bulk_viscosity - 2.0 * mu_1 / 3.0;
-
-          double volumetric_part = 0.0;
-          for (unsigned int s = 0; s < DTI(CC::DIM()); ++s) {
-            tau[i][j][k][r][s] =
-                mu_1 * (velocity_gradient_at_cell_faces[i][j][k][r][r][s] +
-                        velocity_gradient_at_cell_faces[i][j][k][r][s][r]);
-            volumetric_part +=
-                velocity_gradient_at_cell_faces[i][j][k][r][s][s];
-          }
-          tau[i][j][k][r][r] += volumetric_part * mu_2;
-        }
-      }
-    }
+void ViscousFluxes::ComputeTau(
+    unsigned int const r,
+    double const (&velocity_gradient)[DTI(CC::DIM())][DTI(CC::DIM())],
+    double const mu_1, double const mu_2, double (&tau)[DTI(CC::DIM())]) const {
+  double volumetric_part = 0.0;
+  for (unsigned int s = 0; s < DTI(CC::DIM()); ++s) {
+    tau[s] = mu_1 * (velocity_gradient[r][s] + velocity_gradient[s][r]);
+    volumetric_part += velocity_gradient[s][s];
   }
+  tau[r] += volumetric_part * mu_2;
 }
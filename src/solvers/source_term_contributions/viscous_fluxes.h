@@ -22,8 +22,6 @@
 #ifndef VISCOUS_FLUXES_H
 #define VISCOUS_FLUXES_H
 
-#include <vector>
-
 #include "block_definitions/block.h"
 #include "materials/material_manager.h"
 
@@ -36,26 +34,11 @@ class ViscousFluxes {
 private:
   MaterialManager const &material_manager_;
 
-  void ComputeTauFluxes(
-      double const (
-          &velocity_gradient_at_cell_faces)[CC::ICX() + 1][CC::ICY() + 1]
-                                           [CC::ICZ() + 1][DTI(CC::DIM())]
-                                           [DTI(CC::DIM())][DTI(CC::DIM())],
-      std::vector<double> const viscosity,
-      double (&tau)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1][DTI(CC::DIM())]
-                   [DTI(CC::DIM())]) const;
-
-  void ComputeTauFluxes(
-      double const (
-          &velocity_gradient_at_cell_faces)[CC::ICX() + 1][CC::ICY() + 1]
-                                           [CC::ICZ() + 1][DTI(CC::DIM())]
-                                           [DTI(CC::DIM())][DTI(CC::DIM())],
-      double const (
-          &shear_viscosity_at_cell_faces)[CC::ICX() + 1][CC::ICY() + 1]
-                                         [CC::ICZ() + 1][DTI(CC::DIM())],
-      double const bulk_viscosity,
-      double (&tau)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1][DTI(CC::DIM())]
-                   [DTI(CC::DIM())]) const;
+  void
+  ComputeTau(unsigned int const r,
+             double const (&velocity_gradient)[DTI(CC::DIM())][DTI(CC::DIM())],
+             double const mu_1, double const mu_2,
+             double (&tau)[DTI(CC::DIM())]) const;
 
 public:
   ViscousFluxes() = delete;
@@ -59,8 +59,9 @@ void SourceTermSolver::Sources(
     double (
         &volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()]) const {
 
-  // compute dissipative fluxes
-  if constexpr (CC::ViscosityIsActive()) {
+  // compute dissipative fluxes ( unless advanced by super-time-stepping, see
+  // ParabolicFluxes )
+  if constexpr (CC::ViscosityIsActive() && !CC::SuperTimeStepping()) {
     viscous_fluxes_.ComputeFluxes(mat_block, face_fluxes_x, face_fluxes_y,
                                   face_fluxes_z, cell_size);
   }
@@ -82,6 +83,37 @@ void SourceTermSolver::Sources(
   }
 
   // Compute terms for heat exchange
+  if constexpr (CC::HeatConductionActive() &&
+                MF::IsEquationActive(Equation::Energy) &&
+                MF::IsPrimeStateActive(PrimeState::Temperature) &&
+                !CC::SuperTimeStepping()) {
+    heat_fluxes_.ComputeFluxes(mat_block, face_fluxes_x, face_fluxes_y,
+                               face_fluxes_z, cell_size);
+  }
+}
+
+/**
+ * @brief Computes the viscous and heat fluxes only, i.e. the parabolic part of
+ * the right-hand side that is advanced by super-time-stepping.
+ * @param mat_block The phase with its material identifier.
+ * @param cell_size The cell size of the node.
+ * @param face_fluxes_x, face_fluxes_y, face_fluxes_z Fluxes across the cell
+ * face.
+ */
+void SourceTermSolver::ParabolicFluxes(
+    std::pair<MaterialName const, Block> const &mat_block,
+    double const cell_size,
+    double (&face_fluxes_x)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1]
+                           [CC::ICZ() + 1],
+    double (&face_fluxes_y)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1]
+                           [CC::ICZ() + 1],
+    double (&face_fluxes_z)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1]
+                           [CC::ICZ() + 1]) const {
+  if constexpr (CC::ViscosityIsActive()) {
+    viscous_fluxes_.ComputeFluxes(mat_block, face_fluxes_x, face_fluxes_y,
+                                  face_fluxes_z, cell_size);
+  }
+
   if constexpr (CC::HeatConductionActive() &&
                 MF::IsEquationActive(Equation::Energy) &&
                 MF::IsPrimeStateActive(PrimeState::Temperature)) {
@@ -65,6 +65,15 @@ public:
                                       [CC::ICZ() + 1],
                double (&volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()]
                                       [CC::ICZ()]) const;
+  void
+  ParabolicFluxes(std::pair<MaterialName const, Block> const &mat_block,
+                  double const cell_size,
+                  double (&face_fluxes_x)[MF::ANOE()][CC::ICX() + 1]
+                                         [CC::ICY() + 1][CC::ICZ() + 1],
+                  double (&face_fluxes_y)[MF::ANOE()][CC::ICX() + 1]
+                                         [CC::ICY() + 1][CC::ICZ() + 1],
+                  double (&face_fluxes_z)[MF::ANOE()][CC::ICX() + 1]
+                                         [CC::ICY() + 1][CC::ICZ() + 1]) const;
 };
 
 #endif // SOURCE_TERM_SOLVER_H
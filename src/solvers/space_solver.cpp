@@ -21,9 +21,52 @@
 //===----------------------------------------------------------------------===//
 #include "space_solver.h"
 
-#include "utilities/mathematical_functions.h"
+#include <algorithm>
 #include <cmath>
 
+#include "utilities/mathematical_functions.h"
+
+namespace {
+// Edge length of the faces stored for the siblings of a superblock
+constexpr unsigned int face_size = SiblingFaceFluxes::face_size_;
+
+/**
+ * @brief Copies the fluxes over one face layer of a block between the flux
+ * array and the face storage of a superblock sibling.
+ * @param direction The direction normal to the face layer.
+ * @param layer The index of the face layer in the flux array.
+ * @param fluxes The fluxes of the block.
+ * @param face The stored fluxes over the face.
+ * @param to_face Indicates whether the fluxes are copied into the face storage
+ * ( otherwise into the flux array ).
+ */
+void CopyFaceLayer(
+    unsigned int const direction, unsigned int const layer,
+    double (&fluxes)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
+    double (&face)[MF::ANOE()][face_size][face_size], bool const to_face) {
+  constexpr std::array<unsigned int, 3> extents = {CC::ICX() + 1, CC::ICY() + 1,
+                                                   CC::ICZ() + 1};
+  unsigned int const minor1 = direction == 0 ? 1 : 0;
+  unsigned int const minor2 = direction == 2 ? 1 : 2;
+  std::array<unsigned int, 3> index;
+  index[direction] = layer;
+  for (unsigned int e = 0; e < MF::ANOE(); ++e) {
+    for (index[minor1] = 0; index[minor1] < extents[minor1]; ++index[minor1]) {
+      for (index[minor2] = 0; index[minor2] < extents[minor2];
+           ++index[minor2]) {
+        double &flux = fluxes[e][index[0]][index[1]][index[2]];
+        double &stored = face[e][index[minor1]][index[minor2]];
+        if (to_face) {
+          stored = flux;
+        } else {
+          flux = stored;
+        }
+      }
+    }
+  }
+}
+} // namespace
+
 /**
  * @brief Standard constructor using an already existing MaterialManager and the
  * user-defined gravity.
@@ -31,11 +74,14 @@
  * equation of state for the given material.
  * @param gravity Three-dimensional array holding the gravitational pull in x-,
  * y-, z-direction.
+ * @param stencil The reconstruction stencil of the convective fluxes.
  */
 SpaceSolver::SpaceSolver(MaterialManager const &material_manager,
-                         std::array<double, 3> const gravity)
+                         std::array<double, 3> const gravity,
+                         ReconstructionStencils const stencil)
     : eigendecomposition_calculator_(material_manager),
-      convective_term_solver_(material_manager, eigendecomposition_calculator_),
+      convective_term_solver_(material_manager, eigendecomposition_calculator_,
+                              stencil),
       source_term_solver_(material_manager, gravity),
       interface_term_solver_(material_manager),
       material_manager_(material_manager), levelset_advector_() {
@@ -46,8 +92,18 @@ SpaceSolver::SpaceSolver(MaterialManager const &material_manager,
  * @brief Computes right side of the underlying system of equations (including
  * source terms).
  * @param node The node under consideration.
+ * @param sibling_fluxes The convective fluxes over the upper faces of the
+ * siblings of the superblock the node belongs to, nullptr if the node is not
+ * computed as part of a superblock. The fluxes over the lower faces shared with
+ * already computed siblings are taken from here instead of being computed, the
+ * ones over the own upper faces are added.
+ * @param sibling_position The position of the node among its siblings.
+ * @note Fluxes are only handed between single-phase siblings of the same
+ * material. As the halo cells of siblings are copies of the internal cells of
+ * the neighbor, the handed fluxes are identical to the computed ones.
  */
-void SpaceSolver::UpdateFluxes(Node &node) const {
+void SpaceSolver::UpdateFluxes(Node &node, SiblingFaceFluxes *sibling_fluxes,
+                               unsigned int const sibling_position) const {
 
   double face_fluxes_x[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
   double face_fluxes_y[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
@@ -57,17 +113,11 @@ void SpaceSolver::UpdateFluxes(Node &node) const {
 
   for (auto &phase : node.GetPhases()) {
     for (Equation const eq : MF::ASOE()) {
-      double(&rhs_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      FieldValue(&rhs_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
           phase.second.GetRightHandSideBuffer(eq);
-      for (unsigned int i = 0; i < CC::TCX(); ++i) {
-        for (unsigned int j = 0; j < CC::TCY(); ++j) {
-          for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-            rhs_buffer[i][j][k] = 0.0;
-          } // k
-        }   // j
-      }     // i
-    }       // equation
-  }         // phases
+      std::fill_n(&rhs_buffer[0][0][0], CC::TCX() * CC::TCY() * CC::TCZ(), 0.0);
+    } // equation
+  }   // phases
 
   // For multi-phase + Lmax nodes (which have a levelset)
   if (node.HasLevelset()) {
@@ -79,40 +129,74 @@ void SpaceSolver::UpdateFluxes(Node &node) const {
   double const cell_size = node.GetCellSize();
   double const one_cell_size = 1.0 / cell_size;
 
+  // The Gamma-model additionally needs the interface velocity of each face,
+  // which is not handed over
+  bool const hands_over_fluxes = CC::InviscidExchangeActive() &&
+                                 active_equations != EquationSet::GammaModel &&
+                                 sibling_fluxes != nullptr &&
+                                 !node.HasLevelset() &&
+                                 node.GetPhases().size() == 1;
+  if (sibling_fluxes != nullptr) {
+    sibling_fluxes->material_[sibling_position].reset();
+  }
+
   for (auto &phase : node.GetPhases()) {
     if constexpr (CC::SolidBoundaryActive()) {
       if (material_manager_.IsSolidBoundary(phase.first))
         continue;
     }
 
-    // RHS-buffers have to be reset for each phase!
-    for (unsigned int e = 0; e < MF::ANOE(); ++e) {
-      for (unsigned int i = 0; i < CC::ICX() + 1; ++i) {
-        for (unsigned int j = 0; j < CC::ICY() + 1; ++j) {
-          for (unsigned int k = 0; k < CC::ICZ() + 1; ++k) {
-            face_fluxes_x[e][i][j][k] = 0.0;
-            face_fluxes_y[e][i][j][k] = 0.0;
-            face_fluxes_z[e][i][j][k] = 0.0;
-          } // k
-        }   // j
-      }     // i
-    }       // equation
+    // Flux buffers have to be reset for each phase! Each buffer is cleared in
+    // a single contiguous sweep
+    std::fill_n(&face_fluxes_x[0][0][0][0],
+                sizeof(face_fluxes_x) / sizeof(double), 0.0);
+    std::fill_n(&face_fluxes_y[0][0][0][0],
+                sizeof(face_fluxes_y) / sizeof(double), 0.0);
+    std::fill_n(&face_fluxes_z[0][0][0][0],
+                sizeof(face_fluxes_z) / sizeof(double), 0.0);
+    std::fill_n(&volume_forces[0][0][0][0],
+                sizeof(volume_forces) / sizeof(double), 0.0);
 
-    for (unsigned int e = 0; e < MF::ANOE(); ++e) {
-      for (unsigned int i = 0; i < CC::ICX(); ++i) {
-        for (unsigned int j = 0; j < CC::ICY(); ++j) {
-          for (unsigned int k = 0; k < CC::ICZ(); ++k) {
-            volume_forces[e][i][j][k] = 0.0;
-          } // k
-        }   // j
-      }     // i
-    }       // equation
+    auto const face_fluxes = [&](unsigned int const direction)
+        -> double(&)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1] {
+      return direction == 0   ? face_fluxes_x
+             : direction == 1 ? face_fluxes_y
+                              : face_fluxes_z;
+    };
+
+    // Faces shared with a lower sibling are taken from it
+    std::array<bool, 3> given_lower_faces = {false, false, false};
+    if (hands_over_fluxes) {
+      for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+        unsigned int const lower_sibling = sibling_position & ~(1u << d);
+        if (lower_sibling != sibling_position &&
+            sibling_fluxes->material_[lower_sibling] == phase.first) {
+          CopyFaceLayer(d, 0, face_fluxes(d),
+                        sibling_fluxes->fluxes_[lower_sibling][d], false);
+          given_lower_faces[d] = true;
+        }
+      }
+    }
 
     // Determine cell face fluxes unsing a Riemann solver
     if constexpr (CC::InviscidExchangeActive()) {
       convective_term_solver_.UpdateConvectiveFluxes(
           phase, cell_size, face_fluxes_x, face_fluxes_y, face_fluxes_z,
-          volume_forces);
+          volume_forces, given_lower_faces);
+    }
+
+    // Faces shared with an upper sibling are handed to it, before any other
+    // fluxes are added
+    if (hands_over_fluxes) {
+      constexpr std::array<unsigned int, 3> upper_layer = {CC::ICX(), CC::ICY(),
+                                                           CC::ICZ()};
+      for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+        if ((sibling_position & (1u << d)) == 0) {
+          CopyFaceLayer(d, upper_layer[d], face_fluxes(d),
+                        sibling_fluxes->fluxes_[sibling_position][d], true);
+        }
+      }
+      sibling_fluxes->material_[sibling_position] = phase.first;
     }
 
     // Determine source terms
@@ -120,6 +204,12 @@ void SpaceSolver::UpdateFluxes(Node &node) const {
         phase, cell_size, std::get<0>(node.GetBlockCoordinates()),
         face_fluxes_x, face_fluxes_y, face_fluxes_z, volume_forces);
 
+    // The cached velocity gradient is only valid up to the right-hand side
+    // following the parameter update
+    if constexpr (CC::CacheVelocityGradient()) {
+      phase.second.InvalidateVelocityGradient();
+    }
+
     if (node.HasLevelset()) {
       interface_term_solver_.WeightFaceFluxes(node, phase.first, face_fluxes_x,
                                               face_fluxes_y, face_fluxes_z);
@@ -130,7 +220,7 @@ void SpaceSolver::UpdateFluxes(Node &node) const {
     // update cells due to fluxes
     for (Equation const eq : MF::ASOE()) {
       auto const e = ETI(eq);
-      double(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+      FieldValue(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
           phase.second.GetRightHandSideBuffer(eq);
       for (unsigned int i = 0; i < CC::ICX(); ++i) {
         for (unsigned int j = 0; j < CC::ICY(); ++j) {
@@ -153,36 +243,99 @@ void SpaceSolver::UpdateFluxes(Node &node) const {
     }       // equation
 
     // save boundary fluxes for correction at jump boundary conditions
-    double(&boundary_fluxes_west)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
-        phase.second.GetBoundaryJumpFluxes(BoundaryLocation::West);
-    double(&boundary_fluxes_east)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
-        phase.second.GetBoundaryJumpFluxes(BoundaryLocation::East);
-    double(&boundary_fluxes_south)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
-        phase.second.GetBoundaryJumpFluxes(BoundaryLocation::South);
-    double(&boundary_fluxes_north)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
-        phase.second.GetBoundaryJumpFluxes(BoundaryLocation::North);
-    double(&boundary_fluxes_bottom)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
-        phase.second.GetBoundaryJumpFluxes(BoundaryLocation::Bottom);
-    double(&boundary_fluxes_top)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
-        phase.second.GetBoundaryJumpFluxes(BoundaryLocation::Top);
-    for (unsigned int e = 0; e < MF::ANOE(); ++e) {
-      for (unsigned int i = 0; i < CC::ICY(); ++i) {
-        for (unsigned int j = 0; j < CC::ICZ(); ++j) {
-          boundary_fluxes_west[e][i][j] += face_fluxes_x[e][0][i + 1][j + 1];
-          boundary_fluxes_east[e][i][j] +=
-              face_fluxes_x[e][CC::ICX()][i + 1][j + 1];
-          boundary_fluxes_south[e][i][j] += face_fluxes_y[e][i + 1][0][j + 1];
-          boundary_fluxes_north[e][i][j] +=
-              face_fluxes_y[e][i + 1][CC::ICY()][j + 1];
-          boundary_fluxes_bottom[e][i][j] += face_fluxes_z[e][i + 1][j + 1][0];
-          boundary_fluxes_top[e][i][j] +=
-              face_fluxes_z[e][i + 1][j + 1][CC::ICZ()];
+    if (phase.second.HasJumpBuffers()) {
+      double(&boundary_fluxes_west)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
+          phase.second.GetBoundaryJumpFluxes(BoundaryLocation::West);
+      double(&boundary_fluxes_east)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
+          phase.second.GetBoundaryJumpFluxes(BoundaryLocation::East);
+      double(&boundary_fluxes_south)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
+          phase.second.GetBoundaryJumpFluxes(BoundaryLocation::South);
+      double(&boundary_fluxes_north)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
+          phase.second.GetBoundaryJumpFluxes(BoundaryLocation::North);
+      double(&boundary_fluxes_bottom)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
+          phase.second.GetBoundaryJumpFluxes(BoundaryLocation::Bottom);
+      double(&boundary_fluxes_top)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
+          phase.second.GetBoundaryJumpFluxes(BoundaryLocation::Top);
+      for (unsigned int e = 0; e < MF::ANOE(); ++e) {
+        for (unsigned int i = 0; i < CC::ICY(); ++i) {
+          for (unsigned int j = 0; j < CC::ICZ(); ++j) {
+            boundary_fluxes_west[e][i][j] += face_fluxes_x[e][0][i + 1][j + 1];
+            boundary_fluxes_east[e][i][j] +=
+                face_fluxes_x[e][CC::ICX()][i + 1][j + 1];
+            boundary_fluxes_south[e][i][j] += face_fluxes_y[e][i + 1][0][j + 1];
+            boundary_fluxes_north[e][i][j] +=
+                face_fluxes_y[e][i + 1][CC::ICY()][j + 1];
+            boundary_fluxes_bottom[e][i][j] +=
+                face_fluxes_z[e][i + 1][j + 1][0];
+            boundary_fluxes_top[e][i][j] +=
+                face_fluxes_z[e][i + 1][j + 1][CC::ICZ()];
+          }
         }
       }
     }
   } // phases
 }
 
+/**
+ * @brief Computes the parabolic part of the right-hand side, i.e. the
+ * contributions of the viscous and heat fluxes only, see
+ * CC::SuperTimeStepping(). The node must not have a level set.
+ * @param node The node under consideration.
+ * @note The fluxes across resolution jumps are not stored in the jump buffers.
+ */
+void SpaceSolver::UpdateParabolicFluxes(Node &node) const {
+
+  double face_fluxes_x[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
+  double face_fluxes_y[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
+  double face_fluxes_z[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
+
+  double const one_cell_size = 1.0 / node.GetCellSize();
+
+  for (auto &phase : node.GetPhases()) {
+    for (Equation const eq : MF::ASOE()) {
+      FieldValue(&rhs_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+          phase.second.GetRightHandSideBuffer(eq);
+      std::fill_n(&rhs_buffer[0][0][0], CC::TCX() * CC::TCY() * CC::TCZ(), 0.0);
+    } // equation
+
+    if constexpr (CC::SolidBoundaryActive()) {
+      if (material_manager_.IsSolidBoundary(phase.first))
+        continue;
+    }
+
+    std::fill_n(&face_fluxes_x[0][0][0][0],
+                sizeof(face_fluxes_x) / sizeof(double), 0.0);
+    std::fill_n(&face_fluxes_y[0][0][0][0],
+                sizeof(face_fluxes_y) / sizeof(double), 0.0);
+    std::fill_n(&face_fluxes_z[0][0][0][0],
+                sizeof(face_fluxes_z) / sizeof(double), 0.0);
+
+    source_term_solver_.ParabolicFluxes(
+        phase, node.GetCellSize(), face_fluxes_x, face_fluxes_y, face_fluxes_z);
+
+    for (Equation const eq : MF::ASOE()) {
+      auto const e = ETI(eq);
+      FieldValue(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+          phase.second.GetRightHandSideBuffer(eq);
+      for (unsigned int i = 0; i < CC::ICX(); ++i) {
+        for (unsigned int j = 0; j < CC::ICY(); ++j) {
+          for (unsigned int k = 0; k < CC::ICZ(); ++k) {
+            cells[i + CC::FICX()][j + CC::FICY()][k + CC::FICZ()] =
+                DimensionAwareConsistencyManagedSum(
+                    face_fluxes_x[e][i][j + 1][k + 1] -
+                        face_fluxes_x[e][i + 1][j + 1][k + 1],
+                    face_fluxes_y[e][i + 1][j][k + 1] -
+                        face_fluxes_y[e][i + 1][j + 1][k + 1],
+                    face_fluxes_z[e][i + 1][j + 1][k] -
+                        face_fluxes_z[e][i + 1][j + 1][k + 1]) *
+                one_cell_size;
+          } // k
+        }   // j
+      }     // i
+    }       // equation
+  }         // phases
+}
+
 /**
  * @brief Computes right-hand side of the level set advection equation.
  * @param node The node under consideration.
@@ -217,11 +370,11 @@ void SpaceSolver::ComputeMaxEigenvaluesForPhase(
 }
 
 /**
- * @brief Stores the given (GLF) eigenvalues for later usage in a globally valid
- * location.
+ * @brief Stores the given (GLF) eigenvalues of the current stage for later
+ * usage in the flux computation of this solver.
  * @param eigenvalues Values to be stored.
  */
 void SpaceSolver::SetFluxFunctionGlobalEigenvalues(
-    double (&eigenvalues)[DTI(CC::DIM())][MF::ANOE()]) const {
+    double const (&eigenvalues)[DTI(CC::DIM())][MF::ANOE()]) {
   eigendecomposition_calculator_.SetGlobalEigenvalues(eigenvalues);
 }
@@ -22,6 +22,10 @@
 #ifndef SPACE_SOLVER_H
 #define SPACE_SOLVER_H
 
+#include <algorithm>
+#include <array>
+#include <optional>
+
 #include "block_definitions/block.h"
 #include "eigendecomposition.h"
 #include "interface_interaction/interface_term_solver.h"
@@ -29,6 +33,7 @@
 #include "source_term_solver.h"
 #include "topology/node.h"
 #include "user_specifications/numerical_setup.h"
+#include "user_specifications/stencil_setup.h"
 
 #include "levelset/levelset_advector/levelset_advector_setup.h"
 #include "solvers/convective_term_contributions/convective_term_solver_setup.h"
@@ -42,6 +47,21 @@ static_assert(!(active_equations == EquationSet::GammaModel &&
                 CC::Axisymmetric()),
               "Axisymmetric terms are not implemented for Gamma-Model");
 
+/**
+ * @brief Convective fluxes over the upper faces of the siblings of one
+ * superblock. They are handed from a sibling to its upper neighbors within the
+ * superblock, see SpaceSolver::UpdateFluxes.
+ */
+struct SiblingFaceFluxes {
+  // Edge length of the stored faces, large enough for all directions
+  static constexpr unsigned int face_size_ =
+      std::max({CC::ICX(), CC::ICY(), CC::ICZ()}) + 1;
+  // Fluxes over the upper face of each sibling in each direction
+  double fluxes_[CC::NOC()][DTI(CC::DIM())][MF::ANOE()][face_size_][face_size_];
+  // Material of the fluxes of each sibling, empty if none are handed over
+  std::array<std::optional<MaterialName>, CC::NOC()> material_;
+};
+
 /**
  * @brief The SpaceSolver solves right side of the underlying system of
  * equations (including source terms) using a Riemann solver of choice with an
@@ -49,7 +69,7 @@ static_assert(!(active_equations == EquationSet::GammaModel &&
  */
 class SpaceSolver {
 
-  EigenDecomposition const eigendecomposition_calculator_;
+  EigenDecomposition eigendecomposition_calculator_;
   ConvectiveTermSolverConcretization const convective_term_solver_;
   SourceTermSolver const source_term_solver_;
   InterfaceTermSolver const interface_term_solver_;
@@ -58,21 +78,24 @@ class SpaceSolver {
 
 public:
   SpaceSolver() = delete;
-  explicit SpaceSolver(MaterialManager const &material_manager,
-                       std::array<double, 3> gravity);
+  explicit SpaceSolver(
+      MaterialManager const &material_manager, std::array<double, 3> gravity,
+      ReconstructionStencils const stencil = reconstruction_stencil);
   ~SpaceSolver() = default;
   SpaceSolver(SpaceSolver const &) = delete;
   SpaceSolver &operator=(SpaceSolver const &) = delete;
   SpaceSolver(SpaceSolver &&) = delete;
   SpaceSolver &operator=(SpaceSolver &&) = delete;
 
-  void UpdateFluxes(Node &node) const;
+  void UpdateFluxes(Node &node, SiblingFaceFluxes *sibling_fluxes = nullptr,
+                    unsigned int const sibling_position = 0) const;
+  void UpdateParabolicFluxes(Node &node) const;
   void UpdateLevelsetFluxes(Node &node) const;
   void ComputeMaxEigenvaluesForPhase(
       std::pair<MaterialName const, Block> const &mat_block,
       double (&eigenvalues)[DTI(CC::DIM())][MF::ANOE()]) const;
   void SetFluxFunctionGlobalEigenvalues(
-      double (&eigenvalues)[DTI(CC::DIM())][MF::ANOE()]) const;
+      double const (&eigenvalues)[DTI(CC::DIM())][MF::ANOE()]);
 };
 
 #endif // SPACE_SOLVER_H
@@ -24,6 +24,7 @@
 
 #include "block_definitions/field_material_definitions.h"
 #include "prime_states/prime_state_handler.h"
+#include "solvers/eigendecomposition.h"
 #include "solvers/state_reconstruction/state_reconstruction.h"
 
 #include "stencils/stencil_utilities.h"
@@ -39,14 +40,16 @@ class CharacteristicStateReconstruction
   friend StateReconstruction;
 
   /**
-   * @brief Procedure to reconstruct the conservatives/primitive states at cell
-   * faces.
+   * @brief Reconstructs the conservatives/primitive states at cell faces in
+   * characteristic space.
    * @tparam DIR spatial direction the reconstruction has to be performed.
-   * @param block Block of the phase under consideration.
+   * @tparam RECON reconstruction stencil.
    * @param eos Underlying equation of state of the phase under consideration
    * used to convert primes and conservatives.
-   * @param roe_eigenvectors_left .
-   * @param roe_eigenvectors_right .
+   * @param to_characteristic Callable giving the characteristic values of the
+   * cell with the given total indices.
+   * @param to_physical Callable transforming characteristic values back into
+   * conservatives.
    * @param cell_size .
    * @param i .
    * @param k .
@@ -54,15 +57,16 @@ class CharacteristicStateReconstruction
    * @return tuple containing left and right reconstructed primitive and
    * conservative states.
    */
-  template <Direction DIR, ReconstructionStencils RECON>
+  template <Direction DIR, ReconstructionStencils RECON,
+            typename ToCharacteristic, typename ToPhysical>
   std::tuple<std::array<double, MF::ANOE()>, std::array<double, MF::ANOE()>,
              std::array<double, MF::ANOP()>, std::array<double, MF::ANOP()>>
-  SolveStateReconstructionImplementation(
-      Block const &block, EquationOfState const &eos,
-      double const (&Roe_eigenvectors_left)[MF::ANOE()][MF::ANOE()],
-      double const (&Roe_eigenvectors_right)[MF::ANOE()][MF::ANOE()],
-      double const cell_size, unsigned int const i, unsigned int const j,
-      unsigned int const k) const {
+  ReconstructInCharacteristicSpace(EquationOfState const &eos,
+                                   ToCharacteristic const &to_characteristic,
+                                   ToPhysical const &to_physical,
+                                   double const cell_size, unsigned int const i,
+                                   unsigned int const j,
+                                   unsigned int const k) const {
 
     using ReconstructionStencil =
         typename ReconstructionStencilSetup::Concretize<RECON>::type;
@@ -75,47 +79,33 @@ class CharacteristicStateReconstruction
     std::array<double, MF::ANOP()> reconstructed_primes_minus;
     std::array<double, MF::ANOP()> reconstructed_primes_plus;
 
-    constexpr auto conservative_equation_summation_sequence_ =
-        MakeConservativeEquationSummationSequence(
-            std::make_index_sequence<MF::ANOE() - DTI(CC::DIM())>{});
-    std::array<double, ReconstructionStencil::StencilSize()> u_characteristic;
+    // Characteristic values of all fields, lane-contiguous for the batched
+    // stencil evaluation
+    std::array<std::array<double, MF::ANOE()>,
+               ReconstructionStencil::StencilSize()>
+        u_characteristic;
     std::array<double, MF::ANOE()> characteristic_average_plus;
     std::array<double, MF::ANOE()> characteristic_average_minus;
 
-    for (unsigned int n = 0; n < MF::ANOE();
-         ++n) { // n is index of characteristic field (eigenvalue, eigenvector)
-      // Characteristic decomposition
-      for (unsigned int m = 0; m < ReconstructionStencil::StencilSize(); ++m) {
-        u_characteristic[m] = 0.0;
-        for (unsigned int const l :
-             conservative_equation_summation_sequence_[DTI(
-                 DIR)]) { // l is index of conservative equation, iterated in
-                          // symmetry-preserving sequence
-          u_characteristic[m] +=
-              Roe_eigenvectors_left[n][l] *
-              block.GetAverageBuffer(MF::ASOE()[l])
-                  [i + x_reconstruction_offset *
-                           (m - ReconstructionStencil::DownstreamStencilSize())]
-                  [j + y_reconstruction_offset *
-                           (m - ReconstructionStencil::DownstreamStencilSize())]
-                  [k +
-                   z_reconstruction_offset *
-                       (m - ReconstructionStencil::DownstreamStencilSize())];
-        } // L-Loop
-      }   // M-Loop
-
-      characteristic_average_minus[n] =
-          SU::Reconstruction<ReconstructionStencil, SP::UpwindLeft>(
-              u_characteristic, cell_size);
-      characteristic_average_plus[n] =
-          SU::Reconstruction<ReconstructionStencil, SP::UpwindRight>(
-              u_characteristic, cell_size);
-    } // N-Loop
-
-    auto const reconstructed_conservatives_minus = TransformToPhysicalSpace(
-        characteristic_average_minus, Roe_eigenvectors_right);
-    auto const reconstructed_conservatives_plus = TransformToPhysicalSpace(
-        characteristic_average_plus, Roe_eigenvectors_right);
+    // Characteristic decomposition
+    for (unsigned int m = 0; m < ReconstructionStencil::StencilSize(); ++m) {
+      int const offset =
+          int(m) - int(ReconstructionStencil::DownstreamStencilSize());
+      u_characteristic[m] =
+          to_characteristic(i + x_reconstruction_offset * offset,
+                            j + y_reconstruction_offset * offset,
+                            k + z_reconstruction_offset * offset);
+    } // M-Loop
+
+    SU::Reconstruction<ReconstructionStencil, SP::UpwindLeft>(
+        u_characteristic, cell_size, characteristic_average_minus);
+    SU::Reconstruction<ReconstructionStencil, SP::UpwindRight>(
+        u_characteristic, cell_size, characteristic_average_plus);
+
+    auto const reconstructed_conservatives_minus =
+        to_physical(characteristic_average_minus);
+    auto const reconstructed_conservatives_plus =
+        to_physical(characteristic_average_plus);
 
     // To check for invalid cells due to ghost fluid method
     if (reconstructed_conservatives_minus[ETI(Equation::Mass)] <=
@@ -135,6 +125,112 @@ class CharacteristicStateReconstruction
         reconstructed_primes_minus, reconstructed_primes_plus);
   }
 
+  /**
+   * @brief Procedure to reconstruct the conservatives/primitive states at cell
+   * faces with the given Roe eigenvector matrices.
+   * @tparam DIR spatial direction the reconstruction has to be performed.
+   * @param block Block of the phase under consideration.
+   * @param eos Underlying equation of state of the phase under consideration
+   * used to convert primes and conservatives.
+   * @param roe_eigenvectors_left .
+   * @param roe_eigenvectors_right .
+   * @param cell_size .
+   * @param i .
+   * @param k .
+   * @param j .
+   * @return tuple containing left and right reconstructed primitive and
+   * conservative states.
+   */
+  template <Direction DIR, ReconstructionStencils RECON>
+  std::tuple<std::array<double, MF::ANOE()>, std::array<double, MF::ANOE()>,
+             std::array<double, MF::ANOP()>, std::array<double, MF::ANOP()>>
+  SolveStateReconstructionImplementation(
+      Block const &block, EquationOfState const &eos,
+      double const (&Roe_eigenvectors_left)[MF::ANOE()][MF::ANOE()],
+      double const (&Roe_eigenvectors_right)[MF::ANOE()][MF::ANOE()],
+      double const cell_size, unsigned int const i, unsigned int const j,
+      unsigned int const k) const {
+
+    constexpr auto conservative_equation_summation_sequence_ =
+        MakeConservativeEquationSummationSequence(
+            std::make_index_sequence<MF::ANOE() - DTI(CC::DIM())>{});
+
+    auto const to_characteristic =
+        [&block, &Roe_eigenvectors_left,
+         &conservative_equation_summation_sequence_](unsigned int const ii,
+                                                     unsigned int const jj,
+                                                     unsigned int const kk) {
+          std::array<double, MF::ANOE()> characteristic_values;
+          for (unsigned int n = 0; n < MF::ANOE();
+               ++n) { // n is index of characteristic field (eigenvalue,
+                      // eigenvector)
+            characteristic_values[n] = 0.0;
+            for (unsigned int const l :
+                 conservative_equation_summation_sequence_[DTI(
+                     DIR)]) { // l is index of conservative equation, iterated
+                              // in symmetry-preserving sequence
+              characteristic_values[n] +=
+                  Roe_eigenvectors_left[n][l] *
+                  block.GetAverageBuffer(MF::ASOE()[l])[ii][jj][kk];
+            } // L-Loop
+          }   // N-Loop
+          return characteristic_values;
+        };
+    auto const to_physical =
+        [&Roe_eigenvectors_right](
+            std::array<double, MF::ANOE()> const &characteristic_values) {
+          return TransformToPhysicalSpace(characteristic_values,
+                                          Roe_eigenvectors_right);
+        };
+    return ReconstructInCharacteristicSpace<DIR, RECON>(
+        eos, to_characteristic, to_physical, cell_size, i, j, k);
+  }
+
+  /**
+   * @brief Procedure to reconstruct the conservatives/primitive states at cell
+   * faces with the Roe eigenvectors applied in closed form from the Roe
+   * averages of the face. Avoids assembling and multiplying the eigenvector
+   * matrices, most of whose entries are zero or repeated.
+   * @tparam DIR spatial direction the reconstruction has to be performed.
+   * @param block Block of the phase under consideration.
+   * @param eos Underlying equation of state of the phase under consideration
+   * used to convert primes and conservatives.
+   * @param roe_averages Roe averages at the face.
+   * @param cell_size .
+   * @param i .
+   * @param k .
+   * @param j .
+   * @return tuple containing left and right reconstructed primitive and
+   * conservative states.
+   */
+  template <Direction DIR, ReconstructionStencils RECON>
+  std::tuple<std::array<double, MF::ANOE()>, std::array<double, MF::ANOE()>,
+             std::array<double, MF::ANOP()>, std::array<double, MF::ANOP()>>
+  SolveStateReconstructionImplementation(
+      Block const &block, EquationOfState const &eos,
+      RoeFaceAverages const &roe_averages, double const cell_size,
+      unsigned int const i, unsigned int const j, unsigned int const k) const {
+
+    auto const to_characteristic = [&block,
+                                    &roe_averages](unsigned int const ii,
+                                                   unsigned int const jj,
+                                                   unsigned int const kk) {
+      std::array<double, MF::ANOE()> conservatives;
+      for (unsigned int l = 0; l < MF::ANOE(); ++l) {
+        conservatives[l] = block.GetAverageBuffer(MF::ASOE()[l])[ii][jj][kk];
+      }
+      return ProjectToCharacteristicSpace<DIR>(conservatives, roe_averages);
+    };
+    auto const to_physical =
+        [&roe_averages](
+            std::array<double, MF::ANOE()> const &characteristic_values) {
+          return ProjectToPhysicalSpace<DIR>(characteristic_values,
+                                             roe_averages);
+        };
+    return ReconstructInCharacteristicSpace<DIR, RECON>(
+        eos, to_characteristic, to_physical, cell_size, i, j, k);
+  }
+
 public:
   CharacteristicStateReconstruction() : StateReconstruction() {}
   ~CharacteristicStateReconstruction() = default;
@@ -73,13 +73,16 @@ class ConservativeStateReconstruction
     std::array<double, MF::ANOP()> reconstructed_primes_minus;
     std::array<double, MF::ANOP()> reconstructed_primes_plus;
 
-    std::array<double, ReconstructionStencil::StencilSize()>
-        reconstruction_array;
+    // Values of all fields, lane-contiguous for the batched stencil
+    // evaluation
+    std::array<std::array<double, MF::ANOE()>,
+               ReconstructionStencil::StencilSize()>
+        reconstruction_arrays;
     std::array<double, MF::ANOE()> reconstructed_conservatives_minus;
     std::array<double, MF::ANOE()> reconstructed_conservatives_plus;
     for (unsigned int n = 0; n < MF::ANOE(); ++n) {
       for (unsigned int m = 0; m < ReconstructionStencil::StencilSize(); ++m) {
-        reconstruction_array[m] =
+        reconstruction_arrays[m][n] =
             block.GetAverageBuffer(MF::ASOE()[n])
                 [i + x_reconstruction_offset *
                          (m - ReconstructionStencil::DownstreamStencilSize())]
@@ -88,13 +91,12 @@ class ConservativeStateReconstruction
                 [k + z_reconstruction_offset *
                          (m - ReconstructionStencil::DownstreamStencilSize())];
       } // M-Loop
-      reconstructed_conservatives_minus[n] =
-          SU::Reconstruction<ReconstructionStencil, SP::UpwindLeft>(
-              reconstruction_array, cell_size);
-      reconstructed_conservatives_plus[n] =
-          SU::Reconstruction<ReconstructionStencil, SP::UpwindRight>(
-              reconstruction_array, cell_size);
-    } // N-Loop
+    }   // N-Loop
+
+    SU::Reconstruction<ReconstructionStencil, SP::UpwindLeft>(
+        reconstruction_arrays, cell_size, reconstructed_conservatives_minus);
+    SU::Reconstruction<ReconstructionStencil, SP::UpwindRight>(
+        reconstruction_arrays, cell_size, reconstructed_conservatives_plus);
     // To check for invalid cells due to ghost fluid method
     if (reconstructed_conservatives_minus[ETI(Equation::Mass)] <=
             std::numeric_limits<double>::epsilon() ||
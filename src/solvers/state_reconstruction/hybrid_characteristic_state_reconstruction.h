@@ -0,0 +1,186 @@
+//===------------ hybrid_characteristic_state_reconstruction.h ------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef HYBRID_CHARACTERISTIC_STATE_RECONSTRUCTION_H
+#define HYBRID_CHARACTERISTIC_STATE_RECONSTRUCTION_H
+
+#include <algorithm>
+#include <cmath>
+
+#include "block_definitions/field_material_definitions.h"
+#include "solvers/state_reconstruction/state_reconstruction.h"
+#include "user_specifications/state_reconstruction_settings.h"
+
+#include "stencils/stencil_utilities.h"
+
+/**
+ * @brief Discretization of the spatial reconstruction scheme which only
+ * reconstructs characteristic states near discontinuities. A sensor on the
+ * relative jumps of density and pressure within the reconstruction stencil
+ * flags the faces, all other faces are reconstructed component-wise.
+ * @tparam CharacteristicReconstruction The reconstruction used on flagged
+ * faces.
+ * @tparam ComponentWiseReconstruction The reconstruction used on all other
+ * faces.
+ */
+template <typename CharacteristicReconstruction,
+          typename ComponentWiseReconstruction>
+class HybridCharacteristicStateReconstruction
+    : public StateReconstruction<HybridCharacteristicStateReconstruction<
+          CharacteristicReconstruction, ComponentWiseReconstruction>> {
+
+  friend StateReconstruction<HybridCharacteristicStateReconstruction<
+      CharacteristicReconstruction, ComponentWiseReconstruction>>;
+
+  CharacteristicReconstruction const characteristic_reconstruction_;
+  ComponentWiseReconstruction const component_wise_reconstruction_;
+
+  /**
+   * @brief Procedure to reconstruct the conservatives/primitive states at cell
+   * faces. Evaluates the sensor on the face, see
+   * SolveFlaggedStateReconstruction for the parameters.
+   */
+  template <Direction DIR, ReconstructionStencils RECON>
+  std::tuple<std::array<double, MF::ANOE()>, std::array<double, MF::ANOE()>,
+             std::array<double, MF::ANOP()>, std::array<double, MF::ANOP()>>
+  SolveStateReconstructionImplementation(
+      Block const &block, EquationOfState const &eos,
+      double const (&Roe_eigenvectors_left)[MF::ANOE()][MF::ANOE()],
+      double const (&Roe_eigenvectors_right)[MF::ANOE()][MF::ANOE()],
+      double const cell_size, unsigned int const i, unsigned int const j,
+      unsigned int const k) const {
+    return SolveFlaggedStateReconstruction<DIR, RECON>(
+        IsCharacteristicFace<DIR, RECON>(block, i, j, k), block, eos,
+        Roe_eigenvectors_left, Roe_eigenvectors_right, cell_size, i, j, k);
+  }
+
+  /**
+   * @brief Indicates whether the values of two neighboring stencil cells
+   * differ by more than the threshold relative to the smaller magnitude.
+   */
+  static bool Jump(double const first, double const second) {
+    return std::abs(second - first) >
+           HybridCharacteristicSettings::discontinuity_threshold *
+               std::min(std::abs(first), std::abs(second));
+  }
+
+public:
+  HybridCharacteristicStateReconstruction()
+      : StateReconstruction<HybridCharacteristicStateReconstruction<
+            CharacteristicReconstruction, ComponentWiseReconstruction>>(),
+        characteristic_reconstruction_(), component_wise_reconstruction_() {}
+  ~HybridCharacteristicStateReconstruction() = default;
+  HybridCharacteristicStateReconstruction(
+      HybridCharacteristicStateReconstruction const &) = delete;
+  HybridCharacteristicStateReconstruction &
+  operator=(HybridCharacteristicStateReconstruction const &) = delete;
+  HybridCharacteristicStateReconstruction(
+      HybridCharacteristicStateReconstruction &&) = delete;
+  HybridCharacteristicStateReconstruction &
+  operator=(HybridCharacteristicStateReconstruction &&) = delete;
+
+  /**
+   * @brief Discontinuity sensor of a face. Cheap compared to the
+   * characteristic decomposition, such that callers can evaluate it to decide
+   * whether the eigendecomposition of the face is required at all.
+   * @tparam DIR spatial direction of the face normal.
+   * @tparam RECON reconstruction stencil.
+   * @param block Block of the phase under consideration.
+   * @param i,j,k Total indices of the cell left of the face.
+   * @return True if the face is reconstructed in characteristic space.
+   */
+  template <Direction DIR, ReconstructionStencils RECON>
+  static bool IsCharacteristicFace(Block const &block, unsigned int const i,
+                                   unsigned int const j, unsigned int const k) {
+    using ReconstructionStencil =
+        typename ReconstructionStencilSetup::Concretize<RECON>::type;
+    constexpr unsigned int x_offset = DIR == Direction::X ? 1 : 0;
+    constexpr unsigned int y_offset = DIR == Direction::Y ? 1 : 0;
+    constexpr unsigned int z_offset = DIR == Direction::Z ? 1 : 0;
+    double const(&density)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        block.GetAverageBuffer(Equation::Mass);
+    double const(&pressure)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        block.GetPrimeStateBuffer(PrimeState::Pressure);
+
+    unsigned int const first_i =
+        i - x_offset * ReconstructionStencil::DownstreamStencilSize();
+    unsigned int const first_j =
+        j - y_offset * ReconstructionStencil::DownstreamStencilSize();
+    unsigned int const first_k =
+        k - z_offset * ReconstructionStencil::DownstreamStencilSize();
+    // Ghost-fluid cells without a valid state have zero density
+    if (density[first_i][first_j][first_k] <= 0.0) {
+      return true;
+    }
+    for (unsigned int m = 1; m < ReconstructionStencil::StencilSize(); ++m) {
+      unsigned int const ii = first_i + x_offset * m;
+      unsigned int const jj = first_j + y_offset * m;
+      unsigned int const kk = first_k + z_offset * m;
+      unsigned int const ip = ii - x_offset;
+      unsigned int const jp = jj - y_offset;
+      unsigned int const kp = kk - z_offset;
+      if (density[ii][jj][kk] <= 0.0 ||
+          Jump(density[ip][jp][kp], density[ii][jj][kk]) ||
+          Jump(pressure[ip][jp][kp], pressure[ii][jj][kk])) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Reconstructs the states at a face whose sensor was already
+   * evaluated.
+   * @tparam DIR spatial direction the reconstruction has to be performed.
+   * @tparam RECON reconstruction stencil.
+   * @param characteristic Result of IsCharacteristicFace for the face.
+   * @param block Block of the phase under consideration.
+   * @param eos Underlying equation of state of the phase under consideration.
+   * @param Roe_eigenvectors_left, Roe_eigenvectors_right Left and right Roe
+   * eigenvector matrices of the face, only read on characteristic faces.
+   * @param cell_size .
+   * @param i,j,k Total indices of the cell left of the face.
+   * @return tuple containing left and right reconstructed primitive and
+   * conservative states.
+   */
+  template <Direction DIR, ReconstructionStencils RECON>
+  std::tuple<std::array<double, MF::ANOE()>, std::array<double, MF::ANOE()>,
+             std::array<double, MF::ANOP()>, std::array<double, MF::ANOP()>>
+  SolveFlaggedStateReconstruction(
+      bool const characteristic, Block const &block, EquationOfState const &eos,
+      double const (&Roe_eigenvectors_left)[MF::ANOE()][MF::ANOE()],
+      double const (&Roe_eigenvectors_right)[MF::ANOE()][MF::ANOE()],
+      double const cell_size, unsigned int const i, unsigned int const j,
+      unsigned int const k) const {
+    if (characteristic) {
+      return characteristic_reconstruction_
+          .template SolveStateReconstruction<DIR, RECON>(
+              block, eos, Roe_eigenvectors_left, Roe_eigenvectors_right,
+              cell_size, i, j, k);
+    }
+    return component_wise_reconstruction_
+        .template SolveStateReconstruction<DIR, RECON>(
+            block, eos, Roe_eigenvectors_left, Roe_eigenvectors_right,
+            cell_size, i, j, k);
+  }
+};
+
+#endif // HYBRID_CHARACTERISTIC_STATE_RECONSTRUCTION_H
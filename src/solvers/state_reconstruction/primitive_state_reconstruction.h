@@ -73,13 +73,16 @@ class PrimitiveStateReconstruction
     std::array<double, MF::ANOP()> reconstructed_primes_minus;
     std::array<double, MF::ANOP()> reconstructed_primes_plus;
 
-    std::array<double, ReconstructionStencil::StencilSize()>
-        reconstruction_array;
+    // Values of all fields, lane-contiguous for the batched stencil
+    // evaluation
+    std::array<std::array<double, MF::ANOP()>,
+               ReconstructionStencil::StencilSize()>
+        reconstruction_arrays;
     std::array<double, MF::ANOE()> reconstructed_conservatives_minus;
     std::array<double, MF::ANOE()> reconstructed_conservatives_plus;
     for (unsigned int n = 0; n < MF::ANOP(); ++n) {
       for (unsigned int m = 0; m < ReconstructionStencil::StencilSize(); ++m) {
-        reconstruction_array[m] =
+        reconstruction_arrays[m][n] =
             block.GetPrimeStateBuffer(MF::ASOP()[n])
                 [i + x_reconstruction_offset *
                          (m - ReconstructionStencil::DownstreamStencilSize())]
@@ -88,14 +91,12 @@ class PrimitiveStateReconstruction
                 [k + z_reconstruction_offset *
                          (m - ReconstructionStencil::DownstreamStencilSize())];
       } // M-Loop
+    }   // N-Loop
 
-      reconstructed_primes_minus[n] =
-          SU::Reconstruction<ReconstructionStencil, SP::UpwindLeft>(
-              reconstruction_array, cell_size);
-      reconstructed_primes_plus[n] =
-          SU::Reconstruction<ReconstructionStencil, SP::UpwindRight>(
-              reconstruction_array, cell_size);
-    } // N-Loop
+    SU::Reconstruction<ReconstructionStencil, SP::UpwindLeft>(
+        reconstruction_arrays, cell_size, reconstructed_primes_minus);
+    SU::Reconstruction<ReconstructionStencil, SP::UpwindRight>(
+        reconstruction_arrays, cell_size, reconstructed_primes_plus);
 
     PrimeStatesToConservatives(eos, reconstructed_primes_minus,
                                reconstructed_conservatives_minus);
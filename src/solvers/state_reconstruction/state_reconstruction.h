@@ -24,6 +24,8 @@
 
 #include "user_specifications/stencil_setup.h"
 
+struct RoeFaceAverages;
+
 /**
  * @brief Helper function to create the index sequence used to enforce symmetry
  * while summing up conservative equation contributions in characteristic
@@ -100,6 +102,25 @@ public:
             block, eos, Roe_eigenvectors_left, Roe_eigenvectors_right,
             cell_size, i, j, k);
   }
+
+  /**
+   * @brief Overload applying the Roe eigenvectors of the face in closed form
+   * from its Roe averages. Only provided by the characteristic reconstruction
+   * of the Euler and Navier-Stokes equations.
+   * @param roe_averages Roe averages at the face.
+   * @note See the other overload for the remaining parameters.
+   */
+  template <Direction DIR, ReconstructionStencils RECON>
+  std::tuple<std::array<double, MF::ANOE()>, std::array<double, MF::ANOE()>,
+             std::array<double, MF::ANOP()>, std::array<double, MF::ANOP()>>
+  SolveStateReconstruction(Block const &block, EquationOfState const &eos,
+                           RoeFaceAverages const &roe_averages,
+                           double const cell_size, unsigned int const i,
+                           unsigned int const j, unsigned int const k) const {
+    return static_cast<DerivedStateReconstruction const &>(*this)
+        .template SolveStateReconstructionImplementation<DIR, RECON>(
+            block, eos, roe_averages, cell_size, i, j, k);
+  }
 };
 
 #endif // STATE_RECONSTRUCTION_H
@@ -26,13 +26,16 @@
 #include "solvers/state_reconstruction/conservative_state_reconstruction.h"
 #include "solvers/state_reconstruction/gamma_characteristic_state_reconstruction.h"
 #include "solvers/state_reconstruction/gamma_primitive_state_reconstruction.h"
+#include "solvers/state_reconstruction/hybrid_characteristic_state_reconstruction.h"
 #include "solvers/state_reconstruction/primitive_state_reconstruction.h"
 #include "user_specifications/equation_settings.h"
 #include "user_specifications/state_reconstruction_settings.h"
 
 static_assert(
     !(active_equations == EquationSet::Isentropic &&
-      state_reconstruction_type == StateReconstructionType::Characteristic),
+      (state_reconstruction_type == StateReconstructionType::Characteristic ||
+       state_reconstruction_type ==
+           StateReconstructionType::HybridCharacteristic)),
     "Characteristic reconstruction not implemented for isentropic equations!");
 
 /**
@@ -69,6 +72,15 @@ template <> struct Concretize<StateReconstructionType::Primitive> {
 template <> struct Concretize<StateReconstructionType::Characteristic> {
   using type = CharacteristicStateReconstruction;
 };
+
+/**
+ * @brief See generic implementation.
+ */
+template <> struct Concretize<StateReconstructionType::HybridCharacteristic> {
+  using type =
+      HybridCharacteristicStateReconstruction<CharacteristicStateReconstruction,
+                                              PrimitiveStateReconstruction>;
+};
 } // namespace EulerNavierStokes
 
 namespace Isentropic {
@@ -124,6 +136,15 @@ template <> struct Concretize<StateReconstructionType::Primitive> {
 template <> struct Concretize<StateReconstructionType::Characteristic> {
   using type = GammaCharacteristicStateReconstruction;
 };
+
+/**
+ * @brief See generic implementation.
+ */
+template <> struct Concretize<StateReconstructionType::HybridCharacteristic> {
+  using type = HybridCharacteristicStateReconstruction<
+      GammaCharacteristicStateReconstruction,
+      GammaPrimitiveStateReconstruction>;
+};
 } // namespace GammaModel
 
 /**
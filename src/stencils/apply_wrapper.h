@@ -67,11 +67,12 @@ constexpr std::array<int const, 2> GetStencilParameters<SP::Central>() {
  * @brief Implementation for the x-direction. See GetValueVectorFromBuffer for
  * details.
  */
-template <typename S>
-constexpr void GetValueVectorFromBufferX(
-    std::array<double, S::StencilSize()> &array,
-    double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    unsigned int const i, unsigned int const j, unsigned int const k) {
+template <typename S, typename B>
+constexpr void
+GetValueVectorFromBufferX(std::array<double, S::StencilSize()> &array,
+                          B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+                          unsigned int const i, unsigned int const j,
+                          unsigned int const k) {
   for (unsigned int s = 0; s < S::StencilSize(); ++s) {
     array[s] = buffer[i + (-S::DownstreamStencilSize() + s)][j][k];
   }
@@ -80,11 +81,12 @@ constexpr void GetValueVectorFromBufferX(
  * @brief Implementation for the y-direction. See GetValueVectorFromBuffer for
  * details.
  */
-template <typename S>
-constexpr void GetValueVectorFromBufferY(
-    std::array<double, S::StencilSize()> &array,
-    double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    unsigned int const i, unsigned int const j, unsigned int const k) {
+template <typename S, typename B>
+constexpr void
+GetValueVectorFromBufferY(std::array<double, S::StencilSize()> &array,
+                          B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+                          unsigned int const i, unsigned int const j,
+                          unsigned int const k) {
   for (unsigned int s = 0; s < S::StencilSize(); ++s) {
     array[s] = buffer[i][j + (-S::DownstreamStencilSize() + s)][k];
   }
@@ -93,11 +95,12 @@ constexpr void GetValueVectorFromBufferY(
  * @brief Implementation for the z-direction. See GetValueVectorFromBuffer for
  * details.
  */
-template <typename S>
-constexpr void GetValueVectorFromBufferZ(
-    std::array<double, S::StencilSize()> &array,
-    double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    unsigned int const i, unsigned int const j, unsigned int const k) {
+template <typename S, typename B>
+constexpr void
+GetValueVectorFromBufferZ(std::array<double, S::StencilSize()> &array,
+                          B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+                          unsigned int const i, unsigned int const j,
+                          unsigned int const k) {
   for (unsigned int s = 0; s < S::StencilSize(); ++s) {
     array[s] = buffer[i][j][k + (-S::DownstreamStencilSize() + s)];
   }
@@ -112,12 +115,14 @@ constexpr void GetValueVectorFromBufferZ(
  * @param i,j,k The indices for which cell the stencil is applied.
  * @tparam S The used stencil.
  * @tparam D The direction in which the stencil should be evaluated.
+ * @tparam B The type of the buffer values (deduced).
  */
-template <typename S, Direction D>
-constexpr void GetValueVectorFromBuffer(
-    std::array<double, S::StencilSize()> &array,
-    double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    unsigned int const i, unsigned int const j, unsigned int const k) {
+template <typename S, Direction D, typename B>
+constexpr void
+GetValueVectorFromBuffer(std::array<double, S::StencilSize()> &array,
+                         B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+                         unsigned int const i, unsigned int const j,
+                         unsigned int const k) {
   switch (D) {
   case Direction::X:
     GetValueVectorFromBufferX<S>(array, buffer, i, j, k);
@@ -135,12 +140,11 @@ constexpr void GetValueVectorFromBuffer(
  * @brief Implementation for the x-direction. See GetDifferenceVectorFromBuffer
  * for details.
  */
-template <typename S>
+template <typename S, typename B>
 constexpr void GetDifferenceVectorFromBufferX(
     std::array<double, S::StencilSize()> &array,
-    double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    unsigned int const i, unsigned int const j, unsigned int const k,
-    double const cell_size) {
+    B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()], unsigned int const i,
+    unsigned int const j, unsigned int const k, double const cell_size) {
   double const one_cell_size = 1.0 / cell_size;
   for (unsigned int s = 0; s < S::StencilSize(); ++s) {
     array[s] = (buffer[i + (-S::DownstreamStencilSize() + s)][j][k] -
@@ -152,12 +156,11 @@ constexpr void GetDifferenceVectorFromBufferX(
  * @brief Implementation for the y-direction. See GetDifferenceVectorFromBuffer
  * for details.
  */
-template <typename S>
+template <typename S, typename B>
 constexpr void GetDifferenceVectorFromBufferY(
     std::array<double, S::StencilSize()> &array,
-    double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    unsigned int const i, unsigned int const j, unsigned int const k,
-    double const cell_size) {
+    B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()], unsigned int const i,
+    unsigned int const j, unsigned int const k, double const cell_size) {
   double const one_cell_size = 1.0 / cell_size;
   for (unsigned int s = 0; s < S::StencilSize(); ++s) {
     array[s] = (buffer[i][j + (-S::DownstreamStencilSize() + s)][k] -
@@ -169,12 +172,11 @@ constexpr void GetDifferenceVectorFromBufferY(
  * @brief Implementation for the z-direction. See GetDifferenceVectorFromBuffer
  * for details.
  */
-template <typename S>
+template <typename S, typename B>
 constexpr void GetDifferenceVectorFromBufferZ(
     std::array<double, S::StencilSize()> &array,
-    double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    unsigned int const i, unsigned int const j, unsigned int const k,
-    double const cell_size) {
+    B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()], unsigned int const i,
+    unsigned int const j, unsigned int const k, double const cell_size) {
   double const one_cell_size = 1.0 / cell_size;
   for (unsigned int s = 0; s < S::StencilSize(); ++s) {
     array[s] = (buffer[i][j][k + (-S::DownstreamStencilSize() + s)] -
@@ -192,13 +194,13 @@ constexpr void GetDifferenceVectorFromBufferZ(
  * @param i,j,k The indices for which cell the stencil is applied.
  * @tparam S The used stencil.
  * @tparam D The direction in which the stencil should be evaluated.
+ * @tparam B The type of the buffer values (deduced).
  */
-template <typename S, Direction D>
+template <typename S, Direction D, typename B>
 constexpr void GetDifferenceVectorFromBuffer(
     std::array<double, S::StencilSize()> &array,
-    double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    unsigned int const i, unsigned int const j, unsigned int const k,
-    double const cell_size) {
+    B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()], unsigned int const i,
+    unsigned int const j, unsigned int const k, double const cell_size) {
   switch (D) {
   case Direction::X:
     GetDifferenceVectorFromBufferX<S>(array, buffer, i, j, k, cell_size);
@@ -224,9 +226,10 @@ constexpr void GetDifferenceVectorFromBuffer(
  * @param k The index in z-direction.
  * @param cell_size The cell size of the block to which the buffer belongs.
  * @return The result of the stencil.
+ * @tparam B The type of the buffer values (deduced).
  */
-template <typename S, StencilProperty P, Direction D>
-constexpr double Apply(double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+template <typename S, StencilProperty P, Direction D, typename B>
+constexpr double Apply(B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
                        unsigned int i, unsigned int j, unsigned int k,
                        double const cell_size) {
 
@@ -250,12 +253,12 @@ constexpr double Apply(double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
  * @param k The index in z-direction.
  * @param cell_size The cell size of the block to which the buffer belongs.
  * @return The result of the stencil.
+ * @tparam B The type of the buffer values (deduced).
  */
-template <typename S, StencilProperty P, Direction D>
-constexpr double
-ApplyHjWeno(double const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
-            unsigned int i, unsigned int j, unsigned int k,
-            double const cell_size) {
+template <typename S, StencilProperty P, Direction D, typename B>
+constexpr double ApplyHjWeno(B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+                             unsigned int i, unsigned int j, unsigned int k,
+                             double const cell_size) {
 
   constexpr S stencil = S();
 
@@ -282,6 +285,45 @@ constexpr T Apply(std::array<double, S::StencilSize()> const &array,
   return stencil.template Apply<S>(
       array, ApplyUtilities::GetStencilParameters<P>(), cell_size);
 }
+
+/**
+ * @brief Applies the stencil on a batch of already deduced stencil arrays.
+ * @tparam S The used stencil.
+ * @tparam P The manner in which the stencil is applied (UpwindLeft, UpwindRight
+ * or Central).
+ * @tparam W The number of arrays in the batch.
+ * @param arrays The lane-contiguous arrays, arrays[s][w] is entry s of array w.
+ * @param cell_size The cell size of the block to which the buffer belongs.
+ * @param results The result of the stencil for each array (indirect return).
+ */
+template <typename S, StencilProperty P, std::size_t W>
+void Apply(std::array<std::array<double, W>, S::StencilSize()> const &arrays,
+           double const cell_size, std::array<double, W> &results) {
+  constexpr S stencil = S();
+  stencil.template Apply<S, W>(
+      arrays, ApplyUtilities::GetStencilParameters<P>(), cell_size, results);
+}
+
+/**
+ * @brief Applies the stencil on all stencil positions of a line of values.
+ * @tparam S The used stencil.
+ * @tparam P The manner in which the stencil is applied (UpwindLeft, UpwindRight
+ * or Central).
+ * @param pencil The values of the line.
+ * @param number_of_evaluations The number of stencil positions on the line.
+ * @param cell_size The cell size of the block to which the buffer belongs.
+ * @param results The result of the stencil for each position (indirect
+ * return).
+ */
+template <typename S, StencilProperty P>
+void ApplyOnPencil(double const *const pencil,
+                   unsigned int const number_of_evaluations,
+                   double const cell_size, double *const results) {
+  constexpr S stencil = S();
+  stencil.template ApplyOnPencil<S>(pencil, number_of_evaluations,
+                                    ApplyUtilities::GetStencilParameters<P>(),
+                                    cell_size, results);
+}
 } // namespace ApplyUtilities
 
 #endif // APPLY_WRAPPER_H
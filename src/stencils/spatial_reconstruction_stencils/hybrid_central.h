@@ -0,0 +1,164 @@
+//===-------------------------- hybrid_central.h --------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef HYBRID_CENTRAL_H
+#define HYBRID_CENTRAL_H
+
+#include <algorithm>
+#include <limits>
+
+#include "stencils/stencil.h"
+#include "teno5.h"
+#include "utilities/mathematical_functions.h"
+#include "weno5.h"
+
+/**
+ * @brief Discretization of the SpatialReconstructionStencil class which uses
+ * the linear fourth-order central reconstruction in smooth regions and the
+ * given nonlinear stencil only where a smoothness indicator requires it. The
+ * indicator is the second difference normalized by the magnitude of the
+ * values ( see \cite Jameson1981 ) over the full stencil. For a batch of
+ * arrays, e.g., all fields of one cell face, the indicator is evaluated once
+ * and the same branch is taken for all lanes, such that the nonlinear weights
+ * are only computed on faces which are not smooth.
+ * @tparam NonlinearStencil The nonlinear stencil applied on non-smooth data.
+ */
+template <typename NonlinearStencil>
+class HybridCentral : public Stencil<HybridCentral<NonlinearStencil>> {
+
+  friend Stencil<HybridCentral<NonlinearStencil>>;
+
+  static constexpr StencilType stencil_type_ = StencilType::Reconstruction;
+
+  static constexpr double one_sixteenth_ = 1.0 / 16.0;
+
+  // Normalized second difference above which the nonlinear stencil is applied
+  static constexpr double smoothness_threshold_ = 1.0e-2;
+
+  // Number of cells required for upwind and downwind stencils, as well as
+  // number of cells downstream of the cell ( those of the nonlinear stencil )
+  static constexpr unsigned int stencil_size_ = NonlinearStencil::StencilSize();
+  static constexpr unsigned int downstream_stencil_size_ =
+      NonlinearStencil::DownstreamStencilSize();
+
+  static_assert(downstream_stencil_size_ >= 1 &&
+                    stencil_size_ >= downstream_stencil_size_ + 3,
+                "The central part needs two cells on each side of the face");
+
+  /**
+   * @brief Gives the largest normalized second difference within the array.
+   * @param array The values of the stencil.
+   * @return The smoothness indicator, zero for linear data.
+   */
+  static constexpr double
+  SmoothnessIndicator(std::array<double, stencil_size_> const &array) {
+    double indicator = 0.0;
+    for (unsigned int s = 1; s < stencil_size_ - 1; ++s) {
+      double const second_difference =
+          Abs(array[s + 1] - 2.0 * array[s] + array[s - 1]);
+      double const magnitude =
+          Abs(array[s + 1]) + 2.0 * Abs(array[s]) + Abs(array[s - 1]);
+      indicator = std::max(
+          indicator, second_difference /
+                         (magnitude + std::numeric_limits<double>::epsilon()));
+    }
+    return indicator;
+  }
+
+  /**
+   * @brief Evaluates the fourth-order central reconstruction at the face
+   * between the downstream cell and its neighbor. Identical for both upwind
+   * directions.
+   */
+  static constexpr double
+  Central(std::array<double, stencil_size_> const &array) {
+    double const result = 9.0 * (array[downstream_stencil_size_ - 0] +
+                                 array[downstream_stencil_size_ + 1]) -
+                          1.0 * (array[downstream_stencil_size_ - 1] +
+                                 array[downstream_stencil_size_ + 2]);
+    return result * one_sixteenth_;
+  }
+
+  /**
+   * @brief Evaluates the central or nonlinear stencil depending on the
+   * smoothness of the array. Also See base class.
+   * @note Hotpath function.
+   */
+  constexpr double
+  ApplyImplementation(std::array<double, stencil_size_> const &array,
+                      std::array<int const, 2> const evaluation_properties,
+                      double const cell_size) const {
+    if (SmoothnessIndicator(array) <= smoothness_threshold_) {
+      return Central(array);
+    }
+    return NonlinearStencil().template Apply<NonlinearStencil>(
+        array, evaluation_properties, cell_size);
+  }
+
+public:
+  explicit constexpr HybridCentral() = default;
+  ~HybridCentral() = default;
+  HybridCentral(HybridCentral const &) = delete;
+  HybridCentral &operator=(HybridCentral const &) = delete;
+  HybridCentral(HybridCentral &&) = delete;
+  HybridCentral &operator=(HybridCentral &&) = delete;
+
+  using Stencil<HybridCentral<NonlinearStencil>>::Apply;
+
+  /**
+   * @brief Applies the stencil to W independent stencil arrays at once. In
+   * contrast to the base class, the smoothness is decided once for all lanes:
+   * if any lane is not smooth, all lanes use the nonlinear stencil. Also See
+   * base class.
+   * @note Hotpath function.
+   */
+  template <typename S, std::size_t W>
+  void Apply(std::array<std::array<double, W>, S::StencilSize()> const &arrays,
+             std::array<int const, 2> const evaluation_properties,
+             double const cell_size, std::array<double, W> &results) const {
+    bool smooth = true;
+    for (std::size_t w = 0; w < W && smooth; ++w) {
+      std::array<double, stencil_size_> array;
+      for (unsigned int s = 0; s < stencil_size_; ++s) {
+        array[s] = arrays[s][w];
+      }
+      smooth = SmoothnessIndicator(array) <= smoothness_threshold_;
+    }
+    if (smooth) {
+#pragma omp simd
+      for (std::size_t w = 0; w < W; ++w) {
+        std::array<double, stencil_size_> array;
+        for (unsigned int s = 0; s < stencil_size_; ++s) {
+          array[s] = arrays[s][w];
+        }
+        results[w] = Central(array);
+      }
+    } else {
+      NonlinearStencil().template Apply<NonlinearStencil, W>(
+          arrays, evaluation_properties, cell_size, results);
+    }
+  }
+};
+
+using CentralTENO5 = HybridCentral<TENO5>;
+using CentralWENO5 = HybridCentral<WENO5>;
+
+#endif // HYBRID_CENTRAL_H
@@ -22,8 +22,14 @@
 #ifndef RECONSTRUCTION_STENCIL_SETUP_H
 #define RECONSTRUCTION_STENCIL_SETUP_H
 
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
 #include "first_order.h"
 #include "fourth_order_central.h"
+#include "hybrid_central.h"
 #include "teno5.h"
 #include "user_specifications/stencil_setup.h"
 #include "weno-ao53.h"
@@ -137,6 +143,70 @@ template <> struct Concretize<ReconstructionStencils::WENO9> {
 template <> struct Concretize<ReconstructionStencils::WENO5HM> {
   typedef WENO5HM type;
 };
+/**
+ * @brief See generic implementation.
+ */
+template <> struct Concretize<ReconstructionStencils::CentralTENO5> {
+  typedef CentralTENO5 type;
+};
+/**
+ * @brief See generic implementation.
+ */
+template <> struct Concretize<ReconstructionStencils::CentralWENO5> {
+  typedef CentralWENO5 type;
+};
+
+/**
+ * @brief Names of the reconstruction stencils as used in the input file (equal
+ * to the identifiers).
+ */
+inline constexpr std::array stencil_names_ = {
+    std::pair{"FirstOrder", ReconstructionStencils::FirstOrder},
+    std::pair{"WENO3", ReconstructionStencils::WENO3},
+    std::pair{"WENOF3P", ReconstructionStencils::WENOF3P},
+    std::pair{"FourthOrderCentral", ReconstructionStencils::FourthOrderCentral},
+    std::pair{"WENO5", ReconstructionStencils::WENO5},
+    std::pair{"WENO5IS", ReconstructionStencils::WENO5IS},
+    std::pair{"WENO5Z", ReconstructionStencils::WENO5Z},
+    std::pair{"WENOAO53", ReconstructionStencils::WENOAO53},
+    std::pair{"WENO5HM", ReconstructionStencils::WENO5HM},
+    std::pair{"WENO5NU6P", ReconstructionStencils::WENO5NU6P},
+    std::pair{"TENO5", ReconstructionStencils::TENO5},
+    std::pair{"WENOCU6", ReconstructionStencils::WENOCU6},
+    std::pair{"WENO7", ReconstructionStencils::WENO7},
+    std::pair{"WENO9", ReconstructionStencils::WENO9},
+    std::pair{"CentralTENO5", ReconstructionStencils::CentralTENO5},
+    std::pair{"CentralWENO5", ReconstructionStencils::CentralWENO5}};
+
+/**
+ * @brief Converts the name of a reconstruction stencil into its identifier.
+ * @param name The name of the stencil, e.g. "WENO5Z".
+ * @return The identifier of the stencil.
+ * @note Throws if the name is not known.
+ */
+inline ReconstructionStencils StringToStencil(std::string const &name) {
+  for (auto const &[stencil_name, stencil] : stencil_names_) {
+    if (name == stencil_name) {
+      return stencil;
+    }
+  }
+  throw std::invalid_argument("Reconstruction stencil " + name +
+                              " is not known!");
+}
+
+/**
+ * @brief Gives the name of a reconstruction stencil.
+ * @param stencil The identifier of the stencil.
+ * @return The name of the stencil.
+ */
+inline std::string StencilToString(ReconstructionStencils const stencil) {
+  for (auto const &[stencil_name, stencil_identifier] : stencil_names_) {
+    if (stencil == stencil_identifier) {
+      return stencil_name;
+    }
+  }
+  return "ERROR: This stencil is not (yet) defined!";
+}
 
 } // namespace ReconstructionStencilSetup
 
@@ -22,6 +22,8 @@
 #ifndef SPATIAL_RECONSTRUCTION_STENCIL_H
 #define SPATIAL_RECONSTRUCTION_STENCIL_H
 
+#include <array>
+#include <cstddef>
 #include <limits>
 #include <vector>
 
@@ -90,6 +92,69 @@ public:
     return static_cast<DerivedStencil const &>(*this).ApplyImplementation(
         array, evaluation_properties, cell_size);
   }
+
+  /**
+   * @brief Applies the SpatialReconstructionStencil to W independent stencil
+   * arrays at once. The arrays are given lane-contiguous, i.e. arrays[s][w] is
+   * entry s of the array of lane w, such that the lane loop can be vectorized.
+   * Each lane performs exactly the operations of the scalar Apply, the results
+   * are hence identical to W scalar evaluations.
+   * @param arrays The arrays on which to apply the stencil.
+   * @param evaluation_properties See scalar Apply.
+   * @param cell_size The cell size of the corresponding block.
+   * @param results The value at the position of interest for each lane
+   * (indirect return parameter).
+   * @tparam S The used stencil.
+   * @tparam W The number of lanes.
+   * @note Hotpath function.
+   */
+  template <typename S, std::size_t W>
+  void Apply(std::array<std::array<double, W>, S::StencilSize()> const &arrays,
+             std::array<int const, 2> const evaluation_properties,
+             double const cell_size, std::array<double, W> &results) const {
+#pragma omp simd
+    for (std::size_t w = 0; w < W; ++w) {
+      std::array<double, S::StencilSize()> array;
+      for (unsigned int s = 0; s < S::StencilSize(); ++s) {
+        array[s] = arrays[s][w];
+      }
+      results[w] =
+          static_cast<DerivedStencil const &>(*this).ApplyImplementation(
+              array, evaluation_properties, cell_size);
+    }
+  }
+
+  /**
+   * @brief Applies the SpatialReconstructionStencil to all stencil positions
+   * along a contiguous line of cell values (pencil). Evaluation n works on the
+   * values pencil[n] to pencil[n + StencilSize() - 1], consecutive evaluations
+   * are vectorized.
+   * @param pencil The cell values of the line.
+   * @param number_of_evaluations The number of stencil positions on the line.
+   * The pencil has to hold number_of_evaluations + StencilSize() - 1 values.
+   * @param evaluation_properties See scalar Apply.
+   * @param cell_size The cell size of the corresponding block.
+   * @param results The value at the position of interest for each stencil
+   * position (indirect return parameter).
+   * @tparam S The used stencil.
+   * @note Hotpath function.
+   */
+  template <typename S>
+  void ApplyOnPencil(double const *const pencil,
+                     unsigned int const number_of_evaluations,
+                     std::array<int const, 2> const evaluation_properties,
+                     double const cell_size, double *const results) const {
+#pragma omp simd
+    for (unsigned int n = 0; n < number_of_evaluations; ++n) {
+      std::array<double, S::StencilSize()> array;
+      for (unsigned int s = 0; s < S::StencilSize(); ++s) {
+        array[s] = pencil[n + s];
+      }
+      results[n] =
+          static_cast<DerivedStencil const &>(*this).ApplyImplementation(
+              array, evaluation_properties, cell_size);
+    }
+  }
 };
 
 #endif // SPATIAL_RECONSTRUCTION_STENCIL_H
@@ -57,6 +57,45 @@ constexpr T Reconstruction(std::array<double, S::StencilSize()> const &array,
   return ApplyUtilities::Apply<S, P, T>(array, cell_size);
 }
 
+/**
+ * @brief Applies the reconstruction operation of a given stencil for a batch of
+ * linear arrays, which are evaluated lane-parallel.
+ * @param arrays The lane-contiguous arrays holding the information required for
+ * the stencil evaluations, arrays[s][w] is entry s of array w.
+ * @param cell_size The cell size used for stencil application.
+ * @param results The reconstructed value of each array (indirect return
+ * parameter).
+ * @tparam S The used stencil.
+ * @tparam P The manner in which the stencil is applied.
+ * @tparam W The number of arrays in the batch.
+ */
+template <typename S, StencilProperty P, std::size_t W>
+void Reconstruction(
+    std::array<std::array<double, W>, S::StencilSize()> const &arrays,
+    double const cell_size, std::array<double, W> &results) {
+  ApplyUtilities::Apply<S, P, W>(arrays, cell_size, results);
+}
+
+/**
+ * @brief Applies the reconstruction operation of a given stencil on all stencil
+ * positions of a contiguous line of cell values (pencil).
+ * @param pencil The values of the line. It has to hold number_of_evaluations +
+ * S::StencilSize() - 1 values.
+ * @param number_of_evaluations The number of stencil positions.
+ * @param cell_size The cell size used for stencil application.
+ * @param results The reconstructed value at each position (indirect return
+ * parameter).
+ * @tparam S The used stencil.
+ * @tparam P The manner in which the stencil is applied.
+ */
+template <typename S, StencilProperty P>
+void ReconstructionOnPencil(double const *const pencil,
+                            unsigned int const number_of_evaluations,
+                            double const cell_size, double *const results) {
+  ApplyUtilities::ApplyOnPencil<S, P>(pencil, number_of_evaluations, cell_size,
+                                      results);
+}
+
 /**
  * @brief Applies the reconstruction operation of a given stencil for a single
  * cell of the given buffer.
@@ -70,10 +109,11 @@ constexpr T Reconstruction(std::array<double, S::StencilSize()> const &array,
  * @tparam D The direction in which the buffer should be applied.
  * @tparam T The type of the output value (default: double).
  * @tparam DIM The dimension the stencil is applied on (default: CC::DIM())
+ * @tparam B The type of the buffer values (deduced).
  */
 template <typename S, StencilProperty P, Direction D, typename T = double,
-          Dimension DIM = CC::DIM()>
-constexpr T Reconstruction(T const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+          Dimension DIM = CC::DIM(), typename B>
+constexpr T Reconstruction(B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
                            unsigned int const i, unsigned int const j,
                            unsigned int const k, double const cell_size) {
   return ApplyUtilities::Apply<S, P, D>(buffer, i, j, k, cell_size);
@@ -118,11 +158,12 @@ ReconstructionWithUpwinding(std::array<double, S::StencilSize()> const &array,
  * @tparam D The direction in which the buffer should be applied.
  * @tparam T The type of the output value (default: double).
  * @tparam DIM The dimension the stencil is applied on (default: CC::DIM())
+ * @tparam B The type of the buffer values (deduced).
  */
 template <typename S, Direction D, typename T = double,
-          Dimension DIM = CC::DIM()>
+          Dimension DIM = CC::DIM(), typename B>
 constexpr T
-ReconstructionWithUpwinding(T const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+ReconstructionWithUpwinding(B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
                             unsigned int const i, unsigned int const j,
                             unsigned int const k, double const upwind_decision,
                             double const cell_size) {
@@ -166,10 +207,11 @@ constexpr T Derivative(std::array<double, S::StencilSize()> const &array,
  * @tparam D The direction in which the buffer should be applied.
  * @tparam T The type of the output value (default: double).
  * @tparam DIM The dimension the stencil is applied on (default: CC::DIM())
+ * @tparam B The type of the buffer values (deduced).
  */
 template <typename S, Direction D, typename T = double,
-          Dimension DIM = CC::DIM()>
-constexpr T Derivative(T const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+          Dimension DIM = CC::DIM(), typename B>
+constexpr T Derivative(B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
                        unsigned int const i, unsigned int const j,
                        unsigned int const k, double const cell_size) {
   switch (S::GetStencilType()) {
@@ -216,10 +258,11 @@ constexpr T Derivative(std::array<double, S::StencilSize()> const &array,
  * @tparam D The direction in which the buffer should be applied.
  * @tparam T The type of the output value (default: double).
  * @tparam DIM The dimension the stencil is applied on (default: CC::DIM())
+ * @tparam B The type of the buffer values (deduced).
  */
 template <typename S, StencilProperty P, Direction D, typename T = double,
-          Dimension DIM = CC::DIM()>
-constexpr T Derivative(T const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+          Dimension DIM = CC::DIM(), typename B>
+constexpr T Derivative(B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
                        unsigned int const i, unsigned int const j,
                        unsigned int const k, double const cell_size) {
   switch (S::GetStencilType()) {
@@ -267,11 +310,12 @@ DerivativeWithUpwinding(std::array<double, S::StencilSize()> const &array,
  * @tparam D The direction in which the buffer should be applied.
  * @tparam T The type of the output value (default: double).
  * @tparam DIM The dimension the stencil is applied on (default: CC::DIM())
+ * @tparam B The type of the buffer values (deduced).
  */
 template <typename S, Direction D, typename T = double,
-          Dimension DIM = CC::DIM()>
+          Dimension DIM = CC::DIM(), typename B>
 constexpr T
-DerivativeWithUpwinding(T const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+DerivativeWithUpwinding(B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
                         unsigned int const i, unsigned int const j,
                         unsigned int const k, double const upwind_decision,
                         double const cell_size) {
@@ -308,10 +352,12 @@ DerivativeWithUpwinding(T const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
  * @tparam S The used stencil.
  * @tparam T The type of the output value (default: double).
  * @tparam DIM The dimension the stencil is applied on (default: CC::DIM())
+ * @tparam B The type of the buffer values (deduced).
  */
-template <typename S, typename T = double, Dimension DIM = CC::DIM()>
+template <typename S, typename T = double, Dimension DIM = CC::DIM(),
+          typename B>
 constexpr std::array<T, 3>
-GradientVector(T const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
+GradientVector(B const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
                unsigned int const i, unsigned int const j, unsigned int const k,
                double const cell_size) {
   return {Derivative<S, Direction::X, T, DIM>(buffer, i, j, k, cell_size),
@@ -335,12 +381,14 @@ GradientVector(T const (&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()],
  * @tparam S The used stencil.
  * @tparam T The type of the output value (default: double).
  * @tparam DIM The dimension the stencil is applied on (default: CC::DIM())
+ * @tparam B The type of the buffer values (deduced).
  */
-template <typename S, typename T = double, Dimension DIM = CC::DIM()>
+template <typename S, typename T = double, Dimension DIM = CC::DIM(),
+          typename B>
 constexpr std::array<std::array<T, 3>, 3>
-JacobianMatrix(T const (&buffer_x)[CC::TCX()][CC::TCY()][CC::TCZ()],
-               T const (&buffer_y)[CC::TCX()][CC::TCY()][CC::TCZ()],
-               T const (&buffer_z)[CC::TCX()][CC::TCY()][CC::TCZ()],
+JacobianMatrix(B const (&buffer_x)[CC::TCX()][CC::TCY()][CC::TCZ()],
+               B const (&buffer_y)[CC::TCX()][CC::TCY()][CC::TCZ()],
+               B const (&buffer_z)[CC::TCX()][CC::TCY()][CC::TCZ()],
                unsigned int const i, unsigned int const j, unsigned int const k,
                double const cell_size) {
 
@@ -364,12 +412,14 @@ JacobianMatrix(T const (&buffer_x)[CC::TCX()][CC::TCY()][CC::TCZ()],
  * @tparam S The used stencil.
  * @tparam T The type of the output value (default: double).
  * @tparam DIM The dimension the stencil is applied on (default: CC::DIM())
+ * @tparam B The type of the buffer values (deduced).
  */
-template <typename S, typename T = double, Dimension DIM = CC::DIM()>
+template <typename S, typename T = double, Dimension DIM = CC::DIM(),
+          typename B>
 constexpr std::array<T, 3>
-Curl(T const (&buffer_x)[CC::TCX()][CC::TCY()][CC::TCZ()],
-     T const (&buffer_y)[CC::TCX()][CC::TCY()][CC::TCZ()],
-     T const (&buffer_z)[CC::TCX()][CC::TCY()][CC::TCZ()], unsigned int const i,
+Curl(B const (&buffer_x)[CC::TCX()][CC::TCY()][CC::TCZ()],
+     B const (&buffer_y)[CC::TCX()][CC::TCY()][CC::TCZ()],
+     B const (&buffer_z)[CC::TCX()][CC::TCY()][CC::TCZ()], unsigned int const i,
      unsigned int const j, unsigned int const k, double const cell_size) {
   std::array<std::array<T, 3>, 3> const gradient = JacobianMatrix<S, T, DIM>(
       buffer_x, buffer_y, buffer_z, i, j, k, cell_size);
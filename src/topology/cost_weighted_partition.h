@@ -0,0 +1,193 @@
+//===------------------- cost_weighted_partition.h ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef COST_WEIGHTED_PARTITION_H
+#define COST_WEIGHTED_PARTITION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+/**
+ * @brief Cuts an ordered list of elements into contiguous segments of similar
+ * accumulated cost, one segment per rank. An element is given to the rank in
+ * whose share of the total cost the midpoint of the element's cost falls.
+ * Hence, the ranks are non-decreasing along the list.
+ * @param costs The (non-negative) costs of the elements in their order along
+ * the space-filling curve.
+ * @param number_of_ranks The number of ranks to distribute the elements onto.
+ * @return The rank of each element.
+ * @note If all costs are zero, all elements are considered equally expensive.
+ */
+inline std::vector<int> CostWeightedRanks(std::vector<double> const &costs,
+                                          int const number_of_ranks) {
+  std::vector<int> ranks(costs.size(), 0);
+  double total_cost =
+      std::accumulate(std::cbegin(costs), std::cend(costs), 0.0);
+  bool const uniform = total_cost <= 0.0;
+  if (uniform) {
+    total_cost = static_cast<double>(costs.size());
+  }
+  double accumulated_cost = 0.0;
+  for (std::size_t i = 0; i < costs.size(); ++i) {
+    double const cost = uniform ? 1.0 : costs[i];
+    int const rank =
+        static_cast<int>((accumulated_cost + 0.5 * cost) / total_cost *
+                         static_cast<double>(number_of_ranks));
+    ranks[i] = std::clamp(rank, 0, number_of_ranks - 1);
+    accumulated_cost += cost;
+  }
+  return ranks;
+}
+
+/**
+ * @brief Moves elements at the ends of the rank segments to the neighboring
+ * ranks ( in rank order ) to diminish the load imbalance ( diffusive load
+ * balancing ). The flow across the boundary between two ranks is the excess
+ * cost of all ranks before this boundary. Each rank gives away elements from
+ * its front to the preceding and from its back to the succeeding rank, hence
+ * elements never move further than to a neighboring rank.
+ * @param current_ranks The current rank of each element in the order along the
+ * space-filling curve.
+ * @param costs The (non-negative) costs of the elements.
+ * @param number_of_ranks The number of ranks the elements are distributed on.
+ * @param flow_fraction The fraction of the flows that is realized, in [0, 1].
+ * @return The new rank of each element.
+ * @note If all costs are zero, all elements are considered equally expensive.
+ * The balance is not necessarily reached in one call, when a rank has less
+ * cost than it should give away.
+ */
+inline std::vector<int> DiffusiveRanks(std::vector<int> const &current_ranks,
+                                       std::vector<double> const &costs,
+                                       int const number_of_ranks,
+                                       double const flow_fraction) {
+  std::size_t const rank_count = static_cast<std::size_t>(number_of_ranks);
+  bool const uniform =
+      std::accumulate(std::cbegin(costs), std::cend(costs), 0.0) <= 0.0;
+  auto const cost_of = [&costs, uniform](std::size_t const i) {
+    return uniform ? 1.0 : costs[i];
+  };
+
+  std::vector<std::vector<std::size_t>> elements_of_rank(rank_count);
+  std::vector<double> cost_of_rank(rank_count, 0.0);
+  for (std::size_t i = 0; i < current_ranks.size(); ++i) {
+    std::size_t const rank = static_cast<std::size_t>(
+        std::clamp(current_ranks[i], 0, number_of_ranks - 1));
+    elements_of_rank[rank].push_back(i);
+    cost_of_rank[rank] += cost_of(i);
+  }
+  double const mean_cost =
+      std::accumulate(std::cbegin(cost_of_rank), std::cend(cost_of_rank), 0.0) /
+      static_cast<double>(number_of_ranks);
+
+  // flow[r] is the cost to be moved from rank r - 1 to rank r ( negative for
+  // the opposite direction )
+  std::vector<double> flow(rank_count + 1, 0.0);
+  double accumulated_cost = 0.0;
+  for (std::size_t r = 1; r < rank_count; ++r) {
+    accumulated_cost += cost_of_rank[r - 1];
+    flow[r] =
+        flow_fraction * (accumulated_cost - static_cast<double>(r) * mean_cost);
+  }
+
+  std::vector<int> ranks(current_ranks);
+  for (std::size_t r = 0; r < rank_count; ++r) {
+    std::vector<std::size_t> const &elements = elements_of_rank[r];
+    std::size_t front = 0;
+    double moved_cost = 0.0;
+    while (front < elements.size() &&
+           moved_cost + 0.5 * cost_of(elements[front]) < -flow[r]) {
+      moved_cost += cost_of(elements[front]);
+      ranks[elements[front]] = static_cast<int>(r) - 1;
+      front++;
+    }
+    std::size_t back = elements.size();
+    moved_cost = 0.0;
+    while (back > front &&
+           moved_cost + 0.5 * cost_of(elements[back - 1]) < flow[r + 1]) {
+      moved_cost += cost_of(elements[back - 1]);
+      ranks[elements[back - 1]] = static_cast<int>(r) + 1;
+      back--;
+    }
+  }
+  return ranks;
+}
+
+/**
+ * @brief Moves the rank boundaries onto the boundaries of groups of elements,
+ * such that no group is split between ranks. A group consists of consecutive
+ * elements with the same key ( e.g. siblings along the space-filling curve ).
+ * Each group is given to the rank which holds most of its elements, the lower
+ * rank on ties.
+ * @param ranks The rank of each element.
+ * @param keys The group key of each element.
+ * @return The new rank of each element.
+ * @tparam Key Type of the group keys.
+ */
+template <typename Key>
+std::vector<int> GroupAlignedRanks(std::vector<int> const &ranks,
+                                   std::vector<Key> const &keys) {
+  std::vector<int> aligned_ranks(ranks);
+  std::size_t end = 0;
+  for (std::size_t begin = 0; begin < ranks.size(); begin = end) {
+    end = begin + 1;
+    while (end < ranks.size() && keys[end] == keys[begin]) {
+      end++;
+    }
+    int group_rank = ranks[begin];
+    std::ptrdiff_t group_count = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+      std::ptrdiff_t const count = std::count(
+          std::cbegin(ranks) + begin, std::cbegin(ranks) + end, ranks[i]);
+      if (count > group_count ||
+          (count == group_count && ranks[i] < group_rank)) {
+        group_rank = ranks[i];
+        group_count = count;
+      }
+    }
+    std::fill(std::begin(aligned_ranks) + begin,
+              std::begin(aligned_ranks) + end, group_rank);
+  }
+  return aligned_ranks;
+}
+
+/**
+ * @brief Gives the order in which the ranks take the segments of the
+ * space-filling curve such that ranks on the same compute node take adjacent
+ * segments. Thereby, the curve is first split across the compute nodes and then
+ * across the ranks within each node, which keeps most of the halo traffic
+ * within the nodes. Nodes and the ranks within a node keep their order.
+ * @param node_of_rank The compute node of each rank, e.g. its lowest rank.
+ * @return The rank taking the segment at each position along the curve.
+ */
+inline std::vector<int>
+RanksGroupedByNode(std::vector<int> const &node_of_rank) {
+  std::vector<int> ranks(node_of_rank.size());
+  std::iota(std::begin(ranks), std::end(ranks), 0);
+  std::stable_sort(std::begin(ranks), std::end(ranks),
+                   [&node_of_rank](int const a, int const b) {
+                     return node_of_rank[a] < node_of_rank[b];
+                   });
+  return ranks;
+}
+
+#endif // COST_WEIGHTED_PARTITION_H
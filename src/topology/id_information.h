@@ -181,7 +181,7 @@ constexpr bool BottomInSiblingPack(nid_t const id) { return (id & 0x4) == 0; }
  * @return Ids of the children in increasing order, i.e. bottom-south-west,
  * bottom-south-east, bottom-north-west, ... ,top-north-east.
  */
-inline std::vector<nid_t> IdsOfChildren(nid_t const parent_id) {
+inline std::array<nid_t, CC::NOC()> IdsOfChildren(nid_t const parent_id) {
   return {{(parent_id << 3), (parent_id << 3) + 1
 #if DIMENSION > 1
            ,
@@ -20,6 +20,7 @@
 //
 //===----------------------------------------------------------------------===//
 #include "node.h"
+#include "utilities/numa_placement.h"
 #include <utility>
 
 /**
@@ -38,10 +39,15 @@ Node::Node(nid_t const id, double const node_size_on_level_zero,
       node_coordinates_(
           std::make_tuple(DomainCoordinatesOfId(id, node_size_)[0],
                           DomainCoordinatesOfId(id, node_size_)[1],
-                          DomainCoordinatesOfId(id, node_size_)[2])) {
+                          DomainCoordinatesOfId(id, node_size_)[2])),
+      interface_tag_summary_(
+          {initial_interface_tag, initial_interface_tag,
+           std::abs(initial_interface_tag) <= ITTI(IT::NewCutCell)
+               ? CC::TCX() * CC::TCY() * CC::TCZ()
+               : 0}),
+      interface_tag_summary_valid_(true) {
   for (MaterialName const &material : materials) {
-    phases_.emplace(std::piecewise_construct, std::make_tuple(material),
-                    std::make_tuple());
+    phases_.emplace(material);
   }
 
   for (unsigned int i = 0; i < CC::TCX(); ++i) {
@@ -74,10 +80,10 @@ Node::Node(nid_t const id, double const node_size_on_level_zero,
           std::make_tuple(DomainCoordinatesOfId(id, node_size_)[0],
                           DomainCoordinatesOfId(id, node_size_)[1],
                           DomainCoordinatesOfId(id, node_size_)[2])),
+      interface_tag_summary_(), interface_tag_summary_valid_(false),
       interface_block_(std::move(interface_block)) {
   for (MaterialName const &material : materials) {
-    phases_.emplace(std::piecewise_construct, std::make_tuple(material),
-                    std::make_tuple());
+    phases_.emplace(material);
   }
 
   for (unsigned int i = 0; i < CC::TCX(); ++i) {
@@ -170,14 +176,12 @@ std::vector<MaterialName> Node::GetMaterials() const {
  * @brief Gives the data of the phases present in this node.
  * @return Vector of block data.
  */
-std::unordered_map<MaterialName, Block> &Node::GetPhases() { return phases_; }
+PhaseMap &Node::GetPhases() { return phases_; }
 
 /**
  * @brief Const overload.
  */
-std::unordered_map<MaterialName, Block> const &Node::GetPhases() const {
-  return phases_;
-}
+PhaseMap const &Node::GetPhases() const { return phases_; }
 
 /**
  * @brief Returns the material data of the respective material.
@@ -201,8 +205,7 @@ Block const &Node::GetPhaseByMaterial(MaterialName const material) const {
  */
 void Node::AddPhase(MaterialName const material) {
   // does not test if the material is already present
-  phases_.emplace(std::piecewise_construct, std::make_tuple(material),
-                  std::make_tuple());
+  phases_.emplace(material);
 }
 
 /**
@@ -217,12 +220,7 @@ void Node::RemovePhase(MaterialName const material) { phases_.erase(material); }
  * @return True if the material exists in this node. False otherwise.
  */
 bool Node::ContainsMaterial(MaterialName const material) const {
-  if (phases_.find(material) ==
-      phases_.end()) { // C++20 provides a contains function ...
-    return false;
-  } else {
-    return true;
-  }
+  return phases_.contains(material);
 }
 
 /**
@@ -282,14 +280,31 @@ std::int8_t Node::GetUniformInterfaceTag() const {
   }
 }
 
+/**
+ * @brief Gives the summary of the ( reinitialized ) interface tags. It is only
+ * recomputed if write access to the tags was given out since the last call.
+ * @return The summary of the interface tags.
+ * @note References to the tags obtained before must not be written to after
+ * the call.
+ */
+InterfaceTagSummary const &Node::GetInterfaceTagSummary() {
+  if (!interface_tag_summary_valid_) {
+    interface_tag_summary_ =
+        InterfaceTagFunctions::SummarizeInterfaceTags(interface_tags_);
+    interface_tag_summary_valid_ = true;
+  }
+  return interface_tag_summary_;
+}
+
 /**
  * @brief Gives the Interface Tag Buffer. Implementation for the reinitialized
- * buffer.
+ * buffer. Invalidates the summary of the tags.
  * @return Interface tag buffer.
  */
 template <>
 auto Node::GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>()
     -> std::int8_t (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  interface_tag_summary_valid_ = false;
   return interface_tags_;
 }
 
@@ -323,7 +338,8 @@ auto Node::GetInterfaceTags<InterfaceDescriptionBufferType::Integrated>() const
 }
 
 /**
- * @brief Gives the Interface Tag Buffer.
+ * @brief Gives the Interface Tag Buffer. For the reinitialized buffer the
+ * summary of the tags is invalidated.
  * @param type Level set field buffer type.
  * @return Interface tag buffer.
  */
@@ -331,6 +347,7 @@ auto Node::GetInterfaceTags(InterfaceDescriptionBufferType const type)
     -> std::int8_t (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
   switch (type) {
   case InterfaceDescriptionBufferType::Reinitialized: {
+    interface_tag_summary_valid_ = false;
     return interface_tags_;
   }
   case InterfaceDescriptionBufferType::Integrated: {
@@ -371,3 +388,37 @@ auto Node::GetInterfaceTags(InterfaceDescriptionBufferType const type) const
 bool Node::HasLevelset() const {
   return interface_block_ == nullptr ? false : true;
 }
+
+/**
+ * @brief Adds the given measured time to the cost of this node.
+ * @param cost The time spent on this node (in seconds).
+ */
+void Node::AddComputationalCost(double const cost) {
+  computational_cost_ += cost;
+}
+
+/**
+ * @brief Gives the accumulated measured cost of this node.
+ * @return The time spent on this node since the last reset (in seconds).
+ */
+double Node::GetComputationalCost() const { return computational_cost_; }
+
+/**
+ * @brief Resets the accumulated measured cost of this node.
+ */
+void Node::ResetComputationalCost() { computational_cost_ = 0.0; }
+
+/**
+ * @brief Moves the memory of all blocks and of the interface block to the
+ * given NUMA domain.
+ * @param domain The target domain ( see NumaPlacement::MoveToDomain ).
+ */
+void Node::MoveToNumaDomain(int const domain) const {
+  for (auto const &phase : phases_) {
+    phase.second.MoveToNumaDomain(domain);
+  }
+  if (interface_block_) {
+    NumaPlacement::MoveToDomain(interface_block_.get(), sizeof(InterfaceBlock),
+                                domain);
+  }
+}
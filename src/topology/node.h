@@ -30,8 +30,10 @@
 #include "block_definitions/interface_block.h"
 #include "boundary_condition/boundary_specifications.h"
 #include "enums/interface_tag_definition.h"
+#include "interface_tags/interface_tag_functions.h"
 #include "materials/material_definitions.h"
 #include "topology/id_information.h"
+#include "topology/phase_map.h"
 
 /**
  * @brief Nodes are the members in the tree. A node holds a block for every
@@ -44,15 +46,22 @@ class Node {
 
   double const node_size_;
   std::tuple<double const, double const, double const> const node_coordinates_;
-  std::unordered_map<MaterialName, Block> phases_;
+  PhaseMap phases_;
 
   // type std::int8_t due to definition of enum InterfaceTag. Needs to be
   // changed in case the enum type changes.
   std::int8_t interface_tags_[CC::TCX()][CC::TCY()][CC::TCZ()];
   std::int8_t integrated_interface_tags_[CC::TCX()][CC::TCY()][CC::TCZ()];
+  // summary of the ( reinitialized ) interface tags, invalidated whenever
+  // write access to them is given out and recomputed on demand
+  InterfaceTagSummary interface_tag_summary_;
+  bool interface_tag_summary_valid_;
 
   std::unique_ptr<InterfaceBlock> interface_block_;
 
+  // Measured time spent on this node since the last load balancing (seconds)
+  double computational_cost_ = 0.0;
+
 public:
   Node() = delete;
   explicit Node(nid_t const id, double const node_size_on_level_zero,
@@ -82,8 +91,8 @@ public:
   Block const &GetPhaseByMaterial(MaterialName const material) const;
   MaterialName GetSinglePhaseMaterial() const;
   std::vector<MaterialName> GetMaterials() const;
-  std::unordered_map<MaterialName, Block> &GetPhases();
-  std::unordered_map<MaterialName, Block> const &GetPhases() const;
+  PhaseMap &GetPhases();
+  PhaseMap const &GetPhases() const;
 
   void AddPhase(MaterialName const material);
   void RemovePhase(MaterialName const material);
@@ -95,7 +104,14 @@ public:
   SetInterfaceBlock(std::unique_ptr<InterfaceBlock> interface_block = nullptr);
   bool HasLevelset() const;
 
+  void AddComputationalCost(double const cost);
+  double GetComputationalCost() const;
+  void ResetComputationalCost();
+
+  void MoveToNumaDomain(int const domain) const;
+
   std::int8_t GetUniformInterfaceTag() const;
+  InterfaceTagSummary const &GetInterfaceTagSummary();
   template <InterfaceDescriptionBufferType C>
   auto GetInterfaceTags() -> std::int8_t (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
   template <InterfaceDescriptionBufferType C>
@@ -0,0 +1,221 @@
+//===--------------------------- node_store.cpp ---------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "topology/node_store.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+
+#include "topology/space_filling_curve_order.h"
+#include "utilities/memory_statistics.h"
+
+/**
+ * @brief Constructs an empty store.
+ * @param curve_index The index function of the curve the nodes are iterated
+ * along.
+ */
+NodeStore::NodeStore(SfcIndexFunction const curve_index)
+    : curve_index_(curve_index), slabs_(), allocator_(), free_slots_(),
+      free_slots_sorted_(true), index_(), curve_order_(),
+      curve_order_valid_(true) {
+  /** Empty besides initializer list */
+}
+
+/**
+ * @brief Destructs all nodes and returns the slabs to the pool.
+ */
+NodeStore::~NodeStore() {
+  for (auto const &[id, entry_and_index] : index_) {
+    std::destroy_at(entry_and_index.first);
+  }
+  for (Slab *const slab : slabs_) {
+    allocator_.deallocate(slab, 1);
+  }
+}
+
+/**
+ * @brief Takes over the nodes of another store, which is left empty. The nodes
+ * themselves stay in place.
+ * @param other The store to take the nodes from.
+ */
+NodeStore::NodeStore(NodeStore &&other)
+    : curve_index_(other.curve_index_), slabs_(std::move(other.slabs_)),
+      allocator_(), free_slots_(std::move(other.free_slots_)),
+      free_slots_sorted_(other.free_slots_sorted_),
+      index_(std::move(other.index_)),
+      curve_order_(std::move(other.curve_order_)),
+      curve_order_valid_(other.curve_order_valid_) {
+  other.slabs_.clear();
+  other.free_slots_.clear();
+  other.index_.clear();
+  other.curve_order_.clear();
+  other.curve_order_valid_ = true;
+}
+
+/**
+ * @brief Hands out the free slot with the lowest address, a new slab is added
+ * if all slots are taken. Nodes created one after another, e.g. the children
+ * of a refined node or the nodes received in a load balancing, hence lie next
+ * to each other in memory.
+ * @return The slot.
+ */
+NodeStore::Slot *NodeStore::AcquireSlot() {
+  if (free_slots_.empty()) {
+    Slab *const slab = ::new (static_cast<void *>(allocator_.allocate(1))) Slab;
+    slabs_.push_back(slab);
+    for (std::size_t i = slab_size_; i > 0; --i) {
+      free_slots_.push_back(&slab->slots_[i - 1]);
+    }
+  } else if (!free_slots_sorted_) {
+    std::sort(free_slots_.begin(), free_slots_.end(), std::greater<Slot *>());
+  }
+  free_slots_sorted_ = true;
+  Slot *const slot = free_slots_.back();
+  free_slots_.pop_back();
+  return slot;
+}
+
+/**
+ * @brief Sorts the entries along the curve if nodes were inserted or removed
+ * since the last iteration.
+ */
+void NodeStore::UpdateCurveOrder() const {
+  if (curve_order_valid_) {
+    return;
+  }
+  std::vector<nid_t> ids;
+  ids.reserve(index_.size());
+  for (auto const &[id, entry_and_index] : index_) {
+    ids.push_back(id);
+  }
+  OrderNodeIdsBySpaceFillingCurve(
+      ids, [this](nid_t const id) { return index_.at(id).second; });
+  curve_order_.clear();
+  curve_order_.reserve(ids.size());
+  for (nid_t const id : ids) {
+    curve_order_.push_back(index_.at(id).first);
+  }
+  curve_order_valid_ = true;
+}
+
+/**
+ * @brief Removes the node with the given id if it is present. Its slot is
+ * reused by later insertions.
+ * @param id The id of the node.
+ * @return Number of removed nodes ( zero or one ).
+ */
+std::size_t NodeStore::erase(nid_t const id) {
+  auto const position = index_.find(id);
+  if (position == index_.end()) {
+    return 0;
+  }
+  Entry *const entry = position->second.first;
+  std::destroy_at(entry);
+  // The entry is placed at the beginning of its slot
+  free_slots_.push_back(reinterpret_cast<Slot *>(entry));
+  free_slots_sorted_ = false;
+  index_.erase(position);
+  curve_order_valid_ = false;
+  return 1;
+}
+
+/**
+ * @brief Indicates whether a node with the given id is present.
+ * @param id The id of the node.
+ * @return True if the node is present, false otherwise.
+ */
+bool NodeStore::contains(nid_t const id) const {
+  return index_.find(id) != index_.end();
+}
+
+/**
+ * @brief Gives the node with the given id. Throws if it is not present.
+ * @param id The id of the node.
+ * @return The node.
+ */
+Node &NodeStore::at(nid_t const id) { return index_.at(id).first->second; }
+
+/**
+ * @brief Const overload.
+ */
+Node const &NodeStore::at(nid_t const id) const {
+  return index_.at(id).first->second;
+}
+
+/**
+ * @brief Gives the id-node pair with the given id. Throws if it is not present.
+ * @param id The id of the node.
+ * @return The entry.
+ */
+NodeStore::Entry &NodeStore::entry(nid_t const id) {
+  return *index_.at(id).first;
+}
+
+/**
+ * @brief Const overload.
+ */
+NodeStore::Entry const &NodeStore::entry(nid_t const id) const {
+  return *index_.at(id).first;
+}
+
+/**
+ * @brief Gives the id-node pair with the given id in a single lookup. Unlike
+ * for standard maps, no iterator is returned since iteration follows the curve.
+ * @param id The id of the node.
+ * @return The entry, nullptr if it is not present.
+ */
+NodeStore::Entry *NodeStore::find(nid_t const id) {
+  auto const entry = index_.find(id);
+  return entry == index_.end() ? nullptr : entry->second.first;
+}
+
+/**
+ * @brief Const overload.
+ */
+NodeStore::Entry const *NodeStore::find(nid_t const id) const {
+  auto const entry = index_.find(id);
+  return entry == index_.end() ? nullptr : entry->second.first;
+}
+
+/**
+ * @brief Estimates the memory held by the store, i.e. its slabs, the index and
+ * the lists of free slots and of the curve order. The blocks of the nodes are
+ * not included.
+ * @return The memory in bytes.
+ */
+std::size_t NodeStore::CapacityBytes() const {
+  // Index entries are allocated one by one, the bucket list holds pointers
+  return slabs_.size() * sizeof(Slab) + ::CapacityBytes(slabs_) +
+         ::CapacityBytes(free_slots_) + ::CapacityBytes(curve_order_) +
+         index_.size() *
+             (sizeof(decltype(index_)::value_type) + sizeof(void *)) +
+         index_.bucket_count() * sizeof(void *);
+}
+
+/**
+ * @brief Gives the memory held by the slabs kept for reuse in the storage pool
+ * ( shared by the stores of all levels ).
+ * @return Bytes of the free slabs.
+ */
+std::size_t NodeStore::PooledSlabBytes() {
+  return StoragePool<sizeof(Slab)>::Instance().FreeBytes();
+}
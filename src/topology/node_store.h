@@ -0,0 +1,189 @@
+//===---------------------------- node_store.h ----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef NODE_STORE_H
+#define NODE_STORE_H
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "topology/node.h"
+#include "topology/node_id_type.h"
+#include "topology/space_filling_curve_index.h"
+#include "utilities/storage_pool.h"
+
+/**
+ * @brief The NodeStore class holds the nodes of one level of a tree. The nodes
+ * are placed in slabs of contiguous slots drawn from the storage pool, freed
+ * slots are refilled from the lowest address on. Lookups go through an index
+ * from the id to the slot. Iteration follows the space-filling curve, hence
+ * nodes that are neighbors in space are mostly visited one after another.
+ * Iteration yields id-node pairs as known from standard maps.
+ * @note Nodes are never moved, references stay valid until the node is erased.
+ * The curve order is restored on the first iteration after an insertion or
+ * removal, therefore, this first iteration must not run concurrently.
+ */
+class NodeStore {
+
+public:
+  using Entry = std::pair<nid_t const, Node>;
+  using value_type = Entry;
+
+  /**
+   * @brief Forward iterator over the entries along the space-filling curve.
+   * @tparam Value (Const-qualified) value type the iterator refers to.
+   */
+  template <typename Value> class Iterator {
+    Entry *const *position_;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    Iterator() : position_(nullptr) {}
+    explicit Iterator(Entry *const *const position) : position_(position) {}
+
+    reference operator*() const { return **position_; }
+    pointer operator->() const { return *position_; }
+    Iterator &operator++() {
+      ++position_;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator const previous(*this);
+      ++position_;
+      return previous;
+    }
+    bool operator==(Iterator const &other) const {
+      return position_ == other.position_;
+    }
+    bool operator!=(Iterator const &other) const {
+      return position_ != other.position_;
+    }
+  };
+
+  using iterator = Iterator<Entry>;
+  using const_iterator = Iterator<Entry const>;
+
+private:
+  // Number of nodes per slab
+  static constexpr std::size_t slab_size_ = 32;
+
+  struct Slot {
+    alignas(Entry) unsigned char storage_[sizeof(Entry)];
+  };
+  struct Slab {
+    std::array<Slot, slab_size_> slots_;
+  };
+
+  SfcIndexFunction curve_index_;
+  std::vector<Slab *> slabs_;
+  PoolAllocator<Slab> allocator_;
+  // free slots, sorted by descending address when slots are handed out
+  std::vector<Slot *> free_slots_;
+  bool free_slots_sorted_;
+  // entry and curve index of each node
+  std::unordered_map<nid_t, std::pair<Entry *, sfcidx_t>> index_;
+  // entries along the curve, restored lazily after changes
+  mutable std::vector<Entry *> curve_order_;
+  mutable bool curve_order_valid_;
+
+  Slot *AcquireSlot();
+  void UpdateCurveOrder() const;
+
+public:
+  NodeStore() = delete;
+  explicit NodeStore(SfcIndexFunction const curve_index);
+  ~NodeStore();
+  NodeStore(NodeStore const &) = delete;
+  NodeStore &operator=(NodeStore const &) = delete;
+  NodeStore(NodeStore &&other);
+  NodeStore &operator=(NodeStore &&) = delete;
+
+  template <typename... Arguments>
+  std::pair<Entry &, bool> emplace(nid_t const id, Arguments &&...arguments);
+  std::size_t erase(nid_t const id);
+  bool contains(nid_t const id) const;
+  Node &at(nid_t const id);
+  Node const &at(nid_t const id) const;
+  Entry &entry(nid_t const id);
+  Entry const &entry(nid_t const id) const;
+  Entry *find(nid_t const id);
+  Entry const *find(nid_t const id) const;
+
+  std::size_t size() const { return index_.size(); }
+  bool empty() const { return index_.empty(); }
+  std::size_t CapacityBytes() const;
+  static std::size_t PooledSlabBytes();
+
+  iterator begin() {
+    UpdateCurveOrder();
+    return iterator(curve_order_.data());
+  }
+  iterator end() {
+    UpdateCurveOrder();
+    return iterator(curve_order_.data() + curve_order_.size());
+  }
+  const_iterator begin() const {
+    UpdateCurveOrder();
+    return const_iterator(curve_order_.data());
+  }
+  const_iterator end() const {
+    UpdateCurveOrder();
+    return const_iterator(curve_order_.data() + curve_order_.size());
+  }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+};
+
+/**
+ * @brief Constructs a node with the given id in the lowest free slot, if the
+ * id is not present yet.
+ * @param id The unique id of the node.
+ * @param arguments The arguments passed to the node constructor.
+ * @return The entry of the id and whether it was inserted.
+ * @tparam Arguments Types of the constructor arguments.
+ */
+template <typename... Arguments>
+std::pair<NodeStore::Entry &, bool>
+NodeStore::emplace(nid_t const id, Arguments &&...arguments) {
+  if (auto const existing = index_.find(id); existing != index_.end()) {
+    return {*existing->second.first, false};
+  }
+  Slot *const slot = AcquireSlot();
+  Entry *const entry = ::new (static_cast<void *>(slot->storage_))
+      Entry(std::piecewise_construct, std::forward_as_tuple(id),
+            std::forward_as_tuple(std::forward<Arguments>(arguments)...));
+  index_.emplace(id, std::make_pair(entry, curve_index_(id)));
+  curve_order_valid_ = false;
+  return {*entry, true};
+}
+
+#endif // NODE_STORE_H
@@ -0,0 +1,138 @@
+//===--------------------------- phase_map.cpp ----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "topology/phase_map.h"
+
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+
+/**
+ * @brief Default constructor, creates an empty map.
+ */
+PhaseMap::PhaseMap() : entries_{}, size_(0), allocator_() {}
+
+/**
+ * @brief Destructs all blocks and returns their storage to the pool.
+ */
+PhaseMap::~PhaseMap() {
+  for (std::size_t i = 0; i < size_; ++i) {
+    std::destroy_at(entries_[i]);
+    allocator_.deallocate(entries_[i], 1);
+  }
+}
+
+/**
+ * @brief Gives the position of the first entry whose material is not smaller
+ * than the given one.
+ * @param material The material identifier.
+ * @return Index into the entries.
+ */
+std::size_t PhaseMap::LowerBound(MaterialName const material) const {
+  std::size_t position = 0;
+  while (position < size_ && MTI(entries_[position]->first) < MTI(material)) {
+    position++;
+  }
+  return position;
+}
+
+/**
+ * @brief Adds an empty block for the given material, if the material is not
+ * present yet.
+ * @param material The material identifier.
+ * @return The block of the material.
+ */
+Block &PhaseMap::emplace(MaterialName const material) {
+  std::size_t const position = LowerBound(material);
+  if (position < size_ && entries_[position]->first == material) {
+    return entries_[position]->second;
+  }
+#ifndef PERFORMANCE
+  if (size_ == capacity_) {
+    throw std::logic_error("A node cannot hold more phases than materials");
+  }
+#endif
+  Entry *const entry = allocator_.allocate(1);
+  ::new (static_cast<void *>(entry))
+      Entry(std::piecewise_construct, std::forward_as_tuple(material),
+            std::forward_as_tuple());
+  for (std::size_t i = size_; i > position; --i) {
+    entries_[i] = entries_[i - 1];
+  }
+  entries_[position] = entry;
+  size_++;
+  return entry->second;
+}
+
+/**
+ * @brief Removes the block of the given material if it is present.
+ * @param material The material identifier.
+ * @return Number of removed blocks ( zero or one ).
+ */
+std::size_t PhaseMap::erase(MaterialName const material) {
+  std::size_t const position = LowerBound(material);
+  if (position == size_ || entries_[position]->first != material) {
+    return 0;
+  }
+  std::destroy_at(entries_[position]);
+  allocator_.deallocate(entries_[position], 1);
+  for (std::size_t i = position + 1; i < size_; ++i) {
+    entries_[i - 1] = entries_[i];
+  }
+  size_--;
+  entries_[size_] = nullptr;
+  return 1;
+}
+
+/**
+ * @brief Indicates whether a block of the given material is present.
+ * @param material The material identifier.
+ * @return True if the material is present, false otherwise.
+ */
+bool PhaseMap::contains(MaterialName const material) const {
+  std::size_t const position = LowerBound(material);
+  return position < size_ && entries_[position]->first == material;
+}
+
+/**
+ * @brief Gives the block of the given material. Throws if it is not present.
+ * @param material The material identifier.
+ * @return The block of the material.
+ */
+Block &PhaseMap::at(MaterialName const material) {
+  std::size_t const position = LowerBound(material);
+  if (position == size_ || entries_[position]->first != material) {
+    throw std::out_of_range("Material is not present in the phase map");
+  }
+  return entries_[position]->second;
+}
+
+/**
+ * @brief Const overload.
+ */
+Block const &PhaseMap::at(MaterialName const material) const {
+  std::size_t const position = LowerBound(material);
+  if (position == size_ || entries_[position]->first != material) {
+    throw std::out_of_range("Material is not present in the phase map");
+  }
+  return entries_[position]->second;
+}
@@ -0,0 +1,122 @@
+//===---------------------------- phase_map.h -----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef PHASE_MAP_H
+#define PHASE_MAP_H
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include "block_definitions/block.h"
+#include "materials/material_definitions.h"
+#include "utilities/storage_pool.h"
+
+/**
+ * @brief The PhaseMap class maps the materials of a node to their blocks. The
+ * entries are kept in a fixed-capacity inline array sorted by the material,
+ * hence lookups do not hash and the iteration order is deterministic. The
+ * blocks themselves are drawn from the block storage pool. Iteration yields
+ * material-block pairs as known from standard maps.
+ */
+class PhaseMap {
+
+public:
+  using Entry = std::pair<MaterialName const, Block>;
+  using value_type = Entry;
+
+  /**
+   * @brief Forward iterator over the entries of the map.
+   * @tparam Value (Const-qualified) value type the iterator refers to.
+   */
+  template <typename Value> class Iterator {
+    Entry *const *position_;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    Iterator() : position_(nullptr) {}
+    explicit Iterator(Entry *const *const position) : position_(position) {}
+
+    reference operator*() const { return **position_; }
+    pointer operator->() const { return *position_; }
+    Iterator &operator++() {
+      ++position_;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator const previous(*this);
+      ++position_;
+      return previous;
+    }
+    bool operator==(Iterator const &other) const {
+      return position_ == other.position_;
+    }
+    bool operator!=(Iterator const &other) const {
+      return position_ != other.position_;
+    }
+  };
+
+  using iterator = Iterator<Entry>;
+  using const_iterator = Iterator<Entry const>;
+
+private:
+  // A node holds at most one block per material
+  static constexpr std::size_t capacity_ =
+      MTI(MaterialName::MaterialOutOfBounds);
+
+  std::array<Entry *, capacity_> entries_;
+  std::size_t size_;
+  PoolAllocator<Entry> allocator_;
+
+  std::size_t LowerBound(MaterialName const material) const;
+
+public:
+  PhaseMap();
+  ~PhaseMap();
+  PhaseMap(PhaseMap const &) = delete;
+  PhaseMap &operator=(PhaseMap const &) = delete;
+  PhaseMap(PhaseMap &&) = delete;
+  PhaseMap &operator=(PhaseMap &&) = delete;
+
+  Block &emplace(MaterialName const material);
+  std::size_t erase(MaterialName const material);
+  bool contains(MaterialName const material) const;
+  Block &at(MaterialName const material);
+  Block const &at(MaterialName const material) const;
+
+  std::size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  iterator begin() { return iterator(entries_.data()); }
+  iterator end() { return iterator(entries_.data() + size_); }
+  const_iterator begin() const { return const_iterator(entries_.data()); }
+  const_iterator end() const { return const_iterator(entries_.data() + size_); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+};
+
+#endif // PHASE_MAP_H
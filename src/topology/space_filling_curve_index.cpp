@@ -27,6 +27,7 @@
 #include <array>
 #include <bitset>
 #include <limits>
+#include <utility>
 
 constexpr std::size_t bisi = 64; // bisi = Bits In Sfc Index.
 static_assert(std::numeric_limits<sfcidx_t>::digits == bisi,
@@ -268,6 +269,41 @@ sfcidx_t HilbertIndex(nid_t const node_id) {
   return BinaryHilbert::HilbertIndex(RawMortonIndexOfId(node_id));
 }
 
+/**
+ * @brief Gives the two-dimensional Hilbert index for the provided node id,
+ * i.e. the z-coordinate is ignored. The coordinates are de-interleaved from
+ * the Morton index and traversed from the coarsest to the finest bit, rotating
+ * the quadrant at each step \cite Butz1971.
+ * @param node_id The id of the node whose index is to be computed.
+ * @return index.
+ */
+sfcidx_t HilbertIndex2D(nid_t const node_id) {
+  constexpr std::size_t bits_per_coordinate = 21;
+  nid_t const morton_index = RawMortonIndexOfId(node_id);
+  sfcidx_t x = 0;
+  sfcidx_t y = 0;
+  for (std::size_t bit = 0; bit < bits_per_coordinate; ++bit) {
+    x |= ((morton_index >> (3 * bit)) & 1) << bit;
+    y |= ((morton_index >> (3 * bit + 1)) & 1) << bit;
+  }
+
+  sfcidx_t index = 0;
+  for (sfcidx_t s = sfcidx_t(1) << (bits_per_coordinate - 1); s > 0; s >>= 1) {
+    sfcidx_t const rx = (x & s) > 0 ? 1 : 0;
+    sfcidx_t const ry = (y & s) > 0 ? 1 : 0;
+    index += s * s * ((3 * rx) ^ ry);
+    // rotate the quadrant such that the sub-curve starts in its lower left
+    if (ry == 0) {
+      if (rx == 1) {
+        x = s - 1 - x;
+        y = s - 1 - y;
+      }
+      std::swap(x, y);
+    }
+  }
+  return index;
+}
+
 /**
  * @brief Gives the Lebesgue index for the provided node id.
  * @param node_id The id of the node whose index is to be computed.
@@ -28,8 +28,13 @@
 // Space-filling curve index type
 using sfcidx_t = std::uint64_t;
 
+// Function giving the space-filling curve index of a node id
+using SfcIndexFunction = sfcidx_t (*)(nid_t const);
+
 sfcidx_t HilbertIndex(nid_t const node_id);
 
+sfcidx_t HilbertIndex2D(nid_t const node_id);
+
 sfcidx_t LebesgueIndex(nid_t const node_id);
 
 #endif // SPACE_FILLING_CURVE_INDEX
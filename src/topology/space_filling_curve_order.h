@@ -26,24 +26,81 @@
 #include "topology/space_filling_curve_index.h"
 #include "user_specifications/space_filling_curve_settings.h"
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <iterator>
+#include <utility>
 #include <vector>
 
+namespace SpaceFillingCurveOrderConstants {
+// Below this number of ids a comparison sort is faster than the radix sort
+constexpr std::size_t RadixSortThreshold = 256;
+// Bits of the curve index sorted per radix pass
+constexpr unsigned int RadixBits = 8;
+} // namespace SpaceFillingCurveOrderConstants
+
+/**
+ * @brief Sorts ids by their curve index with a least-significant-digit radix
+ * sort. Passes in which all indices share the digit are skipped, e.g. the
+ * leading zero bytes of the indices on coarse levels.
+ * @param keyed_ids The pairs of curve index and id, which get sorted by this
+ * function. Indirect return parameter.
+ * @note Stable, hence, ids with equal indices keep their order.
+ */
+inline void
+RadixSortByCurveIndex(std::vector<std::pair<sfcidx_t, nid_t>> &keyed_ids) {
+  namespace SFCO = SpaceFillingCurveOrderConstants;
+  constexpr std::size_t buckets = std::size_t(1) << SFCO::RadixBits;
+  std::vector<std::pair<sfcidx_t, nid_t>> buffer(keyed_ids.size());
+  for (unsigned int shift = 0; shift < 8 * sizeof(sfcidx_t);
+       shift += SFCO::RadixBits) {
+    std::array<std::size_t, buckets> offsets{};
+    for (auto const &keyed_id : keyed_ids) {
+      offsets[(keyed_id.first >> shift) & (buckets - 1)]++;
+    }
+    if (std::any_of(offsets.cbegin(), offsets.cend(),
+                    [&keyed_ids](std::size_t const count) {
+                      return count == keyed_ids.size();
+                    })) {
+      continue;
+    }
+    std::size_t position = 0;
+    for (std::size_t &offset : offsets) {
+      position += std::exchange(offset, position);
+    }
+    for (auto const &keyed_id : keyed_ids) {
+      buffer[offsets[(keyed_id.first >> shift) & (buckets - 1)]++] = keyed_id;
+    }
+    keyed_ids.swap(buffer);
+  }
+}
+
 /**
  * @brief Sorts a list of node ids according the the provided space-filling
- * curve .
+ * curve. The curve index is evaluated once per id, long lists are radix sorted
+ * on these indices.
  * @param ids_to_sort The unsorted indices, which get sorted by this function.
  * Indirect return parameter.
- * @param index The index function of the respective space-filling curve.
+ * @param index The index function of the respective space-filling curve or any
+ * callable giving the ( e.g. cached ) curve index of an id.
  */
 template <typename SpaceFillingCurveIndexFunction =
               decltype(SpaceFillingCurveSettings::SfcIndex)>
 void OrderNodeIdsBySpaceFillingCurve(std::vector<nid_t> &ids_to_sort,
                                      SpaceFillingCurveIndexFunction index =
                                          SpaceFillingCurveSettings::SfcIndex) {
-  std::sort(
-      std::begin(ids_to_sort), std::end(ids_to_sort),
-      [&index](nid_t const a, nid_t const b) { return index(a) < index(b); });
+  std::vector<std::pair<sfcidx_t, nid_t>> keyed_ids;
+  keyed_ids.reserve(ids_to_sort.size());
+  for (nid_t const id : ids_to_sort) {
+    keyed_ids.emplace_back(index(id), id);
+  }
+  if (keyed_ids.size() < SpaceFillingCurveOrderConstants::RadixSortThreshold) {
+    std::sort(keyed_ids.begin(), keyed_ids.end());
+  } else {
+    RadixSortByCurveIndex(keyed_ids);
+  }
+  std::transform(keyed_ids.cbegin(), keyed_ids.cend(), ids_to_sort.begin(),
+                 [](auto const &keyed_id) { return keyed_id.second; });
 }
 
 #endif // SPACE_FILLING_CURVE_ORDER_H
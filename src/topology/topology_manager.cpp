@@ -28,14 +28,17 @@
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "communication/mpi_utilities.h"
+#include "topology/cost_weighted_partition.h"
 #include "topology/id_information.h"
 #include "topology/node_id_type.h"
 #include "topology/space_filling_curve_order.h"
 #include "utilities/container_operations.h"
+#include "utilities/memory_statistics.h"
 #include "utilities/string_operations.h"
 
 namespace {
@@ -65,6 +68,22 @@ std::vector<std::size_t> ElementsPerRank(std::size_t const number_of_elements,
   return elements_per_rank;
 }
 
+/**
+ * @brief Gives the keys of the sibling groups of the given leaves, i.e. the id
+ * of their parent. Leaves on level zero have no siblings and form a group of
+ * their own.
+ * @param leaves The leaves ( all on the same level ).
+ * @return The group key of each leaf.
+ */
+std::vector<nid_t> SiblingGroupKeys(std::vector<nid_t> const &leaves) {
+  std::vector<nid_t> keys(leaves.size());
+  std::transform(std::cbegin(leaves), std::cend(leaves), std::begin(keys),
+                 [](nid_t const id) {
+                   return LevelOfNode(id) == 0 ? id : ParentIdOfNode(id);
+                 });
+  return keys;
+}
+
 /**
  * @brief Checks if the given node is a multiphase node.
  * @param node Topology node that is to be checked for the multiphase condition.
@@ -74,6 +93,15 @@ bool IsMultiPhase(TopologyNode const &node) {
   return node.NumberOfMaterials() > 1;
 }
 
+/**
+ * @brief Gives the estimated cost of a leaf according to the static cost model.
+ * @param node Topology node whose cost is estimated.
+ * @return Cost relative to a single-phase leaf.
+ */
+double StaticLeafCost(TopologyNode const &node) {
+  return IsMultiPhase(node) ? CC::MPLC() : 1.0;
+}
+
 /**
  * @brief Creates a vector with elements from max_value in descending order
  * until zero included.
@@ -87,6 +115,20 @@ std::vector<unsigned int> ElementsDescendingFrom(unsigned int const max_value) {
   return v;
 }
 
+/**
+ * @brief Gives the listing of the given level. Levels beyond the maximum level
+ * hold no nodes, hence an empty listing is given for them.
+ * @param listings The listings of all levels.
+ * @param level The level of interest.
+ * @return The listing of the level.
+ */
+std::vector<nid_t> const &
+ListingOnLevel(std::vector<std::vector<nid_t>> const &listings,
+               unsigned int const level) {
+  static std::vector<nid_t> const empty_listing;
+  return level < listings.size() ? listings[level] : empty_listing;
+}
+
 } // namespace
 
 /**
@@ -97,15 +139,34 @@ std::vector<unsigned int> ElementsDescendingFrom(unsigned int const max_value) {
  * blocks on level zero in the x/y/z-axis extension.
  * @param active_periodic_locations Side of the domain on which periodic
  * boundaries are activated.
+ * @param load_imbalance_threshold Ratio of the maximum to the mean measured
+ * rank cost above which load balancing is triggered. Zero deactivates the
+ * trigger.
+ * @param space_filling_curve Curve along which the leaves are distributed onto
+ * the ranks.
  */
 TopologyManager::TopologyManager(
     std::array<unsigned int, 3> const level_zero_blocks,
     unsigned int const maximum_level,
-    unsigned int const active_periodic_locations)
+    unsigned int const active_periodic_locations,
+    double const load_imbalance_threshold,
+    SpaceFillingCurve const space_filling_curve)
     : maximum_level_(maximum_level),
       active_periodic_locations_(active_periodic_locations),
+      load_imbalance_threshold_(load_imbalance_threshold),
+      sfc_index_(SpaceFillingCurveSettings::IndexFunction(space_filling_curve)),
+      curve_ranks_(RanksGroupedByNode(MpiUtilities::SharedMemoryNodeOfRanks())),
       number_of_nodes_on_level_zero_(level_zero_blocks), forest_{},
-      coarsenings_since_load_balance_{0}, refinements_since_load_balance_{0} {
+      coarsenings_since_load_balance_{0}, refinements_since_load_balance_{0},
+      material_update_count_{0}, topology_update_count_{0},
+      load_imbalance_{1.0}, ids_on_level_(maximum_level + 1),
+      local_ids_on_level_(maximum_level + 1),
+      leaf_ids_on_level_(maximum_level + 1),
+      local_leaf_ids_on_level_(maximum_level + 1), local_leaf_ids_{},
+      node_lists_update_count_{0}, neighbors_of_local_nodes_{},
+      counts_per_rank_{}, offsets_of_rank_{},
+      rank_counts_topology_update_count_{0}, rank_counts_material_update_count_{
+                                                 0} {
   nid_t id = IdSeed();
 
   std::vector<nid_t> initialization_list;
@@ -119,7 +180,7 @@ TopologyManager::TopologyManager(
   for (unsigned int i = 0; i < number_of_nodes_on_level_zero_[2]; ++i) {
     for (unsigned int j = 0; j < number_of_nodes_on_level_zero_[1]; ++j) {
       for (unsigned int k = 0; k < number_of_nodes_on_level_zero_[0]; ++k) {
-        forest_.emplace(id, 0);
+        forest_.emplace(id, 0).first->second.SetCurveIndex(sfc_index_(id));
         initialization_list.push_back(id);
         id = EastNeighborOfNodeWithId(
             initialization_list
@@ -136,6 +197,9 @@ TopologyManager::TopologyManager(
                              number_of_nodes_on_level_zero_[0] * i)]);
   }
 
+  // The forest has been created, hence the node listings are outdated
+  topology_update_count_++;
+
   // Assign correct ranks to nodes
   PrepareLoadBalancedTopology(MpiUtilities::NumberOfRanks());
 }
@@ -154,23 +218,35 @@ bool TopologyManager::UpdateTopology() {
   bool invalidate_communication_manager_cache = false;
   int const number_of_ranks = MpiUtilities::NumberOfRanks();
 
+  // The lengths of all change lists are gathered at once. Lists that are empty
+  // on all ranks, most often the material changes, are not gathered at all
+  std::vector<std::vector<int>> const list_lengths =
+      MpiUtilities::GatherLengths(
+          {static_cast<int>(local_refine_list_.size()),
+           static_cast<int>(std::get<0>(local_added_materials_list_).size()),
+           static_cast<int>(std::get<0>(local_removed_materials_list_).size())},
+          number_of_ranks);
+
   // Tree update
   // refine
   std::vector<nid_t> global_refine_list;
   MpiUtilities::LocalToGlobalData(local_refine_list_, MPI_LONG_LONG_INT,
-                                  number_of_ranks, global_refine_list);
+                                  list_lengths[0], global_refine_list);
 
   for (auto const &refine_id : global_refine_list) {
     TopologyNode &parent = forest_.at(refine_id);
     parent.MakeParent();
     for (auto child_id : IdsOfChildren(refine_id)) {
-      forest_.emplace(std::piecewise_construct, std::make_tuple(child_id),
-                      std::make_tuple(parent.Rank()));
+      forest_
+          .emplace(std::piecewise_construct, std::make_tuple(child_id),
+                   std::make_tuple(parent.Rank()))
+          .first->second.SetCurveIndex(sfc_index_(child_id));
     }
   }
   // Invalididate cache if any node has been refined
   if (global_refine_list.size() > 0) {
     invalidate_communication_manager_cache = true;
+    topology_update_count_++;
   }
 
   local_refine_list_.clear();
@@ -181,10 +257,10 @@ bool TopologyManager::UpdateTopology() {
   std::tuple<std::vector<nid_t>, std::vector<MaterialName>>
       global_materials_list;
   MpiUtilities::LocalToGlobalData(std::get<0>(local_added_materials_list_),
-                                  MPI_LONG_LONG_INT, number_of_ranks,
+                                  MPI_LONG_LONG_INT, list_lengths[1],
                                   std::get<0>(global_materials_list));
   MpiUtilities::LocalToGlobalData(std::get<1>(local_added_materials_list_),
-                                  MPI_UNSIGNED_SHORT, number_of_ranks,
+                                  MPI_UNSIGNED_SHORT, list_lengths[1],
                                   std::get<1>(global_materials_list));
 
 #ifndef PERFORMANCE
@@ -194,6 +270,7 @@ bool TopologyManager::UpdateTopology() {
   }
 #endif
 
+  bool materials_changed = !std::get<0>(global_materials_list).empty();
   for (unsigned int i = 0; i < std::get<0>(global_materials_list).size(); ++i) {
     forest_.at(std::get<0>(global_materials_list)[i])
         .AddMaterial(std::get<1>(global_materials_list)[i]);
@@ -207,10 +284,10 @@ bool TopologyManager::UpdateTopology() {
   std::get<1>(global_materials_list).clear();
 
   MpiUtilities::LocalToGlobalData(std::get<0>(local_removed_materials_list_),
-                                  MPI_LONG_LONG_INT, number_of_ranks,
+                                  MPI_LONG_LONG_INT, list_lengths[2],
                                   std::get<0>(global_materials_list));
   MpiUtilities::LocalToGlobalData(std::get<1>(local_removed_materials_list_),
-                                  MPI_UNSIGNED_SHORT, number_of_ranks,
+                                  MPI_UNSIGNED_SHORT, list_lengths[2],
                                   std::get<1>(global_materials_list));
 
 #ifndef PERFORMANCE
@@ -220,6 +297,7 @@ bool TopologyManager::UpdateTopology() {
   }
 #endif
 
+  materials_changed |= !std::get<0>(global_materials_list).empty();
   for (unsigned int i = 0; i < std::get<0>(global_materials_list).size(); ++i) {
     forest_.at(std::get<0>(global_materials_list)[i])
         .RemoveMaterial(std::get<1>(global_materials_list)[i]);
@@ -228,9 +306,132 @@ bool TopologyManager::UpdateTopology() {
   std::get<0>(local_removed_materials_list_).clear();
   std::get<1>(local_removed_materials_list_).clear();
 
+  // The lists are global, hence all ranks count identically
+  if (materials_changed) {
+    material_update_count_++;
+  }
+
+  UpdateNodeLists();
+
   return invalidate_communication_manager_cache;
 }
 
+/**
+ * @brief Gives the number of topology updates in which materials have been
+ * added to or removed from nodes. Allows caches that depend on the materials
+ * of nodes to detect that they are outdated.
+ * @return Number of material updates since construction.
+ */
+unsigned int TopologyManager::MaterialUpdateCount() const {
+  return material_update_count_;
+}
+
+/**
+ * @brief Gives the number of changes of the leaves, i.e. refinements and
+ * coarsenings, or of the ranks the nodes are assigned to. Allows caches that
+ * depend on the global leaf distribution to detect that they are outdated.
+ * @return Number of topology updates since construction.
+ */
+unsigned int TopologyManager::TopologyUpdateCount() const {
+  return topology_update_count_;
+}
+
+/**
+ * @brief Gives the index function of the space-filling curve the nodes are
+ * ordered along.
+ * @return The curve index function.
+ */
+SfcIndexFunction TopologyManager::CurveIndexFunction() const {
+  return sfc_index_;
+}
+
+/**
+ * @brief Gives the ratio of the maximum to the mean rank cost as determined in
+ * the last call to UpdateLoadImbalance.
+ * @return The load imbalance, one for a perfectly balanced load.
+ */
+double TopologyManager::LoadImbalance() const { return load_imbalance_; }
+
+/**
+ * @brief Estimates the memory held by the global node information (the forest)
+ * and the local update lists as well as the node listings per level, the
+ * neighbors of the local nodes and the counts per rank. The forest is
+ * replicated on all ranks.
+ * @return The memory in bytes.
+ */
+std::size_t TopologyManager::ForestBytes() const {
+  // Forest entries are allocated one by one, the bucket list holds pointers
+  std::size_t bytes =
+      forest_.size() *
+          (sizeof(std::pair<nid_t const, TopologyNode>) + sizeof(void *)) +
+      forest_.bucket_count() * sizeof(void *);
+  for (auto const &[id, node] : forest_) {
+    bytes += node.NumberOfMaterials() * sizeof(MaterialName);
+  }
+  for (auto const *lists : {&ids_on_level_, &local_ids_on_level_,
+                            &leaf_ids_on_level_, &local_leaf_ids_on_level_}) {
+    bytes += CapacityBytes(*lists);
+    for (std::vector<nid_t> const &ids : *lists) {
+      bytes += CapacityBytes(ids);
+    }
+  }
+  bytes +=
+      neighbors_of_local_nodes_.size() *
+          (sizeof(std::pair<nid_t const, std::array<TopologyNeighbor, 26>>) +
+           sizeof(void *)) +
+      neighbors_of_local_nodes_.bucket_count() * sizeof(void *);
+  return bytes + CapacityBytes(local_leaf_ids_) +
+         CapacityBytes(counts_per_rank_) + CapacityBytes(offsets_of_rank_) +
+         CapacityBytes(local_refine_list_) +
+         CapacityBytes(std::get<0>(local_added_materials_list_)) +
+         CapacityBytes(std::get<1>(local_added_materials_list_)) +
+         CapacityBytes(std::get<0>(local_removed_materials_list_)) +
+         CapacityBytes(std::get<1>(local_removed_materials_list_));
+}
+
+/**
+ * @brief Determines the load imbalance from the measured costs of all ranks.
+ * @param local_cost The cost measured on this rank since the last load
+ * balancing.
+ * @note Collective operation, must be called on all ranks.
+ */
+void TopologyManager::UpdateLoadImbalance(double const local_cost) {
+  double maximum_cost = local_cost;
+  double total_cost = local_cost;
+  MPI_Allreduce(MPI_IN_PLACE, &maximum_cost, 1, MPI_DOUBLE, MPI_MAX,
+                MpiUtilities::Communicator());
+  MPI_Allreduce(MPI_IN_PLACE, &total_cost, 1, MPI_DOUBLE, MPI_SUM,
+                MpiUtilities::Communicator());
+  double const mean_cost = total_cost / MpiUtilities::NumberOfRanks();
+  load_imbalance_ = mean_cost > 0.0 ? maximum_cost / mean_cost : 1.0;
+}
+
+/**
+ * @brief Sets the measured costs of the nodes, which are used in the
+ * cost-weighted load balancing. Nodes without measurement are assigned zero
+ * cost.
+ * @param local_ids The ids of the nodes measured on this rank.
+ * @param local_costs The measured costs of the respective nodes.
+ * @note Collective operation, must be called on all ranks.
+ */
+void TopologyManager::AssignMeasuredCosts(
+    std::vector<nid_t> const &local_ids,
+    std::vector<double> const &local_costs) {
+  int const number_of_ranks = MpiUtilities::NumberOfRanks();
+  std::vector<nid_t> global_ids;
+  std::vector<double> global_costs;
+  MpiUtilities::LocalToGlobalData(local_ids, MPI_LONG_LONG_INT, number_of_ranks,
+                                  global_ids);
+  MpiUtilities::LocalToGlobalData(local_costs, MPI_DOUBLE, number_of_ranks,
+                                  global_costs);
+  for (auto &[id, node] : forest_) {
+    node.SetCost(0.0);
+  }
+  for (std::size_t i = 0; i < global_ids.size(); ++i) {
+    forest_.at(global_ids[i]).SetCost(global_costs[i]);
+  }
+}
+
 /**
  * @brief Marks the node with the given id for refinement.
  * @param id The id of the leaf that is to be refined.
@@ -253,6 +454,7 @@ void TopologyManager::CoarseNodeWithId(nid_t const parent_id) {
       [&forest = forest_](auto const child_id) { forest.erase(child_id); });
   forest_.at(parent_id).MakeLeaf();
   coarsenings_since_load_balance_++;
+  topology_update_count_++;
 }
 
 /**
@@ -280,6 +482,30 @@ TopologyManager::PrepareLoadBalancedTopology(int const number_of_ranks) {
   AssignTargetRankToParents();
   auto nodes_to_balance = NodesToBalance();
   SetCurrentRanksAccordingToTargetRanks();
+  UpdateNodeLists();
+  return nodes_to_balance;
+}
+
+/**
+ * @brief Gives a list which indicates which node should go from which mpi rank
+ * onto which mpi rank. In contrast to PrepareLoadBalancedTopology, the current
+ * distribution is only adjusted by moving leaves between neighboring ranks.
+ * @param number_of_ranks The number of ranks available to distribute the load
+ * onto.
+ * @param maximum_migrated_phases The maximum number of leaf phases that may be
+ * moved to another rank.
+ * @return A vector of all nodes and their current as well as their target mpi
+ * rank.
+ */
+std::vector<std::tuple<nid_t const, int const, int const>>
+TopologyManager::PrepareIncrementallyBalancedTopology(
+    int const number_of_ranks, std::size_t const maximum_migrated_phases) {
+  AssignTargetRanksToLeavesIncrementally(number_of_ranks,
+                                         maximum_migrated_phases);
+  AssignTargetRankToParents();
+  auto nodes_to_balance = NodesToBalance();
+  SetCurrentRanksAccordingToTargetRanks();
+  UpdateNodeLists();
   return nodes_to_balance;
 }
 
@@ -374,31 +600,140 @@ bool TopologyManager::NodeIsLeaf(nid_t const id) const {
  */
 bool TopologyManager::FaceIsJump(nid_t const id,
                                  BoundaryLocation const location) const {
+  TopologyNeighbor const neighbor = NeighborOfNode(id, location);
+  // If the neighbor does not exist and it is not an external BC we have a jump
+  return !neighbor.is_external_ && neighbor.level_difference_ != 0;
+}
 
-  if (IsExternalTopologyBoundary(location, id)) {
-    return false;
+/**
+ * @brief Determines if the specified node takes part in the flux correction at
+ * a resolution jump, i.e. whether one of its faces is a jump or separates it
+ * from a neighbor whose leaf status differs.
+ * @param id Unique id of the node under consideration.
+ * @return True if the node needs jump buffers, false otherwise.
+ */
+bool TopologyManager::NodeNeedsJumpBuffers(nid_t const id) const {
+  bool const is_leaf = NodeIsLeaf(id);
+  for (BoundaryLocation const location : CC::ANBS()) {
+    TopologyNeighbor const neighbor = NeighborOfNode(id, location);
+    if (neighbor.is_external_) {
+      continue;
+    }
+    // Jump from the fine side or leaf next to a parent ( coarse side )
+    if (neighbor.level_difference_ != 0 || neighbor.is_leaf_ != is_leaf) {
+      return true;
+    }
   }
+  return false;
+}
 
-  // If the neighbor does not exist and it is not an external BC we have a jump
-  return !NodeExists(GetTopologyNeighborId(id, location));
+/**
+ * @brief Rebuilds the node listings per level if the leaves or the rank
+ * assignment have changed since their last creation. A single pass over the
+ * forest fills all listings, which are then ordered along the space-filling
+ * curve, such that all ranks see the same order.
+ */
+void TopologyManager::UpdateNodeLists() const {
+  if (node_lists_update_count_ == topology_update_count_) {
+    return;
+  }
+  for (std::vector<nid_t> &ids : ids_on_level_) {
+    ids.clear();
+  }
+  for (auto const &id_node : forest_) {
+    nid_t const id = std::get<0>(id_node);
+    unsigned int const level = LevelOfNode(id);
+    // The listings cover the finest level present, which may exceed the
+    // maximum level the topology has been created with
+    if (level >= ids_on_level_.size()) {
+      ids_on_level_.resize(level + 1);
+    }
+    ids_on_level_[level].push_back(id);
+  }
+  local_ids_on_level_.resize(ids_on_level_.size());
+  leaf_ids_on_level_.resize(ids_on_level_.size());
+  local_leaf_ids_on_level_.resize(ids_on_level_.size());
+
+  // The ids are ordered by the curve indices cached in the nodes, the other
+  // listings are subsets and hence taken over in order
+  int const rank = MpiUtilities::MyRankId();
+  auto const cached_curve_index = [this](nid_t const id) {
+    return forest_.at(id).CurveIndex();
+  };
+  local_leaf_ids_.clear();
+  for (unsigned int level = 0; level < ids_on_level_.size(); ++level) {
+    OrderNodeIdsBySpaceFillingCurve(ids_on_level_[level], cached_curve_index);
+
+    local_ids_on_level_[level].clear();
+    leaf_ids_on_level_[level].clear();
+    local_leaf_ids_on_level_[level].clear();
+    for (nid_t const id : ids_on_level_[level]) {
+      TopologyNode const &node = forest_.at(id);
+      if (node.IsOnRank(rank)) {
+        local_ids_on_level_[level].push_back(id);
+      }
+      if (node.IsLeaf()) {
+        leaf_ids_on_level_[level].push_back(id);
+        if (node.IsOnRank(rank)) {
+          local_leaf_ids_on_level_[level].push_back(id);
+        }
+      }
+    }
+    local_leaf_ids_.insert(local_leaf_ids_.end(),
+                           local_leaf_ids_on_level_[level].cbegin(),
+                           local_leaf_ids_on_level_[level].cend());
+  }
+
+  neighbors_of_local_nodes_.clear();
+  for (std::vector<nid_t> const &local_ids : local_ids_on_level_) {
+    for (nid_t const id : local_ids) {
+      std::array<TopologyNeighbor, 26> &neighbors =
+          neighbors_of_local_nodes_[id];
+      for (BoundaryLocation const location : CC::HBS()) {
+        neighbors[LTI(location)] = FindNeighbor(id, location);
+      }
+    }
+  }
+  node_lists_update_count_ = topology_update_count_;
+}
+
+/**
+ * @brief Determines the neighbor of a node at the given location from the
+ * forest. At resolution jumps the parents of the missing neighbor are visited
+ * until an existing ( coarser ) node is found.
+ * @param id The id of the node whose neighbor is to be found.
+ * @param location Direction in which the neighbor is located.
+ * @return The neighbor information.
+ */
+TopologyNeighbor
+TopologyManager::FindNeighbor(nid_t const id,
+                              BoundaryLocation const location) const {
+  if (IsExternalTopologyBoundary(location, id)) {
+    return {id, -1, true, false, 0};
+  }
+  nid_t const neighbor_id = GetTopologyNeighborId(id, location);
+  nid_t existing_id = neighbor_id;
+  int level_difference = 0;
+  auto node = forest_.find(existing_id);
+  while (node == forest_.end() && LevelOfNode(existing_id) > 0) {
+    existing_id = ParentIdOfNode(existing_id);
+    level_difference--;
+    node = forest_.find(existing_id);
+  }
+  if (node == forest_.end()) {
+    return {neighbor_id, -1, false, false, level_difference};
+  }
+  return {neighbor_id, node->second.Rank(), false, node->second.IsLeaf(),
+          level_difference};
 }
 
 /**
  * @brief Gives a list of all leaves on this MPI rank
- * @return Local leaf ids.
+ * @return Local leaf ids, ordered by level and along the space-filling curve.
  */
-std::vector<nid_t> TopologyManager::LocalLeafIds() const {
-  std::vector<nid_t> local_leaves;
-  local_leaves.reserve((forest_.size() / MpiUtilities::NumberOfRanks()) +
-                       1); //+1 acts as integer-ceil.
-  ContainerOperations::transform_if(
-      std::cbegin(forest_), std::cend(forest_),
-      std::back_inserter(local_leaves),
-      [rank_id = MpiUtilities::MyRankId()](auto const &in) {
-        return std::get<1>(in).IsLeaf() && std::get<1>(in).IsOnRank(rank_id);
-      },
-      [](auto const &in) { return std::get<0>(in); });
-  return local_leaves;
+std::vector<nid_t> const &TopologyManager::LocalLeafIds() const {
+  UpdateNodeLists();
+  return local_leaf_ids_;
 }
 
 std::vector<nid_t> TopologyManager::LocalInterfaceLeafIds() const {
@@ -453,18 +788,10 @@ std::vector<nid_t> TopologyManager::LeafIds() const {
  * @param level The level of interest.
  * @return The list of leaf ids.
  */
-std::vector<nid_t>
+std::vector<nid_t> const &
 TopologyManager::LocalLeafIdsOnLevel(unsigned int const level) const {
-  std::vector<nid_t> local_leaves;
-  ContainerOperations::transform_if(
-      std::cbegin(forest_), std::cend(forest_),
-      std::back_inserter(local_leaves),
-      [level, rank = MpiUtilities::MyRankId()](auto const &id_node) {
-        auto const &[id, node] = id_node;
-        return LevelOfNode(id) == level && node.IsLeaf() && node.IsOnRank(rank);
-      },
-      [](auto const &in) { return std::get<0>(in); });
-  return local_leaves;
+  UpdateNodeLists();
+  return ListingOnLevel(local_leaf_ids_on_level_, level);
 }
 
 /**
@@ -472,19 +799,10 @@ TopologyManager::LocalLeafIdsOnLevel(unsigned int const level) const {
  * @param level The level of interest.
  * @return The list of leaf ids.
  */
-std::vector<nid_t>
+std::vector<nid_t> const &
 TopologyManager::LeafIdsOnLevel(unsigned int const level) const {
-  std::vector<nid_t> leaves;
-  leaves.reserve((forest_.size() / MpiUtilities::NumberOfRanks()) +
-                 1); //+1 acts as integer-ceil.
-  ContainerOperations::transform_if(
-      std::cbegin(forest_), std::cend(forest_), std::back_inserter(leaves),
-      [level](auto const &id_node) {
-        auto const &[id, node] = id_node;
-        return LevelOfNode(id) == level && node.IsLeaf();
-      },
-      [](auto const &in) { return std::get<0>(in); });
-  return leaves;
+  UpdateNodeLists();
+  return ListingOnLevel(leaf_ids_on_level_, level);
 }
 
 /**
@@ -493,16 +811,10 @@ TopologyManager::LeafIdsOnLevel(unsigned int const level) const {
  * @param level Level of interest.
  * @return Ids of Nodes on level.
  */
-std::vector<nid_t> TopologyManager::IdsOnLevel(unsigned int const level) const {
-  std::vector<nid_t> ids;
-  ids.reserve(forest_.size() /
-              ((maximum_level_ - level) +
-               2)); // The idea is that most ids are on the finest level
-  ContainerOperations::transform_if(
-      std::cbegin(forest_), std::cend(forest_), std::back_inserter(ids),
-      [level](auto const &in) { return LevelOfNode(std::get<0>(in)) == level; },
-      [](auto const &in) { return std::get<0>(in); });
-  return ids;
+std::vector<nid_t> const &
+TopologyManager::IdsOnLevel(unsigned int const level) const {
+  UpdateNodeLists();
+  return ListingOnLevel(ids_on_level_, level);
 }
 
 /**
@@ -511,24 +823,35 @@ std::vector<nid_t> TopologyManager::IdsOnLevel(unsigned int const level) const {
  * @param level Level of interest.
  * @return Ids of local Nodes on level.
  */
-std::vector<nid_t>
+std::vector<nid_t> const &
 TopologyManager::LocalIdsOnLevel(unsigned int const level) const {
-  std::vector<nid_t> ids;
-  ids.reserve((forest_.size() / MpiUtilities::NumberOfRanks()) +
-              1); //+1 acts as integer-ceil.
-  ContainerOperations::transform_if(
-      std::cbegin(forest_), std::cend(forest_), std::back_inserter(ids),
-      [level, rank = MpiUtilities::MyRankId()](auto const &id_node) {
-        auto const &[id, node] = id_node;
-        return LevelOfNode(id) == level && node.IsOnRank(rank);
-      },
-      [](auto const &in) { return std::get<0>(in); });
-  return ids;
+  UpdateNodeLists();
+  return ListingOnLevel(local_ids_on_level_, level);
+}
+
+/**
+ * @brief Gives the rank taking each segment of the space-filling curve. Ranks
+ * on the same compute node take adjacent segments, such that halos are mostly
+ * exchanged within the nodes.
+ * @param number_of_ranks The number of ranks available to distribute the load
+ * onto.
+ * @return The rank of each curve segment. The identity if the number of ranks
+ * differs from the simulation's, e.g. in tests.
+ */
+std::vector<int> TopologyManager::CurveRanks(int const number_of_ranks) const {
+  if (curve_ranks_.size() == std::size_t(number_of_ranks)) {
+    return curve_ranks_;
+  }
+  std::vector<int> ranks(number_of_ranks);
+  std::iota(std::begin(ranks), std::end(ranks), 0);
+  return ranks;
 }
 
 /**
  * @brief Assigns the target rank to leaves ( rank on which the leaf SHOULD
- * reside ) such that leaves are distributed among all ranks equally.
+ * reside ) such that leaves are distributed among all ranks equally. Siblings
+ * are kept on one rank ( and hence with their parent ), such that their
+ * remeshing decision needs no communication.
  * @param leaves The list of leaves that are to be assigned with a target rank.
  * @param number_of_ranks The number of ranks available to distribute the load
  * onto.
@@ -537,12 +860,65 @@ void TopologyManager::AssignTargetRanksToLeavesInList(
     std::vector<nid_t> const &leaves, int const number_of_ranks) {
   auto const elements_per_rank =
       ElementsPerRank(leaves.size(), number_of_ranks);
-  std::size_t start = 0;
-  for (int rank_id = 0; rank_id < number_of_ranks; ++rank_id) {
-    for (std::size_t i = start; i < start + elements_per_rank[rank_id]; ++i) {
-      forest_.at(leaves[i]).AssignTargetRank(rank_id);
+  std::vector<int> positions;
+  positions.reserve(leaves.size());
+  for (int position = 0; position < number_of_ranks; ++position) {
+    positions.insert(positions.end(), elements_per_rank[position], position);
+  }
+  positions = GroupAlignedRanks(positions, SiblingGroupKeys(leaves));
+  std::vector<int> const curve_ranks = CurveRanks(number_of_ranks);
+  for (std::size_t i = 0; i < leaves.size(); ++i) {
+    forest_.at(leaves[i]).AssignTargetRank(curve_ranks[positions[i]]);
+  }
+}
+
+/**
+ * @brief Gives the costs of the given leaves. Uses the measured costs where
+ * available and the static cost model otherwise.
+ * @param leaves The list of leaves whose costs are requested.
+ * @return The cost of each leaf in the order of the list.
+ */
+std::vector<double>
+TopologyManager::LeafCosts(std::vector<nid_t> const &leaves) const {
+  // Measured costs are preferred. Leaves without measurement ( e.g. created
+  // since ) get the static estimate, scaled to the measured costs
+  double measured_cost = 0.0;
+  double static_cost_of_measured = 0.0;
+  for (nid_t const id : leaves) {
+    TopologyNode const &node = forest_.at(id);
+    if (node.Cost() > 0.0) {
+      measured_cost += node.Cost();
+      static_cost_of_measured += StaticLeafCost(node);
     }
-    start += elements_per_rank[rank_id];
+  }
+  double const scale = static_cost_of_measured > 0.0
+                           ? measured_cost / static_cost_of_measured
+                           : 1.0;
+  std::vector<double> costs(leaves.size());
+  std::transform(std::cbegin(leaves), std::cend(leaves), std::begin(costs),
+                 [&forest = forest_, scale](nid_t const node_id) {
+                   TopologyNode const &node = forest.at(node_id);
+                   return node.Cost() > 0.0 ? node.Cost()
+                                            : scale * StaticLeafCost(node);
+                 });
+  return costs;
+}
+
+/**
+ * @brief Assigns target ranks to the leaves in the given list such that all
+ * ranks receive a similar accumulated cost. Siblings are kept on one rank.
+ * @param leaves The list of leaves ordered along the space-filling curve.
+ * @param number_of_ranks The number of ranks available to distribute the load
+ * onto.
+ */
+void TopologyManager::AssignTargetRanksToLeavesByCost(
+    std::vector<nid_t> const &leaves, int const number_of_ranks) {
+  std::vector<int> const positions =
+      GroupAlignedRanks(CostWeightedRanks(LeafCosts(leaves), number_of_ranks),
+                        SiblingGroupKeys(leaves));
+  std::vector<int> const curve_ranks = CurveRanks(number_of_ranks);
+  for (std::size_t i = 0; i < leaves.size(); ++i) {
+    forest_.at(leaves[i]).AssignTargetRank(curve_ranks[positions[i]]);
   }
 }
 
@@ -554,21 +930,111 @@ void TopologyManager::AssignTargetRanksToLeavesInList(
  */
 void TopologyManager::AssignTargetRankToLeaves(int const number_of_ranks) {
 
+  // The leaf listings are already ordered along the curve ( see
+  // UpdateNodeLists() )
   for (unsigned int level = 0; level <= maximum_level_; ++level) {
     std::vector<nid_t> leaves = LeafIdsOnLevel(level);
-    // On maximum levels all multies are levelset nodes on coarser levels no
-    // levelset exists
-    auto start_multi =
-        std::partition(std::begin(leaves), std::end(leaves),
-                       [&forest = forest_](nid_t const node_id) {
-                         return !IsMultiPhase(forest.at(node_id));
-                       });
-    std::vector<nid_t> multiphase_leaves(start_multi, std::end(leaves));
-    leaves.erase(start_multi, std::end(leaves));
-    OrderNodeIdsBySpaceFillingCurve(leaves);
-    OrderNodeIdsBySpaceFillingCurve(multiphase_leaves);
-    AssignTargetRanksToLeavesInList(leaves, number_of_ranks);
-    AssignTargetRanksToLeavesInList(multiphase_leaves, number_of_ranks);
+    if constexpr (CC::CostWeightedLoadBalancing()) {
+      // Levels are still balanced separately as they are integrated at
+      // different frequencies
+      AssignTargetRanksToLeavesByCost(leaves, number_of_ranks);
+    } else {
+      // On maximum levels all multies are levelset nodes on coarser levels no
+      // levelset exists. The stable partition keeps the curve order.
+      auto start_multi =
+          std::stable_partition(std::begin(leaves), std::end(leaves),
+                                [&forest = forest_](nid_t const node_id) {
+                                  return !IsMultiPhase(forest.at(node_id));
+                                });
+      std::vector<nid_t> multiphase_leaves(start_multi, std::end(leaves));
+      leaves.erase(start_multi, std::end(leaves));
+      AssignTargetRanksToLeavesInList(leaves, number_of_ranks);
+      AssignTargetRanksToLeavesInList(multiphase_leaves, number_of_ranks);
+    }
+  }
+}
+
+/**
+ * @brief Assigns the target rank to all leaf nodes by diffusing load between
+ * neighboring ranks along the space-filling curve of each level, starting
+ * from the current distribution. The realized fraction of the diffusive flows
+ * is chosen such that at most the given number of phases is migrated.
+ * Siblings are kept on one rank.
+ * @param number_of_ranks The number of ranks available to distribute the load
+ * onto.
+ * @param maximum_migrated_phases The maximum number of leaf phases that may
+ * change their rank.
+ */
+void TopologyManager::AssignTargetRanksToLeavesIncrementally(
+    int const number_of_ranks, std::size_t const maximum_migrated_phases) {
+  // The diffusion works on the positions of the ranks along the curve
+  std::vector<int> const curve_ranks = CurveRanks(number_of_ranks);
+  std::vector<int> position_of_rank(number_of_ranks);
+  for (int position = 0; position < number_of_ranks; ++position) {
+    position_of_rank[curve_ranks[position]] = position;
+  }
+  std::vector<std::vector<nid_t>> leaves_on_level(maximum_level_ + 1);
+  std::vector<std::vector<double>> costs_on_level(maximum_level_ + 1);
+  std::vector<std::vector<int>> ranks_on_level(maximum_level_ + 1);
+  std::vector<std::vector<nid_t>> keys_on_level(maximum_level_ + 1);
+  for (unsigned int level = 0; level <= maximum_level_; ++level) {
+    // Already ordered along the curve ( see UpdateNodeLists() )
+    leaves_on_level[level] = LeafIdsOnLevel(level);
+    costs_on_level[level] = LeafCosts(leaves_on_level[level]);
+    keys_on_level[level] = SiblingGroupKeys(leaves_on_level[level]);
+    for (nid_t const id : leaves_on_level[level]) {
+      ranks_on_level[level].push_back(position_of_rank[forest_.at(id).Rank()]);
+    }
+  }
+
+  auto const targets_for = [&](double const flow_fraction) {
+    std::vector<std::vector<int>> targets(maximum_level_ + 1);
+    for (unsigned int level = 0; level <= maximum_level_; ++level) {
+      targets[level] = GroupAlignedRanks(
+          DiffusiveRanks(ranks_on_level[level], costs_on_level[level],
+                         number_of_ranks, flow_fraction),
+          keys_on_level[level]);
+    }
+    return targets;
+  };
+  auto const migrated_phases =
+      [&](std::vector<std::vector<int>> const &targets) {
+        std::size_t phases = 0;
+        for (unsigned int level = 0; level <= maximum_level_; ++level) {
+          for (std::size_t i = 0; i < targets[level].size(); ++i) {
+            if (targets[level][i] != ranks_on_level[level][i]) {
+              phases +=
+                  forest_.at(leaves_on_level[level][i]).NumberOfMaterials();
+            }
+          }
+        }
+        return phases;
+      };
+
+  std::vector<std::vector<int>> targets = targets_for(1.0);
+  if (migrated_phases(targets) > maximum_migrated_phases) {
+    // The migration grows with the flow fraction, bisection gives the largest
+    // fraction within the limit
+    targets = ranks_on_level;
+    double lower_fraction = 0.0;
+    double upper_fraction = 1.0;
+    for (unsigned int i = 0; i < 16; ++i) {
+      double const fraction = 0.5 * (lower_fraction + upper_fraction);
+      std::vector<std::vector<int>> trial_targets = targets_for(fraction);
+      if (migrated_phases(trial_targets) > maximum_migrated_phases) {
+        upper_fraction = fraction;
+      } else {
+        lower_fraction = fraction;
+        targets = std::move(trial_targets);
+      }
+    }
+  }
+
+  for (unsigned int level = 0; level <= maximum_level_; ++level) {
+    for (std::size_t i = 0; i < leaves_on_level[level].size(); ++i) {
+      forest_.at(leaves_on_level[level][i])
+          .AssignTargetRank(curve_ranks[targets[level][i]]);
+    }
   }
 }
 
@@ -604,6 +1070,7 @@ void TopologyManager::SetCurrentRanksAccordingToTargetRanks() {
   std::for_each(std::begin(forest_), std::end(forest_), [](auto &in) {
     std::get<1>(in).SetCurrentRankAccordingToTargetRank();
   });
+  topology_update_count_++;
 }
 
 /**
@@ -667,6 +1134,23 @@ std::string TopologyManager::LeafRankDistribution(int const number_of_ranks) {
   return leaf_rank_distribution;
 }
 
+/**
+ * @brief Gives the accumulated cost of the leaves on each rank. Leaves without
+ * measured cost are estimated statically, see LeafCosts.
+ * @param number_of_ranks The number of ranks the leaves are distributed onto.
+ * @return The cost per rank.
+ */
+std::vector<double>
+TopologyManager::LeafCostsPerRank(int const number_of_ranks) const {
+  std::vector<nid_t> const leaves = LeafIds();
+  std::vector<double> const costs = LeafCosts(leaves);
+  std::vector<double> costs_per_rank(number_of_ranks, 0.0);
+  for (std::size_t i = 0; i < leaves.size(); ++i) {
+    costs_per_rank[GetRankOfNode(leaves[i])] += costs[i];
+  }
+  return costs_per_rank;
+}
+
 /**
  * @brief Gives whether the node with the given id is a multi-phase node, i.e.
  * contains more than one material.
@@ -708,8 +1192,9 @@ void TopologyManager::RemoveMaterialFromNode(nid_t const id,
  * node.
  * @param id Id of the node in question.
  * @return Vector of the materials in the node.
+ * @note The reference is invalidated by changes of the node in the topology.
  */
-std::vector<MaterialName>
+std::vector<MaterialName> const &
 TopologyManager::GetMaterialsOfNode(nid_t const id) const {
   return forest_.at(id).Materials();
 }
@@ -731,22 +1216,27 @@ MaterialName TopologyManager::SingleMaterialOfNode(nid_t const id) const {
  */
 bool TopologyManager::NodeContainsMaterial(nid_t const node_id,
                                            MaterialName const material) const {
-  auto materials = GetMaterialsOfNode(node_id);
+  std::vector<MaterialName> const &materials = GetMaterialsOfNode(node_id);
   auto block_iterator = std::find(materials.begin(), materials.end(), material);
   return block_iterator == materials.end() ? false : true;
 }
 
 /**
  * @brief Indicates - based on the number of mesh changes since last load
- * balancing - whether or not load balancing should be executed.
+ * balancing or on the measured load imbalance - whether or not load balancing
+ * should be executed.
  * @return Indicator for load balancing.
  */
 bool TopologyManager::IsLoadBalancingNecessary() {
-  // Check whether load balancing is required based on CC chosen value
+  // Check whether load balancing is required based on CC chosen value or the
+  // imbalance threshold ( identical on all ranks as the imbalance is reduced )
   if (coarsenings_since_load_balance_ >= CC::TCULB() ||
-      refinements_since_load_balance_ >= CC::TCULB()) {
+      refinements_since_load_balance_ >= CC::TCULB() ||
+      (load_imbalance_threshold_ > 0.0 &&
+       load_imbalance_ > load_imbalance_threshold_)) {
     coarsenings_since_load_balance_ = 0;
     refinements_since_load_balance_ = 0;
+    load_imbalance_ = 1.0;
     return true;
   } else {
     return false;
@@ -754,16 +1244,16 @@ bool TopologyManager::IsLoadBalancingNecessary() {
 }
 
 /**
- * @brief Gives the number of global nodes and leaves in a std::pair
+ * @brief Gives the number of global nodes and leaves in a std::pair. The counts
+ * are looked up from the rank counts, i.e. only counted once per topology
+ * update.
  * @return std::pair<#Nodes, #Leaves>
  */
 std::pair<unsigned int, unsigned int>
 TopologyManager::NodeAndLeafCount() const {
-  unsigned int const node_count = forest_.size();
-  unsigned int const leaf_count =
-      std::count_if(std::cbegin(forest_), std::cend(forest_),
-                    [](auto const &in) { return std::get<1>(in).IsLeaf(); });
-  return {node_count, leaf_count};
+  int const number_of_ranks = MpiUtilities::NumberOfRanks();
+  RankCounts const &totals = OffsetsOfRank(number_of_ranks, number_of_ranks);
+  return {totals.nodes_, totals.leaves_};
 }
 
 /**
@@ -777,6 +1267,62 @@ unsigned int TopologyManager::InterfaceLeafCount() const {
       });
 }
 
+/**
+ * @brief Rebuilds the node, leaf, block, interface leaf and multi-phase node
+ * counts of all ranks and their prefix sums if the topology, the materials or
+ * the number of ranks have changed since their last creation. Thus, the
+ * rank-wise counters and offsets are lookups in between topology updates.
+ * @param number_of_ranks The number of ranks present in the tree.
+ */
+void TopologyManager::UpdateRankCounts(int const number_of_ranks) const {
+  if (counts_per_rank_.size() == std::size_t(number_of_ranks) &&
+      rank_counts_topology_update_count_ == topology_update_count_ &&
+      rank_counts_material_update_count_ == material_update_count_) {
+    return;
+  }
+  counts_per_rank_.assign(number_of_ranks, RankCounts());
+  for (auto const &[id, node] : forest_) {
+    RankCounts &counts = counts_per_rank_.at(node.Rank());
+    counts.nodes_++;
+    counts.blocks_ += node.NumberOfMaterials();
+    if (IsMultiPhase(node)) {
+      counts.multi_phase_nodes_++;
+    }
+    if (node.IsLeaf()) {
+      counts.leaves_++;
+      if (IsMultiPhase(node)) {
+        counts.interface_leaves_++;
+      }
+    }
+  }
+  offsets_of_rank_.assign(number_of_ranks + 1, RankCounts());
+  for (int rank = 0; rank < number_of_ranks; ++rank) {
+    RankCounts const &counts = counts_per_rank_[rank];
+    RankCounts const &offsets = offsets_of_rank_[rank];
+    offsets_of_rank_[rank + 1] = {
+        offsets.nodes_ + counts.nodes_, offsets.leaves_ + counts.leaves_,
+        offsets.blocks_ + counts.blocks_,
+        offsets.interface_leaves_ + counts.interface_leaves_,
+        offsets.multi_phase_nodes_ + counts.multi_phase_nodes_};
+  }
+  rank_counts_topology_update_count_ = topology_update_count_;
+  rank_counts_material_update_count_ = material_update_count_;
+}
+
+/**
+ * @brief Gives the counts accumulated over all lower ( by rank id ) ranks.
+ * @param rank The rank for which the offsets are to be obtained. Ranks beyond
+ * the number of ranks give the total counts.
+ * @param number_of_ranks The number of ranks present in the tree.
+ * @return The offsets.
+ */
+TopologyManager::RankCounts const &
+TopologyManager::OffsetsOfRank(int const rank,
+                               int const number_of_ranks) const {
+  UpdateRankCounts(number_of_ranks);
+  return offsets_of_rank_[std::min(rank, number_of_ranks)];
+}
+
 /**
  * @brief Gives a list of pairs. An entry at index i corresponds to the MPI
  * rank_id i. It lists the node and leaf count on this rank
@@ -785,14 +1331,11 @@ unsigned int TopologyManager::InterfaceLeafCount() const {
  */
 std::vector<std::pair<unsigned int, unsigned int>>
 TopologyManager::NodesAndLeavesPerRank(int const number_of_ranks) const {
-  std::vector<std::pair<unsigned int, unsigned int>> nodes_and_leaves_per_rank(
-      number_of_ranks, {0, 0});
-  for (auto const &[id, node] : forest_) {
-    auto &[node_count, leaf_count] = nodes_and_leaves_per_rank.at(node.Rank());
-    node_count++;
-    if (node.IsLeaf()) {
-      leaf_count++;
-    }
+  UpdateRankCounts(number_of_ranks);
+  std::vector<std::pair<unsigned int, unsigned int>> nodes_and_leaves_per_rank;
+  nodes_and_leaves_per_rank.reserve(number_of_ranks);
+  for (RankCounts const &counts : counts_per_rank_) {
+    nodes_and_leaves_per_rank.emplace_back(counts.nodes_, counts.leaves_);
   }
   return nodes_and_leaves_per_rank;
 }
@@ -804,11 +1347,11 @@ TopologyManager::NodesAndLeavesPerRank(int const number_of_ranks) const {
  */
 std::vector<unsigned int>
 TopologyManager::InterfaceLeavesPerRank(int const number_of_ranks) const {
-  std::vector<unsigned int> interface_leaves_per_rank(number_of_ranks, 0);
-  for (auto const &[id, node] : forest_) {
-    if (node.IsLeaf() && IsMultiPhase(node)) {
-      interface_leaves_per_rank.at(node.Rank()) += 1;
-    }
+  UpdateRankCounts(number_of_ranks);
+  std::vector<unsigned int> interface_leaves_per_rank;
+  interface_leaves_per_rank.reserve(number_of_ranks);
+  for (RankCounts const &counts : counts_per_rank_) {
+    interface_leaves_per_rank.push_back(counts.interface_leaves_);
   }
   return interface_leaves_per_rank;
 }
@@ -837,25 +1380,23 @@ TopologyManager::NodeAndBlockCount() const {
  */
 std::vector<std::pair<unsigned int, unsigned int>>
 TopologyManager::NodesAndBlocksPerRank(int const number_of_ranks) const {
-  std::vector<std::pair<unsigned int, unsigned int>> nodes_and_blocks_per_rank(
-      number_of_ranks, {0, 0});
-  for (auto const &[id, node] : forest_) {
-    auto &[node_count, block_count] = nodes_and_blocks_per_rank.at(node.Rank());
-    node_count++;
-    block_count += node.NumberOfMaterials();
+  UpdateRankCounts(number_of_ranks);
+  std::vector<std::pair<unsigned int, unsigned int>> nodes_and_blocks_per_rank;
+  nodes_and_blocks_per_rank.reserve(number_of_ranks);
+  for (RankCounts const &counts : counts_per_rank_) {
+    nodes_and_blocks_per_rank.emplace_back(counts.nodes_, counts.blocks_);
   }
   return nodes_and_blocks_per_rank;
 }
 
 /**
  * @brief Gives the global count of nodes holding more than one phase in the
- * topology.
+ * topology. The count is looked up from the rank counts.
  * @return Number of Multiphase nodes
  */
 unsigned int TopologyManager::MultiPhaseNodeCount() const {
-  return std::count_if(
-      std::cbegin(forest_), std::cend(forest_),
-      [](auto const &in) { return IsMultiPhase(std::get<1>(in)); });
+  int const number_of_ranks = MpiUtilities::NumberOfRanks();
+  return OffsetsOfRank(number_of_ranks, number_of_ranks).multi_phase_nodes_;
 }
 
 /**
@@ -884,8 +1425,10 @@ TopologyManager::RestoreTopology(std::vector<nid_t> ids,
         std::cbegin(materials) + material_counter,
         std::cbegin(materials) + material_counter + number_of_phases.at(i));
     material_counter += number_of_phases.at(i);
-    forest_.emplace(std::piecewise_construct, std::forward_as_tuple(ids.at(i)),
-                    std::forward_as_tuple(materials_in_node, initial_rank));
+    forest_
+        .emplace(std::piecewise_construct, std::forward_as_tuple(ids.at(i)),
+                 std::forward_as_tuple(materials_in_node, initial_rank))
+        .first->second.SetCurveIndex(sfc_index_(ids.at(i)));
   }
 
   for (auto &[id, node] : forest_) {
@@ -894,6 +1437,7 @@ TopologyManager::RestoreTopology(std::vector<nid_t> ids,
       node.MakeParent();
     }
   }
+  topology_update_count_++;
 
   PrepareLoadBalancedTopology(MpiUtilities::NumberOfRanks());
 
@@ -909,13 +1453,16 @@ TopologyManager::RestoreTopology(std::vector<nid_t> ids,
       [my_rank](auto const &in) { return std::get<1>(in).Rank() == my_rank; },
       [](auto const &in) { return std::get<0>(in); });
 
+  // position of all ids in the input list, avoids a linear search per node
+  std::unordered_map<nid_t, unsigned int> index_of_id;
+  index_of_id.reserve(ids.size());
+  for (unsigned int i = 0; i < ids.size(); ++i) {
+    index_of_id.emplace(ids[i], i);
+  }
   std::vector<unsigned int> indices_of_local_nodes(local_indices.size());
   std::transform(std::cbegin(local_indices), std::cend(local_indices),
-                 std::begin(indices_of_local_nodes), [&ids](auto const id) {
-                   return std::distance(
-                       std::cbegin(ids),
-                       std::find(std::cbegin(ids), std::cend(ids), id));
-                 });
+                 std::begin(indices_of_local_nodes),
+                 [&index_of_id](auto const id) { return index_of_id.at(id); });
   return indices_of_local_nodes;
 }
 
@@ -977,7 +1524,8 @@ TopologyManager::GetNeighboringLeaves(nid_t const node_id,
           id_list.push_back(open_id);
         } else {
           // open_id has children -> get the relevant ones
-          std::vector<nid_t> const open_children_ids = IdsOfChildren(open_id);
+          std::array<nid_t, CC::NOC()> const open_children_ids =
+              IdsOfChildren(open_id);
           for (nid_t open_children_id : open_children_ids) {
             if (sibling_function(open_children_id)) {
               open_neighbor_ids.push_back(open_children_id);
@@ -1011,16 +1559,7 @@ TopologyManager::GetNeighboringLeaves(nid_t const node_id,
 unsigned long long int
 TopologyManager::LeafOffsetOfRank(int const rank,
                                   int const number_of_ranks) const {
-  std::vector<std::pair<unsigned int, unsigned int>> &&rank_node_map =
-      NodesAndLeavesPerRank(number_of_ranks);
-  auto const final_iterator = rank_node_map.size() > std::size_t(rank)
-                                  ? std::cbegin(rank_node_map) + rank
-                                  : std::cend(rank_node_map);
-  return std::accumulate(std::cbegin(rank_node_map), final_iterator, 0ll,
-                         [](unsigned int const &a,
-                            std::pair<unsigned int, unsigned int> const &b) {
-                           return a + b.second;
-                         });
+  return OffsetsOfRank(rank, number_of_ranks).leaves_;
 }
 
 /**
@@ -1033,12 +1572,7 @@ TopologyManager::LeafOffsetOfRank(int const rank,
 unsigned long long int
 TopologyManager::InterfaceLeafOffsetOfRank(int const rank,
                                            int const number_of_ranks) const {
-  std::vector<unsigned int> rank_node_map =
-      InterfaceLeavesPerRank(number_of_ranks);
-  auto const final_iterator = rank_node_map.size() > std::size_t(rank)
-                                  ? std::cbegin(rank_node_map) + rank
-                                  : std::cend(rank_node_map);
-  return std::accumulate(std::cbegin(rank_node_map), final_iterator, 0ll);
+  return OffsetsOfRank(rank, number_of_ranks).interface_leaves_;
 }
 
 /**
@@ -1051,16 +1585,7 @@ TopologyManager::InterfaceLeafOffsetOfRank(int const rank,
 unsigned long long int
 TopologyManager::NodeOffsetOfRank(int const rank,
                                   int const number_of_ranks) const {
-  std::vector<std::pair<unsigned int, unsigned int>> const rank_node_map =
-      NodesAndLeavesPerRank(number_of_ranks);
-  auto const final_iterator = rank_node_map.size() > std::size_t(rank)
-                                  ? std::cbegin(rank_node_map) + rank
-                                  : std::cend(rank_node_map);
-  return std::accumulate(std::cbegin(rank_node_map), final_iterator, 0ll,
-                         [](unsigned long long int const sum,
-                            std::pair<unsigned int, unsigned int> const &b) {
-                           return sum + b.first;
-                         });
+  return OffsetsOfRank(rank, number_of_ranks).nodes_;
 }
 
 /**
@@ -1073,22 +1598,8 @@ TopologyManager::NodeOffsetOfRank(int const rank,
 std::pair<unsigned long long int, unsigned long long int>
 TopologyManager::NodeAndBlockOffsetOfRank(int const rank,
                                           int const number_of_ranks) const {
-  std::vector<std::pair<unsigned int, unsigned int>> const rank_node_block_map =
-      NodesAndBlocksPerRank(number_of_ranks);
-  auto const final_iterator = rank_node_block_map.size() > std::size_t(rank)
-                                  ? rank_node_block_map.cbegin() + rank
-                                  : rank_node_block_map.cend();
-  return std::make_pair(
-      std::accumulate(rank_node_block_map.cbegin(), final_iterator, 0u,
-                      [](unsigned int const &a,
-                         std::pair<unsigned int, unsigned int> const &b) {
-                        return a + b.first;
-                      }),
-      std::accumulate(rank_node_block_map.cbegin(), final_iterator, 0u,
-                      [](unsigned int const &a,
-                         std::pair<unsigned int, unsigned int> const &b) {
-                        return a + b.second;
-                      }));
+  RankCounts const &offsets = OffsetsOfRank(rank, number_of_ranks);
+  return std::make_pair(offsets.nodes_, offsets.blocks_);
 }
 
 /**
@@ -1121,6 +1632,25 @@ TopologyManager::GetNumberOfNodesOnLevelZero() const {
   return number_of_nodes_on_level_zero_;
 }
 
+/**
+ * @brief Gives the neighbor of a node at the provided direction. The neighbors
+ * of local nodes are looked up in a table that is rebuilt once per topology
+ * update, the ones of remote nodes are determined from the forest.
+ * @param id The id of the node whose neighbor is to be found.
+ * @param location Direction in which the neighbor is located.
+ * @return The neighbor information.
+ */
+TopologyNeighbor
+TopologyManager::NeighborOfNode(nid_t const id,
+                                BoundaryLocation const location) const {
+  UpdateNodeLists();
+  if (auto const neighbors = neighbors_of_local_nodes_.find(id);
+      neighbors != neighbors_of_local_nodes_.end()) {
+    return neighbors->second[LTI(location)];
+  }
+  return FindNeighbor(id, location);
+}
+
 /**
  * @brief Gives the id of a neighbor at the provided direction.
  * @param id The id of the node whose neighbor is to be found.
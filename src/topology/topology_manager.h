@@ -26,10 +26,29 @@
 #include "topology/id_periodic_information.h"
 #include "topology_node.h"
 #include "user_specifications/compile_time_constants.h"
+#include "user_specifications/space_filling_curve_settings.h"
+#include <array>
 #include <mpi.h>
 #include <unordered_map>
 #include <vector>
 
+/**
+ * @brief The TopologyNeighbor struct describes the neighbor of a node at a
+ * location ( including edges and corners ) as seen from the topology.
+ */
+struct TopologyNeighbor {
+  // Id of the neighbor on the same level, regardless whether it exists
+  nid_t id_;
+  // Rank of the closest existing neighbor, -1 at external boundaries
+  int rank_;
+  bool is_external_;
+  // Leaf status of the closest existing neighbor
+  bool is_leaf_;
+  // Level of the closest existing neighbor relative to the node, i.e. zero if
+  // the neighbor on the same level exists and negative at resolution jumps
+  int level_difference_;
+};
+
 /**
  * @brief The TopologyManager class handles all aspects relevant for MPI (
  * distributed Memory ) parallelization. I.e. overview of data-to-rank maps,
@@ -44,6 +63,14 @@ class TopologyManager {
 
   unsigned int const maximum_level_;
   unsigned int const active_periodic_locations_;
+  // max/mean ratio of the rank costs triggering a load balancing, zero if
+  // inactive
+  double const load_imbalance_threshold_;
+  // index function of the curve the leaves are distributed along
+  SfcIndexFunction const sfc_index_;
+  // ranks in the order they take the segments of the space-filling curve,
+  // grouped by compute node
+  std::vector<int> const curve_ranks_;
   std::array<unsigned int, 3> const number_of_nodes_on_level_zero_;
 
   std::vector<nid_t> local_refine_list_;
@@ -63,22 +90,73 @@ class TopologyManager {
 
   unsigned int coarsenings_since_load_balance_;
   unsigned int refinements_since_load_balance_;
+  // Counts the (global) updates in which materials were added or removed
+  unsigned int material_update_count_;
+  // Counts the (global) changes of the leaves or of their rank assignment
+  unsigned int topology_update_count_;
+  // max/mean ratio of the measured rank costs since the last load balancing
+  double load_imbalance_;
+
+  // Node listings per level ordered along the space-filling curve. They only
+  // change with the leaves or the rank assignment and are rebuilt once the
+  // topology update count has changed
+  mutable std::vector<std::vector<nid_t>> ids_on_level_;
+  mutable std::vector<std::vector<nid_t>> local_ids_on_level_;
+  mutable std::vector<std::vector<nid_t>> leaf_ids_on_level_;
+  mutable std::vector<std::vector<nid_t>> local_leaf_ids_on_level_;
+  mutable std::vector<nid_t> local_leaf_ids_;
+  mutable unsigned int node_lists_update_count_;
+  // Neighbors of the local nodes indexed by LTI of the location, rebuilt
+  // together with the node listings
+  mutable std::unordered_map<nid_t, std::array<TopologyNeighbor, 26>>
+      neighbors_of_local_nodes_;
+
+  // Node, leaf, block, interface leaf and multi-phase node counts of a rank
+  struct RankCounts {
+    unsigned long long int nodes_ = 0;
+    unsigned long long int leaves_ = 0;
+    unsigned long long int blocks_ = 0;
+    unsigned long long int interface_leaves_ = 0;
+    unsigned long long int multi_phase_nodes_ = 0;
+  };
+  // Counts per rank and their exclusive prefix sums ( one entry more than
+  // ranks ). Rebuilt once the topology or material update count or the number
+  // of ranks has changed
+  mutable std::vector<RankCounts> counts_per_rank_;
+  mutable std::vector<RankCounts> offsets_of_rank_;
+  mutable unsigned int rank_counts_topology_update_count_;
+  mutable unsigned int rank_counts_material_update_count_;
+
+  void UpdateNodeLists() const;
+  TopologyNeighbor FindNeighbor(nid_t const id,
+                                BoundaryLocation const location) const;
+  void UpdateRankCounts(int const number_of_ranks) const;
+  RankCounts const &OffsetsOfRank(int const rank,
+                                  int const number_of_ranks) const;
 
   void SetCurrentRanksAccordingToTargetRanks();
   std::vector<std::tuple<nid_t const, int const, int const>> NodesToBalance();
 
+  std::vector<int> CurveRanks(int const number_of_ranks) const;
   void AssignTargetRanksToLeavesInList(std::vector<nid_t> const &leaves,
                                        int const number_of_ranks);
+  std::vector<double> LeafCosts(std::vector<nid_t> const &leaves) const;
+  void AssignTargetRanksToLeavesByCost(std::vector<nid_t> const &leaves,
+                                       int const number_of_ranks);
   void AssignTargetRankToLeaves(int const number_of_ranks);
+  void AssignTargetRanksToLeavesIncrementally(
+      int const number_of_ranks, std::size_t const maximum_migrated_phases);
 
   void AssignTargetRankToParents();
 
 public:
-  explicit TopologyManager(std::array<unsigned int, 3> level_zero_blocks = {1,
-                                                                            1,
-                                                                            1},
-                           unsigned int const maximum_level = 0,
-                           unsigned int active_periodic_locations = 0);
+  explicit TopologyManager(
+      std::array<unsigned int, 3> level_zero_blocks = {1, 1, 1},
+      unsigned int const maximum_level = 0,
+      unsigned int active_periodic_locations = 0,
+      double const load_imbalance_threshold = 0.0,
+      SpaceFillingCurve const space_filling_curve =
+          SpaceFillingCurveSettings::DefaultSpaceFillingCurve);
   ~TopologyManager() = default;
   TopologyManager(TopologyManager const &) = delete;
   TopologyManager &operator=(TopologyManager const &) = delete;
@@ -121,15 +199,18 @@ public:
 
   bool NodeContainsMaterial(nid_t const node_id,
                             MaterialName const material) const;
-  std::vector<MaterialName> GetMaterialsOfNode(nid_t const id) const;
+  std::vector<MaterialName> const &GetMaterialsOfNode(nid_t const id) const;
   MaterialName SingleMaterialOfNode(nid_t const id) const;
 
   // Topological questions:
   bool FaceIsJump(nid_t const id, BoundaryLocation const location) const;
+  bool NodeNeedsJumpBuffers(nid_t const id) const;
   bool IsExternalTopologyBoundary(BoundaryLocation const location,
                                   nid_t const id) const;
   std::vector<nid_t>
   GetNeighboringLeaves(nid_t const id, BoundaryLocation const location) const;
+  TopologyNeighbor NeighborOfNode(nid_t const id,
+                                  BoundaryLocation const location) const;
   nid_t GetTopologyNeighborId(nid_t const id,
                               BoundaryLocation const location) const;
 
@@ -138,17 +219,23 @@ public:
   std::array<unsigned int, 3> GetNumberOfNodesOnLevelZero() const;
   unsigned int GetCurrentMaximumLevel() const;
   bool IsLoadBalancingNecessary();
+  unsigned int MaterialUpdateCount() const;
+  unsigned int TopologyUpdateCount() const;
+  SfcIndexFunction CurveIndexFunction() const;
+  double LoadImbalance() const;
+  std::vector<double> LeafCostsPerRank(int const number_of_ranks) const;
+  std::size_t ForestBytes() const;
 
   // Node listings:
-  std::vector<nid_t> LocalLeafIds() const;
+  std::vector<nid_t> const &LocalLeafIds() const;
   std::vector<nid_t> LocalInterfaceLeafIds() const;
   std::vector<nid_t> LeafIds() const;
-  std::vector<nid_t> LocalLeafIdsOnLevel(unsigned int const level) const;
-  std::vector<nid_t> LeafIdsOnLevel(unsigned int const level) const;
+  std::vector<nid_t> const &LocalLeafIdsOnLevel(unsigned int const level) const;
+  std::vector<nid_t> const &LeafIdsOnLevel(unsigned int const level) const;
   std::vector<nid_t> DescendantIdsOfNode(nid_t const id) const;
   std::vector<nid_t> LocalIds() const;
-  std::vector<nid_t> IdsOnLevel(unsigned int const level) const;
-  std::vector<nid_t> LocalIdsOnLevel(unsigned int const level) const;
+  std::vector<nid_t> const &IdsOnLevel(unsigned int const level) const;
+  std::vector<nid_t> const &LocalIdsOnLevel(unsigned int const level) const;
 
   // Node and/or topology altering:
   void RefineNodeWithId(nid_t const id);
@@ -157,8 +244,14 @@ public:
   void RemoveMaterialFromNode(nid_t const id, MaterialName const material);
 
   bool UpdateTopology();
+  void UpdateLoadImbalance(double const local_cost);
+  void AssignMeasuredCosts(std::vector<nid_t> const &local_ids,
+                           std::vector<double> const &local_costs);
   std::vector<std::tuple<nid_t const, int const, int const>>
   PrepareLoadBalancedTopology(int const number_of_ranks);
+  std::vector<std::tuple<nid_t const, int const, int const>>
+  PrepareIncrementallyBalancedTopology(
+      int const number_of_ranks, std::size_t const maximum_migrated_phases);
   std::vector<unsigned int>
   RestoreTopology(std::vector<nid_t> ids,
                   std::vector<unsigned short> number_of_phases,
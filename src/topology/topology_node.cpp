@@ -35,7 +35,7 @@ namespace TNC = TopologyNodeConstants;
  */
 TopologyNode::TopologyNode(int const rank)
     : current_rank_(rank), target_rank_(TNC::unassigned_rank), is_leaf_(true),
-      materials_() {}
+      materials_(), cost_(0.0), curve_index_(0) {}
 
 /**
  * @brief Constructs a topology node as leaf with the given materials, but
@@ -46,7 +46,8 @@ TopologyNode::TopologyNode(int const rank)
 TopologyNode::TopologyNode(std::vector<MaterialName> const &materials,
                            int const rank)
     : current_rank_(rank), target_rank_(TNC::unassigned_rank), is_leaf_(true),
-      materials_(ContainerOperations::SortedCopy(materials)) {}
+      materials_(ContainerOperations::SortedCopy(materials)), cost_(0.0),
+      curve_index_(0) {}
 
 /**
  * @brief Adds the given material to the node.
@@ -74,7 +75,9 @@ void TopologyNode::RemoveMaterial(MaterialName const material) {
  * @brief Gives the  materials present in the node.
  * @return The materials.
  */
-std::vector<MaterialName> TopologyNode::Materials() const { return materials_; }
+std::vector<MaterialName> const &TopologyNode::Materials() const {
+  return materials_;
+}
 
 /**
  * @brief Gives the material of a single phase node.
@@ -145,3 +148,28 @@ void TopologyNode::SetCurrentRankAccordingToTargetRank() {
  * @return True if the node's rank is the desired one. False otherwise.
  */
 bool TopologyNode::IsBalanced() const { return current_rank_ == target_rank_; }
+
+/**
+ * @brief Gives the measured cost of the node.
+ * @return The cost, zero if no measurement is available.
+ */
+double TopologyNode::Cost() const { return cost_; }
+
+/**
+ * @brief Sets the measured cost of the node.
+ * @param cost The cost to be used in the load balancing.
+ */
+void TopologyNode::SetCost(double const cost) { cost_ = cost; }
+
+/**
+ * @brief Gives the index of the node on the space-filling curve, which is
+ * evaluated once on creation of the node.
+ * @return The curve index.
+ */
+sfcidx_t TopologyNode::CurveIndex() const { return curve_index_; }
+
+/**
+ * @brief Caches the index of the node on the space-filling curve.
+ * @param index The curve index.
+ */
+void TopologyNode::SetCurveIndex(sfcidx_t const index) { curve_index_ = index; }
@@ -24,6 +24,7 @@
 
 #include "materials/material_definitions.h"
 #include "topology/node_id_type.h"
+#include "topology/space_filling_curve_index.h"
 #include <tuple>
 #include <vector>
 
@@ -42,6 +43,10 @@ class TopologyNode {
   int target_rank_;
   bool is_leaf_;
   std::vector<MaterialName> materials_;
+  // measured cost since the last load balancing, zero if not measured
+  double cost_;
+  // index of the node on the space-filling curve of the load balancing
+  sfcidx_t curve_index_;
 
 public:
   explicit TopologyNode(
@@ -58,7 +63,7 @@ public:
   void AddMaterial(MaterialName const material);
   void RemoveMaterial(MaterialName const material);
 
-  std::vector<MaterialName> Materials() const;
+  std::vector<MaterialName> const &Materials() const;
   MaterialName SingleMaterial() const;
   std::size_t NumberOfMaterials() const;
 
@@ -74,6 +79,12 @@ public:
   void SetCurrentRankAccordingToTargetRank();
 
   bool IsBalanced() const;
+
+  double Cost() const;
+  void SetCost(double const cost);
+
+  sfcidx_t CurveIndex() const;
+  void SetCurveIndex(sfcidx_t const index);
 };
 
 #endif // TOPOLOGY_NODE_H
@@ -22,6 +22,8 @@
 #include "tree.h"
 
 #include "topology/id_information.h"
+#include "utilities/memory_statistics.h"
+#include "utilities/storage_pool.h"
 #include <stdexcept>
 
 /**
@@ -34,10 +36,12 @@
  */
 Tree::Tree(TopologyManager const &topology, unsigned int const maximum_level,
            double const node_size_on_level_zero)
-    : topology_(topology), node_size_on_level_zero_(node_size_on_level_zero),
-      nodes_(maximum_level + 1) // Level 0 + #Levels
-{
-  /** Empty besides initializer list */
+    : topology_(topology), node_size_on_level_zero_(node_size_on_level_zero) {
+  // Level 0 + #Levels
+  nodes_.reserve(maximum_level + 1);
+  for (unsigned int level = 0; level <= maximum_level; ++level) {
+    nodes_.emplace_back(topology_.CurveIndexFunction());
+  }
 }
 
 /**
@@ -48,12 +52,12 @@ Tree::Tree(TopologyManager const &topology, unsigned int const maximum_level,
  * created.
  * @param interface_tag The interface tag present in all of the node.
  */
-void Tree::InsertNode(nid_t const id, std::vector<MaterialName> const materials,
+void Tree::InsertNode(nid_t const id,
+                      std::vector<MaterialName> const &materials,
                       std::int8_t const interface_tag) {
-  nodes_[LevelOfNode(id)].emplace(
-      std::piecewise_construct, std::forward_as_tuple(id),
-      std::forward_as_tuple(id, node_size_on_level_zero_, materials,
-                            interface_tag));
+  tree_update_count_++;
+  nodes_[LevelOfNode(id)].emplace(id, id, node_size_on_level_zero_, materials,
+                                  interface_tag);
 }
 
 /**
@@ -69,19 +73,19 @@ Node &Tree::CreateNode(
     std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
     std::unique_ptr<InterfaceBlock> interface_block) {
 
+  tree_update_count_++;
   unsigned int const level = LevelOfNode(id);
-  auto entry_and_decision = nodes_[level].emplace(
-      std::piecewise_construct, std::forward_as_tuple(id),
-      std::forward_as_tuple(id, node_size_on_level_zero_, materials,
-                            interface_tags, std::move(interface_block)));
+  auto entry_and_decision =
+      nodes_[level].emplace(id, id, node_size_on_level_zero_, materials,
+                            interface_tags, std::move(interface_block));
 
 #ifndef PERFORMANCE
-  if (!std::get<1>(entry_and_decision)) {
+  if (!entry_and_decision.second) {
     throw std::logic_error(
         "Could not insert node into tree. Id already existed");
   }
 #endif
-  return std::get<1>(*std::get<0>(entry_and_decision));
+  return entry_and_decision.first.second;
 }
 
 /**
@@ -93,18 +97,18 @@ Node &Tree::CreateNode(
 Node &Tree::CreateNode(nid_t const id,
                        std::vector<MaterialName> const &materials) {
 
+  tree_update_count_++;
   unsigned int const level = LevelOfNode(id);
-  auto entry_and_decision = nodes_[level].emplace(
-      std::piecewise_construct, std::forward_as_tuple(id),
-      std::forward_as_tuple(id, node_size_on_level_zero_, materials));
+  auto entry_and_decision =
+      nodes_[level].emplace(id, id, node_size_on_level_zero_, materials);
 
 #ifndef PERFORMANCE
-  if (!std::get<1>(entry_and_decision)) {
+  if (!entry_and_decision.second) {
     throw std::logic_error(
         "Could not insert node into tree. Id already existed");
   }
 #endif
-  return std::get<1>(*std::get<0>(entry_and_decision));
+  return entry_and_decision.first.second;
 }
 
 /**
@@ -115,7 +119,7 @@ Node &Tree::CreateNode(nid_t const id,
  * @param id Id of the leaf which is to be refined, i.e. becomes a parent node.
  * @return List of childrens' ids.
  */
-std::vector<nid_t> Tree::RefineNode(nid_t const id) {
+std::array<nid_t, CC::NOC()> Tree::RefineNode(nid_t const id) {
 
 #ifndef PERFORMANCE
   unsigned int const level = LevelOfNode(id);
@@ -125,7 +129,7 @@ std::vector<nid_t> Tree::RefineNode(nid_t const id) {
   }
 #endif
 
-  std::vector<nid_t> const children_ids =
+  std::array<nid_t, CC::NOC()> const children_ids =
       IdsOfChildren(id); // IdsOfChildren adjusts to 1D/2D.
   Node const &node = GetNodeWithId(id);
 
@@ -148,73 +152,77 @@ std::vector<nid_t> Tree::RefineNode(nid_t const id) {
 void Tree::RemoveNodeWithId(nid_t const id) {
   unsigned int level = LevelOfNode(id);
   nodes_[level].erase(id);
+  tree_update_count_++;
 }
 
 /**
- * @brief Returns a list of all leaf nodes on this rank. $List is in arbitrary
- * order$.
- * @return List of pointers to the leaves in this tree instance.
+ * @brief Gathers the leaves of the given tree anew if the topology or the tree
+ * has changed since the lists were filled last.
+ * @param tree The tree, const for the const lists.
+ * @param lists The cached lists of the tree.
+ * @return The up-to-date lists.
  */
-std::vector<std::reference_wrapper<Node>> Tree::Leaves() {
-
-  std::vector<nid_t> leaf_ids = topology_.LocalLeafIds();
-  std::vector<std::reference_wrapper<Node>> leaves;
-  leaves.reserve(leaf_ids.size());
-
-  for (auto const &id : leaf_ids) {
-    leaves.emplace_back(GetNodeWithId(id)); // We add this leaf
+template <typename NodeType, typename TreeType>
+LeafLists<NodeType> &Tree::UpdateLeafLists(TreeType &tree,
+                                           LeafLists<NodeType> &lists) {
+  unsigned int const topology_update_count =
+      tree.topology_.TopologyUpdateCount();
+  if (lists.topology_update_count_ == topology_update_count &&
+      lists.tree_update_count_ == tree.tree_update_count_) {
+    return lists;
   }
-  return leaves;
+  lists.on_level_.resize(tree.nodes_.size());
+  lists.all_.clear();
+  for (unsigned int level = 0; level < tree.nodes_.size(); ++level) {
+    lists.on_level_[level].clear();
+    for (nid_t const id : tree.topology_.LocalLeafIdsOnLevel(level)) {
+      lists.on_level_[level].emplace_back(tree.GetNodeWithId(id));
+    }
+    lists.all_.insert(lists.all_.end(), lists.on_level_[level].cbegin(),
+                      lists.on_level_[level].cend());
+  }
+  lists.topology_update_count_ = topology_update_count;
+  lists.tree_update_count_ = tree.tree_update_count_;
+  return lists;
 }
 
 /**
- * @brief Const overload.
+ * @brief Returns a list of all leaf nodes on this rank. $List is ordered by
+ * level and along the space-filling curve$.
+ * @return List of pointers to the leaves in this tree instance.
+ * @note The list is kept between calls and only gathered anew after the
+ * topology or the tree has changed, which invalidates the reference.
  */
-std::vector<std::reference_wrapper<Node const>> Tree::Leaves() const {
-
-  std::vector<nid_t> leaf_ids = topology_.LocalLeafIds();
-  std::vector<std::reference_wrapper<Node const>> leaves;
-  leaves.reserve(leaf_ids.size());
+std::vector<std::reference_wrapper<Node>> const &Tree::Leaves() {
+  return UpdateLeafLists(*this, leaf_lists_).all_;
+}
 
-  for (auto const &id : leaf_ids) {
-    leaves.emplace_back(GetNodeWithId(id)); // We add this leaf
-  }
-  return leaves;
+/**
+ * @brief Const overload.
+ */
+std::vector<std::reference_wrapper<Node const>> const &Tree::Leaves() const {
+  return UpdateLeafLists(*this, const_leaf_lists_).all_;
 }
 
 /**
- * @brief Gives a list of all leaves on the specified level. $List is in
- * arbitrary order$.
+ * @brief Gives a list of all leaves on the specified level. $List is ordered
+ * along the space-filling curve$.
  * @param level The level of interest.
  * @return List of leaves.
+ * @note The list is kept between calls and only gathered anew after the
+ * topology or the tree has changed, which invalidates the reference.
  */
-std::vector<std::reference_wrapper<Node>>
+std::vector<std::reference_wrapper<Node>> const &
 Tree::LeavesOnLevel(unsigned int const level) {
-
-  std::vector<nid_t> leaf_ids_on_level = topology_.LocalLeafIdsOnLevel(level);
-  std::vector<std::reference_wrapper<Node>> leaves;
-  leaves.reserve(leaf_ids_on_level.size());
-
-  for (auto &id : leaf_ids_on_level) {
-    leaves.emplace_back(GetNodeWithId(id)); // We add this leaf
-  }
-  return leaves;
+  return UpdateLeafLists(*this, leaf_lists_).on_level_[level];
 }
 
 /**
  * @brief const overload.
  */
-std::vector<std::reference_wrapper<Node const>>
+std::vector<std::reference_wrapper<Node const>> const &
 Tree::LeavesOnLevel(unsigned int const level) const {
-
-  std::vector<nid_t> leaf_ids_on_level = topology_.LocalLeafIdsOnLevel(level);
-  std::vector<std::reference_wrapper<Node const>> leaves;
-  leaves.reserve(leaf_ids_on_level.size());
-
-  for (auto const &id : leaf_ids_on_level) {
-    leaves.emplace_back(GetNodeWithId(id)); // We add this leaf
-  }
-  return leaves;
+  return UpdateLeafLists(*this, const_leaf_lists_).on_level_[level];
 }
 
 /**
@@ -225,7 +233,7 @@ Tree::LeavesOnLevel(unsigned int const level) const {
  */
 std::vector<std::reference_wrapper<Node>>
 Tree::NonLevelsetLeaves(unsigned int const level) {
-  std::vector<nid_t> const leaf_ids_on_level =
+  std::vector<nid_t> const &leaf_ids_on_level =
       topology_.LocalLeafIdsOnLevel(level);
   std::vector<std::reference_wrapper<Node>> non_levelset_leaves;
   non_levelset_leaves.reserve(leaf_ids_on_level.size());
@@ -245,7 +253,7 @@ Tree::NonLevelsetLeaves(unsigned int const level) {
  */
 std::vector<std::reference_wrapper<Node const>>
 Tree::NonLevelsetLeaves(unsigned int const level) const {
-  std::vector<nid_t> const leaf_ids_on_level =
+  std::vector<nid_t> const &leaf_ids_on_level =
       topology_.LocalLeafIdsOnLevel(level);
   std::vector<std::reference_wrapper<Node const>> non_levelset_leaves;
   non_levelset_leaves.reserve(leaf_ids_on_level.size());
@@ -278,8 +286,8 @@ std::vector<std::reference_wrapper<Node const>> Tree::InterfaceLeaves() const {
 }
 
 /**
- * @brief Gives a list of all nodes on the specified level. $List is in
- * arbitrary order$.
+ * @brief Gives a list of all nodes on the specified level. $List is ordered
+ * along the space-filling curve$.
  * @param level The level of interest.
  * @return List of nodes.
  */
@@ -323,13 +331,13 @@ Tree::NodesOnLevel(unsigned int const level) const {
 }
 
 /**
- * @brief gives all nodes with levelset in the tree. $List is in arbitrary
- * order$.
+ * @brief gives all nodes with levelset in the tree. $List is ordered along the
+ * space-filling curve$.
  * @return List of nodes with levelset. List may be empty.
  */
 std::vector<std::reference_wrapper<Node>> Tree::NodesWithLevelset() {
   // Levelset only on maximum level
-  std::unordered_map<nid_t, Node> &maximum_level = nodes_.back();
+  NodeStore &maximum_level = nodes_.back();
   std::vector<std::reference_wrapper<Node>> nodes;
   nodes.reserve(maximum_level.size());
 
@@ -347,7 +355,7 @@ std::vector<std::reference_wrapper<Node>> Tree::NodesWithLevelset() {
 std::vector<std::reference_wrapper<Node const>>
 Tree::NodesWithLevelset() const {
   // Levelset only on maximum level
-  std::unordered_map<nid_t, Node> const &maximum_level = nodes_.back();
+  NodeStore const &maximum_level = nodes_.back();
   std::vector<std::reference_wrapper<Node const>> nodes;
   nodes.reserve(maximum_level.size());
 
@@ -405,7 +413,7 @@ Node const &Tree::GetNodeWithId(nid_t const id) const {
 
 std::pair<nid_t const, Node> &Tree::NodeIdPair(nid_t const id) {
   unsigned int const level = LevelOfNode(id);
-  return *nodes_[level].find(id);
+  return nodes_[level].entry(id);
 }
 
 /**
@@ -413,17 +421,16 @@ std::pair<nid_t const, Node> &Tree::NodeIdPair(nid_t const id) {
  */
 std::pair<nid_t const, Node> const &Tree::NodeIdPair(nid_t const id) const {
   unsigned int const level = LevelOfNode(id);
-  return *nodes_[level].find(id);
+  return nodes_[level].entry(id);
 }
 
 /**
  * @brief Gives a list of all nodes in this instance on the specified level.
- * List is in arbitrary order.
+ * List is ordered along the space-filling curve.
  * @param level The level of interest.
  * @return List of nodes.
  */
-std::unordered_map<nid_t, Node> &
-Tree::GetLevelContent(unsigned int const level) {
+NodeStore &Tree::GetLevelContent(unsigned int const level) {
 #ifndef PERFORMANCE
   if (level > nodes_.size()) {
     throw std::invalid_argument("Requested Level does not exist");
@@ -435,8 +442,7 @@ Tree::GetLevelContent(unsigned int const level) {
 /**
  * @brief const overload.
  */
-std::unordered_map<nid_t, Node> const &
-Tree::GetLevelContent(unsigned int const level) const {
+NodeStore const &Tree::GetLevelContent(unsigned int const level) const {
 #ifndef PERFORMANCE
   if (level > nodes_.size()) {
     throw std::invalid_argument("Requested Level does not exist");
@@ -444,3 +450,59 @@ Tree::GetLevelContent(unsigned int const level) const {
 #endif
   return nodes_[level];
 }
+
+/**
+ * @brief Estimates the memory held by the nodes and their blocks, i.e. the node
+ * stores of the levels, the phases including their (lazily allocated) jump
+ * buffers, integration buffers, velocity gradients and statistics buffers and
+ * the block chunks kept for reuse in the storage pools. The interface blocks
+ * are not included.
+ * @return The memory in bytes.
+ */
+std::size_t Tree::BlockBytes() const {
+  std::size_t bytes = CapacityBytes(nodes_);
+  for (auto const &level : nodes_) {
+    bytes += level.CapacityBytes();
+    for (auto const &[id, node] : level) {
+      for (auto const &[material, block] : node.GetPhases()) {
+        bytes += sizeof(PhaseMap::Entry);
+        if (block.HasJumpBuffers()) {
+          bytes += sizeof(JumpBuffers);
+        }
+        if (block.HasIntegrationBuffers()) {
+          bytes += sizeof(IntegrationBuffers);
+        }
+        if (block.HasVelocityGradientStorage()) {
+          bytes += sizeof(VelocityGradient);
+        }
+        if (block.HasStatisticsBuffers()) {
+          bytes += sizeof(StatisticsBuffers);
+        }
+      }
+    }
+  }
+  return bytes + NodeStore::PooledSlabBytes() +
+         StoragePool<sizeof(PhaseMap::Entry)>::Instance().FreeBytes() +
+         StoragePool<sizeof(JumpBuffers)>::Instance().FreeBytes() +
+         StoragePool<sizeof(IntegrationBuffers)>::Instance().FreeBytes() +
+         StoragePool<sizeof(StatisticsBuffers)>::Instance().FreeBytes();
+}
+
+/**
+ * @brief Estimates the memory held by the interface blocks of the nodes
+ * including the dense tiles of their band-tiled buffers and the chunks kept for
+ * reuse in their storage pool.
+ * @return The memory in bytes.
+ */
+std::size_t Tree::InterfaceBlockBytes() const {
+  std::size_t bytes = 0;
+  for (auto const &level : nodes_) {
+    for (auto const &[id, node] : level) {
+      if (node.HasLevelset()) {
+        bytes +=
+            sizeof(InterfaceBlock) + node.GetInterfaceBlock().BandTiledBytes();
+      }
+    }
+  }
+  return bytes + StoragePool<sizeof(InterfaceBlock)>::Instance().FreeBytes();
+}
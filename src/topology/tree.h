@@ -24,11 +24,24 @@
 
 #include "block_definitions/interface_block.h"
 #include "node.h"
+#include "node_store.h"
 #include "topology_manager.h"
+#include <array>
 #include <memory>
-#include <unordered_map>
 #include <vector>
 
+/**
+ * @brief Gives the leaves of a tree listed per level and in total, such that
+ * they are only gathered anew after the topology or the tree has changed.
+ */
+template <typename NodeType> struct LeafLists {
+  std::vector<std::vector<std::reference_wrapper<NodeType>>> on_level_;
+  std::vector<std::reference_wrapper<NodeType>> all_;
+  // topology and tree update counts the lists were gathered for
+  unsigned int topology_update_count_ = 0;
+  unsigned int tree_update_count_ = 0;
+};
+
 /**
  * @brief The Tree class holds the information about local material data. Data
  * on the MR levels is stored in Node containers as Binary-, Quad-, Oct-tree in
@@ -44,11 +57,20 @@ class Tree {
   TopologyManager const &topology_;
   // size of a cubic block on level zero (non-dimensionalized)
   double const node_size_on_level_zero_;
-  // all nodes contained in this tree ( current rank )
-  std::vector<std::unordered_map<nid_t, Node>> nodes_;
+  // all nodes contained in this tree ( current rank ), one store per level
+  std::vector<NodeStore> nodes_;
+  // number of node insertions and removals, starts at one to mark the leaf
+  // lists as outdated initially
+  unsigned int tree_update_count_ = 1;
+  // cached leaf lists ( see Leaves() )
+  LeafLists<Node> leaf_lists_;
+  mutable LeafLists<Node const> const_leaf_lists_;
 
-  void InsertNode(nid_t const id, std::vector<MaterialName> const materials,
+  void InsertNode(nid_t const id, std::vector<MaterialName> const &materials,
                   std::int8_t const interface_tag);
+  template <typename NodeType, typename TreeType>
+  static LeafLists<NodeType> &UpdateLeafLists(TreeType &tree,
+                                              LeafLists<NodeType> &lists);
 
 public:
   Tree() = delete;
@@ -76,14 +98,14 @@ public:
       std::unique_ptr<InterfaceBlock> interface_block = nullptr);
   Node &CreateNode(nid_t const id, std::vector<MaterialName> const &materials);
   void RemoveNodeWithId(nid_t const id);
-  std::vector<nid_t> RefineNode(nid_t const id);
+  std::array<nid_t, CC::NOC()> RefineNode(nid_t const id);
 
   // Functions to return leaf nodes
-  std::vector<std::reference_wrapper<Node>> Leaves();
-  std::vector<std::reference_wrapper<Node const>> Leaves() const;
-  std::vector<std::reference_wrapper<Node>>
+  std::vector<std::reference_wrapper<Node>> const &Leaves();
+  std::vector<std::reference_wrapper<Node const>> const &Leaves() const;
+  std::vector<std::reference_wrapper<Node>> const &
   LeavesOnLevel(unsigned int const level);
-  std::vector<std::reference_wrapper<Node const>>
+  std::vector<std::reference_wrapper<Node const>> const &
   LeavesOnLevel(unsigned int const level) const;
   std::vector<std::reference_wrapper<Node>>
   NonLevelsetLeaves(unsigned int const level);
@@ -105,26 +127,24 @@ public:
   Node &GetNodeWithId(nid_t const id);
   std::pair<nid_t const, Node> &NodeIdPair(nid_t const id);
   std::pair<nid_t const, Node> const &NodeIdPair(nid_t const id) const;
-  std::unordered_map<nid_t, Node> &GetLevelContent(unsigned int const level);
-  std::unordered_map<nid_t, Node> const &
-  GetLevelContent(unsigned int const level) const;
+  NodeStore &GetLevelContent(unsigned int const level);
+  NodeStore const &GetLevelContent(unsigned int const level) const;
+
+  // Functions to estimate the memory held by the tree
+  std::size_t BlockBytes() const;
+  std::size_t InterfaceBlockBytes() const;
 
   /**
    * @brief Gives a reference to the complete node list in this tree instance, i
    * e. the complete tree on current MPI rank.
-   * @return List of nodes. An array for each level holding arbitrary number of
-   * nodes on each level.
+   * @return List of nodes. A store for each level holding arbitrary number of
+   * nodes on each level, iterated along the space-filling curve.
    */
-  inline std::vector<std::unordered_map<nid_t, Node>> &FullNodeList() {
-    return nodes_;
-  }
+  inline std::vector<NodeStore> &FullNodeList() { return nodes_; }
   /**
    * @brief Const overload.
    */
-  inline std::vector<std::unordered_map<nid_t, Node>> const &
-  FullNodeList() const {
-    return nodes_;
-  }
+  inline std::vector<NodeStore> const &FullNodeList() const { return nodes_; }
 };
 
 #endif // TREE_H
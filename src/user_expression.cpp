@@ -21,6 +21,7 @@
 //===----------------------------------------------------------------------===//
 #include "user_expression.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -36,7 +37,10 @@ UserExpression::UserExpression(
     std::vector<std::string> const &variables_out,
     std::vector<std::string> const &function_variables_names,
     std::vector<double> &function_variables_values)
-    : random_number_expression_() {
+    : random_number_expression_(), variables_out_(variables_out),
+      native_function_(nullptr),
+      native_inputs_(function_variables_values.data()),
+      native_outputs_(variables_out.size(), 0.0) {
   symbol_table_.add_function("rand", random_number_expression_);
 
   if (function_variables_names.size() != function_variables_values.size()) {
@@ -52,6 +56,11 @@ UserExpression::UserExpression(
   for (auto &var : variables_out) {
     symbol_table_.create_variable(var);
   }
+  output_values_.reserve(variables_out.size());
+  for (auto &var : variables_out) {
+    output_values_.push_back(var.empty() ? nullptr
+                                         : &symbol_table_.variable_ref(var));
+  }
 
   symbol_table_.add_constants();
 
@@ -65,6 +74,23 @@ UserExpression::UserExpression(
     throw std::logic_error("Error in expression: " + parser.error() +
                            " Expression: " + expression_string);
   }
+
+  // the interpreter has validated the expression, the native function
+  // replaces it if enabled and possible
+  native_function_ = NativeExpression::Create(expression_string, variables_out,
+                                              function_variables_names);
+}
+
+/**
+ * @brief Selects the stream the random numbers ( rand() ) of the following
+ * evaluations are drawn from. The numbers only depend on the stream and the
+ * number of draws since, not on the order in which points are evaluated.
+ * @param stream The stream, e.g., the node id.
+ * @param substream The substream, e.g., the cell index within the node.
+ */
+void UserExpression::SetRandomStream(std::uint64_t const stream,
+                                     std::uint32_t const substream) {
+  random_number_expression_.generator_.SetStream(stream, substream);
 }
 
 /**
@@ -74,6 +100,52 @@ UserExpression::UserExpression(
  * @return The value of the specified variable.
  */
 double UserExpression::GetValue(std::string const variable) const {
+  if (native_function_) {
+    auto const output =
+        std::find(variables_out_.begin(), variables_out_.end(), variable);
+    if (output != variables_out_.end()) {
+      EvaluateNatively();
+      return native_outputs_[output - variables_out_.begin()];
+    }
+  }
   expression_.value();
   return symbol_table_.get_variable(variable)->value();
 }
+
+/**
+ * @brief Evaluates the expression once and gives the values of all output
+ * variables. Avoids the repeated evaluation and the name lookup of GetValue
+ * if several outputs are needed.
+ * @param values The values of the output variables in the order of their
+ * names, zero for empty names ( indirect return parameter ).
+ */
+void UserExpression::GetValues(std::vector<double> &values) const {
+  if (native_function_) {
+    EvaluateNatively();
+    values = native_outputs_;
+    return;
+  }
+  expression_.value();
+  values.resize(output_values_.size());
+  for (std::size_t index = 0; index < output_values_.size(); ++index) {
+    values[index] = output_values_[index] ? *output_values_[index] : 0.0;
+  }
+}
+
+/**
+ * @brief Evaluates the native function of the expression into the native
+ * outputs.
+ */
+void UserExpression::EvaluateNatively() const {
+  native_function_(native_inputs_, native_outputs_.data(), &DrawRandomNumber,
+                   &random_number_expression_.generator_);
+}
+
+/**
+ * @brief Draws a random number for the native function of an expression.
+ * @param generator The random number generator.
+ * @return The random number.
+ */
+double UserExpression::DrawRandomNumber(void *generator) {
+  return static_cast<RandomNumberGenerator *>(generator)->GiveRandomNumber();
+}
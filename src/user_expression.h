@@ -22,22 +22,21 @@
 #ifndef USER_EXPRESSION_H
 #define USER_EXPRESSION_H
 
-#include <random>
+#include <cstdint>
 #include <string>
 #include <vector>
 
+#include "native_expression.h"
 #include "utilities/random_number_generator.h"
 #include <exprtk.hpp>
 
 template <typename T>
 struct random_number_expression : public exprtk::ifunction<T> {
 
-  RandomNumberGenerator &generator_;
+  RandomNumberGenerator generator_;
 
 public:
-  random_number_expression()
-      : exprtk::ifunction<T>(0), generator_(RandomNumberGenerator::Instance()) {
-  }
+  random_number_expression() : exprtk::ifunction<T>(0), generator_() {}
   virtual ~random_number_expression() {}
 
   inline T operator()() { return generator_.GiveRandomNumber(); }
@@ -47,12 +46,26 @@ public:
  * @brief The UserExpression class represents a user defined mathematical
  * expression with several input and output variables. It wraps the basic
  * functionality of the powerful expression toolkit
- * (http://www.partow.net/programming/exprtk/index.html).
+ * (http://www.partow.net/programming/exprtk/index.html). If enabled, the
+ * expression is compiled to native code ( see NativeExpression ) and the
+ * interpreter is only used if this is not possible.
  */
 class UserExpression {
-  random_number_expression<double> random_number_expression_;
+  // drawn from in const evaluations, as by the interpreter
+  mutable random_number_expression<double> random_number_expression_;
   exprtk::symbol_table<double> symbol_table_;
   exprtk::expression<double> expression_;
+  // values of the output variables in the order of their names ( null for
+  // empty names ), resolved once on construction
+  std::vector<double const *> output_values_;
+  std::vector<std::string> const variables_out_;
+  // native function ( null if not available ), its inputs and outputs
+  NativeExpression::Function native_function_;
+  double const *const native_inputs_;
+  mutable std::vector<double> native_outputs_;
+
+  static double DrawRandomNumber(void *generator);
+  void EvaluateNatively() const;
 
 public:
   UserExpression() = delete;
@@ -67,7 +80,10 @@ public:
   UserExpression(UserExpression &&) = delete;
   UserExpression &operator=(UserExpression &&) = delete;
 
+  void SetRandomStream(std::uint64_t const stream,
+                       std::uint32_t const substream = 0);
   double GetValue(std::string const variable) const;
+  void GetValues(std::vector<double> &values) const;
 };
 
 #endif // USER_EXPRESSION_H
@@ -24,7 +24,9 @@
 
 #include "boundary_condition/boundary_specifications.h"
 #include "enums/dimension_definition.h"
+#include "enums/field_buffer_layout.h"
 #include "enums/norms.h"
+#include "enums/refinement_indicator.h"
 #include "enums/vertex_filter_type.h"
 #include <array>
 #include <limits>
@@ -36,8 +38,15 @@
 class CompileTimeConstants {
 
   /*** TO BE SET BY EXPERIENCED USERS ***/
+  // The block size can be overridden by the build ( see BLOCK_SIZES in
+  // cmake/block_size.cmake )
+#ifdef INTERNAL_CELLS_PER_BLOCK
   static constexpr unsigned int internal_cells_per_block_and_dimension_ =
-      16;                                        // Referred to as "IC"
+      INTERNAL_CELLS_PER_BLOCK; // Referred to as "IC"
+#else
+  static constexpr unsigned int internal_cells_per_block_and_dimension_ =
+      16; // Referred to as "IC"
+#endif
   static constexpr unsigned int halo_width_ = 4; // Referred to as "HS"
   static constexpr unsigned int cells_per_dimension_with_halo_ =
       2 * halo_width_ +
@@ -131,12 +140,63 @@ class CompileTimeConstants {
   // Norm used for the wavelet analysis triggering the refinement/coarsening of
   // cells
   static constexpr Norm norm_for_wavelet_analysis_ = Norm::Linfinity;
+  // Indicator triggering the refinement/coarsening of leaves. All but the
+  // wavelet details are evaluated on the data of the leaf only, i.e. without
+  // the parent, and compared against the fixed thresholds below ( indicator
+  // values within [0, 1] )
+  static constexpr RefinementIndicator refinement_indicator_ =
+      RefinementIndicator::WaveletDetail;
+  static constexpr double refinement_indicator_refine_threshold_ = 0.1;
+  static constexpr double refinement_indicator_coarsen_threshold_ = 0.02;
+  // Reuse the detail of leaves whose remeshing decision cannot have changed
+  // since their last wavelet analysis
+  static constexpr bool cache_wavelet_details_ = true;
+  // Number of time steps of a level between two wavelet analyses of its
+  // children. For more than one step, a band of blocks around the refined
+  // regions is kept refined to cover the fronts moving in between
+  static constexpr unsigned int remesh_interval_ = 1;
+  // Fractions of the memory budget of a rank ( see memoryBudget in the input
+  // file ). Above the first, the thresholds of the single-phase refinement are
+  // raised continuously up to the refine threshold of the fifth-order
+  // prediction at the second, above which this refinement is refused
+  static constexpr double memory_budget_raise_fraction_ = 0.8;
+  static constexpr double memory_budget_refuse_fraction_ = 0.95;
+  // Hysteresis of the change from multi- to single-phase nodes. A node whose
+  // interface has vanished only becomes single-phase once the interface stayed
+  // away for more than the given number of checks ( time steps of its level )
+  // and no node on its level within the given number of blocks still holds the
+  // interface. Zero for both changes the node immediately
+  static constexpr unsigned int interface_removal_delay_ = 0;
+  static constexpr unsigned int interface_removal_distance_ = 0;
+  // Builds the initial mesh top-down, i.e. only blocks whose wavelet details
+  // require refinement ( or which contain the interface ) get children.
+  // Otherwise all blocks are refined and coarsened again afterwards
+  static constexpr bool top_down_initialization_ = false;
 
   // Specification of the vertex filter for the standard output to remove
   // doubled placed vertices
   static constexpr VertexFilterType output_vertex_filter_ =
       VertexFilterType::Mpi;
 
+  // Memory layout of the material and interface field buffers. CellBlocked
+  // requires all block-wide kernels to use the layout-aware accessors, as the
+  // raw three-dimensional field arrays only exist in the FieldMajor layout.
+  static constexpr FieldBufferLayout field_buffer_layout_ =
+      FieldBufferLayout::FieldMajor;
+  // Number of consecutive cells bundled in one tile of the CellBlocked layout
+  static constexpr unsigned int field_buffer_tile_width_ = 8;
+  // Flag to store the material parameters (e.g. viscosity, conductivity) in
+  // single precision. The kernels convert the values to double on load.
+  static constexpr bool single_precision_parameters_ = false;
+  // The floating-point type of the material fields ( conservatives and prime
+  // states ) is set by the build ( see SINGLE_PRECISION in
+  // cmake/precision.cmake ). Time and conservation sums stay in double.
+#ifdef SINGLE_PRECISION
+  static constexpr bool single_precision_fields_ = true;
+#else
+  static constexpr bool single_precision_fields_ = false;
+#endif
+
   /*** DEDUCED OR FIXED VALUES - MUST NOT BE CHANGED ***/
 
   // Macro "PERFORMANCE" set through makefile (only).
@@ -227,6 +287,104 @@ class CompileTimeConstants {
    * rank before the topology is load balanced (chosen on experience)
    */
   static constexpr unsigned int topology_changes_until_load_balancing_ = 8;
+  // Flag to partition the leaves of a level along one space-filling curve by
+  // their accumulated cost instead of equal counts of single- and multi-phase
+  // leaves
+  static constexpr bool cost_weighted_load_balancing_ = false;
+  // Cost of a multi-phase leaf relative to a single-phase leaf (static model
+  // for the cost-weighted load balancing, chosen on experience)
+  static constexpr double multi_phase_leaf_cost_ = 10.0;
+  // Flag to measure the time spent on each node. The measured costs replace
+  // the static cost model and enable the load imbalance trigger
+  static constexpr bool measure_node_costs_ = false;
+  // Flag to rebalance by moving leaves between neighboring ranks only, instead
+  // of a new partition from scratch ( forced load balancing is always full )
+  static constexpr bool incremental_load_balancing_ = false;
+  // Maximum data volume in bytes migrated by one incremental load balancing
+  static constexpr unsigned long long maximum_migration_bytes_ = 1ull << 30;
+
+  // Flag to overlap the MPI halo communication with the computation on nodes
+  // that exchange data only within the rank
+  static constexpr bool overlap_halo_communication_ = true;
+  // Flag to create the MPI requests of halo updates once per topology and to
+  // restart them in every update (persistent communication)
+  static constexpr bool persistent_halo_requests_ = true;
+  // Flag to pack all halo data exchanged with one rank into a single message
+  // (reduces the message rate for small blocks)
+  static constexpr bool aggregate_halo_messages_ = true;
+  // Flag to exchange the aggregated halo data of ranks on the same compute
+  // node through MPI shared-memory windows instead of messages (requires
+  // aggregated halo messages)
+  static constexpr bool shared_memory_halo_exchange_ = false;
+  // Flag to map the halo graph of the ranks onto the processes with the MPI
+  // library after the initial load balancing and to write the suggested
+  // placement as rankfile ( the partition itself is not changed )
+  static constexpr bool halo_graph_rank_placement_ = false;
+  // Flag to only send the level-set halo values inside the cut-off band in MPI
+  // halo updates (values outside the band are restored as the cut-off value)
+  static constexpr bool sparse_levelset_halos_ = true;
+  // Flag to send interface tag halo regions of uniform tags as a single value
+  // in MPI halo updates
+  static constexpr bool compressed_interface_tag_halos_ = true;
+
+  // Flag to recover the prime states of the internal cells of single-phase
+  // leaves right after their integration in one sweep, such that the
+  // prime-state recovery of the stage only converts their halo cells
+  static constexpr bool fused_prime_state_recovery_ = true;
+  // Number of x-planes integrated and converted at once in the fused sweep
+  // ( zero: whole block )
+  static constexpr unsigned int fused_integration_tile_planes_ = 2;
+
+  // Flag to recycle the storage of blocks and interface blocks in per-process
+  // pools instead of returning it to the heap
+  static constexpr bool pool_block_storage_ = true;
+  // Flag to allocate the jump buffers of a block only while its node takes part
+  // in a resolution jump
+  static constexpr bool lazy_jump_buffers_ = true;
+  // Flag to allocate the initial conservative buffer of a block only while its
+  // node is a leaf (parents are not integrated in time)
+  static constexpr bool lazy_integration_buffers_ = true;
+  // Flag to store the initial interface description buffers of an interface
+  // block in tiles, where tiles of uniform values (e.g. beyond the cut-off
+  // band) are kept as a single value
+  static constexpr bool band_tiled_interface_initial_buffers_ = true;
+  // Flag to assign the leaves statically to the threads and to place their
+  // blocks on the NUMA domain of their thread. Worthwhile for ranks spanning
+  // several NUMA domains, at the cost of the dynamic load balance of threads
+  static constexpr bool numa_aware_placement_ = false;
+
+  // Flag whether the equation of state of a material is resolved once per
+  // block and the cell loops are instantiated for the concrete type
+  static constexpr bool devirtualize_equation_of_state_ = true;
+
+  // Flag to compute the interface normals and apertures of the cells close to
+  // the interface once per stage and reuse them in the interface terms
+  static constexpr bool cache_interface_geometry_ = true;
+
+  // Flag to compute the velocity gradient at the cell centers of single-phase
+  // blocks once per stage and share it between the shear-rate parameter models
+  // and the viscous fluxes
+  static constexpr bool cache_velocity_gradient_ = true;
+
+  // Flag to only exchange the face halos ( e, w, n, s, t, b ) of the nodes on
+  // the finest level as long as no interface is present. Edge and corner halos
+  // are then filled with the closest internal value instead. Only takes effect
+  // for stencils without cross derivatives, i.e. without viscous or heat fluxes
+  static constexpr bool face_halos_only_ = true;
+
+  // Flag to advance the viscous and heat fluxes by a second-order
+  // Runge-Kutta-Legendre super-time-stepping scheme ( RKL2 ) after each macro
+  // timestep instead of within the Runge-Kutta stages. The timestep size is
+  // then limited by the convective terms only. Worthwhile if the parabolic
+  // timestep restriction is much stricter than the convective one. Restricted
+  // to single-phase simulations without parameter models
+  static constexpr bool super_time_stepping_ = false;
+
+  // Flag to compute the right-hand side of the rank-local siblings of a parent
+  // one after another as a superblock. The convective fluxes over a face shared
+  // by two single-phase siblings are then computed once and handed from the
+  // lower to the upper sibling instead of being computed by both
+  static constexpr bool superblock_execution_ = false;
 
   // Assertions for consistency checks
   static_assert((internal_cells_per_block_and_dimension_ % 4) == 0,
@@ -255,6 +413,21 @@ class CompileTimeConstants {
                   dimension_of_simulation_ == Dimension::Two) ||
                  axisymmetric_ == false),
                 "Axisymmetric case can only be run with DIM=2");
+  static_assert(!shared_memory_halo_exchange_ || aggregate_halo_messages_,
+                "Shared-memory halo exchange requires aggregated halo "
+                "messages!");
+  static_assert(!super_time_stepping_ ||
+                    (!viscosity_model_active_ &&
+                     !thermal_conductivity_model_active_ && !axisymmetric_),
+                "Super-time-stepping does not support parameter models and "
+                "axisymmetric simulations!");
+  static_assert(refinement_indicator_coarsen_threshold_ <
+                    refinement_indicator_refine_threshold_,
+                "The coarsen threshold of the refinement indicator must be "
+                "below its refine threshold!");
+  static_assert(memory_budget_raise_fraction_ < memory_budget_refuse_fraction_,
+                "The memory budget fraction raising the thresholds must be "
+                "below the one refusing the refinement!");
 
 public:
   CompileTimeConstants() = delete;
@@ -745,6 +918,91 @@ public:
    */
   static constexpr Norm NFWA() { return norm_for_wavelet_analysis_; }
 
+  /**
+   * @brief Gives whether the details of the wavelet analysis are cached. "CWD =
+   * Cache Wavelet Details".
+   * @return True if details are cached, false otherwise.
+   */
+  static constexpr bool CWD() { return cache_wavelet_details_; }
+
+  /**
+   * @brief Gives the indicator triggering the refinement/coarsening of leaves.
+   * "RI = Refinement Indicator".
+   * @return Refinement indicator.
+   */
+  static constexpr RefinementIndicator RI() { return refinement_indicator_; }
+
+  /**
+   * @brief Gives the indicator value above which a leaf is refined ( not used
+   * for wavelet details ). "RIRT = Refinement Indicator Refine Threshold".
+   * @return Refine threshold.
+   */
+  static constexpr double RIRT() {
+    return refinement_indicator_refine_threshold_;
+  }
+
+  /**
+   * @brief Gives the indicator value below which a leaf may be coarsened ( not
+   * used for wavelet details ). "RICT = Refinement Indicator Coarsen
+   * Threshold".
+   * @return Coarsen threshold.
+   */
+  static constexpr double RICT() {
+    return refinement_indicator_coarsen_threshold_;
+  }
+
+  /**
+   * @brief Gives the number of time steps of a level between two wavelet
+   * analyses of its children.
+   * @return Remesh interval.
+   */
+  static constexpr unsigned int RemeshInterval() { return remesh_interval_; }
+
+  /**
+   * @brief Gives the fraction of the memory budget above which the thresholds
+   * of the single-phase refinement are raised.
+   * @return Raise fraction.
+   */
+  static constexpr double MemoryBudgetRaiseFraction() {
+    return memory_budget_raise_fraction_;
+  }
+
+  /**
+   * @brief Gives the fraction of the memory budget above which the
+   * single-phase refinement is refused.
+   * @return Refuse fraction.
+   */
+  static constexpr double MemoryBudgetRefuseFraction() {
+    return memory_budget_refuse_fraction_;
+  }
+
+  /**
+   * @brief Gives the number of checks the interface has to stay away from a
+   * multi-phase node before the node becomes single-phase.
+   * @return Removal delay.
+   */
+  static constexpr unsigned int InterfaceRemovalDelay() {
+    return interface_removal_delay_;
+  }
+
+  /**
+   * @brief Gives the distance in blocks on the level of a multi-phase node
+   * within which no node may hold the interface before the node becomes
+   * single-phase.
+   * @return Removal distance.
+   */
+  static constexpr unsigned int InterfaceRemovalDistance() {
+    return interface_removal_distance_;
+  }
+
+  /**
+   * @brief Gives whether the initial mesh is built top-down. "TDI = Top-Down
+   * Initialization".
+   * @return True if only blocks with significant details are refined during
+   * initialization, false otherwise.
+   */
+  static constexpr bool TDI() { return top_down_initialization_; }
+
   /**
    * @brief Indicates whether or not duplicated vertices in the output files
    * should be filtered. Can affect performance.
@@ -754,6 +1012,37 @@ public:
     return output_vertex_filter_;
   }
 
+  /**
+   * @brief Gives the memory layout used for the field buffers.
+   * @return Field buffer layout identifier.
+   */
+  static constexpr FieldBufferLayout FBL() { return field_buffer_layout_; }
+
+  /**
+   * @brief Gives the number of cells per tile in the cell-blocked field buffer
+   * layout.
+   * @return Tile width of the cell-blocked layout.
+   */
+  static constexpr unsigned int FBTW() { return field_buffer_tile_width_; }
+
+  /**
+   * @brief Indicates whether the material parameters are stored in single
+   * precision.
+   * @return True if the parameter buffers hold floats.
+   */
+  static constexpr bool SinglePrecisionParameters() {
+    return single_precision_parameters_;
+  }
+
+  /**
+   * @brief Indicates whether the material fields are stored and computed in
+   * single precision.
+   * @return True if the conservative and prime state buffers hold floats.
+   */
+  static constexpr bool SinglePrecisionFields() {
+    return single_precision_fields_;
+  }
+
   /**
    * @brief Gives the number of topology changes that are allowed on each rank
    * (refinements, coarsenings) before load load balancing
@@ -762,6 +1051,222 @@ public:
   static constexpr unsigned int TCULB() {
     return topology_changes_until_load_balancing_;
   }
+
+  /**
+   * @brief Indicates whether the load balancing cuts the space-filling curve by
+   * accumulated leaf cost.
+   * @return True if cost-weighted load balancing is active.
+   */
+  static constexpr bool CostWeightedLoadBalancing() {
+    return cost_weighted_load_balancing_;
+  }
+
+  /**
+   * @brief Gives the cost of a multi-phase leaf relative to a single-phase
+   * leaf. "MPLC = Multi-Phase Leaf Cost".
+   * @return Relative cost.
+   */
+  static constexpr double MPLC() { return multi_phase_leaf_cost_; }
+
+  /**
+   * @brief Indicates whether the computational cost of each node is measured
+   * for the load balancing.
+   * @return True if node costs are measured.
+   */
+  static constexpr bool MeasureNodeCosts() { return measure_node_costs_; }
+
+  /**
+   * @brief Indicates whether load balancing only moves leaves between
+   * neighboring ranks.
+   * @return True if incremental load balancing is used.
+   */
+  static constexpr bool IncrementalLoadBalancing() {
+    return incremental_load_balancing_;
+  }
+
+  /**
+   * @brief Gives the maximum number of bytes migrated in one incremental load
+   * balancing.
+   * @return Maximum migration volume in bytes.
+   */
+  static constexpr unsigned long long MaximumMigrationBytes() {
+    return maximum_migration_bytes_;
+  }
+
+  /**
+   * @brief Indicates whether MPI halo communication is overlapped with
+   * computations on rank-local nodes.
+   * @return True if overlapping is active.
+   */
+  static constexpr bool OverlapHaloCommunication() {
+    return overlap_halo_communication_;
+  }
+
+  /**
+   * @brief Indicates whether persistent MPI requests are used for no-jump halo
+   * updates.
+   * @return True if persistent requests are used.
+   */
+  static constexpr bool PersistentHaloRequests() {
+    return persistent_halo_requests_;
+  }
+
+  /**
+   * @brief Indicates whether the no-jump MPI halo data is aggregated into one
+   * message per partner rank.
+   * @return True if messages are aggregated.
+   */
+  static constexpr bool AggregateHaloMessages() {
+    return aggregate_halo_messages_;
+  }
+
+  /**
+   * @brief Indicates whether the aggregated halo data of ranks on the same
+   * compute node is exchanged through shared-memory windows.
+   * @return True if shared-memory windows are used.
+   */
+  static constexpr bool SharedMemoryHaloExchange() {
+    return shared_memory_halo_exchange_;
+  }
+
+  /**
+   * @brief Indicates whether the placement of the ranks suggested for the halo
+   * graph is written after the initialization.
+   * @return True if the suggested placement is written.
+   */
+  static constexpr bool HaloGraphRankPlacement() {
+    return halo_graph_rank_placement_;
+  }
+
+  /**
+   * @brief Indicates whether the prime states of single-phase leaves are
+   * recovered in the same sweep as their integration.
+   * @return True if integration and prime-state recovery are fused.
+   */
+  static constexpr bool FusedPrimeStateRecovery() {
+    return fused_prime_state_recovery_;
+  }
+
+  /**
+   * @brief Gives the number of x-planes swept at once in the fused integration
+   * and prime-state recovery.
+   * @return The number of planes per tile ( zero: whole block ).
+   */
+  static constexpr unsigned int FusedIntegrationTilePlanes() {
+    return fused_integration_tile_planes_;
+  }
+
+  /**
+   * @brief Indicates whether level-set halo updates only exchange the values
+   * inside the cut-off band.
+   * @return True if sparse level-set halo messages are used.
+   */
+  static constexpr bool SparseLevelsetHalos() { return sparse_levelset_halos_; }
+
+  /**
+   * @brief Indicates whether interface tag halo updates send uniform regions
+   * as a single value.
+   * @return True if compressed interface tag halo messages are used.
+   */
+  static constexpr bool CompressedInterfaceTagHalos() {
+    return compressed_interface_tag_halos_;
+  }
+
+  /**
+   * @brief Indicates whether the storage of blocks and interface blocks is
+   * recycled in pools.
+   * @return True if block storage is pooled.
+   */
+  static constexpr bool PoolBlockStorage() { return pool_block_storage_; }
+
+  /**
+   * @brief Indicates whether jump buffers are only allocated for blocks at
+   * resolution jumps.
+   * @return True if jump buffers are allocated on demand.
+   */
+  static constexpr bool LazyJumpBuffers() { return lazy_jump_buffers_; }
+
+  /**
+   * @brief Indicates whether the integration buffers are only allocated for
+   * blocks of leaves.
+   * @return True if integration buffers are allocated on demand.
+   */
+  static constexpr bool LazyIntegrationBuffers() {
+    return lazy_integration_buffers_;
+  }
+
+  /**
+   * @brief Indicates whether the initial interface description buffers are
+   * stored band-tiled, i.e. densely only where the interface band passes.
+   * @return True if the initial buffers are band-tiled.
+   */
+  static constexpr bool BandTiledInterfaceInitialBuffers() {
+    return band_tiled_interface_initial_buffers_;
+  }
+
+  /**
+   * @brief Indicates whether leaves are assigned statically to threads and
+   * their blocks placed on the NUMA domain of their thread.
+   * @return True if block memory is placed NUMA-aware.
+   */
+  static constexpr bool NumaAwarePlacement() { return numa_aware_placement_; }
+
+  /**
+   * @brief Indicates whether cell loops dispatch statically on the concrete
+   * equation of state.
+   * @return True if the equation of state is devirtualized per block.
+   */
+  static constexpr bool DevirtualizeEquationOfState() {
+    return devirtualize_equation_of_state_;
+  }
+
+  /**
+   * @brief Indicates whether the interface geometry is cached per stage.
+   * @return True if normals and apertures are cached.
+   */
+  static constexpr bool CacheInterfaceGeometry() {
+    return cache_interface_geometry_;
+  }
+
+  /**
+   * @brief Indicates whether the velocity gradient is cached per stage. Only
+   * takes effect if a shear viscosity model is active.
+   * @return True if the velocity gradient is cached.
+   */
+  static constexpr bool CacheVelocityGradient() {
+    return cache_velocity_gradient_ && ViscosityIsActive() &&
+           ShearViscosityModelActive();
+  }
+
+  /**
+   * @brief Indicates whether only the face halos of single-phase nodes on the
+   * finest level are exchanged. Derived from the active stencils, as the
+   * viscous and heat fluxes need edge and corner halos for their cross
+   * derivatives.
+   * @return True if edge and corner halos are not exchanged.
+   */
+  static constexpr bool FaceHalosOnly() {
+    return face_halos_only_ && DIM() != Dimension::One &&
+           !ViscosityIsActive() && !HeatConductionActive();
+  }
+
+  /**
+   * @brief Indicates whether the viscous and heat fluxes are advanced by
+   * super-time-stepping after each macro timestep. Only takes effect if any of
+   * them is active.
+   * @return True if super-time-stepping is used.
+   */
+  static constexpr bool SuperTimeStepping() {
+    return super_time_stepping_ &&
+           (ViscosityIsActive() || HeatConductionActive());
+  }
+
+  /**
+   * @brief Indicates whether the right-hand side of sibling leaves is computed
+   * per superblock, see ModularAlgorithmAssembler::ComputeRightHandSide.
+   * @return True if the faces shared by siblings are computed once.
+   */
+  static constexpr bool SuperblockExecution() { return superblock_execution_; }
 };
 
 using CC = CompileTimeConstants;
@@ -33,6 +33,13 @@ class DebugProfileSetup {
   static constexpr bool debug_output_ =
       false; // Writes the debug output (mesh and simulation data) to file
   static constexpr bool profiling_ = false;
+  // Number of macro time steps the performance numbers are averaged over
+  static constexpr unsigned int performance_window_ = 10;
+  // Number of macro time steps between two logs of the node counts and the
+  // performance numbers
+  static constexpr unsigned int performance_log_interval_ = 1;
+  // Minimum wall clock time in seconds between two updates of the status file
+  static constexpr double status_interval_ = 60.0;
 
 public:
   /**
@@ -68,6 +75,32 @@ public:
    * @return Profiling decision.
    */
   static constexpr bool Profile() { return profiling_; }
+
+  /**
+   * @brief Gives the number of macro time steps the logged performance numbers
+   * are averaged over ( rolling average ).
+   * @return Number of macro time steps.
+   */
+  static constexpr unsigned int PerformanceWindow() {
+    return performance_window_;
+  }
+
+  /**
+   * @brief Gives the number of macro time steps between two logs of the node
+   * counts and the performance numbers. The numbers are still recorded every
+   * macro time step.
+   * @return Number of macro time steps.
+   */
+  static constexpr unsigned int PerformanceLogInterval() {
+    return performance_log_interval_;
+  }
+
+  /**
+   * @brief Gives the minimum wall clock time between two updates of the status
+   * file in the output folder ( see InputOutputManager::WriteRunStatus ).
+   * @return Interval in seconds.
+   */
+  static constexpr double StatusInterval() { return status_interval_; }
 };
 
 using DP = DebugProfileSetup;
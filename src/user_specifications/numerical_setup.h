@@ -23,7 +23,7 @@
 #define NUMERICAL_SETUP_H
 
 // TIME_INTEGRATION_SCHEME
-enum class TimeIntegrators { RK2, RK3 };
+enum class TimeIntegrators { RK2, RK3, RK3SSP4 };
 constexpr TimeIntegrators time_integrator = TimeIntegrators::RK3;
 
 // MULTI_PHASE_MANAGER
@@ -41,7 +41,7 @@ constexpr LevelsetAdvectors levelset_advector =
     LevelsetAdvectors::HjReconstructionStencil;
 
 // LEVELSET_REINITIALIZER
-enum class LevelsetReinitializers { Min, Weno, Explicit };
+enum class LevelsetReinitializers { Min, Weno, FastSweeping, Explicit };
 constexpr LevelsetReinitializers levelset_reinitializer =
     LevelsetReinitializers::Weno;
 
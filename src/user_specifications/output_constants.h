@@ -22,7 +22,11 @@
 #ifndef OUTPUT_CONSTANTS_H
 #define OUTPUT_CONSTANTS_H
 
+#include <algorithm>
 #include <array>
+#include <string>
+
+#include "block_definitions/field_material_definitions.h"
 
 namespace MaterialFieldOutputSettings {
 /**
@@ -120,6 +124,13 @@ namespace InterfaceFieldOutputSettings {
  */
 constexpr bool use_all_buffers_in_debug = false;
 
+/**
+ * Indicates whether the interface output writes the zero level-set as surface
+ * (triangles in 3D, line segments in 2D) instead of the cell data of all
+ * interface leaves. The interface output quantities are not written then.
+ */
+constexpr bool SurfaceOutput = false;
+
 /**
  * Indicates whether the levelset should be written to the output or not.
  * The array marks { 0: standard output, 1: interface output, 2: debug output }
@@ -223,4 +234,153 @@ constexpr std::array<bool, 3> VortexStretching = {false, false, false};
 static std::string const VortexStretchingName = "vortex_stretching";
 } // namespace CustomOutputSettings
 
+namespace StatisticsOutputSettings {
+/**
+ * Number of macro timesteps between two samples of the running statistics of
+ * the prime states on the leaves ( mean and covariances per cell ). They are
+ * carried along through remeshing and load balancing and written as regular
+ * output quantities, which replaces frequent full outputs that are only
+ * written to average them afterwards. Zero disables the statistics and their
+ * buffers.
+ */
+constexpr unsigned int SamplingInterval = 0;
+/**
+ * Prime states the statistics are gathered for. Only active prime states can
+ * be sampled. The memory of the statistics grows quadratically with their
+ * number due to the covariances.
+ */
+constexpr std::array<PrimeState, 3> SampledPrimeStates = {
+    PrimeState::Density, PrimeState::Pressure, PrimeState::VelocityX};
+static_assert(std::all_of(SampledPrimeStates.begin(), SampledPrimeStates.end(),
+                          MF::IsPrimeStateActive),
+              "Only active prime states can be sampled");
+/**
+ * Indicates whether the means of the sampled prime states should be written to
+ * the output or not. The array marks { 0: standard output, 1: interface output,
+ * 2: debug output }
+ */
+constexpr std::array<bool, 3> Mean = {true, false, false};
+static std::string const MeanName = "statistics_mean";
+/**
+ * Indicates whether the covariances of the sampled prime states should be
+ * written to the output or not. Their diagonal gives the variances, i.e. the
+ * squared root mean square fluctuations. The array marks { 0: standard output,
+ * 1: interface output, 2: debug output }
+ */
+constexpr std::array<bool, 3> Covariance = {true, false, false};
+static std::string const CovarianceName = "statistics_covariance";
+} // namespace StatisticsOutputSettings
+
+namespace Hdf5OutputSettings {
+/**
+ * Indicates whether the hdf5 files are written collectively by all ranks. Each
+ * rank then gathers all its blocks of a dataset and writes them in a single
+ * call with collective buffering. Otherwise, each rank writes its blocks
+ * independently one by one.
+ */
+constexpr bool CollectiveWrites = true;
+/**
+ * Number of blocks (nodes) that are stored together in one chunk of a chunked
+ * dataset.
+ */
+constexpr unsigned int BlocksPerChunk = 64;
+/**
+ * Number of cells that are stored together in one chunk of a compressed
+ * dataset.
+ */
+constexpr unsigned int CellsPerCompressedChunk = 65536;
+/**
+ * Indicates whether the staged blocks of a file are written on a background
+ * thread while the simulation continues. The next file is only opened once the
+ * previous one is written. Requires collective writes, a thread-safe parallel
+ * hdf5 library and full MPI thread support, otherwise files are written
+ * synchronously.
+ */
+constexpr bool AsynchronousWrites = false;
+/**
+ * Number of output steps of a time series that are written into one hdf5 file.
+ * Each step is stored in its own groups of the file and the mesh is only
+ * written again if it changed since the previous step, the time series xdmf
+ * file references the latest mesh then. No xdmf files are written for the
+ * single steps. Once the given number of steps is reached, the next file is
+ * started. Zero writes one hdf5 and one xdmf file per output step. Outputs
+ * outside of a time series and the interface surface output are always written
+ * into one file per step.
+ */
+constexpr unsigned int StepsPerTimeSeriesFile = 0;
+/**
+ * Indicates whether the mesh of an output is only written if it changed since
+ * the previous output of the same type, i.e. after refinement, coarsening, load
+ * balancing or, for the interface output, a change of the materials. The xdmf
+ * files of the following outputs then reference the mesh in the earlier hdf5
+ * file, which has to be kept. Post-processing tools reading the mesh from each
+ * hdf5 file directly require it to be written every time.
+ */
+constexpr bool ReuseUnchangedMesh = false;
+} // namespace Hdf5OutputSettings
+
+namespace RestartOutputSettings {
+/**
+ * Number of differential restart snapshots written between two full
+ * snapshots. A differential snapshot only stores the blocks which changed since
+ * they were last stored and refers to the previous snapshot for all others.
+ * Restoring from it replays the chain of snapshots back to the last full one.
+ * Zero writes full snapshots only.
+ */
+constexpr unsigned int DifferentialSnapshotsPerFullSnapshot = 0;
+/**
+ * Relative change of the conservatives of a block, measured in the maximum
+ * norm per equation, up to which the block is considered unchanged and is not
+ * stored in a differential snapshot.
+ */
+constexpr double DifferentialSnapshotTolerance = 1.0e-10;
+/**
+ * Flag whether restart snapshots only store the cell data of the leaves. The
+ * parents are averaged from their children on restore, which reduces the
+ * volume of the cell data by up to 1/2^d. Snapshots storing all nodes can be
+ * restored either way.
+ */
+constexpr bool LeafOnlySnapshots = true;
+/**
+ * Number of consecutive ranks that form an aggregator group writing the cell
+ * data of their nodes into a common subfile of a restart snapshot. The
+ * snapshot file itself then only holds the metadata and the node information
+ * (index file), which reduces the contention on a single shared file at high
+ * rank counts. Subfiled snapshots can be restored with any number of ranks.
+ * Zero writes all data into a single shared file.
+ */
+constexpr unsigned int SubfileAggregatorGroupSize = 0;
+/**
+ * Number of macro timesteps between two in-memory checkpoints. Each rank keeps
+ * the data of its nodes and a copy of the data of its buddy rank in memory.
+ * If non-physical states ( density or pressure below their physical limits )
+ * or a collapsed timestep size are detected, the simulation is rolled back to
+ * the last checkpoint and retried with a reduced CFL number. If the user
+ * aborts the run ( ABORTFILE ) or the retries are exhausted, a restart
+ * snapshot of the last checkpoint is written before the run stops. Hence,
+ * snapshots on disk can be written rarely. Zero disables the in-memory
+ * checkpoints.
+ */
+constexpr unsigned int InMemoryCheckpointInterval = 0;
+/**
+ * Number of retries from the same in-memory checkpoint before the run stops.
+ */
+constexpr unsigned int MaximumRollbackRetries = 3;
+/**
+ * Factor applied to the CFL number on each retry after a rollback.
+ */
+constexpr double RollbackCflFactor = 0.5;
+/**
+ * Number of macro timesteps the reduced CFL number persists before it is
+ * relaxed to the CFL number of the input file.
+ */
+constexpr unsigned int RollbackReducedCflSteps = 10;
+/**
+ * Safety factor applied to the predicted duration of the next macro timestep
+ * plus the final restart write when deciding whether a walltime-limited run
+ * has to stop. Guards against fluctuations of the step time.
+ */
+constexpr double WalltimeSafetyFactor = 1.5;
+} // namespace RestartOutputSettings
+
 #endif // OUTPUT_CONSTANTS_H
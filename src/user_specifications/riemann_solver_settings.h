@@ -33,6 +33,14 @@ namespace FluxSplittingSettings {
 /* FluxSplitting options are:
  * Roe | LocalLaxFriedrichs | GlobalLaxFriedrichs | Roe_M | LocalLaxFriedrichs_M
  * Roe_M and LocalLaxFriedrichs_M according to \cite Fleischmann20
+ * GlobalLaxFriedrichs needs the maximum eigenvalues of all blocks of all ranks,
+ * i.e. an additional pass over all leaves and a global reduction before the
+ * fluxes of each stage can be computed, and prevents overlapping the halo
+ * update with the right-hand side. LocalLaxFriedrichs is its face-wise
+ * ( Rusanov ) counterpart without global synchronization, which is less
+ * dissipative in quiet regions. A block-wise maximum is not offered, as two
+ * blocks would use different eigenvalues on their shared face and thus break
+ * conservation.
  */
 constexpr FluxSplitting flux_splitting_scheme = FluxSplitting::Roe;
 
@@ -23,20 +23,48 @@
 #define SPACE_FILLING_CURVE_SETTINGS_H
 
 #include "topology/space_filling_curve_index.h"
+#include "utilities/string_operations.h"
+#include <stdexcept>
 #include <string>
 
+/**
+ * @brief Identifier of the space-filling curve the leaves are ordered along
+ * for the load balancing.
+ */
+enum class SpaceFillingCurve { Lebesgue, Hilbert };
+
 namespace SpaceFillingCurveSettings {
-#if DIMENSION != 3
-constexpr auto SfcIndex = LebesgueIndex;
+// Curve used if none is given in the input file
+#if DIMENSION == 1
+constexpr SpaceFillingCurve DefaultSpaceFillingCurve =
+    SpaceFillingCurve::Lebesgue;
 #else
-constexpr auto SfcIndex = HilbertIndex;
+constexpr SpaceFillingCurve DefaultSpaceFillingCurve =
+    SpaceFillingCurve::Hilbert;
 #endif
 
 /**
- * @brief Gives a string representation of the active space-filling curve.
+ * @brief Gives the index function of the given space-filling curve for the
+ * present dimension. In one dimension both curves coincide.
+ * @param curve The space-filling curve.
+ * @return The index function.
  */
-inline std::string SpaceFillingCurveSelectionString() {
-  if (SfcIndex == LebesgueIndex) {
+constexpr SfcIndexFunction IndexFunction(SpaceFillingCurve const curve) {
+  if (curve == SpaceFillingCurve::Lebesgue || DIMENSION == 1) {
+    return LebesgueIndex;
+  }
+  return DIMENSION == 2 ? HilbertIndex2D : HilbertIndex;
+}
+
+constexpr SfcIndexFunction SfcIndex = IndexFunction(DefaultSpaceFillingCurve);
+
+/**
+ * @brief Gives a string representation of the given space-filling curve.
+ * @param curve The space-filling curve, by default the compiled one.
+ */
+inline std::string SpaceFillingCurveSelectionString(
+    SpaceFillingCurve const curve = DefaultSpaceFillingCurve) {
+  if (IndexFunction(curve) == LebesgueIndex) {
     return "Lebesgue-Curve";
   } else {
     return "Hilbert-Curve";
@@ -44,4 +72,24 @@ inline std::string SpaceFillingCurveSelectionString() {
 }
 } // namespace SpaceFillingCurveSettings
 
+/**
+ * @brief Gives the space-filling curve for a given string.
+ * @param curve String that should be converted.
+ * @return Space-filling curve identifier.
+ */
+inline SpaceFillingCurve StringToSpaceFillingCurve(std::string const &curve) {
+  // transform string to upper case without spaces
+  std::string const curve_upper_case(
+      StringOperations::ToUpperCaseWithoutSpaces(curve));
+  // switch statements cannot be used with strings
+  if (curve_upper_case == "LEBESGUE" || curve_upper_case == "MORTON") {
+    return SpaceFillingCurve::Lebesgue;
+  } else if (curve_upper_case == "HILBERT") {
+    return SpaceFillingCurve::Hilbert;
+  } else {
+    throw std::logic_error("Space-filling curve '" + curve_upper_case +
+                           "' not known!");
+  }
+}
+
 #endif // SPACE_FILLING_CURVE_SETTINGS_H
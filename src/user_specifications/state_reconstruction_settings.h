@@ -22,11 +22,33 @@
 #ifndef STATE_RECONSTRUCTION_SETTINGS_H
 #define STATE_RECONSTRUCTION_SETTINGS_H
 
-enum class StateReconstructionType { Conservative, Primitive, Characteristic };
+#include <string>
+
+/* StateReconstructionType options are:
+ * Conservative | Primitive | Characteristic | HybridCharacteristic
+ * HybridCharacteristic reconstructs characteristic states only on faces whose
+ * stencil is flagged by a discontinuity sensor and primitive states on all
+ * other faces. The (Roe) eigendecomposition is skipped on unflagged faces.
+ */
+enum class StateReconstructionType {
+  Conservative,
+  Primitive,
+  Characteristic,
+  HybridCharacteristic
+};
 
 constexpr StateReconstructionType state_reconstruction_type =
     StateReconstructionType::Characteristic;
 
+namespace HybridCharacteristicSettings {
+/* Relative jump of density or pressure between two neighboring cells of a
+ * reconstruction stencil above which the characteristic reconstruction is used
+ * on the face. Stencils touching cells without a valid state ( ghost-fluid
+ * method ) are always flagged.
+ */
+constexpr double discontinuity_threshold = 0.05;
+} // namespace HybridCharacteristicSettings
+
 /**
  * @brief Provides a string representation of the state reconstruction type.
  * @param reconstruction State reconstruction set to be stringified.
@@ -40,6 +62,8 @@ inline std::string SetToString(StateReconstructionType const reconstruction) {
     return "Primitive";
   case StateReconstructionType::Characteristic:
     return "Characteristic";
+  case StateReconstructionType::HybridCharacteristic:
+    return "Hybrid characteristic";
   default:
     return "ERROR: This reconstruction type is not (yet) defined!";
   }
@@ -22,7 +22,11 @@
 #ifndef STENCIL_SETUP_H
 #define STENCIL_SETUP_H
 
+#include <array>
+
 // RECONSTRUCTION_STENCIL
+// CentralTENO5 and CentralWENO5 use a fourth-order central reconstruction in
+// smooth regions and switch to TENO5 or WENO5 only where the data is not smooth
 enum class ReconstructionStencils {
   FirstOrder,
   WENO3,
@@ -38,10 +42,19 @@ enum class ReconstructionStencils {
   TENO5,
   WENOCU6,
   WENO7,
-  WENO9
+  WENO9,
+  CentralTENO5,
+  CentralWENO5
 };
 constexpr ReconstructionStencils reconstruction_stencil =
     ReconstructionStencils::WENO5;
+// Stencils the convective fluxes of the finite-volume scheme are compiled for.
+// One of them is selected at startup in the input file
+// (<numerics><reconstructionStencil>), reconstruction_stencil is used if none
+// is given. Each further stencil adds compile time, the flux kernels stay fully
+// specialized, e.g. {ReconstructionStencils::WENO5,
+// ReconstructionStencils::WENO5Z, ReconstructionStencils::TENO5}
+constexpr std::array runtime_reconstruction_stencils = {reconstruction_stencil};
 constexpr ReconstructionStencils levelset_reconstruction_stencil =
     ReconstructionStencils::WENO3;
 constexpr ReconstructionStencils geometry_reconstruction_stencil =
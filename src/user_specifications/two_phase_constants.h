@@ -55,6 +55,16 @@ constexpr CutCellCriteria CutCellCriteria = CutCellCriteria::ValueBased;
  */
 constexpr GeometryStencilType GeometryStencilType =
     GeometryStencilType::Reconstruction;
+
+/**
+ * Indicates how the interface curvature for capillary forces is estimated.
+ * Height functions of the volume fraction are more accurate on coarse
+ * interfaces; cut cells without well-defined heights fall back to the level-set
+ * derivatives. With CC::CacheInterfaceGeometry() the height-function curvature
+ * is computed once per stage together with the cached geometry.
+ */
+constexpr CurvatureEstimator CurvatureEstimator =
+    CurvatureEstimator::LevelsetDerivatives;
 } // namespace GeometryCalculationSettings
 
 namespace ReinitializationConstants {
@@ -80,6 +90,40 @@ constexpr bool TrackConvergence = true;
  */
 constexpr double MaximumResiduum = 1.0e-3;
 
+/**
+ * The number of iterations between two global convergence checks (only used if
+ * convergence is tracked). Each check is a reduction over all ranks, which is
+ * overlapped with the halo update of the iteration. Larger intervals save
+ * collectives at the cost of up to interval - 1 additional iterations.
+ */
+constexpr unsigned int ConvergenceCheckInterval = 1;
+
+/**
+ * Decision whether nodes which converged and whose neighbors converged are no
+ * longer iterated (only used if convergence is tracked).
+ */
+constexpr bool FreezeConvergedNodes = true;
+
+/**
+ * Decision whether nodes whose level-set field is still close to a
+ * signed-distance function are not reinitialized. The quality of a node is the
+ * maximum deviation of the gradient magnitude of the level set from one in the
+ * extension band.
+ */
+constexpr bool SkipWellResolvedNodes = false;
+
+/**
+ * The maximum deviation of the gradient magnitude from one allowed for a node
+ * to skip the reinitialization (only used if well-resolved nodes are skipped).
+ */
+constexpr double MaximumGradientDeviation = 0.05;
+
+/**
+ * The maximum number of consecutive reinitializations a node may skip (only
+ * used if well-resolved nodes are skipped).
+ */
+constexpr unsigned int MaximumSkippedReinitializations = 4;
+
 /**
  * Decision whether also cut cells are reinitialized.
  */
@@ -96,6 +140,21 @@ static constexpr bool ReinitializeOnlyInLastRkStage = true;
 static constexpr bool ReinitializeAfterMixing = true;
 } // namespace ReinitializationConstants
 
+namespace FastSweepingReinitializationConstants {
+/**
+ * The maximum number of iterations used in the fast sweeping reinitialization.
+ * Each iteration consists of all sweep orderings within each block followed by
+ * a halo update.
+ */
+constexpr unsigned int MaximumNumberOfIterations = 10;
+
+/**
+ * The maximum change of the level-set field (in cell sizes) allowed for
+ * convergence of the fast sweeping reinitialization.
+ */
+constexpr double MaximumResiduum = 1.0e-3;
+} // namespace FastSweepingReinitializationConstants
+
 namespace ExtensionConstants {
 /**
  * The pseudo-timestep size to iteratively solve the extension equation.
@@ -119,6 +178,12 @@ constexpr bool TrackConvergence = true;
  * The maximum residuum allowed if a convergence criteria is applied.
  */
 constexpr double MaximumResiduum = 1.0e-3;
+
+/**
+ * Decision whether nodes which converged and whose neighbors converged are no
+ * longer iterated (only used if convergence is tracked).
+ */
+constexpr bool FreezeConvergedNodes = true;
 } // namespace ExtensionConstants
 
 namespace InterfaceStateTreatmentConstants {
@@ -163,6 +228,12 @@ constexpr unsigned int MaximumNumberOfIterations = 100;
  * The maximum residuum allowed for the interface Riemann problem
  */
 constexpr double MaximumResiduum = 1.0e-6;
+
+/**
+ * Indicates whether the iterations start from the interface pressure of the
+ * previous stage instead of the linearized solution
+ */
+constexpr bool WarmStart = true;
 } // namespace IterativeInterfaceRiemannSolverConstants
 
 #endif // TWO_PHASE_CONSTANTS_H
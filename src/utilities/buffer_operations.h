@@ -46,20 +46,22 @@ inline void SetSingleBuffer(T (&cells)[CC::TCX()][CC::TCY()][CC::TCZ()],
 }
 
 /**
- * @brief Copies all values from a single buffer into another.
- * @tparam T type of the cell values.
+ * @brief Copies all values from a single buffer into another, converting them
+ * if the buffers are stored in different precision.
+ * @tparam S type of the source cell values.
+ * @tparam T type of the target cell values.
  * @param cells_source The buffer holding the cell values that are copied.
  * @param cells_target The buffer holding the cells where the values are copied
  * into.
  */
-template <typename T>
+template <typename S, typename T>
 inline void
-CopySingleBuffer(T const (&cells_source)[CC::TCX()][CC::TCY()][CC::TCZ()],
+CopySingleBuffer(S const (&cells_source)[CC::TCX()][CC::TCY()][CC::TCZ()],
                  T (&cells_target)[CC::TCX()][CC::TCY()][CC::TCZ()]) {
   for (unsigned int i = 0; i < CC::TCX(); ++i) {
     for (unsigned int j = 0; j < CC::TCY(); ++j) {
       for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-        cells_target[i][j][k] = cells_source[i][j][k];
+        cells_target[i][j][k] = static_cast<T>(cells_source[i][j][k]);
       }
     }
   }
@@ -91,11 +93,7 @@ inline void CopyFieldBuffer(BufferType const &source_buffer,
                             BufferType &target_buffer) {
   for (size_t field_index = 0; field_index < BufferType::GetNumberOfFields();
        ++field_index) {
-    double const(&cells_source)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-        source_buffer[field_index];
-    double(&cells_target)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-        target_buffer[field_index];
-    CopySingleBuffer(cells_source, cells_target);
+    CopySingleBuffer(source_buffer[field_index], target_buffer[field_index]);
   }
 }
 
@@ -125,9 +123,9 @@ template <typename BufferType, typename T>
 inline void SetFieldBuffer(BufferType &buffer, T const value) {
   for (size_t field_index = 0; field_index < BufferType::GetNumberOfFields();
        ++field_index) {
-    T(&cells)
-    [CC::TCX()][CC::TCY()][CC::TCZ()] = buffer[field_index];
-    SetSingleBuffer(cells, value);
+    typename BufferType::value_type(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        buffer[field_index];
+    SetSingleBuffer(cells, static_cast<typename BufferType::value_type>(value));
   }
 }
 
@@ -147,8 +145,8 @@ SetFieldBuffer(BufferType &buffer,
                std::array<T, BufferType::GetNumberOfFields()> const &values) {
   for (size_t field_index = 0; field_index < BufferType::GetNumberOfFields();
        ++field_index) {
-    T(&cells)
-    [CC::TCX()][CC::TCY()][CC::TCZ()] = buffer[field_index];
+    typename BufferType::value_type(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        buffer[field_index];
     SetSingleBuffer(cells, values[field_index]);
   }
 }
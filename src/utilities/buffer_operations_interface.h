@@ -48,9 +48,9 @@ inline void CopyInterfaceDescriptionBufferForNode(Node &node) {
   // Get the source and target buffers
   InterfaceBlock &interface_block = node.GetInterfaceBlock();
   double const(&source_description)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      interface_block.GetInterfaceDescriptionBuffer<SourceBuffer>()[Type];
+      interface_block.GetInterfaceDescriptionBuffer<SourceBuffer>(Type);
   double(&target_description)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      interface_block.GetInterfaceDescriptionBuffer<TargetBuffer>()[Type];
+      interface_block.GetInterfaceDescriptionBuffer<TargetBuffer>(Type);
   // Copy the values
   BO::CopySingleBuffer(source_description, target_description);
 }
@@ -80,6 +80,8 @@ inline void CopyInterfaceDescriptionBufferForNodeList(
 /**
  * @brief Swaps the InterfaceDescription buffer of the FirstBuffer and
  * SecondBuffer InterfaceDescriptionBufferType. This is done for a single node.
+ * The interface block only exchanges the assignment of the buffer types, hence
+ * the costs do not depend on the block size.
  * @tparam FirstBuffer The first InterfaceDescriptionBufferType.
  * @tparam SecondBuffer The second InterfaceDescriptionBufferType.
  * @tparam The InterfaceDescription type that should be copied (Default:
@@ -90,13 +92,8 @@ template <InterfaceDescriptionBufferType FirstBuffer,
           InterfaceDescriptionBufferType SecondBuffer,
           InterfaceDescription Type = InterfaceDescription::Levelset>
 inline void SwapInterfaceDescriptionBufferForNode(Node &node) {
-  double(&first_description_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceBlock()
-          .GetInterfaceDescriptionBuffer<FirstBuffer>()[Type];
-  double(&second_description_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-      node.GetInterfaceBlock()
-          .GetInterfaceDescriptionBuffer<SecondBuffer>()[Type];
-  BO::SwapSingleBuffer(first_description_buffer, second_description_buffer);
+  node.GetInterfaceBlock().SwapInterfaceDescriptionBuffers(FirstBuffer,
+                                                           SecondBuffer, Type);
 }
 
 /**
@@ -73,7 +73,9 @@ inline void CopyConservativeBuffersForNodeList(
 
 /**
  * @brief Swaps the Conservative buffer of the FirstBuffer and SecondBuffer
- * ConservativeBufferType. This is done for a single node.
+ * ConservativeBufferType. This is done for a single node. The blocks only
+ * exchange the assignment of the buffer types, hence the costs do not depend
+ * on the block size.
  * @tparam FirstBuffer The first ConservativeBufferType.
  * @tparam SecondBuffer The second ConservativeBufferType.
  * @param node The node for which the buffers are swapped.
@@ -82,11 +84,7 @@ template <ConservativeBufferType FirstBuffer,
           ConservativeBufferType SecondBuffer>
 inline void SwapConservativeBuffersForNode(Node &node) {
   for (auto &mat_block : node.GetPhases()) {
-    Conservatives &first_conservatives =
-        mat_block.second.GetConservativeBuffer<FirstBuffer>();
-    Conservatives &second_conservatives =
-        mat_block.second.GetConservativeBuffer<SecondBuffer>();
-    BO::SwapFieldBuffer(first_conservatives, second_conservatives);
+    mat_block.second.SwapConservativeBuffers(FirstBuffer, SecondBuffer);
   }
 }
 
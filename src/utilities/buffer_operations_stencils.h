@@ -87,6 +87,22 @@ inline void ComputeScalarAtCellFaces(
   }
 }
 
+/**
+ * @brief Single-precision overload, see above. The scalar is converted to
+ * double before it is reconstructed.
+ */
+template <typename ReconstructionStencil>
+inline void ComputeScalarAtCellFaces(
+    float const (&scalar)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double const cell_size,
+    double (&scalar_at_cell_faces)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
+                                  [DTI(CC::DIM())]) {
+  double scalar_double[CC::TCX()][CC::TCY()][CC::TCZ()];
+  CopySingleBuffer(scalar, scalar_double);
+  ComputeScalarAtCellFaces<ReconstructionStencil>(scalar_double, cell_size,
+                                                  scalar_at_cell_faces);
+}
+
 /**
  * @brief Computes a three dimensional vectorial field at the cell faces.
  * @param v1, v2, v3 Buffer containing the x,y,z direction of the vector at the
@@ -102,9 +118,10 @@ inline void ComputeScalarAtCellFaces(
  */
 template <typename ReconstructionStencil>
 inline void ComputeVectorAtCellFaces(
-    double const (&v1)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    double const (&v2)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    double const (&v3)[CC::TCX()][CC::TCY()][CC::TCZ()], double const cell_size,
+    FieldValue const (&v1)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    FieldValue const (&v2)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    FieldValue const (&v3)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double const cell_size,
     double (&vector_at_cell_face)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
                                  [DTI(CC::DIM())][DTI(CC::DIM())]) {
 
@@ -183,9 +200,10 @@ inline void ComputeVectorAtCellFaces(
  */
 template <typename DerivativeStencil>
 inline void ComputeVectorGradientAtCellCenter(
-    double const (&v1)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    double const (&v2)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    double const (&v3)[CC::TCX()][CC::TCY()][CC::TCZ()], double const cell_size,
+    FieldValue const (&v1)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    FieldValue const (&v2)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    FieldValue const (&v3)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double const cell_size,
     double (&vector_gradient)[CC::TCX()][CC::TCY()][CC::TCZ()][DTI(CC::DIM())]
                              [DTI(CC::DIM())]) {
 
@@ -219,9 +237,15 @@ inline void ComputeVectorGradientAtCellCenter(
 }
 
 /**
- * @brief Computes the gradient of a vector at the cell face.
+ * @brief Computes the gradient of a vector at the cell face from its gradient
+ * at the cell center.
  * @param v1, v2, v3 Corresponding components of the vector in x,y,z direction
  * at cell center.
+ * @param gradient_at_cell_center The vector gradient at the cell center, e.g.
+ * from ComputeVectorGradientAtCellCenter(). Description for the positions of
+ * the Array: [CC::TCX()] [CC::TCY()] [CC::TCZ()] [DTI(CC::DIM())]
+ * [DTI(CC::DIM())] Field index x  Field index y  Field index z  Vector
+ * gradient: dv_i / dx_j
  * @param cell_size The cell size used for calculating the derivative.
  * @param gradient_at_cell_faces The corresponding vector components at the cell
  * face. Description for the positions of the Array: [CC::ICX()+1] [CC::ICY()+1]
@@ -229,50 +253,23 @@ inline void ComputeVectorGradientAtCellCenter(
  * x  Field index y  Field index z  Cell face x/y/z   Velocity gradient: dv_i /
  * dx_j
  *
- * @tparam DerivativeStencilCenter type to be used for the computation of the
- * derivative at the cell center.
  * @tparam DerivativeStencilFace type to be used for the explicit derivative
  * computation at a cell face.
  * @tparam ReconstructionStencil type to be used for the reconstruction of
  * derivatives at cell face.
  */
-template <typename DerivativeStencilCenter, typename DerivativeStencilFace,
-          typename ReconstructionStencil>
+template <typename DerivativeStencilFace, typename ReconstructionStencil>
 inline void ComputeVectorGradientAtCellFaces(
-    double const (&v1)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    double const (&v2)[CC::TCX()][CC::TCY()][CC::TCZ()],
-    double const (&v3)[CC::TCX()][CC::TCY()][CC::TCZ()], double const cell_size,
+    FieldValue const (&v1)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    FieldValue const (&v2)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    FieldValue const (&v3)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double const (&gradient_at_cell_center)[CC::TCX()][CC::TCY()][CC::TCZ()]
+                                           [DTI(CC::DIM())][DTI(CC::DIM())],
+    double const cell_size,
     double (&gradient_at_cell_faces)[CC::ICX() + 1][CC::ICY() + 1]
                                     [CC::ICZ() + 1][DTI(CC::DIM())]
                                     [DTI(CC::DIM())][DTI(CC::DIM())]) {
 
-  // Compute first the whole vector gradient at the center positions
-  /**
-   * Description for the positions of the Array:
-   * [CC::ICX()+1]  [CC::ICY()+1]  [CC::ICZ()+1]  [DTI(CC::DIM())]
-   * [DTI(CC::DIM())][DTI(CC::DIM())] Field index x  Field index y  Field index
-   * z  Cell face x/y/z   Velocity gradient: dv_i / dx_j
-   */
-  double gradient_at_cell_center[CC::TCX()][CC::TCY()][CC::TCZ()]
-                                [DTI(CC::DIM())][DTI(CC::DIM())];
-
-  // initialize the gradient tensor
-  for (unsigned int i = 0; i < CC::TCX(); ++i) {
-    for (unsigned int j = 0; j < CC::TCY(); ++j) {
-      for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-        for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
-          for (unsigned int c = 0; c < DTI(CC::DIM()); ++c) {
-            gradient_at_cell_center[i][j][k][r][c] = 0.0;
-          }
-        }
-      } // k
-    }   // j
-  }     // i
-
-  // calculates the vector gradient at the cell center
-  ComputeVectorGradientAtCellCenter<DerivativeStencilCenter>(
-      v1, v2, v3, cell_size, gradient_at_cell_center);
-
   // Carries out the reconstruction of the gradient at the cell face. For
   // appropriate directions a direct computation of the gradient without
   // reconstruction can be carried out (preferred way). For all other cells, a
@@ -448,6 +445,68 @@ inline void ComputeVectorGradientAtCellFaces(
   }
 }
 
+/**
+ * @brief Computes the gradient of a vector at the cell face.
+ * @param v1, v2, v3 Corresponding components of the vector in x,y,z direction
+ * at cell center.
+ * @param cell_size The cell size used for calculating the derivative.
+ * @param gradient_at_cell_faces The corresponding vector components at the cell
+ * face. Description for the positions of the Array: [CC::ICX()+1] [CC::ICY()+1]
+ * [CC::ICZ()+1]  [DTI(CC::DIM())]  [DTI(CC::DIM())][DTI(CC::DIM())] Field index
+ * x  Field index y  Field index z  Cell face x/y/z   Velocity gradient: dv_i /
+ * dx_j
+ *
+ * @tparam DerivativeStencilCenter type to be used for the computation of the
+ * derivative at the cell center.
+ * @tparam DerivativeStencilFace type to be used for the explicit derivative
+ * computation at a cell face.
+ * @tparam ReconstructionStencil type to be used for the reconstruction of
+ * derivatives at cell face.
+ */
+template <typename DerivativeStencilCenter, typename DerivativeStencilFace,
+          typename ReconstructionStencil>
+inline void ComputeVectorGradientAtCellFaces(
+    FieldValue const (&v1)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    FieldValue const (&v2)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    FieldValue const (&v3)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double const cell_size,
+    double (&gradient_at_cell_faces)[CC::ICX() + 1][CC::ICY() + 1]
+                                    [CC::ICZ() + 1][DTI(CC::DIM())]
+                                    [DTI(CC::DIM())][DTI(CC::DIM())]) {
+
+  // Compute first the whole vector gradient at the center positions
+  /**
+   * Description for the positions of the Array:
+   * [CC::ICX()+1]  [CC::ICY()+1]  [CC::ICZ()+1]  [DTI(CC::DIM())]
+   * [DTI(CC::DIM())][DTI(CC::DIM())] Field index x  Field index y  Field index
+   * z  Cell face x/y/z   Velocity gradient: dv_i / dx_j
+   */
+  double gradient_at_cell_center[CC::TCX()][CC::TCY()][CC::TCZ()]
+                                [DTI(CC::DIM())][DTI(CC::DIM())];
+
+  // initialize the gradient tensor
+  for (unsigned int i = 0; i < CC::TCX(); ++i) {
+    for (unsigned int j = 0; j < CC::TCY(); ++j) {
+      for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+        for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
+          for (unsigned int c = 0; c < DTI(CC::DIM()); ++c) {
+            gradient_at_cell_center[i][j][k][r][c] = 0.0;
+          }
+        }
+      } // k
+    }   // j
+  }     // i
+
+  // calculates the vector gradient at the cell center
+  ComputeVectorGradientAtCellCenter<DerivativeStencilCenter>(
+      v1, v2, v3, cell_size, gradient_at_cell_center);
+
+  // reconstructs the gradient at the cell faces
+  ComputeVectorGradientAtCellFaces<DerivativeStencilFace,
+                                   ReconstructionStencil>(
+      v1, v2, v3, gradient_at_cell_center, cell_size, gradient_at_cell_faces);
+}
+
 } // namespace Stencils
 
 } // namespace BufferOperations
@@ -0,0 +1,166 @@
+//===----------------------- hardware_counters.cpp ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "utilities/hardware_counters.h"
+
+#include <cstring>
+#include <limits>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+#ifdef __linux__
+/**
+ * @brief Opens a counter of the calling thread for user-space events, which
+ * starts counting immediately.
+ * @param type The type of the event (generic hardware, cache or raw).
+ * @param config The event identifier within its type.
+ * @return File descriptor of the counter (negative if not available).
+ */
+int OpenEvent(std::uint32_t const type, std::uint64_t const config) {
+  perf_event_attr attributes;
+  std::memset(&attributes, 0, sizeof(attributes));
+  attributes.size = sizeof(attributes);
+  attributes.type = type;
+  attributes.config = config;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  attributes.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(
+      syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0));
+}
+
+/**
+ * @brief Reads a counter and scales it to the time it was enabled (in case the
+ * counter was multiplexed with others).
+ * @param descriptor The file descriptor of the counter.
+ * @return The (scaled) count, NaN if the counter cannot be read.
+ */
+double ReadEvent(int const descriptor) {
+  std::uint64_t values[3] = {0, 0, 0};
+  if (read(descriptor, values, sizeof(values)) !=
+      static_cast<ssize_t>(sizeof(values))) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  return values[2] > 0
+             ? double(values[0]) * double(values[1]) / double(values[2])
+             : 0.0;
+}
+#endif
+} // namespace
+
+/**
+ * @brief Opens the generic and the given floating-point events.
+ * @param flop_events Raw event codes of the processor counting floating-point
+ * instructions and the number of operations per counted instruction.
+ */
+HardwareCounters::HardwareCounters(
+    std::vector<std::pair<std::uint64_t, double>> const &flop_events) {
+  generic_events_.fill(-1);
+#ifdef __linux__
+  generic_events_[HTI(HardwareCounter::Cycles)] =
+      OpenEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+  generic_events_[HTI(HardwareCounter::Instructions)] =
+      OpenEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+  generic_events_[HTI(HardwareCounter::L1DataMisses)] =
+      OpenEvent(PERF_TYPE_HW_CACHE,
+                PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+  generic_events_[HTI(HardwareCounter::LastLevelCacheMisses)] =
+      OpenEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+  for (auto const &[code, weight] : flop_events) {
+    flop_events_.emplace_back(OpenEvent(PERF_TYPE_RAW, code), weight);
+  }
+#else
+  for (auto const &flop_event : flop_events) {
+    flop_events_.emplace_back(-1, flop_event.second);
+  }
+#endif
+}
+
+/**
+ * @brief Closes all opened events.
+ */
+HardwareCounters::~HardwareCounters() {
+#ifdef __linux__
+  for (int const descriptor : generic_events_) {
+    if (descriptor >= 0) {
+      close(descriptor);
+    }
+  }
+  for (auto const &flop_event : flop_events_) {
+    if (flop_event.first >= 0) {
+      close(flop_event.first);
+    }
+  }
+#endif
+}
+
+/**
+ * @brief Indicates whether a counter is measured. Floating-point operations are
+ * only available if events are given and all of them could be opened.
+ * @param counter The hardware counter.
+ * @return True if the counter is available, false otherwise.
+ */
+bool HardwareCounters::IsAvailable(HardwareCounter const counter) const {
+  if (counter == HardwareCounter::FloatingPointOperations) {
+    if (flop_events_.empty()) {
+      return false;
+    }
+    for (auto const &flop_event : flop_events_) {
+      if (flop_event.first < 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+  return generic_events_[HTI(counter)] >= 0;
+}
+
+/**
+ * @brief Gives the current counts of the calling thread. Only differences of
+ * two reads are meaningful.
+ * @return The counts, NaN for unavailable counters.
+ */
+HardwareCounters::Counts HardwareCounters::Read() const {
+  Counts counts;
+  counts.fill(std::numeric_limits<double>::quiet_NaN());
+#ifdef __linux__
+  for (std::size_t index = 0; index < generic_events_.size(); ++index) {
+    if (generic_events_[index] >= 0) {
+      counts[index] = ReadEvent(generic_events_[index]);
+    }
+  }
+  if (IsAvailable(HardwareCounter::FloatingPointOperations)) {
+    double operations = 0.0;
+    for (auto const &[descriptor, weight] : flop_events_) {
+      operations += weight * ReadEvent(descriptor);
+    }
+    counts[HTI(HardwareCounter::FloatingPointOperations)] = operations;
+  }
+#endif
+  return counts;
+}
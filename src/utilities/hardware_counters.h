@@ -0,0 +1,90 @@
+//===------------------------ hardware_counters.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef HARDWARE_COUNTERS_H
+#define HARDWARE_COUNTERS_H
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Identifier of the counted hardware events.
+ */
+enum class HardwareCounter : std::size_t {
+  Cycles = 0,
+  Instructions = 1,
+  L1DataMisses = 2,
+  LastLevelCacheMisses = 3,
+  FloatingPointOperations = 4
+};
+
+/**
+ * @brief The HardwareCounters give access to the performance monitoring unit
+ * of the processor through the Linux perf_event interface. The generic events
+ * (cycles, instructions, L1 data cache read misses and last-level cache misses)
+ * are always requested. Floating-point operations have no generic event, they
+ * are summed from processor-specific raw events with a weight each (e.g. the
+ * number of operations of a packed vector instruction). Events that cannot be
+ * opened (missing permissions, virtual machines, other platforms) are marked
+ * unavailable. The counters only cover the calling thread and user-space
+ * instructions. If the hardware multiplexes the events, the counts are scaled
+ * by the fraction of time they were active.
+ */
+class HardwareCounters {
+
+public:
+  static constexpr std::size_t number_of_counters_ = 5;
+  using Counts = std::array<double, number_of_counters_>;
+
+private:
+  // file descriptors of the generic events (negative if not available)
+  std::array<int, number_of_counters_ - 1> generic_events_;
+  // file descriptors and weights of the floating-point events
+  std::vector<std::pair<int, double>> flop_events_;
+
+public:
+  explicit HardwareCounters(
+      std::vector<std::pair<std::uint64_t, double>> const &flop_events);
+  HardwareCounters() = delete;
+  ~HardwareCounters();
+  HardwareCounters(HardwareCounters const &) = delete;
+  HardwareCounters &operator=(HardwareCounters const &) = delete;
+  HardwareCounters(HardwareCounters &&) = delete;
+  HardwareCounters &operator=(HardwareCounters &&) = delete;
+
+  bool IsAvailable(HardwareCounter const counter) const;
+  Counts Read() const;
+};
+
+/**
+ * @brief Converts a HardwareCounter into its index in the counts.
+ * @param counter The hardware counter.
+ * @return Index of the counter.
+ */
+constexpr std::underlying_type<HardwareCounter>::type
+HTI(HardwareCounter const counter) {
+  return static_cast<std::underlying_type<HardwareCounter>::type>(counter);
+}
+
+#endif // HARDWARE_COUNTERS_H
@@ -0,0 +1,184 @@
+//===----------------------- memory_statistics.cpp ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "utilities/memory_statistics.h"
+
+#include <algorithm>
+#include <fstream>
+#include <mpi.h>
+
+#include "communication/mpi_utilities.h"
+#include "utilities/string_operations.h"
+
+std::array<std::size_t, number_of_memory_categories_>
+    MemoryStatistics::current_bytes_ = {};
+std::array<std::size_t, number_of_memory_categories_>
+    MemoryStatistics::high_water_bytes_ = {};
+
+namespace {
+/**
+ * @brief Number of rows of the report, i.e. the categories, their total and the
+ * resident memory of the process.
+ */
+constexpr unsigned int number_of_report_rows_ =
+    number_of_memory_categories_ + 2;
+
+/**
+ * @brief Reads an entry of the status file of the process.
+ * @param key The key of the entry (e.g. VmRSS).
+ * @return The value in bytes (zero if not available, e.g. on other platforms
+ * than Linux).
+ */
+double ProcessStatusBytes(std::string const &key) {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.rfind(key + ":", 0) == 0) {
+      // Values are given in kB
+      return 1024.0 * std::stod(line.substr(key.size() + 1));
+    }
+  }
+  return 0.0;
+}
+} // namespace
+
+/**
+ * @brief Gives the name of a memory category.
+ * @param category The memory category.
+ * @return The name of the category.
+ */
+std::string MemoryCategoryToString(MemoryCategory const category) {
+  switch (category) {
+  case MemoryCategory::Blocks:
+    return "Blocks";
+  case MemoryCategory::InterfaceBlocks:
+    return "InterfaceBlocks";
+  case MemoryCategory::Topology:
+    return "Topology";
+  case MemoryCategory::Communication:
+    return "Communication";
+  case MemoryCategory::Checkpoint:
+    return "Checkpoint";
+  default:
+    return "InputOutput";
+  }
+}
+
+/**
+ * @brief Sets the persistent memory of a category and raises its high-water
+ * mark if exceeded.
+ * @param category The memory category.
+ * @param bytes The bytes currently held in the category.
+ */
+void MemoryStatistics::SetCurrent(MemoryCategory const category,
+                                  std::size_t const bytes) {
+  unsigned int const index = static_cast<unsigned int>(category);
+  current_bytes_[index] = bytes;
+  high_water_bytes_[index] = std::max(high_water_bytes_[index], bytes);
+}
+
+/**
+ * @brief Records a transient buffer held on top of the persistent memory of a
+ * category and raises the high-water mark if exceeded.
+ * @param category The memory category.
+ * @param bytes The bytes of the transient buffer.
+ */
+void MemoryStatistics::RecordTransient(MemoryCategory const category,
+                                       std::size_t const bytes) {
+  unsigned int const index = static_cast<unsigned int>(category);
+  high_water_bytes_[index] =
+      std::max(high_water_bytes_[index], current_bytes_[index] + bytes);
+}
+
+/**
+ * @brief Gives the memory currently held by the rank, i.e. the larger of the
+ * resident memory of the process and the total of the categories.
+ * @return The memory in bytes.
+ */
+double CurrentMemoryBytes() {
+  double total = 0.0;
+  for (std::size_t const bytes : MemoryStatistics::current_bytes_) {
+    total += double(bytes);
+  }
+  return std::max(total, ProcessStatusBytes("VmRSS"));
+}
+
+/**
+ * @brief Gives the minimum, mean and maximum memory of all ranks in each
+ * category together with the largest high-water mark of the ranks. The total
+ * of the categories (its peak being the sum of the high-water marks) and the
+ * resident memory of the process (as seen by the operating system) are added
+ * as last rows. Must be called by all ranks.
+ * @return The lines of the report table in MB (only valid on rank 0).
+ */
+std::vector<std::string> MemoryReport() {
+  std::array<double, number_of_report_rows_> current = {};
+  std::array<double, number_of_report_rows_> high_water = {};
+  for (unsigned int index = 0; index < number_of_memory_categories_; ++index) {
+    current[index] = double(MemoryStatistics::current_bytes_[index]);
+    high_water[index] = double(MemoryStatistics::high_water_bytes_[index]);
+    current[number_of_memory_categories_] += current[index];
+    high_water[number_of_memory_categories_] += high_water[index];
+  }
+  current.back() = ProcessStatusBytes("VmRSS");
+  high_water.back() = ProcessStatusBytes("VmHWM");
+
+  std::array<double, number_of_report_rows_> minimum;
+  std::array<double, number_of_report_rows_> maximum;
+  std::array<double, number_of_report_rows_> summed;
+  std::array<double, number_of_report_rows_> maximum_high_water;
+  MPI_Reduce(current.data(), minimum.data(), number_of_report_rows_, MPI_DOUBLE,
+             MPI_MIN, 0, MpiUtilities::Communicator());
+  MPI_Reduce(current.data(), maximum.data(), number_of_report_rows_, MPI_DOUBLE,
+             MPI_MAX, 0, MpiUtilities::Communicator());
+  MPI_Reduce(current.data(), summed.data(), number_of_report_rows_, MPI_DOUBLE,
+             MPI_SUM, 0, MpiUtilities::Communicator());
+  MPI_Reduce(high_water.data(), maximum_high_water.data(),
+             number_of_report_rows_, MPI_DOUBLE, MPI_MAX, 0,
+             MpiUtilities::Communicator());
+
+  std::vector<std::string> lines;
+  if (!MpiUtilities::MasterRank()) {
+    return lines;
+  }
+  double const number_of_ranks = double(MpiUtilities::NumberOfRanks());
+  auto const column = [](std::string const &entry, std::size_t const width) {
+    return entry + StringOperations::Indent(
+                       width > entry.size() ? width - entry.size() : 1);
+  };
+  auto const megabytes = [](double const bytes) {
+    return StringOperations::ToScientificNotationString(bytes / 1.0e6, 3);
+  };
+  lines.push_back(column("Memory per rank", 20) + column("Min [MB]", 12) +
+                  column("Mean [MB]", 12) + column("Max [MB]", 12) +
+                  "Peak [MB]");
+  for (unsigned int index = 0; index < number_of_report_rows_; ++index) {
+    std::string const name =
+        index < number_of_memory_categories_
+            ? MemoryCategoryToString(MemoryCategory(index))
+            : (index == number_of_memory_categories_ ? "Total" : "Resident");
+    lines.push_back(column(name, 20) + column(megabytes(minimum[index]), 12) +
+                    column(megabytes(summed[index] / number_of_ranks), 12) +
+                    column(megabytes(maximum[index]), 12) +
+                    megabytes(maximum_high_water[index]));
+  }
+  return lines;
+}
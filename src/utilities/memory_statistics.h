@@ -0,0 +1,96 @@
+//===------------------------ memory_statistics.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef MEMORY_STATISTICS_H
+#define MEMORY_STATISTICS_H
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Categories of the memory the statistics are gathered for.
+ * @note Do not change the underlying type. Used for index mapping.
+ */
+enum class MemoryCategory : unsigned short {
+  Blocks = 0,
+  InterfaceBlocks = 1,
+  Topology = 2,
+  Communication = 3,
+  InputOutput = 4,
+  Checkpoint = 5
+};
+
+/**
+ * @brief Number of memory categories.
+ */
+constexpr unsigned int number_of_memory_categories_ = 6;
+
+std::string MemoryCategoryToString(MemoryCategory const category);
+
+/**
+ * @brief The MemoryStatistics struct gathers the memory held by the rank in
+ * each category. The persistent memory (blocks, topology, caches) is estimated
+ * by its owners and set at each report, transient buffers (e.g. halo or output
+ * staging buffers) are recorded when they are allocated. Both feed the
+ * high-water mark of the category.
+ */
+struct MemoryStatistics {
+public:
+  static std::array<std::size_t, number_of_memory_categories_> current_bytes_;
+  static std::array<std::size_t, number_of_memory_categories_>
+      high_water_bytes_;
+
+  static void SetCurrent(MemoryCategory const category,
+                         std::size_t const bytes);
+  static void RecordTransient(MemoryCategory const category,
+                              std::size_t const bytes);
+};
+
+/**
+ * @brief Gives the bytes allocated by a vector (its capacity).
+ * @param vector The vector.
+ * @return The allocated bytes.
+ */
+template <typename T> std::size_t CapacityBytes(std::vector<T> const &vector) {
+  return vector.capacity() * sizeof(T);
+}
+
+/**
+ * @brief Gives the bytes allocated by a vector of vectors, i.e. by the outer
+ * vector and all inner ones.
+ * @param vectors The vector of vectors.
+ * @return The allocated bytes.
+ */
+template <typename T>
+std::size_t CapacityBytes(std::vector<std::vector<T>> const &vectors) {
+  std::size_t bytes = vectors.capacity() * sizeof(std::vector<T>);
+  for (std::vector<T> const &vector : vectors) {
+    bytes += CapacityBytes(vector);
+  }
+  return bytes;
+}
+
+double CurrentMemoryBytes();
+std::vector<std::string> MemoryReport();
+
+#endif // MEMORY_STATISTICS_H
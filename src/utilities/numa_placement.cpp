@@ -0,0 +1,134 @@
+//===------------------------- numa_placement.cpp -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "utilities/numa_placement.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace NumaPlacement {
+
+/**
+ * @brief Gives the NUMA domain of the core the calling thread runs on.
+ * @return The domain index, -1 if it cannot be determined.
+ */
+int CurrentDomain() {
+#ifdef __linux__
+  unsigned int cpu = 0;
+  unsigned int domain = 0;
+  if (syscall(SYS_getcpu, &cpu, &domain, nullptr) == 0) {
+    return static_cast<int>(domain);
+  }
+#endif
+  return -1;
+}
+
+/**
+ * @brief Moves the pages of a memory range to the given NUMA domain. The
+ * addresses are unchanged, pages already in the domain are left alone.
+ * @param address Start of the memory range.
+ * @param bytes Size of the memory range.
+ * @param domain The target domain, nothing is moved if negative.
+ * @note Pages at the ends of the range may be shared with other objects, which
+ * are moved along.
+ */
+void MoveToDomain(void const *const address, std::size_t const bytes,
+                  int const domain) {
+#ifdef __linux__
+  if (domain < 0 || bytes == 0) {
+    return;
+  }
+  // MPOL_MF_MOVE of numaif.h: moves only pages used exclusively by the process
+  constexpr int move_owned_pages = 1 << 1;
+  std::uintptr_t const page_size =
+      static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+  std::uintptr_t const begin =
+      reinterpret_cast<std::uintptr_t>(address) & ~(page_size - 1);
+  std::uintptr_t const end = reinterpret_cast<std::uintptr_t>(address) + bytes;
+  std::vector<void *> pages;
+  for (std::uintptr_t page = begin; page < end; page += page_size) {
+    pages.push_back(reinterpret_cast<void *>(page));
+  }
+  std::vector<int> const domains(pages.size(), domain);
+  std::vector<int> status(pages.size());
+  syscall(SYS_move_pages, 0, pages.size(), pages.data(), domains.data(),
+          status.data(), move_owned_pages);
+#else
+  (void)address;
+  (void)bytes;
+  (void)domain;
+#endif
+}
+
+/**
+ * @brief Pins each OpenMP thread to one core of the cores the rank may run on.
+ * The threads are spread evenly over the cores, such that they keep the NUMA
+ * domain their data is placed on. Explicit affinity settings of the user (
+ * OMP_PROC_BIND or OMP_PLACES ) take precedence.
+ * @return Description of the applied affinity for the log.
+ */
+std::string PinThreads() {
+#if defined(_OPENMP) && defined(__linux__)
+  if (std::getenv("OMP_PROC_BIND") != nullptr ||
+      std::getenv("OMP_PLACES") != nullptr) {
+    return "Thread affinity given by OMP_PROC_BIND/OMP_PLACES";
+  }
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    return "Threads not pinned: cores of the rank unknown";
+  }
+  std::vector<int> cores;
+  for (int core = 0; core < CPU_SETSIZE; ++core) {
+    if (CPU_ISSET(core, &allowed)) {
+      cores.push_back(core);
+    }
+  }
+  if (cores.size() < static_cast<std::size_t>(omp_get_max_threads())) {
+    return "Threads not pinned: fewer cores than threads";
+  }
+#pragma omp parallel
+  {
+    std::size_t const thread = static_cast<std::size_t>(omp_get_thread_num());
+    std::size_t const threads = static_cast<std::size_t>(omp_get_num_threads());
+    cpu_set_t core;
+    CPU_ZERO(&core);
+    CPU_SET(cores[thread * cores.size() / threads], &core);
+    pthread_setaffinity_np(pthread_self(), sizeof(core), &core);
+  }
+  return "Threads pinned to " + std::to_string(omp_get_max_threads()) + " of " +
+         std::to_string(cores.size()) + " cores";
+#else
+  return "Threads not pinned";
+#endif
+}
+
+} // namespace NumaPlacement
@@ -0,0 +1,41 @@
+//===-------------------------- numa_placement.h --------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef NUMA_PLACEMENT_H
+#define NUMA_PLACEMENT_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Functions to place memory and threads on the NUMA domains of a
+ * compute node ( see CC::NumaAwarePlacement() ). All functions are best-effort:
+ * If the operating system does not support them, they leave the placement
+ * unchanged.
+ */
+namespace NumaPlacement {
+int CurrentDomain();
+void MoveToDomain(void const *const address, std::size_t const bytes,
+                  int const domain);
+std::string PinThreads();
+} // namespace NumaPlacement
+
+#endif // NUMA_PLACEMENT_H
@@ -0,0 +1,111 @@
+//===-------------------------- phase_timer.cpp ---------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "utilities/phase_timer.h"
+#include <mpi.h>
+#include <numeric>
+
+#include "communication/mpi_utilities.h"
+#include "utilities/string_operations.h"
+
+namespace {
+/**
+ * @brief Width of the phase column in the summary.
+ */
+constexpr std::size_t phase_column_width_ = 36;
+
+/**
+ * @brief Pads an entry of the summary to the width of its column.
+ * @param entry The entry of the column.
+ * @param width The width of the column.
+ * @return The padded entry.
+ */
+std::string Column(std::string const &entry, std::size_t const width) {
+  return entry.size() < width
+             ? entry + StringOperations::Indent(width - entry.size())
+             : entry + " ";
+}
+} // namespace
+
+/**
+ * @brief Creates the timer, the first phase starts immediately.
+ */
+PhaseTimer::PhaseTimer() : lap_start_(MPI_Wtime()) {}
+
+/**
+ * @brief Closes the current phase and starts the next one.
+ * @param name Name of the closed phase.
+ */
+void PhaseTimer::Lap(std::string const &name) {
+  double const now = MPI_Wtime();
+  names_.push_back(name);
+  times_.push_back(now - lap_start_);
+  lap_start_ = now;
+}
+
+/**
+ * @brief Gives the time of all closed phases of this rank.
+ * @return The summed time in seconds.
+ */
+double PhaseTimer::Total() const {
+  return std::accumulate(times_.cbegin(), times_.cend(), 0.0);
+}
+
+/**
+ * @brief Gives the minimum, mean and maximum time of each phase over all ranks.
+ * @return The lines of the summary (empty on all ranks but rank 0).
+ * @note All ranks must have passed the same phases in the same order.
+ */
+std::vector<std::string> PhaseTimer::Summary() const {
+  std::vector<double> times(times_);
+  times.push_back(Total());
+  int const number_of_entries = static_cast<int>(times.size());
+  std::vector<double> minimum_times(times.size());
+  std::vector<double> maximum_times(times.size());
+  std::vector<double> summed_times(times.size());
+  MPI_Reduce(times.data(), minimum_times.data(), number_of_entries, MPI_DOUBLE,
+             MPI_MIN, 0, MpiUtilities::Communicator());
+  MPI_Reduce(times.data(), maximum_times.data(), number_of_entries, MPI_DOUBLE,
+             MPI_MAX, 0, MpiUtilities::Communicator());
+  MPI_Reduce(times.data(), summed_times.data(), number_of_entries, MPI_DOUBLE,
+             MPI_SUM, 0, MpiUtilities::Communicator());
+
+  std::vector<std::string> lines;
+  if (!MpiUtilities::MasterRank()) {
+    return lines;
+  }
+  double const number_of_ranks = double(MpiUtilities::NumberOfRanks());
+  lines.push_back(Column("Phase", phase_column_width_) + Column("Min [s]", 12) +
+                  Column("Mean [s]", 12) + "Max [s]");
+  for (std::size_t index = 0; index < times.size(); ++index) {
+    lines.push_back(
+        Column(index < names_.size() ? names_[index] : "Total",
+               phase_column_width_) +
+        Column(StringOperations::ToScientificNotationString(
+                   minimum_times[index], 3),
+               12) +
+        Column(StringOperations::ToScientificNotationString(
+                   summed_times[index] / number_of_ranks, 3),
+               12) +
+        StringOperations::ToScientificNotationString(maximum_times[index], 3));
+  }
+  return lines;
+}
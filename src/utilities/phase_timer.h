@@ -0,0 +1,54 @@
+//===--------------------------- phase_timer.h ----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef PHASE_TIMER_H
+#define PHASE_TIMER_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief The PhaseTimer measures the wall-clock time of consecutive phases,
+ * e.g. of the startup of a simulation. Each lap closes the current phase and
+ * starts the next one. Unlike the RuntimeProfiler, it does not depend on the
+ * input file and is always active, hence it also covers the phases before the
+ * profiler is set up.
+ */
+class PhaseTimer {
+  std::vector<std::string> names_;
+  std::vector<double> times_;
+  double lap_start_;
+
+public:
+  explicit PhaseTimer();
+  ~PhaseTimer() = default;
+  PhaseTimer(PhaseTimer const &) = delete;
+  PhaseTimer &operator=(PhaseTimer const &) = delete;
+  PhaseTimer(PhaseTimer &&) = delete;
+  PhaseTimer &operator=(PhaseTimer &&) = delete;
+
+  void Lap(std::string const &name);
+  double Total() const;
+  // Collective call giving the summary of all ranks (only valid on rank 0)
+  std::vector<std::string> Summary() const;
+};
+
+#endif // PHASE_TIMER_H
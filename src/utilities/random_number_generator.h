@@ -1,26 +1,84 @@
 #ifndef RANDOM_NUMBER_GENERATOR_H
 #define RANDOM_NUMBER_GENERATOR_H
 
-#include <random>
+#include <array>
+#include <cstdint>
 
+/**
+ * @brief Counter-based random number generator ( Philox4x32-10, see \cite
+ * Salmon2011 ). A number is a pure function of the seed, the stream, the
+ * substream and the number of draws since the stream was set. Hence, keying
+ * the stream by, e.g., node id and cell index gives the same numbers
+ * independent of rank count, thread count and evaluation order.
+ */
 class RandomNumberGenerator {
 
-  std::mt19937_64 gen_; // Standard mersenne_twister_engine
-  std::uniform_real_distribution<> dis_;
+  static constexpr std::uint32_t multiplier_0_ = 0xD2511F53;
+  static constexpr std::uint32_t multiplier_1_ = 0xCD9E8D57;
+  static constexpr std::uint32_t key_increment_0_ = 0x9E3779B9;
+  static constexpr std::uint32_t key_increment_1_ = 0xBB67AE85;
 
-  // Singleton has only privat Constructor
-  explicit RandomNumberGenerator(int const rank_id)
-      : gen_(rank_id), dis_(-1.0, +1.0) {}
+  std::array<std::uint32_t, 2> const key_;
+  // { draw, substream, stream ( low ), stream ( high ) }
+  std::array<std::uint32_t, 4> counter_;
 
 public:
-  // Singelton "Constructor":
-  static RandomNumberGenerator &Instance(int const rank_id = 0);
+  static constexpr std::uint64_t DefaultSeed = 0;
 
-  // Singeltons may never call these methods.
-  RandomNumberGenerator(const RandomNumberGenerator &) = delete;
-  void operator=(const RandomNumberGenerator &) = delete;
+  explicit RandomNumberGenerator(std::uint64_t const seed = DefaultSeed)
+      : key_({static_cast<std::uint32_t>(seed),
+              static_cast<std::uint32_t>(seed >> 32)}),
+        counter_({0, 0, 0, 0}) {}
 
-  double GiveRandomNumber() { return dis_(gen_); }
+  /**
+   * @brief Selects the stream the following numbers are drawn from and resets
+   * the draw counter.
+   * @param stream The stream, e.g., the node id.
+   * @param substream The substream, e.g., the cell index within the node.
+   */
+  void SetStream(std::uint64_t const stream,
+                 std::uint32_t const substream = 0) {
+    counter_ = {0, substream, static_cast<std::uint32_t>(stream),
+                static_cast<std::uint32_t>(stream >> 32)};
+  }
+
+  /**
+   * @brief Gives the next number of the current stream.
+   * @return Uniformly distributed number in [-1, 1).
+   */
+  double GiveRandomNumber() {
+    std::array<std::uint32_t, 4> const bits = Philox(counter_, key_);
+    counter_[0]++;
+    std::uint64_t const mantissa =
+        ((std::uint64_t(bits[0]) << 32) | std::uint64_t(bits[1])) >> 11;
+    // 2^-52 maps the 53 bits onto [0, 2)
+    return double(mantissa) * 0x1.0p-52 - 1.0;
+  }
+
+  /**
+   * @brief The Philox4x32 bijection with ten rounds.
+   * @param counter The counter to be encrypted.
+   * @param key The key.
+   * @return The 128 random bits belonging to the counter.
+   */
+  static constexpr std::array<std::uint32_t, 4>
+  Philox(std::array<std::uint32_t, 4> counter,
+         std::array<std::uint32_t, 2> key) {
+    for (unsigned int round = 0; round < 10; ++round) {
+      std::uint64_t const product_0 =
+          std::uint64_t(multiplier_0_) * std::uint64_t(counter[0]);
+      std::uint64_t const product_1 =
+          std::uint64_t(multiplier_1_) * std::uint64_t(counter[2]);
+      counter = {
+          static_cast<std::uint32_t>(product_1 >> 32) ^ counter[1] ^ key[0],
+          static_cast<std::uint32_t>(product_1),
+          static_cast<std::uint32_t>(product_0 >> 32) ^ counter[3] ^ key[1],
+          static_cast<std::uint32_t>(product_0)};
+      key[0] += key_increment_0_;
+      key[1] += key_increment_1_;
+    }
+    return counter;
+  }
 };
 
 #endif // RANDOM_NUMBER_GENERATOR_H
@@ -0,0 +1,462 @@
+//===------------------------ runtime_profiler.cpp ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "utilities/runtime_profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mpi.h>
+#include <stdexcept>
+
+#include "communication/mpi_utilities.h"
+#include "simulation_context.h"
+#include "utilities/string_operations.h"
+
+namespace {
+/**
+ * @brief Width of the region column in the summary.
+ */
+constexpr std::size_t region_column_width_ = 44;
+
+/**
+ * @brief Number of bytes transferred from memory per last-level cache miss.
+ */
+constexpr double cache_line_size_ = 64.0;
+
+/**
+ * @brief Gives the part of a region path up to its last separator, i.e. the
+ * path of the parent region.
+ * @param path The path of the region.
+ * @return The path of the parent region (empty for top-level regions).
+ */
+std::string ParentPath(std::string const &path) {
+  std::size_t const separator = path.rfind('/');
+  return separator == std::string::npos ? "" : path.substr(0, separator);
+}
+
+/**
+ * @brief Pads an entry of the summary to the width of its column. Entries
+ * exceeding the width are separated by a single space.
+ * @param entry The entry of the column.
+ * @param width The width of the column.
+ * @return The padded entry.
+ */
+std::string Column(std::string const &entry, std::size_t const width) {
+  return entry.size() < width
+             ? entry + StringOperations::Indent(width - entry.size())
+             : entry + " ";
+}
+
+/**
+ * @brief Gives the region column of the summary, i.e. the name of the region
+ * indented according to its depth in the region tree.
+ * @param path The path of the region.
+ * @return The padded region column.
+ */
+std::string RegionColumn(std::string const &path) {
+  unsigned int const depth = std::count(path.begin(), path.end(), '/');
+  std::string const name =
+      path.substr(ParentPath(path).size() + (depth > 0 ? 1 : 0));
+  return Column(StringOperations::Indent(2 * depth) + name,
+                region_column_width_);
+}
+
+/**
+ * @brief Adds a path to the ordered union of paths. Paths that are not present
+ * yet are inserted behind the last descendant of their parent, which keeps the
+ * tree order.
+ * @param path The path to be added.
+ * @param paths The union of paths (indirect return parameter).
+ */
+void AddToUnion(std::string const &path, std::vector<std::string> &paths) {
+  if (std::find(paths.begin(), paths.end(), path) != paths.end()) {
+    return;
+  }
+  std::string const parent = ParentPath(path);
+  if (parent.empty()) {
+    paths.push_back(path);
+    return;
+  }
+  auto const is_in_subtree = [&parent](std::string const &candidate) {
+    return candidate == parent || candidate.rfind(parent + "/", 0) == 0;
+  };
+  auto const last_in_subtree =
+      std::find_if(paths.rbegin(), paths.rend(), is_in_subtree);
+  paths.insert(last_in_subtree.base(), path);
+}
+} // namespace
+
+/**
+ * @brief Creates the (disabled) profiler with the root region.
+ */
+RuntimeProfiler::RuntimeProfiler() : regions_({Region{"", 0, {}}}) {
+  /** Empty besides initializer list */
+}
+
+/**
+ * @brief Gives the profiler of the current simulation context (see
+ * SimulationContext::Current()). If the context has no profiler yet it is
+ * created, otherwise the existing one is passed back.
+ * @return The profiler instance.
+ */
+RuntimeProfiler &RuntimeProfiler::Instance() {
+  return SimulationContext::Current().Profiler();
+}
+
+/**
+ * @brief Enables or disables the measurement of regions. Must not be called
+ * while regions are open.
+ * @param enable Flag whether regions are measured.
+ */
+void RuntimeProfiler::Enable(bool const enable) { enabled_ = enable; }
+
+/**
+ * @brief Enables or disables the recording of the timeline of the regions,
+ * which requires the profiler to be enabled. The origin of the timeline is
+ * synchronized among all ranks, hence, it must be called by all ranks.
+ * @param enable Flag whether the timeline is recorded.
+ */
+void RuntimeProfiler::EnableTracing(bool const enable) {
+  tracing_ = enable;
+  MPI_Barrier(MpiUtilities::Communicator());
+  trace_origin_ = MPI_Wtime();
+}
+
+/**
+ * @brief Enables the collection of hardware counters in all regions. Must not
+ * be called while regions are open.
+ * @param flop_events Raw event codes of the processor counting floating-point
+ * instructions and the number of operations per counted instruction.
+ */
+void RuntimeProfiler::EnableHardwareCounters(
+    std::vector<std::pair<std::uint64_t, double>> const &flop_events) {
+  counters_ = std::make_unique<HardwareCounters>(flop_events);
+}
+
+/**
+ * @brief Stops the collection of hardware counters and releases them. Must not
+ * be called while regions are open.
+ */
+void RuntimeProfiler::DisableHardwareCounters() { counters_.reset(); }
+
+/**
+ * @brief Indicates whether a hardware counter is measured.
+ * @param counter The hardware counter.
+ * @return True if hardware counters are enabled and the counter is available,
+ * false otherwise.
+ */
+bool RuntimeProfiler::IsCounterAvailable(HardwareCounter const counter) const {
+  return counters_ && counters_->IsAvailable(counter);
+}
+
+/**
+ * @brief Starts a sub-region of the active region, which becomes the active
+ * one until it is stopped.
+ * @param name Name of the region.
+ */
+void RuntimeProfiler::Start(std::string const &name) {
+  if (!enabled_) {
+    return;
+  }
+  std::vector<std::size_t> const &children = regions_[active_region_].children_;
+  auto const child = std::find_if(children.begin(), children.end(),
+                                  [this, &name](std::size_t const index) {
+                                    return regions_[index].name_ == name;
+                                  });
+  if (child != children.end()) {
+    active_region_ = *child;
+  } else {
+    std::size_t const parent = active_region_;
+    active_region_ = regions_.size();
+    regions_.push_back(Region{name, parent, {}});
+    regions_[parent].children_.push_back(active_region_);
+  }
+  if (counters_) {
+    start_counts_.push_back(counters_->Read());
+  }
+  start_times_.push_back(MPI_Wtime());
+  if (tracing_) {
+    trace_events_.push_back({active_region_, start_times_.back(), true});
+  }
+}
+
+/**
+ * @brief Stops the active region and activates its parent again.
+ */
+void RuntimeProfiler::Stop() {
+  if (!enabled_) {
+    return;
+  }
+#ifndef PERFORMANCE
+  if (start_times_.empty()) {
+    throw std::logic_error("A profiler region is stopped without being "
+                           "started!");
+  }
+#endif
+  double const stop_time = MPI_Wtime();
+  if (tracing_) {
+    trace_events_.push_back({active_region_, stop_time, false});
+  }
+  Region &region = regions_[active_region_];
+  region.time_ += stop_time - start_times_.back();
+  region.calls_++;
+  start_times_.pop_back();
+  if (counters_) {
+    HardwareCounters::Counts const stop_counts = counters_->Read();
+    for (std::size_t index = 0; index < stop_counts.size(); ++index) {
+      region.counts_[index] += stop_counts[index] - start_counts_.back()[index];
+    }
+    start_counts_.pop_back();
+  }
+  active_region_ = region.parent_;
+}
+
+/**
+ * @brief Removes all measured regions. Must not be called while regions are
+ * open.
+ */
+void RuntimeProfiler::Reset() {
+  regions_.assign(1, Region{"", 0, {}});
+  active_region_ = 0;
+  start_times_.clear();
+  start_counts_.clear();
+  trace_events_.clear();
+}
+
+/**
+ * @brief Appends the path, time and number of calls of a region and all its
+ * descendants in depth-first order.
+ * @param region Index of the region.
+ * @param parent_path Path of the parent region.
+ * @param paths Paths of the regions (indirect return parameter).
+ * @param times Accumulated times of the regions (indirect return parameter).
+ * @param calls Number of calls of the regions (indirect return parameter).
+ * @param counts Hardware counts of the regions, one after another (indirect
+ * return parameter).
+ */
+void RuntimeProfiler::AppendPaths(std::size_t const region,
+                                  std::string const &parent_path,
+                                  std::vector<std::string> &paths,
+                                  std::vector<double> &times,
+                                  std::vector<double> &calls,
+                                  std::vector<double> &counts) const {
+  std::string const path = parent_path.empty()
+                               ? regions_[region].name_
+                               : parent_path + "/" + regions_[region].name_;
+  paths.push_back(path);
+  times.push_back(regions_[region].time_);
+  calls.push_back(double(regions_[region].calls_));
+  counts.insert(counts.end(), regions_[region].counts_.begin(),
+                regions_[region].counts_.end());
+  for (std::size_t const child : regions_[region].children_) {
+    AppendPaths(child, path, paths, times, calls, counts);
+  }
+}
+
+/**
+ * @brief Combines the measurements of all ranks into the minimum, mean and
+ * maximum (inclusive) time of each region. Regions that are not measured on a
+ * rank count as zero time on this rank. If hardware counters are collected, a
+ * second table with the derived rates follows. Must be called by all ranks.
+ * @return The lines of the summary tables (only valid on rank 0).
+ */
+std::vector<std::string> RuntimeProfiler::Summary() const {
+
+  std::vector<std::string> local_paths;
+  std::vector<double> local_times;
+  std::vector<double> local_calls;
+  std::vector<double> local_counts;
+  for (std::size_t const child : regions_.front().children_) {
+    AppendPaths(child, "", local_paths, local_times, local_calls, local_counts);
+  }
+
+  // Union of the regions of all ranks in the same order on all ranks
+  std::string local_names;
+  for (std::string const &path : local_paths) {
+    local_names += path + "\n";
+  }
+  int const number_of_ranks = MpiUtilities::NumberOfRanks();
+  int const local_length = static_cast<int>(local_names.size());
+  std::vector<int> lengths(number_of_ranks);
+  MPI_Allgather(&local_length, 1, MPI_INT, lengths.data(), 1, MPI_INT,
+                MpiUtilities::Communicator());
+  std::vector<int> offsets(number_of_ranks, 0);
+  for (int rank = 1; rank < number_of_ranks; ++rank) {
+    offsets[rank] = offsets[rank - 1] + lengths[rank - 1];
+  }
+  std::string all_names(offsets.back() + lengths.back(), '\0');
+  MPI_Allgatherv(local_names.data(), local_length, MPI_CHAR, all_names.data(),
+                 lengths.data(), offsets.data(), MPI_CHAR,
+                 MpiUtilities::Communicator());
+  std::vector<std::string> paths;
+  std::size_t begin = 0;
+  for (std::size_t end = all_names.find('\n'); end != std::string::npos;
+       end = all_names.find('\n', begin)) {
+    AddToUnion(all_names.substr(begin, end - begin), paths);
+    begin = end + 1;
+  }
+
+  // Local measurements in the order of the union
+  constexpr std::size_t number_of_counters =
+      HardwareCounters::number_of_counters_;
+  std::vector<double> times(paths.size(), 0.0);
+  std::vector<double> calls(paths.size(), 0.0);
+  std::vector<double> counts(paths.size() * number_of_counters, 0.0);
+  for (std::size_t index = 0; index < local_paths.size(); ++index) {
+    std::size_t const position =
+        std::distance(paths.begin(), std::find(paths.begin(), paths.end(),
+                                               local_paths[index]));
+    times[position] = local_times[index];
+    calls[position] = local_calls[index];
+    std::copy_n(local_counts.begin() + index * number_of_counters,
+                number_of_counters,
+                counts.begin() + position * number_of_counters);
+  }
+  int const number_of_regions = static_cast<int>(paths.size());
+  std::vector<double> minimum_times(paths.size());
+  std::vector<double> maximum_times(paths.size());
+  std::vector<double> summed_times(paths.size());
+  std::vector<double> maximum_calls(paths.size());
+  MPI_Reduce(times.data(), minimum_times.data(), number_of_regions, MPI_DOUBLE,
+             MPI_MIN, 0, MpiUtilities::Communicator());
+  MPI_Reduce(times.data(), maximum_times.data(), number_of_regions, MPI_DOUBLE,
+             MPI_MAX, 0, MpiUtilities::Communicator());
+  MPI_Reduce(times.data(), summed_times.data(), number_of_regions, MPI_DOUBLE,
+             MPI_SUM, 0, MpiUtilities::Communicator());
+  MPI_Reduce(calls.data(), maximum_calls.data(), number_of_regions, MPI_DOUBLE,
+             MPI_MAX, 0, MpiUtilities::Communicator());
+  if (counters_) {
+    MPI_Reduce(MpiUtilities::MasterRank() ? MPI_IN_PLACE : counts.data(),
+               counts.data(), static_cast<int>(counts.size()), MPI_DOUBLE,
+               MPI_SUM, 0, MpiUtilities::Communicator());
+  }
+
+  std::vector<std::string> lines;
+  if (!MpiUtilities::MasterRank()) {
+    return lines;
+  }
+  lines.push_back(Column("Region", region_column_width_) + Column("Calls", 12) +
+                  Column("Min [s]", 12) + Column("Mean [s]", 12) + "Max [s]");
+  for (std::size_t index = 0; index < paths.size(); ++index) {
+    lines.push_back(
+        RegionColumn(paths[index]) +
+        Column(std::to_string(
+                   static_cast<unsigned long long int>(maximum_calls[index])),
+               12) +
+        Column(StringOperations::ToScientificNotationString(
+                   minimum_times[index], 3),
+               12) +
+        Column(StringOperations::ToScientificNotationString(
+                   summed_times[index] / double(number_of_ranks), 3),
+               12) +
+        StringOperations::ToScientificNotationString(maximum_times[index], 3));
+  }
+  if (counters_) {
+    std::vector<std::string> const counter_lines =
+        CounterSummary(paths, summed_times, counts);
+    lines.insert(lines.end(), counter_lines.begin(), counter_lines.end());
+  }
+  return lines;
+}
+
+/**
+ * @brief Gives the table of the rates derived from the hardware counts of all
+ * ranks. The rates are averaged over the ranks, i.e. the summed counts are
+ * divided by the summed times. The memory traffic is estimated from the
+ * last-level cache misses, hence, it neglects prefetches and write-backs.
+ * Unavailable counters are given as n.a.
+ * @param paths The paths of the regions.
+ * @param summed_times The times of the regions summed over all ranks.
+ * @param counts The counts of the regions summed over all ranks, one after
+ * another.
+ * @return The lines of the counter table.
+ */
+std::vector<std::string>
+RuntimeProfiler::CounterSummary(std::vector<std::string> const &paths,
+                                std::vector<double> const &summed_times,
+                                std::vector<double> const &counts) const {
+  constexpr std::size_t number_of_counters =
+      HardwareCounters::number_of_counters_;
+  auto const ratio = [](double const numerator, double const denominator,
+                        bool const available) {
+    return available && denominator > 0.0 && std::isfinite(numerator)
+               ? StringOperations::ToScientificNotationString(
+                     numerator / denominator, 3)
+               : std::string("n.a.");
+  };
+  bool const has_flops =
+      IsCounterAvailable(HardwareCounter::FloatingPointOperations);
+  bool const has_misses =
+      IsCounterAvailable(HardwareCounter::LastLevelCacheMisses);
+  bool const has_cycles = IsCounterAvailable(HardwareCounter::Cycles) &&
+                          IsCounterAvailable(HardwareCounter::Instructions);
+  bool const has_l1 = IsCounterAvailable(HardwareCounter::L1DataMisses) &&
+                      IsCounterAvailable(HardwareCounter::Instructions);
+
+  std::vector<std::string> lines;
+  lines.push_back(Column("Region", region_column_width_) +
+                  Column("GFLOP/s", 12) + Column("GB/s", 12) +
+                  Column("FLOP/Byte", 12) + Column("IPC", 12) + "L1D MPKI");
+  for (std::size_t index = 0; index < paths.size(); ++index) {
+    double const *region_counts = counts.data() + index * number_of_counters;
+    double const flops =
+        region_counts[HTI(HardwareCounter::FloatingPointOperations)];
+    double const bytes =
+        cache_line_size_ *
+        region_counts[HTI(HardwareCounter::LastLevelCacheMisses)];
+    double const instructions =
+        region_counts[HTI(HardwareCounter::Instructions)];
+    lines.push_back(
+        RegionColumn(paths[index]) +
+        Column(ratio(1.0e-9 * flops, summed_times[index], has_flops), 12) +
+        Column(ratio(1.0e-9 * bytes, summed_times[index], has_misses), 12) +
+        Column(ratio(flops, bytes, has_flops && has_misses), 12) +
+        Column(ratio(instructions, region_counts[HTI(HardwareCounter::Cycles)],
+                     has_cycles),
+               12) +
+        ratio(1.0e3 * region_counts[HTI(HardwareCounter::L1DataMisses)],
+              instructions, has_l1));
+  }
+  return lines;
+}
+
+/**
+ * @brief Gives the recorded timeline of the rank as events in the Chrome trace
+ * event format (one JSON object per event). The rank is used as process id and
+ * the times are given in microseconds since the origin of the timeline.
+ * @return The events, preceded by the naming of the process.
+ */
+std::vector<std::string> RuntimeProfiler::TraceEvents() const {
+  std::string const process_id = std::to_string(MpiUtilities::MyRankId());
+  std::vector<std::string> events;
+  events.reserve(trace_events_.size() + 1);
+  events.push_back(
+      "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + process_id +
+      ",\"tid\":0,\"args\":{\"name\":\"Rank " + process_id + "\"}}");
+  for (TraceEvent const &event : trace_events_) {
+    events.push_back(
+        "{\"name\":\"" + regions_[event.region_].name_ + "\",\"ph\":\"" +
+        (event.begin_ ? "B" : "E") +
+        "\",\"ts\":" + std::to_string(1.0e6 * (event.time_ - trace_origin_)) +
+        ",\"pid\":" + process_id + ",\"tid\":0}");
+  }
+  return events;
+}
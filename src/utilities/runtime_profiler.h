@@ -0,0 +1,159 @@
+//===------------------------- runtime_profiler.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef RUNTIME_PROFILER_H
+#define RUNTIME_PROFILER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "utilities/hardware_counters.h"
+
+/**
+ * @brief The RuntimeProfiler measures the wall-clock time spent in nested
+ * regions of the code (region -> sub-region) on each rank. Regions are
+ * identified by their name and their parent region, hence, the same name can
+ * appear in different branches of the region tree. The measurements are purely
+ * local, no synchronization is done while timing. Only the summary combines the
+ * times of all ranks into their minimum, mean and maximum. The profiler is
+ * always compiled and enabled at runtime. While disabled, starting and stopping
+ * regions returns immediately. Optionally, the begin and end of each region
+ * are recorded as events of a timeline (trace) of the rank. Hardware counters
+ * can be collected per region in addition, they are summarized as achieved
+ * floating-point rate, memory bandwidth and arithmetic intensity.
+ * @note One instance per simulation, see SimulationContext.
+ */
+class RuntimeProfiler {
+
+  /**
+   * @brief A region of the tree with its accumulated (inclusive) time.
+   */
+  struct Region {
+    std::string name_;
+    std::size_t parent_;
+    std::vector<std::size_t> children_;
+    double time_ = 0.0;
+    unsigned long long int calls_ = 0;
+    HardwareCounters::Counts counts_ = {};
+  };
+
+  /**
+   * @brief Begin or end of a region in the timeline of the rank.
+   */
+  struct TraceEvent {
+    std::size_t region_;
+    double time_;
+    bool begin_;
+  };
+
+  bool enabled_ = false;
+  bool tracing_ = false;
+  // regions of the tree, the first one is the root covering the whole run
+  std::vector<Region> regions_;
+  // currently active region and the start times of all open regions
+  std::size_t active_region_ = 0;
+  std::vector<double> start_times_;
+  // recorded timeline and its origin (identical on all ranks)
+  std::vector<TraceEvent> trace_events_;
+  double trace_origin_ = 0.0;
+  // hardware counters (if enabled) and their values at the start of all open
+  // regions
+  std::unique_ptr<HardwareCounters> counters_;
+  std::vector<HardwareCounters::Counts> start_counts_;
+
+  explicit RuntimeProfiler();
+  friend class SimulationContext;
+
+  void AppendPaths(std::size_t const region, std::string const &parent_path,
+                   std::vector<std::string> &paths, std::vector<double> &times,
+                   std::vector<double> &calls,
+                   std::vector<double> &counts) const;
+  std::vector<std::string>
+  CounterSummary(std::vector<std::string> const &paths,
+                 std::vector<double> const &summed_times,
+                 std::vector<double> const &counts) const;
+
+public:
+  // Instance of the current simulation context
+  static RuntimeProfiler &Instance();
+
+  ~RuntimeProfiler() = default;
+  RuntimeProfiler(RuntimeProfiler const &) = delete;
+  RuntimeProfiler &operator=(RuntimeProfiler const &) = delete;
+  RuntimeProfiler(RuntimeProfiler &&) = delete;
+  RuntimeProfiler &operator=(RuntimeProfiler &&) = delete;
+
+  void Enable(bool const enable = true);
+  /**
+   * @brief Indicates whether regions are measured.
+   * @return True if the profiler is enabled, false otherwise.
+   */
+  inline bool IsEnabled() const { return enabled_; }
+  void EnableTracing(bool const enable = true);
+  /**
+   * @brief Indicates whether the timeline of the regions is recorded.
+   * @return True if tracing is enabled, false otherwise.
+   */
+  inline bool IsTracing() const { return tracing_; }
+  void EnableHardwareCounters(
+      std::vector<std::pair<std::uint64_t, double>> const &flop_events);
+  void DisableHardwareCounters();
+  /**
+   * @brief Indicates whether hardware counters are collected per region.
+   * @return True if hardware counters are collected, false otherwise.
+   */
+  inline bool HasHardwareCounters() const { return counters_ != nullptr; }
+  bool IsCounterAvailable(HardwareCounter const counter) const;
+
+  void Start(std::string const &name);
+  void Stop();
+  void Reset();
+  // Collective call giving the summary of all ranks (only valid on rank 0)
+  std::vector<std::string> Summary() const;
+  std::vector<std::string> TraceEvents() const;
+};
+
+/**
+ * @brief Measures the time of a region of the RuntimeProfiler from its creation
+ * until it goes out of scope.
+ */
+class ProfileRegion {
+public:
+  /**
+   * @brief Starts the region.
+   * @param name Name of the region.
+   */
+  explicit ProfileRegion(std::string const &name) {
+    RuntimeProfiler::Instance().Start(name);
+  }
+  /**
+   * @brief Stops the region.
+   */
+  ~ProfileRegion() { RuntimeProfiler::Instance().Stop(); }
+  ProfileRegion() = delete;
+  ProfileRegion(ProfileRegion const &) = delete;
+  ProfileRegion &operator=(ProfileRegion const &) = delete;
+  ProfileRegion(ProfileRegion &&) = delete;
+  ProfileRegion &operator=(ProfileRegion &&) = delete;
+};
+
+#endif // RUNTIME_PROFILER_H
@@ -89,9 +89,9 @@ inline void ComputeShearRateTensor(
  */
 template <typename DerivativeStencil>
 inline void
-ComputeShearRate(double const (&u)[CC::TCX()][CC::TCY()][CC::TCZ()],
-                 double const (&v)[CC::TCX()][CC::TCY()][CC::TCZ()],
-                 double const (&w)[CC::TCX()][CC::TCY()][CC::TCZ()],
+ComputeShearRate(FieldValue const (&u)[CC::TCX()][CC::TCY()][CC::TCZ()],
+                 FieldValue const (&v)[CC::TCX()][CC::TCY()][CC::TCZ()],
+                 FieldValue const (&w)[CC::TCX()][CC::TCY()][CC::TCZ()],
                  double const cell_size,
                  double (&shear_rate)[CC::TCX()][CC::TCY()][CC::TCZ()]) {
 
@@ -159,24 +159,14 @@ ComputeShearRate(double const (&u)[CC::TCX()][CC::TCY()][CC::TCZ()],
 }
 
 /**
- * @brief Computes the shear rate for a given velocity vectorial velocity field
- * at a certain position.
- * @param u,v,w Velocity buffer for which th shear rate is computed.
- * @param cell_size size of the cell for gradient computation.
- * @param i, j ,k indices at which position the shear rate should be computed.
- * @return shear rate at the given position.
+ * @brief Computes the shear rate for a single velocity gradient tensor.
+ * @param velocity_gradient Velocity gradient tensor for which the shear rate is
+ * computed.
+ * @return shear rate of the given velocity gradient.
  */
-template <typename DerivativeStencil>
-inline double
-ComputeShearRate(double const (&u)[CC::TCX()][CC::TCY()][CC::TCZ()],
-                 double const (&v)[CC::TCX()][CC::TCY()][CC::TCZ()],
-                 double const (&w)[CC::TCX()][CC::TCY()][CC::TCZ()],
-                 double const cell_size, unsigned int const i,
-                 unsigned int const j, unsigned int const k) {
+inline double ComputeShearRate(
+    std::array<std::array<double, 3>, 3> const &velocity_gradient) {
 
-  // Calculate the velocity gradient
-  std::array<std::array<double, 3>, 3> const velocity_gradient =
-      SU::JacobianMatrix<DerivativeStencil>(u, v, w, i, j, k, cell_size);
   std::array<std::array<double, 3>, 3> shear_rate_tensor = {
       {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}}};
   std::array<std::array<double, 3>, 3> shear_rate_tensor_squared = {
@@ -197,6 +187,50 @@ ComputeShearRate(double const (&u)[CC::TCX()][CC::TCY()][CC::TCZ()],
   return 2.0 * std::sqrt(std::abs(second_invariant_of_shear_rate_tensor));
 }
 
+/**
+ * @brief Computes the shear rate for a given velocity vectorial velocity field
+ * at a certain position.
+ * @param u,v,w Velocity buffer for which th shear rate is computed.
+ * @param cell_size size of the cell for gradient computation.
+ * @param i, j ,k indices at which position the shear rate should be computed.
+ * @return shear rate at the given position.
+ */
+template <typename DerivativeStencil>
+inline double
+ComputeShearRate(FieldValue const (&u)[CC::TCX()][CC::TCY()][CC::TCZ()],
+                 FieldValue const (&v)[CC::TCX()][CC::TCY()][CC::TCZ()],
+                 FieldValue const (&w)[CC::TCX()][CC::TCY()][CC::TCZ()],
+                 double const cell_size, unsigned int const i,
+                 unsigned int const j, unsigned int const k) {
+
+  // Calculate the velocity gradient
+  return ComputeShearRate(
+      SU::JacobianMatrix<DerivativeStencil>(u, v, w, i, j, k, cell_size));
+}
+
+/**
+ * @brief Computes the shear rate at a certain position from a given velocity
+ * gradient in the full buffer (e.g. the cached one of a block).
+ * @param velocity_gradient Velocity gradient tensor du_i / dx_j for the full
+ * buffer.
+ * @param i, j ,k indices at which position the shear rate should be computed.
+ * @return shear rate at the given position.
+ */
+inline double ComputeShearRate(
+    double const (&velocity_gradient)[CC::TCX()][CC::TCY()][CC::TCZ()]
+                                     [DTI(CC::DIM())][DTI(CC::DIM())],
+    unsigned int const i, unsigned int const j, unsigned int const k) {
+
+  std::array<std::array<double, 3>, 3> cell_gradient = {
+      {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}}};
+  for (unsigned int r = 0; r < DTI(CC::DIM()); ++r) {
+    for (unsigned int c = 0; c < DTI(CC::DIM()); ++c) {
+      cell_gradient[r][c] = velocity_gradient[i][j][k][r][c];
+    }
+  }
+  return ComputeShearRate(cell_gradient);
+}
+
 } // namespace ShearRateOperations
 
 #endif // SHEAR_RATE_UTILITIES_H
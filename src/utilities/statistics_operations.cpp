@@ -0,0 +1,165 @@
+//===--------------------- statistics_operations.cpp ----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "utilities/statistics_operations.h"
+
+#include <algorithm>
+#include <array>
+
+#include "multiresolution/multiresolution.h"
+
+namespace StatisticsOperations {
+
+/**
+ * @brief Adds the current prime states of the internal cells as sample to the
+ * running statistics ( Welford's algorithm, generalized to covariances ).
+ * @param prime_states The prime states of the block.
+ * @param statistics The statistics of the block.
+ */
+void Sample(PrimeStates const &prime_states, StatisticsBuffers &statistics) {
+  constexpr unsigned int number_of_states =
+      StatisticsBuffers::number_of_states_;
+  constexpr auto const &states = StatisticsOutputSettings::SampledPrimeStates;
+  std::array<double, number_of_states> deviation_from_old_mean;
+  std::array<double, number_of_states> deviation_from_new_mean;
+  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+        double &samples =
+            statistics[StatisticsBuffers::SamplesIndex()][i][j][k];
+        samples += 1.0;
+        double const weight = 1.0 / samples;
+        for (unsigned int a = 0; a < number_of_states; ++a) {
+          double const value = prime_states.Value(PTI(states[a]), i, j, k);
+          double &mean = statistics[StatisticsBuffers::MeanIndex(a)][i][j][k];
+          deviation_from_old_mean[a] = value - mean;
+          mean += deviation_from_old_mean[a] * weight;
+          deviation_from_new_mean[a] = value - mean;
+        }
+        for (unsigned int a = 0; a < number_of_states; ++a) {
+          for (unsigned int b = a; b < number_of_states; ++b) {
+            double &covariance =
+                statistics[StatisticsBuffers::CovarianceIndex(a, b)][i][j][k];
+            covariance +=
+                (deviation_from_old_mean[a] * deviation_from_new_mean[b] -
+                 covariance) *
+                weight;
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Converts the covariances of all cells into raw second moments, i.e.
+ * the means of the products of the sampled prime states.
+ * @param statistics The statistics of the block.
+ */
+void ToRawMoments(StatisticsBuffers &statistics) {
+  constexpr unsigned int number_of_states =
+      StatisticsBuffers::number_of_states_;
+  for (unsigned int a = 0; a < number_of_states; ++a) {
+    auto const &mean_a = statistics[StatisticsBuffers::MeanIndex(a)];
+    for (unsigned int b = a; b < number_of_states; ++b) {
+      auto const &mean_b = statistics[StatisticsBuffers::MeanIndex(b)];
+      auto &moment = statistics[StatisticsBuffers::CovarianceIndex(a, b)];
+      for (unsigned int i = 0; i < CC::TCX(); ++i) {
+        for (unsigned int j = 0; j < CC::TCY(); ++j) {
+          for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+            moment[i][j][k] += mean_a[i][j][k] * mean_b[i][j][k];
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Converts raw second moments of all cells back into covariances ( see
+ * ToRawMoments() ). Variances that became negative through the interpolation
+ * of the moments are set to zero.
+ * @param statistics The statistics of the block.
+ */
+void ToCentralMoments(StatisticsBuffers &statistics) {
+  constexpr unsigned int number_of_states =
+      StatisticsBuffers::number_of_states_;
+  for (unsigned int a = 0; a < number_of_states; ++a) {
+    auto const &mean_a = statistics[StatisticsBuffers::MeanIndex(a)];
+    for (unsigned int b = a; b < number_of_states; ++b) {
+      auto const &mean_b = statistics[StatisticsBuffers::MeanIndex(b)];
+      auto &moment = statistics[StatisticsBuffers::CovarianceIndex(a, b)];
+      for (unsigned int i = 0; i < CC::TCX(); ++i) {
+        for (unsigned int j = 0; j < CC::TCY(); ++j) {
+          for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+            moment[i][j][k] -= mean_a[i][j][k] * mean_b[i][j][k];
+            if (a == b) {
+              moment[i][j][k] = std::max(moment[i][j][k], 0.0);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Fills the halo cells of all moments with the values of the closest
+ * internal cell. The statistics take no part in the halo updates, yet the
+ * prediction stencil reaches into the halo cells of the parent.
+ * @param statistics The statistics of the block.
+ */
+void ExtendIntoHalos(StatisticsBuffers &statistics) {
+  for (unsigned int moment = 0; moment < StatisticsBuffers::GetNumberOfFields();
+       ++moment) {
+    auto &values = statistics[moment];
+    for (unsigned int i = 0; i < CC::TCX(); ++i) {
+      unsigned int const i_internal = std::clamp(i, CC::FICX(), CC::LICX());
+      for (unsigned int j = 0; j < CC::TCY(); ++j) {
+        unsigned int const j_internal = std::clamp(j, CC::FICY(), CC::LICY());
+        for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+          unsigned int const k_internal = std::clamp(k, CC::FICZ(), CC::LICZ());
+          values[i][j][k] = values[i_internal][j_internal][k_internal];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Predicts the internal cells of all moments of a child from its
+ * parent.
+ * @param parent The statistics of the parent as raw moments with filled halo
+ * cells ( see ToRawMoments() and ExtendIntoHalos() ).
+ * @param child The statistics of the child to receive the raw moments.
+ * @param child_id The id of the child.
+ */
+void Predict(StatisticsBuffers const &parent, StatisticsBuffers &child,
+             nid_t const child_id) {
+  for (unsigned int moment = 0; moment < StatisticsBuffers::GetNumberOfFields();
+       ++moment) {
+    Multiresolution::Prediction(parent[moment], child[moment], child_id,
+                                CC::FICX(), CC::ICX(), CC::FICY(), CC::ICY(),
+                                CC::FICZ(), CC::ICZ());
+  }
+}
+
+} // namespace StatisticsOperations
@@ -0,0 +1,48 @@
+//===---------------------- statistics_operations.h -----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef STATISTICS_OPERATIONS_H
+#define STATISTICS_OPERATIONS_H
+
+#include "block_definitions/block.h"
+#include "topology/id_information.h"
+
+/**
+ * @brief Operations on the running statistics of the blocks ( see
+ * StatisticsBuffers ). The statistics are kept as central moments, which are
+ * updated robustly sample by sample. For the transfer between the levels the
+ * covariances are converted to raw second moments, which are linear in the
+ * samples and thus can be averaged and predicted like the conservatives.
+ */
+namespace StatisticsOperations {
+
+void Sample(PrimeStates const &prime_states, StatisticsBuffers &statistics);
+void ToRawMoments(StatisticsBuffers &statistics);
+void ToCentralMoments(StatisticsBuffers &statistics);
+void ExtendIntoHalos(StatisticsBuffers &statistics);
+void Predict(StatisticsBuffers const &parent, StatisticsBuffers &child,
+             nid_t const child_id);
+
+} // namespace StatisticsOperations
+
+namespace SO = StatisticsOperations;
+
+#endif // STATISTICS_OPERATIONS_H
@@ -0,0 +1,55 @@
+//===-------------------------- stop_signal.cpp ---------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "utilities/stop_signal.h"
+
+#include <csignal>
+
+namespace {
+// Only lock-free atomic flags may be written in a signal handler
+volatile std::sig_atomic_t stop_signal_received_ = 0;
+
+/**
+ * @brief Records the reception of a stop signal.
+ */
+void HandleStopSignal(int) { stop_signal_received_ = 1; }
+} // namespace
+
+namespace StopSignal {
+
+/**
+ * @brief Installs the handler for the stop signals ( SIGUSR1 and SIGTERM ).
+ * Afterwards, these signals no longer terminate the process, but are only
+ * recorded.
+ */
+void Install() {
+  std::signal(SIGUSR1, HandleStopSignal);
+  std::signal(SIGTERM, HandleStopSignal);
+}
+
+/**
+ * @brief Indicates whether a stop signal was received by this rank since the
+ * handler was installed.
+ * @return True if a stop signal was received, false otherwise.
+ */
+bool Received() { return stop_signal_received_ != 0; }
+
+} // namespace StopSignal
@@ -0,0 +1,36 @@
+//===--------------------------- stop_signal.h ----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef STOP_SIGNAL_H
+#define STOP_SIGNAL_H
+
+/**
+ * @brief Catches the signals batch systems send ahead of the time limit of a
+ * job ( SIGUSR1, e.g. Slurm's --signal option, and SIGTERM ), such that the
+ * run can write a final restart snapshot and stop cleanly instead of being
+ * killed.
+ */
+namespace StopSignal {
+void Install();
+bool Received();
+} // namespace StopSignal
+
+#endif // STOP_SIGNAL_H
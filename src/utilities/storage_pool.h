@@ -0,0 +1,195 @@
+//===------------------------- storage_pool.h -----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef STORAGE_POOL_H
+#define STORAGE_POOL_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "user_specifications/compile_time_constants.h"
+
+/**
+ * @brief The StoragePool class recycles memory chunks of one size. Released
+ * chunks are kept and handed out again instead of being returned to the heap.
+ * This avoids heap fragmentation as well as page faults on the first touch of
+ * the large block buffers. New chunks are aligned to huge pages ( if this does
+ * not waste too much memory ) and touched by the requesting thread, i.e. they
+ * are placed on its NUMA domain by the first-touch policy.
+ * @tparam ChunkSize Size of the chunks in bytes.
+ */
+template <std::size_t ChunkSize> class StoragePool {
+
+  static constexpr std::size_t huge_page_size_ = 2 * 1024 * 1024;
+  // Huge page alignment is only used if the padding is below 1/8 of the chunk
+  static constexpr std::size_t alignment_ =
+      ChunkSize >= 8 * huge_page_size_ ? huge_page_size_ : 4096;
+  // aligned_alloc requires a size that is a multiple of the alignment
+  static constexpr std::size_t allocation_size_ =
+      (ChunkSize + alignment_ - 1) / alignment_ * alignment_;
+
+  std::vector<void *> free_chunks_;
+  std::mutex mutex_;
+
+  StoragePool() = default;
+
+public:
+  ~StoragePool() {
+    for (void *chunk : free_chunks_) {
+      std::free(chunk);
+    }
+  }
+  StoragePool(StoragePool const &) = delete;
+  StoragePool &operator=(StoragePool const &) = delete;
+  StoragePool(StoragePool &&) = delete;
+  StoragePool &operator=(StoragePool &&) = delete;
+
+  /**
+   * @brief Gives the pool of the chunk size ( one per process ). The pool
+   * holds no simulation state, hence it is shared by all simulations of the
+   * process rather than being part of a SimulationContext.
+   * @return The pool instance.
+   */
+  static StoragePool &Instance() {
+    static StoragePool pool;
+    return pool;
+  }
+
+  /**
+   * @brief Hands out a chunk. Recycled chunks are preferred, otherwise a new
+   * touched chunk is allocated.
+   * @return Pointer to the chunk, suitably aligned for any object type.
+   */
+  void *Acquire() {
+    {
+      std::lock_guard<std::mutex> const lock(mutex_);
+      if (!free_chunks_.empty()) {
+        void *const chunk = free_chunks_.back();
+        free_chunks_.pop_back();
+        return chunk;
+      }
+    }
+    void *const chunk = std::aligned_alloc(alignment_, allocation_size_);
+    if (chunk == nullptr) {
+      throw std::bad_alloc();
+    }
+#ifdef __linux__
+    if constexpr (alignment_ == huge_page_size_) {
+      madvise(chunk, allocation_size_, MADV_HUGEPAGE);
+    }
+#endif
+    std::memset(chunk, 0, allocation_size_);
+    return chunk;
+  }
+
+  /**
+   * @brief Returns a chunk to the pool for later reuse.
+   * @param chunk Pointer to the chunk as obtained from Acquire.
+   */
+  void Release(void *const chunk) {
+    std::lock_guard<std::mutex> const lock(mutex_);
+    free_chunks_.push_back(chunk);
+  }
+
+  /**
+   * @brief Gives the number of chunks currently available for reuse.
+   * @return Number of free chunks.
+   */
+  std::size_t FreeChunkCount() {
+    std::lock_guard<std::mutex> const lock(mutex_);
+    return free_chunks_.size();
+  }
+
+  /**
+   * @brief Gives the memory held by the chunks available for reuse.
+   * @return Bytes of the free chunks.
+   */
+  std::size_t FreeBytes() { return FreeChunkCount() * allocation_size_; }
+};
+
+/**
+ * @brief Allocator drawing single large objects from the StoragePool of their
+ * size. Arrays and small objects ( e.g. bucket lists of containers ) use the
+ * standard allocator.
+ * @tparam T Type of the allocated objects.
+ */
+template <typename T> struct PoolAllocator {
+  using value_type = T;
+
+  // Objects of this size are pooled ( one page )
+  static constexpr std::size_t minimum_pooled_size_ = 4096;
+  static constexpr bool pooled_ =
+      CC::PoolBlockStorage() && sizeof(T) >= minimum_pooled_size_;
+
+  PoolAllocator() noexcept = default;
+  template <typename U> PoolAllocator(PoolAllocator<U> const &) noexcept {}
+
+  /**
+   * @brief Allocates storage for the given number of objects.
+   * @param n Number of objects.
+   * @return Pointer to the uninitialized storage.
+   */
+  T *allocate(std::size_t const n) {
+    if constexpr (pooled_) {
+      static_assert(alignof(T) <= alignof(std::max_align_t),
+                    "Pooled types must not be over-aligned");
+      if (n == 1) {
+        return static_cast<T *>(StoragePool<sizeof(T)>::Instance().Acquire());
+      }
+    }
+    return std::allocator<T>().allocate(n);
+  }
+
+  /**
+   * @brief Frees storage obtained from allocate.
+   * @param pointer Pointer to the storage.
+   * @param n Number of objects the storage was allocated for.
+   */
+  void deallocate(T *const pointer, std::size_t const n) {
+    if constexpr (pooled_) {
+      if (n == 1) {
+        StoragePool<sizeof(T)>::Instance().Release(pointer);
+        return;
+      }
+    }
+    std::allocator<T>().deallocate(pointer, n);
+  }
+};
+
+template <typename T, typename U>
+bool operator==(PoolAllocator<T> const &, PoolAllocator<U> const &) noexcept {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(PoolAllocator<T> const &, PoolAllocator<U> const &) noexcept {
+  return false;
+}
+
+#endif // STORAGE_POOL_H
@@ -0,0 +1,221 @@
+//===--------------------------- task_graph.cpp ---------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "utilities/task_graph.h"
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "simulation_context.h"
+
+/**
+ * @brief Adds a task to the graph.
+ * @param work The work of a compute task, empty for communication tasks.
+ * @param progress The progress function of a communication task, empty for
+ * compute tasks.
+ * @param dependencies The tasks that have to be completed before the task is
+ * started.
+ * @return The identifier of the added task.
+ */
+TaskGraph::TaskId TaskGraph::AddTask(std::function<void()> work,
+                                     std::function<bool()> progress,
+                                     std::vector<TaskId> const &dependencies) {
+  TaskId const id = tasks_.size();
+  for (TaskId const dependency : dependencies) {
+    if (dependency >= id) {
+      throw std::logic_error(
+          "Tasks may only depend on tasks added before them!");
+    }
+    tasks_[dependency].successors_.push_back(id);
+  }
+  tasks_.push_back({std::move(work),
+                    std::move(progress),
+                    static_cast<unsigned int>(dependencies.size()),
+                    {}});
+  return id;
+}
+
+/**
+ * @brief Adds a compute task, which is executed once by an arbitrary thread.
+ * @param work The work of the task. Must be safe to be run concurrently with
+ * all tasks it does not ( indirectly ) depend on.
+ * @param dependencies The tasks that have to be completed before the task is
+ * started.
+ * @return The identifier of the added task.
+ */
+TaskGraph::TaskId
+TaskGraph::AddComputeTask(std::function<void()> work,
+                          std::vector<TaskId> const &dependencies) {
+  return AddTask(std::move(work), {}, dependencies);
+}
+
+/**
+ * @brief Adds a communication task, whose progress function is called
+ * repeatedly by the master thread until it returns true.
+ * @param progress The progress function of the task, e.g. testing posted MPI
+ * requests. Returns whether the task is completed.
+ * @param dependencies The tasks that have to be completed before the task is
+ * polled the first time.
+ * @return The identifier of the added task.
+ */
+TaskGraph::TaskId
+TaskGraph::AddCommunicationTask(std::function<bool()> progress,
+                                std::vector<TaskId> const &dependencies) {
+  return AddTask({}, std::move(progress), dependencies);
+}
+
+/**
+ * @brief Takes the next ready compute task.
+ * @param id The identifier of the task ( indirect return parameter ).
+ * @return True if a task was taken, false if none is ready.
+ */
+bool TaskGraph::PopComputeTask(TaskId &id) {
+  std::lock_guard<std::mutex> const lock(mutex_);
+  if (ready_compute_tasks_.empty()) {
+    return false;
+  }
+  id = ready_compute_tasks_.front();
+  ready_compute_tasks_.pop_front();
+  return true;
+}
+
+/**
+ * @brief Polls all ready communication tasks once. Completed ones release
+ * their successors. Only to be called by the master thread.
+ */
+void TaskGraph::ProgressCommunicationTasks() {
+  {
+    std::lock_guard<std::mutex> const lock(mutex_);
+    active_communication_tasks_.insert(active_communication_tasks_.end(),
+                                       ready_communication_tasks_.begin(),
+                                       ready_communication_tasks_.end());
+    ready_communication_tasks_.clear();
+  }
+  std::size_t number_of_active = 0;
+  for (TaskId const id : active_communication_tasks_) {
+    if (tasks_[id].progress_()) {
+      CompleteTask(id);
+    } else {
+      active_communication_tasks_[number_of_active++] = id;
+    }
+  }
+  active_communication_tasks_.resize(number_of_active);
+}
+
+/**
+ * @brief Marks a task as completed and queues the successors whose
+ * dependencies are all completed.
+ * @param id The identifier of the completed task.
+ */
+void TaskGraph::CompleteTask(TaskId const id) {
+  {
+    std::lock_guard<std::mutex> const lock(mutex_);
+    for (TaskId const successor : tasks_[id].successors_) {
+      if (--open_dependencies_[successor] == 0) {
+        if (tasks_[successor].progress_) {
+          ready_communication_tasks_.push_back(successor);
+        } else {
+          ready_compute_tasks_.push_back(successor);
+        }
+      }
+    }
+  }
+  remaining_tasks_--;
+}
+
+/**
+ * @brief Stops the run after a task threw. The first exception is kept to be
+ * rethrown once all threads left the parallel region.
+ * @param exception The exception thrown by the task.
+ */
+void TaskGraph::Abort(std::exception_ptr const exception) {
+  std::lock_guard<std::mutex> const lock(mutex_);
+  if (!exception_) {
+    exception_ = exception;
+  }
+  aborted_ = true;
+}
+
+/**
+ * @brief Executes all tasks of the graph. Returns once all tasks are
+ * completed. The graph is kept and may be run again.
+ * @note Must be called by the master thread outside of parallel regions.
+ * Exceptions thrown by tasks stop the run and are rethrown.
+ */
+void TaskGraph::Run() {
+  open_dependencies_.resize(tasks_.size());
+  ready_compute_tasks_.clear();
+  ready_communication_tasks_.clear();
+  active_communication_tasks_.clear();
+  exception_ = nullptr;
+  aborted_ = false;
+  for (TaskId id = 0; id < tasks_.size(); ++id) {
+    open_dependencies_[id] = tasks_[id].number_of_dependencies_;
+    if (open_dependencies_[id] == 0) {
+      if (tasks_[id].progress_) {
+        ready_communication_tasks_.push_back(id);
+      } else {
+        ready_compute_tasks_.push_back(id);
+      }
+    }
+  }
+  remaining_tasks_ = tasks_.size();
+
+  // The worker threads act on behalf of the simulation of the master thread
+  SimulationContext &context = SimulationContext::Current();
+#pragma omp parallel
+  {
+    SimulationContext::Binding const binding(context);
+#ifdef _OPENMP
+    bool const is_master = omp_get_thread_num() == 0;
+#else
+    bool const is_master = true;
+#endif
+    while (remaining_tasks_ > 0 && !aborted_) {
+      try {
+        if (is_master) {
+          ProgressCommunicationTasks();
+        }
+        TaskId id;
+        if (PopComputeTask(id)) {
+          tasks_[id].work_();
+          CompleteTask(id);
+        } else if (!is_master) {
+          std::this_thread::yield();
+        }
+      } catch (...) {
+        Abort(std::current_exception());
+      }
+    }
+  }
+
+  if (exception_) {
+    std::rethrow_exception(exception_);
+  }
+}
+
+/**
+ * @brief Removes all tasks from the graph. Keeps the allocated memory.
+ */
+void TaskGraph::Clear() { tasks_.clear(); }
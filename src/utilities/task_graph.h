@@ -0,0 +1,99 @@
+//===---------------------------- task_graph.h ----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef TASK_GRAPH_H
+#define TASK_GRAPH_H
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief The TaskGraph class executes tasks in the order given by their
+ * dependencies. Compute tasks are run once by any thread of an OpenMP parallel
+ * region. Communication tasks are polled by the master thread until their
+ * progress function reports completion, as MPI may only be called from the
+ * master thread ( MPI_THREAD_FUNNELED ). Hence, the communication progresses
+ * while the other threads, and the master thread in between two polls, work on
+ * the compute tasks that are ready.
+ * @note A task may only depend on tasks added before it, i.e. the graph is
+ * acyclic by construction.
+ */
+class TaskGraph {
+
+public:
+  using TaskId = std::size_t;
+
+private:
+  struct Task {
+    // work of compute tasks, progress of communication tasks
+    std::function<void()> work_;
+    std::function<bool()> progress_;
+    unsigned int number_of_dependencies_;
+    std::vector<TaskId> successors_;
+  };
+
+  std::vector<Task> tasks_;
+  // state of a run
+  std::vector<unsigned int> open_dependencies_;
+  std::deque<TaskId> ready_compute_tasks_;
+  std::vector<TaskId> ready_communication_tasks_;
+  // communication tasks polled by the master thread
+  std::vector<TaskId> active_communication_tasks_;
+  std::atomic<std::size_t> remaining_tasks_ = 0;
+  std::atomic<bool> aborted_ = false;
+  std::exception_ptr exception_;
+  std::mutex mutex_;
+
+  TaskId AddTask(std::function<void()> work, std::function<bool()> progress,
+                 std::vector<TaskId> const &dependencies);
+  bool PopComputeTask(TaskId &id);
+  void ProgressCommunicationTasks();
+  void CompleteTask(TaskId const id);
+  void Abort(std::exception_ptr const exception);
+
+public:
+  TaskGraph() = default;
+  ~TaskGraph() = default;
+  TaskGraph(TaskGraph const &) = delete;
+  TaskGraph &operator=(TaskGraph const &) = delete;
+  TaskGraph(TaskGraph &&) = delete;
+  TaskGraph &operator=(TaskGraph &&) = delete;
+
+  TaskId AddComputeTask(std::function<void()> work,
+                        std::vector<TaskId> const &dependencies = {});
+  TaskId AddCommunicationTask(std::function<bool()> progress,
+                              std::vector<TaskId> const &dependencies = {});
+  void Run();
+  void Clear();
+
+  /**
+   * @brief Gives the number of tasks in the graph.
+   * @return Number of tasks.
+   */
+  std::size_t Size() const { return tasks_.size(); }
+};
+
+#endif // TASK_GRAPH_H
@@ -0,0 +1,135 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include "block_definitions/band_tiled_buffer.h"
+
+namespace {
+   double buffer[CC::TCX()][CC::TCY()][CC::TCZ()];
+   double combined[CC::TCX()][CC::TCY()][CC::TCZ()];
+}
+
+SCENARIO( "Band-tiled buffer", "[1rank]" ) {
+   GIVEN( "A buffer cut off everywhere except for two cells of the first tile" ) {
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               buffer[i][j][k]   = i < CC::TCX() / 2 ? -1.0 : 1.0;
+               combined[i][j][k] = 2.0;
+            }
+         }
+      }
+      buffer[0][0][0] = 0.25;
+      buffer[1][0][0] = -0.5;
+
+      BandTiledBuffer tiled;
+
+      WHEN( "The buffer is stored" ) {
+         tiled.Store( buffer );
+         THEN( "Only the tiles with differing values are dense and all values are kept" ) {
+            // tiles in x-direction containing the sign change are dense as well
+            std::size_t const sign_change_tiles = ( CC::TCX() / 2 ) % BandTiledBuffer::TileX == 0 ? 0 : BandTiledBuffer::TilesY * BandTiledBuffer::TilesZ;
+            REQUIRE( tiled.DenseTiles() == 1 + sign_change_tiles );
+            bool all_equal = true;
+            for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+               for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                  for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                     all_equal = all_equal && tiled.Value( i, j, k ) == buffer[i][j][k];
+                  }
+               }
+            }
+            REQUIRE( all_equal );
+         }
+      }
+      WHEN( "A buffer is combined with the stored buffer" ) {
+         tiled.Store( buffer );
+         tiled.Combine( combined, 0.25, 0.75 );
+         THEN( "The result equals the dense combination" ) {
+            bool all_equal = true;
+            for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+               for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                  for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                     all_equal = all_equal && combined[i][j][k] == 0.25 * 2.0 + 0.75 * buffer[i][j][k];
+                  }
+               }
+            }
+            REQUIRE( all_equal );
+         }
+      }
+      WHEN( "The buffer is filled after storing" ) {
+         tiled.Store( buffer );
+         tiled.Fill( 3.0 );
+         THEN( "No dense tiles remain" ) {
+            REQUIRE( tiled.DenseTiles() == 0 );
+            REQUIRE( tiled.DenseBytes() == 0 );
+            REQUIRE( tiled.Value( 0, 0, 0 ) == 3.0 );
+         }
+      }
+   }
+}
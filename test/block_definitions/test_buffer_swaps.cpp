@@ -0,0 +1,146 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include "block_definitions/block.h"
+#include "block_definitions/interface_block.h"
+
+SCENARIO( "Buffer swaps exchange the roles of the buffers", "[1rank]" ) {
+   GIVEN( "A block with distinct values in the average and the right-hand side buffer" ) {
+      Block block;
+      block.GetAverageBuffer( Equation::Mass )[CC::FICX()][CC::FICY()][CC::FICZ()]       = 1.0;
+      block.GetRightHandSideBuffer( Equation::Mass )[CC::FICX()][CC::FICY()][CC::FICZ()] = 2.0;
+      FieldValue const* const average_storage                                            = &block.GetAverageBuffer( Equation::Mass )[0][0][0];
+
+      WHEN( "The two buffers are swapped" ) {
+         block.SwapConservativeBuffers( ConservativeBufferType::RightHandSide, ConservativeBufferType::Average );
+         THEN( "The values are exchanged without moving them" ) {
+            REQUIRE( block.GetAverageBuffer( Equation::Mass )[CC::FICX()][CC::FICY()][CC::FICZ()] == 2.0 );
+            REQUIRE( block.GetRightHandSideBuffer( Equation::Mass )[CC::FICX()][CC::FICY()][CC::FICZ()] == 1.0 );
+            REQUIRE( &block.GetRightHandSideBuffer( Equation::Mass )[0][0][0] == average_storage );
+            REQUIRE( &block.GetConservativeBuffer<ConservativeBufferType::Average>() == &block.GetAverageBuffer() );
+         }
+      }
+   }
+
+   GIVEN( "A block of a parent node" ) {
+      Block block;
+      block.ReleaseIntegrationBuffers();
+
+      WHEN( "The block becomes a leaf" ) {
+         block.AllocateIntegrationBuffers();
+         THEN( "The initial buffer is available and zero" ) {
+            REQUIRE( block.HasIntegrationBuffers() );
+            REQUIRE( block.GetInitialBuffer( Equation::Mass )[CC::FICX()][CC::FICY()][CC::FICZ()] == 0.0 );
+            REQUIRE( &block.GetConservativeBuffer( ConservativeBufferType::Initial ) == &block.GetInitialBuffer() );
+         }
+      }
+   }
+
+   GIVEN( "An interface block with a level-set value" ) {
+      InterfaceBlock interface_block( 1.0 );
+
+      WHEN( "The base and the right-hand side level-set buffers are swapped" ) {
+         interface_block.SwapInterfaceDescriptionBuffers( InterfaceDescriptionBufferType::RightHandSide, InterfaceDescriptionBufferType::Base,
+                                                          InterfaceDescription::Levelset );
+         THEN( "Only the level-set buffers are exchanged" ) {
+            REQUIRE( interface_block.GetBaseBuffer( InterfaceDescription::Levelset )[CC::FICX()][CC::FICY()][CC::FICZ()] == 1.0 );
+            REQUIRE( interface_block.GetRightHandSideBuffer( InterfaceDescription::Levelset )[CC::FICX()][CC::FICY()][CC::FICZ()] == 0.0 );
+            REQUIRE( interface_block.GetBaseBuffer( InterfaceDescription::VolumeFraction )[CC::FICX()][CC::FICY()][CC::FICZ()] == 1.0 );
+            REQUIRE( interface_block.GetRightHandSideBuffer( InterfaceDescription::VolumeFraction )[CC::FICX()][CC::FICY()][CC::FICZ()] == 0.0 );
+            REQUIRE( &interface_block.GetBuffer( InterfaceBlockBufferType::LevelsetBase ) ==
+                     &interface_block.GetInterfaceDescriptionBuffer<InterfaceDescriptionBufferType::Base>( InterfaceDescription::Levelset ) );
+         }
+      }
+   }
+}
+
+SCENARIO( "Material fields are visited in their storage precision", "[1rank]" ) {
+   GIVEN( "A block with a value in the density field" ) {
+      Block block;
+      block.GetPrimeStateBuffer( PrimeState::Density )[CC::FICX()][CC::FICY()][CC::FICZ()] = 0.5;
+
+      WHEN( "The prime-state and conservative fields are visited" ) {
+         std::size_t prime_state_value_size  = 0;
+         std::size_t conservative_value_size = 0;
+         double density                      = 0.0;
+         block.VisitFieldBuffer( MaterialFieldType::PrimeStates, PTI( PrimeState::Density ), [&]( auto const& cells ) {
+            prime_state_value_size = sizeof( cells[0][0][0] );
+            density                = cells[CC::FICX()][CC::FICY()][CC::FICZ()];
+         } );
+         block.VisitFieldBuffer( MaterialFieldType::Conservatives, ETI( Equation::Mass ),
+                                 [&]( auto const& cells ) { conservative_value_size = sizeof( cells[0][0][0] ); } );
+         THEN( "The fields are passed with the value type of the build" ) {
+            REQUIRE( prime_state_value_size == sizeof( FieldValue ) );
+            REQUIRE( conservative_value_size == sizeof( FieldValue ) );
+            REQUIRE( density == 0.5 );
+         }
+      }
+   }
+}
@@ -0,0 +1,125 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include "block_definitions/cut_cell_list.h"
+
+namespace {
+   std::int8_t interface_tags[CC::TCX()][CC::TCY()][CC::TCZ()];
+}
+
+SCENARIO( "Cut-cell list", "[1rank]" ) {
+   GIVEN( "Interface tags with a cut cell, a neighbor and a halo cut cell" ) {
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               interface_tags[i][j][k] = ITTI( IT::BulkPhase );
+            }
+         }
+      }
+      interface_tags[CC::FICX() + 1][CutCellList::FirstY][CutCellList::FirstZ] = ITTI( IT::OldCutCell );
+      interface_tags[CC::FICX() + 2][CutCellList::FirstY][CutCellList::FirstZ] = -ITTI( IT::CutCellNeighbor );
+      interface_tags[CC::FICX() - 1][CutCellList::LastY][CutCellList::LastZ]   = ITTI( IT::NewCutCell );
+      // outside of the considered cells
+      interface_tags[CC::FICX() - 2][CutCellList::FirstY][CutCellList::FirstZ] = ITTI( IT::OldCutCell );
+
+      CutCellList list;
+
+      WHEN( "The list is not yet updated" ) {
+         std::vector<std::array<unsigned int, 3>> scratch;
+         THEN( "The cells are gathered from the tags in loop order" ) {
+            REQUIRE_FALSE( list.IsValid() );
+            std::vector<std::array<unsigned int, 3>> const& cells = list.Cells( interface_tags, scratch );
+            REQUIRE( &cells == &scratch );
+            REQUIRE( cells.size() == 3 );
+            REQUIRE( cells[0] == std::array<unsigned int, 3>( { CC::FICX() - 1, CutCellList::LastY, CutCellList::LastZ } ) );
+            REQUIRE( cells[1] == std::array<unsigned int, 3>( { CC::FICX() + 1, CutCellList::FirstY, CutCellList::FirstZ } ) );
+            REQUIRE_FALSE( CutCellList::IsInternal( cells[0] ) );
+         }
+      }
+      WHEN( "The list is updated" ) {
+         list.Update( interface_tags );
+         std::vector<std::array<unsigned int, 3>> scratch;
+         THEN( "The stored cells are given without gathering" ) {
+            REQUIRE( list.IsValid() );
+            std::vector<std::array<unsigned int, 3>> const& cells = list.Cells( interface_tags, scratch );
+            REQUIRE( &cells != &scratch );
+            REQUIRE( cells.size() == 3 );
+            REQUIRE( scratch.empty() );
+         }
+      }
+      WHEN( "The list is invalidated after an update" ) {
+         list.Update( interface_tags );
+         list.Invalidate();
+         THEN( "The list is outdated" ) {
+            REQUIRE_FALSE( list.IsValid() );
+         }
+      }
+   }
+}
@@ -70,8 +70,11 @@
 
 #include <vector>
 #include <algorithm>
+#include <memory>
 
+#include "block_definitions/field_buffer.h"
 #include "solvers/convective_term_contributions/convective_term_solver.h"
+#include "utilities/buffer_operations.h"
 
 SCENARIO( "Non-momentum equation indexing", "[1rank]" ) {
 
@@ -97,3 +100,79 @@ SCENARIO( "Non-momentum equation indexing", "[1rank]" ) {
       }
    }
 }
+
+SCENARIO( "Field buffer layouts", "[1rank]" ) {
+
+   GIVEN( "A conservative buffer in field-major and in cell-blocked layout" ) {
+      using FieldMajorConservatives  = FieldBuffer<MF::ANOE(), Equation, ETI, FieldBufferLayout::FieldMajor>;
+      using CellBlockedConservatives = FieldBuffer<MF::ANOE(), Equation, ETI, FieldBufferLayout::CellBlocked>;
+      auto const field_major         = std::make_unique<FieldMajorConservatives>();
+      auto const cell_blocked        = std::make_unique<CellBlockedConservatives>();
+
+      WHEN( "The same values are written through the layout-aware accessors" ) {
+         for( unsigned int e = 0; e < MF::ANOE(); ++e ) {
+            for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+               for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                  for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                     double const value                     = double( e ) + 0.001 * double( ( i * CC::TCY() + j ) * CC::TCZ() + k );
+                     field_major->Value( e, i, j, k )       = value;
+                     auto&& cell                            = cell_blocked->GetCellView( i, j, k );
+                     cell[static_cast<unsigned short>( e )] = value;
+                  }
+               }
+            }
+         }
+
+         THEN( "Both layouts give the same values and the field-major layout matches its raw arrays" ) {
+            for( Equation const e : MF::ASOE() ) {
+               for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+                  for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                     for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                        REQUIRE( cell_blocked->Value( e, i, j, k ) == field_major->Value( e, i, j, k ) );
+                        REQUIRE( ( *field_major )[e][i][j][k] == field_major->Value( e, i, j, k ) );
+                     }
+                  }
+               }
+            }
+         }
+
+         THEN( "The cell-blocked layout stores all fields of consecutive cells next to each other" ) {
+            REQUIRE( CellBlockedConservatives::Offset( 1, 0, 0, 0 ) == CC::FBTW() );
+            REQUIRE( CellBlockedConservatives::Offset( MF::ANOE() - 1, 0, 0, 0 ) == ( MF::ANOE() - 1 ) * CC::FBTW() );
+            REQUIRE( sizeof( CellBlockedConservatives ) == sizeof( FieldMajorConservatives ) );
+         }
+      }
+   }
+}
+
+SCENARIO( "Field buffer storage precision", "[1rank]" ) {
+
+   GIVEN( "A conservative buffer stored in double and in single precision" ) {
+      using DoubleConservatives = FieldBuffer<MF::ANOE(), Equation, ETI, FieldBufferLayout::FieldMajor, double>;
+      using FloatConservatives  = FieldBuffer<MF::ANOE(), Equation, ETI, FieldBufferLayout::FieldMajor, float>;
+      auto const double_buffer  = std::make_unique<DoubleConservatives>();
+      auto const float_buffer   = std::make_unique<FloatConservatives>();
+
+      WHEN( "The double values are copied into the single-precision buffer" ) {
+         for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+            for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+               for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                  ( *double_buffer )[Equation::Mass][i][j][k] = 1.0 + 0.1 * double( ( i * CC::TCY() + j ) * CC::TCZ() + k );
+               }
+            }
+         }
+         BO::CopySingleBuffer( ( *double_buffer )[Equation::Mass], ( *float_buffer )[Equation::Mass] );
+
+         THEN( "The single-precision buffer holds the rounded values in half the memory" ) {
+            REQUIRE( sizeof( FloatConservatives ) * 2 == sizeof( DoubleConservatives ) );
+            for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+               for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                  for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                     REQUIRE( float_buffer->Value( Equation::Mass, i, j, k ) == static_cast<float>( double_buffer->Value( Equation::Mass, i, j, k ) ) );
+                  }
+               }
+            }
+         }
+      }
+   }
+}
@@ -0,0 +1,108 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include "block_definitions/interface_geometry_cache.h"
+
+SCENARIO( "Interface geometry cache", "[1rank]" ) {
+   GIVEN( "A cache filled with two cells in loop order" ) {
+      InterfaceGeometryCache cache;
+      std::array<double, 6> const apertures = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6 };
+      std::array<double, 3> const normal    = { 1.0, 0.0, 0.0 };
+      cache.Add( CC::FICX(), CC::FICY(), CC::FICZ(), apertures, normal );
+      cache.Add( CC::FICX() + 1, CC::FICY(), CC::FICZ(), apertures, normal );
+
+      WHEN( "The cache is not yet validated" ) {
+         THEN( "No cell is found" ) {
+            REQUIRE_FALSE( cache.IsValid() );
+            REQUIRE( cache.Find( CC::FICX(), CC::FICY(), CC::FICZ() ) == nullptr );
+         }
+      }
+      WHEN( "The cache is validated" ) {
+         cache.Validate();
+         THEN( "Stored cells are found and others are not" ) {
+            REQUIRE( cache.Size() == 2 );
+            CutCellGeometry const* const cell = cache.Find( CC::FICX() + 1, CC::FICY(), CC::FICZ() );
+            REQUIRE( cell != nullptr );
+            REQUIRE( cell->apertures_ == apertures );
+            REQUIRE( cell->normal_ == normal );
+            REQUIRE( cache.Find( CC::FICX() + 2, CC::FICY(), CC::FICZ() ) == nullptr );
+         }
+      }
+      WHEN( "The cache is invalidated after validation" ) {
+         cache.Validate();
+         cache.Invalidate();
+         THEN( "The cache is empty and no cell is found" ) {
+            REQUIRE_FALSE( cache.IsValid() );
+            REQUIRE( cache.Size() == 0 );
+            REQUIRE( cache.Find( CC::FICX(), CC::FICY(), CC::FICZ() ) == nullptr );
+         }
+      }
+   }
+}
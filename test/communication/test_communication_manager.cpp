@@ -105,16 +105,6 @@ namespace ExpectedSingleJumpHaloLists {
          { 0xA00000F, BoundaryLocation::North },
          { 0xA00000F, BoundaryLocation::Top } };
 
-   std::vector<std::tuple<nid_t, BoundaryLocation>> maximum_level_externals_rank_one_of_three = {
-         { 0xA00000B, BoundaryLocation::East },
-         { 0xA00000B, BoundaryLocation::North },
-         { 0xA00000B, BoundaryLocation::Bottom },
-         { 0xA00000E, BoundaryLocation::North },
-         { 0xA00000E, BoundaryLocation::Top },
-         { 0xA00000F, BoundaryLocation::East },
-         { 0xA00000F, BoundaryLocation::North },
-         { 0xA00000F, BoundaryLocation::Top } };
-
    std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> level_zero_internals = {
          { 0x1400000, BoundaryLocation::East, InternalBoundaryType::NoJumpBoundaryLocal },
          { 0x1400001, BoundaryLocation::West, InternalBoundaryType::NoJumpBoundaryLocal },
@@ -177,46 +167,6 @@ namespace ExpectedSingleJumpHaloLists {
          { 0xA00000F, BoundaryLocation::BottomSouth, InternalBoundaryType::NoJumpBoundaryLocal },
          { 0xA00000F, BoundaryLocation::WestSouthBottom, InternalBoundaryType::NoJumpBoundaryLocal } };
 
-   std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> maximum_level_internals_rank_one_of_three = {
-         { 0xA00000B, BoundaryLocation::Top, InternalBoundaryType::NoJumpBoundaryLocal },
-         { 0xA00000B, BoundaryLocation::TopWest, InternalBoundaryType::NoJumpBoundaryLocal },
-         { 0xA00000E, BoundaryLocation::East, InternalBoundaryType::NoJumpBoundaryLocal },
-         { 0xA00000E, BoundaryLocation::BottomEast, InternalBoundaryType::NoJumpBoundaryLocal },
-         { 0xA00000F, BoundaryLocation::West, InternalBoundaryType::NoJumpBoundaryLocal },
-         { 0xA00000F, BoundaryLocation::Bottom, InternalBoundaryType::NoJumpBoundaryLocal } };
-
-   std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> maximum_level_internals_mpi_rank_one_of_three = {
-         { 0xA00000B, BoundaryLocation::West, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000B, BoundaryLocation::West, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000B, BoundaryLocation::South, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000B, BoundaryLocation::South, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000B, BoundaryLocation::TopSouth, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000B, BoundaryLocation::TopSouth, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000B, BoundaryLocation::SouthWest, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000B, BoundaryLocation::SouthWest, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000B, BoundaryLocation::WestSouthTop, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000B, BoundaryLocation::WestSouthTop, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000E, BoundaryLocation::South, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000E, BoundaryLocation::South, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000E, BoundaryLocation::Bottom, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000E, BoundaryLocation::Bottom, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000E, BoundaryLocation::BottomSouth, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000E, BoundaryLocation::BottomSouth, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000E, BoundaryLocation::SouthEast, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000E, BoundaryLocation::SouthEast, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000E, BoundaryLocation::EastSouthBottom, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000E, BoundaryLocation::EastSouthBottom, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000F, BoundaryLocation::South, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000F, BoundaryLocation::South, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000F, BoundaryLocation::BottomSouth, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000F, BoundaryLocation::BottomSouth, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000F, BoundaryLocation::BottomWest, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000F, BoundaryLocation::BottomWest, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000F, BoundaryLocation::SouthWest, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000F, BoundaryLocation::SouthWest, InternalBoundaryType::NoJumpBoundaryMpiRecv },
-         { 0xA00000F, BoundaryLocation::WestSouthBottom, InternalBoundaryType::NoJumpBoundaryMpiSend },
-         { 0xA00000F, BoundaryLocation::WestSouthBottom, InternalBoundaryType::NoJumpBoundaryMpiRecv } };
-
    std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> maximum_level_jumps = {
          { 0xA000008, BoundaryLocation::West, InternalBoundaryType::JumpBoundaryLocal },
          { 0xA000008, BoundaryLocation::NorthWest, InternalBoundaryType::JumpBoundaryLocal },
@@ -234,36 +184,27 @@ namespace ExpectedSingleJumpHaloLists {
          { 0xA00000E, BoundaryLocation::SouthWest, InternalBoundaryType::JumpBoundaryLocal },
          { 0xA00000E, BoundaryLocation::BottomWest, InternalBoundaryType::JumpBoundaryLocal },
          { 0xA00000E, BoundaryLocation::WestSouthBottom, InternalBoundaryType::JumpBoundaryLocal } };
-
-   std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> maximum_level_jumps_mpi_rank_one_of_three = {
-         { 0xA000008, BoundaryLocation::West, InternalBoundaryType::JumpBoundaryMpiSend },
-         { 0xA000008, BoundaryLocation::TopWest, InternalBoundaryType::JumpBoundaryMpiSend },
-         { 0xA000008, BoundaryLocation::NorthWest, InternalBoundaryType::JumpBoundaryMpiSend },
-         { 0xA000008, BoundaryLocation::WestNorthTop, InternalBoundaryType::JumpBoundaryMpiSend },
-         { 0xA00000A, BoundaryLocation::West, InternalBoundaryType::JumpBoundaryMpiSend },
-         { 0xA00000A, BoundaryLocation::TopWest, InternalBoundaryType::JumpBoundaryMpiSend },
-         { 0xA00000A, BoundaryLocation::SouthWest, InternalBoundaryType::JumpBoundaryMpiSend },
-         { 0xA00000A, BoundaryLocation::WestSouthTop, InternalBoundaryType::JumpBoundaryMpiSend },
-         { 0xA00000C, BoundaryLocation::West, InternalBoundaryType::JumpBoundaryMpiSend },
-         { 0xA00000C, BoundaryLocation::BottomWest, InternalBoundaryType::JumpBoundaryMpiSend },
-         { 0xA00000C, BoundaryLocation::NorthWest, InternalBoundaryType::JumpBoundaryMpiSend },
-         { 0xA00000C, BoundaryLocation::WestNorthBottom, InternalBoundaryType::JumpBoundaryMpiSend } };
-
-   std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> maximum_level_jumps_rank_one_of_three = {
-         { 0xA00000E, BoundaryLocation::West, InternalBoundaryType::JumpBoundaryLocal },
-         { 0xA00000E, BoundaryLocation::BottomWest, InternalBoundaryType::JumpBoundaryLocal },
-         { 0xA00000E, BoundaryLocation::SouthWest, InternalBoundaryType::JumpBoundaryLocal },
-         { 0xA00000E, BoundaryLocation::WestSouthBottom, InternalBoundaryType::JumpBoundaryLocal } };
 }// namespace ExpectedSingleJumpHaloLists
 
 namespace {
    template<typename T>
-   void RequireVectorEquality( std::vector<T> a, std::vector<T>& b ) {
+   void RequireVectorEquality( std::vector<T> a, std::vector<T> b ) {
       REQUIRE( a.size() == b.size() );
       std::sort( std::begin( a ), std::end( a ) );
       std::sort( std::begin( b ), std::end( b ) );
       REQUIRE( a == b );
    }
+
+   /**
+    * @brief Removes the edge and corner halos from expected boundaries on the maximum level if only face halos are exchanged.
+    */
+   std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> ExchangedHalos( std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> boundaries ) {
+      if constexpr( CC::FaceHalosOnly() ) {
+         boundaries.erase( std::remove_if( std::begin( boundaries ), std::end( boundaries ), []( auto const& boundary ) { return LTI( std::get<1>( boundary ) ) >= 6; } ),
+                           std::end( boundaries ) );
+      }
+      return boundaries;
+   }
 }// namespace
 
 SCENARIO( "Communication chache is properly (in-)validated", "[1rank],[2rank]" ) {
@@ -328,12 +269,31 @@ SCENARIO( "The neighborhood relations are correct", "[1rank]" ) {
             RequireVectorEquality( communication.ExternalBoundaries( level_zero ), ExpectedSingleJumpHaloLists::level_zero_externals );
             RequireVectorEquality( communication.ExternalBoundaries( maximum_level ), ExpectedSingleJumpHaloLists::maximum_level_externals );
          }
+         THEN( "The external boundaries are grouped by their location" ) {
+            for( unsigned int const level : { level_zero, maximum_level } ) {
+               std::vector<std::tuple<nid_t, BoundaryLocation>> grouped_boundaries;
+               for( BoundaryLocation const location : CC::ANBS() ) {
+                  for( nid_t const id : communication.ExternalBoundaryGroupsOnLevel( level )[LTI( location )] ) {
+                     grouped_boundaries.emplace_back( id, location );
+                  }
+               }
+               std::vector<std::tuple<nid_t, BoundaryLocation>> external_boundaries = communication.ExternalBoundaries( level );
+               RequireVectorEquality( grouped_boundaries, external_boundaries );
+            }
+         }
          THEN( "The internal no-jump boundaries are correct" ) {
             RequireVectorEquality( communication.InternalBoundaries( level_zero ), ExpectedSingleJumpHaloLists::level_zero_internals );
-            RequireVectorEquality( communication.InternalBoundaries( maximum_level ), ExpectedSingleJumpHaloLists::maximum_level_internals );
+            RequireVectorEquality( communication.InternalBoundaries( maximum_level ), ExchangedHalos( ExpectedSingleJumpHaloLists::maximum_level_internals ) );
          }
          THEN( "The internal jump boundaries are correct" ) {
-            RequireVectorEquality( communication.InternalBoundariesJump( maximum_level ), ExpectedSingleJumpHaloLists::maximum_level_jumps );
+            RequireVectorEquality( communication.InternalBoundariesJump( maximum_level ), ExchangedHalos( ExpectedSingleJumpHaloLists::maximum_level_jumps ) );
+         }
+         THEN( "Edge and corner halos are only extended on the maximum level if only face halos are exchanged" ) {
+            REQUIRE( communication.ExtendedBoundaries( level_zero ).empty() );
+            REQUIRE( communication.ExtendedBoundaries( maximum_level ).empty() == !CC::FaceHalosOnly() );
+            for( auto const& boundary : communication.ExtendedBoundaries( maximum_level ) ) {
+               REQUIRE( LTI( std::get<1>( boundary ) ) >= 6 );
+            }
          }
       }
       WHEN( "We pretend to have a three-rank topology" ) {
@@ -342,20 +302,21 @@ SCENARIO( "The neighborhood relations are correct", "[1rank]" ) {
          CommunicationManager communication = CommunicationManager( simplest_jump_topo, maximum_level );
          communication.GenerateNeighborRelationForHaloUpdate( level_zero );
          communication.GenerateNeighborRelationForHaloUpdate( maximum_level );
+         // Siblings are kept on one rank, hence the only family stays on rank zero together with the level-zero leaf
          THEN( "The external boundaries are correct" ) {
             RequireVectorEquality( communication.ExternalBoundaries( level_zero ), ExpectedSingleJumpHaloLists::level_zero_externals );
-            RequireVectorEquality( communication.ExternalBoundaries( maximum_level ), ExpectedSingleJumpHaloLists::maximum_level_externals_rank_one_of_three );
+            RequireVectorEquality( communication.ExternalBoundaries( maximum_level ), ExpectedSingleJumpHaloLists::maximum_level_externals );
          }
-         THEN( "The internal no-jumps are correctly sorted into MPI and non-MPI" ) {
+         THEN( "The internal no-jumps are all sorted into non-MPI" ) {
             REQUIRE( communication.InternalBoundariesMpi( level_zero ).size() == 0 );
             RequireVectorEquality( communication.InternalBoundaries( level_zero ), ExpectedSingleJumpHaloLists::level_zero_internals );
 
-            RequireVectorEquality( communication.InternalBoundariesMpi( maximum_level ), ExpectedSingleJumpHaloLists::maximum_level_internals_mpi_rank_one_of_three );
-            RequireVectorEquality( communication.InternalBoundaries( maximum_level ), ExpectedSingleJumpHaloLists::maximum_level_internals_rank_one_of_three );
+            REQUIRE( communication.InternalBoundariesMpi( maximum_level ).size() == 0 );
+            RequireVectorEquality( communication.InternalBoundaries( maximum_level ), ExchangedHalos( ExpectedSingleJumpHaloLists::maximum_level_internals ) );
          }
-         THEN( "The internal jumps are correctly sorted into MPI and non-MPI" ) {
-            RequireVectorEquality( communication.InternalBoundariesJump( maximum_level ), ExpectedSingleJumpHaloLists::maximum_level_jumps_rank_one_of_three );
-            RequireVectorEquality( communication.InternalBoundariesJumpMpi( maximum_level ), ExpectedSingleJumpHaloLists::maximum_level_jumps_mpi_rank_one_of_three );
+         THEN( "The internal jumps are all sorted into non-MPI" ) {
+            RequireVectorEquality( communication.InternalBoundariesJump( maximum_level ), ExchangedHalos( ExpectedSingleJumpHaloLists::maximum_level_jumps ) );
+            REQUIRE( communication.InternalBoundariesJumpMpi( maximum_level ).size() == 0 );
          }
       }
    }
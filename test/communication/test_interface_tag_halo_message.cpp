@@ -0,0 +1,147 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "communication/communication_types.h"
+#include "communication/interface_tag_halo_message.h"
+#include "enums/interface_tag_definition.h"
+
+namespace {
+   struct InterfaceTagBuffer {
+      std::int8_t values_[CC::TCX()][CC::TCY()][CC::TCZ()];
+   };
+}
+
+SCENARIO( "Compressed interface tag halo messages", "[1rank]" ) {
+
+   GIVEN( "An interface tag buffer with bulk tags on both sides of a plane interface" ) {
+      auto const sender   = std::make_unique<InterfaceTagBuffer>();
+      auto const receiver = std::make_unique<InterfaceTagBuffer>();
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               // a plane interface normal to x in the middle of the block
+               sender->values_[i][j][k]   = ( 2 * i < CC::TCX() ? -1 : 1 ) * ITTI( IT::BulkPhase );
+               receiver->values_[i][j][k] = ITTI( IT::OldCutCell );
+            }
+         }
+      }
+
+      WHEN( "A halo region within one phase is packed and unpacked again" ) {
+         BoundaryLocation const location = BoundaryLocation::East;
+         auto const start                = CommunicationTypes::GetStartIndicesHaloSend( location );
+         auto const size                 = CommunicationTypes::GetHaloSize( location );
+         std::vector<std::int8_t> message;
+         InterfaceTagHaloMessage::Pack( sender->values_, start, size, message );
+         InterfaceTagHaloMessage::Unpack( message, start, size, receiver->values_ );
+
+         THEN( "Only the flag and the single tag are sent" ) {
+            REQUIRE( message.size() == 2 );
+         }
+
+         THEN( "All tags of the region are restored" ) {
+            for( int i = start[0]; i < start[0] + size[0]; ++i ) {
+               for( int j = start[1]; j < start[1] + size[1]; ++j ) {
+                  for( int k = start[2]; k < start[2] + size[2]; ++k ) {
+                     REQUIRE( receiver->values_[i][j][k] == ITTI( IT::BulkPhase ) );
+                  }
+               }
+            }
+         }
+      }
+
+      WHEN( "A halo region containing a cut cell is packed and unpacked again" ) {
+         BoundaryLocation const location = BoundaryLocation::East;
+         auto const start                = CommunicationTypes::GetStartIndicesHaloSend( location );
+         auto const size                 = CommunicationTypes::GetHaloSize( location );
+         sender->values_[start[0]][start[1]][start[2]] = ITTI( IT::NewCutCell );
+         std::vector<std::int8_t> message;
+         InterfaceTagHaloMessage::Pack( sender->values_, start, size, message );
+         InterfaceTagHaloMessage::Unpack( message, start, size, receiver->values_ );
+
+         THEN( "All tags of the region are sent" ) {
+            REQUIRE( message.size() == InterfaceTagHaloMessage::MaximumSize( size ) );
+         }
+
+         THEN( "All tags of the region are restored" ) {
+            for( int i = start[0]; i < start[0] + size[0]; ++i ) {
+               for( int j = start[1]; j < start[1] + size[1]; ++j ) {
+                  for( int k = start[2]; k < start[2] + size[2]; ++k ) {
+                     REQUIRE( receiver->values_[i][j][k] == sender->values_[i][j][k] );
+                  }
+               }
+            }
+         }
+      }
+   }
+}
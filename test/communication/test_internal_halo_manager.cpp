@@ -138,6 +138,42 @@ SCENARIO( "Internal Halos can be updated correctly", "[1rank],[2rank]" ) {
             }
          }
       }
+
+      WHEN( "Interface tags are halo-updated with the first node frozen" ) {
+         for( auto& [id, node] : tree.FullNodeList().at( maximum_level ) ) {
+            auto& interface_tags = node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
+            for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+               for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                  for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                     interface_tags[i][j][k] = static_cast<int8_t>( PositionOfNodeAmongSiblings( id ) );
+                  }
+               }
+            }
+         }
+         std::vector<nid_t> const frozen_nodes = { two_nodes_level_zero_topo.LocalLeafIds().front() };
+
+         CommunicationManager communication = CommunicationManager( two_nodes_level_zero_topo, maximum_level );
+         InternalHaloManager internal_halos = InternalHaloManager( tree, two_nodes_level_zero_topo, communication, 1 );
+         internal_halos.InterfaceTagHaloUpdateOnLevel( maximum_level, InterfaceDescriptionBufferType::Reinitialized, frozen_nodes );
+
+         THEN( "Only the halos of the frozen node filled on the same rank are left untouched" ) {
+            for( auto& [id, node] : tree.FullNodeList().at( maximum_level ) ) {
+               auto const& interface_tags = node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
+               BoundaryLocation const side = PositionOfNodeAmongSiblings( id ) % 2 == 0 ? BoundaryLocation::East : BoundaryLocation::West;
+               nid_t const neighbor_id     = GetNeighborId( id, side );
+               bool const untouched        = id == frozen_nodes.front() && two_nodes_level_zero_topo.NodeIsOnRank( neighbor_id, MpiUtilities::MyRankId() );
+               auto const recv_indices     = communication.GetStartIndicesHaloRecv( side );
+               auto const size             = communication.GetHaloSize( side );
+               for( int i = recv_indices[0]; i < size[0] + recv_indices[0]; ++i ) {
+                  for( int j = recv_indices[1]; j < size[1] + recv_indices[1]; ++j ) {
+                     for( int k = recv_indices[2]; k < size[2] + recv_indices[2]; ++k ) {
+                        REQUIRE( interface_tags[i][j][k] == static_cast<int8_t>( PositionOfNodeAmongSiblings( untouched ? id : neighbor_id ) ) );
+                     }
+                  }
+               }
+            }
+         }
+      }
    }
 
    GIVEN( "The simplest all two-phase single-jump topology" ) {
@@ -222,3 +258,30 @@ SCENARIO( "Internal Halos can be updated correctly", "[1rank],[2rank]" ) {
       }
    }
 }
+
+SCENARIO( "Halos of reduced depth keep the cells closest to the boundary", "[1rank]" ) {
+   GIVEN( "The full halo geometry of the east and the west boundary" ) {
+      constexpr unsigned int depth = 1;
+      WHEN( "The geometry is reduced to a single halo cell" ) {
+         auto const east_send = CommunicationTypes::GetStartIndicesHaloSend( BoundaryLocation::East, depth );
+         auto const east_recv = CommunicationTypes::GetStartIndicesHaloRecv( BoundaryLocation::East, depth );
+         auto const west_send = CommunicationTypes::GetStartIndicesHaloSend( BoundaryLocation::West, depth );
+         auto const west_recv = CommunicationTypes::GetStartIndicesHaloRecv( BoundaryLocation::West, depth );
+         auto const size      = CommunicationTypes::GetHaloSize( BoundaryLocation::East, depth );
+
+         THEN( "Only the size normal to the boundary shrinks" ) {
+            REQUIRE( size[0] == static_cast<int>( depth ) );
+            REQUIRE( size[1] == CommunicationTypes::GetHaloSize( BoundaryLocation::East )[1] );
+            REQUIRE( size[2] == CommunicationTypes::GetHaloSize( BoundaryLocation::East )[2] );
+         }
+         THEN( "The sent cells are the last internal ones and the received cells the first halo ones" ) {
+            REQUIRE( east_send[0] == static_cast<int>( CC::LICX() ) );
+            REQUIRE( east_recv[0] == static_cast<int>( CC::FHHX() ) );
+            REQUIRE( west_send[0] == static_cast<int>( CC::FICX() ) );
+            REQUIRE( west_recv[0] == static_cast<int>( CC::FICX() - 1 ) );
+            REQUIRE( east_send[1] == CommunicationTypes::GetStartIndicesHaloSend( BoundaryLocation::East )[1] );
+            REQUIRE( west_recv[2] == CommunicationTypes::GetStartIndicesHaloRecv( BoundaryLocation::West )[2] );
+         }
+      }
+   }
+}
@@ -0,0 +1,95 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include "communication/mpi_utilities.h"
+#include "communication/rank_reordering.h"
+
+SCENARIO( "The halo graph placement gives a rankfile covering all ranks", "[1rank],[2rank]" ) {
+   GIVEN( "A halo graph connecting all ranks on a single compute node." ) {
+      int const number_of_ranks = MpiUtilities::NumberOfRanks();
+      std::vector<long> halo_bytes( number_of_ranks, 4096 );
+      halo_bytes[MpiUtilities::MyRankId()] = 0;
+      WHEN( "The halo graph is mapped onto the processes." ) {
+         HaloGraphPlacement const placement = RankReordering::MapHaloGraph( halo_bytes );
+         THEN( "No halo bytes cross compute nodes and each rank is placed once." ) {
+            REQUIRE( placement.internode_bytes_current_ == 0 );
+            REQUIRE( placement.internode_bytes_suggested_ == 0 );
+            REQUIRE( placement.moved_ranks_ >= 0 );
+            REQUIRE( placement.moved_ranks_ <= number_of_ranks );
+            if( MpiUtilities::MasterRank() ) {
+               for( int rank = 0; rank < number_of_ranks; ++rank ) {
+                  REQUIRE( placement.rankfile_.find( "rank " + std::to_string( rank ) + "=" ) != std::string::npos );
+               }
+               REQUIRE( placement.rankfile_.find( "slot=" + std::to_string( number_of_ranks ) ) == std::string::npos );
+            }
+         }
+      }
+   }
+}
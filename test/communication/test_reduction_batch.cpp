@@ -0,0 +1,112 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include "communication/reduction_batch.h"
+
+SCENARIO( "The reduction batch gives the global results of mixed contributions", "[1rank]" ) {
+   GIVEN( "A batch with a maximum, a minimum and two flags." ) {
+      ReductionBatch batch;
+      std::size_t const maximum = batch.AddMaximum( -2.5 );
+      std::size_t const minimum = batch.AddMinimum( 3.0 );
+      std::size_t const set_flag = batch.AddLogicalOr( true );
+      std::size_t const unset_flag = batch.AddLogicalOr( false );
+      WHEN( "The batch is reduced non-blocking." ) {
+         batch.Start();
+         REQUIRE( batch.InFlight() );
+         batch.Wait();
+         THEN( "The reduction is completed and each contribution keeps its value on a single rank." ) {
+            REQUIRE_FALSE( batch.InFlight() );
+            REQUIRE( batch.Maximum( maximum ) == -2.5 );
+            REQUIRE( batch.Minimum( minimum ) == 3.0 );
+            REQUIRE( batch.LogicalOr( set_flag ) );
+            REQUIRE_FALSE( batch.LogicalOr( unset_flag ) );
+         }
+      }
+      WHEN( "The batch is cleared and reused." ) {
+         batch.Reduce();
+         batch.Clear();
+         std::size_t const reused = batch.AddMinimum( -1.0 );
+         batch.Reduce();
+         THEN( "The handles start from the beginning." ) {
+            REQUIRE( reused == 0 );
+            REQUIRE( batch.Minimum( reused ) == -1.0 );
+         }
+      }
+   }
+   GIVEN( "An empty batch." ) {
+      ReductionBatch batch;
+      WHEN( "The batch is reduced." ) {
+         batch.Start();
+         THEN( "No reduction is in flight." ) {
+            REQUIRE_FALSE( batch.InFlight() );
+         }
+      }
+   }
+}
@@ -0,0 +1,157 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "communication/communication_types.h"
+#include "communication/sparse_halo_message.h"
+
+namespace {
+   struct LevelsetBuffer {
+      double values_[CC::TCX()][CC::TCY()][CC::TCZ()];
+   };
+}
+
+SCENARIO( "Sparse level-set halo messages", "[1rank]" ) {
+
+   GIVEN( "A level-set buffer with values inside and outside the cut-off band" ) {
+      double const cutoff = CC::LSCOF();
+      auto const sender   = std::make_unique<LevelsetBuffer>();
+      auto const receiver = std::make_unique<LevelsetBuffer>();
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               // a plane interface in y-direction with plateaus beyond the cut-off
+               sender->values_[i][j][k]   = 1.5 * ( double( j ) - 0.5 * double( CC::TCY() ) ) + 0.01 * double( i + k );
+               receiver->values_[i][j][k] = 0.0;
+            }
+         }
+      }
+      BoundaryLocation const location = BoundaryLocation::East;
+      auto const start                = CommunicationTypes::GetStartIndicesHaloSend( location );
+      auto const size                 = CommunicationTypes::GetHaloSize( location );
+
+      WHEN( "A halo region is packed and unpacked again" ) {
+         std::vector<double> message;
+         SparseHaloMessage::Pack( sender->values_, start, size, cutoff, message );
+         SparseHaloMessage::Unpack( message, start, size, cutoff, receiver->values_ );
+
+         THEN( "The message is not larger than the densest message" ) {
+            REQUIRE( message.size() <= SparseHaloMessage::MaximumSize( size ) );
+         }
+
+         THEN( "Values inside the band are restored exactly and all others give the signed cut-off" ) {
+            for( int i = start[0]; i < start[0] + size[0]; ++i ) {
+               for( int j = start[1]; j < start[1] + size[1]; ++j ) {
+                  for( int k = start[2]; k < start[2] + size[2]; ++k ) {
+                     double const value = sender->values_[i][j][k];
+                     if( std::abs( value ) < cutoff ) {
+                        REQUIRE( receiver->values_[i][j][k] == value );
+                     } else {
+                        REQUIRE( receiver->values_[i][j][k] == ( value < 0.0 ? -cutoff : cutoff ) );
+                     }
+                  }
+               }
+            }
+         }
+
+         THEN( "Limiting the region locally gives the same values" ) {
+            SparseHaloMessage::CutOff( sender->values_, start, size, cutoff );
+            for( int i = start[0]; i < start[0] + size[0]; ++i ) {
+               for( int j = start[1]; j < start[1] + size[1]; ++j ) {
+                  for( int k = start[2]; k < start[2] + size[2]; ++k ) {
+                     REQUIRE( receiver->values_[i][j][k] == sender->values_[i][j][k] );
+                  }
+               }
+            }
+         }
+      }
+
+      WHEN( "A halo region entirely beyond the cut-off is packed" ) {
+         for( int i = start[0]; i < start[0] + size[0]; ++i ) {
+            for( int j = start[1]; j < start[1] + size[1]; ++j ) {
+               for( int k = start[2]; k < start[2] + size[2]; ++k ) {
+                  sender->values_[i][j][k] = -2.0 * cutoff;
+               }
+            }
+         }
+         std::vector<double> message;
+         SparseHaloMessage::Pack( sender->values_, start, size, cutoff, message );
+         SparseHaloMessage::Unpack( message, start, size, cutoff, receiver->values_ );
+
+         THEN( "Only the masks are sent and the negative cut-off is restored" ) {
+            REQUIRE( message.size() == SparseHaloMessage::MaximumSize( size ) - std::size_t( size[0] * size[1] * size[2] ) );
+            REQUIRE( receiver->values_[start[0]][start[1]][start[2]] == -cutoff );
+         }
+      }
+   }
+}
@@ -0,0 +1,170 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <hdf5.h>
+#include <string>
+#include <vector>
+
+#include "initial_condition/hdf5_field_data.h"
+
+namespace {
+   constexpr double density_offset = 2.0;
+   constexpr double density_slopes[3] = { 0.5, -1.5, 3.0 };
+
+   /**
+    * @brief Writes a rectilinear grid covering [-0.1, 1.1] in all active dimensions with a linear density field to an hdf5 file.
+    * @param filename The name of the file.
+    * @param number_of_points The number of grid points per direction.
+    */
+   void WriteLinearDensityField( std::string const& filename, hsize_t const number_of_points ) {
+      hid_t const file = H5Fcreate( filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+      // Non-uniform spacing by a quadratic mapping
+      std::vector<double> points( number_of_points );
+      for( hsize_t n = 0; n < number_of_points; ++n ) {
+         double const s = double( n ) / double( number_of_points - 1 );
+         points[n]      = -0.1 + 1.2 * ( 0.5 * s + 0.5 * s * s );
+      }
+      std::vector<char const*> const names = { "x", "y", "z" };
+      std::vector<hsize_t> extents;
+      for( unsigned int d = 0; d < DTI( CC::DIM() ); ++d ) {
+         hid_t const space   = H5Screate_simple( 1, &number_of_points, nullptr );
+         hid_t const dataset = H5Dcreate2( file, names[d], H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+         H5Dwrite( dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, points.data() );
+         H5Dclose( dataset );
+         H5Sclose( space );
+         extents.push_back( number_of_points );
+      }
+      hsize_t const ny = CC::DIM() != Dimension::One ? number_of_points : 1;
+      hsize_t const nz = CC::DIM() == Dimension::Three ? number_of_points : 1;
+      std::vector<double> density;
+      for( hsize_t i = 0; i < number_of_points; ++i ) {
+         for( hsize_t j = 0; j < ny; ++j ) {
+            for( hsize_t k = 0; k < nz; ++k ) {
+               density.push_back( density_offset + density_slopes[0] * points[i] + ( ny > 1 ? density_slopes[1] * points[j] : 0.0 ) + ( nz > 1 ? density_slopes[2] * points[k] : 0.0 ) );
+            }
+         }
+      }
+      hid_t const space   = H5Screate_simple( int( extents.size() ), extents.data(), nullptr );
+      hid_t const dataset = H5Dcreate2( file, "density", H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+      H5Dwrite( dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, density.data() );
+      H5Dclose( dataset );
+      H5Sclose( space );
+      H5Fclose( file );
+   }
+}// namespace
+
+SCENARIO( "Field data is interpolated from an hdf5 file onto blocks", "[1rank]" ) {
+   GIVEN( "A file with a linear density field on a non-uniform grid spanning several tiles and no pressure" ) {
+      std::string const filename = "test_hdf5_field_data.h5";
+      WriteLinearDensityField( filename, 45 );
+      std::vector<std::string> variable_names( MF::ANOP() );
+      variable_names[0] = "density";
+      variable_names[1] = "pressure";
+
+      WHEN( "The field data is interpolated onto a block of size one at the origin" ) {
+         Hdf5FieldData const field_data( filename, variable_names );
+         double values[MF::ANOP()][CC::ICX()][CC::ICY()][CC::ICZ()];
+         field_data.InterpolateOnBlock( { 0.0, 0.0, 0.0 }, 1.0 / double( CC::ICX() ), values );
+         THEN( "The density is exact, missing variables are zero" ) {
+            REQUIRE( field_data.HasVariable( 0 ) );
+            REQUIRE_FALSE( field_data.HasVariable( 1 ) );
+            for( unsigned int i = 0; i < CC::ICX(); ++i ) {
+               for( unsigned int j = 0; j < CC::ICY(); ++j ) {
+                  for( unsigned int k = 0; k < CC::ICZ(); ++k ) {
+                     double const x        = ( double( i ) + 0.5 ) / double( CC::ICX() );
+                     double const y        = CC::DIM() != Dimension::One ? ( double( j ) + 0.5 ) / double( CC::ICX() ) : 0.0;
+                     double const z        = CC::DIM() == Dimension::Three ? ( double( k ) + 0.5 ) / double( CC::ICX() ) : 0.0;
+                     double const expected = density_offset + density_slopes[0] * x + density_slopes[1] * y + density_slopes[2] * z;
+                     REQUIRE( values[0][i][j][k] == Approx( expected ) );
+                     REQUIRE( values[1][i][j][k] == 0.0 );
+                  }
+               }
+            }
+         }
+      }
+      WHEN( "The field data is interpolated onto a block outside of the grid" ) {
+         Hdf5FieldData const field_data( filename, variable_names );
+         double values[MF::ANOP()][CC::ICX()][CC::ICY()][CC::ICZ()];
+         field_data.InterpolateOnBlock( { 2.0, 2.0, 2.0 }, 1.0 / double( CC::ICX() ), values );
+         THEN( "The values of the closest grid point are taken" ) {
+            double const expected = density_offset + 1.1 * ( density_slopes[0] + ( CC::DIM() != Dimension::One ? density_slopes[1] : 0.0 ) + ( CC::DIM() == Dimension::Three ? density_slopes[2] : 0.0 ) );
+            REQUIRE( values[0][0][0][0] == Approx( expected ) );
+            REQUIRE( values[0][CC::ICX() - 1][CC::ICY() - 1][CC::ICZ() - 1] == Approx( expected ) );
+         }
+      }
+      WHEN( "A file that does not exist is given" ) {
+         THEN( "An error is thrown" ) {
+            REQUIRE_THROWS_AS( Hdf5FieldData( "does_not_exist.h5", variable_names ), std::invalid_argument );
+         }
+      }
+      std::remove( filename.c_str() );
+   }
+}
@@ -80,7 +80,7 @@ namespace TestInitialCondition {
       for( unsigned int level = 1; level <= max_level; level++ ) {
          std::vector<nid_t> level_nodes;
          for( nid_t const id : nodes[level - 1] ) {
-            std::vector<nid_t> child_nodes = IdsOfChildren( id );
+            std::array<nid_t, CC::NOC()> const child_nodes = IdsOfChildren( id );
             level_nodes.insert( std::end( level_nodes ), std::cbegin( child_nodes ), std::cend( child_nodes ) );
          }
          nodes.push_back( level_nodes );
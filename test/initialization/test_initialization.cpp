@@ -81,6 +81,7 @@
 #include "instantiation/instantiation_multiresolution.h"
 #include "instantiation/input_output/instantiation_output_writer.h"
 #include "instantiation/input_output/instantiation_input_output_manager.h"
+#include "instantiation/input_output/instantiation_in_situ_analysis.h"
 #include "instantiation/instantiation_modular_algorithm_assembler.h"
 #include "instantiation/instantiation_initial_condition.h"
 #include "instantiation/topology/instantiation_tree.h"
@@ -434,17 +435,24 @@ namespace Mocking {
             When( Method( multiresolution_reader, ReadNumberOfNodes ).Using( Direction::Y ) ).AlwaysReturn( 1 );
             When( Method( multiresolution_reader, ReadNumberOfNodes ).Using( Direction::Z ) ).AlwaysReturn( 2 );
             When( Method( multiresolution_reader, ReadMaximumLevel ) ).AlwaysReturn( 2 );
+            When( Method( multiresolution_reader, ReadGridSequencingStartLevel ) ).AlwaysReturn( 2 );
             break;
          default:
             When( Method( multiresolution_reader, ReadNumberOfNodes ).Using( Direction::X ) ).AlwaysReturn( 1 );
             When( Method( multiresolution_reader, ReadNumberOfNodes ).Using( Direction::Y ) ).AlwaysReturn( 1 );
             When( Method( multiresolution_reader, ReadNumberOfNodes ).Using( Direction::Z ) ).AlwaysReturn( 1 );
             When( Method( multiresolution_reader, ReadMaximumLevel ) ).AlwaysReturn( 0 );
+            When( Method( multiresolution_reader, ReadGridSequencingStartLevel ) ).AlwaysReturn( 0 );
             break;
       }
       When( Method( multiresolution_reader, ReadNodeSizeOnLevelZero ) ).AlwaysReturn( 1 );
       When( Method( multiresolution_reader, ReadEpsilonLevelReference ) ).AlwaysReturn( 1 );
       When( Method( multiresolution_reader, ReadEpsilonReference ) ).AlwaysReturn( 0.01 );
+      When( Method( multiresolution_reader, ReadLoadImbalanceThreshold ) ).AlwaysReturn( 0.0 );
+      When( Method( multiresolution_reader, ReadSpaceFillingCurve ) ).AlwaysReturn( SpaceFillingCurveSettings::DefaultSpaceFillingCurve );
+      When( Method( multiresolution_reader, ReadHaloExchange ) ).AlwaysReturn( HaloExchange::TwoSided );
+      When( Method( multiresolution_reader, ReadMemoryBudget ) ).AlwaysReturn( 0.0 );
+      When( Method( multiresolution_reader, ReadNumberOfRefinementRegions ) ).AlwaysReturn( 0 );
 
       return multiresolution_reader;
    }
@@ -513,9 +521,20 @@ namespace Mocking {
       When( Method( time_control_reader, ReadStartTime ) ).AlwaysReturn( 0.0 );
       When( Method( time_control_reader, ReadEndTime ) ).AlwaysReturn( 0.0 );
       When( Method( time_control_reader, ReadCFLNumber ) ).AlwaysReturn( 0.6 );
+      When( Method( time_control_reader, ReadMaximumMacroSteps ) ).AlwaysReturn( 0 );
+      When( Method( time_control_reader, ReadWalltimeLimit ) ).AlwaysReturn( 0.0 );
       return time_control_reader;
    }
 
+   /**
+    * @brief Gives a numerics reader that selects the compiled default methods.
+    */
+   Mock<NumericsReader> InstantiateNumericsReader() {
+      Mock<NumericsReader> numerics_reader;
+      When( Method( numerics_reader, ReadReconstructionStencil ) ).AlwaysReturn( reconstruction_stencil );
+      return numerics_reader;
+   }
+
    /**
     * @brief Gives a resart reader that acts according to the given test scenario.
     * @param scenario Indicator what test is to be run.
@@ -525,6 +544,7 @@ namespace Mocking {
       When( Method( restart_reader, ReadRestoreMode ) ).Return( RestoreMode::Off );
       When( Method( restart_reader, ReadSnapshotTimesType ) ).AlwaysReturn( SnapshotTimesType::Stamps );
       When( Method( restart_reader, ReadSnapshotTimeStamps ) ).AlwaysReturn( { 0.0 } );
+      When( Method( restart_reader, ReadStagingFolder ) ).AlwaysReturn( "" );
       return restart_reader;
    }
 
@@ -536,8 +556,17 @@ namespace Mocking {
       Mock<OutputReader> output_reader;
       When( Method( output_reader, ReadOutputTimesType ).Using( OutputType::Standard ) ).Return( OutputTimesType::Interval );
       When( Method( output_reader, ReadOutputTimesType ).Using( OutputType::Interface ) ).Return( OutputTimesType::Off );
+      When( Method( output_reader, ReadOutputTimesType ).Using( OutputType::Monitoring ) ).AlwaysReturn( OutputTimesType::Off );
       When( Method( output_reader, ReadOutputInterval ).Using( OutputType::Standard ) ).Return( 0.000001 );
       When( Method( output_reader, ReadTimeNamingFactor ) ).AlwaysReturn( 1.e0 );
+      When( Method( output_reader, ReadOutputCompression ) ).AlwaysReturn( OutputCompression() );
+      When( Method( output_reader, ReadOutputPrecision ) ).AlwaysReturn( OutputPrecision::Double );
+      When( Method( output_reader, ReadInSituInterval ) ).AlwaysReturn( 0 );
+      When( Method( output_reader, ReadInitialOutput ) ).AlwaysReturn( true );
+      When( Method( output_reader, ReadProfilingActive ) ).AlwaysReturn( false );
+      When( Method( output_reader, ReadProfilingInterval ) ).AlwaysReturn( 0 );
+      When( Method( output_reader, ReadProfilingTrace ) ).AlwaysReturn( false );
+      When( Method( output_reader, ReadOutputBackend ) ).AlwaysReturn( OutputBackend::Hdf5 );
       return output_reader;
    }
 
@@ -553,6 +582,7 @@ namespace Mocking {
       std::string levelset     = LevelsetString( scenario );
       When( Method( initial_condition_reader, ReadMaterialInitialConditions ).Using( 1 ) ).AlwaysReturn( material_one );
       When( Method( initial_condition_reader, ReadMaterialInitialConditions ).Using( 2 ) ).AlwaysReturn( material_two );
+      When( Method( initial_condition_reader, ReadMaterialInitialConditionFile ) ).AlwaysReturn( "" );
       When( Method( initial_condition_reader, ReadLevelsetInitializerInput ).Using( 1 ) ).Return( levelset );
       When( Method( initial_condition_reader, ReadLevelsetInitializerType ) ).AlwaysReturn( LevelsetInitializerType::Functional );
       When( Method( initial_condition_reader, ReadLevelsetInitializerBoundingBoxes ) ).AlwaysReturn( std::vector<std::array<double, 6>>() );
@@ -566,19 +596,21 @@ namespace Mocking {
    Mock<InputReader> InstantiateInputReader( Mock<MaterialReader>& material_reader, Mock<MultiResolutionReader>& multiresolution_reader,
                                              Mock<BoundaryConditionReader>& boundary_condition_reader, Mock<TimeControlReader>& time_control_reader,
                                              Mock<RestartReader>& restart_reader, Mock<OutputReader>& output_reader,
-                                             Mock<InitialConditionReader>& initial_condition_reader, Mock<SourceTermReader>& source_term_reader, CaseSelection::Case const scenario ) {
+                                             Mock<InitialConditionReader>& initial_condition_reader, Mock<SourceTermReader>& source_term_reader,
+                                             Mock<NumericsReader>& numerics_reader, CaseSelection::Case const scenario ) {
       Mock<InputReader> input_reader;
       When( Method( input_reader, GetMaterialReader ) ).AlwaysReturn( material_reader.get() );
       When( Method( input_reader, GetBoundaryConditionReader ) ).AlwaysReturn( boundary_condition_reader.get() );
       When( Method( input_reader, GetMultiResolutionReader ) ).AlwaysReturn( multiresolution_reader.get() );
       When( Method( input_reader, GetTimeControlReader ) ).Return( time_control_reader.get() );
       When( Method( input_reader, GetRestartReader ) ).Return( restart_reader.get() );
-      When( Method( input_reader, GetOutputReader ) ).Return( output_reader.get() );
+      When( Method( input_reader, GetOutputReader ) ).AlwaysReturn( output_reader.get() );
       When( Method( input_reader, GetInputType ) ).Return( InputType::Xml );
       When( Method( input_reader, GetInputFile ) ).Return( VaryingAttributes::InputfileString( scenario ) );
       When( Method( input_reader, GetInitialConditionReader ) ).AlwaysReturn( initial_condition_reader.get() );
       When( Method( input_reader, GetTimeControlReader ) ).AlwaysReturn( time_control_reader.get() );
       When( Method( input_reader, GetSourceTermReader ) ).AlwaysReturn( source_term_reader.get() );
+      When( Method( input_reader, GetNumericsReader ) ).AlwaysReturn( numerics_reader.get() );
       return input_reader;
    }
 }// namespace Mocking
@@ -604,10 +636,11 @@ namespace ScenarioTest {
          fakeit::Mock<OutputReader> output_reader( Mocking::InstantiateOutputReader() );
          fakeit::Mock<InitialConditionReader> initial_condition_reader( Mocking::InstantiateInitialConditionReader( test_case ) );
          fakeit::Mock<SourceTermReader> source_term_reader( Mocking::InstantiateSourceTermReader() );
+         fakeit::Mock<NumericsReader> numerics_reader( Mocking::InstantiateNumericsReader() );
 
          fakeit::Mock<InputReader> input_reader( Mocking::InstantiateInputReader( material_reader, multiresolution_reader, boundary_condition_reader,
                                                                                   time_control_reader, restart_reader, output_reader, initial_condition_reader,
-                                                                                  source_term_reader, test_case ) );
+                                                                                  source_term_reader, numerics_reader, test_case ) );
 
          WHEN( "The simulation is initialized" ) {
             UnitHandler const unit_handler( 1.0, 1.0, 1.0, 1.0 );
@@ -616,18 +649,20 @@ namespace ScenarioTest {
             TopologyManager topology_manager( Instantiation::InstantiateTopologyManager( input_reader.get(), material_manager ) );
             Multiresolution const multiresolution( Instantiation::InstantiateMultiresolution( input_reader.get(), topology_manager ) );
             Tree tree( Instantiation::InstantiateTree( input_reader.get(), topology_manager, unit_handler ) );
-            CommunicationManager communication_manager( Instantiation::InstantiateCommunicationManager( topology_manager ) );
+            CommunicationManager communication_manager( Instantiation::InstantiateCommunicationManager( input_reader.get(), topology_manager ) );
             ExternalHaloManager const external_halo_manager( Instantiation::InstantiateExternalHaloManager( input_reader.get(), unit_handler, material_manager ) );
             InternalHaloManager internal_halo_manager( Instantiation::InstantiateInternalHaloManager( topology_manager, tree, communication_manager, material_manager ) );
             HaloManager halo_manager( Instantiation::InstantiateHaloManager( topology_manager, tree, external_halo_manager, internal_halo_manager, communication_manager ) );
-            OutputWriter const output_writer( Instantiation::InstantiateOutputWriter( topology_manager, tree, material_manager, unit_handler ) );
-            RestartManager const restart_manager( Instantiation::InstantiateRestartManager( topology_manager, tree, unit_handler ) );
-            InputOutputManager input_output_manager( Instantiation::InstantiateInputOutputManager( input_reader.get(), output_writer, restart_manager, unit_handler, case_base_folder ) );
+            OutputWriter const output_writer( Instantiation::InstantiateOutputWriter( input_reader.get(), topology_manager, tree, material_manager, unit_handler ) );
+            RestartManager restart_manager( Instantiation::InstantiateRestartManager( topology_manager, tree, unit_handler ) );
+            InSituAnalysis const in_situ_analysis( Instantiation::InstantiateInSituAnalysis( input_reader.get(), topology_manager, tree, material_manager, unit_handler ) );
+            InputOutputManager input_output_manager( Instantiation::InstantiateInputOutputManager( input_reader.get(), output_writer, restart_manager, in_situ_analysis, unit_handler, case_base_folder ) );
             ModularAlgorithmAssembler modular_assembler( Instantiation::InstantiateModularAlgorithmAssembler( input_reader.get(), topology_manager, tree, communication_manager, halo_manager, multiresolution,
                                                                                                               material_manager, input_output_manager, unit_handler ) );
 
             auto const initial_condition( Instantiation::InstantiateInitialCondition( input_reader.get(), topology_manager, tree, material_manager, unit_handler ) );
-            modular_assembler.Initialization( *initial_condition );
+            PhaseTimer startup_timer;
+            modular_assembler.Initialization( *initial_condition, startup_timer );
 
             THEN( "The inital output and restart matches the expected one" ) {
                {// separate scope for logging purposes
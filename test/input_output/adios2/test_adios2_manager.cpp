@@ -0,0 +1,147 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+#include "input_output/adios2/adios2_manager.h"
+#include "communication/mpi_utilities.h"
+
+#ifdef ALPACA_WITH_ADIOS2
+SCENARIO( "Steps written by the ADIOS2 manager are read back unchanged", "[1rank]" ) {
+   GIVEN( "A BP5 stream in a fresh directory" ) {
+      std::filesystem::path const directory = std::filesystem::temp_directory_path() / "alpaca_test_adios2_manager";
+      std::filesystem::remove_all( directory );
+      std::filesystem::create_directories( directory );
+      std::string const stream_name                 = ( directory / "domain" ).string();
+      std::vector<std::vector<double>> const values = { { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 }, { -1.5, 0.0, 2.5, 1.0e-12, 1.0e12, 7.0 } };
+      std::vector<unsigned long long int> const ids = { 0, 1, 2, 3, 4, 5 };
+      std::vector<double> const times               = { 0.25, 0.5 };
+
+      WHEN( "Two steps with a vector and an id dataset are written" ) {
+         {
+            Adios2Manager manager( Adios2Settings{ Adios2Engine::BP5, 0 } );
+            for( std::size_t step = 0; step < times.size(); ++step ) {
+               manager.BeginStep( stream_name, times[step] );
+               manager.OpenGroup( "cell_data" );
+               manager.ReserveDataspace( "cells", { 3, 2 }, { 3, 2 }, 0, H5T_NATIVE_DOUBLE );
+               manager.WriteDatasetToDataspace( "cells", "velocity", values[step].data() );
+               manager.ReserveDataspace( "ids", { 6 }, { 6 }, 0, H5T_NATIVE_ULLONG );
+               manager.WriteDatasetToDataspace( "ids", "vertex_ids", ids.data() );
+               manager.CloseGroup();
+               manager.EndStep();
+            }
+            manager.CloseStream( stream_name );
+         }
+
+         THEN( "Each step holds the time and the datasets with their global shape" ) {
+            adios2::ADIOS adios( MpiUtilities::Communicator() );
+            adios2::IO io = adios.DeclareIO( "reader" );
+            io.SetEngine( "BP5" );
+            adios2::Engine reader = io.Open( stream_name + ".bp", adios2::Mode::Read );
+            std::size_t step = 0;
+            while( reader.BeginStep() == adios2::StepStatus::OK ) {
+               REQUIRE( step < times.size() );
+               double time = 0.0;
+               reader.Get( io.InquireVariable<double>( "time" ), time, adios2::Mode::Sync );
+               REQUIRE( time == times[step] );
+
+               adios2::Variable<double> velocity = io.InquireVariable<double>( "cell_data/velocity" );
+               REQUIRE( velocity );
+               REQUIRE( velocity.Shape() == adios2::Dims{ 3, 2 } );
+               std::vector<double> read_values;
+               reader.Get( velocity, read_values, adios2::Mode::Sync );
+               REQUIRE( read_values == values[step] );
+
+               adios2::Variable<std::uint64_t> vertex_ids = io.InquireVariable<std::uint64_t>( "cell_data/vertex_ids" );
+               REQUIRE( vertex_ids );
+               std::vector<std::uint64_t> read_ids;
+               reader.Get( vertex_ids, read_ids, adios2::Mode::Sync );
+               REQUIRE( std::vector<unsigned long long int>( read_ids.begin(), read_ids.end() ) == ids );
+               reader.EndStep();
+               ++step;
+            }
+            reader.Close();
+            REQUIRE( step == times.size() );
+         }
+      }
+      std::filesystem::remove_all( directory );
+   }
+}
+#else
+SCENARIO( "The ADIOS2 manager cannot be created without ADIOS2", "[1rank]" ) {
+   GIVEN( "A build without ADIOS2" ) {
+      THEN( "The backend is reported unavailable and the construction throws" ) {
+         REQUIRE_FALSE( Adios2Manager::IsAvailable() );
+         REQUIRE_THROWS_AS( Adios2Manager( Adios2Settings() ), std::invalid_argument );
+      }
+   }
+}
+#endif
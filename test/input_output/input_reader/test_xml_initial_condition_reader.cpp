@@ -96,6 +96,30 @@ SCENARIO( "Check that the xml initial condition reader works properly", "[1rank]
       }
    }
 
+   GIVEN( "A xml document with a field data file for the second material only." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <domain>"
+                                  "     <initialConditions> "
+                                  "       <material1> abc </material1>"
+                                  "       <material2>"
+                                  "          <file> precursor.h5 </file>"
+                                  "       </material2>"
+                                  "     </initialConditions>"
+                                  "  </domain>"
+                                  "</configuration>" );
+      // Create the xml document
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      // Create the xml reader
+      std::unique_ptr<InitialConditionReader const> const reader( std::make_unique<XmlInitialConditionReader const>( xml_tree ) );
+      WHEN( "The field data files of the materials are read from the tree." ) {
+         THEN( "The file of material 2 should be precursor.h5, material 1 should have none." ) {
+            REQUIRE( reader->ReadMaterialInitialConditionFile( 2 ) == "precursor.h5" );
+            REQUIRE( reader->ReadMaterialInitialConditionFile( 1 ).empty() );
+         }
+      }
+   }
+
    GIVEN( "A xml document with the only a string input for the levelset initial conditions." ) {
       std::string const xml_data( "<configuration>"
                                   "  <domain>"
@@ -68,6 +68,8 @@
 *****************************************************************************************/
 #include <catch2/catch.hpp>
 
+#include <array>
+#include <limits>
 #include <string>
 #include <memory>
 
@@ -175,4 +177,279 @@ SCENARIO( "Check that the xml multiresolution reader works properly", "[1rank]"
          }
       }
    }
+
+   GIVEN( "A xml document with and without the optional load balancing data." ) {
+      std::string const xml_data_with( "<configuration>"
+                                       "  <multiResolution>"
+                                       "    <loadBalancing>"
+                                       "       <imbalanceThreshold> 1.25 </imbalanceThreshold>"
+                                       "    </loadBalancing>"
+                                       "  </multiResolution>"
+                                       "</configuration>" );
+      std::string const xml_data_invalid( "<configuration>"
+                                          "  <multiResolution>"
+                                          "    <loadBalancing>"
+                                          "       <imbalanceThreshold> 0.5 </imbalanceThreshold>"
+                                          "    </loadBalancing>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      std::string const xml_data_without( "<configuration>"
+                                          "  <multiResolution>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      // Create the xml documents
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_with( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_with->Parse( xml_data_with.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_invalid( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_invalid->Parse( xml_data_invalid.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_without( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_without->Parse( xml_data_without.c_str() );
+      // Create the xml readers
+      std::unique_ptr<MultiResolutionReader const> const reader_with( std::make_unique<XmlMultiResolutionReader const>( xml_tree_with ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_invalid( std::make_unique<XmlMultiResolutionReader const>( xml_tree_invalid ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_without( std::make_unique<XmlMultiResolutionReader const>( xml_tree_without ) );
+      WHEN( "The load imbalance threshold is read from the trees." ) {
+         THEN( "The given threshold is returned, a missing one deactivates the trigger and values below one throw." ) {
+            REQUIRE( reader_with->ReadLoadImbalanceThreshold() == 1.25 );
+            REQUIRE( reader_without->ReadLoadImbalanceThreshold() == 0.0 );
+            REQUIRE_THROWS_AS( reader_invalid->ReadLoadImbalanceThreshold(), std::invalid_argument );
+         }
+      }
+   }
+}
+
+SCENARIO( "The space-filling curve is read correctly", "[1rank]" ) {
+   GIVEN( "Xml trees with a Lebesgue curve, an unknown curve and no curve" ) {
+      std::string const xml_data_with( "<configuration>"
+                                       "  <multiResolution>"
+                                       "    <loadBalancing>"
+                                       "       <spaceFillingCurve> Lebesgue </spaceFillingCurve>"
+                                       "    </loadBalancing>"
+                                       "  </multiResolution>"
+                                       "</configuration>" );
+      std::string const xml_data_invalid( "<configuration>"
+                                          "  <multiResolution>"
+                                          "    <loadBalancing>"
+                                          "       <spaceFillingCurve> Peano </spaceFillingCurve>"
+                                          "    </loadBalancing>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      std::string const xml_data_without( "<configuration>"
+                                          "  <multiResolution>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      // Create the xml documents
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_with( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_with->Parse( xml_data_with.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_invalid( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_invalid->Parse( xml_data_invalid.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_without( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_without->Parse( xml_data_without.c_str() );
+      // Create the xml readers
+      std::unique_ptr<MultiResolutionReader const> const reader_with( std::make_unique<XmlMultiResolutionReader const>( xml_tree_with ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_invalid( std::make_unique<XmlMultiResolutionReader const>( xml_tree_invalid ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_without( std::make_unique<XmlMultiResolutionReader const>( xml_tree_without ) );
+      WHEN( "The space-filling curve is read from the trees." ) {
+         THEN( "The given curve is returned, a missing one gives the default and unknown ones throw." ) {
+            REQUIRE( reader_with->ReadSpaceFillingCurve() == SpaceFillingCurve::Lebesgue );
+            REQUIRE( reader_without->ReadSpaceFillingCurve() == SpaceFillingCurveSettings::DefaultSpaceFillingCurve );
+            REQUIRE_THROWS_AS( reader_invalid->ReadSpaceFillingCurve(), std::logic_error );
+         }
+      }
+   }
+}
+
+SCENARIO( "The halo exchange is read correctly", "[1rank]" ) {
+   GIVEN( "Xml trees with a one-sided exchange, an unknown exchange and no exchange" ) {
+      std::string const xml_data_with( "<configuration>"
+                                       "  <multiResolution>"
+                                       "    <haloExchange> OneSided </haloExchange>"
+                                       "  </multiResolution>"
+                                       "</configuration>" );
+      std::string const xml_data_invalid( "<configuration>"
+                                          "  <multiResolution>"
+                                          "    <haloExchange> Broadcast </haloExchange>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      std::string const xml_data_without( "<configuration>"
+                                          "  <multiResolution>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      // Create the xml documents
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_with( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_with->Parse( xml_data_with.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_invalid( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_invalid->Parse( xml_data_invalid.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_without( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_without->Parse( xml_data_without.c_str() );
+      // Create the xml readers
+      std::unique_ptr<MultiResolutionReader const> const reader_with( std::make_unique<XmlMultiResolutionReader const>( xml_tree_with ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_invalid( std::make_unique<XmlMultiResolutionReader const>( xml_tree_invalid ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_without( std::make_unique<XmlMultiResolutionReader const>( xml_tree_without ) );
+      WHEN( "The halo exchange is read from the trees." ) {
+         THEN( "The given exchange is returned, a missing one gives the two-sided exchange and unknown ones throw." ) {
+            REQUIRE( reader_with->ReadHaloExchange() == HaloExchange::OneSided );
+            REQUIRE( reader_without->ReadHaloExchange() == HaloExchange::TwoSided );
+            REQUIRE_THROWS_AS( reader_invalid->ReadHaloExchange(), std::logic_error );
+         }
+      }
+   }
+}
+
+SCENARIO( "The memory budget is read correctly", "[1rank]" ) {
+   GIVEN( "Xml trees with a positive budget, a negative budget and no budget" ) {
+      std::string const xml_data_with( "<configuration>"
+                                       "  <multiResolution>"
+                                       "    <memoryBudget> 2048 </memoryBudget>"
+                                       "  </multiResolution>"
+                                       "</configuration>" );
+      std::string const xml_data_invalid( "<configuration>"
+                                          "  <multiResolution>"
+                                          "    <memoryBudget> -1 </memoryBudget>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      std::string const xml_data_without( "<configuration>"
+                                          "  <multiResolution>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      // Create the xml documents
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_with( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_with->Parse( xml_data_with.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_invalid( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_invalid->Parse( xml_data_invalid.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_without( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_without->Parse( xml_data_without.c_str() );
+      // Create the xml readers
+      std::unique_ptr<MultiResolutionReader const> const reader_with( std::make_unique<XmlMultiResolutionReader const>( xml_tree_with ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_invalid( std::make_unique<XmlMultiResolutionReader const>( xml_tree_invalid ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_without( std::make_unique<XmlMultiResolutionReader const>( xml_tree_without ) );
+      WHEN( "The memory budget is read from the trees." ) {
+         THEN( "The given budget is returned, a missing one gives zero and negative ones throw." ) {
+            REQUIRE( reader_with->ReadMemoryBudget() == 2048.0 );
+            REQUIRE( reader_without->ReadMemoryBudget() == 0.0 );
+            REQUIRE_THROWS_AS( reader_invalid->ReadMemoryBudget(), std::invalid_argument );
+         }
+      }
+   }
+}
+
+SCENARIO( "The grid sequencing is read correctly", "[1rank]" ) {
+   GIVEN( "Xml trees with a full grid sequencing, an invalid one and none" ) {
+      std::string const xml_data_with( "<configuration>"
+                                       "  <multiResolution>"
+                                       "    <maximumLevel> 4 </maximumLevel>"
+                                       "    <gridSequencing>"
+                                       "      <startLevel> 2 </startLevel>"
+                                       "      <stamps>"
+                                       "        <ts1> 0.5 </ts1>"
+                                       "        <ts2> 0.1 </ts2>"
+                                       "      </stamps>"
+                                       "      <tolerance> 1e-4 </tolerance>"
+                                       "    </gridSequencing>"
+                                       "  </multiResolution>"
+                                       "</configuration>" );
+      std::string const xml_data_invalid( "<configuration>"
+                                          "  <multiResolution>"
+                                          "    <maximumLevel> 4 </maximumLevel>"
+                                          "    <gridSequencing>"
+                                          "      <startLevel> 5 </startLevel>"
+                                          "      <stamps>"
+                                          "        <ts1> -0.1 </ts1>"
+                                          "      </stamps>"
+                                          "      <tolerance> -1.0 </tolerance>"
+                                          "    </gridSequencing>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      std::string const xml_data_without( "<configuration>"
+                                          "  <multiResolution>"
+                                          "    <maximumLevel> 4 </maximumLevel>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      // Create the xml documents
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_with( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_with->Parse( xml_data_with.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_invalid( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_invalid->Parse( xml_data_invalid.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_without( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_without->Parse( xml_data_without.c_str() );
+      // Create the xml readers
+      std::unique_ptr<MultiResolutionReader const> const reader_with( std::make_unique<XmlMultiResolutionReader const>( xml_tree_with ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_invalid( std::make_unique<XmlMultiResolutionReader const>( xml_tree_invalid ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_without( std::make_unique<XmlMultiResolutionReader const>( xml_tree_without ) );
+      WHEN( "The grid sequencing is read from the trees." ) {
+         THEN( "The given settings are returned sorted, a missing sequencing starts on the maximum level and invalid settings throw." ) {
+            REQUIRE( reader_with->ReadGridSequencingStartLevel() == 2 );
+            REQUIRE( reader_with->ReadGridSequencingTimeStamps() == std::vector<double>( { 0.1, 0.5 } ) );
+            REQUIRE( reader_with->ReadGridSequencingTolerance() == 1e-4 );
+            REQUIRE( reader_without->ReadGridSequencingStartLevel() == 4 );
+            REQUIRE( reader_without->ReadGridSequencingTimeStamps().empty() );
+            REQUIRE( reader_without->ReadGridSequencingTolerance() == 0.0 );
+            REQUIRE_THROWS_AS( reader_invalid->ReadGridSequencingStartLevel(), std::invalid_argument );
+            REQUIRE_THROWS_AS( reader_invalid->ReadGridSequencingTimeStamps(), std::invalid_argument );
+            REQUIRE_THROWS_AS( reader_invalid->ReadGridSequencingTolerance(), std::invalid_argument );
+         }
+      }
+   }
+}
+
+SCENARIO( "The refinement regions are read correctly", "[1rank]" ) {
+   GIVEN( "Xml trees with two regions, an invalid region and no region" ) {
+      std::string const xml_data_with( "<configuration>"
+                                       "  <multiResolution>"
+                                       "    <maximumLevel> 4 </maximumLevel>"
+                                       "    <refinementRegion>"
+                                       "      <xMin> 0.5 </xMin>"
+                                       "      <xMax> 1.0 </xMax>"
+                                       "      <minimumLevel> 2 </minimumLevel>"
+                                       "      <maximumLevel> 3 </maximumLevel>"
+                                       "    </refinementRegion>"
+                                       "    <refinementRegion>"
+                                       "      <expression> inside := 0.25 - x; </expression>"
+                                       "    </refinementRegion>"
+                                       "  </multiResolution>"
+                                       "</configuration>" );
+      std::string const xml_data_invalid( "<configuration>"
+                                          "  <multiResolution>"
+                                          "    <maximumLevel> 4 </maximumLevel>"
+                                          "    <refinementRegion>"
+                                          "      <xMin> 1.0 </xMin>"
+                                          "      <xMax> 0.5 </xMax>"
+                                          "      <minimumLevel> 3 </minimumLevel>"
+                                          "      <maximumLevel> 2 </maximumLevel>"
+                                          "    </refinementRegion>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      std::string const xml_data_without( "<configuration>"
+                                          "  <multiResolution>"
+                                          "    <maximumLevel> 4 </maximumLevel>"
+                                          "  </multiResolution>"
+                                          "</configuration>" );
+      // Create the xml documents
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_with( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_with->Parse( xml_data_with.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_invalid( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_invalid->Parse( xml_data_invalid.c_str() );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree_without( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree_without->Parse( xml_data_without.c_str() );
+      // Create the xml readers
+      std::unique_ptr<MultiResolutionReader const> const reader_with( std::make_unique<XmlMultiResolutionReader const>( xml_tree_with ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_invalid( std::make_unique<XmlMultiResolutionReader const>( xml_tree_invalid ) );
+      std::unique_ptr<MultiResolutionReader const> const reader_without( std::make_unique<XmlMultiResolutionReader const>( xml_tree_without ) );
+      WHEN( "The refinement regions are read from the trees." ) {
+         THEN( "Missing bounds and levels do not bound the region and invalid bounds and levels throw." ) {
+            REQUIRE( reader_with->ReadNumberOfRefinementRegions() == 2 );
+            REQUIRE( reader_with->ReadRefinementRegionBoundingBox( 0 )[0] == 0.5 );
+            REQUIRE( reader_with->ReadRefinementRegionBoundingBox( 0 )[1] == 1.0 );
+            REQUIRE( reader_with->ReadRefinementRegionBoundingBox( 1 )[1] == std::numeric_limits<double>::max() );
+            REQUIRE( reader_with->ReadRefinementRegionExpression( 0 ).empty() );
+            REQUIRE( reader_with->ReadRefinementRegionExpression( 1 ) == "inside := 0.25 - x;" );
+            REQUIRE( reader_with->ReadRefinementRegionLevels( 0 ) == std::array<unsigned int, 2>( { 2, 3 } ) );
+            REQUIRE( reader_with->ReadRefinementRegionLevels( 1 ) == std::array<unsigned int, 2>( { 0, 4 } ) );
+            REQUIRE( reader_without->ReadNumberOfRefinementRegions() == 0 );
+            REQUIRE_THROWS_AS( reader_invalid->ReadRefinementRegionBoundingBox( 0 ), std::invalid_argument );
+            REQUIRE_THROWS_AS( reader_invalid->ReadRefinementRegionLevels( 0 ), std::invalid_argument );
+            REQUIRE_THROWS_AS( reader_with->ReadRefinementRegionLevels( 2 ), std::logic_error );
+         }
+      }
+   }
 }
@@ -0,0 +1,126 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <memory>
+
+#include "input_output/input_reader/numerics_reader/numerics_reader.h"
+#include "input_output/input_reader/numerics_reader/xml_numerics_reader.h"
+
+SCENARIO( "Check that the xml numerics reader works properly", "[1rank]" ) {
+   GIVEN( "A xml document selecting a reconstruction stencil." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <numerics>"
+                                  "     <reconstructionStencil> WENO5Z </reconstructionStencil>"
+                                  "  </numerics>"
+                                  "</configuration>" );
+      // Create the xml document
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      // Create the xml reader
+      std::unique_ptr<NumericsReader const> const reader( std::make_unique<XmlNumericsReader const>( xml_tree ) );
+      WHEN( "The reconstruction stencil is read from the tree." ) {
+         THEN( "The stencil should be WENO5Z" ) {
+            REQUIRE( reader->ReadReconstructionStencil() == ReconstructionStencils::WENO5Z );
+         }
+      }
+   }
+   GIVEN( "A xml document with an unknown reconstruction stencil." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <numerics>"
+                                  "     <reconstructionStencil> WENO11 </reconstructionStencil>"
+                                  "  </numerics>"
+                                  "</configuration>" );
+      // Create the xml document
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      // Create the xml reader
+      std::unique_ptr<NumericsReader const> const reader( std::make_unique<XmlNumericsReader const>( xml_tree ) );
+      WHEN( "The reconstruction stencil is read from the tree." ) {
+         THEN( "An std::invalid_argument exception should be thrown" ) {
+            REQUIRE_THROWS_AS( reader->ReadReconstructionStencil(), std::invalid_argument );
+         }
+      }
+   }
+   GIVEN( "A xml document without numerics section." ) {
+      std::string const xml_data( "<configuration>"
+                                  "</configuration>" );
+      // Create the xml document
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      // Create the xml reader
+      std::unique_ptr<NumericsReader const> const reader( std::make_unique<XmlNumericsReader const>( xml_tree ) );
+      WHEN( "The optional reconstruction stencil is read." ) {
+         THEN( "The compiled default stencil is used" ) {
+            REQUIRE( reader->ReadReconstructionStencil() == reconstruction_stencil );
+         }
+      }
+   }
+}
@@ -69,8 +69,10 @@
 #include <catch2/catch.hpp>
 
 #include <string>
+#include <limits>
 #include <memory>
 
+#include "input_output/adios2/adios2_manager.h"
 #include "input_output/input_reader/output_reader/output_reader.h"
 #include "input_output/input_reader/output_reader/xml_output_reader.h"
 
@@ -234,3 +236,453 @@ SCENARIO( "Check that the xml output reader works properly", "[1rank]" ) {
       }
    }
 }
+
+SCENARIO( "Check that the xml output reader reads the compression of the output quantities", "[1rank]" ) {
+   GIVEN( "A xml document with a default compression and overrides for single quantities." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "     <compression>"
+                                  "       <filter> Deflate </filter>"
+                                  "       <level> 6 </level>"
+                                  "       <pressure>"
+                                  "          <filter> Zfp </filter>"
+                                  "          <errorBound> 1e-3 </errorBound>"
+                                  "       </pressure>"
+                                  "       <density>"
+                                  "          <filter> Off </filter>"
+                                  "       </density>"
+                                  "       <velocity>"
+                                  "          <level> 12 </level>"
+                                  "       </velocity>"
+                                  "       <temperature>"
+                                  "          <filter> Zfp </filter>"
+                                  "       </temperature>"
+                                  "     </compression>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The compression of a quantity without override is read." ) {
+         THEN( "The default deflate compression with level 6 is used." ) {
+            OutputCompression const compression( reader->ReadOutputCompression( "energy" ) );
+            REQUIRE( compression.type_ == OutputCompressionType::Deflate );
+            REQUIRE( compression.deflate_level_ == 6 );
+         }
+      }
+      WHEN( "The compression of quantities with overrides is read." ) {
+         THEN( "The overrides are used." ) {
+            OutputCompression const pressure( reader->ReadOutputCompression( "pressure" ) );
+            REQUIRE( pressure.type_ == OutputCompressionType::Zfp );
+            REQUIRE( pressure.error_bound_ == 1e-3 );
+            REQUIRE( reader->ReadOutputCompression( "density" ).type_ == OutputCompressionType::Off );
+         }
+      }
+      WHEN( "The compression of quantities with invalid parameters is read." ) {
+         THEN( "An invalid argument exception is thrown." ) {
+            REQUIRE_THROWS_AS( reader->ReadOutputCompression( "velocity" ), std::invalid_argument );
+            REQUIRE_THROWS_AS( reader->ReadOutputCompression( "temperature" ), std::invalid_argument );
+         }
+      }
+   }
+
+   GIVEN( "A xml document without compression." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "     <timeNamingFactor> 1.0 </timeNamingFactor>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The compression of a quantity is read." ) {
+         THEN( "The output is not compressed." ) {
+            REQUIRE( reader->ReadOutputCompression( "density" ).type_ == OutputCompressionType::Off );
+         }
+      }
+   }
+}
+
+SCENARIO( "Check that the xml output reader reads the precision of the output quantities", "[1rank]" ) {
+   GIVEN( "A xml document with single precision as default and double precision for the pressure." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "     <precision>"
+                                  "       <type> Single </type>"
+                                  "       <pressure>"
+                                  "          <type> Double </type>"
+                                  "       </pressure>"
+                                  "       <density>"
+                                  "          <type> Half </type>"
+                                  "       </density>"
+                                  "     </precision>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The precision of the quantities is read." ) {
+         THEN( "The default is overridden for the pressure and unknown precisions throw a logic error." ) {
+            REQUIRE( reader->ReadOutputPrecision( "velocity" ) == OutputPrecision::Single );
+            REQUIRE( reader->ReadOutputPrecision( "pressure" ) == OutputPrecision::Double );
+            REQUIRE_THROWS_AS( reader->ReadOutputPrecision( "density" ), std::logic_error );
+         }
+      }
+   }
+}
+
+SCENARIO( "Check that the xml output reader reads the monitoring output", "[1rank]" ) {
+   GIVEN( "A xml document with a monitoring output limited in level and in x-direction." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "     <monitoringOutput>"
+                                  "       <type> Interval </type>"
+                                  "       <interval> 1e-3 </interval>"
+                                  "       <maximumLevel> 2 </maximumLevel>"
+                                  "       <region>"
+                                  "          <xMin> 0.25 </xMin>"
+                                  "          <xMax> 0.75 </xMax>"
+                                  "          <yMin> 1.0 </yMin>"
+                                  "          <yMax> 0.5 </yMax>"
+                                  "       </region>"
+                                  "     </monitoringOutput>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The monitoring output is read." ) {
+         THEN( "The type should be Interval, the interval 1e-3, the maximum level 2 and the inverted region in y-direction throws." ) {
+            REQUIRE( reader->ReadOutputTimesType( OutputType::Monitoring ) == OutputTimesType::Interval );
+            REQUIRE( reader->ReadOutputInterval( OutputType::Monitoring ) == 1e-3 );
+            REQUIRE( reader->ReadMonitoringMaximumLevel() == 2 );
+            REQUIRE_THROWS_AS( reader->ReadMonitoringRegion(), std::invalid_argument );
+         }
+      }
+   }
+
+   GIVEN( "A xml document with a monitoring output without level and with a region in x-direction only." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "     <monitoringOutput>"
+                                  "       <type> Interval </type>"
+                                  "       <interval> 1e-3 </interval>"
+                                  "       <region>"
+                                  "          <xMin> 0.25 </xMin>"
+                                  "          <xMax> 0.75 </xMax>"
+                                  "       </region>"
+                                  "     </monitoringOutput>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The monitoring output is read." ) {
+         THEN( "All levels are written and the region is only bounded in x-direction." ) {
+            REQUIRE( reader->ReadMonitoringMaximumLevel() == std::numeric_limits<unsigned int>::max() );
+            std::array<std::array<double, 2>, 3> const region( reader->ReadMonitoringRegion() );
+            REQUIRE( region[0][0] == 0.25 );
+            REQUIRE( region[0][1] == 0.75 );
+            REQUIRE( region[1][0] == std::numeric_limits<double>::lowest() );
+            REQUIRE( region[2][1] == std::numeric_limits<double>::max() );
+         }
+      }
+   }
+
+   GIVEN( "A xml document without monitoring output." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The monitoring output type is read." ) {
+         THEN( "The monitoring output is switched off." ) {
+            REQUIRE( reader->ReadOutputTimesType( OutputType::Monitoring ) == OutputTimesType::Off );
+         }
+      }
+   }
+}
+
+SCENARIO( "Check that the xml output reader reads the in-situ analysis", "[1rank]" ) {
+   GIVEN( "A xml document with two reductions, a point probe, a line probe and a slice." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "     <inSituAnalysis>"
+                                  "       <interval> 10 </interval>"
+                                  "       <reduction>"
+                                  "          <quantity> density </quantity>"
+                                  "          <operation> Integral </operation>"
+                                  "       </reduction>"
+                                  "       <reduction>"
+                                  "          <quantity> velocity </quantity>"
+                                  "          <component> 1 </component>"
+                                  "          <operation> Max </operation>"
+                                  "       </reduction>"
+                                  "       <probe>"
+                                  "          <quantity> pressure </quantity>"
+                                  "          <x> 0.5 </x>"
+                                  "          <y> 0.25 </y>"
+                                  "       </probe>"
+                                  "       <lineProbe>"
+                                  "          <quantity> pressure </quantity>"
+                                  "          <start> <x> 0.0 </x> </start>"
+                                  "          <end> <x> 1.0 </x> <y> 2.0 </y> </end>"
+                                  "          <points> 3 </points>"
+                                  "       </lineProbe>"
+                                  "       <slice>"
+                                  "          <quantity> pressure </quantity>"
+                                  "          <axes> x </axes>"
+                                  "          <y> 0.5 </y>"
+                                  "          <level> 2 </level>"
+                                  "          <image/>"
+                                  "       </slice>"
+                                  "     </inSituAnalysis>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The in-situ analysis is read." ) {
+         std::vector<InSituReduction> const reductions( reader->ReadInSituReductions() );
+         std::vector<InSituProbe> const probes( reader->ReadInSituProbes() );
+         THEN( "The reductions are read in order and the line probe is expanded into three points after the point probe." ) {
+            REQUIRE( reader->ReadInSituInterval() == 10 );
+            REQUIRE( reductions.size() == 2 );
+            REQUIRE( reductions[0].quantity_name_ == "density" );
+            REQUIRE( reductions[0].component_ == 0 );
+            REQUIRE( reductions[0].operation_ == InSituOperation::Integral );
+            REQUIRE( reductions[1].component_ == 1 );
+            REQUIRE( reductions[1].operation_ == InSituOperation::Maximum );
+            REQUIRE( probes.size() == 4 );
+            REQUIRE( probes[0].point_ == std::array<double, 3>( { 0.5, 0.25, 0.0 } ) );
+            REQUIRE( probes[2].point_ == std::array<double, 3>( { 0.5, 1.0, 0.0 } ) );
+            REQUIRE( probes[3].point_ == std::array<double, 3>( { 1.0, 2.0, 0.0 } ) );
+         }
+      }
+
+      WHEN( "The slices are read." ) {
+         std::vector<InSituSlice> const slices( reader->ReadInSituSlices() );
+         THEN( "The slice spans the given axis and has the given point, level and image flag." ) {
+            REQUIRE( slices.size() == 1 );
+            REQUIRE( slices[0].quantity_name_ == "pressure" );
+            REQUIRE( slices[0].spanned_axes_ == std::array<bool, 3>( { true, false, false } ) );
+            REQUIRE( slices[0].point_ == std::array<double, 3>( { 0.0, 0.5, 0.0 } ) );
+            REQUIRE( slices[0].level_ == 2 );
+            REQUIRE( slices[0].image_ );
+         }
+      }
+   }
+
+   GIVEN( "A xml document with a slice spanning an axis twice." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "     <inSituAnalysis>"
+                                  "       <slice>"
+                                  "          <quantity> pressure </quantity>"
+                                  "          <axes> xx </axes>"
+                                  "       </slice>"
+                                  "     </inSituAnalysis>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The slices are read." ) {
+         THEN( "An exception is thrown." ) {
+            REQUIRE_THROWS_AS( reader->ReadInSituSlices(), std::invalid_argument );
+         }
+      }
+   }
+
+   GIVEN( "A xml document without in-situ analysis." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The in-situ analysis is read." ) {
+         THEN( "The analysis is switched off without reductions and probes." ) {
+            REQUIRE( reader->ReadInSituInterval() == 0 );
+            REQUIRE( reader->ReadInSituReductions().empty() );
+            REQUIRE( reader->ReadInSituProbes().empty() );
+            REQUIRE( reader->ReadInSituSlices().empty() );
+         }
+      }
+   }
+}
+
+SCENARIO( "Check that the xml output reader reads the profiling settings", "[1rank]" ) {
+   GIVEN( "A xml document with a profiling section, an interval and a trace." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "     <profiling>"
+                                  "       <interval> 50 </interval>"
+                                  "       <trace/>"
+                                  "     </profiling>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The profiling settings are read." ) {
+         THEN( "The profiler is active with an interval of 50 and records a trace." ) {
+            REQUIRE( reader->ReadProfilingActive() );
+            REQUIRE( reader->ReadProfilingInterval() == 50 );
+            REQUIRE( reader->ReadProfilingTrace() );
+            REQUIRE_FALSE( reader->ReadProfilingCounters() );
+            REQUIRE( reader->ReadProfilingFlopEvents().empty() );
+         }
+      }
+   }
+
+   GIVEN( "A xml document with hardware counters and two floating-point events." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "     <profiling>"
+                                  "       <counters>"
+                                  "         <flopEvent>"
+                                  "           <code> 0x01c7 </code>"
+                                  "         </flopEvent>"
+                                  "         <flopEvent>"
+                                  "           <code> 0x10c7 </code>"
+                                  "           <weight> 4 </weight>"
+                                  "         </flopEvent>"
+                                  "       </counters>"
+                                  "     </profiling>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The profiling settings are read." ) {
+         std::vector<std::pair<std::uint64_t, double>> const flop_events( reader->ReadProfilingFlopEvents() );
+         THEN( "The counters are active and the hexadecimal codes are read with their weights (default one)." ) {
+            REQUIRE( reader->ReadProfilingCounters() );
+            REQUIRE( flop_events.size() == 2 );
+            REQUIRE( flop_events[0].first == 0x01c7 );
+            REQUIRE( flop_events[0].second == 1.0 );
+            REQUIRE( flop_events[1].first == 0x10c7 );
+            REQUIRE( flop_events[1].second == 4.0 );
+         }
+      }
+   }
+
+   GIVEN( "A xml document without profiling section." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The profiling settings are read." ) {
+         THEN( "The profiler is inactive and only summarized at the end." ) {
+            REQUIRE_FALSE( reader->ReadProfilingActive() );
+            REQUIRE( reader->ReadProfilingInterval() == 0 );
+            REQUIRE_FALSE( reader->ReadProfilingTrace() );
+         }
+      }
+   }
+}
+
+SCENARIO( "Check that the xml output reader reads whether the initial output is written", "[1rank]" ) {
+   GIVEN( "A xml document with the skipInitialOutput tag." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "     <skipInitialOutput/>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The initial output flag is read." ) {
+         THEN( "The initial output is skipped." ) {
+            REQUIRE_FALSE( reader->ReadInitialOutput() );
+         }
+      }
+   }
+
+   GIVEN( "A xml document without the skipInitialOutput tag." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The initial output flag is read." ) {
+         THEN( "The initial output is written." ) {
+            REQUIRE( reader->ReadInitialOutput() );
+         }
+      }
+   }
+}
+
+SCENARIO( "Check that the xml output reader reads the output backend", "[1rank]" ) {
+   GIVEN( "A xml document with the ADIOS2 backend, the SST engine and four aggregators." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "     <backend>"
+                                  "        <type> Adios2 </type>"
+                                  "        <engine> SST </engine>"
+                                  "        <aggregators> 4 </aggregators>"
+                                  "     </backend>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The backend is read." ) {
+         THEN( "ADIOS2 is selected if available, otherwise the reader throws." ) {
+            if( Adios2Manager::IsAvailable() ) {
+               REQUIRE( reader->ReadOutputBackend() == OutputBackend::Adios2 );
+            } else {
+               REQUIRE_THROWS_AS( reader->ReadOutputBackend(), std::invalid_argument );
+            }
+         }
+         THEN( "The engine and the aggregators are read." ) {
+            Adios2Settings const settings = reader->ReadAdios2Settings();
+            REQUIRE( settings.engine_ == Adios2Engine::SST );
+            REQUIRE( settings.aggregators_ == 4 );
+         }
+      }
+   }
+
+   GIVEN( "A xml document without backend section." ) {
+      std::string const xml_data( "<configuration>"
+                                  "  <output>"
+                                  "  </output>"
+                                  "</configuration>" );
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      xml_tree->Parse( xml_data.c_str() );
+      std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+
+      WHEN( "The backend is read." ) {
+         THEN( "Hdf5 is used and ADIOS2 defaults to BP5 with automatic aggregation." ) {
+            REQUIRE( reader->ReadOutputBackend() == OutputBackend::Hdf5 );
+            Adios2Settings const settings = reader->ReadAdios2Settings();
+            REQUIRE( settings.engine_ == Adios2Engine::BP5 );
+            REQUIRE( settings.aggregators_ == 0 );
+         }
+      }
+   }
+}
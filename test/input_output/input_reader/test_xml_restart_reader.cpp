@@ -91,6 +91,10 @@ SCENARIO( "Check that the xml restart reader works properly", "[1rank]" ) {
                                   "          <ts2> 2.0 </ts2>"
                                   "          <ts3> 3.0 </ts3>"
                                   "       </stamps>"
+                                  "       <staging>"
+                                  "          <folder> /tmp/staging </folder>"
+                                  "          <generationsToKeep> 3 </generationsToKeep>"
+                                  "       </staging>"
                                   "     </snapshots>"
                                   "  </restart>"
                                   "</configuration>" );
@@ -133,6 +137,12 @@ SCENARIO( "Check that the xml restart reader works properly", "[1rank]" ) {
             REQUIRE( stamps[2] == 3.0 );
          }
       }
+      WHEN( "The staging data is read from the tree." ) {
+         THEN( "The staging folder should be /tmp/staging keeping 3 snapshots" ) {
+            REQUIRE( reader->ReadStagingFolder() == "/tmp/staging" );
+            REQUIRE( reader->ReadStagingGenerationsToKeep() == 3 );
+         }
+      }
    }
 
    GIVEN( "A xml document with invalid content to read the restart data." ) {
@@ -150,6 +160,9 @@ SCENARIO( "Check that the xml restart reader works properly", "[1rank]" ) {
                                   "          <tss2> 1.0 </tss2>"
                                   "          <tss3> 3.0 </tss3>"
                                   "       </stamps>"
+                                  "       <staging>"
+                                  "          <generationsToKeep> 0 </generationsToKeep>"
+                                  "       </staging>"
                                   "     </snapshots>"
                                   "  </restart>"
                                   "</configuration>" );
@@ -165,6 +178,7 @@ SCENARIO( "Check that the xml restart reader works properly", "[1rank]" ) {
             REQUIRE_THROWS_AS( reader->ReadSnapshotTimesType(), std::logic_error );
             REQUIRE_THROWS_AS( reader->ReadSnapshotIntervalsToKeep(), std::invalid_argument );
             REQUIRE_THROWS_AS( reader->ReadSnapshotInterval(), std::invalid_argument );
+            REQUIRE_THROWS_AS( reader->ReadStagingGenerationsToKeep(), std::invalid_argument );
             std::vector<double> const stamps( reader->ReadSnapshotTimeStamps() );
             REQUIRE( stamps.size() == 0 );
          }
@@ -190,6 +204,10 @@ SCENARIO( "Check that the xml restart reader works properly", "[1rank]" ) {
             REQUIRE_THROWS_AS( reader->ReadSnapshotInterval(), std::logic_error );
             REQUIRE_THROWS_AS( reader->ReadSnapshotTimeStamps(), std::logic_error );
          }
+         THEN( "The staging should be disabled" ) {
+            REQUIRE( reader->ReadStagingFolder().empty() );
+            REQUIRE( reader->ReadStagingGenerationsToKeep() == 1 );
+         }
       }
    }
 }
@@ -81,6 +81,8 @@ SCENARIO( "Check that the xml time control reader works properly", "[1rank]" ) {
                                   "     <CFLNumber> 0.6 </CFLNumber>"
                                   "     <startTime> 0.0 </startTime>"
                                   "     <endTime>   1.0 </endTime>"
+                                  "     <maximumMacroSteps> 20 </maximumMacroSteps>"
+                                  "     <walltimeLimit> 3600 </walltimeLimit>"
                                   "  </timeControl>"
                                   "</configuration>" );
       // Create the xml document
@@ -103,6 +105,16 @@ SCENARIO( "Check that the xml time control reader works properly", "[1rank]" ) {
             REQUIRE( reader->ReadEndTime() == 1.0 );
          }
       }
+      WHEN( "The maximum number of macro steps is read from the tree." ) {
+         THEN( "The maximum number of macro steps should be 20" ) {
+            REQUIRE( reader->ReadMaximumMacroSteps() == 20 );
+         }
+      }
+      WHEN( "The walltime limit is read from the tree." ) {
+         THEN( "The walltime limit should be 3600 seconds" ) {
+            REQUIRE( reader->ReadWalltimeLimit() == 3600.0 );
+         }
+      }
    }
    GIVEN( "A xml document with invalid content to read the time control data." ) {
       std::string const xml_data( "<configuration>"
@@ -110,6 +122,7 @@ SCENARIO( "Check that the xml time control reader works properly", "[1rank]" ) {
                                   "     <CFLNumber> 1.1 </CFLNumber>"
                                   "     <startTime> -1.0 </startTime>"
                                   "     <endTime> -5.0 </endTime>"
+                                  "     <walltimeLimit> -1.0 </walltimeLimit>"
                                   "  </timeControl>"
                                   "</configuration>" );
       // Create the xml document
@@ -132,6 +145,11 @@ SCENARIO( "Check that the xml time control reader works properly", "[1rank]" ) {
             REQUIRE_THROWS_AS( reader->ReadEndTime(), std::invalid_argument );
          }
       }
+      WHEN( "The walltime limit is read from the tree." ) {
+         THEN( "An std::invalid_argument exception should be thrown" ) {
+            REQUIRE_THROWS_AS( reader->ReadWalltimeLimit(), std::invalid_argument );
+         }
+      }
    }
 
    GIVEN( "A xml document with the non-existent tags to read the time control data." ) {
@@ -151,5 +169,15 @@ SCENARIO( "Check that the xml time control reader works properly", "[1rank]" ) {
             REQUIRE_THROWS_AS( reader->ReadEndTime(), std::logic_error );
          }
       }
+      WHEN( "The optional maximum number of macro steps is read." ) {
+         THEN( "The run is not limited by it" ) {
+            REQUIRE( reader->ReadMaximumMacroSteps() == 0 );
+         }
+      }
+      WHEN( "The optional walltime limit is read." ) {
+         THEN( "The run is not limited by it" ) {
+            REQUIRE( reader->ReadWalltimeLimit() == 0.0 );
+         }
+      }
    }
 }
@@ -0,0 +1,148 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+#include <limits>
+#include "topology/topology_manager.h"
+#include "test_mesh_generator_utilities.h"
+#include "input_output/output_writer/mesh_generator/mesh_generator_utilities.h"
+#include "input_output/output_writer/mesh_generator/decimated_mesh_generator.h"
+
+namespace {
+   /**
+    * @brief Gives a region of interest without bounds.
+    * @return The unbounded region.
+    */
+   std::array<std::array<double, 2>, 3> UnboundedRegion() {
+      std::array<std::array<double, 2>, 3> region;
+      region.fill( { std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max() } );
+      return region;
+   }
+}// namespace
+
+/********************************************************************************************************************************************/
+/*                                              TEST OF DECIMATION                                                                          */
+/********************************************************************************************************************************************/
+SCENARIO( "Decimated mesh generator: Only nodes up to the maximum level and in the region of interest are written", "[1rank]" ) {
+
+   GIVEN( "Underlying topology with Lmax being one and the first node refined" ) {
+
+      TopologyManager topology = TopologyManager( { 1, 1, 1 }, 1, 0 );
+      Tree tree( topology, 1, 1.0 );
+      TestUtilities::RefineFirstNodeInTopology( topology );
+      REQUIRE( topology.NodeAndLeafCount() == std::pair<unsigned int, unsigned int>( 9, 8 ) );
+
+      WHEN( "The maximum output level is one and the region is unbounded" ) {
+         std::unique_ptr<MeshGenerator const> mesh_generator = std::make_unique<DecimatedMeshGenerator const>( topology, tree, 1.0, 1, UnboundedRegion() );
+
+         THEN( "All eight leaves are written" ) {
+            REQUIRE( mesh_generator->GetGlobalNumberOfCells() == MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() * 8 );
+            REQUIRE( mesh_generator->GetLocalNumberOfCells() == MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() * 8 );
+            REQUIRE( mesh_generator->GetLocalCellsStartIndex() == 0 );
+            std::vector<hsize_t> const global_vertex_coordinates_dimensions = mesh_generator->GetGlobalDimensionsOfVertexCoordinates();
+            REQUIRE( global_vertex_coordinates_dimensions[0] == MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * 8 );
+            REQUIRE( global_vertex_coordinates_dimensions[1] == 3 );
+         }
+      }
+
+      WHEN( "The maximum output level is zero" ) {
+         std::unique_ptr<MeshGenerator const> mesh_generator = std::make_unique<DecimatedMeshGenerator const>( topology, tree, 1.0, 0, UnboundedRegion() );
+
+         std::vector<double> coordinates;
+         mesh_generator->ComputeVertexCoordinates( coordinates );
+         std::vector<unsigned long long int> vertex_ids;
+         mesh_generator->ComputeVertexIDs( vertex_ids );
+
+         THEN( "Only the parent node is written spanning the full domain" ) {
+            REQUIRE( mesh_generator->GetGlobalNumberOfCells() == MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() );
+            REQUIRE( coordinates.size() == MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * 3 );
+            REQUIRE( vertex_ids.size() == MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() * 8 );
+            REQUIRE( *std::max_element( vertex_ids.begin(), vertex_ids.end() ) < MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() );
+            REQUIRE( coordinates[0] == Approx( 0.0 ) );
+            REQUIRE( coordinates[( CC::ICX() + 1 ) * 3 - 3] == Approx( 1.0 ) );
+         }
+      }
+
+      WHEN( "The region of interest only covers the lower half in x-direction" ) {
+         std::array<std::array<double, 2>, 3> region = UnboundedRegion();
+         region[0] = { 0.0, 0.25 };
+         std::unique_ptr<MeshGenerator const> mesh_generator = std::make_unique<DecimatedMeshGenerator const>( topology, tree, 1.0, 1, region );
+
+         std::vector<double> coordinates;
+         mesh_generator->ComputeVertexCoordinates( coordinates );
+
+         THEN( "Only the four leaves in the lower half are written" ) {
+            REQUIRE( mesh_generator->GetGlobalNumberOfCells() == MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() * 4 );
+            REQUIRE( coordinates.size() == MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * 3 * 4 );
+            for( unsigned int vertex = 0; vertex < coordinates.size(); vertex += 3 ) {
+               REQUIRE( coordinates[vertex] <= 0.5 );
+            }
+         }
+      }
+   }
+}
@@ -99,6 +99,23 @@ namespace TestUtilities {
       }
    }
 
+   /**
+    * @brief Gives the number of leaves held by the own rank after the first node has been refined and load balanced on two ranks.
+    *        Siblings are kept on one rank, hence the whole family resides on rank zero.
+    * @return Number of local leaves.
+    */
+   inline unsigned int LocalLeavesOfBalancedFirstNode() {
+      return MpiUtilities::MyRankId() == 0 ? 8 : 0;
+   }
+
+   /**
+    * @brief Gives the number of leaves held by all lower ranks after the first node has been refined and load balanced on two ranks.
+    * @return Number of leaves on lower ranks.
+    */
+   inline unsigned int LeavesBelowRankOfBalancedFirstNode() {
+      return MpiUtilities::MyRankId() == 0 ? 0 : 8;
+   }
+
    /**
     * @brief Refines the two nodes in the topology
     * @param topology Topology that should be updated (indirect return)
@@ -165,7 +165,7 @@ SCENARIO( "Standard mesh generator without mpi-filtering: Vertex Coordinates loc
          THEN( "The local vertex coordinates dimension vector has two entries with the first being equal the number of vertices time the number of leafs (8) and the second being three" ) {
             std::vector<hsize_t> const local_vertex_coordinates_dimensions = mesh_generator->GetLocalDimensionsOfVertexCoordinates();
             REQUIRE( local_vertex_coordinates_dimensions.size() == 2 );
-            REQUIRE( local_vertex_coordinates_dimensions[0] == MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * 4 );
+            REQUIRE( local_vertex_coordinates_dimensions[0] == MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * TestUtilities::LocalLeavesOfBalancedFirstNode() );
             REQUIRE( local_vertex_coordinates_dimensions[1] == 3 );
          }
       }
@@ -219,7 +219,7 @@ SCENARIO( "Standard mesh generator without mpi-filtering: Vertex Coordinates sta
 
          THEN( "The local vertex coordinates dimension vector has two entries with the first being equal the number of vertices time the number of leafs (8) and the second being three" ) {
             hsize_t const local_vertex_coordinates_start_index = mesh_generator->GetLocalVertexCoordinatesStartIndex();
-            REQUIRE( local_vertex_coordinates_start_index == MpiUtilities::MyRankId() * MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * 4 );
+            REQUIRE( local_vertex_coordinates_start_index == TestUtilities::LeavesBelowRankOfBalancedFirstNode() * MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() );
          }
       }
    }
@@ -333,14 +333,14 @@ SCENARIO( "Standard mesh generator without mpi-filtering: Vertex coordinates nod
          std::vector<double> coordinates;
          mesh_generator->ComputeVertexCoordinates( coordinates );
 
-         THEN( "The coordinates vector has 3 * #of Leaves * #vertices * 4 #nodes and depending on the first coordinate of each node check corner points" ) {
-            REQUIRE( coordinates.size() == 4 * MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * 3 );
+         THEN( "The coordinates vector has 3 * #of Leaves * #vertices * #local nodes and depending on the first coordinate of each node check corner points" ) {
+            REQUIRE( coordinates.size() == TestUtilities::LocalLeavesOfBalancedFirstNode() * MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * 3 );
 
             // Define the cell size (2 nodes in each direction are present, ICX() since always filled)
             double const cell_size = 1.0 / double( CC::ICX() ) / 2;
 
             // Loop through all node start positions and check the coordinates at the corner positions depending on that
-            for( unsigned int node_start = 0; node_start < 4; node_start++ ) {
+            for( unsigned int node_start = 0; node_start < TestUtilities::LocalLeavesOfBalancedFirstNode(); node_start++ ) {
 
                // INdex of the node origin
                unsigned int const origin_idx = ( CC::ICX() + 1 ) * ( CC::ICY() + 1 ) * ( CC::ICZ() + 1 ) * 3 * node_start;
@@ -462,7 +462,7 @@ SCENARIO( "Standard mesh generator without mpi-filtering: Vertex IDs local dimen
          THEN( "The local vertex IDs dimension vector has two entries with the first being equal the number of vertices time the number of leafs (8) and the second being three" ) {
             std::vector<hsize_t> const local_vertex_IDs_dimensions = mesh_generator->GetLocalDimensionsOfVertexIDs();
             REQUIRE( local_vertex_IDs_dimensions.size() == 2 );
-            REQUIRE( local_vertex_IDs_dimensions[0] == MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() * 4 );
+            REQUIRE( local_vertex_IDs_dimensions[0] == MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() * TestUtilities::LocalLeavesOfBalancedFirstNode() );
             REQUIRE( local_vertex_IDs_dimensions[1] == 8 );
          }
       }
@@ -516,7 +516,7 @@ SCENARIO( "Standard mesh generator without mpi-filtering: Vertex IDs start index
 
          THEN( "The local vertex coordinates dimension vector has two entries with the first being equal the number of vertices time the number of leafs (4) and the second being three" ) {
             hsize_t const local_vertex_IDs_start_index = mesh_generator->GetLocalVertexIDsStartIndex();
-            REQUIRE( local_vertex_IDs_start_index == MpiUtilities::MyRankId() * MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() * 4 );
+            REQUIRE( local_vertex_IDs_start_index == TestUtilities::LeavesBelowRankOfBalancedFirstNode() * MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() );
          }
       }
    }
@@ -670,10 +670,10 @@ SCENARIO( "Standard mesh generator without mpi-filtering: Check that vertex IDs
 
          THEN( "The coordinates of the IDs of each cell must be in an order where first x is increased, then y and last z" ) {
             // Check the total size of both vectors
-            REQUIRE( coordinates.size() == 4 * MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * 3 );
-            REQUIRE( vertex_ids.size() == 4 * MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() * 8 );
-            // Check that the largest index in the vertex ids is not larger than the size of the coordinates vector
-            REQUIRE( *std::max_element( vertex_ids.begin(), vertex_ids.end() ) < 4 * MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * 3 );
+            REQUIRE( coordinates.size() == TestUtilities::LocalLeavesOfBalancedFirstNode() * MeshGeneratorUtilities::NumberOfInternalVerticesPerBlock() * 3 );
+            REQUIRE( vertex_ids.size() == TestUtilities::LocalLeavesOfBalancedFirstNode() * MeshGeneratorUtilities::NumberOfInternalCellsPerBlock() * 8 );
+            // Check that no index in the vertex ids is larger than the size of the coordinates vector (ranks without leaves hold no ids)
+            REQUIRE( std::all_of( vertex_ids.begin(), vertex_ids.end(), [&coordinates]( unsigned long long int const id ) { return id < coordinates.size(); } ) );
          }
       }
    }
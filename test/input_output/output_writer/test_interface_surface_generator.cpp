@@ -0,0 +1,152 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+#include <cmath>
+#include "input_output/output_writer/interface_surface_generator.h"
+#include "utilities/vector_utilities.h"
+
+namespace {
+   /**
+    * @brief Fills the level-set field of a block with the signed distance to the plane x = position.
+    * @param levelset The level-set field (indirect return).
+    * @param position The x-coordinate of the plane in units of the cell size, measured from the corner of the first internal cell.
+    */
+   void SetPlanarLevelset( double ( &levelset )[CC::TCX()][CC::TCY()][CC::TCZ()], double const position ) {
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               levelset[i][j][k] = double( i ) - double( CC::FICX() ) + 0.5 - position;
+            }
+         }
+      }
+   }
+}
+
+SCENARIO( "The surface of a planar interface is extracted exactly", "[1rank]" ) {
+   if constexpr( CC::DIM() != Dimension::One ) {
+      GIVEN( "A block with unit cells cut by a plane normal to x" ) {
+         double levelset[CC::TCX()][CC::TCY()][CC::TCZ()];
+         double const position = 0.5 * double( CC::ICX() ) + 0.25;
+         SetPlanarLevelset( levelset, position );
+         std::array<double, 3> const origin = { 2.0, 0.0, 0.0 };
+
+         WHEN( "The surface is extracted" ) {
+            std::vector<unsigned long long int> vertex_ids;
+            std::vector<double> vertex_coordinates;
+            InterfaceSurfaceGenerator::ExtractBlockSurface( levelset, origin, 1.0, vertex_ids, vertex_coordinates );
+
+            THEN( "All vertices lie on the plane and are referenced by the elements" ) {
+               REQUIRE( vertex_ids.size() % InterfaceSurfaceGenerator::VerticesPerElement() == 0 );
+               REQUIRE( !vertex_ids.empty() );
+               for( std::size_t v = 0; v < vertex_coordinates.size(); v += 3 ) {
+                  REQUIRE( vertex_coordinates[v] == Approx( origin[0] + position ) );
+               }
+               for( unsigned long long int const id : vertex_ids ) {
+                  REQUIRE( id < vertex_coordinates.size() / 3 );
+               }
+            }
+            THEN( "The surface covers the dual cells of the block once and is oriented towards positive values" ) {
+               double measure = 0.0;
+               unsigned int const vertices_per_element = InterfaceSurfaceGenerator::VerticesPerElement();
+               for( std::size_t e = 0; e < vertex_ids.size(); e += vertices_per_element ) {
+                  std::array<std::array<double, 3>, 3> corners;
+                  for( unsigned int v = 0; v < vertices_per_element; ++v ) {
+                     corners[v] = { vertex_coordinates[3 * vertex_ids[e + v]], vertex_coordinates[3 * vertex_ids[e + v] + 1],
+                                    vertex_coordinates[3 * vertex_ids[e + v] + 2] };
+                  }
+                  if constexpr( CC::DIM() == Dimension::Three ) {
+                     std::array<double, 3> const normal = VU::CrossProduct( VU::Difference( corners[0], corners[1] ), VU::Difference( corners[0], corners[2] ) );
+                     REQUIRE( normal[0] >= 0.0 );
+                     measure += 0.5 * VU::L2Norm( normal );
+                  } else {
+                     measure += VU::Distance( corners[0], corners[1] );
+                  }
+               }
+               REQUIRE( measure == Approx( double( CC::ICY() * CC::ICZ() ) ) );
+            }
+         }
+      }
+
+      GIVEN( "A block that is not cut by the interface" ) {
+         double levelset[CC::TCX()][CC::TCY()][CC::TCZ()];
+         SetPlanarLevelset( levelset, -double( CC::HS() ) );
+
+         WHEN( "The surface is extracted" ) {
+            std::vector<unsigned long long int> vertex_ids;
+            std::vector<double> vertex_coordinates;
+            InterfaceSurfaceGenerator::ExtractBlockSurface( levelset, { 0.0, 0.0, 0.0 }, 1.0, vertex_ids, vertex_coordinates );
+
+            THEN( "No surface is generated" ) {
+               REQUIRE( vertex_ids.empty() );
+               REQUIRE( vertex_coordinates.empty() );
+            }
+         }
+      }
+   }
+}
@@ -0,0 +1,142 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "input_output/output_writer/output_quantities/custom_material_quantities/helicity_output.h"
+#include "input_output/output_writer/output_quantities/custom_material_quantities/vortex_stretching_output.h"
+#include "input_output/output_writer/output_quantities/custom_material_quantities/vorticity_absolute_output.h"
+#include "materials/equations_of_state/stiffened_gas.h"
+#include "materials/material_type_definitions.h"
+#include "topology/topology_manager.h"
+#include "topology/tree.h"
+
+SCENARIO( "Fused computation of output quantities with shared intermediates", "[1rank]" ) {
+
+   UnitHandler const unit_handler( 1.0, 1.0, 1.0, 1.0 );
+   std::unordered_map<std::string, double> const eos_data = { { "gamma", 1.4 }, { "backgroundPressure", 1.0 } };
+   std::vector<std::tuple<MaterialType, Material>> materials;
+   materials.emplace_back( std::make_tuple( MaterialType::Fluid, Material( std::make_unique<StiffenedGas const>( eos_data, unit_handler ), 0.0, 0.0, 0.0, 0.0, nullptr, nullptr, unit_handler ) ) );
+   MaterialManager const material_manager( std::move( materials ), std::vector<MaterialPairing>() );
+
+   GIVEN( "A single node in solid body rotation u = -y, v = x" ) {
+      TopologyManager topology = TopologyManager( { 1, 1, 1 }, 1, 0 );
+      Tree tree( topology, 1, 1.0 );
+      topology.UpdateTopology();
+      topology.AddMaterialToNode( 0x1400000, MaterialName::MaterialOne );
+      tree.CreateNode( 0x1400000, { MaterialName::MaterialOne } );
+      topology.UpdateTopology();
+      Node& node = tree.GetNodeWithId( 0x1400000 );
+      double const cell_size = node.GetCellSize();
+      PrimeStates& prime_states = node.GetPhaseByMaterial( MaterialName::MaterialOne ).GetPrimeStateBuffer();
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               prime_states[PrimeState::VelocityX][i][j][k] = CC::DIM() != Dimension::One ? -double( j ) * cell_size : 0.0;
+               if constexpr( CC::DIM() != Dimension::One ) {
+                  prime_states[PrimeState::VelocityY][i][j][k] = double( i ) * cell_size;
+               }
+               if constexpr( CC::DIM() == Dimension::Three ) {
+                  prime_states[PrimeState::VelocityZ][i][j][k] = 1.0;
+               }
+            }
+         }
+      }
+      std::vector<std::reference_wrapper<Node const>> const nodes = { node };
+
+      VorticityAbsoluteOutput const vorticity( unit_handler, material_manager, "vorticity", { true, false, false } );
+      HelicityOutput const helicity( unit_handler, material_manager, "helicity", { true, false, false } );
+      VortexStretchingOutput const stretching( unit_handler, material_manager, "vortex_stretching", { true, false, false } );
+      std::size_t const number_of_cells = CC::ICX() * CC::ICY() * CC::ICZ();
+
+      WHEN( "The quantities are computed in a fused pass" ) {
+         std::vector<std::vector<double>> fused_cell_data( 3, std::vector<double>( number_of_cells ) );
+         OutputQuantity::ComputeFusedCellData( { vorticity, helicity, stretching }, nodes, fused_cell_data );
+
+         THEN( "The values match the individual computation and the exact vorticity" ) {
+            std::vector<double> cell_data( number_of_cells );
+            vorticity.ComputeCellData( nodes, cell_data );
+            REQUIRE( fused_cell_data[0] == cell_data );
+            helicity.ComputeCellData( nodes, cell_data );
+            REQUIRE( fused_cell_data[1] == cell_data );
+            stretching.ComputeCellData( nodes, cell_data );
+            REQUIRE( fused_cell_data[2] == cell_data );
+            // the vorticity only has an out-of-plane component, which is not part of the norm in two dimensions
+            double const exact_vorticity = CC::DIM() == Dimension::Three ? 2.0 : 0.0;
+            for( std::size_t cell = 0; cell < number_of_cells; ++cell ) {
+               REQUIRE( fused_cell_data[0][cell] == Approx( exact_vorticity ).margin( 1.0e-10 ) );
+               REQUIRE( fused_cell_data[2][cell] == Approx( 0.0 ).margin( 1.0e-10 ) );
+            }
+         }
+      }
+   }
+}
@@ -0,0 +1,194 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "input_output/in_situ_analysis.h"
+#include "materials/equations_of_state/stiffened_gas.h"
+#include "materials/material_type_definitions.h"
+#include "topology/topology_manager.h"
+#include "topology/tree.h"
+
+namespace {
+   /**
+    * @brief Scalar quantity whose value is the one-based index of the cell in x-direction.
+    */
+   class CellIndexQuantity : public OutputQuantity {
+      void DoComputeCellData( Node const&, std::vector<double>& cell_data, unsigned long long int& cell_data_counter ) const override {
+         for( unsigned int k = 0; k < CC::ICZ(); ++k ) {
+            for( unsigned int j = 0; j < CC::ICY(); ++j ) {
+               for( unsigned int i = 0; i < CC::ICX(); ++i ) {
+                  cell_data[cell_data_counter++] = double( i + 1 );
+               }
+            }
+         }
+      }
+      void DoComputeDebugCellData( Node const&, std::vector<double>&, unsigned long long int&, MaterialName const ) const override {}
+
+   public:
+      CellIndexQuantity( UnitHandler const& unit_handler, MaterialManager const& material_manager ) : OutputQuantity( unit_handler, material_manager, "index", { true, false, false }, { 1, 1 } ) {}
+   };
+
+   /**
+    * @brief Gives the quantity vector used in the analysis.
+    */
+   std::vector<std::unique_ptr<OutputQuantity const>> CellIndexQuantities( UnitHandler const& unit_handler, MaterialManager const& material_manager ) {
+      std::vector<std::unique_ptr<OutputQuantity const>> quantities;
+      quantities.push_back( std::make_unique<CellIndexQuantity const>( unit_handler, material_manager ) );
+      return quantities;
+   }
+}// namespace
+
+SCENARIO( "The in-situ analysis reduces, probes and slices output quantities", "[1rank]" ) {
+
+   UnitHandler const unit_handler( 1.0, 1.0, 1.0, 1.0 );
+   std::unordered_map<std::string, double> const eos_data = { { "gamma", 1.4 }, { "backgroundPressure", 1.0 } };
+   std::vector<std::tuple<MaterialType, Material>> materials;
+   materials.emplace_back( std::make_tuple( MaterialType::Fluid, Material( std::make_unique<StiffenedGas const>( eos_data, unit_handler ), 0.0, 0.0, 0.0, 0.0, nullptr, nullptr, unit_handler ) ) );
+   MaterialManager const material_manager( std::move( materials ), std::vector<MaterialPairing>() );
+
+   GIVEN( "A single node of unit size with a quantity increasing in x-direction" ) {
+      TopologyManager topology = TopologyManager( { 1, 1, 1 }, 1, 0 );
+      Tree tree( topology, 1, 1.0 );
+      topology.UpdateTopology();
+      topology.AddMaterialToNode( 0x1400000, MaterialName::MaterialOne );
+      tree.CreateNode( 0x1400000, { MaterialName::MaterialOne } );
+      topology.UpdateTopology();
+      std::vector<InSituReduction> reductions = { { "index", 0, InSituOperation::Integral },
+                                                  { "index", 0, InSituOperation::SquaredIntegral },
+                                                  { "index", 0, InSituOperation::Mean },
+                                                  { "index", 0, InSituOperation::Minimum },
+                                                  { "index", 0, InSituOperation::Maximum } };
+      std::vector<InSituProbe> probes = { { "index", 0, { 0.01, 0.5, 0.5 } },
+                                          { "index", 0, { 1.0, 0.5, 0.5 } },
+                                          { "index", 0, { 2.0, 0.5, 0.5 } } };
+      InSituAnalysis const analysis( topology, tree, 1.0, 2, CellIndexQuantities( unit_handler, material_manager ), reductions, probes, {} );
+
+      WHEN( "The analysis is evaluated" ) {
+         std::vector<double> const values = analysis.Evaluate();
+         double const number_of_cells = double( CC::ICX() );
+
+         THEN( "The reductions give the volume integrals and extreme values and the probes the value of the containing cell" ) {
+            REQUIRE( analysis.IsDue( 4 ) );
+            REQUIRE_FALSE( analysis.IsDue( 3 ) );
+            REQUIRE( analysis.ColumnNames().size() == 8 );
+            REQUIRE( analysis.ColumnNames()[0] == "Integral(index)" );
+            REQUIRE( values.size() == 8 );
+            REQUIRE( values[0] == Approx( 0.5 * ( number_of_cells + 1.0 ) ) );
+            REQUIRE( values[1] == Approx( ( number_of_cells + 1.0 ) * ( 2.0 * number_of_cells + 1.0 ) / 6.0 ) );
+            REQUIRE( values[2] == Approx( 0.5 * ( number_of_cells + 1.0 ) ) );
+            REQUIRE( values[3] == 1.0 );
+            REQUIRE( values[4] == number_of_cells );
+            REQUIRE( values[5] == 1.0 );
+            REQUIRE( values[6] == number_of_cells );
+            REQUIRE( std::isnan( values[7] ) );
+         }
+      }
+
+      WHEN( "A reduction refers to an unknown quantity" ) {
+         reductions.push_back( { "density", 0, InSituOperation::Maximum } );
+
+         THEN( "The creation of the analysis throws" ) {
+            REQUIRE_THROWS_AS( InSituAnalysis( topology, tree, 1.0, 2, CellIndexQuantities( unit_handler, material_manager ), reductions, probes, {} ), std::invalid_argument );
+         }
+      }
+
+      WHEN( "A line along x is resampled to the level of the node and to a finer level" ) {
+         std::vector<InSituSlice> const slices = { { "index", 0, { true, false, false }, { 0.0, 0.5, 0.5 }, 0, false },
+                                                   { "index", 0, { true, false, false }, { 0.0, 0.5, 0.5 }, 1, false } };
+         InSituAnalysis const analysis( topology, tree, 1.0, 2, CellIndexQuantities( unit_handler, material_manager ), {}, {}, slices );
+         std::vector<std::vector<double>> const values = analysis.EvaluateSlices();
+
+         THEN( "The grid on the node level holds the cell values and the finer grid the predicted ones" ) {
+            REQUIRE( analysis.IsActive() );
+            REQUIRE( analysis.ColumnNames().empty() );
+            REQUIRE( analysis.SliceGrids()[0].cells_ == std::vector<unsigned int>{ CC::ICX() } );
+            REQUIRE( analysis.SliceGrids()[1].cells_ == std::vector<unsigned int>{ 2 * CC::ICX() } );
+            REQUIRE( analysis.SliceGrids()[1].cell_size_ == Approx( 0.5 / double( CC::ICX() ) ) );
+            REQUIRE( values.size() == 2 );
+            for( unsigned int i = 0; i < CC::ICX(); ++i ) {
+               REQUIRE( values[0][i] == double( i + 1 ) );
+               REQUIRE( values[1][2 * i] == double( i + 1 ) );
+               REQUIRE( values[1][2 * i + 1] == double( i + 1 ) );
+            }
+         }
+      }
+
+      WHEN( "A slice is resampled to a level above the maximum level" ) {
+         std::vector<InSituSlice> const slices = { { "index", 0, { true, false, false }, { 0.0, 0.5, 0.5 }, 2, false } };
+
+         THEN( "The creation of the analysis throws" ) {
+            REQUIRE_THROWS_AS( InSituAnalysis( topology, tree, 1.0, 2, CellIndexQuantities( unit_handler, material_manager ), {}, {}, slices ), std::invalid_argument );
+         }
+      }
+   }
+}
@@ -0,0 +1,148 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "input_output/input_reader/multi_resolution_reader/xml_multi_resolution_reader.h"
+#include "input_output/input_reader/time_control_reader/xml_time_control_reader.h"
+#include "input_output/utilities/benchmark_inputfile.h"
+#include "user_specifications/compile_time_constants.h"
+
+SCENARIO( "The benchmark options are parsed from the command line", "[1rank]" ) {
+   GIVEN( "No options" ) {
+      BenchmarkSetup const setup = BenchmarkInputfile::ParseArguments( {} );
+      THEN( "The defaults are used" ) {
+         REQUIRE( setup.macro_steps_ == 10 );
+         REQUIRE( setup.blocks_per_rank_ == 8 );
+         REQUIRE_FALSE( setup.multi_phase_ );
+      }
+   }
+   GIVEN( "All options" ) {
+      BenchmarkSetup const setup = BenchmarkInputfile::ParseArguments( { "--steps", "20", "--multi-phase", "--blocks", "4" } );
+      THEN( "All settings are taken over" ) {
+         REQUIRE( setup.macro_steps_ == 20 );
+         REQUIRE( setup.blocks_per_rank_ == 4 );
+         REQUIRE( setup.multi_phase_ );
+      }
+   }
+   GIVEN( "Invalid options" ) {
+      THEN( "An std::invalid_argument exception is thrown" ) {
+         REQUIRE_THROWS_AS( BenchmarkInputfile::ParseArguments( { "--steps" } ), std::invalid_argument );
+         REQUIRE_THROWS_AS( BenchmarkInputfile::ParseArguments( { "--blocks", "0" } ), std::invalid_argument );
+         REQUIRE_THROWS_AS( BenchmarkInputfile::ParseArguments( { "--output" } ), std::invalid_argument );
+      }
+   }
+}
+
+SCENARIO( "The benchmark blocks are arranged in a box close to a cube", "[1rank]" ) {
+   GIVEN( "64 blocks" ) {
+      std::array<unsigned int, 3> const ratio = BenchmarkInputfile::NodeRatio( 64 );
+      THEN( "All blocks are placed, sorted descending from x to z" ) {
+         REQUIRE( ratio[0] * ratio[1] * ratio[2] == 64 );
+         REQUIRE( ratio[0] >= ratio[1] );
+         REQUIRE( ratio[1] >= ratio[2] );
+         if constexpr( CC::DIM() == Dimension::Three ) {
+            REQUIRE( ratio == std::array<unsigned int, 3>( { 4, 4, 4 } ) );
+         } else if constexpr( CC::DIM() == Dimension::Two ) {
+            REQUIRE( ratio == std::array<unsigned int, 3>( { 8, 8, 1 } ) );
+         } else {
+            REQUIRE( ratio == std::array<unsigned int, 3>( { 64, 1, 1 } ) );
+         }
+      }
+   }
+   GIVEN( "A prime number of blocks larger than the level-zero limit" ) {
+      THEN( "An std::invalid_argument exception is thrown" ) {
+         REQUIRE_THROWS_AS( BenchmarkInputfile::NodeRatio( 131 ), std::invalid_argument );
+      }
+   }
+}
+
+SCENARIO( "The benchmark input is valid xml for the input readers", "[1rank]" ) {
+   GIVEN( "The input of a benchmark on two ranks" ) {
+      BenchmarkSetup setup;
+      setup.macro_steps_ = 5;
+      setup.blocks_per_rank_ = 4;
+      std::shared_ptr<tinyxml2::XMLDocument> xml_tree( std::make_shared<tinyxml2::XMLDocument>() );
+      REQUIRE( xml_tree->Parse( BenchmarkInputfile::Create( setup, 2 ).c_str() ) == tinyxml2::XML_SUCCESS );
+      THEN( "The run is limited by the macro steps" ) {
+         XmlTimeControlReader const reader( xml_tree );
+         REQUIRE( reader.ReadMaximumMacroSteps() == 5 );
+      }
+      THEN( "The mesh is uniform and holds all blocks" ) {
+         XmlMultiResolutionReader const reader( xml_tree );
+         REQUIRE( reader.ReadMaximumLevel() == 0 );
+         REQUIRE( reader.ReadNumberOfNodes( Direction::X ) * reader.ReadNumberOfNodes( Direction::Y ) * reader.ReadNumberOfNodes( Direction::Z ) == 8 );
+      }
+   }
+}
@@ -70,6 +70,10 @@
 
 #include "input_output/utilities/file_utilities.h"
 
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
 SCENARIO( "File extensions can be changed", "[1rank]" ) {
    GIVEN( "A filename with absolute path and .txt extension" ) {
       std::string const txt_filename_with_path = "/scratch/directory/file.txt";
@@ -129,3 +133,21 @@ SCENARIO( "File paths can be removed", "[1rank]" ) {
       REQUIRE( FileUtilities::RemoveFilePath( txt_filename_with_path ) == "file.longext" );
    }
 }
+
+SCENARIO( "Text files can be replaced atomically", "[1rank]" ) {
+   GIVEN( "An existing text file" ) {
+      std::string const filename = "replaced_file_test.txt";
+      FileUtilities::WriteTextBasedFile( filename, "old content" );
+      WHEN( "The file is replaced" ) {
+         FileUtilities::ReplaceTextBasedFile( filename, "new content" );
+         std::ifstream input_stream( filename );
+         std::stringstream content;
+         content << input_stream.rdbuf();
+         THEN( "The file holds the new content and no temporary file is left" ) {
+            REQUIRE( content.str() == "new content" );
+            REQUIRE_FALSE( FileUtilities::CheckIfPathExists( filename + ".tmp" ) );
+         }
+      }
+      std::remove( filename.c_str() );
+   }
+}
@@ -0,0 +1,106 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include "input_output/utilities/run_status.h"
+
+#include <limits>
+
+SCENARIO( "The run status is converted into a JSON object", "[1rank]" ) {
+   GIVEN( "The status of a run with a projected remaining time" ) {
+      RunStatus status;
+      status.simulation_time_ = 0.5;
+      status.end_time_ = 1.0;
+      status.macro_steps_ = 12;
+      status.number_of_leaves_ = 64;
+      status.remaining_seconds_ = 3600.0;
+      status.updated_ = 0;
+      std::string const json = RunStatusJson( status );
+      THEN( "All entries are given as one object" ) {
+         REQUIRE( json.front() == '{' );
+         REQUIRE( json.find( "\"macro_steps\": 12," ) != std::string::npos );
+         REQUIRE( json.find( "\"number_of_leaves\": 64," ) != std::string::npos );
+         REQUIRE( json.find( "\"simulation_time\": 5.000000000e-01," ) != std::string::npos );
+         REQUIRE( json.substr( json.size() - 2 ) == "}\n" );
+      }
+      THEN( "The update and completion times are given in UTC" ) {
+         REQUIRE( json.find( "\"updated\": \"1970-01-01T00:00:00Z\"," ) != std::string::npos );
+         REQUIRE( json.find( "\"projected_completion\": \"1970-01-01T01:00:00Z\"" ) != std::string::npos );
+      }
+   }
+   GIVEN( "The status of a run without a projected remaining time" ) {
+      RunStatus status;
+      status.remaining_seconds_ = std::numeric_limits<double>::infinity();
+      std::string const json = RunStatusJson( status );
+      THEN( "The remaining time and completion are null" ) {
+         REQUIRE( json.find( "\"remaining_seconds\": null," ) != std::string::npos );
+         REQUIRE( json.find( "\"projected_completion\": null" ) != std::string::npos );
+      }
+   }
+}
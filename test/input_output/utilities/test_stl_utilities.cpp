@@ -182,3 +182,105 @@ SCENARIO( "The distance to a triangle is computed properly", "[1rank]" ) {
       }
    }
 }
+
+SCENARIO( "The closest point on a triangle is found in all regions of the triangle", "[1rank]" ) {
+   GIVEN( "A right triangle in the x-y-plane." ) {
+      StlUtilities::Triangle const triangle( { 0.0, 0.0, 1.0 }, { 0.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 }, { 0.0, 2.0, 0.0 } );
+      WHEN( "The point lies above the face" ) {
+         THEN( "The closest point is its projection" ) {
+            constexpr std::array<double, 3> projection = { 0.5, 0.5, 0.0 };
+            REQUIRE( StlUtilities::ClosestPointOnTriangle( triangle, { 0.5, 0.5, 3.0 } ) == projection );
+         }
+      }
+      WHEN( "The point lies beyond the hypotenuse" ) {
+         THEN( "The closest point lies on the hypotenuse" ) {
+            auto const closest = StlUtilities::ClosestPointOnTriangle( triangle, { 2.0, 2.0, 1.0 } );
+            REQUIRE( closest[0] == Approx( 1.0 ) );
+            REQUIRE( closest[1] == Approx( 1.0 ) );
+            REQUIRE( closest[2] == Approx( 0.0 ) );
+         }
+      }
+      WHEN( "The point lies beyond a corner" ) {
+         THEN( "The closest point is the corner" ) {
+            constexpr std::array<double, 3> first_corner  = { 0.0, 0.0, 0.0 };
+            constexpr std::array<double, 3> second_corner = { 2.0, 0.0, 0.0 };
+            REQUIRE( StlUtilities::ClosestPointOnTriangle( triangle, { -1.0, -1.0, 0.5 } ) == first_corner );
+            REQUIRE( StlUtilities::ClosestPointOnTriangle( triangle, { 3.0, -0.5, 0.0 } ) == second_corner );
+         }
+      }
+   }
+}
+
+SCENARIO( "The bounding volume hierarchy gives the signed distance to a closed surface", "[1rank]" ) {
+   GIVEN( "The surface of an octahedron with outward normals refined into many triangles." ) {
+      // Each face of the octahedron with corners at distance one from the origin is split into n * n triangles
+      constexpr unsigned int n = 6;
+      std::vector<StlUtilities::Triangle> triangles;
+      for( double const sx : { -1.0, 1.0 } ) {
+         for( double const sy : { -1.0, 1.0 } ) {
+            for( double const sz : { -1.0, 1.0 } ) {
+               std::array<double, 3> const normal = { sx, sy, sz };
+               auto const corner                  = [&]( unsigned int const a, unsigned int const b ) {
+                  double const u = double( a ) / n;
+                  double const v = double( b ) / n;
+                  return std::array<double, 3>( { sx * u, sy * v, sz * ( 1.0 - u - v ) } );
+               };
+               for( unsigned int a = 0; a < n; ++a ) {
+                  for( unsigned int b = 0; a + b < n; ++b ) {
+                     triangles.emplace_back( normal, corner( a, b ), corner( a + 1, b ), corner( a, b + 1 ) );
+                     if( a + b + 1 < n ) {
+                        triangles.emplace_back( normal, corner( a + 1, b ), corner( a + 1, b + 1 ), corner( a, b + 1 ) );
+                     }
+                  }
+               }
+            }
+         }
+      }
+      StlUtilities::BoundingVolumeHierarchy const hierarchy( triangles );
+      WHEN( "The signed distance is computed on a grid of points around the surface" ) {
+         THEN( "Its magnitude is the distance to the closest of all triangles" ) {
+            for( int i = -7; i <= 7; ++i ) {
+               for( int j = -7; j <= 7; ++j ) {
+                  for( int k = -7; k <= 7; ++k ) {
+                     std::array<double, 3> const point = { 0.2 * i + 0.013, 0.2 * j - 0.007, 0.2 * k + 0.003 };
+                     double distance                   = std::numeric_limits<double>::max();
+                     for( StlUtilities::Triangle const& triangle : triangles ) {
+                        distance = std::min( distance, VU::Distance( point, StlUtilities::ClosestPointOnTriangle( triangle, point ) ) );
+                     }
+                     REQUIRE( std::abs( hierarchy.SignedDistance( point ) ) == Approx( distance ) );
+                  }
+               }
+            }
+         }
+         THEN( "It is positive inside and negative outside of the surface" ) {
+            for( int i = -7; i <= 7; ++i ) {
+               for( int j = -7; j <= 7; ++j ) {
+                  for( int k = -7; k <= 7; ++k ) {
+                     std::array<double, 3> const point = { 0.2 * i + 0.013, 0.2 * j - 0.007, 0.2 * k + 0.003 };
+                     bool const inside                 = std::abs( point[0] ) + std::abs( point[1] ) + std::abs( point[2] ) < 1.0;
+                     REQUIRE( ( hierarchy.SignedDistance( point ) > 0.0 ) == inside );
+                  }
+               }
+            }
+         }
+      }
+      WHEN( "The closest point of the surface is a corner or an edge" ) {
+         THEN( "The distance is the one to the corner or the edge with negative sign" ) {
+            REQUIRE( hierarchy.SignedDistance( { 2.0, 0.0, 0.0 } ) == Approx( -1.0 ) );
+            REQUIRE( hierarchy.SignedDistance( { 0.6, 0.6, 0.0 } ) == Approx( -std::sqrt( 0.02 ) ) );
+         }
+      }
+      WHEN( "The point is the center" ) {
+         THEN( "The distance is the one to the faces with positive sign" ) {
+            REQUIRE( hierarchy.SignedDistance( { 0.0, 0.0, 0.0 } ) == Approx( 1.0 / std::sqrt( 3.0 ) ) );
+         }
+      }
+   }
+   GIVEN( "No triangles" ) {
+      std::vector<StlUtilities::Triangle> const triangles;
+      StlUtilities::BoundingVolumeHierarchy const hierarchy( triangles );
+      THEN( "The distance is the largest double" ) {
+         REQUIRE( hierarchy.SignedDistance( { 0.0, 0.0, 0.0 } ) == std::numeric_limits<double>::max() );
+      }
+   }
+}
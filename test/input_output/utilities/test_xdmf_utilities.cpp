@@ -102,6 +102,10 @@ SCENARIO( "DataItems can be correctly populated", "[1rank]" ) {
          std::array<unsigned int, 2> const dimensions = { 2, 2 };
          REQUIRE( XdmfUtilities::DataItemString( filename, dataset, number_of_cells, dimensions ) == "<DataItem Format=\"HDF\" NumberType=\"Float\" Precision=\"8\" Dimensions=\"42 2 2\"> test.h5:/ds </DataItem>\n" );
       }
+      WHEN( "Created with dimensions of scalar in single precision" ) {
+         std::array<unsigned int, 2> const dimensions = { 1, 1 };
+         REQUIRE( XdmfUtilities::DataItemString( filename, dataset, number_of_cells, dimensions, 4 ) == "<DataItem Format=\"HDF\" NumberType=\"Float\" Precision=\"4\" Dimensions=\"42\"> test.h5:/ds </DataItem>\n" );
+      }
    }
 }
 
@@ -159,6 +159,9 @@ namespace {
       When( Method( multiresolution_reader, ReadNumberOfNodes ).Using( Direction::Z ) ).AlwaysReturn( number_of_nodes[2] );
       When( Method( multiresolution_reader, ReadMaximumLevel ) ).Return( maximum_level );
       When( Method( multiresolution_reader, ReadNodeSizeOnLevelZero ) ).Return( node_size );
+      When( Method( multiresolution_reader, ReadLoadImbalanceThreshold ) ).AlwaysReturn( 0.0 );
+      When( Method( multiresolution_reader, ReadSpaceFillingCurve ) ).AlwaysReturn( SpaceFillingCurveSettings::DefaultSpaceFillingCurve );
+      When( Method( multiresolution_reader, ReadHaloExchange ) ).AlwaysReturn( HaloExchange::TwoSided );
 
       return multiresolution_reader;
    }
@@ -191,6 +194,7 @@ namespace {
 
       When( Method( initial_condition_reader, ReadMaterialInitialConditions ).Using( 1 ) ).Return( density_one + velocity_one + pressure_one );
       When( Method( initial_condition_reader, ReadMaterialInitialConditions ).Using( 2 ) ).Return( density_two + velocity_two + pressure_two );
+      When( Method( initial_condition_reader, ReadMaterialInitialConditionFile ) ).AlwaysReturn( "" );
       When( Method( initial_condition_reader, ReadLevelsetInitializerType ) ).AlwaysReturn( LevelsetInitializerType::Functional );
       When( Method( initial_condition_reader, ReadLevelsetInitializerInput ) ).AlwaysReturn( levelset );
       When( Method( initial_condition_reader, ReadLevelsetInitializerBoundingBoxes ) ).AlwaysReturn( {} );
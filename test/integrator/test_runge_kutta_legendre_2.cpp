@@ -0,0 +1,133 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <cmath>
+
+#include "integrator/runge_kutta_legendre_2.h"
+
+namespace {
+   /**
+    * @brief Performs a super step of the RKL2 scheme on the scalar decay equation y' = -lambda * y.
+    */
+   double SuperStep( double const initial_value, double const lambda, double const timestep, unsigned int const number_of_stages ) {
+      double const initial_right_hand_side = -lambda * initial_value;
+      double second_last = initial_value;
+      double last = initial_value;
+      for( unsigned int stage = 1; stage <= number_of_stages; ++stage ) {
+         RungeKuttaLegendre2::StageCoefficients const c = RungeKuttaLegendre2::Coefficients( number_of_stages, stage );
+         double const next = c.mu_ * last + c.nu_ * second_last + ( 1.0 - c.mu_ - c.nu_ ) * initial_value + c.mu_tilde_ * timestep * ( -lambda * last ) +
+                             c.gamma_tilde_ * timestep * initial_right_hand_side;
+         second_last = last;
+         last = next;
+      }
+      return last;
+   }
+}// namespace
+
+SCENARIO( "The RKL2 scheme chooses enough stages for stability", "[1rank]" ) {
+   GIVEN( "Timesteps of different multiples of the explicit one" ) {
+      WHEN( "The timestep equals the explicit one" ) {
+         THEN( "Two stages are used" ) {
+            REQUIRE( RungeKuttaLegendre2::NumberOfStages( 1.0, 1.0 ) == 2 );
+            REQUIRE( RungeKuttaLegendre2::NumberOfStages( 0.1, 1.0 ) == 2 );
+         }
+      }
+      WHEN( "The timestep is larger" ) {
+         THEN( "The fewest stable stages are used" ) {
+            for( double const ratio : { 1.5, 2.5, 10.0, 100.0 } ) {
+               unsigned int const s = RungeKuttaLegendre2::NumberOfStages( ratio, 1.0 );
+               REQUIRE( 0.25 * double( s * s + s - 2 ) >= ratio );
+               REQUIRE( 0.25 * double( ( s - 1 ) * ( s - 1 ) + ( s - 1 ) - 2 ) < ratio );
+            }
+         }
+      }
+   }
+}
+
+SCENARIO( "The RKL2 scheme integrates a decaying state", "[1rank]" ) {
+   GIVEN( "The decay equation with the explicit Euler limit 2 / lambda" ) {
+      double const lambda = 1.0;
+      WHEN( "A super step of many explicit timesteps is taken" ) {
+         double const timestep = 50.0;
+         unsigned int const s = RungeKuttaLegendre2::NumberOfStages( timestep, 2.0 / lambda );
+         double const result = SuperStep( 1.0, lambda, timestep, s );
+         THEN( "The state stays bounded" ) {
+            REQUIRE( std::abs( result ) <= 1.0 );
+         }
+      }
+      WHEN( "Small super steps are taken" ) {
+         double const coarse_error = std::abs( SuperStep( 1.0, lambda, 0.02, 3 ) - std::exp( -0.02 ) );
+         double const fine_error   = std::abs( SuperStep( 1.0, lambda, 0.01, 3 ) - std::exp( -0.01 ) );
+         THEN( "The local error is of third order" ) {
+            REQUIRE( coarse_error / fine_error == Approx( 8.0 ).epsilon( 0.1 ) );
+         }
+      }
+   }
+}
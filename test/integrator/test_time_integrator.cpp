@@ -0,0 +1,134 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "integrator/runge_kutta_3_TVD.h"
+
+namespace {
+   /**
+    * @brief Fills the average buffer of all cells of the node's single phase with distinct values and the right-hand side buffer with ones.
+    * @param node The node whose buffers are filled.
+    */
+   void FillBuffers( Node& node ) {
+      Block& block = node.GetSinglePhase();
+      for( Equation const eq : MF::ASOE() ) {
+         for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+            for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+               for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                  block.GetAverageBuffer( eq )[i][j][k]       = double( ETI( eq ) + i + 2 * j + 3 * k );
+                  block.GetRightHandSideBuffer( eq )[i][j][k] = 1.0;
+               }
+            }
+         }
+      }
+   }
+}// namespace
+
+SCENARIO( "The tiled integration of a node equals the integration of the whole node", "[1rank]" ) {
+   GIVEN( "Two nodes with the same buffers and a time integrator with one micro timestep" ) {
+      auto whole = std::make_unique<Node>( IdSeed(), 1.0, std::vector<MaterialName>( { MaterialName::MaterialOne } ) );
+      auto tiled = std::make_unique<Node>( IdSeed(), 1.0, std::vector<MaterialName>( { MaterialName::MaterialOne } ) );
+      FillBuffers( *whole );
+      FillBuffers( *tiled );
+      RungeKutta3TVD integrator( 0.0 );
+      integrator.AppendMicroTimestep( 0.5 );
+      WHEN( "One node is integrated at once and the other one in tiles" ) {
+         integrator.IntegrateNode( *whole, 0, 1 );
+         std::vector<unsigned int> visits_of_plane( CC::TCX(), 0 );
+         integrator.IntegrateNodeTiled( *tiled, 0, 1, [&visits_of_plane]( MaterialName const, Block&, unsigned int const first_plane, unsigned int const end_plane ) {
+            for( unsigned int i = first_plane; i < end_plane; ++i ) {
+               visits_of_plane[i]++;
+            }
+         } );
+         THEN( "Each internal plane is handed to the tile function once" ) {
+            for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+               REQUIRE( visits_of_plane[i] == ( i >= CC::FICX() && i <= CC::LICX() ? 1 : 0 ) );
+            }
+         }
+         THEN( "Both nodes hold the same integrated conservatives" ) {
+            Block const& whole_block = whole->GetSinglePhase();
+            Block const& tiled_block = tiled->GetSinglePhase();
+            for( Equation const eq : MF::ASOE() ) {
+               for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+                  for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                     for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                        REQUIRE( tiled_block.GetRightHandSideBuffer( eq )[i][j][k] == whole_block.GetRightHandSideBuffer( eq )[i][j][k] );
+                     }
+                  }
+               }
+            }
+            REQUIRE( tiled_block.GetRightHandSideBuffer( Equation::Mass )[CC::FICX()][CC::FICY()][CC::FICZ()] ==
+                     Approx( whole_block.GetAverageBuffer( Equation::Mass )[CC::FICX()][CC::FICY()][CC::FICZ()] + 0.5 ) );
+         }
+      }
+   }
+}
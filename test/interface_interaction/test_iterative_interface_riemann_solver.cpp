@@ -0,0 +1,152 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include "interface_interaction/interface_riemann_solver/exact_iterative_interface_riemann_solver.h"
+
+#include "materials/equations_of_state/stiffened_gas.h"
+#include "materials/material_type_definitions.h"
+
+#include <cmath>
+#include <limits>
+
+namespace {
+   /**
+    * @brief Creates a fluid material with a stiffened-gas equation of state.
+    */
+   std::tuple<MaterialType, Material> CreateFluid( double const gamma, double const background_pressure, UnitHandler const& unit_handler ) {
+      std::unordered_map<std::string, double> const eos_data = { { "gamma", gamma }, { "backgroundPressure", background_pressure } };
+      std::unique_ptr<EquationOfState const> equation_of_state( std::make_unique<StiffenedGas const>( eos_data, unit_handler ) );
+      return std::make_tuple( MaterialType::Fluid, Material( std::move( equation_of_state ), 0.0, 0.0, 0.0, 0.0, nullptr, nullptr, unit_handler ) );
+   }
+}
+
+SCENARIO( "Batched and cell-wise exact interface Riemann solutions agree", "[1rank]" ) {
+   UnitHandler const unit_handler( 1.0, 1.0, 1.0, 1.0 );
+   std::vector<std::tuple<MaterialType, Material>> materials;
+   materials.emplace_back( CreateFluid( 1.4, 0.0, unit_handler ) );
+   materials.emplace_back( CreateFluid( 4.4, 600.0, unit_handler ) );
+   std::vector<MaterialPairing> material_pairings;
+   material_pairings.emplace_back( MaterialPairing() );
+   auto const material_manager = MaterialManager( std::move( materials ), std::move( material_pairings ) );
+   MaterialName const material_left  = material_manager.GetMaterialNames().front();
+   MaterialName const material_right = material_manager.GetMaterialNames().back();
+
+   ExactIterativeInterfaceRiemannSolver const solver( material_manager );
+
+   GIVEN( "A batch with shocks and rarefactions on both sides" ) {
+      std::array<std::array<double, 7>, 4> const problems = { { { 1.0, 1.0, 0.0, 1000.0, 1.0, 0.0, 0.0 },
+                                                                { 1.0, 10.0, 1.0, 1000.0, 1.0, -1.0, 0.0 },
+                                                                { 0.5, 1.0, -0.5, 1000.0, 2.0, 0.5, 0.1 },
+                                                                { 2.0, 0.1, 0.0, 1000.0, 100.0, 0.0, 0.0 } } };
+      InterfaceRiemannProblemBatch batch;
+      batch.Resize( problems.size() );
+      for( std::size_t n = 0; n < problems.size(); ++n ) {
+         batch.rho_left_[n]              = problems[n][0];
+         batch.p_left_[n]                = problems[n][1];
+         batch.velocity_normal_left_[n]  = problems[n][2];
+         batch.rho_right_[n]             = problems[n][3];
+         batch.p_right_[n]               = problems[n][4];
+         batch.velocity_normal_right_[n] = problems[n][5];
+         batch.delta_p_[n]               = problems[n][6];
+      }
+
+      WHEN( "No admissible pressure guess is given" ) {
+         std::fill( batch.pressure_guess_.begin(), batch.pressure_guess_.end(), std::numeric_limits<double>::quiet_NaN() );
+         solver.SolveInterfaceRiemannProblems( batch, material_left, material_right );
+         THEN( "The solution is identical to the cell-wise solution" ) {
+            for( std::size_t n = 0; n < problems.size(); ++n ) {
+               std::array<double, 3> const expected = solver.SolveInterfaceRiemannProblem( problems[n][0], problems[n][1], problems[n][2], material_left,
+                                                                                          problems[n][3], problems[n][4], problems[n][5], material_right, problems[n][6] );
+               REQUIRE( batch.interface_velocity_[n] == expected[0] );
+               REQUIRE( batch.interface_pressure_positive_[n] == expected[1] );
+               REQUIRE( batch.interface_pressure_negative_[n] == expected[2] );
+            }
+         }
+      }
+
+      WHEN( "The iterations are warm-started from nearby pressures" ) {
+         for( std::size_t n = 0; n < problems.size(); ++n ) {
+            std::array<double, 3> const expected = solver.SolveInterfaceRiemannProblem( problems[n][0], problems[n][1], problems[n][2], material_left,
+                                                                                       problems[n][3], problems[n][4], problems[n][5], material_right, problems[n][6] );
+            batch.pressure_guess_[n] = 1.1 * expected[1];
+         }
+         solver.SolveInterfaceRiemannProblems( batch, material_left, material_right );
+         THEN( "The solution agrees with the cell-wise solution" ) {
+            for( std::size_t n = 0; n < problems.size(); ++n ) {
+               std::array<double, 3> const expected = solver.SolveInterfaceRiemannProblem( problems[n][0], problems[n][1], problems[n][2], material_left,
+                                                                                          problems[n][3], problems[n][4], problems[n][5], material_right, problems[n][6] );
+               REQUIRE( batch.interface_velocity_[n] == Approx( expected[0] ).epsilon( 1.0e-5 ).margin( 1.0e-10 ) );
+               REQUIRE( batch.interface_pressure_positive_[n] == Approx( expected[1] ).epsilon( 1.0e-5 ) );
+               REQUIRE( batch.interface_pressure_negative_[n] == Approx( expected[2] ).epsilon( 1.0e-5 ) );
+            }
+         }
+      }
+   }
+}
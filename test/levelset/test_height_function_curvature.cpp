@@ -0,0 +1,139 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include "levelset/geometry/height_function_curvature.h"
+#include <cmath>
+
+namespace {
+   double volume_fraction[CC::TCX()][CC::TCY()][CC::TCZ()];
+
+   /**
+    * @brief Fills the volume fraction of the material outside of a circle ( 2D ) or sphere ( 3D ) by subsampling each cell.
+    */
+   void FillVolumeFraction( std::array<double, 3> const& center, double const radius ) {
+      constexpr unsigned int samples = 16;
+      constexpr unsigned int samples_y = CC::DIM() != Dimension::One ? samples : 1;
+      constexpr unsigned int samples_z = CC::DIM() == Dimension::Three ? samples : 1;
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               unsigned int outside = 0;
+               for( unsigned int a = 0; a < samples; ++a ) {
+                  for( unsigned int b = 0; b < samples_y; ++b ) {
+                     for( unsigned int c = 0; c < samples_z; ++c ) {
+                        double const x = double( i ) + ( double( a ) + 0.5 ) / samples - center[0];
+                        double const y = double( j ) + ( double( b ) + 0.5 ) / samples_y - center[1];
+                        double const z = double( k ) + ( double( c ) + 0.5 ) / samples_z - center[2];
+                        double const distance = std::sqrt( x * x + ( CC::DIM() != Dimension::One ? y * y : 0.0 ) + ( CC::DIM() == Dimension::Three ? z * z : 0.0 ) );
+                        outside += distance > radius ? 1 : 0;
+                     }
+                  }
+               }
+               volume_fraction[i][j][k] = double( outside ) / double( samples * samples_y * samples_z );
+            }
+         }
+      }
+   }
+}// namespace
+
+SCENARIO( "Height-function curvature", "[1rank]" ) {
+   GIVEN( "The volume fraction of the material outside of a circle or sphere" ) {
+      double const radius                = 6.0;
+      std::array<double, 3> const center = { 0.5 * CC::TCX() + 0.3, 0.5 * CC::TCY() + 0.2, CC::DIM() == Dimension::Three ? 0.5 * CC::TCZ() + 0.1 : 0.5 };
+      FillVolumeFraction( center, radius );
+      WHEN( "The curvature is computed in the cut cell on top of the circle" ) {
+         unsigned int const i                = static_cast<unsigned int>( center[0] );
+         unsigned int const j                = static_cast<unsigned int>( center[1] + radius );
+         unsigned int const k                = static_cast<unsigned int>( center[2] );
+         std::array<double, 3> const normal  = { 0.0, 1.0, 0.0 };
+         double curvature                    = 0.0;
+         bool const is_defined               = ComputeHeightFunctionCurvature( volume_fraction, normal, i, j, k, curvature );
+         THEN( "It matches the exact curvature, which is positive for a normal pointing outwards" ) {
+            if constexpr( CC::DIM() == Dimension::One ) {
+               REQUIRE_FALSE( is_defined );
+            } else {
+               double const exact_curvature = ( CC::DIM() == Dimension::Three ? 2.0 : 1.0 ) / radius;
+               REQUIRE( is_defined );
+               REQUIRE( curvature == Approx( exact_curvature ).epsilon( 0.02 ) );
+            }
+         }
+      }
+      WHEN( "The curvature is computed in a cell whose columns do not cross the interface" ) {
+         unsigned int const i               = static_cast<unsigned int>( center[0] );
+         unsigned int const j               = static_cast<unsigned int>( center[1] );
+         unsigned int const k               = static_cast<unsigned int>( center[2] );
+         std::array<double, 3> const normal = { 0.0, 1.0, 0.0 };
+         double curvature                   = 0.0;
+         THEN( "The heights are not defined" ) {
+            REQUIRE_FALSE( ComputeHeightFunctionCurvature( volume_fraction, normal, i, j, k, curvature ) );
+         }
+      }
+   }
+}
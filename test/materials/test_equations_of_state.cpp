@@ -67,6 +67,7 @@
 *                                                                                        *
 *****************************************************************************************/
 #include <catch2/catch.hpp>
+#include <array>
 #include <limits>
 
 #include <limits>
@@ -77,6 +78,8 @@
 #include "materials/equations_of_state/stiffened_gas_complete_safe.h"
 #include "materials/equations_of_state/waterlike_fluid.h"
 #include "materials/equations_of_state/noble_abel_stiffened_gas.h"
+#include "materials/equations_of_state/tabulated_equation_of_state.h"
+#include "materials/equation_of_state_dispatch.h"
 
 namespace TestEos {
    /**
@@ -135,6 +138,14 @@ namespace TestEos {
       REQUIRE( equation_of_state->Energy( density, velocity_x, velocity_y, velocity_z, pressure ) == Approx( expected_energy ).epsilon( comparison_epsilon ) );
       REQUIRE( equation_of_state->SpeedOfSound( density, pressure ) == Approx( expected_speed_of_sound ).epsilon( comparison_epsilon ) );
       REQUIRE( equation_of_state->Psi( pressure, 1.0 / density ) == Approx( expected_psi ).epsilon( comparison_epsilon ) );
+      // The batched speed of sound gives the scalar result for every state
+      std::array<double, 3> const densities = { density, 2.0 * density, 0.5 * density };
+      std::array<double, 3> const pressures = { pressure, pressure, 3.0 * pressure };
+      std::array<double, 3> speeds_of_sound;
+      equation_of_state->SpeedOfSound( densities.data(), pressures.data(), speeds_of_sound.data(), 3 );
+      for( unsigned int s = 0; s < 3; ++s ) {
+         REQUIRE( speeds_of_sound[s] == equation_of_state->SpeedOfSound( densities[s], pressures[s] ) );
+      }
    }
 
    /**
@@ -317,3 +328,66 @@ SCENARIO( "Equations of state getters and computation", "[1rank]" ) {
       }
    }
 }
+
+SCENARIO( "Static dispatch on the concrete equation of state", "[1rank]" ) {
+   UnitHandler const unit_handler( 1.0, 1.0, 1.0, 1.0 );
+
+   GIVEN( "A stiffened gas and an isentropic equation of state behind the abstract interface" ) {
+      std::unordered_map<std::string, double> const stiffened_gas_data = { { "gamma", 1.6 }, { "backgroundPressure", 2.0 } };
+      std::unordered_map<std::string, double> const isentropic_data    = { { "gamma", 3.2 }, { "A", 0.74586 } };
+      std::unique_ptr<EquationOfState const> stiffened_gas( std::make_unique<StiffenedGas const>( stiffened_gas_data, unit_handler ) );
+      std::unique_ptr<EquationOfState const> isentropic( std::make_unique<Isentropic const>( isentropic_data, unit_handler ) );
+
+      WHEN( "We ask for their names" ) {
+         THEN( "The names identify the concrete equations of state" ) {
+            REQUIRE( stiffened_gas->Name() == EquationOfStateName::StiffenedGas );
+            REQUIRE( isentropic->Name() == EquationOfStateName::Isentropic );
+         }
+      }
+
+      WHEN( "We visit them and compute the pressure through the resolved type" ) {
+         auto const pressure = []( EquationOfState const& eos ) {
+            return VisitEquationOfState( eos, []( auto const& concrete_eos ) { return concrete_eos.Pressure( 1.5, 1.0, 0.5, 0.25, 4.0 ); } );
+         };
+         THEN( "The results equal the virtual computation" ) {
+            REQUIRE( pressure( *stiffened_gas ) == stiffened_gas->Pressure( 1.5, 1.0, 0.5, 0.25, 4.0 ) );
+            REQUIRE( pressure( *isentropic ) == isentropic->Pressure( 1.5, 1.0, 0.5, 0.25, 4.0 ) );
+         }
+      }
+   }
+}
+
+SCENARIO( "Tabulated equation of state", "[1rank]" ) {
+   UnitHandler const unit_handler( 1.0, 1.0, 1.0, 1.0 );
+
+   GIVEN( "A stiffened gas tabulated over a range of densities, specific energies and pressures" ) {
+      std::unordered_map<std::string, double> const eos_data = { { "gamma", 1.6 }, { "backgroundPressure", 2.0 }, { "tableDensityMinimum", 0.5 }, { "tableDensityMaximum", 5.0 }, { "tableDensityPoints", 46 }, { "tableEnergyMinimum", 0.0 }, { "tableEnergyMaximum", 40.0 }, { "tableEnergyPoints", 81 }, { "tablePressureMinimum", 0.0 }, { "tablePressureMaximum", 20.0 }, { "tablePressurePoints", 201 } };
+      std::unique_ptr<EquationOfState const> stiffened_gas( std::make_unique<StiffenedGas const>( eos_data, unit_handler ) );
+      REQUIRE( TabulatedEquationOfState::IsRequested( eos_data ) );
+      std::unique_ptr<EquationOfState const> tabulated( std::make_unique<TabulatedEquationOfState const>( std::make_unique<StiffenedGas const>( eos_data, unit_handler ), eos_data, unit_handler ) );
+
+      WHEN( "We evaluate states within the table range" ) {
+         THEN( "The pressure, which is bilinear in density and specific energy, is reproduced up to round-off" ) {
+            REQUIRE( tabulated->Pressure( 1.5, 1.0, 0.5, 0.25, 4.0 ) == Approx( stiffened_gas->Pressure( 1.5, 1.0, 0.5, 0.25, 4.0 ) ).epsilon( 1.0e-12 ) );
+            REQUIRE( tabulated->Pressure( 5.0, 0.0, 0.0, 0.0, 200.0 ) == Approx( stiffened_gas->Pressure( 5.0, 0.0, 0.0, 0.0, 200.0 ) ).epsilon( 1.0e-12 ) );
+         }
+         THEN( "The speed of sound matches the analytic one up to the interpolation error" ) {
+            REQUIRE( tabulated->SpeedOfSound( 2.4, 3.75 ) == Approx( stiffened_gas->SpeedOfSound( 2.4, 3.75 ) ).epsilon( 1.0e-3 ) );
+         }
+         THEN( "The statically bound pressure equals the virtual one" ) {
+            double const pressure = VisitEquationOfState( *tabulated, []( auto const& eos ) { return eos.Pressure( 1.5, 1.0, 0.5, 0.25, 4.0 ); } );
+            REQUIRE( pressure == tabulated->Pressure( 1.5, 1.0, 0.5, 0.25, 4.0 ) );
+            REQUIRE( tabulated->Name() == EquationOfStateName::Tabulated );
+         }
+      }
+
+      WHEN( "We evaluate states outside of the table range or quantities that are not tabulated" ) {
+         THEN( "The analytic equation of state is used" ) {
+            REQUIRE( tabulated->Pressure( 10.0, 1.0, 0.5, 0.25, 4.0 ) == stiffened_gas->Pressure( 10.0, 1.0, 0.5, 0.25, 4.0 ) );
+            REQUIRE( tabulated->SpeedOfSound( 2.4, 30.0 ) == stiffened_gas->SpeedOfSound( 2.4, 30.0 ) );
+            REQUIRE( tabulated->Energy( 2.4, 0.75, 1.9, 4.003, 3.75 ) == stiffened_gas->Energy( 2.4, 0.75, 1.9, 4.003, 3.75 ) );
+            TestEos::GetterFunctions( tabulated, 1.6, 2.0, 0.6 );
+         }
+      }
+   }
+}
@@ -0,0 +1,215 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <limits>
+#include <memory>
+
+#include "multiresolution/multiresolution.h"
+
+namespace {
+   /**
+    * @brief Fills the initial and the right-hand-side buffers of the equations entering the wavelet analysis.
+    * @param block The block whose buffers are filled.
+    * @param initial_value The value of the initial buffers.
+    * @param right_hand_side_value The value of the right-hand-side buffers.
+    */
+   void FillWaveletEquations( Block& block, double const initial_value, double const right_hand_side_value ) {
+      block.AllocateIntegrationBuffers();
+      for( Equation const eq : MF::EWA() ) {
+         auto& initial         = block.GetInitialBuffer( eq );
+         auto& right_hand_side = block.GetRightHandSideBuffer( eq );
+         for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+            for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+               for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                  initial[i][j][k]         = initial_value;
+                  right_hand_side[i][j][k] = right_hand_side_value;
+               }
+            }
+         }
+      }
+   }
+
+   /**
+    * @brief Fills the right-hand-side buffers with a jump in x-direction in the middle of the block. Mass and energy jump from the left to the
+    *        right value, the x-momentum from the left to the right momentum. All other momenta vanish.
+    * @param block The block whose buffers are filled.
+    * @param left The mass and energy left of the jump.
+    * @param right The mass and energy right of the jump.
+    * @param left_momentum The x-momentum left of the jump.
+    * @param right_momentum The x-momentum right of the jump.
+    */
+   void FillJump( Block& block, double const left, double const right, double const left_momentum, double const right_momentum ) {
+      for( Equation const eq : MF::ASOE() ) {
+         auto& right_hand_side = block.GetRightHandSideBuffer( eq );
+         for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+            bool const is_left = i < CC::TCX() / 2;
+            double value       = is_left ? left : right;
+            if( eq == Equation::MomentumX ) {
+               value = is_left ? left_momentum : right_momentum;
+            } else if( eq != Equation::Mass && eq != Equation::Energy ) {
+               value = 0.0;
+            }
+            for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+               for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                  right_hand_side[i][j][k] = value;
+               }
+            }
+         }
+      }
+   }
+}// namespace
+
+SCENARIO( "Local refinement indicators are computed from the data of the leaf only", "[1rank]" ) {
+   GIVEN( "A block with a uniform state" ) {
+      auto block = std::make_unique<Block>();
+      FillJump( *block, 1.0, 1.0, 0.5, 0.5 );
+      WHEN( "The indicators are computed" ) {
+         THEN( "All vanish and the leaf may be coarsened" ) {
+            REQUIRE( Multiresolution::LocalIndicator<RefinementIndicator::Gradient>( *block ) == 0.0 );
+            REQUIRE( Multiresolution::LocalIndicator<RefinementIndicator::Curvature>( *block ) == 0.0 );
+            REQUIRE( Multiresolution::LocalIndicator<RefinementIndicator::ShockSensor>( *block ) == 0.0 );
+            REQUIRE( Multiresolution::LeafNeedsRemeshing<RefinementIndicator::Curvature>( *block ) == RemeshIdentifier::Coarse );
+         }
+      }
+   }
+   GIVEN( "A block with a compressive jump of the density" ) {
+      auto block = std::make_unique<Block>();
+      FillJump( *block, 1.0, 2.0, 1.0, 0.0 );
+      WHEN( "The indicators are computed" ) {
+         THEN( "All demand refinement" ) {
+            REQUIRE( Multiresolution::LeafNeedsRemeshing<RefinementIndicator::Gradient>( *block ) == RemeshIdentifier::Refine );
+            REQUIRE( Multiresolution::LeafNeedsRemeshing<RefinementIndicator::Curvature>( *block ) == RemeshIdentifier::Refine );
+            REQUIRE( Multiresolution::LeafNeedsRemeshing<RefinementIndicator::ShockSensor>( *block ) == RemeshIdentifier::Refine );
+         }
+      }
+   }
+   GIVEN( "A block with a jump of the density at constant velocity ( contact )" ) {
+      auto block = std::make_unique<Block>();
+      FillJump( *block, 1.0, 2.0, 1.0, 2.0 );
+      WHEN( "The shock sensor is computed" ) {
+         THEN( "It vanishes as the flow is not compressed" ) {
+            REQUIRE( Multiresolution::LocalIndicator<RefinementIndicator::ShockSensor>( *block ) == 0.0 );
+         }
+      }
+   }
+}
+
+SCENARIO( "The relative change of a block during a time step is computed", "[1rank]" ) {
+   GIVEN( "A block with positive conservatives" ) {
+      auto block = std::make_unique<Block>();
+      FillWaveletEquations( *block, 2.0, 2.0 );
+      WHEN( "The conservatives did not change" ) {
+         THEN( "The relative change is zero" ) {
+            REQUIRE( Multiresolution::RelativeChangeOfStep( *block ) == 0.0 );
+         }
+      }
+      WHEN( "One halo cell changed" ) {
+         block->GetRightHandSideBuffer( MF::EWA()[0] )[0][0][0] = 2.5;
+         THEN( "The relative change is the one of this cell" ) {
+            REQUIRE( Multiresolution::RelativeChangeOfStep( *block ) == Approx( 0.2 ) );
+         }
+      }
+   }
+   GIVEN( "A block with vanishing conservatives" ) {
+      auto block = std::make_unique<Block>();
+      FillWaveletEquations( *block, 0.0, 0.0 );
+      WHEN( "The relative change is computed" ) {
+         THEN( "It is infinite" ) {
+            REQUIRE( Multiresolution::RelativeChangeOfStep( *block ) == std::numeric_limits<double>::infinity() );
+         }
+      }
+   }
+}
+
+SCENARIO( "Cached details are only reused if the remeshing decision cannot change", "[1rank]" ) {
+   GIVEN( "A multiresolution with thresholds 0.01 ( coarsening ) and 0.32 ( refinement ) on level three" ) {
+      constexpr unsigned int level = 3;
+      Multiresolution const multiresolution( Thresholder( level, level, 0.01 ), RefinementRegions( {}, 1.0, level ) );
+      WHEN( "The conservatives did not change since the analysis" ) {
+         THEN( "The decision is certain for any detail" ) {
+            REQUIRE( multiresolution.DecisionIsCertain( { 0.001, 0.0 }, level ) );
+            REQUIRE( multiresolution.DecisionIsCertain( { 0.0101, 0.0 }, level ) );
+            REQUIRE( multiresolution.DecisionIsCertain( { 1.0, 0.0 }, level ) );
+         }
+      }
+      WHEN( "The conservatives changed slightly since the analysis" ) {
+         THEN( "The decision is certain for details far from the thresholds only" ) {
+            REQUIRE( multiresolution.DecisionIsCertain( { 0.1, 1.0e-4 }, level ) );
+            REQUIRE_FALSE( multiresolution.DecisionIsCertain( { 0.0101, 1.0e-4 }, level ) );
+            REQUIRE_FALSE( multiresolution.DecisionIsCertain( { 0.3199, 1.0e-4 }, level ) );
+         }
+      }
+      WHEN( "The change of the conservatives is unknown" ) {
+         THEN( "The decision is never certain" ) {
+            REQUIRE_FALSE( multiresolution.DecisionIsCertain( { 0.1, std::numeric_limits<double>::infinity() }, level ) );
+         }
+      }
+   }
+}
@@ -0,0 +1,121 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <limits>
+#include <vector>
+
+#include "multiresolution/refinement_regions.h"
+
+namespace {
+   constexpr double unbounded = std::numeric_limits<double>::max();
+   constexpr double lowest    = std::numeric_limits<double>::lowest();
+}
+
+SCENARIO( "Refinement regions bound the levels of single-phase leaves", "[1rank]" ) {
+   GIVEN( "A domain of one unit node on level zero with the maximum level five" ) {
+      nid_t const root                                     = IdSeed();
+      std::array<nid_t, CC::NOC()> const children          = IdsOfChildren( root );
+      nid_t const low_x_child                              = children[0];
+      nid_t const high_x_child                             = children[1];
+      nid_t const low_x_great_grandchild                   = IdsOfChildren( IdsOfChildren( IdsOfChildren( low_x_child ).front() ).front() ).front();
+      std::array<double, 6> const low_x_box                = { lowest, 0.4, lowest, unbounded, lowest, unbounded };
+      std::array<double, 6> const whole_box                = { lowest, unbounded, lowest, unbounded, lowest, unbounded };
+      WHEN( "No region is given" ) {
+         RefinementRegions const regions( {}, 1.0, 5 );
+         THEN( "All nodes may be refined up to the maximum level and the decisions are kept" ) {
+            REQUIRE_FALSE( regions.Any() );
+            REQUIRE( regions.LevelBoundsOfNode( low_x_child ) == std::array<unsigned int, 2>( { 0, 5 } ) );
+            REQUIRE( regions.BoundRemeshingDecision( RemeshIdentifier::Coarse, low_x_child ) == RemeshIdentifier::Coarse );
+            REQUIRE( regions.BoundRemeshingDecision( RemeshIdentifier::Refine, low_x_great_grandchild ) == RemeshIdentifier::Refine );
+         }
+      }
+      WHEN( "A box region below x = 0.4 bounds the levels to two and three" ) {
+         RefinementRegions const regions( { { low_x_box, "", 2, 3 } }, 1.0, 5 );
+         THEN( "Only the nodes overlapping the box are bounded" ) {
+            REQUIRE( regions.LevelBoundsOfNode( low_x_child ) == std::array<unsigned int, 2>( { 2, 3 } ) );
+            REQUIRE( regions.LevelBoundsOfNode( high_x_child ) == std::array<unsigned int, 2>( { 0, 5 } ) );
+         }
+         THEN( "Leaves below the minimum level are refined and leaves above the maximum level are coarsened" ) {
+            REQUIRE( regions.BoundRemeshingDecision( RemeshIdentifier::Coarse, low_x_child ) == RemeshIdentifier::Refine );
+            REQUIRE( regions.BoundRemeshingDecision( RemeshIdentifier::Refine, low_x_great_grandchild ) == RemeshIdentifier::Coarse );
+            REQUIRE( regions.BoundRemeshingDecision( RemeshIdentifier::Coarse, high_x_child ) == RemeshIdentifier::Coarse );
+         }
+      }
+      WHEN( "The box region is nested in a region covering the whole domain up to level one" ) {
+         RefinementRegions const regions( { { whole_box, "", 0, 1 }, { low_x_box, "", 2, 3 } }, 1.0, 5 );
+         THEN( "The nested region refines further, all other nodes are capped at level one" ) {
+            REQUIRE( regions.LevelBoundsOfNode( low_x_child ) == std::array<unsigned int, 2>( { 2, 3 } ) );
+            REQUIRE( regions.LevelBoundsOfNode( high_x_child ) == std::array<unsigned int, 2>( { 0, 1 } ) );
+            REQUIRE( regions.BoundRemeshingDecision( RemeshIdentifier::Refine, high_x_child ) == RemeshIdentifier::Neutral );
+            REQUIRE( regions.BoundRemeshingDecision( RemeshIdentifier::Neutral, high_x_child ) == RemeshIdentifier::Neutral );
+         }
+      }
+   }
+}
@@ -140,4 +140,53 @@ SCENARIO( "Conservative quantities and prime state values can be converted into
          }
       }
    }
+   GIVEN( "Conservative buffers filled with an arbitrary state" ) {
+      MaterialName const material_name = material_manager.GetMaterialNames().front();
+      auto const conservatives         = std::make_unique<Conservatives>();
+      for( unsigned int e = 0; e < MF::ANOE(); ++e ) {
+         for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+            for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+               for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                  conservatives->Fields[e][i][j][k] = 0.1 * double( e ) + 0.01 * double( i + j + k ) + 1.0;
+               }
+            }
+         }
+      }
+
+      WHEN( "A sub-range of the buffers is converted to prime states" ) {
+         auto const prime_states                 = std::make_unique<PrimeStates>();
+         std::array<unsigned int, 3> const start = { CC::FICX(), CC::FICY(), CC::FICZ() };
+         std::array<unsigned int, 3> const end   = { CC::LICX() + 1, CC::LICY() + 1, CC::LICZ() + 1 };
+         for( unsigned int p = 0; p < MF::ANOP(); ++p ) {
+            for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+               for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                  for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                     prime_states->Fields[p][i][j][k] = -7.0;
+                  }
+               }
+            }
+         }
+         prime_state_handler.ConvertConservativesToPrimeStates( material_name, *conservatives, *prime_states, start, end );
+
+         THEN( "Cells inside the range match the cell-wise conversion and cells outside are untouched" ) {
+            for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+               for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                  for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                     bool const inside = i >= start[0] && i < end[0] && j >= start[1] && j < end[1] && k >= start[2] && k < end[2];
+                     std::array<double, MF::ANOE()> cell_conservatives;
+                     for( unsigned int e = 0; e < MF::ANOE(); ++e ) {
+                        cell_conservatives[e] = conservatives->Fields[e][i][j][k];
+                     }
+                     std::array<double, MF::ANOP()> cell_prime_states;
+                     cell_prime_states.fill( -7.0 );
+                     prime_state_handler.ConvertConservativesToPrimeStates( material_name, cell_conservatives, cell_prime_states );
+                     for( unsigned int p = 0; p < MF::ANOP(); ++p ) {
+                        REQUIRE( prime_states->Fields[p][i][j][k] == ( inside ? Approx( cell_prime_states[p] ) : Approx( -7.0 ) ) );
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
 }
@@ -0,0 +1,132 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+#include "solvers/eigendecomposition.h"
+
+namespace {
+   /**
+    * @brief Checks the closed-form projections of a face against the products with the eigenvector matrices.
+    */
+   template<Direction DIR>
+   void RequireProjectionsMatchEigenvectors( RoeFaceAverages const& averages, std::array<double, MF::ANOE()> const& values ) {
+      double left_eigenvectors[MF::ANOE()][MF::ANOE()];
+      double right_eigenvectors[MF::ANOE()][MF::ANOE()];
+      RoeEigenvectorsFromAverages<DIR>( averages, left_eigenvectors, right_eigenvectors );
+      std::array<double, MF::ANOE()> const characteristic_values = ProjectToCharacteristicSpace<DIR>( values, averages );
+      std::array<double, MF::ANOE()> const physical_values       = ProjectToPhysicalSpace<DIR>( values, averages );
+      std::array<double, MF::ANOE()> const reference_physical_values = TransformToPhysicalSpace( values, right_eigenvectors );
+      for( unsigned int n = 0; n < MF::ANOE(); ++n ) {
+         double reference_characteristic_value = 0.0;
+         for( unsigned int l = 0; l < MF::ANOE(); ++l ) {
+            reference_characteristic_value += left_eigenvectors[n][l] * values[l];
+         }
+         REQUIRE( characteristic_values[n] == Approx( reference_characteristic_value ).epsilon( 1e-12 ) );
+         REQUIRE( physical_values[n] == Approx( reference_physical_values[n] ).epsilon( 1e-12 ) );
+      }
+   }
+}// namespace
+
+SCENARIO( "The closed-form Roe projections match the eigenvector matrices", "[1rank]" ) {
+   GIVEN( "Roe averages of a face and a state with distinct entries" ) {
+      RoeFaceAverages averages;
+      averages.principal_velocity_ = 1.3;
+      averages.minor1_velocity_    = CC::DIM() != Dimension::One ? -0.7 : 0.0;
+      averages.minor2_velocity_    = CC::DIM() == Dimension::Three ? 0.4 : 0.0;
+      averages.q_squared_          = 1.3 * 1.3 + averages.minor1_velocity_ * averages.minor1_velocity_ + averages.minor2_velocity_ * averages.minor2_velocity_;
+      averages.enthalpy_           = 9.5;
+      averages.gruneisen_          = 0.4;
+      averages.speed_of_sound_     = 2.1;
+      averages.one_cc_             = 1.0 / ( 2.1 * 2.1 );
+      averages.density_            = 1.6;
+      averages.one_density_        = 1.0 / 1.6;
+      std::array<double, MF::ANOE()> values;
+      for( unsigned int l = 0; l < MF::ANOE(); ++l ) {
+         values[l] = 0.5 + 0.75 * l;
+      }
+      WHEN( "The state is projected onto faces of all directions" ) {
+         THEN( "The results equal the products with the eigenvector matrices" ) {
+            RequireProjectionsMatchEigenvectors<Direction::X>( averages, values );
+            if constexpr( CC::DIM() != Dimension::One ) {
+               RequireProjectionsMatchEigenvectors<Direction::Y>( averages, values );
+            }
+            if constexpr( CC::DIM() == Dimension::Three ) {
+               RequireProjectionsMatchEigenvectors<Direction::Z>( averages, values );
+            }
+         }
+      }
+      WHEN( "The averages of an invalid face are used" ) {
+         std::array<double, MF::ANOE()> const characteristic_values = ProjectToCharacteristicSpace<Direction::X>( values, RoeFaceAverages() );
+         THEN( "The state is projected onto zero" ) {
+            for( unsigned int n = 0; n < MF::ANOE(); ++n ) {
+               REQUIRE( characteristic_values[n] == 0.0 );
+            }
+         }
+      }
+   }
+}
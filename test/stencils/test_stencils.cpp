@@ -69,6 +69,7 @@
 #include <catch2/catch.hpp>
 
 #include <vector>
+#include <cmath>
 #include <algorithm>
 
 #include "stencils/stencil_utilities.h"
@@ -134,6 +135,50 @@ void TestZeronessOnUnitArrayWithMargin( double const allowed_margin ) {
    }
 }
 
+template<typename S>
+void TestBatchedEvaluationEqualsScalarEvaluation() {
+   WHEN( "The stencil is applied to a batch of arrays and along a pencil" ) {
+      constexpr std::size_t lanes = 5;
+      constexpr unsigned int pencil_size = 16;
+      std::array<std::array<double, lanes>, S::StencilSize()> batch;
+      for( unsigned int s = 0; s < S::StencilSize(); ++s ) {
+         for( std::size_t w = 0; w < lanes; ++w ) {
+            // Mix of smooth data, a step and a kink over the lanes
+            batch[s][w] = w == 0 ? 1.0 : w == 1 ? ( s < S::StencilSize() / 2 ? 0.0 : 1.0 ) : std::sin( 0.3 * s * w ) + 0.1 * ( s * s );
+         }
+      }
+      std::array<double, pencil_size> pencil;
+      for( unsigned int n = 0; n < pencil_size; ++n ) {
+         pencil[n] = n < pencil_size / 2 ? std::cos( 0.7 * n ) : 2.0 + 0.05 * n;
+      }
+      constexpr unsigned int number_of_evaluations = pencil_size - S::StencilSize() + 1;
+      constexpr double cell_size = 1.0;
+
+      std::array<double, lanes> batch_left;
+      std::array<double, lanes> batch_right;
+      SU::Reconstruction<S, StencilProperty::UpwindLeft>( batch, cell_size, batch_left );
+      SU::Reconstruction<S, StencilProperty::UpwindRight>( batch, cell_size, batch_right );
+      std::array<double, number_of_evaluations> pencil_left;
+      SU::ReconstructionOnPencil<S, StencilProperty::UpwindLeft>( pencil.data(), number_of_evaluations, cell_size, pencil_left.data() );
+
+      THEN( "Every lane equals the scalar evaluation bit by bit" ) {
+         for( std::size_t w = 0; w < lanes; ++w ) {
+            std::array<double, S::StencilSize()> array;
+            for( unsigned int s = 0; s < S::StencilSize(); ++s ) {
+               array[s] = batch[s][w];
+            }
+            REQUIRE( batch_left[w] == SU::Reconstruction<S, StencilProperty::UpwindLeft>( array, cell_size ) );
+            REQUIRE( batch_right[w] == SU::Reconstruction<S, StencilProperty::UpwindRight>( array, cell_size ) );
+         }
+         for( unsigned int n = 0; n < number_of_evaluations; ++n ) {
+            std::array<double, S::StencilSize()> array;
+            std::copy_n( pencil.begin() + n, S::StencilSize(), array.begin() );
+            REQUIRE( pencil_left[n] == SU::Reconstruction<S, StencilProperty::UpwindLeft>( array, cell_size ) );
+         }
+      }
+   }
+}
+
 SCENARIO( "Reconstruction stencil correctness", "[1rank]" ) {
    GIVEN( "A WENO-3 reconstruction stencil" ) {
       constexpr auto weno3 = WENO3();
@@ -242,6 +287,60 @@ SCENARIO( "Reconstruction stencil correctness", "[1rank]" ) {
    }
 }
 
+SCENARIO( "Batched reconstruction stencil evaluation", "[1rank]" ) {
+   GIVEN( "A WENO-5 reconstruction stencil" ) {
+      TestBatchedEvaluationEqualsScalarEvaluation<WENO5>();
+   }
+   GIVEN( "A TENO-5 reconstruction stencil" ) {
+      TestBatchedEvaluationEqualsScalarEvaluation<TENO5>();
+   }
+   GIVEN( "A WENO-CU6 reconstruction stencil" ) {
+      TestBatchedEvaluationEqualsScalarEvaluation<WENOCU6>();
+   }
+   GIVEN( "A WENO-9 reconstruction stencil" ) {
+      TestBatchedEvaluationEqualsScalarEvaluation<WENO9>();
+   }
+}
+
+SCENARIO( "Hybrid central reconstruction stencil", "[1rank]" ) {
+   GIVEN( "A central TENO-5 reconstruction stencil" ) {
+      constexpr auto central_teno5 = CentralTENO5();
+      TestStencilParameters( central_teno5, StencilType::Reconstruction, 6, 2 );
+      TestUnityOnUnitArrayWithMargin<CentralTENO5>( 1e-16 );
+      TestWenoValuesLeftAndRightOfStepWithMargin<CentralTENO5>( 1e-16 );
+      WHEN( "Smooth data and data with a step in one lane are reconstructed as batch" ) {
+         constexpr std::size_t lanes = 3;
+         std::array<std::array<double, lanes>, CentralTENO5::StencilSize()> smooth;
+         std::array<std::array<double, lanes>, CentralTENO5::StencilSize()> step;
+         for( unsigned int s = 0; s < CentralTENO5::StencilSize(); ++s ) {
+            for( std::size_t w = 0; w < lanes; ++w ) {
+               smooth[s][w] = 1.0 + 0.01 * w * s;
+               step[s][w]   = w == 1 ? ( s < CentralTENO5::StencilSize() / 2 ? 0.0 : 1.0 ) : smooth[s][w];
+            }
+         }
+         constexpr double cell_size = 1.0;
+         std::array<double, lanes> smooth_left;
+         std::array<double, lanes> step_left;
+         SU::Reconstruction<CentralTENO5, StencilProperty::UpwindLeft>( smooth, cell_size, smooth_left );
+         SU::Reconstruction<CentralTENO5, StencilProperty::UpwindLeft>( step, cell_size, step_left );
+         THEN( "Smooth batches use the central stencil, otherwise all lanes use TENO-5" ) {
+            for( std::size_t w = 0; w < lanes; ++w ) {
+               std::array<double, CentralTENO5::StencilSize()> smooth_array;
+               std::array<double, CentralTENO5::StencilSize()> step_array;
+               std::array<double, FourthOrderCentral::StencilSize()> central_array;
+               for( unsigned int s = 0; s < CentralTENO5::StencilSize(); ++s ) {
+                  smooth_array[s] = smooth[s][w];
+                  step_array[s]   = step[s][w];
+               }
+               std::copy_n( smooth_array.begin() + 1, FourthOrderCentral::StencilSize(), central_array.begin() );
+               REQUIRE( smooth_left[w] == Approx( SU::Reconstruction<FourthOrderCentral, StencilProperty::UpwindLeft>( central_array, cell_size ) ).margin( 1e-15 ) );
+               REQUIRE( step_left[w] == SU::Reconstruction<TENO5, StencilProperty::UpwindLeft>( step_array, cell_size ) );
+            }
+         }
+      }
+   }
+}
+
 SCENARIO( "Derivative stencil correctness", "[1rank]" ) {
    GIVEN( "A HOUC-5 derivative stencil" ) {
       constexpr auto houc5 = HOUC5();
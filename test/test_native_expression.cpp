@@ -0,0 +1,188 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "native_expression.h"
+
+SCENARIO( "Translation of user expressions into native code", "[1rank]" ) {
+
+   std::vector<std::string> const variables_out = { "density", "", "pressure" };
+   std::vector<std::string> const variables_in  = { "x", "y", "z" };
+
+   GIVEN( "Expressions of the subset that reproduces the interpreter" ) {
+      std::vector<std::string> const expressions = {
+         "density := 2 * x + 5; pressure := x * y;",
+         "if (x < 0.5)\n{\ndensity : = 1.0;\npressure := 1.0;\n}\nelse\n{\ndensity := 0.125;\npressure := 0.1;\n}",
+         "if (x > 1) density := 1; else if (X > 0) density := 2; else density := 3;",
+         "var t := (-x)^2 + x^-1; density := sqrt(t) * sin(pi / 2) + max(1, y, z) + clamp(0, x, 1);",
+         "density := if(x > 1 and y < 5, 1 / 2, 7 % 4); pressure := x > 4 ? 1 : rand(); # comment",
+         "density += x; pressure := not (x = 3) or velocity;" };
+      WHEN( "They are translated" ) {
+         THEN( "A function is generated for each of them" ) {
+            for( std::string const& expression : expressions ) {
+               REQUIRE( NativeExpression::Translate( expression, variables_out, variables_in ).find( "alpaca_user_expression" ) != std::string::npos );
+            }
+         }
+      }
+   }
+
+   GIVEN( "Expressions whose semantics differ in C++ or that are not supported" ) {
+      std::vector<std::string> const expressions = {
+         "density := rand() + rand();",
+         "t := t + 1; density := t;",
+         "if (x > 1) { var t := 2; density := t; } pressure := t;",
+         "density := -x^2;",
+         "density := 2^3^2;",
+         "x := 1;",
+         "density := foo(x);",
+         "density := 2x;",
+         "for (var i := 0; i < 3; i += 1) { density += i; }" };
+      WHEN( "They are translated" ) {
+         THEN( "The translation is rejected for each of them" ) {
+            for( std::string const& expression : expressions ) {
+               REQUIRE_THROWS_AS( NativeExpression::Translate( expression, variables_out, variables_in ), std::invalid_argument );
+            }
+         }
+      }
+   }
+
+   GIVEN( "An output that is also an input" ) {
+      WHEN( "An expression is translated" ) {
+         THEN( "The translation is rejected" ) {
+            REQUIRE_THROWS_AS( NativeExpression::Translate( "x := 1;", { "x" }, { "x" } ), std::invalid_argument );
+         }
+      }
+   }
+}
+
+SCENARIO( "Natively compiled expressions are only cached in private locations", "[1rank]" ) {
+
+   std::filesystem::path const base = std::filesystem::temp_directory_path() / "alpaca_test_native_expression";
+   std::filesystem::remove_all( base );
+   std::filesystem::create_directories( base );
+
+   GIVEN( "A cache home of the current user" ) {
+      char const* const previous_cache_home = std::getenv( "XDG_CACHE_HOME" );
+      std::string const restored_cache_home = previous_cache_home != nullptr ? previous_cache_home : "";
+      ::setenv( "XDG_CACHE_HOME", base.c_str(), 1 );
+      WHEN( "The cache directory is requested" ) {
+         std::filesystem::path const directory = NativeExpression::CacheDirectory();
+         THEN( "It is created inside the cache home with access for the owner only" ) {
+            REQUIRE( directory == base / "alpaca" / "native_expressions" );
+            REQUIRE( std::filesystem::is_directory( directory ) );
+            REQUIRE( std::filesystem::status( directory ).permissions() == std::filesystem::perms::owner_all );
+            REQUIRE( NativeExpression::IsPrivate( directory ) );
+         }
+      }
+      if( previous_cache_home != nullptr ) {
+         ::setenv( "XDG_CACHE_HOME", restored_cache_home.c_str(), 1 );
+      } else {
+         ::unsetenv( "XDG_CACHE_HOME" );
+      }
+   }
+
+   GIVEN( "A file of the current user" ) {
+      std::filesystem::path const file = base / "expression.so";
+      std::ofstream( file ) << "content";
+      std::filesystem::permissions( file, std::filesystem::perms::owner_read | std::filesystem::perms::owner_write );
+      WHEN( "Only the owner can write it" ) {
+         THEN( "It is private" ) {
+            REQUIRE( NativeExpression::IsPrivate( file ) );
+         }
+      }
+      WHEN( "Others can write it" ) {
+         std::filesystem::permissions( file, std::filesystem::perms::others_write, std::filesystem::perm_options::add );
+         THEN( "It is not private" ) {
+            REQUIRE_FALSE( NativeExpression::IsPrivate( file ) );
+         }
+      }
+      WHEN( "It is reached through a symbolic link" ) {
+         std::filesystem::path const link = base / "link.so";
+         std::filesystem::create_symlink( file, link );
+         THEN( "The link is not private" ) {
+            REQUIRE_FALSE( NativeExpression::IsPrivate( link ) );
+         }
+      }
+      WHEN( "It does not exist" ) {
+         std::filesystem::remove( file );
+         THEN( "It is not private" ) {
+            REQUIRE_FALSE( NativeExpression::IsPrivate( file ) );
+         }
+      }
+   }
+
+   std::filesystem::remove_all( base );
+}
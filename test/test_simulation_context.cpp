@@ -0,0 +1,203 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+#include "communication/communication_statistics.h"
+#include "communication/mpi_utilities.h"
+#include "simulation_context.h"
+#include "utilities/runtime_profiler.h"
+#include "utilities/task_graph.h"
+
+SCENARIO( "The instances of a simulation resolve to the context bound to the thread", "[1rank]" ) {
+   GIVEN( "Two contexts with different communicators and the default context." ) {
+      SimulationContext& default_context = SimulationContext::Current();
+      SimulationContext first( MPI_COMM_SELF );
+      SimulationContext second;
+      WHEN( "The contexts are bound one after another." ) {
+         THEN( "The bound context is current and the previous one is restored with the end of the binding." ) {
+            {
+               SimulationContext::Binding const outer( first );
+               REQUIRE( &SimulationContext::Current() == &first );
+               REQUIRE( MpiUtilities::Communicator() == MPI_COMM_SELF );
+               {
+                  SimulationContext::Binding const inner( second );
+                  REQUIRE( &SimulationContext::Current() == &second );
+                  REQUIRE( MpiUtilities::Communicator() == MPI_COMM_WORLD );
+               }
+               REQUIRE( &SimulationContext::Current() == &first );
+            }
+            REQUIRE( &SimulationContext::Current() == &default_context );
+         }
+         THEN( "Each context holds its own statistics and profiler." ) {
+            long const default_sends = CommunicationStatistics::Instance().balance_send_;
+            {
+               SimulationContext::Binding const binding( first );
+               CommunicationStatistics::Instance().balance_send_ += 3;
+               REQUIRE( &RuntimeProfiler::Instance() == &first.Profiler() );
+            }
+            {
+               SimulationContext::Binding const binding( second );
+               REQUIRE( CommunicationStatistics::Instance().balance_send_ == 0 );
+               REQUIRE( &RuntimeProfiler::Instance() == &second.Profiler() );
+            }
+            REQUIRE( first.Statistics().balance_send_ == 3 );
+            REQUIRE( CommunicationStatistics::Instance().balance_send_ == default_sends );
+         }
+      }
+   }
+
+   GIVEN( "Two contexts bound on two threads." ) {
+      SimulationContext first;
+      SimulationContext second;
+      WHEN( "Both threads count messages concurrently." ) {
+         auto const count = []( SimulationContext& context, long const messages ) {
+            SimulationContext::Binding const binding( context );
+            for( long message = 0; message < messages; ++message ) {
+               CommunicationStatistics::Instance().jump_halos_send_++;
+            }
+         };
+         std::thread first_thread( count, std::ref( first ), 1000 );
+         std::thread second_thread( count, std::ref( second ), 2000 );
+         first_thread.join();
+         second_thread.join();
+         THEN( "Each context holds the messages of its thread." ) {
+            REQUIRE( first.Statistics().jump_halos_send_ == 1000 );
+            REQUIRE( second.Statistics().jump_halos_send_ == 2000 );
+         }
+      }
+   }
+
+   GIVEN( "Contexts bound on other threads while this thread has no binding." ) {
+      SimulationContext first;
+      SimulationContext second;
+      std::atomic<int> bound_threads = 0;
+      std::atomic<bool> checked = false;
+      auto const bind = [&bound_threads, &checked]( SimulationContext& context ) {
+         SimulationContext::Binding const binding( context );
+         bound_threads++;
+         while( !checked ) {
+            std::this_thread::yield();
+         }
+      };
+      WHEN( "A single context is bound." ) {
+         std::thread first_thread( bind, std::ref( first ) );
+         while( bound_threads < 1 ) {
+            std::this_thread::yield();
+         }
+         SimulationContext* const current = &SimulationContext::Current();
+         checked = true;
+         first_thread.join();
+         THEN( "The thread resolves to the only bound context and to the default context after the binding ended." ) {
+            REQUIRE( current == &first );
+            REQUIRE( &SimulationContext::Current() != &first );
+         }
+      }
+      WHEN( "Two contexts are bound." ) {
+         std::thread first_thread( bind, std::ref( first ) );
+         std::thread second_thread( bind, std::ref( second ) );
+         while( bound_threads < 2 ) {
+            std::this_thread::yield();
+         }
+         bool throws = false;
+         try {
+            SimulationContext::Current();
+         } catch( std::logic_error const& ) {
+            throws = true;
+         }
+         checked = true;
+         first_thread.join();
+         second_thread.join();
+         THEN( "The context cannot be resolved." ) {
+            REQUIRE( throws );
+         }
+      }
+   }
+
+   GIVEN( "A task graph run while a context is bound." ) {
+      SimulationContext context;
+      SimulationContext::Binding const binding( context );
+      TaskGraph graph;
+      std::atomic<int> foreign_contexts = 0;
+      for( unsigned int task = 0; task < 64; ++task ) {
+         graph.AddComputeTask( [&context, &foreign_contexts]() {
+            if( &SimulationContext::Current() != &context ) foreign_contexts++;
+         } );
+      }
+      WHEN( "The graph is run." ) {
+         graph.Run();
+         THEN( "All tasks resolve the bound context, regardless of the thread that executes them." ) {
+            REQUIRE( foreign_contexts == 0 );
+         }
+      }
+   }
+}
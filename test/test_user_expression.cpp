@@ -163,6 +163,53 @@ SCENARIO( "User expression evaluation", "[1rank]" ) {
          }
       }
    }
+   GIVEN( "A user expression of type f=x+y, g=x-y with an empty output name." ) {
+      std::vector<double> point( 2, 0.0 );
+      std::vector<std::string> const variables_out = { "f", "", "g" };
+      std::vector<std::string> const variables_in  = { "x", "y" };
+      std::string const expression                 = "f := x + y; g := x - y;";
+      UserExpression user_expression               = UserExpression( expression, variables_out, variables_in, point );
+
+      WHEN( "All outputs are evaluated at once at the point {x,y} = {1.5, 0.25}" ) {
+         point[0] = 1.5;
+         point[1] = 0.25;
+         std::vector<double> values;
+         user_expression.GetValues( values );
+         THEN( "Then, approximately should hold {f,,g} = {1.75, 0.0, 1.25}" ) {
+            REQUIRE( values.size() == 3 );
+            REQUIRE( values[0] == Approx( 1.75 ) );
+            REQUIRE( values[1] == 0.0 );
+            REQUIRE( values[2] == Approx( 1.25 ) );
+         }
+         THEN( "The values agree with the single evaluations" ) {
+            REQUIRE( values[0] == user_expression.GetValue( "f" ) );
+            REQUIRE( values[2] == user_expression.GetValue( "g" ) );
+         }
+      }
+   }
+   GIVEN( "A user expression with random numbers of type f=rand()." ) {
+      std::vector<double> point( 1, 0.0 );
+      std::vector<std::string> const variables_out = { "f" };
+      std::vector<std::string> const variables_in  = { "x" };
+      std::string const expression                 = "f := rand()";
+      UserExpression user_expression               = UserExpression( expression, variables_out, variables_in, point );
+
+      WHEN( "Two cells are evaluated in either order" ) {
+         user_expression.SetRandomStream( 10, 0 );
+         double const first_cell = user_expression.GetValue( "f" );
+         user_expression.SetRandomStream( 10, 1 );
+         double const second_cell = user_expression.GetValue( "f" );
+         user_expression.SetRandomStream( 10, 1 );
+         double const second_cell_again = user_expression.GetValue( "f" );
+         user_expression.SetRandomStream( 10, 0 );
+         double const first_cell_again = user_expression.GetValue( "f" );
+         THEN( "Each cell gets the same value independent of the order" ) {
+            REQUIRE( first_cell == first_cell_again );
+            REQUIRE( second_cell == second_cell_again );
+            REQUIRE( first_cell != second_cell );
+         }
+      }
+   }
    GIVEN( "A parametric user expression of type x=r*sin(theta)*cos(phi), y=r*sin(theta)*sin(phi), z=r*cos(theta) for spherical corodinate computation." ) {
       std::vector<double> point( 3, 0.0 );
       std::vector<std::string> const variables_out = { "x", "y", "z" };
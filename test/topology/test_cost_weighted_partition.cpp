@@ -0,0 +1,221 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+
+#include <catch2/catch.hpp>
+#include "topology/cost_weighted_partition.h"
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace {
+   /**
+    * @brief Gives the accumulated cost each rank receives for the given partition.
+    */
+   std::vector<double> CostPerRank( std::vector<double> const& costs, std::vector<int> const& ranks, int const number_of_ranks ) {
+      std::vector<double> cost_per_rank( number_of_ranks, 0.0 );
+      for( std::size_t i = 0; i < costs.size(); ++i ) {
+         cost_per_rank[ranks[i]] += costs[i];
+      }
+      return cost_per_rank;
+   }
+}// namespace
+
+SCENARIO( "Cost-weighted partitions cut the curve by accumulated cost", "[1rank]" ) {
+   GIVEN( "Eight elements of equal cost" ) {
+      std::vector<double> const costs( 8, 1.0 );
+      WHEN( "They are distributed onto four ranks" ) {
+         auto const ranks = CostWeightedRanks( costs, 4 );
+         THEN( "Each rank receives two elements in curve order" ) {
+            REQUIRE( ranks == std::vector<int>( { 0, 0, 1, 1, 2, 2, 3, 3 } ) );
+         }
+      }
+   }
+   GIVEN( "Two expensive elements followed by six cheap ones" ) {
+      std::vector<double> const costs = { 6.0, 6.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+      WHEN( "They are distributed onto three ranks" ) {
+         auto const ranks = CostWeightedRanks( costs, 3 );
+         THEN( "Each rank receives the same cost" ) {
+            REQUIRE( CostPerRank( costs, ranks, 3 ) == std::vector<double>( { 6.0, 6.0, 6.0 } ) );
+         }
+         THEN( "The ranks do not decrease along the curve" ) {
+            REQUIRE( std::is_sorted( ranks.begin(), ranks.end() ) );
+         }
+      }
+   }
+   GIVEN( "Elements without any cost" ) {
+      std::vector<double> const costs( 4, 0.0 );
+      WHEN( "They are distributed onto two ranks" ) {
+         auto const ranks = CostWeightedRanks( costs, 2 );
+         THEN( "They are treated as equally expensive" ) {
+            REQUIRE( ranks == std::vector<int>( { 0, 0, 1, 1 } ) );
+         }
+      }
+   }
+}
+
+SCENARIO( "Diffusive partitions move elements only between neighboring ranks", "[1rank]" ) {
+   GIVEN( "Eight elements of equal cost of which six reside on the first of two ranks" ) {
+      std::vector<double> const costs( 8, 1.0 );
+      std::vector<int> const current_ranks = { 0, 0, 0, 0, 0, 0, 1, 1 };
+      WHEN( "The full flow is realized" ) {
+         auto const ranks = DiffusiveRanks( current_ranks, costs, 2, 1.0 );
+         THEN( "The rear elements of the first rank move to the second rank" ) {
+            REQUIRE( ranks == std::vector<int>( { 0, 0, 0, 0, 1, 1, 1, 1 } ) );
+         }
+      }
+      WHEN( "Half of the flow is realized" ) {
+         auto const ranks = DiffusiveRanks( current_ranks, costs, 2, 0.5 );
+         THEN( "Only half of the excess elements move" ) {
+            REQUIRE( ranks == std::vector<int>( { 0, 0, 0, 0, 0, 1, 1, 1 } ) );
+         }
+      }
+      WHEN( "No flow is realized" ) {
+         auto const ranks = DiffusiveRanks( current_ranks, costs, 2, 0.0 );
+         THEN( "No element moves" ) {
+            REQUIRE( ranks == current_ranks );
+         }
+      }
+   }
+   GIVEN( "Eight elements of equal cost all residing on the first of four ranks" ) {
+      std::vector<double> const costs( 8, 1.0 );
+      std::vector<int> const current_ranks( 8, 0 );
+      WHEN( "The full flow is realized" ) {
+         auto const ranks = DiffusiveRanks( current_ranks, costs, 4, 1.0 );
+         THEN( "Elements only move to the neighboring rank" ) {
+            REQUIRE( *std::max_element( ranks.begin(), ranks.end() ) == 1 );
+            REQUIRE( CostPerRank( costs, ranks, 4 ) == std::vector<double>( { 2.0, 6.0, 0.0, 0.0 } ) );
+         }
+      }
+   }
+   GIVEN( "A balanced distribution" ) {
+      std::vector<double> const costs = { 6.0, 6.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+      std::vector<int> const current_ranks = CostWeightedRanks( costs, 3 );
+      WHEN( "The full flow is realized" ) {
+         auto const ranks = DiffusiveRanks( current_ranks, costs, 3, 1.0 );
+         THEN( "No element moves" ) {
+            REQUIRE( ranks == current_ranks );
+         }
+      }
+   }
+}
+
+SCENARIO( "Group-aligned partitions keep groups of elements on one rank", "[1rank]" ) {
+   GIVEN( "Two groups of four elements split between two ranks" ) {
+      std::vector<int> const ranks = { 0, 0, 0, 1, 1, 1, 1, 1 };
+      std::vector<int> const keys = { 7, 7, 7, 7, 9, 9, 9, 9 };
+      WHEN( "The ranks are aligned to the groups" ) {
+         auto const aligned_ranks = GroupAlignedRanks( ranks, keys );
+         THEN( "Each group goes to the rank holding most of its elements" ) {
+            REQUIRE( aligned_ranks == std::vector<int>( { 0, 0, 0, 0, 1, 1, 1, 1 } ) );
+         }
+      }
+   }
+   GIVEN( "A group split evenly between two ranks" ) {
+      std::vector<int> const ranks = { 0, 0, 1, 1 };
+      std::vector<int> const keys( 4, 3 );
+      WHEN( "The ranks are aligned to the groups" ) {
+         auto const aligned_ranks = GroupAlignedRanks( ranks, keys );
+         THEN( "The group goes to the lower rank" ) {
+            REQUIRE( aligned_ranks == std::vector<int>( 4, 0 ) );
+         }
+      }
+   }
+   GIVEN( "Groups which are not split" ) {
+      std::vector<double> const costs( 8, 1.0 );
+      std::vector<int> const ranks = CostWeightedRanks( costs, 4 );
+      std::vector<int> const keys = { 1, 1, 2, 2, 3, 3, 4, 4 };
+      WHEN( "The ranks are aligned to the groups" ) {
+         auto const aligned_ranks = GroupAlignedRanks( ranks, keys );
+         THEN( "No element moves" ) {
+            REQUIRE( aligned_ranks == ranks );
+         }
+      }
+   }
+}
+
+SCENARIO( "Curve segments are ordered by the compute nodes of the ranks", "[1rank]" ) {
+   GIVEN( "Six ranks placed round-robin onto two compute nodes" ) {
+      std::vector<int> const node_of_rank = { 0, 1, 0, 1, 0, 1 };
+      WHEN( "The ranks are grouped by their node" ) {
+         auto const curve_ranks = RanksGroupedByNode( node_of_rank );
+         THEN( "The ranks of each node take adjacent segments in their original order" ) {
+            REQUIRE( curve_ranks == std::vector<int>( { 0, 2, 4, 1, 3, 5 } ) );
+         }
+      }
+   }
+   GIVEN( "Ranks placed block-wise onto compute nodes" ) {
+      std::vector<int> const node_of_rank = { 0, 0, 2, 2 };
+      WHEN( "The ranks are grouped by their node" ) {
+         auto const curve_ranks = RanksGroupedByNode( node_of_rank );
+         THEN( "The order is unchanged" ) {
+            REQUIRE( curve_ranks == std::vector<int>( { 0, 1, 2, 3 } ) );
+         }
+      }
+   }
+}
@@ -0,0 +1,134 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+#include "topology/node_store.h"
+#include "topology/id_information.h"
+#include "topology/space_filling_curve_order.h"
+#include <stdexcept>
+#include <vector>
+
+namespace {
+   /**
+    * @brief Gives the ids of the store in iteration order.
+    */
+   std::vector<nid_t> IdsInOrder( NodeStore const& nodes ) {
+      std::vector<nid_t> ids;
+      for( auto const& [id, node] : nodes ) {
+         ids.push_back( id );
+      }
+      return ids;
+   }
+}// namespace
+
+SCENARIO( "The node store iterates its nodes along the space-filling curve", "[1rank]" ) {
+   GIVEN( "A node store filled with the children of a node in reverse order" ) {
+      NodeStore nodes( SpaceFillingCurveSettings::SfcIndex );
+      std::array<nid_t, CC::NOC()> const children = IdsOfChildren( 0x1400000 );
+      for( auto child = children.crbegin(); child != children.crend(); ++child ) {
+         nodes.emplace( *child, *child, 1.0, std::vector<MaterialName>( { MaterialName::MaterialOne } ) );
+      }
+      std::vector<nid_t> curve_order( children.cbegin(), children.cend() );
+      OrderNodeIdsBySpaceFillingCurve( curve_order );
+      THEN( "All nodes are found and the iteration follows the curve" ) {
+         REQUIRE( nodes.size() == CC::NOC() );
+         for( nid_t const child : children ) {
+            REQUIRE( nodes.contains( child ) );
+            REQUIRE( nodes.entry( child ).first == child );
+            REQUIRE( nodes.find( child ) == &nodes.entry( child ) );
+         }
+         REQUIRE( IdsInOrder( nodes ) == curve_order );
+      }
+      WHEN( "An existing id is added again" ) {
+         Node const& node = nodes.at( children.front() );
+         auto const entry_and_decision = nodes.emplace( children.front(), children.front(), 1.0, std::vector<MaterialName>( { MaterialName::MaterialTwo } ) );
+         THEN( "The existing node is kept" ) {
+            REQUIRE_FALSE( entry_and_decision.second );
+            REQUIRE( &entry_and_decision.first.second == &node );
+            REQUIRE( nodes.size() == CC::NOC() );
+         }
+      }
+      WHEN( "A node is removed and inserted again" ) {
+         Node const* const address = &nodes.at( children.back() );
+         REQUIRE( nodes.erase( children.back() ) == 1 );
+         REQUIRE_FALSE( nodes.contains( children.back() ) );
+         Node const& node = nodes.emplace( children.back(), children.back(), 1.0, std::vector<MaterialName>( { MaterialName::MaterialOne } ) ).first.second;
+         THEN( "The freed slot is reused and the curve order is restored" ) {
+            REQUIRE( &node == address );
+            REQUIRE( IdsInOrder( nodes ) == curve_order );
+         }
+      }
+      WHEN( "A node that is not present is requested" ) {
+         THEN( "The lookup throws and the search gives no entry" ) {
+            REQUIRE_THROWS_AS( nodes.at( 0x1400000 ), std::out_of_range );
+            REQUIRE( nodes.find( 0x1400000 ) == nullptr );
+            REQUIRE( nodes.erase( 0x1400000 ) == 0 );
+         }
+      }
+   }
+}
@@ -0,0 +1,119 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+#include "topology/phase_map.h"
+#include <stdexcept>
+#include <vector>
+
+namespace {
+   /**
+    * @brief Gives the materials of the map in iteration order.
+    */
+   std::vector<MaterialName> MaterialsInOrder( PhaseMap const& phases ) {
+      std::vector<MaterialName> materials;
+      for( auto const& [material, block] : phases ) {
+         materials.push_back( material );
+      }
+      return materials;
+   }
+}// namespace
+
+SCENARIO( "The phase map keeps its entries sorted by material", "[1rank]" ) {
+   GIVEN( "A phase map filled in reverse material order" ) {
+      PhaseMap phases;
+      phases.emplace( MaterialName::MaterialThree );
+      phases.emplace( MaterialName::MaterialOne );
+      phases.emplace( MaterialName::MaterialTwo );
+      THEN( "The iteration order follows the material order" ) {
+         REQUIRE( MaterialsInOrder( phases ) == std::vector<MaterialName>( { MaterialName::MaterialOne, MaterialName::MaterialTwo, MaterialName::MaterialThree } ) );
+      }
+      WHEN( "An existing material is added again" ) {
+         Block const& block = phases.at( MaterialName::MaterialTwo );
+         Block const& added_block = phases.emplace( MaterialName::MaterialTwo );
+         THEN( "The existing block is kept" ) {
+            REQUIRE( phases.size() == 3 );
+            REQUIRE( &added_block == &block );
+         }
+      }
+      WHEN( "A material is removed" ) {
+         std::size_t const removed_count = phases.erase( MaterialName::MaterialTwo );
+         THEN( "Only this material is gone and the order is kept" ) {
+            REQUIRE( removed_count == 1 );
+            REQUIRE_FALSE( phases.contains( MaterialName::MaterialTwo ) );
+            REQUIRE( MaterialsInOrder( phases ) == std::vector<MaterialName>( { MaterialName::MaterialOne, MaterialName::MaterialThree } ) );
+         }
+      }
+      WHEN( "A material that is not present is requested" ) {
+         THEN( "The lookup throws" ) {
+            REQUIRE_THROWS_AS( phases.at( MaterialName::MaterialFour ), std::out_of_range );
+            REQUIRE( phases.erase( MaterialName::MaterialFour ) == 0 );
+         }
+      }
+   }
+}
@@ -69,6 +69,7 @@
 
 #include <catch2/catch.hpp>
 #include "topology/space_filling_curve_index.h"
+#include <algorithm>
 #include <cstdint>
 #include <iterator>
 #include <vector>
@@ -97,6 +98,24 @@ namespace {
                NorthNeighborOfNodeWithId( origin_id ), NorthNeighborOfNodeWithId( EastNeighborOfNodeWithId( origin_id ) ), NorthNeighborOfNodeWithId( EastNeighborOfNodeWithId( EastNeighborOfNodeWithId( origin_id ) ) ), NorthNeighborOfNodeWithId( EastNeighborOfNodeWithId( EastNeighborOfNodeWithId( EastNeighborOfNodeWithId( origin_id ) ) ) ) };
    }
 
+   /**
+    * @brief Gives the node ids that make up a 4x4x1 square on level one, row by row.
+    */
+   std::vector<nid_t> LevelOneFourByFourSquare() {
+      nid_t const start_on_level_one = IdsOfChildren( origin_id ).front();
+      std::vector<nid_t> square;
+      nid_t row_start = start_on_level_one;
+      for( unsigned int j = 0; j < 4; ++j ) {
+         nid_t id = row_start;
+         for( unsigned int i = 0; i < 4; ++i ) {
+            square.push_back( id );
+            id = EastNeighborOfNodeWithId( id );
+         }
+         row_start = NorthNeighborOfNodeWithId( row_start );
+      }
+      return square;
+   }
+
    /*
     * @brief Gives the node ids that make up a 1x1x512 channel on level two.
     */
@@ -244,3 +263,34 @@ SCENARIO( "Lebesgue index is correctly computed", "[1rank]" ) {
       }
    }
 }
+
+SCENARIO( "Two-dimensional Hilbert index is correctly computed", "[1rank]" ) {
+   GIVEN( "Ids forming a 2x2 square" ) {
+      std::vector<nid_t> const square = { origin_id, EastNeighborOfNodeWithId( origin_id ), NorthNeighborOfNodeWithId( origin_id ),
+                                          EastNeighborOfNodeWithId( NorthNeighborOfNodeWithId( origin_id ) ) };
+      WHEN( "We compute the index of each id in the square" ) {
+         std::vector<sfcidx_t> indices;
+         indices.reserve( square.size() );
+         std::transform( std::cbegin( square ), std::cend( square ), std::back_inserter( indices ), []( auto const id ) { return HilbertIndex2D( id ); } );
+         THEN( "The indices match the expected hilbert traversal through the square" ) {
+            std::vector<sfcidx_t> expected_hilbert_order = { 0, 3, 1, 2 };
+            REQUIRE( indices == expected_hilbert_order );
+         }
+      }
+   }
+   GIVEN( "Ids forming a 4x4 square on level one" ) {
+      auto square = LevelOneFourByFourSquare();
+      WHEN( "We sort the ids by their index" ) {
+         std::sort( std::begin( square ), std::end( square ), []( nid_t const a, nid_t const b ) { return HilbertIndex2D( a ) < HilbertIndex2D( b ); } );
+         THEN( "The square is traversed without gaps, i.e. consecutive ids are face neighbors" ) {
+            REQUIRE( HilbertIndex2D( square.front() ) == 0 );
+            REQUIRE( HilbertIndex2D( square.back() ) == 15 );
+            for( std::size_t i = 1; i < square.size(); ++i ) {
+               nid_t const a = square[i - 1];
+               nid_t const b = square[i];
+               REQUIRE( ( EastNeighborOfNodeWithId( a ) == b || EastNeighborOfNodeWithId( b ) == a || NorthNeighborOfNodeWithId( a ) == b || NorthNeighborOfNodeWithId( b ) == a ) );
+            }
+         }
+      }
+   }
+}
@@ -118,3 +118,27 @@ SCENARIO( "Space-filling curves give the correct ordering of ids", "[1rank]" ) {
       }
    }
 }
+
+SCENARIO( "Long id lists are ordered like a comparison sort on the curve index", "[1rank]" ) {
+   GIVEN( "All descendants of the seed on level three, more than the radix sort threshold in three dimensions" ) {
+      std::vector<nid_t> nodes = { IdSeed() };
+      for( unsigned int level = 0; level < 3; ++level ) {
+         std::vector<nid_t> children;
+         for( nid_t const id : nodes ) {
+            for( nid_t const child : IdsOfChildren( id ) ) {
+               children.push_back( child );
+            }
+         }
+         nodes = children;
+      }
+      std::vector<nid_t> expected_nodes( nodes );
+      std::sort( expected_nodes.begin(), expected_nodes.end(), []( nid_t const a, nid_t const b ) { return HilbertIndex( a ) < HilbertIndex( b ); } );
+      WHEN( "We order the reversed list by the Hilbert curve" ) {
+         std::reverse( nodes.begin(), nodes.end() );
+         OrderNodeIdsBySpaceFillingCurve( nodes, HilbertIndex );
+         THEN( "The order is the one of the comparison sort" ) {
+            REQUIRE( nodes == expected_nodes );
+         }
+      }
+   }
+}
@@ -66,10 +66,12 @@
 * Munich, February 10th, 2021                                                            *
 *                                                                                        *
 *****************************************************************************************/
+#include <algorithm>
 #include <catch2/catch.hpp>
 #include "topology/id_information.h"
 #include "topology/node_id_type.h"
 #include "topology/topology_manager.h"
+#include "user_specifications/space_filling_curve_settings.h"
 #include "materials/material_definitions.h"
 #include "communication/mpi_utilities.h"
 
@@ -184,24 +186,25 @@ namespace SimplestJumpTopology {
       constexpr unsigned int interfaceleaf_count = 4;
       constexpr unsigned int block_count         = 15;
    }// namespace MaterialsAdded
+   // Siblings are kept on one rank, hence the only family resides on rank zero together with the level-zero leaf
    namespace Distributed {
-      constexpr unsigned int nodes_blocks_on_rank_zero = 4;
-      constexpr unsigned int nodes_blocks_on_rank_one  = 4;
-      constexpr unsigned int nodes_blocks_on_rank_two  = 2;
-      constexpr unsigned int leaves_on_rank_zero       = 4;
-      constexpr unsigned int leaves_on_rank_one        = 3;
-      constexpr unsigned int leaves_on_rank_two        = 2;
-      constexpr int parent_rank                        = 1;
+      constexpr unsigned int nodes_blocks_on_rank_zero = 10;
+      constexpr unsigned int nodes_blocks_on_rank_one  = 0;
+      constexpr unsigned int nodes_blocks_on_rank_two  = 0;
+      constexpr unsigned int leaves_on_rank_zero       = 9;
+      constexpr unsigned int leaves_on_rank_one        = 0;
+      constexpr unsigned int leaves_on_rank_two        = 0;
+      constexpr int parent_rank                        = 0;
    }// namespace Distributed
    namespace MaterialsAddedDistributed {
       constexpr unsigned long long int offset_rank_zero          = 0;
-      constexpr unsigned long long int node_offset_rank_one      = 5;
+      constexpr unsigned long long int node_offset_rank_one      = 10;
       constexpr unsigned long long int leaf_count                = 9;
-      constexpr unsigned long long int leaf_offset_rank_one      = 5;
+      constexpr unsigned long long int leaf_offset_rank_one      = 9;
       constexpr unsigned long long int interface_count           = 4;
-      constexpr unsigned long long int interface_offset_rank_one = 2;
+      constexpr unsigned long long int interface_offset_rank_one = 4;
       constexpr unsigned long long int block_count               = 15;
-      constexpr unsigned long long int block_offset_rank_one     = 7;
+      constexpr unsigned long long int block_offset_rank_one     = 15;
    }// namespace MaterialsAddedDistributed
    namespace Parallel {
       /**
@@ -302,7 +305,7 @@ SCENARIO( "Topology manager gives correct nodes/leaf/multi-phase/offset/etc. cou
          constexpr int number_of_ranks = 3;
          simplest_jump.PrepareLoadBalancedTopology( number_of_ranks );
          simplest_jump.UpdateTopology();
-         THEN( "We count 4, 4 and 2 nodes as well as 4, 3 and 2 leaves on rank zero, one and two, respectively" ) {
+         THEN( "We count all ten nodes and nine leaves on rank zero and none on rank one and two" ) {
             auto const nodes_and_leaves_per_rank = simplest_jump.NodesAndLeavesPerRank( number_of_ranks );
             REQUIRE( nodes_and_leaves_per_rank.size() == 3 );
 
@@ -318,7 +321,7 @@ SCENARIO( "Topology manager gives correct nodes/leaf/multi-phase/offset/etc. cou
             REQUIRE( nodes_rank_two == SimplestJumpTopology::Distributed::nodes_blocks_on_rank_two );
             REQUIRE( leaves_rank_two == SimplestJumpTopology::Distributed::leaves_on_rank_two );
          }
-         THEN( "We count 4, 4 and 2 nodes on rank zero, one and two, respectively and the same amount of blocks" ) {
+         THEN( "We count all ten nodes on rank zero and none on rank one and two and the same amount of blocks" ) {
             auto const nodes_and_blocks_per_rank = simplest_jump.NodesAndBlocksPerRank( number_of_ranks );
             REQUIRE( nodes_and_blocks_per_rank.size() == 3 );
 
@@ -334,6 +337,14 @@ SCENARIO( "Topology manager gives correct nodes/leaf/multi-phase/offset/etc. cou
             REQUIRE( nodes_rank_two == SimplestJumpTopology::Distributed::nodes_blocks_on_rank_two );
             REQUIRE( blocks_rank_two == SimplestJumpTopology::Distributed::nodes_blocks_on_rank_two );
          }
+         THEN( "The leaf costs per rank equal the leaf counts, as single-phase leaves without measurement cost one each" ) {
+            std::vector<double> const costs = simplest_jump.LeafCostsPerRank( number_of_ranks );
+            auto const nodes_and_leaves_per_rank = simplest_jump.NodesAndLeavesPerRank( number_of_ranks );
+            REQUIRE( costs.size() == 3 );
+            for( int rank = 0; rank < number_of_ranks; ++rank ) {
+               REQUIRE( costs[rank] == double( nodes_and_leaves_per_rank[rank].second ) );
+            }
+         }
       }
 
       WHEN( "We add a second material and distribute on two ranks" ) {
@@ -341,11 +352,11 @@ SCENARIO( "Topology manager gives correct nodes/leaf/multi-phase/offset/etc. cou
          constexpr int number_of_ranks = 2;
          simplest_jump.PrepareLoadBalancedTopology( number_of_ranks );
          simplest_jump.UpdateTopology();
-         THEN( "We count two, and two interface leaves on rank zero and one, respectively" ) {
+         THEN( "We count four and no interface leaves on rank zero and one, respectively" ) {
             auto const interface_leaves_per_rank = simplest_jump.InterfaceLeavesPerRank( number_of_ranks );
             REQUIRE( interface_leaves_per_rank.size() == 2 );
-            REQUIRE( interface_leaves_per_rank[0] == 2 );
-            REQUIRE( interface_leaves_per_rank[1] == 2 );
+            REQUIRE( interface_leaves_per_rank[0] == 4 );
+            REQUIRE( interface_leaves_per_rank[1] == 0 );
          }
 
          THEN( "The node offset of rank zero is zero and equal the node count on all other ranks " ) {
@@ -436,6 +447,23 @@ SCENARIO( "Single node states can be requested", "[1rank]" ) {
    }
 }
 
+SCENARIO( "The topology tells which nodes take part in resolution jumps", "[1rank]" ) {
+   GIVEN( "A topology with eight leaves on Lmax = 1 and two nodes on level zero" ) {
+      TopologyManager simplest_jump( { 2, 1, 1 }, 1 );
+      RefineZerothRootNode( simplest_jump );
+      WHEN( "We ask which nodes need jump buffers" ) {
+         THEN( "The children at the jump, their parent and the coarse leaf need them" ) {
+            REQUIRE( simplest_jump.NodeNeedsJumpBuffers( SimplestJumpTopology::NodeWithJumpAtEastSide() ) );
+            REQUIRE( simplest_jump.NodeNeedsJumpBuffers( SimplestJumpTopology::ParentNode() ) );
+            REQUIRE( simplest_jump.NodeNeedsJumpBuffers( SimplestJumpTopology::LevelZeroLeafNode() ) );
+         }
+         THEN( "Children away from the jump do not need them" ) {
+            REQUIRE_FALSE( simplest_jump.NodeNeedsJumpBuffers( SimplestJumpTopology::FirstLeftChild() ) );
+         }
+      }
+   }
+}
+
 SCENARIO( "Questions about the Topology can be answered", "[1rank]" ) {
    GIVEN( "A topology with eight leaves on Lmax = 1 and two nodes on level zero, which is periodic in the x-direction" ) {
       TopologyManager simplest_periodic_jump( { 2, 1, 1 }, 1, 1 );
@@ -552,7 +580,7 @@ SCENARIO( "Topology state can be pretty formatted", "[1rank]" ) {
          topology.PrepareLoadBalancedTopology( number_of_ranks );
          topology.UpdateTopology();
          THEN( "we can get the leaf rank distribution as pretty string" ) {
-            std::string const expected_pretty_string = "+++ leave rank distribution +++ Level: 0 Rank: 0 --> 1 | Rank: 1 --> 0 | Rank: 2 --> 0 |  - Level: 1 Rank: 0 --> 3 | Rank: 1 --> 3 | Rank: 2 --> 2 |  - ";
+            std::string const expected_pretty_string = "+++ leave rank distribution +++ Level: 0 Rank: 0 --> 1 | Rank: 1 --> 0 | Rank: 2 --> 0 |  - Level: 1 Rank: 0 --> 8 | Rank: 1 --> 0 | Rank: 2 --> 0 |  - ";
             REQUIRE( topology.LeafRankDistribution( number_of_ranks ) == expected_pretty_string );
          }
       }
@@ -600,9 +628,9 @@ SCENARIO( "Changes in the topology are correctly processed", "[2rank]" ) {
          topology.RefineNodeWithId( root_node_id );
          topology.UpdateTopology();
          topology.PrepareLoadBalancedTopology( number_of_ranks );
-         THEN( "The leafs are evenly distributed onto the ranks" ) {
-            REQUIRE( std::get<1>( topology.NodesAndLeavesPerRank().front() ) == 4 );
-            REQUIRE( std::get<1>( topology.NodesAndLeavesPerRank().back() ) == 4 );
+         THEN( "The leafs are siblings and hence kept on one rank" ) {
+            REQUIRE( std::get<1>( topology.NodesAndLeavesPerRank().front() ) == 8 );
+            REQUIRE( std::get<1>( topology.NodesAndLeavesPerRank().back() ) == 0 );
          }
       }
       WHEN( "We refine the root node, add a couple materials and create a second topology from the first one by restoring the topology" ) {
@@ -631,10 +659,19 @@ SCENARIO( "Changes in the topology are correctly processed", "[2rank]" ) {
          THEN( "The amount of fluids in the first child is the same on both nodes" ) {
             REQUIRE( topology.GetMaterialsOfNode( IdsOfChildren( root_node_id )[0] ) == restored_topology.GetMaterialsOfNode( IdsOfChildren( root_node_id )[0] ) );
          }
+         THEN( "The returned indices refer to the restored nodes on this rank" ) {
+            auto const local_indices = restored_topology.RestoreTopology( ids, number_of_materials, materials );
+            REQUIRE( local_indices.size() == restored_topology.NodesAndLeavesPerRank()[my_rank].first );
+            for( auto const index : local_indices ) {
+               REQUIRE( index < ids.size() );
+               REQUIRE( restored_topology.GetRankOfNode( ids[index] ) == my_rank );
+            }
+         }
       }
-      WHEN( "We refine the root node and the first child" ) {
+      WHEN( "We refine the root node and its first two children" ) {
          topology.RefineNodeWithId( root_node_id );
-         topology.RefineNodeWithId( IdsOfChildren( root_node_id ).front() );
+         topology.RefineNodeWithId( IdsOfChildren( root_node_id )[0] );
+         topology.RefineNodeWithId( IdsOfChildren( root_node_id )[1] );
          topology.UpdateTopology();
          auto const balance_list = topology.PrepareLoadBalancedTopology( number_of_ranks );
          THEN( "Some nodes need to be load balanced" ) {
@@ -650,3 +687,131 @@ SCENARIO( "Changes in the topology are correctly processed", "[2rank]" ) {
       }
    }
 }
+
+SCENARIO( "Material updates are counted by the topology manager", "[1rank]" ) {
+   GIVEN( "A single-phase topology with eight leaves on Lmax = 1 and two nodes on level zero" ) {
+      TopologyManager simplest_jump( { 2, 1, 1 }, 1 );
+      RefineZerothRootNode( simplest_jump );
+      WHEN( "No material has been added" ) {
+         THEN( "The material update count is zero" ) {
+            REQUIRE( simplest_jump.MaterialUpdateCount() == 0 );
+         }
+      }
+      WHEN( "Materials are added in two separate topology updates" ) {
+         AddMaterialToAllNodes( simplest_jump, MaterialName::MaterialOne );
+         AddMaterialToWestmostNodesOnEveryLevel( simplest_jump, MaterialName::MaterialTwo );
+         THEN( "The material update count is two" ) {
+            REQUIRE( simplest_jump.MaterialUpdateCount() == 2 );
+         }
+         THEN( "A topology update without material changes does not increase the count" ) {
+            simplest_jump.UpdateTopology();
+            REQUIRE( simplest_jump.MaterialUpdateCount() == 2 );
+         }
+      }
+   }
+}
+
+SCENARIO( "Topology updates are counted by the topology manager", "[1rank]" ) {
+   GIVEN( "A single-phase topology with two nodes on level zero and Lmax = 1" ) {
+      TopologyManager simplest_jump( { 2, 1, 1 }, 1 );
+      unsigned int const initial_count = simplest_jump.TopologyUpdateCount();
+      WHEN( "A node is refined" ) {
+         RefineZerothRootNode( simplest_jump );
+         THEN( "The topology update count is increased" ) {
+            REQUIRE( simplest_jump.TopologyUpdateCount() > initial_count );
+         }
+      }
+      WHEN( "Only materials are added" ) {
+         unsigned int const count_before_materials = simplest_jump.TopologyUpdateCount();
+         AddMaterialToAllNodes( simplest_jump, MaterialName::MaterialOne );
+         THEN( "The topology update count is unchanged" ) {
+            REQUIRE( simplest_jump.TopologyUpdateCount() == count_before_materials );
+         }
+      }
+      WHEN( "The topology is load balanced" ) {
+         unsigned int const count_before_balancing = simplest_jump.TopologyUpdateCount();
+         simplest_jump.PrepareLoadBalancedTopology( MpiUtilities::NumberOfRanks() );
+         THEN( "The topology update count is increased" ) {
+            REQUIRE( simplest_jump.TopologyUpdateCount() > count_before_balancing );
+         }
+      }
+   }
+}
+
+SCENARIO( "Node listings follow the changes of the topology in space-filling curve order", "[1rank]" ) {
+   GIVEN( "A single-phase topology with eight leaves on Lmax = 1 and two nodes on level zero" ) {
+      TopologyManager simplest_jump( { 2, 1, 1 }, 1 );
+      RefineZerothRootNode( simplest_jump );
+      WHEN( "We list the nodes on level one" ) {
+         std::vector<nid_t> const ids = simplest_jump.IdsOnLevel( 1 );
+         THEN( "The ids are ordered along the space-filling curve" ) {
+            REQUIRE( ids.size() == 8 );
+            REQUIRE( std::is_sorted( std::cbegin( ids ), std::cend( ids ), []( nid_t const a, nid_t const b ) {
+               return SpaceFillingCurveSettings::SfcIndex( a ) < SpaceFillingCurveSettings::SfcIndex( b );
+            } ) );
+         }
+         THEN( "The local leaf lists hold the same ids as all nodes are on this rank" ) {
+            REQUIRE( simplest_jump.LocalIdsOnLevel( 1 ) == ids );
+            REQUIRE( simplest_jump.LeafIdsOnLevel( 1 ) == ids );
+            REQUIRE( simplest_jump.LocalLeafIdsOnLevel( 1 ) == ids );
+         }
+      }
+      WHEN( "We coarse all the children" ) {
+         simplest_jump.IdsOnLevel( 1 );
+         simplest_jump.CoarseNodeWithId( root_node_id );
+         THEN( "The listings are updated" ) {
+            REQUIRE( simplest_jump.IdsOnLevel( 1 ).empty() );
+            REQUIRE( simplest_jump.LeafIdsOnLevel( 0 ).size() == 2 );
+            REQUIRE( simplest_jump.LocalLeafIds().size() == 2 );
+         }
+      }
+   }
+}
+
+SCENARIO( "Neighbors of nodes are provided by the topology manager", "[1rank]" ) {
+   GIVEN( "A single-phase topology with two nodes on level zero of which the first is refined, Lmax = 1" ) {
+      TopologyManager simplest_jump( { 2, 1, 1 }, 1 );
+      RefineZerothRootNode( simplest_jump );
+      nid_t const east_root_id = EastNeighborOfNodeWithId( root_node_id );
+      std::array<nid_t, CC::NOC()> const children = IdsOfChildren( root_node_id );
+      WHEN( "We ask for the neighbors of an eastern child" ) {
+         nid_t const child_id = *std::find_if( std::cbegin( children ), std::cend( children ), EastInSiblingPack );
+         TopologyNeighbor const east = simplest_jump.NeighborOfNode( child_id, BoundaryLocation::East );
+         TopologyNeighbor const west = simplest_jump.NeighborOfNode( child_id, BoundaryLocation::West );
+         THEN( "The east neighbor is the coarser root node behind a jump" ) {
+            REQUIRE( east.id_ == simplest_jump.GetTopologyNeighborId( child_id, BoundaryLocation::East ) );
+            REQUIRE_FALSE( east.is_external_ );
+            REQUIRE( east.is_leaf_ );
+            REQUIRE( east.level_difference_ == -1 );
+            REQUIRE( east.rank_ == simplest_jump.GetRankOfNode( east_root_id ) );
+            REQUIRE( simplest_jump.FaceIsJump( child_id, BoundaryLocation::East ) );
+         }
+         THEN( "The west neighbor is a sibling on the same level" ) {
+            REQUIRE( west.level_difference_ == 0 );
+            REQUIRE( west.is_leaf_ );
+            REQUIRE( std::find( std::cbegin( children ), std::cend( children ), west.id_ ) != std::cend( children ) );
+            REQUIRE_FALSE( simplest_jump.FaceIsJump( child_id, BoundaryLocation::West ) );
+         }
+      }
+      WHEN( "We ask for the neighbors of the eastern root node" ) {
+         TopologyNeighbor const east = simplest_jump.NeighborOfNode( east_root_id, BoundaryLocation::East );
+         TopologyNeighbor const west = simplest_jump.NeighborOfNode( east_root_id, BoundaryLocation::West );
+         THEN( "The east neighbor is an external boundary and the west neighbor the refined root node" ) {
+            REQUIRE( east.is_external_ );
+            REQUIRE( east.rank_ == -1 );
+            REQUIRE_FALSE( west.is_external_ );
+            REQUIRE( west.id_ == root_node_id );
+            REQUIRE( west.level_difference_ == 0 );
+            REQUIRE_FALSE( west.is_leaf_ );
+            REQUIRE( simplest_jump.NodeNeedsJumpBuffers( east_root_id ) );
+         }
+      }
+      WHEN( "The refined root node is coarsened" ) {
+         simplest_jump.CoarseNodeWithId( root_node_id );
+         THEN( "The neighbor of the eastern root node is a leaf" ) {
+            REQUIRE( simplest_jump.NeighborOfNode( east_root_id, BoundaryLocation::West ).is_leaf_ );
+            REQUIRE_FALSE( simplest_jump.NodeNeedsJumpBuffers( east_root_id ) );
+         }
+      }
+   }
+}
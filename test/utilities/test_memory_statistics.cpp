@@ -0,0 +1,111 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+#include "utilities/memory_statistics.h"
+
+SCENARIO( "The memory statistics keep the high-water mark of a category", "[1rank]" ) {
+   GIVEN( "A category with persistent memory" ) {
+      MemoryStatistics::current_bytes_.fill( 0 );
+      MemoryStatistics::high_water_bytes_.fill( 0 );
+      MemoryStatistics::SetCurrent( MemoryCategory::Communication, 1000 );
+      WHEN( "A transient buffer is recorded" ) {
+         MemoryStatistics::RecordTransient( MemoryCategory::Communication, 500 );
+         THEN( "The high-water mark includes the buffer on top of the persistent memory" ) {
+            REQUIRE( MemoryStatistics::current_bytes_[3] == 1000 );
+            REQUIRE( MemoryStatistics::high_water_bytes_[3] == 1500 );
+         }
+      }
+      WHEN( "The persistent memory shrinks" ) {
+         MemoryStatistics::SetCurrent( MemoryCategory::Communication, 200 );
+         THEN( "The high-water mark is kept" ) {
+            REQUIRE( MemoryStatistics::current_bytes_[3] == 200 );
+            REQUIRE( MemoryStatistics::high_water_bytes_[3] == 1000 );
+         }
+      }
+      THEN( "Other categories are not affected" ) {
+         REQUIRE( MemoryStatistics::high_water_bytes_[0] == 0 );
+      }
+   }
+}
+
+SCENARIO( "The capacity of vectors is counted in bytes", "[1rank]" ) {
+   GIVEN( "A vector of vectors" ) {
+      std::vector<std::vector<double>> vectors( 2 );
+      vectors[0].reserve( 4 );
+      vectors[1].reserve( 8 );
+      THEN( "The outer and all inner capacities are counted" ) {
+         REQUIRE( CapacityBytes( vectors ) == vectors.capacity() * sizeof( std::vector<double> ) +
+                                                  ( vectors[0].capacity() + vectors[1].capacity() ) * sizeof( double ) );
+      }
+   }
+}
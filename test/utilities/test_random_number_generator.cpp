@@ -0,0 +1,150 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "utilities/random_number_generator.h"
+
+SCENARIO( "The Philox bijection reproduces the reference values", "[1rank]" ) {
+   GIVEN( "The known answer tests of Philox4x32-10" ) {
+      WHEN( "Counter and key are zero" ) {
+         std::array<std::uint32_t, 4> const bits = RandomNumberGenerator::Philox( { 0, 0, 0, 0 }, { 0, 0 } );
+         THEN( "The result matches the reference" ) {
+            std::array<std::uint32_t, 4> const reference = { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 };
+            REQUIRE( bits == reference );
+         }
+      }
+      WHEN( "All bits of counter and key are set" ) {
+         std::array<std::uint32_t, 4> const bits = RandomNumberGenerator::Philox( { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff }, { 0xffffffff, 0xffffffff } );
+         THEN( "The result matches the reference" ) {
+            std::array<std::uint32_t, 4> const reference = { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd };
+            REQUIRE( bits == reference );
+         }
+      }
+      WHEN( "Counter and key are the digits of pi" ) {
+         std::array<std::uint32_t, 4> const bits = RandomNumberGenerator::Philox( { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }, { 0xa4093822, 0x299f31d0 } );
+         THEN( "The result matches the reference" ) {
+            std::array<std::uint32_t, 4> const reference = { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 };
+            REQUIRE( bits == reference );
+         }
+      }
+   }
+}
+
+SCENARIO( "Random numbers only depend on stream and draw", "[1rank]" ) {
+   GIVEN( "Two generators with the same seed" ) {
+      RandomNumberGenerator first;
+      RandomNumberGenerator second;
+      WHEN( "The streams are visited in different order" ) {
+         std::vector<double> first_numbers;
+         for( std::uint64_t stream = 0; stream < 4; ++stream ) {
+            first.SetStream( stream, 7 );
+            first_numbers.push_back( first.GiveRandomNumber() );
+            first_numbers.push_back( first.GiveRandomNumber() );
+         }
+         std::vector<double> second_numbers( first_numbers.size() );
+         for( std::uint64_t stream = 4; stream-- > 0; ) {
+            second.SetStream( stream, 7 );
+            second_numbers[2 * stream]     = second.GiveRandomNumber();
+            second_numbers[2 * stream + 1] = second.GiveRandomNumber();
+         }
+         THEN( "The numbers are identical" ) {
+            REQUIRE( first_numbers == second_numbers );
+         }
+         THEN( "The numbers lie in [-1, 1) and differ between draws and streams" ) {
+            for( std::size_t n = 0; n < first_numbers.size(); ++n ) {
+               REQUIRE( first_numbers[n] >= -1.0 );
+               REQUIRE( first_numbers[n] < 1.0 );
+               for( std::size_t m = 0; m < n; ++m ) {
+                  REQUIRE( first_numbers[n] != first_numbers[m] );
+               }
+            }
+         }
+      }
+      WHEN( "The substreams differ" ) {
+         first.SetStream( 3, 0 );
+         second.SetStream( 3, 1 );
+         THEN( "The numbers differ" ) {
+            REQUIRE( first.GiveRandomNumber() != second.GiveRandomNumber() );
+         }
+      }
+   }
+   GIVEN( "Two generators with different seeds on the same stream" ) {
+      RandomNumberGenerator first( 1 );
+      RandomNumberGenerator second( 2 );
+      first.SetStream( 5 );
+      second.SetStream( 5 );
+      THEN( "The numbers differ" ) {
+         REQUIRE( first.GiveRandomNumber() != second.GiveRandomNumber() );
+      }
+   }
+}
@@ -0,0 +1,165 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include "utilities/runtime_profiler.h"
+
+SCENARIO( "The runtime profiler measures nested regions", "[1rank]" ) {
+   GIVEN( "An enabled profiler with a region that holds two sub-regions, one of them called twice." ) {
+      RuntimeProfiler& profiler = RuntimeProfiler::Instance();
+      profiler.Reset();
+      profiler.Enable();
+      {
+         ProfileRegion const outer( "Outer" );
+         for( unsigned int call = 0; call < 2; ++call ) {
+            ProfileRegion const inner( "Inner" );
+         }
+         profiler.Start( "Other" );
+         profiler.Stop();
+      }
+      WHEN( "The summary is created." ) {
+         std::vector<std::string> const lines( profiler.Summary() );
+         THEN( "It has a header and one line per region in tree order with indented sub-regions." ) {
+            REQUIRE( lines.size() == 4 );
+            REQUIRE( lines[0].rfind( "Region", 0 ) == 0 );
+            REQUIRE( lines[1].rfind( "Outer ", 0 ) == 0 );
+            REQUIRE( lines[2].rfind( "  Inner ", 0 ) == 0 );
+            REQUIRE( lines[3].rfind( "  Other ", 0 ) == 0 );
+         }
+         THEN( "The number of calls is given for each region." ) {
+            REQUIRE( lines[1].substr( 44, 12 ) == "1           " );
+            REQUIRE( lines[2].substr( 44, 12 ) == "2           " );
+         }
+      }
+      profiler.Enable( false );
+      profiler.Reset();
+   }
+
+   GIVEN( "An enabled profiler recording the timeline of a region." ) {
+      RuntimeProfiler& profiler = RuntimeProfiler::Instance();
+      profiler.Reset();
+      profiler.Enable();
+      profiler.EnableTracing();
+      {
+         ProfileRegion const region( "Region" );
+      }
+      WHEN( "The trace events are created." ) {
+         std::vector<std::string> const events( profiler.TraceEvents() );
+         THEN( "The process is named after the rank and the region begins and ends." ) {
+            REQUIRE( events.size() == 3 );
+            REQUIRE( events[0].find( "\"process_name\"" ) != std::string::npos );
+            REQUIRE( events[1].rfind( "{\"name\":\"Region\",\"ph\":\"B\"", 0 ) == 0 );
+            REQUIRE( events[2].rfind( "{\"name\":\"Region\",\"ph\":\"E\"", 0 ) == 0 );
+         }
+      }
+      profiler.EnableTracing( false );
+      profiler.Enable( false );
+      profiler.Reset();
+   }
+
+   GIVEN( "An enabled profiler collecting hardware counters in a region." ) {
+      RuntimeProfiler& profiler = RuntimeProfiler::Instance();
+      profiler.Reset();
+      profiler.Enable();
+      profiler.EnableHardwareCounters( {} );
+      {
+         ProfileRegion const region( "Region" );
+      }
+      WHEN( "The summary is created." ) {
+         std::vector<std::string> const lines( profiler.Summary() );
+         THEN( "The time table is followed by the counter table, which gives no FLOP rate without floating-point events." ) {
+            REQUIRE( lines.size() == 4 );
+            REQUIRE( lines[2].rfind( "Region", 0 ) == 0 );
+            REQUIRE( lines[2].find( "GFLOP/s" ) != std::string::npos );
+            REQUIRE( lines[3].rfind( "Region ", 0 ) == 0 );
+            REQUIRE( lines[3].substr( 44, 4 ) == "n.a." );
+            REQUIRE_FALSE( profiler.IsCounterAvailable( HardwareCounter::FloatingPointOperations ) );
+         }
+      }
+      profiler.DisableHardwareCounters();
+      profiler.Enable( false );
+      profiler.Reset();
+   }
+
+   GIVEN( "A disabled profiler." ) {
+      RuntimeProfiler& profiler = RuntimeProfiler::Instance();
+      profiler.Reset();
+      profiler.Enable( false );
+      {
+         ProfileRegion const region( "Region" );
+      }
+      WHEN( "The summary is created." ) {
+         std::vector<std::string> const lines( profiler.Summary() );
+         THEN( "Only the header is given and stopping without start is ignored." ) {
+            REQUIRE( lines.size() == 1 );
+            REQUIRE_NOTHROW( profiler.Stop() );
+         }
+      }
+   }
+}
@@ -0,0 +1,119 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <memory>
+
+#include "block_definitions/block.h"
+#include "stencils/spatial_derivative_stencils/derivative_stencil_setup.h"
+#include "utilities/shear_rate_operations.h"
+
+namespace {
+   struct VelocityField {
+      double u_[CC::TCX()][CC::TCY()][CC::TCZ()];
+      double v_[CC::TCX()][CC::TCY()][CC::TCZ()];
+      double w_[CC::TCX()][CC::TCY()][CC::TCZ()];
+   };
+}// namespace
+
+SCENARIO( "Shear rate from a cached velocity gradient", "[1rank]" ) {
+   using DerivativeStencil = DerivativeStencilSetup::Concretize<viscous_fluxes_derivative_stencil_cell_center>::type;
+
+   GIVEN( "A non-uniform velocity field and its velocity gradient at the cell centers" ) {
+      double const cell_size = 0.1;
+      auto const velocity    = std::make_unique<VelocityField>();
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               double const x        = double( i ) * cell_size;
+               double const y        = double( j ) * cell_size;
+               double const z        = double( k ) * cell_size;
+               velocity->u_[i][j][k] = x * x + 2.0 * y - z;
+               velocity->v_[i][j][k] = 0.5 * x * y + z * z;
+               velocity->w_[i][j][k] = x - y * z;
+            }
+         }
+      }
+      auto const gradient = std::make_unique<VelocityGradient>();
+      BO::Stencils::ComputeVectorGradientAtCellCenter<DerivativeStencil>( velocity->u_, velocity->v_, velocity->w_, cell_size, gradient->values_ );
+
+      WHEN( "The shear rate is computed from the velocity gradient and directly from the velocities" ) {
+         THEN( "Both give the same value in all internal cells" ) {
+            for( unsigned int i = CC::FICX(); i <= CC::LICX(); ++i ) {
+               for( unsigned int j = CC::FICY(); j <= CC::LICY(); ++j ) {
+                  for( unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k ) {
+                     double const direct = ShearRateOperations::ComputeShearRate<DerivativeStencil>( velocity->u_, velocity->v_, velocity->w_, cell_size, i, j, k );
+                     REQUIRE( ShearRateOperations::ComputeShearRate( gradient->values_, i, j, k ) == direct );
+                  }
+               }
+            }
+         }
+      }
+   }
+}
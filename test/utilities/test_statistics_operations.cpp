@@ -0,0 +1,145 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <memory>
+
+#include "multiresolution/multiresolution.h"
+#include "utilities/statistics_operations.h"
+
+namespace {
+   /**
+    * @brief Sets the sampled prime states of the internal cells of a block alternating between two values in x-direction, the n-th sampled
+    *        prime state to ( n + 1 ) times the value.
+    * @param block The block whose prime states are set.
+    * @param even_value The value of the even internal cells in x-direction.
+    * @param odd_value The value of the odd internal cells in x-direction.
+    */
+   void SetSampledPrimeStates( Block& block, double const even_value, double const odd_value ) {
+      for( unsigned int a = 0; a < StatisticsBuffers::number_of_states_; ++a ) {
+         PrimeState const state = StatisticsOutputSettings::SampledPrimeStates[a];
+         for( unsigned int i = CC::FICX(); i <= CC::LICX(); ++i ) {
+            double const value = ( i - CC::FICX() ) % 2 == 0 ? even_value : odd_value;
+            for( unsigned int j = CC::FICY(); j <= CC::LICY(); ++j ) {
+               for( unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k ) {
+                  block.GetPrimeStateBuffer().Value( PTI( state ), i, j, k ) = double( a + 1 ) * value;
+               }
+            }
+         }
+      }
+   }
+}// namespace
+
+SCENARIO( "Running statistics give the mean and covariances of the samples", "[1rank]" ) {
+   GIVEN( "A block with statistics buffers" ) {
+      auto block = std::make_unique<Block>();
+      block->AllocateStatisticsBuffers();
+      StatisticsBuffers const& statistics = block->GetStatisticsBuffers();
+      unsigned int const last_state       = StatisticsBuffers::number_of_states_ - 1;
+      WHEN( "The values 1 and 3 are sampled" ) {
+         SetSampledPrimeStates( *block, 1.0, 1.0 );
+         SO::Sample( block->GetPrimeStateBuffer(), block->GetStatisticsBuffers() );
+         SetSampledPrimeStates( *block, 3.0, 3.0 );
+         SO::Sample( block->GetPrimeStateBuffer(), block->GetStatisticsBuffers() );
+         THEN( "The internal cells hold the number of samples, the means and the ( population ) covariances" ) {
+            REQUIRE( statistics[StatisticsBuffers::SamplesIndex()][CC::FICX()][CC::FICY()][CC::FICZ()] == 2.0 );
+            REQUIRE( statistics[StatisticsBuffers::MeanIndex( 0 )][CC::FICX()][CC::FICY()][CC::FICZ()] == Approx( 2.0 ) );
+            REQUIRE( statistics[StatisticsBuffers::MeanIndex( last_state )][CC::LICX()][CC::LICY()][CC::LICZ()] == Approx( 2.0 * ( last_state + 1 ) ) );
+            REQUIRE( statistics[StatisticsBuffers::CovarianceIndex( 0, 0 )][CC::FICX()][CC::FICY()][CC::FICZ()] == Approx( 1.0 ) );
+            REQUIRE( statistics[StatisticsBuffers::CovarianceIndex( 0, last_state )][CC::FICX()][CC::FICY()][CC::FICZ()] == Approx( double( last_state + 1 ) ) );
+         }
+         THEN( "The halo cells are untouched" ) {
+            REQUIRE( statistics[StatisticsBuffers::SamplesIndex()][0][0][0] == 0.0 );
+         }
+      }
+   }
+}
+
+SCENARIO( "Statistics averaged into the parent combine the samples of the child cells", "[1rank]" ) {
+   GIVEN( "A child whose cells alternate between means of 1 and 3 in x-direction sampled once" ) {
+      auto child = std::make_unique<Block>();
+      child->AllocateStatisticsBuffers();
+      SetSampledPrimeStates( *child, 1.0, 3.0 );
+      SO::Sample( child->GetPrimeStateBuffer(), child->GetStatisticsBuffers() );
+      WHEN( "The statistics are averaged into the parent as raw moments" ) {
+         nid_t const child_id = IdsOfChildren( IdSeed() ).front();
+         auto parent          = std::make_unique<StatisticsBuffers>();
+         auto raw_child       = std::make_unique<StatisticsBuffers>( child->GetStatisticsBuffers() );
+         SO::ToRawMoments( *raw_child );
+         Multiresolution::Average( *raw_child, *parent, child_id );
+         SO::ToCentralMoments( *parent );
+         THEN( "The parent cells hold the mean and the variance of both child cells" ) {
+            auto const& statistics = *parent;
+            REQUIRE( statistics[StatisticsBuffers::SamplesIndex()][CC::FICX()][CC::FICY()][CC::FICZ()] == Approx( 1.0 ) );
+            REQUIRE( statistics[StatisticsBuffers::MeanIndex( 0 )][CC::FICX()][CC::FICY()][CC::FICZ()] == Approx( 2.0 ) );
+            REQUIRE( statistics[StatisticsBuffers::CovarianceIndex( 0, 0 )][CC::FICX()][CC::FICY()][CC::FICZ()] == Approx( 1.0 ) );
+         }
+      }
+   }
+}
@@ -0,0 +1,126 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "utilities/storage_pool.h"
+
+namespace {
+   struct LargeObject {
+      double data_[1024];
+   };
+}// namespace
+
+SCENARIO( "The storage pool recycles released chunks", "[1rank]" ) {
+   GIVEN( "A storage pool for large chunks" ) {
+      StoragePool<8192>& pool = StoragePool<8192>::Instance();
+      WHEN( "A chunk is acquired and released" ) {
+         void* const chunk = pool.Acquire();
+         std::size_t const free_chunks = pool.FreeChunkCount();
+         pool.Release( chunk );
+         THEN( "The chunk is kept for reuse" ) {
+            REQUIRE( pool.FreeChunkCount() == free_chunks + 1 );
+            REQUIRE( pool.FreeBytes() == ( free_chunks + 1 ) * 8192 );
+         }
+         THEN( "The same chunk is handed out again" ) {
+            void* const recycled_chunk = pool.Acquire();
+            REQUIRE( recycled_chunk == chunk );
+            pool.Release( recycled_chunk );
+         }
+      }
+   }
+}
+
+SCENARIO( "The pool allocator only pools single large objects", "[1rank]" ) {
+   GIVEN( "Pool allocators for a large and a small type" ) {
+      PoolAllocator<LargeObject> large_allocator;
+      PoolAllocator<double> small_allocator;
+      WHEN( "A large object is freed" ) {
+         LargeObject* const object = large_allocator.allocate( 1 );
+         large_allocator.deallocate( object, 1 );
+         THEN( "Its storage is reused for the next large object" ) {
+            LargeObject* const next_object = large_allocator.allocate( 1 );
+            REQUIRE( next_object == object );
+            large_allocator.deallocate( next_object, 1 );
+         }
+      }
+      WHEN( "Arrays and small objects are allocated" ) {
+         std::size_t const free_chunks = StoragePool<sizeof( LargeObject )>::Instance().FreeChunkCount();
+         LargeObject* const array = large_allocator.allocate( 2 );
+         double* const value = small_allocator.allocate( 1 );
+         THEN( "The pool is not touched" ) {
+            REQUIRE( StoragePool<sizeof( LargeObject )>::Instance().FreeChunkCount() == free_chunks );
+         }
+         large_allocator.deallocate( array, 2 );
+         small_allocator.deallocate( value, 1 );
+      }
+   }
+}
@@ -0,0 +1,135 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+#include "utilities/task_graph.h"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO( "Tasks are executed in the order of their dependencies", "[1rank]" ) {
+   GIVEN( "A graph with independent tasks and a chain of dependent tasks" ) {
+      TaskGraph graph;
+      constexpr unsigned int number_of_tasks = 64;
+      std::vector<int> executed( number_of_tasks, 0 );
+      std::vector<TaskGraph::TaskId> ids;
+      for( unsigned int i = 0; i < number_of_tasks / 2; ++i ) {
+         ids.push_back( graph.AddComputeTask( [&executed, i]() { executed[i]++; } ) );
+      }
+      std::atomic<bool> order_violated = false;
+      for( unsigned int i = number_of_tasks / 2; i < number_of_tasks; ++i ) {
+         ids.push_back( graph.AddComputeTask(
+               [&executed, &order_violated, i]() {
+                  if( executed[i - 1] <= executed[i] ) order_violated = true;
+                  executed[i]++;
+               },
+               { ids[i - 1] } ) );
+      }
+      WHEN( "The graph is run twice" ) {
+         graph.Run();
+         graph.Run();
+         THEN( "Each task is executed once per run and after its dependency" ) {
+            REQUIRE( graph.Size() == number_of_tasks );
+            for( int const count : executed ) {
+               REQUIRE( count == 2 );
+            }
+            REQUIRE_FALSE( order_violated );
+         }
+      }
+   }
+}
+
+SCENARIO( "Communication tasks are polled until they are completed", "[1rank]" ) {
+   GIVEN( "A communication task that completes on the third poll and a dependent compute task" ) {
+      TaskGraph graph;
+      int polls                = 0;
+      int polls_before_compute = -1;
+      TaskGraph::TaskId const communication = graph.AddCommunicationTask( [&polls]() { return ++polls == 3; } );
+      graph.AddComputeTask( [&polls, &polls_before_compute]() { polls_before_compute = polls; }, { communication } );
+      WHEN( "The graph is run" ) {
+         graph.Run();
+         THEN( "The compute task is executed after the communication completed" ) {
+            REQUIRE( polls == 3 );
+            REQUIRE( polls_before_compute == 3 );
+         }
+      }
+   }
+}
+
+SCENARIO( "Invalid graphs and failing tasks are reported", "[1rank]" ) {
+   GIVEN( "A graph with a single task" ) {
+      TaskGraph graph;
+      TaskGraph::TaskId const first = graph.AddComputeTask( []() { throw std::runtime_error( "failed" ); } );
+      THEN( "Depending on a task not yet added throws" ) {
+         REQUIRE_THROWS_AS( graph.AddComputeTask( []() {}, { first + 1 } ), std::logic_error );
+      }
+      THEN( "The exception of the failing task is rethrown by the run" ) {
+         REQUIRE_THROWS_AS( graph.Run(), std::runtime_error );
+      }
+   }
+}